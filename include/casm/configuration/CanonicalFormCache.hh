@@ -0,0 +1,109 @@
+#ifndef CASM_config_CanonicalFormCache
+#define CASM_config_CanonicalFormCache
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Stores canonical form results for configurations of one
+///     supercell, so that repeated queries make one pass over the supercell
+///     symmetry operations
+///
+/// Notes:
+/// - Results are found by `make_canonical_form_info`, using all supercell
+///   symmetry operations, in the order of `SupercellSymOp::begin` to
+///   `SupercellSymOp::end`, and comparing all DoF. So `is_canonical`,
+///   `to_canonical`, `make_invariant_subgroup`, and `make_canonical_form`
+///   give the same results as the free functions with those operations.
+/// - Entries are keyed by the DoF values themselves: a configuration is
+///   looked up by `ConfigurationHash` and then compared to the stored copy
+///   with `operator==`. A configuration whose DoF values were modified since
+///   a previous query therefore does not match the stale entry, and no
+///   explicit invalidation is needed.
+/// - If `max_size` entries are stored, the cache is cleared before a new
+///   entry is added.
+/// - It is safe to call the member functions concurrently. Results are
+///   found without holding the lock, and returned by value.
+class CanonicalFormCache {
+ public:
+  /// \brief Constructor
+  explicit CanonicalFormCache(
+      std::shared_ptr<Supercell const> const &_supercell,
+      Index _max_size = 10000);
+
+  /// \brief The supercell
+  std::shared_ptr<Supercell const> const &supercell() const;
+
+  /// \brief The supercell symmetry operations
+  std::vector<SupercellSymOp> const &ops() const;
+
+  /// \brief Return the canonical form results for a configuration, finding
+  ///     and storing them if necessary
+  CanonicalFormInfo get(Configuration const &configuration);
+
+  /// \brief Return true if a configuration is in canonical form
+  bool is_canonical(Configuration const &configuration);
+
+  /// \brief Return the operation that makes a configuration canonical
+  SupercellSymOp to_canonical(Configuration const &configuration);
+
+  /// \brief Return the operations that leave a configuration invariant
+  std::vector<SupercellSymOp> make_invariant_subgroup(
+      Configuration const &configuration);
+
+  /// \brief Return the canonical form of a configuration
+  Configuration make_canonical_form(Configuration const &configuration);
+
+  /// \brief Return the distinct symmetrically equivalent configurations
+  std::vector<Configuration> make_equivalents(
+      Configuration const &configuration);
+
+  /// \brief Maximum number of entries
+  Index max_size() const;
+
+  /// \brief Number of entries
+  Index size() const;
+
+  /// \brief Number of passes over the operations made, which is the number
+  ///     of cache misses
+  Index n_passes() const;
+
+  /// \brief Erase all entries
+  void clear();
+
+ private:
+  struct Entry {
+    Configuration configuration;
+    CanonicalFormInfo info;
+  };
+
+  std::shared_ptr<Supercell const> m_supercell;
+
+  std::vector<SupercellSymOp> m_ops;
+
+  Index m_max_size;
+
+  Index m_n_passes;
+
+  mutable std::mutex m_mutex;
+
+  /// Entries, in insertion order
+  std::vector<Entry> m_entries;
+
+  /// ConfigurationHash -> index in m_entries
+  std::unordered_multimap<std::size_t, Index> m_index;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,212 @@
+#ifndef CASM_config_CanonicalFormEngine
+#define CASM_config_CanonicalFormEngine
+
+#include <optional>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Holds the results of CanonicalFormEngine::canonicalize
+struct CanonicalFormResult {
+  CanonicalFormResult(Index _to_canonical_index,
+                      SupercellSymOp const &_to_canonical,
+                      std::vector<Index> const &_invariant_subgroup_indices,
+                      Configuration const &_canonical_configuration);
+
+  /// \brief Index into CanonicalFormEngine::ops() of the first operation
+  ///     that makes the configuration canonical
+  Index to_canonical_index;
+
+  /// \brief The first operation that makes the configuration canonical
+  SupercellSymOp to_canonical;
+
+  /// \brief Indices into CanonicalFormEngine::ops() of the operations that
+  ///     leave the configuration invariant
+  std::vector<Index> invariant_subgroup_indices;
+
+  /// \brief The canonical configuration
+  Configuration canonical_configuration;
+};
+
+/// \brief Finds canonical forms of configurations in one supercell using
+///     precomputed site permutation tables
+///
+/// Method:
+/// - The combined permutation (factor group operation followed by
+///   translation) of every operation is computed once, at construction, and
+///   stored in one contiguous buffer with one row of `n_sites` indices per
+///   operation. Transformed occupation values are then read as
+///   `occupation[permutation(op_index)[l]]`, without going through
+///   `SupercellSymOp::permute_index`.
+/// - If the prim has anisotropic occupants, occupant index permutations are
+///   stored in one flat (supercell factor group index, sublattice, occupant)
+///   table, and, parallel to the permutation buffer, each operation has one
+///   row of `n_sites` pointers into that table, selecting the occupant
+///   remap for the source site of each destination site. Transformed
+///   occupant indices are then read as
+///   `occupant_remap(op_index)[l][occupation[permutation(op_index)[l]]]`,
+///   with no factor group or sublattice index arithmetic per site.
+///   Operations that leave every occupant index unchanged, such as the
+///   operations without time reversal for discrete collinear magnetic
+///   occupants, skip the remap and are applied as for isotropic occupants.
+/// - Transformed occupation vectors are compared lexicographically with early
+///   exit, which gives the same ordering as `ConfigCompare`.
+/// - Configurations with continuous DoF are compared using
+///   `ConfigCompare` and `ConfigIsEquivalent` over the same operations, so
+///   all results are identical to those of `to_canonical`,
+///   `make_canonical_form`, and `make_invariant_subgroup`.
+/// - The permutation table requires `ops().size() * n_sites()` indices, and
+///   the occupant remap table, if used, as many pointers.
+class CanonicalFormEngine {
+ public:
+  /// \brief Constructor, using all operations that leave the supercell
+  ///     lattice invariant
+  explicit CanonicalFormEngine(
+      std::shared_ptr<Supercell const> const &_supercell);
+
+  /// \brief Constructor, using a particular group of operations
+  CanonicalFormEngine(std::shared_ptr<Supercell const> const &_supercell,
+                      std::vector<SupercellSymOp> const &_ops);
+
+  /// \brief The supercell
+  std::shared_ptr<Supercell const> const &supercell() const;
+
+  /// \brief The operations used to find canonical forms
+  std::vector<SupercellSymOp> const &ops() const;
+
+  /// \brief Number of sites in the supercell
+  Index n_sites() const;
+
+  /// \brief Pointer to the combined permutation of `ops()[op_index]`
+  Index const *permutation(Index op_index) const;
+
+  /// \brief Pointer to the occupant remap tables of `ops()[op_index]`, or
+  ///     nullptr if `ops()[op_index]` does not transform occupant indices
+  int const *const *occupant_remap(Index op_index) const;
+
+  /// \brief Occupant index on site `l` of `ops()[op_index] * occupation`
+  ///
+  /// Depends only on `occupation[permutation(op_index)[l]]`.
+  int occupation_value(Eigen::VectorXi const &occupation, Index op_index,
+                       Index l) const {
+    return _occ_value(occupation, op_index, l);
+  }
+
+  /// \brief Set `after` to the occupation transformed by `ops()[op_index]`
+  void apply_occupation(Index op_index, Eigen::VectorXi const &before,
+                        Eigen::VectorXi &after) const;
+
+  /// \brief Lexicographically compare `occupation` to
+  ///     `ops()[op_index] * occupation`
+  int compare_occupation(Eigen::VectorXi const &occupation,
+                         Index op_index) const;
+
+  /// \brief Lexicographically compare `ops()[op_index_A] * occupation` to
+  ///     `ops()[op_index_B] * occupation`
+  int compare_occupation(Eigen::VectorXi const &occupation, Index op_index_A,
+                         Index op_index_B) const;
+
+  /// \brief Return true if configuration is in canonical form
+  bool is_canonical(Configuration const &configuration) const;
+
+  /// \brief Return the index into `ops()` of the first operation that makes
+  ///     the configuration canonical
+  Index to_canonical_index(Configuration const &configuration) const;
+
+  /// \brief Return the first operation that makes the configuration canonical
+  SupercellSymOp const &to_canonical(Configuration const &configuration) const;
+
+  /// \brief Return the configuration that compares greater to all
+  ///     equivalents generated by `ops()`
+  Configuration make_canonical_form(Configuration const &configuration) const;
+
+  /// \brief Return the indices into `ops()` of the operations that leave the
+  ///     configuration invariant
+  std::vector<Index> make_invariant_subgroup_indices(
+      Configuration const &configuration) const;
+
+  /// \brief Find the canonical operation index, the invariant subgroup, and
+  ///     the canonical configuration in one pass over the operations
+  CanonicalFormResult canonicalize(Configuration const &configuration) const;
+
+  /// \brief Return `to_canonical_index` for each of many configurations
+  std::vector<Index> to_canonical_indices(
+      std::vector<Configuration> const &configurations, Index n_threads = 1,
+      Index tile_size = 0) const;
+
+  /// \brief Return `make_canonical_form` for each of many configurations
+  std::vector<Configuration> make_canonical_forms(
+      std::vector<Configuration> const &configurations, Index n_threads = 1,
+      Index tile_size = 0) const;
+
+ private:
+  void _throw_if_other_supercell(Configuration const &configuration) const;
+
+  bool _is_occupation_only(Configuration const &configuration) const;
+
+  /// \brief Occupant index on site `l` of `ops()[op_index] * occupation`
+  int _occ_value(Eigen::VectorXi const &occupation, Index op_index,
+                 Index l) const {
+    Index const k = op_index * m_n_sites + l;
+    int const occ = occupation[m_permutations[k]];
+    if (!m_has_aniso_occs || m_op_occ_is_identity[op_index]) {
+      return occ;
+    }
+    return m_occ_remap[k][occ];
+  }
+
+  std::shared_ptr<Supercell const> m_supercell;
+
+  std::vector<SupercellSymOp> m_ops;
+
+  /// \brief Number of sublattices
+  Index m_n_sublat;
+
+  /// \brief Integer supercell volume
+  Index m_n_vol;
+
+  /// \brief Number of sites in the supercell
+  Index m_n_sites;
+
+  /// \brief Combined site permutations, one row of size m_n_sites per
+  ///     operation, such that `after[l] = before[m_permutations[i * n + l]]`
+  std::vector<Index> m_permutations;
+
+  /// \brief Supercell factor group index of each operation
+  std::vector<Index> m_fg_index;
+
+  /// \brief True if occupant indices transform under symmetry
+  bool m_has_aniso_occs;
+
+  /// \brief If m_has_aniso_occs, true for each operation whose occupant
+  ///     index permutations are all the identity
+  std::vector<char> m_op_occ_is_identity;
+
+  /// \brief Maximum number of occupants on any sublattice
+  Index m_max_n_occ;
+
+  /// \brief Occupant index permutations, indexed by
+  ///     `(supercell_fg_index * n_sublat + b) * max_n_occ + occupant_index`
+  std::vector<int> m_occ_permutations;
+
+  /// \brief Occupant remap of the source site of each destination site, one
+  ///     row of size m_n_sites per operation, such that
+  ///     `after[l] = m_occ_remap[k][before[m_permutations[k]]]`, where
+  ///     `k = i * n + l`. Points into m_occ_permutations.
+  std::vector<int const *> m_occ_remap;
+};
+
+/// \brief Return the canonical forms of many configurations in any number
+///     of supercells, grouped by supercell
+std::vector<Configuration> make_canonical_forms_by_supercell(
+    std::vector<Configuration> const &configurations, Index n_threads = 1,
+    std::optional<Index> max_table_bytes = std::nullopt);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef CASM_config_CombinedPermutationTable
+#define CASM_config_CombinedPermutationTable
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Default memory budget, in bytes, of a supercell's
+///     CombinedPermutationTable
+constexpr Index DEFAULT_COMBINED_PERMUTATION_TABLE_MAX_BYTES = 1 << 24;
+
+/// \brief Thread-safe, lazily built table of the combined site permutations
+///     of all operations in a supercell, and their inverses
+///
+/// Notes:
+/// - The combined permutation of the operation with supercell factor group
+///   index `f` and translation index `t` is the same as
+///   `SupercellSymOp(supercell, f, t).combined_permute()`. Rows are built on
+///   first use, together with the inverse permutation, and then kept, so
+///   repeated access does not construct or compose permutations.
+/// - Values are stored as `std::int32_t`, so the table uses
+///   `2 * n_ops * n_sites * sizeof(std::int32_t)` bytes, allocated when the
+///   table is constructed.
+/// - Constructed by `Supercell::combined_permutation_table` if it fits in the
+///   supercell's memory budget. All methods may be called concurrently.
+class CombinedPermutationTable {
+ public:
+  /// \brief Constructor
+  explicit CombinedPermutationTable(Supercell const &supercell);
+
+  /// \brief Return the size in bytes of a table for a supercell
+  static Index required_bytes(Supercell const &supercell);
+
+  /// \brief Number of sites in the supercell
+  Index n_sites() const { return m_n_sites; }
+
+  /// \brief Number of operations, `n_factor_group * n_translations`
+  Index n_ops() const { return m_n_ops; }
+
+  /// \brief Combined permutation of an operation, as `n_sites()` values
+  std::int32_t const *permute(Index supercell_factor_group_index,
+                              Index translation_index) const;
+
+  /// \brief Inverse combined permutation of an operation, as `n_sites()`
+  ///     values
+  std::int32_t const *inverse_permute(Index supercell_factor_group_index,
+                                      Index translation_index) const;
+
+  /// \brief Number of operations whose permutations have been built
+  Index n_built() const { return m_n_built.load(); }
+
+  /// \brief Memory used by the table, in bytes
+  Index size_bytes() const;
+
+ private:
+  /// \brief Return the operation index, building its row on first use
+  Index _row(Index supercell_factor_group_index,
+             Index translation_index) const;
+
+  Supercell const *m_supercell;
+
+  Index m_n_translations;
+
+  Index m_n_sites;
+
+  Index m_n_ops;
+
+  /// \brief One flag per operation, set when its row has been built
+  std::unique_ptr<std::once_flag[]> m_flags;
+
+  mutable std::vector<std::int32_t> m_permute;
+
+  mutable std::vector<std::int32_t> m_inverse_permute;
+
+  mutable std::atomic<Index> m_n_built;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -9,11 +9,18 @@ namespace CASM {
 namespace config {
 
 /// \brief Class for less than comparison of Configurations
-class ConfigCompare {
+///
+/// - ConfigIsEquivalentType may be ConfigIsEquivalent or
+///   OccupationConfigIsEquivalent<HasAnisoOccs>
+template <typename ConfigIsEquivalentType>
+class BasicConfigCompare {
  public:
-  explicit ConfigCompare(ConfigIsEquivalent const &_eq) : m_eq(_eq) {}
-  explicit ConfigCompare(Configuration const &_config,
-                         std::set<std::string> const &_which_dofs)
+  explicit BasicConfigCompare(ConfigIsEquivalentType const &_eq) : m_eq(_eq) {}
+  explicit BasicConfigCompare(Configuration const &_config,
+                              std::set<std::string> const &_which_dofs)
+      : m_eq(_config, _which_dofs) {}
+  explicit BasicConfigCompare(ConfigurationView const &_config,
+                              std::set<std::string> const &_which_dofs)
       : m_eq(_config, _which_dofs) {}
 
   template <typename... Args>
@@ -25,9 +32,56 @@ class ConfigCompare {
   }
 
  private:
-  ConfigIsEquivalent m_eq;
+  ConfigIsEquivalentType m_eq;
 };
 
+/// \brief Class for less than comparison of Configurations
+typedef BasicConfigCompare<ConfigIsEquivalent> ConfigCompare;
+
+/// \brief Call `f` with the less than comparison type that applies to a
+///     configuration
+///
+/// Equivalent to `visit_config_is_equivalent`, but `f` is called with a
+/// `BasicConfigCompare` constructed from the selected equivalence
+/// comparison type.
+///
+/// \param _config The configuration to be compared against
+/// \param f A function, `f(compare_f)`, where `compare_f` is a `const &` to
+///     the comparison object
+/// \param _which_dofs The DoF types to compare, as for `ConfigIsEquivalent`
+///
+/// \returns The result of `f`
+template <typename F>
+auto visit_config_compare(Configuration const &_config, F &&f,
+                          std::set<std::string> const &_which_dofs = {"all"}) {
+  return visit_config_is_equivalent(
+      _config,
+      [&](auto const &equal_to_f) {
+        typedef std::decay_t<decltype(equal_to_f)> equal_to_type;
+        BasicConfigCompare<equal_to_type> const compare_f(equal_to_f);
+        return f(compare_f);
+      },
+      _which_dofs);
+}
+
+/// \brief Call `f` with the less than comparison type that applies to a
+///     view of a configuration
+///
+/// Equivalent to `visit_config_compare` for a Configuration, with the
+/// comparison objects constructed from the view.
+template <typename F>
+auto visit_config_compare(ConfigurationView const &_config, F &&f,
+                          std::set<std::string> const &_which_dofs = {"all"}) {
+  return visit_config_is_equivalent(
+      _config,
+      [&](auto const &equal_to_f) {
+        typedef std::decay_t<decltype(equal_to_f)> equal_to_type;
+        BasicConfigCompare<equal_to_type> const compare_f(equal_to_f);
+        return f(compare_f);
+      },
+      _which_dofs);
+}
+
 }  // namespace config
 }  // namespace CASM
 
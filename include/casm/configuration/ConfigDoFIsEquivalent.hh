@@ -1,58 +1,144 @@
 #ifndef CASM_config_ConfigDoFIsEquivalent
 #define CASM_config_ConfigDoFIsEquivalent
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
 #include "casm/clexulator/ConfigDoFValues.hh"
 #include "casm/clexulator/ConfigDoFValuesTools.hh"
 #include "casm/configuration/PrimSymInfo.hh"
 #include "casm/configuration/Supercell.hh"
 #include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/perf.hh"
 
 namespace CASM {
 namespace config {
 
+/// \brief Return a continuous DoF value quantized onto a grid with spacing
+///     `tol`
+///
+/// Values are mapped to the nearest integer multiple of `tol`, so quantized
+/// comparisons are exact integer comparisons that are transitive and
+/// consistent with hashing. Values that differ by less than `tol` may be
+/// quantized to adjacent keys if they are near a grid boundary.
+inline std::int64_t quantize_dof_value(double value, double tol) {
+  return static_cast<std::int64_t>(std::llround(value / tol));
+}
+
 /// Namespace containing DoF comparison functors
+///
+/// The functors keep a reference to the DoF values they are constructed
+/// with, which may be owned by a Configuration or by an external buffer
+/// (see ConfigurationView), and must not be modified or destroyed while the
+/// functor is in use. Values are passed as `Eigen::Ref` so that both
+/// Eigen vectors and matrices and contiguous `Eigen::Map` are accepted
+/// without copying. Operations are passed as `SupercellSymOpRef`, to which
+/// `SupercellSymOp` converts without copying its supercell shared_ptr.
 namespace ConfigDoFIsEquivalent {
 
+/// \brief Read-only reference to occupation values
+typedef Eigen::Ref<Eigen::VectorXi const> OccupationRef;
+
+/// \brief Read-only reference to local continuous DoF values
+typedef Eigen::Ref<Eigen::MatrixXd const> LocalValuesRef;
+
+/// \brief Read-only reference to global continuous DoF values
+typedef Eigen::Ref<Eigen::VectorXd const> GlobalValuesRef;
+
 /// Compare isotropic occupation values
 ///
 /// - The protected '_check' method provides for both checking equality and if
 ///   not equivalent, storing the 'less than' result
+///
+/// Method:
+/// - If all occupant indices fit in one byte, a packed uint8 copy of the
+///   occupation is made at construction. Comparisons of the occupation with
+///   itself under transformation by one or two SupercellSymOp then gather
+///   permuted values into small blocks of bytes and compare whole blocks at
+///   once, only searching for the first differing site in a block that
+///   differs.
+/// - Site permutations are read directly from the supercell factor group and
+///   translation permutation tables, once per comparison. For operations
+///   with supercell factor group index 0 (pure translations) only the
+///   translation permutation is applied.
+/// - Comparisons with "other" occupation values, or in supercells which
+///   compute translated site indices instead of storing translation
+///   permutations, use element-wise comparison.
 class Occupation {
  public:
-  Occupation(Eigen::VectorXi const &_occupation)
-      : m_occupation_ptr(&_occupation) {}
+  Occupation(OccupationRef const &_occupation)
+      : m_occupation_data(_occupation.data()),
+        m_occupation_size(_occupation.size()) {
+    if ((_occupation.array() >= 0).all() &&
+        (_occupation.array() <= 255).all()) {
+      m_packed.resize(_occupation.size());
+      for (Index i = 0; i < _occupation.size(); ++i) {
+        m_packed[i] = static_cast<std::uint8_t>(_occupation[i]);
+      }
+      m_is_packed = true;
+    } else {
+      m_is_packed = false;
+    }
+  }
 
   /// \brief Return config == other, store config < other
-  bool operator()(Eigen::VectorXi const &other) const {
-    return _for_each([&](Index i) { return (*m_occupation_ptr)[i]; },
+  bool operator()(OccupationRef const &other) const {
+    return _for_each([&](Index i) { return m_occupation_data[i]; },
                      [&](Index i) { return other[i]; });
   }
 
   /// \brief Return config == A*config, store config < A*config
-  bool operator()(SupercellSymOp const &A) const {
+  bool operator()(SupercellSymOpRef const &A) const {
+    SitePermutation perm_A;
+    if (m_is_packed && _get_site_permutation(A, perm_A)) {
+      return _for_each_block(
+          [&](Index begin, Index, std::uint8_t *) {
+            return m_packed.data() + begin;
+          },
+          [&](Index begin, Index n, std::uint8_t *buffer) {
+            return _gather(perm_A, begin, n, buffer);
+          });
+    }
     return _for_each(
-        [&](Index i) { return (*m_occupation_ptr)[i]; },
-        [&](Index i) { return (*m_occupation_ptr)[A.permute_index(i)]; });
+        [&](Index i) { return m_occupation_data[i]; },
+        [&](Index i) { return m_occupation_data[A.permute_index(i)]; });
   }
 
   /// \brief Return A*config == B*config, store A*config < B*config
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B) const {
+  bool operator()(SupercellSymOpRef const &A,
+                  SupercellSymOpRef const &B) const {
+    SitePermutation perm_A;
+    SitePermutation perm_B;
+    if (m_is_packed && _get_site_permutation(A, perm_A) &&
+        _get_site_permutation(B, perm_B)) {
+      return _for_each_block(
+          [&](Index begin, Index n, std::uint8_t *buffer) {
+            return _gather(perm_A, begin, n, buffer);
+          },
+          [&](Index begin, Index n, std::uint8_t *buffer) {
+            return _gather(perm_B, begin, n, buffer);
+          });
+    }
     return _for_each(
-        [&](Index i) { return (*m_occupation_ptr)[A.permute_index(i)]; },
-        [&](Index i) { return (*m_occupation_ptr)[B.permute_index(i)]; });
+        [&](Index i) { return m_occupation_data[A.permute_index(i)]; },
+        [&](Index i) { return m_occupation_data[B.permute_index(i)]; });
   }
 
   /// \brief Return config == A*other, store config < A*other
-  bool operator()(SupercellSymOp const &A, Eigen::VectorXi const &other) const {
-    return _for_each([&](Index i) { return (*m_occupation_ptr)[i]; },
+  bool operator()(SupercellSymOpRef const &A,
+                  OccupationRef const &other) const {
+    return _for_each([&](Index i) { return m_occupation_data[i]; },
                      [&](Index i) { return other[A.permute_index(i)]; });
   }
 
   /// \brief Return A*config == B*other, store A*config < B*other
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B,
-                  Eigen::VectorXi const &other) const {
+  bool operator()(SupercellSymOpRef const &A, SupercellSymOpRef const &B,
+                  OccupationRef const &other) const {
     return _for_each(
-        [&](Index i) { return (*m_occupation_ptr)[A.permute_index(i)]; },
+        [&](Index i) { return m_occupation_data[A.permute_index(i)]; },
         [&](Index i) { return other[B.permute_index(i)]; });
   }
 
@@ -65,8 +151,98 @@ class Occupation {
   template <typename F, typename G>
   bool _for_each(F f, G g) const {
     Index i;
-    for (i = 0; i < m_occupation_ptr->size(); i++) {
+    for (i = 0; i < m_occupation_size; i++) {
       if (!_check(f(i), g(i))) {
+        CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_early_exit);
+        CASM_CONFIGURATION_PERF_COUNT_N(config_is_equivalent_early_exit_depth,
+                                        i);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// \brief Number of sites compared at once by `_for_each_block`
+  static constexpr Index block_size = 64;
+
+  /// \brief Site permutation, `after[i] = before[fg[trans[i]]]`, with
+  ///     `fg == nullptr` for the identity factor group operation
+  struct SitePermutation {
+    Index const *fg;
+    Index const *trans;
+
+    /// Holds a translation permutation obtained from the supercell's
+    /// translation permutation cache while it is in use
+    std::shared_ptr<sym_info::Permutation const> trans_holder;
+  };
+
+  /// \brief Get the site permutation of `A` from the supercell permutation
+  ///     tables, if they are stored or cached
+  static bool _get_site_permutation(SupercellSymOpRef const &A,
+                                    SitePermutation &perm) {
+    Supercell const &supercell = A.supercell();
+    SupercellSymInfo const &sym_info = supercell.sym_info;
+    Index fg_index = A.supercell_factor_group_index();
+    if (sym_info.translation_permutations.has_value()) {
+      perm.trans =
+          (*sym_info.translation_permutations)[A.translation_index()].data();
+    } else if (sym_info.translation_permutation_cache->max_bytes() != 0) {
+      perm.trans_holder = sym_info.translation_permutation_cache->get(
+          A.translation_index(), supercell.unitcell_index_converter,
+          supercell.unitcellcoord_index_converter,
+          supercell.diagonal_index_converter.get());
+      perm.trans = perm.trans_holder->data();
+    } else {
+      return false;
+    }
+    perm.fg = (fg_index == 0)
+                  ? nullptr
+                  : sym_info.factor_group_permutations[fg_index].data();
+    return true;
+  }
+
+  /// \brief Set `buffer[k]` to the packed value on site `begin + k` after
+  ///     permutation, for `k < n`, and return `buffer`
+  std::uint8_t const *_gather(SitePermutation const &perm, Index begin,
+                              Index n, std::uint8_t *buffer) const {
+    std::uint8_t const *packed = m_packed.data();
+    Index const *trans = perm.trans + begin;
+    if (perm.fg == nullptr) {
+      for (Index k = 0; k < n; ++k) {
+        buffer[k] = packed[trans[k]];
+      }
+    } else {
+      Index const *fg = perm.fg;
+      for (Index k = 0; k < n; ++k) {
+        buffer[k] = packed[fg[trans[k]]];
+      }
+    }
+    return buffer;
+  }
+
+  /// \brief Compare packed values block by block
+  ///
+  /// \param f,g Functions `(Index begin, Index n, std::uint8_t *buffer) ->
+  ///     std::uint8_t const*` which return a pointer to the `n` values
+  ///     starting with site `begin`, optionally using `buffer` as storage.
+  template <typename F, typename G>
+  bool _for_each_block(F f, G g) const {
+    std::uint8_t buffer_A[block_size];
+    std::uint8_t buffer_B[block_size];
+    Index size = m_packed.size();
+    for (Index begin = 0; begin < size; begin += block_size) {
+      Index n = std::min(block_size, size - begin);
+      std::uint8_t const *A = f(begin, n, buffer_A);
+      std::uint8_t const *B = g(begin, n, buffer_B);
+      if (std::memcmp(A, B, n) != 0) {
+        Index k = 0;
+        while (A[k] == B[k]) {
+          ++k;
+        }
+        m_less = (A[k] < B[k]);
+        CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_early_exit);
+        CASM_CONFIGURATION_PERF_COUNT_N(config_is_equivalent_early_exit_depth,
+                                        begin + k);
         return false;
       }
     }
@@ -83,7 +259,15 @@ class Occupation {
     return false;
   }
 
-  Eigen::VectorXi const *m_occupation_ptr;
+  /// Occupation values this was constructed with
+  int const *m_occupation_data;
+  Index m_occupation_size;
+
+  /// Packed copy of the occupation, if `m_is_packed`
+  std::vector<std::uint8_t> m_packed;
+
+  /// True if all occupant indices fit in `std::uint8_t`
+  bool m_is_packed;
 
   /// Stores (A < B) if A != B
   mutable bool m_less;
@@ -106,10 +290,11 @@ class Occupation {
 ///   is called because it cannot be guaranteed that the "other" is the same.
 class AnisoOccupation {
  public:
-  AnisoOccupation(Eigen::VectorXi const &_occupation, Index n_sublat)
+  AnisoOccupation(OccupationRef const &_occupation, Index n_sublat)
       : m_n_sublat(n_sublat),
         m_n_vol(_occupation.size() / m_n_sublat),
-        m_occupation_ptr(&_occupation),
+        m_occupation_data(_occupation.data()),
+        m_occupation_size(_occupation.size()),
         m_tmp_valid(true),
         m_fg_index_A(0),
         m_new_occ_A(_occupation),
@@ -117,25 +302,26 @@ class AnisoOccupation {
         m_new_occ_B(_occupation) {}
 
   /// \brief Return config == other, store config < other
-  bool operator()(Eigen::VectorXi const &other) const {
-    return _for_each([&](Index i) { return (*m_occupation_ptr)[i]; },
+  bool operator()(OccupationRef const &other) const {
+    return _for_each([&](Index i) { return m_occupation_data[i]; },
                      [&](Index i) { return other[i]; });
   }
 
   /// \brief Return config == B*config, store config < B*config
-  bool operator()(SupercellSymOp const &B) const {
-    _update_B(B, *m_occupation_ptr);
+  bool operator()(SupercellSymOpRef const &B) const {
+    _update_B(B, _occupation());
     m_tmp_valid = true;
 
     return _for_each(
-        [&](Index i) { return (*m_occupation_ptr)[i]; },
+        [&](Index i) { return m_occupation_data[i]; },
         [&](Index i) { return this->m_new_occ_B[B.permute_index(i)]; });
   }
 
   /// \brief Return A*config == B*config, store A*config < B*config
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B) const {
-    _update_A(A, *m_occupation_ptr);
-    _update_B(B, *m_occupation_ptr);
+  bool operator()(SupercellSymOpRef const &A,
+                  SupercellSymOpRef const &B) const {
+    _update_A(A, _occupation());
+    _update_B(B, _occupation());
     m_tmp_valid = true;
 
     return _for_each(
@@ -144,19 +330,20 @@ class AnisoOccupation {
   }
 
   /// \brief Return config == B*other, store config < B*other
-  bool operator()(SupercellSymOp const &B, Eigen::VectorXi const &other) const {
+  bool operator()(SupercellSymOpRef const &B,
+                  OccupationRef const &other) const {
     _update_B(B, other);
     m_tmp_valid = false;
 
     return _for_each(
-        [&](Index i) { return (*m_occupation_ptr)[i]; },
+        [&](Index i) { return m_occupation_data[i]; },
         [&](Index i) { return this->m_new_occ_B[B.permute_index(i)]; });
   }
 
   /// \brief Return A*config == B*other, store A*config < B*other
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B,
-                  Eigen::VectorXi const &other) const {
-    _update_A(A, *m_occupation_ptr);
+  bool operator()(SupercellSymOpRef const &A, SupercellSymOpRef const &B,
+                  OccupationRef const &other) const {
+    _update_A(A, _occupation());
     _update_B(B, other);
     m_tmp_valid = false;
 
@@ -174,20 +361,24 @@ class AnisoOccupation {
   template <typename F, typename G>
   bool _for_each(F f, G g) const {
     Index i;
-    for (i = 0; i < m_occupation_ptr->size(); i++) {
+    for (i = 0; i < m_occupation_size; i++) {
       if (!_check(f(i), g(i))) {
+        CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_early_exit);
+        CASM_CONFIGURATION_PERF_COUNT_N(config_is_equivalent_early_exit_depth,
+                                        i);
         return false;
       }
     }
     return true;
   }
 
-  void _update_A(SupercellSymOp const &A, Eigen::VectorXi const &before) const {
+  void _update_A(SupercellSymOpRef const &A,
+                 OccupationRef const &before) const {
     if (A.supercell_factor_group_index() != m_fg_index_A || !m_tmp_valid) {
       m_fg_index_A = A.supercell_factor_group_index();
       Index l = 0;
-      PrimSymInfo const &prim_sym_info = A.supercell()->prim->sym_info;
-      SupercellSymInfo const &supercell_sym_info = A.supercell()->sym_info;
+      PrimSymInfo const &prim_sym_info = A.supercell().prim->sym_info;
+      SupercellSymInfo const &supercell_sym_info = A.supercell().sym_info;
       Index prim_fg_index =
           supercell_sym_info.factor_group->head_group_index[m_fg_index_A];
       for (Index b = 0; b < m_n_sublat; ++b) {
@@ -200,12 +391,13 @@ class AnisoOccupation {
     }
   }
 
-  void _update_B(SupercellSymOp const &B, Eigen::VectorXi const &before) const {
+  void _update_B(SupercellSymOpRef const &B,
+                 OccupationRef const &before) const {
     if (B.supercell_factor_group_index() != m_fg_index_B || !m_tmp_valid) {
       m_fg_index_B = B.supercell_factor_group_index();
       Index l = 0;
-      PrimSymInfo const &prim_sym_info = B.supercell()->prim->sym_info;
-      SupercellSymInfo const &supercell_sym_info = B.supercell()->sym_info;
+      PrimSymInfo const &prim_sym_info = B.supercell().prim->sym_info;
+      SupercellSymInfo const &supercell_sym_info = B.supercell().sym_info;
       Index prim_fg_index =
           supercell_sym_info.factor_group->head_group_index[m_fg_index_B];
       for (Index b = 0; b < m_n_sublat; ++b) {
@@ -219,6 +411,11 @@ class AnisoOccupation {
   }
 
  private:
+  Eigen::Map<Eigen::VectorXi const> _occupation() const {
+    return Eigen::Map<Eigen::VectorXi const>(m_occupation_data,
+                                             m_occupation_size);
+  }
+
   template <typename T>
   bool _check(const T &A, const T &B) const {
     if (A == B) {
@@ -232,8 +429,9 @@ class AnisoOccupation {
 
   Index m_n_vol;
 
-  // Points to ConfigDoF this was constructed with
-  Eigen::VectorXi const *m_occupation_ptr;
+  // Occupation values this was constructed with
+  int const *m_occupation_data;
+  Index m_occupation_size;
 
   // Set to false when comparison is made to "other" ConfigDoF, to force update
   // of temporary dof during the next comparison
@@ -263,29 +461,54 @@ class AnisoOccupation {
 ///   comparison is made against an "other" ConfigDoF to force update of the
 ///   transformed variables in the temporary vectors the next time the functor
 ///   is called because it cannot be guaranteed that the "other" is the same.
+/// - If constructed with `_cache_by_factor_group_op == true`, the values of
+///   the configuration this was constructed with are transformed at most once
+///   per supercell factor group operation, and kept in 'm_transformed' for
+///   all subsequent comparisons of the configuration with itself, so
+///   comparisons under operations in any order only permute columns. This
+///   requires storing up to one copy of the values per supercell factor group
+///   operation.
+/// - If constructed with `_quantize == true`, values are compared as keys
+///   quantized onto a grid with spacing `_tol` (see `quantize_dof_value`),
+///   instead of within the tolerance `_tol`, which makes the comparison a
+///   strict weak ordering consistent with `QuantizedConfigurationHash`.
 class Local {
  public:
-  Local(Eigen::MatrixXd const &_values, DoFKey const &_key, Index n_sublat,
-        double _tol)
-      : m_values_ptr(&_values),
+  Local(LocalValuesRef const &_values, DoFKey const &_key, Index n_sublat,
+        double _tol, bool _cache_by_factor_group_op = false,
+        bool _quantize = false)
+      : m_values_data(_values.data()),
+        m_values_rows(_values.rows()),
+        m_values_cols(_values.cols()),
         m_key(_key),
         m_n_sublat(n_sublat),
         m_n_vol(_values.cols() / n_sublat),
         m_tol(_tol),
+        m_quantize(_quantize),
+        m_cache_by_factor_group_op(_cache_by_factor_group_op),
         m_tmp_valid(true),
         m_fg_index_A(0),
-        m_new_dof_A(*m_values_ptr),
+        m_new_dof_A(_values),
         m_fg_index_B(0),
-        m_new_dof_B(*m_values_ptr) {}
+        m_new_dof_B(_values) {}
 
   /// \brief Return config == other, store config < other
-  bool operator()(Eigen::MatrixXd const &other) const {
+  bool operator()(LocalValuesRef const &other) const {
     return _for_each([&](Index i, Index j) { return this->_values()(i, j); },
                      [&](Index i, Index j) { return other(i, j); });
   }
 
   /// \brief Return config == B*config, store config < B*config
-  bool operator()(SupercellSymOp const &B) const {
+  bool operator()(SupercellSymOpRef const &B) const {
+    if (m_cache_by_factor_group_op) {
+      Eigen::MatrixXd const &transformed_B = _transformed(B);
+      return _for_each(
+          [&](Index i, Index j) { return this->_values()(i, j); },
+          [&](Index i, Index j) {
+            return transformed_B(i, B.permute_index(j));
+          });
+    }
+
     _update_B(B, _values());
     m_tmp_valid = true;
 
@@ -296,7 +519,20 @@ class Local {
   }
 
   /// \brief Return A*config == B*config, store A*config < B*config
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B) const {
+  bool operator()(SupercellSymOpRef const &A,
+                  SupercellSymOpRef const &B) const {
+    if (m_cache_by_factor_group_op) {
+      Eigen::MatrixXd const &transformed_A = _transformed(A);
+      Eigen::MatrixXd const &transformed_B = _transformed(B);
+      return _for_each(
+          [&](Index i, Index j) {
+            return transformed_A(i, A.permute_index(j));
+          },
+          [&](Index i, Index j) {
+            return transformed_B(i, B.permute_index(j));
+          });
+    }
+
     _update_A(A, _values());
     _update_B(B, _values());
     m_tmp_valid = true;
@@ -310,7 +546,8 @@ class Local {
   }
 
   /// \brief Return config == B*other, store config < B*other
-  bool operator()(SupercellSymOp const &B, Eigen::MatrixXd const &other) const {
+  bool operator()(SupercellSymOpRef const &B,
+                  LocalValuesRef const &other) const {
     _update_B(B, other);
     m_tmp_valid = false;
 
@@ -321,8 +558,8 @@ class Local {
   }
 
   /// \brief Return A*config == B*other, store A*config < B*other
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B,
-                  Eigen::MatrixXd const &other) const {
+  bool operator()(SupercellSymOpRef const &A, SupercellSymOpRef const &B,
+                  LocalValuesRef const &other) const {
     _update_A(A, _values());
     _update_B(B, other);
     m_tmp_valid = false;
@@ -342,41 +579,59 @@ class Local {
   bool is_less() const { return m_less; }
 
  private:
-  Eigen::MatrixXd const &_values() const { return *m_values_ptr; }
+  Eigen::Map<Eigen::MatrixXd const> _values() const {
+    return Eigen::Map<Eigen::MatrixXd const>(m_values_data, m_values_rows,
+                                             m_values_cols);
+  }
 
-  void _update_A(SupercellSymOp const &A, Eigen::MatrixXd const &before) const {
+  /// \brief Set `after` to `before` transformed by the factor group
+  ///     operation of `A`, without site permutation
+  void _transform(SupercellSymOpRef const &A, LocalValuesRef const &before,
+                  Eigen::MatrixXd &after) const {
     using clexulator::sublattice_block;
+    PrimSymInfo const &prim_sym_info = A.supercell().prim->sym_info;
+    SupercellSymInfo const &supercell_sym_info = A.supercell().sym_info;
+    Index prim_fg_index =
+        supercell_sym_info.factor_group
+            ->head_group_index[A.supercell_factor_group_index()];
+    sym_info::PackedDoFSymGroupRep const &rep =
+        prim_sym_info.packed_local_dof_symgroup_rep.at(m_key);
+    for (Index b = 0; b < m_n_sublat; ++b) {
+      rep.apply(prim_fg_index, b, before.middleCols(b * m_n_vol, m_n_vol),
+                sublattice_block(after, b, m_n_vol));
+    }
+  }
+
+  /// \brief Return the values of the configuration transformed by the factor
+  ///     group operation of `A`, computing them on first use
+  Eigen::MatrixXd const &_transformed(SupercellSymOpRef const &A) const {
+    if (m_is_transformed.empty()) {
+      Index n_fg = A.supercell().sym_info.factor_group->element.size();
+      m_transformed.resize(n_fg);
+      m_is_transformed.resize(n_fg, false);
+    }
+    Index fg_index = A.supercell_factor_group_index();
+    if (!m_is_transformed[fg_index]) {
+      m_transformed[fg_index] = _values();
+      _transform(A, _values(), m_transformed[fg_index]);
+      m_is_transformed[fg_index] = true;
+    }
+    return m_transformed[fg_index];
+  }
+
+  void _update_A(SupercellSymOpRef const &A,
+                 LocalValuesRef const &before) const {
     if (A.supercell_factor_group_index() != m_fg_index_A || !m_tmp_valid) {
-      PrimSymInfo const &prim_sym_info = A.supercell()->prim->sym_info;
       m_fg_index_A = A.supercell_factor_group_index();
-      SupercellSymInfo const &supercell_sym_info = A.supercell()->sym_info;
-      Index prim_fg_index =
-          supercell_sym_info.factor_group->head_group_index[m_fg_index_A];
-      for (Index b = 0; b < m_n_sublat; ++b) {
-        Eigen::MatrixXd const &M =
-            prim_sym_info.local_dof_symgroup_rep.at(m_key)[prim_fg_index][b];
-        Index dim = M.cols();
-        sublattice_block(m_new_dof_A, b, m_n_vol).topRows(dim) =
-            M * sublattice_block(before, b, m_n_vol).topRows(dim);
-      }
+      _transform(A, before, m_new_dof_A);
     }
   }
 
-  void _update_B(SupercellSymOp const &B, Eigen::MatrixXd const &before) const {
-    using clexulator::sublattice_block;
+  void _update_B(SupercellSymOpRef const &B,
+                 LocalValuesRef const &before) const {
     if (B.supercell_factor_group_index() != m_fg_index_B || !m_tmp_valid) {
-      PrimSymInfo const &prim_sym_info = B.supercell()->prim->sym_info;
       m_fg_index_B = B.supercell_factor_group_index();
-      SupercellSymInfo const &supercell_sym_info = B.supercell()->sym_info;
-      Index prim_fg_index =
-          supercell_sym_info.factor_group->head_group_index[m_fg_index_B];
-      for (Index b = 0; b < m_n_sublat; ++b) {
-        Eigen::MatrixXd const &M =
-            prim_sym_info.local_dof_symgroup_rep.at(m_key)[prim_fg_index][b];
-        Index dim = M.cols();
-        sublattice_block(m_new_dof_B, b, m_n_vol).topRows(dim) =
-            M * sublattice_block(before, b, m_n_vol).topRows(dim);
-      }
+      _transform(B, before, m_new_dof_B);
     }
   }
 
@@ -386,6 +641,15 @@ class Local {
 
   template <typename T>
   bool _check(const T &A, const T &B) const {
+    if (m_quantize) {
+      std::int64_t qA = quantize_dof_value(A, m_tol);
+      std::int64_t qB = quantize_dof_value(B, m_tol);
+      if (qA != qB) {
+        m_less = qA < qB;
+        return false;
+      }
+      return true;
+    }
     if (A < B - m_tol) {
       m_less = true;
       return false;
@@ -400,8 +664,8 @@ class Local {
   template <typename F, typename G>
   bool _for_each(F f, G g) const {
     Index i, j;
-    for (j = 0; j < _values().cols(); j++) {
-      for (i = 0; i < _values().rows(); i++) {
+    for (j = 0; j < m_values_cols; j++) {
+      for (i = 0; i < m_values_rows; i++) {
         if (!_check(f(i, j), g(i, j))) {
           return false;
         }
@@ -410,9 +674,10 @@ class Local {
     return true;
   }
 
-  // Points to LocalContinuousConfigDoFValues of ConfigDoF this was constructed
-  // with
-  Eigen::MatrixXd const *m_values_ptr;
+  // Local continuous DoF values this was constructed with
+  double const *m_values_data;
+  Index m_values_rows;
+  Index m_values_cols;
 
   // DoF type (used to obtain matrix rep)
   DoFKey m_key;
@@ -426,6 +691,17 @@ class Local {
   // Tolerance for comparisons
   double m_tol;
 
+  // If true, compare values quantized onto a grid with spacing m_tol
+  bool m_quantize;
+
+  // If true, keep the values transformed by each factor group operation
+  bool m_cache_by_factor_group_op;
+
+  // Values transformed by each supercell factor group operation, if
+  // m_cache_by_factor_group_op and m_is_transformed[fg_index]
+  mutable std::vector<Eigen::MatrixXd> m_transformed;
+  mutable std::vector<bool> m_is_transformed;
+
   // Set to false when comparison is made to "other" ConfigDoF, to force update
   // of temporary dof during the next comparison
   mutable bool m_tmp_valid;
@@ -445,26 +721,32 @@ class Local {
 /// Compare continuous global DoF values
 ///
 /// - Compares global DoF values lexicographically
+/// - If `_quantize` is true, values are compared as keys quantized onto a
+///   grid with spacing `_tol` (see `quantize_dof_value`), instead of within
+///   the tolerance `_tol`
 class Global {
  public:
-  Global(Eigen::VectorXd const &_values, DoFKey const &_key, double _tol)
-      : m_values_ptr(&_values),
+  Global(GlobalValuesRef const &_values, DoFKey const &_key, double _tol,
+         bool _quantize = false)
+      : m_values_data(_values.data()),
+        m_values_size(_values.size()),
         m_key(_key),
         m_tol(_tol),
+        m_quantize(_quantize),
         m_tmp_valid(true),
         m_fg_index_A(0),
-        m_new_dof_A(*m_values_ptr),
+        m_new_dof_A(_values),
         m_fg_index_B(0),
-        m_new_dof_B(*m_values_ptr) {}
+        m_new_dof_B(_values) {}
 
   /// \brief Return config == other, store config < other
-  bool operator()(Eigen::VectorXd const &other) const {
+  bool operator()(GlobalValuesRef const &other) const {
     return _for_each([&](Index i) { return this->_values(i); },
                      [&](Index i) { return other[i]; });
   }
 
   /// \brief Return config == B*config, store config < B*config
-  bool operator()(SupercellSymOp const &B) const {
+  bool operator()(SupercellSymOpRef const &B) const {
     _update_B(B, _values());
     m_tmp_valid = true;
     return _for_each([&](Index i) { return this->_values(i); },
@@ -472,7 +754,8 @@ class Global {
   }
 
   /// \brief Return A*config == B*config, store A*config < B*config
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B) const {
+  bool operator()(SupercellSymOpRef const &A,
+                  SupercellSymOpRef const &B) const {
     _update_A(A, _values());
     _update_B(B, _values());
     m_tmp_valid = true;
@@ -481,7 +764,8 @@ class Global {
   }
 
   /// \brief Return config == B*other, store config < B*other
-  bool operator()(SupercellSymOp const &B, Eigen::VectorXd const &other) const {
+  bool operator()(SupercellSymOpRef const &B,
+                  GlobalValuesRef const &other) const {
     _update_B(B, other);
     m_tmp_valid = false;
     return _for_each([&](Index i) { return this->_values()[i]; },
@@ -489,8 +773,8 @@ class Global {
   }
 
   /// \brief Return A*config == B*other, store A*config < B*other
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B,
-                  Eigen::VectorXd const &other) const {
+  bool operator()(SupercellSymOpRef const &A, SupercellSymOpRef const &B,
+                  GlobalValuesRef const &other) const {
     _update_A(A, _values());
     _update_B(B, other);
     m_tmp_valid = false;
@@ -504,35 +788,39 @@ class Global {
   bool is_less() const { return m_less; }
 
  private:
-  void _update_A(SupercellSymOp const &A, Eigen::VectorXd const &before) const {
+  void _update_A(SupercellSymOpRef const &A,
+                 GlobalValuesRef const &before) const {
     if (A.supercell_factor_group_index() != m_fg_index_A || !m_tmp_valid) {
-      PrimSymInfo const &prim_sym_info = A.supercell()->prim->sym_info;
+      PrimSymInfo const &prim_sym_info = A.supercell().prim->sym_info;
       m_fg_index_A = A.supercell_factor_group_index();
-      SupercellSymInfo const &supercell_sym_info = A.supercell()->sym_info;
+      SupercellSymInfo const &supercell_sym_info = A.supercell().sym_info;
       Index prim_fg_index =
           supercell_sym_info.factor_group->head_group_index[m_fg_index_A];
-      Eigen::MatrixXd const &M =
-          prim_sym_info.global_dof_symgroup_rep.at(m_key)[prim_fg_index];
-      m_new_dof_A = M * before;
+      m_new_dof_A.resize(before.size());
+      prim_sym_info.packed_global_dof_symgroup_rep.at(m_key).apply(
+          prim_fg_index, 0, before, m_new_dof_A);
     }
   }
 
-  void _update_B(SupercellSymOp const &B, Eigen::VectorXd const &before) const {
+  void _update_B(SupercellSymOpRef const &B,
+                 GlobalValuesRef const &before) const {
     if (B.supercell_factor_group_index() != m_fg_index_B || !m_tmp_valid) {
-      PrimSymInfo const &prim_sym_info = B.supercell()->prim->sym_info;
+      PrimSymInfo const &prim_sym_info = B.supercell().prim->sym_info;
       m_fg_index_B = B.supercell_factor_group_index();
-      SupercellSymInfo const &supercell_sym_info = B.supercell()->sym_info;
+      SupercellSymInfo const &supercell_sym_info = B.supercell().sym_info;
       Index prim_fg_index =
           supercell_sym_info.factor_group->head_group_index[m_fg_index_B];
-      Eigen::MatrixXd const &M =
-          prim_sym_info.global_dof_symgroup_rep.at(m_key)[prim_fg_index];
-      m_new_dof_B = M * before;
+      m_new_dof_B.resize(before.size());
+      prim_sym_info.packed_global_dof_symgroup_rep.at(m_key).apply(
+          prim_fg_index, 0, before, m_new_dof_B);
     }
   }
 
-  Eigen::VectorXd const &_values() const { return *m_values_ptr; }
+  Eigen::Map<Eigen::VectorXd const> _values() const {
+    return Eigen::Map<Eigen::VectorXd const>(m_values_data, m_values_size);
+  }
 
-  double _values(Index i) const { return _values()[i]; }
+  double _values(Index i) const { return m_values_data[i]; }
 
   double _new_dof_A(Index i) const { return m_new_dof_A[i]; }
 
@@ -540,6 +828,15 @@ class Global {
 
   template <typename T>
   bool _check(const T &A, const T &B) const {
+    if (m_quantize) {
+      std::int64_t qA = quantize_dof_value(A, m_tol);
+      std::int64_t qB = quantize_dof_value(B, m_tol);
+      if (qA != qB) {
+        m_less = qA < qB;
+        return false;
+      }
+      return true;
+    }
     if (A < B - m_tol) {
       m_less = true;
       return false;
@@ -554,7 +851,7 @@ class Global {
   template <typename F, typename G>
   bool _for_each(F f, G g) const {
     Index i;
-    for (i = 0; i < _values().size(); i++) {
+    for (i = 0; i < m_values_size; i++) {
       if (!_check(f(i), g(i))) {
         return false;
       }
@@ -562,9 +859,9 @@ class Global {
     return true;
   }
 
-  // Points to GlobalContinuousConfigDoFValues of ConfigDoF this was constructed
-  // with
-  Eigen::VectorXd const *m_values_ptr;
+  // Global continuous DoF values this was constructed with
+  double const *m_values_data;
+  Index m_values_size;
 
   // DoF type (used to obtain matrix rep)
   DoFKey m_key;
@@ -572,6 +869,9 @@ class Global {
   // Tolerance for comparison
   double m_tol;
 
+  // If true, compare values quantized onto a grid with spacing m_tol
+  bool m_quantize;
+
   // Set to false when comparison is made to "other" ConfigDoF, to force update
   // of temporary dof during the next comparison
   mutable bool m_tmp_valid;
@@ -1,9 +1,14 @@
 #ifndef CASM_config_ConfigIsEquivalent
 #define CASM_config_ConfigIsEquivalent
 
+#include <optional>
+#include <type_traits>
+
 #include "casm/configuration/ConfigDoFIsEquivalent.hh"
 #include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationView.hh"
 #include "casm/configuration/Supercell.hh"
+#include "casm/configuration/perf.hh"
 
 namespace CASM {
 namespace config {
@@ -12,18 +17,46 @@ namespace config {
 ///
 /// - The call operators return the value for equality comparison,
 ///   and if not equivalent, also store the result for less than comparison
+/// - The configuration DoF values must not be modified while a
+///   ConfigIsEquivalent constructed with it is in use
+/// - May be constructed with a ConfigurationView, to compare DoF values held
+///   in external buffers without copying them
+/// - Holds per-comparison scratch, so use one ConfigIsEquivalent per thread.
+///   The configurations and SupercellSymOp being compared may be shared.
+/// - Operations are passed as SupercellSymOpRef, so either SupercellSymOp or
+///   SupercellSymOpRef may be used without copying a supercell shared_ptr
 ///
 class ConfigIsEquivalent {
  public:
   /// Construct with config to be compared against, tolerance for comparison,
   /// and (optional) list of DoFs to compare if _wich_dofs is empty, no dofs
-  /// will be compared (default is "all", in which case all DoFs are compared)
+  /// will be compared (default is "all", in which case all DoFs are compared).
+  /// If _cache_local_dof_by_factor_group_op is true, local DoF values are
+  /// transformed at most once per supercell factor group operation (see
+  /// ConfigDoFIsEquivalent::Local). If _quantize_continuous_dofs is true,
+  /// continuous DoF values are compared as keys quantized onto a grid with
+  /// spacing _tol (see `quantize_dof_value`).
   ConfigIsEquivalent(Configuration const &_config, double _tol,
-                     std::set<std::string> const &_which_dofs = {"all"});
+                     std::set<std::string> const &_which_dofs = {"all"},
+                     bool _cache_local_dof_by_factor_group_op = false,
+                     bool _quantize_continuous_dofs = false);
 
   ConfigIsEquivalent(Configuration const &_config,
                      std::set<std::string> const &_which_dofs = {"all"});
 
+  /// Construct with a view of the config to be compared against, with the
+  /// same options as for a Configuration
+  ConfigIsEquivalent(ConfigurationView const &_config, double _tol,
+                     std::set<std::string> const &_which_dofs = {"all"},
+                     bool _cache_local_dof_by_factor_group_op = false,
+                     bool _quantize_continuous_dofs = false);
+
+  ConfigIsEquivalent(ConfigurationView const &_config,
+                     std::set<std::string> const &_which_dofs = {"all"});
+
+  /// \brief The config to be compared against
+  ///
+  /// - Throws if constructed with a ConfigurationView
   Configuration const &config() const;
 
   /// \brief Returns less than comparison
@@ -38,81 +71,265 @@ class ConfigIsEquivalent {
   bool operator()(Configuration const &other) const;
 
   /// \brief Check if config == A*config, store config < A*config
-  bool operator()(SupercellSymOp const &A) const;
+  bool operator()(SupercellSymOpRef const &A) const;
 
   /// \brief Check if A*config == B*config, store A*config < B*config
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B) const;
+  bool operator()(SupercellSymOpRef const &A, SupercellSymOpRef const &B) const;
 
   /// \brief Check if config == A*other, store config < A*other
-  bool operator()(SupercellSymOp const &A, Configuration const &other) const;
+  bool operator()(SupercellSymOpRef const &A, Configuration const &other) const;
 
   /// \brief Check if A*config == B*other, store A*config < B*other
-  bool operator()(SupercellSymOp const &A, SupercellSymOp const &B,
+  bool operator()(SupercellSymOpRef const &A, SupercellSymOpRef const &B,
                   Configuration const &other) const;
 
  private:
+  template <typename ConfigurationType>
+  void _init(ConfigurationType const &_config, double _tol,
+             std::set<std::string> const &_which_dofs,
+             bool _cache_local_dof_by_factor_group_op,
+             bool _quantize_continuous_dofs);
+
   template <typename... Args>
   bool _occupation_is_equivalent(Args &&...args) const;
 
+  /// The config to be compared against, or nullptr if constructed with a
+  /// ConfigurationView
   Configuration const *m_config;
+  Supercell const *m_supercell;
   Index m_n_sublat;
   bool m_all_dofs;
   bool m_check_occupation;
   bool m_has_aniso_occs;
-  Eigen::VectorXi const *m_occupation_ptr;
+  std::optional<ConfigDoFIsEquivalent::Occupation> m_occ_equiv;
+  std::optional<ConfigDoFIsEquivalent::AnisoOccupation> m_aniso_occ_equiv;
   std::map<DoFKey, ConfigDoFIsEquivalent::Global> m_global_equivs;
   std::map<DoFKey, ConfigDoFIsEquivalent::Local> m_local_equivs;
   mutable bool m_less;
 };
 
+/// \brief Return true if ConfigIsEquivalent, constructed with `_which_dofs`,
+///     would only compare occupation
+bool is_occupation_only_comparison(
+    Configuration const &_config,
+    std::set<std::string> const &_which_dofs = {"all"});
+
+/// \brief Return true if ConfigIsEquivalent, constructed with `_which_dofs`,
+///     would only compare occupation
+bool is_occupation_only_comparison(
+    ConfigurationView const &_config,
+    std::set<std::string> const &_which_dofs = {"all"});
+
+/// \brief Return true if ConfigIsEquivalent, constructed with `_which_dofs`,
+///     would only compare global DoF
+bool is_global_dof_only_comparison(
+    Configuration const &_config,
+    std::set<std::string> const &_which_dofs = {"all"});
+
+/// \brief Return true if ConfigIsEquivalent, constructed with `_which_dofs`,
+///     would only compare global DoF
+bool is_global_dof_only_comparison(
+    ConfigurationView const &_config,
+    std::set<std::string> const &_which_dofs = {"all"});
+
+/// \brief Class for comparison of Configurations (with the same Supercell)
+///     which only have occupation DoF to compare
+///
+/// - Gives the same results as `ConfigIsEquivalent(_config, _which_dofs)`
+///   when `is_occupation_only_comparison(_config, _which_dofs)` is true, but
+///   the occupation comparison type is selected at compile time, so
+///   comparisons do not branch on the DoF types present
+/// - Only occupation is compared, so continuous DoF values are ignored
+/// - HasAnisoOccs must equal `prim->sym_info.has_aniso_occs`
+/// - Use `visit_config_is_equivalent` to select the comparison type that
+///   applies to a particular configuration
+///
+template <bool HasAnisoOccs>
+class OccupationConfigIsEquivalent {
+ public:
+  typedef std::conditional_t<HasAnisoOccs,
+                             ConfigDoFIsEquivalent::AnisoOccupation,
+                             ConfigDoFIsEquivalent::Occupation>
+      occupation_is_equivalent_type;
+
+  /// Construct with config to be compared against
+  explicit OccupationConfigIsEquivalent(Configuration const &_config);
+
+  /// Construct with a view of the config to be compared against
+  explicit OccupationConfigIsEquivalent(ConfigurationView const &_config);
+
+  /// \brief The config to be compared against
+  ///
+  /// - Throws if constructed with a ConfigurationView
+  Configuration const &config() const {
+    if (m_config == nullptr) {
+      throw std::runtime_error(
+          "Error in OccupationConfigIsEquivalent::config: constructed with a "
+          "ConfigurationView");
+    }
+    return *m_config;
+  }
+
+  /// \brief Returns less than comparison
+  ///
+  /// - Only valid after call operator returns false
+  bool is_less() const { return m_less; }
+
+  /// \brief Check if config == other, store config < other
+  bool operator()(Configuration const &other) const;
+
+  /// \brief Check if config == A*config, store config < A*config
+  bool operator()(SupercellSymOpRef const &A) const { return _check(A); }
+
+  /// \brief Check if A*config == B*config, store A*config < B*config
+  bool operator()(SupercellSymOpRef const &A,
+                  SupercellSymOpRef const &B) const {
+    return _check(A, B);
+  }
+
+  /// \brief Check if config == A*other, store config < A*other
+  bool operator()(SupercellSymOpRef const &A,
+                  Configuration const &other) const {
+    return _check(A, other.dof_values.occupation);
+  }
+
+  /// \brief Check if A*config == B*other, store A*config < B*other
+  bool operator()(SupercellSymOpRef const &A, SupercellSymOpRef const &B,
+                  Configuration const &other) const {
+    return _check(A, B, other.dof_values.occupation);
+  }
+
+ private:
+  template <typename ConfigurationType>
+  static occupation_is_equivalent_type _make_occ_equiv(
+      ConfigurationType const &_config);
+
+  template <typename... Args>
+  bool _check(Args const &...args) const {
+    CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_compare);
+    if (!m_occ_equiv(args...)) {
+      m_less = m_occ_equiv.is_less();
+      return false;
+    }
+    return true;
+  }
+
+  /// The config to be compared against, or nullptr if constructed with a
+  /// ConfigurationView
+  Configuration const *m_config;
+  Supercell const *m_supercell;
+  occupation_is_equivalent_type m_occ_equiv;
+  mutable bool m_less;
+};
+
+/// \brief Call `f` with the equivalence comparison type that applies to a
+///     configuration
+template <typename F>
+auto visit_config_is_equivalent(
+    Configuration const &_config, F &&f,
+    std::set<std::string> const &_which_dofs = {"all"});
+
+/// \brief Call `f` with the equivalence comparison type that applies to a
+///     view of a configuration
+template <typename F>
+auto visit_config_is_equivalent(
+    ConfigurationView const &_config, F &&f,
+    std::set<std::string> const &_which_dofs = {"all"});
+
 /// Construct with config to be compared against, tolerance for comparison,
 /// and (optional) list of DoFs to compare if _wich_dofs is empty, no dofs
 /// will be compared (default is "all", in which case all DoFs are compared)
 inline ConfigIsEquivalent::ConfigIsEquivalent(
     Configuration const &_config, double _tol,
-    std::set<std::string> const &_which_dofs)
-    : m_config(&_config),
-      m_n_sublat(config().supercell->prim->basicstructure->basis().size()),
-      m_all_dofs(_which_dofs.count("all")),
-      m_check_occupation(
-          (m_all_dofs || _which_dofs.count("occ")) &&
-          config().supercell->prim->sym_info.has_occupation_dofs),
-      m_has_aniso_occs(config().supercell->prim->sym_info.has_aniso_occs),
-      m_occupation_ptr(nullptr) {
-  clexulator::ConfigDoFValues const &dof_values = config().dof_values;
+    std::set<std::string> const &_which_dofs,
+    bool _cache_local_dof_by_factor_group_op, bool _quantize_continuous_dofs)
+    : m_config(&_config) {
+  _init(_config, _tol, _which_dofs, _cache_local_dof_by_factor_group_op,
+        _quantize_continuous_dofs);
+}
+
+inline ConfigIsEquivalent::ConfigIsEquivalent(
+    Configuration const &_config, std::set<std::string> const &_which_dofs)
+    : ConfigIsEquivalent(
+          _config, _config.supercell->prim->basicstructure->lattice().tol(),
+          _which_dofs) {}
+
+/// Construct with a view of the config to be compared against, with the
+/// same options as for a Configuration. The referenced DoF values must not
+/// be modified while this is in use.
+inline ConfigIsEquivalent::ConfigIsEquivalent(
+    ConfigurationView const &_config, double _tol,
+    std::set<std::string> const &_which_dofs,
+    bool _cache_local_dof_by_factor_group_op, bool _quantize_continuous_dofs)
+    : m_config(nullptr) {
+  _init(_config, _tol, _which_dofs, _cache_local_dof_by_factor_group_op,
+        _quantize_continuous_dofs);
+}
+
+inline ConfigIsEquivalent::ConfigIsEquivalent(
+    ConfigurationView const &_config, std::set<std::string> const &_which_dofs)
+    : ConfigIsEquivalent(
+          _config, _config.supercell->prim->basicstructure->lattice().tol(),
+          _which_dofs) {}
+
+/// \brief Construct the DoF comparisons, for a Configuration or a
+///     ConfigurationView
+template <typename ConfigurationType>
+void ConfigIsEquivalent::_init(ConfigurationType const &_config, double _tol,
+                               std::set<std::string> const &_which_dofs,
+                               bool _cache_local_dof_by_factor_group_op,
+                               bool _quantize_continuous_dofs) {
+  Prim const &prim = *_config.supercell->prim;
+  m_supercell = _config.supercell.get();
+  m_n_sublat = prim.basicstructure->basis().size();
+  m_all_dofs = _which_dofs.count("all");
+  m_check_occupation = (m_all_dofs || _which_dofs.count("occ")) &&
+                       prim.sym_info.has_occupation_dofs;
+  m_has_aniso_occs = prim.sym_info.has_aniso_occs;
+
+  auto const &dof_values = _config.dof_values;
 
   for (auto const &dof : dof_values.global_dof_values) {
     DoFKey const &key = dof.first;
-    Eigen::VectorXd const &values = dof.second;
+    auto const &values = dof.second;
     if (m_all_dofs || _which_dofs.count(key)) {
       m_global_equivs.emplace(std::piecewise_construct,
                               std::forward_as_tuple(key),
-                              std::forward_as_tuple(values, key, _tol));
+                              std::forward_as_tuple(values, key, _tol,
+                                                    _quantize_continuous_dofs));
     }
   }
 
   if (m_check_occupation) {
-    m_occupation_ptr = &dof_values.occupation;
+    if (m_has_aniso_occs) {
+      m_aniso_occ_equiv.emplace(dof_values.occupation, m_n_sublat);
+    } else {
+      m_occ_equiv.emplace(dof_values.occupation);
+    }
   }
 
   for (auto const &dof : dof_values.local_dof_values) {
     DoFKey const &key = dof.first;
-    Eigen::MatrixXd const &values = dof.second;
+    auto const &values = dof.second;
     if (m_all_dofs || _which_dofs.count(key)) {
       m_local_equivs.emplace(
           std::piecewise_construct, std::forward_as_tuple(key),
-          std::forward_as_tuple(values, key, m_n_sublat, _tol));
+          std::forward_as_tuple(values, key, m_n_sublat, _tol,
+                                _cache_local_dof_by_factor_group_op,
+                                _quantize_continuous_dofs));
     }
   }
 }
 
-inline ConfigIsEquivalent::ConfigIsEquivalent(
-    Configuration const &_config, std::set<std::string> const &_which_dofs)
-    : ConfigIsEquivalent(
-          _config, _config.supercell->prim->basicstructure->lattice().tol(),
-          _which_dofs) {}
-
+/// \brief The config to be compared against
+///
+/// - Throws if constructed with a ConfigurationView
 inline Configuration const &ConfigIsEquivalent::config() const {
+  if (m_config == nullptr) {
+    throw std::runtime_error(
+        "Error in ConfigIsEquivalent::config: constructed with a "
+        "ConfigurationView");
+  }
   return *m_config;
 }
 
@@ -126,11 +343,12 @@ inline bool ConfigIsEquivalent::is_less() const { return m_less; }
 /// - Currently assumes that both Configuration have the same Prim, but may
 ///   have different supercells
 inline bool ConfigIsEquivalent::operator()(Configuration const &other) const {
-  if (&config() == &other) {
+  CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_compare);
+  if (m_config == &other) {
     return true;
   }
 
-  if (config().supercell->prim != other.supercell->prim) {
+  if (m_supercell->prim != other.supercell->prim) {
     throw std::runtime_error(
         "Error comparing Configuration with ConfigIsEquivalent: "
         "Only Configuration with shared prim may be compared this way.");
@@ -138,8 +356,8 @@ inline bool ConfigIsEquivalent::operator()(Configuration const &other) const {
 
   clexulator::ConfigDoFValues const &other_dof_values = other.dof_values;
 
-  if (*config().supercell != *other.supercell) {
-    m_less = *config().supercell < *other.supercell;
+  if (*m_supercell != *other.supercell) {
+    m_less = *m_supercell < *other.supercell;
     return false;
   }
 
@@ -173,7 +391,8 @@ inline bool ConfigIsEquivalent::operator()(Configuration const &other) const {
 }
 
 /// \brief Check if config == A*config, store config < A*config
-inline bool ConfigIsEquivalent::operator()(SupercellSymOp const &A) const {
+inline bool ConfigIsEquivalent::operator()(SupercellSymOpRef const &A) const {
+  CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_compare);
   for (auto const &dof_is_equiv_f : m_global_equivs) {
     ConfigDoFIsEquivalent::Global const &f = dof_is_equiv_f.second;
     if (!f(A)) {
@@ -198,8 +417,9 @@ inline bool ConfigIsEquivalent::operator()(SupercellSymOp const &A) const {
 }
 
 /// \brief Check if A*config == B*config, store A*config < B*config
-inline bool ConfigIsEquivalent::operator()(SupercellSymOp const &A,
-                                           SupercellSymOp const &B) const {
+inline bool ConfigIsEquivalent::operator()(SupercellSymOpRef const &A,
+                                           SupercellSymOpRef const &B) const {
+  CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_compare);
   if (A.supercell_factor_group_index() != B.supercell_factor_group_index()) {
     for (auto const &dof_is_equiv_f : m_global_equivs) {
       ConfigDoFIsEquivalent::Global const &f = dof_is_equiv_f.second;
@@ -226,8 +446,9 @@ inline bool ConfigIsEquivalent::operator()(SupercellSymOp const &A,
 }
 
 /// \brief Check if config == A*other, store config < A*other
-inline bool ConfigIsEquivalent::operator()(SupercellSymOp const &A,
+inline bool ConfigIsEquivalent::operator()(SupercellSymOpRef const &A,
                                            Configuration const &other) const {
+  CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_compare);
   clexulator::ConfigDoFValues const &other_dof_values = other.dof_values;
 
   for (auto const &dof_is_equiv_f : m_global_equivs) {
@@ -260,9 +481,10 @@ inline bool ConfigIsEquivalent::operator()(SupercellSymOp const &A,
 }
 
 /// \brief Check if A*config == B*other, store A*config < B*other
-inline bool ConfigIsEquivalent::operator()(SupercellSymOp const &A,
-                                           SupercellSymOp const &B,
+inline bool ConfigIsEquivalent::operator()(SupercellSymOpRef const &A,
+                                           SupercellSymOpRef const &B,
                                            Configuration const &other) const {
+  CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_compare);
   clexulator::ConfigDoFValues const &other_dof_values = other.dof_values;
 
   for (auto const &dof_is_equiv_f : m_global_equivs) {
@@ -298,13 +520,13 @@ template <typename... Args>
 bool ConfigIsEquivalent::_occupation_is_equivalent(Args &&...args) const {
   if (m_check_occupation) {
     if (m_has_aniso_occs) {
-      ConfigDoFIsEquivalent::AnisoOccupation f(*m_occupation_ptr, m_n_sublat);
+      ConfigDoFIsEquivalent::AnisoOccupation const &f = *m_aniso_occ_equiv;
       if (!f(std::forward<Args>(args)...)) {
         m_less = f.is_less();
         return false;
       }
     } else {
-      ConfigDoFIsEquivalent::Occupation f(*m_occupation_ptr);
+      ConfigDoFIsEquivalent::Occupation const &f = *m_occ_equiv;
       if (!f(std::forward<Args>(args)...)) {
         m_less = f.is_less();
         return false;
@@ -314,6 +536,210 @@ bool ConfigIsEquivalent::_occupation_is_equivalent(Args &&...args) const {
   return true;
 }
 
+namespace ConfigIsEquivalent_impl {
+
+template <typename ConfigurationType>
+bool is_occupation_only_comparison(ConfigurationType const &_config,
+                                   std::set<std::string> const &_which_dofs) {
+  bool all_dofs = _which_dofs.count("all");
+  if (!_config.supercell->prim->sym_info.has_occupation_dofs ||
+      !(all_dofs || _which_dofs.count("occ"))) {
+    return false;
+  }
+  auto const &dof_values = _config.dof_values;
+  for (auto const &dof : dof_values.global_dof_values) {
+    if (all_dofs || _which_dofs.count(dof.first)) {
+      return false;
+    }
+  }
+  for (auto const &dof : dof_values.local_dof_values) {
+    if (all_dofs || _which_dofs.count(dof.first)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename ConfigurationType>
+bool is_global_dof_only_comparison(ConfigurationType const &_config,
+                                   std::set<std::string> const &_which_dofs) {
+  bool all_dofs = _which_dofs.count("all");
+  if (_config.supercell->prim->sym_info.has_occupation_dofs &&
+      (all_dofs || _which_dofs.count("occ"))) {
+    return false;
+  }
+  for (auto const &dof : _config.dof_values.local_dof_values) {
+    if (all_dofs || _which_dofs.count(dof.first)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename ConfigurationType, typename F>
+auto visit_config_is_equivalent(ConfigurationType const &_config, F &&f,
+                                std::set<std::string> const &_which_dofs) {
+  if (is_occupation_only_comparison(_config, _which_dofs)) {
+    if (_config.supercell->prim->sym_info.has_aniso_occs) {
+      OccupationConfigIsEquivalent<true> const equal_to_f(_config);
+      return f(equal_to_f);
+    }
+    OccupationConfigIsEquivalent<false> const equal_to_f(_config);
+    return f(equal_to_f);
+  }
+  ConfigIsEquivalent const equal_to_f(_config, _which_dofs);
+  return f(equal_to_f);
+}
+
+}  // namespace ConfigIsEquivalent_impl
+
+/// \brief Return true if ConfigIsEquivalent, constructed with `_which_dofs`,
+///     would only compare occupation
+///
+/// True if the prim has occupation DoF, occupation is selected by
+/// `_which_dofs`, and no continuous DoF of `_config` are selected.
+inline bool is_occupation_only_comparison(
+    Configuration const &_config, std::set<std::string> const &_which_dofs) {
+  return ConfigIsEquivalent_impl::is_occupation_only_comparison(_config,
+                                                                _which_dofs);
+}
+
+/// \brief Return true if ConfigIsEquivalent, constructed with `_which_dofs`,
+///     would only compare occupation
+inline bool is_occupation_only_comparison(
+    ConfigurationView const &_config,
+    std::set<std::string> const &_which_dofs) {
+  return ConfigIsEquivalent_impl::is_occupation_only_comparison(_config,
+                                                                _which_dofs);
+}
+
+/// \brief Return true if ConfigIsEquivalent, constructed with `_which_dofs`,
+///     would only compare global DoF
+///
+/// True if occupation is not compared, either because the prim has no
+/// occupation DoF or because occupation is not selected by `_which_dofs`,
+/// and no local DoF of `_config` are selected. Then the comparison of
+/// `A * config` depends only on `A.supercell_factor_group_index()`, because
+/// translations act trivially on global DoF values.
+inline bool is_global_dof_only_comparison(
+    Configuration const &_config, std::set<std::string> const &_which_dofs) {
+  return ConfigIsEquivalent_impl::is_global_dof_only_comparison(_config,
+                                                                _which_dofs);
+}
+
+/// \brief Return true if ConfigIsEquivalent, constructed with `_which_dofs`,
+///     would only compare global DoF
+inline bool is_global_dof_only_comparison(
+    ConfigurationView const &_config,
+    std::set<std::string> const &_which_dofs) {
+  return ConfigIsEquivalent_impl::is_global_dof_only_comparison(_config,
+                                                                _which_dofs);
+}
+
+/// Construct with config to be compared against
+///
+/// Throws if the prim does not have occupation DoF, or if `HasAnisoOccs`
+/// does not match the prim.
+template <bool HasAnisoOccs>
+OccupationConfigIsEquivalent<HasAnisoOccs>::OccupationConfigIsEquivalent(
+    Configuration const &_config)
+    : m_config(&_config),
+      m_supercell(_config.supercell.get()),
+      m_occ_equiv(_make_occ_equiv(_config)) {}
+
+/// Construct with a view of the config to be compared against
+///
+/// Throws if the prim does not have occupation DoF, or if `HasAnisoOccs`
+/// does not match the prim. The referenced occupation values
+/// must not be modified while this is in use.
+template <bool HasAnisoOccs>
+OccupationConfigIsEquivalent<HasAnisoOccs>::OccupationConfigIsEquivalent(
+    ConfigurationView const &_config)
+    : m_config(nullptr),
+      m_supercell(_config.supercell.get()),
+      m_occ_equiv(_make_occ_equiv(_config)) {}
+
+/// \brief Check if config == other, store config < other
+///
+/// - Currently assumes that both Configuration have the same Prim, but may
+///   have different supercells
+template <bool HasAnisoOccs>
+bool OccupationConfigIsEquivalent<HasAnisoOccs>::operator()(
+    Configuration const &other) const {
+  if (m_config == &other) {
+    CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_compare);
+    return true;
+  }
+  if (m_supercell->prim != other.supercell->prim) {
+    throw std::runtime_error(
+        "Error comparing Configuration with OccupationConfigIsEquivalent: "
+        "Only Configuration with shared prim may be compared this way.");
+  }
+  if (*m_supercell != *other.supercell) {
+    CASM_CONFIGURATION_PERF_COUNT(config_is_equivalent_compare);
+    m_less = *m_supercell < *other.supercell;
+    return false;
+  }
+  return _check(other.dof_values.occupation);
+}
+
+template <bool HasAnisoOccs>
+template <typename ConfigurationType>
+typename OccupationConfigIsEquivalent<
+    HasAnisoOccs>::occupation_is_equivalent_type
+OccupationConfigIsEquivalent<HasAnisoOccs>::_make_occ_equiv(
+    ConfigurationType const &_config) {
+  auto const &sym_info = _config.supercell->prim->sym_info;
+  if (!sym_info.has_occupation_dofs ||
+      sym_info.has_aniso_occs != HasAnisoOccs) {
+    throw std::runtime_error(
+        "Error constructing OccupationConfigIsEquivalent: configuration "
+        "DoF are not consistent with the comparison type");
+  }
+  auto const &occupation = _config.dof_values.occupation;
+  if constexpr (HasAnisoOccs) {
+    return occupation_is_equivalent_type(
+        occupation, _config.supercell->prim->basicstructure->basis().size());
+  } else {
+    return occupation_is_equivalent_type(occupation);
+  }
+}
+
+/// \brief Call `f` with the equivalence comparison type that applies to a
+///     configuration
+///
+/// If `is_occupation_only_comparison(_config, _which_dofs)`, then `f` is
+/// called with an `OccupationConfigIsEquivalent<true>` or
+/// `OccupationConfigIsEquivalent<false>`, according to whether the prim has
+/// anisotropic occupants. Otherwise, `f` is called with a
+/// `ConfigIsEquivalent(_config, _which_dofs)`. All give the same results, so
+/// `f` must be callable with each type and return the same type for each.
+///
+/// \param _config The configuration to be compared against
+/// \param f A function, `f(equal_to_f)`, where `equal_to_f` is a
+///     `const &` to the comparison object
+/// \param _which_dofs The DoF types to compare, as for `ConfigIsEquivalent`
+///
+/// \returns The result of `f`
+template <typename F>
+auto visit_config_is_equivalent(Configuration const &_config, F &&f,
+                                std::set<std::string> const &_which_dofs) {
+  return ConfigIsEquivalent_impl::visit_config_is_equivalent(
+      _config, std::forward<F>(f), _which_dofs);
+}
+
+/// \brief Call `f` with the equivalence comparison type that applies to a
+///     view of a configuration
+///
+/// Equivalent to `visit_config_is_equivalent` for a Configuration, with the
+/// comparison objects constructed from the view.
+template <typename F>
+auto visit_config_is_equivalent(ConfigurationView const &_config, F &&f,
+                                std::set<std::string> const &_which_dofs) {
+  return ConfigIsEquivalent_impl::visit_config_is_equivalent(
+      _config, std::forward<F>(f), _which_dofs);
+}
+
 }  // namespace config
 }  // namespace CASM
 
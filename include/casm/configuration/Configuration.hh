@@ -37,6 +37,11 @@ struct Configuration : public Comparisons<CRTPBase<Configuration>> {
 clexulator::ConfigDoFValues make_standard_dof_values(
     Configuration const &config);
 
+/// \brief Convert DoF values into the standard basis, writing into existing
+///     storage
+void make_standard_dof_values(Configuration const &config,
+                              clexulator::ConfigDoFValues &standard_dof_values);
+
 /// \brief Set DoF values from other, which is in the standard basis
 void set_standard_dof_values(Configuration &config,
                              clexulator::ConfigDoFValues const &other);
@@ -46,12 +51,29 @@ void set_dof_space_values(config::Configuration &config,
                           clexulator::DoFSpace const &dof_space,
                           Eigen::VectorXd const &dof_space_coordinate);
 
+/// \brief Estimate the memory used by a configuration, in bytes, including
+///     its supercell if not already counted
+Index memory_usage(Configuration const &configuration,
+                   MemoryUsageContext &context);
+
 class SupercellSymOp;
+class SupercellSymOpRef;
+struct SupercellSymOpWorkspace;
 
 /// \brief Apply a symmetry operation specified by a SupercellSymOp to
 /// Configuration
 Configuration &apply(SupercellSymOp const &op, Configuration &configuration);
 
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+/// Configuration, using reusable storage
+Configuration &apply(SupercellSymOp const &op, Configuration &configuration,
+                     SupercellSymOpWorkspace &workspace);
+
+/// \brief Apply a symmetry operation specified by a SupercellSymOpRef to
+/// Configuration, using reusable storage
+Configuration &apply(SupercellSymOpRef const &op, Configuration &configuration,
+                     SupercellSymOpWorkspace &workspace);
+
 /// \brief Apply a symmetry operation specified by a SupercellSymOp to
 /// Configuration
 Configuration copy_apply(SupercellSymOp const &op, Configuration configuration);
@@ -74,6 +96,24 @@ class SupercellSymOp;
 ConfigurationWithProperties &apply(SupercellSymOp const &op,
                                    ConfigurationWithProperties &configuration);
 
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+///     a configuration with properties, using reusable storage
+ConfigurationWithProperties &apply(SupercellSymOp const &op,
+                                   ConfigurationWithProperties &configuration,
+                                   SupercellSymOpWorkspace &workspace);
+
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+///     the value of one global property
+void apply_global_property(SupercellSymOp const &op, std::string const &key,
+                           Eigen::VectorXd &value,
+                           SupercellSymOpWorkspace &workspace);
+
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+///     the value of one local property
+void apply_local_property(SupercellSymOp const &op, std::string const &key,
+                          Eigen::MatrixXd &value,
+                          SupercellSymOpWorkspace &workspace);
+
 /// \brief Apply a symmetry operation specified by a SupercellSymOp to
 ///     a configuration with properties
 ConfigurationWithProperties copy_apply(
@@ -0,0 +1,209 @@
+#ifndef CASM_config_ConfigurationBatch
+#define CASM_config_ConfigurationBatch
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+
+namespace CASM {
+namespace config {
+
+class CanonicalFormEngine;
+class ConfigurationBatch;
+
+/// \brief Read-only view of one configuration in a ConfigurationBatch
+///
+/// DoF values are returned as Eigen::Map into the batch storage, without
+/// copying. A view is invalidated by any operation that changes the size of
+/// the batch.
+class ConfigurationBatchView {
+ public:
+  ConfigurationBatchView(ConfigurationBatch const &batch, Index index);
+
+  /// \brief The shared supercell
+  std::shared_ptr<Supercell const> const &supercell() const;
+
+  /// \brief Index of the configuration in the batch
+  Index index() const { return m_index; }
+
+  /// \brief Occupation values, size n_sites
+  Eigen::Map<Eigen::VectorXi const> occupation() const;
+
+  /// \brief Global DoF values, in the prim basis, size dim
+  Eigen::Map<Eigen::VectorXd const> global_dof_values(
+      std::string const &key) const;
+
+  /// \brief Local DoF values, in the prim basis, shape (dim, n_sites)
+  Eigen::Map<Eigen::MatrixXd const> local_dof_values(
+      std::string const &key) const;
+
+  /// \brief Copy into a Configuration
+  Configuration configuration() const;
+
+  /// \brief Copy into an existing Configuration, reusing its storage
+  void copy_to(Configuration &configuration) const;
+
+ private:
+  ConfigurationBatch const *m_batch;
+  Index m_index;
+};
+
+/// \brief Many configurations in one supercell, stored as contiguous arrays
+///
+/// A std::vector<Configuration> holds a separate shared supercell pointer,
+/// occupation vector, and DoF value maps per configuration. A
+/// ConfigurationBatch holds one shared supercell and, for all
+/// configurations together:
+/// - occupation: row-major (size, n_sites) int array
+/// - global DoF values: for each key, a row-major (size, dim) array
+/// - local DoF values: for each key, a row-major (size, dim * n_sites)
+///   array, where each row is the column-major (dim, n_sites) matrix of one
+///   configuration
+///
+/// DoF values are in the prim basis, as in Configuration. All
+/// configurations must be in the batch's supercell. Use `view(i)` to read
+/// a configuration without copying, or `configuration(i)` / `copy_to` to
+/// use it with functions that take a Configuration, such as
+/// ConfigIsEquivalent.
+class ConfigurationBatch {
+ public:
+  typedef Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+      OccupationMatrix;
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                        Eigen::RowMajor>
+      ValuesMatrix;
+
+  /// \brief Constructor, an empty batch
+  explicit ConfigurationBatch(
+      std::shared_ptr<Supercell const> const &supercell);
+
+  /// \brief Constructor, copying configurations
+  ConfigurationBatch(std::shared_ptr<Supercell const> const &supercell,
+                     std::vector<Configuration> const &configurations);
+
+  /// \brief The shared supercell
+  std::shared_ptr<Supercell const> const &supercell() const {
+    return m_supercell;
+  }
+
+  /// \brief Number of configurations
+  Index size() const { return m_size; }
+
+  /// \brief Return true if there are no configurations
+  bool empty() const { return m_size == 0; }
+
+  /// \brief Number of sites in the supercell
+  Index n_sites() const { return m_n_sites; }
+
+  /// \brief Reserve storage for `n` configurations
+  void reserve(Index n);
+
+  /// \brief Remove all configurations
+  void clear();
+
+  /// \brief Add a configuration, which must be in the batch's supercell
+  void push_back(Configuration const &configuration);
+
+  /// \brief Set the configuration at index `i`
+  void set(Index i, Configuration const &configuration);
+
+  /// \brief Read-only view of the configuration at index `i`
+  ConfigurationBatchView view(Index i) const;
+
+  /// \brief Copy the configuration at index `i`
+  Configuration configuration(Index i) const;
+
+  /// \brief Copy the configuration at index `i` into an existing
+  ///     Configuration, reusing its storage
+  void copy_to(Index i, Configuration &configuration) const;
+
+  /// \brief Copy all configurations
+  std::vector<Configuration> configurations() const;
+
+  /// \brief Occupation of all configurations, shape (size, n_sites)
+  Eigen::Map<OccupationMatrix> occupation();
+
+  /// \brief Occupation of all configurations, shape (size, n_sites)
+  Eigen::Map<OccupationMatrix const> occupation() const;
+
+  /// \brief Global DoF dimensions, by key
+  std::map<std::string, Index> const &global_dof_dim() const {
+    return m_global_dof_dim;
+  }
+
+  /// \brief Local DoF dimensions, by key
+  std::map<std::string, Index> const &local_dof_dim() const {
+    return m_local_dof_dim;
+  }
+
+  /// \brief Values of a global DoF, shape (size, dim)
+  Eigen::Map<ValuesMatrix> global_dof_values(std::string const &key);
+
+  /// \brief Values of a global DoF, shape (size, dim)
+  Eigen::Map<ValuesMatrix const> global_dof_values(
+      std::string const &key) const;
+
+  /// \brief Values of a local DoF, shape (size, dim * n_sites)
+  Eigen::Map<ValuesMatrix> local_dof_values(std::string const &key);
+
+  /// \brief Values of a local DoF, shape (size, dim * n_sites)
+  Eigen::Map<ValuesMatrix const> local_dof_values(std::string const &key) const;
+
+ private:
+  void _check(Configuration const &configuration) const;
+
+  std::vector<double> &_values(std::map<std::string, std::vector<double>> &map,
+                               std::string const &key, char const *what);
+
+  std::vector<double> const &_values(
+      std::map<std::string, std::vector<double>> const &map,
+      std::string const &key, char const *what) const;
+
+  std::shared_ptr<Supercell const> m_supercell;
+
+  Index m_n_sites;
+
+  Index m_size;
+
+  std::map<std::string, Index> m_global_dof_dim;
+
+  std::map<std::string, Index> m_local_dof_dim;
+
+  std::vector<int> m_occupation;
+
+  std::map<std::string, std::vector<double>> m_global_dof_values;
+
+  std::map<std::string, std::vector<double>> m_local_dof_values;
+};
+
+/// \brief Fill a batch with copies of a background configuration, with DoF
+///     values set from many DoFSpace coordinates
+void set_dof_space_values(ConfigurationBatch &batch,
+                          Configuration const &background,
+                          clexulator::DoFSpace const &dof_space,
+                          Eigen::MatrixXd const &dof_space_coordinates);
+
+/// \brief Apply a symmetry operation to every configuration in a batch
+ConfigurationBatch &apply(SupercellSymOp const &op, ConfigurationBatch &batch);
+
+/// \brief Return `engine.to_canonical_index` for each configuration in a
+///     batch
+std::vector<Index> to_canonical_indices(CanonicalFormEngine const &engine,
+                                        ConfigurationBatch const &batch,
+                                        Index n_threads = 1);
+
+/// \brief Return `engine.is_canonical` for each configuration in a batch
+std::vector<bool> is_canonical(CanonicalFormEngine const &engine,
+                               ConfigurationBatch const &batch,
+                               Index n_threads = 1);
+
+/// \brief Replace each configuration in a batch with its canonical form
+void to_canonical_forms(CanonicalFormEngine const &engine,
+                        ConfigurationBatch &batch, Index n_threads = 1);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
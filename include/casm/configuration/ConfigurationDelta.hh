@@ -0,0 +1,108 @@
+#ifndef CASM_config_ConfigurationDelta
+#define CASM_config_ConfigurationDelta
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/global/eigen.hh"
+#include "casm/misc/Comparisons.hh"
+
+namespace CASM {
+namespace config {
+
+struct Configuration;
+class MemoryUsageContext;
+
+/// \brief Occupation of a configuration relative to a background, as
+///     (linear site index, occupant index) pairs for the sites that differ,
+///     sorted by site index
+typedef std::vector<std::pair<Index, int>> SparseOccupation;
+
+/// \brief Local continuous DoF values of a configuration relative to a
+///     background, as (linear site index, value) pairs for the sites that
+///     differ, sorted by site index
+typedef std::vector<std::pair<Index, Eigen::VectorXd>> SparseLocalDoFValues;
+
+/// \brief A configuration stored as its changes relative to a shared
+///     background configuration
+///
+/// Notes:
+/// - Perturbations of a background, as generated by local and periodic
+///   perturbation enumeration, differ from the background on a few sites.
+///   A ConfigurationDelta stores only the differing occupation values, the
+///   differing columns of local continuous DoF values, and the differing
+///   global DoF values, so memory and serialized size scale with the
+///   number of changes rather than the number of sites.
+/// - The background is shared, not copied. The full configuration is only
+///   constructed when requested, by `make_configuration`.
+/// - DoF values are in the prim basis, as in `Configuration::dof_values`.
+/// - Deltas are made minimal by `make_configuration_delta`: values are only
+///   stored if they differ from the background by more than the prim
+///   lattice tolerance. Comparisons assume deltas are minimal.
+/// - Deltas are ordered by background, then occupation changes, then global
+///   DoF changes, then local DoF changes, so they can be stored in
+///   `std::set<ConfigurationDelta>`. This is generally not the order of the
+///   expanded configurations.
+struct ConfigurationDelta : public Comparisons<CRTPBase<ConfigurationDelta>> {
+  /// \brief Constructor, with no changes
+  explicit ConfigurationDelta(
+      std::shared_ptr<Configuration const> const &_background);
+
+  /// \brief The shared background configuration
+  std::shared_ptr<Configuration const> background;
+
+  /// \brief Occupation values that differ from the background
+  SparseOccupation occupation;
+
+  /// \brief Local continuous DoF values that differ from the background, by
+  ///     DoF type
+  std::map<DoFKey, SparseLocalDoFValues> local_dof_values;
+
+  /// \brief Global continuous DoF values that differ from the background
+  std::map<DoFKey, Eigen::VectorXd> global_dof_values;
+
+  /// \brief Number of stored changes
+  Index size() const;
+
+  /// \brief Less than comparison of ConfigurationDelta
+  bool operator<(ConfigurationDelta const &rhs) const;
+
+ private:
+  friend struct Comparisons<CRTPBase<ConfigurationDelta>>;
+
+  /// \brief Equality comparison of ConfigurationDelta
+  bool eq_impl(ConfigurationDelta const &rhs) const;
+};
+
+/// \brief Make the minimal delta of a configuration relative to a
+///     background
+ConfigurationDelta make_configuration_delta(
+    std::shared_ptr<Configuration const> const &background,
+    Configuration const &configuration);
+
+/// \brief Make the minimal deltas of configurations relative to one shared
+///     background, in parallel
+std::vector<ConfigurationDelta> make_configuration_deltas(
+    std::shared_ptr<Configuration const> const &background,
+    std::vector<Configuration> const &configurations, Index n_threads = 1);
+
+/// \brief Construct the configuration represented by a delta
+Configuration make_configuration(ConfigurationDelta const &delta);
+
+/// \brief Set a configuration to the one represented by a delta, reusing
+///     its storage
+void make_configuration(ConfigurationDelta const &delta,
+                        Configuration &configuration);
+
+/// \brief Estimate the memory used by a delta, in bytes, including its
+///     background if not already counted
+Index memory_usage(ConfigurationDelta const &delta,
+                   MemoryUsageContext &context);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
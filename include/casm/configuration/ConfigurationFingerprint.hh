@@ -0,0 +1,138 @@
+#ifndef CASM_config_ConfigurationFingerprint
+#define CASM_config_ConfigurationFingerprint
+
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <unordered_map>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Makes hashes of configurations that are invariant with respect to
+///     prim factor group operations and translations
+///
+/// The fingerprint of a configuration combines:
+/// - The supercell volume, as a number of unit cells.
+/// - The number of sites occupied by each site-occupant orbit. A
+///   site-occupant orbit is an orbit of (sublattice index, occupant index)
+///   pairs under the prim factor group, so anisotropic occupants that are
+///   related by symmetry are counted together.
+/// - For each of a small set of prim periodic cluster orbits, the number of
+///   clusters in the supercell with each sorted list of site-occupant orbit
+///   indices. By default, point, pair, and triplet orbits with sites that
+///   have occupation DoF and with maximum site-to-site distance up to the
+///   shortest prim lattice vector (times 1.01) are used.
+///
+/// Equivalent configurations always have the same fingerprint, so if two
+/// configurations have different fingerprints they are not equivalent. The
+/// converse does not hold. Continuous DoF values do not contribute to the
+/// fingerprint, because equivalence of continuous DoF values is checked
+/// within a tolerance, which a hash cannot respect.
+class InvariantFingerprintCalculator {
+ public:
+  /// \brief Constructor, using the default cluster orbits
+  explicit InvariantFingerprintCalculator(
+      std::shared_ptr<Prim const> const &_prim);
+
+  /// \brief Constructor, using particular cluster orbits
+  InvariantFingerprintCalculator(
+      std::shared_ptr<Prim const> const &_prim,
+      std::vector<std::set<clust::IntegralCluster>> const &_orbits);
+
+  /// \brief The prim
+  std::shared_ptr<Prim const> const &prim() const;
+
+  /// \brief The prim periodic cluster orbits which contribute cluster counts
+  std::vector<std::set<clust::IntegralCluster>> const &orbits() const;
+
+  /// \brief Number of site-occupant orbits
+  Index n_site_occupant_orbits() const;
+
+  /// \brief Index of the site-occupant orbit of an occupant on a sublattice
+  Index site_occupant_orbit_index(Index sublattice_index,
+                                  Index occupant_index) const;
+
+  /// \brief Return the fingerprint of a configuration
+  std::uint64_t operator()(Configuration const &configuration) const;
+
+ private:
+  std::shared_ptr<Prim const> m_prim;
+
+  std::vector<std::set<clust::IntegralCluster>> m_orbits;
+
+  Index m_n_site_occupant_orbits;
+
+  /// site-occupant orbit index, by [sublattice_index][occupant_index]
+  std::vector<std::vector<Index>> m_site_occupant_orbit_index;
+};
+
+/// \brief Finds distinct configurations, making canonical forms only for
+///     configurations with matching fingerprints
+///
+/// Notes:
+/// - `insert` computes the fingerprint of a configuration. If no
+///   configuration already found has the same fingerprint, the configuration
+///   is distinct and no canonical form is made. Otherwise, the canonical
+///   forms of the configuration and of the configurations already found with
+///   the same fingerprint are compared. Canonical forms of configurations
+///   already found are made at most once.
+/// - If `in_canonical_supercell` is true, configurations are equivalent if
+///   they are equivalent with respect to the prim factor group and
+///   translations, possibly in different supercells (as by
+///   `make_in_canonical_supercell`). Otherwise, configurations are only
+///   equivalent if they have the same supercell and are equivalent with
+///   respect to the supercell symmetry operations (as by
+///   `make_canonical_form`).
+class DistinctConfigurationFinder {
+ public:
+  /// \brief Constructor
+  explicit DistinctConfigurationFinder(
+      std::shared_ptr<InvariantFingerprintCalculator const> const &_calculator,
+      bool _in_canonical_supercell = true);
+
+  /// \brief The fingerprint calculator
+  InvariantFingerprintCalculator const &calculator() const;
+
+  /// \brief Insert a configuration, if it is not equivalent to a
+  ///     configuration already found
+  bool insert(Configuration const &configuration);
+
+  /// \brief Insert a configuration with a precomputed fingerprint, if it is
+  ///     not equivalent to a configuration already found
+  bool insert(Configuration const &configuration, std::uint64_t fingerprint);
+
+  /// \brief The distinct configurations, in the order inserted
+  std::vector<Configuration> const &configurations() const;
+
+  /// \brief Number of canonical forms made
+  Index n_canonical_forms() const;
+
+ private:
+  /// \brief Canonical form of `m_configurations[index]`, made if necessary
+  Configuration const &_canonical_form(Index index);
+
+  Configuration _make_canonical_form(Configuration const &configuration);
+
+  std::shared_ptr<InvariantFingerprintCalculator const> m_calculator;
+
+  bool m_in_canonical_supercell;
+
+  std::vector<Configuration> m_configurations;
+
+  std::vector<std::optional<Configuration>> m_canonical_forms;
+
+  /// fingerprint -> index into m_configurations
+  std::unordered_multimap<std::uint64_t, Index> m_index_by_fingerprint;
+
+  Index m_n_canonical_forms;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
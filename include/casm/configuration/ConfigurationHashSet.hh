@@ -0,0 +1,123 @@
+#ifndef CASM_config_ConfigurationHashSet
+#define CASM_config_ConfigurationHashSet
+
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Hash of a configuration that is consistent with Configuration
+///     equality
+///
+/// Combines the supercell transformation matrix and the occupation.
+/// Continuous DoF values are compared within a tolerance, so they do not
+/// contribute.
+struct ConfigurationHash {
+  std::size_t operator()(Configuration const &configuration) const;
+};
+
+/// \brief Hash of a configuration that is consistent with quantized
+///     equivalence
+///
+/// Combines the supercell transformation matrix, the occupation, and the
+/// continuous DoF values quantized onto a grid with spacing `tol` (see
+/// `quantize_dof_value`). Configurations that are equal as compared by
+/// `ConfigIsEquivalent` with `_quantize_continuous_dofs == true` and the
+/// same `tol` have the same hash.
+struct QuantizedConfigurationHash {
+  explicit QuantizedConfigurationHash(double _tol) : tol(_tol) {}
+
+  std::size_t operator()(Configuration const &configuration) const;
+
+  double tol;
+};
+
+/// \brief A set of distinct configurations, stored in insertion order, with
+///     hashed lookup
+///
+/// An alternative to `std::set<Configuration>` for collecting distinct
+/// configurations. Configurations are stored contiguously, in the order
+/// they were first inserted, and a new configuration is checked only
+/// against configurations with the same ConfigurationHash, so insertion and
+/// lookup are amortized O(1) instead of O(log(n)) full comparisons.
+/// Configurations that differ only in continuous DoF values have the same
+/// hash, and are checked against each other with `operator==`.
+///
+/// If constructed with a `quantization_tol`, continuous DoF values are
+/// quantized onto a grid with that spacing, both for hashing
+/// (`QuantizedConfigurationHash`) and for equality, so configurations that
+/// differ in continuous DoF values are usually distinguished by hash alone.
+class ConfigurationHashSet {
+ public:
+  typedef std::vector<Configuration>::const_iterator const_iterator;
+
+  /// \brief Constructor
+  explicit ConfigurationHashSet(
+      std::optional<double> _quantization_tol = std::nullopt);
+
+  /// \brief Grid spacing for continuous DoF values, if quantized
+  std::optional<double> const &quantization_tol() const {
+    return m_quantization_tol;
+  }
+
+  /// \brief Insert a configuration, if not already present
+  std::pair<const_iterator, bool> insert(Configuration const &configuration);
+
+  /// \brief Insert all configurations of another set, in order, if not
+  ///     already present
+  void merge(ConfigurationHashSet const &other);
+
+  /// \brief Find a configuration, or return `end()` if not present
+  const_iterator find(Configuration const &configuration) const;
+
+  /// \brief Return 1 if a configuration is present, else 0
+  Index count(Configuration const &configuration) const;
+
+  /// \brief Number of configurations
+  Index size() const;
+
+  /// \brief True if there are no configurations
+  bool empty() const;
+
+  /// \brief Remove all configurations
+  void clear();
+
+  /// \brief Reserve space for `n` configurations
+  void reserve(Index n);
+
+  /// \brief Configurations, in insertion order
+  std::vector<Configuration> const &values() const;
+
+  const_iterator begin() const;
+
+  const_iterator end() const;
+
+  /// \brief Copy configurations into an ordered set
+  std::set<Configuration> to_set() const;
+
+ private:
+  std::size_t _hash(Configuration const &configuration) const;
+
+  bool _equal(Configuration const &A, Configuration const &B) const;
+
+  /// Index in m_values, or -1
+  Index _find(Configuration const &configuration, std::size_t hash) const;
+
+  std::optional<double> m_quantization_tol;
+
+  std::vector<Configuration> m_values;
+
+  /// ConfigurationHash -> index in m_values
+  std::unordered_multimap<std::size_t, Index> m_index;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
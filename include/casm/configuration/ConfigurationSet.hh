@@ -1,8 +1,15 @@
 #ifndef CASM_config_ConfigurationSet
 #define CASM_config_ConfigurationSet
 
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "casm/configuration/Configuration.hh"
 #include "casm/configuration/definitions.hh"
@@ -12,25 +19,61 @@ namespace CASM {
 namespace config {
 
 /// \brief Data structure for holding / reading / writing configurations
+///
+/// Notes:
+/// - The supercell name is held by a shared handle, so records in a
+///   ConfigurationSet share one copy of each supercell name.
+/// - The configuration id is held as an integer, and the configuration name
+///   is made from the supercell name and configuration id when requested.
 struct ConfigurationRecord : public Comparisons<CRTPBase<ConfigurationRecord>> {
+  /// \brief Constructor
+  ConfigurationRecord(Configuration const &_configuration,
+                      std::string const &_supercell_name,
+                      std::string const &_configuration_id);
+
+  /// \brief Constructor, with a shared supercell name and integer id
   ConfigurationRecord(Configuration const &_configuration,
-                      std::string _supercell_name,
-                      std::string _configuration_id);
+                      std::shared_ptr<std::string const> _supercell_name,
+                      Index _configuration_id);
 
   /// \brief Shared pointer to the configuration
   Configuration configuration;
 
   /// \brief Name of canonical supercell for the configuration (i.e.
   /// "SCEL4_2_2_1_0_0_0")
-  std::string supercell_name;
+  std::string const &supercell_name() const { return *m_supercell_name; }
+
+  /// \brief Shared handle to the supercell name
+  std::shared_ptr<std::string const> const &supercell_name_ptr() const {
+    return m_supercell_name;
+  }
 
   /// \brief Distinguish configurations in the same canonical supercell (i.e.
   /// "2")
-  std::string configuration_id;
+  std::string configuration_id() const {
+    return std::to_string(m_configuration_id);
+  }
+
+  /// \brief The configuration id, as an integer
+  Index configuration_id_value() const { return m_configuration_id; }
 
   /// \brief Canonical supercell name and configuration id (i.e.
   /// "SCEL4_2_2_1_0_0_0/2")
-  std::string configuration_name;
+  std::string configuration_name() const {
+    return supercell_name() + "/" + configuration_id();
+  }
+
+  /// \brief Hash of the primitive canonical form of the configuration, if
+  ///     found (see `make_primitive_canonical_key`)
+  std::optional<std::uint64_t> const &primitive_canonical_key() const {
+    return m_primitive_canonical_key;
+  }
+
+  /// \brief Set the hash of the primitive canonical form of the
+  ///     configuration, if known
+  void set_primitive_canonical_key(std::optional<std::uint64_t> key) {
+    m_primitive_canonical_key = key;
+  }
 
   bool operator<(ConfigurationRecord const &rhs) const {
     return this->configuration < rhs.configuration;
@@ -38,8 +81,22 @@ struct ConfigurationRecord : public Comparisons<CRTPBase<ConfigurationRecord>> {
 
  private:
   friend struct Comparisons<CRTPBase<ConfigurationRecord>>;
+  friend class ConfigurationSet;
+
+  std::shared_ptr<std::string const> m_supercell_name;
+
+  Index m_configuration_id;
+
+  /// Derived from `configuration`, so it may be found for records already
+  /// in a ConfigurationSet without changing their order
+  mutable std::optional<std::uint64_t> m_primitive_canonical_key;
 };
 
+/// \brief Parse a configuration id, returning std::nullopt if it is not a
+///     non-negative integer in canonical form (i.e. "2", but not "02")
+std::optional<Index> parse_configuration_id(
+    std::string const &configuration_id);
+
 /// \brief Data structure for holding / reading / writing canonical
 /// configurations
 ///
@@ -52,10 +109,43 @@ struct ConfigurationRecord : public Comparisons<CRTPBase<ConfigurationRecord>> {
 ///   use a std::vector<Configuration> or other container
 /// - Includes a map of supercell_name -> next configuration id that can
 ///   be used to automatically provide new configurations with sequential IDs
+/// - Records are stored in a std::set, ordered by configuration. Hashed
+///   indices by configuration fingerprint (see `make_configuration_fingerprint`)
+///   and by supercell name and configuration id are kept consistent with the
+///   ordered storage, so that `find`, `find_by_name`, `count`,
+///   `count_by_name`, `erase`, `erase_by_name`, and the duplicate check on
+///   `insert` are amortized O(1). Configurations with continuous DoF that are
+///   not found by fingerprint are also checked against the ordered storage,
+///   so results do not depend on how DoF values round.
+/// - Configurations are ordered by supercell first, so the records of each
+///   supercell are contiguous in the ordered storage. The per-supercell index
+///   holds the first and last record of each, so `supercell_range` is O(1)
+///   and walks one supercell's records without a scan. Records with the same
+///   supercell name must have the same supercell, and records with the same
+///   supercell must have the same supercell name; `insert` throws otherwise.
+/// - Supercell names are interned: all records in a supercell share one
+///   copy of the supercell name, held by the per-supercell index.
+/// - If the primitive canonical index is enabled (see
+///   `set_primitive_canonical_index`), each record's
+///   `primitive_canonical_key` is found once, when it is inserted, unless
+///   already set, and records are also indexed by it. Then
+///   `find_primitive_canonical` finds a record equivalent to a configuration
+///   in any supercell, such as a configuration imported in a different
+///   supercell, with amortized O(1) lookups. The index is disabled by
+///   default, because finding keys costs a `make_primitive` and
+///   `make_in_canonical_supercell` per insert.
 class ConfigurationSet {
  public:
   ConfigurationSet(std::map<std::string, Index> _next_config_id = {});
 
+  ConfigurationSet(ConfigurationSet const &other);
+
+  ConfigurationSet(ConfigurationSet &&other) = default;
+
+  ConfigurationSet &operator=(ConfigurationSet const &other);
+
+  ConfigurationSet &operator=(ConfigurationSet &&other) = default;
+
   typedef std::set<ConfigurationRecord>::size_type size_type;
   typedef std::set<ConfigurationRecord>::iterator iterator;
   typedef std::set<ConfigurationRecord>::const_iterator const_iterator;
@@ -90,12 +180,30 @@ class ConfigurationSet {
 
   size_type count_by_name(std::string configuration_name) const;
 
+  /// \brief Records with the given supercell name, as a contiguous range of
+  ///     the ordered storage
+  std::pair<const_iterator, const_iterator> supercell_range(
+      std::string const &supercell_name) const;
+
+  /// \brief Number of records with the given supercell name
+  size_type count_by_supercell(std::string const &supercell_name) const;
+
   const_iterator erase(const_iterator it);
 
   size_type erase(Configuration const &configuration);
 
   size_type erase_by_name(std::string configuration_name);
 
+  /// \brief Enable or disable the primitive canonical index
+  void set_primitive_canonical_index(bool enabled);
+
+  /// \brief True if the primitive canonical index is enabled
+  bool has_primitive_canonical_index() const;
+
+  /// \brief Find a record equivalent to a configuration, in any supercell
+  const_iterator find_primitive_canonical(
+      Configuration const &configuration) const;
+
   /// \brief Set IDs, by supercell_name, used to automatically ID new
   /// configurations
   void set_next_config_id(std::map<std::string, Index> const &next_config_id);
@@ -103,17 +211,137 @@ class ConfigurationSet {
   /// \brief IDs, by supercell_name, used to automatically ID new configurations
   std::map<std::string, Index> const &next_config_id() const;
 
+  /// \brief Access the ordered storage; call `rebuild_index` after inserting
+  ///     or erasing through this reference
   std::set<ConfigurationRecord> &data();
 
   std::set<ConfigurationRecord> const &data() const;
 
+  /// \brief Rebuild the hashed indices from the ordered storage
+  void rebuild_index();
+
  private:
+  /// \brief Records of one supercell name
+  struct SupercellIndex {
+    /// Interned supercell name, shared by records inserted into the set
+    std::shared_ptr<std::string const> name;
+
+    /// Number of records
+    size_type size = 0;
+
+    /// First and last record in the ordered storage, valid if `size > 0`
+    const_iterator first;
+    const_iterator last;
+
+    /// configuration_id -> record
+    std::unordered_multimap<Index, const_iterator> by_id;
+  };
+
+  /// \brief Return the per-supercell index, adding a new one with the
+  ///     given shared name if necessary
+  SupercellIndex &_supercell_index(
+      std::shared_ptr<std::string const> const &supercell_name);
+
+  /// \brief Insert a Configuration that is known not to be in the set
+  std::pair<iterator, bool> _insert_new(std::string const &supercell_name,
+                                        Configuration const &configuration);
+
+  /// \brief Return a record with the interned supercell name
+  ConfigurationRecord _intern(ConfigurationRecord const &record);
+
+  /// \brief Add a record inserted in the ordered storage to the indices, or
+  ///     erase it from the ordered storage and throw if the records of a
+  ///     supercell would not be contiguous
+  void _add_to_index(const_iterator it);
+
+  void _remove_from_index(const_iterator it);
+
+  /// \brief Find the primitive canonical key of a record, if necessary, and
+  ///     add it to the primitive canonical index
+  void _add_to_primitive_canonical_index(const_iterator it);
+
   std::set<ConfigurationRecord> m_data;
 
+  /// Configuration fingerprint -> record
+  std::unordered_multimap<std::size_t, const_iterator> m_index_by_fingerprint;
+
+  /// supercell_name -> records
+  std::unordered_map<std::string, SupercellIndex> m_index_by_supercell;
+
+  /// If true, records are indexed by primitive canonical key
+  bool m_has_primitive_canonical_index = false;
+
+  /// Primitive canonical key -> record
+  std::unordered_multimap<std::uint64_t, const_iterator>
+      m_index_by_primitive_canonical_key;
+
   // map of supercell_name -> next id to assign to a new Configuration
   std::map<std::string, Index> m_next_config_id;
 };
 
+/// \brief Stages configurations inserted concurrently, for a deterministic
+///     merge into a ConfigurationSet
+///
+/// Notes:
+/// - `insert` may be called concurrently from many threads. The
+///   ConfigurationSet given to the constructor is only read, to skip
+///   configurations it already contains, and must not be modified until
+///   `merge_into` is called.
+/// - Staged configurations are held in shards, each with its own lock.
+///   Occupation-only configurations are assigned to shards by fingerprint;
+///   configurations with continuous DoF, whose equivalence within tolerance
+///   a fingerprint cannot detect, are assigned to shards by supercell.
+/// - `merge_into` inserts the staged configurations in configuration order,
+///   so configuration ids depend only on which configurations were staged,
+///   not on which thread staged them or when.
+class ConcurrentConfigurationSet {
+ public:
+  /// \brief Constructor
+  explicit ConcurrentConfigurationSet(ConfigurationSet const &_configurations,
+                                      Index _n_shards = 64);
+
+  /// \brief Stage a configuration, if it is not already in the set or staged
+  bool insert(Configuration const &configuration);
+
+  /// \brief Number of staged configurations
+  Index size() const;
+
+  /// \brief Insert all staged configurations, in order, and clear the
+  ///     staged configurations
+  std::vector<ConfigurationSet::const_iterator> merge_into(
+      ConfigurationSet &configurations);
+
+ private:
+  struct Shard {
+    mutable std::mutex mutex;
+    std::set<Configuration> data;
+  };
+
+  ConfigurationSet const &m_configurations;
+
+  std::vector<Shard> m_shards;
+};
+
+/// \brief Estimate the memory used by a ConfigurationSet, in bytes,
+///     including its supercells if not already counted
+Index memory_usage(ConfigurationSet const &configurations,
+                   MemoryUsageContext &context);
+
+/// \brief Estimate the memory used by a ConfigurationSet, in bytes,
+///     including its supercells
+Index memory_usage(ConfigurationSet const &configurations);
+
+/// \brief Make a hash of a configuration's supercell and DoF values
+std::size_t make_configuration_fingerprint(Configuration const &configuration);
+
+/// \brief Return the canonical form, in the canonical supercell, of the
+///     primitive configuration
+Configuration make_primitive_canonical_form(
+    Configuration const &configuration);
+
+/// \brief Make a hash of the primitive canonical form of a configuration
+std::uint64_t make_primitive_canonical_key(Configuration const &configuration);
+
 /// \brief Make a map for finding ConfigurationRecord by configuration_name
 std::map<std::string, ConfigurationRecord const *>
 make_index_by_configuration_name(
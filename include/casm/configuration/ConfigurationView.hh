@@ -0,0 +1,89 @@
+#ifndef CASM_config_ConfigurationView
+#define CASM_config_ConfigurationView
+
+#include <map>
+#include <memory>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/global/eigen.hh"
+
+namespace CASM {
+namespace config {
+
+struct Configuration;
+struct Supercell;
+class SupercellSymOp;
+
+/// \brief Read-only references to configuration DoF values
+///
+/// Values are in the prim basis, with the same shapes as the corresponding
+/// values of `clexulator::ConfigDoFValues`: occupation is size `n_sites`,
+/// local DoF values are `(max DoF dimension, n_sites)` column-major, and
+/// global DoF values are size `DoF dimension`. The referenced buffers are not
+/// owned and must outlive the view.
+struct ConfigDoFValuesView {
+  /// \brief Reference the values of a ConfigDoFValues
+  explicit ConfigDoFValuesView(clexulator::ConfigDoFValues const &dof_values);
+
+  /// \brief Reference occupation values, with no continuous DoF values
+  ConfigDoFValuesView(int const *_occupation, Index n_sites);
+
+  /// \brief Occupation values
+  Eigen::Map<Eigen::VectorXi const> occupation;
+
+  /// \brief Local continuous DoF values
+  std::map<DoFKey, Eigen::Map<Eigen::MatrixXd const>> local_dof_values;
+
+  /// \brief Global continuous DoF values
+  std::map<DoFKey, Eigen::Map<Eigen::VectorXd const>> global_dof_values;
+};
+
+/// \brief Non-owning view of a configuration, with DoF values in external
+///     buffers
+///
+/// A ConfigurationView can be used in place of a Configuration by
+/// `is_canonical`, `to_canonical`, and `make_invariant_subgroup` with
+/// SupercellSymOp iterators, and by `ConfigIsEquivalent` and `ConfigCompare`
+/// for comparisons of the view with transformations of itself. These read
+/// the referenced buffers directly, so that engines that own DoF values in
+/// their own arrays, or numpy arrays, do not need to copy them into a
+/// Configuration for each call. Functions which make new configurations or
+/// structures from a view, such as `copy_apply`, `copy_configuration`, and
+/// `make_simple_structure`, copy the values once.
+///
+/// Example:
+/// \code
+/// // occupation: int[n_sites], owned by a Monte Carlo engine
+/// ConfigurationView view(supercell, occupation);
+/// bool result = is_canonical(view, begin, end);
+/// \endcode
+struct ConfigurationView {
+  /// \brief Reference the supercell and DoF values of a Configuration
+  explicit ConfigurationView(Configuration const &configuration);
+
+  /// \brief Reference DoF values in external buffers
+  ConfigurationView(
+      std::shared_ptr<Supercell const> const &_supercell,
+      int const *occupation,
+      std::map<DoFKey, double const *> const &local_dof_values = {},
+      std::map<DoFKey, double const *> const &global_dof_values = {});
+
+  /// \brief The supercell
+  std::shared_ptr<Supercell const> supercell;
+
+  /// \brief References to DoF values, in the prim basis
+  ConfigDoFValuesView dof_values;
+};
+
+/// \brief Copy the DoF values referenced by a view into a Configuration
+Configuration make_configuration(ConfigurationView const &view);
+
+/// \brief Apply a symmetry operation to the configuration referenced by a
+///     view, giving a new Configuration
+Configuration copy_apply(SupercellSymOp const &op,
+                         ConfigurationView const &view);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
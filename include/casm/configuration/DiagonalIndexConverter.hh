@@ -0,0 +1,106 @@
+#ifndef CASM_config_DiagonalIndexConverter
+#define CASM_config_DiagonalIndexConverter
+
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/configuration/sym_info/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Fast linear index conversions for supercells with a diagonal
+///     transformation matrix
+///
+/// Notes:
+/// - For a diagonal transformation matrix, `T = diag(n0, n1, n2)`, unit
+///   cells within the supercell are the grid `Z_n0 x Z_n1 x Z_n2`, so
+///   reducing a unit cell into the supercell is a modulo per component and
+///   translations add in grid coordinates. This avoids the general
+///   `xtal::UnitCellIndexConverter` lookup, which brings unit cells within
+///   the superlattice and then searches a hash map.
+/// - If every extent is a power of two, the modulo and the grid linear index
+///   are computed with bit masks and shifts.
+/// - Linear indices are the same as those of the supercell's
+///   `unitcell_index_converter` and `unitcellcoord_index_converter`. A table
+///   from grid index to linear unit cell index, and its inverse, are
+///   constructed once, from the general converter.
+/// - Constructed by Supercell if its transformation matrix is diagonal, and
+///   used for translation permutations.
+class DiagonalIndexConverter {
+ public:
+  /// \brief Constructor
+  DiagonalIndexConverter(
+      Eigen::Matrix3l const &transformation_matrix_to_super,
+      xtal::UnitCellIndexConverter const &unitcell_index_converter,
+      xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter);
+
+  /// \brief Return true if a transformation matrix is diagonal
+  static bool is_diagonal(
+      Eigen::Matrix3l const &transformation_matrix_to_super);
+
+  /// \brief Grid extents, the absolute values of the transformation matrix
+  ///     diagonal
+  Eigen::Vector3l const &shape() const { return m_shape; }
+
+  /// \brief Return true if all grid extents are powers of two
+  bool is_power_of_two() const { return m_is_power_of_two; }
+
+  /// \brief Number of unit cells in the supercell
+  Index n_unitcells() const { return m_n_unitcells; }
+
+  /// \brief Number of sites in the supercell
+  Index n_sites() const { return m_n_unitcells * m_n_sublat; }
+
+  /// \brief Linear unit cell index of a unit cell, brought within the
+  ///     supercell
+  Index linear_unitcell_index(UnitCell const &unitcell) const;
+
+  /// \brief Linear site index of a site, brought within the supercell
+  Index linear_site_index(UnitCellCoord const &bijk) const;
+
+  /// \brief Linear site index of site `l` translated by a supercell
+  ///     translation
+  Index translate_site_index(Index l, Index translation_index) const;
+
+  /// \brief Construct a single supercell translation permutation
+  sym_info::Permutation make_translation_permutation(
+      Index translation_index) const;
+
+  /// \brief Return `make_translation_permutation(translation_index)[i]`,
+  ///     without constructing the permutation
+  Index translation_permute_index(Index translation_index, Index i) const;
+
+  /// \brief Memory used by the index tables, in bytes
+  Index size_bytes() const;
+
+ private:
+  /// \brief Grid index of the grid coordinate `(i, j, k)`, reduced
+  Index _grid_index(Index i, Index j, Index k) const;
+
+  /// \brief Grid index of the sum, or difference, of grid indices
+  Index _add(Index g, Index h, bool subtract) const;
+
+  Eigen::Vector3l m_shape;
+
+  bool m_is_power_of_two;
+
+  /// \brief If `m_is_power_of_two`, the grid index is
+  ///     `(i << m_shift(0)) | (j << m_shift(1)) | k`
+  Eigen::Vector3l m_shift;
+
+  Index m_n_unitcells;
+
+  Index m_n_sublat;
+
+  /// \brief Linear unit cell index, by grid index
+  std::vector<Index> m_grid_to_unitcell;
+
+  /// \brief Grid index, by linear unit cell index
+  std::vector<Index> m_unitcell_to_grid;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef CASM_config_DistinctSuperConfigurationMaker
+#define CASM_config_DistinctSuperConfigurationMaker
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+class DistinctConfigurationFinder;
+class SupercellSet;
+
+/// \brief Makes distinct super configurations of one motif in many
+///     supercells
+///
+/// Gives the same configurations, in the same order, as
+/// `make_distinct_super_configurations(motif, supercell)`, but:
+/// - The primitive motif is made once, at construction.
+/// - The prim factor group operations that are minimal in their double coset
+///   `supercell_fg * prim_fg_op * prim_motif_supercell_fg` depend only on
+///   the supercell factor group, so they are found once for each distinct
+///   supercell factor group and stored. Supercells with the same point group
+///   reuse them, and only the lattice tiling check is repeated.
+///
+/// Const methods are safe to call concurrently.
+class DistinctSuperConfigurationMaker {
+ public:
+  /// \brief Constructor
+  explicit DistinctSuperConfigurationMaker(Configuration const &motif);
+
+  /// \brief The primitive motif configuration
+  Configuration const &prim_motif() const;
+
+  /// \brief Return prim factor group indices that create tilings of the
+  ///     motif into a supercell that are not equivalent under supercell
+  ///     factor group operations
+  std::set<Index> unique_generating_prim_factor_group_indices(
+      std::shared_ptr<Supercell const> const &supercell) const;
+
+  /// \brief Make the distinct super configurations of the motif in a
+  ///     supercell
+  std::vector<Configuration> operator()(
+      std::shared_ptr<Supercell const> const &supercell) const;
+
+  /// \brief Number of distinct supercell factor groups seen so far
+  Index n_cached_factor_groups() const;
+
+ private:
+  /// \brief Return the prim factor group indices that are minimal in their
+  ///     double coset, computing them on first use for a supercell factor
+  ///     group
+  std::vector<Index> const &_double_coset_representatives(
+      std::vector<Index> const &supercell_head_group_index) const;
+
+  Configuration m_prim_motif;
+
+  mutable std::mutex m_mutex;
+
+  /// Minimal double coset representatives, by supercell factor group
+  /// head_group_index
+  mutable std::map<std::vector<Index>, std::vector<Index>>
+      m_double_coset_representatives;
+};
+
+/// \brief Make the distinct super configurations of a motif in each of many
+///     supercells, in parallel
+std::vector<std::vector<Configuration>> make_distinct_super_configurations(
+    Configuration const &motif,
+    std::vector<std::shared_ptr<Supercell const>> const &supercells,
+    Index n_threads);
+
+/// \brief Make distinct super configurations of a motif, without changing
+///     the motif orientation, in all supercells equivalent to those given
+std::vector<Configuration> make_fixed_orientation_super_configurations(
+    Configuration const &motif,
+    std::vector<std::shared_ptr<Supercell const>> const &supercells,
+    DistinctConfigurationFinder &finder, SupercellSet *supercell_set = nullptr,
+    Index n_threads = 1);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
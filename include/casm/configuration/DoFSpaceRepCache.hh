@@ -0,0 +1,80 @@
+#ifndef CASM_config_DoFSpaceRepCache
+#define CASM_config_DoFSpaceRepCache
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace clexulator {
+struct DoFSpace;
+}
+namespace config {
+
+class SupercellSymOp;
+
+/// \brief Stores `make_dof_space_rep` results in memory, keyed by their
+///     inputs
+///
+/// Notes:
+/// - Results are keyed by the supercell, the group elements (as supercell
+///   factor group and translation index pairs), and the DoFSpace DoF type,
+///   sites, and basis. The basis is compared using `tol`. A hash of its
+///   values rounded to a multiple of `tol` is used to find candidate
+///   results, so a hash miss only causes the representation to be repeated.
+/// - Results are shared, and not copied, when they are found.
+/// - It is safe to call `make` concurrently.
+class DoFSpaceRepCache {
+ public:
+  /// \brief Constructor
+  DoFSpaceRepCache(double _tol = TOL);
+
+  /// \brief Return a stored DoFSpace matrix representation with the same
+  ///     inputs, or construct, store, and return a new one
+  std::shared_ptr<std::vector<Eigen::MatrixXd> const> make(
+      std::vector<SupercellSymOp> const &group,
+      clexulator::DoFSpace const &dof_space);
+
+  /// \brief Tolerance used to compare inputs
+  double tol() const;
+
+  /// \brief Number of stored results
+  Index size() const;
+
+  /// \brief Erase stored results
+  void clear();
+
+ private:
+  struct Entry {
+    std::shared_ptr<Supercell const> supercell;
+    std::vector<std::pair<Index, Index>> group;
+    DoFKey dof_key;
+    std::optional<std::set<Index>> sites;
+    Eigen::MatrixXd basis;
+    std::shared_ptr<std::vector<Eigen::MatrixXd> const> result;
+  };
+
+  std::size_t _hash(std::vector<std::pair<Index, Index>> const &group_index,
+                    clexulator::DoFSpace const &dof_space) const;
+
+  std::shared_ptr<std::vector<Eigen::MatrixXd> const> _find(
+      std::size_t key, std::shared_ptr<Supercell const> const &supercell,
+      std::vector<std::pair<Index, Index>> const &group_index,
+      clexulator::DoFSpace const &dof_space) const;
+
+  double m_tol;
+
+  mutable std::mutex m_mutex;
+
+  std::unordered_multimap<std::size_t, Entry> m_entries;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -14,13 +14,13 @@ namespace config {
 /// Removes specified occupation modes from the DoFSpace basis, by sublattice
 clexulator::DoFSpace exclude_default_occ_modes_by_sublattice(
     clexulator::DoFSpace const &dof_space,
-    std::map<int, int> sublattice_index_to_default_occ);
+    std::map<int, int> sublattice_index_to_default_occ, Index n_threads = 1);
 
 /// Removes specified occupation modes from the DoFSpace basis, by supercell
 /// site index
 clexulator::DoFSpace exclude_default_occ_modes_by_site(
     clexulator::DoFSpace const &dof_space,
-    std::map<Index, int> site_index_to_default_occ);
+    std::map<Index, int> site_index_to_default_occ, Index n_threads = 1);
 
 /// Removes specified occupation modes from the DoFSpace basis
 clexulator::DoFSpace exclude_default_occ_modes(
@@ -29,7 +29,8 @@ clexulator::DoFSpace exclude_default_occ_modes(
     std::optional<std::map<int, int>> sublattice_index_to_default_occ =
         std::nullopt,
     std::optional<std::map<Index, int>> site_index_to_default_occ =
-        std::nullopt);
+        std::nullopt,
+    Index n_threads = 1);
 
 /// Removes homogeneous modes from the DoFSpace basis
 clexulator::DoFSpace exclude_homogeneous_mode_space(
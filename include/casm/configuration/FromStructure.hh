@@ -1,9 +1,13 @@
 #ifndef CASM_config_FromStructure
 #define CASM_config_FromStructure
 
+#include <functional>
 #include <map>
+#include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "casm/global/definitions.hh"
 #include "casm/global/eigen.hh"
@@ -102,9 +106,23 @@ class FromStructure {
   std::map<std::string, Eigen::VectorXd> default_make_global_properties(
       xtal::SimpleStructure const &mapped_structure) const;
 
+  std::vector<std::optional<ConfigurationWithProperties>> make_batch(
+      std::vector<xtal::SimpleStructure> const &mapped_structures,
+      SupercellSet &supercells,
+      std::function<ConfigurationWithProperties(
+          xtal::SimpleStructure const &,
+          std::shared_ptr<Supercell const> const &)>
+          make_f,
+      std::vector<std::string> &error_messages, Index n_threads) const;
+
  protected:
   std::shared_ptr<Prim const> m_prim;
   std::shared_ptr<xtal::BasicStructure const> m_xtal_prim;
+
+  /// \brief Occupant indices, by sublattice, then by occupant name
+  ///     (`Molecule::name()`), in increasing order
+  std::vector<std::unordered_map<std::string, std::vector<Index>>>
+      m_occupant_indices_by_name;
 };
 
 /// \brief Construct a configuration with properties from
@@ -149,20 +167,33 @@ class FromIsotropicAtomicStructure : public FromStructure {
   ConfigurationWithProperties operator()(
       xtal::SimpleStructure const &mapped_structure);
 
+  /// \brief Construct configurations with properties from mapped
+  ///     structures, in parallel
+  std::vector<std::optional<ConfigurationWithProperties>> operator()(
+      std::vector<xtal::SimpleStructure> const &mapped_structures,
+      std::vector<std::string> &error_messages, Index n_threads = 1);
+
   /// \brief Return shared pointer to all supercells
   std::shared_ptr<SupercellSet> supercells() const;
 
  protected:
   std::runtime_error error(std::string what) const override;
 
+  ConfigurationWithProperties make(
+      xtal::SimpleStructure const &mapped_structure,
+      std::shared_ptr<Supercell const> const &supercell) const;
+
   Eigen::VectorXi make_occupation(
-      xtal::SimpleStructure const &mapped_structure) const;
+      xtal::SimpleStructure const &mapped_structure,
+      std::shared_ptr<Supercell const> const &supercell) const;
 
   std::map<std::string, Eigen::MatrixXd> make_local_dof_values(
-      xtal::SimpleStructure const &mapped_structure) const;
+      xtal::SimpleStructure const &mapped_structure,
+      std::shared_ptr<Supercell const> const &supercell) const;
 
   std::map<std::string, Eigen::MatrixXd> make_local_properties(
-      xtal::SimpleStructure const &mapped_structure) const;
+      xtal::SimpleStructure const &mapped_structure,
+      std::shared_ptr<Supercell const> const &supercell) const;
 
   std::map<std::string, Eigen::VectorXd> make_global_dof_values(
       xtal::SimpleStructure const &mapped_structure) const;
@@ -171,9 +202,6 @@ class FromIsotropicAtomicStructure : public FromStructure {
       xtal::SimpleStructure const &mapped_structure) const;
 
  private:
-  // Current supercell
-  std::shared_ptr<Supercell const> m_current_supercell;
-
   // Set of supercells to avoid unnecessary duplication
   std::shared_ptr<SupercellSet> m_supercells;
 };
@@ -231,20 +259,34 @@ class FromDiscreteMagneticAtomicStructure : public FromStructure {
   ConfigurationWithProperties operator()(
       xtal::SimpleStructure const &mapped_structure);
 
+  /// \brief Construct configurations with properties from mapped
+  ///     structures, in parallel
+  std::vector<std::optional<ConfigurationWithProperties>> operator()(
+      std::vector<xtal::SimpleStructure> const &mapped_structures,
+      std::vector<std::string> &error_messages, Index n_threads = 1);
+
   /// \brief Return shared pointer to all supercells
   std::shared_ptr<SupercellSet> supercells() const;
 
  protected:
   std::runtime_error error(std::string what) const override;
 
-  Eigen::VectorXi make_occupation(xtal::SimpleStructure const &mapped_structure,
-                                  Eigen::MatrixXd const &magspin) const;
+  ConfigurationWithProperties make(
+      xtal::SimpleStructure const &mapped_structure,
+      std::shared_ptr<Supercell const> const &supercell) const;
+
+  Eigen::VectorXi make_occupation(
+      xtal::SimpleStructure const &mapped_structure,
+      std::shared_ptr<Supercell const> const &supercell,
+      Eigen::MatrixXd const &magspin) const;
 
   std::map<std::string, Eigen::MatrixXd> make_local_dof_values(
-      xtal::SimpleStructure const &mapped_structure) const;
+      xtal::SimpleStructure const &mapped_structure,
+      std::shared_ptr<Supercell const> const &supercell) const;
 
   std::map<std::string, Eigen::MatrixXd> make_local_properties(
       xtal::SimpleStructure const &mapped_structure,
+      std::shared_ptr<Supercell const> const &supercell,
       std::set<std::string> excluded = {}) const;
 
   std::map<std::string, Eigen::VectorXd> make_global_dof_values(
@@ -254,15 +296,17 @@ class FromDiscreteMagneticAtomicStructure : public FromStructure {
       xtal::SimpleStructure const &mapped_structure) const;
 
  private:
-  // Current supercell
-  std::shared_ptr<Supercell const> m_current_supercell;
-
   // Set of supercells to avoid unnecessary duplication
   std::shared_ptr<SupercellSet> m_supercells;
 
   // Maximum allowed difference when mapping magspin,
   // using (calculated_magspin - ideal_magspin).norm()
   double m_magspin_tol;
+
+  /// \brief Occupant indices, by sublattice, then by atom name
+  ///     (`mol.atom(0).name()`), in increasing order
+  std::vector<std::unordered_map<std::string, std::vector<Index>>>
+      m_occupant_indices_by_atom_name;
 };
 
 }  // namespace config
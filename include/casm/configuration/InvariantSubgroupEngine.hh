@@ -0,0 +1,107 @@
+#ifndef CASM_config_InvariantSubgroupEngine
+#define CASM_config_InvariantSubgroupEngine
+
+#include <set>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Finds invariant subgroups and equivalents of configurations with
+///     respect to all operations that leave a supercell lattice invariant
+///
+/// The supercell symmetry group, G, is the set of operations `t * f`, where
+/// `f` is a supercell factor group operation and `t` is one of the supercell
+/// translations, T. The invariant subgroup, H, of a configuration is found
+/// incrementally using the coset structure of G:
+/// - The invariant translations, H_T, are found first. When a translation is
+///   found to be invariant, the subgroup it generates with the invariant
+///   translations already found is added without comparisons. When a
+///   translation is not invariant, no translation in its coset of H_T is
+///   invariant.
+/// - If `t0 * f` leaves the configuration invariant, then the elements of H
+///   with factor group operation `f` are exactly `H_T * t0 * f`. So for each
+///   factor group operation, only one translation per coset of H_T is tested,
+///   and testing stops when one is found.
+/// - The factor group operations of H form a subgroup. Products of those
+///   already found are added without comparisons, and products of those
+///   excluded with those found are excluded without comparisons.
+///
+/// Equivalents are generated by applying one operation from each left coset
+/// `g * H` of G, so each distinct equivalent configuration is constructed
+/// once. All results are identical to those of `make_invariant_subgroup`
+/// and `make_equivalents` in `canonical_form.hh` with
+/// `[SupercellSymOp::begin(supercell), SupercellSymOp::end(supercell))`.
+class InvariantSubgroupEngine {
+ public:
+  /// \brief Constructor
+  explicit InvariantSubgroupEngine(
+      std::shared_ptr<Supercell const> const &_supercell);
+
+  /// \brief The supercell
+  std::shared_ptr<Supercell const> const &supercell() const;
+
+  /// \brief Number of supercell factor group operations
+  Index n_factor_group() const;
+
+  /// \brief Number of supercell translations
+  Index n_translations() const;
+
+  /// \brief Return the indices of the translations that leave the
+  ///     configuration invariant
+  std::vector<Index> make_invariant_translation_indices(
+      Configuration const &configuration,
+      std::set<std::string> const &which_dofs = {"all"}) const;
+
+  /// \brief Return the operations that leave the configuration invariant
+  std::vector<SupercellSymOp> make_invariant_subgroup(
+      Configuration const &configuration,
+      std::set<std::string> const &which_dofs = {"all"}) const;
+
+  /// \brief Return the first operation of each left coset of a subgroup
+  std::vector<SupercellSymOp> make_left_coset_representatives(
+      std::vector<SupercellSymOp> const &subgroup) const;
+
+  /// \brief Return the first operation of each double coset of two
+  ///     subgroups
+  std::vector<SupercellSymOp> make_double_coset_representatives(
+      std::vector<SupercellSymOp> const &left_subgroup,
+      std::vector<SupercellSymOp> const &right_subgroup) const;
+
+  /// \brief Return the distinct symmetrically equivalent configurations
+  std::vector<Configuration> make_equivalents(
+      Configuration const &configuration) const;
+
+  /// \brief Return the distinct symmetrically equivalent configurations
+  std::vector<ConfigurationWithProperties> make_equivalents(
+      ConfigurationWithProperties const &configuration_with_properties) const;
+
+ private:
+  void _throw_if_other_supercell(Configuration const &configuration) const;
+
+  /// \brief Index of the translation by `a` followed by `b`
+  Index _translation_sum(Index a, Index b) const;
+
+  /// \brief Index of `op` in `[SupercellSymOp::begin(supercell),
+  ///     SupercellSymOp::end(supercell))`
+  Index _op_index(SupercellSymOp const &op) const {
+    return op.supercell_factor_group_index() * m_n_translations +
+           op.translation_index();
+  }
+
+  std::shared_ptr<Supercell const> m_supercell;
+
+  /// \brief Number of supercell factor group operations
+  Index m_n_factor_group;
+
+  /// \brief Number of supercell translations
+  Index m_n_translations;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
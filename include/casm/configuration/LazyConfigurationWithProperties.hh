@@ -0,0 +1,144 @@
+#ifndef CASM_config_LazyConfigurationWithProperties
+#define CASM_config_LazyConfigurationWithProperties
+
+#include <set>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief A ConfigurationWithProperties with a symmetry operation applied,
+///     where each property is transformed the first time it is accessed
+///
+/// The configuration is transformed on construction. Properties are read
+/// from a shared, untransformed original, and each is transformed only when
+/// first requested and then cached, so if only the configuration or a few
+/// properties are used, the other properties are never transformed.
+///
+/// Accessors are const but fill the cache, so one instance should not be
+/// accessed from multiple threads at once.
+class LazyConfigurationWithProperties {
+ public:
+  /// \brief Constructor
+  LazyConfigurationWithProperties(
+      SupercellSymOp const &op,
+      std::shared_ptr<ConfigurationWithProperties const> const &original);
+
+  /// \brief Constructor, with the configuration already transformed
+  LazyConfigurationWithProperties(
+      SupercellSymOp const &op,
+      std::shared_ptr<ConfigurationWithProperties const> const &original,
+      Configuration const &transformed_configuration);
+
+  /// \brief The transformed configuration
+  Configuration const &configuration() const { return m_configuration; }
+
+  /// \brief The symmetry operation applied to the original
+  SupercellSymOp const &op() const { return m_op; }
+
+  /// \brief The untransformed original
+  ConfigurationWithProperties const &original() const { return *m_original; }
+
+  /// \brief Names of the local properties
+  std::set<std::string> local_property_keys() const;
+
+  /// \brief Names of the global properties
+  std::set<std::string> global_property_keys() const;
+
+  /// \brief Return true if there is a local property with name `key`
+  bool has_local_property(std::string const &key) const;
+
+  /// \brief Return true if there is a global property with name `key`
+  bool has_global_property(std::string const &key) const;
+
+  /// \brief The transformed value of a local property
+  Eigen::MatrixXd const &local_property(std::string const &key) const;
+
+  /// \brief The transformed value of a global property
+  Eigen::VectorXd const &global_property(std::string const &key) const;
+
+  /// \brief Transform all properties and return the result
+  ConfigurationWithProperties materialize() const;
+
+ private:
+  SupercellSymOp m_op;
+
+  std::shared_ptr<ConfigurationWithProperties const> m_original;
+
+  Configuration m_configuration;
+
+  /// Transformed local properties, by name, filled when first accessed
+  mutable std::map<std::string, Eigen::MatrixXd> m_local_properties;
+
+  /// Transformed global properties, by name, filled when first accessed
+  mutable std::map<std::string, Eigen::VectorXd> m_global_properties;
+
+  /// Holds the combined site permutation once a local property is accessed
+  mutable SupercellSymOpWorkspace m_workspace;
+};
+
+/// \brief Apply a symmetry operation to a configuration with properties,
+///     transforming properties only when they are accessed
+LazyConfigurationWithProperties copy_apply_lazy(
+    SupercellSymOp const &op,
+    std::shared_ptr<ConfigurationWithProperties const> const &original);
+
+/// \brief Return `copy_apply_lazy(op, original)` for each op in
+///     [begin, end), sharing one original
+///
+/// Unlike `make_equivalents`, this does not remove duplicates, so the
+/// result is one value per op, which is what is needed for symmetry
+/// augmentation of a dataset.
+template <typename SupercellSymOpIt>
+std::vector<LazyConfigurationWithProperties> make_lazy_copies(
+    ConfigurationWithProperties const &original, SupercellSymOpIt begin,
+    SupercellSymOpIt end) {
+  auto shared_original =
+      std::make_shared<ConfigurationWithProperties const>(original);
+  std::vector<LazyConfigurationWithProperties> result;
+  for (auto it = begin; it != end; ++it) {
+    result.emplace_back(*it, shared_original);
+  }
+  return result;
+}
+
+/// \brief Return the distinct symmetrically equivalent configurations with
+///     properties, transforming properties only when they are accessed
+///
+/// Gives the same equivalents, in the same order, as
+/// `make_equivalents(configuration_with_properties, begin, end)`.
+template <typename SupercellSymOpIt>
+std::vector<LazyConfigurationWithProperties> make_lazy_equivalents(
+    ConfigurationWithProperties const &configuration_with_properties,
+    SupercellSymOpIt begin, SupercellSymOpIt end) {
+  Configuration const &configuration =
+      configuration_with_properties.configuration;
+  auto compare = [](std::pair<Configuration, SupercellSymOp> const &A,
+                    std::pair<Configuration, SupercellSymOp> const &B) {
+    return A.first < B.first;
+  };
+  std::set<std::pair<Configuration, SupercellSymOp>, decltype(compare)>
+      equivalents(compare);
+  SupercellSymOpApplier applier;
+  for (auto it = begin; it != end; ++it) {
+    equivalents.emplace(applier.copy_apply(*it, configuration), *it);
+  }
+
+  std::vector<LazyConfigurationWithProperties> result;
+  if (equivalents.size() == 0) {
+    return result;
+  }
+  auto shared_original = std::make_shared<ConfigurationWithProperties const>(
+      configuration_with_properties);
+  for (auto const &pair : equivalents) {
+    result.emplace_back(pair.second, shared_original, pair.first);
+  }
+  return result;
+}
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
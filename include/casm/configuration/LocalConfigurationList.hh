@@ -0,0 +1,114 @@
+#ifndef CASM_config_LocalConfigurationList
+#define CASM_config_LocalConfigurationList
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief A configuration and the position of an event in it
+///
+/// The position of the event is `pos = (unitcell_index, equivalent_index)`,
+/// where `equivalent_index` is an index into the orbit of equivalent events
+/// associated with the origin unit cell and `unitcell_index` is the unit cell
+/// of the event in the supercell. LocalConfiguration are compared by `pos`
+/// and then by `configuration`.
+struct LocalConfiguration : public Comparisons<CRTPBase<LocalConfiguration>> {
+  LocalConfiguration(Configuration const &_configuration,
+                     std::pair<Index, Index> const &_pos);
+
+  /// \brief The configuration
+  Configuration configuration;
+
+  /// \brief The event position, as `(unitcell_index, equivalent_index)`
+  std::pair<Index, Index> pos;
+
+  /// \brief Less than comparison, by pos and then by configuration
+  bool operator<(LocalConfiguration const &rhs) const;
+
+ private:
+  friend struct Comparisons<CRTPBase<LocalConfiguration>>;
+
+  bool eq_impl(LocalConfiguration const &rhs) const;
+};
+
+/// \brief Hash of a local configuration that is consistent with
+///     LocalConfiguration equality
+///
+/// Combines the event position and the ConfigurationHash.
+struct LocalConfigurationHash {
+  std::size_t operator()(LocalConfiguration const &local_configuration) const;
+};
+
+/// \brief A list of local configurations, with hashed lookup
+///
+/// Local configurations are stored contiguously, in list order, and may
+/// include duplicates. An index from LocalConfigurationHash to list position
+/// is maintained, so `contains` and `index` check only local configurations
+/// with the same hash, instead of searching the whole list. Appending and
+/// setting values update the index in O(1); erasing and sorting rebuild it.
+class LocalConfigurationList {
+ public:
+  typedef std::vector<LocalConfiguration>::const_iterator const_iterator;
+
+  /// \brief Number of local configurations
+  Index size() const;
+
+  /// \brief True if there are no local configurations
+  bool empty() const;
+
+  /// \brief Return the i-th local configuration
+  LocalConfiguration const &at(Index i) const;
+
+  /// \brief Append a local configuration
+  void push_back(LocalConfiguration const &value);
+
+  /// \brief Append local configurations, in order
+  void extend(std::vector<LocalConfiguration> const &values);
+
+  /// \brief Set the i-th local configuration
+  void set(Index i, LocalConfiguration const &value);
+
+  /// \brief Erase the i-th local configuration
+  void erase(Index i);
+
+  /// \brief Remove all local configurations
+  void clear();
+
+  /// \brief Reserve space for `n` local configurations
+  void reserve(Index n);
+
+  /// \brief Sort local configurations, keeping the order of equal values
+  void sort();
+
+  /// \brief Return the index of the first equal local configuration, or -1
+  Index index(LocalConfiguration const &value) const;
+
+  /// \brief Return true if an equal local configuration is present
+  bool contains(LocalConfiguration const &value) const;
+
+  /// \brief Local configurations, in list order
+  std::vector<LocalConfiguration> const &values() const;
+
+  const_iterator begin() const;
+
+  const_iterator end() const;
+
+ private:
+  void _rebuild_index();
+
+  std::vector<LocalConfiguration> m_values;
+
+  /// LocalConfigurationHash -> index in m_values
+  std::unordered_multimap<std::size_t, Index> m_index;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
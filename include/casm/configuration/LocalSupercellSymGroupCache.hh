@@ -0,0 +1,123 @@
+#ifndef CASM_config_LocalSupercellSymGroupCache
+#define CASM_config_LocalSupercellSymGroupCache
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Local property symmetry of a phenomenal cluster or event in a
+///     supercell
+///
+/// Holds `make_local_supercell_symgroup_rep` and `make_local_symgroup` for
+/// one local prim subgroup (such as a cluster group or OccEvent invariant
+/// group) and one supercell.
+struct LocalSupercellSymGroup {
+  /// \brief Constructor
+  LocalSupercellSymGroup(
+      std::shared_ptr<SymGroup const> const &_local_prim_subgroup,
+      std::shared_ptr<Supercell const> const &_supercell);
+
+  /// \brief The local prim subgroup
+  std::shared_ptr<SymGroup const> local_prim_subgroup;
+
+  /// \brief The supercell
+  std::shared_ptr<Supercell const> supercell;
+
+  /// \brief The SupercellSymOp consistent with both the supercell and
+  ///     `local_prim_subgroup`
+  std::vector<SupercellSymOp> supercell_symgroup_rep;
+
+  /// \brief `supercell_symgroup_rep` as a SymGroup, with the prim factor
+  ///     group as head group
+  std::shared_ptr<SymGroup const> symgroup;
+
+  /// \brief Approximate memory used, in bytes
+  Index size_bytes() const;
+};
+
+/// \brief Default memory budget, in bytes, of a LocalSupercellSymGroupCache
+constexpr Index DEFAULT_LOCAL_SUPERCELL_SYMGROUP_CACHE_MAX_BYTES = 1 << 24;
+
+/// \brief Thread-safe, bounded cache of LocalSupercellSymGroup
+///
+/// Notes:
+/// - Values are keyed by the supercell and local prim subgroup objects, so
+///   repeated requests with the same shared supercell and group (for
+///   example, the invariant groups stored by OccEventPrimInfo) are found
+///   without constructing SupercellSymOp again. Values hold both, so keys
+///   are not reused while stored.
+/// - Values are kept, least recently used first out, while their total
+///   `size_bytes()` is at most `max_bytes`. A value larger than `max_bytes`
+///   is returned without being stored.
+/// - Values are returned as shared pointers, so they remain valid after
+///   being evicted. All methods may be called concurrently.
+class LocalSupercellSymGroupCache {
+ public:
+  /// \brief Constructor
+  explicit LocalSupercellSymGroupCache(
+      Index _max_bytes = DEFAULT_LOCAL_SUPERCELL_SYMGROUP_CACHE_MAX_BYTES);
+
+  /// \brief Get LocalSupercellSymGroup, constructing it if not cached
+  std::shared_ptr<LocalSupercellSymGroup const> get(
+      std::shared_ptr<SymGroup const> const &local_prim_subgroup,
+      std::shared_ptr<Supercell const> const &supercell);
+
+  /// \brief Memory budget, in bytes
+  Index max_bytes() const;
+
+  /// \brief Total size of cached values, in bytes
+  Index size_bytes() const;
+
+  /// \brief Number of cached values
+  Index size() const;
+
+  /// \brief Number of calls to `get` that found a cached value
+  Index n_hits() const;
+
+  /// \brief Number of calls to `get` that constructed a value
+  Index n_misses() const;
+
+  /// \brief Remove all cached values
+  void clear();
+
+ private:
+  typedef std::pair<Supercell const *, SymGroup const *> key_type;
+
+  typedef std::list<key_type> lru_list_type;
+
+  struct Entry {
+    std::shared_ptr<LocalSupercellSymGroup const> value;
+    lru_list_type::iterator lru_position;
+  };
+
+  Index m_max_bytes;
+
+  mutable std::mutex m_mutex;
+
+  /// Keys, most recently used first
+  lru_list_type m_lru;
+
+  std::map<key_type, Entry> m_entries;
+
+  Index m_size_bytes;
+
+  Index m_n_hits;
+
+  Index m_n_misses;
+};
+
+/// \brief Process-wide LocalSupercellSymGroupCache
+LocalSupercellSymGroupCache &local_supercell_symgroup_cache();
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef CASM_config_MotifTilingMap
+#define CASM_config_MotifTilingMap
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+
+namespace CASM {
+namespace config {
+
+struct Configuration;
+struct ConfigurationWithProperties;
+
+/// \brief Maps the sites of a supercell to the sites of a motif configuration
+///     that tiles it, for repeated `copy_configuration`
+///
+/// For each site in `supercell`, the map stores the linear index of the
+/// source site in `motif_supercell`, and, if the tiling is transformed by a
+/// prim factor group operation, the occupation and local DoF representation
+/// matrices of that operation for the source sublattice. Applying the map is
+/// then a gather, with no UnitCellCoord or lattice arithmetic:
+///
+///     destination(i) = rep[i] * source(source_site_index[i])
+///
+/// Notes:
+/// - Sites map as for `copy_configuration`. Without a prim factor group
+///   operation:
+///       unitcellcoord + origin = motif_unitcellcoord
+///   and with one:
+///       unitcellcoord + origin = fg * motif_unitcellcoord + translation
+/// - `apply(motif)` gives the same result as the corresponding
+///   `copy_configuration` overload, which constructs a map for each call.
+///   Construct a map, or use MotifTilingMapCache, to copy many motif
+///   configurations with the same supercell into the same supercell.
+/// - Representation matrices are stored as pointers into the prim's
+///   PrimSymInfo, which is kept alive by `supercell`.
+class MotifTilingMap {
+ public:
+  /// \brief Constructor, for copying without transformation
+  MotifTilingMap(std::shared_ptr<Supercell const> const &_motif_supercell,
+                 std::shared_ptr<Supercell const> const &_supercell,
+                 UnitCell const &_origin = UnitCell(0, 0, 0));
+
+  /// \brief Constructor, for copying with transformation
+  MotifTilingMap(Index _prim_factor_group_index, UnitCell const &_translation,
+                 std::shared_ptr<Supercell const> const &_motif_supercell,
+                 std::shared_ptr<Supercell const> const &_supercell,
+                 UnitCell const &_origin = UnitCell(0, 0, 0));
+
+  /// \brief The supercell of motif configurations
+  std::shared_ptr<Supercell const> const &motif_supercell() const {
+    return m_motif_supercell;
+  }
+
+  /// \brief The supercell of new configurations
+  std::shared_ptr<Supercell const> const &supercell() const {
+    return m_supercell;
+  }
+
+  /// \brief The prim factor group operation that transforms the motif, if
+  ///     any
+  std::optional<Index> const &prim_factor_group_index() const {
+    return m_prim_factor_group_index;
+  }
+
+  /// \brief Number of sites in `supercell`
+  Index n_sites() const { return m_source_site_index.size(); }
+
+  /// \brief Linear index in `motif_supercell` of the source of each site in
+  ///     `supercell`
+  std::vector<Index> const &source_site_index() const {
+    return m_source_site_index;
+  }
+
+  /// \brief Sublattice index of the source of each site in `supercell`
+  std::vector<Index> const &source_sublattice_index() const {
+    return m_source_sublattice_index;
+  }
+
+  /// \brief Copy motif configuration DoF values into `supercell`
+  Configuration apply(Configuration const &motif) const;
+
+  /// \brief Copy motif configuration DoF values and properties into
+  ///     `supercell`
+  ConfigurationWithProperties apply(
+      ConfigurationWithProperties const &motif_with_properties) const;
+
+  /// \brief Gather occupation values
+  void gather_occupation(Eigen::VectorXi const &source,
+                         Eigen::VectorXi &destination) const;
+
+  /// \brief Gather local DoF or property values
+  void gather_local(DoFKey const &key, Eigen::MatrixXd const &source,
+                    Eigen::MatrixXd &destination) const;
+
+  /// \brief Transform global DoF or property values
+  void transform_global(DoFKey const &key, Eigen::VectorXd const &source,
+                        Eigen::VectorXd &destination) const;
+
+ private:
+  void _check_motif(Configuration const &motif) const;
+
+  std::shared_ptr<Supercell const> m_motif_supercell;
+
+  std::shared_ptr<Supercell const> m_supercell;
+
+  std::optional<Index> m_prim_factor_group_index;
+
+  std::vector<Index> m_source_site_index;
+
+  std::vector<Index> m_source_sublattice_index;
+
+  /// Occupant index permutation, by site in `supercell`. Empty if there is
+  /// no prim factor group operation.
+  std::vector<std::vector<Index> const *> m_occ_rep;
+
+  /// Local DoF representation matrix, by site in `supercell`. Empty if there
+  /// is no prim factor group operation.
+  std::map<DoFKey, std::vector<Eigen::MatrixXd const *>> m_local_rep;
+};
+
+/// \brief Stores MotifTilingMap in memory, keyed by their inputs
+///
+/// Notes:
+/// - Maps are keyed by the motif supercell, the supercell, the prim factor
+///   group operation, if any, the translation, and the origin. Supercells
+///   are compared by value.
+/// - Maps are shared, and not copied, when they are found.
+/// - Each map stores two indices and, if transformed, a few pointers per
+///   site of the supercell. Use `clear` to release them.
+/// - It is safe to call `make` concurrently.
+class MotifTilingMapCache {
+ public:
+  /// \brief Return a stored map, for copying without transformation, or
+  ///     construct, store, and return a new one
+  std::shared_ptr<MotifTilingMap const> make(
+      std::shared_ptr<Supercell const> const &motif_supercell,
+      std::shared_ptr<Supercell const> const &supercell,
+      UnitCell const &origin = UnitCell(0, 0, 0));
+
+  /// \brief Return a stored map, for copying with transformation, or
+  ///     construct, store, and return a new one
+  std::shared_ptr<MotifTilingMap const> make(
+      Index prim_factor_group_index, UnitCell const &translation,
+      std::shared_ptr<Supercell const> const &motif_supercell,
+      std::shared_ptr<Supercell const> const &supercell,
+      UnitCell const &origin = UnitCell(0, 0, 0));
+
+  /// \brief Number of stored maps
+  Index size() const;
+
+  /// \brief Erase stored maps
+  void clear();
+
+ private:
+  struct Entry {
+    Index prim_factor_group_index;
+    UnitCell translation;
+    UnitCell origin;
+    std::shared_ptr<MotifTilingMap const> result;
+  };
+
+  std::shared_ptr<MotifTilingMap const> _make(
+      Index prim_factor_group_index, UnitCell const &translation,
+      std::shared_ptr<Supercell const> const &motif_supercell,
+      std::shared_ptr<Supercell const> const &supercell,
+      UnitCell const &origin);
+
+  std::shared_ptr<MotifTilingMap const> _find(
+      std::size_t key, Index prim_factor_group_index,
+      UnitCell const &translation,
+      std::shared_ptr<Supercell const> const &motif_supercell,
+      std::shared_ptr<Supercell const> const &supercell,
+      UnitCell const &origin) const;
+
+  mutable std::mutex m_mutex;
+
+  std::unordered_multimap<std::size_t, Entry> m_entries;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef CASM_config_OccupationCanonicalizer
+#define CASM_config_OccupationCanonicalizer
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+class CanonicalFormEngine;
+class ConfigurationBatch;
+
+/// \brief Holds the results of OccupationCanonicalizer::canonicalize
+struct OccupationCanonicalizationResult {
+  /// \brief Index into CanonicalFormEngine::ops() of the first operation
+  ///     that makes each configuration canonical
+  std::vector<Index> to_canonical_index;
+
+  /// \brief 1 if each configuration is in canonical form, else 0
+  std::vector<char> is_canonical;
+};
+
+/// \brief Finds canonical operations of many occupation-only
+///     configurations in one supercell, on a GPU if available
+///
+/// Notes:
+/// - The CPU path uses `CanonicalFormEngine::compare_occupation`, and is
+///   the reference implementation.
+/// - If the library is built with the CMake option `CASM_CONFIGURATION_CUDA`
+///   and a CUDA device is found, the combined permutation table of the
+///   engine is uploaded once, at construction, and each call to
+///   `canonicalize` uploads one batch of occupation values, finds the
+///   canonical operation index and canonical flag of each configuration on
+///   the device, and downloads the results. One device thread handles one
+///   configuration, with occupation values stored site-major so that
+///   neighboring threads read neighboring addresses.
+/// - The device path requires isotropic occupants, and occupant indices
+///   less than 128. If the prim has anisotropic occupants, or no device is
+///   available, the CPU path is used.
+/// - Results are identical for both paths, and equal to
+///   `CanonicalFormEngine::to_canonical_indices` and `is_canonical`.
+/// - The engine must remain valid for the lifetime of the canonicalizer.
+class OccupationCanonicalizer {
+ public:
+  /// \brief Constructor
+  explicit OccupationCanonicalizer(CanonicalFormEngine const &_engine,
+                                   bool use_device = true);
+
+  /// \brief The canonical form engine
+  CanonicalFormEngine const &engine() const { return m_engine; }
+
+  /// \brief Return true if canonicalization runs on a GPU
+  bool uses_device() const { return m_device_tables != nullptr; }
+
+  /// \brief Return true if the library was built with a GPU backend and a
+  ///     device is available
+  static bool device_is_available();
+
+  /// \brief Find canonical operation indices and flags for a row-major
+  ///     (n_configurations, n_sites) array of occupation values
+  void canonicalize(int const *occupation, Index n_configurations,
+                    OccupationCanonicalizationResult &result,
+                    Index n_threads = 1) const;
+
+  /// \brief Find canonical operation indices and flags for the
+  ///     configurations in a batch, which must be occupation-only
+  OccupationCanonicalizationResult canonicalize(ConfigurationBatch const &batch,
+                                                Index n_threads = 1) const;
+
+ private:
+  void _canonicalize_on_host(int const *occupation, Index n_configurations,
+                             OccupationCanonicalizationResult &result,
+                             Index n_threads) const;
+
+  CanonicalFormEngine const &m_engine;
+
+  /// \brief Device copy of the permutation table, or nullptr if the CPU
+  ///     path is used
+  std::shared_ptr<void> m_device_tables;
+};
+
+namespace OccupationCanonicalizerImpl {
+
+// The device backend, which is only defined if the library is built with
+// `CASM_CONFIGURATION_CUDA`:
+
+/// \brief Return the number of available devices
+Index device_count();
+
+/// \brief Upload a row-major (n_ops, n_sites) permutation table
+std::shared_ptr<void> make_device_tables(std::vector<std::int32_t> const &perm,
+                                         Index n_ops, Index n_sites);
+
+/// \brief Canonicalize a site-major (n_sites, n_configurations) array of
+///     occupation values, writing results into host arrays
+void device_canonicalize(void *device_tables,
+                         std::vector<std::int8_t> const &occupation_by_site,
+                         Index n_configurations, Index *to_canonical_index,
+                         char *is_canonical);
+
+}  // namespace OccupationCanonicalizerImpl
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef CASM_config_PerturbationCanonicalizer
+#define CASM_config_PerturbationCanonicalizer
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Finds canonical forms of configurations that differ from one
+///     background configuration on a few sites
+///
+/// Method:
+/// - At construction, the background occupation transformed by each
+///   operation of a CanonicalFormEngine is computed. Operations that give
+///   the same transformed background form one left coset of the background
+///   invariant subgroup, and one transformed background is stored per coset.
+/// - A perturbed configuration transformed by an operation is the
+///   transformed background of its coset, overwritten on the images of the
+///   perturbed sites. For each operation only those image sites and values
+///   are computed, as a list sorted by site index.
+/// - Within a coset the transformed backgrounds are identical, so candidates
+///   are compared using only the image sites. The best candidate of each
+///   coset is then compared to the best so far by walking the transformed
+///   backgrounds with the image sites overlaid, with early exit.
+/// - The result is identical to `CanonicalFormEngine::make_canonical_form`
+///   and `CanonicalFormEngine::to_canonical_index`, including ties.
+/// - Configurations with continuous DoF are passed to the engine.
+/// - Storage is one transformed background of `n_sites` values per coset,
+///   plus the inverse permutation of each operation.
+class PerturbationCanonicalizer {
+ public:
+  /// \brief Constructor
+  PerturbationCanonicalizer(
+      std::shared_ptr<CanonicalFormEngine const> const &_engine,
+      Configuration const &_background);
+
+  /// \brief The engine whose operations are used
+  CanonicalFormEngine const &engine() const;
+
+  /// \brief The background configuration
+  Configuration const &background() const;
+
+  /// \brief Number of distinct transformed backgrounds, equal to the number
+  ///     of engine operations divided by the size of the background
+  ///     invariant subgroup
+  Index n_cosets() const;
+
+  /// \brief Return the index into `engine().ops()` of the first operation
+  ///     that makes the configuration canonical
+  Index to_canonical_index(Configuration const &configuration,
+                           std::set<Index> const &perturbed_sites) const;
+
+  /// \brief Return the index into `engine().ops()` of the first operation
+  ///     that makes the configuration canonical
+  Index to_canonical_index(Configuration const &configuration) const;
+
+  /// \brief Return the canonical form of a perturbed configuration
+  Configuration make_canonical_form(
+      Configuration const &configuration,
+      std::set<Index> const &perturbed_sites) const;
+
+  /// \brief Return the canonical form of a perturbed configuration
+  Configuration make_canonical_form(Configuration const &configuration) const;
+
+ private:
+  /// \brief A site index and occupant value in a transformed configuration
+  struct ImageSite {
+    Index site;
+    int value;
+  };
+
+  struct Candidate {
+    Index op_index;
+    Index coset_index;
+    std::vector<ImageSite> image;
+  };
+
+  /// \brief Sites where the occupation differs from the background
+  std::vector<Index> _changed_sites(
+      Eigen::VectorXi const &occupation,
+      std::set<Index> const *perturbed_sites) const;
+
+  /// \brief Index of the best operation, given the changed sites
+  Index _to_canonical_index(Eigen::VectorXi const &occupation,
+                            std::vector<Index> const &changed_sites) const;
+
+  /// \brief Set `image` to the image sites and values of the changed sites
+  void _make_image(Eigen::VectorXi const &occupation,
+                   std::vector<Index> const &changed_sites, Index op_index,
+                   std::vector<ImageSite> &image) const;
+
+  /// \brief Lexicographically compare two transformed configurations
+  int _compare(Candidate const &A, Candidate const &B) const;
+
+  bool _is_occupation_only(Configuration const &configuration) const;
+
+  void _throw_if_other_supercell(Configuration const &configuration) const;
+
+  std::shared_ptr<CanonicalFormEngine const> m_engine;
+
+  Configuration m_background;
+
+  Index m_n_sites;
+
+  /// \brief Inverse combined site permutations, one row of size m_n_sites
+  ///     per operation, such that site `s` maps to
+  ///     `m_inverse_permutations[i * n + s]`
+  std::vector<Index> m_inverse_permutations;
+
+  /// \brief Coset index of each operation
+  std::vector<Index> m_coset_index;
+
+  /// \brief Operation indices in each coset, in increasing order
+  std::vector<std::vector<Index>> m_coset_ops;
+
+  /// \brief Transformed background occupation, one row of size m_n_sites
+  ///     per coset
+  std::vector<int> m_coset_backgrounds;
+};
+
+/// \brief Finds canonical forms, in the context of an occupation event, of
+///     configurations that differ from one background configuration on a
+///     few sites
+///
+/// Gives the same results as `make_canonical_form(configuration,
+/// event_sites, occ_init, occ_final, event_group)`, using one
+/// PerturbationCanonicalizer for the background with the initial event
+/// occupation and one for the background with the final event occupation.
+class LocalPerturbationCanonicalizer {
+ public:
+  /// \brief Constructor
+  LocalPerturbationCanonicalizer(
+      std::shared_ptr<CanonicalFormEngine const> const &_event_group_engine,
+      Configuration const &_background, std::vector<Index> const &_event_sites,
+      std::vector<int> const &_occ_init, std::vector<int> const &_occ_final);
+
+  /// \brief Return the canonical form of a perturbed configuration, in the
+  ///     context of the event
+  Configuration make_canonical_form(
+      Configuration const &configuration,
+      std::set<Index> const &perturbed_sites) const;
+
+ private:
+  std::vector<Index> m_event_sites;
+
+  std::vector<int> m_occ_init;
+
+  std::vector<int> m_occ_final;
+
+  /// Canonicalizer for the background with occ_init on the event sites
+  PerturbationCanonicalizer m_init;
+
+  /// Canonicalizer for the background with occ_final on the event sites
+  PerturbationCanonicalizer m_final;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
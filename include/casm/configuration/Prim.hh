@@ -1,6 +1,7 @@
 #ifndef CASM_config_Prim
 #define CASM_config_Prim
 
+#include "casm/configuration/PrimDoFBasisInfo.hh"
 #include "casm/configuration/PrimMagspinInfo.hh"
 #include "casm/configuration/PrimSymInfo.hh"
 #include "casm/configuration/definitions.hh"
@@ -11,7 +12,8 @@ namespace config {
 
 /// \brief Species the primitive crystal structure (lattice and basis) and
 /// allowed degrees of freedom (DoF), and also symmetry representations
-/// used for all configurations with the same prim. All members are const.
+/// used for all configurations with the same prim. All members are const,
+/// so a Prim may be shared by multiple threads.
 struct Prim {
   /// \brief Constructor
   Prim(std::shared_ptr<BasicStructure const> const &_basicstructure);
@@ -20,6 +22,10 @@ struct Prim {
   Prim(std::vector<xtal::SymOp> const &factor_group_elements,
        std::shared_ptr<BasicStructure const> const &_basicstructure);
 
+  /// \brief Construct using existing symmetry representations
+  Prim(PrimSymInfo const &_sym_info,
+       std::shared_ptr<BasicStructure const> const &_basicstructure);
+
   /// \brief The BasicStructure specifies the primitive crystal structure
   /// (lattice and basis) and allowed degrees of freedom (DoF)
   std::shared_ptr<BasicStructure const> const basicstructure;
@@ -31,6 +37,10 @@ struct Prim {
   ///     local DoF
   std::map<DoFKey, std::vector<xtal::SiteDoFSet>> const local_dof_info;
 
+  /// \brief Precomputed matrices for converting DoF values between the
+  ///     prim basis and the standard basis
+  PrimDoFBasisInfo const dof_basis_info;
+
   /// \brief Checks that the prim allows 1 or more occupants on each site,
   ///     all occupants have a single atom, and there are no Molecule
   ///     properties, only AtomPosition properties
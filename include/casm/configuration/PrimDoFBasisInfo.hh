@@ -0,0 +1,75 @@
+#ifndef CASM_config_PrimDoFBasisInfo
+#define CASM_config_PrimDoFBasisInfo
+
+#include <map>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/crystallography/DoFSet.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Precomputed matrices for converting DoF values between the prim
+///     basis and the standard basis
+///
+/// Notes:
+/// - For each DoF, `basis` converts prim basis values to standard basis
+///   values, and `inv_basis` converts standard basis values to prim basis
+///   values.
+/// - Local DoF have one pair of matrices per sublattice. Sublattices
+///   without the DoF have matrices with 0 prim basis dimensions, so their
+///   standard values are 0.
+/// - Used by `to_standard_values` and `from_standard_values` to convert
+///   ConfigDoFValues into existing storage, without constructing new
+///   ConfigDoFValues.
+struct PrimDoFBasisInfo {
+  explicit PrimDoFBasisInfo(
+      std::map<DoFKey, xtal::DoFSet> const &global_dof_info,
+      std::map<DoFKey, std::vector<xtal::SiteDoFSet>> const &local_dof_info);
+
+  /// \brief Conversion matrices for one DoF basis
+  struct Basis {
+    /// \brief Shape (standard_dim, prim_dim)
+    Eigen::MatrixXd basis;
+
+    /// \brief Shape (prim_dim, standard_dim)
+    Eigen::MatrixXd inv_basis;
+  };
+
+  /// \brief Conversion matrices for one local DoF
+  struct LocalBasis {
+    /// \brief Number of rows of local DoF values in the standard basis
+    Index standard_dim;
+
+    /// \brief Number of rows of local DoF values in the prim basis, which
+    ///     is the maximum dimension over all sublattices
+    Index prim_dim;
+
+    /// \brief Conversion matrices for each sublattice
+    std::vector<Basis> sublattice;
+  };
+
+  /// \brief Global DoF conversion matrices, by DoF key
+  std::map<DoFKey, Basis> global;
+
+  /// \brief Local DoF conversion matrices, by DoF key
+  std::map<DoFKey, LocalBasis> local;
+};
+
+/// \brief Convert DoF values from the prim basis to the standard basis,
+///     writing into existing storage
+void to_standard_values(PrimDoFBasisInfo const &dof_basis_info,
+                        ConfigDoFValues const &prim_dof_values,
+                        Index n_unitcells, ConfigDoFValues &standard_dof_values);
+
+/// \brief Convert DoF values from the standard basis to the prim basis,
+///     writing into existing storage
+void from_standard_values(PrimDoFBasisInfo const &dof_basis_info,
+                          ConfigDoFValues const &standard_dof_values,
+                          Index n_unitcells, ConfigDoFValues &prim_dof_values);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -4,6 +4,7 @@
 #include "casm/configuration/definitions.hh"
 #include "casm/configuration/group/Group.hh"
 #include "casm/configuration/sym_info/definitions.hh"
+#include "casm/configuration/sym_info/packed_dof_sym_info.hh"
 #include "casm/crystallography/SymTools.hh"
 #include "casm/crystallography/UnitCellCoordRep.hh"
 
@@ -116,6 +117,33 @@ struct PrimSymInfo {
   /// \endcode
   ///
   std::map<DoFKey, sym_info::GlobalDoFSymGroupRep> global_dof_symgroup_rep;
+
+  /// \brief The matrices of `local_dof_symgroup_rep`, stored contiguously,
+  /// for fast application
+  ///
+  /// Usage:
+  /// \code
+  /// // same as `after = local_dof_symgroup_rep.at(dof_type)
+  /// //                      .at(group_element_index)
+  /// //                      .at(sublattice_index_before) * before`
+  /// packed_local_dof_symgroup_rep.at(dof_type).apply(
+  ///     group_element_index, sublattice_index_before, before, after);
+  /// \endcode
+  std::map<DoFKey, sym_info::PackedDoFSymGroupRep>
+      packed_local_dof_symgroup_rep;
+
+  /// \brief The matrices of `global_dof_symgroup_rep`, stored contiguously,
+  /// for fast application
+  ///
+  /// Usage:
+  /// \code
+  /// // same as `after = global_dof_symgroup_rep.at(dof_type)
+  /// //                      .at(group_element_index) * before`
+  /// packed_global_dof_symgroup_rep.at(dof_type).apply(
+  ///     group_element_index, 0, before, after);
+  /// \endcode
+  std::map<DoFKey, sym_info::PackedDoFSymGroupRep>
+      packed_global_dof_symgroup_rep;
 };
 
 }  // namespace config
@@ -0,0 +1,78 @@
+#ifndef CASM_config_PrimSymInfoCache
+#define CASM_config_PrimSymInfoCache
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/global/filesystem.hh"
+
+namespace CASM {
+
+class jsonParser;
+
+namespace config {
+
+/// \brief Return a digest of a prim, used as a symmetry cache key
+std::string make_prim_digest(BasicStructure const &prim);
+
+/// \brief Stores PrimSymInfo in memory, and optionally on disk, keyed by
+///     the prim
+///
+/// Notes:
+/// - Results are keyed by the prim JSON, as by `write_prim` with fractional
+///   coordinates and vacancies included, and the lattice tolerance, so
+///   prims that are equal up to floating point precision share results.
+/// - If `cache_dir` is given, the factor group of each new prim is also
+///   written to `<cache_dir>/<digest>.json`, along with the prim, and read
+///   by later caches using the same directory. Only the factor group is
+///   stored on disk; the symmetry representations are constructed again
+///   from it, which skips the factor group search.
+/// - Results are shared, and not copied, when they are found in memory.
+/// - It is safe to call `make` concurrently.
+class PrimSymInfoCache {
+ public:
+  /// \brief Constructor
+  PrimSymInfoCache(std::optional<fs::path> _cache_dir = std::nullopt);
+
+  /// \brief Return stored PrimSymInfo for the prim, or construct, store,
+  ///     and return new PrimSymInfo
+  std::shared_ptr<PrimSymInfo const> make(BasicStructure const &prim);
+
+  /// \brief Construct a Prim, using stored PrimSymInfo if available
+  std::shared_ptr<Prim const> make_prim(
+      std::shared_ptr<BasicStructure const> const &basicstructure);
+
+  /// \brief Directory used to store factor groups on disk, if any
+  std::optional<fs::path> const &cache_dir() const;
+
+  /// \brief Number of results stored in memory
+  Index size() const;
+
+  /// \brief Erase results stored in memory
+  void clear();
+
+ private:
+  std::shared_ptr<PrimSymInfo const> _read(
+      std::string const &digest, std::string const &key,
+      BasicStructure const &prim) const;
+
+  void _write(std::string const &digest, jsonParser const &prim_json,
+              PrimSymInfo const &sym_info, BasicStructure const &prim) const;
+
+  std::optional<fs::path> m_cache_dir;
+
+  mutable std::mutex m_mutex;
+
+  /// Results, by prim JSON and tolerance
+  std::unordered_map<std::string, std::shared_ptr<PrimSymInfo const>>
+      m_entries;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
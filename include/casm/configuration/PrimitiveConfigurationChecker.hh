@@ -0,0 +1,66 @@
+#ifndef CASM_config_PrimitiveConfigurationChecker
+#define CASM_config_PrimitiveConfigurationChecker
+
+#include <memory>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+struct Configuration;
+struct Supercell;
+
+/// \brief Checks if configurations are primitive, using only the supercell
+///     translations of prime order
+///
+/// A configuration is non-primitive if and only if some non-zero supercell
+/// translation leaves it invariant. The invariant translations form a
+/// subgroup, which, if not trivial, contains a translation of prime order,
+/// so only those need to be checked. Translations that generate the same
+/// subgroup are equivalent, so one translation per subgroup of prime order
+/// is checked.
+///
+/// The subgroups are found from the Smith normal form of the supercell
+/// transformation matrix (see `TranslationGrid`): the translations form the
+/// group Z_n0 x Z_n1 x Z_n2, so for each prime `p` dividing `n2`, and the
+/// `k` of `n0`, `n1`, `n2` that `p` divides, there are `(p^k - 1) / (p - 1)`
+/// subgroups of order `p`. This is usually far fewer than the number of
+/// translations.
+///
+/// For configurations with only occupation DoF, the site permutations of
+/// the translations are stored, and each comparison exits at the first site
+/// with a different occupation, which makes `is_primitive` cheap enough to
+/// check every candidate of an enumeration before canonicalization.
+class PrimitiveConfigurationChecker {
+ public:
+  /// \brief Constructor
+  explicit PrimitiveConfigurationChecker(
+      std::shared_ptr<Supercell const> const &_supercell);
+
+  /// \brief The supercell
+  std::shared_ptr<Supercell const> const &supercell() const;
+
+  /// \brief Indices of the translations that are checked, one generating
+  ///     each subgroup of prime order
+  std::vector<Index> const &translation_indices() const;
+
+  /// \brief Return true if no translations within the supercell result in
+  ///     the same configuration
+  bool is_primitive(Configuration const &configuration) const;
+
+ private:
+  std::shared_ptr<Supercell const> m_supercell;
+
+  std::vector<Index> m_translation_indices;
+
+  /// Site permutations, `m_permutations[i][l]` the site whose value moves to
+  /// site `l` by the translation `m_translation_indices[i]`
+  std::vector<std::vector<Index>> m_permutations;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef CASM_config_SuperConfigurationGenerator
+#define CASM_config_SuperConfigurationGenerator
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/InvariantSubgroupEngine.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Generates all equivalent configurations with respect to the prim
+///     factor group that fill a supercell, one at a time
+///
+/// This generates the same configurations as
+/// `make_all_super_configurations`, without storing them all:
+/// - The distinct configurations, as given by
+///   `make_distinct_super_configurations`, are made one at a time, using
+///   `unique_generating_prim_factor_group_indices`.
+/// - For each distinct configuration, the equivalents that may be generated
+///   using SupercellSymOp are made by applying one operation per left coset
+///   of its invariant subgroup, as by
+///   `InvariantSubgroupEngine::make_left_coset_representatives`.
+/// - Subsets are generated in the same order as by
+///   `make_all_super_configurations_by_subsets`, but within a subset
+///   configurations are in the order of the coset representatives, rather
+///   than sorted.
+///
+/// Configurations are made in batches of `batch_size`, using up to
+/// `n_threads` threads. Memory use is proportional to `batch_size`, not to
+/// the total number of configurations. The order of the generated
+/// configurations does not depend on `batch_size` or `n_threads`.
+///
+/// Example:
+/// \code
+/// SuperConfigurationGenerator generator(motif, supercell);
+/// Configuration configuration(supercell);
+/// while (generator.next(configuration)) {
+///   ...
+/// }
+/// \endcode
+class SuperConfigurationGenerator {
+ public:
+  /// \brief Constructor
+  SuperConfigurationGenerator(Configuration const &motif,
+                              std::shared_ptr<Supercell const> const &supercell,
+                              Index _batch_size = 1, Index _n_threads = 1);
+
+  /// \brief The supercell being filled
+  std::shared_ptr<Supercell const> const &supercell() const;
+
+  /// \brief Number of distinct configurations, which is the number of subsets
+  Index n_subsets() const;
+
+  /// \brief Set `configuration` to the next configuration, or return false
+  ///     if all configurations have been generated
+  bool next(Configuration &configuration);
+
+  /// \brief Index of the subset of the configuration most recently returned
+  ///     by `next`
+  Index subset_index() const;
+
+ private:
+  /// \brief An operation to be applied to a subset prototype
+  struct Task {
+    std::shared_ptr<Configuration const> prototype;
+    SupercellSymOp op;
+    Index subset_index;
+  };
+
+  /// \brief Make the next batch of configurations
+  void _fill_buffer();
+
+  /// \brief Begin the next subset, returning false if there are none left
+  bool _begin_next_subset();
+
+  std::shared_ptr<Supercell const> m_supercell;
+  InvariantSubgroupEngine m_engine;
+  Index m_batch_size;
+  Index m_n_threads;
+
+  /// \brief The primitive motif configuration
+  Configuration m_prim_motif;
+
+  /// \brief Prim factor group operations that generate distinct
+  ///     configurations
+  std::vector<Index> m_generating_prim_fg_ops;
+
+  /// \brief Index into m_generating_prim_fg_ops of the current subset
+  Index m_next_subset_index;
+
+  /// \brief Current subset prototype
+  std::shared_ptr<Configuration const> m_prototype;
+
+  /// \brief Left coset representatives for the current subset
+  std::vector<SupercellSymOp> m_coset_reps;
+
+  /// \brief Index into m_coset_reps of the next operation to apply
+  Index m_next_rep_index;
+
+  /// \brief Configurations made, but not yet returned, with subset index
+  std::deque<std::pair<Configuration, Index>> m_buffer;
+
+  /// \brief Subset index of the configuration most recently returned
+  Index m_subset_index;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
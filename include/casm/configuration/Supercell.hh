@@ -1,6 +1,13 @@
 #ifndef CASM_config_Supercell
 #define CASM_config_Supercell
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/CombinedPermutationTable.hh"
 #include "casm/configuration/Prim.hh"
 #include "casm/configuration/SupercellSymInfo.hh"
 #include "casm/crystallography/LinearIndexConverter.hh"
@@ -11,17 +18,52 @@ namespace CASM {
 namespace config {
 
 /// \brief Specifies all the structural and symmetry information common for all
-/// configurations with the same supercell. All members are const.
+/// configurations with the same supercell. All data members are const.
+///
+/// The canonical equivalent supercell, and related data, are computed when
+/// first requested and then stored, so that repeated calls to
+/// `is_canonical(Supercell const &)`, `make_canonical_form(Supercell const &)`,
+/// and `make_in_canonical_supercell` do not repeat the lattice
+/// canonicalization. This is thread safe.
+///
+/// Per-site tables (ideal Cartesian coordinates, sublattice index, and linear
+/// unit cell index, by linear site index) are also computed when first
+/// requested and then stored, in the same thread safe way. The memory they
+/// use is reported by `site_data_bytes()`. The combined permutation table,
+/// if it fits in `combined_permutation_table_max_bytes`, is constructed on
+/// first use in the same way, and its rows when first requested.
+///
+/// Thread safety: a Supercell, and its Prim and SupercellSymInfo, are
+/// immutable once constructed, apart from the lazily computed data described
+/// above, so they may be shared by any number of threads without copying.
+/// Per-thread scratch belongs in separate objects, such as
+/// SupercellSymOpWorkspace, SupercellSymOpApplier, and ConfigIsEquivalent.
 struct Supercell : public Comparisons<CRTPBase<Supercell>> {
   Supercell(std::shared_ptr<Prim const> const &_prim,
             Lattice const &_superlattice,
-            Index max_n_translation_permutations = 100);
+            Index max_n_translation_permutations = 100,
+            Index translation_permutation_cache_max_bytes =
+                DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES,
+            Index combined_permutation_table_max_bytes =
+                DEFAULT_COMBINED_PERMUTATION_TABLE_MAX_BYTES);
   Supercell(std::shared_ptr<Prim const> const &_prim,
             Superlattice const &_superlattice,
-            Index max_n_translation_permutations = 100);
+            Index max_n_translation_permutations = 100,
+            Index translation_permutation_cache_max_bytes =
+                DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES,
+            Index combined_permutation_table_max_bytes =
+                DEFAULT_COMBINED_PERMUTATION_TABLE_MAX_BYTES);
   Supercell(std::shared_ptr<Prim const> const &_prim,
             Eigen::Matrix3l const &_superlattice_matrix,
-            Index max_n_translation_permutations = 100);
+            Index max_n_translation_permutations = 100,
+            Index translation_permutation_cache_max_bytes =
+                DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES,
+            Index combined_permutation_table_max_bytes =
+                DEFAULT_COMBINED_PERMUTATION_TABLE_MAX_BYTES);
+  Supercell(std::shared_ptr<Prim const> const &_prim,
+            Superlattice const &_superlattice, SupercellSymInfo &&_sym_info,
+            Index combined_permutation_table_max_bytes =
+                DEFAULT_COMBINED_PERMUTATION_TABLE_MAX_BYTES);
 
   /// \brief Species the primitive crystal structure (lattice and basis) and
   /// allowed degrees of freedom (DoF), and also symmetry representations
@@ -40,6 +82,13 @@ struct Supercell : public Comparisons<CRTPBase<Supercell>> {
   /// corresponding linear index
   xtal::UnitCellCoordIndexConverter const unitcellcoord_index_converter;
 
+  /// \brief Fast linear index conversions, if the transformation matrix is
+  /// diagonal, else null
+  ///
+  /// Selected at construction. Used for translation permutations, and by
+  /// `linear_unitcell_index` and `linear_site_index`.
+  std::shared_ptr<DiagonalIndexConverter const> const diagonal_index_converter;
+
   /// \brief Holds symmetry representations used for all configurations with
   /// the same supercell
   SupercellSymInfo const sym_info;
@@ -47,11 +96,104 @@ struct Supercell : public Comparisons<CRTPBase<Supercell>> {
   /// \brief Less than comparison of Supercell
   bool operator<(Supercell const &B) const;
 
+  /// \brief Linear unit cell index of a unit cell, brought within the
+  ///     supercell
+  Index linear_unitcell_index(UnitCell const &unitcell) const;
+
+  /// \brief Linear site index of a site, brought within the supercell
+  Index linear_site_index(UnitCellCoord const &bijk) const;
+
+  /// \brief Return true if the superlattice is a right-handed lattice in
+  ///     canonical form
+  bool is_canonical() const;
+
+  /// \brief Return the canonical equivalent supercell
+  std::shared_ptr<Supercell const> canonical_supercell() const;
+
+  /// \brief Return the index of a prim factor group operation that
+  ///     transforms this supercell to the canonical equivalent supercell
+  Index prim_factor_group_index_to_canonical() const;
+
+  /// \brief Return the name of the canonical equivalent supercell
+  std::string const &canonical_supercell_name() const;
+
+  /// \brief Ideal site coordinates, in Cartesian coordinates, as columns
+  ///     by linear site index
+  Eigen::Matrix3Xd const &site_coordinate_cart() const;
+
+  /// \brief Sublattice index, by linear site index
+  std::vector<Index> const &site_sublattice_index() const;
+
+  /// \brief Linear unit cell index, by linear site index
+  std::vector<Index> const &site_unitcell_index() const;
+
+  /// \brief Memory used by the per-site tables, in bytes, or 0 if they have
+  ///     not been computed yet
+  Index site_data_bytes() const;
+
+  /// \brief Memory budget, in bytes, of the combined permutation table
+  Index const combined_permutation_table_max_bytes;
+
+  /// \brief Return the table of combined permutations of all supercell
+  ///     operations, constructing it on first use, or null if it does not
+  ///     fit in the memory budget
+  CombinedPermutationTable const *combined_permutation_table() const;
+
+  /// \brief Memory used by the combined permutation table, in bytes, or 0
+  ///     if it has not been constructed
+  Index combined_permutation_table_bytes() const;
+
  private:
   friend struct Comparisons<CRTPBase<Supercell>>;
 
   /// \brief Equality comparison of Supercell
   bool eq_impl(Supercell const &rhs) const;
+
+  /// \brief Canonical equivalent supercell data
+  struct CanonicalData {
+    bool is_canonical;
+
+    /// \brief The canonical equivalent supercell, or nullptr if this
+    ///     supercell is canonical (to avoid a reference cycle)
+    std::shared_ptr<Supercell const> canonical_supercell;
+
+    Index prim_factor_group_index_to_canonical;
+
+    std::string canonical_supercell_name;
+  };
+
+  /// \brief Return canonical equivalent supercell data, computing it on
+  ///     first use
+  CanonicalData const &_canonical_data() const;
+
+  mutable std::once_flag m_canonical_data_flag;
+
+  mutable CanonicalData m_canonical_data;
+
+  /// \brief Per-site tables, by linear site index
+  struct SiteData {
+    Eigen::Matrix3Xd coordinate_cart;
+
+    std::vector<Index> sublattice_index;
+
+    std::vector<Index> unitcell_index;
+  };
+
+  /// \brief Return per-site tables, computing them on first use
+  SiteData const &_site_data() const;
+
+  mutable std::once_flag m_site_data_flag;
+
+  mutable SiteData m_site_data;
+
+  mutable std::atomic<bool> m_has_site_data{false};
+
+  mutable std::once_flag m_combined_permutation_table_flag;
+
+  mutable std::unique_ptr<CombinedPermutationTable const>
+      m_combined_permutation_table;
+
+  mutable std::atomic<bool> m_has_combined_permutation_table{false};
 };
 
 struct CompareSharedSupercell {
@@ -61,6 +203,52 @@ struct CompareSharedSupercell {
   }
 };
 
+/// \brief Estimated memory used by a Supercell, by component, in bytes
+struct SupercellMemoryUsage {
+  /// \brief Number of sites in the supercell
+  Index n_sites = 0;
+
+  /// \brief `Supercell::sym_info`
+  SupercellSymInfoMemoryUsage sym_info;
+
+  /// \brief The per-site tables, as `Supercell::site_data_bytes()`
+  Index site_data_bytes = 0;
+
+  /// \brief The combined permutation table, as
+  ///     `Supercell::combined_permutation_table_bytes()`
+  Index combined_permutation_table_bytes = 0;
+
+  /// \brief `sizeof(Supercell)`, excluding `sym_info`, and the
+  ///     `diagonal_index_converter` tables, if any
+  Index other_bytes = 0;
+
+  /// \brief Sum of all components
+  Index total_bytes() const {
+    return sym_info.total_bytes() + site_data_bytes +
+           combined_permutation_table_bytes + other_bytes;
+  }
+};
+
+/// \brief Estimate the memory used by a Supercell
+SupercellMemoryUsage make_memory_usage(Supercell const &supercell,
+                                       MemoryUsageContext &context);
+
+/// \brief Estimate the memory used by a Supercell, in bytes
+Index memory_usage(Supercell const &supercell);
+
+/// \brief Return a shared Supercell, reusing an existing one if possible
+std::shared_ptr<Supercell const> make_shared_supercell(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super);
+
+/// \brief Return a shared Supercell, reusing an existing one if possible
+std::shared_ptr<Supercell const> make_shared_supercell(
+    std::shared_ptr<Prim const> const &prim, Superlattice const &superlattice);
+
+/// \brief Return a shared Supercell, reusing an existing one if possible
+std::shared_ptr<Supercell const> make_shared_supercell(
+    std::shared_ptr<Prim const> const &prim, Lattice const &superlattice);
+
 }  // namespace config
 }  // namespace CASM
 
@@ -0,0 +1,102 @@
+#ifndef CASM_config_SupercellNameCache
+#define CASM_config_SupercellNameCache
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/configuration/supercell_name.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Stores supercell names and canonical equivalent supercells, by
+///     the Hermite normal form of the transformation matrix
+///
+/// Notes:
+/// - Each entry relates a Hermite normal form, H, its supercell name, the
+///   canonical equivalent supercell's transformation matrix and name, and
+///   the index of the prim factor group operation that transforms the
+///   superlattice to the canonical superlattice.
+/// - Entries are found by the compact key of H, so transformation matrices
+///   that generate the same superlattice share an entry, and by name, so
+///   names are parsed once.
+/// - The lattice canonicalization is done once per entry, without
+///   constructing a Supercell. This lets SupercellSet, ConfigurationSet, and
+///   readers that make many records for the same supercells skip the
+///   repeated point group scans.
+/// - It is safe to call `get` concurrently. References to entries remain
+///   valid until `clear` is called.
+class SupercellNameCache {
+ public:
+  struct Entry {
+    /// \brief Key of the Hermite normal form
+    HermiteNormalFormKey key;
+
+    /// \brief Supercell name, as from `make_supercell_name`
+    std::string supercell_name;
+
+    /// \brief Transformation matrix of the canonical equivalent supercell
+    Eigen::Matrix3l canonical_transformation_matrix_to_super;
+
+    /// \brief Key of the Hermite normal form of the canonical equivalent
+    ///     supercell
+    HermiteNormalFormKey canonical_key;
+
+    /// \brief Name of the canonical equivalent supercell
+    std::string canonical_supercell_name;
+
+    /// \brief Index of the prim factor group operation that transforms the
+    ///     superlattice to the canonical equivalent superlattice
+    Index prim_factor_group_index_to_canonical;
+  };
+
+  /// \brief Constructor
+  explicit SupercellNameCache(std::shared_ptr<Prim const> const &_prim);
+
+  /// \brief The prim
+  std::shared_ptr<Prim const> const &prim() const;
+
+  /// \brief Return the entry for a transformation matrix, constructing and
+  ///     storing it if necessary
+  Entry const &get(Eigen::Matrix3l const &transformation_matrix_to_super);
+
+  /// \brief Return the entry for a Hermite normal form key, constructing
+  ///     and storing it if necessary
+  Entry const &get(HermiteNormalFormKey const &key);
+
+  /// \brief Return the entry for a supercell name, constructing and storing
+  ///     it if necessary
+  Entry const &get(std::string const &supercell_name);
+
+  /// \brief Return true if a supercell with this transformation matrix is
+  ///     in canonical form
+  bool is_canonical(Eigen::Matrix3l const &transformation_matrix_to_super);
+
+  /// \brief Number of entries
+  Index size() const;
+
+  /// \brief Erase all entries
+  void clear();
+
+ private:
+  Entry const &_get(HermiteNormalFormKey const &key);
+
+  std::shared_ptr<Prim const> m_prim;
+
+  mutable std::mutex m_mutex;
+
+  /// Entries, by key of the Hermite normal form
+  std::map<HermiteNormalFormKey, Entry> m_entries;
+
+  /// Entries, by supercell name as given to `get`
+  std::unordered_map<std::string, Entry const *> m_by_name;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
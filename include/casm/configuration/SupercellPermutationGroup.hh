@@ -0,0 +1,103 @@
+#ifndef CASM_config_SupercellPermutationGroup
+#define CASM_config_SupercellPermutationGroup
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/definitions.hh"
+#include "casm/configuration/group/StabilizerChain.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief The group of supercell site permutations, as a stabilizer chain,
+///     for finding canonical occupations without visiting every operation
+///
+/// Method:
+/// - The site permutations of all supercell operations (factor group
+///   operation followed by translation) form a group of order
+///   `n_fg * n_translations / n_kernel`, where `n_kernel` counts operations
+///   that do not permute sites. It is represented by a base and strong
+///   generating set, built by the randomized Schreier-Sims algorithm from
+///   the factor group permutations, the unit translations, and random
+///   operations, until the chain order equals the group order.
+/// - Because the base is increasing, the lexicographically greatest
+///   equivalent occupation is found level by level: at each level only
+///   candidates with the greatest values on the sites fixed below that
+///   level are kept, and candidates with identical partial images are
+///   merged. The work depends on the number of distinct partial images
+///   rather than on the group order, which helps most for configurations
+///   with large invariant subgroups, where every operation ties.
+/// - Results are the same canonical configurations as `make_canonical_form`
+///   over all supercell operations. `to_canonical` returns an operation
+///   that makes the configuration canonical, which is not necessarily the
+///   first in `SupercellSymOp` order.
+/// - Occupant index transformations and continuous DoF are not represented
+///   by site permutations, so for prim with anisotropic occupants or
+///   configurations with continuous DoF the `canonical_form.hh` functions
+///   over all supercell operations are used instead.
+class SupercellPermutationGroup {
+ public:
+  typedef group::StabilizerChain::Permutation Permutation;
+
+  /// \brief Constructor
+  explicit SupercellPermutationGroup(
+      std::shared_ptr<Supercell const> const &_supercell);
+
+  /// \brief The supercell
+  std::shared_ptr<Supercell const> const &supercell() const {
+    return m_supercell;
+  }
+
+  /// \brief The stabilizer chain of the site permutation group
+  group::StabilizerChain const &stabilizer_chain() const { return m_chain; }
+
+  /// \brief Order of the site permutation group
+  Index order() const { return m_chain.order(); }
+
+  /// \brief Return the combined site permutation of the operation
+  ///     `(factor group index, translation index)`
+  Permutation make_permutation(Index supercell_factor_group_index,
+                               Index translation_index) const;
+
+  /// \brief Return an operation with combined site permutation `permutation`
+  SupercellSymOp find_op(Permutation const &permutation) const;
+
+  /// \brief Return the lexicographically greatest equivalent occupation
+  Eigen::VectorXi make_canonical_occupation(
+      Eigen::VectorXi const &occupation,
+      Permutation *to_canonical_permutation = nullptr) const;
+
+  /// \brief Return true if configuration is in canonical form
+  bool is_canonical(Configuration const &configuration) const;
+
+  /// \brief Return an operation that makes the configuration canonical
+  SupercellSymOp to_canonical(Configuration const &configuration) const;
+
+  /// \brief Return the configuration that compares greater to all
+  ///     equivalents
+  Configuration make_canonical_form(Configuration const &configuration) const;
+
+ private:
+  void _throw_if_other_supercell(Configuration const &configuration) const;
+
+  bool _use_permutations(Configuration const &configuration) const;
+
+  /// \brief Return the translation index `t` such that
+  ///     `make_permutation(f, t) == permutation`, or -1
+  Index _find_translation_index(Index f, Permutation const &permutation) const;
+
+  std::shared_ptr<Supercell const> m_supercell;
+
+  Index m_n_sites;
+
+  /// `m_translation_of_site[translation_permute_index(t, 0)] == t`, or -1
+  /// for sites that are not images of site 0 under a translation
+  std::vector<Index> m_translation_of_site;
+
+  group::StabilizerChain m_chain;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
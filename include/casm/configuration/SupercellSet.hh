@@ -2,9 +2,12 @@
 #define CASM_config_SupercellSet
 
 #include <map>
+#include <mutex>
 #include <set>
+#include <vector>
 
 #include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellNameCache.hh"
 #include "casm/configuration/definitions.hh"
 #include "casm/misc/Comparisons.hh"
 
@@ -15,6 +18,10 @@ namespace config {
 struct SupercellRecord : public Comparisons<CRTPBase<SupercellRecord>> {
   SupercellRecord(std::shared_ptr<Supercell const> const &_supercell);
 
+  /// \brief Constructor, using stored supercell names
+  SupercellRecord(std::shared_ptr<Supercell const> const &_supercell,
+                  SupercellNameCache &name_cache);
+
   std::shared_ptr<Supercell const> supercell;
 
   std::string supercell_name;
@@ -90,11 +97,90 @@ class SupercellSet {
 
   std::set<SupercellRecord> const &data() const;
 
+  /// \brief Supercell names and canonical supercells, shared by copies
+  std::shared_ptr<SupercellNameCache> const &name_cache() const;
+
  private:
   std::shared_ptr<Prim const> m_prim;
   std::set<SupercellRecord> m_data;
+  std::shared_ptr<SupercellNameCache> m_name_cache;
+};
+
+/// \brief Thread-safe insertion into a SupercellSet
+///
+/// Notes:
+/// - The `insert` methods may be called concurrently from many threads. The
+///   SupercellSet must not be used directly while they may be called.
+/// - SupercellRecord, and the supercell if necessary, are constructed
+///   without holding the lock, which is only held to insert the record.
+/// - Records are references to elements of the SupercellSet, which remain
+///   valid as other records are inserted. Because SupercellSet is ordered,
+///   its contents do not depend on the order of insertion.
+class ConcurrentSupercellSet {
+ public:
+  /// \brief Constructor
+  explicit ConcurrentSupercellSet(SupercellSet &_supercells);
+
+  /// \brief Insert a supercell, returning the record in the set
+  SupercellRecord const &insert(std::shared_ptr<Supercell const> supercell);
+
+  /// \brief Insert a supercell, returning the record in the set
+  SupercellRecord const &insert(
+      Eigen::Matrix3l const &transformation_matrix_to_super);
+
+  /// \brief Insert a canonical supercell by name, returning the record in
+  ///     the set
+  SupercellRecord const &insert_canonical(std::string supercell_name);
+
+  /// \brief Number of supercells in the set
+  SupercellSet::size_type size() const;
+
+ private:
+  SupercellSet &m_supercells;
+
+  mutable std::mutex m_mutex;
+};
+
+/// \brief Estimated memory used by a SupercellSet, in bytes
+struct SupercellSetMemoryUsage {
+  /// \brief Name and estimated memory used by each supercell, in set order
+  ///
+  /// Objects shared by several supercells are counted for the first.
+  std::vector<std::pair<std::string, SupercellMemoryUsage>> supercells;
+
+  /// \brief The set and its records, excluding the supercells
+  Index records_bytes = 0;
+
+  /// \brief Total, including the supercells
+  Index total_bytes() const {
+    Index bytes = records_bytes;
+    for (auto const &pair : supercells) {
+      bytes += pair.second.total_bytes();
+    }
+    return bytes;
+  }
 };
 
+/// \brief Estimate the memory used by a SupercellSet and its supercells
+SupercellSetMemoryUsage make_memory_usage(SupercellSet const &supercells,
+                                          MemoryUsageContext &context);
+
+/// \brief Estimate the memory used by a SupercellSet and its supercells, in
+///     bytes
+Index memory_usage(SupercellSet const &supercells);
+
+/// \brief Insert many supercells, constructing the missing ones in parallel
+std::vector<SupercellRecord const *> insert_supercells(
+    SupercellSet &supercells,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices_to_super,
+    Index n_threads = 1);
+
+/// \brief Insert many canonical supercells by name, constructing the missing
+///     ones in parallel
+std::vector<SupercellRecord const *> insert_canonical_supercells(
+    SupercellSet &supercells, std::vector<std::string> const &supercell_names,
+    Index n_threads = 1);
+
 /// \brief Make a map for finding canonical SupercellRecord by supercell_name
 std::map<std::string, SupercellRecord const *>
 make_index_by_canonical_supercell_name(
@@ -1,20 +1,164 @@
 #ifndef CASM_config_SupercellSymInfo
 #define CASM_config_SupercellSymInfo
 
+#include <functional>
+#include <list>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
 #include "casm/configuration/definitions.hh"
+#include "casm/configuration/memory_usage.hh"
 #include "casm/configuration/sym_info/definitions.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
 
 namespace CASM {
 namespace config {
 
+/// \brief Default memory budget, in bytes, of a supercell's
+///     TranslationPermutationCache
+constexpr Index DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES = 1 << 24;
+
+/// \brief Thread-safe, bounded cache of supercell translation permutations
+///
+/// Notes:
+/// - Used for supercells too large to store all translation permutations.
+///   Permutations are constructed with `make_translation_permutation` on
+///   first use and kept, least recently used first out, while their total
+///   size (`n_sites * sizeof(Index)` bytes each) is at most `max_bytes`.
+/// - Permutations are returned as shared pointers, so they remain valid
+///   after being evicted.
+/// - Shared by all SupercellSymOp in the same supercell. All methods may be
+///   called concurrently.
+/// - If `max_bytes` is 0, nothing is stored.
+/// - If a `source` is given, it is used instead of
+///   `make_translation_permutation` to construct permutations, for example
+///   to read them from stored tables (see `SupercellSymInfoTables`).
+class TranslationPermutationCache {
+ public:
+  /// \brief Constructs a translation permutation from its translation index
+  typedef std::function<sym_info::Permutation(Index)> source_type;
+
+  /// \brief Constructor
+  explicit TranslationPermutationCache(Index _max_bytes,
+                                       source_type _source = nullptr);
+
+  /// \brief Get a translation permutation, constructing it if not cached
+  std::shared_ptr<sym_info::Permutation const> get(
+      Index translation_index,
+      xtal::UnitCellIndexConverter const &ijk_index_converter,
+      xtal::UnitCellCoordIndexConverter const &bijk_index_converter,
+      DiagonalIndexConverter const *diagonal_index_converter = nullptr);
+
+  /// \brief Memory budget, in bytes
+  Index max_bytes() const;
+
+  /// \brief Total size of cached permutations, in bytes
+  Index size_bytes() const;
+
+  /// \brief Number of cached permutations
+  Index size() const;
+
+  /// \brief Number of calls to `get` that found a cached permutation
+  Index n_hits() const;
+
+  /// \brief Number of calls to `get` that constructed a permutation
+  Index n_misses() const;
+
+  /// \brief Remove all cached permutations
+  void clear();
+
+ private:
+  typedef std::list<Index> lru_list_type;
+
+  struct Entry {
+    std::shared_ptr<sym_info::Permutation const> permutation;
+    lru_list_type::iterator lru_position;
+  };
+
+  Index m_max_bytes;
+
+  /// If not null, constructs permutations on a miss
+  source_type m_source;
+
+  mutable std::mutex m_mutex;
+
+  /// Translation indices, most recently used first
+  lru_list_type m_lru;
+
+  std::unordered_map<Index, Entry> m_entries;
+
+  Index m_size_bytes;
+
+  Index m_n_hits;
+
+  Index m_n_misses;
+};
+
+/// \brief Smith normal form of an integer matrix, `U * M * V == S`
+void smith_normal_form(Eigen::Matrix3l const &M, Eigen::Matrix3l &U,
+                       Eigen::Matrix3l &S, Eigen::Matrix3l &V);
+
+/// \brief Coordinates of supercell translations as the group
+///     Z_n0 x Z_n1 x Z_n2
+///
+/// Notes:
+/// - From the Smith normal form, `U * T * V == S`, of the transformation
+///   matrix, `T`, from prim to supercell lattice vectors. The unit cell
+///   `x` has grid coordinate `(U * x) mod shape`, where `shape` is the
+///   diagonal of `S`, and translations add in grid coordinates. This
+///   allows translation searches to use a 3-dimensional discrete Fourier
+///   transform.
+/// - Grid coordinates are linearly indexed in row-major order. This is
+///   not the same as the supercell's `unitcell_index_converter` indexing.
+struct TranslationGrid {
+  /// \brief Constructor
+  explicit TranslationGrid(Eigen::Matrix3l const &transformation_matrix);
+
+  /// \brief Grid shape, the diagonal of the Smith normal form, with
+  ///     `shape(0) | shape(1) | shape(2)`
+  Eigen::Vector3l shape;
+
+  /// \brief Unimodular matrix, `U`, giving grid coordinates of unit cells
+  Eigen::Matrix3l to_grid;
+
+  /// \brief Number of grid points, equal to the number of unit cells
+  Index size() const { return shape(0) * shape(1) * shape(2); }
+
+  /// \brief Grid coordinate of a unit cell, each in [0, shape(i))
+  Eigen::Vector3l coordinate(UnitCell const &unitcell) const;
+
+  /// \brief Row-major linear index of a unit cell's grid coordinate
+  Index linear_index(UnitCell const &unitcell) const;
+};
+
 /// \brief Data structure describing application of symmetry in a supercell
+///
+/// Members are not modified after construction, except through the
+/// thread-safe `translation_permutation_cache`, so a SupercellSymInfo may be
+/// shared by multiple threads.
 struct SupercellSymInfo {
   /// \brief Constructor
   SupercellSymInfo(
       std::shared_ptr<Prim const> const &prim, Superlattice const &superlattice,
       xtal::UnitCellIndexConverter const &unitcell_index_converter,
       xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter,
-      Index max_n_translation_permutations = 100);
+      Index max_n_translation_permutations = 100,
+      Index translation_permutation_cache_max_bytes =
+          DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES,
+      DiagonalIndexConverter const *diagonal_index_converter = nullptr);
+
+  /// \brief Constructor, using precomputed permutations
+  SupercellSymInfo(
+      std::shared_ptr<Prim const> const &prim, Superlattice const &superlattice,
+      std::set<Index> const &head_group_index,
+      std::vector<sym_info::Permutation> &&_factor_group_permutations,
+      std::optional<std::vector<sym_info::Permutation>>
+          &&_translation_permutations,
+      Index translation_permutation_cache_max_bytes =
+          DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES,
+      TranslationPermutationCache::source_type translation_permutation_source =
+          nullptr);
 
   /// \brief The subgroup of the prim factor group that leaves
   /// the supercell lattice vectors invariant
@@ -28,13 +172,91 @@ struct SupercellSymInfo {
   /// (n_unitcells > max_n_translation_permutations).
   std::optional<std::vector<sym_info::Permutation>> translation_permutations;
 
+  /// \brief Holds recently used translation permutations for large
+  /// supercells
+  ///
+  /// Populated only if `translation_permutations` is not populated, else
+  /// null. Shared by all SupercellSymOp in the supercell. If its
+  /// `max_bytes()` is 0, `SupercellSymOp::permute_index` computes permuted
+  /// indices directly, without constructing a permutation.
+  std::shared_ptr<TranslationPermutationCache> translation_permutation_cache;
+
   /// \brief Describes how sites permute due to supercell factor group
   /// operations.
   ///
   /// There is one element for each element in the supercell factor group.
   std::vector<sym_info::Permutation> factor_group_permutations;
+
+  /// \brief Integer transformation matrices, in fractional coordinates of
+  /// the prim lattice, of the supercell factor group operations
+  ///
+  /// There is one element for each element in the supercell factor group.
+  /// Used to transform translations, as UnitCell, without floating point
+  /// arithmetic.
+  std::vector<Eigen::Matrix3l> factor_group_point_matrices;
+
+  /// \brief Lattice translations, as UnitCell, relating products of
+  /// supercell factor group operations to the factor group operation
+  /// elements
+  ///
+  /// For supercell factor group operations with indices `a`, `b`, and
+  /// product `ab`:
+  ///
+  ///     element[a] * element[b] = translation(cocycle) * element[ab],
+  ///
+  /// where `cocycle = factor_group_translation_cocycle[a * n_fg + b]` and
+  /// `n_fg` is the size of the supercell factor group. Allows the product
+  /// and inverse of SupercellSymOp to be found by integer arithmetic.
+  std::vector<UnitCell> factor_group_translation_cocycle;
+
+  /// \brief Grid coordinates of supercell translations, from the Smith
+  /// normal form of the transformation matrix
+  TranslationGrid translation_grid;
+
+  /// \brief Supercell translations, in Cartesian coordinates
+  ///
+  /// Column `translation_index` is the Cartesian coordinate of the
+  /// translation `unitcell_index_converter(translation_index)`. Allows
+  /// `SupercellSymOp::to_symop` to be constructed as a lookup and one
+  /// vector addition.
+  Eigen::Matrix3Xd translation_cart;
+};
+
+/// \brief Estimated memory used by a SupercellSymInfo, by component, in
+///     bytes
+struct SupercellSymInfoMemoryUsage {
+  /// \brief The supercell factor group, point matrices, and translation
+  ///     cocycle
+  Index factor_group_bytes = 0;
+
+  /// \brief `factor_group_permutations`
+  Index factor_group_permutations_bytes = 0;
+
+  /// \brief Number of stored `translation_permutations`
+  Index n_translation_permutations = 0;
+
+  /// \brief `translation_permutations`
+  Index translation_permutations_bytes = 0;
+
+  /// \brief Permutations currently held by `translation_permutation_cache`
+  Index translation_permutation_cache_bytes = 0;
+
+  /// \brief `sizeof(SupercellSymInfo)`, the translation grid, and
+  ///     `translation_cart`
+  Index other_bytes = 0;
+
+  /// \brief Sum of all components
+  Index total_bytes() const {
+    return factor_group_bytes + factor_group_permutations_bytes +
+           translation_permutations_bytes +
+           translation_permutation_cache_bytes + other_bytes;
+  }
 };
 
+/// \brief Estimate the memory used by a SupercellSymInfo
+SupercellSymInfoMemoryUsage make_memory_usage(SupercellSymInfo const &sym_info,
+                                              MemoryUsageContext &context);
+
 /// \brief Construct supercell factor group
 SymGroup make_factor_group(std::shared_ptr<Prim const> const &prim,
                            Superlattice const &superlattice);
@@ -43,12 +265,27 @@ SymGroup make_factor_group(std::shared_ptr<Prim const> const &prim,
 sym_info::Permutation make_translation_permutation(
     Index translation_index,
     xtal::UnitCellIndexConverter const &ijk_index_converter,
-    xtal::UnitCellCoordIndexConverter const &bijk_index_converter);
+    xtal::UnitCellCoordIndexConverter const &bijk_index_converter,
+    DiagonalIndexConverter const *diagonal_index_converter = nullptr);
+
+/// \brief Return `make_translation_permutation(translation_index, ...)[i]`,
+///     without constructing the permutation
+Index translation_permute_index(
+    Index translation_index, Index i,
+    xtal::UnitCellIndexConverter const &ijk_index_converter,
+    xtal::UnitCellCoordIndexConverter const &bijk_index_converter,
+    DiagonalIndexConverter const *diagonal_index_converter = nullptr);
 
 /// \brief Construct supercell translation permutations
 std::vector<sym_info::Permutation> make_translation_permutations(
     xtal::UnitCellIndexConverter const &ijk_index_converter,
-    xtal::UnitCellCoordIndexConverter const &bijk_index_converter);
+    xtal::UnitCellCoordIndexConverter const &bijk_index_converter,
+    DiagonalIndexConverter const *diagonal_index_converter = nullptr);
+
+/// \brief Construct Cartesian coordinates of supercell translations
+Eigen::Matrix3Xd make_translation_cart(
+    Lattice const &prim_lattice,
+    xtal::UnitCellIndexConverter const &ijk_index_converter);
 
 /// \brief Construct supercell factor group permutations
 std::vector<sym_info::Permutation> make_factor_group_permutations(
@@ -56,6 +293,15 @@ std::vector<sym_info::Permutation> make_factor_group_permutations(
     sym_info::UnitCellCoordSymGroupRep const &unitcellcoord_symgroup_rep,
     xtal::UnitCellCoordIndexConverter const &bijk_index_converter);
 
+/// \brief Construct supercell factor group integer transformation matrices
+std::vector<Eigen::Matrix3l> make_factor_group_point_matrices(
+    std::vector<Index> const &head_group_index,
+    sym_info::UnitCellCoordSymGroupRep const &unitcellcoord_symgroup_rep);
+
+/// \brief Construct the supercell factor group translation cocycle
+std::vector<UnitCell> make_factor_group_translation_cocycle(
+    SymGroup const &factor_group, Lattice const &prim_lattice);
+
 }  // namespace config
 }  // namespace CASM
 
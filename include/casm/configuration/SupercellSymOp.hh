@@ -4,12 +4,91 @@
 #include <iterator>
 
 #include "casm/configuration/definitions.hh"
+#include "casm/configuration/irreps/BlockPermutationMatrix.hh"
 #include "casm/configuration/sym_info/definitions.hh"
 #include "casm/misc/Comparisons.hh"
 
 namespace CASM {
 namespace config {
 
+/// \brief Non-owning handle to a symmetry operation consistent with a given
+///     Supercell
+///
+/// Holds a raw pointer to the supercell and the supercell factor group and
+/// translation indices, so copying it does not change a shared_ptr reference
+/// count, which SupercellSymOp copies do. The supercell must outlive the
+/// handle. Use `SupercellSymOp::ref()` to make a SupercellSymOpRef, and the
+/// SupercellSymOp constructor to make an owning SupercellSymOp from one.
+///
+/// Notes:
+/// - SupercellSymOpRef is not an iterator. Use SupercellSymOp to iterate
+///   over all operations.
+/// - Operations are applied as for SupercellSymOp, giving the same results.
+/// - If the supercell does not store all translation permutations,
+///   `permute_index` computes translated site indices directly, rather
+///   than using the shared translation permutation cache.
+class SupercellSymOpRef : public Comparisons<CRTPBase<SupercellSymOpRef>> {
+ public:
+  /// Default invalid SupercellSymOpRef
+  SupercellSymOpRef();
+
+  /// Construct SupercellSymOpRef
+  SupercellSymOpRef(Supercell const &_supercell,
+                    Index _supercell_factor_group_index,
+                    Index _translation_index);
+
+  /// Construct SupercellSymOpRef referring to the same operation as `op`
+  SupercellSymOpRef(SupercellSymOp const &op);
+
+  Supercell const &supercell() const { return *m_supercell; }
+
+  Supercell const *supercell_ptr() const { return m_supercell; }
+
+  Index supercell_factor_group_index() const {
+    return m_supercell_factor_group_index;
+  }
+
+  Index prim_factor_group_index() const;
+
+  Index translation_index() const { return m_translation_index; }
+
+  xtal::UnitCell translation_frac() const;
+
+  /// \brief Returns the index of the site containing the site DoF values that
+  ///     will be permuted onto site i
+  Index permute_index(Index i) const;
+
+  /// \brief Return the SymOp for the operation
+  SymOp to_symop() const;
+
+  /// \brief Returns the inverse supercell operation
+  SupercellSymOpRef inverse() const;
+
+  /// \brief Returns the supercell operation equivalent to applying first RHS
+  /// and then *this
+  SupercellSymOpRef operator*(SupercellSymOpRef const &RHS) const;
+
+  /// \brief Less than comparison (used to implement operator<() and other
+  /// standard comparisons via Comparisons)
+  bool operator<(SupercellSymOpRef const &RHS) const;
+
+  void throw_invalid_if_end() const;
+
+ private:
+  friend Comparisons<CRTPBase<SupercellSymOpRef>>;
+
+  /// \brief Equality comparison (used to implement operator==)
+  bool eq_impl(SupercellSymOpRef const &RHS) const;
+
+  Supercell const *m_supercell;
+
+  /// \brief Supercell factor group index
+  Index m_supercell_factor_group_index;
+
+  /// \brief Lattice translation index
+  Index m_translation_index;
+};
+
 /// \brief Represents and allows iteration over symmetry operations consistent
 /// with a given Supercell, combining pure factor group and pure translation
 /// operations.
@@ -20,6 +99,14 @@ namespace config {
 /// - When iterating over all operations the translation operations are
 ///   iterated in the inner loop and factor group operations iterated in the
 ///   outer loop
+/// - Thread safety: const member functions, including
+///   `translation_permute()`, may be called concurrently on the same
+///   SupercellSymOp, and the Supercell may be shared by any number of
+///   SupercellSymOp used in different threads. Incrementing, decrementing,
+///   or assigning a SupercellSymOp while another thread uses it is a data
+///   race, so iterate with a per-thread copy. Functions that need temporary
+///   storage, such as `apply`, allocate it per call, or use an explicit
+///   per-thread SupercellSymOpWorkspace or SupercellSymOpApplier.
 /// - Overall, the following sequence of permutations is replicated (if
 ///   sym_info.translation_permutations.has_value()):
 ///
@@ -63,6 +150,20 @@ class SupercellSymOp : public Comparisons<CRTPBase<SupercellSymOp>> {
                  Index _supercell_factor_group_index,
                  Eigen::Vector3d const &_translation_cart);
 
+  /// Construct SupercellSymOp, owning the supercell of a SupercellSymOpRef
+  SupercellSymOp(std::shared_ptr<Supercell const> const &_supercell,
+                 SupercellSymOpRef const &_ref);
+
+  /// Copy constructor, which does not copy the stored translation permutation
+  SupercellSymOp(SupercellSymOp const &other);
+
+  SupercellSymOp(SupercellSymOp &&other) = default;
+
+  /// Copy assignment, which does not copy the stored translation permutation
+  SupercellSymOp &operator=(SupercellSymOp const &other);
+
+  SupercellSymOp &operator=(SupercellSymOp &&other) = default;
+
   /// \brief Make supercell symop begin iterator
   static SupercellSymOp begin(
       std::shared_ptr<Supercell const> const &_supercell);
@@ -92,6 +193,9 @@ class SupercellSymOp : public Comparisons<CRTPBase<SupercellSymOp>> {
   ///     will be permuted onto site i
   Index permute_index(Index i) const;
 
+  /// \brief Returns a non-owning handle to the current operation
+  SupercellSymOpRef ref() const;
+
   /// Returns a reference to this -- allows SupercellSymOp to be treated
   /// as an iterator to SupercellSymOp object
   SupercellSymOp const &operator*() const;
@@ -115,13 +219,18 @@ class SupercellSymOp : public Comparisons<CRTPBase<SupercellSymOp>> {
   /// \brief Return the SymOp for the current operation
   SymOp to_symop() const;
 
-  /// Returns the translation permutation. Reference not valid after increment.
+  /// Returns the translation permutation. Reference not valid after
+  /// increment or assignment.
   sym_info::Permutation const &translation_permute() const;
 
   /// Returns the combination of factor group operation permutation and
   /// translation permutation
   sym_info::Permutation combined_permute() const;
 
+  /// \brief Returns the inverse of `combined_permute()`, which transforms
+  ///     site indices
+  sym_info::Permutation inverse_combined_permute() const;
+
   /// \brief Returns the inverse supercell operation
   SupercellSymOp inverse() const;
 
@@ -144,6 +253,9 @@ class SupercellSymOp : public Comparisons<CRTPBase<SupercellSymOp>> {
  private:
   friend Comparisons<CRTPBase<SupercellSymOp>>;
 
+  /// Updates the operation indices in place while iterating
+  friend class SupercellSymOpRangeIterator;
+
   /// \brief Equality comparison (used to implement operator==)
   bool eq_impl(const SupercellSymOp &iter) const;
 
@@ -190,12 +302,21 @@ class SupercellSymOp : public Comparisons<CRTPBase<SupercellSymOp>> {
   /// - m_supercell->superlattice.size()
   Index m_N_translation;
 
+  /// \brief A translation permutation obtained from the supercell's
+  ///     translation permutation cache, and its translation index
+  struct TranslationPermutation {
+    Index translation_index;
+    std::shared_ptr<sym_info::Permutation const> permute;
+  };
+
   /// \brief Use to hold current translation permutation, if not
   ///     held by SymInfo
-  mutable sym_info::Permutation m_tmp_translation_permute;
-
-  /// \brief Index of translation currently stored in m_tmp_translation_permute
-  mutable Index m_tmp_translation_index;
+  ///
+  /// Only accessed with the atomic shared_ptr functions, so that
+  /// `translation_permute()` may be called concurrently on the same
+  /// SupercellSymOp. It is not copied.
+  mutable std::shared_ptr<TranslationPermutation const>
+      m_tmp_translation_permute;
 };
 
 /// \brief Return inverse SymOp
@@ -210,6 +331,141 @@ ConfigDoFValues &apply(SupercellSymOp const &op, ConfigDoFValues &dof_values);
 ConfigDoFValues copy_apply(SupercellSymOp const &op,
                            ConfigDoFValues dof_values);
 
+/// \brief Reusable storage for applying SupercellSymOp
+///
+/// Holds the combined site permutation of the last operation applied, which
+/// is reused while the same operation is applied again, and temporary values
+/// which keep their allocations between calls. Not thread-safe; use one
+/// workspace per thread.
+struct SupercellSymOpWorkspace {
+  /// \brief Combined site permutation of the last operation applied
+  sym_info::Permutation combined_permute;
+
+  /// \brief Supercell of the operation `combined_permute` was made for
+  Supercell const *supercell = nullptr;
+
+  /// \brief Holds `supercell`, if `combined_permute` was made for a
+  ///     SupercellSymOp
+  std::shared_ptr<Supercell const> shared_supercell;
+
+  /// \brief Supercell factor group index of the operation
+  ///     `combined_permute` was made for
+  Index supercell_factor_group_index = -1;
+
+  /// \brief Translation index of the operation `combined_permute` was
+  ///     made for
+  Index translation_index = -1;
+
+  /// \brief Temporary global DoF or property values
+  Eigen::VectorXd global_values;
+
+  /// \brief Temporary occupation values
+  Eigen::VectorXi occupation;
+
+  /// \brief Temporary local DoF or property values
+  Eigen::MatrixXd local_values;
+
+  /// \brief Return the combined site permutation of `op`, making it only if
+  ///     it is not the one already stored
+  sym_info::Permutation const &update_combined_permute(
+      SupercellSymOp const &op);
+
+  /// \brief Return the combined site permutation of `op`, making it only if
+  ///     it is not the one already stored
+  sym_info::Permutation const &update_combined_permute(
+      SupercellSymOpRef const &op);
+};
+
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+/// ConfigDoFValues, using reusable storage
+ConfigDoFValues &apply(SupercellSymOp const &op, ConfigDoFValues &dof_values,
+                       SupercellSymOpWorkspace &workspace);
+
+/// \brief Apply a symmetry operation specified by a SupercellSymOpRef to
+/// ConfigDoFValues, using reusable storage
+ConfigDoFValues &apply(SupercellSymOpRef const &op,
+                       ConfigDoFValues &dof_values,
+                       SupercellSymOpWorkspace &workspace);
+
+/// \brief Apply symmetry operations to many occupation vectors
+void copy_apply_occupations(std::vector<SupercellSymOp> const &ops,
+                            Eigen::Ref<Eigen::MatrixXi const> occupations,
+                            Eigen::Ref<Eigen::MatrixXi> result,
+                            Index n_threads = 1);
+
+namespace SupercellSymOpApplier_impl {
+
+/// \brief Calls `apply(op, value, workspace)`, found by argument-dependent
+///     lookup for the type `T`
+template <typename T>
+T &apply_with_workspace(SupercellSymOp const &op, T &value,
+                        SupercellSymOpWorkspace &workspace) {
+  return apply(op, value, workspace);
+}
+
+/// \brief Calls `apply(op, value, workspace)`, found by argument-dependent
+///     lookup for the type `T`
+template <typename T>
+T &apply_with_workspace(SupercellSymOpRef const &op, T &value,
+                        SupercellSymOpWorkspace &workspace) {
+  return apply(op, value, workspace);
+}
+
+}  // namespace SupercellSymOpApplier_impl
+
+/// \brief Applies SupercellSymOp using one reusable workspace
+///
+/// Example, applying many operations without making a new site permutation
+/// or new temporary values for each operation:
+/// \code
+/// SupercellSymOpApplier applier;
+/// for (auto it = begin; it != end; ++it) {
+///   Configuration config = applier.copy_apply(*it, configuration);
+///   ...
+/// }
+/// \endcode
+///
+/// Works with any type, `T`, for which
+/// `apply(SupercellSymOp const &, T &, SupercellSymOpWorkspace &)` is
+/// defined: ConfigDoFValues, Configuration, and ConfigurationWithProperties.
+/// SupercellSymOpRef may be used for ConfigDoFValues and Configuration.
+class SupercellSymOpApplier {
+ public:
+  /// \brief Apply `op` to `value` in place
+  template <typename T>
+  T &apply(SupercellSymOp const &op, T &value) {
+    return SupercellSymOpApplier_impl::apply_with_workspace(op, value,
+                                                            m_workspace);
+  }
+
+  /// \brief Return `op` applied to a copy of `value`
+  template <typename T>
+  T copy_apply(SupercellSymOp const &op, T value) {
+    SupercellSymOpApplier_impl::apply_with_workspace(op, value, m_workspace);
+    return value;
+  }
+
+  /// \brief Apply `op` to `value` in place
+  template <typename T>
+  T &apply(SupercellSymOpRef const &op, T &value) {
+    return SupercellSymOpApplier_impl::apply_with_workspace(op, value,
+                                                            m_workspace);
+  }
+
+  /// \brief Return `op` applied to a copy of `value`
+  template <typename T>
+  T copy_apply(SupercellSymOpRef const &op, T value) {
+    SupercellSymOpApplier_impl::apply_with_workspace(op, value, m_workspace);
+    return value;
+  }
+
+  /// \brief The workspace
+  SupercellSymOpWorkspace &workspace() { return m_workspace; }
+
+ private:
+  SupercellSymOpWorkspace m_workspace;
+};
+
 /// \brief Apply a symmetry operation specified by a SupercellSymOp to
 ///     xtal::UnitCellCoord
 xtal::UnitCellCoord &apply(SupercellSymOp const &op,
@@ -220,6 +476,11 @@ xtal::UnitCellCoord &apply(SupercellSymOp const &op,
 xtal::UnitCellCoord copy_apply(SupercellSymOp const &op,
                                xtal::UnitCellCoord unitcellcoord);
 
+/// \brief Apply a symmetry operation specified by a SupercellSymOpRef to
+///     xtal::UnitCellCoord
+xtal::UnitCellCoord &apply(SupercellSymOpRef const &op,
+                           xtal::UnitCellCoord &unitcellcoord);
+
 /// \brief Make SupercellSymOp group rep for local property symmetry in a
 /// supercell
 std::vector<SupercellSymOp> make_local_supercell_symgroup_rep(
@@ -253,6 +514,14 @@ std::vector<Eigen::MatrixXd> make_local_dof_matrix_rep(
     std::set<Index> const &site_indices,
     std::shared_ptr<SymGroup const> &symgroup);
 
+/// \brief Make the block permutation matrix representation of `group` that
+///     describes the transformation of occupation DoF or a particular local
+///     DoF of amongst a subset of supercell sites
+irreps::BlockPermutationMatrixRep make_local_dof_block_matrix_rep(
+    std::vector<SupercellSymOp> const &group, DoFKey key,
+    std::set<Index> const &site_indices,
+    std::shared_ptr<SymGroup const> &symgroup);
+
 /// \brief Make the matrix representation of `group` that describes the
 ///     transformation of values in the basis of the given DoFSpace
 std::vector<Eigen::MatrixXd> make_dof_space_rep(
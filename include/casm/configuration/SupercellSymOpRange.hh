@@ -0,0 +1,157 @@
+#ifndef CASM_config_SupercellSymOpRange
+#define CASM_config_SupercellSymOpRange
+
+#include <iterator>
+#include <optional>
+
+#include "casm/configuration/SupercellSymOp.hh"
+
+namespace CASM {
+namespace config {
+
+class SupercellSymOpRange;
+
+/// \brief Iterator over the operations in a SupercellSymOpRange
+///
+/// Dereferences to a SupercellSymOp held by the iterator, which is updated
+/// in place on increment, so iterating does not copy the supercell
+/// shared_ptr. The reference is not valid after increment.
+class SupercellSymOpRangeIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = SupercellSymOp;
+  using pointer = SupercellSymOp const *;
+  using reference = SupercellSymOp const &;
+
+  SupercellSymOpRangeIterator();
+
+  SupercellSymOpRangeIterator(SupercellSymOpRange const &range,
+                              Index factor_group_position,
+                              Index translation_position);
+
+  SupercellSymOp const &operator*() const { return m_op; }
+
+  SupercellSymOp const *operator->() const { return &m_op; }
+
+  /// \brief prefix ++it, translations are iterated in the inner loop
+  SupercellSymOpRangeIterator &operator++();
+
+  /// \brief postfix it++
+  SupercellSymOpRangeIterator operator++(int);
+
+  /// \brief Linear position in the range
+  Index position() const;
+
+  bool operator==(SupercellSymOpRangeIterator const &RHS) const;
+
+  bool operator!=(SupercellSymOpRangeIterator const &RHS) const {
+    return !(*this == RHS);
+  }
+
+  /// \brief Compares position, for use with algorithms that check `it < end`
+  bool operator<(SupercellSymOpRangeIterator const &RHS) const {
+    return position() < RHS.position();
+  }
+
+ private:
+  void _update();
+
+  SupercellSymOpRange const *m_range;
+
+  Index m_factor_group_position;
+
+  Index m_translation_position;
+
+  SupercellSymOp m_op;
+};
+
+/// \brief A set of SupercellSymOp with the product structure
+///     (factor group operations) x (translations)
+///
+/// Represents the operations `SupercellSymOp(supercell, f, t)` for each
+/// supercell factor group index `f` in `factor_group_indices` and each
+/// translation index `t` in `translation_indices`, in that order with
+/// translations iterated in the inner loop. Only the two index lists are
+/// stored, so storage is `factor_group_indices.size() +
+/// translation_indices.size()`, rather than one SupercellSymOp per
+/// operation.
+///
+/// The full supercell group has this structure, as do subgroups that
+/// include all of their translations combined with each factor group
+/// operation, such as the invariant group of a configuration that has only
+/// point operations taking it to itself. Use `make_supercell_symop_range`
+/// to check a group for this structure.
+///
+/// Algorithms that take a SupercellSymOpRange (see canonical_form.hh) use
+/// the structure to apply each factor group operation once and then iterate
+/// over translations, which only permute sites.
+class SupercellSymOpRange {
+ public:
+  typedef SupercellSymOpRangeIterator const_iterator;
+
+  /// \brief Constructor
+  SupercellSymOpRange(std::shared_ptr<Supercell const> const &_supercell,
+                      std::vector<Index> _factor_group_indices,
+                      std::vector<Index> _translation_indices);
+
+  /// \brief All operations consistent with the supercell
+  static SupercellSymOpRange all(
+      std::shared_ptr<Supercell const> const &_supercell);
+
+  /// \brief All translations of the supercell
+  static SupercellSymOpRange translations(
+      std::shared_ptr<Supercell const> const &_supercell);
+
+  std::shared_ptr<Supercell const> const &supercell() const {
+    return m_supercell;
+  }
+
+  /// \brief Supercell factor group indices, iterated in the outer loop
+  std::vector<Index> const &factor_group_indices() const {
+    return m_factor_group_indices;
+  }
+
+  /// \brief Translation indices, iterated in the inner loop
+  std::vector<Index> const &translation_indices() const {
+    return m_translation_indices;
+  }
+
+  /// \brief Number of operations
+  Index size() const {
+    return m_factor_group_indices.size() * m_translation_indices.size();
+  }
+
+  /// \brief Return true if there are no operations
+  bool empty() const { return size() == 0; }
+
+  /// \brief The operation at linear index `i`
+  SupercellSymOp operator[](Index i) const;
+
+  /// \brief A non-owning handle to the operation at linear index `i`
+  SupercellSymOpRef ref(Index i) const;
+
+  const_iterator begin() const;
+
+  const_iterator end() const;
+
+  /// \brief Copy the operations into a vector
+  std::vector<SupercellSymOp> to_vector() const;
+
+ private:
+  std::shared_ptr<Supercell const> m_supercell;
+
+  std::vector<Index> m_factor_group_indices;
+
+  std::vector<Index> m_translation_indices;
+};
+
+/// \brief Return `group` as a SupercellSymOpRange, if it has the product
+///     structure (factor group operations) x (translations)
+std::optional<SupercellSymOpRange> make_supercell_symop_range(
+    std::vector<SupercellSymOp> const &group);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef CASM_config_asymmetric_unit
+#define CASM_config_asymmetric_unit
+
+#include <optional>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+struct Configuration;
+
+/// \brief Return the asymmetric unit index of each site, for the orbits of
+///     sites under a group of supercell operations
+std::vector<Index> make_asymmetric_unit_index(
+    std::vector<SupercellSymOp> const &group, Index n_sites);
+
+/// \brief Return the asymmetric unit index of each site, for the orbits of
+///     sites under the configuration invariant subgroup
+std::vector<Index> make_asymmetric_unit_index(
+    Configuration const &configuration);
+
+/// \brief Return the linear site indices of each asymmetric unit
+std::vector<std::vector<Index>> make_asymmetric_unit_indices(
+    std::vector<Index> const &asymmetric_unit_index);
+
+/// \brief Return the linear site indices of each asymmetric unit of a
+///     configuration
+std::vector<std::vector<Index>> make_asymmetric_unit_indices(
+    Configuration const &configuration);
+
+/// \brief Reorder asymmetric units to be consistent with those of an
+///     equivalent reference configuration
+std::optional<std::vector<std::vector<Index>>>
+make_consistent_asymmetric_unit_indices(
+    std::vector<std::vector<Index>> const &initial,
+    Configuration const &configuration_init,
+    std::vector<std::vector<Index>> const &reference,
+    Configuration const &configuration_ref);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
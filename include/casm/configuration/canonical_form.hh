@@ -1,7 +1,11 @@
 #ifndef CASM_config_canonical_form
 #define CASM_config_canonical_form
 
+#include <algorithm>
+#include <map>
+#include <optional>
 #include <set>
+#include <vector>
 
 #include "casm/configuration/definitions.hh"
 
@@ -12,6 +16,7 @@ struct Configuration;
 struct ConfigurationWithProperties;
 struct Supercell;
 class SupercellSymOp;
+class SupercellSymOpRange;
 
 // --- Supercell ---
 
@@ -28,7 +33,51 @@ std::shared_ptr<Supercell const> make_canonical_form(
 std::vector<std::shared_ptr<Supercell const>> make_equivalents(
     Supercell const &supercell);
 
+/// \brief Return the supercells with distinct symmetrically equivalent
+///     lattices, for many supercells in parallel
+std::vector<std::vector<std::shared_ptr<Supercell const>>> make_equivalents(
+    std::vector<std::shared_ptr<Supercell const>> const &supercells,
+    Index n_threads = 1);
+
+/// \brief Return the transformation matrix of the canonical equivalent
+///     superlattice, without constructing a Supercell
+Eigen::Matrix3l make_canonical_transformation_matrix(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super);
+
+/// \brief Return the transformation matrices of the canonical equivalent
+///     superlattices, for many superlattices in parallel
+std::vector<Eigen::Matrix3l> make_canonical_transformation_matrices(
+    std::shared_ptr<Prim const> const &prim,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices_to_super,
+    Index n_threads = 1);
+
+/// \brief Return the transformation matrices of the distinct symmetrically
+///     equivalent superlattices, without constructing Supercells
+std::vector<Eigen::Matrix3l> make_equivalent_transformation_matrices(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super);
+
+/// \brief Return the transformation matrices of the distinct symmetrically
+///     equivalent superlattices, for many superlattices in parallel
+std::vector<std::vector<Eigen::Matrix3l>>
+make_equivalent_transformation_matrices(
+    std::shared_ptr<Prim const> const &prim,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices_to_super,
+    Index n_threads = 1);
+
+/// \brief Return the indices of the prim factor group operations that leave
+///     a superlattice invariant, without constructing a Supercell
+std::vector<Index> make_superlattice_invariant_factor_group_indices(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super);
+
 // --- Configuration ---
+//
+// The operations `[begin, end)` may be SupercellSymOp or SupercellSymOpRef.
+// Operations are compared and tracked as SupercellSymOpRef, so the supercell
+// shared_ptr is only copied to make returned SupercellSymOp. If the elements
+// are SupercellSymOpRef, they must refer to the configuration's supercell.
 
 /// \brief Return true if configuration is in canonical form
 template <typename SupercellSymOpIt>
@@ -41,6 +90,13 @@ template <typename SupercellSymOpIt>
 Configuration make_canonical_form(Configuration const &configuration,
                                   SupercellSymOpIt begin, SupercellSymOpIt end);
 
+/// \brief Return the canonical forms of many configurations in the same
+///     supercell
+template <typename SupercellSymOpIt>
+std::vector<Configuration> make_canonical_forms(
+    std::vector<Configuration> const &configurations, SupercellSymOpIt begin,
+    SupercellSymOpIt end, Index n_threads = 1);
+
 /// \brief Return rep that makes a configuration canonical
 template <typename SupercellSymOpIt>
 SupercellSymOp to_canonical(Configuration const &configuration,
@@ -58,6 +114,69 @@ std::vector<SupercellSymOp> make_invariant_subgroup(
     Configuration const &configuration, SupercellSymOpIt begin,
     SupercellSymOpIt end, std::set<std::string> which_dofs = {"all"});
 
+/// \brief Return true if configuration is in canonical form, applying each
+///     factor group operation of `range` once
+bool is_canonical(Configuration const &configuration,
+                  SupercellSymOpRange const &range);
+
+/// \brief Return rep that makes a configuration canonical, applying each
+///     factor group operation of `range` once
+SupercellSymOp to_canonical(Configuration const &configuration,
+                            SupercellSymOpRange const &range);
+
+/// \brief Return the canonical form of a configuration, applying each
+///     factor group operation of `range` once
+Configuration make_canonical_form(Configuration const &configuration,
+                                  SupercellSymOpRange const &range);
+
+/// \brief Return rep that leave configuration invariant, applying each
+///     factor group operation of `range` once
+std::vector<SupercellSymOp> make_invariant_subgroup(
+    Configuration const &configuration, SupercellSymOpRange const &range,
+    std::set<std::string> which_dofs = {"all"});
+
+/// \brief Canonical form results for one configuration, as found by
+///     `make_canonical_form_info`
+///
+/// Indices are positions in the `[begin, end)` range of operations used.
+struct CanonicalFormInfo {
+  /// \brief True if the configuration is in canonical form
+  bool is_canonical = true;
+
+  /// \brief Index of the operation that makes the configuration canonical,
+  ///     as by `to_canonical`
+  Index to_canonical_index = 0;
+
+  /// \brief Indices of the operations that leave the configuration
+  ///     invariant, as by `make_invariant_subgroup`
+  std::vector<Index> invariant_subgroup_indices;
+};
+
+/// \brief Return `is_canonical`, `to_canonical`, and
+///     `make_invariant_subgroup` results from one pass over the operations
+template <typename SupercellSymOpIt>
+CanonicalFormInfo make_canonical_form_info(Configuration const &configuration,
+                                           SupercellSymOpIt begin,
+                                           SupercellSymOpIt end);
+
+// --- ConfigurationView ---
+
+/// \brief Return true if a view of a configuration is in canonical form
+template <typename SupercellSymOpIt>
+bool is_canonical(ConfigurationView const &configuration,
+                  SupercellSymOpIt begin, SupercellSymOpIt end);
+
+/// \brief Return rep that makes a view of a configuration canonical
+template <typename SupercellSymOpIt>
+SupercellSymOp to_canonical(ConfigurationView const &configuration,
+                            SupercellSymOpIt begin, SupercellSymOpIt end);
+
+/// \brief Return rep that leave a view of a configuration invariant
+template <typename SupercellSymOpIt>
+std::vector<SupercellSymOp> make_invariant_subgroup(
+    ConfigurationView const &configuration, SupercellSymOpIt begin,
+    SupercellSymOpIt end, std::set<std::string> which_dofs = {"all"});
+
 /// \brief Return the distinct symmetrically equivalent configurations (using
 ///     operations that leave the supercell lattice invariant)
 template <typename SupercellSymOpIt>
@@ -89,6 +208,119 @@ std::vector<std::vector<SupercellSymOp>> make_equivalence_map(
 bool site_indices_are_invariant(SupercellSymOp const &op,
                                 std::set<Index> const &site_indices);
 
+/// \brief Find the SupercellSymOp which map equivalent configurations,
+///     using the invariant subgroup of the first equivalent and its cosets
+///
+/// Gives the same result as `make_equivalence_map`. Operations are applied
+/// to the first equivalent only until its invariant subgroup `H` and one
+/// operation `g_i` mapping it onto each equivalent are found. Then
+/// `equivalence_map[i]` is the coset `g_i * H`, formed with
+/// `SupercellSymOp::operator*`. This uses at most `|G|` applications and
+/// `map` lookups, rather than `|G| * equivalents.size()` comparisons.
+///
+/// \param equivalents The distinct symmetrically equivalent configurations
+///     generated by [begin, end)
+/// \param begin,end The group used to generate the equivalents. Must be
+///     closed under multiplication.
+///
+/// \returns equivalence_map, The vector equivalence_map[i] is
+///     the SupercellSymOp that transform the first element in
+///     equivalents into the i-th element in equivalents, in the order of
+///     [begin, end).
+///
+template <typename SupercellSymOpIt>
+std::vector<std::vector<SupercellSymOp>> make_equivalence_map_by_cosets(
+    std::vector<Configuration> const &equivalents, SupercellSymOpIt begin,
+    SupercellSymOpIt end) {
+  if (equivalents.size() == 0) {
+    throw std::runtime_error(
+        "Error in make_equivalence_map_by_cosets: equivalents.size() == 0");
+  }
+  std::vector<SupercellSymOp> group(begin, end);
+  Index group_size = group.size();
+  Index n_equivs = equivalents.size();
+  if (group_size % n_equivs != 0) {
+    throw std::runtime_error(
+        "Error in make_equivalence_map_by_cosets: number of equivalents does "
+        "not divide the group size");
+  }
+  Index subgroup_size = group_size / n_equivs;
+
+  std::map<Configuration, Index> equivalent_index;
+  for (Index d = 0; d < n_equivs; ++d) {
+    equivalent_index.emplace(equivalents[d], d);
+  }
+  std::map<SupercellSymOp, Index> group_index;
+  for (Index i = 0; i < group_size; ++i) {
+    group_index.emplace(group[i], i);
+  }
+
+  std::vector<Index> subgroup;
+  std::vector<Index> representative(n_equivs, -1);
+  Index n_found = 0;
+  for (Index i = 0; i < group_size; ++i) {
+    if (Index(subgroup.size()) == subgroup_size && n_found == n_equivs) {
+      break;
+    }
+    auto it = equivalent_index.find(copy_apply_f(group[i], equivalents[0]));
+    if (it == equivalent_index.end()) {
+      throw std::runtime_error(
+          "Error in make_equivalence_map_by_cosets: failed");
+    }
+    Index d = it->second;
+    if (d == 0) {
+      subgroup.push_back(i);
+    }
+    if (representative[d] == -1) {
+      representative[d] = i;
+      ++n_found;
+    }
+  }
+  if (Index(subgroup.size()) != subgroup_size || n_found != n_equivs) {
+    throw std::runtime_error(
+        "Error in make_equivalence_map_by_cosets: operations do not form a "
+        "group");
+  }
+
+  std::vector<std::vector<SupercellSymOp>> equivalence_map(n_equivs);
+  std::vector<Index> coset;
+  for (Index d = 0; d < n_equivs; ++d) {
+    coset.clear();
+    for (Index h : subgroup) {
+      auto it = group_index.find(group[representative[d]] * group[h]);
+      if (it == group_index.end()) {
+        throw std::runtime_error(
+            "Error in make_equivalence_map_by_cosets: operations are not "
+            "closed under multiplication");
+      }
+      coset.push_back(it->second);
+    }
+    std::sort(coset.begin(), coset.end());
+    for (Index i : coset) {
+      equivalence_map[d].push_back(group[i]);
+    }
+  }
+  return equivalence_map;
+}
+
+/// \brief Find the SupercellSymOp which map equivalent configurations,
+///     using the invariant subgroup of the first equivalent and its cosets
+///
+/// Gives the same result as `make_equivalence_map`. Properties are not
+/// considered in comparisons; they are assumed to be symmetrically
+/// consistent with DoF values.
+template <typename SupercellSymOpIt>
+std::vector<std::vector<SupercellSymOp>> make_equivalence_map_by_cosets(
+    std::vector<ConfigurationWithProperties> const &equivalents_with_properties,
+    SupercellSymOpIt begin, SupercellSymOpIt end) {
+  std::vector<Configuration> equivalents;
+  equivalents.reserve(equivalents_with_properties.size());
+  for (auto const &equiv : equivalents_with_properties) {
+    equivalents.push_back(equiv.configuration);
+  }
+  return make_equivalence_map_by_cosets(equivalents, begin, end);
+}
+
 /// \brief Return the subgroup of [begin, end] that does not mix given sites and
 ///     other sites
 template <typename SupercellSymOpIt>
@@ -104,30 +336,139 @@ std::vector<SupercellSymOp> make_invariant_subgroup(
     SupercellSymOpIt begin, SupercellSymOpIt end,
     std::set<std::string> which_dofs = {"all"});
 
+// --- Configuration mapping ---
+
+/// \brief Find a symmetry operation that maps a configuration to an
+///     equivalent reference configuration, which may be in a different
+///     supercell
+std::optional<SymOp> find_mapping_operation(
+    Configuration const &configuration, Configuration const &configuration_ref);
+
 }  // namespace config
 }  // namespace CASM
 
 // --- Implementation ---
 
 #include <algorithm>
+#include <iterator>
+#include <optional>
 
+#include "casm/configuration/CanonicalFormEngine.hh"
 #include "casm/configuration/ConfigCompare.hh"
+#include "casm/configuration/ConfigurationView.hh"
+#include "casm/configuration/perf.hh"
 
 namespace CASM {
 namespace config {
 
+namespace canonical_form_impl {
+
+/// \brief Records the supercell factor group indices of visited operations
+///
+/// Used when only global DoF are compared (see
+/// `is_global_dof_only_comparison`), so results depend only on the factor
+/// group index and operations differing only by translation are skipped.
+class FactorGroupIndexSet {
+ public:
+  /// \brief Constructor, for a Configuration or ConfigurationView
+  template <typename ConfigurationType>
+  explicit FactorGroupIndexSet(ConfigurationType const &configuration)
+      : m_visited(
+            configuration.supercell->sym_info.factor_group->element.size(),
+            false) {}
+
+  /// \brief Return true if the factor group index of `op` was not visited
+  ///     before, and mark it visited
+  bool insert(SupercellSymOpRef const &op) {
+    Index f = op.supercell_factor_group_index();
+    if (m_visited[f]) {
+      return false;
+    }
+    m_visited[f] = true;
+    return true;
+  }
+
+ private:
+  std::vector<bool> m_visited;
+};
+
+/// \brief Return the supercell owning the operations of a range whose
+///     elements are SupercellSymOp
+inline std::shared_ptr<Supercell const> const &range_supercell(
+    SupercellSymOp const &op, std::shared_ptr<Supercell const> const &) {
+  return op.supercell();
+}
+
+/// \brief Return the supercell owning the operations of a range whose
+///     elements are SupercellSymOpRef, which must be `supercell`
+inline std::shared_ptr<Supercell const> const &range_supercell(
+    SupercellSymOpRef const &,
+    std::shared_ptr<Supercell const> const &supercell) {
+  return supercell;
+}
+
+// Shared by the Configuration and ConfigurationView overloads:
+
+template <typename ConfigurationType, typename SupercellSymOpIt>
+bool is_canonical(ConfigurationType const &configuration,
+                  SupercellSymOpIt begin, SupercellSymOpIt end);
+
+template <typename ConfigurationType, typename SupercellSymOpIt>
+SupercellSymOp to_canonical(ConfigurationType const &configuration,
+                            SupercellSymOpIt begin, SupercellSymOpIt end);
+
+template <typename ConfigurationType, typename SupercellSymOpIt>
+std::vector<SupercellSymOp> make_invariant_subgroup(
+    ConfigurationType const &configuration, SupercellSymOpIt begin,
+    SupercellSymOpIt end, std::set<std::string> const &which_dofs);
+
+}  // namespace canonical_form_impl
+
 /// \brief Return true if configuration is in canonical form
 ///
 /// If true, then `configuration` satisfies, for all `rep` in `[begin,
 /// end)`:
 ///     configuration >= copy_apply(rep, configuration)
+///
+/// If only global DoF are compared, only the first operation with each
+/// supercell factor group index is compared.
 template <typename SupercellSymOpIt>
 bool is_canonical(Configuration const &configuration, SupercellSymOpIt begin,
                   SupercellSymOpIt end) {
-  ConfigCompare compare_f(configuration);
-  return std::none_of(begin, end, compare_f);
+  return canonical_form_impl::is_canonical(configuration, begin, end);
 }
 
+/// \brief Return true if a view of a configuration is in canonical form
+///
+/// Equivalent to `is_canonical` for a Configuration, comparing the DoF
+/// values referenced by the view without copying them.
+template <typename SupercellSymOpIt>
+bool is_canonical(ConfigurationView const &configuration,
+                  SupercellSymOpIt begin, SupercellSymOpIt end) {
+  return canonical_form_impl::is_canonical(configuration, begin, end);
+}
+
+namespace canonical_form_impl {
+
+template <typename ConfigurationType, typename SupercellSymOpIt>
+bool is_canonical(ConfigurationType const &configuration,
+                  SupercellSymOpIt begin, SupercellSymOpIt end) {
+  return visit_config_compare(configuration, [&](auto const &compare_f) {
+    if (is_global_dof_only_comparison(configuration)) {
+      canonical_form_impl::FactorGroupIndexSet visited(configuration);
+      for (auto it = begin; it != end; ++it) {
+        if (visited.insert(*it) && compare_f(*it)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    return std::none_of(begin, end, compare_f);
+  });
+}
+
+}  // namespace canonical_form_impl
+
 /// \brief Return the configuration that compares greater to all equivalents in
 ///     the same supercell
 ///
@@ -141,17 +482,96 @@ Configuration make_canonical_form(Configuration const &configuration,
   return copy_apply(to_canonical(configuration, begin, end), configuration);
 }
 
+/// \brief Return the canonical forms of many configurations in the same
+///     supercell
+///
+/// The result, `canonical_configurations`, satisfies for each `i` and all
+/// `rep` in `[begin, end)`:
+///     canonical_configurations[i] >= copy_apply(rep, configurations[i])
+///
+/// Notes:
+/// - A single CanonicalFormEngine is constructed for `[begin, end)`, so the
+///   permutation tables are computed once and reused for every
+///   configuration. See `CanonicalFormEngine::make_canonical_forms` for
+///   details of tiling and threading.
+/// - All configurations must have the same supercell as the operations.
+///
+/// \param configurations The configurations
+/// \param begin,end The operations used to find canonical forms
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+template <typename SupercellSymOpIt>
+std::vector<Configuration> make_canonical_forms(
+    std::vector<Configuration> const &configurations, SupercellSymOpIt begin,
+    SupercellSymOpIt end, Index n_threads) {
+  if (configurations.empty()) {
+    return std::vector<Configuration>();
+  }
+  CanonicalFormEngine engine(configurations.front().supercell,
+                             std::vector<SupercellSymOp>(begin, end));
+  return engine.make_canonical_forms(configurations, n_threads);
+}
+
 /// \brief Return rep that makes a configuration canonical
 ///
 /// The result, `rep`, is the first in `[begin, end)` that satisfies:
 ///     canonical_configuration == copy_apply(rep, configuration)
+///
+/// If only occupation is compared, the comparison type is specialized at
+/// compile time (see `visit_config_compare`). If only global DoF are
+/// compared, only the first operation with each supercell factor group index
+/// is compared, which gives the same result.
 template <typename SupercellSymOpIt>
 SupercellSymOp to_canonical(Configuration const &configuration,
                             SupercellSymOpIt begin, SupercellSymOpIt end) {
-  ConfigCompare compare_f(configuration);
-  return *std::max_element(begin, end, compare_f);
+  return canonical_form_impl::to_canonical(configuration, begin, end);
 }
 
+/// \brief Return rep that makes a view of a configuration canonical
+///
+/// Equivalent to `to_canonical` for a Configuration, comparing the DoF
+/// values referenced by the view without copying them.
+template <typename SupercellSymOpIt>
+SupercellSymOp to_canonical(ConfigurationView const &configuration,
+                            SupercellSymOpIt begin, SupercellSymOpIt end) {
+  return canonical_form_impl::to_canonical(configuration, begin, end);
+}
+
+namespace canonical_form_impl {
+
+template <typename ConfigurationType, typename SupercellSymOpIt>
+SupercellSymOp to_canonical(ConfigurationType const &configuration,
+                            SupercellSymOpIt begin, SupercellSymOpIt end) {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(to_canonical);
+  CASM_CONFIGURATION_PERF_COUNT(canonicalization);
+  return visit_config_compare(configuration, [&](auto const &compare_f) {
+    if (begin == end) {
+      throw std::runtime_error("Error in to_canonical: no operations");
+    }
+    // track the best operation by SupercellSymOpRef, so updates do not copy
+    // the supercell shared_ptr
+    SupercellSymOpRef best(*begin);
+    if (is_global_dof_only_comparison(configuration)) {
+      canonical_form_impl::FactorGroupIndexSet visited(configuration);
+      for (auto it = begin; it != end; ++it) {
+        if (visited.insert(*it) && compare_f(best, *it)) {
+          best = *it;
+        }
+      }
+    } else {
+      for (auto it = std::next(begin); it != end; ++it) {
+        if (compare_f(best, *it)) {
+          best = *it;
+        }
+      }
+    }
+    return SupercellSymOp(range_supercell(*begin, configuration.supercell),
+                          best);
+  });
+}
+
+}  // namespace canonical_form_impl
+
 /// \brief Return rep that makes a configuration from the canonical
 ///     configuration
 ///
@@ -165,38 +585,181 @@ SupercellSymOp from_canonical(Configuration const &configuration,
 
   // alternate version: the lowest index element that transforms canonical form
   // to this
-  ConfigCompare compare_f(configuration);
-  auto _to_canonical = begin;
-  auto _from_canonical = _to_canonical->inverse();
-  for (auto it = begin; it < end; ++it) {
-    if (compare_f(*_to_canonical, *it)) {
-      _to_canonical = it;
-      _from_canonical = _to_canonical->inverse();
-    }
-    // other permutations that result in canonical config may have a lower index
-    // inverse
-    else if (!compare_f(*it, *_to_canonical)) {
-      auto it_inv = it->inverse();
-      if (it_inv < _from_canonical) {
-        _from_canonical = it_inv;
+  return visit_config_compare(configuration, [&](auto const &compare_f) {
+    SupercellSymOpRef _to_canonical(*begin);
+    SupercellSymOpRef _from_canonical = _to_canonical.inverse();
+    for (auto it = begin; it < end; ++it) {
+      if (compare_f(_to_canonical, *it)) {
+        _to_canonical = *it;
+        _from_canonical = _to_canonical.inverse();
+      }
+      // other permutations that result in canonical config may have a lower
+      // index inverse
+      else if (!compare_f(*it, _to_canonical)) {
+        SupercellSymOpRef it_inv = SupercellSymOpRef(*it).inverse();
+        if (it_inv < _from_canonical) {
+          _from_canonical = it_inv;
+        }
       }
     }
-  }
-  return _from_canonical;
+    return SupercellSymOp(
+        canonical_form_impl::range_supercell(*begin, configuration.supercell),
+        _from_canonical);
+  });
 }
 
 /// \brief Return rep that leave configuration invariant
 ///
 /// The results, `rep`, are the elements in `[begin, end)` that satisfy:
 ///     configuration == copy_apply(rep, canonical)
+///
+/// If only global DoF are compared, the comparison is made once per
+/// supercell factor group index.
 template <typename SupercellSymOpIt>
 std::vector<SupercellSymOp> make_invariant_subgroup(
     Configuration const &configuration, SupercellSymOpIt begin,
     SupercellSymOpIt end, std::set<std::string> which_dofs) {
-  std::vector<SupercellSymOp> subgroup;
-  ConfigIsEquivalent equal_to_f(configuration, which_dofs);
-  std::copy_if(begin, end, std::back_inserter(subgroup), equal_to_f);
-  return subgroup;
+  return canonical_form_impl::make_invariant_subgroup(configuration, begin,
+                                                      end, which_dofs);
+}
+
+/// \brief Return rep that leave a view of a configuration invariant
+///
+/// Equivalent to `make_invariant_subgroup` for a Configuration, comparing
+/// the DoF values referenced by the view without copying them.
+template <typename SupercellSymOpIt>
+std::vector<SupercellSymOp> make_invariant_subgroup(
+    ConfigurationView const &configuration, SupercellSymOpIt begin,
+    SupercellSymOpIt end, std::set<std::string> which_dofs) {
+  return canonical_form_impl::make_invariant_subgroup(configuration, begin,
+                                                      end, which_dofs);
+}
+
+namespace canonical_form_impl {
+
+template <typename ConfigurationType, typename SupercellSymOpIt>
+std::vector<SupercellSymOp> make_invariant_subgroup(
+    ConfigurationType const &configuration, SupercellSymOpIt begin,
+    SupercellSymOpIt end, std::set<std::string> const &which_dofs) {
+  return visit_config_is_equivalent(
+      configuration,
+      [&](auto const &equal_to_f) {
+        // collect the invariant operations by SupercellSymOpRef, and copy
+        // the supercell shared_ptr only to make the owning results
+        std::vector<SupercellSymOpRef> invariant;
+        if (is_global_dof_only_comparison(configuration, which_dofs)) {
+          // 0: not compared, 1: equal, 2: not equal
+          std::vector<int> result(
+              configuration.supercell->sym_info.factor_group->element.size(),
+              0);
+          for (auto it = begin; it != end; ++it) {
+            int &r = result[it->supercell_factor_group_index()];
+            if (r == 0) {
+              r = equal_to_f(*it) ? 1 : 2;
+            }
+            if (r == 1) {
+              invariant.emplace_back(*it);
+            }
+          }
+        } else {
+          for (auto it = begin; it != end; ++it) {
+            if (equal_to_f(*it)) {
+              invariant.emplace_back(*it);
+            }
+          }
+        }
+        std::vector<SupercellSymOp> subgroup;
+        if (invariant.empty()) {
+          return subgroup;
+        }
+        std::shared_ptr<Supercell const> const &supercell =
+            range_supercell(*begin, configuration.supercell);
+        subgroup.reserve(invariant.size());
+        for (SupercellSymOpRef const &op : invariant) {
+          subgroup.emplace_back(supercell, op);
+        }
+        return subgroup;
+      },
+      which_dofs);
+}
+
+}  // namespace canonical_form_impl
+
+/// \brief Return `is_canonical`, `to_canonical`, and
+///     `make_invariant_subgroup` results from one pass over the operations
+///
+/// Each operation is compared with the untransformed configuration once,
+/// which gives the invariant subgroup and the canonical flag. While the
+/// operation found to make the configuration canonical leaves it invariant,
+/// the same comparison also updates it, so for a canonical configuration one
+/// comparison per operation is made in total, versus three for separate
+/// calls. If only global DoF are compared, the comparison is made once per
+/// supercell factor group index.
+///
+/// \param configuration The configuration, with all DoF compared
+/// \param begin,end The operations
+///
+/// \returns The results, with indices as positions in `[begin, end)`, equal
+///     to those of `is_canonical`, `to_canonical`, and
+///     `make_invariant_subgroup`
+template <typename SupercellSymOpIt>
+CanonicalFormInfo make_canonical_form_info(Configuration const &configuration,
+                                           SupercellSymOpIt begin,
+                                           SupercellSymOpIt end) {
+  CASM_CONFIGURATION_PERF_COUNT(canonicalization);
+  return visit_config_is_equivalent(configuration, [&](auto const &equal_to_f) {
+    CanonicalFormInfo info;
+    bool global_dof_only = is_global_dof_only_comparison(configuration);
+    // by supercell factor group index, if global_dof_only:
+    // 0: not compared, 1: equal, 2: less, 3: greater
+    std::vector<int> result;
+    if (global_dof_only) {
+      result.resize(
+          configuration.supercell->sym_info.factor_group->element.size(), 0);
+    }
+    std::optional<SupercellSymOpRef> best;
+    bool best_is_invariant = false;
+    Index index = 0;
+    for (auto it = begin; it != end; ++it, ++index) {
+      // r: comparison of `configuration` with `copy_apply(*it, configuration)`
+      int r = 0;
+      bool repeated = false;
+      if (global_dof_only) {
+        r = result[it->supercell_factor_group_index()];
+        repeated = (r != 0);
+      }
+      if (r == 0) {
+        r = equal_to_f(*it) ? 1 : (equal_to_f.is_less() ? 2 : 3);
+        if (global_dof_only) {
+          result[it->supercell_factor_group_index()] = r;
+        }
+      }
+      if (r == 1) {
+        info.invariant_subgroup_indices.push_back(index);
+      } else if (r == 2) {
+        info.is_canonical = false;
+      }
+
+      // update the first operation giving the greatest configuration
+      if (!best.has_value()) {
+        best = *it;
+        best_is_invariant = (r == 1);
+        continue;
+      }
+      if (repeated) {
+        continue;
+      }
+      bool is_greater = best_is_invariant
+                            ? (r == 2)
+                            : (!equal_to_f(*best, *it) && equal_to_f.is_less());
+      if (is_greater) {
+        best = *it;
+        info.to_canonical_index = index;
+        best_is_invariant = false;
+      }
+    }
+    return info;
+  });
 }
 
 /// \brief Return the distinct symmetrically equivalent configurations
@@ -210,13 +773,21 @@ std::vector<SupercellSymOp> make_invariant_subgroup(
 ///   infinite crystals and fit in the supercell, if configuration
 ///   is not primitive. To generate all equivalents as infinite
 ///   crystals, use `make_all_super_configurations`.
+/// - If the configuration has only global DoF, only the first operation
+///   with each supercell factor group index is applied.
 template <typename SupercellSymOpIt>
 std::vector<Configuration> make_equivalents(Configuration const &configuration,
                                             SupercellSymOpIt begin,
                                             SupercellSymOpIt end) {
   std::set<Configuration> equivalents;
+  SupercellSymOpApplier applier;
+  bool global_dof_only = is_global_dof_only_comparison(configuration);
+  canonical_form_impl::FactorGroupIndexSet visited(configuration);
   for (auto it = begin; it != end; ++it) {
-    equivalents.emplace(copy_apply(*it, configuration));
+    if (global_dof_only && !visited.insert(*it)) {
+      continue;
+    }
+    equivalents.emplace(applier.copy_apply(*it, configuration));
   }
   return std::vector<Configuration>(equivalents.begin(), equivalents.end());
 }
@@ -246,8 +817,14 @@ std::vector<ConfigurationWithProperties> make_equivalents(
   };
   std::set<std::pair<Configuration, SupercellSymOp>, decltype(compare)>
       equivalents(compare);
+  SupercellSymOpApplier applier;
+  bool global_dof_only = is_global_dof_only_comparison(configuration);
+  canonical_form_impl::FactorGroupIndexSet visited(configuration);
   for (auto it = begin; it != end; ++it) {
-    equivalents.emplace(copy_apply(*it, configuration), *it);
+    if (global_dof_only && !visited.insert(*it)) {
+      continue;
+    }
+    equivalents.emplace(applier.copy_apply(*it, configuration), *it);
   }
 
   std::vector<ConfigurationWithProperties> equivalents_with_properties;
@@ -256,7 +833,7 @@ std::vector<ConfigurationWithProperties> make_equivalents(
   }
   for (auto const &pair : equivalents) {
     equivalents_with_properties.push_back(
-        copy_apply(pair.second, configuration_with_properties));
+        applier.copy_apply(pair.second, configuration_with_properties));
   }
   return equivalents_with_properties;
 }
@@ -289,7 +866,17 @@ std::vector<std::vector<SupercellSymOp>> make_equivalence_map(
   equivalence_map.resize(equivalents.size());
   auto equiv_begin = equivalents.begin();
   auto equiv_end = equivalents.end();
+
+  // if only global DoF, the result depends only on the factor group index
+  bool global_dof_only = is_global_dof_only_comparison(*equiv_begin);
+  std::vector<Index> factor_group_d(
+      equiv_begin->supercell->sym_info.factor_group->element.size(), -1);
   for (auto symop_it = begin; symop_it != end; ++symop_it) {
+    Index &cached_d = factor_group_d[symop_it->supercell_factor_group_index()];
+    if (global_dof_only && cached_d != -1) {
+      equivalence_map[cached_d].push_back(*symop_it);
+      continue;
+    }
     auto equiv = copy_apply_f(*symop_it, *equiv_begin);
     Index d = 0;
     auto equiv_it = equiv_begin;
@@ -300,6 +887,7 @@ std::vector<std::vector<SupercellSymOp>> make_equivalence_map(
     if (equiv_it == equiv_end) {
       throw std::runtime_error("Error in make_equivalence_map: failed");
     }
+    cached_d = d;
     equivalence_map[d].push_back(*symop_it);
   }
   return equivalence_map;
@@ -336,7 +924,18 @@ std::vector<std::vector<SupercellSymOp>> make_equivalence_map(
   equivalence_map.resize(equivalents_with_properties.size());
   auto equiv_begin = equivalents_with_properties.begin();
   auto equiv_end = equivalents_with_properties.end();
+
+  // if only global DoF, the result depends only on the factor group index
+  Configuration const &first = equiv_begin->configuration;
+  bool global_dof_only = is_global_dof_only_comparison(first);
+  std::vector<Index> factor_group_d(
+      first.supercell->sym_info.factor_group->element.size(), -1);
   for (auto symop_it = begin; symop_it != end; ++symop_it) {
+    Index &cached_d = factor_group_d[symop_it->supercell_factor_group_index()];
+    if (global_dof_only && cached_d != -1) {
+      equivalence_map[cached_d].push_back(*symop_it);
+      continue;
+    }
     auto equiv = copy_apply_f(*symop_it, *equiv_begin);
     Index d = 0;
     auto equiv_it = equiv_begin;
@@ -349,6 +948,7 @@ std::vector<std::vector<SupercellSymOp>> make_equivalence_map(
       throw std::runtime_error(
           "Error in make_equivalence_map (with properties): failed");
     }
+    cached_d = d;
     equivalence_map[d].push_back(*symop_it);
   }
   return equivalence_map;
@@ -37,6 +37,22 @@ class ClusterInvariants {
                     IntegralCluster const &phenomenal,
                     xtal::BasicStructure const &basicstructure);
 
+  /// \brief Construct cluster invariants of a cluster extended by one site,
+  ///     from the invariants of the cluster
+  ClusterInvariants(ClusterInvariants const &parent,
+                    IntegralCluster const &parent_cluster,
+                    xtal::UnitCellCoord const &site,
+                    xtal::BasicStructure const &basicstructure);
+
+  /// \brief Construct cluster invariants of a cluster extended by one site,
+  ///     from the invariants of the cluster, including phenomenal cluster
+  ///     sites
+  ClusterInvariants(ClusterInvariants const &parent,
+                    IntegralCluster const &parent_cluster,
+                    xtal::UnitCellCoord const &site,
+                    IntegralCluster const &phenomenal,
+                    xtal::BasicStructure const &basicstructure);
+
   /// \brief Number of elements in the cluster
   int size() const;
 
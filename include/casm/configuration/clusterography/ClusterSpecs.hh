@@ -43,6 +43,10 @@ bool alloy_sites_filter(const xtal::Site &site);
 /// \brief Generate clusters using Site with specified DoF
 SiteFilterFunction dof_sites_filter(const std::vector<DoFKey> &dofs = {});
 
+/// \brief Evaluate a site filter once for each prim sublattice
+SiteFilterMask make_site_filter_mask(xtal::BasicStructure const &prim,
+                                     SiteFilterFunction const &site_filter);
+
 /// Accept all clusters
 ClusterFilterFunction all_clusters_filter();
 
@@ -64,6 +68,12 @@ CandidateSitesFunction cutoff_radius_neighborhood(
     IntegralCluster const &phenomenal, double cutoff_radius,
     bool include_phenomenal_sites = false);
 
+/// Sites within cutoff_radius distance to any site in the phenomenal cluster,
+/// using an existing PrimNeighborIndex
+std::vector<xtal::UnitCellCoord> make_cutoff_radius_neighborhood(
+    PrimNeighborIndex const &neighbor_index, IntegralCluster const &phenomenal,
+    double cutoff_radius, bool include_phenomenal_sites = false);
+
 }  // namespace clust
 }  // namespace CASM
 
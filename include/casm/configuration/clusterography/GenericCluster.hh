@@ -29,10 +29,12 @@ namespace clust {
 /// To implement this, there must be a traits class for the particular derived
 /// type of cluster with the following members:
 /// - typename traits<MostDerived>::Element
+/// - typename traits<MostDerived>::ElementContainer, a vector-like container
+///   of Element, such as `std::vector<Element>` or `SmallVector<Element, N>`
 ///
 /// The derived cluster type must implement public methods:
-/// - std::vector<Element>& MostDerived::elements();
-/// - const std::vector<Element>& MostDerived::elements() const;
+/// - ElementContainer& MostDerived::elements();
+/// - const ElementContainer& MostDerived::elements() const;
 ///
 /// Optionally, the derived cluster type may specialize protected methods:
 /// - MostDerived& sort_impl();
@@ -51,11 +53,12 @@ class GenericCluster : public Comparisons<Base> {
   using Base::derived;
 
   typedef typename traits<MostDerived>::Element Element;
+  typedef typename traits<MostDerived>::ElementContainer ElementContainer;
   typedef Index size_type;
 
-  typedef typename std::vector<Element>::value_type value_type;
-  typedef typename std::vector<Element>::iterator iterator;
-  typedef typename std::vector<Element>::const_iterator const_iterator;
+  typedef typename ElementContainer::value_type value_type;
+  typedef typename ElementContainer::iterator iterator;
+  typedef typename ElementContainer::const_iterator const_iterator;
 
   /// \brief Iterator to first element in the cluster
   iterator begin() { return derived().elements().begin(); }
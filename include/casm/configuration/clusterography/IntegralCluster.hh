@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "casm/configuration/clusterography/GenericCluster.hh"
+#include "casm/configuration/clusterography/SmallVector.hh"
 #include "casm/crystallography/UnitCellCoord.hh"
 #include "casm/global/definitions.hh"
 
@@ -37,6 +38,10 @@ class IntegralCluster;
 template <>
 struct traits<clust::IntegralCluster> {
   typedef xtal::UnitCellCoord Element;
+
+  /// Clusters of up to 6 sites are stored inline, so copying them, as when
+  /// generating orbits, does not allocate
+  typedef clust::SmallVector<xtal::UnitCellCoord, 6> ElementContainer;
   // typedef Index size_type;
   // static const std::string name;
 };
@@ -48,6 +53,7 @@ class IntegralCluster
  public:
   typedef xtal::Translatable<GenericCluster<CRTPBase<IntegralCluster>>> Base;
   using Base::Element;
+  using Base::ElementContainer;
   using Base::size_type;
 
   explicit IntegralCluster();
@@ -62,10 +68,10 @@ class IntegralCluster
   IntegralCluster(Iterator begin, Iterator end);
 
   /// \brief Access vector of elements
-  std::vector<Element> &elements();
+  ElementContainer &elements();
 
   /// \brief const Access vector of elements
-  const std::vector<Element> &elements() const;
+  const ElementContainer &elements() const;
 
   /// \brief Translate the cluster by a UnitCell translation
   IntegralCluster &operator+=(xtal::UnitCell trans);
@@ -74,7 +80,7 @@ class IntegralCluster
   friend GenericCluster<CRTPBase<IntegralCluster>>;
 
  private:
-  std::vector<xtal::UnitCellCoord> m_element;
+  ElementContainer m_element;
 };
 
 /// \brief Apply symmetry to IntegralCluster
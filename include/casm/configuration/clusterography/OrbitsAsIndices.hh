@@ -0,0 +1,143 @@
+#ifndef CASM_clust_OrbitsAsIndices
+#define CASM_clust_OrbitsAsIndices
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "casm/configuration/clusterography/definitions.hh"
+
+namespace CASM {
+namespace clust {
+
+/// \brief Orbits of clusters, as linear site indices in a supercell, stored
+///     in flat arrays
+///
+/// Layout (compressed sparse row):
+/// - Cluster `j` is the sites `sites[cluster_offset[j]]` through
+///   `sites[cluster_offset[j+1] - 1]`, sorted and without duplicates.
+/// - Orbit `i` is the clusters `orbit_offset[i]` through
+///   `orbit_offset[i+1] - 1`, sorted lexicographically and without
+///   duplicates.
+///
+/// This holds the same data, in the same order, as the
+/// `std::vector<std::set<std::set<Index>>>` returned by
+/// `make_orbits_as_indices`, using three contiguous arrays.
+struct OrbitsAsIndices {
+  /// \brief Size `n_orbits() + 1`, index into clusters of the first
+  ///     cluster in each orbit
+  std::vector<Index> orbit_offset = {0};
+
+  /// \brief Size `n_clusters() + 1`, index into `sites` of the first site
+  ///     in each cluster
+  std::vector<Index> cluster_offset = {0};
+
+  /// \brief Linear site indices of all clusters
+  std::vector<Index> sites;
+
+  /// \brief Number of orbits
+  Index n_orbits() const { return orbit_offset.size() - 1; }
+
+  /// \brief Number of clusters, in all orbits
+  Index n_clusters() const { return cluster_offset.size() - 1; }
+
+  /// \brief Pointer to the first site of cluster `j`
+  Index const *cluster_begin(Index j) const {
+    return sites.data() + cluster_offset[j];
+  }
+
+  /// \brief Pointer past the last site of cluster `j`
+  Index const *cluster_end(Index j) const {
+    return sites.data() + cluster_offset[j + 1];
+  }
+
+  /// \brief Number of sites in cluster `j`
+  Index cluster_size(Index j) const {
+    return cluster_offset[j + 1] - cluster_offset[j];
+  }
+};
+
+/// \brief Local-cluster orbits around every translation of every
+///     equivalent phenomenal cluster, as linear site indices in a supercell,
+///     stored in flat arrays
+///
+/// Layout:
+/// - The clusters around one translated equivalent phenomenal cluster make
+///   one row of `n_cluster_sites()` sites. Rows are stored row-major, so
+///   `sites` can be wrapped as an array of shape
+///   `(n_equivalents, n_translations, n_cluster_sites())` without copying.
+/// - Cluster `j` is the sites `cluster_offset[j]` through
+///   `cluster_offset[j+1] - 1` of each row, and orbit `i` is the clusters
+///   `orbit_offset[i]` through `orbit_offset[i+1] - 1`. The offsets are
+///   the same for all rows.
+/// - The clusters around equivalent `e` are `translation_e * op_e *
+///   cluster` for the clusters around the prototype, in the same order and
+///   with sites in the same order, so cluster `j` of each row corresponds
+///   to cluster `j` around the prototype. Translations are in the order of
+///   the supercell's xtal::UnitCellIndexConverter.
+struct LocalOrbitsAsIndices {
+  /// \brief Number of equivalent phenomenal clusters
+  Index n_equivalents = 0;
+
+  /// \brief Number of translations, which is the supercell volume
+  Index n_translations = 0;
+
+  /// \brief Size `n_orbits() + 1`, index of the first cluster in each orbit
+  std::vector<Index> orbit_offset = {0};
+
+  /// \brief Size `n_clusters() + 1`, index in each row of the first site in
+  ///     each cluster
+  std::vector<Index> cluster_offset = {0};
+
+  /// \brief Linear supercell site index of site `s` of cluster `j` around
+  ///     equivalent `e` translated by unit cell `l`, at
+  ///     `sites[(e * n_translations + l) * n_cluster_sites() +
+  ///     cluster_offset[j] + s]`
+  std::vector<std::int32_t> sites;
+
+  /// \brief Number of orbits
+  Index n_orbits() const { return orbit_offset.size() - 1; }
+
+  /// \brief Number of clusters, in all orbits, in each row
+  Index n_clusters() const { return cluster_offset.size() - 1; }
+
+  /// \brief Number of sites, in all clusters, in each row
+  Index n_cluster_sites() const { return cluster_offset.back(); }
+
+  /// \brief Pointer to the first site of the row for equivalent `e`
+  ///     translated by unit cell `l`
+  std::int32_t const *row(Index e, Index l) const {
+    return sites.data() + (e * n_translations + l) * n_cluster_sites();
+  }
+};
+
+/// \brief Convert orbits of IntegralCluster to flat orbits of linear site
+///     indices in a supercell
+OrbitsAsIndices make_flat_orbits_as_indices(
+    std::vector<std::set<IntegralCluster>> const &orbits,
+    xtal::UnitCellCoordIndexConverter const &converter);
+
+/// \brief Convert orbits of linear site indices to the flat representation
+OrbitsAsIndices make_flat_orbits_as_indices(
+    std::vector<std::set<std::set<Index>>> const &orbits_as_indices);
+
+/// \brief Convert local-cluster orbits to flat tables of linear site
+///     indices for every translation of every equivalent phenomenal cluster
+///     in a supercell
+LocalOrbitsAsIndices make_flat_local_orbits_as_indices(
+    std::vector<std::set<IntegralCluster>> const &local_orbits,
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    std::vector<Index> const &equivalent_generating_op_indices,
+    std::vector<xtal::UnitCell> const &phenomenal_generating_translations,
+    xtal::UnitCellCoordIndexConverter const &site_converter,
+    xtal::UnitCellIndexConverter const &unitcell_converter,
+    Index n_threads = 1);
+
+/// \brief Convert flat orbits of linear site indices to nested sets
+std::vector<std::set<std::set<Index>>> make_nested_orbits_as_indices(
+    OrbitsAsIndices const &orbits_as_indices);
+
+}  // namespace clust
+}  // namespace CASM
+
+#endif
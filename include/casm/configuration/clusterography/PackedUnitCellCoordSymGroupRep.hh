@@ -0,0 +1,118 @@
+#ifndef CASM_clust_PackedUnitCellCoordSymGroupRep
+#define CASM_clust_PackedUnitCellCoordSymGroupRep
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "casm/configuration/clusterography/definitions.hh"
+
+namespace CASM {
+namespace clust {
+
+class IntegralCluster;
+
+/// \brief The images of one cluster under all operations of a
+///     PackedUnitCellCoordSymGroupRep, in struct-of-arrays layout
+///
+/// Site `s` of image `m` is `xtal::UnitCellCoord(b[x], i[x], j[x], k[x])`,
+/// where `x = m * n_sites + s`.
+struct PackedClusterImages {
+  /// \brief Number of images, one per operation
+  Index n_images = 0;
+
+  /// \brief Number of sites in each image
+  Index n_sites = 0;
+
+  std::vector<std::int32_t> b;
+  std::vector<std::int32_t> i;
+  std::vector<std::int32_t> j;
+  std::vector<std::int32_t> k;
+};
+
+/// \brief Applies all operations of a UnitCellCoordRep symmetry group
+///     representation to one cluster at once
+///
+/// Method:
+/// - The integer point matrices, sublattice maps, and unit cell
+///   translations of all operations are packed into contiguous int32
+///   arrays at construction.
+/// - A cluster is transformed by every operation in one pass, writing the
+///   images in struct-of-arrays layout (`PackedClusterImages`), without
+///   constructing an IntegralCluster per operation.
+/// - The sites of each image are sorted with a sorting network for clusters
+///   of up to 6 sites, and with `std::sort` otherwise. Sites are ordered as
+///   `xtal::UnitCellCoord`: by unit cell indices, lexicographically, and
+///   then by sublattice index.
+/// - Results are the same as `make_canonical_element` and
+///   `make_equivalence_map` using `prim_periodic_integral_cluster_apply` or
+///   `local_integral_cluster_apply`.
+class PackedUnitCellCoordSymGroupRep {
+ public:
+  /// \brief Constructor
+  explicit PackedUnitCellCoordSymGroupRep(
+      std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep);
+
+  /// \brief Number of operations
+  Index size() const { return m_n_ops; }
+
+  /// \brief Number of sublattices
+  Index n_sublat() const { return m_n_sublat; }
+
+  /// \brief Write the images of a cluster under all operations, sorted and
+  ///     translated so the first site is in the origin unit cell
+  void make_prim_periodic_images(IntegralCluster const &cluster,
+                                 PackedClusterImages &images) const;
+
+  /// \brief Write the images of a cluster under all operations, sorted
+  void make_local_images(IntegralCluster const &cluster,
+                         PackedClusterImages &images) const;
+
+  /// \brief Return the greatest prim periodic image of a cluster
+  IntegralCluster make_prim_periodic_canonical_element(
+      IntegralCluster const &cluster) const;
+
+  /// \brief Return the greatest local image of a cluster
+  IntegralCluster make_local_canonical_element(
+      IntegralCluster const &cluster) const;
+
+  /// \brief Make the equivalence map of a prim periodic orbit
+  std::vector<std::vector<Index>> make_prim_periodic_equivalence_map(
+      std::set<IntegralCluster> const &orbit) const;
+
+  /// \brief Make the equivalence map of a local orbit
+  std::vector<std::vector<Index>> make_local_equivalence_map(
+      std::set<IntegralCluster> const &orbit) const;
+
+ private:
+  void _make_images(IntegralCluster const &cluster, bool translate_to_origin,
+                    PackedClusterImages &images) const;
+
+  Index _find_greatest(PackedClusterImages const &images) const;
+
+  std::vector<std::vector<Index>> _make_equivalence_map(
+      std::set<IntegralCluster> const &orbit,
+      PackedClusterImages const &images) const;
+
+  Index m_n_ops;
+
+  Index m_n_sublat;
+
+  /// \brief Point matrices, row-major, 9 values per operation
+  std::vector<std::int32_t> m_point_matrix;
+
+  /// \brief Sublattice maps, `n_sublat` values per operation
+  std::vector<std::int32_t> m_sublattice_index;
+
+  /// \brief Unit cell translations, 3 values per sublattice per operation
+  std::vector<std::int32_t> m_unitcell_indices;
+};
+
+/// \brief Return the image of a cluster by index
+IntegralCluster make_cluster(PackedClusterImages const &images,
+                             Index image_index);
+
+}  // namespace clust
+}  // namespace CASM
+
+#endif
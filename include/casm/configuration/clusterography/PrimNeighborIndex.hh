@@ -0,0 +1,103 @@
+#ifndef CASM_clust_PrimNeighborIndex
+#define CASM_clust_PrimNeighborIndex
+
+#include <optional>
+#include <vector>
+
+#include "casm/configuration/clusterography/definitions.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+
+namespace CASM {
+namespace clust {
+
+class IntegralCluster;
+
+/// \brief Finds the sites of a prim that are within a distance of other sites
+///
+/// Method:
+/// - By prim periodic translation symmetry, the sites within a distance of
+///   `xtal::UnitCellCoord(b, i, j, k)` are the sites within that distance of
+///   `xtal::UnitCellCoord(b, 0, 0, 0)`, translated by `(i, j, k)`.
+/// - At construction, the neighbors of each sublattice, which are the sites
+///   accepted by `site_filter` within `max_radius` of the site in the origin
+///   unit cell, are found once by scanning the lattice points that could
+///   contain them. `site_filter` is evaluated once per sublattice, as a
+///   SiteFilterMask. They are stored sorted by distance, so the neighbors
+///   within any `radius <= max_radius` are a prefix of the list.
+/// - A second copy, sorted by site, allows finding the distance between any
+///   two sites by binary search.
+///
+/// Distances are compared using `distance < radius`, so sites at exactly
+/// `radius` are not included. All query results are sorted by
+/// `xtal::UnitCellCoord`.
+class PrimNeighborIndex {
+ public:
+  /// \brief A site and its distance from the site the neighbor list is for
+  struct Neighbor {
+    Neighbor(xtal::UnitCellCoord const &_site, double _distance)
+        : site(_site), distance(_distance) {}
+
+    xtal::UnitCellCoord site;
+    double distance;
+  };
+
+  /// \brief Constructor
+  PrimNeighborIndex(xtal::BasicStructure const &prim, double _max_radius,
+                    SiteFilterFunction site_filter);
+
+  /// \brief Constructor, using a site filter evaluated for each sublattice
+  PrimNeighborIndex(xtal::BasicStructure const &prim, double _max_radius,
+                    SiteFilterMask const &site_filter_mask);
+
+  /// \brief The maximum radius which may be queried
+  double max_radius() const;
+
+  /// \brief Number of sublattices
+  Index n_sublattices() const;
+
+  /// \brief Neighbors of `xtal::UnitCellCoord(b, 0, 0, 0)`, sorted by
+  ///     distance
+  std::vector<Neighbor> const &neighbors(Index b) const;
+
+  /// \brief Return the distance between two sites, if `site_b` is a
+  ///     neighbor of `site_a`
+  std::optional<double> distance(xtal::UnitCellCoord const &site_a,
+                                 xtal::UnitCellCoord const &site_b) const;
+
+  /// \brief Return the sites within `radius` of `site`
+  std::vector<xtal::UnitCellCoord> sites_within(
+      xtal::UnitCellCoord const &site, double radius) const;
+
+  /// \brief Return the sites within `radius` of any site in `sites`
+  std::vector<xtal::UnitCellCoord> sites_within_any(
+      std::vector<xtal::UnitCellCoord> const &sites, double radius) const;
+
+  /// \brief Return the sites within `radius` of any site in `cluster`
+  std::vector<xtal::UnitCellCoord> sites_within_any(
+      IntegralCluster const &cluster, double radius) const;
+
+  /// \brief Return the sites within `radius` of every site in `cluster`
+  std::vector<xtal::UnitCellCoord> sites_within_all(
+      IntegralCluster const &cluster, double radius) const;
+
+ private:
+  void _throw_if_invalid_radius(double radius) const;
+
+  /// \brief Return the end of the prefix of `neighbors(b)` within `radius`
+  std::vector<Neighbor>::const_iterator _end_within(Index b,
+                                                    double radius) const;
+
+  double m_max_radius;
+
+  /// \brief m_neighbors[b]: neighbors of sublattice b, sorted by distance
+  std::vector<std::vector<Neighbor>> m_neighbors;
+
+  /// \brief m_neighbors_by_site[b]: neighbors of sublattice b, sorted by
+  ///     site
+  std::vector<std::vector<Neighbor>> m_neighbors_by_site;
+};
+
+}  // namespace clust
+}  // namespace CASM
+
+#endif
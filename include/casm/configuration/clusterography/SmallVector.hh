@@ -0,0 +1,302 @@
+#ifndef CASM_clust_SmallVector
+#define CASM_clust_SmallVector
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CASM {
+namespace clust {
+
+/// \brief A vector that stores up to `N` elements inline, without heap
+///     allocation
+///
+/// Notes:
+/// - Has the subset of the `std::vector` interface used for cluster
+///   elements. Iterators are pointers.
+/// - While `size() <= N`, elements are stored in the object itself, so
+///   copying a small cluster does not allocate. Larger sizes use heap
+///   storage, as `std::vector`.
+/// - As for `std::vector`, iterators, pointers, and references are
+///   invalidated by operations that change the capacity. Moving a
+///   SmallVector that uses inline storage moves its elements.
+/// - Converts implicitly to `std::vector<T>`, and compares
+///   lexicographically, as `std::vector<T>`.
+template <typename T, std::size_t N>
+class SmallVector {
+ public:
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T &reference;
+  typedef T const &const_reference;
+  typedef T *pointer;
+  typedef T const *const_pointer;
+  typedef T *iterator;
+  typedef T const *const_iterator;
+  typedef std::reverse_iterator<iterator> reverse_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  SmallVector() noexcept : m_data(_inline()), m_size(0), m_capacity(N) {}
+
+  SmallVector(std::initializer_list<T> values) : SmallVector() {
+    _append(values.begin(), values.end());
+  }
+
+  template <typename Iterator,
+            typename = typename std::iterator_traits<Iterator>::value_type>
+  SmallVector(Iterator begin, Iterator end) : SmallVector() {
+    _append(begin, end);
+  }
+
+  SmallVector(std::vector<T> const &values) : SmallVector() {
+    _append(values.begin(), values.end());
+  }
+
+  SmallVector(SmallVector const &other) : SmallVector() {
+    _append(other.begin(), other.end());
+  }
+
+  SmallVector(SmallVector &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value)
+      : SmallVector() {
+    _steal(other);
+  }
+
+  ~SmallVector() {
+    clear();
+    _deallocate();
+  }
+
+  SmallVector &operator=(SmallVector const &other) {
+    if (this != &other) {
+      clear();
+      _append(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  SmallVector &operator=(SmallVector &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+      clear();
+      _deallocate();
+      _steal(other);
+    }
+    return *this;
+  }
+
+  SmallVector &operator=(std::initializer_list<T> values) {
+    clear();
+    _append(values.begin(), values.end());
+    return *this;
+  }
+
+  /// \brief Copy into a std::vector
+  operator std::vector<T>() const { return std::vector<T>(begin(), end()); }
+
+  iterator begin() noexcept { return m_data; }
+  const_iterator begin() const noexcept { return m_data; }
+  const_iterator cbegin() const noexcept { return m_data; }
+  iterator end() noexcept { return m_data + m_size; }
+  const_iterator end() const noexcept { return m_data + m_size; }
+  const_iterator cend() const noexcept { return m_data + m_size; }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator(end());
+  }
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator(begin());
+  }
+
+  size_type size() const noexcept { return m_size; }
+  bool empty() const noexcept { return m_size == 0; }
+  size_type capacity() const noexcept { return m_capacity; }
+
+  /// \brief True if elements are stored inline
+  bool is_inline() const noexcept { return m_data == _inline(); }
+
+  T *data() noexcept { return m_data; }
+  T const *data() const noexcept { return m_data; }
+
+  reference operator[](size_type i) { return m_data[i]; }
+  const_reference operator[](size_type i) const { return m_data[i]; }
+
+  reference at(size_type i) {
+    if (i >= m_size) {
+      throw std::out_of_range("Error in SmallVector::at: out of range");
+    }
+    return m_data[i];
+  }
+  const_reference at(size_type i) const {
+    if (i >= m_size) {
+      throw std::out_of_range("Error in SmallVector::at: out of range");
+    }
+    return m_data[i];
+  }
+
+  reference front() { return m_data[0]; }
+  const_reference front() const { return m_data[0]; }
+  reference back() { return m_data[m_size - 1]; }
+  const_reference back() const { return m_data[m_size - 1]; }
+
+  void reserve(size_type n) {
+    if (n > m_capacity) {
+      _reallocate(n);
+    }
+  }
+
+  void clear() noexcept {
+    std::destroy(begin(), end());
+    m_size = 0;
+  }
+
+  void push_back(T const &value) { emplace_back(value); }
+
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (m_size == m_capacity) {
+      // construct first, in case args refer to an element
+      T value(std::forward<Args>(args)...);
+      _reallocate(2 * m_capacity + 1);
+      ::new (static_cast<void *>(m_data + m_size)) T(std::move(value));
+    } else {
+      ::new (static_cast<void *>(m_data + m_size))
+          T(std::forward<Args>(args)...);
+    }
+    ++m_size;
+    return back();
+  }
+
+  void pop_back() {
+    --m_size;
+    std::destroy_at(m_data + m_size);
+  }
+
+  void resize(size_type n) {
+    if (n < m_size) {
+      std::destroy(begin() + n, end());
+      m_size = n;
+      return;
+    }
+    reserve(n);
+    for (; m_size < n; ++m_size) {
+      ::new (static_cast<void *>(m_data + m_size)) T();
+    }
+  }
+
+  iterator insert(const_iterator pos, T const &value) {
+    size_type i = pos - begin();
+    push_back(value);
+    std::rotate(begin() + i, end() - 1, end());
+    return begin() + i;
+  }
+
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type i = first - begin();
+    size_type n = last - first;
+    std::move(begin() + i + n, end(), begin() + i);
+    std::destroy(end() - n, end());
+    m_size -= n;
+    return begin() + i;
+  }
+
+  friend bool operator==(SmallVector const &A, SmallVector const &B) {
+    return A.size() == B.size() && std::equal(A.begin(), A.end(), B.begin());
+  }
+  friend bool operator!=(SmallVector const &A, SmallVector const &B) {
+    return !(A == B);
+  }
+  friend bool operator<(SmallVector const &A, SmallVector const &B) {
+    return std::lexicographical_compare(A.begin(), A.end(), B.begin(),
+                                        B.end());
+  }
+  friend bool operator>(SmallVector const &A, SmallVector const &B) {
+    return B < A;
+  }
+  friend bool operator<=(SmallVector const &A, SmallVector const &B) {
+    return !(B < A);
+  }
+  friend bool operator>=(SmallVector const &A, SmallVector const &B) {
+    return !(A < B);
+  }
+
+ private:
+  T *_inline() noexcept { return reinterpret_cast<T *>(m_inline); }
+  T const *_inline() const noexcept {
+    return reinterpret_cast<T const *>(m_inline);
+  }
+
+  template <typename Iterator>
+  void _append(Iterator begin, Iterator end) {
+    typedef typename std::iterator_traits<Iterator>::iterator_category
+        category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+      reserve(m_size + std::distance(begin, end));
+    }
+    for (; begin != end; ++begin) {
+      emplace_back(*begin);
+    }
+  }
+
+  /// Move elements to new storage with capacity n >= m_size
+  void _reallocate(size_type n) {
+    T *new_data = std::allocator<T>().allocate(n);
+    std::uninitialized_move(begin(), end(), new_data);
+    std::destroy(begin(), end());
+    _deallocate();
+    m_data = new_data;
+    m_capacity = n;
+  }
+
+  /// Free heap storage, if any, and use inline storage; elements must
+  /// already be destroyed
+  void _deallocate() noexcept {
+    if (!is_inline()) {
+      std::allocator<T>().deallocate(m_data, m_capacity);
+    }
+    m_data = _inline();
+    m_capacity = N;
+  }
+
+  /// Take the elements of other; this must be empty and inline
+  void _steal(SmallVector &other) {
+    if (other.is_inline()) {
+      std::uninitialized_move(other.begin(), other.end(), m_data);
+      m_size = other.m_size;
+      other.clear();
+    } else {
+      m_data = other.m_data;
+      m_size = other.m_size;
+      m_capacity = other.m_capacity;
+      other.m_data = other._inline();
+      other.m_size = 0;
+      other.m_capacity = N;
+    }
+  }
+
+  alignas(T) unsigned char m_inline[N * sizeof(T)];
+
+  T *m_data;
+
+  size_type m_size;
+
+  size_type m_capacity;
+};
+
+}  // namespace clust
+}  // namespace CASM
+
+#endif
@@ -1,6 +1,10 @@
 #ifndef CASM_clust_SubClusterCounter
 #define CASM_clust_SubClusterCounter
 
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+
 #include "casm/configuration/clusterography/IntegralCluster.hh"
 #include "casm/container/Counter.hh"
 
@@ -57,6 +61,135 @@ class SubClusterCounter {
   Counter<std::vector<int> > m_site_counter;
 };
 
+/// \brief A subcluster, as a bitmask of site indices in the cluster it is a
+///     subcluster of
+///
+/// Bit `i` is set if site `i` of the cluster is included.
+typedef std::uint64_t SubClusterMask;
+
+/// \brief Make the subcluster of `cluster` given by `mask`, writing the
+///     result into an existing cluster
+inline void make_subcluster(IntegralCluster &result,
+                            IntegralCluster const &cluster,
+                            SubClusterMask mask) {
+  result.elements().clear();
+  for (Index i = 0; mask; ++i, mask >>= 1) {
+    if (mask & 1) {
+      result.elements().push_back(cluster.element(i));
+    }
+  }
+}
+
+/// \brief Make the subcluster of `cluster` given by `mask`
+inline IntegralCluster make_subcluster(IntegralCluster const &cluster,
+                                       SubClusterMask mask) {
+  IntegralCluster result;
+  make_subcluster(result, cluster, mask);
+  return result;
+}
+
+/// \brief Generates subclusters of a cluster, as bitmasks
+///
+/// - Includes the null cluster (mask 0) and the original cluster
+/// - Subclusters are generated in the same order as SubClusterCounter, which
+///   is increasing mask value
+/// - Does not build an IntegralCluster unless `materialize` is called
+/// - Clusters may have at most 64 sites
+///
+class SubClusterMaskCounter {
+ public:
+  /// \brief Construct with the cluster to find subclusters of
+  explicit SubClusterMaskCounter(IntegralCluster const &cluster)
+      : m_cluster(cluster), m_mask(0), m_valid(true), m_is_materialized(false) {
+    if (m_cluster.size() > 64) {
+      throw std::runtime_error(
+          "Error in SubClusterMaskCounter: cluster size > 64");
+    }
+    m_last = ~SubClusterMask(0) >> (64 - m_cluster.size());
+    if (m_cluster.size() == 0) {
+      m_last = 0;
+    }
+  }
+
+  /// \brief Generate the next subcluster (if valid)
+  void next() {
+    if (m_mask == m_last) {
+      m_valid = false;
+    } else {
+      ++m_mask;
+    }
+    m_is_materialized = false;
+  }
+
+  /// \brief The current subcluster, as a bitmask of site indices
+  SubClusterMask mask() const { return m_mask; }
+
+  bool valid() const { return m_valid; }
+
+  /// \brief The current subcluster, built on first access
+  IntegralCluster const &materialize() {
+    if (!m_is_materialized) {
+      make_subcluster(m_current, m_cluster, m_mask);
+      m_is_materialized = true;
+    }
+    return m_current;
+  }
+
+  /// \brief The cluster subclusters are found of
+  IntegralCluster const &cluster() const { return m_cluster; }
+
+ private:
+  /// the cluster we're finding subclusters of
+  IntegralCluster m_cluster;
+
+  /// The current subcluster
+  SubClusterMask m_mask;
+
+  /// The mask including all sites
+  SubClusterMask m_last;
+
+  bool m_valid;
+
+  /// The current subcluster, if m_is_materialized
+  IntegralCluster m_current;
+
+  bool m_is_materialized;
+};
+
+/// \brief Finds the orbits that contain subclusters of a cluster
+///
+/// Method:
+/// - At construction, each cluster in the orbits is stored in a lookup
+///   table, with the index of its orbit.
+/// - For periodic orbits, clusters are looked up in the form used by
+///   `make_prim_periodic_orbit`: sorted, then translated so the first site is
+///   in the origin unit cell. For local orbits, they are looked up as is,
+///   after sorting.
+/// - Subclusters of a sorted cluster, taken in site order, are already
+///   sorted, so `subcluster_orbit_indices` only translates them.
+class SubClusterOrbitIndex {
+ public:
+  /// \brief Constructor
+  SubClusterOrbitIndex(std::vector<std::set<IntegralCluster>> const &orbits,
+                       bool periodic);
+
+  /// \brief Return the index of the orbit containing `cluster`, or -1
+  Index orbit_index(IntegralCluster cluster) const;
+
+  /// \brief Return the orbit index of each subcluster of `cluster`, indexed
+  ///     by SubClusterMask
+  std::vector<Index> subcluster_orbit_indices(
+      IntegralCluster const &cluster) const;
+
+ private:
+  /// \brief Return the orbit index of a sorted cluster, or -1
+  Index _orbit_index_of_sorted(IntegralCluster &cluster) const;
+
+  bool m_periodic;
+
+  std::map<IntegralCluster, Index> m_orbit_index;
+};
+
 }  // namespace clust
 }  // namespace CASM
 
@@ -0,0 +1,71 @@
+#ifndef CASM_clust_SupercellImpactTable
+#define CASM_clust_SupercellImpactTable
+
+#include <set>
+#include <vector>
+
+#include "casm/configuration/clusterography/definitions.hh"
+
+namespace CASM {
+namespace clust {
+
+/// \brief Impact neighborhoods, as linear site indices in a supercell,
+///     stored in flat arrays
+///
+/// Layout (compressed sparse row):
+/// - Row `i` is the sites `sites[row_offset[i]]` through
+///   `sites[row_offset[i+1] - 1]`, sorted and without duplicates.
+/// - For a table made by `make_flower_impact_table`, row `l` holds the
+///   sites impacted by a change at linear site index `l`.
+/// - For a table made by `make_local_impact_table`, row `i` holds the local
+///   neighborhood of the phenomenal cluster translated to the `i`-th unit
+///   cell of the supercell.
+///
+/// Tables are built once per supercell and set of orbits, and then can be
+/// shared, for instance using `std::shared_ptr<SupercellImpactTable const>`,
+/// by all code that needs neighborhoods as linear site indices, instead of
+/// building and converting `std::set<xtal::UnitCellCoord>` on demand.
+struct SupercellImpactTable {
+  /// \brief Size `n_rows() + 1`, index into `sites` of the first site in
+  ///     each row
+  std::vector<Index> row_offset = {0};
+
+  /// \brief Linear site indices of all rows
+  std::vector<Index> sites;
+
+  /// \brief Number of rows
+  Index n_rows() const { return row_offset.size() - 1; }
+
+  /// \brief Pointer to the first site of row `i`
+  Index const *row_begin(Index i) const {
+    return sites.data() + row_offset[i];
+  }
+
+  /// \brief Pointer past the last site of row `i`
+  Index const *row_end(Index i) const {
+    return sites.data() + row_offset[i + 1];
+  }
+
+  /// \brief Number of sites in row `i`
+  Index row_size(Index i) const {
+    return row_offset[i + 1] - row_offset[i];
+  }
+};
+
+/// \brief Make a table of the flower neighborhood of each site in a
+///     supercell
+SupercellImpactTable make_flower_impact_table(
+    std::vector<std::set<IntegralCluster>> const &orbits,
+    xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter);
+
+/// \brief Make a table of the local neighborhood of a phenomenal cluster,
+///     translated to each unit cell in a supercell
+SupercellImpactTable make_local_impact_table(
+    std::vector<std::set<IntegralCluster>> const &local_orbits,
+    xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter,
+    xtal::UnitCellIndexConverter const &unitcell_index_converter);
+
+}  // namespace clust
+}  // namespace CASM
+
+#endif
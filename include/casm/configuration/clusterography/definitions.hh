@@ -20,6 +20,7 @@
 
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace CASM {
 template <typename T>
@@ -33,6 +34,7 @@ class UnitCell;
 class UnitCellCoord;
 struct UnitCellCoordRep;
 class UnitCellCoordIndexConverter;
+class UnitCellIndexConverter;
 }  // namespace xtal
 
 namespace group {
@@ -51,13 +53,19 @@ template <typename Base>
 class GenericCluster;
 class IntegralCluster;
 struct IntegralClusterOrbitGenerator;
+class PrimNeighborIndex;
 
 /// \brief A group::Group of xtal::SymOp
 typedef group::Group<xtal::SymOp> SymGroup;
 
 /// A SiteFilterFunction returns true if a Site should be included and false if
 /// it should be excluded
-typedef std::function<bool(xtal::Site)> SiteFilterFunction;
+typedef std::function<bool(xtal::Site const &)> SiteFilterFunction;
+
+/// A SiteFilterMask holds the value of a SiteFilterFunction for each prim
+/// sublattice, `mask[b]` for `prim.basis()[b]`, so that the filter is
+/// evaluated once per sublattice rather than once per candidate site
+typedef std::vector<bool> SiteFilterMask;
 
 /// A ClusterFilterFunction returns true if an IntegralCluster should be
 /// included and false if it should be excluded
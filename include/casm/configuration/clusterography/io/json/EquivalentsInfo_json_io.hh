@@ -1,7 +1,10 @@
 #ifndef CASM_clust_EquivalentsInfo_json_io
 #define CASM_clust_EquivalentsInfo_json_io
 
+#include <iostream>
+
 #include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/io/json/IntegralCluster_json_io.hh"
 #include "casm/configuration/clusterography/orbits.hh"
 
 namespace CASM {
@@ -14,6 +17,16 @@ class jsonParser;
 jsonParser &to_json(clust::EquivalentsInfo const &equivalents_info,
                     jsonParser &json, xtal::BasicStructure const &prim);
 
+/// \brief Write "equivalents info" to a stream, one equivalent at a time
+void write_equivalents_info_json(
+    std::ostream &out, clust::EquivalentsInfo const &equivalents_info,
+    xtal::BasicStructure const &prim,
+    std::vector<std::vector<std::set<clust::IntegralCluster>>> const
+        *equivalent_orbits = nullptr,
+    clust::ClusterOrbitOutputOptions const &options =
+        clust::ClusterOrbitOutputOptions(),
+    JsonStreamOptions const &stream_options = JsonStreamOptions());
+
 /// \brief Parse minimal clexulator::EquivalentsInfo from JSON
 void parse(InputParser<clust::EquivalentsInfo> &parser,
            xtal::BasicStructure const &prim);
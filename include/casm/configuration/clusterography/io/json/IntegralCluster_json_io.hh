@@ -1,21 +1,38 @@
 #ifndef CASM_IntegralCluster_json_io
 #define CASM_IntegralCluster_json_io
 
+#include <iostream>
 #include <memory>
 #include <optional>
+#include <set>
+#include <vector>
 
 #include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/io/json/JsonArrayWriter.hh"
 
 namespace CASM {
 
 namespace clust {
 class IntegralCluster;
 struct IntegralClusterOrbitGenerator;
+
+/// \brief Options for writing cluster orbits
+struct ClusterOrbitOutputOptions {
+  /// If true, include "elements", the clusters in each orbit. If false,
+  /// only the prototype is written.
+  bool include_elements = true;
+
+  /// If true, include "equivalence_map", the indices of the symmetry
+  /// operations that map the prototype onto each element
+  bool include_equivalence_map = false;
+};
+
 }  // namespace clust
 
 namespace xtal {
 class BasicStructure;
-}
+struct UnitCellCoordRep;
+}  // namespace xtal
 
 template <typename T>
 class InputParser;
@@ -44,6 +61,29 @@ struct jsonConstructor<clust::IntegralCluster> {
 void parse(InputParser<clust::IntegralCluster> &parser,
            xtal::BasicStructure const &prim);
 
+/// \brief Write a cluster orbit to JSON object
+jsonParser &to_json(
+    std::set<clust::IntegralCluster> const &orbit, jsonParser &json,
+    xtal::BasicStructure const &prim,
+    std::optional<clust::IntegralCluster> phenomenal = std::nullopt,
+    std::vector<xtal::UnitCellCoordRep> const *unitcellcoord_symgroup_rep =
+        nullptr,
+    clust::ClusterOrbitOutputOptions const &options =
+        clust::ClusterOrbitOutputOptions());
+
+/// \brief Write cluster orbits to a stream as a JSON array, one orbit at a
+///     time
+void write_cluster_orbits_json(
+    std::ostream &out,
+    std::vector<std::set<clust::IntegralCluster>> const &orbits,
+    xtal::BasicStructure const &prim,
+    std::optional<clust::IntegralCluster> phenomenal = std::nullopt,
+    std::vector<xtal::UnitCellCoordRep> const *unitcellcoord_symgroup_rep =
+        nullptr,
+    clust::ClusterOrbitOutputOptions const &options =
+        clust::ClusterOrbitOutputOptions(),
+    JsonStreamOptions const &stream_options = JsonStreamOptions());
+
 }  // namespace CASM
 
 #endif
@@ -4,11 +4,14 @@
 #include <vector>
 
 #include "casm/container/Counter.hh"
+#include "casm/global/definitions.hh"
 
 namespace CASM {
 namespace xtal {
 class BasicStructure;
-}
+struct SymOp;
+struct UnitCellCoordRep;
+}  // namespace xtal
 
 namespace clust {
 class IntegralCluster;
@@ -17,6 +20,31 @@ class IntegralCluster;
 Counter<std::vector<int>> make_occ_counter(IntegralCluster const &cluster,
                                            xtal::BasicStructure const &prim);
 
+/// \brief A cluster occupation that is distinct under a cluster group, and
+///     the number of equivalent occupations
+struct DistinctClusterOccupation {
+  /// The occupant index on each cluster site. This is the greatest
+  /// (lexicographically) of the equivalent occupations.
+  std::vector<int> occupation;
+
+  /// The number of distinct occupations equivalent to `occupation` under the
+  /// cluster group, including `occupation`
+  Index multiplicity;
+};
+
+/// \brief Make the cluster occupations that are distinct under a group which
+///     leaves the cluster invariant
+std::vector<DistinctClusterOccupation> make_distinct_cluster_occupations(
+    IntegralCluster const &cluster, xtal::BasicStructure const &prim,
+    std::vector<xtal::SymOp> const &cluster_group_elements);
+
+/// \brief Make the cluster occupations that are distinct under a group which
+///     leaves the cluster invariant
+std::vector<DistinctClusterOccupation> make_distinct_cluster_occupations(
+    IntegralCluster const &cluster, xtal::BasicStructure const &prim,
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    std::vector<std::vector<std::vector<Index>>> const &occ_symgroup_rep);
+
 }  // namespace clust
 }  // namespace CASM
 
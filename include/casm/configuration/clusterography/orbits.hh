@@ -2,7 +2,9 @@
 #define CASM_clust_orbits
 
 #include <memory>
+#include <memory_resource>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "casm/configuration/clusterography/definitions.hh"
@@ -17,6 +19,12 @@ class IntegralCluster;
 IntegralCluster prim_periodic_integral_cluster_copy_apply(
     xtal::UnitCellCoordRep const &op, IntegralCluster clust);
 
+/// \brief Apply symmetry operation transformation to a cluster, writing the
+///     result into an existing cluster
+IntegralCluster &prim_periodic_integral_cluster_apply(
+    xtal::UnitCellCoordRep const &op, IntegralCluster const &clust,
+    IntegralCluster &result);
+
 /// \brief Find translation that leave cluster sites invariant after
 ///     transformation, up to a permutation
 xtal::UnitCell prim_periodic_integral_cluster_frac_translation(
@@ -75,7 +83,17 @@ std::vector<std::shared_ptr<SymGroup const>> make_cluster_groups(
     std::set<IntegralCluster> const &orbit,
     std::shared_ptr<SymGroup const> const &symggroup,
     Eigen::Matrix3d const &lat_column_mat,
-    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep);
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    bool conjugate_prototype_group = false);
+
+/// \brief Make groups that leave cluster orbit elements invariant, for
+///     multiple orbits
+std::vector<std::vector<std::shared_ptr<SymGroup const>>> make_cluster_groups(
+    std::vector<std::set<IntegralCluster>> const &orbits,
+    std::shared_ptr<SymGroup const> const &symgroup,
+    Eigen::Matrix3d const &lat_column_mat,
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    Index n_threads = 1, bool conjugate_prototype_group = false);
 
 /// \brief Make the group which leaves a cluster invariant
 std::shared_ptr<SymGroup const> make_cluster_group(
@@ -88,7 +106,94 @@ std::vector<std::set<IntegralCluster>> make_prim_periodic_orbits(
     std::shared_ptr<xtal::BasicStructure const> const &prim,
     std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
     SiteFilterFunction site_filter, std::vector<double> const &max_length,
-    std::vector<IntegralClusterOrbitGenerator> const &custom_generators);
+    std::vector<IntegralClusterOrbitGenerator> const &custom_generators,
+    Index n_threads = 1, std::pmr::memory_resource *resource = nullptr);
+
+class PackedUnitCellCoordSymGroupRep;
+
+/// \brief Generates orbits of clusters, with periodic symmetry of a prim,
+///     one branch at a time
+///
+/// Gives the same orbits as `make_prim_periodic_orbits`, without custom
+/// generators, but branch by branch on demand, so that max_length cutoffs
+/// can be chosen adaptively:
+///
+/// \code
+/// PrimPeriodicOrbitGenerator generator(prim, unitcellcoord_symgroup_rep,
+///                                      site_filter);
+/// generator.add_branch();     // point clusters
+/// generator.add_branch(6.0);  // pairs
+/// generator.extend_cutoff(8.0);  // more pairs
+/// generator.add_branch(4.0);  // triplets
+/// auto orbits = generator.orbits();
+/// \endcode
+///
+/// Notes:
+/// - The null cluster branch is generated at construction.
+/// - The prototypes of each branch are kept, so adding a branch extends only
+///   the last branch, and extending the cutoff of the last branch only
+///   generates the clusters with size in the added range. Earlier branches
+///   are never regenerated.
+/// - Only the last branch can be extended, because the clusters of a branch
+///   are generated from those of the previous branch.
+class PrimPeriodicOrbitGenerator {
+ public:
+  /// \brief Constructor
+  PrimPeriodicOrbitGenerator(
+      std::shared_ptr<xtal::BasicStructure const> const &_prim,
+      std::vector<xtal::UnitCellCoordRep> const &_unitcellcoord_symgroup_rep,
+      SiteFilterFunction _site_filter, Index _n_threads = 1);
+
+  ~PrimPeriodicOrbitGenerator();
+
+  /// \brief Number of branches generated, including the null cluster branch
+  Index n_branches() const;
+
+  /// \brief The max_length of each branch generated, as for
+  ///     `make_prim_periodic_orbits`
+  std::vector<double> const &max_length() const { return m_max_length; }
+
+  /// \brief Orbits of clusters of size == branch
+  std::vector<std::set<IntegralCluster>> const &branch_orbits(
+      Index branch) const;
+
+  /// \brief Orbits of all branches generated, in order
+  std::vector<std::set<IntegralCluster>> orbits() const;
+
+  /// \brief Generate the next branch
+  std::vector<std::set<IntegralCluster>> const &add_branch(
+      double max_length = 0.0);
+
+  /// \brief Increase the max_length of the last branch
+  std::vector<std::set<IntegralCluster>> const &extend_cutoff(
+      double max_length);
+
+ private:
+  void _extend(double min_length);
+
+  std::shared_ptr<xtal::BasicStructure const> m_prim;
+
+  std::vector<xtal::UnitCellCoordRep> m_unitcellcoord_symgroup_rep;
+
+  /// \brief site_filter, evaluated once per prim sublattice
+  SiteFilterMask m_site_filter_mask;
+
+  Index m_n_threads;
+
+  std::unique_ptr<PackedUnitCellCoordSymGroupRep> m_packed_rep;
+
+  /// Rebuilt when a branch needs a larger radius
+  std::unique_ptr<PrimNeighborIndex> m_neighbor_index;
+
+  std::vector<double> m_max_length;
+
+  /// Orbit prototypes, with their invariants, by branch, in the order of
+  /// `m_orbits[branch]`
+  std::vector<std::vector<std::pair<ClusterInvariants, IntegralCluster>>>
+      m_prototypes;
+
+  std::vector<std::vector<std::set<IntegralCluster>>> m_orbits;
+};
 
 /// \brief Convert orbits of IntegralCluster to orbits of linear site
 ///     indices in a supercell
@@ -113,6 +218,12 @@ struct EquivalentsInfo {
 IntegralCluster local_integral_cluster_copy_apply(
     xtal::UnitCellCoordRep const &op, IntegralCluster clust);
 
+/// \brief Apply symmetry operation transformation to a local cluster,
+///     writing the result into an existing cluster
+IntegralCluster &local_integral_cluster_apply(xtal::UnitCellCoordRep const &op,
+                                              IntegralCluster const &clust,
+                                              IntegralCluster &result);
+
 /// \brief Make an orbit of local clusters
 std::set<IntegralCluster> make_local_orbit(
     IntegralCluster const &orbit_element,
@@ -137,6 +248,15 @@ std::vector<std::shared_ptr<SymGroup const>> make_local_cluster_groups(
     std::shared_ptr<SymGroup const> const &phenomenal_group,
     std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep);
 
+/// \brief Make groups that leave cluster orbit elements invariant, for
+///     multiple orbits of local clusters
+std::vector<std::vector<std::shared_ptr<SymGroup const>>>
+make_local_cluster_groups(
+    std::vector<std::set<IntegralCluster>> const &orbits,
+    std::shared_ptr<SymGroup const> const &phenomenal_group,
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    Index n_threads = 1);
+
 /// \brief Make the group that leaves a local cluster invariant
 std::shared_ptr<SymGroup const> make_local_cluster_group(
     IntegralCluster cluster,
@@ -150,7 +270,17 @@ std::vector<std::set<IntegralCluster>> make_local_orbits(
     SiteFilterFunction site_filter, std::vector<double> const &max_length,
     std::vector<IntegralClusterOrbitGenerator> const &custom_generators,
     IntegralCluster const &phenomenal, std::vector<double> const &cutoff_radius,
-    bool include_phenomenal_sites = false);
+    bool include_phenomenal_sites = false,
+    std::pmr::memory_resource *resource = nullptr);
+
+/// \brief Transform local-cluster orbits to the orbits around an equivalent
+///     phenomenal cluster
+std::vector<std::set<IntegralCluster>> make_equivalent_local_orbits(
+    std::vector<std::set<IntegralCluster>> const &local_orbits,
+    xtal::UnitCellCoordRep const &op, xtal::UnitCell const &translation);
+
+/// \brief Estimate the memory used by orbits of clusters, in bytes
+Index memory_usage(std::vector<std::set<IntegralCluster>> const &orbits);
 
 }  // namespace clust
 }  // namespace CASM
@@ -24,12 +24,14 @@ struct ConfigSpaceAnalysisResults {
 
   /// \brief DoF values of all equivalent configurations in the
   ///     fully commensurate supercell, expressed in the basis of the
-  ///     standard DoF space, with key == input configuration identifier
+  ///     standard DoF space, with key == input configuration identifier.
+  ///     Empty if equivalents were not stored.
   std::map<std::string, std::vector<Eigen::VectorXd>> const
       equivalent_dof_values;
 
   /// \brief All equivalent configurations in the fully commensurate
-  ///     supercell, with key == input configuration identifier
+  ///     supercell, with key == input configuration identifier. Empty if
+  ///     equivalents were not stored.
   std::map<std::string, std::vector<Configuration>> const
       equivalent_configurations;
 
@@ -44,6 +46,76 @@ struct ConfigSpaceAnalysisResults {
   clexulator::DoFSpace const symmetry_adapted_dof_space;
 };
 
+/// \brief Partial projectors of `config_space_analysis`, for a subset of
+///     the input configurations
+///
+/// The projector is a sum over configurations, so it can be accumulated
+/// for disjoint subsets of the input configurations independently, for
+/// example by MPI ranks or worker processes, and the partial results summed
+/// before the eigendecomposition:
+///
+/// \code
+/// // all ranks use the same fully commensurate supercell
+/// auto supercell = make_config_space_analysis_supercell(all_configurations);
+/// ConfigSpaceAnalysisPartial partial = config_space_analysis_partial(
+///     supercell, configurations_on_this_rank, dofs);
+/// ... sum `partial.projector` from every rank into one partial ...
+/// auto results = finish_config_space_analysis(partial);
+/// \endcode
+///
+/// A configuration, or equivalent configurations, included in more than one
+/// subset are counted once per subset. This scales the eigenvalues, but does
+/// not change the symmetry adapted space.
+struct ConfigSpaceAnalysisPartial {
+  explicit ConfigSpaceAnalysisPartial(
+      std::shared_ptr<Supercell const> const &_supercell);
+
+  /// \brief The fully commensurate supercell
+  std::shared_ptr<Supercell const> supercell;
+
+  /// \brief Standard DoF space, by DoF type
+  std::map<DoFKey, clexulator::DoFSpace> standard_dof_space;
+
+  /// \brief Partial projection matrix, by DoF type
+  std::map<DoFKey, Eigen::MatrixXd> projector;
+
+  /// \brief Number of distinct primitive configurations accumulated
+  Index n_configurations;
+
+  /// \brief Add the projectors of another partial result
+  void merge(ConfigSpaceAnalysisPartial const &other);
+
+  /// \brief Add partial projectors, as from another partial result
+  void add_projector(std::map<DoFKey, Eigen::MatrixXd> const &other_projector,
+                     Index other_n_configurations);
+};
+
+/// \brief Make the fully commensurate supercell used by
+///     `config_space_analysis`
+std::shared_ptr<Supercell const> make_config_space_analysis_supercell(
+    std::map<std::string, Configuration> const &configurations,
+    std::optional<Index> max_supercell_volume = std::nullopt);
+
+/// \brief Accumulate the projectors of `config_space_analysis` for a subset
+///     of the input configurations
+ConfigSpaceAnalysisPartial config_space_analysis_partial(
+    std::shared_ptr<Supercell const> const &supercell,
+    std::map<std::string, Configuration> const &configurations,
+    std::optional<std::vector<DoFKey>> dofs = std::nullopt,
+    std::optional<bool> exclude_homogeneous_modes = std::nullopt,
+    bool include_default_occ_modes = false,
+    std::optional<std::map<int, int>> sublattice_index_to_default_occ =
+        std::nullopt,
+    std::optional<std::map<Index, int>> site_index_to_default_occ =
+        std::nullopt,
+    double tol = TOL, Index n_threads = 1,
+    bool use_prototype_supercells = false);
+
+/// \brief Find the symmetry adapted config spaces from merged partial
+///     projectors
+std::map<DoFKey, ConfigSpaceAnalysisResults> finish_config_space_analysis(
+    ConfigSpaceAnalysisPartial const &partial, double tol = TOL);
+
 std::map<DoFKey, ConfigSpaceAnalysisResults> config_space_analysis(
     std::map<std::string, Configuration> const &configurations,
     std::optional<std::vector<DoFKey>> dofs = std::nullopt,
@@ -53,7 +125,9 @@ std::map<DoFKey, ConfigSpaceAnalysisResults> config_space_analysis(
         std::nullopt,
     std::optional<std::map<Index, int>> site_index_to_default_occ =
         std::nullopt,
-    double tol = TOL);
+    double tol = TOL, bool store_equivalents = true, Index n_threads = 1,
+    std::optional<Index> max_supercell_volume = std::nullopt,
+    bool use_prototype_supercells = false);
 
 }  // namespace config
 }  // namespace CASM
@@ -8,6 +8,7 @@ namespace CASM {
 namespace config {
 
 struct Configuration;
+struct ConfigurationView;
 struct ConfigurationWithProperties;
 struct Supercell;
 
@@ -17,6 +18,13 @@ Configuration copy_configuration(
     std::shared_ptr<Supercell const> const &supercell,
     UnitCell const &origin = UnitCell(0, 0, 0));
 
+/// \brief Copy configuration DoF values, referenced by a view, into a
+///     supercell
+Configuration copy_configuration(
+    ConfigurationView const &motif,
+    std::shared_ptr<Supercell const> const &supercell,
+    UnitCell const &origin = UnitCell(0, 0, 0));
+
 /// \brief Copy transformed configuration DoF values into a supercell
 Configuration copy_configuration(
     Index prim_factor_group_index, UnitCell translation,
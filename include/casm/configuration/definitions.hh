@@ -85,12 +85,16 @@ using xtal::UnitCell;
 using xtal::UnitCellCoord;
 using xtal::UnitCellCoordRep;
 
+class CanonicalFormEngine;
 struct Configuration;
+struct ConfigurationView;
+class DiagonalIndexConverter;
 struct Prim;
 struct PrimSymInfo;
 struct Supercell;
 struct SupercellSymInfo;
 class SupercellSymOp;
+class SupercellSymOpRef;
 
 typedef long Index;
 typedef std::string DoFKey;
@@ -10,6 +10,7 @@ namespace clexulator {
 struct DoFSpace;
 }
 namespace irreps {
+class IrrepDecompositionCache;
 struct VectorSpaceSymReport;
 }
 
@@ -43,7 +44,10 @@ DoFSpaceAnalysisResults dof_space_analysis(
         std::nullopt,
     std::optional<std::map<Index, int>> site_index_to_default_occ =
         std::nullopt,
-    bool calc_wedges = false, std::optional<Log> log = std::nullopt);
+    bool calc_wedges = false, std::optional<Log> log = std::nullopt,
+    std::shared_ptr<irreps::IrrepDecompositionCache> irrep_decomposition_cache =
+        nullptr,
+    Index n_threads = 1, bool use_kpoint_blocks = false);
 
 }  // namespace config
 }  // namespace CASM
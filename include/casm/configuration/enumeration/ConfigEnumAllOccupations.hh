@@ -2,11 +2,24 @@
 #define CASM_config_enum_ConfigEnumAllOccupations
 
 #include "casm/configuration/Configuration.hh"
-#include "casm/container/Counter.hh"
+#include "casm/configuration/enumeration/ConfigurationFilter.hh"
+#include "casm/configuration/enumeration/EnumProgress.hh"
 
 namespace CASM {
 namespace config {
 
+/// \brief A change in the occupation of one site
+struct OccupationDelta {
+  /// Site index, in the supercell
+  Index site_index;
+
+  /// Occupant index before the change
+  int old_occupation;
+
+  /// Occupant index after the change
+  int new_occupation;
+};
+
 /// Enumerate over all possible occupations on particular sites in a
 /// Configuration
 ///
@@ -25,6 +38,24 @@ namespace config {
 /// }
 /// \endcode
 ///
+/// To split enumeration across threads, use `make_occupation_partitions` to
+/// choose values for the leading sites, and construct one enumerator per
+/// partition. The union of the partitions is the full enumeration. See
+/// `make_distinct_occupations`.
+///
+/// To checkpoint a long enumeration, save `counter_value()`, and to resume
+/// construct an enumerator with the same background and sites and call
+/// `set_counter_value` with the saved value.
+///
+/// The sites whose occupation changed in the last call to `advance` are
+/// given by `delta()`. With `gray_code == true`, occupations are enumerated
+/// in reflected mixed-radix Gray code order, so that each call to `advance`
+/// changes the occupation of exactly one site, by one occupant index, which
+/// allows consumers that update incrementally to do O(1) work per value.
+///
+/// To monitor a long enumeration without a per-value callback, give an
+/// EnumProgress to `set_progress`, which then counts each value generated.
+///
 class ConfigEnumAllOccupations {
  public:
   /// \brief Constructor
@@ -37,15 +68,41 @@ class ConfigEnumAllOccupations {
   ConfigEnumAllOccupations(Configuration const &background,
                            std::set<Index> const &sites);
 
+  /// \brief Constructor, enumerating one partition of the occupations
+  ConfigEnumAllOccupations(Configuration const &background,
+                           std::set<Index> const &sites,
+                           std::vector<int> const &fixed_occupation,
+                           bool gray_code = false);
+
   /// \brief Get the current Configuration
   Configuration const &value() const;
 
+  /// \brief Occupation changes made by the last call to `advance`
+  std::vector<OccupationDelta> const &delta() const;
+
+  /// \brief True if enumerating in Gray code order
+  bool gray_code() const;
+
   /// \brief Generate the next Configuration
   void advance();
 
   /// \brief Return true if `value` is valid, false if no more valid values
   bool is_valid() const;
 
+  /// \brief Occupant indices on the enumerated sites, in sorted order
+  std::vector<int> const &counter_value() const;
+
+  /// \brief Set the occupant indices on the enumerated sites, in sorted
+  ///     order, to resume enumeration
+  void set_counter_value(std::vector<int> const &value);
+
+  /// \brief Number of values of the counter, i.e. the number of
+  ///     configurations enumerated from the first value
+  double n_total() const;
+
+  /// \brief Count the values generated in `progress`
+  void set_progress(std::shared_ptr<EnumProgress> const &progress);
+
  private:
   /// The current configuration
   Configuration m_current;
@@ -53,10 +110,61 @@ class ConfigEnumAllOccupations {
   /// Site index to enumerate on
   std::set<Index> m_sites;
 
-  /// Counter over allowed occupation indices on sites in m_sites
-  Counter<std::vector<int> > m_counter;
+  /// Site index to enumerate on, as a vector, in the same order as m_sites
+  std::vector<Index> m_site_indices;
+
+  /// Max allowed occupation index on each site in m_sites
+  std::vector<int> m_max_site_occupation;
+
+  /// Current occupation index on each site in m_sites, incremented
+  /// lexicographically, or in Gray code order, with the first site changing
+  /// fastest
+  std::vector<int> m_counter;
+
+  /// If true, enumerate in reflected mixed-radix Gray code order
+  bool m_gray_code;
+
+  /// Direction, +1 or -1, each element of m_counter moves in Gray code order
+  std::vector<int> m_direction;
+
+  /// Occupation changes made by the last call to `advance`
+  std::vector<OccupationDelta> m_delta;
+
+  /// True while m_counter is valid
+  bool m_is_valid;
+
+  /// If not null, counts the values generated
+  std::shared_ptr<EnumProgress> m_progress;
+
+  void _advance();
+
+  void _set_counter(Index i, int value);
+
+  void _set_direction();
 };
 
+/// \brief Split the occupations enumerated on `sites` into disjoint
+///     partitions
+std::vector<std::vector<int>> make_occupation_partitions(
+    Configuration const &background, std::set<Index> const &sites,
+    Index min_n_partitions);
+
+/// \brief Enumerate occupations on `sites` in parallel and return the
+///     distinct canonical configurations that pass a filter
+std::set<Configuration> make_distinct_occupations(
+    Configuration const &background, std::set<Index> const &sites,
+    ConfigurationFilter const &filter, Index n_threads = 1,
+    EnumProgress *progress = nullptr, bool skip_non_primitive = false);
+
+/// \brief Enumerate occupations on `sites` in parallel and return the
+///     distinct canonical configurations that pass a filter, using an
+///     existing CanonicalFormEngine
+std::set<Configuration> make_distinct_occupations(
+    CanonicalFormEngine const &engine, Configuration const &background,
+    std::set<Index> const &sites, ConfigurationFilter const &filter,
+    Index n_threads = 1, EnumProgress *progress = nullptr,
+    bool skip_non_primitive = false);
+
 }  // namespace config
 }  // namespace CASM
 
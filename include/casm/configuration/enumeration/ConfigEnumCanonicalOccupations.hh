@@ -0,0 +1,131 @@
+#ifndef CASM_config_enum_ConfigEnumCanonicalOccupations
+#define CASM_config_enum_ConfigEnumCanonicalOccupations
+
+#include <optional>
+
+#include "casm/configuration/Configuration.hh"
+
+namespace CASM {
+namespace config {
+
+/// Enumerate the canonical occupations on particular sites in a
+/// Configuration, pruning non-canonical candidates early
+///
+/// The configurations generated are those generated by
+/// `ConfigEnumAllOccupations(background, sites)` that are canonical with
+/// respect to `engine->ops()` (by default, all operations that leave the
+/// supercell lattice invariant), but possibly in a different order.
+///
+/// Method:
+/// - Occupations are assigned to `sites` in increasing site index order by
+///   depth-first search.
+/// - A partial assignment is pruned as soon as some operation maps it to an
+///   occupation that is lexicographically greater on the sites already
+///   determined, because no completion of it can then be canonical. Only
+///   operations that leave the background global DoF values unchanged are
+///   used for pruning.
+/// - Complete assignments are checked with `CanonicalFormEngine::is_canonical`.
+/// - If `occupant_counts` is given, only occupations with exactly that many
+///   of each occupant on the enumerated sites of each sublattice are
+///   generated. Occupant values are chosen from those with remaining counts,
+///   so only the distinct permutations of the fixed multiset of occupants are
+///   visited, rather than the full product of occupants on every site. For
+///   example, 32 A and 32 B on 64 sites visits at most C(64,32) leaves,
+///   rather than 2^64, before canonical pruning.
+///
+/// Example:
+/// \code
+/// std::vector<Configuration> configurations;
+/// Configuration background = ...;
+/// std::set<Index> sites = ...;
+/// ConfigEnumCanonicalOccupations enumerator(background, sites);
+/// while (enumerator.is_valid()) {
+///   configurations.push_back(enumerator.value());
+///   enumerator.advance();
+/// }
+/// \endcode
+///
+class ConfigEnumCanonicalOccupations {
+ public:
+  /// \brief Constructor, using all operations that leave the supercell
+  ///     lattice invariant
+  ConfigEnumCanonicalOccupations(
+      Configuration const &background, std::set<Index> const &sites,
+      std::optional<std::vector<std::vector<Index>>> const &occupant_counts =
+          std::nullopt);
+
+  /// \brief Constructor, using the operations of an existing engine
+  ConfigEnumCanonicalOccupations(
+      std::shared_ptr<CanonicalFormEngine const> const &engine,
+      Configuration const &background, std::set<Index> const &sites,
+      std::optional<std::vector<std::vector<Index>>> const &occupant_counts =
+          std::nullopt);
+
+  /// \brief Get the current Configuration
+  Configuration const &value() const;
+
+  /// \brief Generate the next Configuration
+  void advance();
+
+  /// \brief Return true if `value` is valid, false if no more valid values
+  bool is_valid() const;
+
+ private:
+  /// \brief Return true if no completion of the current partial assignment
+  ///     can be canonical
+  bool _is_pruned() const;
+
+  /// \brief Assign the first allowed occupant to `m_sites[k]`
+  void _first_value(Index k);
+
+  /// \brief Assign the next allowed occupant to `m_sites[k]`; return false,
+  ///     releasing the current occupant, if there is none
+  bool _next_value(Index k);
+
+  /// \brief Move to the next partial assignment at the current depth or
+  ///     above; return false if the search is complete
+  bool _next_sibling();
+
+  /// \brief Search from the current partial assignment for the next
+  ///     canonical configuration
+  void _search();
+
+  /// Finds canonical forms
+  std::shared_ptr<CanonicalFormEngine const> m_engine;
+
+  /// The current configuration
+  Configuration m_current;
+
+  /// Site indices to enumerate on, in increasing order
+  std::vector<Index> m_sites;
+
+  /// Maximum occupant index on each site in m_sites
+  std::vector<int> m_max_occupation;
+
+  /// Sublattice index of each site in m_sites
+  std::vector<Index> m_sublattice;
+
+  /// If true, occupant counts are fixed
+  bool m_fixed_counts;
+
+  /// Remaining occupant counts, as m_remaining_counts[b][occupant_index],
+  /// for the sites in m_sites not yet assigned. Only used if m_fixed_counts.
+  std::vector<std::vector<Index>> m_remaining_counts;
+
+  /// Position of each supercell site in m_sites, or -1 if not enumerated
+  std::vector<Index> m_site_position;
+
+  /// Indices into `m_engine->ops()` of the operations used for pruning
+  std::vector<Index> m_pruning_op_indices;
+
+  /// Number of sites in m_sites currently assigned
+  Index m_depth;
+
+  /// True if `m_current` is a valid value
+  bool m_valid;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
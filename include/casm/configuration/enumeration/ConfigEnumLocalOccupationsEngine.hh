@@ -0,0 +1,135 @@
+#ifndef CASM_config_enum_ConfigEnumLocalOccupationsEngine
+#define CASM_config_enum_ConfigEnumLocalOccupationsEngine
+
+#include <optional>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/definitions.hh"
+#include "casm/configuration/enumeration/EnumProgress.hh"
+#include "casm/configuration/sym_info/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief A distinct local occupation perturbation, as generated by
+///     ConfigEnumLocalOccupationsEngine
+struct LocalOccupationPerturbation {
+  /// \brief Index of the local-cluster orbit that was perturbed, or -1 if the
+  ///     perturbation was made on a neighborhood of sites combined from
+  ///     multiple orbits
+  Index i_local_orbit;
+
+  /// \brief Linear site indices of the sites on which the perturbation was
+  ///     applied
+  std::vector<Index> sites;
+
+  /// \brief Background occupation on `sites`
+  std::vector<int> initial_occupation;
+
+  /// \brief Perturbed occupation on `sites`
+  std::vector<int> final_occupation;
+
+  /// \brief The configuration with the perturbation applied
+  Configuration configuration;
+
+  /// \brief The canonical form of `configuration` in the context of the event
+  Configuration canonical_configuration;
+};
+
+/// \brief Enumerates distinct occupation perturbations in the local
+///     environment of an event in a background configuration
+///
+/// This is the native implementation of the per-cluster loop of
+/// `libcasm.enumerate.ConfigEnumLocalOccupations`. One engine is constructed
+/// for each background configuration and event position, and then:
+///
+/// 1. For each local-cluster orbit, the distinct local-cluster sites are
+///    found using the site permutations of the event group operations that
+///    leave the background and event invariant (see
+///    `make_local_cluster_sites_group_rep`), which are computed once, at
+///    construction.
+/// 2. All occupations on each distinct local-cluster are enumerated, starting
+///    from the reference configuration, which is the greater of the
+///    background with the initial or the final event occupation applied.
+///    This includes occupations that leave some sites unchanged.
+/// 3. Each perturbed configuration is made canonical in the context of the
+///    event (see `make_canonical_form(configuration, event_sites, occ_init,
+///    occ_final, event_group)`), using a CanonicalFormEngine constructed for
+///    the event group, and only distinct canonical forms are kept. A local
+///    cluster with no sites gives the unperturbed reference configuration.
+///
+/// Distinct perturbations are found separately for each orbit, so the same
+/// canonical configuration may be generated from more than one orbit.
+class ConfigEnumLocalOccupationsEngine {
+ public:
+  /// \brief Constructor
+  ConfigEnumLocalOccupationsEngine(
+      Configuration const &_background, std::vector<Index> const &_event_sites,
+      std::vector<int> const &_occ_init, std::vector<int> const &_occ_final,
+      std::vector<SupercellSymOp> const &_event_group);
+
+  /// \brief The background configuration
+  Configuration const &background() const;
+
+  /// \brief The reference configuration, which is perturbed
+  Configuration const &reference() const;
+
+  /// \brief Count the perturbations generated and kept in `progress`
+  void set_progress(std::shared_ptr<EnumProgress> const &progress);
+
+  /// \brief Make the canonical form of a configuration in the context of the
+  ///     event
+  Configuration make_canonical_form(Configuration const &configuration) const;
+
+  /// \brief Make the distinct clusters of sites from an orbit of
+  ///     local-clusters
+  std::set<std::set<Index>> make_distinct_local_cluster_sites(
+      std::set<clust::IntegralCluster> const &local_orbit) const;
+
+  /// \brief Make distinct perturbations on distinct local-cluster sites
+  std::vector<LocalOccupationPerturbation> make_distinct_local_perturbations(
+      std::set<std::set<Index>> const &distinct_local_cluster_sites,
+      Index i_local_orbit = -1) const;
+
+  /// \brief Make distinct perturbations on each local-cluster orbit
+  std::vector<LocalOccupationPerturbation> by_cluster(
+      std::vector<std::set<clust::IntegralCluster>> const &local_orbits,
+      std::optional<std::set<Index>> const &orbits = std::nullopt) const;
+
+  /// \brief Make distinct perturbations on a neighborhood of sites
+  std::vector<LocalOccupationPerturbation> by_neighborhood(
+      std::vector<std::set<clust::IntegralCluster>> const &local_orbits,
+      std::set<Index> const &neighborhood_from_orbits) const;
+
+ private:
+  Configuration m_background;
+  std::vector<Index> m_event_sites;
+  std::vector<int> m_occ_init;
+  std::vector<int> m_occ_final;
+  Configuration m_reference;
+
+  /// Canonicalizes configurations under the event group
+  CanonicalFormEngine m_canonical_form_engine;
+
+  /// Site permutations of the event group operations that leave the
+  /// background and event invariant
+  std::vector<sym_info::Permutation> m_indices_group_rep;
+
+  /// If not null, counts the perturbations generated and kept
+  std::shared_ptr<EnumProgress> m_progress;
+};
+
+/// \brief Return the operations that place an event in each distinct
+///     position with respect to a background configuration
+std::vector<SupercellSymOp> make_suborbit_generating_ops(
+    std::shared_ptr<Supercell const> const &supercell,
+    std::vector<SupercellSymOp> const &event_group,
+    std::vector<SupercellSymOp> const &background_group);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
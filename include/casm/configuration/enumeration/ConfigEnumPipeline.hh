@@ -0,0 +1,149 @@
+#ifndef CASM_config_enum_ConfigEnumPipeline
+#define CASM_config_enum_ConfigEnumPipeline
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/definitions.hh"
+#include "casm/configuration/enumeration/ConfigurationFilter.hh"
+#include "casm/configuration/enumeration/Enumerator.hh"
+
+namespace CASM {
+namespace config {
+
+class ConfigurationBinaryWriter;
+class ConfigurationSet;
+
+/// \brief ConfigEnumPipeline parameters
+struct ConfigEnumPipelineParams {
+  /// Number of configurations passed between stages at a time
+  Index batch_size = 256;
+
+  /// Maximum number of batches waiting between two stages. When a queue is
+  /// full, the stage before it waits.
+  Index queue_capacity = 16;
+
+  /// Number of threads finding canonical forms. If <= 0, use the number of
+  /// threads set by `set_num_threads`.
+  Index n_canonical_form_workers = 1;
+
+  /// Number of threads applying the filter. If <= 0, use the number of threads
+  /// set by `set_num_threads`.
+  Index n_filter_workers = 1;
+};
+
+/// \brief Throughput metrics for one stage of a ConfigEnumPipeline
+struct PipelineStageMetrics {
+  /// Stage name: "enumerate", "canonicalize", "filter", or "write"
+  std::string name;
+
+  /// Number of threads running the stage
+  Index n_workers = 0;
+
+  /// Number of configurations received
+  Index n_in = 0;
+
+  /// Number of configurations passed on, or, for "write", inserted
+  Index n_out = 0;
+
+  /// Time spent processing, summed over workers, excluding time spent
+  /// waiting on queues
+  double busy_seconds = 0.0;
+
+  /// Time spent waiting on queues, summed over workers
+  double wait_seconds = 0.0;
+
+  /// Time from the start of the pipeline until the stage finished
+  double wall_seconds = 0.0;
+
+  /// \brief Configurations received per second of wall time
+  double throughput() const {
+    return wall_seconds > 0.0 ? n_in / wall_seconds : 0.0;
+  }
+};
+
+/// \brief Runs enumerate -> canonicalize -> filter -> write as concurrent
+///     stages connected by bounded queues
+///
+/// Stages:
+/// - "enumerate": runs on the calling thread, filling batches of
+///   configurations from a source.
+/// - "canonicalize": `n_canonical_form_workers` threads, which replace
+///   each configuration with its canonical form with respect to all
+///   operations that leave its supercell lattice invariant, using one
+///   shared CanonicalFormEngine per supercell.
+/// - "filter": `n_filter_workers` threads, which drop configurations for
+///   which the filter returns false. The filter must be safe to call
+///   concurrently.
+/// - "write": one thread, which inserts distinct configurations into the
+///   ConfigurationSet, if given, or else into `distinct_configurations()`,
+///   and streams each newly inserted configuration to the binary writer, if
+///   given.
+///
+/// Notes:
+/// - Batches are numbered by the enumerate stage and the write stage
+///   handles them in that order, so results, including configuration ids,
+///   do not depend on the number of workers or thread timing.
+/// - Bounded queues apply backpressure: if writing is slow, compute stages
+///   wait rather than accumulating batches in memory.
+/// - If any stage throws, all queues are closed, the stages stop, and the
+///   first exception is rethrown by `run`.
+class ConfigEnumPipeline {
+ public:
+  /// \brief Constructor
+  ConfigEnumPipeline(ConfigEnumPipelineParams const &_params,
+                     ConfigurationFilter const &_filter,
+                     ConfigurationSet *_configurations = nullptr,
+                     ConfigurationBinaryWriter *_writer = nullptr);
+
+  /// \brief Run the pipeline with a source that fills batches
+  std::vector<PipelineStageMetrics> run(
+      std::function<bool(std::vector<Configuration> &)> fill_batch);
+
+  /// \brief Run the pipeline with an enumerator as the source
+  template <typename EnumeratorType>
+  std::vector<PipelineStageMetrics> run_enumerator(EnumeratorType &enumerator);
+
+  /// \brief Distinct canonical configurations that passed the filter, if
+  ///     no ConfigurationSet was given
+  std::set<Configuration> const &distinct_configurations() const;
+
+ private:
+  ConfigEnumPipelineParams m_params;
+
+  ConfigurationFilter const &m_filter;
+
+  ConfigurationSet *m_configurations;
+
+  ConfigurationBinaryWriter *m_writer;
+
+  std::set<Configuration> m_distinct_configurations;
+};
+
+// --- Inline definitions ---
+
+/// \brief Run the pipeline with an enumerator as the source
+///
+/// \param enumerator An enumerator of Configuration with a supported
+///     EnumeratorProtocol, such as ConfigEnumAllOccupations, or an
+///     Enumerator<Configuration>.
+///
+/// \returns Metrics for each stage, in pipeline order.
+template <typename EnumeratorType>
+std::vector<PipelineStageMetrics> ConfigEnumPipeline::run_enumerator(
+    EnumeratorType &enumerator) {
+  Index batch_size = std::max(Index(1), m_params.batch_size);
+  return run([&](std::vector<Configuration> &batch) {
+    next_batch(enumerator, batch, batch_size - Index(batch.size()));
+    return enumerator_is_valid(enumerator);
+  });
+}
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef CASM_config_enum_DistinctOccupationSampler
+#define CASM_config_enum_DistinctOccupationSampler
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+
+namespace CASM {
+namespace config {
+
+class CanonicalFormEngine;
+
+/// \brief Draw symmetrically distinct occupations of a supercell uniformly
+///     at random, without enumerating them
+///
+/// Each sample is the canonical form of an occupation, and every orbit of
+/// occupations is equally likely, regardless of its size. This is unlike
+/// canonicalizing uniformly random occupations, which favors orbits with
+/// more members, by a factor of up to the number of operations.
+///
+/// Method:
+/// - An occupation `x` and an operation `g` are drawn uniformly at random,
+///   and accepted if `g * x == x`. This accepts `x` with probability
+///   `|H_x| / |G|`, where `H_x` is the invariant subgroup of `x`. An orbit
+///   has `|G| / |H_x|` members, so every orbit is accepted with the same
+///   probability, `1 / n_occupations`.
+/// - Site occupants are drawn lazily, only as the comparison of `g * x` to
+///   `x` reaches them, so a rejected proposal costs a few random draws
+///   rather than one per site. The expected number of proposals per sample
+///   is `n_occupations / n_orbits`, which is close to `|G|` for large
+///   supercells.
+/// - If `occupant_counts` is given, occupations are uniformly random
+///   permutations of the fixed occupants on each sublattice, drawn lazily by
+///   sampling without replacement. Only the operations that preserve the
+///   fixed composition are used, both for acceptance and for the canonical
+///   form, so that samples satisfy the constraint and are uniform over its
+///   orbits.
+/// - The cost per sample depends on the number of operations and sites, but
+///   not on the number of occupations.
+///
+/// Random numbers are generated with `std::mt19937_64` and integer
+/// arithmetic only, so samples for a given seed are the same on every
+/// platform.
+class DistinctOccupationSampler {
+ public:
+  /// \brief Constructor, using all operations that leave the supercell
+  ///     lattice invariant
+  explicit DistinctOccupationSampler(
+      std::shared_ptr<Supercell const> const &supercell,
+      std::optional<std::vector<std::vector<Index>>> const &occupant_counts =
+          std::nullopt);
+
+  /// \brief Constructor, using the operations of an existing engine
+  explicit DistinctOccupationSampler(
+      std::shared_ptr<CanonicalFormEngine const> const &engine,
+      std::optional<std::vector<std::vector<Index>>> const &occupant_counts =
+          std::nullopt);
+
+  /// \brief The supercell
+  std::shared_ptr<Supercell const> const &supercell() const;
+
+  /// \brief Finds canonical forms, using only the operations that preserve
+  ///     the fixed composition, if any
+  std::shared_ptr<CanonicalFormEngine const> const &engine() const;
+
+  /// \brief Draw one distinct occupation
+  Configuration sample(std::mt19937_64 &random_engine,
+                       Index *n_proposals = nullptr) const;
+
+  /// \brief Draw many distinct occupations, in parallel
+  std::vector<Configuration> sample(Index n_samples, std::uint64_t seed,
+                                    Index n_threads = 1) const;
+
+ private:
+  /// Finds canonical forms
+  std::shared_ptr<CanonicalFormEngine const> m_engine;
+
+  /// Number of sites in the supercell
+  Index m_n_sites;
+
+  /// Sublattice index of each site
+  std::vector<Index> m_sublattice;
+
+  /// Number of allowed occupants on each sublattice
+  std::vector<int> m_n_occupants;
+
+  /// If true, occupant counts are fixed
+  bool m_fixed_counts;
+
+  /// Fixed occupant counts, as m_occupant_counts[b][occupant_index]. Only
+  /// used if m_fixed_counts.
+  std::vector<std::vector<Index>> m_occupant_counts;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
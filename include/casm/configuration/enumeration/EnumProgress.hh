@@ -0,0 +1,142 @@
+#ifndef CASM_config_enum_EnumProgress
+#define CASM_config_enum_EnumProgress
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief A snapshot of the progress of an enumeration
+struct EnumProgressStatus {
+  /// \brief Number of configurations generated
+  Index n_generated = 0;
+
+  /// \brief Number of generated configurations found to be canonical, for
+  ///     enumerations that check
+  Index n_canonical = 0;
+
+  /// \brief Number of configurations accepted, i.e. passed on to the caller
+  Index n_accepted = 0;
+
+  /// \brief Estimated total number of configurations to be generated, or 0
+  ///     if not known
+  double n_total = 0.0;
+
+  /// \brief Seconds since the progress was constructed or reset
+  double elapsed_seconds = 0.0;
+
+  /// \brief Configurations generated per second
+  double rate = 0.0;
+
+  /// \brief Fraction of `n_total` generated, if `n_total` is known
+  std::optional<double> fraction_complete;
+
+  /// \brief Estimated seconds remaining, if `n_total` is known and the rate
+  ///     is not zero
+  std::optional<double> estimated_remaining_seconds;
+};
+
+/// \brief Accumulates enumeration progress and reports it through a
+///     throttled callback
+///
+/// Enumerators add to the counts as they go, and the callback, if any, is
+/// called with a status snapshot at most once per `report_interval` seconds,
+/// by whichever thread notices the interval has passed. The counts can also
+/// be polled with `status()` at any time.
+///
+/// Notes:
+/// - Counts are relaxed atomics, so methods may be called from several
+///   threads. Parallel enumerators add counts per batch rather than per
+///   configuration, so the shared counters are not contended.
+/// - Only one thread runs the callback at a time. A report that falls due
+///   while the callback is running is skipped.
+/// - `n_total` is the sum of the sizes of the occupation counters of the
+///   enumerators that have started, so it grows as an enumeration over many
+///   backgrounds proceeds.
+class EnumProgress {
+ public:
+  typedef std::function<void(EnumProgressStatus const &)> CallbackType;
+
+  /// \brief Constructor
+  explicit EnumProgress(CallbackType _callback = CallbackType(),
+                        double _report_interval = 1.0);
+
+  EnumProgress(EnumProgress const &) = delete;
+  EnumProgress &operator=(EnumProgress const &) = delete;
+
+  /// \brief Add to the estimated total number of configurations
+  void add_total(double n);
+
+  /// \brief Add to the number of configurations generated
+  void add_generated(Index n = 1) {
+    m_n_generated.fetch_add(n, std::memory_order_relaxed);
+    report_if_due();
+  }
+
+  /// \brief Add to the number of canonical configurations
+  void add_canonical(Index n = 1) {
+    m_n_canonical.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  /// \brief Add to the number of accepted configurations
+  void add_accepted(Index n = 1) {
+    m_n_accepted.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  /// \brief Return a snapshot of the current progress
+  EnumProgressStatus status() const;
+
+  /// \brief Call the callback if `report_interval` seconds have passed
+  ///     since the last report
+  void report_if_due() {
+    if (m_callback &&
+        _now_ticks() >= m_next_report.load(std::memory_order_relaxed)) {
+      _report(false);
+    }
+  }
+
+  /// \brief Call the callback now, if there is one
+  void report() { _report(true); }
+
+  /// \brief Set all counts to zero and restart the clock
+  void reset();
+
+ private:
+  typedef std::chrono::steady_clock clock;
+
+  static clock::rep _now_ticks() {
+    return clock::now().time_since_epoch().count();
+  }
+
+  void _report(bool force);
+
+  CallbackType m_callback;
+
+  clock::duration m_report_interval;
+
+  std::atomic<clock::rep> m_begin;
+
+  std::atomic<clock::rep> m_next_report;
+
+  std::atomic<Index> m_n_generated;
+
+  std::atomic<Index> m_n_canonical;
+
+  std::atomic<Index> m_n_accepted;
+
+  std::atomic<double> m_n_total;
+
+  /// Held while the callback runs
+  std::mutex m_report_mutex;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,265 @@
+#ifndef CASM_config_enum_Enumerator
+#define CASM_config_enum_Enumerator
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Adapts the protocol of an enumerator type to
+///     `is_valid(e)` / `value(e)` / `advance(e)`
+///
+/// Specializations exist for the protocols used in CASM:
+/// - `is_valid()` / `value()` / `advance()`, as used by
+///   ConfigEnumAllOccupations, ConfigEnumCanonicalOccupations,
+///   MeshGridPointEnumerator, and the configuration readers
+/// - `is_finished()` / `value()` / `advance()`, as used by
+///   occ_events::OccEventCounter
+/// - `valid()` / `value()` / `next()`, as used by clust::SubClusterCounter
+///
+/// Iterator ranges, such as xtal::SuperlatticeEnumerator, can be adapted
+/// with RangeEnumerator.
+template <typename EnumeratorType, typename = void>
+struct EnumeratorProtocol;
+
+template <typename EnumeratorType>
+struct EnumeratorProtocol<
+    EnumeratorType,
+    std::void_t<decltype(std::declval<EnumeratorType const &>().is_valid()),
+                decltype(std::declval<EnumeratorType &>().advance())>> {
+  static bool is_valid(EnumeratorType const &e) { return e.is_valid(); }
+  static void advance(EnumeratorType &e) { e.advance(); }
+};
+
+template <typename EnumeratorType>
+struct EnumeratorProtocol<
+    EnumeratorType,
+    std::void_t<decltype(std::declval<EnumeratorType const &>().is_finished()),
+                decltype(std::declval<EnumeratorType &>().advance())>> {
+  static bool is_valid(EnumeratorType const &e) { return !e.is_finished(); }
+  static void advance(EnumeratorType &e) { e.advance(); }
+};
+
+template <typename EnumeratorType>
+struct EnumeratorProtocol<
+    EnumeratorType,
+    std::void_t<decltype(std::declval<EnumeratorType const &>().valid()),
+                decltype(std::declval<EnumeratorType &>().next())>> {
+  static bool is_valid(EnumeratorType const &e) { return e.valid(); }
+  static void advance(EnumeratorType &e) { e.next(); }
+};
+
+/// \brief True if the current value of an enumerator is valid
+template <typename EnumeratorType>
+bool enumerator_is_valid(EnumeratorType const &enumerator) {
+  return EnumeratorProtocol<EnumeratorType>::is_valid(enumerator);
+}
+
+/// \brief Advance an enumerator to its next value
+template <typename EnumeratorType>
+void enumerator_advance(EnumeratorType &enumerator) {
+  EnumeratorProtocol<EnumeratorType>::advance(enumerator);
+}
+
+/// \brief Write the next values of an enumerator into `[first, first +
+///     size)`, and return the number written
+///
+/// \param enumerator An enumerator with a supported EnumeratorProtocol.
+/// \param first, size Values are copy assigned to existing elements, so
+///     storage held by the elements, such as DoF values, is reused from
+///     batch to batch.
+///
+/// \returns The number of values written. If less than `size`, the
+///     enumeration is complete.
+template <typename EnumeratorType, typename ValueType>
+Index next_batch(EnumeratorType &enumerator, ValueType *first, Index size) {
+  Index n = 0;
+  while (n < size && enumerator_is_valid(enumerator)) {
+    first[n] = enumerator.value();
+    enumerator_advance(enumerator);
+    ++n;
+  }
+  return n;
+}
+
+/// \brief Append up to `max_size` next values of an enumerator to `batch`,
+///     and return the number appended
+///
+/// \returns The number of values appended. If less than `max_size`, the
+///     enumeration is complete.
+template <typename EnumeratorType, typename ValueType>
+Index next_batch(EnumeratorType &enumerator, std::vector<ValueType> &batch,
+                 Index max_size) {
+  Index n = 0;
+  while (n < max_size && enumerator_is_valid(enumerator)) {
+    batch.push_back(enumerator.value());
+    enumerator_advance(enumerator);
+    ++n;
+  }
+  return n;
+}
+
+/// \brief Enumerates the values of an iterator range
+///
+/// Iterators must remain valid for the lifetime of the RangeEnumerator.
+template <typename IteratorType>
+class RangeEnumerator {
+ public:
+  typedef typename std::iterator_traits<IteratorType>::value_type value_type;
+
+  RangeEnumerator(IteratorType begin, IteratorType end)
+      : m_it(begin), m_end(end) {}
+
+  value_type const &value() const { return *m_it; }
+  bool is_valid() const { return m_it != m_end; }
+  void advance() { ++m_it; }
+
+ private:
+  IteratorType m_it;
+  IteratorType m_end;
+};
+
+/// \brief Make a RangeEnumerator
+template <typename IteratorType>
+RangeEnumerator<IteratorType> make_range_enumerator(IteratorType begin,
+                                                    IteratorType end) {
+  return RangeEnumerator<IteratorType>(begin, end);
+}
+
+/// \brief Enumerates the values written by a generator function
+///
+/// The generator is called once per value, as `bool generator(T &value)`,
+/// and writes the next value into `value`, or returns false if there are no
+/// more values. It may keep its state in captured variables, which gives
+/// generator style enumeration without a hand written state machine.
+template <typename T>
+class GeneratorEnumerator {
+ public:
+  typedef T value_type;
+
+  GeneratorEnumerator(std::function<bool(T &)> generator, T initial_value)
+      : m_generator(std::move(generator)), m_value(std::move(initial_value)) {
+    advance();
+  }
+
+  T const &value() const { return m_value; }
+  bool is_valid() const { return m_is_valid; }
+  void advance() { m_is_valid = m_generator(m_value); }
+
+ private:
+  std::function<bool(T &)> m_generator;
+  T m_value;
+  bool m_is_valid = false;
+};
+
+/// \brief Type erased enumerator of values of type T
+///
+/// An Enumerator<T> can hold any enumerator with a supported
+/// EnumeratorProtocol and a `value()` that returns `T const &`, so that
+/// pipelines, parallel drivers, and Python batch iterators can treat
+/// different enumerators uniformly. `next_batch` makes one virtual call
+/// per batch, with the per-value loop on the concrete enumerator type.
+///
+/// Example:
+/// \code
+/// Enumerator<Configuration> enumerator(
+///     ConfigEnumAllOccupations(background, sites));
+/// std::vector<Configuration> batch;
+/// while (enumerator.next_batch(batch, 256)) {
+///   ... use batch ...
+///   batch.clear();
+/// }
+/// \endcode
+template <typename T>
+class Enumerator {
+ public:
+  typedef T value_type;
+
+  template <typename EnumeratorType,
+            typename = std::enable_if_t<!std::is_same_v<
+                std::decay_t<EnumeratorType>, Enumerator<T>>>>
+  explicit Enumerator(EnumeratorType &&enumerator)
+      : m_impl(std::make_unique<Model<std::decay_t<EnumeratorType>>>(
+            std::forward<EnumeratorType>(enumerator))) {}
+
+  /// \brief The current value
+  T const &value() const { return m_impl->value(); }
+
+  /// \brief True if `value` is valid, false if no more valid values
+  bool is_valid() const { return m_impl->is_valid(); }
+
+  /// \brief Generate the next value
+  void advance() { m_impl->advance(); }
+
+  /// \brief Write the next values into `[first, first + size)`, and return
+  ///     the number written
+  Index next_batch(T *first, Index size) {
+    return m_impl->next_batch(first, size);
+  }
+
+  /// \brief Append up to `max_size` next values to `batch`, and return the
+  ///     number appended
+  Index next_batch(std::vector<T> &batch, Index max_size) {
+    return m_impl->next_batch(batch, max_size);
+  }
+
+ private:
+  struct Concept {
+    virtual ~Concept() {}
+    virtual T const &value() const = 0;
+    virtual bool is_valid() const = 0;
+    virtual void advance() = 0;
+    virtual Index next_batch(T *first, Index size) = 0;
+    virtual Index next_batch(std::vector<T> &batch, Index max_size) = 0;
+  };
+
+  template <typename EnumeratorType>
+  struct Model : public Concept {
+    explicit Model(EnumeratorType &&_enumerator)
+        : enumerator(std::move(_enumerator)) {}
+    explicit Model(EnumeratorType const &_enumerator)
+        : enumerator(_enumerator) {}
+
+    T const &value() const override { return enumerator.value(); }
+    bool is_valid() const override { return enumerator_is_valid(enumerator); }
+    void advance() override { enumerator_advance(enumerator); }
+    Index next_batch(T *first, Index size) override {
+      return config::next_batch(enumerator, first, size);
+    }
+    Index next_batch(std::vector<T> &batch, Index max_size) override {
+      return config::next_batch(enumerator, batch, max_size);
+    }
+
+    EnumeratorType enumerator;
+  };
+
+  std::unique_ptr<Concept> m_impl;
+};
+
+/// \brief Write the next values of an Enumerator into `[first, first +
+///     size)`, with one virtual call per batch
+template <typename T>
+Index next_batch(Enumerator<T> &enumerator, T *first, Index size) {
+  return enumerator.next_batch(first, size);
+}
+
+/// \brief Append up to `max_size` next values of an Enumerator to `batch`,
+///     with one virtual call per batch
+template <typename T>
+Index next_batch(Enumerator<T> &enumerator, std::vector<T> &batch,
+                 Index max_size) {
+  return enumerator.next_batch(batch, max_size);
+}
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -44,6 +44,17 @@ class MakeOccEventStructures {
   /// \brief Construct interpolated structure
   xtal::SimpleStructure operator()(double interpolation_factor) const;
 
+  /// \brief Deformed lattice vectors, as columns
+  Eigen::Matrix3d lat_column_mat() const;
+
+  /// \brief Atom names, in the order of coordinates columns
+  std::vector<std::string> const &atom_names() const;
+
+  /// \brief Construct Cartesian coordinates of the interpolated structures,
+  ///     as one array
+  Eigen::MatrixXd make_coords_batch(
+      std::vector<double> const &interpolation_factors) const;
+
  private:
   /// Ideal lattice
   Eigen::Matrix3d m_ideal_lat_column_mat;
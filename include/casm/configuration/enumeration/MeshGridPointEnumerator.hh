@@ -0,0 +1,206 @@
+#ifndef CASM_config_enum_MeshGridPointEnumerator
+#define CASM_config_enum_MeshGridPointEnumerator
+
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/global/definitions.hh"
+#include "casm/global/eigen.hh"
+
+namespace CASM {
+namespace irreps {
+class SubWedge;
+}
+
+namespace config {
+
+/// \brief Stores points in canonical form under a matrix representation of a
+///     group, to skip symmetrically equivalent points
+///
+/// The canonical form of a point `x` is the lexicographically greatest of
+/// `x` and `M * x` for all `M` in the representation, with coordinates
+/// compared up to an absolute tolerance. All images are found with one
+/// matrix-vector product against the stacked representation, and canonical
+/// points are stored in an ordered set, so a lookup is O(log(n)) rather than
+/// a search of all previous points.
+class CanonicalPointSet {
+ public:
+  /// \brief Constructor
+  explicit CanonicalPointSet(std::vector<Eigen::MatrixXd> const &rep,
+                             double abs_tol = TOL);
+
+  /// \brief Point dimension
+  Index dim() const;
+
+  /// \brief Return the canonical form of a point
+  Eigen::VectorXd make_canonical(Eigen::VectorXd const &x) const;
+
+  /// \brief Insert the canonical form of a point, and return true if no
+  ///     equivalent point was already present
+  bool insert(Eigen::VectorXd const &x);
+
+  /// \brief Number of distinct points inserted
+  Index size() const;
+
+ private:
+  struct Compare {
+    double tol;
+    bool operator()(Eigen::VectorXd const &A, Eigen::VectorXd const &B) const;
+  };
+
+  Index m_dim;
+
+  Compare m_compare;
+
+  /// Representation matrices, stacked as rows
+  Eigen::MatrixXd m_stacked_rep;
+
+  std::set<Eigen::VectorXd, Compare> m_canonical;
+};
+
+/// \brief Enumerate points in a meshgrid, or in the meshgrids along the
+///     edges of each SubWedge of an irreducible wedge
+///
+/// Gives the same points, in the same order, as the Python functions
+/// `meshgrid_points` and `irreducible_wedge_points`, with the first
+/// coordinate incremented fastest. Optionally, points equivalent to a
+/// previous point under a DoF space representation are skipped, using
+/// CanonicalPointSet.
+///
+/// Example:
+/// \code
+/// MeshGridPointEnumerator enumerator(xi);
+/// while (enumerator.is_valid()) {
+///   Eigen::VectorXd const &eta = enumerator.value();
+///   ...
+///   enumerator.advance();
+/// }
+/// \endcode
+class MeshGridPointEnumerator {
+ public:
+  /// \brief Constructor, for a meshgrid
+  explicit MeshGridPointEnumerator(
+      std::vector<Eigen::VectorXd> const &xi,
+      std::optional<std::vector<Eigen::MatrixXd>> const &dof_space_rep =
+          std::nullopt,
+      double abs_tol = TOL);
+
+  /// \brief Constructor, for an irreducible wedge
+  MeshGridPointEnumerator(
+      std::vector<irreps::SubWedge> const &irreducible_wedge,
+      Eigen::MatrixXd const &basis_inv, double stop, Index num,
+      bool trim_corners = true,
+      std::optional<std::vector<Eigen::MatrixXd>> const &dof_space_rep =
+          std::nullopt,
+      double abs_tol = TOL);
+
+  /// \brief Dimension of the points
+  Index dim() const;
+
+  /// \brief The current point
+  Eigen::VectorXd const &value() const;
+
+  /// \brief Index of the grid of the current point, i.e. the SubWedge index
+  Index grid_index() const;
+
+  /// \brief Generate the next point
+  void advance();
+
+  /// \brief Return true if `value` is valid, false if no more valid values
+  bool is_valid() const;
+
+  /// \brief Write the next points into the rows of `batch`, and return the
+  ///     number written
+  template <typename PointBatch, typename IndexBatch>
+  Index fill_batch(PointBatch &&batch, IndexBatch &&grid_index_batch);
+
+ private:
+  struct Grid {
+    /// Coordinates along each axis
+    std::vector<Eigen::VectorXd> xi;
+
+    /// If has_value, points are `trans_mat * x`, else `x`
+    std::optional<Eigen::MatrixXd> trans_mat;
+  };
+
+  void _init(std::optional<std::vector<Eigen::MatrixXd>> const &dof_space_rep);
+
+  /// Set m_value from m_counter; return false if it should be skipped
+  bool _set_value();
+
+  /// Increment m_counter, moving to the next grid when one is finished;
+  /// return false if there are no more points
+  bool _increment();
+
+  /// Advance to the next point that is not skipped, starting with the
+  /// current counter value
+  void _skip();
+
+  std::vector<Grid> m_grids;
+
+  Index m_dim;
+
+  /// If has_value, skip grid points with
+  /// `x.squaredNorm() / (stop * stop) > 1.0 + tol`
+  std::optional<double> m_trim_stop;
+
+  double m_tol;
+
+  std::optional<CanonicalPointSet> m_canonical;
+
+  Index m_grid_index;
+
+  std::vector<Index> m_counter;
+
+  Eigen::VectorXd m_x;
+
+  Eigen::VectorXd m_value;
+
+  bool m_is_valid;
+};
+
+/// \brief Return `num` evenly spaced values from `start` to `stop`,
+///     inclusive, as by `numpy.linspace`
+Eigen::VectorXd make_linspace(double start, double stop, Index num);
+
+// --- Inline definitions ---
+
+/// \brief Write the next points into the rows of `batch`, and return the
+///     number written
+///
+/// \param batch Points are written into rows, so `batch.cols()` must equal
+///     `dim()`
+/// \param grid_index_batch The grid index of each point is written, so its
+///     size must be at least `batch.rows()`
+///
+/// \returns n_written The number of rows written. If it is less than
+///     `batch.rows()`, the enumeration is complete.
+template <typename PointBatch, typename IndexBatch>
+Index MeshGridPointEnumerator::fill_batch(PointBatch &&batch,
+                                          IndexBatch &&grid_index_batch) {
+  if (batch.cols() != m_dim) {
+    throw std::runtime_error(
+        "Error in MeshGridPointEnumerator::fill_batch: batch.cols() != dim");
+  }
+  if (grid_index_batch.size() < batch.rows()) {
+    throw std::runtime_error(
+        "Error in MeshGridPointEnumerator::fill_batch: grid_index_batch is "
+        "too small");
+  }
+  Index n_written = 0;
+  while (n_written < batch.rows() && m_is_valid) {
+    batch.row(n_written) = m_value.transpose();
+    grid_index_batch(n_written) = m_grid_index;
+    ++n_written;
+    advance();
+  }
+  return n_written;
+}
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
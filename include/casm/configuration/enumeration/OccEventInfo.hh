@@ -1,6 +1,14 @@
 #ifndef CASM_config_enum_OccEventInfo
 #define CASM_config_enum_OccEventInfo
 
+#include <cstdint>
+#include <future>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
 #include "casm/configuration/Prim.hh"
 #include "casm/configuration/Supercell.hh"
 #include "casm/configuration/SupercellSymOp.hh"
@@ -69,6 +77,13 @@ struct OccEventSupercellInfo {
   /// such as when identifying symmetrically distinct local environments.
   std::vector<SupercellSymOp> supercellsymop_symgroup_rep;
 
+  /// \brief Finds canonical forms using supercellsymop_symgroup_rep
+  ///
+  /// The combined site permutations and occupant permutations of
+  /// supercellsymop_symgroup_rep are computed once, at construction, so that
+  /// local canonicalization is table-driven.
+  std::shared_ptr<CanonicalFormEngine const> canonical_form_engine;
+
   /// \brief Make canonical local environment configuration
   Configuration make_canonical_form(Configuration const &configuration) const;
 
@@ -94,22 +109,153 @@ struct OccEventSupercellInfo {
   /// clusters, using all equivalents of motif that fill the supercell
   std::set<Configuration> make_all_distinct_local_perturbations(
       Configuration const &motif,
-      std::vector<std::set<clust::IntegralCluster>> const &local_orbits) const;
+      std::vector<std::set<clust::IntegralCluster>> const &local_orbits,
+      Index n_threads = 1) const;
 
   /// \brief Generate local-cluster orbits and make configurations that are
   ///     distinct perturbations of local clusters, using all equivalents
   ///     of motif that fill the supercell
   std::set<Configuration> make_all_distinct_local_perturbations(
       Configuration const &motif,
-      std::set<clust::IntegralCluster> const &local_clusters) const;
+      std::set<clust::IntegralCluster> const &local_clusters,
+      Index n_threads = 1) const;
 
   /// \brief Generate local-cluster orbits and make configurations that are
   ///     distinct perturbations of sites within a cutoff radius of sites
   ///     in the event
   std::set<Configuration> make_all_distinct_local_perturbations(
-      Configuration const &motif, double cutoff_radius) const;
+      Configuration const &motif, double cutoff_radius,
+      Index n_threads = 1) const;
+};
+
+/// \brief Linear supercell site indices and occupation of every translation
+///     of every equivalent event in an orbit
+///
+/// Notes:
+/// - Sites are in the order given by `occ_events::make_cluster_occupation`
+///   for each equivalent event, so `sites` for translation 0 of equivalent
+///   `e` matches `OccEventSupercellInfo::sites` for
+///   `phenomenal_occevent[e]`.
+/// - Translations are in the order of `Supercell::unitcell_index_converter`.
+/// - Storage is row-major, so the tables can be wrapped as arrays of shape
+///   `(n_equivalents, n_translations, n_sites)` and
+///   `(n_equivalents, n_sites)` without copying.
+struct OccEventSiteIndexTable {
+  /// \brief Number of equivalent events
+  Index n_equivalents = 0;
+
+  /// \brief Number of translations, which is the supercell volume
+  Index n_translations = 0;
+
+  /// \brief Number of sites in each event
+  Index n_sites = 0;
+
+  /// \brief Linear supercell site index of site `s` of equivalent `e`
+  ///     translated by unit cell `l`, at
+  ///     `sites[(e * n_translations + l) * n_sites + s]`
+  std::vector<std::int32_t> sites;
+
+  /// \brief Initial occupation of site `s` of equivalent `e`, at
+  ///     `occ_init[e * n_sites + s]`
+  std::vector<std::int32_t> occ_init;
+
+  /// \brief Final occupation of site `s` of equivalent `e`, at
+  ///     `occ_final[e * n_sites + s]`
+  std::vector<std::int32_t> occ_final;
 };
 
+/// \brief Make linear supercell site indices and occupation for every
+///     translation of every equivalent event in an orbit
+OccEventSiteIndexTable make_occevent_site_index_table(
+    std::vector<occ_events::OccEvent> const &phenomenal_occevent,
+    Supercell const &supercell, Index n_threads = 1);
+
+/// \brief Default maximum number of OccEventSupercellInfo stored by an
+///     OccEventSupercellInfoCache
+constexpr Index DEFAULT_OCC_EVENT_SUPERCELL_INFO_CACHE_MAX_ENTRIES = 256;
+
+/// \brief Thread-safe, bounded cache of OccEventPrimInfo and
+///     OccEventSupercellInfo
+///
+/// Notes:
+/// - OccEventSupercellInfo are keyed by the prim, the supercell
+///   transformation matrix, and the event, so each translated or equivalent
+///   event in a supercell has its own entry, and all Supercell with the
+///   same transformation matrix share entries. They are kept, least
+///   recently used first out, while there are at most `max_entries`.
+/// - OccEventPrimInfo are keyed by the prim and the event. There is one
+///   for each distinct event, until `clear` is called.
+/// - Each value is constructed exactly once while it is stored: concurrent
+///   calls for the same key wait for the first to finish. Construction is
+///   done without holding the lock, so calls for other keys do not wait.
+/// - Values are returned as shared pointers, so they remain valid after
+///   being evicted.
+/// - If `max_entries` is 0, OccEventSupercellInfo are not stored.
+class OccEventSupercellInfoCache {
+ public:
+  /// \brief Constructor
+  explicit OccEventSupercellInfoCache(
+      Index _max_entries = DEFAULT_OCC_EVENT_SUPERCELL_INFO_CACHE_MAX_ENTRIES);
+
+  /// \brief Get OccEventPrimInfo, constructing it if not cached
+  std::shared_ptr<OccEventPrimInfo const> prim_info(
+      std::shared_ptr<Prim const> const &prim,
+      occ_events::OccEvent const &event);
+
+  /// \brief Get OccEventSupercellInfo, constructing it if not cached
+  std::shared_ptr<OccEventSupercellInfo const> supercell_info(
+      std::shared_ptr<Supercell const> const &supercell,
+      occ_events::OccEvent const &event);
+
+  /// \brief Maximum number of OccEventSupercellInfo stored
+  Index max_entries() const;
+
+  /// \brief Number of OccEventSupercellInfo stored
+  Index size() const;
+
+  /// \brief Number of calls to `supercell_info` that found a stored value
+  Index n_hits() const;
+
+  /// \brief Number of calls to `supercell_info` that constructed a value
+  Index n_misses() const;
+
+  /// \brief Remove all stored values
+  void clear();
+
+ private:
+  typedef std::pair<Prim const *, occ_events::OccEvent> prim_key_type;
+
+  typedef std::tuple<Prim const *, std::vector<long>, occ_events::OccEvent>
+      supercell_key_type;
+
+  typedef std::list<supercell_key_type> lru_list_type;
+
+  struct Entry {
+    std::shared_future<std::shared_ptr<OccEventSupercellInfo const>> value;
+    lru_list_type::iterator lru_position;
+  };
+
+  Index m_max_entries;
+
+  mutable std::mutex m_mutex;
+
+  std::map<prim_key_type,
+           std::shared_future<std::shared_ptr<OccEventPrimInfo const>>>
+      m_prim_entries;
+
+  /// Supercell keys, most recently used first
+  lru_list_type m_lru;
+
+  std::map<supercell_key_type, Entry> m_entries;
+
+  Index m_n_hits;
+
+  Index m_n_misses;
+};
+
+/// \brief Process-wide OccEventSupercellInfoCache
+OccEventSupercellInfoCache &occ_event_supercell_info_cache();
+
 }  // namespace config
 }  // namespace CASM
 
@@ -0,0 +1,209 @@
+#ifndef CASM_config_enum_OccupationFilter
+#define CASM_config_enum_OccupationFilter
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/configuration/enumeration/ConfigurationFilter.hh"
+#include "casm/global/eigen.hh"
+
+namespace CASM {
+namespace config {
+
+struct Configuration;
+
+/// \brief Cheap predicates on the occupation of configurations in one
+///     supercell, which can be applied to batches of packed occupation
+///     vectors
+///
+/// Predicates are added with the `require_*` methods, which return `*this`
+/// so they can be chained, and a configuration passes if it satisfies all
+/// of them:
+/// - `require_occupant_count`: the number of sites on a sublattice with a
+///   particular occupant is in a range, which bounds the composition per
+///   sublattice.
+/// - `require_n_changed_sites`: the number of sites with occupation
+///   different from a background configuration is in a range, which bounds
+///   the number of defects.
+/// - `require_allowed_occupants`: each site in a subset has one of the
+///   allowed occupants.
+///
+/// Notes:
+/// - Each occupation vector is checked in one pass over its sites, using
+///   tables made when predicates are added, so a filter is much cheaper than
+///   constructing a Configuration and calling a user callback. Use it to
+///   reject most candidates first, so only the survivors reach more
+///   expensive filters.
+/// - As a ConfigurationFilter it makes no primitive or canonical guarantee,
+///   and can be combined with other filters using
+///   ChainedConfigurationFilter.
+/// - Const methods are safe to call concurrently.
+class OccupationFilter : public ConfigurationFilter {
+ public:
+  /// \brief Constructor, with no predicates
+  explicit OccupationFilter(std::shared_ptr<Supercell const> const &_supercell);
+
+  /// \brief The supercell
+  std::shared_ptr<Supercell const> const &supercell() const;
+
+  /// \brief Require that the number of sites on a sublattice with an
+  ///     occupant is in `[min_count, max_count]`
+  OccupationFilter &require_occupant_count(Index sublattice_index,
+                                           Index occupant_index,
+                                           Index min_count, Index max_count);
+
+  /// \brief Require that the number of sites with occupation different from
+  ///     `background_occupation` is in `[min_count, max_count]`
+  OccupationFilter &require_n_changed_sites(
+      Eigen::VectorXi const &background_occupation, Index min_count,
+      Index max_count);
+
+  /// \brief Require that each site in `sites` has one of `allowed_occupants`
+  OccupationFilter &require_allowed_occupants(
+      std::set<Index> const &sites, std::set<int> const &allowed_occupants);
+
+  /// \brief Return true if an occupation vector satisfies all predicates
+  template <typename Derived>
+  bool is_allowed(Eigen::MatrixBase<Derived> const &occupation) const;
+
+  /// \brief Return true if the configuration occupation satisfies all
+  ///     predicates
+  bool operator()(Configuration const &configuration) const override;
+
+  bool primitive_guarantee() const override { return false; }
+
+  bool canonical_guarantee() const override { return false; }
+
+  /// \brief Move the rows of a batch of occupation vectors which satisfy all
+  ///     predicates to the front, in order, and return how many there are
+  template <typename Derived>
+  Index compact(Eigen::MatrixBase<Derived> &batch, Index n_rows) const;
+
+ private:
+  std::shared_ptr<Supercell const> m_supercell;
+
+  Index m_n_sites;
+
+  /// Number of occupant slots per sublattice in m_bound_index
+  Index m_n_occ_max;
+
+  /// m_slot_begin[l] = sublattice_index(l) * m_n_occ_max
+  std::vector<Index> m_slot_begin;
+
+  /// Index into m_count_bounds, by (sublattice, occupant) slot, or -1 if
+  /// the occupant count is not bounded
+  std::vector<Index> m_bound_index;
+
+  /// Occupant count bounds, as (min_count, max_count)
+  std::vector<std::array<Index, 2>> m_count_bounds;
+
+  /// If true, check the number of changed sites
+  bool m_check_changed;
+
+  Eigen::VectorXi m_background_occupation;
+
+  Index m_min_changed;
+
+  Index m_max_changed;
+
+  /// If true, check m_allowed_mask
+  bool m_check_allowed;
+
+  /// Allowed occupants, as a bitmask by site. All bits are set for sites
+  /// without constraints.
+  std::vector<unsigned long long> m_allowed_mask;
+};
+
+// --- Inline definitions ---
+
+/// \brief Return true if an occupation vector satisfies all predicates
+///
+/// \param occupation An occupation vector, as a row or column of any integer
+///     type, with size equal to the number of sites in the supercell.
+template <typename Derived>
+bool OccupationFilter::is_allowed(
+    Eigen::MatrixBase<Derived> const &occupation) const {
+  if (occupation.size() != m_n_sites) {
+    throw std::runtime_error(
+        "Error in OccupationFilter: occupation size does not match supercell");
+  }
+  // counts by bound index, on the stack for the usual small number of bounds
+  Index const n_bounds = m_count_bounds.size();
+  std::array<Index, 32> stack_counts;
+  std::vector<Index> heap_counts;
+  Index *counts = stack_counts.data();
+  if (n_bounds > Index(stack_counts.size())) {
+    heap_counts.resize(n_bounds);
+    counts = heap_counts.data();
+  }
+  std::fill(counts, counts + n_bounds, Index(0));
+
+  Index n_changed = 0;
+  for (Index l = 0; l < m_n_sites; ++l) {
+    int occ = static_cast<int>(occupation(l));
+    if (m_check_allowed &&
+        (occ < 0 || occ >= 64 || !((m_allowed_mask[l] >> occ) & 1ULL))) {
+      return false;
+    }
+    if (m_check_changed && occ != m_background_occupation(l)) {
+      if (++n_changed > m_max_changed) {
+        return false;
+      }
+    }
+    if (n_bounds && occ >= 0 && occ < m_n_occ_max) {
+      Index i_bound = m_bound_index[m_slot_begin[l] + occ];
+      if (i_bound >= 0) {
+        ++counts[i_bound];
+      }
+    }
+  }
+  if (m_check_changed && n_changed < m_min_changed) {
+    return false;
+  }
+  for (Index i = 0; i < n_bounds; ++i) {
+    if (counts[i] < m_count_bounds[i][0] || counts[i] > m_count_bounds[i][1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Move the rows of a batch of occupation vectors which satisfy all
+///     predicates to the front, in order, and return how many there are
+///
+/// \param batch Occupation vectors, one per row, as from
+///     `fill_occupation_batch`
+/// \param n_rows Number of leading rows of `batch` which are checked
+///
+/// \returns n_allowed The number of rows which satisfy all predicates, which
+///     are now rows `[0, n_allowed)` of `batch`. The contents of the other
+///     checked rows are unspecified.
+template <typename Derived>
+Index OccupationFilter::compact(Eigen::MatrixBase<Derived> &batch,
+                                Index n_rows) const {
+  if (n_rows > batch.rows()) {
+    throw std::runtime_error(
+        "Error in OccupationFilter::compact: n_rows > batch.rows()");
+  }
+  Index n_allowed = 0;
+  for (Index i = 0; i < n_rows; ++i) {
+    if (!is_allowed(batch.row(i))) {
+      continue;
+    }
+    if (n_allowed != i) {
+      batch.row(n_allowed) = batch.row(i);
+    }
+    ++n_allowed;
+  }
+  return n_allowed;
+}
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef CASM_config_enum_PerturbationDeltaSet
+#define CASM_config_enum_PerturbationDeltaSet
+
+#include <functional>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationDelta.hh"
+#include "casm/configuration/definitions.hh"
+#include "casm/global/filesystem.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Return the occupation of `configuration` relative to `background`
+SparseOccupation make_occupation_delta(Configuration const &background,
+                                       Configuration const &configuration);
+
+/// \brief Return a copy of `background` with `delta` applied
+Configuration apply_occupation_delta(Configuration const &background,
+                                     SparseOccupation const &delta);
+
+/// \brief A set of distinct configurations that differ from a shared
+///     background only in occupation, stored as SparseOccupation, with a
+///     memory budget
+///
+/// Notes:
+/// - Configurations are stored as the occupation changes relative to the
+///   background, so a perturbation of a few sites takes a few pairs rather
+///   than a full copy of the DoF values. Configurations that are not in the
+///   background supercell, or that have continuous DoF values that differ
+///   from the background, cannot be stored and cause `insert` to throw.
+/// - When the estimated memory used by the stored deltas exceeds
+///   `memory_budget`, they are written to a file as a sorted run and
+///   cleared. Run files are written in a directory with a unique name,
+///   created in `spill_dir` on the first spill and removed on destruction,
+///   so sets in different threads or processes may share `spill_dir`. `for_each` merges the runs and the deltas
+///   still in memory, removing duplicates, and rebuilds each distinct
+///   configuration only as it is passed on.
+/// - Distinct configurations are visited in SparseOccupation order, which is
+///   generally not the `Configuration` order of `std::set<Configuration>`.
+/// - Run files are removed by `clear` and by the destructor.
+class PerturbationDeltaSet {
+ public:
+  /// \brief Constructor
+  PerturbationDeltaSet(Configuration const &_background,
+                       std::optional<Index> _memory_budget = std::nullopt,
+                       std::optional<fs::path> _spill_dir = std::nullopt);
+
+  PerturbationDeltaSet(PerturbationDeltaSet const &) = delete;
+  PerturbationDeltaSet &operator=(PerturbationDeltaSet const &) = delete;
+
+  ~PerturbationDeltaSet();
+
+  /// \brief The shared background configuration
+  Configuration const &background() const { return m_background; }
+
+  /// \brief Insert a configuration, stored relative to the background
+  void insert(Configuration const &configuration);
+
+  /// \brief Insert an occupation delta
+  void insert(SparseOccupation delta);
+
+  /// \brief Estimated bytes used by the deltas held in memory
+  Index memory_used() const { return m_memory_used; }
+
+  /// \brief Number of sorted runs written to disk
+  Index n_runs() const { return m_runs.size(); }
+
+  /// \brief Call `f` with each distinct occupation delta, in order
+  void for_each_delta(std::function<void(SparseOccupation const &)> f) const;
+
+  /// \brief Call `f` with each distinct configuration, in SparseOccupation
+  ///     order
+  void for_each(std::function<void(Configuration const &)> f) const;
+
+  /// \brief Number of distinct configurations
+  Index size() const;
+
+  /// \brief Copy the distinct configurations into an ordered set
+  std::set<Configuration> to_set() const;
+
+  /// \brief Remove all configurations and run files
+  void clear();
+
+ private:
+  void _spill();
+
+  Configuration m_background;
+
+  std::optional<Index> m_memory_budget;
+
+  fs::path m_spill_dir;
+
+  /// Directory holding this set's run files, created with a unique name in
+  /// `m_spill_dir` on the first spill, or empty
+  fs::path m_run_dir;
+
+  std::set<SparseOccupation> m_deltas;
+
+  Index m_memory_used;
+
+  std::vector<fs::path> m_runs;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
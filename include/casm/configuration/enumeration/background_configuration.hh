@@ -43,6 +43,24 @@ Configuration make_canonical_form(
     std::vector<int> const &occ_init, std::vector<int> const &occ_final,
     std::vector<SupercellSymOp> const &event_group);
 
+/// \brief Make the canonical form for a configuration in the context
+///    of an occupation event, using precomputed event group permutations
+Configuration make_canonical_form(
+    Configuration const &configuration, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    CanonicalFormEngine const &event_group_engine);
+
+/// \brief Make the canonical forms of many configurations, each in the
+///     context of one of a set of occupation events, in parallel
+std::vector<Configuration> make_canonical_forms(
+    std::vector<Configuration> const &configurations,
+    std::vector<Index> const &event_index,
+    std::vector<std::vector<Index>> const &event_sites,
+    std::vector<std::vector<int>> const &occ_init,
+    std::vector<std::vector<int>> const &occ_final,
+    std::vector<std::vector<SupercellSymOp>> const &event_groups,
+    Index n_threads = 1);
+
 /// \brief Make all configurations, equivalent as infinite crystals under prim
 ///     factor group operations, that fit into the same supercell, but are
 ///     inequivalent under the action of a local group.
@@ -51,7 +69,17 @@ std::set<Configuration> make_distinct_background_configurations(
     std::shared_ptr<Supercell const> const &supercell,
     std::vector<Index> const &event_sites, std::vector<int> const &occ_init,
     std::vector<int> const &occ_final,
-    std::vector<SupercellSymOp> const &event_group);
+    std::vector<SupercellSymOp> const &event_group,
+    Index n_threads = 1);
+
+/// \brief Make all configurations, equivalent as infinite crystals under prim
+///     factor group operations, that fit into the same supercell, but are
+///     inequivalent under the action of a local group, using precomputed
+///     event group permutations
+std::set<Configuration> make_distinct_background_configurations(
+    Configuration const &motif, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    CanonicalFormEngine const &event_group_engine, Index n_threads = 1);
 
 }  // namespace config
 }  // namespace CASM
@@ -0,0 +1,56 @@
+#ifndef CASM_config_enum_count_occupations
+#define CASM_config_enum_count_occupations
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Number of symmetrically distinct occupations of a supercell
+///
+/// Counts are exact, and may exceed the range of Index, so they are given
+/// as decimal integer strings.
+struct DistinctOccupationCount {
+  /// \brief Sublattices in each orbit of sublattices under the supercell
+  ///     factor group
+  std::vector<std::vector<Index>> sublattice_orbits;
+
+  /// \brief Number of allowed occupants on the sublattices of each orbit
+  std::vector<Index> n_occupants;
+
+  /// \brief Number of supercell sites in each orbit
+  std::vector<Index> n_sites;
+
+  /// \brief Number of supercell operations, `n_fg * n_translations`
+  Index group_order = 0;
+
+  /// \brief Number of distinct cycle types of the supercell operations
+  Index n_cycle_types = 0;
+
+  /// \brief Number of distinct occupations
+  std::string total;
+
+  /// \brief Number of distinct occupations, by composition, if requested
+  ///
+  /// Keys are the number of sites with each occupant, by sublattice orbit,
+  /// concatenated: the count of occupant `k` on the sites of orbit `o` is
+  /// `key[n_occupants[0] + ... + n_occupants[o-1] + k]`. Compositions with
+  /// no occupations are not included.
+  std::map<std::vector<Index>, std::string> by_composition;
+};
+
+/// \brief Count the symmetrically distinct occupations of a supercell,
+///     without enumerating them
+DistinctOccupationCount count_distinct_occupations(
+    std::shared_ptr<Supercell const> const &supercell,
+    bool by_composition = false, Index n_threads = 1);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef CASM_config_enum_enumerate_supercells
+#define CASM_config_enum_enumerate_supercells
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Enumerate symmetrically distinct supercells, as transformation
+///     matrices to canonical superlattices
+std::vector<Eigen::Matrix3l> enumerate_canonical_transformation_matrices(
+    std::shared_ptr<Prim const> const &prim, Index max_volume,
+    Index min_volume = 1, std::string dirs = std::string("abc"),
+    Eigen::Matrix3i const &unit_cell = Eigen::Matrix3i::Identity(),
+    bool diagonal_only = false, bool fixed_shape = false,
+    Index n_threads = 1);
+
+/// \brief Enumerate symmetrically distinct supercells, in canonical form
+std::vector<std::shared_ptr<Supercell const>> enumerate_canonical_supercells(
+    std::shared_ptr<Prim const> const &prim, Index max_volume,
+    Index min_volume = 1, std::string dirs = std::string("abc"),
+    Eigen::Matrix3i const &unit_cell = Eigen::Matrix3i::Identity(),
+    bool diagonal_only = false, bool fixed_shape = false,
+    Index n_threads = 1);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
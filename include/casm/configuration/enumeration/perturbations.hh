@@ -1,7 +1,12 @@
 #ifndef CASM_config_enum_perturbations
 #define CASM_config_enum_perturbations
 
+#include "casm/configuration/ConfigurationHashSet.hh"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/OrbitsAsIndices.hh"
 #include "casm/configuration/definitions.hh"
+#include "casm/configuration/enumeration/PerturbationDeltaSet.hh"
+#include "casm/configuration/sym_info/definitions.hh"
 
 namespace CASM {
 namespace config {
@@ -12,10 +17,39 @@ std::set<std::set<Index>> make_distinct_cluster_sites(
     Configuration const &background,
     std::vector<std::set<std::set<Index>>> const &orbits_as_indices);
 
+/// \brief Make the distinct clusters of sites, taking into account the
+///     background configuration symmetry
+std::set<std::set<Index>> make_distinct_cluster_sites(
+    Configuration const &background,
+    clust::OrbitsAsIndices const &orbits_as_indices);
+
 /// \brief Make configurations that are distinct occupation perturbations
 std::set<Configuration> make_distinct_perturbations(
     Configuration const &background,
-    std::set<std::set<Index>> const &distinct_cluster_sites);
+    std::set<std::set<Index>> const &distinct_cluster_sites,
+    Index n_threads = 1);
+
+/// \brief Make configurations that are distinct occupation perturbations,
+///     collected in a ConfigurationHashSet
+ConfigurationHashSet make_distinct_perturbations_hash_set(
+    Configuration const &background,
+    std::set<std::set<Index>> const &distinct_cluster_sites,
+    Index n_threads = 1);
+
+/// \brief Insert configurations that are distinct occupation perturbations
+///     into a PerturbationDeltaSet
+void insert_distinct_perturbations(
+    Configuration const &background,
+    std::set<std::set<Index>> const &distinct_cluster_sites,
+    PerturbationDeltaSet &distinct_perturbations);
+
+/// \brief Make configurations that are distinct occupation perturbations of
+///     every distinct background that a motif generates in a supercell
+std::set<Configuration> make_all_distinct_periodic_perturbations(
+    std::shared_ptr<Supercell const> const &supercell,
+    Configuration const &motif,
+    std::vector<std::set<clust::IntegralCluster>> const &orbits,
+    Index n_threads = 1);
 
 /// \brief Make the distinct clusters of sites, taking into account the
 ///     event group, supercell, and background configuration symmetry
@@ -25,6 +59,28 @@ std::set<std::set<Index>> make_distinct_local_cluster_sites(
     std::vector<SupercellSymOp> const &event_group,
     std::vector<std::set<std::set<Index>>> const &local_orbits_as_indices);
 
+/// \brief Make the distinct clusters of sites, taking into account the
+///     event group, supercell, and background configuration symmetry
+std::set<std::set<Index>> make_distinct_local_cluster_sites(
+    Configuration const &background, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group,
+    clust::OrbitsAsIndices const &local_orbits_as_indices);
+
+/// \brief Make the site index permutations that transform clusters of sites
+///     while leaving the background configuration and event invariant
+std::vector<sym_info::Permutation> make_local_cluster_sites_group_rep(
+    Configuration const &background, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group);
+
+/// \brief Make the distinct clusters of sites, given the site index
+///     permutations that leave the background configuration and event
+///     invariant
+std::set<std::set<Index>> make_distinct_local_cluster_sites(
+    std::vector<sym_info::Permutation> const &indices_group_rep,
+    clust::OrbitsAsIndices const &local_orbits_as_indices);
+
 /// \brief Make configurations that are distinct local occupation perturbations
 std::set<Configuration> make_distinct_local_perturbations(
     Configuration const &background, std::vector<Index> const &event_sites,
@@ -32,6 +88,23 @@ std::set<Configuration> make_distinct_local_perturbations(
     std::vector<SupercellSymOp> const &event_group,
     std::set<std::set<Index>> const &distinct_local_cluster_sites);
 
+/// \brief Make configurations that are distinct local occupation
+///     perturbations, collected in a ConfigurationHashSet
+ConfigurationHashSet make_distinct_local_perturbations_hash_set(
+    Configuration const &background, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group,
+    std::set<std::set<Index>> const &distinct_local_cluster_sites);
+
+/// \brief Insert configurations that are distinct local occupation
+///     perturbations into a PerturbationDeltaSet
+void insert_distinct_local_perturbations(
+    Configuration const &background, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group,
+    std::set<std::set<Index>> const &distinct_local_cluster_sites,
+    PerturbationDeltaSet &distinct_local_perturbations);
+
 }  // namespace config
 }  // namespace CASM
 
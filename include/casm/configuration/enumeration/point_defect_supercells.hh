@@ -0,0 +1,89 @@
+#ifndef CASM_config_enum_point_defect_supercells
+#define CASM_config_enum_point_defect_supercells
+
+#include <memory>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Score of a superlattice for point defect calculations
+///
+/// Only lattice data is used, so no Supercell is constructed.
+struct PointDefectSuperlatticeScore {
+  /// Transformation matrix, `T`, such that `S = L * T`
+  Eigen::Matrix3l transformation_matrix_to_super;
+
+  /// Number of unit cells, `|det(T)|`
+  Index n_unitcells;
+
+  /// Size of the supercell factor group
+  Index factor_group_size;
+
+  /// Radius of the largest sphere that fits in the superlattice Voronoi
+  /// cell, which measures the minimum periodic image distance
+  double voronoi_inner_radius;
+};
+
+/// \brief Return an upper bound on the superlattice Voronoi inner radius
+double point_defect_voronoi_inner_radius_bound(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super);
+
+/// \brief Score a superlattice for point defect calculations
+PointDefectSuperlatticeScore make_point_defect_superlattice_score(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super);
+
+/// \brief Score superlattices for point defect calculations, in parallel
+std::vector<PointDefectSuperlatticeScore>
+make_point_defect_superlattice_scores(
+    std::shared_ptr<Prim const> const &prim,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices,
+    Index min_factor_group_size = 0, double min_voronoi_inner_radius = 0.0,
+    Index n_threads = 1);
+
+/// \brief Return the indices of Pareto-optimal points, maximizing Voronoi
+///     inner radius and minimizing number of unit cells
+std::vector<Index> make_point_defect_pareto_indices(
+    std::vector<Index> const &n_unitcells,
+    std::vector<double> const &voronoi_inner_radius,
+    std::vector<bool> const &is_candidate, double tol = 1e-5);
+
+/// \brief Find the Pareto-optimal superlattices for point defect
+///     calculations
+std::vector<PointDefectSuperlatticeScore>
+find_pareto_point_defect_superlattices(
+    std::shared_ptr<Prim const> const &prim,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices,
+    Index min_factor_group_size = 0, double min_voronoi_inner_radius = 0.0,
+    double tol = 1e-5, Index n_threads = 1);
+
+/// \brief Return true if a superlattice is left invariant by each of the
+///     required prim factor group operations
+bool has_required_operations(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super,
+    std::vector<Index> const &required_operations);
+
+/// \brief Return true if a superlattice has each set of required sites
+///     without periodic image overlap
+bool has_required_sites(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super,
+    std::vector<std::vector<xtal::UnitCellCoord>> const &required_sites);
+
+/// \brief Make the equivalent supercells whose factor group includes the
+///     required operations
+std::vector<std::shared_ptr<Supercell const>>
+make_equivalent_supercells_with_required_operations(
+    Supercell const &supercell, std::vector<Index> const &required_operations,
+    Index n_threads = 1);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
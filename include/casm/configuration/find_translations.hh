@@ -0,0 +1,31 @@
+#ifndef CASM_config_find_translations
+#define CASM_config_find_translations
+
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+struct Configuration;
+
+/// \brief Return the number of sites with equal occupation after each
+///     supercell translation
+std::vector<Index> make_translation_occupation_overlap(
+    Configuration const &from, Configuration const &to);
+
+/// \brief Return the indices of the supercell translations that map the
+///     occupation of one configuration onto another
+std::vector<Index> find_occupation_translation_indices(
+    Configuration const &from, Configuration const &to);
+
+/// \brief Return the indices of the supercell translations that map one
+///     configuration onto another
+std::vector<Index> find_translation_indices(Configuration const &from,
+                                            Configuration const &to);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -3,8 +3,10 @@
 
 #include <memory>
 #include <set>
+#include <unordered_map>
 
 #include "casm/configuration/group/definitions.hh"
+#include "casm/configuration/parallel.hh"
 #include "casm/misc/algorithm.hh"
 
 namespace CASM {
@@ -83,6 +85,43 @@ Group<ElementType> make_group(
     MultiplyFunctionType multiply_f = MultiplyFunctionType(),
     EqualToFunctionType equal_to_f = EqualToFunctionType());
 
+/// \brief Finds the index of an element, using a hash to find candidates
+///
+/// Elements with equal hash values are candidates, and are checked with
+/// `equal_to_f` in order. If none are equal, all elements are checked, so
+/// the hash function only needs to give equal values for equal elements
+/// most of the time, for example by rounding values to bins much wider than
+/// the comparison tolerance. The result is the same as a search of all
+/// elements in order, unless two elements are equal to the value.
+///
+/// Const methods are safe to call concurrently.
+template <typename ElementType, typename EqualToFunctionType,
+          typename HashFunctionType>
+class HashedElementIndex {
+ public:
+  /// \brief Constructor
+  HashedElementIndex(std::vector<ElementType> const &_element,
+                     EqualToFunctionType _equal_to_f,
+                     HashFunctionType _hash_f);
+
+  /// \brief Return the index of the first element equal to `value`, or -1
+  Index find(ElementType const &value) const;
+
+ private:
+  std::vector<ElementType> const &m_element;
+  EqualToFunctionType m_equal_to_f;
+  HashFunctionType m_hash_f;
+  std::unordered_multimap<std::size_t, Index> m_index;
+};
+
+/// \brief Make a group, using a hash to find products, in parallel
+template <typename ElementType, typename MultiplyFunctionType,
+          typename EqualToFunctionType, typename HashFunctionType>
+Group<ElementType> make_group(std::vector<ElementType> const &element,
+                              MultiplyFunctionType multiply_f,
+                              EqualToFunctionType equal_to_f,
+                              HashFunctionType hash_f, Index n_threads = 1);
+
 /// \brief Determine conjugacy classes
 template <typename ElementType>
 std::vector<std::vector<Index>> make_conjugacy_classes(
@@ -93,6 +132,8 @@ std::vector<std::vector<Index>> make_conjugacy_classes(
 
 // --- Implementation ---
 
+#include <algorithm>
+#include <exception>
 #include <numeric>
 
 namespace CASM {
@@ -134,28 +175,30 @@ MultiplicationTable _make_subgroup_multiplication_table(
     }
   }
 
+  // subgroup_position[i]: position of head group element i in the
+  // subgroup, or -1 if not included
+  std::vector<Index> subgroup_position(N, -1);
+  Index position = 0;
+  for (Index index : _head_group_index) {
+    subgroup_position[index] = position++;
+  }
+
   Index row = 0;
-  for (Index i = 0; i < N; ++i) {
+  for (Index i : _head_group_index) {
     if (head_group_table[i].size() != N) {
       throw std::runtime_error(
           "Error in Group constructor: head group multiplication table is not "
           "square");
     }
-    if (!_head_group_index.count(i)) {
-      continue;
-    }
 
-    for (Index j = 0; j < N; ++j) {
-      if (!_head_group_index.count(j)) {
-        continue;
-      }
-      auto it = _head_group_index.find(head_group_table[i][j]);
-      if (it == _head_group_index.end()) {
+    result[row].reserve(_head_group_index.size());
+    for (Index j : _head_group_index) {
+      Index subgroup_entry = subgroup_position[head_group_table[i][j]];
+      if (subgroup_entry == -1) {
         throw std::runtime_error(
             "Error in Group constructor: subgroup is not closed according to "
             "the head group multiplication table.");
       }
-      Index subgroup_entry = std::distance(_head_group_index.begin(), it);
       result[row].push_back(subgroup_entry);
     }
 
@@ -281,6 +324,91 @@ Group<ElementType> make_group(std::vector<ElementType> const &element,
   return Group<ElementType>(element, multiplication_table);
 }
 
+/// \brief Constructor
+///
+/// \param _element Elements to find. A reference is kept, so it must remain
+///     valid for the lifetime of this object.
+/// \param _equal_to_f Checks if two elements are equal
+/// \param _hash_f Returns a hash value for an element
+template <typename ElementType, typename EqualToFunctionType,
+          typename HashFunctionType>
+HashedElementIndex<ElementType, EqualToFunctionType, HashFunctionType>::
+    HashedElementIndex(std::vector<ElementType> const &_element,
+                       EqualToFunctionType _equal_to_f,
+                       HashFunctionType _hash_f)
+    : m_element(_element), m_equal_to_f(_equal_to_f), m_hash_f(_hash_f) {
+  m_index.reserve(m_element.size());
+  for (Index i = 0; i < m_element.size(); ++i) {
+    m_index.emplace(m_hash_f(m_element[i]), i);
+  }
+}
+
+/// \brief Return the index of the first element equal to `value`, or -1
+template <typename ElementType, typename EqualToFunctionType,
+          typename HashFunctionType>
+Index HashedElementIndex<ElementType, EqualToFunctionType,
+                         HashFunctionType>::find(ElementType const &value)
+    const {
+  auto range = m_index.equal_range(m_hash_f(value));
+  Index found = -1;
+  for (auto it = range.first; it != range.second; ++it) {
+    if ((found == -1 || it->second < found) &&
+        m_equal_to_f(m_element[it->second], value)) {
+      found = it->second;
+    }
+  }
+  if (found != -1) {
+    return found;
+  }
+  for (Index i = 0; i < m_element.size(); ++i) {
+    if (m_equal_to_f(m_element[i], value)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/// \brief Make a group, using a hash to find products, in parallel
+///
+/// Gives the same result as `make_group(element, multiply_f, equal_to_f)`,
+/// but each product is found with a HashedElementIndex lookup instead of a
+/// search of all elements, and multiplication table rows are found in
+/// parallel.
+///
+/// \param element Group elements
+/// \param multiply_f Multiplies elements
+/// \param equal_to_f Checks if two elements are equal
+/// \param hash_f Returns a hash value for an element, as for
+///     HashedElementIndex
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `config::set_num_threads`. The functions must
+///     be safe to call concurrently.
+template <typename ElementType, typename MultiplyFunctionType,
+          typename EqualToFunctionType, typename HashFunctionType>
+Group<ElementType> make_group(std::vector<ElementType> const &element,
+                              MultiplyFunctionType multiply_f,
+                              EqualToFunctionType equal_to_f,
+                              HashFunctionType hash_f, Index n_threads) {
+  Index size = element.size();
+  HashedElementIndex<ElementType, EqualToFunctionType, HashFunctionType> index(
+      element, equal_to_f, hash_f);
+  MultiplicationTable multiplication_table(size);
+  config::parallel_for_items(size, n_threads, [&](Index i) {
+    std::vector<Index> &row = multiplication_table[i];
+    row.reserve(size);
+    for (Index j = 0; j < size; ++j) {
+      Index k = index.find(multiply_f(element[i], element[j]));
+      if (k == -1) {
+        throw std::runtime_error(
+            "Error in CASM::group::make_group: Failed to construct "
+            "multiplication table");
+      }
+      row.push_back(k);
+    }
+  });
+  return Group<ElementType>(element, multiplication_table);
+}
+
 /// \brief Determine conjugacy classes
 ///
 /// \returns conjugacy_classes, where conjugacy_classes[i] is a vector of
@@ -0,0 +1,106 @@
+#ifndef CASM_group_StabilizerChain
+#define CASM_group_StabilizerChain
+
+#include <vector>
+
+#include "casm/configuration/group/definitions.hh"
+
+namespace CASM {
+namespace group {
+
+/// \brief A base and strong generating set (BSGS) for a group of
+///     permutations of the points `[0, n_points)`
+///
+/// Notes:
+/// - A permutation `p` maps point `x` to `p[x]`, and permutations compose
+///   as functions, so `(p * q)[x] == p[q[x]]`.
+/// - The base is increasing. Level `i` holds the stabilizer of all points
+///   less than `base_point(i)`, which moves `base_point(i)`, and the orbit
+///   of `base_point(i)` under that stabilizer, as a Schreier vector.
+///   Because every point less than `base_point(i)` is fixed at level `i`,
+///   a search over the chain visits points in increasing order, as needed
+///   to find lexicographically extreme images.
+/// - Use `insert` to add elements. The group order is the product of the
+///   orbit sizes once the chain is complete. `insert` sifts an element and
+///   extends the chain only if the element is not already generated, so
+///   inserting random group elements until `order()` equals a known group
+///   order gives a complete chain (the randomized Schreier-Sims algorithm).
+class StabilizerChain {
+ public:
+  typedef std::vector<Index> Permutation;
+
+  /// \brief Constructor, the trivial group
+  explicit StabilizerChain(Index _n_points);
+
+  /// \brief Number of points permuted
+  Index n_points() const { return m_n_points; }
+
+  /// \brief Add an element, extending the chain if the element is not
+  ///     already in the group it generates
+  bool insert(Permutation const &element);
+
+  /// \brief Return true if `element` is in the group generated so far
+  bool contains(Permutation const &element) const;
+
+  /// \brief Group order, the product of the level orbit sizes
+  Index order() const;
+
+  /// \brief Number of levels, the size of the base
+  Index n_levels() const { return m_levels.size(); }
+
+  /// \brief Base point of level `i`
+  Index base_point(Index i) const { return m_levels[i].base_point; }
+
+  /// \brief Orbit of `base_point(i)` under the level `i` stabilizer
+  std::vector<Index> const &orbit(Index i) const { return m_levels[i].orbit; }
+
+  /// \brief Return the transversal element of level `i` that maps
+  ///     `base_point(i)` to `point`
+  Permutation transversal(Index i, Index point) const;
+
+  /// \brief Strong generators
+  std::vector<Permutation> const &generators() const { return m_generators; }
+
+ private:
+  struct Level {
+    Index base_point;
+
+    /// Points in the orbit, in the order found
+    std::vector<Index> orbit;
+
+    /// `parent[x]` is the orbit point that generator `edge[x]` maps to `x`,
+    /// or -1 if `x` is not in the orbit or is the base point
+    std::vector<Index> parent;
+
+    std::vector<Index> edge;
+  };
+
+  /// \brief Sift `element` through the chain, returning the residue and
+  ///     the level it stopped at
+  Index _sift(Permutation &element) const;
+
+  /// \brief Recompute the orbit of a level from the strong generators
+  void _make_orbit(Level &level);
+
+  Index m_n_points;
+
+  std::vector<Level> m_levels;
+
+  std::vector<Permutation> m_generators;
+
+  std::vector<Permutation> m_inverse_generators;
+
+  /// The first point moved by each generator
+  std::vector<Index> m_first_moved;
+};
+
+/// \brief Return the lexicographically greatest image of `values` under the
+///     group, where the image under `p` is `image[x] = values[p[x]]`
+std::vector<int> make_lexicographic_max_image(
+    StabilizerChain const &chain, std::vector<int> const &values,
+    StabilizerChain::Permutation *permutation = nullptr);
+
+}  // namespace group
+}  // namespace CASM
+
+#endif
@@ -1,8 +1,14 @@
 #ifndef CASM_group_orbits
 #define CASM_group_orbits
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <set>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "casm/configuration/group/definitions.hh"
 
@@ -35,6 +41,73 @@ std::set<OrbitElementType, CompareType> make_orbit(
   return orbit;
 }
 
+/// \brief Make an orbit by applying group elements to one element
+///     of the orbit, reusing a scratch element
+///
+/// \param orbit_element One element of the orbit
+/// \param group_begin,group_end Group elements used to generate the
+///     orbit
+/// \param compare_f, Binary function used to compare orbit elements.
+/// \param apply_f Function used to apply group element to orbit elements,
+///     according to `apply_f(group_element, orbit_element, result)`, which
+///     sets `result` to the transformed orbit element. Implementations should
+///     reuse storage already owned by `result`.
+/// \param scratch Element used to hold each image. Its value on return is
+///     unspecified.
+///
+/// \returns orbit, A set containing the unique orbit elements
+///
+/// Images are only copied into the orbit if they are not already present, so
+/// no element is allocated for images that are duplicates.
+///
+template <typename OrbitElementType, typename GroupElementIt,
+          typename CompareType, typename ApplyType>
+std::set<OrbitElementType, CompareType> make_orbit(
+    OrbitElementType const &orbit_element, GroupElementIt group_begin,
+    GroupElementIt group_end, CompareType compare_f, ApplyType apply_f,
+    OrbitElementType &scratch) {
+  std::set<OrbitElementType, CompareType> orbit(compare_f);
+  for (; group_begin != group_end; ++group_begin) {
+    apply_f(*group_begin, orbit_element, scratch);
+    orbit.insert(scratch);
+  }
+  return orbit;
+}
+
+/// \brief Make an orbit, as a hash set, by applying group elements to one
+///     element of the orbit
+///
+/// \param orbit_element One element of the orbit
+/// \param group_begin,group_end Group elements used to generate the
+///     orbit
+/// \param hash_f, Hash function for orbit elements
+/// \param equal_f, Equality comparison for orbit elements
+/// \param apply_f Function used to apply group element to orbit elements,
+///     according to `apply_f(group_element, orbit_element, result)`, which
+///     sets `result` to the transformed orbit element.
+/// \param scratch Element used to hold each image. Its value on return is
+///     unspecified.
+///
+/// \returns orbit, A hash set containing the unique orbit elements
+///
+/// Useful when orbits are large and only membership is needed; use
+/// `make_orbit` if the orbit elements must be ordered.
+///
+template <typename OrbitElementType, typename GroupElementIt,
+          typename HashType, typename EqualType, typename ApplyType>
+std::unordered_set<OrbitElementType, HashType, EqualType> make_hashed_orbit(
+    OrbitElementType const &orbit_element, GroupElementIt group_begin,
+    GroupElementIt group_end, HashType hash_f, EqualType equal_f,
+    ApplyType apply_f, OrbitElementType &scratch) {
+  std::unordered_set<OrbitElementType, HashType, EqualType> orbit(
+      0, hash_f, equal_f);
+  for (; group_begin != group_end; ++group_begin) {
+    apply_f(*group_begin, orbit_element, scratch);
+    orbit.insert(scratch);
+  }
+  return orbit;
+}
+
 template <typename OrbitElementType, typename GroupElementIt,
           typename CompareType, typename CopyApplyType>
 OrbitElementType make_canonical_element(OrbitElementType const &orbit_element,
@@ -52,6 +125,89 @@ OrbitElementType make_canonical_element(OrbitElementType const &orbit_element,
   return best;
 }
 
+/// \brief Make the canonical element of an orbit, the greatest element
+///     according to `compare_f`, reusing scratch elements
+///
+/// \param orbit_element One element of the orbit
+/// \param group_begin,group_end Group elements used to generate the
+///     orbit. Must not be empty.
+/// \param compare_f, Binary function used to compare orbit elements.
+/// \param apply_f Function used to apply group element to orbit elements,
+///     according to `apply_f(group_element, orbit_element, result)`, which
+///     sets `result` to the transformed orbit element. Implementations should
+///     reuse storage already owned by `result`.
+/// \param best Set to the canonical element
+/// \param scratch Element used to hold each image. Its value on return is
+///     unspecified.
+///
+/// \returns A reference to `best`
+///
+/// Images that improve on `best` are swapped into it, not copied.
+///
+template <typename OrbitElementType, typename GroupElementIt,
+          typename CompareType, typename ApplyType>
+OrbitElementType &make_canonical_element(OrbitElementType const &orbit_element,
+                                         GroupElementIt group_begin,
+                                         GroupElementIt group_end,
+                                         CompareType compare_f,
+                                         ApplyType apply_f,
+                                         OrbitElementType &best,
+                                         OrbitElementType &scratch) {
+  apply_f(*group_begin++, orbit_element, best);
+  for (; group_begin != group_end; ++group_begin) {
+    apply_f(*group_begin, orbit_element, scratch);
+    if (compare_f(best, scratch)) {
+      using std::swap;
+      swap(best, scratch);
+    }
+  }
+  return best;
+}
+
+/// \brief Make the canonical element of an orbit, the greatest element,
+///     using a function that compares while applying
+///
+/// \param orbit_element One element of the orbit
+/// \param group_begin,group_end Group elements used to generate the
+///     orbit. Must not be empty.
+/// \param apply_f Function used to apply group element to orbit elements,
+///     according to `apply_f(group_element, orbit_element, result)`, which
+///     sets `result` to the transformed orbit element.
+/// \param apply_if_greater_f Function used to apply group elements only as
+///     far as needed, according to
+///     `apply_if_greater_f(group_element, orbit_element, best, result)`.
+///     It must return true if the transformed orbit element is greater than
+///     `best`, in which case `result` must be set to the transformed orbit
+///     element. Otherwise it should return false as soon as the
+///     transformed element is known to be less than or equal to `best`,
+///     and the value of `result` is unspecified.
+/// \param best Set to the canonical element
+/// \param scratch Element used to hold each image. Its value on return is
+///     unspecified.
+///
+/// \returns A reference to `best`
+///
+/// This allows images to be abandoned as soon as they are known not to
+/// improve on `best`, for example when orbit elements are compared
+/// lexicographically and the transformed values may be generated in order.
+///
+template <typename OrbitElementType, typename GroupElementIt,
+          typename ApplyType, typename ApplyIfGreaterType>
+OrbitElementType &make_canonical_element_early_exit(
+    OrbitElementType const &orbit_element, GroupElementIt group_begin,
+    GroupElementIt group_end, ApplyType apply_f,
+    ApplyIfGreaterType apply_if_greater_f, OrbitElementType &best,
+    OrbitElementType &scratch) {
+  apply_f(*group_begin++, orbit_element, best);
+  for (; group_begin != group_end; ++group_begin) {
+    if (apply_if_greater_f(*group_begin, orbit_element, best, scratch)) {
+      using std::swap;
+      swap(best, scratch);
+    }
+  }
+  return best;
+}
+
 template <typename OrbitElementContainer, typename GroupElementIt,
           typename CompareType, typename CopyApplyType>
 std::set<typename OrbitElementContainer::value_type, CompareType>
@@ -108,6 +264,92 @@ std::vector<std::vector<Index>> make_equivalence_map(
   return equivalence_map;
 }
 
+/// \brief Make the orbit equivalence map from the invariant subgroup of the
+///     first orbit element and one coset representative per element
+///
+/// Gives the same result as `make_equivalence_map`, but group elements are
+/// applied only until the invariant subgroup `H` of orbit element 0 and one
+/// representative `g_i` mapping element 0 onto element i are known. Then
+/// `equivalence_map[i]` is the coset `g_i * H`, formed with the
+/// multiplication table. When `H` and the representatives are found early,
+/// this avoids applying most group elements.
+///
+/// \param orbit The orbit of unique elements generated by the group
+/// \param group_begin,group_end Group elements used to generate the
+///     orbit. Must be a group, in the order of `multiplication_table`.
+/// \param multiplication_table The group multiplication table, where
+///     `multiplication_table[i][j]` is the index of `element[i] *
+///     element[j]`.
+/// \param copy_apply_f Function used to apply group element to orbit
+///     elements, according to `copy_apply_f(group_element, orbit_element)`
+///     which returns a new orbit element.
+///
+/// \returns equivalence_map, The indices equivalence_map[i] are
+///     the indices of the group elements transform the first
+///     element in the orbit into the i-th element in the orbit, in
+///     increasing order.
+///
+template <typename OrbitElementType, typename GroupElementIt,
+          typename CompareType, typename CopyApplyType>
+std::vector<std::vector<Index>> make_equivalence_map_by_cosets(
+    std::set<OrbitElementType, CompareType> const &orbit,
+    GroupElementIt group_begin, GroupElementIt group_end,
+    MultiplicationTable const &multiplication_table,
+    CopyApplyType copy_apply_f) {
+  Index group_size = std::distance(group_begin, group_end);
+  Index orbit_size = orbit.size();
+  if (Index(multiplication_table.size()) != group_size) {
+    throw std::runtime_error(
+        "Error in make_equivalence_map_by_cosets: multiplication table size "
+        "does not match the group");
+  }
+  if (orbit_size == 0 || group_size % orbit_size != 0) {
+    throw std::runtime_error(
+        "Error in make_equivalence_map_by_cosets: orbit size does not divide "
+        "the group size");
+  }
+  Index subgroup_size = group_size / orbit_size;
+
+  std::vector<Index> subgroup;
+  std::vector<Index> representative(orbit_size, -1);
+  Index n_found = 0;
+  Index i = 0;
+  for (; group_begin != group_end; ++group_begin) {
+    if (Index(subgroup.size()) == subgroup_size && n_found == orbit_size) {
+      break;
+    }
+    auto it = orbit.find(copy_apply_f(*group_begin, *orbit.begin()));
+    if (it == orbit.end()) {
+      throw std::runtime_error(
+          "Error in make_equivalence_map_by_cosets: failed");
+    }
+    Index d = std::distance(orbit.begin(), it);
+    if (d == 0) {
+      subgroup.push_back(i);
+    }
+    if (representative[d] == -1) {
+      representative[d] = i;
+      ++n_found;
+    }
+    ++i;
+  }
+  if (Index(subgroup.size()) != subgroup_size || n_found != orbit_size) {
+    throw std::runtime_error(
+        "Error in make_equivalence_map_by_cosets: elements do not form a "
+        "group");
+  }
+
+  std::vector<std::vector<Index>> equivalence_map(orbit_size);
+  for (Index d = 0; d < orbit_size; ++d) {
+    std::vector<Index> &coset = equivalence_map[d];
+    for (Index h : subgroup) {
+      coset.push_back(multiplication_table[representative[d]][h]);
+    }
+    std::sort(coset.begin(), coset.end());
+  }
+  return equivalence_map;
+}
+
 }  // namespace group
 }  // namespace CASM
 
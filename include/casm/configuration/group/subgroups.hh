@@ -3,6 +3,7 @@
 
 #include "casm/configuration/group/Group.hh"
 #include "casm/configuration/group/definitions.hh"
+#include "casm/configuration/hash.hh"
 
 namespace CASM {
 namespace group {
@@ -30,95 +31,221 @@ std::vector<SubgroupIndices> make_invariant_subgroups(
 
 // --- Implementation ---
 
+#include <cstdint>
+#include <functional>
 #include <numeric>
+#include <unordered_set>
 
 namespace CASM {
 namespace group {
 
 namespace subgroups_impl {
 
-typedef std::set<Index> CosetIndices;
+/// \brief Dynamic bitset of group element indices, used internally to
+///     represent subgroups
+///
+/// Union, equality, and hashing operate on 64-bit words, so that subgroups
+/// of large groups (for example, a point group combined with supercell
+/// translations) are compact and fast to compare.
+class SubgroupBits {
+ public:
+  typedef std::uint64_t word_type;
+  static constexpr Index word_size = 64;
+
+  explicit SubgroupBits(Index _n_elements)
+      : m_words((_n_elements + word_size - 1) / word_size, 0) {}
+
+  /// \brief Return true if element `i` is included
+  bool test(Index i) const {
+    return (m_words[i / word_size] >> (i % word_size)) & word_type(1);
+  }
+
+  /// \brief Include element `i`, returning true if it was not yet included
+  bool insert(Index i) {
+    word_type &word = m_words[i / word_size];
+    word_type mask = word_type(1) << (i % word_size);
+    if (word & mask) {
+      return false;
+    }
+    word |= mask;
+    return true;
+  }
+
+  /// \brief Number of elements included
+  Index count() const {
+    Index n = 0;
+    for (word_type word : m_words) {
+      for (; word; ++n) {
+        word &= word - 1;
+      }
+    }
+    return n;
+  }
+
+  /// \brief Include all elements of `other`
+  SubgroupBits &operator|=(SubgroupBits const &other) {
+    for (Index w = 0; w < m_words.size(); ++w) {
+      m_words[w] |= other.m_words[w];
+    }
+    return *this;
+  }
+
+  bool operator==(SubgroupBits const &other) const {
+    return m_words == other.m_words;
+  }
+
+  /// \brief Call `f(i)` for each included element `i`, in increasing order
+  template <typename F>
+  void for_each(F f) const {
+    for (Index w = 0; w < m_words.size(); ++w) {
+      word_type word = m_words[w];
+      while (word) {
+        Index b = 0;
+        while (!((word >> b) & word_type(1))) {
+          ++b;
+        }
+        f(w * word_size + b);
+        word &= word - 1;
+      }
+    }
+  }
+
+  /// \brief Return included elements as indices
+  SubgroupIndices to_indices() const {
+    SubgroupIndices indices;
+    for_each([&](Index i) { indices.emplace_hint(indices.end(), i); });
+    return indices;
+  }
+
+  std::size_t hash() const {
+    std::size_t seed = m_words.size();
+    for (word_type word : m_words) {
+      hash_combine(seed, std::hash<word_type>()(word));
+    }
+    return seed;
+  }
+
+ private:
+  std::vector<word_type> m_words;
+};
+
+struct SubgroupBitsHash {
+  std::size_t operator()(SubgroupBits const &bits) const {
+    return bits.hash();
+  }
+};
+
+typedef std::unordered_set<SubgroupBits, SubgroupBitsHash> SubgroupBitsSet;
+
+/// \brief A subgroup, and elements that generate it
+struct SubgroupRecord {
+  SubgroupBits bits;
+  std::vector<Index> generators;
+};
+
+/// \brief Return the subgroup generated by `generators`
+///
+/// Uses breadth-first closure, so the cost is proportional to the subgroup
+/// size times the number of generators.
+template <typename ElementType>
+SubgroupBits _make_closure(Group<ElementType> const &group,
+                           std::vector<Index> const &generators) {
+  SubgroupBits bits(group.element.size());
+  std::vector<Index> elements({0});
+  bits.insert(0);
+  for (Index k = 0; k < elements.size(); ++k) {
+    Index x = elements[k];
+    for (Index g : generators) {
+      Index product_index = group.mult(g, x);
+      if (bits.insert(product_index)) {
+        elements.push_back(product_index);
+      }
+    }
+  }
+  return bits;
+}
 
-/// \brief Return the unique left cosets of a subgroup
+/// \brief Return the distinct subgroups equivalent to `subgroup` by
+///     conjugation, with generators
 ///
 /// - If subgroup B of group G contains elements: (E, B1, B2, …, Bg),
 /// the "left coset” of X is (X*E, X*B1, X*B2, …, X*Bg),
 /// where X is an element of G.
-/// - A coset need not be a subgroup.
-/// - If X is an element of B, then the coset will be a subgroup of B.
 /// - Two left cosets of a given subgroup either contain exactly the same
-/// elements, or have no elements in common.
+/// elements, or have no elements in common, and every element X of a
+/// left coset gives the same conjugate subgroup X*B*X^-1. So one conjugate
+/// is generated per left coset.
 template <typename ElementType>
-std::set<CosetIndices> _make_left_cosets(
-    Group<ElementType> const &group, SubgroupIndices const &subgroup_indices) {
-  std::set<CosetIndices> left_cosets;
+std::vector<SubgroupRecord> _make_subgroup_orbit(
+    Group<ElementType> const &group, SubgroupRecord const &subgroup) {
+  Index n = group.element.size();
+  std::vector<Index> subgroup_elements;
+  subgroup.bits.for_each([&](Index i) { subgroup_elements.push_back(i); });
+
+  std::vector<SubgroupRecord> orbit;
+  SubgroupBitsSet found;
 
   // each group element is only included in one coset
-  std::vector<bool> check(group.element.size(), false);
-  Index product_index;
-  Index group_element_index = 0;
-  while (group_element_index < group.element.size()) {
-    if (check[group_element_index]) {
-      ++group_element_index;
+  std::vector<bool> check(n, false);
+  for (Index X_index = 0; X_index < n; ++X_index) {
+    if (check[X_index]) {
       continue;
     }
-    CosetIndices left_coset;
-    for (auto subgroup_element_index : subgroup_indices) {
-      product_index = group.mult(group_element_index, subgroup_element_index);
-      left_coset.insert(product_index);
-      check[product_index] = true;
+    for (Index A_index : subgroup_elements) {
+      check[group.mult(X_index, A_index)] = true;
     }
-    left_cosets.insert(left_coset);
-    ++group_element_index;
-  }
-  return left_cosets;
-}
-
-template <typename ElementType>
-SubgroupOrbit _make_subgroup_orbit(Group<ElementType> const &group,
-                                   SubgroupIndices const &subgroup) {
-  SubgroupOrbit orbit;
-  std::set<subgroups_impl::CosetIndices> left_cosets =
-      subgroups_impl::_make_left_cosets(group, subgroup);
-  for (auto const &coset : left_cosets) {
-    Index X_index = *coset.begin();
     Index X_inv_index = group.inv(X_index);
-    SubgroupIndices equiv_subgroup;
-    for (auto const &A_index : subgroup) {
-      equiv_subgroup.insert(
-          group.mult(X_index, group.mult(A_index, X_inv_index)));
+    SubgroupRecord equiv{SubgroupBits(n), {}};
+    for (Index A_index : subgroup_elements) {
+      equiv.bits.insert(group.mult(X_index, group.mult(A_index, X_inv_index)));
+    }
+    if (!found.insert(equiv.bits).second) {
+      continue;
     }
-    orbit.insert(equiv_subgroup);
+    for (Index g : subgroup.generators) {
+      equiv.generators.push_back(
+          group.mult(X_index, group.mult(g, X_inv_index)));
+    }
+    orbit.emplace_back(std::move(equiv));
   }
   return orbit;
 }
 
-inline std::function<bool(SubgroupIndices const &)> _make_subgroup_count(
-    std::set<SubgroupOrbit> const &subgroups) {
-  return [&](SubgroupIndices const &subgroup) {
-    for (auto const &orbit : subgroups) {
-      if (orbit.count(subgroup)) {
-        return true;
-      }
+/// \brief Convert orbits of subgroups from the internal representation
+inline std::set<SubgroupOrbit> _to_subgroup_orbits(
+    std::vector<std::vector<SubgroupRecord>> const &orbits) {
+  std::set<SubgroupOrbit> result;
+  for (auto const &orbit : orbits) {
+    SubgroupOrbit subgroup_orbit;
+    for (auto const &subgroup : orbit) {
+      subgroup_orbit.insert(subgroup.bits.to_indices());
     }
-    return false;
-  };
+    result.insert(std::move(subgroup_orbit));
+  }
+  return result;
 }
 
+/// \brief Make orbits of cyclic subgroups, in the internal representation
+///
+/// \param found Set to all cyclic subgroups found
 template <typename ElementType>
-std::function<void(SubgroupIndices &)> _make_close_subgroup(
-    Group<ElementType> const &group) {
-  return [&](SubgroupIndices &subgroup) {
-    std::vector<Index> vgroup(subgroup.begin(), subgroup.end());
-    for (Index i = 0; i < vgroup.size(); i++) {
-      for (Index j = 0; j < vgroup.size(); j++) {
-        Index product_index = group.mult(vgroup[i], vgroup[j]);
-        if (subgroup.insert(product_index).second) {
-          vgroup.push_back(product_index);
-        }
-      }
+std::vector<std::vector<SubgroupRecord>> _make_cyclic_subgroup_orbits(
+    Group<ElementType> const &group, SubgroupBitsSet &found) {
+  std::vector<std::vector<SubgroupRecord>> orbits;
+  for (Index i = 0; i < group.element.size(); ++i) {
+    // Make cyclic subgroup of element `i`
+    SubgroupRecord cyclic_subgroup{_make_closure(group, {i}), {i}};
+    if (found.count(cyclic_subgroup.bits)) {
+      continue;
+    }
+
+    // Make orbit of subgroups equivalent to `cyclic_subgroup` && Insert orbit
+    orbits.push_back(_make_subgroup_orbit(group, cyclic_subgroup));
+    for (auto const &equiv : orbits.back()) {
+      found.insert(equiv.bits);
     }
-  };
+  }
+  return orbits;
 }
 
 }  // namespace subgroups_impl
@@ -138,37 +265,24 @@ std::function<void(SubgroupIndices &)> _make_close_subgroup(
 template <typename ElementType>
 std::set<SubgroupOrbit> make_cyclic_subgroups(Group<ElementType> const &group) {
   using namespace subgroups_impl;
-
-  std::set<SubgroupOrbit> cyclic_subgroups;
-  Index group_element_index = 0;
-  while (group_element_index < group.element.size()) {
-    // Make cyclic subgroup of element `group_element_index`
-    SubgroupIndices cyclic_subgroup;
-    cyclic_subgroup.insert(group_element_index);
-    Index product_index = group_element_index;
-    while (product_index != 0) {
-      product_index = group.mult(group_element_index, product_index);
-      cyclic_subgroup.insert(product_index);
-    }
-
-    // Make orbit of subgroups equivalent to `cyclic_subgroup` && Insert orbit
-    cyclic_subgroups.insert(_make_subgroup_orbit(group, cyclic_subgroup));
-
-    ++group_element_index;
-  }
-  return cyclic_subgroups;
+  SubgroupBitsSet found;
+  return _to_subgroup_orbits(_make_cyclic_subgroup_orbits(group, found));
 }
 
 /// \brief Return all subgroups
 ///
 /// Method:
-/// - Start with m_subgroups = m_small_subgroups, then add new subgroups by
-/// finding the closure of a union of a large_group and a small_group.
-/// - If the the new large_group is unique, add it as a large_group.
-/// - Repeat for all (large_group, small_group) pairs, until no new
-/// m_subgroups are found.
+/// - Start with all_subgroups = cyclic subgroups, then add new subgroups by
+/// finding the closure of a union of a subgroup in all_subgroups and a
+/// cyclic subgroup.
+/// - If the the new subgroup is unique, add its orbit to all_subgroups.
+/// - Repeat for all (subgroup, cyclic subgroup) pairs, until no new
+/// subgroups are found.
 ///
-/// Note:
+/// Notes:
+/// - Subgroups are represented internally as bitsets, with a list of
+/// generating elements, so closure is found by breadth-first
+/// multiplication by the generators and uniqueness is checked by hashing.
 /// - This is probably not the fastest algorithm, but it is complete
 ///
 /// \param group The group to find subgroups of
@@ -177,39 +291,43 @@ std::set<SubgroupOrbit> make_cyclic_subgroups(Group<ElementType> const &group) {
 template <typename ElementType>
 std::set<SubgroupOrbit> make_all_subgroups(Group<ElementType> const &group) {
   using namespace subgroups_impl;
-  std::set<SubgroupOrbit> small_subgroups = make_cyclic_subgroups(group);
-  std::set<SubgroupOrbit> all_subgroups = small_subgroups;
-
-  // functor to close incomplete subgroup
-  auto _close_subgroup = _make_close_subgroup(group);
 
-  // functor to find if any orbit contains a particular subgroup
-  auto _subgroup_count = _make_subgroup_count(all_subgroups);
+  // all subgroups found, in any orbit
+  SubgroupBitsSet found;
+  std::vector<std::vector<SubgroupRecord>> small_subgroups =
+      _make_cyclic_subgroup_orbits(group, found);
+  std::vector<std::vector<SubgroupRecord>> all_subgroups = small_subgroups;
 
-  auto all_subgroups_it = all_subgroups.begin();
-  while (all_subgroups_it != all_subgroups.end()) {
+  for (Index i_orbit = 0; i_orbit < all_subgroups.size(); ++i_orbit) {
     for (auto const &small_subgroups_orbit : small_subgroups) {
       for (auto const &small_subgroups_equiv : small_subgroups_orbit) {
         // Combine an existing subgroup and a small (cyclic) subgroup
-        SubgroupIndices subgroup = *(all_subgroups_it->begin());
-        Index init_size = subgroup.size();
-        subgroup.insert(small_subgroups_equiv.begin(),
-                        small_subgroups_equiv.end());
-        if (subgroup.size() == init_size) continue;
+        SubgroupRecord const &large = all_subgroups[i_orbit].front();
+        SubgroupBits combined = large.bits;
+        combined |= small_subgroups_equiv.bits;
+        if (combined == large.bits) continue;
 
         // Find group closure
-        _close_subgroup(subgroup);
+        SubgroupRecord subgroup{SubgroupBits(0), large.generators};
+        subgroup.generators.insert(subgroup.generators.end(),
+                                   small_subgroups_equiv.generators.begin(),
+                                   small_subgroups_equiv.generators.end());
+        subgroup.bits = _make_closure(group, subgroup.generators);
 
         // If subgroup already exists in all_subgroups, continue
-        if (_subgroup_count(subgroup)) continue;
+        if (found.count(subgroup.bits)) continue;
 
         // Else, make orbit and insert
-        all_subgroups.insert(_make_subgroup_orbit(group, subgroup));
+        std::vector<SubgroupRecord> orbit =
+            _make_subgroup_orbit(group, subgroup);
+        for (auto const &equiv : orbit) {
+          found.insert(equiv.bits);
+        }
+        all_subgroups.emplace_back(std::move(orbit));
       }
     }
-    ++all_subgroups_it;
   }
-  return all_subgroups;
+  return _to_subgroup_orbits(all_subgroups);
 }
 
 /// \brief Make the invariant subgroup for each orbit element, as
@@ -0,0 +1,23 @@
+#ifndef CASM_config_hash
+#define CASM_config_hash
+
+#include <type_traits>
+
+namespace CASM {
+
+/// \brief Mix `value` into the hash `seed`
+///
+/// Used to combine element hashes into a container hash. The value type is
+/// not deduced, so `value` converts to the type of `seed` (for example
+/// `std::size_t` for unordered container hashes, or `std::uint64_t` for
+/// hashes that are written to disk).
+template <typename SeedType>
+void hash_combine(SeedType &seed,
+                  std::enable_if_t<std::is_unsigned_v<SeedType>, SeedType>
+                      value) {
+  seed ^= value + SeedType(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2);
+}
+
+}  // namespace CASM
+
+#endif
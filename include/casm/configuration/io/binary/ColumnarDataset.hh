@@ -0,0 +1,203 @@
+#ifndef CASM_config_ColumnarDataset
+#define CASM_config_ColumnarDataset
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+
+namespace CASM {
+namespace config {
+
+class SupercellSet;
+
+/// \brief Version of the columnar dataset format written by
+///     ColumnarDatasetWriter
+constexpr unsigned int COLUMNAR_DATASET_VERSION = 1;
+
+/// \brief First bytes of a columnar dataset stream
+constexpr char COLUMNAR_DATASET_MAGIC[8] = {'C', 'A', 'S', 'M',
+                                            'C', 'O', 'L', 'B'};
+
+/// \brief Ragged column of property values, one matrix per record
+///
+/// The values of record `i` are `values[offsets[i]:offsets[i+1]]`, a
+/// `rows[i]` x `cols[i]` matrix in column-major order. Records without
+/// the property have `present[i] == 0` and no values.
+struct ColumnarProperty {
+  std::vector<Index> offsets;
+  std::vector<Index> rows;
+  std::vector<Index> cols;
+  std::vector<unsigned char> present;
+  std::vector<double> values;
+
+  /// \brief Value for record `i`, as a matrix
+  Eigen::MatrixXd matrix(Index i) const;
+};
+
+/// \brief A batch of configurations with properties, stored by column
+///
+/// All records in a batch have the same number of sites and the same DoF
+/// keys and dimensions, so DoF values are stored as dense matrices with one
+/// column per record:
+/// - `occupation`: shape (n_sites, n_records)
+/// - `global_dof_values[key]`: shape (dim, n_records)
+/// - `local_dof_values[key]`: shape (dim * n_sites, n_records), where
+///   each column is the column-major (dim, n_sites) matrix of one record.
+///
+/// DoF values are in the prim basis. Properties may differ in shape between
+/// records, so they are stored as ragged columns.
+struct ColumnarBatch {
+  /// \brief Number of sites of every record in the batch
+  Index n_sites = 0;
+
+  /// \brief Position of each record in the order written
+  std::vector<Index> record_index;
+
+  /// \brief Index of each record's supercell in `supercell_list`
+  std::vector<Index> supercell_index;
+
+  /// \brief Supercells, in the order they first appear in the stream
+  ///
+  /// Shared by all batches read from the same stream.
+  std::shared_ptr<std::vector<std::shared_ptr<Supercell const>> const>
+      supercell_list;
+
+  Eigen::MatrixXi occupation;
+  std::map<std::string, Eigen::MatrixXd> global_dof_values;
+  std::map<std::string, Eigen::MatrixXd> local_dof_values;
+
+  /// \brief Local DoF dimension, by key
+  std::map<std::string, Index> local_dof_dim;
+
+  std::map<std::string, ColumnarProperty> local_properties;
+  std::map<std::string, ColumnarProperty> global_properties;
+
+  /// \brief Number of records
+  Index size() const { return record_index.size(); }
+
+  /// \brief Reconstruct record `i`
+  ConfigurationWithProperties configuration_with_properties(Index i) const;
+};
+
+/// \brief Reconstruct all records of a batch
+std::vector<ConfigurationWithProperties> make_configurations_with_properties(
+    ColumnarBatch const &batch);
+
+/// \brief Write configurations with properties in the columnar dataset
+///     format
+///
+/// Records are buffered by batch signature (number of sites, DoF keys and
+/// dimensions) and each signature's buffer is written as one batch when it
+/// holds `batch_size` records, so at most `batch_size` records per
+/// signature are held in memory. Batches are therefore not necessarily in
+/// write order; `ColumnarBatch::record_index` gives each record's position
+/// in the order written.
+///
+/// Format (version 1, all integers and doubles little-endian):
+/// - Header: the 8 bytes "CASMCOLB", then uint32 version.
+/// - Records, until end of stream, each starting with a 1-byte tag:
+///   - 'S' supercell: as in the binary configuration format (see
+///     `ConfigurationBinaryWriter`). Written once per supercell, before the
+///     first batch that uses it.
+///   - 'B' batch: int64 length of the contents, so batches can be skipped,
+///     then:
+///     - uint32 n_records, uint32 n_sites
+///     - int64 record_index[n_records], uint32 supercell_index[n_records]
+///     - occupation: uint8 bytes per value (1 or 2), then
+///       n_sites * n_records values as int8 or int16, record by record
+///     - global DoF: uint32 count, then string key, uint32 dim, and
+///       doubles[dim * n_records]
+///     - local DoF: uint32 count, then string key, uint32 dim, and
+///       doubles[dim * n_sites * n_records]
+///     - local properties, then global properties: uint32 count, then
+///       string key, uint8 present[n_records], uint32 rows[n_records],
+///       uint32 cols[n_records], int64 offsets[n_records + 1], and
+///       doubles[offsets[n_records]]
+/// - Strings are uint32 length followed by bytes.
+class ColumnarDatasetWriter {
+ public:
+  /// \brief Constructor, writes the header
+  explicit ColumnarDatasetWriter(std::ostream &out, Index batch_size = 1024);
+
+  /// \brief Destructor, calls `finish` if it has not been called
+  ~ColumnarDatasetWriter();
+
+  ColumnarDatasetWriter(ColumnarDatasetWriter const &) = delete;
+  ColumnarDatasetWriter &operator=(ColumnarDatasetWriter const &) = delete;
+
+  /// \brief Write a Configuration, with no properties
+  void write(Configuration const &configuration);
+
+  /// \brief Write a ConfigurationWithProperties
+  void write(ConfigurationWithProperties const &configuration_with_properties);
+
+  /// \brief Write all buffered records
+  void finish();
+
+  /// \brief Number of records written
+  Index size() const;
+
+ private:
+  struct Buffer {
+    std::vector<Index> record_index;
+    std::vector<ConfigurationWithProperties> records;
+  };
+
+  /// \brief Write the supercell record, if not yet written, and return its
+  ///     index in the stream
+  Index _supercell_index(std::shared_ptr<Supercell const> const &supercell);
+
+  /// \brief Write the records in a buffer as a batch and clear it
+  void _flush(Buffer &buffer);
+
+  std::ostream *m_out;
+
+  Index m_batch_size;
+
+  Index m_size;
+
+  bool m_finished;
+
+  /// Buffered records, by batch signature
+  std::map<std::string, Buffer> m_buffers;
+
+  /// Supercells already written, by address
+  std::map<Supercell const *, Index> m_supercell_index;
+
+  /// Keep written supercells alive, so that addresses are not reused
+  std::vector<std::shared_ptr<Supercell const>> m_supercells;
+};
+
+/// \brief Read the columnar dataset format one batch at a time
+///
+/// Supercells are found or added through a shared `SupercellSet`. Only one
+/// batch is held in memory at a time.
+class ColumnarDatasetReader {
+ public:
+  /// \brief Constructor, reads the header
+  ColumnarDatasetReader(std::istream &in, SupercellSet &supercells);
+
+  /// \brief Read the next batch, or return std::nullopt at end of stream
+  std::optional<ColumnarBatch> read_batch();
+
+  /// \brief Supercells read so far, in stream order
+  std::vector<std::shared_ptr<Supercell const>> const &supercell_list() const;
+
+ private:
+  std::istream *m_in;
+
+  SupercellSet *m_supercells;
+
+  std::shared_ptr<std::vector<std::shared_ptr<Supercell const>>>
+      m_supercell_list;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
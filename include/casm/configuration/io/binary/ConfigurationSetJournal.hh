@@ -0,0 +1,162 @@
+#ifndef CASM_config_ConfigurationSetJournal
+#define CASM_config_ConfigurationSetJournal
+
+#include <memory>
+#include <string>
+
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+class SupercellSet;
+
+/// \brief Version of the journal format written by ConfigurationSetJournal
+constexpr unsigned int CONFIGURATION_JOURNAL_VERSION = 1;
+
+/// \brief First bytes of a configuration journal
+constexpr char CONFIGURATION_JOURNAL_MAGIC[8] = {'C', 'A', 'S', 'M',
+                                                 'C', 'F', 'G', 'J'};
+
+/// \brief When ConfigurationSetJournal calls `fsync`
+enum class JournalSyncPolicy {
+  /// Never; written entries are durable once the OS writes them
+  none,
+
+  /// On `flush`, `compact`, and destruction
+  flush,
+
+  /// After each entry, and as for `flush`
+  every_entry
+};
+
+/// \brief A ConfigurationSet persisted as a binary snapshot plus an
+///     append-only journal of changes
+///
+/// Saving a ConfigurationSet rewrites it entirely. ConfigurationSetJournal
+/// instead appends each insert and erase to a journal, so saving costs
+/// O(changes), and periodically compacts the journal into a new snapshot.
+///
+/// Notes:
+/// - The snapshot, at `path`, is written by `write_indexed_binary`, so it can
+///   also be opened with ConfigurationSetView or read with `read_binary`.
+///   The journal is at `path + ".journal"`.
+/// - Construction reads the snapshot, if it exists, and replays the journal.
+///   A partially written entry at the end of the journal, as left by a
+///   crash, is discarded.
+/// - Journal format (all integers little-endian): the 8 bytes "CASMCFGJ",
+///   uint32 version, int64 snapshot size in bytes, int64 number of snapshot
+///   records, then entries. Each entry is a 1-byte tag, uint32 payload
+///   length, payload, and uint32 FNV-1a checksum of the payload:
+///   - 'R' insert: string supercell name, int64[9] transformation matrix to
+///     supercell (row-major), string configuration id, DoF values (see
+///     `ConfigurationBinaryWriter`).
+///   - 'E' erase: string configuration name.
+/// - The journal header identifies the snapshot it applies to. A journal
+///   whose header does not match the snapshot, such as when a crash occurs
+///   between writing a new snapshot and resetting the journal, is ignored.
+/// - `compact` writes the new snapshot to a temporary file and renames it
+///   over the old one, so readers that opened the old snapshot keep a
+///   consistent view and new readers see the complete new snapshot.
+/// - Entries are buffered and written on `flush`, when the buffer is large,
+///   or after each entry for `JournalSyncPolicy::every_entry`.
+/// - Next configuration ids are restored as in the snapshot, and increased
+///   past the ids of replayed inserts.
+/// - Only one ConfigurationSetJournal may write a given path at a time, and
+///   methods that modify it must not be called concurrently.
+class ConfigurationSetJournal {
+ public:
+  typedef ConfigurationSet::const_iterator const_iterator;
+  typedef ConfigurationSet::size_type size_type;
+
+  /// \brief Constructor, reads the snapshot and replays the journal
+  ConfigurationSetJournal(
+      std::string const &_path,
+      std::shared_ptr<SupercellSet> const &_supercells,
+      JournalSyncPolicy _sync_policy = JournalSyncPolicy::flush,
+      Index _compact_threshold = 0);
+
+  ConfigurationSetJournal(ConfigurationSetJournal const &) = delete;
+  ConfigurationSetJournal &operator=(ConfigurationSetJournal const &) =
+      delete;
+
+  /// \brief Destructor, flushes the journal
+  ~ConfigurationSetJournal();
+
+  /// \brief The configurations, as of the snapshot plus the journal
+  ConfigurationSet const &configurations() const { return m_configurations; }
+
+  /// \brief Supercells used by records are found or added to this set
+  std::shared_ptr<SupercellSet> const &supercells() const {
+    return m_supercells;
+  }
+
+  /// \brief Path to the snapshot
+  std::string const &snapshot_path() const { return m_path; }
+
+  /// \brief Path to the journal
+  std::string const &journal_path() const { return m_journal_path; }
+
+  /// \brief Number of journal entries since the snapshot was written
+  Index n_entries() const { return m_n_entries; }
+
+  /// \brief Insert Configuration, setting supercell_name and
+  ///     configuration_id automatically, and journal it
+  std::pair<const_iterator, bool> insert(Configuration const &configuration);
+
+  /// \brief Insert ConfigurationRecord, allowing custom configuration_id,
+  ///     and journal it
+  std::pair<const_iterator, bool> insert(ConfigurationRecord const &record);
+
+  /// \brief Erase by configuration, and journal it
+  size_type erase(Configuration const &configuration);
+
+  /// \brief Erase by configuration name, and journal it
+  size_type erase_by_name(std::string const &configuration_name);
+
+  /// \brief Write buffered entries, and `fsync` unless the policy is `none`
+  void flush();
+
+  /// \brief Write a new snapshot and reset the journal
+  void compact();
+
+ private:
+  void _load();
+
+  Index _replay(std::string const &journal, Index snapshot_size,
+                Index n_snapshot_records);
+
+  void _append(char tag, std::string const &payload);
+
+  void _write_buffer();
+
+  void _reset_journal(Index snapshot_size, Index n_snapshot_records);
+
+  void _open_journal(Index valid_size);
+
+  std::string m_path;
+
+  std::string m_journal_path;
+
+  std::shared_ptr<SupercellSet> m_supercells;
+
+  JournalSyncPolicy m_sync_policy;
+
+  Index m_compact_threshold;
+
+  ConfigurationSet m_configurations;
+
+  /// Journal file descriptor, opened for appending
+  int m_fd;
+
+  /// Entries not yet written
+  std::string m_buffer;
+
+  Index m_n_entries;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
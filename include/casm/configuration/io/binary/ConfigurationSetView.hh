@@ -0,0 +1,132 @@
+#ifndef CASM_config_ConfigurationSetView
+#define CASM_config_ConfigurationSetView
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+class SupercellSet;
+
+/// \brief Write a ConfigurationSet in the indexed binary configuration format
+void write_indexed_binary(std::ostream &out,
+                          ConfigurationSet const &configurations);
+
+/// \brief Read-only view of a ConfigurationSet stored in the indexed binary
+///     configuration format, using a memory-mapped file
+///
+/// Notes:
+/// - The file is a binary configuration stream (see
+///   `ConfigurationBinaryWriter`) of 'R' records, followed by 'N', 'I', and
+///   'F' records, as written by `write_indexed_binary`. It can also be read
+///   with `ConfigurationBinaryReader` or `read_binary`.
+/// - Construction maps the file and reads only the header and the index, so
+///   it takes constant time. Records are decoded on access, directly from the
+///   mapped memory, and the mapped pages are shared by all processes that
+///   open the same file.
+/// - Records are addressable by index, in ConfigurationSet order, and by
+///   configuration name, using binary search over the on-disk index.
+/// - Supercells are constructed on first use and added to `supercells()`.
+///   Access is thread safe.
+class ConfigurationSetView {
+ public:
+  /// \brief Constructor, maps the file and reads the index
+  ConfigurationSetView(std::string const &path,
+                       std::shared_ptr<SupercellSet> const &_supercells);
+
+  ConfigurationSetView(ConfigurationSetView const &) = delete;
+  ConfigurationSetView &operator=(ConfigurationSetView const &) = delete;
+
+  ~ConfigurationSetView();
+
+  /// \brief Number of configuration records
+  Index size() const;
+
+  /// \brief Number of supercells
+  Index n_supercells() const;
+
+  /// \brief Supercells used by records are found or added to this set
+  std::shared_ptr<SupercellSet> const &supercells() const;
+
+  /// \brief Get a supercell by its index in the file, constructing it on
+  ///     first use
+  std::shared_ptr<Supercell const> const &supercell(
+      Index supercell_index) const;
+
+  /// \brief Get a supercell name by its index in the file
+  std::string supercell_name(Index supercell_index) const;
+
+  /// \brief Configuration id of the i-th record
+  std::string configuration_id(Index i) const;
+
+  /// \brief Configuration name ("<supercell_name>/<configuration_id>") of
+  ///     the i-th record
+  std::string configuration_name(Index i) const;
+
+  /// \brief Decode the configuration of the i-th record
+  Configuration configuration(Index i) const;
+
+  /// \brief Decode the i-th record
+  ConfigurationRecord record(Index i) const;
+
+  /// \brief Find a record index by configuration name, returning `size()`
+  ///     if not found
+  Index find_by_name(std::string const &configuration_name) const;
+
+  /// \brief Next configuration ids, by supercell name
+  std::map<std::string, Index> next_config_id() const;
+
+ private:
+  /// \brief Check that `offset` is within the file and return a pointer
+  char const *_at(Index offset) const;
+
+  /// \brief Offset of the i-th record, checking `i`
+  Index _record_offset(Index i) const;
+
+  /// \brief Supercell index of the record at `offset`, skipping the
+  ///     configuration id
+  Index _record_supercell_index(Index record_offset) const;
+
+  std::shared_ptr<SupercellSet> m_supercells;
+
+  /// Mapped file
+  char const *m_data;
+
+  /// Mapped file size, in bytes
+  Index m_size;
+
+  Index m_n_supercells;
+
+  /// Pointer to int64 offsets of 'S' records
+  char const *m_supercell_offsets;
+
+  Index m_n_records;
+
+  /// Pointer to int64 offsets of 'R' records
+  char const *m_record_offsets;
+
+  /// Pointer to uint32 record indices, sorted by configuration name
+  char const *m_name_order;
+
+  /// Offset of the 'N' record
+  Index m_next_config_id_offset;
+
+  /// Guards m_supercell_list and m_supercells
+  mutable std::mutex m_mutex;
+
+  /// Supercells constructed so far, by index in the file
+  mutable std::vector<std::shared_ptr<Supercell const>> m_supercell_list;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef CASM_config_Configuration_binary_io
+#define CASM_config_Configuration_binary_io
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/Configuration.hh"
+
+namespace CASM {
+namespace config {
+
+struct ConfigurationRecord;
+class ConfigurationSet;
+class SupercellSet;
+
+/// \brief Version of the binary configuration format written by
+///     ConfigurationBinaryWriter
+constexpr unsigned int CONFIGURATION_BINARY_VERSION = 2;
+
+/// \brief First bytes of a binary configuration stream
+constexpr char CONFIGURATION_BINARY_MAGIC[8] = {'C', 'A', 'S', 'M',
+                                                'C', 'F', 'G', 'B'};
+
+/// \brief Write configurations in the binary configuration format
+///
+/// Format (version 2, all integers and doubles little-endian):
+/// - Header: the 8 bytes "CASMCFGB", then uint32 version.
+/// - Records, until end of stream, each starting with a 1-byte tag:
+///   - 'S' supercell: uint32 supercell index (sequential from 0), string
+///     supercell name (as from `make_supercell_name`), int64[9]
+///     transformation matrix to supercell (row-major). Written once per
+///     supercell, before the first record in that supercell.
+///   - 'C' configuration: uint32 supercell index, DoF values.
+///   - 'P' configuration with properties: uint32 supercell index, DoF
+///     values, local properties (uint32 count, then string key, uint32 rows,
+///     uint32 cols, doubles), and global properties (uint32 count, then
+///     string key, uint32 size, doubles).
+///   - 'R' configuration set record: string configuration id, then the
+///     same contents as 'C'.
+///   - 'K' primitive canonical key: int64, the bits of the
+///     `ConfigurationRecord::primitive_canonical_key` of the preceding 'R'
+///     record. Written only if the key is set. (Added in version 2.)
+///   - 'N' next configuration ids: uint32 count, then string supercell
+///     name and int64 id.
+///   - 'I' index: int64 length, then contents (see `write_indexed_binary`).
+///   - 'F' footer: int64 offset of the 'I' record. If present, it is the
+///     last record.
+/// - Strings are uint32 length followed by bytes.
+/// - DoF values are in the prim basis: occupation (uint32 size, uint8
+///   bytes per value (1 or 2), values as int8 or int16), global DoF (uint32
+///   count, then string key, uint32 size, doubles), and local DoF (uint32
+///   count, then string key, uint32 rows, uint32 cols, doubles in
+///   column-major order).
+class ConfigurationBinaryWriter {
+ public:
+  /// \brief Constructor, writes the header
+  explicit ConfigurationBinaryWriter(std::ostream &out);
+
+  /// \brief Write a Configuration record
+  void write(Configuration const &configuration);
+
+  /// \brief Write a ConfigurationWithProperties record
+  void write(ConfigurationWithProperties const &configuration_with_properties);
+
+  /// \brief Write a ConfigurationSet record
+  void write(ConfigurationRecord const &record);
+
+  /// \brief Write the records and next configuration ids of a
+  ///     ConfigurationSet
+  void write(ConfigurationSet const &configurations);
+
+  /// \brief Write a next configuration ids record
+  void write_next_config_id(std::map<std::string, Index> const &next_config_id);
+
+  /// \brief Write the supercell record, if not yet written, and return its
+  ///     index in the stream
+  Index supercell_index(std::shared_ptr<Supercell const> const &supercell);
+
+  /// \brief Number of supercell records written
+  Index n_supercells() const;
+
+ private:
+  std::ostream *m_out;
+
+  /// Supercells already written, by address
+  std::map<Supercell const *, Index> m_supercell_index;
+
+  /// Keep written supercells alive, so that addresses are not reused
+  std::vector<std::shared_ptr<Supercell const>> m_supercells;
+};
+
+/// \brief Read configurations one record at a time from the binary
+///     configuration format
+///
+/// `ConfigurationType` may be `Configuration` or
+/// `ConfigurationWithProperties`. When reading `Configuration`, the
+/// properties of 'P' records are ignored; when reading
+/// `ConfigurationWithProperties`, 'C' and 'R' records have no properties.
+/// Supercells are found or added through a shared `SupercellSet`. 'N'
+/// records are not returned as values; their contents are collected in
+/// `next_config_id`. 'I' and 'F' records are skipped. 'K' records give the
+/// `primitive_canonical_key` of the preceding 'R' record.
+template <typename ConfigurationType>
+class ConfigurationBinaryReader {
+ public:
+  /// \brief Constructor, reads the header and the first record
+  ConfigurationBinaryReader(std::istream &in, SupercellSet &supercells);
+
+  /// \brief Get the current record
+  ConfigurationType const &value() const;
+
+  /// \brief Configuration id of the current record, if it is a 'R' record,
+  ///     else empty
+  std::string const &configuration_id() const;
+
+  /// \brief Primitive canonical key of the current record, if it is a 'R'
+  ///     record followed by a 'K' record, else empty
+  std::optional<std::uint64_t> const &primitive_canonical_key() const;
+
+  /// \brief Supercell name of the current record
+  std::string const &supercell_name() const;
+
+  /// \brief Read the next record
+  void advance();
+
+  /// \brief Return true if `value` is valid, false if no more records
+  bool is_valid() const;
+
+  /// \brief Next configuration ids read from 'N' records
+  std::map<std::string, Index> const &next_config_id() const;
+
+ private:
+  std::istream *m_in;
+
+  SupercellSet *m_supercells;
+
+  /// Supercells, by index in the stream
+  std::vector<std::shared_ptr<Supercell const>> m_supercell_list;
+
+  /// Supercell names, by index in the stream
+  std::vector<std::string> m_supercell_name_list;
+
+  /// Index of the supercell of the current record
+  Index m_supercell_index;
+
+  std::unique_ptr<ConfigurationType> m_current;
+
+  std::string m_configuration_id;
+
+  std::optional<std::uint64_t> m_primitive_canonical_key;
+
+  std::map<std::string, Index> m_next_config_id;
+};
+
+/// \brief Write a ConfigurationSet in the binary configuration format
+void write_binary(std::ostream &out, ConfigurationSet const &configurations);
+
+/// \brief Read a ConfigurationSet from the binary configuration format
+void read_binary(std::istream &in, SupercellSet &supercells,
+                 ConfigurationSet &configurations);
+
+/// \brief Convert a Configuration to the binary configuration format
+std::string to_bytes(Configuration const &configuration);
+
+/// \brief Convert a ConfigurationWithProperties to the binary configuration
+///     format
+std::string to_bytes(
+    ConfigurationWithProperties const &configuration_with_properties);
+
+/// \brief Convert a ConfigurationSet to the binary configuration format
+std::string to_bytes(ConfigurationSet const &configurations);
+
+/// \brief Read a single Configuration or ConfigurationWithProperties from
+///     the binary configuration format
+template <typename ConfigurationType>
+ConfigurationType from_bytes(std::string const &bytes,
+                             SupercellSet &supercells);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
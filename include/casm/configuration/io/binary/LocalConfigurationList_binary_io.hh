@@ -0,0 +1,48 @@
+#ifndef CASM_config_LocalConfigurationList_binary_io
+#define CASM_config_LocalConfigurationList_binary_io
+
+#include <iostream>
+#include <string>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+class LocalConfigurationList;
+class SupercellSet;
+
+/// \brief Version of the binary local configuration list format
+constexpr unsigned int LOCAL_CONFIGURATION_LIST_BINARY_VERSION = 1;
+
+/// \brief First bytes of a binary local configuration list stream
+constexpr char LOCAL_CONFIGURATION_LIST_BINARY_MAGIC[8] = {
+    'C', 'A', 'S', 'M', 'L', 'C', 'F', 'B'};
+
+/// \brief Write a LocalConfigurationList in binary format
+///
+/// Format (version 1, all integers little-endian):
+/// - Header: the 8 bytes "CASMLCFB", then uint32 version.
+/// - int64 number of local configurations, `n`.
+/// - `n` event positions, each as int64 unitcell_index, then int64
+///   equivalent_index.
+/// - A binary configuration stream (see `ConfigurationBinaryWriter`) with
+///   the `n` configurations, in list order, as 'C' records.
+void write_binary(std::ostream &out,
+                  LocalConfigurationList const &local_configurations);
+
+/// \brief Read a LocalConfigurationList from binary format
+void read_binary(std::istream &in, SupercellSet &supercells,
+                 LocalConfigurationList &local_configurations);
+
+/// \brief Convert a LocalConfigurationList to binary format
+std::string to_bytes(LocalConfigurationList const &local_configurations);
+
+/// \brief Read a LocalConfigurationList from binary format
+LocalConfigurationList local_configuration_list_from_bytes(
+    std::string const &bytes, SupercellSet &supercells);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef CASM_config_SupercellSymInfo_binary_io
+#define CASM_config_SupercellSymInfo_binary_io
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/SupercellSymInfo.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Version of the binary supercell symmetry tables format
+constexpr unsigned int SUPERCELL_SYM_INFO_BINARY_VERSION = 2;
+
+/// \brief First bytes of a binary supercell symmetry tables file
+constexpr char SUPERCELL_SYM_INFO_BINARY_MAGIC[8] = {'C', 'A', 'S', 'M',
+                                                     'S', 'Y', 'M', 'T'};
+
+/// \brief Write the symmetry tables of supercells in the binary supercell
+///     symmetry tables format
+///
+/// Format (version 2, all integers little-endian):
+/// - Header: the 8 bytes "CASMSYMT", uint32 version, uint32 0, uint64 prim
+///   digest (see `make_supercell_sym_info_prim_digest`), int64 prim basis
+///   size, int64 prim factor group size, int64 number of supercells, then
+///   int64 offset of each supercell record.
+/// - Supercell records: int64[9] transformation matrix to supercell
+///   (row-major), int64 n_fg (supercell factor group size), int64 n_t
+///   (number of stored translation permutations, 0 or n_unitcells), int64
+///   n_sites, int64[n_fg] prim factor group index of each supercell factor
+///   group operation, int64[n_fg * n_sites] factor group permutations,
+///   int64[n_t * n_sites] translation permutations.
+/// - All values are 8-byte aligned.
+void write_supercell_sym_info_tables(
+    std::ostream &out,
+    std::vector<std::shared_ptr<Supercell const>> const &supercells);
+
+/// \brief Digest of the prim structure and factor group, identifying the
+///     prim of binary supercell symmetry tables
+std::uint64_t make_supercell_sym_info_prim_digest(Prim const &prim);
+
+/// \brief Read-only supercell symmetry tables, using a memory-mapped file
+///
+/// Notes:
+/// - The file is written by `write_supercell_sym_info_tables`, once, and
+///   then opened by each worker process. Construction maps the file and
+///   reads only the header, and the mapped pages are shared by all
+///   processes that open the same file.
+/// - `make_supercell` constructs a Supercell whose SupercellSymInfo
+///   permutations are read from the file, instead of constructed from the
+///   prim symmetry representations, which removes most of the cost of
+///   constructing large supercells. Every permutation value read is checked
+///   to be a valid site index, and the prim is checked by digest.
+/// - Factor group permutations, at most one per prim factor group
+///   operation, are copied into each Supercell. Stored translation
+///   permutations, one per unit cell, are not copied. Instead the
+///   supercell's TranslationPermutationCache reads them from the shared
+///   mapping on demand, and holds at most
+///   `translation_permutation_cache_max_bytes` of them in each process.
+/// - The mapping stays valid while any supercell constructed from it
+///   exists, even after the SupercellSymInfoTables is destroyed.
+/// - Access is thread safe.
+class SupercellSymInfoTables {
+ public:
+  /// \brief Constructor, maps the file and reads the header
+  explicit SupercellSymInfoTables(std::string const &path);
+
+  SupercellSymInfoTables(SupercellSymInfoTables const &) = delete;
+  SupercellSymInfoTables &operator=(SupercellSymInfoTables const &) = delete;
+
+  /// \brief Number of supercells
+  Index size() const { return m_n_supercells; }
+
+  /// \brief Transformation matrix to supercell of the i-th supercell
+  Eigen::Matrix3l transformation_matrix_to_super(Index i) const;
+
+  /// \brief Return the index of the supercell with the given transformation
+  ///     matrix, or `size()` if not found
+  Index find(Eigen::Matrix3l const &transformation_matrix_to_super) const;
+
+  /// \brief Construct the SupercellSymInfo of the i-th supercell
+  SupercellSymInfo make_sym_info(
+      std::shared_ptr<Prim const> const &prim, Index i,
+      Index translation_permutation_cache_max_bytes =
+          DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES) const;
+
+  /// \brief Construct a Supercell using the stored tables
+  std::shared_ptr<Supercell const> make_supercell(
+      std::shared_ptr<Prim const> const &prim,
+      Eigen::Matrix3l const &transformation_matrix_to_super,
+      Index translation_permutation_cache_max_bytes =
+          DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES) const;
+
+ private:
+  /// \brief Offset of the i-th supercell record, checking `i`
+  Index _record_offset(Index i) const;
+
+  /// \brief Pointer to `n` int64 values at `offset`, checking bounds
+  char const *_at(Index offset, Index n) const;
+
+  /// Mapped file, unmapped when the tables and all supercells constructed
+  /// from them are destroyed
+  std::shared_ptr<char const> m_data;
+
+  /// Mapped file size, in bytes
+  Index m_size;
+
+  std::uint64_t m_prim_digest;
+
+  Index m_prim_basis_size;
+
+  Index m_prim_factor_group_size;
+
+  Index m_n_supercells;
+};
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef CASM_config_binary_io
+#define CASM_config_binary_io
+
+#include <iostream>
+#include <map>
+#include <streambuf>
+#include <string>
+
+#include "casm/clexulator/ConfigDoFValues.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Low-level reading and writing of the binary configuration format
+///
+/// All integers and doubles are little-endian, independent of the host.
+/// Readers throw std::runtime_error if the stream ends early. See
+/// `ConfigurationBinaryWriter` for the record layout.
+namespace binary_io {
+
+/// \brief Write one byte
+void write_u8(std::ostream &out, unsigned char value);
+
+/// \brief Write a uint32, throwing if `value` is out of range
+void write_u32(std::ostream &out, Index value);
+
+/// \brief Write an int64
+void write_i64(std::ostream &out, Index value);
+
+/// \brief Write a string as uint32 length followed by bytes
+void write_string(std::ostream &out, std::string const &value);
+
+/// \brief Write `n` doubles
+void write_doubles(std::ostream &out, double const *values, Index n);
+
+/// \brief Write uint32 count, then string key, uint32 size, doubles
+void write_vector_map(std::ostream &out,
+                      std::map<std::string, Eigen::VectorXd> const &values);
+
+/// \brief Write uint32 count, then string key, uint32 rows, uint32 cols,
+///     doubles in column-major order
+void write_matrix_map(std::ostream &out,
+                      std::map<std::string, Eigen::MatrixXd> const &values);
+
+/// \brief Write uint32 size, uint8 bytes per value (1 or 2), then values
+void write_occupation(std::ostream &out, Eigen::VectorXi const &occupation);
+
+/// \brief Write occupation, global DoF values, then local DoF values
+void write_dof_values(std::ostream &out,
+                      clexulator::ConfigDoFValues const &dof_values);
+
+/// \brief Read exactly `n` bytes
+void read_exact(std::istream &in, char *data, Index n);
+
+/// \brief Read a uint32
+Index read_u32(std::istream &in);
+
+/// \brief Read an int64
+Index read_i64(std::istream &in);
+
+/// \brief Read a string written by `write_string`
+std::string read_string(std::istream &in);
+
+/// \brief Read `n` doubles
+void read_doubles(std::istream &in, double *values, Index n);
+
+/// \brief Read values written by `write_vector_map`
+std::map<std::string, Eigen::VectorXd> read_vector_map(std::istream &in);
+
+/// \brief Read values written by `write_matrix_map`
+std::map<std::string, Eigen::MatrixXd> read_matrix_map(std::istream &in);
+
+/// \brief Read values written by `write_occupation`
+Eigen::VectorXi read_occupation(std::istream &in);
+
+/// \brief Read values written by `write_dof_values`, checking sizes
+///     against the supercell
+clexulator::ConfigDoFValues read_dof_values(std::istream &in,
+                                            Supercell const &supercell);
+
+/// \brief A read-only std::streambuf over existing memory, without copying
+///
+/// Used to read records directly from a memory-mapped file.
+class MemoryStreamBuffer : public std::streambuf {
+ public:
+  MemoryStreamBuffer(char const *begin, char const *end) {
+    char *_begin = const_cast<char *>(begin);
+    setg(_begin, _begin, const_cast<char *>(end));
+  }
+};
+
+}  // namespace binary_io
+}  // namespace config
+}  // namespace CASM
+
+#endif
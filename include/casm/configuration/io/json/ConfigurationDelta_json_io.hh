@@ -0,0 +1,42 @@
+#ifndef CASM_config_ConfigurationDelta_json_io
+#define CASM_config_ConfigurationDelta_json_io
+
+#include <memory>
+#include <vector>
+
+#include "casm/global/definitions.hh"
+
+namespace CASM {
+namespace config {
+struct Configuration;
+struct ConfigurationDelta;
+struct Prim;
+}  // namespace config
+
+class jsonParser;
+template <typename T>
+struct jsonConstructor;
+
+template <>
+struct jsonConstructor<config::ConfigurationDelta> {
+  /// Read ConfigurationDelta from JSON, relative to a background
+  static config::ConfigurationDelta from_json(
+      jsonParser const &json,
+      std::shared_ptr<config::Configuration const> const &background);
+};
+
+/// Insert ConfigurationDelta to JSON, without its background
+jsonParser &to_json(config::ConfigurationDelta const &delta, jsonParser &json);
+
+/// Insert ConfigurationDelta sharing one background to JSON
+jsonParser &to_json(std::vector<config::ConfigurationDelta> const &deltas,
+                    jsonParser &json);
+
+/// Read ConfigurationDelta sharing one background from JSON
+void from_json(std::vector<config::ConfigurationDelta> &deltas,
+               jsonParser const &json,
+               std::shared_ptr<config::Prim const> const &prim);
+
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef CASM_config_ConfigurationJsonLines
+#define CASM_config_ConfigurationJsonLines
+
+#include <iostream>
+#include <memory>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+struct ConfigurationWithProperties;
+class SupercellSet;
+
+/// \brief Read configurations one record at a time from a JSON lines stream
+///
+/// A JSON lines stream contains one JSON object per line, each in the
+/// format read by `jsonConstructor<ConfigurationType>::from_json`. Blank
+/// lines are skipped. Records are read with `make_from_json_string`, without
+/// constructing a JSON document. Only the current record is held in memory,
+/// and supercells are found or added through a shared `SupercellSet`, so
+/// memory use does not depend on the number of records.
+///
+/// `ConfigurationType` may be `Configuration` or
+/// `ConfigurationWithProperties`.
+///
+/// Example:
+/// \code
+/// std::ifstream in("configurations.jsonl");
+/// SupercellSet supercells(prim);
+/// ConfigurationJsonLinesReader<Configuration> reader(in, supercells);
+/// while (reader.is_valid()) {
+///   Configuration const &configuration = reader.value();
+///   ...
+///   reader.advance();
+/// }
+/// \endcode
+template <typename ConfigurationType>
+class ConfigurationJsonLinesReader {
+ public:
+  /// \brief Constructor
+  ConfigurationJsonLinesReader(std::istream &in, SupercellSet &supercells);
+
+  /// \brief Get the current record
+  ConfigurationType const &value() const;
+
+  /// \brief Read the next record
+  void advance();
+
+  /// \brief Return true if `value` is valid, false if no more records
+  bool is_valid() const;
+
+  /// \brief Line number (starting from 1) of the current record
+  Index line_number() const;
+
+ private:
+  std::istream *m_in;
+
+  SupercellSet *m_supercells;
+
+  std::unique_ptr<ConfigurationType> m_current;
+
+  Index m_line_number;
+};
+
+/// \brief Write a Configuration as one line of a JSON lines stream
+void write_json_line(std::ostream &out, Configuration const &configuration,
+                     bool write_prim_basis = false);
+
+/// \brief Write a ConfigurationWithProperties as one line of a JSON lines
+///     stream
+void write_json_line(
+    std::ostream &out,
+    ConfigurationWithProperties const &configuration_with_properties,
+    bool write_prim_basis = false);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
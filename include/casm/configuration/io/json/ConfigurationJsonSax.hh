@@ -0,0 +1,46 @@
+#ifndef CASM_config_ConfigurationJsonSax
+#define CASM_config_ConfigurationJsonSax
+
+#include <memory>
+#include <string>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+struct ConfigurationWithProperties;
+class ConfigurationSet;
+class SupercellSet;
+
+/// \brief Read a Configuration or ConfigurationWithProperties from a JSON
+///     string, without constructing a JSON document
+///
+/// Notes:
+/// - Reads the format read by `jsonMake<ConfigurationType>::make_from_json`.
+/// - Records in the standard layout are read from the token stream directly
+///   into occupation and DoF value buffers, without constructing a
+///   `jsonParser`. Unrecognized attributes are skipped, as by the document
+///   reader.
+/// - If a record is not in the standard layout (for example, non-integer
+///   occupation values), is inconsistent with the prim, or cannot be parsed,
+///   it is read with the document reader instead, which gives the same
+///   result or the same error.
+///
+/// `ConfigurationType` may be `Configuration` or
+/// `ConfigurationWithProperties`.
+template <typename ConfigurationType>
+std::unique_ptr<ConfigurationType> make_from_json_string(
+    std::string const &json_str, SupercellSet &supercells);
+
+/// \brief Read a ConfigurationSet from a JSON string, without constructing a
+///     JSON document
+void read_configuration_set_json(std::string const &json_str,
+                                 SupercellSet &supercells,
+                                 ConfigurationSet &configurations,
+                                 Index n_threads = 1);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
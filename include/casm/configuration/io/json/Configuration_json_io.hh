@@ -5,6 +5,8 @@
 #include <memory>
 #include <set>
 
+#include "casm/global/definitions.hh"
+
 namespace CASM {
 namespace config {
 struct Configuration;
@@ -18,9 +20,11 @@ class jsonParser;
 template <typename T>
 class InputParser;
 
+/// \brief Read ConfigurationSet from JSON
 void from_json(config::SupercellSet &supercells,
                config::ConfigurationSet &configurations, jsonParser const &json,
-               std::shared_ptr<config::Prim const> const &prim);
+               std::shared_ptr<config::Prim const> const &prim,
+               Index n_threads = 1);
 
 jsonParser &to_json(config::ConfigurationSet const &configurations,
                     jsonParser &json, bool write_prim_basis = false);
@@ -0,0 +1,85 @@
+#ifndef CASM_config_JsonArrayWriter
+#define CASM_config_JsonArrayWriter
+
+#include <iostream>
+#include <optional>
+
+#include "casm/global/definitions.hh"
+
+namespace CASM {
+
+class jsonParser;
+
+/// \brief Options for writing JSON to a stream
+struct JsonStreamOptions {
+  /// If true, write each value on one line, without indentation. If false,
+  /// pretty print each value.
+  bool compact = false;
+
+  /// If has_value, round floating point numbers to this many significant
+  /// digits before writing, which shortens compact output
+  std::optional<int> precision;
+};
+
+/// \brief Round floating point numbers in a JSON document, in place, to
+///     `precision` significant digits
+void round_json_numbers(jsonParser &json, int precision);
+
+/// \brief Write one JSON value to a stream
+void write_json(std::ostream &out, jsonParser json,
+                JsonStreamOptions const &options = JsonStreamOptions());
+
+/// \brief Writes a JSON array to a stream one element at a time
+///
+/// Each element is written as soon as it is given, so only the current
+/// element needs to be held in memory as a jsonParser, rather than the
+/// whole array.
+///
+/// Example:
+/// \code
+/// std::ofstream out("orbits.json");
+/// JsonArrayWriter writer(out);
+/// for (auto const &orbit : orbits) {
+///   jsonParser json;
+///   ... // write orbit to json
+///   writer.write(std::move(json));
+/// }
+/// writer.finish();
+/// \endcode
+class JsonArrayWriter {
+ public:
+  /// \brief Constructor, writes the opening bracket
+  explicit JsonArrayWriter(std::ostream &out, JsonStreamOptions const &options =
+                                                  JsonStreamOptions());
+
+  /// \brief Destructor, calls `finish` if it has not been called
+  ~JsonArrayWriter();
+
+  JsonArrayWriter(JsonArrayWriter const &) = delete;
+  JsonArrayWriter &operator=(JsonArrayWriter const &) = delete;
+
+  /// \brief Write the next element
+  void write(jsonParser json);
+
+  /// \brief Write the closing bracket
+  void finish();
+
+  /// \brief Number of elements written
+  Index size() const;
+
+  /// \brief The options used to write elements
+  JsonStreamOptions const &options() const;
+
+ private:
+  std::ostream *m_out;
+
+  JsonStreamOptions m_options;
+
+  Index m_size;
+
+  bool m_finished;
+};
+
+}  // namespace CASM
+
+#endif
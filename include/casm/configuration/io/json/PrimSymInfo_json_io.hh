@@ -0,0 +1,34 @@
+#ifndef CASM_config_PrimSymInfo_json_io
+#define CASM_config_PrimSymInfo_json_io
+
+#include <vector>
+
+#include "casm/configuration/sym_info/definitions.hh"
+
+namespace CASM {
+
+template <typename T>
+struct jsonConstructor;
+class jsonParser;
+
+namespace config {
+struct PrimSymInfo;
+}
+
+/// \brief Write PrimSymInfo groups to JSON object
+jsonParser &to_json(config::PrimSymInfo const &sym_info, jsonParser &json,
+                    xtal::BasicStructure const &prim);
+
+template <>
+struct jsonConstructor<config::PrimSymInfo> {
+  /// \brief Construct from JSON
+  static config::PrimSymInfo from_json(jsonParser const &json,
+                                       xtal::BasicStructure const &prim);
+};
+
+/// \brief Read factor group elements, in order, from SymGroup JSON
+std::vector<xtal::SymOp> symgroup_elements_from_json(jsonParser const &json);
+
+}  // namespace CASM
+
+#endif
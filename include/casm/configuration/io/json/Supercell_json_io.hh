@@ -4,6 +4,8 @@
 #include <memory>
 #include <set>
 
+#include "casm/global/definitions.hh"
+
 namespace CASM {
 
 class jsonParser;
@@ -27,7 +29,8 @@ jsonParser &to_json(std::shared_ptr<config::Supercell const> const &supercell,
 
 /// \brief Read SupercellSet from JSON
 void from_json(config::SupercellSet &supercells, jsonParser const &json,
-               std::shared_ptr<config::Prim const> const &prim);
+               std::shared_ptr<config::Prim const> const &prim,
+               Index n_threads = 1);
 
 /// \brief Write SupercellSet to JSON (version 2.0)
 jsonParser &to_json(config::SupercellSet const &supercells, jsonParser &json);
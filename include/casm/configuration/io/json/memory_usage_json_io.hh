@@ -0,0 +1,23 @@
+#ifndef CASM_config_memory_usage_json_io
+#define CASM_config_memory_usage_json_io
+
+namespace CASM {
+
+class jsonParser;
+
+namespace config {
+struct SupercellMemoryUsage;
+struct SupercellSetMemoryUsage;
+}  // namespace config
+
+/// \brief Write SupercellMemoryUsage to JSON
+jsonParser &to_json(config::SupercellMemoryUsage const &usage,
+                    jsonParser &json);
+
+/// \brief Write SupercellSetMemoryUsage to JSON
+jsonParser &to_json(config::SupercellSetMemoryUsage const &usage,
+                    jsonParser &json);
+
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef CASM_config_perf_json_io
+#define CASM_config_perf_json_io
+
+namespace CASM {
+
+class jsonParser;
+
+namespace config {
+namespace perf {
+struct PerfReport;
+}  // namespace perf
+}  // namespace config
+
+/// \brief Write PerfReport to JSON
+jsonParser &to_json(config::perf::PerfReport const &report, jsonParser &json);
+
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef CASM_irreps_BlockPermutationMatrix
+#define CASM_irreps_BlockPermutationMatrix
+
+#include <vector>
+
+#include "casm/configuration/irreps/definitions.hh"
+
+namespace CASM {
+namespace irreps {
+
+/// \brief A square matrix with exactly one non-zero block in each block row
+///     and each block column
+///
+/// Notes:
+/// - Rows and columns are partitioned into the same blocks. Block `i` is
+///   rows (or columns) `[block_offset[i], block_offset[i+1])`.
+/// - Block row `i` has one non-zero block, `blocks[i]`, in block column
+///   `block_permutation[i]`, so `blocks[i]` has shape
+///   `(block_dim(i), block_dim(block_permutation[i]))`.
+/// - This is the form of the matrix representation of a supercell symmetry
+///   operation acting on site DoF values, where blocks are site DoF symrep
+///   matrices. Only `sum_i block_dim(i)^2` values are stored, rather than
+///   `rows()^2`.
+struct BlockPermutationMatrix {
+  /// \brief Constructor
+  BlockPermutationMatrix(std::vector<Index> _block_offset,
+                         std::vector<Index> _block_permutation,
+                         std::vector<Eigen::MatrixXd> _blocks);
+
+  /// \brief Beginning row (or column) of each block, with
+  ///     `block_offset.back() == rows()`
+  std::vector<Index> block_offset;
+
+  /// \brief Block column of the non-zero block in each block row
+  std::vector<Index> block_permutation;
+
+  /// \brief Non-zero block in each block row
+  std::vector<Eigen::MatrixXd> blocks;
+
+  /// \brief Number of blocks
+  Index n_blocks() const { return blocks.size(); }
+
+  /// \brief Number of rows (or columns) of block `i`
+  Index block_dim(Index i) const {
+    return block_offset[i + 1] - block_offset[i];
+  }
+
+  /// \brief Number of rows
+  Index rows() const { return block_offset.back(); }
+
+  /// \brief Number of columns
+  Index cols() const { return block_offset.back(); }
+
+  /// \brief Return the product of this matrix and `X`, without constructing
+  ///     the dense matrix
+  Eigen::MatrixXd operator*(Eigen::MatrixXd const &X) const;
+
+  /// \brief Construct the dense matrix
+  Eigen::MatrixXd to_dense() const;
+};
+
+typedef std::vector<BlockPermutationMatrix> BlockPermutationMatrixRep;
+
+/// \brief Construct the dense matrix representation
+MatrixRep to_dense(BlockPermutationMatrixRep const &rep);
+
+}  // namespace irreps
+}  // namespace CASM
+
+#endif
@@ -4,6 +4,7 @@
 #include <optional>
 
 #include "casm/casm_io/Log.hh"
+#include "casm/configuration/irreps/BlockPermutationMatrix.hh"
 #include "casm/configuration/irreps/definitions.hh"
 
 namespace CASM {
@@ -65,14 +66,62 @@ struct IrrepDecomposition {
       Eigen::MatrixXd const &_init_subspace,
       std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
       std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
-      bool allow_complex, std::optional<Log> _log = std::nullopt);
+      bool allow_complex, std::optional<Log> _log = std::nullopt,
+      Index n_threads = 1);
+
+  /// IrrepDecomposition constructor, using a block permutation matrix rep
+  IrrepDecomposition(
+      BlockPermutationMatrixRep const &_fullspace_rep,
+      GroupIndices const &_head_group, Eigen::MatrixXd const &_init_subspace,
+      std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
+      std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
+      bool allow_complex, std::optional<Log> _log = std::nullopt,
+      Index n_threads = 1);
+
+  /// IrrepDecomposition constructor, using irreps that are already found
+  IrrepDecomposition(MatrixRep const &_fullspace_rep,
+                     GroupIndices const &_head_group,
+                     Eigen::MatrixXd const &_subspace,
+                     std::vector<IrrepInfo> const &_irreps,
+                     std::optional<Log> _log = std::nullopt);
+
+  /// IrrepDecomposition constructor, using irreps that are already found
+  /// and a block permutation matrix rep
+  IrrepDecomposition(BlockPermutationMatrixRep const &_fullspace_rep,
+                     GroupIndices const &_head_group,
+                     Eigen::MatrixXd const &_subspace,
+                     std::vector<IrrepInfo> const &_irreps,
+                     std::optional<Log> _log = std::nullopt);
 
   /// Full space matrix representation
   ///
   /// fullspace_rep[i].rows() == full space dimension
   /// fullspace_rep[i].cols() == full space dimension
+  ///
+  /// Empty if constructed from a block permutation matrix rep, which is
+  /// stored as `fullspace_block_rep` instead. Use `has_fullspace_rep`,
+  /// `apply_fullspace_rep`, and `make_fullspace_matrix` to use either.
   MatrixRep fullspace_rep;
 
+  /// Full space matrix representation, as block permutation matrices
+  ///
+  /// Has value only if constructed from a block permutation matrix rep, in
+  /// which case `fullspace_rep` is empty.
+  std::optional<BlockPermutationMatrixRep> fullspace_block_rep;
+
+  /// \brief Return true if `fullspace_rep` or `fullspace_block_rep` is
+  ///     stored
+  bool has_fullspace_rep() const;
+
+  /// \brief Return the product of the full space matrix representation of
+  ///     element `element_index` and `X`
+  Eigen::MatrixXd apply_fullspace_rep(Index element_index,
+                                      Eigen::MatrixXd const &X) const;
+
+  /// \brief Return the dense full space matrix representation of element
+  ///     `element_index`
+  Eigen::MatrixXd make_fullspace_matrix(Index element_index) const;
+
   /// Group (as indices into fullspace_rep) used to find irreps
   GroupIndices head_group;
 
@@ -100,6 +149,13 @@ struct IrrepDecomposition {
 
   /// If provided, log progress
   std::optional<Log> log;
+
+ private:
+  template <typename RepType>
+  void _decompose(RepType const &rep, Eigen::MatrixXd const &init_subspace,
+                  std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
+                  std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
+                  bool allow_complex, Index n_threads);
 };
 
 }  // namespace irreps
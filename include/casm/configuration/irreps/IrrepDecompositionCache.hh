@@ -0,0 +1,82 @@
+#ifndef CASM_irreps_IrrepDecompositionCache
+#define CASM_irreps_IrrepDecompositionCache
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include "casm/casm_io/Log.hh"
+#include "casm/configuration/irreps/definitions.hh"
+
+namespace CASM {
+namespace irreps {
+
+struct IrrepDecomposition;
+
+/// \brief Stores IrrepDecomposition results in memory, keyed by their inputs
+///
+/// Notes:
+/// - Results are keyed by the matrix representation, head group, initial
+///   subspace, and `allow_complex`. The matrix representation and initial
+///   subspace are compared using `tol`. A hash of their values rounded to
+///   a multiple of `tol` is used to find candidate results, so a hash miss
+///   only causes the decomposition to be repeated.
+/// - The subgroup functions are not part of the key. They are expected to be
+///   determined by the matrix representation and head group, as they are
+///   in `dof_space_analysis`.
+/// - Results are shared, and not copied, when they are found.
+/// - It is safe to call `make` concurrently.
+class IrrepDecompositionCache {
+ public:
+  /// \brief Constructor
+  IrrepDecompositionCache(double _tol = TOL);
+
+  /// \brief Return a stored IrrepDecomposition with the same inputs, or
+  ///     construct, store, and return a new IrrepDecomposition
+  std::shared_ptr<IrrepDecomposition const> make(
+      MatrixRep const &fullspace_rep, GroupIndices const &head_group,
+      Eigen::MatrixXd const &init_subspace,
+      std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
+      std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
+      bool allow_complex, std::optional<Log> log = std::nullopt,
+      Index n_threads = 1);
+
+  /// \brief Tolerance used to compare inputs
+  double tol() const;
+
+  /// \brief Number of stored results
+  Index size() const;
+
+  /// \brief Erase stored results
+  void clear();
+
+ private:
+  struct Entry {
+    Eigen::MatrixXd init_subspace;
+    bool allow_complex;
+    std::shared_ptr<IrrepDecomposition const> result;
+  };
+
+  std::size_t _hash(MatrixRep const &fullspace_rep,
+                    GroupIndices const &head_group,
+                    Eigen::MatrixXd const &init_subspace,
+                    bool allow_complex) const;
+
+  std::shared_ptr<IrrepDecomposition const> _find(
+      std::size_t key, MatrixRep const &fullspace_rep,
+      GroupIndices const &head_group, Eigen::MatrixXd const &init_subspace,
+      bool allow_complex) const;
+
+  double m_tol;
+
+  mutable std::mutex m_mutex;
+
+  std::unordered_multimap<std::size_t, Entry> m_entries;
+};
+
+}  // namespace irreps
+}  // namespace CASM
+
+#endif
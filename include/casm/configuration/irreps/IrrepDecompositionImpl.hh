@@ -149,16 +149,32 @@ IrrepInfo subspace_to_full_space(IrrepInfo const &subspace_irrep,
 /// (number of rows of `trans_mat`)
 IrrepInfo make_dummy_irrep_info(Eigen::MatrixXcd const &trans_mat);
 
+/// Calculate characters of the head group elements
+Eigen::VectorXd make_head_group_characters(MatrixRep const &rep,
+                                           GroupIndices const &head_group);
+
+/// Calculate the sum of squared irrep multiplicities from characters
+Index make_sum_of_squared_multiplicities(Eigen::VectorXd const &characters,
+                                         Index head_group_size);
+
 /// Check if a representation is irreducible
 ///
 /// A representation is irreducible if the squared norm of the characters
 /// equals the group size
 bool is_irrep(MatrixRep const &rep, GroupIndices const &head_group);
 
+/// Make the possible irrep spanning all of `kernel`
+PossibleIrrep make_kernel_possible_irrep(Eigen::MatrixXcd const &kernel,
+                                         MatrixRep const &rep,
+                                         GroupIndices const &head_group,
+                                         double is_irrep_tol,
+                                         bool allow_complex);
+
 /// Finds irreducible subspaces that comprise an underlying subspace
 std::vector<IrrepInfo> irrep_decomposition(MatrixRep const &rep,
                                            GroupIndices const &head_group,
-                                           bool allow_complex);
+                                           bool allow_complex,
+                                           Index n_threads = 1);
 
 /// Convert irreps generated for a subspace to full space dimension
 std::vector<IrrepInfo> make_fullspace_irreps(
@@ -170,17 +186,27 @@ Eigen::MatrixXd make_invariant_space(MatrixRep const &rep,
                                      GroupIndices const &head_group,
                                      Eigen::MatrixXd const &subspace);
 
+/// Expand subspace by application of group, and orthogonalize
+Eigen::MatrixXd make_invariant_space(BlockPermutationMatrixRep const &rep,
+                                     GroupIndices const &head_group,
+                                     Eigen::MatrixXd const &subspace);
+
 /// \brief Create the subspace rep from the fullspace rep
 MatrixRep make_subspace_rep(MatrixRep const &fullspace_rep,
                             Eigen::MatrixXd const &subspace);
 
+/// \brief Create the subspace rep from the fullspace rep
+MatrixRep make_subspace_rep(BlockPermutationMatrixRep const &fullspace_rep,
+                            Eigen::MatrixXd const &subspace);
+
 /// \brief Symmetrize IrrepInfo, by finding high symmetry directions and
 /// aligning the irrep subspace basis with those directions
 std::vector<IrrepInfo> symmetrize_irreps(
     MatrixRep const &subspace_rep, GroupIndices const &head_group,
     std::vector<IrrepInfo> const &irreps,
     std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
-    std::function<GroupIndicesOrbitSet()> make_all_subgroups_f);
+    std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
+    Index n_threads = 1);
 
 }  // namespace IrrepDecompositionImpl
 
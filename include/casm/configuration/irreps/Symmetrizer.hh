@@ -12,7 +12,7 @@ multivector<Eigen::VectorXcd>::X<2> make_irrep_special_directions(
     Eigen::MatrixXcd const &irrep_subspace, double vec_compare_tol,
     std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
     std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
-    bool use_all_subgroups = false);
+    bool use_all_subgroups = false, Index n_threads = 1);
 
 /// Make an irreducible space symmetrizer matrix using special directions
 Eigen::MatrixXcd make_irrep_symmetrizer_matrix(
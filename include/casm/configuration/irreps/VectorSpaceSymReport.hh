@@ -65,7 +65,8 @@ struct VectorSpaceSymReport {
 /// Construct VectorSpaceSymReport
 VectorSpaceSymReport vector_space_sym_report(
     IrrepDecomposition const &irrep_decomposition, bool calc_wedges = false,
-    std::optional<std::vector<std::string>> axis_glossary = std::nullopt);
+    std::optional<std::vector<std::string>> axis_glossary = std::nullopt,
+    Index n_threads = 1);
 
 }  // namespace irreps
 }  // namespace CASM
@@ -0,0 +1,51 @@
+#ifndef CASM_irreps_VectorSymmetrizer
+#define CASM_irreps_VectorSymmetrizer
+
+#include "casm/configuration/irreps/IrrepDecomposition.hh"
+#include "casm/configuration/irreps/definitions.hh"
+
+namespace CASM {
+namespace irreps {
+
+/// \brief Applies a precomputed linear symmetrization operator to many
+///     vectors at once
+///
+/// The operator is either the group average of a matrix representation,
+/// which projects vectors onto the subspace invariant to the group, or a
+/// projector onto one or more irreducible subspaces. Vectors are the columns
+/// of a `dim x n_vectors` matrix, so applying the operator is one
+/// matrix-matrix product instead of one matrix-vector product per vector.
+class VectorSymmetrizer {
+ public:
+  /// \brief Constructor
+  explicit VectorSymmetrizer(Eigen::MatrixXd _matrix);
+
+  /// \brief The `dim x dim` operator matrix
+  Eigen::MatrixXd const &matrix() const;
+
+  /// \brief Vector dimension
+  Index dim() const;
+
+  /// \brief Return `matrix() * vectors`
+  Eigen::MatrixXd operator()(Eigen::MatrixXd const &vectors) const;
+
+  /// \brief Set `vectors = matrix() * vectors`
+  void apply_in_place(Eigen::Ref<Eigen::MatrixXd> vectors) const;
+
+ private:
+  Eigen::MatrixXd m_matrix;
+};
+
+/// \brief Make the group average of a matrix representation
+VectorSymmetrizer make_group_average_symmetrizer(
+    MatrixRep const &rep, GroupIndices const &head_group);
+
+/// \brief Make the projector onto the span of one or more irreducible
+///     subspaces
+VectorSymmetrizer make_irrep_projector(std::vector<IrrepInfo> const &irreps,
+                                       double abs_tol = TOL);
+
+}  // namespace irreps
+}  // namespace CASM
+
+#endif
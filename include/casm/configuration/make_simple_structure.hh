@@ -4,7 +4,9 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
+#include "casm/configuration/definitions.hh"
 #include "casm/global/eigen.hh"
 
 namespace CASM {
@@ -16,6 +18,7 @@ class SimpleStructure;
 namespace config {
 
 struct Configuration;
+struct ConfigurationView;
 struct ConfigurationWithProperties;
 
 /// \brief (deprecated) Convert a Configuration to a SimpleStructure
@@ -26,6 +29,49 @@ xtal::SimpleStructure make_simple_structure(
     std::string atom_type_naming_method = "chemical_name",
     std::set<std::string> excluded_species = {"Va", "VA", "va"});
 
+/// \brief (deprecated) Convert a view of a Configuration to a SimpleStructure
+xtal::SimpleStructure make_simple_structure(
+    ConfigurationView const &configuration,
+    std::map<std::string, Eigen::MatrixXd> const &local_properties = {},
+    std::map<std::string, Eigen::VectorXd> const &global_properties = {},
+    std::string atom_type_naming_method = "chemical_name",
+    std::set<std::string> excluded_species = {"Va", "VA", "va"});
+
+/// \brief Atomic structures of many configurations of one supercell, stored
+///     in contiguous arrays
+///
+/// Layout:
+/// - Configuration `k` has lattice vectors
+///   `lat_column_mat.middleCols(3 * k, 3)`, and atoms `atom_offset[k]`
+///   through `atom_offset[k+1] - 1`.
+/// - Atom `i` has Cartesian coordinate `coords.col(i)`, name
+///   `atom_type_names[atom_type[i]]`, and is on linear site index
+///   `site_index[i]`.
+struct AtomicStructureBatch {
+  /// \brief Size `3 x (3 * n_configurations())`, the deformed lattice
+  ///     vectors of each configuration, as columns
+  Eigen::MatrixXd lat_column_mat;
+
+  /// \brief Size `n_configurations() + 1`, index of the first atom of each
+  ///     configuration
+  std::vector<Index> atom_offset = {0};
+
+  /// \brief Size `3 x n_atoms`, Cartesian coordinates of all atoms
+  Eigen::MatrixXd coords;
+
+  /// \brief Size `n_atoms`, index into `atom_type_names` of each atom
+  Eigen::VectorXi atom_type;
+
+  /// \brief Size `n_atoms`, linear site index of each atom
+  std::vector<Index> site_index;
+
+  /// \brief Atom type names
+  std::vector<std::string> atom_type_names;
+
+  /// \brief Number of configurations
+  Index n_configurations() const { return atom_offset.size() - 1; }
+};
+
 /// \brief Construct a SimpleStructure from a configuration of a Prim with
 ///     atomic occupants
 ///
@@ -79,6 +125,12 @@ class ToAtomicStructure {
       std::map<std::string, Eigen::MatrixXd> const &local_properties = {},
       std::map<std::string, Eigen::VectorXd> const &global_properties = {});
 
+  /// \brief Convert many configurations of one supercell to contiguous
+  ///     coordinate and atom type arrays
+  AtomicStructureBatch make_batch(
+      std::vector<Configuration> const &configurations,
+      Index n_threads = 1) const;
+
  private:
   std::string m_atom_type_naming_method;
   std::set<std::string> m_excluded_species;
@@ -0,0 +1,74 @@
+#ifndef CASM_config_memory_usage
+#define CASM_config_memory_usage
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Records objects already counted when estimating memory usage
+///
+/// Notes:
+/// - Objects held by `std::shared_ptr` may be shared by many owners, such
+///   as a SymGroup or a Supercell shared by many configurations. Passing
+///   one MemoryUsageContext to the `make_memory_usage` and `memory_usage`
+///   functions for several objects counts each shared object only once.
+/// - Estimates include the size of each object and the heap memory it owns,
+///   with the allocator overhead of `std::set` and `std::unordered_map`
+///   nodes approximated. They do not include the Prim, which is shared by
+///   all supercells.
+class MemoryUsageContext {
+ public:
+  /// \brief Record an object, returning true if it was not recorded
+  ///     already and is not null
+  bool insert(void const *ptr) {
+    return ptr != nullptr && m_counted.insert(ptr).second;
+  }
+
+ private:
+  std::unordered_set<void const *> m_counted;
+};
+
+namespace memory_usage_impl {
+
+/// \brief Estimated bytes per `std::set` node, excluding the value
+constexpr Index set_node_bytes = 4 * sizeof(void *);
+
+/// \brief Estimated bytes per `std::unordered_map` node, excluding the
+///     value, plus one bucket
+constexpr Index hash_node_bytes = 3 * sizeof(void *);
+
+/// \brief Heap bytes owned by a vector, excluding its values' own heap
+template <typename T>
+Index heap_bytes(std::vector<T> const &value) {
+  return value.capacity() * sizeof(T);
+}
+
+/// \brief Heap bytes owned by a string
+inline Index heap_bytes(std::string const &value) {
+  // strings that fit the short string buffer do not allocate
+  return value.capacity() > 15 ? value.capacity() + 1 : 0;
+}
+
+/// \brief Heap bytes owned by a dense Eigen matrix
+template <typename Derived>
+Index heap_bytes(Eigen::PlainObjectBase<Derived> const &value) {
+  return value.size() * sizeof(typename Derived::Scalar);
+}
+
+/// \brief Heap bytes owned by ConfigDoFValues
+Index heap_bytes(ConfigDoFValues const &value);
+
+/// \brief Heap bytes owned by a SymGroup, excluding its head group
+Index heap_bytes(SymGroup const &value);
+
+}  // namespace memory_usage_impl
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
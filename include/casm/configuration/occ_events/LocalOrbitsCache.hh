@@ -0,0 +1,131 @@
+#ifndef CASM_occ_events_LocalOrbitsCache
+#define CASM_occ_events_LocalOrbitsCache
+
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/IntegralClusterOrbitGenerator.hh"
+#include "casm/configuration/occ_events/OccEvent.hh"
+#include "casm/configuration/occ_events/OccEventRep.hh"
+#include "casm/configuration/occ_events/definitions.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+
+namespace CASM {
+namespace occ_events {
+
+/// \brief Local-cluster orbits around the prototype of an OccEvent orbit
+struct LocalOrbitsPrototype {
+  /// \brief The prototype OccEvent, the greatest in its orbit after
+  ///     translation to the origin unit cell
+  OccEvent prototype;
+
+  /// \brief The subgroup of the prim factor group that leaves `prototype`
+  ///     invariant
+  std::shared_ptr<SymGroup const> invariant_group;
+
+  /// \brief Local-cluster orbits around `prototype`, generated by
+  ///     `clust::make_local_orbits` with the `invariant_group`
+  std::vector<std::set<clust::IntegralCluster>> local_orbits;
+};
+
+/// \brief Thread-safe cache of local-cluster orbits, generated once per
+///     OccEvent orbit and transformed to equivalent events
+///
+/// Notes:
+/// - Local-cluster orbits around an OccEvent are generated by
+///   `clust::make_local_orbits`, using the group that leaves the OccEvent
+///   invariant. For events related by a prim factor group operation and a
+///   lattice translation, the local-cluster orbits are related by the same
+///   operation.
+/// - `local_orbits(event)` finds the prototype of the event's prim periodic
+///   orbit, generates its local-cluster orbits if they are not yet stored,
+///   and then transforms them to `event` with
+///   `clust::make_equivalent_local_orbits`. Orbit `i` around each
+///   equivalent event corresponds to orbit `i` around the prototype.
+/// - `custom_generators` are local clusters around the prototype of each
+///   event orbit, so they are most useful when all events are in one
+///   orbit.
+/// - Each prototype entry is constructed exactly once: concurrent calls for
+///   the same prototype wait for the first to finish. Construction is done
+///   without holding the lock, so calls for other prototypes do not wait.
+class LocalOrbitsCache {
+ public:
+  /// \brief Constructor
+  LocalOrbitsCache(
+      std::shared_ptr<xtal::BasicStructure const> const &_prim,
+      std::shared_ptr<SymGroup const> const &_prim_factor_group,
+      clust::SiteFilterFunction _site_filter,
+      std::vector<double> const &_max_length,
+      std::vector<clust::IntegralClusterOrbitGenerator> const
+          &_custom_generators,
+      std::vector<double> const &_cutoff_radius,
+      bool _include_phenomenal_sites = false);
+
+  /// \brief Get the local-cluster orbits around an OccEvent
+  std::vector<std::set<clust::IntegralCluster>> local_orbits(
+      OccEvent const &event);
+
+  /// \brief Get the prototype entry for an OccEvent's orbit, constructing it
+  ///     if not cached
+  std::shared_ptr<LocalOrbitsPrototype const> prototype(OccEvent const &event);
+
+  /// \brief Return the prototype of an OccEvent's prim periodic orbit
+  OccEvent make_prototype(OccEvent const &event) const;
+
+  /// \brief Find the prim factor group index and translation that map the
+  ///     prototype onto an equivalent OccEvent
+  std::pair<Index, xtal::UnitCell> find_equivalence_op(
+      OccEvent const &prototype, OccEvent const &event) const;
+
+  /// \brief Number of prototype entries stored
+  Index size() const;
+
+  /// \brief Number of calls to `prototype` that found a stored value
+  Index n_hits() const;
+
+  /// \brief Number of calls to `prototype` that constructed a value
+  Index n_misses() const;
+
+  /// \brief Remove all stored values
+  void clear();
+
+ private:
+  std::shared_ptr<LocalOrbitsPrototype const> _make_entry(
+      OccEvent const &prototype) const;
+
+  std::shared_ptr<xtal::BasicStructure const> m_prim;
+
+  std::shared_ptr<SymGroup const> m_prim_factor_group;
+
+  std::vector<OccEventRep> m_occevent_symgroup_rep;
+
+  clust::SiteFilterFunction m_site_filter;
+
+  std::vector<double> m_max_length;
+
+  std::vector<clust::IntegralClusterOrbitGenerator> m_custom_generators;
+
+  std::vector<double> m_cutoff_radius;
+
+  bool m_include_phenomenal_sites;
+
+  mutable std::mutex m_mutex;
+
+  std::map<OccEvent,
+           std::shared_future<std::shared_ptr<LocalOrbitsPrototype const>>>
+      m_entries;
+
+  Index m_n_hits;
+
+  Index m_n_misses;
+};
+
+}  // namespace occ_events
+}  // namespace CASM
+
+#endif
@@ -110,6 +110,19 @@ OccEvent &apply(OccEventRep const &rep, OccEvent &occ_event);
 /// \brief Apply SymOp to OccEvent
 OccEvent copy_apply(OccEventRep const &rep, OccEvent occ_event);
 
+/// \brief Hash of an OccEvent, consistent with OccEvent equality
+///
+/// Notes:
+/// - Fields of OccPosition that are not used in comparisons (the site of a
+///   position in the reservoir, and the atom position index of a molecule
+///   position) are not hashed.
+/// - Equivalent events only have equal hashes if they are in the same form,
+///   so events should be put in standardized form (see `standardize`) and
+///   translated consistently before hashing.
+struct OccEventHash {
+  std::size_t operator()(OccEvent const &event) const;
+};
+
 // --- Implementation ---
 
 template <typename Iterator>
@@ -3,6 +3,8 @@
 
 #include <optional>
 #include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "casm/configuration/clusterography/IntegralCluster.hh"
@@ -150,6 +152,30 @@ struct OccEventCounterParameters {
   ///     sites. Do not skip atom-vacancy exchange.
   bool skip_direct_exchange = true;
 
+  // Trajectory constraints checked on each atom trajectory,
+  // position_init[i] -> position_final[i], in order. Because they
+  // can be decided for a partial assignment of trajectories, the
+  // first trajectory that fails one lets every permutation of
+  // position_final sharing the failing prefix be skipped without
+  // being generated. Vacancy trajectories are not constrained.
+
+  /// \brief Skip events in which any atom moves more than this
+  ///     Cartesian distance
+  std::optional<double> max_trajectory_length;
+
+  /// \brief Skip events in which more than this number of atoms
+  ///     change sites
+  std::optional<int> max_moving_atoms;
+
+  /// \brief Skip events in which an atom moves to a different site,
+  ///     unless (atom name, name of the chemical initially on the
+  ///     destination site) is in this set. Atom names are as in
+  ///     OccSystem::atom_name_list and chemical names are as in
+  ///     OccSystem::chemical_name_list, so {("A", "Va")} allows only
+  ///     "A" atoms hopping into vacant sites.
+  std::optional<std::set<std::pair<std::string, std::string>>>
+      allowed_species_pairs;
+
   /// \brief Optional customizeable filter to skip or allow events
   ///     based on the cluster, occ_init, occ_final, position_init,
   ///     and position_final. Return true to allow, false to skip.
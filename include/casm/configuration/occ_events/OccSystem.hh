@@ -1,6 +1,7 @@
 #ifndef CASM_occ_events_OccSystem
 #define CASM_occ_events_OccSystem
 
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
@@ -39,7 +40,16 @@ struct OccPosition;
 ///   These names match `xtal::BasicStructure::unique_names()`.
 /// - The `atom_name_list` names all atom components of xtal::Molecule.
 ///   These names match `xtal::AtomPosition::name()`.
+/// - The nested lookup tables (`occupant_to_chemical_index`, etc.) are
+///   also stored as flat arrays of `short_index_type`, indexed using
+///   per-sublattice offsets, which are used by the `get_*` accessors and
+///   the occupation checks so that lookups in event counting loops stay
+///   in cache. The flat arrays are built by the constructor and are not
+///   updated if the nested tables are modified.
 struct OccSystem {
+  /// \brief Compact index type used in flat lookup tables
+  typedef std::int16_t short_index_type;
+
   OccSystem(std::shared_ptr<xtal::BasicStructure const> const &_prim,
             std::vector<std::string> const &_chemical_name_list,
             std::set<std::string> const &_vacancy_name_list =
@@ -114,6 +124,64 @@ struct OccSystem {
   /// - -1 if invalid
   std::vector<std::vector<int>> orientation_to_occupant_index;
 
+  // --- Flat lookup tables ---
+
+  /// \brief Offset of sublattice occupants in flat occupant tables
+  ///
+  /// Usage:
+  /// - occupant_offset[b] + occupant_index -> occupant flat index
+  std::vector<Index> occupant_offset;
+
+  /// \brief Flat conversion table of occupant flat index to chemical index
+  std::vector<short_index_type> flat_occupant_to_chemical_index;
+
+  /// \brief Flat conversion table of occupant flat index to orientation
+  /// index
+  std::vector<short_index_type> flat_occupant_to_orientation_index;
+
+  /// \brief Offset of occupant atom positions in
+  ///     `flat_atom_position_to_name_index`
+  ///
+  /// Usage:
+  /// - The atom name indices of the atoms of the occupant with flat index
+  ///   `i` are `flat_atom_position_to_name_index[j]`, for
+  ///   `atom_position_offset[i] <= j < atom_position_offset[i + 1]`
+  std::vector<Index> atom_position_offset;
+
+  /// \brief Flat conversion table of atom position to atom name index
+  std::vector<short_index_type> flat_atom_position_to_name_index;
+
+  /// \brief Index into the flat occupant tables
+  Index get_occupant_flat_index(Index b, Index occupant_index) const {
+    return occupant_offset[b] + occupant_index;
+  }
+
+  /// \brief Chemical index of occupant `occupant_index` on sublattice `b`
+  Index get_chemical_index(Index b, Index occupant_index) const {
+    return flat_occupant_to_chemical_index[get_occupant_flat_index(
+        b, occupant_index)];
+  }
+
+  /// \brief Orientation index of occupant `occupant_index` on sublattice `b`
+  Index get_orientation_index(Index b, Index occupant_index) const {
+    return flat_occupant_to_orientation_index[get_occupant_flat_index(
+        b, occupant_index)];
+  }
+
+  /// \brief Number of atoms in occupant `occupant_index` on sublattice `b`
+  Index get_n_atom_positions(Index b, Index occupant_index) const {
+    Index i = get_occupant_flat_index(b, occupant_index);
+    return atom_position_offset[i + 1] - atom_position_offset[i];
+  }
+
+  /// \brief Atom name index of an atom position
+  Index get_atom_name_index(Index b, Index occupant_index,
+                            Index atom_position_index) const {
+    return flat_atom_position_to_name_index
+        [atom_position_offset[get_occupant_flat_index(b, occupant_index)] +
+         atom_position_index];
+  }
+
   // --- OccPosition factory functions ---
 
   OccPosition make_molecule_position(
@@ -151,36 +219,34 @@ struct OccSystem {
   std::string get_chemical_name(
       xtal::UnitCellCoord const &integral_site_coordinate,
       Index occupant_index) const {
-    return chemical_name_list
-        [occupant_to_chemical_index[integral_site_coordinate.sublattice()]
-                                   [occupant_index]];
+    return chemical_name_list[get_chemical_index(
+        integral_site_coordinate.sublattice(), occupant_index)];
   }
 
   std::string get_orientation_name(
       xtal::UnitCellCoord const &integral_site_coordinate,
       Index occupant_index) const {
-    return orientation_name_list
-        [occupant_to_orientation_index[integral_site_coordinate.sublattice()]
-                                      [occupant_index]];
+    return orientation_name_list[get_orientation_index(
+        integral_site_coordinate.sublattice(), occupant_index)];
   }
 
   std::string get_atom_name(xtal::UnitCellCoord const &integral_site_coordinate,
                             Index occupant_index,
                             Index atom_position_index) const {
-    return atom_name_list
-        [atom_position_to_name_index[integral_site_coordinate.sublattice()]
-                                    [occupant_index][atom_position_index]];
+    return atom_name_list[get_atom_name_index(
+        integral_site_coordinate.sublattice(), occupant_index,
+        atom_position_index)];
   }
 
   std::vector<std::string> get_atom_names(
       xtal::UnitCellCoord const &integral_site_coordinate,
       Index occupant_index) const {
     std::vector<std::string> atom_names;
-    auto const &indices =
-        atom_position_to_name_index[integral_site_coordinate.sublattice()]
-                                   [occupant_index];
-    for (auto const &atom_name_index : indices) {
-      atom_names.push_back(atom_name_list[atom_name_index]);
+    Index b = integral_site_coordinate.sublattice();
+    Index n = get_n_atom_positions(b, occupant_index);
+    for (Index j = 0; j < n; ++j) {
+      atom_names.push_back(
+          atom_name_list[get_atom_name_index(b, occupant_index, j)]);
     }
     return atom_names;
   }
@@ -210,20 +276,18 @@ struct OccSystem {
     if (p.is_in_reservoir) {
       return p.occupant_index;
     }
-    return occupant_to_chemical_index[get_sublattice_index(p)]
-                                     [p.occupant_index];
+    return get_chemical_index(get_sublattice_index(p), p.occupant_index);
   }
 
   /// Valid if p.is_in_reservoir==false
   Index get_orientation_index(OccPosition const &p) const {
-    return occupant_to_orientation_index[get_sublattice_index(p)]
-                                        [p.occupant_index];
+    return get_orientation_index(get_sublattice_index(p), p.occupant_index);
   }
 
   /// Valid if p.is_atom==true
   Index get_atom_name_index(OccPosition const &p) const {
-    return atom_position_to_name_index[get_sublattice_index(p)]
-                                      [p.occupant_index][p.atom_position_index];
+    return get_atom_name_index(get_sublattice_index(p), p.occupant_index,
+                               p.atom_position_index);
   }
 
   /// Valid if p.is_in_reservoir==false
@@ -0,0 +1,71 @@
+#ifndef CASM_occ_events_OccSystemCache
+#define CASM_occ_events_OccSystemCache
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "casm/configuration/occ_events/definitions.hh"
+
+namespace CASM {
+namespace occ_events {
+
+/// \brief Stores OccSystem in memory, keyed by the prim and names
+///
+/// Notes:
+/// - OccSystem are keyed by the prim JSON, as by `write_prim` with
+///   fractional coordinates and vacancies included, and the lattice
+///   tolerance (as for `config::PrimSymInfoCache`), the chemical name list,
+///   and the vacancy name list. Prims that are equal up to floating point
+///   precision share one OccSystem, which holds the prim it was first
+///   constructed with.
+/// - If no chemical name list is given, the default from
+///   `make_chemical_name_list` is used, which requires the prim factor
+///   group. It is also stored, by prim JSON.
+/// - Results are shared, and not copied, when they are found in memory.
+/// - It is safe to call `make` concurrently.
+class OccSystemCache {
+ public:
+  /// \brief Constructor
+  OccSystemCache();
+
+  /// \brief Return the stored OccSystem, or construct, store, and return a
+  ///     new OccSystem
+  std::shared_ptr<OccSystem const> make(
+      std::shared_ptr<xtal::BasicStructure const> const &prim,
+      std::optional<std::vector<std::string>> const &chemical_name_list =
+          std::nullopt,
+      std::set<std::string> const &vacancy_name_list =
+          std::set<std::string>({"Va", "VA", "va"}));
+
+  /// \brief Number of OccSystem stored
+  Index size() const;
+
+  /// \brief Erase stored results
+  void clear();
+
+ private:
+  typedef std::tuple<std::string, std::vector<std::string>,
+                     std::set<std::string>>
+      key_type;
+
+  mutable std::mutex m_mutex;
+
+  /// Default chemical name lists, by prim JSON
+  std::map<std::string, std::vector<std::string>> m_chemical_name_lists;
+
+  std::map<key_type, std::shared_ptr<OccSystem const>> m_entries;
+};
+
+/// \brief Process-wide OccSystemCache
+OccSystemCache &occ_system_cache();
+
+}  // namespace occ_events
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef CASM_occ_events_PackedOccEvent
+#define CASM_occ_events_PackedOccEvent
+
+#include <cstdint>
+#include <vector>
+
+#include "casm/configuration/occ_events/definitions.hh"
+
+namespace CASM {
+namespace occ_events {
+
+struct OccPosition;
+
+/// \brief Encodes an OccPosition as one 64-bit integer
+///
+/// Fields, from most to least significant bits:
+/// - kind (2 bits): 0 for a molecule, 1 for an atom, 2 for a position in the
+///   reservoir
+/// - unit cell i, j, k (12 bits each): offset by 2048, so values in
+///   [-2048, 2047] are allowed
+/// - sublattice b (10 bits)
+/// - occupant index (8 bits)
+/// - atom position index (8 bits)
+///
+/// Fields that OccPosition comparisons ignore (the site of a position in the
+/// reservoir, and the atom position index of a molecule) are stored as 0, so
+/// packed positions compare with `<` and `==` exactly as OccPosition does.
+struct PackedOccPosition {
+  static constexpr int kind_bits = 2;
+  static constexpr int unitcell_bits = 12;
+  static constexpr int sublattice_bits = 10;
+  static constexpr int occupant_bits = 8;
+  static constexpr int atom_position_bits = 8;
+
+  static constexpr long unitcell_offset = 1L << (unitcell_bits - 1);
+
+  /// \brief Return true if `pos` can be packed
+  static bool is_packable(OccPosition const &pos);
+
+  /// \brief Pack an OccPosition; throws if it is not packable
+  static std::uint64_t pack(OccPosition const &pos);
+
+  /// \brief Unpack an OccPosition
+  static OccPosition unpack(std::uint64_t value);
+};
+
+/// \brief An OccEvent encoded as a vector of 64-bit integers
+///
+/// The key is `[n_trajectories, (n_positions, packed positions...) ...]`, so
+/// lexicographical comparison of keys gives the same order as
+/// `OccEvent::operator<`, and keys are equal exactly when events are equal.
+/// Comparing or hashing a PackedOccEvent compares or hashes a contiguous
+/// array of integers instead of walking OccTrajectory and OccPosition field
+/// by field.
+///
+/// As for OccEvent, equivalent events only have equal keys if they are in
+/// the same form, so events should be standardized and translated
+/// consistently before packing.
+struct PackedOccEvent {
+  PackedOccEvent() {}
+
+  /// \brief Pack an OccEvent; throws if it is not packable
+  explicit PackedOccEvent(OccEvent const &event);
+
+  /// \brief Return true if all positions in `event` can be packed
+  static bool is_packable(OccEvent const &event);
+
+  /// \brief Unpack the OccEvent
+  OccEvent unpack() const;
+
+  std::vector<std::uint64_t> key;
+
+  bool operator<(PackedOccEvent const &B) const { return key < B.key; }
+  bool operator>(PackedOccEvent const &B) const { return B.key < key; }
+  bool operator<=(PackedOccEvent const &B) const { return !(B.key < key); }
+  bool operator>=(PackedOccEvent const &B) const { return !(key < B.key); }
+  bool operator==(PackedOccEvent const &B) const { return key == B.key; }
+  bool operator!=(PackedOccEvent const &B) const { return key != B.key; }
+};
+
+/// \brief Hash of a PackedOccEvent
+struct PackedOccEventHash {
+  std::size_t operator()(PackedOccEvent const &event) const;
+};
+
+}  // namespace occ_events
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef CASM_occ_events_OccEvent_binary_io
+#define CASM_occ_events_OccEvent_binary_io
+
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/occ_events/definitions.hh"
+
+namespace CASM {
+namespace occ_events {
+
+/// \brief Version of the binary OccEvent format
+constexpr unsigned int OCC_EVENT_BINARY_VERSION = 1;
+
+/// \brief First bytes of a binary OccEvent stream
+constexpr char OCC_EVENT_BINARY_MAGIC[8] = {'C', 'A', 'S', 'M',
+                                            'O', 'E', 'V', 'B'};
+
+/// \brief Digest of the OccSystem indices that OccEvent refer to
+///
+/// A 64-bit FNV-1a hash of the number of sublattices, the chemical, atom,
+/// and orientation name lists, and the occupant and atom position lookup
+/// tables. OccEvent written for one OccSystem can be read with another
+/// OccSystem exactly when the digests are equal.
+std::uint64_t make_occsystem_digest(OccSystem const &system);
+
+/// \brief Write OccEvent in binary format
+///
+/// Format (version 1, all integers little-endian):
+/// - Header: the 8 bytes "CASMOEVB", uint32 version, then the uint64
+///   `make_occsystem_digest` of the OccSystem.
+/// - int64 number of groups, then for each group int64 number of events,
+///   followed by the events. A list of events is written as one group, and
+///   event orbits as one group per orbit.
+/// - Each event begins with a uint8 encoding:
+///   - 'P': uint32 key size, then the `PackedOccEvent` key as uint64
+///     values. Used for events where `PackedOccEvent::is_packable`.
+///   - 'F': uint32 number of trajectories, then for each trajectory uint32
+///     number of positions, then for each position a uint8 with bit 0 set
+///     if `is_in_reservoir` and bit 1 set if `is_atom`, followed by int64
+///     sublattice, i, j, k, occupant_index, and atom_position_index.
+void write_binary(std::ostream &out, std::vector<OccEvent> const &events,
+                  OccSystem const &system);
+
+/// \brief Write OccEvent orbits in binary format
+void write_binary(std::ostream &out,
+                  std::vector<std::set<OccEvent>> const &orbits,
+                  OccSystem const &system);
+
+/// \brief Read OccEvent from binary format
+void read_binary(std::istream &in, OccSystem const &system,
+                 std::vector<OccEvent> &events);
+
+/// \brief Read OccEvent orbits from binary format
+void read_binary(std::istream &in, OccSystem const &system,
+                 std::vector<std::set<OccEvent>> &orbits);
+
+/// \brief Convert OccEvent to binary format
+std::string to_bytes(std::vector<OccEvent> const &events,
+                     OccSystem const &system);
+
+/// \brief Convert OccEvent orbits to binary format
+std::string to_bytes(std::vector<std::set<OccEvent>> const &orbits,
+                     OccSystem const &system);
+
+/// \brief Read OccEvent from binary format
+std::vector<OccEvent> occevents_from_bytes(std::string const &bytes,
+                                           OccSystem const &system);
+
+/// \brief Read OccEvent orbits from binary format
+std::vector<std::set<OccEvent>> occevent_orbits_from_bytes(
+    std::string const &bytes, OccSystem const &system);
+
+}  // namespace occ_events
+}  // namespace CASM
+
+#endif
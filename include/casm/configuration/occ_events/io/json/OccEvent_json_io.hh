@@ -2,9 +2,13 @@
 #define CASM_occ_events_OccEvent_json_io
 
 #include <functional>
+#include <iostream>
 #include <memory>
 #include <optional>
+#include <set>
+#include <vector>
 
+#include "casm/configuration/io/json/JsonArrayWriter.hh"
 #include "casm/configuration/occ_events/definitions.hh"
 #include "casm/crystallography/io/SymInfo_json_io.hh"
 #include "casm/crystallography/io/SymInfo_stream_io.hh"
@@ -88,6 +92,18 @@ jsonParser &to_json(
     occ_events::OccEventOutputOptions const &options =
         occ_events::OccEventOutputOptions());
 
+/// \brief Write OccEvent orbits to a stream as a JSON array, one orbit at a
+///     time
+void write_occevent_orbits_json(
+    std::ostream &out,
+    std::vector<std::set<occ_events::OccEvent>> const &orbits,
+    std::optional<std::reference_wrapper<occ_events::OccSystem const>> system,
+    std::shared_ptr<occ_events::SymGroup const> const &factor_group,
+    std::vector<occ_events::OccEventRep> const &occevent_symgroup_rep,
+    occ_events::OccEventOutputOptions const &options =
+        occ_events::OccEventOutputOptions(),
+    JsonStreamOptions const &stream_options = JsonStreamOptions());
+
 void from_json(occ_events::OccEvent &event, jsonParser const &json,
                occ_events::OccSystem const &system);
 
@@ -1,6 +1,7 @@
 #ifndef CASM_occ_events_orbits
 #define CASM_occ_events_orbits
 
+#include <functional>
 #include <set>
 #include <vector>
 
@@ -15,6 +16,12 @@ struct OccEventCounterParameters;
 OccEvent prim_periodic_occevent_copy_apply(OccEventRep const &rep,
                                            OccEvent occ_event);
 
+/// \brief Apply symmetry operation transformation to an OccEvent, writing
+///     the result into an existing OccEvent
+OccEvent &prim_periodic_occevent_apply(OccEventRep const &rep,
+                                       OccEvent const &occ_event,
+                                       OccEvent &result);
+
 /// \brief Make an orbit of OccEvent, with periodic symmetry of a prim
 std::set<OccEvent> make_prim_periodic_orbit(
     OccEvent const &orbit_element,
@@ -40,6 +47,15 @@ std::vector<std::shared_ptr<SymGroup const>> make_occevent_groups(
     Eigen::Matrix3d const &lat_column_mat,
     std::vector<OccEventRep> const &occevent_symgroup_rep);
 
+/// \brief Make groups that leave OccEvent orbit elements invariant, for
+///     multiple orbits
+std::vector<std::vector<std::shared_ptr<SymGroup const>>> make_occevent_groups(
+    std::vector<std::set<OccEvent>> const &orbits,
+    std::shared_ptr<SymGroup const> const &symgroup,
+    Eigen::Matrix3d const &lat_column_mat,
+    std::vector<OccEventRep> const &occevent_symgroup_rep,
+    Index n_threads = 1);
+
 /// \brief Make the group which leaves an OccEvent invariant
 std::shared_ptr<SymGroup const> make_occevent_group(
     OccEvent occ_event, std::shared_ptr<SymGroup const> const &symgroup,
@@ -53,6 +69,20 @@ std::vector<OccEvent> make_prim_periodic_occevent_prototypes(
     std::vector<clust::IntegralCluster> const &clusters,
     std::vector<OccEventRep> const &occevent_symgroup_rep,
     OccEventCounterParameters const &params,
+    std::vector<OccEvent> const &custom_events = {}, Index n_threads = 1);
+
+/// \brief Function called once for each distinct orbit found by
+///     `for_each_prim_periodic_occevent_orbit`, as `f(prototype, orbit)`
+typedef std::function<void(OccEvent const &, std::set<OccEvent> const &)>
+    OccEventOrbitFunction;
+
+/// \brief Generate orbits of OccEvent incrementally, as OccEventCounter
+///     counts them, with periodic symmetry of a prim
+Index for_each_prim_periodic_occevent_orbit(
+    std::shared_ptr<OccSystem const> const &system,
+    std::vector<clust::IntegralCluster> const &clusters,
+    std::vector<OccEventRep> const &occevent_symgroup_rep,
+    OccEventCounterParameters const &params, OccEventOrbitFunction const &f,
     std::vector<OccEvent> const &custom_events = {});
 
 /// \brief Make orbits of OccEvent, with periodic symmetry of a prim
@@ -61,7 +91,7 @@ std::vector<std::set<OccEvent>> make_prim_periodic_occevent_orbits(
     std::vector<clust::IntegralCluster> const &clusters,
     std::vector<OccEventRep> const &occevent_symgroup_rep,
     OccEventCounterParameters const &params,
-    std::vector<OccEvent> const &custom_events = {});
+    std::vector<OccEvent> const &custom_events = {}, Index n_threads = 1);
 
 }  // namespace occ_events
 }  // namespace CASM
@@ -0,0 +1,212 @@
+#ifndef CASM_config_parallel
+#define CASM_config_parallel
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "casm/global/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Set the number of threads used by parallel operations
+void set_num_threads(Index n_threads);
+
+/// \brief Number of threads used by parallel operations
+Index get_num_threads();
+
+/// \brief Return true if called from a task of a parallel operation
+bool in_parallel_region();
+
+/// \brief Return the number of threads to use for a parallel operation
+Index resolve_n_threads(Index n_threads, Index n_items);
+
+namespace parallel_impl {
+
+/// \brief Call `task(t)` for each `t` in `[0, n_tasks)`, using the
+///     process-wide thread pool and the calling thread
+void run_tasks(Index n_tasks, std::function<void(Index)> const &task);
+
+}  // namespace parallel_impl
+
+/// \brief Call `f(chunk_begin, chunk_end)` on contiguous chunks of
+///     `[0, n_items)`, using up to `n_threads` threads
+template <typename F>
+void parallel_for_chunks(Index n_items, Index n_threads, F f);
+
+/// \brief Call `f(thread_index, item_index)`, or `f(item_index)`, for each
+///     item in `[0, n_items)`, using up to `n_threads` threads that take
+///     items in turn
+template <typename F>
+void parallel_for_items(Index n_items, Index n_threads, F f);
+
+/// \brief A queue with fixed capacity, for passing work between threads
+///
+/// Notes:
+/// - `push` blocks while the queue is full, which applies backpressure to
+///   producers, and `pop` blocks while the queue is empty.
+/// - After `close`, `push` returns false without adding, and `pop` returns
+///   the remaining values and then std::nullopt. Closing wakes all blocked
+///   threads, so closing every queue is enough to stop a pipeline.
+/// - All methods are safe to call concurrently.
+template <typename T>
+class BoundedQueue {
+ public:
+  /// \brief Constructor
+  ///
+  /// \param _capacity Maximum number of values held. Must be >= 1.
+  explicit BoundedQueue(Index _capacity)
+      : m_capacity(std::max(Index(1), _capacity)), m_closed(false) {}
+
+  /// \brief Add a value, waiting while the queue is full
+  ///
+  /// \returns True if the value was added, false if the queue was closed
+  bool push(T value) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_not_full.wait(lock,
+                    [&]() { return m_closed || m_data.size() < m_capacity; });
+    if (m_closed) {
+      return false;
+    }
+    m_data.push_back(std::move(value));
+    lock.unlock();
+    m_not_empty.notify_one();
+    return true;
+  }
+
+  /// \brief Remove a value, waiting while the queue is empty
+  ///
+  /// \returns The value, or std::nullopt if the queue is closed and empty
+  std::optional<T> pop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_not_empty.wait(lock, [&]() { return m_closed || !m_data.empty(); });
+    if (m_data.empty()) {
+      return std::nullopt;
+    }
+    std::optional<T> value(std::move(m_data.front()));
+    m_data.pop_front();
+    lock.unlock();
+    m_not_full.notify_one();
+    return value;
+  }
+
+  /// \brief Stop accepting values, and wake all waiting threads
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_closed = true;
+    }
+    m_not_full.notify_all();
+    m_not_empty.notify_all();
+  }
+
+  /// \brief Maximum number of values held
+  Index capacity() const { return m_capacity; }
+
+ private:
+  Index m_capacity;
+  bool m_closed;
+  std::deque<T> m_data;
+  std::mutex m_mutex;
+  std::condition_variable m_not_full;
+  std::condition_variable m_not_empty;
+};
+
+// --- Inline definitions ---
+
+/// \brief Return the number of threads to use for a parallel operation
+///
+/// \param n_threads Requested number of threads. If `n_threads <= 0`, use
+///     `get_num_threads()`, which is `std::thread::hardware_concurrency()`
+///     unless set otherwise.
+/// \param n_items Number of independent work items. The result is never
+///     greater than `n_items`, and is at least 1.
+///
+/// Returns 1 if called from a task of a parallel operation, so nested
+/// parallel operations run on the calling thread.
+inline Index resolve_n_threads(Index n_threads, Index n_items) {
+  if (in_parallel_region()) {
+    return 1;
+  }
+  if (n_threads <= 0) {
+    n_threads = get_num_threads();
+  }
+  return std::max(Index(1), std::min(n_threads, n_items));
+}
+
+/// \brief Call `f(chunk_begin, chunk_end)` on contiguous chunks of
+///     `[0, n_items)`, using up to `n_threads` threads
+///
+/// Notes:
+/// - `[0, n_items)` is split into `resolve_n_threads(n_threads, n_items)`
+///   chunks of nearly equal size. If there is only one chunk, `f` is called
+///   on the current thread. Otherwise, chunks are run as tasks on the
+///   process-wide thread pool, and by the calling thread, so at most
+///   `get_num_threads()` chunks run at once, regardless of `n_threads`.
+/// - `f` must be safe to call concurrently on disjoint chunks.
+/// - If any call to `f` throws, the first exception caught is rethrown after
+///   all chunks have finished.
+template <typename F>
+void parallel_for_chunks(Index n_items, Index n_threads, F f) {
+  if (n_items <= 0) {
+    return;
+  }
+  n_threads = resolve_n_threads(n_threads, n_items);
+  if (n_threads == 1) {
+    f(Index(0), n_items);
+    return;
+  }
+
+  Index chunk_size = n_items / n_threads;
+  Index remainder = n_items % n_threads;
+  parallel_impl::run_tasks(n_threads, [&](Index t) {
+    Index chunk_begin = t * chunk_size + std::min(t, remainder);
+    Index chunk_end = chunk_begin + chunk_size + (t < remainder ? 1 : 0);
+    f(chunk_begin, chunk_end);
+  });
+}
+
+/// \brief Call `f(thread_index, item_index)`, or `f(item_index)`, for each
+///     item in `[0, n_items)`, using up to `n_threads` threads that take
+///     items in turn
+///
+/// Notes:
+/// - Unlike `parallel_for_chunks`, items are handed out one at a time from
+///   a shared counter, which balances the load when items take very
+///   different amounts of time.
+/// - `thread_index` is in `[0, resolve_n_threads(n_threads, n_items))`, so it
+///   can index per-thread results. Each thread calls `f` sequentially. If
+///   `f` only takes `item_index`, the thread index is not passed.
+/// - If any call to `f` throws, the first exception caught is rethrown after
+///   all threads have finished. The thread that threw takes no more items.
+template <typename F>
+void parallel_for_items(Index n_items, Index n_threads, F f) {
+  n_threads = resolve_n_threads(n_threads, n_items);
+  std::atomic<Index> next(0);
+  parallel_for_chunks(n_threads, n_threads, [&](Index begin, Index end) {
+    for (Index t = begin; t < end; ++t) {
+      Index i;
+      while ((i = next++) < n_items) {
+        if constexpr (std::is_invocable_v<F &, Index, Index>) {
+          f(t, i);
+        } else {
+          f(i);
+        }
+      }
+    }
+  });
+}
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef CASM_config_perf
+#define CASM_config_perf
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Optional instrumentation of hot paths
+///
+/// Counters and scoped timers are recorded by the `CASM_CONFIGURATION_PERF_*`
+/// macros, which are only active if the library is compiled with
+/// `-DCASM_CONFIGURATION_PERF` (CMake option `CASM_CONFIGURATION_PERF`).
+/// Otherwise the macros expand to nothing and all counters remain zero.
+///
+/// Notes:
+/// - Counters are relaxed atomics, so they may be updated from parallel
+///   loops. Totals are exact, but enabling instrumentation adds contention
+///   to multi-threaded hot loops; it is meant for tuning, not production.
+/// - The counter and timer storage is always compiled into the library, so
+///   code compiled with and without instrumentation may be linked together.
+namespace perf {
+
+/// \brief Instrumentation counters
+enum class Counter : int {
+  /// Number of SupercellSymOp applied to ConfigDoFValues
+  supercell_sym_op_apply,
+
+  /// Number of ConfigIsEquivalent comparisons
+  config_is_equivalent_compare,
+
+  /// Number of occupation comparisons which found a differing site
+  config_is_equivalent_early_exit,
+
+  /// Sum, over early exits, of the number of sites found equal before the
+  /// first differing site
+  config_is_equivalent_early_exit_depth,
+
+  /// Number of translation permutations requested from a supercell's
+  /// TranslationPermutationCache
+  translation_permutation_lookup,
+
+  /// Number of translation permutations constructed by a supercell's
+  /// TranslationPermutationCache
+  translation_permutation_rebuild,
+
+  /// Number of Supercell constructed
+  supercell_construction,
+
+  /// Number of configurations for which a canonical operation was found
+  canonicalization,
+
+  /// Number of candidate clusters tested during orbit generation
+  orbit_candidate_tested,
+
+  /// Number of unique candidate clusters kept during orbit generation
+  orbit_candidate_kept,
+
+  n_counters
+};
+
+/// \brief Instrumentation timers
+enum class Timer : int {
+  /// to_canonical(Configuration const &, begin, end)
+  to_canonical,
+
+  /// CanonicalFormEngine canonicalization methods
+  canonical_form_engine,
+
+  /// make_prim_periodic_orbits
+  make_prim_periodic_orbits,
+
+  /// make_local_orbits
+  make_local_orbits,
+
+  /// make_distinct_perturbations
+  make_distinct_perturbations,
+
+  /// config_space_analysis
+  config_space_analysis,
+
+  n_timers
+};
+
+/// \brief Accumulated values of a timer
+struct TimerValue {
+  /// \brief Number of timed scopes
+  Index count = 0;
+
+  /// \brief Total time, in seconds
+  double total_s = 0.0;
+};
+
+/// \brief A snapshot of all counters and timers
+struct PerfReport {
+  /// \brief True if instrumentation was compiled in
+  bool enabled = false;
+
+  /// \brief Counter values, by name
+  std::map<std::string, Index> counters;
+
+  /// \brief Timer values, by name
+  std::map<std::string, TimerValue> timers;
+};
+
+/// \brief Return true if the library was compiled with instrumentation
+bool is_enabled();
+
+/// \brief Return the name of a counter
+std::string name(Counter counter);
+
+/// \brief Return the name of a timer
+std::string name(Timer timer);
+
+/// \brief Add to a counter
+inline void count(Counter counter, Index n = 1);
+
+/// \brief Add a timed scope to a timer
+void add_time(Timer timer, std::chrono::steady_clock::duration duration);
+
+/// \brief Set all counters and timers to zero
+void reset();
+
+/// \brief Return a snapshot of all counters and timers
+PerfReport make_report();
+
+/// \brief Time a scope, adding the elapsed time to a timer on destruction
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(Timer timer)
+      : m_timer(timer), m_begin(std::chrono::steady_clock::now()) {}
+
+  ScopedTimer(ScopedTimer const &) = delete;
+  ScopedTimer &operator=(ScopedTimer const &) = delete;
+
+  ~ScopedTimer() {
+    add_time(m_timer, std::chrono::steady_clock::now() - m_begin);
+  }
+
+ private:
+  Timer m_timer;
+  std::chrono::steady_clock::time_point m_begin;
+};
+
+// --- Inline definitions ---
+
+namespace detail {
+
+/// \brief Counter storage, use `count` and `make_report`
+extern std::array<std::atomic<Index>, int(Counter::n_counters)> counters;
+
+}  // namespace detail
+
+/// \brief Add to a counter
+///
+/// Inline, so that counting in hot loops does not require a function call.
+inline void count(Counter counter, Index n) {
+  detail::counters[int(counter)].fetch_add(n, std::memory_order_relaxed);
+}
+
+}  // namespace perf
+}  // namespace config
+}  // namespace CASM
+
+#ifdef CASM_CONFIGURATION_PERF
+
+/// \brief Increment the counter `perf::Counter::NAME` by 1
+#define CASM_CONFIGURATION_PERF_COUNT(NAME) \
+  ::CASM::config::perf::count(::CASM::config::perf::Counter::NAME)
+
+/// \brief Increment the counter `perf::Counter::NAME` by `N`
+#define CASM_CONFIGURATION_PERF_COUNT_N(NAME, N) \
+  ::CASM::config::perf::count(::CASM::config::perf::Counter::NAME, (N))
+
+/// \brief Time the enclosing scope with the timer `perf::Timer::NAME`
+#define CASM_CONFIGURATION_PERF_SCOPED_TIMER(NAME)         \
+  ::CASM::config::perf::ScopedTimer casm_perf_timer_##NAME( \
+      ::CASM::config::perf::Timer::NAME)
+
+#else
+
+#define CASM_CONFIGURATION_PERF_COUNT(NAME) ((void)0)
+#define CASM_CONFIGURATION_PERF_COUNT_N(NAME, N) ((void)0)
+#define CASM_CONFIGURATION_PERF_SCOPED_TIMER(NAME) ((void)0)
+
+#endif
+
+#endif
@@ -1,9 +1,12 @@
 #ifndef CASM_config_supercell_name
 #define CASM_config_supercell_name
 
+#include <array>
 #include <string>
 #include <vector>
 
+#include "casm/global/eigen.hh"
+
 namespace CASM {
 namespace xtal {
 class Lattice;
@@ -11,6 +14,31 @@ struct SymOp;
 }  // namespace xtal
 namespace config {
 
+/// \brief Compact key for a Hermite normal form matrix, H
+///
+/// Values are, in order: H(0,0), H(1,1), H(2,2), H(1,2), H(0,2), H(0,1),
+/// the same order as used in supercell names.
+typedef std::array<long, 6> HermiteNormalFormKey;
+
+/// \brief Make the key of the Hermite normal form of a transformation
+///     matrix
+HermiteNormalFormKey make_hermite_normal_form_key(
+    Eigen::Matrix3l const &transformation_matrix_to_super);
+
+/// \brief Parse the key of the Hermite normal form from a supercell name
+HermiteNormalFormKey make_hermite_normal_form_key(
+    std::string const &supercell_name);
+
+/// \brief Make the Hermite normal form matrix from its key
+Eigen::Matrix3l make_hermite_normal_form(HermiteNormalFormKey const &key);
+
+/// \brief Make the supercell name from the key of the Hermite normal form
+std::string make_supercell_name(HermiteNormalFormKey const &key);
+
+/// \brief Make the supercell name from a transformation matrix
+std::string make_supercell_name(
+    Eigen::Matrix3l const &transformation_matrix_to_super);
+
 /// \brief Make the supercell name of a superlattice
 std::string make_supercell_name(xtal::Lattice const &prim_lattice,
                                 xtal::Lattice const &superlattice);
@@ -18,19 +18,37 @@ struct ConjugacyClassCompare {
   bool operator()(const map_type &A, const map_type &B) const;
 };
 
+/// \brief Hash of a SymOp, consistent with xtal::SymOpPeriodicCompare_f
+///
+/// Hashes the Cartesian matrix, the fractional translation modulo lattice
+/// translations, and time reversal, with values rounded to bins of
+/// `bin_width`. Equal operations have equal hash values unless a value is
+/// within the comparison tolerance of a bin edge, so this is for use with
+/// group::HashedElementIndex, which falls back to a full search.
+struct SymOpPeriodicHash_f {
+  SymOpPeriodicHash_f(xtal::Lattice const &lattice, double _bin_width = 1e-3);
+
+  std::size_t operator()(SymOp const &op) const;
+
+  Eigen::Matrix3d inv_lat_column_mat;
+  double bin_width;
+};
+
 /// \brief Construct a SymGroup from the group elements, sorting by class
 /// and operation
 std::shared_ptr<SymGroup const> make_symgroup(
-    std::vector<SymOp> const &elements, xtal::Lattice const &lattice);
+    std::vector<SymOp> const &elements, xtal::Lattice const &lattice,
+    Index n_threads = 1);
 
 /// \brief Construct a SymGroup from the group elements,
 ///     without sorting by class
 std::shared_ptr<SymGroup const> make_symgroup_without_sorting(
-    std::vector<SymOp> const &elements, xtal::Lattice const &lattice);
+    std::vector<SymOp> const &elements, xtal::Lattice const &lattice,
+    Index n_threads = 1);
 
 /// \brief Generate prim factor group
 std::shared_ptr<SymGroup const> make_factor_group(
-    xtal::BasicStructure const &prim);
+    xtal::BasicStructure const &prim, Index n_threads = 1);
 
 /// \brief Use prim factor group
 std::shared_ptr<SymGroup const> use_factor_group(
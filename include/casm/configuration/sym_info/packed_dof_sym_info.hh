@@ -0,0 +1,142 @@
+#ifndef CASM_sym_info_packed_dof
+#define CASM_sym_info_packed_dof
+
+#include <vector>
+
+#include "casm/configuration/sym_info/definitions.hh"
+
+namespace CASM {
+namespace sym_info {
+
+/// \brief DoF symmetry representation matrices stored contiguously, for
+///     fast application
+///
+/// The matrices of a LocalDoFSymGroupRep, indexed by [op][sublattice], or of
+/// a GlobalDoFSymGroupRep, indexed by [op] and treated as having one
+/// sublattice, are stored column-major in one array, in that order. The
+/// `apply` method multiplies by a fixed-size matrix for the common DoF
+/// dimensions (1, 2, 3, 4, and 6), so that the products can be unrolled and
+/// vectorized, and uses a dynamically-sized matrix otherwise.
+///
+/// Usage:
+/// \code
+/// // same as `after = local_dof_symgroup_rep[op][b] * before`
+/// packed_rep.apply(op, b, before, after);
+/// \endcode
+class PackedDoFSymGroupRep {
+ public:
+  /// \brief Default constructor, with no operations
+  PackedDoFSymGroupRep();
+
+  /// \brief Constructor, from a local DoF representation
+  explicit PackedDoFSymGroupRep(LocalDoFSymGroupRep const &rep);
+
+  /// \brief Constructor, from a global DoF representation
+  explicit PackedDoFSymGroupRep(GlobalDoFSymGroupRep const &rep);
+
+  /// \brief Number of group operations
+  Index n_ops() const { return m_n_ops; }
+
+  /// \brief Number of sublattices (1 for a global DoF representation)
+  Index n_sublat() const { return m_dim.size(); }
+
+  /// \brief DoF dimension on sublattice `b`
+  Index dim(Index b) const { return m_dim[b]; }
+
+  /// \brief Column-major data of the matrix for operation `op` and
+  ///     sublattice `b`
+  double const *data(Index op, Index b) const {
+    return m_data.data() + op * m_op_stride + m_offset[b];
+  }
+
+  /// \brief Matrix for operation `op` and sublattice `b`
+  Eigen::Map<Eigen::MatrixXd const> matrix(Index op, Index b) const {
+    return Eigen::Map<Eigen::MatrixXd const>(data(op, b), m_dim[b], m_dim[b]);
+  }
+
+  /// \brief Set the top `dim(b)` rows of `after` to the matrix for
+  ///     operation `op` and sublattice `b` times the top `dim(b)` rows of
+  ///     `before`
+  template <typename BeforeType, typename AfterType>
+  void apply(Index op, Index b, BeforeType const &before,
+             AfterType &&after) const;
+
+ private:
+  template <int N, typename BeforeType, typename AfterType>
+  static void _apply_fixed(double const *M, BeforeType const &before,
+                           AfterType &after) {
+    after.template topRows<N>().noalias() =
+        Eigen::Map<Eigen::Matrix<double, N, N> const>(M) *
+        before.template topRows<N>();
+  }
+
+  void _init(std::vector<Eigen::MatrixXd const *> const &first_op);
+
+  Index m_n_ops;
+
+  /// DoF dimension, by sublattice
+  std::vector<Index> m_dim;
+
+  /// Offset of each sublattice matrix within the data for one operation
+  std::vector<Index> m_offset;
+
+  /// Size of the data for one operation
+  Index m_op_stride;
+
+  std::vector<double> m_data;
+};
+
+/// \brief Make packed local DoF symmetry representations
+std::map<DoFKey, PackedDoFSymGroupRep> make_packed_dof_symgroup_rep(
+    std::map<DoFKey, LocalDoFSymGroupRep> const &local_dof_symgroup_rep);
+
+/// \brief Make packed global DoF symmetry representations
+std::map<DoFKey, PackedDoFSymGroupRep> make_packed_dof_symgroup_rep(
+    std::map<DoFKey, GlobalDoFSymGroupRep> const &global_dof_symgroup_rep);
+
+// --- Inline definitions ---
+
+/// \brief Set the top `dim(b)` rows of `after` to the matrix for
+///     operation `op` and sublattice `b` times the top `dim(b)` rows of
+///     `before`
+///
+/// \param op Group operation index
+/// \param b Sublattice index, 0 for a global DoF representation
+/// \param before Values before transformation, as an Eigen matrix or vector
+///     expression with at least `dim(b)` rows
+/// \param after Values after transformation, as a writable Eigen matrix or
+///     vector expression of the same size as `before`. Must not alias
+///     `before`.
+template <typename BeforeType, typename AfterType>
+void PackedDoFSymGroupRep::apply(Index op, Index b, BeforeType const &before,
+                                 AfterType &&after) const {
+  double const *M = data(op, b);
+  Index d = m_dim[b];
+  switch (d) {
+    case 0:
+      return;
+    case 1:
+      _apply_fixed<1>(M, before, after);
+      return;
+    case 2:
+      _apply_fixed<2>(M, before, after);
+      return;
+    case 3:
+      _apply_fixed<3>(M, before, after);
+      return;
+    case 4:
+      _apply_fixed<4>(M, before, after);
+      return;
+    case 6:
+      _apply_fixed<6>(M, before, after);
+      return;
+    default:
+      after.topRows(d).noalias() =
+          Eigen::Map<Eigen::MatrixXd const>(M, d, d) * before.topRows(d);
+  }
+}
+
+}  // namespace sym_info
+}  // namespace CASM
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef CASM_config_symmetrize_properties
+#define CASM_config_symmetrize_properties
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+struct ConfigurationWithProperties;
+class SupercellSymOp;
+struct SupercellSymOpWorkspace;
+
+/// \brief Average the properties of a configuration over a group of
+///     operations, in place
+void symmetrize_properties(ConfigurationWithProperties &config_with_properties,
+                           std::vector<SupercellSymOp> const &group);
+
+/// \brief Average the properties of a configuration over a group of
+///     operations, in place, using reusable storage
+void symmetrize_properties(ConfigurationWithProperties &config_with_properties,
+                           std::vector<SupercellSymOp> const &group,
+                           SupercellSymOpWorkspace &workspace);
+
+/// \brief Average the properties of each configuration over the given
+///     group of operations, in place
+void symmetrize_properties(
+    std::vector<ConfigurationWithProperties> &configurations,
+    std::vector<std::vector<SupercellSymOp>> const &groups,
+    Index n_threads = 1);
+
+/// \brief Average the properties of each configuration over its invariant
+///     subgroup, in place
+void symmetrize_properties(
+    std::vector<ConfigurationWithProperties> &configurations,
+    std::set<std::string> const &which_dofs = {"all"}, Index n_threads = 1);
+
+}  // namespace config
+}  // namespace CASM
+
+#endif
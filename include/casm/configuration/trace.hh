@@ -0,0 +1,115 @@
+#ifndef CASM_config_trace
+#define CASM_config_trace
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include "casm/global/definitions.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Optional timeline traces, written as Chrome trace event JSON
+///
+/// Scoped events are recorded by the `CASM_CONFIGURATION_TRACE_*` macros
+/// around the major phases of supercell construction, orbit generation,
+/// OccEvent counting, irrep decomposition, configuration space analysis,
+/// canonicalization batches, parallel tasks, and file I/O.
+///
+/// Notes:
+/// - Tracing is started by `start(path)`, or at library load if the
+///   environment variable `CASM_TRACE_FILE` is set to a path. Events are
+///   held in memory, per thread, and written to the file by `stop()`, or
+///   at exit.
+/// - The file can be viewed with `chrome://tracing` or
+///   https://ui.perfetto.dev. Each thread is shown on its own track, so
+///   stragglers in parallel operations and waits on locks show as gaps.
+/// - When tracing is not active, each scoped event costs one relaxed atomic
+///   load. Unlike the `CASM_CONFIGURATION_PERF_*` instrumentation, trace
+///   events are always compiled in.
+namespace trace {
+
+/// \brief Start recording trace events, to be written to a file
+void start(std::string const &path);
+
+/// \brief Stop recording and write the trace file
+void stop();
+
+/// \brief Return true if trace events are being recorded
+inline bool is_active();
+
+namespace detail {
+
+/// \brief Nonzero, and unique to each call to `start`, while recording
+extern std::atomic<Index> generation;
+
+/// \brief Record a complete event on the calling thread
+void record(Index generation, char const *name, char const *arg_name,
+            Index arg_value, std::chrono::steady_clock::time_point begin,
+            std::chrono::steady_clock::time_point end);
+
+}  // namespace detail
+
+/// \brief Record the duration of a scope as a trace event
+///
+/// `name` and `arg_name` must be string literals, or otherwise outlive the
+/// trace. If not null, `arg_name` and `arg_value` are shown with the event.
+class ScopedEvent {
+ public:
+  explicit ScopedEvent(char const *_name, char const *_arg_name = nullptr,
+                       Index _arg_value = 0)
+      : m_name(_name),
+        m_arg_name(_arg_name),
+        m_arg_value(_arg_value),
+        m_generation(detail::generation.load(std::memory_order_relaxed)) {
+    if (m_generation) {
+      m_begin = std::chrono::steady_clock::now();
+    }
+  }
+
+  ScopedEvent(ScopedEvent const &) = delete;
+  ScopedEvent &operator=(ScopedEvent const &) = delete;
+
+  ~ScopedEvent() {
+    if (m_generation) {
+      detail::record(m_generation, m_name, m_arg_name, m_arg_value, m_begin,
+                     std::chrono::steady_clock::now());
+    }
+  }
+
+ private:
+  char const *m_name;
+  char const *m_arg_name;
+  Index m_arg_value;
+  Index m_generation;
+  std::chrono::steady_clock::time_point m_begin;
+};
+
+// --- Inline definitions ---
+
+/// \brief Return true if trace events are being recorded
+inline bool is_active() {
+  return detail::generation.load(std::memory_order_relaxed) != 0;
+}
+
+}  // namespace trace
+}  // namespace config
+}  // namespace CASM
+
+#define CASM_CONFIGURATION_TRACE_CONCAT_IMPL(A, B) A##B
+#define CASM_CONFIGURATION_TRACE_CONCAT(A, B) \
+  CASM_CONFIGURATION_TRACE_CONCAT_IMPL(A, B)
+
+/// \brief Record the enclosing scope as a trace event named `NAME`
+#define CASM_CONFIGURATION_TRACE_SCOPE(NAME)                         \
+  ::CASM::config::trace::ScopedEvent CASM_CONFIGURATION_TRACE_CONCAT( \
+      casm_trace_event_, __LINE__)(NAME)
+
+/// \brief Record the enclosing scope as a trace event named `NAME`, with
+///     the argument `ARG_NAME: VALUE`
+#define CASM_CONFIGURATION_TRACE_SCOPE_ARG(NAME, ARG_NAME, VALUE)    \
+  ::CASM::config::trace::ScopedEvent CASM_CONFIGURATION_TRACE_CONCAT( \
+      casm_trace_event_, __LINE__)(NAME, ARG_NAME, (VALUE))
+
+#endif
@@ -80,6 +80,20 @@ def has_source_extension(filepath):
     return False
 
 
+def cuda_source_files(search_root):
+    """CUDA source files (.cu), which are only compiled with the optional CUDA
+    backend, so they are not included by source_files()
+    """
+    files = [
+        (dirpath, files)
+        for dirpath, dirnames, files in os.walk(search_root, followlinks=True)
+    ]
+    _cuda_source_files = [
+        os.path.join(d, f) for d, fs in files for f in fs if f.endswith(".cu")
+    ]
+    return sorted(_cuda_source_files)
+
+
 def header_and_source_extensions():
     return header_extensions() + source_extensions()
 
@@ -130,6 +144,15 @@ def unit_test_source_files(search_dir, additional):
     return files
 
 
+def benchmark_source_files(search_dir):
+    files = []
+    for root, dirs, _files in os.walk(search_dir):
+        for file in _files:
+            if has_source_extension(file):
+                files.append(os.path.join(root, file))
+    return sorted(files)
+
+
 def as_cmake_file_strings(files):
     cmake_file_strings = ""
     for file in files:
@@ -150,6 +173,10 @@ files = source_files("src")
 cmake_file_strings = as_cmake_file_strings(files)
 cmakelists = cmakelists.replace("@source_files@", cmake_file_strings)
 
+files = cuda_source_files("src")
+cmake_file_strings = as_cmake_file_strings(files)
+cmakelists = cmakelists.replace("@cuda_source_files@", cmake_file_strings)
+
 with open("CMakeLists.txt", "w") as f:
     f.write(cmakelists)
 
@@ -183,5 +210,13 @@ files = unit_test_source_files("unit/occ_events", additional)
 cmake_file_strings = as_cmake_file_strings(files)
 cmakelists = cmakelists.replace("@casm_unit_occ_events_source_files@", cmake_file_strings)
 
+files = unit_test_source_files("unit/thread_safety", additional)
+cmake_file_strings = as_cmake_file_strings(files)
+cmakelists = cmakelists.replace("@casm_unit_thread_safety_source_files@", cmake_file_strings)
+
+files = benchmark_source_files("benchmark")
+cmake_file_strings = as_cmake_file_strings(files)
+cmakelists = cmakelists.replace("@casm_configuration_benchmarks_source_files@", cmake_file_strings)
+
 with open("CMakeLists.txt", "w") as f:
     f.write(cmakelists)
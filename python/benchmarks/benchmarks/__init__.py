@@ -0,0 +1 @@
+"""End-to-end benchmarks of libcasm-configuration Python workflows"""
@@ -0,0 +1,34 @@
+"""asv benchmarks of the workflows in :mod:`benchmarks.workflows`"""
+import time
+
+from .workflows import WORKFLOWS
+
+_BY_NAME = {workflow.name: workflow for workflow in WORKFLOWS}
+
+
+class Workflows:
+    params = [list(_BY_NAME.keys())]
+    param_names = ["workflow"]
+    timeout = 600
+
+    def setup(self, name):
+        self.workflow = _BY_NAME[name]
+        self.inputs = self.workflow.setup()
+
+    def time_run(self, name):
+        self.workflow.run(self.inputs)
+
+    def peakmem_run(self, name):
+        self.workflow.run(self.inputs)
+
+    def track_items_per_second(self, name):
+        start = time.perf_counter()
+        n_items = self.workflow.run(self.inputs)
+        return n_items / (time.perf_counter() - start)
+
+    track_items_per_second.unit = "items/s"
+
+    def track_items(self, name):
+        return self.workflow.run(self.inputs)
+
+    track_items.unit = "items"
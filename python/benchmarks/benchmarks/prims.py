@@ -0,0 +1,102 @@
+"""Fixed prims used by the workflow benchmarks
+
+The prims are constructed explicitly, rather than loaded from files, so that
+results are comparable between releases.
+"""
+from math import sqrt
+
+import numpy as np
+
+import libcasm.configuration as casmconfig
+import libcasm.xtal as xtal
+import libcasm.xtal.prims as xtal_prims
+
+
+def FCC_binary_prim() -> casmconfig.Prim:
+    """FCC, with occupants A and B"""
+    return casmconfig.Prim(xtal_prims.FCC(r=0.5, occ_dof=["A", "B"]))
+
+
+def FCC_A_B_Va_prim() -> casmconfig.Prim:
+    """FCC, with occupants A, B, and Va, for vacancy-mediated hop events"""
+    return casmconfig.Prim(xtal_prims.FCC(r=1.0, occ_dof=["A", "B", "Va"]))
+
+
+def HCP_ternary_prim() -> casmconfig.Prim:
+    """HCP, with occupants A, B, and C"""
+    return casmconfig.Prim(xtal_prims.HCP(r=0.5, occ_dof=["A", "B", "C"]))
+
+
+def FCC_dumbbell_prim() -> casmconfig.Prim:
+    """FCC, with an A atom or a B-B dumbbell along x, y, or z on each site"""
+
+    def _dumbbell(name, axis):
+        coordinate = np.zeros(3)
+        coordinate[axis] = 0.2
+        return xtal.Occupant(
+            name=name,
+            atoms=[
+                xtal.AtomComponent(name="B", coordinate=-coordinate, properties={}),
+                xtal.AtomComponent(name="B", coordinate=coordinate, properties={}),
+            ],
+        )
+
+    occupants = {
+        "A": xtal.Occupant(
+            name="A",
+            atoms=[
+                xtal.AtomComponent(name="A", coordinate=np.zeros(3), properties={})
+            ],
+        ),
+        "BB.x": _dumbbell("BB", 0),
+        "BB.y": _dumbbell("BB", 1),
+        "BB.z": _dumbbell("BB", 2),
+    }
+    xtal_prim = xtal.Prim(
+        lattice=xtal.Lattice(
+            column_vector_matrix=np.array(
+                [
+                    [0.0, 2.0, 2.0],
+                    [2.0, 0.0, 2.0],
+                    [2.0, 2.0, 0.0],
+                ]
+            ).T,
+        ),
+        coordinate_frac=np.zeros((3, 1)),
+        occ_dof=[["A", "BB.x", "BB.y", "BB.z"]],
+        occupants=occupants,
+    )
+    return casmconfig.Prim(xtal_prim)
+
+
+def perovskite_Hstrain_prim() -> casmconfig.Prim:
+    """Cubic ABO3 perovskite, with strain, B-site disorder, and O vacancies"""
+    Hstrain_dof = xtal.DoFSetBasis(
+        dofname="Hstrain",
+        axis_names=["e_{1}", "e_{2}", "e_{3}", "e_{4}", "e_{5}", "e_{6}"],
+        basis=np.array(
+            [
+                [1.0 / sqrt(3), 1.0 / sqrt(3), 1.0 / sqrt(3), 0.0, 0.0, 0.0],
+                [1.0 / sqrt(2), -1.0 / sqrt(2), 0.0, 0.0, 0.0, 0.0],
+                [-1.0 / sqrt(6), -1.0 / sqrt(6), 2.0 / sqrt(6), 0.0, 0.0, 0.0],
+                [0.0, 0.0, 0.0, 1.0, 0.0, 0.0],
+                [0.0, 0.0, 0.0, 0.0, 1.0, 0.0],
+                [0.0, 0.0, 0.0, 0.0, 0.0, 1.0],
+            ]
+        ).transpose(),
+    )
+    xtal_prim = xtal.Prim(
+        lattice=xtal.Lattice(column_vector_matrix=np.eye(3) * 4.0),
+        coordinate_frac=np.array(
+            [
+                [0.0, 0.0, 0.0],
+                [0.5, 0.5, 0.5],
+                [0.5, 0.5, 0.0],
+                [0.5, 0.0, 0.5],
+                [0.0, 0.5, 0.5],
+            ]
+        ).transpose(),
+        occ_dof=[["Sr"], ["Ti", "Zr"], ["O", "Va"], ["O", "Va"], ["O", "Va"]],
+        global_dof=[Hstrain_dof],
+    )
+    return casmconfig.Prim(xtal_prim)
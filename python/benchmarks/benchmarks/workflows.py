@@ -0,0 +1,240 @@
+"""The benchmarked workflows
+
+Each workflow has a ``setup`` function, which is not timed and returns the
+inputs, and a ``run`` function, which is timed and returns the number of items
+produced, so that throughput can be compared between workflows and releases.
+"""
+from dataclasses import dataclass
+from typing import Any, Callable
+
+import numpy as np
+
+import libcasm.configuration as casmconfig
+import libcasm.configuration.io as config_io
+import libcasm.enumerate as casmenum
+
+from . import prims
+
+
+@dataclass
+class Workflow:
+    name: str
+    """Benchmark name"""
+
+    setup: Callable[[], Any]
+    """Construct the inputs, which is not timed"""
+
+    run: Callable[[Any], int]
+    """Run the workflow on the inputs, and return the number of items"""
+
+
+def _count(iterable) -> int:
+    n = 0
+    for _ in iterable:
+        n += 1
+    return n
+
+
+# --- ConfigEnumAllOccupations.by_supercell ---
+
+
+def _enum_all_occupations(name, make_prim, max_volume):
+    def run(prim):
+        config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+        return _count(config_enum.by_supercell(max=max_volume))
+
+    return Workflow(
+        name=f"ConfigEnumAllOccupations.by_supercell[{name}]",
+        setup=make_prim,
+        run=run,
+    )
+
+
+# --- ConfigEnumLocalOccupations.by_cluster_specs ---
+
+
+def _setup_local_occupations():
+    import libcasm.local_configuration as casmlocal
+    import libcasm.occ_events as occ_events
+    import libcasm.xtal as xtal
+
+    prim = prims.FCC_A_B_Va_prim()
+    site1 = xtal.IntegralSiteCoordinate(sublattice=0, unitcell=[0, 0, 0])
+    site2 = xtal.IntegralSiteCoordinate(sublattice=0, unitcell=[1, 0, 0])
+    event = occ_events.OccEvent(
+        [
+            [
+                occ_events.OccPosition.molecule(site1, 0),
+                occ_events.OccPosition.molecule(site2, 0),
+            ],
+            [
+                occ_events.OccPosition.molecule(site2, 2),
+                occ_events.OccPosition.molecule(site1, 2),
+            ],
+        ]
+    )
+    system = occ_events.OccSystem(xtal_prim=prim.xtal_prim)
+    event_info = casmlocal.OccEventSymInfo.init(
+        prim=prim,
+        system=system,
+        prototype_event=event,
+    )
+
+    # L12 background
+    T_conventional = np.array([[-1, 1, 1], [1, -1, 1], [1, 1, -1]], dtype="int")
+    background = casmconfig.Configuration(casmconfig.Supercell(prim, T_conventional))
+    background.set_occ(0, 1)
+
+    cluster_specs = casmenum.make_first_n_orbits_cluster_specs(
+        prim=prim,
+        phenomenal=event,
+        cutoff_radius=[0, 2.01, 2.01],
+        make_all_possible_orbits=True,
+    )
+    return (prim, event_info, background, T_conventional * 4, cluster_specs)
+
+
+def _run_local_occupations(inputs):
+    prim, event_info, background, T, cluster_specs = inputs
+    supercells = casmconfig.SupercellSet(prim=prim)
+    config_enum = casmenum.ConfigEnumLocalOccupations(
+        event_info=event_info,
+        supercell_set=supercells,
+    )
+    return _count(
+        config_enum.by_cluster_specs(
+            background=background,
+            supercell=casmconfig.Supercell(prim, T),
+            cluster_specs=cluster_specs,
+            fix="background",
+            neighborhood_from_orbits=[1],
+        )
+    )
+
+
+# --- SuperConfigEnum.by_supercell_list ---
+
+
+def _setup_super_config_enum():
+    prim = prims.FCC_binary_prim()
+    motif = casmconfig.Configuration(
+        casmconfig.Supercell(prim, np.array([[1, 0, 0], [0, 1, 0], [0, 0, 2]]))
+    )
+    motif.set_occupation([0, 1])
+    supercells = casmenum.enumerate_canonical_supercells(prim=prim, max_volume=12)
+    return (prim, motif, supercells)
+
+
+def _run_super_config_enum(inputs):
+    prim, motif, supercells = inputs
+    super_config_enum = casmenum.SuperConfigEnum(
+        prim=prim,
+        supercell_set=casmconfig.SupercellSet(prim=prim),
+    )
+    return _count(
+        super_config_enum.by_supercell_list(motif=motif, supercells=supercells)
+    )
+
+
+# --- make_supercells_for_point_defects ---
+
+
+def _setup_point_defect_supercells():
+    prim = prims.FCC_dumbbell_prim()
+    motif = casmconfig.Configuration(
+        casmconfig.Supercell(prim, np.eye(3, dtype="int"))
+    )
+    return motif
+
+
+def _run_point_defect_supercells(motif):
+    candidates = casmenum.make_supercells_for_point_defects(
+        motif=motif,
+        base_max_volume=10,
+        min_volume=1,
+        max_volume=216,
+    )
+    return 0 if candidates is None else len(candidates)
+
+
+# --- irreducible_wedge_points ---
+
+
+def _setup_irreducible_wedge_points():
+    import libcasm.clexulator as casmclex
+
+    prim = prims.perovskite_Hstrain_prim()
+    dof_space = casmclex.DoFSpace(dof_key="Hstrain", xtal_prim=prim.xtal_prim)
+    background = casmconfig.Configuration(
+        casmconfig.Supercell(prim, np.eye(3, dtype="int"))
+    )
+    results = casmconfig.dof_space_analysis(
+        dof_space=dof_space,
+        prim=prim,
+        calc_wedges=True,
+    )
+    irreducible_wedge = results.symmetry_report.irreducible_wedge
+    return (background, dof_space, irreducible_wedge)
+
+
+def _run_irreducible_wedge_points(inputs):
+    background, dof_space, irreducible_wedge = inputs
+    return _count(
+        casmenum.irreducible_wedge_points(
+            background=background,
+            dof_space=dof_space,
+            irreducible_wedge=irreducible_wedge,
+            stop=0.1,
+            num=5,
+            skip_equivalents=True,
+        )
+    )
+
+
+# --- configuration_list_from_data ---
+
+
+def _setup_configuration_list_from_data():
+    prim = prims.FCC_binary_prim()
+    config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+    data_list = config_io.configuration_list_to_data(
+        list(config_enum.by_supercell(max=6))
+    )
+    return (prim, data_list)
+
+
+def _run_configuration_list_from_data(inputs):
+    prim, data_list = inputs
+    return len(config_io.configuration_list_from_data(data_list, prim=prim))
+
+
+WORKFLOWS = [
+    _enum_all_occupations("FCC_binary", prims.FCC_binary_prim, 8),
+    _enum_all_occupations("HCP_ternary", prims.HCP_ternary_prim, 3),
+    Workflow(
+        name="ConfigEnumLocalOccupations.by_cluster_specs[FCC_A_B_Va]",
+        setup=_setup_local_occupations,
+        run=_run_local_occupations,
+    ),
+    Workflow(
+        name="SuperConfigEnum.by_supercell_list[FCC_binary]",
+        setup=_setup_super_config_enum,
+        run=_run_super_config_enum,
+    ),
+    Workflow(
+        name="make_supercells_for_point_defects[FCC_dumbbell]",
+        setup=_setup_point_defect_supercells,
+        run=_run_point_defect_supercells,
+    ),
+    Workflow(
+        name="irreducible_wedge_points[perovskite_Hstrain]",
+        setup=_setup_irreducible_wedge_points,
+        run=_run_irreducible_wedge_points,
+    ),
+    Workflow(
+        name="configuration_list_from_data[FCC_binary]",
+        setup=_setup_configuration_list_from_data,
+        run=_run_configuration_list_from_data,
+    ),
+]
+"""All benchmarked workflows"""
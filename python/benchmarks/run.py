@@ -0,0 +1,155 @@
+"""Run the workflow benchmarks without asv
+
+Usage::
+
+    python run.py --output results-2.0a7.json
+    python run.py --output results-new.json --compare results-2.0a7.json
+    python run.py --filter ConfigEnumAllOccupations
+
+Each workflow is run in a separate process, so that the peak resident set
+size of one workflow does not include the memory used by the others. For each
+workflow, the wall time is the minimum over `--repeat` runs, after the
+untimed setup, and the peak RSS is the maximum resident set size of the
+process, including setup. Results are written as JSON, with the installed
+library versions, so that results for successive releases can be compared.
+
+With asv installed, the same workflows can be run with ``asv run`` using
+``asv.conf.json``.
+"""
+import argparse
+import datetime
+import json
+import platform
+import resource
+import subprocess
+import sys
+import time
+
+
+def _peak_rss_bytes() -> int:
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # kilobytes on Linux, bytes on macOS
+    return peak if sys.platform == "darwin" else peak * 1024
+
+
+def _versions() -> dict:
+    from importlib.metadata import PackageNotFoundError, version
+
+    versions = {}
+    for package in [
+        "libcasm-configuration",
+        "libcasm-global",
+        "libcasm-xtal",
+        "libcasm-clexulator",
+        "numpy",
+    ]:
+        try:
+            versions[package] = version(package)
+        except PackageNotFoundError:
+            versions[package] = None
+    return versions
+
+
+def _run_one(name: str, repeat: int) -> dict:
+    from benchmarks.workflows import WORKFLOWS
+
+    workflow = {x.name: x for x in WORKFLOWS}[name]
+    inputs = workflow.setup()
+    times = []
+    n_items = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        n_items = workflow.run(inputs)
+        times.append(time.perf_counter() - start)
+    wall_time = min(times)
+    return {
+        "name": name,
+        "wall_time": wall_time,
+        "wall_times": times,
+        "peak_rss": _peak_rss_bytes(),
+        "n_items": n_items,
+        "items_per_second": n_items / wall_time if wall_time > 0 else None,
+    }
+
+
+def _print_comparison(results: list[dict], previous: dict) -> None:
+    by_name = {x["name"]: x for x in previous["results"]}
+    print()
+    print(f"{'workflow':<60} {'time':>8} {'rss':>8} {'items/s':>8}")
+    for result in results:
+        before = by_name.get(result["name"])
+        if before is None or "error" in result or "error" in before:
+            continue
+        if not result["items_per_second"] or not before["items_per_second"]:
+            continue
+        print(
+            f"{result['name']:<60} "
+            f"{result['wall_time'] / before['wall_time']:>7.2f}x "
+            f"{result['peak_rss'] / before['peak_rss']:>7.2f}x "
+            f"{result['items_per_second'] / before['items_per_second']:>7.2f}x"
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--output", help="JSON results file to write")
+    parser.add_argument("--compare", help="JSON results file to compare against")
+    parser.add_argument("--filter", help="Only run workflows whose name contains this")
+    parser.add_argument(
+        "--repeat", type=int, default=3, help="Timed runs per workflow"
+    )
+    parser.add_argument("--single", help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    if args.single is not None:
+        print(json.dumps(_run_one(args.single, args.repeat)))
+        return
+
+    from benchmarks.workflows import WORKFLOWS
+
+    results = []
+    for workflow in WORKFLOWS:
+        if args.filter is not None and args.filter not in workflow.name:
+            continue
+        process = subprocess.run(
+            [
+                sys.executable,
+                __file__,
+                "--single",
+                workflow.name,
+                "--repeat",
+                str(args.repeat),
+            ],
+            capture_output=True,
+            text=True,
+        )
+        if process.returncode != 0:
+            result = {"name": workflow.name, "error": process.stderr.strip()}
+            print(f"{workflow.name}: error")
+        else:
+            result = json.loads(process.stdout.strip().splitlines()[-1])
+            print(
+                f"{workflow.name}: {result['wall_time']:.3f} s, "
+                f"{result['peak_rss'] / 2**20:.1f} MiB, "
+                f"{result['n_items']} items, "
+                f"{result['items_per_second']:.1f} items/s"
+            )
+        results.append(result)
+
+    data = {
+        "date": datetime.datetime.now().isoformat(),
+        "python": platform.python_version(),
+        "platform": platform.platform(),
+        "versions": _versions(),
+        "results": results,
+    }
+    if args.output is not None:
+        with open(args.output, "w") as f:
+            json.dump(data, f, indent=2)
+    if args.compare is not None:
+        with open(args.compare, "r") as f:
+            _print_comparison(results, json.load(f))
+
+
+if __name__ == "__main__":
+    main()
@@ -15,6 +15,9 @@ Primarily, this purpose of this module is to provide:
 - :class:`~libcasm.clusterography.ClusterSpecs`, a class which collects parameters
   controlling the generation of orbits, for either periodic or local-clusters, and
   generates all symmetrically distinct orbits
+- :func:`~libcasm.clusterography.make_orbits_with_cache`, a function that saves
+  generated orbit prototypes in a cache directory, keyed by a hash of the prim,
+  generating group, and ClusterSpecs, and reuses them when called again
 
 The :py:mod:`libcasm.clusterography` module has dependencies on:
 
@@ -27,6 +30,7 @@ from ._clusterography import (
     Cluster,
     ClusterOrbitGenerator,
     ClusterSpecs,
+    PrimPeriodicOrbitGenerator,
     equivalents_info_from_dict,
     make_cluster_group,
     make_custom_cluster_specs,
@@ -43,3 +47,7 @@ from ._methods import (
     make_local_cluster_specs,
     make_periodic_cluster_specs,
 )
+from ._orbit_cache import (
+    make_cluster_specs_hash,
+    make_orbits_with_cache,
+)
@@ -0,0 +1,161 @@
+import hashlib
+import json
+import os
+import pathlib
+import tempfile
+from typing import Optional, Union
+
+import libcasm.clusterography._clusterography as _clust
+
+ORBIT_CACHE_VERSION = 1
+"""Version of the orbit cache file format. Files with a different version are
+ignored."""
+
+_CACHEABLE_SITE_FILTER_METHODS = ["dof_sites", "alloy_sites", "all_sites"]
+
+
+def _symgroup_rep_data(cluster_specs: _clust.ClusterSpecs) -> list:
+    """Generating group elements, as lists, in order"""
+    data = []
+    for op in cluster_specs.generating_group().elements:
+        data.append(
+            {
+                "matrix": op.matrix().tolist(),
+                "translation": op.translation().tolist(),
+                "time_reversal": op.time_reversal(),
+            }
+        )
+    return data
+
+
+def make_cluster_specs_hash(
+    cluster_specs: _clust.ClusterSpecs,
+) -> Optional[str]:
+    """Make a content hash of the data that determines the orbits generated
+    by a ClusterSpecs
+
+    The hash is the SHA-256 digest of the JSON representation, with sorted
+    keys, of:
+
+    - the prim, as given by :func:`libcasm.xtal.Prim.to_dict`,
+    - the generating group elements, in order, which determine the
+      :class:`~libcasm.xtal.IntegralSiteCoordinateRep` used to generate orbits,
+    - the ClusterSpecs, as given by :func:`ClusterSpecs.to_dict`,
+    - the cache format version, :data:`ORBIT_CACHE_VERSION`, and the
+      ``libcasm.clusterography`` version.
+
+    Parameters
+    ----------
+    cluster_specs: libcasm.clusterography.ClusterSpecs
+        The ClusterSpecs
+
+    Returns
+    -------
+    hash: Optional[str]
+        The hexadecimal digest, or None if `cluster_specs` uses a site filter
+        method which is not represented in its JSON (``"custom"``), in which
+        case the orbits may not be cached.
+    """
+    if cluster_specs.site_filter_method() not in _CACHEABLE_SITE_FILTER_METHODS:
+        return None
+    data = {
+        "orbit_cache_version": ORBIT_CACHE_VERSION,
+        "libcasm_clusterography_version": _clust.__version__,
+        "prim": cluster_specs.xtal_prim().to_dict(),
+        "generating_group": _symgroup_rep_data(cluster_specs),
+        "cluster_specs": cluster_specs.to_dict(),
+    }
+    text = json.dumps(data, sort_keys=True, separators=(",", ":"))
+    return hashlib.sha256(text.encode("utf-8")).hexdigest()
+
+
+def _make_orbits_from_prototypes(
+    cluster_specs: _clust.ClusterSpecs,
+    prototypes: list[_clust.Cluster],
+) -> list[list[_clust.Cluster]]:
+    symgroup_rep = _clust.make_integral_site_coordinate_symgroup_rep(
+        cluster_specs.generating_group().elements, cluster_specs.xtal_prim()
+    )
+    if cluster_specs.phenomenal() is not None:
+        make_orbit = _clust.make_local_orbit
+    else:
+        make_orbit = _clust.make_periodic_orbit
+    return [
+        make_orbit(
+            orbit_element=prototype,
+            integral_site_coordinate_symgroup_rep=symgroup_rep,
+        )
+        for prototype in prototypes
+    ]
+
+
+def make_orbits_with_cache(
+    cluster_specs: _clust.ClusterSpecs,
+    cache_dir: Union[str, pathlib.Path],
+    n_threads: int = 1,
+) -> list[list[_clust.Cluster]]:
+    """Construct cluster orbits, reusing orbits saved in a cache directory
+
+    The orbit prototypes are saved in ``<cache_dir>/<hash>.json``, where
+    ``<hash>`` is given by :func:`make_cluster_specs_hash`. If the file exists,
+    orbits are regenerated from the saved prototypes instead of being found by
+    :func:`ClusterSpecs.make_orbits`. Otherwise, orbits are generated and the
+    file is written.
+
+    Regenerating each orbit from its prototype gives the same orbits, in the
+    same order, as :func:`ClusterSpecs.make_orbits`.
+
+    Parameters
+    ----------
+    cluster_specs: libcasm.clusterography.ClusterSpecs
+        The ClusterSpecs. If it uses a ``"custom"`` site filter method, the
+        orbits are generated without using the cache.
+    cache_dir: Union[str, pathlib.Path]
+        The cache directory. It is created if it does not exist.
+    n_threads: int = 1
+        Number of threads used, as for :func:`ClusterSpecs.make_orbits`, if
+        the orbits must be generated.
+
+    Returns
+    -------
+    orbits: list[list[Cluster]]
+        A list of cluster orbits, as given by :func:`ClusterSpecs.make_orbits`.
+    """
+    key = make_cluster_specs_hash(cluster_specs)
+    if key is None:
+        return cluster_specs.make_orbits(n_threads=n_threads)
+
+    cache_dir = pathlib.Path(cache_dir)
+    path = cache_dir / (key + ".json")
+    if path.exists():
+        with open(path, "r") as f:
+            data = json.load(f)
+        if (
+            data.get("version") == ORBIT_CACHE_VERSION
+            and data.get("hash") == key
+        ):
+            prototypes = [
+                _clust.Cluster.from_list(sites) for sites in data["prototypes"]
+            ]
+            return _make_orbits_from_prototypes(cluster_specs, prototypes)
+
+    orbits = cluster_specs.make_orbits(n_threads=n_threads)
+    data = {
+        "version": ORBIT_CACHE_VERSION,
+        "hash": key,
+        "prototypes": [orbit[0].to_list() for orbit in orbits],
+    }
+
+    # write to a temporary file, then rename, so that concurrent readers never
+    # see a partially written file
+    cache_dir.mkdir(parents=True, exist_ok=True)
+    fd, tmp_path = tempfile.mkstemp(dir=cache_dir, suffix=".tmp")
+    try:
+        with os.fdopen(fd, "w") as f:
+            f.write(json.dumps(data, separators=(",", ":")))
+        os.replace(tmp_path, path)
+    except BaseException:
+        if os.path.exists(tmp_path):
+            os.remove(tmp_path)
+        raise
+    return orbits
@@ -1,44 +1,87 @@
 """Supercells and configurations"""
 from ._configuration import (
+    ConfigSpaceAnalysisPartial,
     ConfigSpaceAnalysisResults,
     Configuration,
+    ConfigurationBatch,
+    ConfigurationDelta,
     ConfigurationRecord,
     ConfigurationSet,
+    ConfigurationSetJournal,
+    ConfigurationSetView,
     ConfigurationWithProperties,
+    DistinctConfigurationFinder,
     DoFSpaceAnalysisResults,
+    DoFSpaceRepCache,
+    InvariantFingerprintCalculator,
+    MotifTilingMapCache,
     Prim,
+    PrimSymInfoCache,
+    PrimitiveConfigurationChecker,
     Supercell,
     SupercellRecord,
     SupercellSet,
+    SupercellSymInfoTables,
     SupercellSymOp,
+    SuperConfigurationGenerator,
     asymmetric_unit_indices,
     config_space_analysis,
+    config_space_analysis_partial,
+    configuration_deltas_from_dict,
+    configuration_deltas_to_dict,
+    copy_apply_to_occupations,
     copy_configuration,
     copy_transformed_configuration,
     dof_space_analysis,
+    find_mapping_operation,
+    find_translation_indices,
+    finish_config_space_analysis,
     from_canonical_configuration,
+    get_num_threads,
     is_canonical_configuration,
     is_canonical_supercell,
     is_primitive_configuration,
     make_all_super_configurations,
     make_all_super_configurations_by_subsets,
+    make_asymmetric_unit_index,
+    make_atomic_structure_batch,
     make_canonical_configuration,
+    make_canonical_configurations,
     make_canonical_supercell,
+    make_canonical_transformation_matrices,
+    make_canonical_transformation_matrix,
+    make_config_space_analysis_supercell,
+    make_configuration_deltas,
+    make_consistent_asymmetric_unit_index,
+    make_consistent_asymmetric_unit_indices,
     make_distinct_super_configurations,
+    make_distinct_super_configurations_in_supercells,
     make_dof_space_rep,
     make_equivalent_configurations,
     make_equivalent_supercells,
+    make_equivalent_supercells_batch,
+    make_equivalent_transformation_matrices,
+    make_equivalent_transformation_matrices_batch,
+    make_fixed_orientation_super_configurations,
     make_global_dof_matrix_rep,
     make_invariant_subgroup,
     make_local_dof_matrix_rep,
+    make_prim_digest,
     make_primitive_configuration,
+    make_superlattice_invariant_factor_group_indices,
+    make_supercell_symop_arrays,
+    perf_report,
+    perf_reset,
+    set_num_threads,
+    start_trace,
+    stop_trace,
+    symmetrize_properties,
+    symmetrize_properties_batch,
     to_canonical_configuration,
 )
 from ._methods import (
     apply,
     copy_apply,
-    find_mapping_operation,
-    make_consistent_asymmetric_unit_indices,
 )
 from ._misc import (
     equivalent_order_parameters_index,
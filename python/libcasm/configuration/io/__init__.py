@@ -1,8 +1,16 @@
 """Additional methods for IO"""
-from typing import Dict, List, Optional
+import json
+import pathlib
+from typing import Dict, Iterable, Iterator, List, Optional, Union
 
 import libcasm.configuration._configuration as _config
 
+from ._compression import (
+    detect_compression,
+    open_file,
+    read_json,
+    write_json,
+)
 from ._symgroup import (
     symgroup_to_dict_with_group_classification,
 )
@@ -37,6 +45,7 @@ def supercell_list_from_data(
     data_list: List[Dict],
     prim: Optional[_config.Prim] = None,
     supercells: Optional[_config.SupercellSet] = None,
+    n_threads: int = 1,
 ):
     """Construct a List[:class:`~libcasm.configuration.Supercell`] from a List[Dict]
 
@@ -47,6 +56,8 @@ def supercell_list_from_data(
         from libcasm.configuration import Supercell
         supercell_list = [Supercell.from_dict(data, supercells) for data in data_list]
 
+    except that each distinct supercell is constructed once, and the supercells
+    are constructed in parallel.
 
     Parameters
     ----------
@@ -58,6 +69,9 @@ def supercell_list_from_data(
     supercells: :class:`~libcasm.configuration.SupercellSet`
         A :class:`~libcasm.configuration.SupercellSet`, which may be provided to hold
         shared supercells in order to avoid duplicates.
+    n_threads: int = 1
+        Number of threads used to construct supercells. If <= 0, use the hardware
+        concurrency.
 
     Returns
     -------
@@ -70,7 +84,18 @@ def supercell_list_from_data(
         )
     if supercells is None:
         supercells = _config.SupercellSet(prim)
-    return [_config.Supercell.from_dict(data, supercells) for data in data_list]
+    matrices = []
+    for data in data_list:
+        if "transformation_matrix_to_supercell" not in data:
+            raise Exception(
+                "Error in supercell_list_from_data: "
+                'missing "transformation_matrix_to_supercell"'
+            )
+        matrices.append(data["transformation_matrix_to_supercell"])
+    records = supercells.add_by_transformation_matrices_to_super(
+        matrices, n_threads=n_threads
+    )
+    return [record.supercell for record in records]
 
 
 def configuration_list_to_data(
@@ -102,6 +127,7 @@ def configuration_list_from_data(
     data_list: List[Dict],
     prim: Optional[_config.Prim] = None,
     supercells: Optional[_config.SupercellSet] = None,
+    n_threads: int = 1,
 ):
     """Construct a List[:class:`~libcasm.configuration.Configuration`] from a List[Dict]
 
@@ -114,6 +140,8 @@ def configuration_list_from_data(
             Configuration.from_dict(data, supercells) for data in data_list
         ]
 
+    except that the distinct supercells are constructed first, once each and in
+    parallel, before the configurations are read.
 
     Parameters
     ----------
@@ -125,6 +153,9 @@ def configuration_list_from_data(
     supercells: :class:`~libcasm.configuration.SupercellSet`
         A :class:`~libcasm.configuration.SupercellSet`, which may be provided to hold
         shared supercells in order to avoid duplicates.
+    n_threads: int = 1
+        Number of threads used to construct supercells. If <= 0, use the hardware
+        concurrency.
 
     Returns
     -------
@@ -138,4 +169,418 @@ def configuration_list_from_data(
         )
     if supercells is None:
         supercells = _config.SupercellSet(prim)
+    supercells.add_by_transformation_matrices_to_super(
+        [
+            data["transformation_matrix_to_supercell"]
+            for data in data_list
+            if "transformation_matrix_to_supercell" in data
+        ],
+        n_threads=n_threads,
+    )
     return [_config.Configuration.from_dict(data, supercells) for data in data_list]
+
+
+def write_configuration_jsonl(
+    configurations: Iterable[
+        Union[_config.Configuration, _config.ConfigurationWithProperties]
+    ],
+    path: Union[str, pathlib.Path],
+    write_prim_basis: bool = False,
+    compression: Optional[str] = None,
+    level: Optional[int] = None,
+    n_threads: int = 0,
+) -> int:
+    """Write configurations to a JSON lines file, one record per line
+
+    Parameters
+    ----------
+    configurations: Iterable[Union[:class:`~libcasm.configuration.Configuration`, \
+    :class:`~libcasm.configuration.ConfigurationWithProperties`]]
+        The configurations to write. May be a generator, in which case only one
+        configuration is held in memory at a time.
+    path: Union[str, pathlib.Path]
+        The output file path.
+    write_prim_basis: bool = False
+        If True, write DoF values using the prim basis. Default (False) is to
+        write DoF values in the standard basis.
+    compression: Optional[str] = None
+        One of "none", "gzip", or "zstd". If None, the compression is
+        determined from the file extension, so that, for example,
+        "configurations.jsonl.zst" is written with zstd compression.
+    level: Optional[int] = None
+        The compression level, as for :func:`~libcasm.configuration.io.open_file`.
+    n_threads: int = 0
+        The number of zstd compression threads, as for
+        :func:`~libcasm.configuration.io.open_file`.
+
+    Returns
+    -------
+    n_records: int
+        The number of records written.
+    """
+    n_records = 0
+    with open_file(
+        path, "w", compression=compression, level=level, n_threads=n_threads
+    ) as f:
+        for configuration in configurations:
+            data = configuration.to_dict(write_prim_basis=write_prim_basis)
+            f.write(json.dumps(data, separators=(",", ":")))
+            f.write("\n")
+            n_records += 1
+    return n_records
+
+
+def read_configuration_jsonl(
+    path: Union[str, pathlib.Path],
+    prim: Optional[_config.Prim] = None,
+    supercells: Optional[_config.SupercellSet] = None,
+    with_properties: bool = False,
+) -> Iterator[Union[_config.Configuration, _config.ConfigurationWithProperties]]:
+    """Read configurations from a JSON lines file, one record at a time
+
+    Each non-blank line of the file must be the dict representation of one
+    :class:`~libcasm.configuration.Configuration` (or
+    :class:`~libcasm.configuration.ConfigurationWithProperties`, if
+    `with_properties` is True), as written by
+    :func:`~libcasm.configuration.io.write_configuration_jsonl`. Only one record is
+    held in memory at a time, and supercells are shared through `supercells`, so
+    memory use does not depend on the file size. Files compressed with gzip or
+    zstd are detected from their leading bytes and decompressed as they are
+    read.
+
+    Parameters
+    ----------
+    path: Union[str, pathlib.Path]
+        The input file path.
+    prim: :class:`~libcasm.configuration.Prim`
+        A :class:`~libcasm.configuration.Prim`, which is required if `supercells` is
+        not provided.
+    supercells: :class:`~libcasm.configuration.SupercellSet`
+        A :class:`~libcasm.configuration.SupercellSet`, which may be provided to hold
+        shared supercells in order to avoid duplicates.
+    with_properties: bool = False
+        If True, read :class:`~libcasm.configuration.ConfigurationWithProperties`,
+        otherwise read :class:`~libcasm.configuration.Configuration`.
+
+    Yields
+    ------
+    configuration: Union[:class:`~libcasm.configuration.Configuration`, \
+    :class:`~libcasm.configuration.ConfigurationWithProperties`]
+        The configurations, in file order.
+    """
+    if prim is None and supercells is None:
+        raise Exception(
+            "Error in read_configuration_jsonl: One of prim or supercells is required"
+        )
+    if supercells is None:
+        supercells = _config.SupercellSet(prim)
+    if with_properties:
+        from_json_str = _config.ConfigurationWithProperties.from_json_str
+    else:
+        from_json_str = _config.Configuration.from_json_str
+    with open_file(path, "r") as f:
+        for line_number, line in enumerate(f, start=1):
+            if not line.strip():
+                continue
+            try:
+                configuration = from_json_str(line, supercells)
+            except Exception as e:
+                raise Exception(
+                    f"Error in read_configuration_jsonl: line {line_number}: {e}"
+                )
+            yield configuration
+
+
+def read_configuration_set(
+    path: Union[str, pathlib.Path],
+    prim: Optional[_config.Prim] = None,
+    supercells: Optional[_config.SupercellSet] = None,
+    n_threads: int = 1,
+) -> _config.ConfigurationSet:
+    """Read a :class:`~libcasm.configuration.ConfigurationSet` from a JSON file
+
+    Equivalent to ``ConfigurationSet.from_dict(read_json(path), supercells)``,
+    but configurations are read from the file text directly into DoF value
+    arrays, without constructing a dict, so reading large sets is faster and
+    uses less memory. Files compressed with gzip or zstd are detected from their
+    leading bytes.
+
+    Parameters
+    ----------
+    path: Union[str, pathlib.Path]
+        The input file path.
+    prim: :class:`~libcasm.configuration.Prim`
+        A :class:`~libcasm.configuration.Prim`, which is required if `supercells` is
+        not provided.
+    supercells: :class:`~libcasm.configuration.SupercellSet`
+        A :class:`~libcasm.configuration.SupercellSet`, which may be provided to hold
+        shared supercells in order to avoid duplicates.
+    n_threads: int = 1
+        Number of threads used to construct supercells that are not already in
+        `supercells`. If <= 0, use the hardware concurrency.
+
+    Returns
+    -------
+    configurations: :class:`~libcasm.configuration.ConfigurationSet`
+        The configurations.
+    """
+    if prim is None and supercells is None:
+        raise Exception(
+            "Error in read_configuration_set: One of prim or supercells is required"
+        )
+    if supercells is None:
+        supercells = _config.SupercellSet(prim)
+    with open_file(path, "r") as f:
+        json_str = f.read()
+    return _config.ConfigurationSet.from_json_str(
+        json_str, supercells, n_threads=n_threads
+    )
+
+
+def write_configuration_binary(
+    configurations: Iterable[
+        Union[_config.Configuration, _config.ConfigurationWithProperties]
+    ],
+    path: Union[str, pathlib.Path],
+) -> int:
+    """Write configurations to a file in the binary configuration format
+
+    The binary format stores each supercell once, by name and transformation
+    matrix, and stores DoF values in the prim basis as raw doubles, so values
+    are preserved exactly. It is more compact and faster to read and write than
+    :func:`~libcasm.configuration.io.write_configuration_jsonl`.
+
+    Parameters
+    ----------
+    configurations: Iterable[Union[:class:`~libcasm.configuration.Configuration`, \
+    :class:`~libcasm.configuration.ConfigurationWithProperties`]]
+        The configurations to write. May be a generator, in which case only one
+        configuration is held in memory at a time.
+    path: Union[str, pathlib.Path]
+        The output file path.
+
+    Returns
+    -------
+    n_records: int
+        The number of records written.
+    """
+    n_records = 0
+    writer = _config.ConfigurationBinaryFileWriter(str(path))
+    for configuration in configurations:
+        writer.write(configuration)
+        n_records += 1
+    writer.close()
+    return n_records
+
+
+def read_configuration_binary(
+    path: Union[str, pathlib.Path],
+    prim: Optional[_config.Prim] = None,
+    supercells: Optional[_config.SupercellSet] = None,
+    with_properties: bool = False,
+) -> Iterator[Union[_config.Configuration, _config.ConfigurationWithProperties]]:
+    """Read configurations from a file in the binary configuration format, one \
+    record at a time
+
+    Parameters
+    ----------
+    path: Union[str, pathlib.Path]
+        The input file path, as written by
+        :func:`~libcasm.configuration.io.write_configuration_binary`.
+    prim: :class:`~libcasm.configuration.Prim`
+        A :class:`~libcasm.configuration.Prim`, which is required if `supercells` is
+        not provided.
+    supercells: :class:`~libcasm.configuration.SupercellSet`
+        A :class:`~libcasm.configuration.SupercellSet`, which may be provided to hold
+        shared supercells in order to avoid duplicates.
+    with_properties: bool = False
+        If True, read :class:`~libcasm.configuration.ConfigurationWithProperties`,
+        otherwise read :class:`~libcasm.configuration.Configuration`.
+
+    Yields
+    ------
+    configuration: Union[:class:`~libcasm.configuration.Configuration`, \
+    :class:`~libcasm.configuration.ConfigurationWithProperties`]
+        The configurations, in file order.
+    """
+    if prim is None and supercells is None:
+        raise Exception(
+            "Error in read_configuration_binary: One of prim or supercells is required"
+        )
+    if supercells is None:
+        supercells = _config.SupercellSet(prim)
+    reader = _config.ConfigurationBinaryFileReader(str(path), supercells)
+    while True:
+        value = reader.read_next()
+        if value is None:
+            return
+        if with_properties:
+            yield value
+        else:
+            yield value.configuration
+
+
+def write_configuration_columnar(
+    configurations: Iterable[
+        Union[_config.Configuration, _config.ConfigurationWithProperties]
+    ],
+    path: Union[str, pathlib.Path],
+    batch_size: int = 1024,
+) -> int:
+    """Write configurations to a file in the columnar dataset format
+
+    The columnar format groups records with the same number of sites and DoF
+    shapes into batches of up to `batch_size` records. Within a batch, DoF
+    values are stored as contiguous arrays with one row per record, and
+    properties are stored as ragged arrays with offsets, so a batch can be
+    loaded directly as numpy arrays with
+    :func:`~libcasm.configuration.io.read_columnar_batches`. Supercells are
+    stored once, by name and transformation matrix. DoF values are in the prim
+    basis and are preserved exactly.
+
+    Records are buffered by batch signature, so batches are not necessarily in
+    write order. Each record's position in the order written is stored as
+    "record_index".
+
+    Parameters
+    ----------
+    configurations: Iterable[Union[:class:`~libcasm.configuration.Configuration`, \
+    :class:`~libcasm.configuration.ConfigurationWithProperties`]]
+        The configurations to write. May be a generator, in which case at most
+        `batch_size` configurations per batch signature are held in memory at a
+        time.
+    path: Union[str, pathlib.Path]
+        The output file path.
+    batch_size: int = 1024
+        The maximum number of records per batch.
+
+    Returns
+    -------
+    n_records: int
+        The number of records written.
+    """
+    n_records = 0
+    writer = _config.ColumnarDatasetFileWriter(str(path), batch_size)
+    for configuration in configurations:
+        writer.write(configuration)
+        n_records += 1
+    writer.close()
+    return n_records
+
+
+def read_configuration_columnar(
+    path: Union[str, pathlib.Path],
+    prim: Optional[_config.Prim] = None,
+    supercells: Optional[_config.SupercellSet] = None,
+    with_properties: bool = False,
+) -> Iterator[Union[_config.Configuration, _config.ConfigurationWithProperties]]:
+    """Read configurations from a file in the columnar dataset format, one \
+    batch at a time
+
+    Parameters
+    ----------
+    path: Union[str, pathlib.Path]
+        The input file path, as written by
+        :func:`~libcasm.configuration.io.write_configuration_columnar`.
+    prim: :class:`~libcasm.configuration.Prim`
+        A :class:`~libcasm.configuration.Prim`, which is required if `supercells` is
+        not provided.
+    supercells: :class:`~libcasm.configuration.SupercellSet`
+        A :class:`~libcasm.configuration.SupercellSet`, which may be provided to hold
+        shared supercells in order to avoid duplicates.
+    with_properties: bool = False
+        If True, read :class:`~libcasm.configuration.ConfigurationWithProperties`,
+        otherwise read :class:`~libcasm.configuration.Configuration`.
+
+    Yields
+    ------
+    configuration: Union[:class:`~libcasm.configuration.Configuration`, \
+    :class:`~libcasm.configuration.ConfigurationWithProperties`]
+        The configurations, in batch order, which is not necessarily the order
+        they were written.
+    """
+    if prim is None and supercells is None:
+        raise Exception(
+            "Error in read_configuration_columnar: "
+            "One of prim or supercells is required"
+        )
+    if supercells is None:
+        supercells = _config.SupercellSet(prim)
+    reader = _config.ColumnarDatasetFileReader(str(path), supercells)
+    while True:
+        values = reader.read_batch()
+        if values is None:
+            return
+        for value in values:
+            if with_properties:
+                yield value
+            else:
+                yield value.configuration
+
+
+def read_columnar_batches(
+    path: Union[str, pathlib.Path],
+    prim: Optional[_config.Prim] = None,
+    supercells: Optional[_config.SupercellSet] = None,
+) -> Iterator[Dict]:
+    """Read batches from a file in the columnar dataset format as numpy arrays
+
+    Only one batch is held in memory at a time, so datasets larger than memory
+    can be processed batch by batch.
+
+    Parameters
+    ----------
+    path: Union[str, pathlib.Path]
+        The input file path, as written by
+        :func:`~libcasm.configuration.io.write_configuration_columnar`.
+    prim: :class:`~libcasm.configuration.Prim`
+        A :class:`~libcasm.configuration.Prim`, which is required if `supercells` is
+        not provided.
+    supercells: :class:`~libcasm.configuration.SupercellSet`
+        A :class:`~libcasm.configuration.SupercellSet`, which may be provided to hold
+        shared supercells in order to avoid duplicates.
+
+    Yields
+    ------
+    batch: Dict
+        A batch of records, with:
+
+        - "n_sites": int, the number of sites of every record in the batch
+        - "record_index": np.ndarray of shape (n_records,), the position of
+          each record in the order written
+        - "supercell_index": np.ndarray of shape (n_records,), the index of
+          each record's supercell in "supercell_list"
+        - "supercell_list": List[:class:`~libcasm.configuration.Supercell`],
+          the supercells read so far, in file order
+        - "occupation": np.ndarray of shape (n_records, n_sites)
+        - "global_dof_values": Dict[str, np.ndarray], with arrays of shape
+          (n_records, dim)
+        - "local_dof_values": Dict[str, np.ndarray], with arrays of shape
+          (n_records, dim, n_sites)
+        - "local_properties", "global_properties": Dict[str, Dict], with
+          ragged arrays "present", "rows", "cols", and "offsets" of shape
+          (n_records,), except "offsets" of shape (n_records + 1,), and
+          "values". The value of record `i` is
+          ``values[offsets[i]:offsets[i+1]].reshape((rows[i], cols[i]),
+          order="F")``, if ``present[i]``.
+    """
+    if prim is None and supercells is None:
+        raise Exception(
+            "Error in read_columnar_batches: One of prim or supercells is required"
+        )
+    if supercells is None:
+        supercells = _config.SupercellSet(prim)
+    reader = _config.ColumnarDatasetFileReader(str(path), supercells)
+    while True:
+        batch = reader.read_batch_data()
+        if batch is None:
+            return
+        n_records = len(batch["record_index"])
+        n_sites = batch["n_sites"]
+        local_dof_dim = batch.pop("local_dof_dim")
+        for key, value in batch["local_dof_values"].items():
+            batch["local_dof_values"][key] = value.reshape(
+                (n_records, n_sites, local_dof_dim[key])
+            ).transpose((0, 2, 1))
+        batch["supercell_list"] = reader.supercell_list()
+        yield batch
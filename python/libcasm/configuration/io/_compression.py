@@ -0,0 +1,197 @@
+"""Transparent compression for text files"""
+import gzip
+import io
+import json
+import pathlib
+from typing import Any, Optional, TextIO, Union
+
+_GZIP_MAGIC = b"\x1f\x8b"
+_ZSTD_MAGIC = b"\x28\xb5\x2f\xfd"
+
+_EXTENSIONS = {
+    ".gz": "gzip",
+    ".gzip": "gzip",
+    ".zst": "zstd",
+    ".zstd": "zstd",
+}
+
+
+def _import_zstandard():
+    try:
+        import zstandard
+    except ImportError:
+        raise Exception(
+            "Error: zstd compression requires the 'zstandard' package "
+            "(pip install zstandard)"
+        )
+    return zstandard
+
+
+def detect_compression(
+    path: Union[str, pathlib.Path],
+    mode: str = "r",
+) -> str:
+    """Determine the compression of a file
+
+    Parameters
+    ----------
+    path: Union[str, pathlib.Path]
+        The file path.
+    mode: str = "r"
+        If "r", the compression of an existing file is determined from its
+        leading magic bytes, so compressed files are read correctly regardless
+        of their names. If "w" or "a", the compression is determined from the
+        file extension: ".gz" or ".gzip" for gzip, and ".zst" or ".zstd" for
+        zstd.
+
+    Returns
+    -------
+    compression: str
+        One of "none", "gzip", or "zstd".
+    """
+    path = pathlib.Path(path)
+    if mode == "r":
+        with open(path, "rb") as f:
+            magic = f.read(4)
+        if magic.startswith(_GZIP_MAGIC):
+            return "gzip"
+        if magic == _ZSTD_MAGIC:
+            return "zstd"
+        return "none"
+    return _EXTENSIONS.get(path.suffix.lower(), "none")
+
+
+def open_file(
+    path: Union[str, pathlib.Path],
+    mode: str = "r",
+    compression: Optional[str] = None,
+    level: Optional[int] = None,
+    n_threads: int = 0,
+) -> TextIO:
+    """Open a text file, with transparent gzip or zstd compression
+
+    Data is streamed through the compressor or decompressor, so files of any
+    size can be read and written in constant memory.
+
+    Parameters
+    ----------
+    path: Union[str, pathlib.Path]
+        The file path.
+    mode: str = "r"
+        One of "r", "w", or "a". Files are always opened in text mode, with
+        UTF-8 encoding. Appending to a compressed file adds a new compressed
+        frame, which is read back as a continuation of the file.
+    compression: Optional[str] = None
+        One of "none", "gzip", or "zstd". If None, the compression is detected
+        by :func:`~libcasm.configuration.io.detect_compression`: from magic
+        bytes when reading, and from the file extension when writing.
+    level: Optional[int] = None
+        The compression level. If None, the default level of the compressor
+        is used, which is 9 for gzip and 3 for zstd.
+    n_threads: int = 0
+        The number of worker threads used for zstd compression of large
+        writes. If 0, compression is done in the calling thread. If < 0, all
+        available hardware threads are used. Not used for reading, or for
+        gzip, which has no multi-threaded compressor.
+
+    Returns
+    -------
+    f: TextIO
+        A text stream. Use it as a context manager, so that the compressed
+        stream is completed and the file is closed.
+    """
+    if mode not in ("r", "w", "a"):
+        raise Exception(f"Error in open_file: invalid mode '{mode}'")
+    if compression is None:
+        if mode == "a" and not pathlib.Path(path).exists():
+            compression = detect_compression(path, "w")
+        else:
+            compression = detect_compression(path, mode)
+
+    if compression == "none":
+        return open(path, mode, encoding="utf-8")
+    elif compression == "gzip":
+        kwargs = {} if level is None else {"compresslevel": level}
+        return gzip.open(path, mode + "t", encoding="utf-8", **kwargs)
+    elif compression == "zstd":
+        zstandard = _import_zstandard()
+        if mode == "r":
+            return io.TextIOWrapper(
+                zstandard.ZstdDecompressor().stream_reader(
+                    open(path, "rb"), read_across_frames=True, closefd=True
+                ),
+                encoding="utf-8",
+            )
+        compressor = zstandard.ZstdCompressor(
+            level=3 if level is None else level, threads=n_threads
+        )
+        return io.TextIOWrapper(
+            compressor.stream_writer(open(path, mode + "b"), closefd=True),
+            encoding="utf-8",
+        )
+    raise Exception(f"Error in open_file: unknown compression '{compression}'")
+
+
+def read_json(
+    path: Union[str, pathlib.Path],
+    compression: Optional[str] = None,
+) -> Any:
+    """Read a JSON file, which may be compressed
+
+    Parameters
+    ----------
+    path: Union[str, pathlib.Path]
+        The input file path.
+    compression: Optional[str] = None
+        One of "none", "gzip", or "zstd". If None, the compression is detected
+        from the leading magic bytes of the file.
+
+    Returns
+    -------
+    data: Any
+        The parsed JSON data.
+    """
+    with open_file(path, "r", compression=compression) as f:
+        return json.load(f)
+
+
+def write_json(
+    data: Any,
+    path: Union[str, pathlib.Path],
+    compression: Optional[str] = None,
+    level: Optional[int] = None,
+    n_threads: int = 0,
+    indent: Optional[int] = None,
+) -> None:
+    """Write a JSON file, which may be compressed
+
+    This can be used with the ``to_dict`` methods and list helpers, such as
+    :func:`~libcasm.configuration.io.supercell_list_to_data` and
+    :func:`~libcasm.configuration.io.configuration_list_to_data`, to write
+    compressed supercell and configuration files.
+
+    Parameters
+    ----------
+    data: Any
+        The JSON serializable data.
+    path: Union[str, pathlib.Path]
+        The output file path.
+    compression: Optional[str] = None
+        One of "none", "gzip", or "zstd". If None, the compression is
+        determined from the file extension.
+    level: Optional[int] = None
+        The compression level, as for :func:`~libcasm.configuration.io.open_file`.
+    n_threads: int = 0
+        The number of zstd compression threads, as for
+        :func:`~libcasm.configuration.io.open_file`.
+    indent: Optional[int] = None
+        If not None, pretty-print with this indent. Otherwise, the JSON is
+        written compactly.
+    """
+    with open_file(
+        path, "w", compression=compression, level=level, n_threads=n_threads
+    ) as f:
+        if indent is None:
+            json.dump(data, f, separators=(",", ":"))
+        else:
+            json.dump(data, f, indent=indent)
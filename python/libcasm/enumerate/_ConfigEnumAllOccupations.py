@@ -8,8 +8,12 @@ import libcasm.xtal as xtal
 
 from ._enumerate import (
     ConfigEnumAllOccupationsBase,
+    EnumProgress,
     make_distinct_cluster_sites,
+    make_distinct_occupations,
 )
+from ._EnumCheckpoint import EnumCheckpoint
+from ._EnumShard import EnumShard
 from ._ScelEnum import ScelEnum
 from ._SuperConfigEnum import SuperConfigEnum
 
@@ -31,6 +35,7 @@ class ConfigEnumAllOccupations:
         self,
         prim: casmconfig.Prim,
         supercell_set: Optional[casmconfig.SupercellSet] = None,
+        progress: Optional[EnumProgress] = None,
     ):
         """
         .. rubric:: Constructor
@@ -42,9 +47,15 @@ class ConfigEnumAllOccupations:
         supercell_set: Optional[casmconfig.SupercellSet] = None
             If not None, generated :class:`~casmconfig.Supercell` are constructed by
             adding in the :class:`~casmconfig.SupercellSet`.
+        progress: Optional[libcasm.enumerate.EnumProgress] = None
+            If not None, the number of configurations generated, found canonical,
+            and yielded, and the estimated total from the size of the occupation
+            counters, are accumulated natively in `progress`, which reports through
+            its throttled callback.
         """
         self._prim = prim
         self._supercell_set = supercell_set
+        self._progress = progress
 
         # Set and updated during an enumeration
         self._background = None
@@ -62,6 +73,11 @@ class ConfigEnumAllOccupations:
         adding in the :class:`~casmconfig.SupercellSet`."""
         return self._supercell_set
 
+    @property
+    def progress(self) -> Optional[EnumProgress]:
+        """If not None, enumeration progress is accumulated in `progress`."""
+        return self._progress
+
     @property
     def background(self) -> Optional[casmconfig.Configuration]:
         """During enumeration, `background` is set to the current background
@@ -170,6 +186,10 @@ class ConfigEnumAllOccupations:
         skip_equivalents: bool,
         use_background_invariant_group: bool,
         which_dofs: Optional[set[str]] = None,
+        n_threads: Optional[int] = None,
+        shard: Optional[EnumShard] = None,
+        checkpoint: Optional[EnumCheckpoint] = None,
+        check_prime_translations: bool = True,
     ):
         """Run the inner loop of enumerating occupations on sites in a background
 
@@ -202,6 +222,30 @@ class ConfigEnumAllOccupations:
             ``use_background_invariant_group is True``, the names of the degrees of
             freedom (DoF) in the background that must be invariant. The default is that
             all DoF must be invariant.
+        n_threads: Optional[int] = None
+            If not None, and ``skip_equivalents is True`` and
+            ``use_background_invariant_group is False``, enumerate in parallel
+            using :func:`~libcasm.enumerate.make_distinct_occupations` with
+            `n_threads` threads. Configurations are then yielded in sorted
+            order.
+        shard: Optional[EnumShard] = None
+            If not None, only configurations in work units owned by `shard` are
+            yielded. The work unit is set by the supercell name and the occupation on
+            the first `shard.prefix_length` sites, in sorted order. When enumerating in
+            parallel the work unit is the entire supercell.
+        checkpoint: Optional[EnumCheckpoint] = None
+            If not None, skip the background if its supercell was completed before
+            the saved checkpoint state, resume after the saved counter value if
+            resuming in its supercell, and update `checkpoint` after each
+            configuration is yielded.
+        check_prime_translations: bool = True
+            If True, and ``skip_non_primitive is True``, non-primitive
+            configurations are found with
+            :class:`~libcasm.configuration.PrimitiveConfigurationChecker`,
+            which only checks translations of prime order, before
+            canonicalization. Otherwise,
+            :func:`~libcasm.configuration.is_primitive_configuration` is used.
+            The same configurations are generated either way.
 
         Yields
         ------
@@ -216,10 +260,52 @@ class ConfigEnumAllOccupations:
             self._enum_index = 0
         else:
             self._enum_index += 1
+        supercell_name = None
+        sorted_sites = None
+        if shard is not None or checkpoint is not None:
+            supercell_name = casmconfig.SupercellRecord(
+                background.supercell
+            ).supercell_name
+            sorted_sites = sorted(sites)
+        resume_counter_value = None
+        if checkpoint is not None:
+            if checkpoint.skip_supercell(supercell_name):
+                return
+            resume_counter_value = checkpoint.begin_supercell(supercell_name)
+        if (
+            n_threads is not None
+            and skip_equivalents
+            and not use_background_invariant_group
+        ):
+            if shard is not None and not shard.owns(supercell_name):
+                return
+            for config in make_distinct_occupations(
+                background=background,
+                sites=sites,
+                skip_non_primitive=skip_non_primitive,
+                n_threads=n_threads,
+                progress=self._progress,
+            ):
+                yield config
+                if checkpoint is not None:
+                    checkpoint.update()
+            return
         config_enum = ConfigEnumAllOccupationsBase(
             background=background,
             sites=sites,
         )
+        if resume_counter_value is not None:
+            config_enum.set_counter_value(resume_counter_value)
+            config_enum.advance()
+        progress = self._progress
+        if progress is not None:
+            config_enum.set_progress(progress)
+        if skip_non_primitive and check_prime_translations:
+            is_primitive = casmconfig.PrimitiveConfigurationChecker(
+                background.supercell
+            ).is_primitive
+        else:
+            is_primitive = casmconfig.is_primitive_configuration
         if skip_equivalents:
             if use_background_invariant_group:
                 canonicalization_group = casmconfig.make_invariant_subgroup(
@@ -230,7 +316,14 @@ class ConfigEnumAllOccupations:
             else:
                 canonicalization_group = None
         while config_enum.is_valid():
-            if skip_non_primitive and not casmconfig.is_primitive_configuration(
+            if shard is not None and not shard.owns_configuration(
+                configuration=config_enum.value(),
+                sorted_sites=sorted_sites,
+                supercell_name=supercell_name,
+            ):
+                config_enum.advance()
+                continue
+            if skip_non_primitive and not is_primitive(
                 configuration=config_enum.value()
             ):
                 config_enum.advance()
@@ -241,7 +334,13 @@ class ConfigEnumAllOccupations:
             ):
                 config_enum.advance()
                 continue
+            if progress is not None:
+                if skip_equivalents:
+                    progress.add_canonical()
+                progress.add_accepted()
             yield config_enum.value()
+            if checkpoint is not None:
+                checkpoint.update(counter_value=config_enum.counter_value())
             config_enum.advance()
 
     def by_supercell(
@@ -256,6 +355,10 @@ class ConfigEnumAllOccupations:
         motif: Optional[casmconfig.Configuration] = None,
         skip_non_primitive: bool = True,
         skip_non_canonical: bool = True,
+        n_threads: Optional[int] = None,
+        shard: Optional[EnumShard] = None,
+        checkpoint: Optional[EnumCheckpoint] = None,
+        check_prime_translations: bool = True,
     ):
         """Enumerate all occupations in a series of enumerated supercells
 
@@ -315,6 +418,38 @@ class ConfigEnumAllOccupations:
             If True, enumeration skips non-canonical configurations with respect
             to the symmetry operations that leave the supercell lattice vectors
             invariant.
+        n_threads: Optional[int] = None
+            If not None, and ``skip_non_canonical is True``, the occupations in
+            each supercell are enumerated in parallel with
+            :func:`~libcasm.enumerate.make_distinct_occupations`, using
+            `n_threads` threads (if ``n_threads <= 0``, the number of hardware
+            threads). The same configurations are generated, but within each
+            supercell they are yielded in sorted order.
+
+        shard: Optional[EnumShard] = None
+            If not None, only configurations in the work units owned by `shard` are
+            yielded. Running the same enumeration with each shard of
+            ``range(shard.n_shards)`` generates each configuration exactly once, and
+            the results can be combined with
+            :func:`~libcasm.enumerate.merge_configuration_sets`. When `n_threads` is
+            not None, work units are entire supercells.
+        checkpoint: Optional[EnumCheckpoint] = None
+            If not None, the enumeration state is saved periodically to
+            `checkpoint`, and if `checkpoint` was read from an existing file the
+            enumeration resumes from the saved state. The same parameters must be
+            given when resuming. When the enumeration completes, the checkpoint is
+            marked complete, and resuming from it yields nothing.
+        check_prime_translations: bool = True
+            If True, and ``skip_non_primitive is True``, non-primitive
+            configurations are skipped before canonicalization using
+            :class:`~libcasm.configuration.PrimitiveConfigurationChecker`,
+            which only checks one translation generating each subgroup of
+            prime order, stopping at the first site with a different
+            occupation. If False, the check uses
+            :func:`~libcasm.configuration.is_primitive_configuration`. The
+            same configurations are generated either way. When `n_threads` is
+            not None, non-primitive configurations are always skipped before
+            canonicalization.
 
         Yields
         ------
@@ -379,6 +514,8 @@ class ConfigEnumAllOccupations:
             return
 
         self._begin()
+        if checkpoint is not None:
+            checkpoint.begin("ConfigEnumAllOccupations.by_supercell")
         scel_enum = ScelEnum(
             prim=self.prim,
             supercell_set=self.supercell_set,
@@ -394,14 +531,24 @@ class ConfigEnumAllOccupations:
                 skip_non_primitive=skip_non_primitive,
                 skip_equivalents=skip_non_canonical,
                 use_background_invariant_group=False,
+                n_threads=n_threads,
+                shard=shard,
+                checkpoint=checkpoint,
+                check_prime_translations=check_prime_translations,
             ):
                 yield config
+        if checkpoint is not None:
+            checkpoint.finish()
 
     def by_supercell_list(
         self,
         supercells: list[casmconfig.Supercell],
         skip_non_primitive: bool = True,
         skip_non_canonical: bool = True,
+        n_threads: Optional[int] = None,
+        shard: Optional[EnumShard] = None,
+        checkpoint: Optional[EnumCheckpoint] = None,
+        check_prime_translations: bool = True,
     ):
         """Enumerate all occupations in a list of supercells explicitly provided
 
@@ -416,6 +563,38 @@ class ConfigEnumAllOccupations:
             If True, enumeration skips non-canonical configurations with respect
             to the symmetry operations that leave the supercell lattice vectors
             invariant.
+        n_threads: Optional[int] = None
+            If not None, and ``skip_non_canonical is True``, the occupations in
+            each supercell are enumerated in parallel with
+            :func:`~libcasm.enumerate.make_distinct_occupations`, using
+            `n_threads` threads (if ``n_threads <= 0``, the number of hardware
+            threads). The same configurations are generated, but within each
+            supercell they are yielded in sorted order.
+
+        shard: Optional[EnumShard] = None
+            If not None, only configurations in the work units owned by `shard` are
+            yielded. Running the same enumeration with each shard of
+            ``range(shard.n_shards)`` generates each configuration exactly once, and
+            the results can be combined with
+            :func:`~libcasm.enumerate.merge_configuration_sets`. When `n_threads` is
+            not None, work units are entire supercells.
+        checkpoint: Optional[EnumCheckpoint] = None
+            If not None, the enumeration state is saved periodically to
+            `checkpoint`, and if `checkpoint` was read from an existing file the
+            enumeration resumes from the saved state. The same parameters must be
+            given when resuming. When the enumeration completes, the checkpoint is
+            marked complete, and resuming from it yields nothing.
+        check_prime_translations: bool = True
+            If True, and ``skip_non_primitive is True``, non-primitive
+            configurations are skipped before canonicalization using
+            :class:`~libcasm.configuration.PrimitiveConfigurationChecker`,
+            which only checks one translation generating each subgroup of
+            prime order, stopping at the first site with a different
+            occupation. If False, the check uses
+            :func:`~libcasm.configuration.is_primitive_configuration`. The
+            same configurations are generated either way. When `n_threads` is
+            not None, non-primitive configurations are always skipped before
+            canonicalization.
 
         Yields
         ------
@@ -423,6 +602,8 @@ class ConfigEnumAllOccupations:
             A :class:`~casmconfig.Configuration`.
         """
         self._begin()
+        if checkpoint is not None:
+            checkpoint.begin("ConfigEnumAllOccupations.by_supercell_list")
         for supercell in supercells:
             if self.supercell_set is not None:
                 self.supercell_set.add_supercell(supercell)
@@ -434,8 +615,14 @@ class ConfigEnumAllOccupations:
                 skip_non_primitive=skip_non_primitive,
                 skip_equivalents=skip_non_canonical,
                 use_background_invariant_group=False,
+                n_threads=n_threads,
+                shard=shard,
+                checkpoint=checkpoint,
+                check_prime_translations=check_prime_translations,
             ):
                 yield config
+        if checkpoint is not None:
+            checkpoint.finish()
 
     def by_supercell_with_continuous_dof(
         self,
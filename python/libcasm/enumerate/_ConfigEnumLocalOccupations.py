@@ -7,8 +7,9 @@ import libcasm.local_configuration as casmlocal
 import libcasm.xtal as xtal
 
 from ._enumerate import (
-    make_distinct_local_cluster_sites,
-    make_distinct_local_perturbations,
+    ConfigEnumLocalOccupationsEngine,
+    EnumProgress,
+    make_suborbit_generating_ops,
 )
 from ._make_distinct_super_configurations import (
     make_distinct_super_configurations,
@@ -63,30 +64,22 @@ def make_distinct_local_configurations(
             event_init = event_supercell_info.event(pos)
             event_group_rep = event_supercell_info.event_group_rep(pos)
 
-            def _is_suborbit_generator_op(rep_init):
-                for event_op in event_group_rep:
-                    for background_op in background_group:
-                        if background_op * rep_init * event_op < rep_init:
-                            return False
-                return True
-
-            rep_it = casmconfig.SupercellSymOp.begin(background.supercell)
-            rep_end = casmconfig.SupercellSymOp.end(background.supercell)
-
-            while rep_it != rep_end:
-                if _is_suborbit_generator_op(rep_it):
-                    event_final = event_supercell_info.copy_apply_supercell_symop(
-                        op=rep_it,
-                        occ_event=event_init,
-                    )
-                    local_configurations.append(
-                        casmlocal.LocalConfiguration(
-                            pos=event_supercell_info.coordinate(event_final),
-                            configuration=background,
-                            event_info=event_info,
-                        )
+            for rep in make_suborbit_generating_ops(
+                supercell=background.supercell,
+                event_group=event_group_rep,
+                background_group=background_group,
+            ):
+                event_final = event_supercell_info.copy_apply_supercell_symop(
+                    op=rep,
+                    occ_event=event_init,
+                )
+                local_configurations.append(
+                    casmlocal.LocalConfiguration(
+                        pos=event_supercell_info.coordinate(event_final),
+                        configuration=background,
+                        event_info=event_info,
                     )
-                rep_it.next()
+                )
         return local_configurations
 
     elif fix == "event":
@@ -303,39 +296,34 @@ class ConfigEnumLocalOccupationsReference:
 
         # Generate asymmetric unit indices for each local configuration
         _asym_indices = []
-        asymmetric_unit_indices_ref = None
+        asymmetric_unit_index_ref = None
         configuration_ref = None
         for local_config in initial:
-            small_supercell = local_config.configuration.supercell
-            asymmetric_unit_indices = casmconfig.asymmetric_unit_indices(
+            asymmetric_unit_index = casmconfig.make_asymmetric_unit_index(
                 configuration=local_config.configuration,
             )
-            if asymmetric_unit_indices_ref is None:
-                asymmetric_unit_indices_ref = asymmetric_unit_indices
+            if asymmetric_unit_index_ref is None:
+                asymmetric_unit_index_ref = asymmetric_unit_index
                 configuration_ref = local_config.configuration
 
             else:
-                asymmetric_unit_indices = (
-                    casmconfig.make_consistent_asymmetric_unit_indices(
-                        initial=asymmetric_unit_indices,
+                asymmetric_unit_index = (
+                    casmconfig.make_consistent_asymmetric_unit_index(
+                        initial=asymmetric_unit_index,
                         configuration_init=local_config.configuration,
-                        reference=asymmetric_unit_indices_ref,
+                        reference=asymmetric_unit_index_ref,
                         configuration_ref=configuration_ref,
                     )
                 )
 
-                if asymmetric_unit_indices is None:
+                if asymmetric_unit_index is None:
                     raise ValueError(
                         "Error in ConfigEnumLocalOccupationsReference: "
                         "Failed mapping asymmetric unit indices "
                         "between initial configurations."
                     )
 
-            asym_by_small_site_index = [None] * small_supercell.n_sites
-            for i_asym_unit, asym_unit in enumerate(asymmetric_unit_indices):
-                for site in asym_unit:
-                    asym_by_small_site_index[site] = i_asym_unit
-            _asym_indices.append(asym_by_small_site_index)
+            _asym_indices.append(asymmetric_unit_index.tolist())
 
         self.sublattice_indices = event_supercell_info.supercell.sublattice_indices()
         """list[int]: The prim sublattice indices for the sites in the supercell."""
@@ -578,6 +566,7 @@ class ConfigEnumLocalOccupations:
         event_info: casmlocal.OccEventSymInfo,
         supercell_set: Optional[casmconfig.SupercellSet] = None,
         verbose: bool = False,
+        progress: Optional[EnumProgress] = None,
     ):
         """
         .. rubric:: Constructor
@@ -591,6 +580,11 @@ class ConfigEnumLocalOccupations:
             adding in the :class:`~casmconfig.SupercellSet`.
         verbose: bool = False
             If True, print additional information about the enumeration process.
+        progress: Optional[libcasm.enumerate.EnumProgress] = None
+            If not None, the number of perturbed configurations generated and
+            distinct perturbations kept, and the estimated total from the
+            number of occupations on each local-cluster, are accumulated natively
+            in `progress`, which reports through its throttled callback.
 
         """
         if not isinstance(event_info, casmlocal.OccEventSymInfo):
@@ -615,6 +609,10 @@ class ConfigEnumLocalOccupations:
         self.verbose = verbose
         """bool: If True, print additional information about the enumeration process."""
 
+        self.progress = progress
+        """Optional[libcasm.enumerate.EnumProgress]: If not None, enumeration 
+        progress is accumulated in `progress`."""
+
     def _make_prim_local_orbits(
         self,
         cluster_specs: casmclust.ClusterSpecs,
@@ -766,110 +764,96 @@ class ConfigEnumLocalOccupations:
         result.i_initial = i_initial
         result.pos = pos
 
-        # Get distinct local-cluster sites (and i_local_orbit) to perturb
-        sites_to_perturb = []
-        i_local_orbit_for_sites = []
-        allow_subcluster_perturbations = False
+        # Make distinct local perturbations, as tuples
+        # (i_local_orbit, sites, initial_occupation, final_occupation,
+        # config, canonical_config). The C++ engine finds the symmetry
+        # operations that leave the background and event invariant once, and
+        # reuses them for every local-cluster orbit.
+        # Note: for a large neighborhood enumeration (i.e., using
+        # `neighborhood_from_orbits`) this can take a long time... Could consider
+        # implementing to yield each perturbation as it is generated, or allowing
+        # for filters.
+        engine = ConfigEnumLocalOccupationsEngine(
+            background=super_background,
+            event=event,
+            event_group=event_group_rep,
+        )
+        if self.progress is not None:
+            engine.set_progress(self.progress)
+        local_orbits = ref.event_local_orbits[i_initial]
         if neighborhood_from_orbits is not None:
-            # If `neighborhood_from_orbits` is True, then all local-cluster orbits
-            # around the event are combined into a single set of sites to perturb.
-            neighborhood_sites = set()
-            _i_local_orbit = []
-            for i_local_orbit, event_local_orbit in enumerate(
-                ref.event_local_orbits[i_initial]
-            ):
-                if i_local_orbit not in neighborhood_from_orbits:
-                    continue
-                # Make symmetrically distinct-local cluster sites, as list[set[int]],
-                # appropriately translated to the correct `pos` in the supercell
-                _i_local_orbit.append(i_local_orbit)
-                for cluster in event_local_orbit:
-                    for site in cluster:
-                        f_large = large_supercell.site_index_converter
-                        site_index = f_large.linear_site_index(site)
-                        neighborhood_sites.add(site_index)
-            sites_to_perturb.append([neighborhood_sites])
-            i_local_orbit_for_sites.append(_i_local_orbit)
-            allow_subcluster_perturbations = True
+            # If `neighborhood_from_orbits` is not None, then the selected
+            # local-cluster orbits around the event are combined into a single set
+            # of sites to perturb.
+            _i_local_orbit = [
+                i
+                for i in range(len(local_orbits))
+                if i in neighborhood_from_orbits
+            ]
+            perturbations = engine.by_neighborhood(
+                local_orbits=local_orbits,
+                neighborhood_from_orbits=set(_i_local_orbit),
+            )
         else:
-            # For each local-cluster orbit around the event...
-            for i_local_orbit, event_local_orbit in enumerate(
-                ref.event_local_orbits[i_initial]
-            ):
-                if orbits is not None:
-                    if i_local_orbit not in orbits:
-                        continue
-                # Make symmetrically distinct-local cluster sites, as list[set[int]],
-                # appropriately translated to the correct `pos` in the supercell
-                i_local_orbit_for_sites.append(i_local_orbit)
-                distinct_local_cluster_sites = make_distinct_local_cluster_sites(
-                    configuration=super_background,
-                    event=event,
-                    event_group=event_group_rep,
-                    local_orbits=[event_local_orbit],
-                )
-                sites_to_perturb.append(distinct_local_cluster_sites)
-
-        # For all distinct local-cluster sites to perturb...
-        for i, sites in enumerate(sites_to_perturb):
-            result.i_local_orbit = i_local_orbit_for_sites[i]
-
-            # Make distinct local perturbations on the distinct local-cluster sites
-            # Note: for a large neighborhood enumeration (i.e., using
-            # `neighborhood_from_orbits`) this can take a long time... Could consider
-            # implementing to yield each perturbation as it is generated, or allowing
-            # for filters.
-            perturbations = make_distinct_local_perturbations(
-                configuration=super_background,
-                event=event,
-                event_group=event_group_rep,
-                distinct_local_cluster_sites=sites,
-                allow_subcluster_perturbations=allow_subcluster_perturbations,
+            perturbations = engine.by_cluster(
+                local_orbits=local_orbits,
+                orbits=set(orbits) if orbits is not None else None,
             )
 
-            # For each individual perturbation, store the results in `result` and yield
-            for cluster_sites, config, canonical_config in perturbations:
-                # Set result local configuration
-                result.local_configuration = casmlocal.LocalConfiguration(
-                    pos=pos,
-                    configuration=config,
-                    event_info=ref.event_info,
-                )
+        f_small = small_supercell.site_index_converter
+        f_large = large_supercell.site_index_converter
+
+        # For each individual perturbation, store the results in `result` and yield
+        for (
+            i_local_orbit,
+            cluster_sites,
+            initial_occupation,
+            final_occupation,
+            config,
+            canonical_config,
+        ) in perturbations:
+            if neighborhood_from_orbits is not None:
+                result.i_local_orbit = _i_local_orbit
+            else:
+                result.i_local_orbit = i_local_orbit
 
-                # Set result canonical local configuration
-                result.canonical_local_configuration = casmlocal.LocalConfiguration(
-                    pos=pos,
-                    configuration=canonical_config,
-                    event_info=ref.event_info,
-                )
+            # Set result local configuration
+            result.local_configuration = casmlocal.LocalConfiguration(
+                pos=pos,
+                configuration=config,
+                event_info=ref.event_info,
+            )
 
-                # Set site indices for the cluster sites
-                result.sites = cluster_sites
+            # Set result canonical local configuration
+            result.canonical_local_configuration = casmlocal.LocalConfiguration(
+                pos=pos,
+                configuration=canonical_config,
+                event_info=ref.event_info,
+            )
 
-                # Set sublattice indices for the cluster sites
-                result.sublattices = [
-                    sublattice_indices[site_index] for site_index in cluster_sites
-                ]
+            # Set site indices for the cluster sites
+            result.sites = cluster_sites
 
-                # Set asymmetric unit indices for the cluster sites
-                result.asymmetric_units = []
-                f_small = small_supercell.site_index_converter
-                f_large = large_supercell.site_index_converter
-                for large_site_index in cluster_sites:
-                    site = f_large.integral_site_coordinate(large_site_index)
-                    small_site_index = f_small.linear_site_index(site)
-                    result.asymmetric_units.append(
-                        ref.asymmetric_unit_indices[i_initial][small_site_index]
-                    )
+            # Set sublattice indices for the cluster sites
+            result.sublattices = [
+                sublattice_indices[site_index] for site_index in cluster_sites
+            ]
 
-                # Set initial and final occupations for the cluster sites
-                result.initial_occupation = [
-                    super_background.occ(s) for s in cluster_sites
-                ]
-                result.final_occupation = [config.occ(s) for s in cluster_sites]
+            # Set asymmetric unit indices for the cluster sites
+            result.asymmetric_units = []
+            for large_site_index in cluster_sites:
+                site = f_large.integral_site_coordinate(large_site_index)
+                small_site_index = f_small.linear_site_index(site)
+                result.asymmetric_units.append(
+                    ref.asymmetric_unit_indices[i_initial][small_site_index]
+                )
 
-                # Yield the result
-                yield result
+            # Set initial and final occupations for the cluster sites
+            result.initial_occupation = initial_occupation
+            result.final_occupation = final_occupation
+
+            # Yield the result
+            yield result
 
     def by_cluster(
         self,
@@ -1056,10 +1040,10 @@ class ConfigEnumLocalOccupations:
            configuration according to the prim factor group symmetry using the provided
            `cluster_specs`.
         3. Generate the distinct local-cluster sites, for each local-cluster orbit,
-           for each initial local configuration, using
-           :func:`~libcasm.configuration.make_distinct_local_cluster_sites`.
-        4. Generate distinct local perturbations on the distinct local-cluster sites
-           using :func:`~libcasm.configuration.make_distinct_local_perturbations`.
+           for each initial local configuration, and
+        4. Generate distinct local perturbations on the distinct local-cluster
+           sites, both using
+           :class:`~libcasm.enumerate.ConfigEnumLocalOccupationsEngine`.
 
         .. rubric:: Variations
 
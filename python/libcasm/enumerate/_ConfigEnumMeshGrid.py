@@ -6,10 +6,8 @@ import numpy as np
 import libcasm.casmglobal
 import libcasm.clexulator as casmclex
 import libcasm.configuration as casmconfig
-import libcasm.counter
-from libcasm.configuration._misc import (
-    equivalent_order_parameters_index,
-    make_canonical_order_parameters,
+from libcasm.enumerate._enumerate import (
+    MeshGridPointEnumerator,
 )
 from libcasm.irreps import (
     SubWedge,
@@ -18,51 +16,28 @@ from libcasm.irreps import (
 array_like = TypeVar("array_like")
 
 
-def _is_corner_point(
-    x: np.ndarray,
-    shape_factor: np.ndarray,
-    abs_tol: float = libcasm.casmglobal.TOL,
-) -> bool:
-    if x.transpose() @ shape_factor @ x > 1.0 + abs_tol:
-        return True
-    return False
-
+def _make_dof_space_rep(
+    background: casmconfig.Configuration,
+    dof_space: casmclex.DoFSpace,
+) -> list[np.ndarray]:
+    fg = casmconfig.make_invariant_subgroup(background)
+    return casmconfig.make_dof_space_rep(group=fg, dof_space=dof_space)
 
-def _subwedge_counter(
-    subwedge: SubWedge,
-    stop: float,
-    num: int,
-) -> tuple[list[np.ndarray], libcasm.counter.IntCounter]:
-    """Generate a counter for integer coordinates of subwedge points"""
-    dim = subwedge.trans_mat.shape[1]
-    start = [0.0] * dim
-    stop = [stop] * dim
-    num = [num] * dim
-
-    # For axes with multiplicity==1, include both positive and negative coordinates;
-    # otherwise, only include positive
-    subwedge_axis_index = 0
-    for irrep_wedge in subwedge.irrep_wedges:
-        for i, m in enumerate(irrep_wedge.mult):
-            if m == 1:
-                start[subwedge_axis_index] = -stop[subwedge_axis_index]
-
-                # keep point at 0.0 * axis
-                num[subwedge_axis_index] = 2 * num[subwedge_axis_index] - 1
-        subwedge_axis_index += 1
-
-    xi = [
-        np.linspace(_start, _stop, num=_num)
-        for _start, _stop, _num in zip(start, stop, num)
-    ]
-
-    counter = libcasm.counter.IntCounter(
-        initial=[0] * dim,
-        final=[len(x) - 1 for x in xi],
-        increment=[1] * dim,
-    )
 
-    return (xi, counter)
+def _iterate_batches(
+    enumerator: MeshGridPointEnumerator,
+    batch_size: int,
+):
+    """Yield (grid_index, point) from a MeshGridPointEnumerator, filling arrays
+    of `batch_size` points at a time"""
+    batch = np.zeros((batch_size, enumerator.dim()), dtype="float64")
+    grid_index = np.zeros((batch_size,), dtype="int64")
+    while True:
+        n_written = enumerator.fill_batch(batch, grid_index)
+        for i in range(n_written):
+            yield (int(grid_index[i]), batch[i].copy())
+        if n_written < batch_size:
+            return
 
 
 def meshgrid_points(
@@ -71,6 +46,7 @@ def meshgrid_points(
     xi: list[array_like],
     skip_equivalents: bool = False,
     abs_tol: float = libcasm.casmglobal.TOL,
+    batch_size: int = 1000,
 ):
     """Generate points in a meshgrid
 
@@ -93,6 +69,9 @@ def meshgrid_points(
         the `background` configuration.
     abs_tol: float = :data:`~libcasm.casmglobal.TOL`
         The absolute tolerance used for checking equivalence.
+    batch_size: int = 1000
+        Points are generated in C++, by
+        :class:`~libcasm.enumerate.MeshGridPointEnumerator`, this many at a time.
 
     Yields
     ------
@@ -100,37 +79,14 @@ def meshgrid_points(
         A point in the meshgrid.
     """
 
-    if skip_equivalents:
-        fg = casmconfig.make_invariant_subgroup(background)
-        dof_space_rep = casmconfig.make_dof_space_rep(group=fg, dof_space=dof_space)
-        canonical_eta_list = []
-
-    dim = len(xi)
-    counter = libcasm.counter.IntCounter(
-        initial=[0] * dim,
-        final=[len(x) - 1 for x in xi],
-        increment=[1] * dim,
+    enumerator = MeshGridPointEnumerator(
+        xi=[np.asarray(x, dtype="float64") for x in xi],
+        dof_space_rep=(
+            _make_dof_space_rep(background, dof_space) if skip_equivalents else None
+        ),
+        abs_tol=abs_tol,
     )
-
-    for indices in counter:
-        eta = np.array([x[i] for x, i in zip(xi, indices)])
-        if skip_equivalents:
-            if (
-                equivalent_order_parameters_index(
-                    canonical_eta_list=canonical_eta_list,
-                    eta=eta,
-                    dof_space_rep=dof_space_rep,
-                    abs_tol=abs_tol,
-                )
-                is not None
-            ):
-                continue
-            else:
-                canonical_eta_list.append(
-                    make_canonical_order_parameters(
-                        eta=eta, dof_space_rep=dof_space_rep, abs_tol=abs_tol
-                    )
-                )
+    for _, eta in _iterate_batches(enumerator, batch_size):
         yield eta
 
 
@@ -143,6 +99,7 @@ def irreducible_wedge_points(
     trim_corners: bool = True,
     skip_equivalents: bool = False,
     abs_tol: float = libcasm.casmglobal.TOL,
+    batch_size: int = 1000,
 ):
     """Generate points in the irreducible wedge
 
@@ -182,6 +139,9 @@ def irreducible_wedge_points(
         the `background` configuration.
     abs_tol: float = :data:`~libcasm.casmglobal.TOL`
         The absolute tolerance used for checking equivalence.
+    batch_size: int = 1000
+        Points are generated in C++, by
+        :class:`~libcasm.enumerate.MeshGridPointEnumerator`, this many at a time.
 
     Yields
     ------
@@ -195,46 +155,18 @@ def irreducible_wedge_points(
             `dof_space.basis`.
     """
 
-    if skip_equivalents:
-        fg = casmconfig.make_invariant_subgroup(background)
-        dof_space_rep = casmconfig.make_dof_space_rep(group=fg, dof_space=dof_space)
-        canonical_eta_list = []
-    if trim_corners:
-        dim = dof_space.subspace_dim
-        shape_factor = np.eye(dim)
-        for i in range(dim):
-            shape_factor[i, i] = 1.0 / (abs(stop) ** 2)
-
-    for subwedge_index, subwedge in enumerate(irreducible_wedge):
-        xi, counter = _subwedge_counter(subwedge, stop, num)
-
-        for indices in counter:
-            eta_subwedge = np.array([x[i] for x, i in zip(xi, indices)])
-            if trim_corners:
-                if _is_corner_point(
-                    x=eta_subwedge, shape_factor=shape_factor, abs_tol=abs_tol
-                ):
-                    continue
-            eta = dof_space.basis_inv @ subwedge.trans_mat @ eta_subwedge
-
-            if skip_equivalents:
-                if (
-                    equivalent_order_parameters_index(
-                        canonical_eta_list=canonical_eta_list,
-                        eta=eta,
-                        dof_space_rep=dof_space_rep,
-                        abs_tol=abs_tol,
-                    )
-                    is not None
-                ):
-                    continue
-                else:
-                    canonical_eta_list.append(
-                        make_canonical_order_parameters(
-                            eta=eta, dof_space_rep=dof_space_rep, abs_tol=abs_tol
-                        )
-                    )
-            yield (subwedge_index, eta)
+    enumerator = MeshGridPointEnumerator(
+        irreducible_wedge=irreducible_wedge,
+        basis_inv=dof_space.basis_inv,
+        stop=stop,
+        num=num,
+        trim_corners=trim_corners,
+        dof_space_rep=(
+            _make_dof_space_rep(background, dof_space) if skip_equivalents else None
+        ),
+        abs_tol=abs_tol,
+    )
+    yield from _iterate_batches(enumerator, batch_size)
 
 
 class ConfigEnumMeshGrid:
@@ -363,8 +295,8 @@ class ConfigEnumMeshGrid:
         # casmconfig.make_canonical_configuration, instead of generating points without
         # equivalents using meshgrid_points(..., skip_equivalents=True) because:
         # 1) This is exact: does not depend on background choice
-        # 2) This seems to be faster: meshgrid_points currently uses comparisons of the
-        #    order parameter vectors in Python, vs Configuration comparisons in C++
+        # 2) It also accounts for symmetry that does not leave the background
+        #    invariant but maps the configuration to an equivalent one
 
         if skip_equivalents:
             is_canonical_background_supercell = casmconfig.is_canonical_supercell(
@@ -623,8 +555,8 @@ class ConfigEnumMeshGrid:
         # casmconfig.make_canonical_configuration, instead of generating points without
         # equivalents using meshgrid_points(..., skip_equivalents=True) because:
         # 1) This is exact: does not depend on background choice
-        # 2) This seems to be faster: meshgrid_points currently uses comparisons of the
-        #    order parameter vectors in Python, vs Configuration comparisons in C++
+        # 2) It also accounts for symmetry that does not leave the background
+        #    invariant but maps the configuration to an equivalent one
 
         if skip_equivalents:
             is_canonical_background_supercell = casmconfig.is_canonical_supercell(
@@ -0,0 +1,272 @@
+import json
+import os
+import pathlib
+import tempfile
+import time
+from typing import Optional, Union
+
+import libcasm.configuration as casmconfig
+
+ENUM_CHECKPOINT_VERSION = "1.0"
+
+
+class EnumCheckpoint:
+    """Periodically saves the state of an enumeration, so it can be resumed
+
+    The state saved is the name of the supercell currently being enumerated and the
+    counter value (see
+    :func:`ConfigEnumAllOccupationsBase.counter_value
+    <libcasm.enumerate.ConfigEnumAllOccupationsBase.counter_value>`) of the last
+    configuration yielded. Optionally, a
+    :class:`~libcasm.configuration.ConfigurationSet` that is being filled with the
+    results is saved too. The checkpoint file is
+    written every `every_n` configurations yielded, and/or every `every_seconds`
+    seconds, by writing to a temporary file and then renaming, so a job that is
+    killed while writing leaves the previous checkpoint intact.
+
+    If the checkpoint file exists at construction, it is read and the next
+    enumeration using the checkpoint resumes: supercells before the saved supercell
+    are skipped, and enumeration in the saved supercell continues after the last
+    configuration yielded. When enumerating in parallel over the occupations in a
+    supercell, the saved supercell is enumerated again from the beginning, so some
+    configurations may be yielded twice; adding them to a ConfigurationSet again
+    has no effect.
+
+    .. rubric:: Example usage
+
+    .. code-block:: Python
+
+        import libcasm.configuration as casmconfig
+        import libcasm.enumerate as casmenum
+
+        supercell_set = casmconfig.SupercellSet(prim=prim)
+        checkpoint = casmenum.EnumCheckpoint(
+            path="enum_checkpoint.json",
+            every_seconds=600.0,
+            supercell_set=supercell_set,
+        )
+        configuration_set = checkpoint.configuration_set
+        config_enum = casmenum.ConfigEnumAllOccupations(
+            prim=prim,
+            supercell_set=supercell_set,
+        )
+        for configuration in config_enum.by_supercell(
+            max=12,
+            checkpoint=checkpoint,
+        ):
+            configuration_set.add(configuration)
+
+    """
+
+    def __init__(
+        self,
+        path: Union[str, pathlib.Path],
+        every_n: Optional[int] = None,
+        every_seconds: Optional[float] = None,
+        supercell_set: Optional[casmconfig.SupercellSet] = None,
+    ):
+        """
+        .. rubric:: Constructor
+
+        Parameters
+        ----------
+        path: Union[str, pathlib.Path]
+            Path to the checkpoint file. If it exists, it is read and enumeration
+            resumes from the saved state.
+        every_n: Optional[int] = None
+            If not None, save a checkpoint every `every_n` configurations yielded.
+        every_seconds: Optional[float] = None
+            If not None, save a checkpoint when at least `every_seconds` seconds have
+            passed since the last checkpoint was saved, checked each time a
+            configuration is yielded.
+        supercell_set: Optional[casmconfig.SupercellSet] = None
+            If not None, :py:attr:`configuration_set` is saved with the checkpoint,
+            and when resuming it is read, using `supercell_set` to hold its
+            supercells.
+        """
+        if every_n is not None and every_n < 1:
+            raise ValueError("Error in EnumCheckpoint: every_n must be >= 1")
+        if every_seconds is not None and every_seconds <= 0.0:
+            raise ValueError("Error in EnumCheckpoint: every_seconds must be > 0")
+        self._path = pathlib.Path(path)
+        self._every_n = every_n
+        self._every_seconds = every_seconds
+        self._supercell_set = supercell_set
+
+        self._configuration_set = None
+        if supercell_set is not None:
+            self._configuration_set = casmconfig.ConfigurationSet()
+
+        # resume state, as read from the checkpoint file
+        self._resume = None
+
+        # current state
+        self._method = None
+        self._supercell_name = None
+        self._counter_value = None
+        self._n_yielded = 0
+        self._is_complete = False
+
+        self._n_since_save = 0
+        self._last_save_time = time.time()
+
+        if self._path.exists():
+            self._read()
+
+    @property
+    def path(self) -> pathlib.Path:
+        """pathlib.Path: Path to the checkpoint file"""
+        return self._path
+
+    @property
+    def configuration_set(self) -> Optional[casmconfig.ConfigurationSet]:
+        """Optional[casmconfig.ConfigurationSet]: A configuration set that is saved
+        with the checkpoint, or None if `supercell_set` was not given at construction.
+        When resuming, this is read from the checkpoint file."""
+        return self._configuration_set
+
+    @property
+    def is_resuming(self) -> bool:
+        """bool: True if the enumeration has not yet reached the saved state"""
+        return self._resume is not None
+
+    @property
+    def is_complete(self) -> bool:
+        """bool: True if the enumeration using this checkpoint completed"""
+        return self._is_complete
+
+    @property
+    def n_yielded(self) -> int:
+        """int: The total number of configurations yielded, including before
+        resuming"""
+        return self._n_yielded
+
+    def _read(self):
+        with open(self._path, "r") as f:
+            data = json.load(f)
+        if data.get("version") != ENUM_CHECKPOINT_VERSION:
+            raise ValueError(
+                f"Error in EnumCheckpoint: unsupported version in {self._path}"
+            )
+        state = data["state"]
+        self._method = state["method"]
+        self._n_yielded = state["n_yielded"]
+        self._is_complete = state["is_complete"]
+        if not self._is_complete:
+            self._resume = state
+        if self._configuration_set is not None and "configuration_set" in data:
+            self._configuration_set = casmconfig.ConfigurationSet.from_dict(
+                data=data["configuration_set"],
+                supercells=self._supercell_set,
+            )
+
+    def save(self):
+        """Write the checkpoint file now"""
+        data = {
+            "version": ENUM_CHECKPOINT_VERSION,
+            "state": {
+                "method": self._method,
+                "supercell_name": self._supercell_name,
+                "counter_value": self._counter_value,
+                "n_yielded": self._n_yielded,
+                "is_complete": self._is_complete,
+            },
+        }
+        if self._configuration_set is not None:
+            data["configuration_set"] = self._configuration_set.to_dict()
+
+        # write to a temporary file, then rename, so that a job killed while
+        # writing leaves the previous checkpoint intact
+        directory = self._path.parent
+        directory.mkdir(parents=True, exist_ok=True)
+        fd, tmp_path = tempfile.mkstemp(dir=directory, suffix=".tmp")
+        try:
+            with os.fdopen(fd, "w") as f:
+                f.write(json.dumps(data, separators=(",", ":")))
+            os.replace(tmp_path, self._path)
+        except BaseException:
+            if os.path.exists(tmp_path):
+                os.remove(tmp_path)
+            raise
+        self._n_since_save = 0
+        self._last_save_time = time.time()
+
+    def begin(self, method: str):
+        """Begin an enumeration
+
+        Parameters
+        ----------
+        method: str
+            A name for the enumeration method, which must match the saved name when
+            resuming.
+        """
+        if self._method is not None and self._method != method:
+            raise ValueError(
+                "Error in EnumCheckpoint: "
+                f"checkpoint method '{self._method}' does not match '{method}'"
+            )
+        self._method = method
+
+    def skip_supercell(self, supercell_name: str) -> bool:
+        """Return True if a supercell was completed before the saved state
+
+        If the enumeration is complete, all supercells are skipped. If resuming,
+        supercells are skipped until the saved supercell is reached.
+        """
+        if self._is_complete:
+            return True
+        if self._resume is None:
+            return False
+        return supercell_name != self._resume["supercell_name"]
+
+    def begin_supercell(self, supercell_name: str) -> Optional[list[int]]:
+        """Begin enumeration in a supercell
+
+        Parameters
+        ----------
+        supercell_name: str
+            The name of the supercell being enumerated.
+
+        Returns
+        -------
+        counter_value: Optional[list[int]]
+            If resuming in this supercell, the counter value of the last
+            configuration yielded before the checkpoint was saved, or None if
+            enumeration in this supercell should start from the beginning.
+        """
+        counter_value = None
+        if self._resume is not None:
+            if supercell_name == self._resume["supercell_name"]:
+                counter_value = self._resume["counter_value"]
+            self._resume = None
+        self._supercell_name = supercell_name
+        self._counter_value = None
+        return counter_value
+
+    def update(self, counter_value: Optional[list[int]] = None):
+        """Record that a configuration was yielded, and save if due
+
+        Parameters
+        ----------
+        counter_value: Optional[list[int]] = None
+            The counter value of the configuration yielded, or None if enumeration
+            in the current supercell cannot be resumed from the middle.
+        """
+        self._counter_value = None if counter_value is None else list(counter_value)
+        self._n_yielded += 1
+        self._n_since_save += 1
+        if self._every_n is not None and self._n_since_save >= self._every_n:
+            self.save()
+        elif (
+            self._every_seconds is not None
+            and time.time() - self._last_save_time >= self._every_seconds
+        ):
+            self.save()
+
+    def finish(self):
+        """Record that the enumeration completed, and save"""
+        self._is_complete = True
+        self._resume = None
+        self._supercell_name = None
+        self._counter_value = None
+        self.save()
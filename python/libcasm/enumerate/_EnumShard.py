@@ -0,0 +1,242 @@
+import hashlib
+from typing import Iterable, Optional
+
+import libcasm.configuration as casmconfig
+
+
+class EnumShard:
+    """Describes one shard of an enumeration that is partitioned into work units
+
+    An enumeration is partitioned into work units, each specified by a supercell name
+    and a prefix, the occupation on the first `prefix_length` sites (in sorted order)
+    on which occupations are enumerated. Each work unit is owned by exactly one of
+    `n_shards` shards, as determined by a stable hash of the work unit. Ownership
+    does not depend on the order of enumeration or on the machine, so independent
+    processes that run the same enumeration with each `shard_id` in
+    ``range(n_shards)`` together generate each configuration exactly once.
+
+    .. rubric:: Example usage
+
+    .. code-block:: Python
+
+        import libcasm.configuration as casmconfig
+        import libcasm.enumerate as casmenum
+
+        # on each node, with shard_id in range(n_shards):
+        shard = casmenum.EnumShard(shard_id=shard_id, n_shards=n_shards)
+        configuration_set = casmconfig.ConfigurationSet()
+        config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+        for configuration in config_enum.by_supercell(max=8, shard=shard):
+            configuration_set.add(configuration)
+
+        # after collecting the per-shard results:
+        merged = casmenum.merge_configuration_sets(configuration_sets)
+
+    """
+
+    def __init__(
+        self,
+        shard_id: int,
+        n_shards: int,
+        prefix_length: int = 0,
+    ):
+        """
+        .. rubric:: Constructor
+
+        Parameters
+        ----------
+        shard_id: int
+            The index of this shard, in ``range(n_shards)``.
+        n_shards: int
+            The total number of shards. Must be >= 1.
+        prefix_length: int = 0
+            The number of sites whose occupation, together with the supercell name,
+            specifies a work unit. With the default, 0, each work unit is an entire
+            supercell. Larger values make smaller work units, which balance better
+            when there are few supercells, with a small cost for hashing the prefix
+            of every configuration generated.
+        """
+        if n_shards < 1:
+            raise ValueError("Error in EnumShard: n_shards must be >= 1")
+        if shard_id < 0 or shard_id >= n_shards:
+            raise ValueError("Error in EnumShard: shard_id must be in range(n_shards)")
+        if prefix_length < 0:
+            raise ValueError("Error in EnumShard: prefix_length must be >= 0")
+        self._shard_id = shard_id
+        self._n_shards = n_shards
+        self._prefix_length = prefix_length
+
+    @property
+    def shard_id(self) -> int:
+        """int: The index of this shard"""
+        return self._shard_id
+
+    @property
+    def n_shards(self) -> int:
+        """int: The total number of shards"""
+        return self._n_shards
+
+    @property
+    def prefix_length(self) -> int:
+        """int: The number of sites whose occupation, together with the supercell
+        name, specifies a work unit"""
+        return self._prefix_length
+
+    def owner(self, supercell_name: str, prefix: Iterable[int] = ()) -> int:
+        """Return the shard that owns a work unit
+
+        Parameters
+        ----------
+        supercell_name: str
+            The supercell name.
+        prefix: Iterable[int] = ()
+            The occupation on the first `prefix_length` sites.
+
+        Returns
+        -------
+        shard_id: int
+            The index of the shard that owns the work unit.
+        """
+        key = supercell_name + ":" + ",".join(str(int(x)) for x in prefix)
+        digest = hashlib.sha1(key.encode("utf-8")).digest()
+        return int.from_bytes(digest[:8], "big") % self._n_shards
+
+    def owns(self, supercell_name: str, prefix: Iterable[int] = ()) -> bool:
+        """Return True if this shard owns a work unit"""
+        return self.owner(supercell_name, prefix) == self._shard_id
+
+    def owns_supercell(self, supercell: casmconfig.Supercell) -> bool:
+        """Return True if this shard owns the work unit that is an entire supercell
+
+        This is used for enumerations that are only partitioned by supercell.
+        """
+        return self.owns(casmconfig.SupercellRecord(supercell).supercell_name)
+
+    def owns_configuration(
+        self,
+        configuration: casmconfig.Configuration,
+        sorted_sites: list[int],
+        supercell_name: Optional[str] = None,
+    ) -> bool:
+        """Return True if this shard owns the work unit which contains a
+        configuration
+
+        Parameters
+        ----------
+        configuration: casmconfig.Configuration
+            A configuration generated by enumerating occupations on sites.
+        sorted_sites: list[int]
+            The linear site indices on which occupations are enumerated, in sorted
+            order. The first `prefix_length` are used to determine the work unit.
+        supercell_name: Optional[str] = None
+            The name of the configuration's supercell, if already known.
+
+        Returns
+        -------
+        value: bool
+            True if this shard owns the work unit which contains `configuration`.
+        """
+        if supercell_name is None:
+            supercell_name = casmconfig.SupercellRecord(
+                configuration.supercell
+            ).supercell_name
+        occupation = configuration.occupation
+        prefix = [occupation[l] for l in sorted_sites[: self._prefix_length]]
+        return self.owns(supercell_name, prefix)
+
+    def to_dict(self) -> dict:
+        """Represent the EnumShard as a Python dict"""
+        return {
+            "shard_id": self._shard_id,
+            "n_shards": self._n_shards,
+            "prefix_length": self._prefix_length,
+        }
+
+    @staticmethod
+    def from_dict(data: dict) -> "EnumShard":
+        """Construct an EnumShard from a Python dict"""
+        return EnumShard(
+            shard_id=data["shard_id"],
+            n_shards=data["n_shards"],
+            prefix_length=data.get("prefix_length", 0),
+        )
+
+    def __repr__(self):
+        return (
+            f"EnumShard(shard_id={self._shard_id}, n_shards={self._n_shards}, "
+            f"prefix_length={self._prefix_length})"
+        )
+
+
+def merge_configuration_sets(
+    configuration_sets: Iterable[casmconfig.ConfigurationSet],
+    base: Optional[casmconfig.ConfigurationSet] = None,
+) -> casmconfig.ConfigurationSet:
+    """Merge per-shard ConfigurationSet, assigning configuration_id reproducibly
+
+    Records in `base` keep their configuration_id. Configurations from
+    `configuration_sets` that are not in `base` are de-duplicated and then added in
+    sorted order, with configuration_id assigned consecutively in each supercell,
+    continuing after the largest integer configuration_id already in use. The result
+    therefore does not depend on how the enumeration was sharded or on the order in
+    which shards finish.
+
+    All configurations must share the same prim, for example by constructing each
+    ConfigurationSet with :func:`ConfigurationSet.from_dict
+    <libcasm.configuration.ConfigurationSet.from_dict>` using the same
+    :class:`~libcasm.configuration.SupercellSet`. Configurations are compared as
+    given, so configurations that are not canonical should be made canonical before
+    merging.
+
+    Parameters
+    ----------
+    configuration_sets: Iterable[casmconfig.ConfigurationSet]
+        The per-shard configuration sets. Their configuration_id are not used.
+    base: Optional[casmconfig.ConfigurationSet] = None
+        An existing configuration set, whose records are kept as is.
+
+    Returns
+    -------
+    merged: casmconfig.ConfigurationSet
+        A new configuration set, containing the records in `base` and the distinct
+        configurations in `configuration_sets`.
+    """
+    merged = casmconfig.ConfigurationSet()
+    next_id = {}
+
+    def _update_next_id(record):
+        try:
+            value = int(record.configuration_id) + 1
+        except ValueError:
+            return
+        name = record.supercell_name
+        next_id[name] = max(next_id.get(name, 0), value)
+
+    if base is not None:
+        for record in base:
+            merged.add_record(record)
+            _update_next_id(record)
+
+    new_configurations = []
+    for configuration_set in configuration_sets:
+        for record in configuration_set:
+            if record.configuration not in merged:
+                new_configurations.append(record.configuration)
+    new_configurations.sort()
+
+    for configuration in new_configurations:
+        if configuration in merged:
+            continue
+        supercell_name = casmconfig.SupercellRecord(
+            configuration.supercell
+        ).supercell_name
+        configuration_id = next_id.get(supercell_name, 0)
+        merged.add_record(
+            casmconfig.ConfigurationRecord(
+                configuration=configuration,
+                supercell_name=supercell_name,
+                configuration_id=str(configuration_id),
+            )
+        )
+        next_id[supercell_name] = configuration_id + 1
+    return merged
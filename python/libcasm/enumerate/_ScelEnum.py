@@ -5,6 +5,9 @@ import numpy as np
 import libcasm.configuration as casmconfig
 import libcasm.xtal as xtal
 
+from ._enumerate import (
+    enumerate_canonical_supercells,
+)
 from ._SuperlatticeEnum import SuperlatticeEnum
 
 
@@ -223,3 +226,71 @@ class ScelEnum:
                     transformation_matrix_to_super=T,
                 )
                 yield record.supercell
+
+    def make_all_by_volume(
+        self,
+        max: int,
+        min: int = 1,
+        unit_cell: Optional[np.ndarray] = None,
+        dirs: str = "abc",
+        diagonal_only: bool = False,
+        fixed_shape: bool = False,
+        n_threads: int = 1,
+    ) -> list[casmconfig.Supercell]:
+        """Make all symmetrically distinct supercells for a range of volumes
+
+        Gives the same supercells, in the same order, as :func:`by_volume`, but
+        superlattices are enumerated, put in canonical form, and used to
+        construct supercells in C++, with volumes distributed over threads,
+        using :func:`~libcasm.enumerate.enumerate_canonical_supercells`. This is
+        much faster than :func:`by_volume` when there are many supercells.
+
+        Parameters
+        ----------
+        max : int
+            The maximum volume superlattice to enumerate. The volume is measured
+            relative the unit cell being used to generate supercells.
+        min : int, default=1
+            The minimum volume superlattice to enumerate. The volume is measured
+            relative the unit cell being used to generate supercells.
+        dirs : str, default="abc"
+            A string indicating which lattice vectors to enumerate over. Some
+            combination of 'a', 'b', and 'c', where 'a' indicates the first lattice
+            vector of the unit cell, 'b' the second, and 'c' the third.
+        unit_cell: Optional[np.ndarray] = None,
+            An integer shape=(3,3) transformation matrix `U` allows specifying an
+            alternative unit cell that can be used to generate superlattices of the
+            form `S = (L @ U) @ T`. If None, `U` is set to the identity matrix.
+        diagonal_only: bool = False
+            If true, restrict :math:`T` to diagonal matrices.
+        fixed_shape: bool = False
+            If true, restrict :math:`T` to diagonal matrices with diagonal coefficients
+            :math:`[m, 1, 1]` (1d), :math:`[m, m, 1]` (2d), or :math:`[m, m, m]` (3d),
+            where the dimension is determined from `len(dirs)`.
+        n_threads: int = 1
+            Number of threads to use. If `n_threads <= 0`, all available hardware
+            threads are used. The result does not depend on `n_threads`.
+
+        Returns
+        -------
+        supercells: list[casmconfig.Supercell]
+            The :class:`~casmconfig.Supercell`, guaranteed to be in canonical
+            form. If :py:attr:`supercell_set` is not None, they are also added
+            to it.
+        """
+        supercells = enumerate_canonical_supercells(
+            prim=self.prim,
+            max_volume=max,
+            min_volume=min,
+            dirs=dirs,
+            unit_cell=unit_cell,
+            diagonal_only=diagonal_only,
+            fixed_shape=fixed_shape,
+            n_threads=n_threads,
+        )
+        if self.supercell_set is not None:
+            supercells = [
+                self.supercell_set.add_supercell(supercell).supercell
+                for supercell in supercells
+            ]
+        return supercells
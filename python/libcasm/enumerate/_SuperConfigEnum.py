@@ -4,14 +4,19 @@ import numpy as np
 
 from libcasm.configuration import (
     Configuration,
+    DistinctConfigurationFinder,
+    InvariantFingerprintCalculator,
+    MotifTilingMapCache,
     Prim,
     Supercell,
     SupercellSet,
     copy_configuration,
-    make_canonical_configuration,
     make_equivalent_supercells,
+    make_fixed_orientation_super_configurations,
 )
 
+from ._enumerate import EnumProgress
+from ._EnumShard import EnumShard
 from ._ScelEnum import ScelEnum
 
 
@@ -20,6 +25,8 @@ class SuperConfigEnum:
         self,
         prim: Prim,
         supercell_set: Optional[SupercellSet] = None,
+        progress: Optional[EnumProgress] = None,
+        tiling_map_cache: Optional[MotifTilingMapCache] = None,
     ):
         """
         .. rubric:: Constructor
@@ -31,9 +38,23 @@ class SuperConfigEnum:
         supercell_set: Optional[libcasm.configuration.SupercellSet] = None
             If not None, generated :class:`Supercell` are constructed by
             adding in the :class:`~SupercellSet`.
+        progress: Optional[libcasm.enumerate.EnumProgress] = None
+            If not None, the number of equivalent supercells checked is added to
+            the estimated total, each super configuration made is counted as
+            generated, and each distinct super configuration yielded is counted as
+            canonical and accepted, natively in `progress`, which reports through
+            its throttled callback.
+        tiling_map_cache: Optional[libcasm.configuration.MotifTilingMapCache] = None
+            If not None, the maps from supercell sites to motif sites used to make
+            super configurations are stored in `tiling_map_cache` and reused when
+            motif configurations with the same supercell fill the same supercell,
+            as when enumerating super configurations of many motifs.
         """
         self._prim = prim
         self._supercell_set = supercell_set
+        self._progress = progress
+        self._tiling_map_cache = tiling_map_cache
+        self._fingerprint_calculator = None
 
     @property
     def prim(self) -> Prim:
@@ -46,17 +67,43 @@ class SuperConfigEnum:
         adding in the :class:`~casmconfig.SupercellSet`."""
         return self._supercell_set
 
+    @property
+    def progress(self) -> Optional[EnumProgress]:
+        """If not None, enumeration progress is accumulated in `progress`."""
+        return self._progress
+
+    @property
+    def tiling_map_cache(self) -> Optional[MotifTilingMapCache]:
+        """If not None, maps from supercell sites to motif sites are stored in
+        and reused from `tiling_map_cache`."""
+        return self._tiling_map_cache
+
+    def _make_finder(self) -> DistinctConfigurationFinder:
+        """Make a DistinctConfigurationFinder, which only makes canonical super
+        configurations for super configurations with matching fingerprints"""
+        if self._fingerprint_calculator is None:
+            self._fingerprint_calculator = InvariantFingerprintCalculator(
+                prim=self.prim
+            )
+        return DistinctConfigurationFinder(
+            calculator=self._fingerprint_calculator,
+            in_canonical_supercell=True,
+        )
+
     def _one_supercell(
         self,
         motif: Configuration,
         supercell: Supercell,
-        super_configurations: list[Configuration],
-        canonical_super_configurations: list[Configuration],
+        finder: DistinctConfigurationFinder,
     ):
         """Yield super configurations of the motif in a single supercell, without
         changing the orientation of the motif, and without duplicating equivalent
         super configurations."""
-        for _equiv in make_equivalent_supercells(supercell):
+        progress = self._progress
+        equivalent_supercells = make_equivalent_supercells(supercell)
+        if progress is not None:
+            progress.add_total(len(equivalent_supercells))
+        for _equiv in equivalent_supercells:
             # If supercell_set is not None, add _equiv to the supercell set
             if self.supercell_set is not None:
                 record = self.supercell_set.add_supercell(_equiv)
@@ -69,14 +116,13 @@ class SuperConfigEnum:
             )
             if not is_superlat:
                 continue
-            super = copy_configuration(motif, equiv)
-            canonical_super = make_canonical_configuration(
-                configuration=super,
-                in_canonical_supercell=True,
-            )
-            if canonical_super not in canonical_super_configurations:
-                super_configurations.append(super)
-                canonical_super_configurations.append(canonical_super)
+            super = copy_configuration(motif, equiv, cache=self._tiling_map_cache)
+            if progress is not None:
+                progress.add_generated()
+            if finder.insert(super):
+                if progress is not None:
+                    progress.add_canonical()
+                    progress.add_accepted()
                 yield super.copy()
 
     def by_supercell(
@@ -88,6 +134,7 @@ class SuperConfigEnum:
         dirs: str = "abc",
         diagonal_only: bool = False,
         fixed_shape: bool = False,
+        shard: Optional[EnumShard] = None,
     ):
         """Make super configurations of the motif, without changing the orientation of
         the motif
@@ -98,9 +145,10 @@ class SuperConfigEnum:
           with respect to the prim factor group are generated.
         - If the motif tiles a supercell exactly, a super configuration is
           generated in that supercell.
-        - If the super configuration is unique, as determined by checking a running
-          list of canonical super configurations in the canonical supercell, then it
-          is yielded.
+        - If the super configuration is unique, as determined by a
+          :class:`~libcasm.configuration.DistinctConfigurationFinder` that compares
+          canonical super configurations in the canonical supercell only when
+          fingerprints match, then it is yielded.
 
         Parameters
         ----------
@@ -126,6 +174,11 @@ class SuperConfigEnum:
             If true, restrict :math:`T` to diagonal matrices with diagonal coefficients
             :math:`[m, 1, 1]` (1d), :math:`[m, m, 1]` (2d), or :math:`[m, m, m]` (3d),
             where the dimension is determined from `len(dirs)`.
+        shard: Optional[EnumShard] = None
+            If not None, only super configurations generated from the supercells
+            owned by `shard`, as determined by
+            :func:`EnumShard.owns_supercell <libcasm.enumerate.EnumShard.owns_supercell>`
+            for each supercell generated by `ScelEnum.by_volume`, are yielded.
 
         Yields
         ------
@@ -153,13 +206,13 @@ class SuperConfigEnum:
             diagonal_only=diagonal_only,
             fixed_shape=fixed_shape,
         ):
-            super_configurations = []
-            canonical_super_configurations = []
+            if shard is not None and not shard.owns_supercell(supercell):
+                continue
+            finder = self._make_finder()
             for config in self._one_supercell(
                 motif=motif,
                 supercell=supercell,
-                super_configurations=super_configurations,
-                canonical_super_configurations=canonical_super_configurations,
+                finder=finder,
             ):
                 yield config
 
@@ -167,6 +220,8 @@ class SuperConfigEnum:
         self,
         motif: Configuration,
         supercells: list[Supercell],
+        shard: Optional[EnumShard] = None,
+        n_threads: int = 1,
     ):
         """Make super configurations of the motif, without changing the orientation of
         the motif
@@ -177,9 +232,10 @@ class SuperConfigEnum:
           factor group are generated.
         - If the motif tiles a supercell exactly, a super configuration is
           generated in that supercell.
-        - If the super configuration is unique, as determined by checking a running
-          list of canonical super configurations in the canonical supercell, then it
-          is yielded.
+        - If the super configuration is unique, as determined by a
+          :class:`~libcasm.configuration.DistinctConfigurationFinder` that compares
+          canonical super configurations in the canonical supercell only when
+          fingerprints match, then it is yielded.
 
         Parameters
         ----------
@@ -191,6 +247,21 @@ class SuperConfigEnum:
 
             If `self.supercell_set` is not None, the generated equivalent supercells
             are added to the supercell set.
+        shard: Optional[EnumShard] = None
+            If not None, only super configurations generated from the supercells in
+            `supercells` owned by `shard`, as determined by
+            :func:`EnumShard.owns_supercell <libcasm.enumerate.EnumShard.owns_supercell>`,
+            are yielded. Equivalent super configurations are only skipped within a
+            shard, so super configurations from different shards should be made
+            canonical before merging.
+        n_threads: int = 1
+            If not 1, super configurations are made using
+            :func:`~libcasm.configuration.make_fixed_orientation_super_configurations`,
+            which constructs equivalent supercells, makes super configurations, and
+            calculates their fingerprints in parallel, with `n_threads` threads. If
+            `n_threads <= 0`, all available hardware threads are used. All super
+            configurations are made before the first is yielded. The super
+            configurations yielded do not depend on `n_threads`.
 
         Yields
         ------
@@ -198,13 +269,31 @@ class SuperConfigEnum:
             A :class:`~casmconfig.Configuration`. Configurations might not be in the
             canonical supercell.
         """
-        super_configurations = []
-        canonical_super_configurations = []
+        finder = self._make_finder()
+        if n_threads != 1:
+            if shard is not None:
+                supercells = [x for x in supercells if shard.owns_supercell(x)]
+            configs = make_fixed_orientation_super_configurations(
+                motif=motif,
+                supercells=supercells,
+                finder=finder,
+                supercell_set=self.supercell_set,
+                n_threads=n_threads,
+            )
+            if self._progress is not None:
+                self._progress.add_total(len(configs))
+                self._progress.add_generated(len(configs))
+                self._progress.add_canonical(len(configs))
+                self._progress.add_accepted(len(configs))
+            for config in configs:
+                yield config
+            return
         for supercell in supercells:
+            if shard is not None and not shard.owns_supercell(supercell):
+                continue
             for config in self._one_supercell(
                 motif=motif,
                 supercell=supercell,
-                super_configurations=super_configurations,
-                canonical_super_configurations=canonical_super_configurations,
+                finder=finder,
             ):
                 yield config
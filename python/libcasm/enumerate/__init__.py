@@ -16,13 +16,47 @@ from ._ConfigEnumMeshGrid import (
     irreducible_wedge_points,
     meshgrid_points,
 )
+from ._EnumCheckpoint import (
+    EnumCheckpoint,
+)
+from ._EnumShard import (
+    EnumShard,
+    merge_configuration_sets,
+)
 from ._enumerate import (
+    ConfigEnumAllOccupationsBase,
+    ConfigEnumCanonicalOccupationsBase,
+    ConfigEnumLocalOccupationsEngine,
+    DistinctOccupationSampler,
+    EnumProgress,
+    EnumProgressStatus,
+    MeshGridPointEnumerator,
+    OccupationFilter,
+    OrbitsAsIndices,
+    PointDefectSuperlatticeScore,
+    SupercellImpactTable,
+    count_distinct_occupations,
+    enumerate_canonical_supercells,
+    enumerate_canonical_transformation_matrices,
+    find_pareto_point_defect_superlattices,
     get_occevent_coordinate,
     make_distinct_cluster_sites,
     make_distinct_local_cluster_sites,
     make_distinct_local_perturbations,
+    make_distinct_occupations,
+    make_equivalent_supercells_with_required_operations,
+    make_flower_impact_table,
+    make_local_impact_table,
+    make_local_orbits_index_table,
     make_occevent_simple_structures,
+    make_occevent_site_index_table,
+    make_occevent_structure_coords,
     make_phenomenal_occevent,
+    make_point_defect_pareto_indices,
+    make_point_defect_superlattice_scores,
+    make_suborbit_generating_ops,
+    superlattice_has_required_operations,
+    superlattice_has_required_sites,
 )
 from ._make_distinct_super_configurations import (
     make_distinct_super_configurations,
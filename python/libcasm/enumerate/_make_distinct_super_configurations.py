@@ -10,6 +10,7 @@ def make_distinct_super_configurations(
     supercell: casmconfig.Supercell,
     fix: str = "supercell",
     supercell_set: Optional[casmconfig.SupercellSet] = None,
+    n_threads: int = 1,
 ) -> list[casmconfig.Configuration]:
     """
     Make configurations that fill a supercell and are equivalent with respect to the
@@ -30,6 +31,10 @@ def make_distinct_super_configurations(
     supercell_set: Optional[libcasm.configuration.SupercellSet] = None
         If not None, generated :class:`Supercell` are constructed by
         adding in the :class:`~SupercellSet`.
+    n_threads: int = 1
+        Number of threads used if `fix` is "motif", as by
+        :func:`SuperConfigEnum.by_supercell_list
+        <libcasm.enumerate.SuperConfigEnum.by_supercell_list>`.
 
     Returns
     -------
@@ -51,6 +56,7 @@ def make_distinct_super_configurations(
         for config in super_config_enum.by_supercell_list(
             motif=motif,
             supercells=[supercell],
+            n_threads=n_threads,
         ):
             super_backgrounds.append(config)
         return super_backgrounds
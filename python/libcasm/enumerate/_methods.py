@@ -11,6 +11,7 @@ def make_all_distinct_periodic_perturbations(
     supercell: libcasm.configuration.Supercell,
     motif: libcasm.configuration.Configuration,
     clusters: list[libcasm.clusterography.Cluster],
+    n_threads: int = 1,
 ) -> list[libcasm.configuration.Configuration]:
     r"""
     Construct distinct local perturbations of a configuration
@@ -56,6 +57,13 @@ def make_all_distinct_periodic_perturbations(
         the clusters that are distinct taking the motif and supercell into
         account are perturbed with each possible occupation.
 
+    n_threads: int = 1
+        The number of threads used to find the distinct clusters in each
+        distinct background configuration, and then to enumerate occupations on
+        each of them. Threads take (background, cluster) pairs in turn, largest
+        first. If ``n_threads <= 0``, use the number of hardware threads. The
+        result does not depend on the number of threads.
+
     Returns
     -------
     configurations : list[~libcasm.configuration.Configuration]
@@ -63,7 +71,7 @@ def make_all_distinct_periodic_perturbations(
         in the supercell, on the specified clusters.
     """
     return _enumerate.make_all_distinct_periodic_perturbations(
-        supercell, motif, clusters
+        supercell, motif, clusters, n_threads
     )
 
 
@@ -72,6 +80,7 @@ def make_all_distinct_local_perturbations(
     occ_event: libcasm.occ_events.OccEvent,
     motif: libcasm.configuration.Configuration,
     local_clusters: list[libcasm.clusterography.Cluster],
+    n_threads: int = 1,
 ) -> list[libcasm.configuration.Configuration]:
     r"""
     Construct distinct local perturbations of a configuration
@@ -133,6 +142,12 @@ def make_all_distinct_local_perturbations(
         taking the background configuration and supercell into account are
         perturbed with each possible occupation.
 
+    n_threads: int = 1
+        The number of threads used to find the distinct local-clusters in each
+        distinct background configuration, and then to enumerate occupations on
+        each of them. If ``n_threads <= 0``, use the number of hardware threads.
+        The result does not depend on the number of threads.
+
     Returns
     -------
     configurations : list[~libcasm.configuration.Configuration]
@@ -143,7 +158,7 @@ def make_all_distinct_local_perturbations(
 
     """
     return _enumerate.make_all_distinct_local_perturbations(
-        supercell, occ_event, motif, local_clusters
+        supercell, occ_event, motif, local_clusters, n_threads
     )
 
 
@@ -1,4 +1,3 @@
-import math
 import sys
 from typing import Optional
 
@@ -41,73 +40,6 @@ def _format_figure(
     p.yaxis.major_label_text_font_size = font_size_2
 
 
-def _make_pareto(
-    n_unitcells: list[int],
-    voronoi_inner_radius: list[float],
-    has_required_sites: list[bool],
-    has_all_motif_operations: list[bool],
-):
-    # Find pareto (n_unitcells, dist),
-    # restricted to has_required_sites==True and has_all_motif_operations==True
-    pareto = []
-    n_points = len(n_unitcells)
-    tol = 1e-5
-    for i in range(n_points):
-        if not has_required_sites[i]:
-            continue
-        if not has_all_motif_operations[i]:
-            continue
-
-        point_set = []
-        for j in range(n_points):
-            if n_unitcells[i] >= n_unitcells[j]:
-                point_set.append(j)
-        is_max = True
-        for j in point_set:
-            if j == i:
-                continue
-            if n_unitcells[i] == n_unitcells[j] and math.isclose(
-                voronoi_inner_radius[i], voronoi_inner_radius[j], abs_tol=tol
-            ):
-                continue
-            if voronoi_inner_radius[i] < voronoi_inner_radius[j] + tol:
-                is_max = False
-                break
-        if is_max:
-            pareto.append(i)
-    return pareto
-
-
-def _score_point_defect_supercell(supercell: casmconfig.Supercell):
-    """Return a score for ranking supercells for point defect calculations.
-
-    The score is `(supercell_factor_group_size, -n_unitcells, voronoi_inner_radius).`
-    This metric tends to prefer high symmetry, small, compact supercells as the "base"
-    supercell, which can then be multiplied by a scaling factor to make a larger
-    supercell that point defect calculations can be performed in.
-
-    Parameters
-    ----------
-    supercell: casmconfig.Supercell
-        The supercell being scored.
-
-    Returns
-    -------
-    supercell_factor_group_size: int
-        The supercell factor group size
-    negative_n_unitcells: int
-        The negative of the number of unit cells.
-    voronoi_inner_radius: float
-        The superlattice voronoi inner radius distance, which is the minimum
-        defect periodic image distance.
-
-    """
-    scel_fg_size = len(supercell.factor_group.elements)
-    n_unitcells = supercell.n_unitcells
-    voronoi_inner_radius = supercell.superlattice.voronoi_inner_radius()
-    return (scel_fg_size, -n_unitcells, voronoi_inner_radius)
-
-
 def make_required_sites(
     phenomenal_clusters: list[casmclust.Cluster],
     local_orbits: list[list[list[casmclust.Cluster]]],
@@ -175,47 +107,11 @@ def has_required_sites(
         False.
 
     """
-    for _required_sites in required_sites:
-        site_indices = set()
-        for site in _required_sites:
-            site_indices.add(supercell.linear_site_index(site))
-        if len(site_indices) != len(_required_sites):
-            return False
-    return True
-
-
-def make_equivalent_supercells_with_required_operations(
-    supercell: casmconfig.Supercell,
-    required_operations: list[int],
-    supercell_set: Optional[casmconfig.SupercellSet] = None,
-) -> list[casmconfig.Supercell]:
-    """Make equivalent supercells with required operations.
-
-    Parameters
-    ----------
-    supercell: casmconfig.Supercell
-        The initial supercell.
-    required_operations: set[int]
-        The indices of prim factor group operations that are required in the
-        in supercell factor group.
-    supercell_set: Optional[casmconfig.SupercellSet] = None
-            If not None, generated :class:`~casmconfig.Supercell` are constructed by
-            adding in the :class:`~casmconfig.SupercellSet`.
-
-    Returns
-    -------
-    matching: list[casmconfig.Supercell]
-        Equivalent supercells to `supercell` with the required operations.
-    """
-    candidates = casmconfig.make_equivalent_supercells(supercell)
-    matching = []
-    for candidate in candidates:
-        operations = set(candidate.factor_group.head_group_index)
-        if required_operations.issubset(operations):
-            if supercell_set is not None:
-                supercell_set.add(candidate)
-            matching.append(candidate)
-    return matching
+    return casmenum.superlattice_has_required_sites(
+        prim=supercell.prim,
+        transformation_matrix_to_super=supercell.transformation_matrix_to_super,
+        required_sites=required_sites,
+    )
 
 
 def make_supercells_for_point_defects(
@@ -226,6 +122,7 @@ def make_supercells_for_point_defects(
     base_min_factor_group_size: Optional[int] = None,
     required_sites: Optional[list[list[xtal.IntegralSiteCoordinate]]] = None,
     supercell_set: Optional[casmconfig.SupercellSet] = None,
+    n_threads: int = 1,
 ):
     """Find the best supercells for point defect calculations which can be filled by a
     particular motif configuration.
@@ -254,6 +151,11 @@ def make_supercells_for_point_defects(
     supercell_set: Optional[casmconfig.SupercellSet] = None
             If not None, generated :class:`~casmconfig.Supercell` are constructed by
             adding in the :class:`~casmconfig.SupercellSet`.
+    n_threads: int = 1
+        Number of threads used to enumerate and score unit cells, using
+        :func:`~libcasm.enumerate.make_point_defect_superlattice_scores`. If
+        `n_threads <= 0`, all available hardware threads are used. The result does
+        not depend on `n_threads`.
 
     Returns
     -------
@@ -272,40 +174,50 @@ def make_supercells_for_point_defects(
 
     """
     prim = motif.supercell.prim
-    scel_enum = casmenum.ScelEnum(prim=prim)
 
     # Get all prim factor group operations in the motif invariant group
     required_operations = set()
     for op in casmconfig.make_invariant_subgroup(motif):
         required_operations.add(op.prim_factor_group_index())
 
-    # Generate candidate unit cells
-    candidate_unit_cells = []
-    for supercell in scel_enum.by_volume(min=1, max=base_max_volume):
-        score = _score_point_defect_supercell(supercell)
-        if (
-            base_min_factor_group_size is not None
-            and score[0] < base_min_factor_group_size
-        ):
-            continue
-        candidate_unit_cells.append((supercell, score))
+    # Generate and score candidate unit cells, from lattice data only
+    candidate_unit_cells = casmenum.make_point_defect_superlattice_scores(
+        prim=prim,
+        transformation_matrices=casmenum.enumerate_canonical_transformation_matrices(
+            prim=prim,
+            max_volume=base_max_volume,
+            n_threads=n_threads,
+        ),
+        min_factor_group_size=(
+            0 if base_min_factor_group_size is None else base_min_factor_group_size
+        ),
+        n_threads=n_threads,
+    )
 
     # Sort candidate unit cells by score:
     # (factor_group_size, -n_unitcells, voronoi_inner_radius)
-    candidate_unit_cells.sort(key=lambda x: x[1], reverse=True)
+    candidate_unit_cells.sort(
+        key=lambda x: (x.factor_group_size, -x.n_unitcells, x.voronoi_inner_radius),
+        reverse=True,
+    )
 
     # Generate the candidate supercells
     candidate_supercells = {}
-    for candidate, score in candidate_unit_cells:
+    for score in candidate_unit_cells:
+        candidate = None
         m = 0
-        T1 = candidate.transformation_matrix_to_super
+        T1 = score.transformation_matrix_to_super
         while True:
             m += 1
-            supercell = casmconfig.Supercell(prim, T1 * m)
 
-            if supercell.n_unitcells > max_volume:
+            # the volume is known without constructing the supercell
+            n_unitcells = score.n_unitcells * m**3
+            if n_unitcells > max_volume:
                 break
-            if supercell.n_unitcells < min_volume or supercell in candidate_supercells:
+            if n_unitcells < min_volume:
+                continue
+            supercell = casmconfig.Supercell(prim, T1 * m)
+            if supercell in candidate_supercells:
                 continue
 
             # Check if motif can tile the supercell
@@ -318,11 +230,14 @@ def make_supercells_for_point_defects(
                 continue
 
             # Check if at least one equivalent supercell has all required operations
-            matching = make_equivalent_supercells_with_required_operations(
+            matching = casmenum.make_equivalent_supercells_with_required_operations(
                 supercell=supercell,
-                required_operations=required_operations,
-                supercell_set=supercell_set,
+                required_operations=sorted(required_operations),
+                n_threads=n_threads,
             )
+            if supercell_set is not None:
+                for x in matching:
+                    supercell_set.add(x)
             has_all_motif_operations = len(matching) > 0
 
             if has_all_motif_operations:
@@ -333,6 +248,8 @@ def make_supercells_for_point_defects(
             # All filters passed: include supercell
             if supercell_set is not None:
                 supercell_set.add(key)
+            if candidate is None:
+                candidate = casmconfig.Supercell(prim, T1)
             candidate_supercells[key] = dict(
                 unitcell=candidate,
                 unitcell_name=casmconfig.SupercellRecord(candidate).supercell_name,
@@ -490,9 +407,14 @@ def find_optimal_point_defect_supercells(
     has_required_sites = [value["has_required_sites"] for value in values]
     has_all_motif_operations = [value["has_all_motif_operations"] for value in values]
 
-    # Find pareto (n_unitcells, dist)
-    pareto = _make_pareto(
-        n_unitcells, voronoi_inner_radius, has_required_sites, has_all_motif_operations
+    # Find pareto (n_unitcells, dist),
+    # restricted to has_required_sites==True and has_all_motif_operations==True
+    pareto = casmenum.make_point_defect_pareto_indices(
+        n_unitcells=n_unitcells,
+        voronoi_inner_radius=voronoi_inner_radius,
+        is_candidate=[
+            a and b for a, b in zip(has_required_sites, has_all_motif_operations)
+        ],
     )
 
     return sorted(
@@ -1,9 +1,13 @@
 """Irreducible space decompositions"""
 from ._irreps import (
     IrrepDecomposition,
+    IrrepDecompositionCache,
     IrrepInfo,
     IrrepWedge,
     MatrixRepGroup,
     SubWedge,
     VectorSpaceSymReport,
+    VectorSymmetrizer,
+    make_group_average_symmetrizer,
+    make_irrep_projector,
 )
@@ -1,12 +1,19 @@
+import bisect
 import copy
 from functools import total_ordering
-from typing import Optional
+from typing import Iterable, Optional
 
 import libcasm.clusterography as casmclust
 import libcasm.configuration as casmconfig
 import libcasm.occ_events as occ_events
 import libcasm.xtal as xtal
 
+from ._local_configuration import (
+    _local_configuration_hash,
+    _local_configurations_from_bytes,
+    _local_configurations_to_bytes,
+    _make_canonical_local_configurations_about_events,
+)
 from ._OccEventPrimSymInfo import OccEventPrimSymInfo
 from ._OccEventSupercellSymInfo import (
     OccEventSupercellSymInfo,
@@ -473,6 +480,12 @@ class LocalConfigurationList:
     - `del local_config_list[i]`: Delete the i-th LocalConfiguration
     - `for lc in local_config_list`: Iterate over the LocalConfigurations
 
+    Membership checks and :func:`LocalConfigurationList.index` use a hash of
+    each LocalConfiguration's `pos` and `configuration`, so they only compare
+    against LocalConfiguration with the same hash instead of searching the whole
+    list. LocalConfiguration should not be modified in place while they are in
+    the list.
+
     """
 
     def __init__(
@@ -515,6 +528,31 @@ class LocalConfigurationList:
         self._local_configurations = local_configurations
         """list[LocalConfiguration]: The list of local configurations."""
 
+        self._index = None
+        """Optional[dict[int, list[int]]]: Hash of LocalConfiguration -> sorted
+        indices into `_local_configurations`; built on first use, and reset when
+        indices shift."""
+
+    @staticmethod
+    def _hash(value):
+        return _local_configuration_hash(value.configuration, value.pos)
+
+    def _get_index(self):
+        """Return the hash index, building it if necessary"""
+        if self._index is None:
+            index = dict()
+            for i, x in enumerate(self._local_configurations):
+                index.setdefault(self._hash(x), []).append(i)
+            self._index = index
+        return self._index
+
+    def _find(self, value):
+        """Return the index of the first equal LocalConfiguration, or -1"""
+        for i in self._get_index().get(self._hash(value), []):
+            if self._local_configurations[i] == value:
+                return i
+        return -1
+
     def _check_value(self, value):
         """Check insertion value
 
@@ -562,7 +600,7 @@ class LocalConfigurationList:
 
     def __contains__(self, value):
         value = self._check_value(value)
-        return value in self._local_configurations
+        return self._find(value) != -1
 
     def __len__(self):
         return len(self._local_configurations)
@@ -572,10 +610,18 @@ class LocalConfigurationList:
 
     def __setitem__(self, i, value):
         value = self._check_value(value)
+        if self._index is not None and isinstance(i, int):
+            i = range(len(self._local_configurations))[i]
+            old_indices = self._index[self._hash(self._local_configurations[i])]
+            old_indices.remove(i)
+            bisect.insort(self._index.setdefault(self._hash(value), []), i)
+        else:
+            self._index = None
         self._local_configurations[i] = value
 
     def __delitem__(self, i):
         del self._local_configurations[i]
+        self._index = None
 
     def __iter__(self):
         return iter(self._local_configurations)
@@ -590,11 +636,62 @@ class LocalConfigurationList:
         """
 
         value = self._check_value(value)
+        if self._index is not None:
+            self._index.setdefault(self._hash(value), []).append(
+                len(self._local_configurations)
+            )
         self._local_configurations.append(value)
 
+    def extend(
+        self,
+        values: Iterable[LocalConfiguration],
+        make_canonical: bool = False,
+        in_canonical_pos: bool = True,
+        apply_event_occupation: bool = True,
+        unique: bool = False,
+        n_threads: int = 1,
+    ):
+        """Append many LocalConfiguration to the list
+
+        Parameters
+        ----------
+        values : Iterable[libcasm.enumerate.LocalConfiguration]
+            The values to append to the list, in order.
+        make_canonical: bool = False
+            If True, append the canonical forms of `values`, as by
+            :func:`make_canonical_local_configurations`, using
+            `in_canonical_pos`, `apply_event_occupation`, and `n_threads`.
+        in_canonical_pos: bool = True
+            Passed to :func:`make_canonical_local_configurations`, if
+            `make_canonical` is True.
+        apply_event_occupation: bool = True
+            Passed to :func:`make_canonical_local_configurations`, if
+            `make_canonical` is True.
+        unique: bool = False
+            If True, skip values equal to a LocalConfiguration already in the list,
+            including values appended earlier in the same call.
+        n_threads: int = 1
+            Number of threads used to make canonical forms. If `n_threads <= 0`,
+            use the number of hardware threads. The result does not depend on
+            `n_threads`.
+        """
+        values = [self._check_value(x) for x in values]
+        if make_canonical:
+            values = make_canonical_local_configurations(
+                values,
+                in_canonical_pos=in_canonical_pos,
+                apply_event_occupation=apply_event_occupation,
+                n_threads=n_threads,
+            )
+        for value in values:
+            if unique and value in self:
+                continue
+            self.append(value)
+
     def sort(self):
         """Sort the list of LocalConfigurations in place."""
         self._local_configurations.sort()
+        self._index = None
 
     def index(self, value):
         """Find the index of an equivalent LocalConfiguration in the list.
@@ -612,11 +709,15 @@ class LocalConfigurationList:
         """
 
         value = self._check_value(value)
-        return self._local_configurations.index(value)
+        i = self._find(value)
+        if i == -1:
+            raise ValueError("LocalConfiguration is not in the list")
+        return i
 
     def clear(self):
         """Remove all LocalConfigurations from the list."""
         self._local_configurations.clear()
+        self._index = None
 
     def copy(self):
         """Return a copy of the LocalConfigurationList.
@@ -656,6 +757,61 @@ class LocalConfigurationList:
             "local_configurations": [lc.to_dict() for lc in self._local_configurations],
         }
 
+    def to_bytes(self):
+        """Represent the local configurations in a compact binary format
+
+        The `event_info` is not included; it can be stored separately using
+        `event_info.to_data()`.
+
+        Returns
+        -------
+        data : bytes
+            The event positions and configurations, in list order, in the binary
+            local configuration list format.
+        """
+        return _local_configurations_to_bytes(
+            [lc.configuration for lc in self._local_configurations],
+            [lc.pos for lc in self._local_configurations],
+        )
+
+    @staticmethod
+    def from_bytes(
+        data: bytes,
+        event_info: OccEventSymInfo,
+        supercells: casmconfig.SupercellSet,
+    ):
+        """Construct a LocalConfigurationList from the binary format
+
+        Parameters
+        ----------
+        data : bytes
+            The local configurations, as from
+            :func:`LocalConfigurationList.to_bytes`.
+        event_info: OccEventSymInfo
+            Information about the OccEvent, which defines the meaning of the
+            `pos` attribute, as used when writing `data`.
+        supercells : libcasm.configuration.SupercellSet
+            A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+            supercells in order to avoid duplicates.
+
+        Returns
+        -------
+        local_config_list : LocalConfigurationList
+            The LocalConfigurationList.
+        """
+        configurations, pos = _local_configurations_from_bytes(data, supercells)
+        return LocalConfigurationList(
+            event_info=event_info,
+            local_configurations=[
+                LocalConfiguration(
+                    configuration=configuration,
+                    pos=tuple(_pos),
+                    event_info=event_info,
+                )
+                for configuration, _pos in zip(configurations, pos)
+            ],
+        )
+
     @staticmethod
     def from_dict(
         data: dict,
@@ -775,3 +931,79 @@ def make_canonical_local_configuration(
         configuration=_final_config,
         event_info=initial.event_info,
     )
+
+
+def make_canonical_local_configurations(
+    values: Iterable[LocalConfiguration],
+    in_canonical_pos: bool = True,
+    apply_event_occupation: bool = True,
+    n_threads: int = 1,
+):
+    """Make the canonical forms of many local configurations, in parallel
+
+    Gives the same results as :func:`make_canonical_local_configuration` with
+    `in_canonical_supercell=False`, but the event group operations are collected
+    once per distinct event position, and the canonical configurations are found
+    in parallel, without holding the GIL.
+
+    Parameters
+    ----------
+    values: Iterable[libcasm.enumerate.LocalConfiguration]
+        The initial LocalConfiguration to transform.
+    in_canonical_pos: bool = True
+        If True, transform each value to put its `pos` in the canonical position
+        in the supercell. Else, keep `pos` in its current position and only
+        transform the configuration.
+    apply_event_occupation: bool = True
+        If True, apply the occupation of the event to the configuration. If False,
+        maintain the current configuration occupation.
+    n_threads: int = 1
+        Number of threads to use. If `n_threads <= 0`, use the number of hardware
+        threads. The result does not depend on `n_threads`.
+
+    Returns
+    -------
+    final: list[libcasm.enumerate.LocalConfiguration]
+        The final LocalConfiguration after the transformation, in the order of
+        `values`.
+    """
+    values = list(values)
+    configurations = []
+    final_pos = []
+    event_index = []
+    events = []
+    event_groups = []
+    key_to_event_index = dict()
+    for value in values:
+        curr = value._event_supercell_info
+        if in_canonical_pos:
+            _pos = curr.canonical_pos(value.pos)
+            _configuration = curr.supercell_rep(value.pos, _pos) * value.configuration
+        else:
+            _pos = value.pos
+            _configuration = value.configuration
+        key = (id(curr), tuple(_pos))
+        if key not in key_to_event_index:
+            key_to_event_index[key] = len(events)
+            events.append(curr.event(_pos))
+            event_groups.append(curr.event_group_rep(_pos))
+        configurations.append(_configuration)
+        final_pos.append(_pos)
+        event_index.append(key_to_event_index[key])
+
+    canonical = _make_canonical_local_configurations_about_events(
+        configurations=configurations,
+        event_index=event_index,
+        events=events,
+        event_groups=event_groups,
+        apply_event_occupation=apply_event_occupation,
+        n_threads=n_threads,
+    )
+    return [
+        LocalConfiguration(
+            configuration=_configuration,
+            pos=_pos,
+            event_info=value.event_info,
+        )
+        for value, _configuration, _pos in zip(values, canonical, final_pos)
+    ]
@@ -4,6 +4,7 @@ from ._LocalConfiguration import (
     LocalConfigurationList,
     OccEventSymInfo,
     make_canonical_local_configuration,
+    make_canonical_local_configurations,
 )
 from ._methods import (
     make_equivalents_generators,
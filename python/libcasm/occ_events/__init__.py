@@ -18,4 +18,8 @@ from ._occ_events import (
     make_occevent_symgroup_rep,
     make_occevent_symgroup_rep_from_existing,
     make_prim_periodic_orbit,
+    occevent_orbits_from_bytes,
+    occevent_orbits_to_bytes,
+    occevents_from_bytes,
+    occevents_to_bytes,
 )
@@ -159,6 +159,7 @@ def make_canonical_prim_periodic_occevents(
     cluster_specs: clust.ClusterSpecs,
     occevent_counter_params: dict = {},
     custom_events: list[_occ_events.OccEvent] = [],
+    n_threads: int = 1,
 ) -> list[_occ_events.OccEvent]:
     """Enumerate symmetrically distinct OccEvent
 
@@ -229,9 +230,31 @@ def make_canonical_prim_periodic_occevents(
         - "print_state_info": Optional[bool] = False, Print information about the
           step-by-step state of the algorithm.
 
+        Filter by atom trajectories. These are checked on each trajectory as
+        trajectories are assigned, so that all events sharing a failing partial
+        assignment are skipped without being generated. Vacancy trajectories are
+        not constrained:
+
+        - "max_trajectory_length": Optional[float] = None, Skip events in which any
+          atom moves more than this Cartesian distance.
+        - "max_moving_atoms": Optional[int] = None, Skip events in which more than
+          this number of atoms change sites.
+        - "allowed_species_pairs": Optional[list[list[str]]] = None, Skip events in
+          which an atom moves to a different site, unless
+          ``[atom_name, chemical_name]``, with the name of the moving atom and the
+          name of the chemical initially on the destination site, is included.
+          For example, ``[["A", "Va"]]`` allows only "A" atoms hopping into vacant
+          sites.
+
     custom_events: list[~libcasm.clusterography.ClusterOrbitGenerator]=[]
           Specifies OccEvent that should be included in the results
           regardless of the other options.
+    n_threads: int = 1
+        Number of threads used to count OccEvent. Each thread counts OccEvent
+        on one cluster orbit prototype at a time, and results are merged in a
+        deterministic order, so the result does not depend on `n_threads`. If
+        `n_threads <= 0`, use the number of hardware threads. If
+        "print_state_info" is true, counting is serial.
 
     Returns
     -------
@@ -239,5 +262,5 @@ def make_canonical_prim_periodic_occevents(
         The resulting OccEvent
     """
     return _occ_events.make_canonical_prim_periodic_occevents(
-        system, cluster_specs, occevent_counter_params, custom_events
+        system, cluster_specs, occevent_counter_params, custom_events, n_threads
     )
@@ -75,10 +75,20 @@ clust::IntegralCluster make_cluster_from_list(
   return cluster;
 }
 
+/// \brief Copy orbits from sets to vectors
+std::vector<std::vector<clust::IntegralCluster>> orbits_to_list(
+    std::vector<std::set<clust::IntegralCluster>> const &_orbits) {
+  std::vector<std::vector<clust::IntegralCluster>> orbits;
+  for (Index i = 0; i < _orbits.size(); ++i) {
+    orbits.emplace_back(_orbits[i].begin(), _orbits[i].end());
+  }
+  return orbits;
+}
+
 /// \brief Make orbits of clusters, either periodic or local-cluster orbits,
 ///     based on the ClusterSpecs
 std::vector<std::vector<clust::IntegralCluster>> make_orbits(
-    clust::ClusterSpecs const &cluster_specs) {
+    clust::ClusterSpecs const &cluster_specs, Index n_threads = 1) {
   // construct
   std::vector<std::set<clust::IntegralCluster>> _orbits;
   if (cluster_specs.phenomenal.has_value()) {
@@ -98,15 +108,10 @@ std::vector<std::vector<clust::IntegralCluster>> make_orbits(
     _orbits = make_prim_periodic_orbits(
         cluster_specs.prim, generating_group_unitcellcoord_symgroup_rep,
         cluster_specs.site_filter, cluster_specs.max_length,
-        cluster_specs.custom_generators);
+        cluster_specs.custom_generators, n_threads);
   }
 
-  // copy
-  std::vector<std::vector<clust::IntegralCluster>> orbits;
-  for (Index i = 0; i < _orbits.size(); ++i) {
-    orbits.emplace_back(_orbits[i].begin(), _orbits[i].end());
-  }
-  return orbits;
+  return orbits_to_list(_orbits);
 }
 
 clust::ClusterSpecs make_custom_cluster_specs(
@@ -143,9 +148,12 @@ clust::ClusterSpecs make_custom_cluster_specs(
   _cluster_specs.include_phenomenal_sites = include_phenomenal_sites;
   _cluster_specs.cutoff_radius = cutoff_radius;
 
-  // make cluster orbits
-  std::vector<std::vector<clust::IntegralCluster>> orbits =
-      make_orbits(_cluster_specs);
+  // make cluster orbits; the GIL is re-acquired to call site_filter_f
+  std::vector<std::vector<clust::IntegralCluster>> orbits;
+  {
+    py::gil_scoped_release release;
+    orbits = make_orbits(_cluster_specs);
+  }
 
   // turn orbit prototypes in custom generators:
   std::vector<clust::IntegralClusterOrbitGenerator> final_custom_generators;
@@ -329,7 +337,8 @@ PYBIND11_MODULE(_clusterography, m) {
       .def(
           "sites",
           [](clust::IntegralCluster const &cluster) {
-            return cluster.elements();
+            return std::vector<xtal::UnitCellCoord>(cluster.begin(),
+                                                    cluster.end());
           },
           "Returns the cluster sites")
       .def("append", &append_site, "Append to cluster sites")
@@ -481,6 +490,17 @@ PYBIND11_MODULE(_clusterography, m) {
            [](clust::IntegralCluster const &self, py::dict) {
              return clust::IntegralCluster(self);
            })
+      .def(py::pickle(
+          [](clust::IntegralCluster const &self) {
+            std::vector<std::vector<Index>> list;
+            for (auto const &site : self.elements()) {
+              list.push_back(site_to_list(site));
+            }
+            return list;
+          },
+          [](std::vector<std::vector<Index>> const &list) {
+            return make_cluster_from_list(list);
+          }))
       .def("__repr__",
            [](clust::IntegralCluster const &self) {
              std::stringstream ss;
@@ -749,19 +769,27 @@ PYBIND11_MODULE(_clusterography, m) {
           "Return the `cutoff_radius` list")
       .def(
           "make_orbits",
-          [](clust::ClusterSpecs const &cluster_specs) {
-            return make_orbits(cluster_specs);
+          [](clust::ClusterSpecs const &cluster_specs, Index n_threads) {
+            return make_orbits(cluster_specs, n_threads);
           },
           R"pbdoc(
           Construct cluster orbits
 
+          Parameters
+          ----------
+          n_threads : int = 1
+              Number of threads used to generate periodic cluster orbits. If
+              ``n_threads <= 0``, use the number of hardware threads. The
+              resulting orbits do not depend on the number of threads.
+
           Returns
           -------
           orbits: list[list[Cluster]]
               A list of cluster orbits, `orbits[i]` is the i-th orbit. If a
               phenomenal cluster is included in the ClusterSpecs, the resulting
               orbits are local-cluster orbits, otherwise they are periodic.
-         )pbdoc")
+         )pbdoc",
+          py::arg("n_threads") = 1, py::call_guard<py::gil_scoped_release>())
       .def_static(
           "from_dict",
           [](const nlohmann::json &data,
@@ -835,6 +863,147 @@ PYBIND11_MODULE(_clusterography, m) {
         return ss.str();
       });
 
+  py::class_<clust::PrimPeriodicOrbitGenerator>(m, "PrimPeriodicOrbitGenerator",
+                                                R"pbdoc(
+      Generates periodic cluster orbits one branch at a time
+
+      Gives the same orbits as :func:`ClusterSpecs.make_orbits`, but branch
+      by branch on demand, so that `max_length` cutoffs can be chosen
+      adaptively. Adding a branch extends only the last branch, and
+      extending the cutoff of the last branch only generates the clusters
+      in the added range, so earlier branches are never regenerated.
+      )pbdoc")
+      .def(py::init([](clust::ClusterSpecs const &cluster_specs,
+                       Index n_threads) {
+             if (cluster_specs.phenomenal.has_value()) {
+               throw std::runtime_error(
+                   "Error constructing PrimPeriodicOrbitGenerator: "
+                   "cluster_specs has a phenomenal cluster");
+             }
+             if (cluster_specs.custom_generators.size()) {
+               throw std::runtime_error(
+                   "Error constructing PrimPeriodicOrbitGenerator: "
+                   "cluster_specs has custom generators");
+             }
+             auto generator =
+                 std::make_unique<clust::PrimPeriodicOrbitGenerator>(
+                     cluster_specs.prim,
+                     sym_info::make_unitcellcoord_symgroup_rep(
+                         cluster_specs.generating_group->element,
+                         *cluster_specs.prim),
+                     cluster_specs.site_filter, n_threads);
+             auto const &max_length = cluster_specs.max_length;
+             for (Index b = 1; b < max_length.size(); ++b) {
+               generator->add_branch(max_length[b]);
+             }
+             return generator;
+           }),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          cluster_specs : ClusterSpecs
+              Specifies the prim, generating group, and site filter. The
+              branches specified by `max_length` are generated at
+              construction. Must not have a phenomenal cluster or custom
+              generators.
+          n_threads : int = 1
+              Number of threads used to generate clusters and orbits. If
+              ``n_threads <= 0``, use the number of hardware threads. The
+              resulting orbits do not depend on the number of threads.
+          )pbdoc",
+           py::arg("cluster_specs"), py::arg("n_threads") = 1)
+      .def("n_branches", &clust::PrimPeriodicOrbitGenerator::n_branches,
+           "Number of branches generated, including the null cluster branch.")
+      .def("max_length", &clust::PrimPeriodicOrbitGenerator::max_length,
+           "The `max_length` of each branch generated, as for "
+           ":class:`ClusterSpecs`.")
+      .def(
+          "branch_orbits",
+          [](clust::PrimPeriodicOrbitGenerator const &self, Index branch) {
+            return orbits_to_list(self.branch_orbits(branch));
+          },
+          R"pbdoc(
+          Return the orbits of clusters of size `branch`
+
+          Returns
+          -------
+          orbits: list[list[Cluster]]
+              The cluster orbits of the branch.
+          )pbdoc",
+          py::arg("branch"))
+      .def(
+          "orbits",
+          [](clust::PrimPeriodicOrbitGenerator const &self) {
+            return orbits_to_list(self.orbits());
+          },
+          R"pbdoc(
+          Return the orbits of all branches generated
+
+          Returns
+          -------
+          orbits: list[list[Cluster]]
+              The cluster orbits, the same as from
+              :func:`ClusterSpecs.make_orbits` with
+              ``max_length=self.max_length()``.
+          )pbdoc")
+      .def(
+          "add_branch",
+          [](clust::PrimPeriodicOrbitGenerator &self, double max_length) {
+            std::vector<std::set<clust::IntegralCluster>> const *orbits;
+            {
+              py::gil_scoped_release release;
+              orbits = &self.add_branch(max_length);
+            }
+            return orbits_to_list(*orbits);
+          },
+          R"pbdoc(
+          Generate the next branch
+
+          Parameters
+          ----------
+          max_length : float = 0.0
+              The maximum site-to-site distance for clusters of the next
+              branch. Ignored for the point cluster branch.
+
+          Returns
+          -------
+          orbits: list[list[Cluster]]
+              The cluster orbits of the new branch.
+          )pbdoc",
+          py::arg("max_length") = 0.0)
+      .def(
+          "extend_cutoff",
+          [](clust::PrimPeriodicOrbitGenerator &self, double max_length) {
+            std::vector<std::set<clust::IntegralCluster>> const *orbits;
+            {
+              py::gil_scoped_release release;
+              orbits = &self.extend_cutoff(max_length);
+            }
+            return orbits_to_list(*orbits);
+          },
+          R"pbdoc(
+          Increase the `max_length` of the last branch
+
+          Clusters already generated are kept, and only clusters with max
+          site-to-site distance in the added range are generated. Only the
+          last branch, which must be the pair branch or higher, can be
+          extended.
+
+          Parameters
+          ----------
+          max_length : float
+              The new maximum site-to-site distance for clusters of the
+              last branch. Must not be less than the current value.
+
+          Returns
+          -------
+          orbits: list[list[Cluster]]
+              All cluster orbits of the last branch.
+          )pbdoc",
+          py::arg("max_length"));
+
   m.def("make_custom_cluster_specs", &make_custom_cluster_specs,
         R"pbdoc(
       Make a ClusterSpecs with entirely custom generators based on a custom
@@ -4,6 +4,10 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
 // nlohmann::json binding
 #define JSON_USE_IMPLICIT_CONVERSIONS 0
 #include "casm/casm_io/Log.hh"
@@ -12,22 +16,52 @@
 #include "casm/casm_io/json/jsonParser.hh"
 #include "casm/clexulator/ConfigDoFValuesTools_impl.hh"
 #include "casm/configuration/ConfigCompare.hh"
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/ConfigurationBatch.hh"
+#include "casm/configuration/ConfigurationDelta.hh"
+#include "casm/configuration/ConfigurationFingerprint.hh"
 #include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/DistinctSuperConfigurationMaker.hh"
+#include "casm/configuration/DoFSpaceRepCache.hh"
 #include "casm/configuration/FromStructure.hh"
+#include "casm/configuration/InvariantSubgroupEngine.hh"
+#include "casm/configuration/LocalSupercellSymGroupCache.hh"
+#include "casm/configuration/MotifTilingMap.hh"
 #include "casm/configuration/Prim.hh"
+#include "casm/configuration/PrimSymInfoCache.hh"
+#include "casm/configuration/PrimSymInfo.hh"
+#include "casm/configuration/PrimitiveConfigurationChecker.hh"
+#include "casm/configuration/SuperConfigurationGenerator.hh"
 #include "casm/configuration/Supercell.hh"
 #include "casm/configuration/SupercellSet.hh"
 #include "casm/configuration/SupercellSymInfo.hh"
 #include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/asymmetric_unit.hh"
 #include "casm/configuration/canonical_form.hh"
 #include "casm/configuration/config_space_analysis.hh"
 #include "casm/configuration/copy_configuration.hh"
 #include "casm/configuration/dof_space_analysis.hh"
+#include "casm/configuration/find_translations.hh"
+#include "casm/configuration/io/binary/ColumnarDataset.hh"
+#include "casm/configuration/io/binary/ConfigurationSetJournal.hh"
+#include "casm/configuration/io/binary/ConfigurationSetView.hh"
+#include "casm/configuration/io/binary/Configuration_binary_io.hh"
+#include "casm/configuration/io/binary/SupercellSymInfo_binary_io.hh"
+#include "casm/configuration/io/json/ConfigurationDelta_json_io.hh"
+#include "casm/configuration/io/json/ConfigurationJsonSax.hh"
 #include "casm/configuration/io/json/Configuration_json_io.hh"
+#include "casm/configuration/io/json/PrimSymInfo_json_io.hh"
 #include "casm/configuration/io/json/Supercell_json_io.hh"
 #include "casm/configuration/io/json/analysis_json_io.hh"
+#include "casm/configuration/io/json/memory_usage_json_io.hh"
+#include "casm/configuration/io/json/perf_json_io.hh"
+#include "casm/configuration/irreps/IrrepDecompositionCache.hh"
 #include "casm/configuration/irreps/VectorSpaceSymReport.hh"
 #include "casm/configuration/make_simple_structure.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/configuration/perf.hh"
+#include "casm/configuration/symmetrize_properties.hh"
+#include "casm/configuration/trace.hh"
 #include "casm/crystallography/SimpleStructure.hh"
 #include "casm/crystallography/SymInfo.hh"
 #include "casm/crystallography/UnitCellCoord.hh"
@@ -68,13 +102,25 @@ using namespace CASM;
 // Prim
 
 std::shared_ptr<config::Prim> make_prim(
-    std::shared_ptr<xtal::BasicStructure const> const &xtal_prim) {
-  std::shared_ptr<xtal::BasicStructure const> basicstructure(xtal_prim);
-  std::map<DoFKey, xtal::DoFSet> global_dof_info(
-      clexulator::make_global_dof_info(*basicstructure));
-  std::map<DoFKey, std::vector<xtal::SiteDoFSet>> local_dof_info(
-      clexulator::make_local_dof_info(*basicstructure));
-  config::PrimSymInfo sym_info(*basicstructure);
+    std::shared_ptr<xtal::BasicStructure const> const &xtal_prim,
+    std::shared_ptr<config::PrimSymInfoCache> sym_info_cache,
+    std::optional<std::vector<xtal::SymOp>> factor_group_elements) {
+  if (factor_group_elements.has_value()) {
+    if (sym_info_cache) {
+      throw std::runtime_error(
+          "Error in Prim constructor: sym_info_cache and "
+          "factor_group_elements may not both be given");
+    }
+    throw_if_equal_to_nullptr(xtal_prim,
+                              "Error in Prim constructor: xtal_prim is None");
+    return std::make_shared<config::Prim>(*factor_group_elements, xtal_prim);
+  }
+  if (sym_info_cache) {
+    throw_if_equal_to_nullptr(xtal_prim,
+                              "Error in Prim constructor: xtal_prim is None");
+    return std::make_shared<config::Prim>(*sym_info_cache->make(*xtal_prim),
+                                          xtal_prim);
+  }
   return std::make_shared<config::Prim>(xtal_prim);
 }
 
@@ -111,9 +157,13 @@ std::string prim_to_json(std::shared_ptr<config::Prim const> const &prim) {
 std::shared_ptr<config::Supercell> make_supercell(
     std::shared_ptr<config::Prim const> const &prim,
     Eigen::Matrix3l const &transformation_matrix_to_super,
-    Index max_n_translation_permutations) {
+    Index max_n_translation_permutations,
+    Index translation_permutation_cache_max_bytes,
+    Index combined_permutation_table_max_bytes) {
   return std::make_shared<config::Supercell>(
-      prim, transformation_matrix_to_super, max_n_translation_permutations);
+      prim, transformation_matrix_to_super, max_n_translation_permutations,
+      translation_permutation_cache_max_bytes,
+      combined_permutation_table_max_bytes);
 }
 
 // SupercellSymOp
@@ -178,6 +228,275 @@ inline Eigen::MatrixXd pretty(const Eigen::MatrixXd &M, double tol = 1e-10) {
   return Mp;
 }
 
+std::ofstream open_binary_output(std::string const &path) {
+  std::ofstream out(path, std::ios::binary);
+  if (!out) {
+    throw std::runtime_error("Error opening file for writing: " + path);
+  }
+  return out;
+}
+
+std::ifstream open_binary_input(std::string const &path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    throw std::runtime_error("Error opening file for reading: " + path);
+  }
+  return in;
+}
+
+/// \brief Writes configurations to a file in the binary configuration format
+struct ConfigurationBinaryFileWriter {
+  ConfigurationBinaryFileWriter(std::string const &path)
+      : out(open_binary_output(path)), writer(out) {}
+
+  std::ofstream out;
+  config::ConfigurationBinaryWriter writer;
+};
+
+/// \brief Reads configurations from a file in the binary configuration
+///     format, one record at a time
+struct ConfigurationBinaryFileReader {
+  ConfigurationBinaryFileReader(
+      std::string const &path,
+      std::shared_ptr<config::SupercellSet> const &_supercells)
+      : supercells(_supercells),
+        in(open_binary_input(path)),
+        reader(in, *supercells) {}
+
+  std::shared_ptr<config::SupercellSet> supercells;
+  std::ifstream in;
+  config::ConfigurationBinaryReader<config::ConfigurationWithProperties>
+      reader;
+};
+
+/// \brief Writes configurations to a file in the columnar dataset format
+struct ColumnarDatasetFileWriter {
+  ColumnarDatasetFileWriter(std::string const &path, Index batch_size)
+      : out(open_binary_output(path)), writer(out, batch_size) {}
+
+  std::ofstream out;
+  config::ColumnarDatasetWriter writer;
+};
+
+/// \brief Reads configurations from a file in the columnar dataset format,
+///     one batch at a time
+struct ColumnarDatasetFileReader {
+  ColumnarDatasetFileReader(
+      std::string const &path,
+      std::shared_ptr<config::SupercellSet> const &_supercells)
+      : supercells(_supercells),
+        in(open_binary_input(path)),
+        reader(in, *supercells) {}
+
+  std::shared_ptr<config::SupercellSet> supercells;
+  std::ifstream in;
+  config::ColumnarDatasetReader reader;
+};
+
+template <typename T>
+py::array_t<T> to_array(std::vector<T> const &values) {
+  return py::array_t<T>(values.size(), values.data());
+}
+
+py::dict columnar_properties_to_dict(
+    std::map<std::string, config::ColumnarProperty> const &properties) {
+  py::dict result;
+  for (auto const &pair : properties) {
+    auto const &property = pair.second;
+    py::dict value;
+    value["present"] = to_array(property.present).attr("astype")("bool");
+    value["rows"] = to_array(property.rows);
+    value["cols"] = to_array(property.cols);
+    value["offsets"] = to_array(property.offsets);
+    value["values"] = to_array(property.values);
+    result[py::str(pair.first)] = value;
+  }
+  return result;
+}
+
+/// \brief Represent a ColumnarBatch as a dict of numpy arrays, with one row
+///     per record
+py::dict columnar_batch_to_dict(config::ColumnarBatch const &batch) {
+  py::dict result;
+  result["n_sites"] = batch.n_sites;
+  result["record_index"] = to_array(batch.record_index);
+  result["supercell_index"] = to_array(batch.supercell_index);
+  result["occupation"] = Eigen::MatrixXi(batch.occupation.transpose());
+  py::dict global_dof_values;
+  for (auto const &pair : batch.global_dof_values) {
+    global_dof_values[py::str(pair.first)] =
+        Eigen::MatrixXd(pair.second.transpose());
+  }
+  result["global_dof_values"] = global_dof_values;
+  py::dict local_dof_values;
+  for (auto const &pair : batch.local_dof_values) {
+    local_dof_values[py::str(pair.first)] =
+        Eigen::MatrixXd(pair.second.transpose());
+  }
+  result["local_dof_values"] = local_dof_values;
+  result["local_dof_dim"] = batch.local_dof_dim;
+  result["local_properties"] =
+      columnar_properties_to_dict(batch.local_properties);
+  result["global_properties"] =
+      columnar_properties_to_dict(batch.global_properties);
+  return result;
+}
+
+/// \brief Wrap row-major batch storage as a numpy array, without copying
+///
+/// The array keeps `owner` alive, but is invalidated if the batch storage
+/// is reallocated.
+template <typename T>
+py::array_t<T> make_batch_array(T *data, std::vector<py::ssize_t> shape,
+                                std::vector<py::ssize_t> strides,
+                                py::object const &owner) {
+  for (auto &stride : strides) {
+    stride *= sizeof(T);
+  }
+  return py::array_t<T>(shape, strides, data, owner);
+}
+
+/// \brief Per-process registry used to unpickle prims and supercells
+///
+/// Unpickled prims are found by structure digest and factor group JSON, so
+/// each process constructs a prim and its symmetry representations once,
+/// however many pickled objects refer to it. Prims with the same structure
+/// but a different factor group, for example constructed with
+/// `factor_group_elements`, are kept separately. Pickled supercells are
+/// found through one SupercellSet per prim, so supercell symmetry
+/// representations are also constructed once per process. Only unpickled
+/// prims are registered, and they are kept for the life of the process.
+struct PickleRegistry {
+  std::mutex mutex;
+
+  /// Unpickled prims, by (structure digest, factor group JSON)
+  std::map<std::pair<std::string, std::string>,
+           std::shared_ptr<config::Prim const>>
+      prim;
+
+  /// Supercells, by prim
+  std::map<config::Prim const *, std::shared_ptr<config::SupercellSet>>
+      supercells;
+};
+
+PickleRegistry &pickle_registry() {
+  static PickleRegistry registry;
+  return registry;
+}
+
+/// \brief Return the registered prim with the given key, registering
+///     `prim` if there is none
+std::shared_ptr<config::Prim const> register_pickle_prim(
+    std::pair<std::string, std::string> const &key,
+    std::shared_ptr<config::Prim const> const &prim) {
+  auto &registry = pickle_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.prim.emplace(key, prim).first->second;
+}
+
+/// \brief Return the SupercellSet used to unpickle supercells of `prim`
+std::shared_ptr<config::SupercellSet> pickle_supercells(
+    std::shared_ptr<config::Prim const> const &prim) {
+  auto &registry = pickle_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto &supercells = registry.supercells[prim.get()];
+  if (!supercells) {
+    supercells = std::make_shared<config::SupercellSet>(prim);
+  }
+  return supercells;
+}
+
+std::string json_to_string(jsonParser const &json) {
+  std::stringstream ss;
+  ss << json;
+  return ss.str();
+}
+
+/// \brief Pickled Prim: (digest, prim JSON, lattice tolerance, factor
+///     group JSON)
+py::tuple prim_getstate(std::shared_ptr<config::Prim const> const &prim) {
+  xtal::BasicStructure const &structure = *prim->basicstructure;
+  std::string digest = config::make_prim_digest(structure);
+  jsonParser prim_json;
+  bool include_va = true;
+  write_prim(structure, prim_json, FRAC, include_va);
+  jsonParser sym_info_json;
+  to_json(prim->sym_info, sym_info_json, structure);
+  return py::make_tuple(digest, json_to_string(prim_json),
+                        structure.lattice().tol(),
+                        json_to_string(sym_info_json));
+}
+
+/// \brief Unpickle a Prim, using the registered prim with the same digest
+///     and factor group if there is one, else constructing it from the
+///     stored factor group
+std::shared_ptr<config::Prim> prim_setstate(py::tuple const &state) {
+  if (state.size() != 4) {
+    throw std::runtime_error("Error unpickling Prim: invalid state");
+  }
+  std::pair<std::string, std::string> key(state[0].cast<std::string>(),
+                                          state[3].cast<std::string>());
+  {
+    auto &registry = pickle_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto it = registry.prim.find(key);
+    if (it != registry.prim.end()) {
+      return std::const_pointer_cast<config::Prim>(it->second);
+    }
+  }
+  jsonParser prim_json = jsonParser::parse(state[1].cast<std::string>());
+  ParsingDictionary<AnisoValTraits> const *aniso_val_dict = nullptr;
+  auto structure = std::make_shared<xtal::BasicStructure const>(
+      read_prim(prim_json, state[2].cast<double>(), aniso_val_dict));
+  jsonParser sym_info_json = jsonParser::parse(key.second);
+  auto prim = std::make_shared<config::Prim const>(
+      jsonConstructor<config::PrimSymInfo>::from_json(sym_info_json,
+                                                      *structure),
+      structure);
+  return std::const_pointer_cast<config::Prim>(
+      register_pickle_prim(key, prim));
+}
+
+/// \brief Pickled Supercell: (prim, transformation_matrix_to_super)
+py::tuple supercell_getstate(
+    std::shared_ptr<config::Supercell const> const &supercell) {
+  return py::make_tuple(
+      std::const_pointer_cast<config::Prim>(supercell->prim),
+      supercell->superlattice.transformation_matrix_to_super());
+}
+
+/// \brief Unpickle a Supercell, shared with other unpickled objects
+std::shared_ptr<config::Supercell> supercell_setstate(py::tuple const &state) {
+  if (state.size() != 2) {
+    throw std::runtime_error("Error unpickling Supercell: invalid state");
+  }
+  auto prim = state[0].cast<std::shared_ptr<config::Prim>>();
+  auto T = state[1].cast<Eigen::Matrix3l>();
+  auto supercells = pickle_supercells(prim);
+  return std::const_pointer_cast<config::Supercell>(
+      supercells->insert(T).first->supercell);
+}
+
+/// \brief Pickled configuration: (prim, binary configuration format)
+template <typename ConfigurationType>
+py::tuple configuration_getstate(
+    std::shared_ptr<config::Prim const> const &prim,
+    ConfigurationType const &configuration) {
+  return py::make_tuple(std::const_pointer_cast<config::Prim>(prim),
+                        py::bytes(config::to_bytes(configuration)));
+}
+
+/// \brief Unpickle a Configuration or ConfigurationWithProperties
+template <typename ConfigurationType>
+ConfigurationType configuration_setstate(py::tuple const &state) {
+  if (state.size() != 2) {
+    throw std::runtime_error("Error unpickling configuration: invalid state");
+  }
+  auto prim = state[0].cast<std::shared_ptr<config::Prim>>();
+  return config::from_bytes<ConfigurationType>(
+      std::string{state[1].cast<py::bytes>()}, *pickle_supercells(prim));
+}
+
 }  // namespace CASMpy
 
 PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>);
@@ -202,6 +521,79 @@ PYBIND11_MODULE(_configuration, m) {
   py::module::import("libcasm.irreps");
   py::module::import("libcasm.sym_info");
 
+  py::class_<config::PrimSymInfoCache,
+             std::shared_ptr<config::PrimSymInfoCache>>(m, "PrimSymInfoCache",
+                                                        R"pbdoc(
+      Stores prim symmetry representations, keyed by the prim
+
+      A PrimSymInfoCache can be passed to the :class:`Prim` constructor so
+      that constructing a Prim again for the same :class:`libcasm.xtal.Prim`
+      reuses the factor group and symmetry representations instead of
+      repeating the factor group search.
+
+      Prims are compared by their JSON representation and lattice
+      tolerance. If `cache_dir` is given, the factor group of each new prim
+      is also written to ``<cache_dir>/<digest>.json``, so that it can be
+      read by caches in other sessions using the same directory. Symmetry
+      representations are constructed again from a factor group read from
+      disk.
+      )pbdoc")
+      .def(py::init([](std::optional<std::string> cache_dir) {
+             std::optional<fs::path> _cache_dir;
+             if (cache_dir.has_value()) {
+               _cache_dir = fs::path(*cache_dir);
+             }
+             return std::make_shared<config::PrimSymInfoCache>(_cache_dir);
+           }),
+           R"pbdoc(
+
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          cache_dir: Optional[str] = None
+              If given, the directory used to read and write factor groups.
+              It is created if it does not exist.
+          )pbdoc",
+           py::arg("cache_dir") = std::nullopt)
+      .def(
+          "cache_dir",
+          [](config::PrimSymInfoCache const &cache) {
+            std::optional<std::string> result;
+            if (cache.cache_dir().has_value()) {
+              result = cache.cache_dir()->string();
+            }
+            return result;
+          },
+          "Return the directory used to store factor groups, or None.")
+      .def("size", &config::PrimSymInfoCache::size,
+           "Return the number of prim symmetry representations stored in "
+           "memory.")
+      .def("clear", &config::PrimSymInfoCache::clear,
+           "Erase the prim symmetry representations stored in memory. Files "
+           "in the cache directory are not erased.");
+
+  m.def(
+      "make_prim_digest",
+      [](std::shared_ptr<xtal::BasicStructure const> const &xtal_prim) {
+        return config::make_prim_digest(*xtal_prim);
+      },
+      R"pbdoc(
+      Return the digest used by :class:`PrimSymInfoCache` as a key
+
+      Parameters
+      ----------
+      xtal_prim : libcasm.xtal.Prim
+          A :class:`libcasm.xtal.Prim`
+
+      Returns
+      -------
+      digest : str
+          A hexadecimal hash of the prim JSON representation and lattice
+          tolerance, which is the same in all sessions.
+      )pbdoc",
+      py::arg("xtal_prim"));
+
   py::class_<config::Prim, std::shared_ptr<config::Prim>>(m, "Prim", R"pbdoc(
       A data structure that includes a shared :class:`libcasm.xtal.Prim`
       specifying the parent crystal structure and allowed degrees of freedom
@@ -210,6 +602,8 @@ PYBIND11_MODULE(_configuration, m) {
 
       )pbdoc")
       .def(py::init(&make_prim), py::arg("xtal_prim"),
+           py::arg("sym_info_cache") = nullptr,
+           py::arg("factor_group_elements") = std::nullopt,
            R"pbdoc(
 
       .. rubric:: Constructor
@@ -218,6 +612,17 @@ PYBIND11_MODULE(_configuration, m) {
       ----------
       xtal_prim : libcasm.xtal.Prim
           A :class:`libcasm.xtal.Prim`
+      sym_info_cache : Optional[PrimSymInfoCache] = None
+          If given, the factor group and symmetry representations are taken
+          from the cache if available, and otherwise are calculated and
+          stored in the cache.
+      factor_group_elements : Optional[list[libcasm.xtal.SymOp]] = None
+          If given, use these factor group operations, in this order,
+          instead of finding the factor group of `xtal_prim`. This allows
+          restoring a factor group that was saved previously, for example
+          from the :py:attr:`Prim.factor_group` elements, without repeating
+          the factor group search, which is the most expensive part of
+          constructing a Prim. May not be combined with `sym_info_cache`.
       )pbdoc")
       .def_property_readonly(
           "xtal_prim",
@@ -495,6 +900,11 @@ PYBIND11_MODULE(_configuration, m) {
           R"pbdoc(
           Optional[str]: The discrete atomic magspin flavor if present, else None.
           )pbdoc")
+      .def(py::pickle(
+          [](std::shared_ptr<config::Prim> const &prim) {
+            return prim_getstate(prim);
+          },
+          [](py::tuple state) { return prim_setstate(state); }))
       .def_static(
           "from_dict",
           [](const nlohmann::json &data, double xtal_tol) {
@@ -910,6 +1320,10 @@ PYBIND11_MODULE(_configuration, m) {
       .def(py::init(&make_supercell), py::arg("prim"),
            py::arg("transformation_matrix_to_super").noconvert(),
            py::arg("max_n_translation_permutations") = 100,
+           py::arg("translation_permutation_cache_max_bytes") =
+               config::DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES,
+           py::arg("combined_permutation_table_max_bytes") =
+               config::DEFAULT_COMBINED_PERMUTATION_TABLE_MAX_BYTES,
            R"pbdoc(
 
       .. rubric:: Constructor
@@ -926,6 +1340,18 @@ PYBIND11_MODULE(_configuration, m) {
       max_n_translation_permutations : int = 100
           The complete set of translation permutations is not generated for
           large supercells with `n_unitcells` > `max_n_translation_permutations`.
+      translation_permutation_cache_max_bytes : int = 16777216
+          For large supercells, translation permutations are constructed as
+          needed and the most recently used are kept, shared by all
+          :class:`~libcasm.configuration.SupercellSymOp` in the supercell,
+          up to this total size in bytes. If 0, none are kept and
+          permuted site indices are computed directly.
+      combined_permutation_table_max_bytes : int = 16777216
+          If the combined site permutations of all supercell operations,
+          and their inverses, fit in this many bytes, they are stored when
+          first requested, as by
+          :func:`~libcasm.configuration.SupercellSymOp.combined_permute`,
+          and then reused. If 0, they are never stored.
       )pbdoc")
       .def_readonly("prim", &config::Supercell::prim,
                     R"pbdoc(
@@ -934,7 +1360,7 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def_property_readonly(
           "xtal_prim",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->prim->basicstructure;
           },
           R"pbdoc(
@@ -942,7 +1368,7 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def_property_readonly(
           "transformation_matrix_to_super",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->superlattice.transformation_matrix_to_super();
           },
           py::return_value_policy::reference_internal,
@@ -952,7 +1378,7 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def_property_readonly(
           "superlattice",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->superlattice.superlattice();
           },
           py::return_value_policy::reference_internal,
@@ -961,7 +1387,7 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def_property_readonly(
           "prim_lattice",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->superlattice.prim_lattice();
           },
           py::return_value_policy::reference_internal,
@@ -970,7 +1396,7 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def_property_readonly(
           "site_index_converter",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->unitcellcoord_index_converter;
           },
           py::return_value_policy::reference_internal,
@@ -980,7 +1406,7 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def_property_readonly(
           "unitcell_index_converter",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->unitcell_index_converter;
           },
           py::return_value_policy::reference_internal,
@@ -1086,7 +1512,7 @@ PYBIND11_MODULE(_configuration, m) {
           py::arg("transformation_matrix_to_super"))
       .def_property_readonly(
           "factor_group",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->sym_info.factor_group;
           },
           R"pbdoc(
@@ -1101,7 +1527,7 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def_property_readonly(
           "factor_group_permutations",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->sym_info.factor_group_permutations;
           },
           R"pbdoc(
@@ -1117,7 +1543,7 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def_property_readonly(
           "translation_permutations",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->sym_info.translation_permutations;
           },
           R"pbdoc(
@@ -1133,7 +1559,7 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def(
           "symgroup_rep",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             std::vector<config::SupercellSymOp> symgroup_rep;
             auto it = config::SupercellSymOp::begin(supercell);
             auto end = config::SupercellSymOp::end(supercell);
@@ -1171,13 +1597,19 @@ PYBIND11_MODULE(_configuration, m) {
           [](std::shared_ptr<config::Supercell const> const &supercell,
              std::shared_ptr<sym_info::SymGroup const> const
                  &local_prim_subgroup) {
-            return config::make_local_supercell_symgroup_rep(
-                local_prim_subgroup, supercell);
+            return config::local_supercell_symgroup_cache()
+                .get(local_prim_subgroup, supercell)
+                ->supercell_symgroup_rep;
           },
           R"pbdoc(
           Make SupercellSymOp group rep for local property symmetry in a
           supercell
 
+          Results are stored in a process-wide cache, with a memory budget,
+          keyed by the supercell and `local_prim_subgroup` objects, so
+          repeated calls with the same arguments do not construct the
+          SupercellSymOp again.
+
           Parameters
           ----------
           local_prim_subgroup : libcasm.sym_info.SymGroup
@@ -1193,19 +1625,19 @@ PYBIND11_MODULE(_configuration, m) {
           )pbdoc")
       .def_property_readonly(
           "n_sites",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->unitcellcoord_index_converter.total_sites();
           },
           "int: The number of sites in the supercell.")
       .def_property_readonly(
           "n_unitcells",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             return supercell->unitcell_index_converter.total_sites();
           },
           "int: The number of unit cells in the supercell.")
       .def(
           "n_occupants",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             std::vector<Index> n_occupants;
             auto const &converter = supercell->unitcellcoord_index_converter;
             auto const &xtal_prim = supercell->prim->basicstructure;
@@ -1221,7 +1653,7 @@ PYBIND11_MODULE(_configuration, m) {
           "occupants allowed on site `l`.")
       .def(
           "occ_dof",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             std::vector<std::vector<std::string>> occ_dof;
             auto const &converter = supercell->unitcellcoord_index_converter;
             auto const &xtal_prim = supercell->prim->basicstructure;
@@ -1238,22 +1670,14 @@ PYBIND11_MODULE(_configuration, m) {
           "value `s` on site `l`.")
       .def(
           "coordinate_cart",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
-            auto const &converter = supercell->unitcellcoord_index_converter;
-            auto const &xtal_prim = supercell->prim->basicstructure;
-            Index n_sites = converter.total_sites();
-            Eigen::MatrixXd R(3, n_sites);
-            for (Index l = 0; l < n_sites; ++l) {
-              xtal::UnitCellCoord bijk = converter(l);
-              R.col(l) = bijk.coordinate(*xtal_prim).const_cart();
-            }
-            return R;
+          [](std::shared_ptr<config::Supercell> const &supercell) {
+            return Eigen::MatrixXd(supercell->site_coordinate_cart());
           },
           "Returns the basis site positions, as columns of a matrix, in "
           "Cartesian coordinates")
       .def(
           "coordinate_frac",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             auto const &converter = supercell->unitcellcoord_index_converter;
             auto const &xtal_prim = supercell->prim->basicstructure;
             Index n_sites = converter.total_sites();
@@ -1268,20 +1692,14 @@ PYBIND11_MODULE(_configuration, m) {
           "fractional coordinates of the prim lattice vectors.")
       .def(
           "sublattice_indices",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
-            std::vector<Index> sublattice_indices;
-            auto const &converter = supercell->unitcellcoord_index_converter;
-            Index n_sites = converter.total_sites();
-            for (Index l = 0; l < n_sites; ++l) {
-              sublattice_indices.push_back(converter(l).sublattice());
-            }
-            return sublattice_indices;
+          [](std::shared_ptr<config::Supercell> const &supercell) {
+            return supercell->site_sublattice_index();
           },
           "Returns the sublattice indices, as a List[int], of each site "
           "in the supercell.")
       .def(
           "unitcell_indices",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             auto const &converter = supercell->unitcellcoord_index_converter;
             Index n_sites = converter.total_sites();
             Eigen::MatrixXl R(3, n_sites);
@@ -1295,18 +1713,8 @@ PYBIND11_MODULE(_configuration, m) {
           "each site in the supercell.")
       .def(
           "linear_unitcell_indices",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
-            std::vector<Index> unitcell_indices;
-            auto const &xtal_prim = supercell->prim->basicstructure;
-            Index N_sublat = xtal_prim->basis().size();
-            Index N_unitcells =
-                supercell->unitcell_index_converter.total_sites();
-            for (Index b = 0; b < N_sublat; ++b) {
-              for (Index i = 0; i < N_unitcells; ++i) {
-                unitcell_indices.push_back(i);
-              }
-            }
-            return unitcell_indices;
+          [](std::shared_ptr<config::Supercell> const &supercell) {
+            return supercell->site_unitcell_index();
           },
           "Returns the linear unitcell index for each site in the supercell.")
       .def(
@@ -1346,6 +1754,46 @@ PYBIND11_MODULE(_configuration, m) {
             return converter(l);
           },
           "Returns the integral_site_coordinate of a site in the supercell.")
+      .def(
+          "memory_usage",
+          [](std::shared_ptr<config::Supercell const> const &supercell)
+              -> nlohmann::json {
+            config::MemoryUsageContext context;
+            jsonParser json;
+            to_json(make_memory_usage(*supercell, context), json);
+            return static_cast<nlohmann::json>(json);
+          },
+          R"pbdoc(
+          Estimate the memory used by the supercell
+
+          The prim, and the canonical equivalent supercell if it is a
+          different supercell, are not included.
+
+          Returns
+          -------
+          report : dict
+              A dict with format:
+
+              .. code-block:: Python
+
+                  {
+                      "n_sites": int,
+                      "factor_group_bytes": int,
+                      "factor_group_permutations_bytes": int,
+                      "n_translation_permutations": int,
+                      "translation_permutations_bytes": int,
+                      "translation_permutation_cache_bytes": int,
+                      "site_data_bytes": int,
+                      "combined_permutation_table_bytes": int,
+                      "other_bytes": int,
+                      "total_bytes": int,
+                  }
+
+              All values ending in ``"_bytes"`` are estimates, in bytes.
+              ``"translation_permutations_bytes"`` is non-zero only if the
+              supercell stores all translation permutations; see the
+              ``max_n_translation_permutations`` constructor parameter.
+          )pbdoc")
       .def(py::self < py::self,
            "Sorts supercells by size then how canonical the lattice vectors "
            "are. Only supercells with the same prim can be compared.")
@@ -1365,6 +1813,11 @@ PYBIND11_MODULE(_configuration, m) {
            ""
            "True if supercells are not equal. Only supercells with the same "
            "prim can be compared.")
+      .def(py::pickle(
+          [](std::shared_ptr<config::Supercell> const &supercell) {
+            return supercell_getstate(supercell);
+          },
+          [](py::tuple state) { return supercell_setstate(state); }))
       .def_static(
           "from_dict",
           [](const nlohmann::json &data,
@@ -1395,7 +1848,7 @@ PYBIND11_MODULE(_configuration, m) {
           py::arg("data"), py::arg("supercells"))
       .def(
           "to_dict",
-          [](std::shared_ptr<config::Supercell const> const &supercell) {
+          [](std::shared_ptr<config::Supercell> const &supercell) {
             jsonParser json;
             to_json(supercell, json);
             return static_cast<nlohmann::json>(json);
@@ -1406,7 +1859,7 @@ PYBIND11_MODULE(_configuration, m) {
           "Configuration/>`_ documents the expected format for Configurations "
           "and Supercells.")
       .def("__repr__",
-           [](std::shared_ptr<config::Supercell const> const &supercell) {
+           [](std::shared_ptr<config::Supercell> const &supercell) {
              std::stringstream ss;
              jsonParser json;
              to_json(supercell, json);
@@ -1414,7 +1867,7 @@ PYBIND11_MODULE(_configuration, m) {
              return ss.str();
            })
       .def("__hash__",
-           [](std::shared_ptr<config::Supercell const> const &supercell) {
+           [](std::shared_ptr<config::Supercell> const &supercell) {
              Eigen::Matrix3l const &T =
                  supercell->superlattice.transformation_matrix_to_super();
              std::stringstream ss;
@@ -1458,6 +1911,156 @@ PYBIND11_MODULE(_configuration, m) {
       "Return a list of the supercells with distinct, but symmetrically "
       "equivalent lattice points, using the prim crystal point group.");
 
+  m.def(
+      "make_equivalent_supercells_batch",
+      [](std::vector<std::shared_ptr<config::Supercell const>> const
+             &supercells,
+         Index n_threads) {
+        return config::make_equivalents(supercells, n_threads);
+      },
+      py::arg("supercells"), py::arg("n_threads") = 1,
+      py::call_guard<py::gil_scoped_release>(),
+      R"pbdoc(
+      Make the equivalent supercells of many supercells, in parallel
+
+      Parameters
+      ----------
+      supercells : list[Supercell]
+          The supercells.
+      n_threads : int = 1
+          Number of threads to use. If `n_threads` <= 0, use the hardware
+          concurrency.
+
+      Returns
+      -------
+      equivalents : list[list[Supercell]]
+          ``make_equivalent_supercells(supercells[i])``, for each `i`. The
+          result does not depend on `n_threads`.
+      )pbdoc");
+
+  m.def("make_canonical_transformation_matrix",
+        &config::make_canonical_transformation_matrix, py::arg("prim"),
+        py::arg("transformation_matrix_to_super"), R"pbdoc(
+      Make the transformation matrix of the canonical equivalent superlattice,
+      without constructing a Supercell
+
+      Parameters
+      ----------
+      prim : Prim
+          The prim.
+      transformation_matrix_to_super : array_like, shape=(3,3), dtype=int
+          The transformation matrix, T, of the superlattice, such that
+          ``S = L @ T``.
+
+      Returns
+      -------
+      canonical_transformation_matrix_to_super : np.ndarray[np.int64[3, 3]]
+          Equal to the `transformation_matrix_to_super` of
+          ``make_canonical_supercell(Supercell(prim, T))``.
+      )pbdoc");
+
+  m.def("make_canonical_transformation_matrices",
+        &config::make_canonical_transformation_matrices, py::arg("prim"),
+        py::arg("transformation_matrices_to_super"), py::arg("n_threads") = 1,
+        py::call_guard<py::gil_scoped_release>(), R"pbdoc(
+      Make the transformation matrices of the canonical equivalent
+      superlattices of many superlattices, in parallel
+
+      Parameters
+      ----------
+      prim : Prim
+          The prim.
+      transformation_matrices_to_super : list[array_like]
+          The transformation matrices of the superlattices.
+      n_threads : int = 1
+          Number of threads to use. If `n_threads` <= 0, use the hardware
+          concurrency.
+
+      Returns
+      -------
+      canonical_transformation_matrices_to_super : list[np.ndarray[np.int64[3, 3]]]
+          ``make_canonical_transformation_matrix(prim, T)``, for each `T`.
+      )pbdoc");
+
+  m.def("make_equivalent_transformation_matrices",
+        py::overload_cast<std::shared_ptr<config::Prim const> const &,
+                          Eigen::Matrix3l const &>(
+            &config::make_equivalent_transformation_matrices),
+        py::arg("prim"), py::arg("transformation_matrix_to_super"),
+        R"pbdoc(
+      Make the transformation matrices of the distinct symmetrically
+      equivalent superlattices, without constructing Supercells
+
+      The prim point group operations are applied to the transformation
+      matrix as integer matrices, and results are identified by their
+      Hermite normal form, so this is much cheaper than
+      :func:`make_equivalent_supercells`, which also constructs the supercell
+      symmetry info for every result. Construct Supercell only for the
+      results that are needed.
+
+      Parameters
+      ----------
+      prim : Prim
+          The prim.
+      transformation_matrix_to_super : array_like, shape=(3,3), dtype=int
+          The transformation matrix, T, of the superlattice, such that
+          ``S = L @ T``.
+
+      Returns
+      -------
+      equivalent_transformation_matrices_to_super : list[np.ndarray[np.int64[3, 3]]]
+          The transformation matrices of the supercells returned by
+          ``make_equivalent_supercells(Supercell(prim, T))``, in the same
+          order.
+      )pbdoc");
+
+  m.def("make_equivalent_transformation_matrices_batch",
+        py::overload_cast<std::shared_ptr<config::Prim const> const &,
+                          std::vector<Eigen::Matrix3l> const &, Index>(
+            &config::make_equivalent_transformation_matrices),
+        py::arg("prim"), py::arg("transformation_matrices_to_super"),
+        py::arg("n_threads") = 1, py::call_guard<py::gil_scoped_release>(),
+        R"pbdoc(
+      Make the transformation matrices of the distinct symmetrically
+      equivalent superlattices of many superlattices, in parallel
+
+      Parameters
+      ----------
+      prim : Prim
+          The prim.
+      transformation_matrices_to_super : list[array_like]
+          The transformation matrices of the superlattices.
+      n_threads : int = 1
+          Number of threads to use. If `n_threads` <= 0, use the hardware
+          concurrency.
+
+      Returns
+      -------
+      equivalent_transformation_matrices_to_super : list[list[np.ndarray[np.int64[3, 3]]]]
+          ``make_equivalent_transformation_matrices(prim, T)``, for each `T`.
+      )pbdoc");
+
+  m.def("make_superlattice_invariant_factor_group_indices",
+        &config::make_superlattice_invariant_factor_group_indices,
+        py::arg("prim"), py::arg("transformation_matrix_to_super"), R"pbdoc(
+      Make the indices of the prim factor group operations that leave a
+      superlattice invariant, without constructing a Supercell
+
+      Parameters
+      ----------
+      prim : Prim
+          The prim.
+      transformation_matrix_to_super : array_like, shape=(3,3), dtype=int
+          The transformation matrix, T, of the superlattice, such that
+          ``S = L @ T``.
+
+      Returns
+      -------
+      indices : list[int]
+          The prim factor group indices, equal to
+          ``Supercell(prim, T).factor_group.head_group_index``.
+      )pbdoc");
+
   // SupercellRecord -- define functions
   pySupercellRecord
       .def(py::init<std::shared_ptr<config::Supercell const> const &>(),
@@ -1520,7 +2123,8 @@ PYBIND11_MODULE(_configuration, m) {
 
   // ConfigurationRecord -- define functions
   pyConfigurationRecord
-      .def(py::init<config::Configuration const &, std::string, std::string>(),
+      .def(py::init<config::Configuration const &, std::string const &,
+                    std::string const &>(),
            py::arg("configuration"), py::arg("supercell_name"),
            py::arg("configuration_id"),
            R"pbdoc(
@@ -1535,7 +2139,8 @@ PYBIND11_MODULE(_configuration, m) {
               The supercell name, as from
               :attr:`SupercellRecord.supercell_name <libcasm.configuration.SupercellRecord.supercell_name>`.
           configuration_id: str
-              The configuration id.
+              The configuration id, which must be a non-negative integer,
+              such as ``"2"``.
           )pbdoc")
       .def_readonly("configuration",
                     &config::ConfigurationRecord::configuration,
@@ -1543,15 +2148,15 @@ PYBIND11_MODULE(_configuration, m) {
           libcasm.configuration.Configuration: The
           :class:`~libcasm.configuration.Configuration`
           )pbdoc")
-      .def_readonly("supercell_name",
-                    &config::ConfigurationRecord::supercell_name,
-                    "str: The supercell name.")
-      .def_readonly("configuration_id",
-                    &config::ConfigurationRecord::configuration_id,
-                    "str: The configuration id.")
-      .def_readonly("configuration_name",
-                    &config::ConfigurationRecord::configuration_name,
-                    "str: The configuration name.")
+      .def_property_readonly("supercell_name",
+                             &config::ConfigurationRecord::supercell_name,
+                             "str: The supercell name.")
+      .def_property_readonly("configuration_id",
+                             &config::ConfigurationRecord::configuration_id,
+                             "str: The configuration id.")
+      .def_property_readonly("configuration_name",
+                             &config::ConfigurationRecord::configuration_name,
+                             "str: The configuration name.")
       .def(py::self < py::self, "Sorts ConfigurationRecord.")
       .def(py::self <= py::self, "Sorts ConfigurationRecord.")
       .def(py::self > py::self, "Sorts ConfigurationRecord.")
@@ -1578,9 +2183,9 @@ PYBIND11_MODULE(_configuration, m) {
         std::stringstream ss;
         jsonParser json;
         to_json(self.configuration, json["configuration"]);
-        to_json(self.supercell_name, json["supercell_name"]);
-        to_json(self.configuration_id, json["configuration_id"]);
-        to_json(self.configuration_name, json["configuration_name"]);
+        to_json(self.supercell_name(), json["supercell_name"]);
+        to_json(self.configuration_id(), json["configuration_id"]);
+        to_json(self.configuration_name(), json["configuration_name"]);
         ss << json;
         return ss.str();
       });
@@ -1606,6 +2211,50 @@ PYBIND11_MODULE(_configuration, m) {
       .def("__len__", &config::SupercellSet::size)
       // clear
       .def("clear", &config::SupercellSet::clear, "Clear SupercellSet")
+      .def(
+          "memory_usage",
+          [](config::SupercellSet const &m) -> nlohmann::json {
+            config::MemoryUsageContext context;
+            jsonParser json;
+            to_json(make_memory_usage(m, context), json);
+            return static_cast<nlohmann::json>(json);
+          },
+          R"pbdoc(
+          Estimate the memory used by the SupercellSet and its supercells
+
+          Memory shared by several supercells is counted once, for the first
+          supercell in the set that uses it. The prim is not included.
+
+          Returns
+          -------
+          report : dict
+              A dict with format:
+
+              .. code-block:: Python
+
+                  {
+                      "supercells": [
+                          {
+                              "supercell_name": str,
+                              "n_sites": int,
+                              "factor_group_bytes": int,
+                              "factor_group_permutations_bytes": int,
+                              "n_translation_permutations": int,
+                              "translation_permutations_bytes": int,
+                              "translation_permutation_cache_bytes": int,
+                              "site_data_bytes": int,
+                              "combined_permutation_table_bytes": int,
+                              "other_bytes": int,
+                              "total_bytes": int,
+                          },
+                          ...
+                      ],
+                      "records_bytes": int,
+                      "total_bytes": int,
+                  }
+
+              All values ending in ``"_bytes"`` are estimates, in bytes.
+          )pbdoc")
       // add
       .def(
           "add_supercell",
@@ -1735,6 +2384,76 @@ PYBIND11_MODULE(_configuration, m) {
               A :class:`~libcasm.configuration.SupercellRecord`, as a const reference.
           )pbdoc",
           py::arg("supercell_name"))
+      .def(
+          "add_by_transformation_matrices_to_super",
+          [](config::SupercellSet &m,
+             std::vector<Eigen::Matrix3l> const &matrices, Index n_threads) {
+            py::gil_scoped_release release;
+            return config::insert_supercells(m, matrices, n_threads);
+          },
+          py::return_value_policy::reference_internal,
+          R"pbdoc(
+          Add many supercells to the set, by constructing from transformation \
+          matrices in parallel.
+
+          Equivalent to calling
+          :func:`~libcasm.configuration.SupercellSet.add_by_transformation_matrix_to_super`
+          for each matrix, but each distinct supercell not already in the set is
+          constructed once, and the supercells are constructed in parallel.
+
+          Parameters
+          ----------
+          transformation_matrices_to_super : List[array_like], shape=(3,3), dtype=int
+              The transformation matrices, which may contain duplicates.
+
+          n_threads : int = 1
+              Number of threads used to construct supercells that are not
+              already in the set. If <= 0, use the hardware concurrency.
+
+          Returns
+          -------
+          records : List[libcasm.configuration.SupercellRecord]
+              The :class:`~libcasm.configuration.SupercellRecord` for each
+              transformation matrix, as const references.
+          )pbdoc",
+          py::arg("transformation_matrices_to_super"), py::arg("n_threads") = 1)
+      .def(
+          "add_by_canonical_names",
+          [](config::SupercellSet &m,
+             std::vector<std::string> const &supercell_names,
+             Index n_threads) {
+            py::gil_scoped_release release;
+            return config::insert_canonical_supercells(m, supercell_names,
+                                                       n_threads);
+          },
+          py::return_value_policy::reference_internal,
+          R"pbdoc(
+          Construct many canonical supercells from supercell names, in \
+          parallel, and add to the set.
+
+          Equivalent to calling
+          :func:`~libcasm.configuration.SupercellSet.add_by_canonical_name`
+          for each name, but each distinct supercell not already in the set is
+          constructed once, and the supercells are constructed in parallel.
+
+          Parameters
+          ----------
+          supercell_names : List[str]
+              The names of canonical supercells, which may contain duplicates.
+              Raises if any is not the name of the canonical equivalent
+              supercell.
+
+          n_threads : int = 1
+              Number of threads used to construct supercells that are not
+              already in the set. If <= 0, use the hardware concurrency.
+
+          Returns
+          -------
+          records : List[libcasm.configuration.SupercellRecord]
+              The :class:`~libcasm.configuration.SupercellRecord` for each
+              name, as const references.
+          )pbdoc",
+          py::arg("supercell_names"), py::arg("n_threads") = 1)
       .def(
           "add",
           [](config::SupercellSet &m,
@@ -2000,11 +2719,12 @@ PYBIND11_MODULE(_configuration, m) {
       .def_static(
           "from_dict",
           [](const nlohmann::json &data,
-             std::shared_ptr<config::Prim const> const &prim)
+             std::shared_ptr<config::Prim const> const &prim, Index n_threads)
               -> std::shared_ptr<config::SupercellSet> {
             auto supercells = std::make_shared<config::SupercellSet>(prim);
             jsonParser json{data};
-            from_json(*supercells, json, prim);
+            py::gil_scoped_release release;
+            from_json(*supercells, json, prim, n_threads);
             return supercells;
           },
           R"pbdoc(
@@ -2036,12 +2756,16 @@ PYBIND11_MODULE(_configuration, m) {
           prim : libcasm.configuration.Prim
               A :class:`libcasm.configuration.Prim`
 
+          n_threads : int = 1
+              Number of threads used to construct the supercells. If <= 0, use
+              the hardware concurrency.
+
           Returns
           -------
           supercells : libcasm.configuration.SupercellSet
               The :class:`~libcasm.configuration.SupercellSet`.
           )pbdoc",
-          py::arg("data"), py::arg("prim"))
+          py::arg("data"), py::arg("prim"), py::arg("n_threads") = 1)
       .def(
           "to_dict",
           [](std::shared_ptr<config::SupercellSet> supercells,
@@ -2088,6 +2812,17 @@ PYBIND11_MODULE(_configuration, m) {
       .def("__len__", &config::ConfigurationSet::size)
       // clear
       .def("clear", &config::ConfigurationSet::clear, "Clear ConfigurationSet")
+      .def(
+          "memory_usage",
+          [](config::ConfigurationSet const &m) {
+            return config::memory_usage(m);
+          },
+          R"pbdoc(
+          Estimate the memory used by the ConfigurationSet, in bytes
+
+          Includes the configurations, the supercells they use, each counted
+          once, and the lookup indices. The prim is not included.
+          )pbdoc")
       // add
       .def(
           "add_configuration",
@@ -2397,14 +3132,70 @@ PYBIND11_MODULE(_configuration, m) {
           },
           py::keep_alive<
               0, 1>() /* Essential: keep object alive while iterator exists */)
+      .def(
+          "supercell_records",
+          [](config::ConfigurationSet const &m, std::string supercell_name) {
+            auto range = m.supercell_range(supercell_name);
+            return py::make_iterator(range.first, range.second);
+          },
+          py::keep_alive<0, 1>(), py::arg("supercell_name"),
+          R"pbdoc(
+          Iterate over the ConfigurationRecord with the given supercell name
+
+          Records of one supercell are contiguous in the set, so this does not
+          scan the records of other supercells. The set must not be modified
+          while iterating.
+
+          Parameters
+          ----------
+          supercell_name: str
+              The supercell name.
+
+          Returns
+          -------
+          records: Iterator[libcasm.configuration.ConfigurationRecord]
+              The records with the given supercell name, in set order.
+          )pbdoc")
+      .def("count_by_supercell", &config::ConfigurationSet::count_by_supercell,
+           py::arg("supercell_name"),
+           R"pbdoc(
+          Return the number of configurations with the given supercell name.
+          )pbdoc")
+      .def(py::pickle(
+          [](config::ConfigurationSet const &configurations) {
+            py::object prim = py::none();
+            if (!configurations.empty()) {
+              prim = py::cast(std::const_pointer_cast<config::Prim>(
+                  configurations.begin()->configuration.supercell->prim));
+            }
+            return py::make_tuple(prim,
+                                  py::bytes(config::to_bytes(configurations)));
+          },
+          [](py::tuple state) {
+            if (state.size() != 2) {
+              throw std::runtime_error(
+                  "Error unpickling ConfigurationSet: invalid state");
+            }
+            auto configurations = std::make_shared<config::ConfigurationSet>();
+            if (!state[0].is_none()) {
+              auto prim = state[0].cast<std::shared_ptr<config::Prim>>();
+              std::istringstream in(std::string{state[1].cast<py::bytes>()});
+              config::read_binary(in, *pickle_supercells(prim),
+                                  *configurations);
+            }
+            return configurations;
+          }))
       .def_static(
           "from_dict",
           [](const nlohmann::json &data,
-             std::shared_ptr<config::SupercellSet> supercells) {
+             std::shared_ptr<config::SupercellSet> supercells,
+             Index n_threads) {
             jsonParser json{data};
             std::shared_ptr<config::ConfigurationSet> configurations =
                 std::make_shared<config::ConfigurationSet>();
-            from_json(*supercells, *configurations, json, supercells->prim());
+            py::gil_scoped_release release;
+            from_json(*supercells, *configurations, json, supercells->prim(),
+                      n_threads);
             return configurations;
           },
           R"pbdoc(
@@ -2437,21 +3228,68 @@ PYBIND11_MODULE(_configuration, m) {
               :class:`~libcasm.configuration.Configuration` in order to avoid
               duplicates.
 
+          n_threads : int = 1
+              Number of threads used to construct supercells that are not
+              already in `supercells`. If <= 0, use the hardware concurrency.
+
           Returns
           -------
           configurations : libcasm.configuration.ConfigurationSet
               The :class:`~libcasm.configuration.ConfigurationSet` constructed from
               the dict.
           )pbdoc",
-          py::arg("data"), py::arg("supercells"))
-      .def(
-          "to_dict",
-          [](config::ConfigurationSet const &configurations,
-             bool write_prim_basis) {
-            jsonParser json;
-            to_json(configurations, json, write_prim_basis);
-            return static_cast<nlohmann::json>(json);
-          },
+          py::arg("data"), py::arg("supercells"), py::arg("n_threads") = 1)
+      .def_static(
+          "from_json_str",
+          [](std::string const &json_str,
+             std::shared_ptr<config::SupercellSet> supercells,
+             Index n_threads) {
+            std::shared_ptr<config::ConfigurationSet> configurations =
+                std::make_shared<config::ConfigurationSet>();
+            py::gil_scoped_release release;
+            config::read_configuration_set_json(json_str, *supercells,
+                                                *configurations, n_threads);
+            return configurations;
+          },
+          R"pbdoc(
+          Construct a ConfigurationSet from a JSON string
+
+          Equivalent to
+          ``ConfigurationSet.from_dict(json.loads(json_str), supercells)``,
+          but configurations in the standard layout are read directly into
+          DoF value arrays, without constructing a Python dict or a JSON
+          document, which for large sets is several times the size of the
+          data.
+
+          Parameters
+          ----------
+          json_str : str
+              The serialized ConfigurationSet, in the format read by
+              :func:`~libcasm.configuration.ConfigurationSet.from_dict`.
+          supercells : libcasm.configuration.SupercellSet
+              A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+              supercells used by the constructed
+              :class:`~libcasm.configuration.Configuration` in order to avoid
+              duplicates.
+          n_threads : int = 1
+              Number of threads used to construct supercells that are not
+              already in `supercells`. If <= 0, use the hardware concurrency.
+
+          Returns
+          -------
+          configurations : libcasm.configuration.ConfigurationSet
+              The :class:`~libcasm.configuration.ConfigurationSet` constructed
+              from the JSON string.
+          )pbdoc",
+          py::arg("json_str"), py::arg("supercells"), py::arg("n_threads") = 1)
+      .def(
+          "to_dict",
+          [](config::ConfigurationSet const &configurations,
+             bool write_prim_basis) {
+            jsonParser json;
+            to_json(configurations, json, write_prim_basis);
+            return static_cast<nlohmann::json>(json);
+          },
           R"pbdoc(
           Represent the ConfigurationSet as a Python dict.
 
@@ -2466,7 +3304,55 @@ PYBIND11_MODULE(_configuration, m) {
           data : dict
               The `Prim reference <https://prisms-center.github.io/CASMcode_docs/formats/casm/crystallography/BasicStructure/>`_ documents the expected format.
           )pbdoc",
-          py::arg("write_prim_basis") = false);
+          py::arg("write_prim_basis") = false)
+      .def_static(
+          "from_bytes",
+          [](py::bytes const &data,
+             std::shared_ptr<config::SupercellSet> supercells) {
+            std::shared_ptr<config::ConfigurationSet> configurations =
+                std::make_shared<config::ConfigurationSet>();
+            std::istringstream in(std::string{data});
+            config::read_binary(in, *supercells, *configurations);
+            return configurations;
+          },
+          R"pbdoc(
+          Construct a ConfigurationSet from the binary configuration format
+
+          Parameters
+          ----------
+          data : bytes
+              The ConfigurationSet, as from
+              :func:`~libcasm.configuration.ConfigurationSet.to_bytes`.
+          supercells : libcasm.configuration.SupercellSet
+              A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+              supercells used by the constructed
+              :class:`~libcasm.configuration.Configuration` in order to avoid
+              duplicates.
+
+          Returns
+          -------
+          configurations : libcasm.configuration.ConfigurationSet
+              The :class:`~libcasm.configuration.ConfigurationSet` constructed from
+              the bytes.
+          )pbdoc",
+          py::arg("data"), py::arg("supercells"))
+      .def(
+          "to_bytes",
+          [](config::ConfigurationSet const &configurations) {
+            return py::bytes(config::to_bytes(configurations));
+          },
+          R"pbdoc(
+          Represent the ConfigurationSet in the binary configuration format
+
+          Configuration ids and next configuration ids are preserved. DoF
+          values are stored in the prim basis as raw doubles, so values are
+          preserved exactly.
+
+          Returns
+          -------
+          data : bytes
+              The ConfigurationSet in the binary configuration format.
+          )pbdoc");
 
   // SupercellSymOp -- define functions
   pySupercellSymOp
@@ -2538,6 +3424,10 @@ PYBIND11_MODULE(_configuration, m) {
       .def("combined_permute", &config::SupercellSymOp::combined_permute,
            "Returns the combination of factor group operation permutation and "
            "translation permutation")
+      .def("inverse_combined_permute",
+           &config::SupercellSymOp::inverse_combined_permute,
+           "Returns the inverse of the combined permutation, which "
+           "transforms site indices")
       .def("inverse", &config::SupercellSymOp::inverse,
            "Returns the inverse operation")
       .def(
@@ -2698,8 +3588,12 @@ PYBIND11_MODULE(_configuration, m) {
           "Assign all values from other, which is in the standard basis, using "
           "copy",
           py::arg("other"))
-      .def("standard_dof_values", &config::make_standard_dof_values,
-           "Return a copy of ConfigDoFValues, in the standard basis.")
+      .def(
+          "standard_dof_values",
+          [](config::Configuration const &configuration) {
+            return config::make_standard_dof_values(configuration);
+          },
+          "Return a copy of ConfigDoFValues, in the standard basis.")
       .def_property_readonly(
           "occupation",
           [](config::Configuration const &configuration)
@@ -2752,6 +3646,27 @@ PYBIND11_MODULE(_configuration, m) {
           },
           "Sets the site occupation values. Changing the size of the "
           "occupation vector results in an exception.")
+      .def(
+          "occupation_view",
+          [](config::Configuration &configuration) -> Eigen::VectorXi & {
+            return configuration.dof_values.occupation;
+          },
+          py::return_value_policy::reference_internal,
+          R"pbdoc(
+          Returns a writable view of the site occupation values
+
+          The result is a numpy.ndarray[numpy.int32[n_sites,]] that shares
+          memory with this Configuration, without copying, and keeps this
+          Configuration alive. Assigning to its elements, for example
+          ``config.occupation_view()[:] = new_occupation``, sets the
+          occupation in place.
+
+          The view remains valid while the occupation vector is not
+          replaced. Methods that only assign values, such as
+          :func:`Configuration.set_occupation` and
+          :func:`Configuration.set_occ`, keep it valid. Values are not
+          checked for validity.
+          )pbdoc")
       .def(
           "occ",
           [](config::Configuration const &configuration, Index l) -> int {
@@ -2779,6 +3694,24 @@ PYBIND11_MODULE(_configuration, m) {
           py::return_value_policy::reference_internal, py::arg("key"),
           "Returns global DoF values of type `key`, in the prim basis, as a "
           "const reference.")
+      .def(
+          "global_dof_values_view",
+          [](config::Configuration &configuration,
+             std::string key) -> Eigen::VectorXd & {
+            return configuration.dof_values.global_dof_values.at(key);
+          },
+          py::return_value_policy::reference_internal, py::arg("key"),
+          R"pbdoc(
+          Returns a writable view of the global DoF values of type `key`, in
+          the prim basis
+
+          The result shares memory with this Configuration, without copying,
+          and keeps this Configuration alive. Assigning to its elements sets
+          the DoF values in place. It remains valid while the DoF values are
+          not replaced; :func:`Configuration.set_global_dof_values` and
+          :func:`Configuration.set_global_standard_dof_values` keep it
+          valid.
+          )pbdoc")
       .def(
           "global_standard_dof_values",
           [](config::Configuration const &configuration,
@@ -2813,8 +3746,16 @@ PYBIND11_MODULE(_configuration, m) {
             auto const &prim = configuration.supercell->prim;
             Eigen::VectorXd &curr_dof_values =
                 configuration.dof_values.global_dof_values.at(key);
-            curr_dof_values = clexulator::global_from_standard_values(
-                standard_dof_values, prim->global_dof_info.at(key));
+            Eigen::VectorXd dof_values =
+                clexulator::global_from_standard_values(
+                    standard_dof_values, prim->global_dof_info.at(key));
+            if (curr_dof_values.size() != dof_values.size()) {
+              throw std::runtime_error(
+                  "Error in set_global_standard_dof_values: size may not be "
+                  "changed");
+            }
+            // copy into the existing storage, so views remain valid
+            curr_dof_values.noalias() = dof_values;
           },
           py::arg("key"), py::arg("standard_dof_values"),
           "Set global DoF values of type `key`, in the standard basis, using a "
@@ -2828,6 +3769,26 @@ PYBIND11_MODULE(_configuration, m) {
           py::return_value_policy::reference_internal, py::arg("key"),
           "Returns local DoF values of type `key`, in the prim basis, as a "
           "const reference.")
+      .def(
+          "local_dof_values_view",
+          [](config::Configuration &configuration,
+             std::string key) -> Eigen::MatrixXd & {
+            return configuration.dof_values.local_dof_values.at(key);
+          },
+          py::return_value_policy::reference_internal, py::arg("key"),
+          R"pbdoc(
+          Returns a writable view of the local DoF values of type `key`, in
+          the prim basis
+
+          The result, of shape=(dim, n_sites), shares memory with this
+          Configuration, without copying, and keeps this Configuration
+          alive. Assigning to its elements, for example
+          ``config.local_dof_values_view("disp")[:, l] = value``, sets the
+          DoF values in place. It remains valid while the DoF values are
+          not replaced; :func:`Configuration.set_local_dof_values`,
+          :func:`Configuration.set_local_standard_dof_values` and the site
+          value setters keep it valid.
+          )pbdoc")
       .def(
           "local_standard_dof_values",
           [](config::Configuration const &configuration,
@@ -2878,9 +3839,17 @@ PYBIND11_MODULE(_configuration, m) {
                 supercell->unitcell_index_converter.total_sites();
             Eigen::MatrixXd &curr_dof_values =
                 configuration.dof_values.local_dof_values.at(key);
-            curr_dof_values = clexulator::local_from_standard_values(
+            Eigen::MatrixXd dof_values = clexulator::local_from_standard_values(
                 standard_dof_values, N_sublat, N_unitcells,
                 prim->local_dof_info.at(key));
+            if (curr_dof_values.rows() != dof_values.rows() ||
+                curr_dof_values.cols() != dof_values.cols()) {
+              throw std::runtime_error(
+                  "Error in set_local_standard_dof_values: shape may not be "
+                  "changed");
+            }
+            // copy into the existing storage, so views remain valid
+            curr_dof_values.noalias() = dof_values;
           },
           py::arg("key"), py::arg("standard_dof_values"),
           "Set local DoF values of type `key`, in the standard basis, using a "
@@ -3235,6 +4204,13 @@ PYBIND11_MODULE(_configuration, m) {
            })
       .def("__deepcopy__", [](config::Configuration const &self,
                               py::dict) { return config::Configuration(self); })
+      .def(py::pickle(
+          [](config::Configuration const &self) {
+            return configuration_getstate(self.supercell->prim, self);
+          },
+          [](py::tuple state) {
+            return configuration_setstate<config::Configuration>(state);
+          }))
       .def_static(
           "from_dict",
           [](const nlohmann::json &data,
@@ -3289,6 +4265,82 @@ PYBIND11_MODULE(_configuration, m) {
               The `Configuration reference <https://prisms-center.github.io/CASMcode_docs/formats/casm/clex/Configuration/>`_ documents the expected format for Configurations."
           )pbdoc",
           py::arg("write_prim_basis") = false)
+      .def_static(
+          "from_json_str",
+          [](std::string const &json_str,
+             std::shared_ptr<config::SupercellSet> supercells) {
+            // print errors and warnings to sys.stdout
+            py::scoped_ostream_redirect redirect;
+            return std::move(
+                *config::make_from_json_string<config::Configuration>(
+                    json_str, *supercells));
+          },
+          R"pbdoc(
+          Construct a Configuration from a JSON string
+
+          Equivalent to
+          ``Configuration.from_dict(json.loads(json_str), supercells)``, but
+          records in the standard layout are read directly into DoF value
+          arrays, without constructing a Python dict or a JSON document.
+
+          Parameters
+          ----------
+          json_str : str
+              A Configuration, as JSON.
+          supercells : libcasm.configuration.SupercellSet
+              A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+              supercells in order to avoid duplicates.
+
+          Returns
+          -------
+          configuration : libcasm.configuration.Configuration
+              The :class:`~libcasm.configuration.Configuration` constructed from
+              the JSON string.
+          )pbdoc",
+          py::arg("json_str"), py::arg("supercells"))
+      .def_static(
+          "from_bytes",
+          [](py::bytes const &data,
+             std::shared_ptr<config::SupercellSet> supercells) {
+            return config::from_bytes<config::Configuration>(std::string{data},
+                                                             *supercells);
+          },
+          R"pbdoc(
+          Construct a Configuration from the binary configuration format
+
+          Parameters
+          ----------
+          data : bytes
+              The Configuration, as from
+              :func:`~libcasm.configuration.Configuration.to_bytes`.
+          supercells : libcasm.configuration.SupercellSet
+              A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+              supercells in order to avoid duplicates.
+
+          Returns
+          -------
+          configuration : libcasm.configuration.Configuration
+              The :class:`~libcasm.configuration.Configuration` constructed from
+              the bytes.
+          )pbdoc",
+          py::arg("data"), py::arg("supercells"))
+      .def(
+          "to_bytes",
+          [](config::Configuration const &self) {
+            return py::bytes(config::to_bytes(self));
+          },
+          R"pbdoc(
+          Represent the Configuration in the binary configuration format
+
+          The supercell is stored by name and transformation matrix, and DoF
+          values are stored in the prim basis as raw doubles, so values are
+          preserved exactly.
+
+          Returns
+          -------
+          data : bytes
+              The Configuration in the binary configuration format.
+          )pbdoc")
       .def("__repr__",
            [](config::Configuration const &self) {
              std::stringstream ss;
@@ -3370,37 +4422,7 @@ PYBIND11_MODULE(_configuration, m) {
   m.def(
       "asymmetric_unit_indices",
       [](config::Configuration const &configuration) {
-        // Make the configuration invariant subgroup
-        auto const &supercell = configuration.supercell;
-        auto begin = config::SupercellSymOp::begin(supercell);
-        auto end = config::SupercellSymOp::end(supercell);
-        std::vector<config::SupercellSymOp> invariant_subgroup =
-            config::make_invariant_subgroup(configuration, begin, end);
-
-        // Make the orbits of equivalent sites
-        std::vector<std::vector<Index>> asymmetric_unit_indices;
-        Index n_sites = supercell->unitcellcoord_index_converter.total_sites();
-        for (Index l = 0; l < n_sites; ++l) {
-          bool found = false;
-          for (auto const &indices : asymmetric_unit_indices) {
-            if (std::find(indices.begin(), indices.end(), l) != indices.end()) {
-              found = true;
-              break;
-            }
-          }
-
-          if (found) {
-            continue;
-          }
-
-          std::set<Index> orbit;
-          for (auto const &op : invariant_subgroup) {
-            orbit.insert(op.permute_index(l));
-          }
-          asymmetric_unit_indices.push_back(
-              std::vector<Index>(orbit.begin(), orbit.end()));
-        }
-        return asymmetric_unit_indices;
+        return config::make_asymmetric_unit_indices(configuration);
       },
       R"pbdoc(
       Returns the indices of equivalent sites.
@@ -3420,6 +4442,129 @@ PYBIND11_MODULE(_configuration, m) {
       )pbdoc",
       py::arg("configuration"));
 
+  m.def(
+      "make_asymmetric_unit_index",
+      [](config::Configuration const &configuration,
+         std::optional<std::vector<config::SupercellSymOp>> group) {
+        if (!group.has_value()) {
+          return to_array(config::make_asymmetric_unit_index(configuration));
+        }
+        return to_array(config::make_asymmetric_unit_index(
+            *group,
+            configuration.supercell->unitcellcoord_index_converter
+                .total_sites()));
+      },
+      R"pbdoc(
+      Returns the asymmetric unit index of each site.
+
+      Sites are joined in one union-find pass over the combined site
+      permutation of each operation in `group`. Asymmetric units are
+      numbered in order of their smallest linear site index, so
+      ``asymmetric_unit_indices(configuration)[i]`` are the sites with
+      ``asymmetric_unit_index == i``.
+
+      Parameters
+      ----------
+      configuration : libcasm.configuration.Configuration
+          The configuration.
+      group : Optional[list[libcasm.configuration.SupercellSymOp]] = None
+          The operations, which should form a group, that generate the orbits
+          of sites. If None, the invariant subgroup of `configuration` is
+          used.
+
+      Returns
+      -------
+      asymmetric_unit_index: numpy.ndarray[numpy.int64[n_sites]]
+          The index of the asymmetric unit containing each site, by linear
+          site index.
+      )pbdoc",
+      py::arg("configuration"), py::arg("group") = std::nullopt);
+
+  m.def("make_consistent_asymmetric_unit_indices",
+        &config::make_consistent_asymmetric_unit_indices, py::arg("initial"),
+        py::arg("configuration_init"), py::arg("reference"),
+        py::arg("configuration_ref"),
+        R"pbdoc(
+      Update asymmetric unit indices which are consistent with a reference set
+      generated for an equivalent reference configuration.
+
+      The operation found by :func:`~libcasm.configuration.find_mapping_operation`
+      maps the first site of each asymmetric unit in `initial` to a site of
+      `configuration_ref`, and the asymmetric unit is placed in the position
+      of the reference asymmetric unit that contains it.
+
+      Parameters
+      ----------
+      initial : list[list[int]]
+          The asymmetric unit indices for `configuration_init`.
+      configuration_init : libcasm.configuration.Configuration
+          The configuration for which the asymmetric unit indices are given.
+      reference : list[list[int]]
+          The asymmetric unit indices for `configuration_ref`.
+      configuration_ref : libcasm.configuration.Configuration
+          The reference configuration for which the reference asymmetric unit
+          indices are given.
+
+      Returns
+      -------
+      final : Optional[list[list[int]]]
+          The asymmetric unit indices for `configuration_init`, made consistent
+          with the `reference` indices for `configuration_ref`. If the
+          configurations are not equivalent, then None is returned.
+      )pbdoc");
+
+  m.def(
+      "make_consistent_asymmetric_unit_index",
+      [](std::vector<Index> const &initial,
+         config::Configuration const &configuration_init,
+         std::vector<Index> const &reference,
+         config::Configuration const &configuration_ref)
+          -> std::optional<py::array_t<Index>> {
+        auto final = config::make_consistent_asymmetric_unit_indices(
+            config::make_asymmetric_unit_indices(initial), configuration_init,
+            config::make_asymmetric_unit_indices(reference), configuration_ref);
+        if (!final.has_value()) {
+          return std::nullopt;
+        }
+        std::vector<Index> asymmetric_unit_index(initial.size());
+        for (Index i = 0; i < final->size(); ++i) {
+          for (Index l : (*final)[i]) {
+            asymmetric_unit_index[l] = i;
+          }
+        }
+        return to_array(asymmetric_unit_index);
+      },
+      R"pbdoc(
+      Update an asymmetric unit index array to be consistent with one for an
+      equivalent reference configuration.
+
+      This is equivalent to
+      :func:`~libcasm.configuration.make_consistent_asymmetric_unit_indices`,
+      for asymmetric units given as from
+      :func:`~libcasm.configuration.make_asymmetric_unit_index`.
+
+      Parameters
+      ----------
+      initial : numpy.ndarray[numpy.int64[n_sites]]
+          The asymmetric unit index of each site of `configuration_init`.
+      configuration_init : libcasm.configuration.Configuration
+          The configuration for which `initial` is given.
+      reference : numpy.ndarray[numpy.int64[n_sites_ref]]
+          The asymmetric unit index of each site of `configuration_ref`.
+      configuration_ref : libcasm.configuration.Configuration
+          The reference configuration for which `reference` is given.
+
+      Returns
+      -------
+      final : Optional[numpy.ndarray[numpy.int64[n_sites]]]
+          The asymmetric unit index of each site of `configuration_init`,
+          numbered so that sites with index ``i`` are equivalent to the sites
+          of `configuration_ref` with reference index ``i``. If the
+          configurations are not equivalent, then None is returned.
+      )pbdoc",
+      py::arg("initial"), py::arg("configuration_init"), py::arg("reference"),
+      py::arg("configuration_ref"));
+
   // ConfigurationWithProperties -- define functions
   pyConfigurationWithProperties
       .def(py::init<config::Configuration const &,
@@ -3522,6 +4667,15 @@ PYBIND11_MODULE(_configuration, m) {
            [](config::ConfigurationWithProperties const &self, py::dict) {
              return config::ConfigurationWithProperties(self);
            })
+      .def(py::pickle(
+          [](config::ConfigurationWithProperties const &self) {
+            return configuration_getstate(self.configuration.supercell->prim,
+                                          self);
+          },
+          [](py::tuple state) {
+            return configuration_setstate<config::ConfigurationWithProperties>(
+                state);
+          }))
       .def_static(
           "from_dict",
           [](const nlohmann::json &data,
@@ -3579,6 +4733,82 @@ PYBIND11_MODULE(_configuration, m) {
               The `Configuration reference <https://prisms-center.github.io/CASMcode_docs/formats/casm/clex/Configuration/>`_ documents the expected format for Configurations."
           )pbdoc",
           py::arg("write_prim_basis") = false)
+      .def_static(
+          "from_json_str",
+          [](std::string const &json_str,
+             std::shared_ptr<config::SupercellSet> supercells) {
+            // print errors and warnings to sys.stdout
+            py::scoped_ostream_redirect redirect;
+            return std::move(
+                *config::make_from_json_string<
+                    config::ConfigurationWithProperties>(json_str,
+                                                         *supercells));
+          },
+          R"pbdoc(
+          Construct a ConfigurationWithProperties from a JSON string
+
+          Equivalent to ``ConfigurationWithProperties.from_dict(
+          json.loads(json_str), supercells)``, but records in the standard layout are read directly into DoF value
+          arrays, without constructing a Python dict or a JSON document.
+
+          Parameters
+          ----------
+          json_str : str
+              A ConfigurationWithProperties, as JSON.
+          supercells : libcasm.configuration.SupercellSet
+              A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+              supercells in order to avoid duplicates.
+
+          Returns
+          -------
+          configuration_with_properties : libcasm.configuration.ConfigurationWithProperties
+              The
+              :class:`~libcasm.configuration.ConfigurationWithProperties`
+              constructed from the JSON string.
+          )pbdoc",
+          py::arg("json_str"), py::arg("supercells"))
+      .def_static(
+          "from_bytes",
+          [](py::bytes const &data,
+             std::shared_ptr<config::SupercellSet> supercells) {
+            return config::from_bytes<config::ConfigurationWithProperties>(
+                std::string{data}, *supercells);
+          },
+          R"pbdoc(
+          Construct a ConfigurationWithProperties from the binary configuration
+          format
+
+          Parameters
+          ----------
+          data : bytes
+              The ConfigurationWithProperties, as from
+              :func:`~libcasm.configuration.ConfigurationWithProperties.to_bytes`.
+          supercells : libcasm.configuration.SupercellSet
+              A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+              supercells in order to avoid duplicates.
+
+          Returns
+          -------
+          configuration_with_properties : libcasm.configuration.ConfigurationWithProperties
+              The :class:`~libcasm.configuration.ConfigurationWithProperties`
+              constructed from the bytes.
+          )pbdoc",
+          py::arg("data"), py::arg("supercells"))
+      .def(
+          "to_bytes",
+          [](config::ConfigurationWithProperties const &self) {
+            return py::bytes(config::to_bytes(self));
+          },
+          R"pbdoc(
+          Represent the ConfigurationWithProperties in the binary configuration
+          format
+
+          Returns
+          -------
+          data : bytes
+              The ConfigurationWithProperties in the binary configuration
+              format.
+          )pbdoc")
       .def("__repr__",
            [](config::ConfigurationWithProperties const &self) {
              std::stringstream ss;
@@ -3715,6 +4945,83 @@ PYBIND11_MODULE(_configuration, m) {
           py::arg("prim"), py::arg("structure"),
           py::arg("converter") = std::string("isotropic_atomic"),
           py::arg("supercells") = std::nullopt, py::arg("magspin_tol") = 1.0)
+      .def_static(
+          "from_structures",
+          [](std::shared_ptr<config::Prim const> prim,
+             std::vector<xtal::SimpleStructure> const &structures,
+             std::string converter,
+             std::optional<std::shared_ptr<config::SupercellSet>>
+                 opt_supercells,
+             double magspin_tol, Index n_threads) {
+            std::shared_ptr<config::SupercellSet> supercells;
+            if (opt_supercells.has_value() &&
+                opt_supercells.value() != nullptr) {
+              supercells = opt_supercells.value();
+            }
+
+            std::vector<std::optional<config::ConfigurationWithProperties>>
+                result;
+            std::vector<std::string> error_messages;
+            if (converter == "isotropic_atomic") {
+              config::FromIsotropicAtomicStructure f(prim, supercells);
+              py::gil_scoped_release release;
+              result = f(structures, error_messages, n_threads);
+            } else if (converter == "discrete_magnetic_atomic") {
+              config::FromDiscreteMagneticAtomicStructure f(prim, supercells,
+                                                            magspin_tol);
+              py::gil_scoped_release release;
+              result = f(structures, error_messages, n_threads);
+            } else {
+              std::stringstream ss;
+              ss << "Error in ConfigurationWithProperties.from_structures: "
+                    "Unknown converter: "
+                 << "\" " << converter << "\".";
+              throw std::runtime_error(ss.str());
+            }
+            return std::make_pair(result, error_messages);
+          },
+          R"pbdoc(
+          Construct ConfigurationWithProperties from many Structure, in
+          parallel
+
+          Equivalent to calling :func:`ConfigurationWithProperties.from_structure`
+          for each structure, but the conversions are done in C++ using up to
+          `n_threads` threads. Errors are returned for each structure instead
+          of being raised.
+
+          Parameters
+          ----------
+          prim : :class:`~libcasm.configuration.Prim`
+              The :class:`libcasm.configuration.Prim`.
+          structures : list[:class:`~libcasm.xtal.Structure`]
+              Structures which have been mapped to supercells of `prim`.
+          converter : str = "isotropic_atomic"
+              The converter to use, as for
+              :func:`ConfigurationWithProperties.from_structure`.
+          supercells : Optional[:class:`~libcasm.configuration.SupercellSet`] = None
+              An optional :class:`~libcasm.configuration.SupercellSet`, in which
+              to hold the shared supercells of the generated configurations in
+              order to avoid duplicates. It is shared by all threads.
+          magspin_tol : float = 1.0
+              The magspin tolerance, as for
+              :func:`ConfigurationWithProperties.from_structure`.
+          n_threads : int = 1
+              Number of threads to use. If `n_threads <= 0`, all available
+              hardware threads are used. Results do not depend on `n_threads`.
+
+          Returns
+          -------
+          configurations_with_properties : list[Optional[:class:`ConfigurationWithProperties`]]
+              The :class:`ConfigurationWithProperties` constructed from each
+              structure, or None if it could not be constructed.
+          error_messages : list[str]
+              The error message for each structure that could not be
+              converted, or an empty string.
+          )pbdoc",
+          py::arg("prim"), py::arg("structures"),
+          py::arg("converter") = std::string("isotropic_atomic"),
+          py::arg("supercells") = std::nullopt, py::arg("magspin_tol") = 1.0,
+          py::arg("n_threads") = 1)
       .def(
           "to_structure",
           [](config::ConfigurationWithProperties const &self,
@@ -3863,6 +5170,83 @@ PYBIND11_MODULE(_configuration, m) {
       "Creates a copy of `integral_site_coordinate` and applies the symmetry "
       "operation represented by this SupercellSymOp");
 
+  m.def(
+      "copy_apply_to_occupations",
+      [](py::array_t<int, py::array::c_style | py::array::forcecast>
+             occupations,
+         std::shared_ptr<config::Supercell const> const &supercell,
+         std::optional<std::vector<config::SupercellSymOp>> supercell_symops,
+         Index n_threads) {
+        if (occupations.ndim() != 2) {
+          throw std::runtime_error(
+              "Error in copy_apply_to_occupations: occupations must be a "
+              "2-dimensional array");
+        }
+        py::ssize_t n_configs = occupations.shape(0);
+        py::ssize_t n_sites = occupations.shape(1);
+        std::vector<config::SupercellSymOp> ops;
+        if (supercell_symops.has_value()) {
+          ops = std::move(*supercell_symops);
+        } else {
+          auto it = config::SupercellSymOp::begin(supercell);
+          auto end = config::SupercellSymOp::end(supercell);
+          while (it != end) {
+            ops.push_back(*it);
+            ++it;
+          }
+        }
+        for (auto const &op : ops) {
+          if (*op.supercell() != *supercell) {
+            throw std::runtime_error(
+                "Error in copy_apply_to_occupations: supercell_symops are not "
+                "all in `supercell`");
+          }
+        }
+        py::ssize_t n_ops = ops.size();
+        py::array_t<int> result({n_ops, n_configs, n_sites});
+        Eigen::Map<Eigen::MatrixXi const> in(occupations.data(), n_sites,
+                                             n_configs);
+        Eigen::Map<Eigen::MatrixXi> out(result.mutable_data(), n_sites,
+                                        n_ops * n_configs);
+        {
+          py::gil_scoped_release release;
+          config::copy_apply_occupations(ops, in, out, n_threads);
+        }
+        return result;
+      },
+      py::arg("occupations"), py::arg("supercell"),
+      py::arg("supercell_symops") = std::nullopt, py::arg("n_threads") = 1,
+      R"pbdoc(
+      Apply many symmetry operations to many occupation vectors
+
+      Equivalent to applying each SupercellSymOp to a Configuration with each
+      occupation, using :func:`~libcasm.configuration.copy_apply`, and
+      collecting the resulting occupation, but in one call: each combined
+      site permutation is made once and applied to all occupations, occupant
+      index permutations are applied for anisotropic occupants, and work is
+      split across operations with the GIL released.
+
+      Parameters
+      ----------
+      occupations : numpy.ndarray[numpy.int32[n_configs, n_sites]]
+          Occupation values, one configuration per row.
+      supercell : libcasm.configuration.Supercell
+          The supercell of the occupations.
+      supercell_symops : Optional[list[libcasm.configuration.SupercellSymOp]] = None
+          The symmetry operations to apply, all in `supercell`. If None, all
+          operations of the supercell, as from
+          :func:`~libcasm.configuration.Supercell.symgroup_rep`, in order.
+      n_threads : int = 1
+          Number of threads to use. If less than or equal to zero, the
+          number of hardware threads is used.
+
+      Returns
+      -------
+      transformed : numpy.ndarray[numpy.int32[n_ops, n_configs, n_sites]]
+          `transformed[i, j, :]` is the occupation of the configuration
+          with occupation `occupations[j, :]` after applying operation `i`.
+      )pbdoc");
+
   m.def(
       "is_canonical_configuration",
       [](config::Configuration const &configuration,
@@ -3933,6 +5317,62 @@ PYBIND11_MODULE(_configuration, m) {
           `in_canonical_supercell == True`.
       )pbdoc");
 
+  m.def(
+      "make_canonical_configurations",
+      [](std::vector<config::Configuration> const &configurations,
+         std::optional<std::vector<config::SupercellSymOp>> subgroup,
+         Index n_threads, std::optional<Index> max_table_bytes) {
+        if (configurations.empty()) {
+          return std::vector<config::Configuration>();
+        }
+        if (subgroup.has_value()) {
+          return make_canonical_forms(configurations, subgroup->begin(),
+                                      subgroup->end(), n_threads);
+        } else {
+          return config::make_canonical_forms_by_supercell(
+              configurations, n_threads, max_table_bytes);
+        }
+      },
+      py::arg("configurations"), py::arg("subgroup") = std::nullopt,
+      py::arg("n_threads") = 1, py::arg("max_table_bytes") = std::nullopt,
+      R"pbdoc(
+      Return the canonical form of each of many configurations
+
+      This is equivalent to calling :func:`make_canonical_configuration` on
+      each configuration, but the symmetry operation permutation tables are
+      constructed once per supercell and reused for all configurations in
+      that supercell, and work may be split across threads.
+
+      If `subgroup` is not provided, configurations may be in any number of
+      supercells. They are grouped by supercell, and groups are processed
+      largest first, with large groups split across threads and small
+      groups processed concurrently.
+
+      Parameters
+      ----------
+      configurations : List[libcasm.configuration.Configuration]
+          The initial configurations. If `subgroup` is provided, all must be
+          in the same supercell as `subgroup`.
+      subgroup : Optional[List[libcasm.configuration.SupercellSymOp]] = None
+          If provided, the canonical configurations will be found with
+          respect to a subgroup of the supercell factor group instead of
+          the complete supercell factor group.
+      n_threads : int = 1
+          Number of threads to use. If less than or equal to zero, the
+          number of hardware threads is used.
+      max_table_bytes : Optional[int] = None
+          If provided, and `subgroup` is not provided, the maximum bytes of
+          permutation tables used at once. Supercells whose tables do not
+          fit are canonicalized using the supercell's bounded translation
+          permutation cache instead.
+
+      Returns
+      -------
+      canonical_configurations : List[libcasm.configuration.Configuration]
+          The canonical configurations, in the same order as
+          `configurations`.
+      )pbdoc");
+
   m.def(
       "to_canonical_configuration",
       [](config::Configuration const &configuration,
@@ -3973,6 +5413,34 @@ PYBIND11_MODULE(_configuration, m) {
       "a "
       "subgroup of the supercell factor group.");
 
+  m.def("find_mapping_operation", &config::find_mapping_operation,
+        py::arg("configuration"), py::arg("configuration_ref"),
+        R"pbdoc(
+      Find a symmetry operation that maps the configuration to an equivalent
+      reference configuration which may be in a different supercell
+
+      The first prim factor group operation that maps the superlattice of
+      `configuration` to a superlattice equivalent to that of
+      `configuration_ref` is used to copy `configuration` into the reference
+      supercell. Then the operations that make the copy and
+      `configuration_ref` canonical are combined, so only two canonical form
+      searches are needed.
+
+      Parameters
+      ----------
+      configuration : libcasm.configuration.Configuration
+          The configuration to map.
+      configuration_ref : libcasm.configuration.Configuration
+          The reference configuration to map to.
+
+      Returns
+      -------
+      mapping_op : Optional[libcasm.xtal.SymOp]
+          The symmetry operation that maps `configuration` to
+          `configuration_ref`, or None if the configurations are not
+          equivalent.
+      )pbdoc");
+
   m.def(
       "make_invariant_subgroup",
       [](std::optional<std::reference_wrapper<config::Configuration const>>
@@ -4004,10 +5472,8 @@ PYBIND11_MODULE(_configuration, m) {
                                            group->end(), which_dofs);
           } else {
             auto const &supercell = configuration->get().supercell;
-            auto begin = config::SupercellSymOp::begin(supercell);
-            auto end = config::SupercellSymOp::end(supercell);
-            return make_invariant_subgroup(configuration->get(), begin, end,
-                                           which_dofs);
+            return config::InvariantSubgroupEngine(supercell)
+                .make_invariant_subgroup(configuration->get(), which_dofs);
           }
         }
 
@@ -4063,9 +5529,8 @@ PYBIND11_MODULE(_configuration, m) {
                                   subgroup->end());
         } else {
           auto const &supercell = configuration.supercell;
-          auto begin = config::SupercellSymOp::begin(supercell);
-          auto end = config::SupercellSymOp::end(supercell);
-          return make_equivalents(configuration, begin, end);
+          return config::InvariantSubgroupEngine(supercell).make_equivalents(
+              configuration);
         }
       },
       py::arg("configuration"), py::arg("subgroup") = std::nullopt,
@@ -4073,15 +5538,128 @@ PYBIND11_MODULE(_configuration, m) {
       "respect to the supercell factor group (default) or a subgroup of the "
       "supercell factor group.");
 
+  m.def(
+      "symmetrize_properties",
+      [](config::ConfigurationWithProperties &configuration_with_properties,
+         std::optional<std::vector<config::SupercellSymOp>> group,
+         std::set<std::string> which_dofs) {
+        py::gil_scoped_release gil_release;
+        if (group.has_value()) {
+          config::symmetrize_properties(configuration_with_properties,
+                                        group.value());
+        } else {
+          auto const &configuration =
+              configuration_with_properties.configuration;
+          config::symmetrize_properties(
+              configuration_with_properties,
+              config::InvariantSubgroupEngine(configuration.supercell)
+                  .make_invariant_subgroup(configuration, which_dofs));
+        }
+      },
+      py::arg("configuration_with_properties"), py::arg("group") = std::nullopt,
+      py::arg("which_dofs") = std::set<std::string>({"all"}),
+      R"pbdoc(
+      Average the properties of a configuration over a group of operations, \
+      in place
+
+      Gives the same result as replacing each property by its average over \
+      `group` of :func:`~libcasm.configuration.copy_apply`, without \
+      copying the configuration. The configuration itself is not changed.
+
+      Parameters
+      ----------
+      configuration_with_properties: \
+      libcasm.configuration.ConfigurationWithProperties
+          The configuration and properties. Local and global properties are \
+          replaced by their symmetrized values.
+      group: Optional[list[libcasm.configuration.SupercellSymOp]] = None
+          The operations, which should leave the configuration invariant. By \
+          default, the invariant subgroup of the configuration is used.
+      which_dofs: set[str] = set(["all"])
+          The DoF types considered when finding the default invariant \
+          subgroup.
+      )pbdoc");
+
+  m.def(
+      "symmetrize_properties_batch",
+      [](std::vector<config::ConfigurationWithProperties> configurations,
+         std::optional<std::vector<std::vector<config::SupercellSymOp>>>
+             groups,
+         std::set<std::string> which_dofs, Index n_threads) {
+        py::gil_scoped_release gil_release;
+        if (groups.has_value()) {
+          config::symmetrize_properties(configurations, groups.value(),
+                                        n_threads);
+        } else {
+          config::symmetrize_properties(configurations, which_dofs, n_threads);
+        }
+        return configurations;
+      },
+      py::arg("configurations"), py::arg("groups") = std::nullopt,
+      py::arg("which_dofs") = std::set<std::string>({"all"}),
+      py::arg("n_threads") = 1,
+      R"pbdoc(
+      Symmetrize the properties of many configurations
+
+      Parameters
+      ----------
+      configurations: list[libcasm.configuration.ConfigurationWithProperties]
+          The configurations and properties.
+      groups: Optional[list[list[libcasm.configuration.SupercellSymOp]]] = None
+          The operations used for each configuration. By default, the \
+          invariant subgroup of each configuration is used, with symmetry \
+          data for each supercell prepared once.
+      which_dofs: set[str] = set(["all"])
+          The DoF types considered when finding the default invariant \
+          subgroups.
+      n_threads: int = 1
+          Number of threads. If <= 0, use the hardware concurrency.
+
+      Returns
+      -------
+      symmetrized: list[libcasm.configuration.ConfigurationWithProperties]
+          Copies of `configurations`, with symmetrized properties.
+      )pbdoc");
+
+  py::class_<config::MotifTilingMapCache,
+             std::shared_ptr<config::MotifTilingMapCache>>(
+      m, "MotifTilingMapCache", R"pbdoc(
+      Stores motif tiling maps in memory, keyed by their inputs
+
+      A motif tiling map stores, for each site in a supercell, the index of the
+      site in a motif configuration's supercell that it is copied from, and the
+      symmetry representation used to transform the copied values. A
+      MotifTilingMapCache can be passed to
+      :func:`~libcasm.configuration.copy_configuration` and
+      :func:`~libcasm.configuration.copy_transformed_configuration` so that
+      copying many motif configurations with the same supercell into the same
+      supercell constructs the map once and then copies DoF values with a
+      simple gather. Supercells are compared by value.
+      )pbdoc")
+      .def(py::init<>(), R"pbdoc(
+          .. rubric:: Constructor
+
+          Construct an empty MotifTilingMapCache.
+          )pbdoc")
+      .def("size", &config::MotifTilingMapCache::size,
+           "Return the number of stored motif tiling maps.")
+      .def("clear", &config::MotifTilingMapCache::clear,
+           "Erase the stored motif tiling maps.");
+
   m.def(
       "copy_configuration",
       [](config::Configuration const &motif,
          std::shared_ptr<config::Supercell const> const &supercell,
-         Eigen::Vector3l origin) {
+         Eigen::Vector3l origin,
+         std::shared_ptr<config::MotifTilingMapCache> cache) {
+        if (cache) {
+          return cache->make(motif.supercell, supercell, xtal::UnitCell(origin))
+              ->apply(motif);
+        }
         return copy_configuration(motif, supercell, xtal::UnitCell(origin));
       },
       py::arg("motif"), py::arg("supercell"),
-      py::arg("origin") = Eigen::Vector3l::Zero(),
+      py::arg("origin") = Eigen::Vector3l::Zero(), py::arg("cache") = nullptr,
       R"pbdoc(
       Copy motif configuration DoF values into a supercell
 
@@ -4094,6 +5672,11 @@ PYBIND11_MODULE(_configuration, m) {
       origin : array_like of int, shape=(3,)
           The UnitCell indicating which unit cell in the initial configuration
           is the origin in new configuration
+      cache: Optional[:class:`~libcasm.configuration.MotifTilingMapCache`] = None
+          If provided, the map from supercell sites to motif sites is reused if
+          one with the same motif supercell, supercell, and origin was made by
+          a previous call using the same cache, and otherwise it is stored in
+          the cache.
       )pbdoc");
 
   m.def(
@@ -4159,13 +5742,20 @@ PYBIND11_MODULE(_configuration, m) {
       [](Index prim_factor_group_index, Eigen::Vector3l const &translation,
          config::Configuration const &motif,
          std::shared_ptr<config::Supercell const> const &supercell,
-         Eigen::Vector3l origin) {
+         Eigen::Vector3l origin,
+         std::shared_ptr<config::MotifTilingMapCache> cache) {
+        if (cache) {
+          return cache
+              ->make(prim_factor_group_index, translation, motif.supercell,
+                     supercell, xtal::UnitCell(origin))
+              ->apply(motif);
+        }
         return copy_configuration(prim_factor_group_index, translation, motif,
                                   supercell, xtal::UnitCell(origin));
       },
       py::arg("prim_factor_group_index"), py::arg("translation"),
       py::arg("motif"), py::arg("supercell"),
-      py::arg("origin") = Eigen::Vector3l::Zero(),
+      py::arg("origin") = Eigen::Vector3l::Zero(), py::arg("cache") = nullptr,
       R"pbdoc(
       Copy transformed motif configuration DoF values into a supercell
 
@@ -4191,6 +5781,11 @@ PYBIND11_MODULE(_configuration, m) {
       origin : array_like of int, shape=(3,)
           The UnitCell indicating which unit cell in the initial configuration
           is the origin in new configuration
+      cache: Optional[:class:`~libcasm.configuration.MotifTilingMapCache`] = None
+          If provided, the map from supercell sites to motif sites is reused if
+          one with the same prim factor group operation, translation, motif
+          supercell, supercell, and origin was made by a previous call using
+          the same cache, and otherwise it is stored in the cache.
       )pbdoc");
 
   m.def(
@@ -4271,11 +5866,397 @@ PYBIND11_MODULE(_configuration, m) {
             with `motif`, but may not be generated from each other using SupercellSymOp.
         )pbdoc");
 
+  m.def(
+      "make_distinct_super_configurations_in_supercells",
+      [](config::Configuration const &motif,
+         std::vector<std::shared_ptr<config::Supercell const>> const
+             &supercells,
+         Index n_threads) {
+        py::gil_scoped_release release;
+        return config::make_distinct_super_configurations(motif, supercells,
+                                                          n_threads);
+      },
+      py::arg("motif"), py::arg("supercells"), py::arg("n_threads") = 1,
+      R"pbdoc(
+        Make configurations that fill each of many supercells and are equivalent
+        with respect to the prim factor group, but distinct by supercell factor
+        group operations
+
+        Gives the same result as calling
+        :func:`~libcasm.configuration.make_distinct_super_configurations` for each
+        supercell, but the primitive motif is made once, the prim factor group
+        operations that generate distinct orientations are found once for each
+        distinct supercell factor group, and supercells are filled in parallel.
+
+        Parameters
+        ----------
+        motif : libcasm.configuration.Configuration
+            The initial configuration, with DoF values to be filled into the
+            supercells.
+        supercells : list[libcasm.configuration.Supercell]
+            The supercells to be filled by the motif configuration.
+        n_threads : int = 1
+            Number of threads to use. If `n_threads <= 0`, use the number of
+            hardware threads. The result does not depend on `n_threads`.
+
+        Returns
+        -------
+        distinct : list[list[libcasm.configuration.Configuration]]
+            The configurations ``distinct[i]`` are the same as
+            ``make_distinct_super_configurations(motif, supercells[i])``.
+        )pbdoc");
+
+  m.def(
+      "make_fixed_orientation_super_configurations",
+      [](config::Configuration const &motif,
+         std::vector<std::shared_ptr<config::Supercell const>> const
+             &supercells,
+         config::DistinctConfigurationFinder &finder,
+         std::shared_ptr<config::SupercellSet> supercell_set,
+         Index n_threads) {
+        py::gil_scoped_release release;
+        return config::make_fixed_orientation_super_configurations(
+            motif, supercells, finder, supercell_set.get(), n_threads);
+      },
+      py::arg("motif"), py::arg("supercells"), py::arg("finder"),
+      py::arg("supercell_set") = nullptr, py::arg("n_threads") = 1,
+      R"pbdoc(
+        Make distinct super configurations of a motif, without changing the
+        orientation of the motif, in all supercells equivalent to those given
+
+        Equivalent supercells are constructed, and super configurations are made
+        and their fingerprints calculated, in parallel. Then super
+        configurations are inserted into `finder` in order, so the result is the
+        same as by :func:`SuperConfigEnum.by_supercell_list
+        <libcasm.enumerate.SuperConfigEnum.by_supercell_list>`.
+
+        Parameters
+        ----------
+        motif : libcasm.configuration.Configuration
+            The configuration to generate super configurations from.
+        supercells : list[libcasm.configuration.Supercell]
+            The initial supercells, from which equivalent supercells are
+            generated and filled with the motif.
+        finder : libcasm.configuration.DistinctConfigurationFinder
+            Finds distinct configurations. Configurations already inserted in
+            `finder` are excluded.
+        supercell_set : Optional[libcasm.configuration.SupercellSet] = None
+            If not None, equivalent supercells are added to the set, and super
+            configurations use the supercells in the set.
+        n_threads : int = 1
+            Number of threads to use. If `n_threads <= 0`, use the number of
+            hardware threads. The result does not depend on `n_threads`.
+
+        Returns
+        -------
+        configurations : list[libcasm.configuration.Configuration]
+            The distinct super configurations. Configurations might not be in
+            the canonical supercell.
+        )pbdoc");
+
+  py::class_<config::SuperConfigurationGenerator>(m,
+                                                  "SuperConfigurationGenerator",
+                                                  R"pbdoc(
+      Generates all equivalent configurations with respect to the prim factor
+      group that fill a supercell, one at a time
+
+      This generates the same configurations as
+      :func:`~libcasm.configuration.make_all_super_configurations`, without
+      storing them all. Subsets of configurations that may be generated from
+      each other using SupercellSymOp are generated in the same order as by
+      :func:`~libcasm.configuration.make_all_super_configurations_by_subsets`,
+      but within a subset configurations are not sorted.
+
+      Example:
+
+      .. code-block:: Python
+
+          generator = SuperConfigurationGenerator(motif, supercell)
+          for configuration in generator:
+              ...
+
+      )pbdoc")
+      .def(py::init<config::Configuration const &,
+                    std::shared_ptr<config::Supercell const> const &, Index,
+                    Index>(),
+           py::arg("motif"), py::arg("supercell"), py::arg("batch_size") = 1,
+           py::arg("n_threads") = 1,
+           R"pbdoc(
+      .. rubric:: Constructor
+
+      Parameters
+      ----------
+      motif : libcasm.configuration.Configuration
+          The initial configuration, with DoF values to be filled into the supercell.
+      supercell : libcasm.configuration.Supercell
+          The supercell to be filled by the motif configuration.
+      batch_size : int = 1
+          Number of configurations made together, and held until they are
+          returned. Memory usage is proportional to `batch_size`.
+      n_threads : int = 1
+          Number of threads used to make each batch of configurations. If
+          `n_threads <= 0`, use the number of hardware threads. The order of
+          the generated configurations does not depend on `batch_size` or
+          `n_threads`.
+      )pbdoc")
+      .def("supercell", &config::SuperConfigurationGenerator::supercell,
+           "Returns the supercell being filled.")
+      .def("n_subsets", &config::SuperConfigurationGenerator::n_subsets,
+           "Returns the number of distinct configurations, as given by "
+           ":func:`~libcasm.configuration.make_distinct_super_configurations`, "
+           "which is the number of subsets.")
+      .def("subset_index", &config::SuperConfigurationGenerator::subset_index,
+           "Returns the index of the subset of the configuration most recently "
+           "generated, or -1 if no configuration has been generated.")
+      .def(
+          "__iter__",
+          [](config::SuperConfigurationGenerator &generator)
+              -> config::SuperConfigurationGenerator & { return generator; },
+          py::return_value_policy::reference_internal)
+      .def("__next__", [](config::SuperConfigurationGenerator &generator) {
+        config::Configuration configuration(generator.supercell());
+        if (!generator.next(configuration)) {
+          throw py::stop_iteration();
+        }
+        return configuration;
+      });
+
+  py::class_<config::InvariantFingerprintCalculator,
+             std::shared_ptr<config::InvariantFingerprintCalculator>>(
+      m, "InvariantFingerprintCalculator", R"pbdoc(
+      Makes hashes of configurations that are invariant with respect to prim
+      factor group operations and translations
+
+      The fingerprint combines the supercell volume, the number of sites
+      occupied by each site-occupant orbit (an orbit of (sublattice,
+      occupant) pairs under the prim factor group), and, for point, pair, and
+      triplet cluster orbits with max length up to the shortest prim lattice
+      vector, the number of clusters with each sorted list of site-occupant
+      orbit indices.
+
+      Equivalent configurations always have the same fingerprint. Continuous
+      DoF values do not contribute to the fingerprint.
+      )pbdoc")
+      .def(py::init([](std::shared_ptr<config::Prim const> const &prim) {
+             return std::make_shared<config::InvariantFingerprintCalculator>(
+                 prim);
+           }),
+           py::arg("prim"), R"pbdoc(
+      .. rubric:: Constructor
+
+      Parameters
+      ----------
+      prim : libcasm.configuration.Prim
+          The prim.
+      )pbdoc")
+      .def("n_site_occupant_orbits",
+           &config::InvariantFingerprintCalculator::n_site_occupant_orbits,
+           "Returns the number of site-occupant orbits.")
+      .def("site_occupant_orbit_index",
+           &config::InvariantFingerprintCalculator::site_occupant_orbit_index,
+           py::arg("sublattice_index"), py::arg("occupant_index"),
+           "Returns the index of the site-occupant orbit of an occupant on a "
+           "sublattice.")
+      .def(
+          "__call__",
+          [](config::InvariantFingerprintCalculator const &calculator,
+             config::Configuration const &configuration) {
+            return calculator(configuration);
+          },
+          py::arg("configuration"),
+          "Returns the fingerprint, as an int, of a configuration.");
+
+  py::class_<config::DistinctConfigurationFinder>(
+      m, "DistinctConfigurationFinder", R"pbdoc(
+      Finds distinct configurations, making canonical forms only for
+      configurations with matching fingerprints
+
+      If no configuration already found has the same fingerprint (see
+      :class:`InvariantFingerprintCalculator`) as an inserted configuration,
+      it is distinct and no canonical form is made. Otherwise, canonical
+      forms are compared.
+      )pbdoc")
+      .def(py::init(
+               [](std::shared_ptr<config::InvariantFingerprintCalculator> const
+                      &calculator,
+                  bool in_canonical_supercell) {
+                 return config::DistinctConfigurationFinder(
+                     calculator, in_canonical_supercell);
+               }),
+           py::arg("calculator"), py::arg("in_canonical_supercell") = true,
+           R"pbdoc(
+      .. rubric:: Constructor
+
+      Parameters
+      ----------
+      calculator : libcasm.configuration.InvariantFingerprintCalculator
+          Calculates configuration fingerprints.
+      in_canonical_supercell : bool = True
+          If True, configurations are equivalent if they are equivalent with
+          respect to the prim factor group, possibly in different supercells.
+          If False, configurations are only equivalent if they have the same
+          supercell and are equivalent with respect to the supercell factor
+          group.
+      )pbdoc")
+      .def(
+          "insert",
+          [](config::DistinctConfigurationFinder &finder,
+             config::Configuration const &configuration) {
+            return finder.insert(configuration);
+          },
+          py::arg("configuration"),
+          "Inserts a configuration, if it is not equivalent to a "
+          "configuration already found. Returns True if inserted.")
+      .def("configurations",
+           &config::DistinctConfigurationFinder::configurations,
+           "Returns the distinct configurations, in the order inserted.")
+      .def("n_canonical_forms",
+           &config::DistinctConfigurationFinder::n_canonical_forms,
+           "Returns the number of canonical forms made.");
+
+  m.def(
+      "make_atomic_structure_batch",
+      [](std::vector<config::Configuration> const &configurations,
+         std::string atom_type_naming_method,
+         std::vector<std::string> const &excluded_species, Index n_threads) {
+        config::AtomicStructureBatch batch;
+        {
+          py::gil_scoped_release release;
+          std::set<std::string> _excluded_species(excluded_species.begin(),
+                                                  excluded_species.end());
+          config::ToAtomicStructure f(atom_type_naming_method,
+                                      _excluded_species);
+          batch = f.make_batch(configurations, n_threads);
+        }
+        py::dict results;
+        results["lattice_column_vector_matrix"] = batch.lat_column_mat;
+        results["atom_offset"] =
+            Eigen::Map<Eigen::Matrix<Index, Eigen::Dynamic, 1> const>(
+                batch.atom_offset.data(), batch.atom_offset.size());
+        results["atom_coordinate_cart"] = batch.coords;
+        results["atom_type_index"] = batch.atom_type;
+        results["atom_type_names"] = batch.atom_type_names;
+        results["site_index"] =
+            Eigen::Map<Eigen::Matrix<Index, Eigen::Dynamic, 1> const>(
+                batch.site_index.data(), batch.site_index.size());
+        return results;
+      },
+      R"pbdoc(
+      Convert many configurations of one supercell to atomic structures,
+      stored as contiguous arrays
+
+      This gives the same lattice vectors, atom types, and atom coordinates
+      as :func:`Configuration.to_structure` with ``converter="atomic"``, for
+      each configuration, without constructing a
+      :class:`~libcasm.xtal.Structure` for each. Ideal site coordinates are
+      computed once for the supercell, and displacement and strain are
+      applied to all atoms of a configuration with matrix operations. Only
+      occupation, displacement, and strain DoF are included.
+
+      Parameters
+      ----------
+      configurations : list[Configuration]
+          Configurations, all of the same supercell.
+      atom_type_naming_method : str = "chemical_name"
+          How to name atom types, as for :func:`Configuration.to_structure`.
+      excluded_species : list[str] = ["Va", "VA", "va"]
+          Occupant names that are not included as atoms.
+      n_threads : int = 1
+          The number of threads used. If <= 0, use the hardware concurrency.
+
+      Returns
+      -------
+      batch : dict
+          With keys:
+
+          - "lattice_column_vector_matrix": numpy.ndarray[numpy.float64[3, 3 * n_configurations]],
+            where columns ``[3*k, 3*k+3)`` are the lattice vectors of
+            configuration ``k``.
+          - "atom_offset": numpy.ndarray[numpy.int64[n_configurations + 1]],
+            where configuration ``k`` has atoms ``atom_offset[k]`` through
+            ``atom_offset[k+1]-1``.
+          - "atom_coordinate_cart": numpy.ndarray[numpy.float64[3, n_atoms]],
+            the Cartesian coordinates of all atoms, as columns.
+          - "atom_type_index": numpy.ndarray[numpy.int32[n_atoms]], the
+            index in "atom_type_names" of the type of each atom.
+          - "atom_type_names": list[str], the atom type names.
+          - "site_index": numpy.ndarray[numpy.int64[n_atoms]], the linear
+            site index of each atom.
+      )pbdoc",
+      py::arg("configurations"),
+      py::arg("atom_type_naming_method") = std::string("chemical_name"),
+      py::arg("excluded_species") =
+          std::vector<std::string>({"Va", "VA", "va"}),
+      py::arg("n_threads") = 1);
+
   m.def("is_primitive_configuration", &config::is_primitive,
         py::arg("configuration"),
         "Return true if no translations within the supercell result in the "
         "same configuration");
 
+  py::class_<config::PrimitiveConfigurationChecker,
+             std::shared_ptr<config::PrimitiveConfigurationChecker>>(
+      m, "PrimitiveConfigurationChecker", R"pbdoc(
+      Checks if configurations are primitive, using only the supercell
+      translations of prime order
+
+      A configuration is non-primitive if and only if a translation of prime
+      order leaves it invariant, and only one translation generating each
+      subgroup of prime order needs to be checked. These are found from the
+      Smith normal form of the supercell transformation matrix, and are
+      usually far fewer than the number of translations. For configurations
+      with only occupation DoF, each comparison stops at the first site with
+      a different occupation, which makes the check cheap enough to apply to
+      every configuration of an enumeration before canonicalization.
+      )pbdoc")
+      .def(py::init<std::shared_ptr<config::Supercell const> const &>(),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          supercell : libcasm.configuration.Supercell
+              The supercell of the configurations to be checked.
+          )pbdoc",
+           py::arg("supercell"))
+      .def("supercell", &config::PrimitiveConfigurationChecker::supercell,
+           "Return the supercell.")
+      .def("translation_indices",
+           &config::PrimitiveConfigurationChecker::translation_indices,
+           "Return the indices of the translations that are checked, one "
+           "generating each subgroup of prime order.")
+      .def("is_primitive",
+           &config::PrimitiveConfigurationChecker::is_primitive,
+           py::arg("configuration"),
+           "Return true if no translations within the supercell result in "
+           "the same configuration. Gives the same result as "
+           ":func:`~libcasm.configuration.is_primitive_configuration`.");
+
+  m.def("find_translation_indices", &config::find_translation_indices,
+        py::arg("from_config"), py::arg("to_config"), R"pbdoc(
+      Return the indices of the supercell translations that map one
+      configuration onto another
+
+      Candidate translations are found from the occupation using a
+      Fourier transform over the supercell translations, in
+      O(n_sites * log(n_unitcells)), and only those are fully compared.
+
+      Parameters
+      ----------
+      from_config : libcasm.configuration.Configuration
+          The configuration that is translated.
+      to_config : libcasm.configuration.Configuration
+          The target configuration, in the same supercell as
+          `from_config`.
+
+      Returns
+      -------
+      translation_indices : list[int]
+          Translation indices, `t`, in increasing order, for which
+          ``SupercellSymOp(supercell, 0, t) * from_config`` is
+          equivalent to `to_config`.
+      )pbdoc");
+
   m.def(
       "make_primitive_configuration",
       [](config::Configuration const &configuration) {
@@ -4287,6 +6268,57 @@ PYBIND11_MODULE(_configuration, m) {
       "`in_canonical_supercell=True` aftwards to obtain the "
       "primitive canonical configuration in the canonical supercell.");
 
+  m.def(
+      "make_supercell_symop_arrays",
+      [](std::vector<config::SupercellSymOp> const &group) {
+        py::ssize_t n = group.size();
+        py::array_t<double> matrix({n, py::ssize_t(3), py::ssize_t(3)});
+        py::array_t<double> translation({n, py::ssize_t(3)});
+        py::array_t<bool> time_reversal(n);
+        auto M = matrix.mutable_unchecked<3>();
+        auto tau = translation.mutable_unchecked<2>();
+        auto tr = time_reversal.mutable_unchecked<1>();
+        {
+          py::gil_scoped_release release;
+          for (py::ssize_t k = 0; k < n; ++k) {
+            xtal::SymOp op = group[k].to_symop();
+            for (py::ssize_t i = 0; i < 3; ++i) {
+              for (py::ssize_t j = 0; j < 3; ++j) {
+                M(k, i, j) = op.matrix(i, j);
+              }
+              tau(k, i) = op.translation(i);
+            }
+            tr(k) = op.is_time_reversal_active;
+          }
+        }
+        return py::make_tuple(matrix, translation, time_reversal);
+      },
+      py::arg("group"), R"pbdoc(
+      Return the Cartesian symmetry operations of a list of
+      SupercellSymOp as stacked arrays
+
+      This is equivalent to calling :func:`SupercellSymOp.to_symop` for
+      each element of `group`, using the Cartesian supercell translations
+      stored by the supercell, but without constructing any
+      :class:`~libcasm.xtal.SymOp`.
+
+      Parameters
+      ----------
+      group : list[libcasm.configuration.SupercellSymOp]
+          The supercell symmetry operations.
+
+      Returns
+      -------
+      matrix : numpy.ndarray[numpy.float64[n, 3, 3]]
+          The point transformation matrices, ``matrix[k]``, of the
+          operations.
+      translation : numpy.ndarray[numpy.float64[n, 3]]
+          The Cartesian translations, ``translation[k]``, of the
+          operations.
+      time_reversal : numpy.ndarray[numpy.bool[n]]
+          True for operations that include time reversal.
+      )pbdoc");
+
   m.def(
       "make_global_dof_matrix_rep",
       [](std::vector<config::SupercellSymOp> const &group, config::DoFKey key) {
@@ -4312,7 +6344,45 @@ PYBIND11_MODULE(_configuration, m) {
       "specified by `site_indices` (a set of linear index of sites in "
       "the supercell).");
 
-  m.def("make_dof_space_rep", &config::make_dof_space_rep, R"pbdoc(
+  py::class_<config::DoFSpaceRepCache,
+             std::shared_ptr<config::DoFSpaceRepCache>>(m, "DoFSpaceRepCache",
+                                                        R"pbdoc(
+      Stores DoF space matrix representations in memory, keyed by their inputs
+
+      A DoFSpaceRepCache can be passed to
+      :func:`~libcasm.configuration.make_dof_space_rep` so that repeated
+      calls with the same supercell, group elements, and DoF space reuse the
+      matrix representation. DoF space bases are compared using `abs_tol`.
+      )pbdoc")
+      .def(py::init<double>(), R"pbdoc(
+
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          abs_tol: float = :data:`~libcasm.casmglobal.TOL`
+              The absolute tolerance used to compare DoF space bases.
+          )pbdoc",
+           py::arg("abs_tol") = CASM::TOL)
+      .def("abs_tol", &config::DoFSpaceRepCache::tol,
+           "Return the absolute tolerance used to compare inputs.")
+      .def("size", &config::DoFSpaceRepCache::size,
+           "Return the number of stored matrix representations.")
+      .def("clear", &config::DoFSpaceRepCache::clear,
+           "Erase the stored matrix representations.");
+
+  m.def(
+      "make_dof_space_rep",
+      [](std::vector<config::SupercellSymOp> const &group,
+         clexulator::DoFSpace const &dof_space,
+         std::shared_ptr<config::DoFSpaceRepCache> cache)
+          -> std::vector<Eigen::MatrixXd> {
+        if (cache) {
+          return *cache->make(group, dof_space);
+        }
+        return config::make_dof_space_rep(group, dof_space);
+      },
+      R"pbdoc(
       Make the matrix representation of a group for transforming values in the DoF
       space basis
 
@@ -4325,6 +6395,10 @@ PYBIND11_MODULE(_configuration, m) {
           freedom (DoF) basis, `x_subspace` according to
           ``x_prim = dof_space.basis @ x_subspace``, where `x_prim` is a vector in the
           prim DoF basis.
+      cache: Optional[:class:`~libcasm.configuration.DoFSpaceRepCache`] = None
+          If provided, the matrix representation is reused if one with the same
+          supercell, group elements, and DoF space was made by a previous call
+          using the same cache, and otherwise it is stored in the cache.
 
       Returns
       -------
@@ -4333,7 +6407,7 @@ PYBIND11_MODULE(_configuration, m) {
           ``x_subspace_after = M @ x_subspace_before``.
 
       )pbdoc",
-        py::arg("group"), py::arg("dof_space"));
+      py::arg("group"), py::arg("dof_space"), py::arg("cache") = nullptr);
 
   //
   py::class_<config::ConfigSpaceAnalysisResults>(m,
@@ -4443,6 +6517,31 @@ PYBIND11_MODULE(_configuration, m) {
           supercell site index (the key).
       tol : float = libcasm.TOL
           Tolerance used for identifying zero-valued eigenvalues.
+      store_equivalents : bool = True
+          If True, store the equivalent configurations and their DoF values in
+          the results. If False, the projector is accumulated while equivalent
+          configurations are generated, and they are not stored, so memory
+          usage does not increase with the number of equivalent
+          configurations. The projector is the same, up to floating point
+          rounding.
+      n_threads : int = 1
+          Number of threads used to construct normal coordinates and
+          accumulate the projector. If `n_threads <= 0`, use the number of
+          hardware threads. The results do not depend on `n_threads`.
+      max_supercell_volume : Optional[int] = None
+          If provided, raise before constructing the fully commensurate
+          supercell if its volume, as a multiple of the prim volume, is
+          greater than this value.
+      use_prototype_supercells : bool = False
+          If True, the equivalents of each configuration are generated in the
+          smallest supercell commensurate with it and its point group images,
+          and their projector contributions are mapped into the standard DoF
+          space of the fully commensurate supercell. That supercell is then
+          only used for its transformation matrix, so its symmetry operations
+          and the equivalent configurations in it are not constructed. This
+          is much faster when the input configurations have incompatible
+          shapes. The projector is the same, up to floating point rounding.
+          Requires `store_equivalents` to be False.
 
       Returns
       -------
@@ -4456,22 +6555,195 @@ PYBIND11_MODULE(_configuration, m) {
         py::arg("include_default_occ_modes") = false,
         py::arg("sublattice_index_to_default_occ") = std::nullopt,
         py::arg("site_index_to_default_occ") = std::nullopt,
-        py::arg("tol") = CASM::TOL);
+        py::arg("tol") = CASM::TOL, py::arg("store_equivalents") = true,
+        py::arg("n_threads") = 1,
+        py::arg("max_supercell_volume") = std::nullopt,
+        py::arg("use_prototype_supercells") = false,
+        py::call_guard<py::gil_scoped_release>());
+
+  py::class_<config::ConfigSpaceAnalysisPartial>(m,
+                                                 "ConfigSpaceAnalysisPartial",
+                                                 R"pbdoc(
+      Partial projectors of :func:`~libcasm.configuration.config_space_analysis`,
+      for a subset of the input configurations
 
-  //
-  py::class_<config::DoFSpaceAnalysisResults>(m, "DoFSpaceAnalysisResults",
-                                              R"pbdoc(
-      Holds results from :func:`~libcasm.configuration.dof_space_analysis`.
+      The projector is a sum over configurations, so it can be accumulated for
+      disjoint subsets of the input configurations independently, for example
+      by MPI ranks, :mod:`multiprocessing` workers, or dask tasks, and the
+      partial results summed before the eigendecomposition.
+
+      .. rubric:: Example usage, with mpi4py
 
+      .. code-block:: Python
+
+          import libcasm.configuration as casmconfig
+
+          # all ranks use the supercell made from all configurations
+          supercell = casmconfig.make_config_space_analysis_supercell(
+              all_configurations
+          )
+          my_configurations = {
+              key: value
+              for i, (key, value) in enumerate(all_configurations.items())
+              if i % comm.size == comm.rank
+          }
+          partial = casmconfig.config_space_analysis_partial(
+              supercell, my_configurations, dofs=["occ"]
+          )
+          projectors = comm.gather(
+              (partial.projector, partial.n_configurations), root=0
+          )
+          if comm.rank == 0:
+              total = casmconfig.config_space_analysis_partial(
+                  supercell, {}, dofs=["occ"]
+              )
+              for projector, n_configurations in projectors:
+                  total.add_projector(projector, n_configurations)
+              results = casmconfig.finish_config_space_analysis(total)
+
+      A configuration, or equivalent configurations, included in more than one
+      subset are counted once per subset. This scales the eigenvalues, but does
+      not change the symmetry adapted space.
       )pbdoc")
-      .def(py::init<clexulator::DoFSpace, irreps::VectorSpaceSymReport>(),
+      .def_readonly("supercell", &config::ConfigSpaceAnalysisPartial::supercell,
+                    ":class:`~libcasm.configuration.Supercell`: The fully "
+                    "commensurate supercell")
+      .def_readonly("standard_dof_space",
+                    &config::ConfigSpaceAnalysisPartial::standard_dof_space,
+                    "dict[str, :class:`~libcasm.clexulator.DoFSpace`]: "
+                    "Standard DoF space, by DoF type")
+      .def_readonly("projector", &config::ConfigSpaceAnalysisPartial::projector,
+                    "dict[str, np.ndarray]: Partial projection matrix, by DoF "
+                    "type")
+      .def_readonly("n_configurations",
+                    &config::ConfigSpaceAnalysisPartial::n_configurations,
+                    "int: Number of distinct primitive configurations "
+                    "accumulated")
+      .def("merge", &config::ConfigSpaceAnalysisPartial::merge,
            R"pbdoc(
-           .. rubric:: Constructor
-           )pbdoc",
-           py::arg("symmetry_adapted_dof_space"), py::arg("symmetry_report"))
-      .def_readonly(
-          "symmetry_adapted_dof_space",
-          &config::DoFSpaceAnalysisResults::symmetry_adapted_dof_space,
+          Add the projectors of another partial result
+
+          Parameters
+          ----------
+          other : ConfigSpaceAnalysisPartial
+              Another partial result, for the same fully commensurate
+              supercell and DoF types, and a disjoint subset of
+              configurations.
+          )pbdoc",
+           py::arg("other"))
+      .def("add_projector", &config::ConfigSpaceAnalysisPartial::add_projector,
+           R"pbdoc(
+          Add partial projectors, as from another partial result
+
+          This allows partial projectors to be summed after being
+          communicated as plain arrays.
+
+          Parameters
+          ----------
+          projector : dict[str, np.ndarray]
+              Partial projection matrices, by DoF type, which must have the
+              same DoF types and shapes as `projector`.
+          n_configurations : int
+              The number of distinct primitive configurations accumulated
+              into `projector`.
+          )pbdoc",
+           py::arg("projector"), py::arg("n_configurations"));
+
+  m.def("make_config_space_analysis_supercell",
+        &config::make_config_space_analysis_supercell, R"pbdoc(
+      Make the fully commensurate supercell used by
+      :func:`~libcasm.configuration.config_space_analysis`
+
+      Partial analyses of subsets of the configurations must all use the
+      supercell made from the complete set.
+
+      Parameters
+      ----------
+      configurations : dict[str, :class:`~libcasm.configuration.Configuration`]
+          All input configurations. Must not be empty.
+      max_supercell_volume : Optional[int] = None
+          If provided, raise if the volume of the fully commensurate
+          supercell, as a multiple of the prim volume, is greater than this
+          value.
+
+      Returns
+      -------
+      supercell : :class:`~libcasm.configuration.Supercell`
+          The fully commensurate supercell.
+      )pbdoc",
+        py::arg("configurations"),
+        py::arg("max_supercell_volume") = std::nullopt);
+
+  m.def("config_space_analysis_partial", &config::config_space_analysis_partial,
+        R"pbdoc(
+      Accumulate the projectors of
+      :func:`~libcasm.configuration.config_space_analysis` for a subset of the
+      input configurations
+
+      Parameters
+      ----------
+      supercell : :class:`~libcasm.configuration.Supercell`
+          The fully commensurate supercell, as made by
+          :func:`~libcasm.configuration.make_config_space_analysis_supercell`
+          from all configurations.
+      configurations : dict[str, :class:`~libcasm.configuration.Configuration`]
+          The configurations in this subset. May be empty, which gives zero
+          projectors.
+
+      The remaining parameters are as for
+      :func:`~libcasm.configuration.config_space_analysis`, and must be the
+      same for all partial results that are merged, except `n_threads` and
+      `use_prototype_supercells`, which do not change the result beyond
+      floating point rounding.
+
+      Returns
+      -------
+      partial : ConfigSpaceAnalysisPartial
+          Partial projectors, for each requested DoF type.
+      )pbdoc",
+        py::arg("supercell"), py::arg("configurations"),
+        py::arg("dofs") = std::nullopt,
+        py::arg("exclude_homogeneous_modes") = std::nullopt,
+        py::arg("include_default_occ_modes") = false,
+        py::arg("sublattice_index_to_default_occ") = std::nullopt,
+        py::arg("site_index_to_default_occ") = std::nullopt,
+        py::arg("tol") = CASM::TOL, py::arg("n_threads") = 1,
+        py::arg("use_prototype_supercells") = false,
+        py::call_guard<py::gil_scoped_release>());
+
+  m.def("finish_config_space_analysis", &config::finish_config_space_analysis,
+        R"pbdoc(
+      Find the symmetry adapted config spaces from merged partial projectors
+
+      Parameters
+      ----------
+      partial : ConfigSpaceAnalysisPartial
+          Partial projectors, merged for all configurations.
+      tol : float = libcasm.TOL
+          Tolerance used for identifying zero-valued eigenvalues.
+
+      Returns
+      -------
+      results : dict[str, :class:`~libcasm.configuration.ConfigSpaceAnalysisResults`]
+          Results, as for :func:`~libcasm.configuration.config_space_analysis`
+          with ``store_equivalents=False``, for each DoF type.
+      )pbdoc",
+        py::arg("partial"), py::arg("tol") = CASM::TOL);
+
+  //
+  py::class_<config::DoFSpaceAnalysisResults>(m, "DoFSpaceAnalysisResults",
+                                              R"pbdoc(
+      Holds results from :func:`~libcasm.configuration.dof_space_analysis`.
+
+      )pbdoc")
+      .def(py::init<clexulator::DoFSpace, irreps::VectorSpaceSymReport>(),
+           R"pbdoc(
+           .. rubric:: Constructor
+           )pbdoc",
+           py::arg("symmetry_adapted_dof_space"), py::arg("symmetry_report"))
+      .def_readonly(
+          "symmetry_adapted_dof_space",
+          &config::DoFSpaceAnalysisResults::symmetry_adapted_dof_space,
           ":class:`~libcasm.clexulator.DoFSpace`: The symmetry adapated "
           ":class:`~libcasm.clexulator.DoFSpace`")
       .def_readonly("symmetry_report",
@@ -4510,13 +6782,18 @@ PYBIND11_MODULE(_configuration, m) {
          bool include_default_occ_modes,
          std::optional<std::map<int, int>> sublattice_index_to_default_occ,
          std::optional<std::map<Index, int>> site_index_to_default_occ,
-         bool calc_wedges) -> config::DoFSpaceAnalysisResults {
+         bool calc_wedges,
+         std::shared_ptr<irreps::IrrepDecompositionCache>
+             irrep_decomposition_cache,
+         Index n_threads,
+         bool use_kpoint_blocks) -> config::DoFSpaceAnalysisResults {
         std::optional<Log> log = std::nullopt;
         // std::optional<Log> log = Log(std::cout, Log::debug, true);
         return config::dof_space_analysis(
             dof_space, prim, configuration, exclude_homogeneous_modes,
             include_default_occ_modes, sublattice_index_to_default_occ,
-            site_index_to_default_occ, calc_wedges, log);
+            site_index_to_default_occ, calc_wedges, log,
+            irrep_decomposition_cache, n_threads, use_kpoint_blocks);
       },
       R"pbdoc(
       Construct symmetry adapted bases in a DoFSpace
@@ -4568,6 +6845,25 @@ PYBIND11_MODULE(_configuration, m) {
           If True, calculate the irreducible wedges for the vector space.
           This may take a long time, but provides the symmetrically unique
           portions of the vector space, which is useful for enumeration.
+      irrep_decomposition_cache : Optional[:class:`~libcasm.irreps.IrrepDecompositionCache`] = None
+          If provided, the irreducible space decomposition is reused if one
+          with the same matrix representation and DoF space basis was found
+          by a previous analysis using the same cache, and otherwise it is
+          stored in the cache.
+      n_threads : int = 1
+          The number of threads to use. If `use_kpoint_blocks`, k-point star
+          blocks are decomposed in parallel. If `n_threads` <= 0, the number
+          of hardware threads is used.
+      use_kpoint_blocks : bool = False
+          If True, and the DoF is local with DoFSpace sites that include
+          every translation of each sublattice included, the subspace
+          spanned by Bloch waves with k-points in each star is decomposed
+          separately, using matrices with the dimension of that subspace
+          rather than of the full DoF space. This uses much less memory and
+          time for large supercells. The resulting symmetry adapted basis
+          spans the same irreducible subspaces, but may be ordered
+          differently. Unless `calc_wedges` is True, the
+          `symgroup_rep` of the resulting symmetry report is empty.
 
 
       Returns
@@ -4584,7 +6880,1007 @@ PYBIND11_MODULE(_configuration, m) {
       py::arg("include_default_occ_modes") = false,
       py::arg("sublattice_index_to_default_occ") = std::nullopt,
       py::arg("site_index_to_default_occ") = std::nullopt,
-      py::arg("calc_wedges") = false);
+      py::arg("calc_wedges") = false,
+      py::arg("irrep_decomposition_cache") = nullptr,
+      py::arg("n_threads") = 1, py::arg("use_kpoint_blocks") = false,
+      py::call_guard<py::gil_scoped_release>());
+
+  m.def(
+      "perf_report",
+      []() -> nlohmann::json {
+        jsonParser json;
+        to_json(config::perf::make_report(), json);
+        return static_cast<nlohmann::json>(json);
+      },
+      R"pbdoc(
+      Return hot-path instrumentation counters and timers
+
+      Instrumentation is only compiled in if libcasm-configuration is built
+      with the CMake option ``CASM_CONFIGURATION_PERF=ON`` (or with
+      ``-DCASM_CONFIGURATION_PERF``). Otherwise, ``"enabled"`` is False and all
+      values are zero.
+
+      Counters and timers accumulate over all threads, from library load or
+      the last call to :func:`perf_reset`.
+
+      Returns
+      -------
+      report : dict
+          A dict with format:
+
+          .. code-block:: Python
+
+              {
+                  "enabled": bool,
+                  "counters": {
+                      "supercell_sym_op_apply": int,
+                      "config_is_equivalent_compare": int,
+                      "config_is_equivalent_early_exit": int,
+                      "config_is_equivalent_early_exit_depth": int,
+                      "translation_permutation_lookup": int,
+                      "translation_permutation_rebuild": int,
+                      "supercell_construction": int,
+                      "canonicalization": int,
+                      "orbit_candidate_tested": int,
+                      "orbit_candidate_kept": int,
+                  },
+                  "timers": {
+                      <name>: {"count": int, "total_s": float},
+                      ...
+                  },
+              }
+
+          Where:
+
+          - ``config_is_equivalent_early_exit_depth`` is the total, over
+            occupation comparisons that found a differing site, of the number
+            of sites found equal first.
+          - ``translation_permutation_lookup`` and
+            ``translation_permutation_rebuild`` count requests to, and
+            permutations constructed by, the translation permutation cache
+            used by supercells with more than `max_n_translation_permutations`
+            translations.
+          - Timers include ``to_canonical``, ``canonical_form_engine``,
+            ``make_prim_periodic_orbits``, ``make_local_orbits``,
+            ``make_distinct_perturbations``, and ``config_space_analysis``.
+      )pbdoc");
+
+  m.def("perf_reset", &config::perf::reset, R"pbdoc(
+      Set all hot-path instrumentation counters and timers to zero
+
+      See :func:`perf_report`. This should not be called while instrumented
+      operations are running in other threads.
+      )pbdoc");
+
+  m.def("set_num_threads", &config::set_num_threads, R"pbdoc(
+      Set the number of threads shared by parallel operations
+
+      Parallel operations in libcasm-configuration, and in the other
+      libcasm modules that use it, run on one process-wide thread pool. The
+      ``n_threads`` parameter of a parallel operation sets how many parts
+      its work is split into; if ``n_threads <= 0``, the number of threads
+      set here is used. At most this many threads run at once, and parallel
+      operations started from within a parallel operation run serially.
+
+      When running one process per core, as with MPI or
+      :py:mod:`multiprocessing`, use ``set_num_threads(1)`` or set the
+      environment variable ``CASM_NUM_THREADS=1``.
+
+      Parameters
+      ----------
+      n_threads : int
+          The number of threads, including the calling thread. If
+          ``n_threads <= 0``, the default is restored: the value of the
+          environment variable ``CASM_NUM_THREADS`` if set, else the number
+          of hardware threads.
+      )pbdoc",
+        py::arg("n_threads"));
+
+  m.def("get_num_threads", &config::get_num_threads, R"pbdoc(
+      Return the number of threads shared by parallel operations
+
+      See :func:`set_num_threads`.
+
+      Returns
+      -------
+      n_threads : int
+          The number of threads shared by parallel operations.
+      )pbdoc");
+
+  m.def("start_trace", &config::trace::start, R"pbdoc(
+      Start recording timeline trace events
+
+      Trace events record the duration of the major phases of supercell
+      construction, orbit generation, OccEvent counting, irrep
+      decomposition, configuration space analysis, canonicalization
+      batches, parallel tasks, and configuration file I/O, on each thread.
+      They are written by :func:`stop_trace` as Chrome trace event JSON,
+      which can be viewed with ``chrome://tracing`` or
+      https://ui.perfetto.dev.
+
+      Tracing is also started when the module is loaded if the environment
+      variable ``CASM_TRACE_FILE`` is set to a path, in which case the trace
+      is written at exit.
+
+      If a trace is already being recorded, it is stopped and written
+      first.
+
+      Parameters
+      ----------
+      path : str
+          Path of the trace file to write.
+      )pbdoc",
+        py::arg("path"));
+
+  m.def("stop_trace", &config::trace::stop, R"pbdoc(
+      Stop recording timeline trace events and write the trace file
+
+      See :func:`start_trace`. Does nothing if a trace is not being
+      recorded.
+      )pbdoc");
+
+  py::class_<ConfigurationBinaryFileWriter>(m, "ConfigurationBinaryFileWriter",
+                                            R"pbdoc(
+      Writes configurations to a file in the binary configuration format
+
+      Used by :func:`~libcasm.configuration.io.write_configuration_binary`.
+      )pbdoc")
+      .def(py::init<std::string const &>(), py::arg("path"))
+      .def(
+          "write",
+          [](ConfigurationBinaryFileWriter &self,
+             config::Configuration const &configuration) {
+            self.writer.write(configuration);
+          },
+          "Write a Configuration record", py::arg("configuration"))
+      .def(
+          "write",
+          [](ConfigurationBinaryFileWriter &self,
+             config::ConfigurationWithProperties const
+                 &configuration_with_properties) {
+            self.writer.write(configuration_with_properties);
+          },
+          "Write a ConfigurationWithProperties record",
+          py::arg("configuration_with_properties"))
+      .def(
+          "close",
+          [](ConfigurationBinaryFileWriter &self) {
+            self.out.close();
+            if (!self.out) {
+              throw std::runtime_error(
+                  "Error in ConfigurationBinaryFileWriter: write failed");
+            }
+          },
+          "Flush and close the file");
+
+  py::class_<ConfigurationBinaryFileReader>(m, "ConfigurationBinaryFileReader",
+                                            R"pbdoc(
+      Reads configurations from a file in the binary configuration format
+
+      Used by :func:`~libcasm.configuration.io.read_configuration_binary`.
+      )pbdoc")
+      .def(py::init<std::string const &,
+                    std::shared_ptr<config::SupercellSet> const &>(),
+           py::arg("path"), py::arg("supercells"))
+      .def(
+          "read_next",
+          [](ConfigurationBinaryFileReader &self)
+              -> std::optional<config::ConfigurationWithProperties> {
+            if (!self.reader.is_valid()) {
+              return std::nullopt;
+            }
+            config::ConfigurationWithProperties value = self.reader.value();
+            self.reader.advance();
+            return value;
+          },
+          R"pbdoc(
+          Return the next record, or None if there are no more records. \
+          Records without properties are returned with empty properties.
+          )pbdoc");
+
+  py::class_<config::ConfigurationBatch>(m, "ConfigurationBatch", R"pbdoc(
+      Many configurations in one supercell, stored as contiguous arrays
+
+      A ConfigurationBatch holds one shared supercell, and the occupation and
+      DoF values of all configurations in contiguous arrays, with one row per
+      configuration. The arrays are available as numpy arrays that view the
+      batch storage without copying. Array views are invalidated by
+      :func:`~ConfigurationBatch.append` and :func:`~ConfigurationBatch.clear`,
+      which may reallocate the storage.
+
+      DoF values are in the prim basis, as in
+      :class:`~libcasm.configuration.Configuration`.
+      )pbdoc")
+      .def(py::init<std::shared_ptr<config::Supercell const> const &,
+                    std::vector<config::Configuration> const &>(),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          supercell : libcasm.configuration.Supercell
+              The supercell of all configurations in the batch.
+          configurations : list[libcasm.configuration.Configuration] = []
+              Configurations to copy into the batch. All must be in
+              `supercell`.
+          )pbdoc",
+           py::arg("supercell"),
+           py::arg("configurations") = std::vector<config::Configuration>())
+      .def("supercell", &config::ConfigurationBatch::supercell,
+           "Return the shared supercell.")
+      .def("__len__", &config::ConfigurationBatch::size)
+      .def("n_sites", &config::ConfigurationBatch::n_sites,
+           "Return the number of sites in the supercell.")
+      .def("reserve", &config::ConfigurationBatch::reserve,
+           "Reserve storage for `n` configurations.", py::arg("n"))
+      .def("clear", &config::ConfigurationBatch::clear,
+           "Remove all configurations.")
+      .def("append", &config::ConfigurationBatch::push_back,
+           "Copy a configuration, which must be in the batch's supercell, "
+           "into the batch.",
+           py::arg("configuration"))
+      .def(
+          "__getitem__",
+          [](config::ConfigurationBatch const &self, Index i) {
+            if (i < 0) {
+              i += self.size();
+            }
+            if (i < 0 || i >= self.size()) {
+              throw py::index_error("ConfigurationBatch index out of range");
+            }
+            return self.configuration(i);
+          },
+          "Return a copy of the `i`-th configuration.", py::arg("i"))
+      .def(
+          "__setitem__",
+          [](config::ConfigurationBatch &self, Index i,
+             config::Configuration const &configuration) {
+            if (i < 0) {
+              i += self.size();
+            }
+            if (i < 0 || i >= self.size()) {
+              throw py::index_error("ConfigurationBatch index out of range");
+            }
+            self.set(i, configuration);
+          },
+          "Set the `i`-th configuration.", py::arg("i"),
+          py::arg("configuration"))
+      .def("to_list", &config::ConfigurationBatch::configurations,
+           "Return copies of all configurations, as a list.")
+      .def(
+          "occupation",
+          [](py::object self) {
+            auto &batch = self.cast<config::ConfigurationBatch &>();
+            return make_batch_array<int>(
+                batch.occupation().data(), {batch.size(), batch.n_sites()},
+                {batch.n_sites(), 1}, self);
+          },
+          R"pbdoc(
+          Return the occupation of all configurations, as a writable view \
+          of shape (n_configurations, n_sites).
+          )pbdoc")
+      .def(
+          "global_dof_values",
+          [](py::object self, std::string const &key) {
+            auto &batch = self.cast<config::ConfigurationBatch &>();
+            auto values = batch.global_dof_values(key);
+            return make_batch_array<double>(values.data(),
+                                            {values.rows(), values.cols()},
+                                            {values.cols(), 1}, self);
+          },
+          R"pbdoc(
+          Return the values of a global DoF, as a writable view of shape \
+          (n_configurations, dim).
+          )pbdoc",
+          py::arg("key"))
+      .def(
+          "local_dof_values",
+          [](py::object self, std::string const &key) {
+            auto &batch = self.cast<config::ConfigurationBatch &>();
+            auto values = batch.local_dof_values(key);
+            py::ssize_t dim = batch.local_dof_dim().at(key);
+            py::ssize_t n_sites = batch.n_sites();
+            return make_batch_array<double>(values.data(),
+                                            {values.rows(), dim, n_sites},
+                                            {values.cols(), 1, dim}, self);
+          },
+          R"pbdoc(
+          Return the values of a local DoF, as a writable view of shape \
+          (n_configurations, dim, n_sites).
+          )pbdoc",
+          py::arg("key"))
+      .def(
+          "set_order_parameters",
+          [](config::ConfigurationBatch &self,
+             config::Configuration const &background,
+             clexulator::DoFSpace const &dof_space,
+             Eigen::MatrixXd const &order_parameters) {
+            py::gil_scoped_release release;
+            config::set_dof_space_values(self, background, dof_space,
+                                         order_parameters.transpose());
+          },
+          R"pbdoc(
+          Replace the configurations in the batch with copies of a \
+          background configuration, with DoF values set from many order \
+          parameter values
+
+          Gives the same result as
+          :func:`Configuration.set_order_parameters
+          <libcasm.configuration.Configuration.set_order_parameters>`
+          applied to a copy of `background` for each row of
+          `order_parameters`, using one matrix product for all rows.
+
+          Parameters
+          ----------
+          background: libcasm.configuration.Configuration
+              Provides the values of all DoF not set from the DoFSpace.
+              Must be in the batch's supercell.
+          dof_space: libcasm.clexulator.DoFSpace
+              A DoFSpace with basis defining the order parameters.
+              Occupation DoFSpace are not supported.
+          order_parameters: np.ndarray
+              The order parameters, as an array of shape
+              (n_configurations, dof_space.basis.shape[1]), with one row per
+              configuration.
+          )pbdoc",
+          py::arg("background"), py::arg("dof_space"),
+          py::arg("order_parameters"))
+      .def(
+          "apply",
+          [](config::ConfigurationBatch &self,
+             config::SupercellSymOp const &op) {
+            py::gil_scoped_release release;
+            apply(op, self);
+          },
+          "Apply a symmetry operation to every configuration, in place.",
+          py::arg("op"))
+      .def(
+          "is_canonical",
+          [](config::ConfigurationBatch const &self, Index n_threads) {
+            py::gil_scoped_release release;
+            config::CanonicalFormEngine engine(self.supercell());
+            return config::is_canonical(engine, self, n_threads);
+          },
+          R"pbdoc(
+          Return, for each configuration, True if it is in canonical form \
+          with respect to the operations that leave the supercell lattice \
+          invariant. If `n_threads` <= 0, use the hardware concurrency.
+          )pbdoc",
+          py::arg("n_threads") = 1)
+      .def(
+          "make_canonical",
+          [](config::ConfigurationBatch &self, Index n_threads) {
+            py::gil_scoped_release release;
+            config::CanonicalFormEngine engine(self.supercell());
+            config::to_canonical_forms(engine, self, n_threads);
+          },
+          R"pbdoc(
+          Replace each configuration with its canonical form, with respect \
+          to the operations that leave the supercell lattice invariant, in \
+          place. If `n_threads` <= 0, use the hardware concurrency.
+          )pbdoc",
+          py::arg("n_threads") = 1);
+
+  py::class_<ColumnarDatasetFileWriter>(m, "ColumnarDatasetFileWriter",
+                                        R"pbdoc(
+      Writes configurations to a file in the columnar dataset format
+
+      Used by :func:`~libcasm.configuration.io.write_configuration_columnar`.
+      )pbdoc")
+      .def(py::init<std::string const &, Index>(), py::arg("path"),
+           py::arg("batch_size") = 1024)
+      .def(
+          "write",
+          [](ColumnarDatasetFileWriter &self,
+             config::Configuration const &configuration) {
+            self.writer.write(configuration);
+          },
+          "Write a Configuration, with no properties",
+          py::arg("configuration"))
+      .def(
+          "write",
+          [](ColumnarDatasetFileWriter &self,
+             config::ConfigurationWithProperties const
+                 &configuration_with_properties) {
+            self.writer.write(configuration_with_properties);
+          },
+          "Write a ConfigurationWithProperties",
+          py::arg("configuration_with_properties"))
+      .def(
+          "close",
+          [](ColumnarDatasetFileWriter &self) {
+            {
+              py::gil_scoped_release release;
+              self.writer.finish();
+            }
+            self.out.close();
+            if (!self.out) {
+              throw std::runtime_error(
+                  "Error in ColumnarDatasetFileWriter: write failed");
+            }
+          },
+          "Write buffered records, then flush and close the file");
+
+  py::class_<ColumnarDatasetFileReader>(m, "ColumnarDatasetFileReader",
+                                        R"pbdoc(
+      Reads configurations from a file in the columnar dataset format
+
+      Used by :func:`~libcasm.configuration.io.read_configuration_columnar`
+      and :func:`~libcasm.configuration.io.read_columnar_batches`.
+      )pbdoc")
+      .def(py::init<std::string const &,
+                    std::shared_ptr<config::SupercellSet> const &>(),
+           py::arg("path"), py::arg("supercells"))
+      .def(
+          "read_batch",
+          [](ColumnarDatasetFileReader &self)
+              -> std::optional<
+                  std::vector<config::ConfigurationWithProperties>> {
+            py::gil_scoped_release release;
+            auto batch = self.reader.read_batch();
+            if (!batch.has_value()) {
+              return std::nullopt;
+            }
+            return config::make_configurations_with_properties(*batch);
+          },
+          R"pbdoc(
+          Return the records of the next batch, or None if there are no more \
+          batches.
+          )pbdoc")
+      .def(
+          "read_batch_data",
+          [](ColumnarDatasetFileReader &self) -> std::optional<py::dict> {
+            std::optional<config::ColumnarBatch> batch;
+            {
+              py::gil_scoped_release release;
+              batch = self.reader.read_batch();
+            }
+            if (!batch.has_value()) {
+              return std::nullopt;
+            }
+            return columnar_batch_to_dict(*batch);
+          },
+          R"pbdoc(
+          Return the next batch as a dict of numpy arrays, or None if there \
+          are no more batches. See \
+          :func:`~libcasm.configuration.io.read_columnar_batches`.
+          )pbdoc")
+      .def(
+          "supercell_list",
+          [](ColumnarDatasetFileReader const &self) {
+            return self.reader.supercell_list();
+          },
+          "Supercells read so far, in file order");
+
+  py::class_<config::ConfigurationDelta>(m, "ConfigurationDelta", R"pbdoc(
+      A configuration stored as its changes relative to a shared background
+
+      A ConfigurationDelta stores the occupation values, local DoF values by
+      site, and global DoF values that differ from a background
+      configuration, so that perturbations of a background that differ on a
+      few sites take little memory. The background is shared by deltas made
+      with :func:`make_configuration_deltas`, and the full configuration is
+      only constructed by :func:`ConfigurationDelta.make_configuration`.
+
+      DoF values are in the prim basis, as in
+      :class:`~libcasm.configuration.Configuration`. Deltas sort by
+      background and then by their changes, which is generally not the
+      order of the expanded configurations.
+      )pbdoc")
+      .def(py::init([](config::Configuration const &background,
+                       config::Configuration const &configuration) {
+             return config::make_configuration_delta(
+                 std::make_shared<config::Configuration const>(background),
+                 configuration);
+           }),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Use :func:`make_configuration_deltas` for many configurations, so
+          that they share one copy of the background.
+
+          Parameters
+          ----------
+          background : libcasm.configuration.Configuration
+              The background configuration, which is copied.
+          configuration : libcasm.configuration.Configuration
+              A configuration in the same supercell as `background`.
+          )pbdoc",
+           py::arg("background"), py::arg("configuration"))
+      .def(
+          "background",
+          [](config::ConfigurationDelta const &self) {
+            return *self.background;
+          },
+          "Return a copy of the background configuration.")
+      .def("n_changes", &config::ConfigurationDelta::size,
+           "Return the number of stored changes.")
+      .def(
+          "occupation_changes",
+          [](config::ConfigurationDelta const &self) {
+            return self.occupation;
+          },
+          "Return the changed occupation values, as a list of (linear site "
+          "index, occupant index).")
+      .def(
+          "make_configuration",
+          [](config::ConfigurationDelta const &self) {
+            return config::make_configuration(self);
+          },
+          "Construct the configuration represented by this delta.")
+      .def(
+          "to_dict",
+          [](config::ConfigurationDelta const &self) -> nlohmann::json {
+            jsonParser json;
+            to_json(self, json);
+            return static_cast<nlohmann::json>(json);
+          },
+          "Represent the changes, without the background, as a Python dict.")
+      .def(py::self < py::self, "Sorts ConfigurationDelta.")
+      .def(py::self <= py::self, "Sorts ConfigurationDelta.")
+      .def(py::self > py::self, "Sorts ConfigurationDelta.")
+      .def(py::self >= py::self, "Sorts ConfigurationDelta.")
+      .def(py::self == py::self,
+           "True if backgrounds and changes are equal, within tolerance.")
+      .def(py::self != py::self,
+           "True if backgrounds or changes are not equal, within tolerance.");
+
+  m.def(
+      "make_configuration_deltas",
+      [](config::Configuration const &background,
+         std::vector<config::Configuration> const &configurations,
+         Index n_threads) {
+        auto shared_background =
+            std::make_shared<config::Configuration const>(background);
+        py::gil_scoped_release release;
+        return config::make_configuration_deltas(shared_background,
+                                                 configurations, n_threads);
+      },
+      R"pbdoc(
+      Make the deltas of configurations relative to one shared background
+
+      Parameters
+      ----------
+      background : libcasm.configuration.Configuration
+          The background configuration. One copy is shared by all results.
+      configurations : list[libcasm.configuration.Configuration]
+          Configurations in the same supercell as `background`.
+      n_threads : int = 1
+          Number of threads to use. If `n_threads <= 0`, all available
+          hardware threads are used. The result does not depend on
+          `n_threads`.
+
+      Returns
+      -------
+      deltas : list[ConfigurationDelta]
+          The deltas, in the order of `configurations`. Only values that
+          differ from the background by more than the prim lattice tolerance
+          are stored.
+      )pbdoc",
+      py::arg("background"), py::arg("configurations"),
+      py::arg("n_threads") = 1);
+
+  m.def(
+      "configuration_deltas_to_dict",
+      [](std::vector<config::ConfigurationDelta> const &deltas)
+          -> nlohmann::json {
+        jsonParser json;
+        to_json(deltas, json);
+        return static_cast<nlohmann::json>(json);
+      },
+      R"pbdoc(
+      Represent deltas sharing one background as a Python dict
+
+      The background is written once, followed by the changes of each delta.
+      DoF values are written in the prim basis.
+
+      Parameters
+      ----------
+      deltas : list[ConfigurationDelta]
+          Deltas with equal backgrounds.
+
+      Returns
+      -------
+      data : dict
+          The serialized deltas.
+      )pbdoc",
+      py::arg("deltas"));
+
+  m.def(
+      "configuration_deltas_from_dict",
+      [](nlohmann::json const &data,
+         std::shared_ptr<config::Prim const> const &prim) {
+        jsonParser json{data};
+        std::vector<config::ConfigurationDelta> deltas;
+        from_json(deltas, json, prim);
+        return deltas;
+      },
+      R"pbdoc(
+      Read deltas sharing one background from a Python dict
+
+      Parameters
+      ----------
+      data : dict
+          The serialized deltas, as from
+          :func:`configuration_deltas_to_dict`.
+      prim : libcasm.configuration.Prim
+          The prim.
+
+      Returns
+      -------
+      deltas : list[ConfigurationDelta]
+          The deltas, which share one background.
+      )pbdoc",
+      py::arg("data"), py::arg("prim"));
+
+  py::class_<config::ConfigurationSetView>(m, "ConfigurationSetView", R"pbdoc(
+      Read-only view of a ConfigurationSet stored in the indexed binary
+      configuration format, using a memory-mapped file
+
+      Opening a view reads only the file header and index, so it takes
+      constant time, and the mapped memory is shared by all processes that
+      open the same file. Records are decoded on access, and supercells are
+      constructed on first use.
+
+      Records are accessed by index, in ConfigurationSet order, or by
+      configuration name:
+
+      .. code-block:: Python
+
+          from libcasm.configuration import ConfigurationSetView
+
+          # write once
+          ConfigurationSetView.write(configurations, "configurations.bin")
+
+          # open in each process
+          view = ConfigurationSetView("configurations.bin", supercells)
+          record = view[0]
+          record = view.get("SCEL2_1_2_1_1_0_0/0")
+          for record in view:
+              configuration = record.configuration
+              # do something ...
+
+      )pbdoc")
+      .def(py::init<std::string const &,
+                    std::shared_ptr<config::SupercellSet> const &>(),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          path : str
+              Path to a file written by
+              :func:`~libcasm.configuration.ConfigurationSetView.write`.
+          supercells : libcasm.configuration.SupercellSet
+              A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+              supercells in order to avoid duplicates.
+          )pbdoc",
+           py::arg("path"), py::arg("supercells"))
+      .def_static(
+          "write",
+          [](config::ConfigurationSet const &configurations,
+             std::string const &path) {
+            std::ofstream out = open_binary_output(path);
+            config::write_indexed_binary(out, configurations);
+            out.close();
+            if (!out) {
+              throw std::runtime_error(
+                  "Error in ConfigurationSetView.write: write failed");
+            }
+          },
+          R"pbdoc(
+          Write a ConfigurationSet in the indexed binary configuration format
+
+          The file can also be read with
+          :func:`~libcasm.configuration.io.read_configuration_binary`.
+
+          Parameters
+          ----------
+          configurations : libcasm.configuration.ConfigurationSet
+              The configurations to write.
+          path : str
+              The output file path.
+          )pbdoc",
+          py::arg("configurations"), py::arg("path"))
+      .def("__len__", &config::ConfigurationSetView::size)
+      .def(
+          "__getitem__",
+          [](config::ConfigurationSetView const &self, Index i) {
+            if (i < 0) {
+              i += self.size();
+            }
+            if (i < 0 || i >= self.size()) {
+              throw py::index_error("ConfigurationSetView index out of range");
+            }
+            return self.record(i);
+          },
+          "Decode the i-th record, as a :class:`~libcasm.configuration."
+          "ConfigurationRecord`",
+          py::arg("i"))
+      .def(
+          "__contains__",
+          [](config::ConfigurationSetView const &self,
+             std::string const &configuration_name) {
+            return self.find_by_name(configuration_name) != self.size();
+          },
+          py::arg("configuration_name"))
+      .def(
+          "get",
+          [](config::ConfigurationSetView const &self,
+             std::string const &configuration_name)
+              -> std::optional<config::ConfigurationRecord> {
+            Index i = self.find_by_name(configuration_name);
+            if (i == self.size()) {
+              return std::nullopt;
+            }
+            return self.record(i);
+          },
+          R"pbdoc(
+          Get a record by configuration name, or None if not present
+          )pbdoc",
+          py::arg("configuration_name"))
+      .def(
+          "index",
+          [](config::ConfigurationSetView const &self,
+             std::string const &configuration_name) -> std::optional<Index> {
+            Index i = self.find_by_name(configuration_name);
+            if (i == self.size()) {
+              return std::nullopt;
+            }
+            return i;
+          },
+          R"pbdoc(
+          Get a record index by configuration name, or None if not present
+          )pbdoc",
+          py::arg("configuration_name"))
+      .def("configuration_name",
+           &config::ConfigurationSetView::configuration_name,
+           "Configuration name of the i-th record, without decoding DoF values",
+           py::arg("i"))
+      .def("configuration", &config::ConfigurationSetView::configuration,
+           "Decode the configuration of the i-th record", py::arg("i"))
+      .def("next_config_id", &config::ConfigurationSetView::next_config_id,
+           "Next configuration ids, by supercell name")
+      .def_property_readonly(
+          "supercells",
+          [](config::ConfigurationSetView const &self) {
+            return self.supercells();
+          },
+          "The :class:`~libcasm.configuration.SupercellSet` holding "
+          "supercells used by records");
+
+  py::class_<config::ConfigurationSetJournal>(m, "ConfigurationSetJournal",
+                                              R"pbdoc(
+      A ConfigurationSet persisted as a binary snapshot plus an append-only
+      journal of changes
+
+      Each insert and erase is appended to a journal, so saving costs
+      O(changes) rather than rewriting every configuration, and the journal
+      is periodically compacted into a new snapshot. Opening reads the
+      snapshot and replays the journal.
+
+      .. code-block:: Python
+
+          from libcasm.configuration import ConfigurationSetJournal
+
+          journal = ConfigurationSetJournal(
+              "configurations.bin", supercells, compact_threshold=10000
+          )
+          journal.insert(configuration)
+          journal.flush()
+
+          # the snapshot can be opened by readers in other processes
+          view = ConfigurationSetView("configurations.bin", supercells)
+
+      The snapshot is written by
+      :func:`~libcasm.configuration.ConfigurationSetView.write` and replaced
+      atomically by :func:`ConfigurationSetJournal.compact`, so readers
+      always see a complete snapshot. The journal is at
+      ``path + ".journal"``.
+      )pbdoc")
+      .def(py::init([](std::string const &path,
+                       std::shared_ptr<config::SupercellSet> const &supercells,
+                       std::string sync_policy, Index compact_threshold) {
+             config::JournalSyncPolicy policy;
+             if (sync_policy == "none") {
+               policy = config::JournalSyncPolicy::none;
+             } else if (sync_policy == "flush") {
+               policy = config::JournalSyncPolicy::flush;
+             } else if (sync_policy == "every_entry") {
+               policy = config::JournalSyncPolicy::every_entry;
+             } else {
+               throw std::runtime_error(
+                   "Error in ConfigurationSetJournal: invalid sync_policy '" +
+                   sync_policy + "'");
+             }
+             return std::make_unique<config::ConfigurationSetJournal>(
+                 path, supercells, policy, compact_threshold);
+           }),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          path : str
+              Path to the snapshot. Neither the snapshot nor the journal
+              needs to exist.
+          supercells : libcasm.configuration.SupercellSet
+              A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+              supercells in order to avoid duplicates.
+          sync_policy : str = "flush"
+              When to call ``fsync``. One of "none", "flush" (on
+              :func:`flush`, :func:`compact`, and when closed), or
+              "every_entry" (also after each insert or erase).
+          compact_threshold : int = 0
+              If > 0, :func:`compact` is called automatically when the
+              journal has this many entries.
+          )pbdoc",
+           py::arg("path"), py::arg("supercells"),
+           py::arg("sync_policy") = "flush", py::arg("compact_threshold") = 0)
+      .def_property_readonly(
+          "configurations",
+          [](config::ConfigurationSetJournal const &self)
+              -> config::ConfigurationSet const & {
+            return self.configurations();
+          },
+          py::return_value_policy::reference_internal,
+          "libcasm.configuration.ConfigurationSet: The configurations, as of "
+          "the snapshot plus the journal. Modify them only through this "
+          "object.")
+      .def_property_readonly("n_entries",
+                             &config::ConfigurationSetJournal::n_entries,
+                             "int: Number of journal entries since the "
+                             "snapshot was written.")
+      .def_property_readonly("snapshot_path",
+                             &config::ConfigurationSetJournal::snapshot_path,
+                             "str: Path to the snapshot.")
+      .def_property_readonly("journal_path",
+                             &config::ConfigurationSetJournal::journal_path,
+                             "str: Path to the journal.")
+      .def(
+          "insert",
+          [](config::ConfigurationSetJournal &self,
+             config::Configuration const &configuration) {
+            return self.insert(configuration).second;
+          },
+          R"pbdoc(
+          Insert a configuration, with an automatic configuration id, and
+          journal it. Returns True if it was not already present.
+          )pbdoc",
+          py::arg("configuration"))
+      .def(
+          "insert_record",
+          [](config::ConfigurationSetJournal &self,
+             config::ConfigurationRecord const &record) {
+            return self.insert(record).second;
+          },
+          R"pbdoc(
+          Insert a ConfigurationRecord, with a custom configuration id, and
+          journal it. Returns True if it was not already present.
+          )pbdoc",
+          py::arg("record"))
+      .def(
+          "erase",
+          [](config::ConfigurationSetJournal &self,
+             config::Configuration const &configuration) {
+            return self.erase(configuration) != 0;
+          },
+          R"pbdoc(
+          Erase a configuration, and journal it. Returns True if it was
+          present.
+          )pbdoc",
+          py::arg("configuration"))
+      .def(
+          "erase_by_name",
+          [](config::ConfigurationSetJournal &self,
+             std::string const &configuration_name) {
+            return self.erase_by_name(configuration_name) != 0;
+          },
+          R"pbdoc(
+          Erase a configuration by name, and journal it. Returns True if it
+          was present.
+          )pbdoc",
+          py::arg("configuration_name"))
+      .def("flush", &config::ConfigurationSetJournal::flush,
+           "Write buffered journal entries, and fsync unless sync_policy is "
+           "\"none\".")
+      .def("compact", &config::ConfigurationSetJournal::compact,
+           "Write a new snapshot and reset the journal.");
+
+  py::class_<config::SupercellSymInfoTables,
+             std::shared_ptr<config::SupercellSymInfoTables>>(
+      m, "SupercellSymInfoTables", R"pbdoc(
+      Read-only supercell symmetry tables, using a memory-mapped file
+
+      Supercell factor group and translation permutations are written once,
+      and then each worker process constructs supercells from the file
+      instead of constructing the permutations from the prim symmetry
+      representations. The mapped pages are shared by all processes that
+      open the same file, and opening takes constant time.
+
+      .. code-block:: Python
+
+          from libcasm.configuration import SupercellSymInfoTables
+
+          # write once
+          SupercellSymInfoTables.write(supercells, "sym_info.bin")
+
+          # open in each process
+          tables = SupercellSymInfoTables("sym_info.bin")
+          supercell = tables.make_supercell(prim, T)
+
+      Each constructed supercell holds its own copy of its factor group
+      permutations. Stored translation permutations are read from the shared
+      mapping on demand, and at most the supercell's translation permutation
+      cache budget of them are held by each process. All permutation values
+      are checked when read, and the prim is checked by a digest of its
+      structure and factor group.
+      )pbdoc")
+      .def(py::init<std::string const &>(), R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          path : str
+              Path to a file written by
+              :func:`~libcasm.configuration.SupercellSymInfoTables.write`.
+          )pbdoc",
+           py::arg("path"))
+      .def_static(
+          "write",
+          [](std::vector<std::shared_ptr<config::Supercell const>> const
+                 &supercells,
+             std::string const &path) {
+            std::ofstream out = open_binary_output(path);
+            config::write_supercell_sym_info_tables(out, supercells);
+            out.close();
+            if (!out) {
+              throw std::runtime_error(
+                  "Error in SupercellSymInfoTables.write: write failed");
+            }
+          },
+          R"pbdoc(
+          Write the symmetry tables of supercells
+
+          Parameters
+          ----------
+          supercells : list[libcasm.configuration.Supercell]
+              The supercells, which must all have the same prim. Translation
+              permutations are written only for supercells that store them.
+          path : str
+              The output file path.
+          )pbdoc",
+          py::arg("supercells"), py::arg("path"))
+      .def("__len__", &config::SupercellSymInfoTables::size)
+      .def("transformation_matrix_to_super",
+           &config::SupercellSymInfoTables::transformation_matrix_to_super,
+           "Transformation matrix to supercell of the i-th supercell",
+           py::arg("i"))
+      .def(
+          "make_supercell",
+          [](config::SupercellSymInfoTables const &self,
+             std::shared_ptr<config::Prim const> const &prim,
+             Eigen::Matrix3l const &transformation_matrix_to_super) {
+            return self.make_supercell(prim, transformation_matrix_to_super);
+          },
+          R"pbdoc(
+          Construct a Supercell using the stored tables
+
+          Parameters
+          ----------
+          prim : libcasm.configuration.Prim
+              The prim the tables were written from.
+          transformation_matrix_to_super : array_like, shape=(3,3), dtype=int
+              The supercell transformation matrix, which must be one of the
+              stored supercells.
+
+          Returns
+          -------
+          supercell : libcasm.configuration.Supercell
+              The supercell. To share it with other supercells, add it to a
+              :class:`~libcasm.configuration.SupercellSet`.
+          )pbdoc",
+          py::arg("prim"), py::arg("transformation_matrix_to_super"));
 
 #ifdef VERSION_INFO
   m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
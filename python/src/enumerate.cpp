@@ -1,5 +1,7 @@
 #include <pybind11/eigen.h>
+#include <pybind11/functional.h>
 #include <pybind11/iostream.h>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -12,15 +14,28 @@
 #include "casm/casm_io/Log.hh"
 #include "casm/casm_io/json/InputParser_impl.hh"
 #include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/CanonicalFormEngine.hh"
 #include "casm/configuration/Configuration.hh"
 #include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/OrbitsAsIndices.hh"
+#include "casm/configuration/clusterography/SupercellImpactTable.hh"
 #include "casm/configuration/clusterography/orbits.hh"
 #include "casm/configuration/copy_configuration.hh"
 #include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
+#include "casm/configuration/enumeration/ConfigEnumCanonicalOccupations.hh"
+#include "casm/configuration/enumeration/ConfigEnumLocalOccupationsEngine.hh"
+#include "casm/configuration/enumeration/DistinctOccupationSampler.hh"
+#include "casm/configuration/enumeration/EnumProgress.hh"
 #include "casm/configuration/enumeration/MakeOccEventStructures.hh"
+#include "casm/configuration/enumeration/MeshGridPointEnumerator.hh"
 #include "casm/configuration/enumeration/OccEventInfo.hh"
+#include "casm/configuration/enumeration/OccupationFilter.hh"
 #include "casm/configuration/enumeration/background_configuration.hh"
+#include "casm/configuration/enumeration/count_occupations.hh"
+#include "casm/configuration/enumeration/enumerate_supercells.hh"
 #include "casm/configuration/enumeration/perturbations.hh"
+#include "casm/configuration/enumeration/point_defect_supercells.hh"
+#include "casm/configuration/irreps/IrrepWedge.hh"
 #include "casm/configuration/occ_events/OccSystem.hh"
 #include "casm/configuration/occ_events/orbits.hh"
 #include "casm/crystallography/CanonicalForm.hh"
@@ -37,51 +52,150 @@ namespace CASMpy {
 
 using namespace CASM;
 
+clust::OrbitsAsIndices make_orbits_as_indices(
+    std::shared_ptr<config::Supercell const> const &supercell,
+    std::vector<std::vector<clust::IntegralCluster>> const &_orbits) {
+  std::vector<std::set<clust::IntegralCluster>> orbits;
+  for (auto const &_orbit : _orbits) {
+    orbits.emplace_back(_orbit.begin(), _orbit.end());
+  }
+  return clust::make_flat_orbits_as_indices(
+      orbits, supercell->unitcellcoord_index_converter);
+}
+
+clust::SupercellImpactTable make_flower_impact_table(
+    std::shared_ptr<config::Supercell const> const &supercell,
+    std::vector<std::vector<clust::IntegralCluster>> const &_orbits) {
+  std::vector<std::set<clust::IntegralCluster>> orbits;
+  for (auto const &_orbit : _orbits) {
+    orbits.emplace_back(_orbit.begin(), _orbit.end());
+  }
+  return clust::make_flower_impact_table(
+      orbits, supercell->unitcellcoord_index_converter);
+}
+
+clust::SupercellImpactTable make_local_impact_table(
+    std::shared_ptr<config::Supercell const> const &supercell,
+    std::vector<std::vector<clust::IntegralCluster>> const &_local_orbits) {
+  std::vector<std::set<clust::IntegralCluster>> local_orbits;
+  for (auto const &_orbit : _local_orbits) {
+    local_orbits.emplace_back(_orbit.begin(), _orbit.end());
+  }
+  return clust::make_local_impact_table(
+      local_orbits, supercell->unitcellcoord_index_converter,
+      supercell->unitcell_index_converter);
+}
+
 std::vector<config::Configuration> make_all_distinct_periodic_perturbations(
     std::shared_ptr<config::Supercell const> const &supercell,
     config::Configuration const &motif,
-    std::vector<clust::IntegralCluster> const &clusters) {
+    std::vector<clust::IntegralCluster> const &clusters, Index n_threads) {
   auto const &prim = supercell->prim;
   std::vector<std::set<clust::IntegralCluster>> orbits;
   for (auto const &cluster : clusters) {
     orbits.emplace_back(make_prim_periodic_orbit(
         cluster, prim->sym_info.unitcellcoord_symgroup_rep));
   }
-  auto orbits_as_indices = clust::make_orbits_as_indices(
-      orbits, supercell->unitcellcoord_index_converter);
-
-  std::vector<std::vector<config::Configuration>> super_configurations =
-      config::make_all_super_configurations_by_subsets(motif, supercell);
-
-  std::set<config::Configuration> all;
-  for (auto const &equiv_configurations : super_configurations) {
-    auto const &configuration = equiv_configurations[0];
-    auto distinct_cluster_sites =
-        config::make_distinct_cluster_sites(configuration, orbits_as_indices);
-    std::set<config::Configuration> perturbations =
-        config::make_distinct_perturbations(configuration,
-                                            distinct_cluster_sites);
-    all.insert(perturbations.begin(), perturbations.end());
-  }
-
+  std::set<config::Configuration> all =
+      config::make_all_distinct_periodic_perturbations(supercell, motif,
+                                                       orbits, n_threads);
   return std::vector<config::Configuration>(all.begin(), all.end());
 }
 
 std::vector<config::Configuration> make_all_distinct_local_perturbations(
     std::shared_ptr<config::Supercell const> const &supercell,
     occ_events::OccEvent const &occ_event, config::Configuration const &motif,
-    std::vector<clust::IntegralCluster> const &local_clusters) {
+    std::vector<clust::IntegralCluster> const &local_clusters,
+    Index n_threads) {
   std::set<clust::IntegralCluster> _local_clusters(local_clusters.begin(),
                                                    local_clusters.end());
 
-  auto event_prim_info = std::make_shared<config::OccEventPrimInfo const>(
-      supercell->prim, occ_event);
-  config::OccEventSupercellInfo f(event_prim_info, supercell);
+  // event symmetry info is shared by calls with the same supercell and event
+  std::shared_ptr<config::OccEventSupercellInfo const> f =
+      config::occ_event_supercell_info_cache().supercell_info(supercell,
+                                                              occ_event);
   std::set<config::Configuration> all =
-      f.make_all_distinct_local_perturbations(motif, _local_clusters);
+      f->make_all_distinct_local_perturbations(motif, _local_clusters,
+                                               n_threads);
   return std::vector<config::Configuration>(all.begin(), all.end());
 }
 
+using PointBatch =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+template <typename IntType>
+using OccupationBatch =
+    Eigen::Matrix<IntType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/// \brief Write the occupations of the next configurations generated by an
+///     enumerator into the rows of `batch`, and return the number written
+///
+/// If `occupation_filter` is not null, configurations it does not allow are
+/// skipped. If `engine` is not null, configurations that are not canonical
+/// with respect to `engine->ops()` are skipped. The occupation filter is
+/// checked first, because it is much cheaper. Stops when `batch` is full or
+/// the enumerator is no longer valid. The enumerator is advanced past every
+/// configuration that is written or skipped.
+template <typename EnumeratorType, typename IntType>
+Index fill_occupation_batch(EnumeratorType &enumerator,
+                            Eigen::Ref<OccupationBatch<IntType>> batch,
+                            config::CanonicalFormEngine const *engine,
+                            config::OccupationFilter const *occupation_filter) {
+  Index n_written = 0;
+  while (n_written < batch.rows() && enumerator.is_valid()) {
+    config::Configuration const &configuration = enumerator.value();
+    Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+    if (occupation.size() != batch.cols()) {
+      throw std::runtime_error(
+          "Error in fill_occupation_batch: batch.shape[1] != n_sites");
+    }
+    if ((!occupation_filter || occupation_filter->is_allowed(occupation)) &&
+        (!engine || engine->is_canonical(configuration))) {
+      batch.row(n_written) = occupation.transpose().cast<IntType>();
+      ++n_written;
+    }
+    enumerator.advance();
+  }
+  return n_written;
+}
+
+template <typename IntType>
+Index fill_all_occupation_batch(
+    config::ConfigEnumAllOccupations &enumerator,
+    Eigen::Ref<OccupationBatch<IntType>> batch, bool canonical_only,
+    config::OccupationFilter const *occupation_filter) {
+  py::gil_scoped_release release;
+  if (!enumerator.is_valid()) {
+    return 0;
+  }
+  std::optional<config::CanonicalFormEngine> engine;
+  if (canonical_only) {
+    engine.emplace(enumerator.value().supercell);
+  }
+  return fill_occupation_batch<config::ConfigEnumAllOccupations, IntType>(
+      enumerator, batch, engine ? &engine.value() : nullptr,
+      occupation_filter);
+}
+
+template <typename IntType>
+Index fill_canonical_occupation_batch(
+    config::ConfigEnumCanonicalOccupations &enumerator,
+    Eigen::Ref<OccupationBatch<IntType>> batch,
+    config::OccupationFilter const *occupation_filter) {
+  py::gil_scoped_release release;
+  return fill_occupation_batch<config::ConfigEnumCanonicalOccupations,
+                               IntType>(enumerator, batch, nullptr,
+                                        occupation_filter);
+}
+
+template <typename IntType>
+Index compact_occupation_batch(config::OccupationFilter const &filter,
+                               Eigen::Ref<OccupationBatch<IntType>> batch,
+                               std::optional<Index> n_rows) {
+  py::gil_scoped_release release;
+  return filter.compact(batch, n_rows.value_or(batch.rows()));
+}
+
 std::vector<xtal::SimpleStructure> make_occevent_simple_structures(
     config::Configuration const &configuration,
     occ_events::OccEvent const &occ_event,
@@ -97,6 +211,51 @@ std::vector<xtal::SimpleStructure> make_occevent_simple_structures(
   return results;
 }
 
+/// \brief Wrap a `3 x (n_atoms * n_images)` coordinates batch as a numpy
+///     array of shape `(n_images, 3, n_atoms)`, without copying
+py::array_t<double> make_coords_batch_array(Eigen::MatrixXd &&coords,
+                                            Index n_atoms) {
+  Index n_images = n_atoms ? coords.cols() / n_atoms : 0;
+  auto *data = new Eigen::MatrixXd(std::move(coords));
+  py::capsule owner(data, [](void *ptr) {
+    delete reinterpret_cast<Eigen::MatrixXd *>(ptr);
+  });
+  py::ssize_t d = sizeof(double);
+  return py::array_t<double>({py::ssize_t(n_images), py::ssize_t(3),
+                              py::ssize_t(n_atoms)},
+                             {py::ssize_t(3 * n_atoms) * d, d, 3 * d},
+                             data->data(), owner);
+}
+
+py::list make_occevent_structure_coords(
+    config::Configuration const &configuration,
+    std::vector<occ_events::OccEvent> const &occ_events,
+    std::vector<double> interpolation_factors,
+    std::shared_ptr<occ_events::OccSystem const> const &system,
+    bool skip_event_occupants) {
+  std::vector<Eigen::Matrix3d> lat_column_mat;
+  std::vector<std::vector<std::string>> atom_type;
+  std::vector<Eigen::MatrixXd> coords;
+  {
+    py::gil_scoped_release release;
+    for (auto const &occ_event : occ_events) {
+      config::MakeOccEventStructures make_structure(
+          configuration, occ_event, system, skip_event_occupants);
+      lat_column_mat.push_back(make_structure.lat_column_mat());
+      atom_type.push_back(make_structure.atom_names());
+      coords.push_back(make_structure.make_coords_batch(interpolation_factors));
+    }
+  }
+  py::list results;
+  for (Index i = 0; i < coords.size(); ++i) {
+    Index n_atoms = atom_type[i].size();
+    results.append(py::make_tuple(
+        lat_column_mat[i], atom_type[i],
+        make_coords_batch_array(std::move(coords[i]), n_atoms)));
+  }
+  return results;
+}
+
 /// \brief Return (unitcell_index,equivalent_index) of a particular OccEvent
 ///
 /// \param occ_event Input OccEvent, to find the coordinates of
@@ -130,6 +289,107 @@ std::tuple<Index, Index> get_occevent_coordinate(
       "could be found");
 }
 
+/// \brief Count distinct occupations, as a dict with Python int counts
+py::dict count_distinct_occupations(
+    std::shared_ptr<config::Supercell const> const &supercell,
+    bool by_composition, Index n_threads) {
+  config::DistinctOccupationCount count;
+  {
+    py::gil_scoped_release release;
+    count = config::count_distinct_occupations(supercell, by_composition,
+                                               n_threads);
+  }
+  py::dict result;
+  result["sublattice_orbits"] = count.sublattice_orbits;
+  result["n_occupants"] = count.n_occupants;
+  result["n_sites"] = count.n_sites;
+  result["group_order"] = count.group_order;
+  result["n_cycle_types"] = count.n_cycle_types;
+  result["total"] = py::int_(py::str(count.total));
+  if (by_composition) {
+    py::dict counts;
+    for (auto const &pair : count.by_composition) {
+      counts[py::tuple(py::cast(pair.first))] = py::int_(py::str(pair.second));
+    }
+    result["by_composition"] = counts;
+  }
+  return result;
+}
+
+/// \brief Return (sites, occ_init, occ_final) numpy arrays for every
+///     translation of every equivalent event, without copying
+py::tuple make_occevent_site_index_table(
+    std::vector<occ_events::OccEvent> const &phenomenal_occevent,
+    config::Supercell const &supercell, Index n_threads) {
+  config::OccEventSiteIndexTable *table;
+  {
+    py::gil_scoped_release release;
+    table = new config::OccEventSiteIndexTable(
+        config::make_occevent_site_index_table(phenomenal_occevent, supercell,
+                                               n_threads));
+  }
+  py::capsule owner(table, [](void *ptr) {
+    delete reinterpret_cast<config::OccEventSiteIndexTable *>(ptr);
+  });
+  py::ssize_t n_e = table->n_equivalents;
+  py::ssize_t n_l = table->n_translations;
+  py::ssize_t n_s = table->n_sites;
+  py::ssize_t d = sizeof(std::int32_t);
+  return py::make_tuple(
+      py::array_t<std::int32_t>({n_e, n_l, n_s}, {n_l * n_s * d, n_s * d, d},
+                                table->sites.data(), owner),
+      py::array_t<std::int32_t>({n_e, n_s}, {n_s * d, d},
+                                table->occ_init.data(), owner),
+      py::array_t<std::int32_t>({n_e, n_s}, {n_s * d, d},
+                                table->occ_final.data(), owner));
+}
+
+/// \brief Return (sites, orbit_offset, cluster_offset) numpy arrays for the
+///     local clusters of every translation of every equivalent phenomenal
+///     cluster, without copying
+py::tuple make_local_orbits_index_table(
+    clust::IntegralCluster const &prototype,
+    std::vector<std::vector<clust::IntegralCluster>> const &_local_orbits,
+    std::vector<clust::IntegralCluster> const &phenomenal_clusters,
+    std::vector<Index> const &equivalent_generating_op_indices,
+    config::Supercell const &supercell, Index n_threads) {
+  clust::LocalOrbitsAsIndices *table;
+  {
+    py::gil_scoped_release release;
+    std::vector<std::set<clust::IntegralCluster>> local_orbits;
+    for (auto const &_orbit : _local_orbits) {
+      local_orbits.emplace_back(_orbit.begin(), _orbit.end());
+    }
+    auto const &unitcellcoord_symgroup_rep =
+        supercell.prim->sym_info.unitcellcoord_symgroup_rep;
+    std::vector<xtal::UnitCell> translations =
+        clust::make_phenomenal_generating_translations(
+            prototype, phenomenal_clusters, equivalent_generating_op_indices,
+            unitcellcoord_symgroup_rep);
+    table = new clust::LocalOrbitsAsIndices(
+        clust::make_flat_local_orbits_as_indices(
+            local_orbits, unitcellcoord_symgroup_rep,
+            equivalent_generating_op_indices, translations,
+            supercell.unitcellcoord_index_converter,
+            supercell.unitcell_index_converter, n_threads));
+  }
+  py::capsule owner(table, [](void *ptr) {
+    delete reinterpret_cast<clust::LocalOrbitsAsIndices *>(ptr);
+  });
+  py::ssize_t n_e = table->n_equivalents;
+  py::ssize_t n_l = table->n_translations;
+  py::ssize_t n_s = table->n_cluster_sites();
+  py::ssize_t d = sizeof(std::int32_t);
+  py::ssize_t d_offset = sizeof(Index);
+  return py::make_tuple(
+      py::array_t<std::int32_t>({n_e, n_l, n_s}, {n_l * n_s * d, n_s * d, d},
+                                table->sites.data(), owner),
+      py::array_t<Index>({py::ssize_t(table->orbit_offset.size())},
+                         {d_offset}, table->orbit_offset.data(), owner),
+      py::array_t<Index>({py::ssize_t(table->cluster_offset.size())},
+                         {d_offset}, table->cluster_offset.data(), owner));
+}
+
 std::vector<occ_events::OccEvent> make_phenomenal_occevent(
     occ_events::OccEvent prototype,
     std::vector<clust::IntegralCluster> const &phenomenal_clusters,
@@ -305,6 +565,7 @@ PYBIND11_MODULE(_enumerate, m) {
     )pbdoc";
   py::module::import("libcasm.xtal");
   py::module::import("libcasm.configuration");
+  py::module::import("libcasm.irreps");
   py::module::import("libcasm.occ_events");
 
   py::class_<SuperlatticeEnum>(m, "SuperlatticeEnumBase")
@@ -387,10 +648,483 @@ PYBIND11_MODULE(_enumerate, m) {
                   The fixed shape flag
           )pbdoc");
 
+  m.def(
+      "enumerate_canonical_supercells",
+      [](std::shared_ptr<config::Prim const> const &prim, Index max_volume,
+         Index min_volume, std::string dirs,
+         std::optional<Eigen::Matrix3i> unit_cell, bool diagonal_only,
+         bool fixed_shape, Index n_threads) {
+        return config::enumerate_canonical_supercells(
+            prim, max_volume, min_volume, dirs,
+            unit_cell.value_or(Eigen::Matrix3i::Identity()), diagonal_only,
+            fixed_shape, n_threads);
+      },
+      R"pbdoc(
+      Enumerate symmetrically distinct supercells, in canonical form
+
+      Gives the same supercells, in the same order, as
+      :func:`ScelEnum.by_volume <libcasm.enumerate.ScelEnum.by_volume>`, but
+      superlattices are enumerated, put in canonical form, and used to
+      construct supercells in C++, with volumes distributed over threads.
+
+      Parameters
+      ----------
+      prim: libcasm.configuration.Prim
+          The Prim
+      max_volume : int
+          The maximum volume superlattice to enumerate. The volume is measured
+          relative the unit cell being used to generate supercells.
+      min_volume : int, default=1
+          The minimum volume superlattice to enumerate. The volume is measured
+          relative the unit cell being used to generate supercells.
+      dirs : str, default="abc"
+          A string indicating which lattice vectors to enumerate over. Some
+          combination of 'a', 'b', and 'c', where 'a' indicates the first
+          lattice vector of the unit cell, 'b' the second, and 'c' the third.
+      unit_cell: Optional[np.ndarray] = None,
+          An integer shape=(3,3) transformation matrix `U` allows specifying
+          an alternative unit cell that can be used to generate superlattices
+          of the form `S = (L @ U) @ T`. If None, `U` is set to the identity
+          matrix.
+      diagonal_only: bool = False
+          If true, restrict :math:`T` to diagonal matrices.
+      fixed_shape: bool = False
+          If true, restrict :math:`T` to diagonal matrices with diagonal
+          coefficients :math:`[m, 1, 1]` (1d), :math:`[m, m, 1]` (2d), or
+          :math:`[m, m, m]` (3d), where the dimension is determined from
+          `len(dirs)`.
+      n_threads: int = 1
+          Number of threads to use. If `n_threads <= 0`, all available
+          hardware threads are used. The result does not depend on
+          `n_threads`.
+
+      Returns
+      -------
+      supercells: list[libcasm.configuration.Supercell]
+          The symmetrically distinct supercells, in canonical form.
+      )pbdoc",
+      py::arg("prim"), py::arg("max_volume"), py::arg("min_volume") = 1,
+      py::arg("dirs") = "abc", py::arg("unit_cell") = std::nullopt,
+      py::arg("diagonal_only") = false, py::arg("fixed_shape") = false,
+      py::arg("n_threads") = 1);
+
+  m.def(
+      "enumerate_canonical_transformation_matrices",
+      [](std::shared_ptr<config::Prim const> const &prim, Index max_volume,
+         Index min_volume, std::string dirs,
+         std::optional<Eigen::Matrix3i> unit_cell, bool diagonal_only,
+         bool fixed_shape, Index n_threads) {
+        return config::enumerate_canonical_transformation_matrices(
+            prim, max_volume, min_volume, dirs,
+            unit_cell.value_or(Eigen::Matrix3i::Identity()), diagonal_only,
+            fixed_shape, n_threads);
+      },
+      R"pbdoc(
+      Enumerate symmetrically distinct supercells, as transformation matrices
+      to canonical superlattices
+
+      Same as :func:`enumerate_canonical_supercells`, but no
+      :class:`~libcasm.configuration.Supercell` is constructed.
+
+      Parameters
+      ----------
+      prim: libcasm.configuration.Prim
+          The Prim
+      max_volume : int
+          The maximum volume superlattice to enumerate.
+      min_volume : int, default=1
+          The minimum volume superlattice to enumerate.
+      dirs : str, default="abc"
+          Which lattice vectors of the unit cell to enumerate over.
+      unit_cell: Optional[np.ndarray] = None,
+          An integer shape=(3,3) transformation matrix `U` specifying an
+          alternative unit cell. If None, `U` is set to the identity matrix.
+      diagonal_only: bool = False
+          If true, restrict :math:`T` to diagonal matrices.
+      fixed_shape: bool = False
+          If true, restrict :math:`T` to diagonal matrices of fixed shape.
+      n_threads: int = 1
+          Number of threads to use. If `n_threads <= 0`, all available
+          hardware threads are used.
+
+      Returns
+      -------
+      transformation_matrices: list[np.ndarray[np.int64[3, 3]]]
+          The transformation matrices, `T`, relating the canonical
+          superlattice vectors, `S`, to the prim lattice vectors, `L`,
+          according to ``S = L @ T``.
+      )pbdoc",
+      py::arg("prim"), py::arg("max_volume"), py::arg("min_volume") = 1,
+      py::arg("dirs") = "abc", py::arg("unit_cell") = std::nullopt,
+      py::arg("diagonal_only") = false, py::arg("fixed_shape") = false,
+      py::arg("n_threads") = 1);
+
+  py::class_<config::PointDefectSuperlatticeScore>(
+      m, "PointDefectSuperlatticeScore", R"pbdoc(
+      Score of a superlattice for point defect calculations
+
+      Scores are found from lattice data only, so no
+      :class:`~libcasm.configuration.Supercell` is constructed.
+      )pbdoc")
+      .def_readonly(
+          "transformation_matrix_to_super",
+          &config::PointDefectSuperlatticeScore::transformation_matrix_to_super,
+          "np.ndarray[np.int64[3, 3]]: The transformation matrix, `T`, such "
+          "that ``S = L @ T``.")
+      .def_readonly("n_unitcells",
+                    &config::PointDefectSuperlatticeScore::n_unitcells,
+                    "int: The number of unit cells.")
+      .def_readonly("factor_group_size",
+                    &config::PointDefectSuperlatticeScore::factor_group_size,
+                    "int: The size of the supercell factor group.")
+      .def_readonly(
+          "voronoi_inner_radius",
+          &config::PointDefectSuperlatticeScore::voronoi_inner_radius,
+          "float: The superlattice Voronoi inner radius, which measures the "
+          "minimum periodic image distance.");
+
+  m.def("make_point_defect_superlattice_scores",
+        &config::make_point_defect_superlattice_scores,
+        R"pbdoc(
+      Score superlattices for point defect calculations, in parallel
+
+      The supercell factor group size is the number of prim factor group
+      operations that leave the superlattice invariant, so scores are found
+      without constructing :class:`~libcasm.configuration.Supercell`.
+
+      Parameters
+      ----------
+      prim: libcasm.configuration.Prim
+          The Prim
+      transformation_matrices: list[np.ndarray[np.int64[3, 3]]]
+          The transformation matrices, `T`, of the superlattices to score,
+          such that ``S = L @ T``.
+      min_factor_group_size: int = 0
+          Superlattices with a smaller supercell factor group are excluded.
+      min_voronoi_inner_radius: float = 0.0
+          Superlattices with a smaller Voronoi inner radius are excluded. A
+          cheap upper bound, half the shortest reduced cell vector, is
+          checked first.
+      n_threads: int = 1
+          Number of threads to use. If `n_threads <= 0`, all available
+          hardware threads are used. The result does not depend on
+          `n_threads`.
+
+      Returns
+      -------
+      scores: list[PointDefectSuperlatticeScore]
+          Scores of the superlattices that are not excluded, in the order of
+          `transformation_matrices`.
+      )pbdoc",
+        py::arg("prim"), py::arg("transformation_matrices"),
+        py::arg("min_factor_group_size") = 0,
+        py::arg("min_voronoi_inner_radius") = 0.0, py::arg("n_threads") = 1);
+
+  m.def("make_point_defect_pareto_indices",
+        &config::make_point_defect_pareto_indices,
+        R"pbdoc(
+      Return the indices of Pareto-optimal points, maximizing Voronoi inner
+      radius and minimizing number of unit cells
+
+      Point `i` is Pareto-optimal if `is_candidate[i]`, no point of any
+      candidacy with fewer unit cells has Voronoi inner radius greater than
+      ``voronoi_inner_radius[i] - tol``, and no point with the same number of
+      unit cells has Voronoi inner radius greater than
+      ``voronoi_inner_radius[i] + tol``.
+
+      Parameters
+      ----------
+      n_unitcells: list[int]
+          Number of unit cells, by point
+      voronoi_inner_radius: list[float]
+          Voronoi inner radius, by point
+      is_candidate: list[bool]
+          If False, the point is only used to exclude others.
+      tol: float = 1e-5
+          Tolerance for comparing Voronoi inner radius
+
+      Returns
+      -------
+      pareto_indices: list[int]
+          Indices of the Pareto-optimal points, in increasing order.
+      )pbdoc",
+        py::arg("n_unitcells"), py::arg("voronoi_inner_radius"),
+        py::arg("is_candidate"), py::arg("tol") = 1e-5);
+
+  m.def("find_pareto_point_defect_superlattices",
+        &config::find_pareto_point_defect_superlattices,
+        R"pbdoc(
+      Find the Pareto-optimal superlattices for point defect calculations
+
+      Gives the same result as :func:`make_point_defect_superlattice_scores`
+      followed by :func:`make_point_defect_pareto_indices`, but superlattices
+      are considered in order of increasing volume, and a superlattice whose
+      Voronoi inner radius upper bound is not larger than the Voronoi inner
+      radius of a smaller superlattice already scored is rejected without
+      finding its factor group.
+
+      Parameters
+      ----------
+      prim: libcasm.configuration.Prim
+          The Prim
+      transformation_matrices: list[np.ndarray[np.int64[3, 3]]]
+          The transformation matrices, `T`, of the superlattices to consider,
+          such that ``S = L @ T``.
+      min_factor_group_size: int = 0
+          Superlattices with a smaller supercell factor group are excluded.
+      min_voronoi_inner_radius: float = 0.0
+          Superlattices with a smaller Voronoi inner radius are excluded.
+      tol: float = 1e-5
+          Tolerance for comparing Voronoi inner radius
+      n_threads: int = 1
+          Number of threads to use. If `n_threads <= 0`, all available
+          hardware threads are used. The result does not depend on
+          `n_threads`.
+
+      Returns
+      -------
+      scores: list[PointDefectSuperlatticeScore]
+          Scores of the Pareto-optimal superlattices, sorted by number of
+          unit cells.
+      )pbdoc",
+        py::arg("prim"), py::arg("transformation_matrices"),
+        py::arg("min_factor_group_size") = 0,
+        py::arg("min_voronoi_inner_radius") = 0.0, py::arg("tol") = 1e-5,
+        py::arg("n_threads") = 1);
+
+  m.def("superlattice_has_required_operations",
+        &config::has_required_operations,
+        R"pbdoc(
+      Check if a superlattice is left invariant by required operations
+
+      Operations are checked with integer arithmetic only, without
+      constructing a :class:`~libcasm.configuration.Supercell`.
+
+      Parameters
+      ----------
+      prim: libcasm.configuration.Prim
+          The Prim
+      transformation_matrix_to_super: np.ndarray[np.int64[3, 3]]
+          The transformation matrix, `T`, of the superlattice, such that
+          ``S = L @ T``.
+      required_operations: list[int]
+          Indices of prim factor group operations.
+
+      Returns
+      -------
+      result: bool
+          True if each required operation is in the supercell factor group.
+      )pbdoc",
+        py::arg("prim"), py::arg("transformation_matrix_to_super"),
+        py::arg("required_operations"));
+
+  m.def("superlattice_has_required_sites", &config::has_required_sites,
+        R"pbdoc(
+      Check if a superlattice has sets of required sites without periodic
+      image overlap
+
+      Periodic images are found with integer arithmetic only, without
+      constructing a :class:`~libcasm.configuration.Supercell`.
+
+      Parameters
+      ----------
+      prim: libcasm.configuration.Prim
+          The Prim
+      transformation_matrix_to_super: np.ndarray[np.int64[3, 3]]
+          The transformation matrix, `T`, of the superlattice, such that
+          ``S = L @ T``.
+      required_sites: list[list[libcasm.xtal.IntegralSiteCoordinate]]
+          Sets of required sites.
+
+      Returns
+      -------
+      result: bool
+          True if, for each set, no two sites are periodic images in the
+          supercell.
+      )pbdoc",
+        py::arg("prim"), py::arg("transformation_matrix_to_super"),
+        py::arg("required_sites"));
+
+  m.def("make_equivalent_supercells_with_required_operations",
+        &config::make_equivalent_supercells_with_required_operations,
+        R"pbdoc(
+      Make the equivalent supercells whose factor group includes required
+      operations
+
+      Equivalent superlattices are found from transformation matrices, the
+      required operations are checked with integer arithmetic, and a
+      :class:`~libcasm.configuration.Supercell` is only constructed for the
+      superlattices that pass.
+
+      Parameters
+      ----------
+      supercell: libcasm.configuration.Supercell
+          The initial supercell.
+      required_operations: list[int]
+          The indices of prim factor group operations that are required in
+          the supercell factor group.
+      n_threads: int = 1
+          Number of threads to use. If `n_threads <= 0`, all available
+          hardware threads are used. The result does not depend on
+          `n_threads`.
+
+      Returns
+      -------
+      matching: list[libcasm.configuration.Supercell]
+          Equivalent supercells to `supercell` with the required operations,
+          in the order of
+          :func:`~libcasm.configuration.make_equivalent_transformation_matrices`.
+      )pbdoc",
+        py::arg("supercell"), py::arg("required_operations"),
+        py::arg("n_threads") = 1);
+
+  py::class_<config::EnumProgressStatus>(m, "EnumProgressStatus", R"pbdoc(
+      A snapshot of the progress of an enumeration
+
+      See :class:`~libcasm.enumerate.EnumProgress`.
+      )pbdoc")
+      .def_readonly("n_generated", &config::EnumProgressStatus::n_generated,
+                    "int: Number of configurations generated.")
+      .def_readonly("n_canonical", &config::EnumProgressStatus::n_canonical,
+                    "int: Number of generated configurations found to be "
+                    "canonical, for enumerations that check.")
+      .def_readonly("n_accepted", &config::EnumProgressStatus::n_accepted,
+                    "int: Number of configurations accepted, i.e. yielded or "
+                    "returned.")
+      .def_readonly("n_total", &config::EnumProgressStatus::n_total,
+                    "float: Estimated total number of configurations to be "
+                    "generated, or 0.0 if not known.")
+      .def_readonly("elapsed_seconds",
+                    &config::EnumProgressStatus::elapsed_seconds,
+                    "float: Seconds since the progress was constructed or "
+                    "reset.")
+      .def_readonly("rate", &config::EnumProgressStatus::rate,
+                    "float: Configurations generated per second.")
+      .def_readonly("fraction_complete",
+                    &config::EnumProgressStatus::fraction_complete,
+                    "Optional[float]: Fraction of `n_total` generated, if "
+                    "`n_total` is known.")
+      .def_readonly("estimated_remaining_seconds",
+                    &config::EnumProgressStatus::estimated_remaining_seconds,
+                    "Optional[float]: Estimated seconds remaining, if "
+                    "`n_total` is known and the rate is not zero.")
+      .def("__repr__", [](config::EnumProgressStatus const &self) {
+        std::stringstream ss;
+        ss << "EnumProgressStatus(n_generated=" << self.n_generated
+           << ", n_canonical=" << self.n_canonical
+           << ", n_accepted=" << self.n_accepted << ", n_total=" << self.n_total
+           << ", elapsed_seconds=" << self.elapsed_seconds
+           << ", rate=" << self.rate << ")";
+        return ss.str();
+      });
+
+  py::class_<config::EnumProgress, std::shared_ptr<config::EnumProgress>>(
+      m, "EnumProgress", R"pbdoc(
+      Accumulates enumeration progress natively and reports it through a
+      throttled callback
+
+      Enumerators given an EnumProgress count configurations generated,
+      found canonical, and accepted in C++, and estimate the total from the
+      size of their occupation counters. The callback, if any, is called
+      with an :class:`~libcasm.enumerate.EnumProgressStatus` at most once per
+      `report_interval` seconds, so monitoring does not need a Python
+      callback per configuration. The status can also be polled with
+      :func:`status` from another thread.
+
+      The callback may be called from a worker thread of a parallel
+      enumeration. Only one call runs at a time.
+      )pbdoc")
+      .def(py::init([](std::optional<std::function<void(
+                           config::EnumProgressStatus const &)>>
+                           callback,
+                       double report_interval) {
+             return std::make_shared<config::EnumProgress>(
+                 callback.has_value() ? *callback
+                                      : config::EnumProgress::CallbackType(),
+                 report_interval);
+           }),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          callback: Optional[Callable[[EnumProgressStatus], None]] = None
+              If not None, called with the current status at most once per
+              `report_interval` seconds during enumeration, and by
+              :func:`report`.
+          report_interval: float = 1.0
+              Minimum number of seconds between calls of `callback` during
+              enumeration.
+          )pbdoc",
+           py::arg("callback") = std::nullopt,
+           py::arg("report_interval") = 1.0)
+      .def("status", &config::EnumProgress::status,
+           "Return an :class:`~libcasm.enumerate.EnumProgressStatus` snapshot "
+           "of the current progress.")
+      .def("report", &config::EnumProgress::report,
+           "Call the callback now, if there is one, such as to report the "
+           "final status.")
+      .def("reset", &config::EnumProgress::reset,
+           "Set all counts to zero and restart the clock.")
+      .def("add_total", &config::EnumProgress::add_total,
+           "Add to the estimated total number of configurations.",
+           py::arg("n"))
+      .def("add_generated", &config::EnumProgress::add_generated,
+           "Add to the number of configurations generated, and call the "
+           "callback if a report is due.",
+           py::arg("n") = 1)
+      .def("add_canonical", &config::EnumProgress::add_canonical,
+           "Add to the number of canonical configurations.", py::arg("n") = 1)
+      .def("add_accepted", &config::EnumProgress::add_accepted,
+           "Add to the number of accepted configurations.", py::arg("n") = 1);
+
   py::class_<config::ConfigEnumAllOccupations>(m,
                                                "ConfigEnumAllOccupationsBase")
-      .def(py::init<config::Configuration const &, std::set<Index> const &>(),
-           py::arg("background"), py::arg("sites"))
+      .def(py::init([](config::Configuration const &background,
+                       std::set<Index> const &sites, bool gray_code) {
+             return config::ConfigEnumAllOccupations(
+                 background, sites, std::vector<int>(), gray_code);
+           }),
+           py::arg("background"), py::arg("sites"),
+           py::arg("gray_code") = false, R"pbdoc(
+          Constructor
+
+          Parameters
+          ----------
+          background: libcasm.configuration.Configuration
+              The background configuration.
+          sites: set[int]
+              The site indices where occupant values are enumerated.
+          gray_code: bool = False
+              If True, enumerate in reflected mixed-radix Gray code order,
+              so that each call to :func:`advance` changes the occupation
+              of exactly one site, as given by :func:`delta`.
+          )pbdoc")
+      .def_property_readonly("gray_code",
+                             &config::ConfigEnumAllOccupations::gray_code,
+                             "True if enumerating in Gray code order.")
+      .def(
+          "delta",
+          [](config::ConfigEnumAllOccupations const &self) {
+            std::vector<std::tuple<Index, int, int>> result;
+            for (auto const &x : self.delta()) {
+              result.emplace_back(x.site_index, x.old_occupation,
+                                  x.new_occupation);
+            }
+            return result;
+          },
+          R"pbdoc(
+          Occupation changes made by the last call to :func:`advance`
+
+          Returns
+          -------
+          delta: list[tuple[int, int, int]]
+              The changes, as `(site_index, old_occupation,
+              new_occupation)`, in the order applied. Empty after
+              construction and :func:`set_counter_value`. In Gray code
+              order, each call to :func:`advance` that gives a valid value
+              makes exactly one change.
+          )pbdoc")
       .def("value", &config::ConfigEnumAllOccupations::value, R"pbdoc(
           Get the current Configuration
 
@@ -410,12 +1144,725 @@ PYBIND11_MODULE(_enumerate, m) {
           -------
           is_valid: bool
               True if `value` is valid, False if no more valid values
+          )pbdoc")
+      .def("counter_value", &config::ConfigEnumAllOccupations::counter_value,
+           R"pbdoc(
+          Occupant indices on the enumerated sites, in sorted order
+
+          The counter value, with the background and sites, completely
+          specifies the state of the enumeration, so it can be saved to
+          checkpoint an enumeration.
+
+          Returns
+          -------
+          counter_value: list[int]
+              The occupant indices on the enumerated sites, in sorted order.
+          )pbdoc")
+      .def("set_counter_value",
+           &config::ConfigEnumAllOccupations::set_counter_value, R"pbdoc(
+          Set the occupant indices on the enumerated sites, in sorted order,
+          to resume enumeration
+
+          Parameters
+          ----------
+          value: list[int]
+              Occupant indices on the enumerated sites, as from
+              :func:`counter_value`. Enumeration continues from `value`, which
+              becomes the current value.
+          )pbdoc",
+           py::arg("value"))
+      .def("n_total", &config::ConfigEnumAllOccupations::n_total, R"pbdoc(
+          Number of values of the counter, i.e. the number of configurations
+          enumerated from the first value, as a float
+          )pbdoc")
+      .def("set_progress", &config::ConfigEnumAllOccupations::set_progress,
+           R"pbdoc(
+          Count the values generated in `progress`
+
+          Parameters
+          ----------
+          progress: Optional[libcasm.enumerate.EnumProgress]
+              If not None, :func:`n_total` is added to its estimated total,
+              and the current value, if valid, and each value generated by
+              :func:`advance` are added to its generated count.
+          )pbdoc",
+           py::arg("progress"))
+      .def("fill_occupation_batch", &fill_all_occupation_batch<std::int32_t>,
+           R"pbdoc(
+          Write the next occupations into the rows of an existing array
+
+          Starting from the current `value`, the occupation of each
+          configuration is written into the next row of `batch` and the
+          enumerator is advanced, until `batch` is full or there are no more
+          valid values. No Configuration objects are created in Python, and
+          the GIL is released while the array is filled.
+
+          Parameters
+          ----------
+          batch: np.ndarray[np.int32[batch_size, n_sites]]
+              A writable, C-contiguous array, which is filled in place. It is
+              not converted or copied, so it must have dtype int32 or int8.
+          canonical_only: bool = False
+              If True, configurations that are not canonical with respect to
+              the operations that leave the supercell lattice invariant are
+              skipped. For large enumerations,
+              :class:`ConfigEnumCanonicalOccupationsBase` is faster, because
+              it prunes non-canonical candidates early.
+          occupation_filter: Optional[OccupationFilter] = None
+              If not None, configurations that `occupation_filter` does not
+              allow are skipped. This is checked before `canonical_only`.
+
+          Returns
+          -------
+          n_written: int
+              The number of rows of `batch` that were written. If it is less
+              than ``batch.shape[0]``, the enumeration is complete.
+          )pbdoc",
+           py::arg("batch").noconvert(), py::arg("canonical_only") = false,
+           py::arg("occupation_filter") = nullptr)
+      .def("fill_occupation_batch", &fill_all_occupation_batch<std::int8_t>,
+           py::arg("batch").noconvert(), py::arg("canonical_only") = false,
+           py::arg("occupation_filter") = nullptr);
+
+  py::class_<config::ConfigEnumCanonicalOccupations>(
+      m, "ConfigEnumCanonicalOccupationsBase", R"pbdoc(
+      Enumerate the canonical occupations on particular sites in a
+      configuration, pruning non-canonical candidates early.
+
+      Generates the configurations generated by
+      :class:`ConfigEnumAllOccupationsBase` that are canonical with respect to
+      the operations that leave the supercell lattice vectors invariant, but
+      possibly in a different order. Occupations are assigned by depth-first
+      search, and partial assignments that some operation maps to a
+      lexicographically greater occupation are skipped.
+
+      Optionally, the composition on the enumerated sites can be fixed, in
+      which case only the distinct permutations of the fixed occupants are
+      visited. This is much faster than filtering all occupations by
+      composition: for 32 A and 32 B on 64 sites, at most C(64,32) leaves are
+      visited, rather than 2^64.
+      )pbdoc")
+      .def(py::init<config::Configuration const &, std::set<Index> const &,
+                    std::optional<std::vector<std::vector<Index>>> const &>(),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          background : libcasm.configuration.Configuration
+              The background configuration.
+          sites : set[int]
+              The linear site indices on which occupations are enumerated.
+              All other sites keep the occupation of the background
+              configuration.
+          occupant_counts : Optional[list[list[int]]] = None
+              If not None, fixes the composition: ``occupant_counts[b][i]``
+              is the number of sites in `sites` on sublattice ``b`` with
+              occupant index ``i``. The counts for each sublattice must sum to
+              the number of sites in `sites` on that sublattice. Sublattices
+              with no sites in `sites` may have empty counts.
+          )pbdoc",
+           py::arg("background"), py::arg("sites"),
+           py::arg("occupant_counts") = std::nullopt)
+      .def("value", &config::ConfigEnumCanonicalOccupations::value, R"pbdoc(
+          Get the current Configuration
+
+          Returns
+          -------
+          config: libcasm.configuration.Configuration
+              A const reference to the current Configuration
+          )pbdoc",
+           py::return_value_policy::reference_internal)
+      .def("advance", &config::ConfigEnumCanonicalOccupations::advance,
+           R"pbdoc(
+          Generate the next Configuration
+          )pbdoc")
+      .def("is_valid", &config::ConfigEnumCanonicalOccupations::is_valid,
+           R"pbdoc(
+          Return True if `value` is valid, False if no more valid values
+
+          Returns
+          -------
+          is_valid: bool
+              True if `value` is valid, False if no more valid values
+          )pbdoc")
+      .def("fill_occupation_batch",
+           &fill_canonical_occupation_batch<std::int32_t>, R"pbdoc(
+          Write the next occupations into the rows of an existing array
+
+          Starting from the current `value`, the occupation of each
+          configuration is written into the next row of `batch` and the
+          enumerator is advanced, until `batch` is full or there are no more
+          valid values. No Configuration objects are created in Python, and
+          the GIL is released while the array is filled.
+
+          Parameters
+          ----------
+          batch: np.ndarray[np.int32[batch_size, n_sites]]
+              A writable, C-contiguous array, which is filled in place. It is
+              not converted or copied, so it must have dtype int32 or int8.
+          occupation_filter: Optional[OccupationFilter] = None
+              If not None, configurations that `occupation_filter` does not
+              allow are skipped.
+
+          Returns
+          -------
+          n_written: int
+              The number of rows of `batch` that were written. If it is less
+              than ``batch.shape[0]``, the enumeration is complete.
+          )pbdoc",
+           py::arg("batch").noconvert(), py::arg("occupation_filter") = nullptr)
+      .def("fill_occupation_batch",
+           &fill_canonical_occupation_batch<std::int8_t>,
+           py::arg("batch").noconvert(),
+           py::arg("occupation_filter") = nullptr);
+
+  py::class_<config::DistinctOccupationSampler>(m, "DistinctOccupationSampler",
+                                                R"pbdoc(
+      Draw symmetrically distinct occupations of a supercell uniformly at
+      random, without enumerating them
+
+      Each sample is the canonical form of an occupation, and every orbit of
+      occupations is equally likely, regardless of its size. Canonicalizing
+      uniformly random occupations instead favors orbits with more members,
+      by a factor of up to the number of operations.
+
+      A random occupation and a random operation are proposed together, and
+      accepted if the operation leaves the occupation unchanged, which
+      accepts every orbit with equal probability. Site occupants are drawn
+      only as they are needed to reject a proposal, so the cost per sample
+      depends on the number of operations and sites, but not on the number
+      of occupations.
+
+      Samples for a given seed are the same on every platform and for any
+      number of threads.
+      )pbdoc")
+      .def(py::init<std::shared_ptr<config::Supercell const> const &,
+                    std::optional<std::vector<std::vector<Index>>> const &>(),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          supercell : libcasm.configuration.Supercell
+              The supercell. Samples have the default value of any
+              continuous DoF.
+          occupant_counts : Optional[list[list[int]]] = None
+              If not None, fixes the composition: ``occupant_counts[b][i]``
+              is the number of sites on sublattice ``b`` with occupant index
+              ``i``. The counts for each sublattice must sum to the number of
+              sites on that sublattice. Only the operations that preserve the
+              fixed composition are used to find canonical forms.
+          )pbdoc",
+           py::arg("supercell"), py::arg("occupant_counts") = std::nullopt)
+      .def(
+          "sample",
+          [](config::DistinctOccupationSampler const &self, Index n_samples,
+             std::uint64_t seed, Index n_threads) {
+            py::gil_scoped_release release;
+            return self.sample(n_samples, seed, n_threads);
+          },
+          R"pbdoc(
+          Draw distinct occupations
+
+          Parameters
+          ----------
+          n_samples : int
+              The number of samples. Samples are independent, so they may
+              repeat.
+          seed : int = 0
+              The random seed. Drawing more samples with the same seed
+              extends the same sequence.
+          n_threads: int = 1
+              Number of threads to use. If `n_threads <= 0`, all available
+              hardware threads are used. The result does not depend on
+              `n_threads`.
+
+          Returns
+          -------
+          samples : list[libcasm.configuration.Configuration]
+              The sampled configurations, in canonical form.
+          )pbdoc",
+          py::arg("n_samples"), py::arg("seed") = 0, py::arg("n_threads") = 1);
+
+  py::class_<config::OccupationFilter,
+             std::shared_ptr<config::OccupationFilter>>(m, "OccupationFilter",
+                                                        R"pbdoc(
+      Cheap predicates on the occupation of configurations in one supercell,
+      which can be applied to batches of occupation vectors
+
+      Predicates are added with the ``require_*`` methods, which return this
+      filter so they can be chained, and an occupation passes if it satisfies
+      all of them. Each occupation is checked in one pass over its sites,
+      without creating a Configuration, so use an OccupationFilter to reject
+      most candidates before more expensive checks, such as finding canonical
+      forms or calling Python functions.
+
+      .. rubric:: Example usage
+
+      .. code-block:: Python
+
+          occ_filter = (
+              casmenum.OccupationFilter(supercell)
+              .require_occupant_count(
+                  sublattice_index=0, occupant_index=1, min_count=0, max_count=2
+              )
+              .require_n_changed_sites(
+                  background_occupation=background.occupation,
+                  min_count=1,
+                  max_count=3,
+              )
+          )
+          n = config_enum.fill_occupation_batch(
+              batch=batch,
+              occupation_filter=occ_filter,
+          )
+      )pbdoc")
+      .def(py::init<std::shared_ptr<config::Supercell const> const &>(),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          supercell : libcasm.configuration.Supercell
+              The supercell of the occupations that are checked.
+          )pbdoc",
+           py::arg("supercell"))
+      .def_property_readonly("supercell", &config::OccupationFilter::supercell,
+                             "libcasm.configuration.Supercell: The supercell")
+      .def(
+          "require_occupant_count",
+          [](config::OccupationFilter &self, Index sublattice_index,
+             Index occupant_index, Index min_count,
+             Index max_count) -> config::OccupationFilter & {
+            return self.require_occupant_count(sublattice_index, occupant_index,
+                                               min_count, max_count);
+          },
+          R"pbdoc(
+          Require that the number of sites on a sublattice with an occupant is
+          in ``[min_count, max_count]``
+
+          If called more than once for the same sublattice and occupant, the
+          ranges are intersected.
+
+          Parameters
+          ----------
+          sublattice_index : int
+              The sublattice index, :math:`b`.
+          occupant_index : int
+              The occupant index on the sublattice.
+          min_count : int
+              The minimum number of sites with the occupant.
+          max_count : int
+              The maximum number of sites with the occupant.
+
+          Returns
+          -------
+          self : OccupationFilter
+              This filter
+          )pbdoc",
+          py::return_value_policy::reference_internal,
+          py::arg("sublattice_index"), py::arg("occupant_index"),
+          py::arg("min_count"), py::arg("max_count"))
+      .def(
+          "require_n_changed_sites",
+          [](config::OccupationFilter &self,
+             Eigen::VectorXi const &background_occupation, Index min_count,
+             Index max_count) -> config::OccupationFilter & {
+            return self.require_n_changed_sites(background_occupation,
+                                                min_count, max_count);
+          },
+          R"pbdoc(
+          Require that the number of sites with occupation different from
+          `background_occupation` is in ``[min_count, max_count]``
+
+          Replaces any previous requirement on the number of changed sites.
+
+          Parameters
+          ----------
+          background_occupation : np.ndarray[np.int[n_sites]]
+              The background occupation.
+          min_count : int
+              The minimum number of changed sites.
+          max_count : int
+              The maximum number of changed sites.
+
+          Returns
+          -------
+          self : OccupationFilter
+              This filter
+          )pbdoc",
+          py::return_value_policy::reference_internal,
+          py::arg("background_occupation"), py::arg("min_count"),
+          py::arg("max_count"))
+      .def(
+          "require_allowed_occupants",
+          [](config::OccupationFilter &self, std::set<Index> const &sites,
+             std::set<int> const &allowed_occupants)
+              -> config::OccupationFilter & {
+            return self.require_allowed_occupants(sites, allowed_occupants);
+          },
+          R"pbdoc(
+          Require that each site in `sites` has one of `allowed_occupants`
+
+          If called more than once for the same site, the allowed occupants
+          are intersected.
+
+          Parameters
+          ----------
+          sites : set[int]
+              Linear site indices.
+          allowed_occupants : set[int]
+              The allowed occupant indices, which must be less than 64.
+
+          Returns
+          -------
+          self : OccupationFilter
+              This filter
+          )pbdoc",
+          py::return_value_policy::reference_internal, py::arg("sites"),
+          py::arg("allowed_occupants"))
+      .def(
+          "is_allowed",
+          [](config::OccupationFilter const &self,
+             Eigen::VectorXi const &occupation) {
+            return self.is_allowed(occupation);
+          },
+          R"pbdoc(
+          Return True if an occupation vector satisfies all predicates
+
+          Parameters
+          ----------
+          occupation : np.ndarray[np.int[n_sites]]
+              An occupation vector.
+
+          Returns
+          -------
+          is_allowed : bool
+              True if `occupation` satisfies all predicates.
+          )pbdoc",
+          py::arg("occupation"))
+      .def("compact", &compact_occupation_batch<std::int32_t>, R"pbdoc(
+          Move the rows of a batch of occupations which satisfy all predicates
+          to the front, in order, and return how many there are
+
+          The GIL is released while the batch is checked.
+
+          Parameters
+          ----------
+          batch: np.ndarray[np.int32[batch_size, n_sites]]
+              A writable, C-contiguous array, as filled by
+              ``fill_occupation_batch``, which is modified in place. It must
+              have dtype int32 or int8.
+          n_rows: Optional[int] = None
+              The number of leading rows of `batch` to check. If None, check
+              all rows.
+
+          Returns
+          -------
+          n_allowed: int
+              The number of rows which satisfy all predicates, which are now
+              ``batch[:n_allowed]``. The contents of the other checked rows
+              are unspecified.
+          )pbdoc",
+           py::arg("batch").noconvert(), py::arg("n_rows") = std::nullopt)
+      .def("compact", &compact_occupation_batch<std::int8_t>,
+           py::arg("batch").noconvert(), py::arg("n_rows") = std::nullopt);
+
+  py::class_<config::MeshGridPointEnumerator>(m, "MeshGridPointEnumerator",
+                                              R"pbdoc(
+      Enumerate points in a meshgrid, or in the meshgrids along the edges of
+      each SubWedge of an irreducible wedge
+
+      Gives the same points, in the same order, as
+      :func:`~libcasm.enumerate.meshgrid_points` and
+      :func:`~libcasm.enumerate.irreducible_wedge_points`, but points are
+      generated in C++ and can be written directly into arrays with
+      :func:`fill_batch`.
+
+      If `dof_space_rep` is given, points equivalent to a previous point are
+      skipped. The canonical form of each point is found with one
+      matrix-vector product against the stacked representation matrices, and
+      canonical points are stored in an ordered set, so checking a point does
+      not require comparing it against all previous points.
+      )pbdoc")
+      .def(py::init<std::vector<Eigen::VectorXd> const &,
+                    std::optional<std::vector<Eigen::MatrixXd>> const &,
+                    double>(),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          There are two constructors, one for a meshgrid and one for an
+          irreducible wedge.
+
+          Parameters
+          ----------
+          xi : list[array_like]
+              For a meshgrid, 1-D arrays, `[x1, x2, ...]`, representing the
+              coordinates of a grid generated as if by `np.meshgrid`.
+          irreducible_wedge: list[libcasm.irreps.SubWedge]
+              For an irreducible wedge, the SubWedges, which are enumerated
+              in order.
+          basis_inv: np.ndarray[np.float64[subspace_dim, vector_dim]]
+              For an irreducible wedge, points are
+              ``basis_inv @ subwedge.trans_mat @ x`` for grid points ``x``,
+              as by ``dof_space.basis_inv``.
+          stop: float
+              For an irreducible wedge, the end value along each SubWedge
+              axis. The start value is 0.0, or ``-stop`` for axes with
+              symmetric multiplicity of 1.
+          num: int
+              For an irreducible wedge, the number of values along each
+              SubWedge axis. For axes with symmetric multiplicity of 1,
+              ``2*num-1`` is used.
+          trim_corners: bool = True
+              For an irreducible wedge, skip grid points that lie outside the
+              sphere of radius `stop`.
+          dof_space_rep: Optional[list[np.ndarray]] = None
+              If not None, skip points equivalent to a previous point, using
+              the representation from
+              :func:`~libcasm.configuration.make_dof_space_rep`.
+          abs_tol: float = :data:`~libcasm.casmglobal.TOL`
+              The absolute tolerance used for checking equivalence.
+          )pbdoc",
+           py::arg("xi"), py::arg("dof_space_rep") = std::nullopt,
+           py::arg("abs_tol") = TOL)
+      .def(py::init<std::vector<irreps::SubWedge> const &,
+                    Eigen::MatrixXd const &, double, Index, bool,
+                    std::optional<std::vector<Eigen::MatrixXd>> const &,
+                    double>(),
+           py::arg("irreducible_wedge"), py::arg("basis_inv"),
+           py::arg("stop"), py::arg("num"), py::arg("trim_corners") = true,
+           py::arg("dof_space_rep") = std::nullopt, py::arg("abs_tol") = TOL)
+      .def("dim", &config::MeshGridPointEnumerator::dim,
+           "Dimension of the points.")
+      .def("is_valid", &config::MeshGridPointEnumerator::is_valid,
+           "Return True if `value` is valid, False if no more valid values.")
+      .def("value", &config::MeshGridPointEnumerator::value,
+           "The current point.")
+      .def("grid_index", &config::MeshGridPointEnumerator::grid_index,
+           "The index of the grid, i.e. the SubWedge, of the current point.")
+      .def("advance", &config::MeshGridPointEnumerator::advance,
+           "Generate the next point.")
+      .def(
+          "fill_batch",
+          [](config::MeshGridPointEnumerator &enumerator,
+             Eigen::Ref<PointBatch> batch,
+             Eigen::Ref<Eigen::Matrix<std::int64_t, Eigen::Dynamic, 1>>
+                 grid_index) {
+            py::gil_scoped_release release;
+            return enumerator.fill_batch(batch, grid_index);
+          },
+          R"pbdoc(
+          Write the next points into the rows of existing arrays
+
+          Starting from the current `value`, each point is written into the
+          next row of `batch`, its grid index is written into the next
+          element of `grid_index`, and the enumerator is advanced, until
+          `batch` is full or there are no more valid values. The GIL is
+          released while the arrays are filled.
+
+          Parameters
+          ----------
+          batch: np.ndarray[np.float64[batch_size, dim]]
+              A writable, C-contiguous array, which is filled in place.
+          grid_index: np.ndarray[np.int64[batch_size]]
+              A writable array, which is filled in place.
+
+          Returns
+          -------
+          n_written: int
+              The number of rows of `batch` that were written. If it is less
+              than ``batch.shape[0]``, the enumeration is complete.
+          )pbdoc",
+          py::arg("batch").noconvert(), py::arg("grid_index").noconvert());
+
+  py::class_<clust::OrbitsAsIndices>(m, "OrbitsAsIndices", R"pbdoc(
+      Orbits of clusters, as linear site indices in a supercell, stored in
+      flat arrays
+
+      Cluster ``j`` is ``sites[cluster_offset[j]:cluster_offset[j+1]]``, and
+      orbit ``i`` is clusters ``orbit_offset[i]`` through
+      ``orbit_offset[i+1]-1``. Sites in a cluster and clusters in an orbit are
+      sorted and without duplicates.
+
+      The array attributes are read-only views of the data, not copies.
+      )pbdoc")
+      .def(py::init(&make_orbits_as_indices),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          supercell : libcasm.configuration.Supercell
+              The supercell in which linear site indices are generated.
+          orbits: list[list[Cluster]]
+              The orbits in the infinite crystal.
+          )pbdoc",
+           py::arg("supercell"), py::arg("orbits"))
+      .def_property_readonly(
+          "orbit_offset",
+          [](clust::OrbitsAsIndices const &self) {
+            return Eigen::Map<Eigen::Matrix<Index, Eigen::Dynamic, 1> const>(
+                self.orbit_offset.data(), self.orbit_offset.size());
+          },
+          py::return_value_policy::reference_internal,
+          "numpy.ndarray[numpy.int64[n_orbits + 1]]: Index of the first "
+          "cluster in each orbit")
+      .def_property_readonly(
+          "cluster_offset",
+          [](clust::OrbitsAsIndices const &self) {
+            return Eigen::Map<Eigen::Matrix<Index, Eigen::Dynamic, 1> const>(
+                self.cluster_offset.data(), self.cluster_offset.size());
+          },
+          py::return_value_policy::reference_internal,
+          "numpy.ndarray[numpy.int64[n_clusters + 1]]: Index in `sites` of "
+          "the first site in each cluster")
+      .def_property_readonly(
+          "sites",
+          [](clust::OrbitsAsIndices const &self) {
+            return Eigen::Map<Eigen::Matrix<Index, Eigen::Dynamic, 1> const>(
+                self.sites.data(), self.sites.size());
+          },
+          py::return_value_policy::reference_internal,
+          "numpy.ndarray[numpy.int64[n_sites]]: Linear site indices of all "
+          "clusters")
+      .def("n_orbits", &clust::OrbitsAsIndices::n_orbits,
+           "Return the number of orbits")
+      .def("n_clusters", &clust::OrbitsAsIndices::n_clusters,
+           "Return the number of clusters, in all orbits")
+      .def(
+          "to_list",
+          [](clust::OrbitsAsIndices const &self) {
+            std::vector<std::vector<std::vector<Index>>> orbits;
+            for (Index i = 0; i < self.n_orbits(); ++i) {
+              std::vector<std::vector<Index>> orbit;
+              for (Index j = self.orbit_offset[i];
+                   j < self.orbit_offset[i + 1]; ++j) {
+                orbit.emplace_back(self.cluster_begin(j), self.cluster_end(j));
+              }
+              orbits.push_back(std::move(orbit));
+            }
+            return orbits;
+          },
+          R"pbdoc(
+          Return the orbits as nested lists
+
+          Returns
+          -------
+          orbits_as_indices: list[list[list[int]]]
+              Where ``orbits_as_indices[i][j]`` is the `j`-th cluster in the
+              `i`-th orbit, represented as a sorted list of linear site
+              indices.
           )pbdoc");
 
+  py::class_<clust::SupercellImpactTable>(m, "SupercellImpactTable", R"pbdoc(
+      Impact neighborhoods, as linear site indices in a supercell, stored in
+      flat arrays
+
+      Row ``i`` is ``sites[row_offset[i]:row_offset[i+1]]``, sorted and
+      without duplicates. Tables are made by
+      :func:`~libcasm.enumerate.make_flower_impact_table`, with one row per
+      site, or :func:`~libcasm.enumerate.make_local_impact_table`, with one
+      row per unit cell.
+
+      The array attributes are read-only views of the data, not copies.
+      )pbdoc")
+      .def_property_readonly(
+          "row_offset",
+          [](clust::SupercellImpactTable const &self) {
+            return Eigen::Map<Eigen::Matrix<Index, Eigen::Dynamic, 1> const>(
+                self.row_offset.data(), self.row_offset.size());
+          },
+          py::return_value_policy::reference_internal,
+          "numpy.ndarray[numpy.int64[n_rows + 1]]: Index in `sites` of the "
+          "first site in each row")
+      .def_property_readonly(
+          "sites",
+          [](clust::SupercellImpactTable const &self) {
+            return Eigen::Map<Eigen::Matrix<Index, Eigen::Dynamic, 1> const>(
+                self.sites.data(), self.sites.size());
+          },
+          py::return_value_policy::reference_internal,
+          "numpy.ndarray[numpy.int64[n_sites]]: Linear site indices of all "
+          "rows")
+      .def("n_rows", &clust::SupercellImpactTable::n_rows,
+           "Return the number of rows")
+      .def(
+          "row",
+          [](clust::SupercellImpactTable const &self, Index i) {
+            if (i < 0 || i >= self.n_rows()) {
+              throw std::runtime_error(
+                  "Error in SupercellImpactTable.row: index out of range");
+            }
+            return Eigen::Map<Eigen::Matrix<Index, Eigen::Dynamic, 1> const>(
+                self.row_begin(i), self.row_size(i));
+          },
+          py::return_value_policy::reference_internal,
+          R"pbdoc(
+          Return row `i`, as a read-only view
+
+          Parameters
+          ----------
+          i: int
+              The row index.
+
+          Returns
+          -------
+          row: numpy.ndarray[numpy.int64[row_size]]
+              The sorted linear site indices in row `i`.
+          )pbdoc",
+          py::arg("i"));
+
+  m.def("make_flower_impact_table", &make_flower_impact_table, R"pbdoc(
+      Make a table of the flower neighborhood of each site in a supercell
+
+      Parameters
+      ----------
+      supercell : libcasm.configuration.Supercell
+          The supercell in which linear site indices are generated.
+      orbits: list[list[libcasm.clusterography.Cluster]]
+          The periodic orbits, usually those with non-zero ECI.
+
+      Returns
+      -------
+      table: SupercellImpactTable
+          A table with one row per site in the supercell, where row ``l`` is
+          the linear site indices of the sites that share a cluster with site
+          ``l``, including ``l``. These are the sites whose cluster
+          contributions can change when site ``l`` changes.
+      )pbdoc",
+        py::arg("supercell"), py::arg("orbits"),
+        py::call_guard<py::gil_scoped_release>());
+
+  m.def("make_local_impact_table", &make_local_impact_table, R"pbdoc(
+      Make a table of the local neighborhood of a phenomenal cluster,
+      translated to each unit cell in a supercell
+
+      Parameters
+      ----------
+      supercell : libcasm.configuration.Supercell
+          The supercell in which linear site indices are generated.
+      local_orbits: list[list[libcasm.clusterography.Cluster]]
+          The local-cluster orbits of the phenomenal cluster, usually those
+          with non-zero ECI.
+
+      Returns
+      -------
+      table: SupercellImpactTable
+          A table with one row per unit cell in the supercell, where row
+          ``i`` is the linear site indices of the sites in the local
+          clusters, translated to the ``i``-th unit cell of the supercell, as
+          counted by ``supercell.unitcell_index_converter``.
+      )pbdoc",
+        py::arg("supercell"), py::arg("local_orbits"),
+        py::call_guard<py::gil_scoped_release>());
+
   m.def("make_all_distinct_periodic_perturbations",
         &make_all_distinct_periodic_perturbations,
         "Documented in libcasm.enumerate._methods.py", py::arg("supercell"),
-        py::arg("motif"), py::arg("clusters"));
+        py::arg("motif"), py::arg("clusters"), py::arg("n_threads") = 1,
+        py::call_guard<py::gil_scoped_release>());
 
   m.def(
       "make_distinct_cluster_sites",
@@ -432,7 +1879,7 @@ PYBIND11_MODULE(_enumerate, m) {
         xtal::UnitCellCoordIndexConverter const &converter =
             supercell->unitcellcoord_index_converter;
         auto orbits_as_indices =
-            clust::make_orbits_as_indices(orbits, converter);
+            clust::make_flat_orbits_as_indices(orbits, converter);
 
         // find distinct cluster sites in the background configuration
         std::set<std::set<Index>> _distinct_cluster_sites =
@@ -466,10 +1913,42 @@ PYBIND11_MODULE(_enumerate, m) {
       )pbdoc",
       py::arg("configuration"), py::arg("orbits"));
 
+  m.def(
+      "make_distinct_cluster_sites",
+      [](config::Configuration const &background,
+         clust::OrbitsAsIndices const &orbits_as_indices) {
+        std::set<std::set<Index>> _distinct_cluster_sites =
+            config::make_distinct_cluster_sites(background, orbits_as_indices);
+        return std::vector<std::set<Index>>(_distinct_cluster_sites.begin(),
+                                            _distinct_cluster_sites.end());
+      },
+      R"pbdoc(
+      Make the distinct clusters of sites in a particular configuration, given
+      orbits already converted to linear site indices
+
+      Parameters
+      ----------
+      configuration : libcasm.configuration.Configuration
+          The background configuration in which distinct clusters will be found.
+
+      orbits: OrbitsAsIndices
+          The orbits in the infinite crystal, as linear site indices in the
+          supercell of `configuration`.
+
+      Returns
+      -------
+      distinct_cluster_sites: list[set[int]]
+          The symmetrically distinct clusters in the background configuration,
+          where ``distinct_cluster_sites[i]`` is the `i`-th distinct cluster,
+          represented as a set of linear site indices in the supercell.
+      )pbdoc",
+      py::arg("configuration"), py::arg("orbits"));
+
   m.def("make_all_distinct_local_perturbations",
         &make_all_distinct_local_perturbations,
         "Documented in libcasm.enumerate._methods.py", py::arg("supercell"),
-        py::arg("occ_event"), py::arg("motif"), py::arg("local_clusters"));
+        py::arg("occ_event"), py::arg("motif"), py::arg("local_clusters"),
+        py::arg("n_threads") = 1, py::call_guard<py::gil_scoped_release>());
 
   m.def("make_occevent_simple_structures", &make_occevent_simple_structures,
         R"pbdoc(
@@ -517,6 +1996,47 @@ PYBIND11_MODULE(_enumerate, m) {
         py::arg("interpolation_factors"), py::arg("system"),
         py::arg("skip_event_occupants"));
 
+  m.def("make_occevent_structure_coords", &make_occevent_structure_coords,
+        R"pbdoc(
+      Construct atom coordinates along OccEvent paths in a background
+      configuration, as arrays
+
+      This gives the same lattice, atom types, and coordinates as
+      :func:`make_occevent_simple_structures`, for many events and images,
+      without constructing a :class:`~libcasm.xtal.Structure` for each image.
+      For each event, the background coordinates are computed once and only
+      the coordinates of the atoms involved in the event are written for
+      each image.
+
+      Parameters
+      ----------
+      configuration : libcasm.configuration.Configuration
+          The background configuration, which sets the occupation on
+          all sites not involved in the events.
+      occ_events: list[libcasm.occ_events.OccEvent]
+          The occupation events.
+      interpolation_factors: list[double]
+          Interpolation factors, ranging for 0.0 (initial event
+          occupation) to 1.0 (final event occupation), specifying
+          which images along the event pathways should be generated.
+      system: libcasm.occ_events.OccSystem
+          The OccSystem is used to determine output atom type order and
+          help with index conversions.
+      skip_event_occupants: bool = False
+          If True, the occupants involved in the event are not included in
+          the output.
+
+      Returns
+      -------
+      results : list[tuple[numpy.ndarray[numpy.float64[3, 3]], list[str], numpy.ndarray[numpy.float64[n_images, 3, n_atoms]]]]
+          For each event, a tuple ``(lattice_column_vector_matrix, atom_type,
+          coords)``, where ``coords[k]`` holds the Cartesian coordinates of
+          the atoms, as columns, for image ``k``.
+      )pbdoc",
+        py::arg("configuration"), py::arg("occ_events"),
+        py::arg("interpolation_factors"), py::arg("system"),
+        py::arg("skip_event_occupants") = false);
+
   m.def("make_phenomenal_occevent", &make_phenomenal_occevent,
         R"pbdoc(
       Construct the phenomenal OccEvent for the equivalent local basis sets
@@ -576,6 +2096,157 @@ PYBIND11_MODULE(_enumerate, m) {
         py::arg("occ_event"), py::arg("phenomenal_occevent"),
         py::arg("supercell"));
 
+  m.def("make_occevent_site_index_table", &make_occevent_site_index_table,
+        R"pbdoc(
+      Make linear site indices and occupation for every translation of
+      every equivalent OccEvent in a supercell
+
+      This is the bulk form of finding the linear supercell site indices
+      of an OccEvent, for each of the `phenomenal_occevent` and each of
+      their translations within the supercell, such as for setting up a
+      kinetic Monte Carlo event list. Translations are computed in
+      parallel.
+
+      Parameters
+      ----------
+      phenomenal_occevent : List[libcasm.occ_events.OccEvent]
+          The equivalent OccEvent of an orbit, such as generated by
+          :func:`make_phenomenal_occevent`. Each must have the same number
+          of sites.
+      supercell : libcasm.configuration.Supercell
+          The supercell in which OccEvent are translated
+      n_threads: int = 1
+          Number of threads to use. If `n_threads <= 0`, all available
+          hardware threads are used. The result does not depend on
+          `n_threads`.
+
+      Returns
+      -------
+      sites : numpy.ndarray[numpy.int32[n_equivalents, n_translations, n_sites]]
+          The linear supercell site index, ``sites[e, l, s]``, of site `s`
+          of ``phenomenal_occevent[e]`` translated to the unit cell with
+          linear index `l`, according to
+          ``supercell.unitcell_index_converter``. Sites are in the order
+          of ``phenomenal_occevent[e].cluster()``.
+      occ_init : numpy.ndarray[numpy.int32[n_equivalents, n_sites]]
+          The initial occupation, ``occ_init[e, s]``, of site `s` of
+          ``phenomenal_occevent[e]``, which is the same for all
+          translations.
+      occ_final : numpy.ndarray[numpy.int32[n_equivalents, n_sites]]
+          The final occupation, ``occ_final[e, s]``, of site `s` of
+          ``phenomenal_occevent[e]``, which is the same for all
+          translations.
+      )pbdoc",
+        py::arg("phenomenal_occevent"), py::arg("supercell"),
+        py::arg("n_threads") = 1);
+
+  m.def("make_local_orbits_index_table", &make_local_orbits_index_table,
+        R"pbdoc(
+      Make linear site indices of the local clusters of every translation
+      of every equivalent phenomenal cluster in a supercell
+
+      This is the local counterpart of
+      :class:`~libcasm.enumerate.OrbitsAsIndices`, for local-cluster orbits
+      such as those generated by
+      :func:`libcasm.clusterography.ClusterSpecs.make_orbits` with local
+      cluster specs. The
+      clusters around each equivalent phenomenal cluster are generated by
+      transforming the clusters around the prototype, so cluster `j` of
+      each row corresponds to cluster `j` around the prototype, with sites
+      in the same order. Rows are computed in parallel.
+
+      The parameters `phenomenal_clusters` and
+      `equivalent_generating_op_indices` can be read from the
+      "equivalents_info.json" file generated when the local basis sets are
+      constructed.
+
+      Parameters
+      ----------
+      prototype : libcasm.clusterography.Cluster
+          The prototype phenomenal cluster.
+      local_orbits : list[list[libcasm.clusterography.Cluster]]
+          The local-cluster orbits around `prototype`.
+      phenomenal_clusters : list[libcasm.clusterography.Cluster]
+          The equivalent phenomenal clusters.
+      equivalent_generating_op_indices : list[int]
+          Indices of the prim factor group operations that generate
+          `phenomenal_clusters` from `prototype`.
+      supercell : libcasm.configuration.Supercell
+          The supercell in which linear site indices are generated.
+      n_threads: int = 1
+          Number of threads to use. If `n_threads <= 0`, all available
+          hardware threads are used. The result does not depend on
+          `n_threads`.
+
+      Returns
+      -------
+      sites : numpy.ndarray[numpy.int32[n_equivalents, n_translations, n_cluster_sites]]
+          The linear supercell site indices of all local clusters around
+          equivalent `e`, translated to the unit cell with linear index
+          `l`, according to ``supercell.unitcell_index_converter``, are
+          ``sites[e, l, :]``.
+      orbit_offset : numpy.ndarray[numpy.int64[n_orbits + 1]]
+          Orbit `i` is clusters ``orbit_offset[i]`` through
+          ``orbit_offset[i+1]-1``.
+      cluster_offset : numpy.ndarray[numpy.int64[n_clusters + 1]]
+          Cluster `j` is ``sites[e, l, cluster_offset[j]:cluster_offset[j+1]]``.
+      )pbdoc",
+        py::arg("prototype"), py::arg("local_orbits"),
+        py::arg("phenomenal_clusters"),
+        py::arg("equivalent_generating_op_indices"), py::arg("supercell"),
+        py::arg("n_threads") = 1);
+
+  m.def("count_distinct_occupations", &count_distinct_occupations,
+        R"pbdoc(
+      Count the symmetrically distinct occupations of a supercell, without
+      enumerating them
+
+      By Burnside's lemma, the number of distinct occupations is the
+      average, over all supercell operations, of the number of occupations
+      each leaves unchanged, which depends only on the cycle type of the
+      operation's site permutation. Counts by composition use Pólya's
+      generating function over the same cycle types. This takes
+      milliseconds for supercells where enumerating the occupations would
+      be impossible, and is useful for sizing and planning enumerations.
+
+      Counts include occupations whose primitive cell is smaller than the
+      supercell, as for filtering :class:`ConfigEnumAllOccupations` by
+      canonical form.
+
+      Parameters
+      ----------
+      supercell : libcasm.configuration.Supercell
+          The supercell. Its prim must not have occupants that transform
+          into other occupants under symmetry.
+      by_composition : bool = False
+          If True, also count by composition.
+      n_threads: int = 1
+          Number of threads to use. If `n_threads <= 0`, all available
+          hardware threads are used. The result does not depend on
+          `n_threads`.
+
+      Returns
+      -------
+      counts : dict
+          A dict with:
+
+          - "total": int, the number of distinct occupations. Counts are
+            exact, and may be very large.
+          - "sublattice_orbits": list[list[int]], the sublattices in each
+            orbit of sublattices under the supercell factor group.
+          - "n_occupants": list[int], the number of allowed occupants on
+            the sublattices of each orbit.
+          - "n_sites": list[int], the number of supercell sites in each
+            orbit.
+          - "group_order": int, the number of supercell operations.
+          - "n_cycle_types": int, the number of distinct cycle types.
+          - "by_composition": dict[tuple[int, ...], int], if
+            `by_composition`. Keys are the number of sites with each
+            occupant, by sublattice orbit, concatenated in orbit order.
+      )pbdoc",
+        py::arg("supercell"), py::arg("by_composition") = false,
+        py::arg("n_threads") = 1);
+
   m.def(
       "_make_canonical_local_configuration_about_event",
       [](config::Configuration const &configuration,
@@ -654,8 +2325,8 @@ PYBIND11_MODULE(_enumerate, m) {
         // convert to linear site indices
         xtal::UnitCellCoordIndexConverter const &converter =
             supercell->unitcellcoord_index_converter;
-        std::vector<std::set<std::set<Index>>> local_orbits_as_indices =
-            clust::make_orbits_as_indices(local_orbits, converter);
+        clust::OrbitsAsIndices local_orbits_as_indices =
+            clust::make_flat_orbits_as_indices(local_orbits, converter);
 
         std::set<std::set<Index>> _distinct_local_cluster_sites =
             config::make_distinct_local_cluster_sites(
@@ -836,6 +2507,266 @@ PYBIND11_MODULE(_enumerate, m) {
       py::arg("distinct_local_cluster_sites"),
       py::arg("allow_subcluster_perturbations"));
 
+  typedef std::tuple<Index, std::vector<Index>, std::vector<int>,
+                     std::vector<int>, config::Configuration,
+                     config::Configuration>
+      perturbation_tuple_type;
+  auto to_perturbation_tuples =
+      [](std::vector<config::LocalOccupationPerturbation> const &results) {
+        std::vector<perturbation_tuple_type> tuples;
+        tuples.reserve(results.size());
+        for (auto const &x : results) {
+          tuples.emplace_back(x.i_local_orbit, x.sites, x.initial_occupation,
+                              x.final_occupation, x.configuration,
+                              x.canonical_configuration);
+        }
+        return tuples;
+      };
+
+  py::class_<config::ConfigEnumLocalOccupationsEngine>(
+      m, "ConfigEnumLocalOccupationsEngine", R"pbdoc(
+      Enumerates distinct occupation perturbations in the local environment of
+      an event in a background configuration
+
+      This implements the per-cluster loop of
+      :class:`~libcasm.enumerate.ConfigEnumLocalOccupations`. The symmetry
+      operations that leave the background and event invariant, and the
+      permutations used to find canonical configurations, are computed once
+      at construction and reused for all local-clusters.
+
+      Results are returned as a list of tuples
+      ``(i_local_orbit, sites, initial_occupation, final_occupation, config,
+      canonical_config)``, where:
+
+      - `i_local_orbit`: int, The index of the local-cluster orbit that was
+        perturbed, or -1 for a neighborhood perturbation.
+      - `sites`: list[int], The linear site indices of the sites on which the
+        perturbation was applied.
+      - `initial_occupation`: list[int], The background occupation on `sites`.
+      - `final_occupation`: list[int], The perturbed occupation on `sites`.
+      - `config`: :class:`~libcasm.configuration.Configuration`, The
+        configuration with the perturbation applied.
+      - `canonical_config`: :class:`~libcasm.configuration.Configuration`,
+        The canonical form of `config`, as determined by application of
+        `event_group`, which is used to find distinct perturbations.
+
+      All occupations on each distinct local-cluster are included, including
+      those which leave some sites unchanged. Distinct perturbations are found
+      separately for each local-cluster orbit.
+      )pbdoc")
+      .def(py::init([](config::Configuration const &background,
+                       occ_events::OccEvent const &occ_event,
+                       std::vector<config::SupercellSymOp> const &event_group) {
+             auto const &converter =
+                 background.supercell->unitcellcoord_index_converter;
+             auto cluster_occupation =
+                 occ_events::make_cluster_occupation(occ_event);
+             std::vector<Index> event_sites =
+                 to_index_vector(cluster_occupation.first, converter);
+             return config::ConfigEnumLocalOccupationsEngine(
+                 background, event_sites, cluster_occupation.second[0],
+                 cluster_occupation.second[1], event_group);
+           }),
+           R"pbdoc(
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          background : libcasm.configuration.Configuration
+              The background configuration, in the supercell where
+              perturbations are enumerated.
+          event : libcasm.occ_events.OccEvent
+              The event, positioned in the supercell.
+          event_group : list[libcasm.configuration.SupercellSymOp]
+              The subset of the supercell symmetry group that leaves the event
+              invariant.
+          )pbdoc",
+           py::arg("background"), py::arg("event"), py::arg("event_group"))
+      .def("background", &config::ConfigEnumLocalOccupationsEngine::background,
+           "Return the background configuration.")
+      .def("reference", &config::ConfigEnumLocalOccupationsEngine::reference,
+           "Return the reference configuration, which is perturbed: the "
+           "greater of `background` with the initial or the final event "
+           "occupation applied.")
+      .def("make_canonical_form",
+           &config::ConfigEnumLocalOccupationsEngine::make_canonical_form,
+           "Make the canonical form of a configuration in the context of the "
+           "event.",
+           py::arg("configuration"))
+      .def("set_progress",
+           &config::ConfigEnumLocalOccupationsEngine::set_progress, R"pbdoc(
+          Count the perturbations generated and kept in `progress`
+
+          Parameters
+          ----------
+          progress: Optional[libcasm.enumerate.EnumProgress]
+              If not None, :func:`by_cluster` and :func:`by_neighborhood` add
+              the number of occupations on each local-cluster to its
+              estimated total, each perturbed configuration to its generated
+              count, and each distinct perturbation kept to its canonical and
+              accepted counts.
+          )pbdoc",
+           py::arg("progress"))
+      .def(
+          "by_cluster",
+          [=](config::ConfigEnumLocalOccupationsEngine const &self,
+              std::vector<std::vector<clust::IntegralCluster>> const
+                  &_local_orbits,
+              std::optional<std::set<Index>> const &orbits) {
+            std::vector<std::set<clust::IntegralCluster>> local_orbits;
+            for (auto const &_orbit : _local_orbits) {
+              local_orbits.emplace_back(_orbit.begin(), _orbit.end());
+            }
+            std::vector<config::LocalOccupationPerturbation> results;
+            {
+              py::gil_scoped_release release;
+              results = self.by_cluster(local_orbits, orbits);
+            }
+            return to_perturbation_tuples(results);
+          },
+          R"pbdoc(
+          Make distinct perturbations on each local-cluster orbit
+
+          Parameters
+          ----------
+          local_orbits : list[list[libcasm.clusterography.Cluster]]
+              The local-cluster orbits, positioned around the event.
+          orbits : Optional[set[int]] = None
+              If provided, only perturb the local-cluster orbits with these
+              indices.
+
+          Returns
+          -------
+          results : list[tuple]
+              The distinct perturbations, for each selected orbit in order.
+          )pbdoc",
+          py::arg("local_orbits"), py::arg("orbits") = std::nullopt)
+      .def(
+          "by_neighborhood",
+          [=](config::ConfigEnumLocalOccupationsEngine const &self,
+              std::vector<std::vector<clust::IntegralCluster>> const
+                  &_local_orbits,
+              std::set<Index> const &neighborhood_from_orbits) {
+            std::vector<std::set<clust::IntegralCluster>> local_orbits;
+            for (auto const &_orbit : _local_orbits) {
+              local_orbits.emplace_back(_orbit.begin(), _orbit.end());
+            }
+            std::vector<config::LocalOccupationPerturbation> results;
+            {
+              py::gil_scoped_release release;
+              results =
+                  self.by_neighborhood(local_orbits, neighborhood_from_orbits);
+            }
+            return to_perturbation_tuples(results);
+          },
+          R"pbdoc(
+          Make distinct perturbations on a neighborhood of sites
+
+          Parameters
+          ----------
+          local_orbits : list[list[libcasm.clusterography.Cluster]]
+              The local-cluster orbits, positioned around the event.
+          neighborhood_from_orbits : set[int]
+              The indices of the local-cluster orbits whose sites are combined
+              into a single neighborhood, on which all occupations are
+              enumerated.
+
+          Returns
+          -------
+          results : list[tuple]
+              The distinct perturbations, with `i_local_orbit` equal to -1.
+          )pbdoc",
+          py::arg("local_orbits"), py::arg("neighborhood_from_orbits"));
+
+  m.def("make_suborbit_generating_ops", &config::make_suborbit_generating_ops,
+        py::call_guard<py::gil_scoped_release>(),
+        R"pbdoc(
+      Return the operations that place an event in each distinct position with
+      respect to a background configuration
+
+      Parameters
+      ----------
+      supercell : libcasm.configuration.Supercell
+          The supercell of the background configuration.
+      event_group : list[libcasm.configuration.SupercellSymOp]
+          The operations that leave the event invariant.
+      background_group : list[libcasm.configuration.SupercellSymOp]
+          The operations that leave the background configuration invariant.
+
+      Returns
+      -------
+      ops : list[libcasm.configuration.SupercellSymOp]
+          The operations, `rep`, such that no
+          ``background_op * rep * event_op`` is less than `rep`. Applying each
+          to the event generates one event from each distinct suborbit.
+      )pbdoc",
+        py::arg("supercell"), py::arg("event_group"),
+        py::arg("background_group"));
+
+  m.def(
+      "make_distinct_occupations",
+      [](config::Configuration const &background, std::set<Index> const &sites,
+         bool skip_non_primitive, Index n_threads,
+         std::shared_ptr<config::EnumProgress> progress) {
+        // non-primitive configurations are skipped before canonicalization
+        config::GenericConfigurationFilter filter;
+        filter.primitive_only = false;
+        filter.canonical_only = false;
+        filter.f = [](config::Configuration const &configuration) {
+          return true;
+        };
+        std::set<config::Configuration> distinct;
+        {
+          py::gil_scoped_release release;
+          distinct = config::make_distinct_occupations(
+              background, sites, filter, n_threads, progress.get(),
+              skip_non_primitive);
+        }
+        return std::vector<config::Configuration>(distinct.begin(),
+                                                  distinct.end());
+      },
+      R"pbdoc(
+      Enumerate all occupations on a set of sites in a background
+      configuration, using multiple threads, and return the distinct
+      canonical configurations.
+
+      The occupations of the leading sites are fixed to split the enumeration
+      into disjoint partitions, which are enumerated, canonicalized, and
+      filtered in parallel. The results are the same as enumerating with
+      :class:`~libcasm.enumerate.ConfigEnumAllOccupations` and keeping
+      canonical configurations, but are returned in sorted order.
+
+      Parameters
+      ----------
+      background : libcasm.configuration.Configuration
+          The background configuration.
+      sites : set[int]
+          The linear site indices on which occupations are enumerated. All
+          other sites keep the occupation of the background configuration.
+      skip_non_primitive : bool = True
+          If True, exclude non-primitive configurations. They are skipped as
+          they are enumerated, before canonicalization, using
+          :class:`~libcasm.configuration.PrimitiveConfigurationChecker`.
+      n_threads : int = 1
+          Number of threads to use. If ``n_threads <= 0``, use the number of
+          hardware threads.
+      progress : Optional[libcasm.enumerate.EnumProgress] = None
+          If not None, progress is counted per batch of configurations. The
+          number of accepted configurations counts the distinct results.
+          Skipped non-primitive configurations are counted as generated
+          only.
+
+      Returns
+      -------
+      configurations : list[libcasm.configuration.Configuration]
+          The distinct canonical configurations, with respect to the
+          operations that leave the supercell lattice vectors invariant, in
+          sorted order.
+      )pbdoc",
+      py::arg("background"), py::arg("sites"),
+      py::arg("skip_non_primitive") = true, py::arg("n_threads") = 1,
+      py::arg("progress") = nullptr);
+
 #ifdef VERSION_INFO
   m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
 #else
@@ -12,8 +12,10 @@
 #include "casm/configuration/group/Group.hh"
 #include "casm/configuration/group/subgroups.hh"
 #include "casm/configuration/irreps/IrrepDecomposition.hh"
+#include "casm/configuration/irreps/IrrepDecompositionCache.hh"
 #include "casm/configuration/irreps/IrrepWedge.hh"
 #include "casm/configuration/irreps/VectorSpaceSymReport.hh"
+#include "casm/configuration/irreps/VectorSymmetrizer.hh"
 #include "casm/configuration/irreps/io/json/IrrepDecomposition_json_io.hh"
 #include "casm/configuration/irreps/io/json/VectorSpaceSymReport_json_io.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
@@ -62,7 +64,7 @@ irreps::IrrepDecomposition make_IrrepDecomposition(
     irreps::MatrixRep const &matrix_rep,
     std::optional<irreps::GroupIndices> head_group,
     std::optional<Eigen::MatrixXd> init_subspace, bool allow_complex,
-    double abs_tol) {
+    double abs_tol, Index n_threads) {
   if (matrix_rep.size() == 0) {
     throw std::runtime_error(
         "Error in make_IrrepDecomposition: matrix_rep.size() == 0");
@@ -101,9 +103,9 @@ irreps::IrrepDecomposition make_IrrepDecomposition(
   };
 
   std::optional<Log> log;
-  return irreps::IrrepDecomposition(matrix_rep, *head_group, *init_subspace,
-                                    make_cyclic_subgroups_f,
-                                    make_all_subgroups_f, allow_complex, log);
+  return irreps::IrrepDecomposition(
+      matrix_rep, *head_group, *init_subspace, make_cyclic_subgroups_f,
+      make_all_subgroups_f, allow_complex, log, n_threads);
 }
 
 }  // namespace CASMpy
@@ -535,12 +537,24 @@ PYBIND11_MODULE(_irreps, m) {
           abs_tol: float = :data:`~libcasm.casmglobal.TOL`
               The absolute tolerance, used to construct a group multiplication
               table.
+          n_threads: int = 1
+              Number of threads used to construct commuter matrices. If
+              `n_threads <= 0`, use the number of hardware threads. The result
+              does not depend on `n_threads`.
           )pbdoc",
            py::arg("matrix_rep"), py::arg("head_group") = std::nullopt,
            py::arg("init_subspace") = std::nullopt,
-           py::arg("allow_complex") = true, py::arg("abs_tol") = CASM::TOL)
-      .def_readonly("matrix_rep", &irreps::IrrepDecomposition::fullspace_rep,
-                    "Full space matrix representation")
+           py::arg("allow_complex") = true, py::arg("abs_tol") = CASM::TOL,
+           py::arg("n_threads") = 1, py::call_guard<py::gil_scoped_release>())
+      .def_property_readonly(
+          "matrix_rep",
+          [](irreps::IrrepDecomposition const &self) {
+            if (self.fullspace_block_rep.has_value()) {
+              return irreps::to_dense(*self.fullspace_block_rep);
+            }
+            return self.fullspace_rep;
+          },
+          "Full space matrix representation")
       .def_readonly("head_group", &irreps::IrrepDecomposition::head_group,
                     "Group used to find irreps, as indices into `matrix_rep`")
       .def_readonly("subspace", &irreps::IrrepDecomposition::subspace,
@@ -559,19 +573,10 @@ PYBIND11_MODULE(_irreps, m) {
       .def(
           "make_symmetry_report",
           [](irreps::IrrepDecomposition const &self, bool calc_wedges,
-             std::optional<std::vector<std::string>> glossary)
-              -> irreps::VectorSpaceSymReport {
-            if (!glossary.has_value()) {
-              Index dim = self.fullspace_rep[0].rows();
-              std::vector<std::string> _glossary;
-              for (Index i = 0; i < dim; ++i) {
-                _glossary.push_back(std::string("x") + std::to_string(i + 1));
-              }
-              glossary = _glossary;
-            }
-
+             std::optional<std::vector<std::string>> glossary,
+             Index n_threads) -> irreps::VectorSpaceSymReport {
             return irreps::vector_space_sym_report(self, calc_wedges,
-                                                   *glossary);
+                                                   glossary, n_threads);
           },
           R"pbdoc(
           Construct a VectorSpaceSymReport
@@ -584,8 +589,149 @@ PYBIND11_MODULE(_irreps, m) {
               portions of the vector space, which is useful for enumeration.
           glossary: Optional[list[str]] = None
               If provided, a description of each dimension of the vector space.
+              Otherwise, ``["x1", "x2", ...]``.
+          n_threads: int = 1
+              Number of threads used to calculate the irreducible wedges. If
+              `n_threads <= 0`, use the number of hardware threads. The result
+              does not depend on `n_threads`.
+          )pbdoc",
+          py::arg("calc_wedges") = false, py::arg("glossary") = std::nullopt,
+          py::arg("n_threads") = 1, py::call_guard<py::gil_scoped_release>());
+
+  py::class_<irreps::IrrepDecompositionCache,
+             std::shared_ptr<irreps::IrrepDecompositionCache>>(
+      m, "IrrepDecompositionCache", R"pbdoc(
+      Stores irreducible space decompositions in memory, keyed by their inputs
+
+      An IrrepDecompositionCache can be passed to
+      :func:`libcasm.configuration.dof_space_analysis` so that repeated
+      analyses with the same matrix representation and DoF space basis, such
+      as for the same prim and DoF in different supercells with the same
+      symmetry, reuse the irreducible space decomposition. Matrix
+      representations and initial subspaces are compared using `abs_tol`.
+      )pbdoc")
+      .def(py::init<double>(), R"pbdoc(
+
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          abs_tol: float = :data:`~libcasm.casmglobal.TOL`
+              The absolute tolerance used to compare inputs.
+          )pbdoc",
+           py::arg("abs_tol") = CASM::TOL)
+      .def("abs_tol", &irreps::IrrepDecompositionCache::tol,
+           "Return the absolute tolerance used to compare inputs.")
+      .def("size", &irreps::IrrepDecompositionCache::size,
+           "Return the number of stored irreducible space decompositions.")
+      .def("clear", &irreps::IrrepDecompositionCache::clear,
+           "Erase the stored irreducible space decompositions.");
+
+  py::class_<irreps::VectorSymmetrizer>(m, "VectorSymmetrizer", R"pbdoc(
+      Applies a precomputed linear symmetrization operator to many vectors at
+      once
+
+      The operator is either the group average of a matrix representation,
+      from :func:`make_group_average_symmetrizer`, or a projector onto one or
+      more irreducible subspaces, from :func:`make_irrep_projector`. Vectors
+      are the columns of a ``(dim, n_vectors)`` array, so applying the
+      operator is one matrix-matrix product.
+      )pbdoc")
+      .def(py::init<Eigen::MatrixXd>(), R"pbdoc(
+
+          .. rubric:: Constructor
+
+          Parameters
+          ----------
+          matrix: np.ndarray[np.float64[dim, dim]]
+              The operator matrix.
+          )pbdoc",
+           py::arg("matrix"))
+      .def_property_readonly("matrix", &irreps::VectorSymmetrizer::matrix,
+                             "np.ndarray[np.float64[dim, dim]]: The operator "
+                             "matrix.")
+      .def("dim", &irreps::VectorSymmetrizer::dim, "Vector dimension.")
+      .def(
+          "__call__",
+          [](irreps::VectorSymmetrizer const &self,
+             Eigen::MatrixXd const &vectors) {
+            py::gil_scoped_release release;
+            return self(vectors);
+          },
+          R"pbdoc(
+          Apply the operator to each column
+
+          Parameters
+          ----------
+          vectors: np.ndarray[np.float64[dim, n_vectors]]
+              Vectors to symmetrize or project, one per column.
+
+          Returns
+          -------
+          result: np.ndarray[np.float64[dim, n_vectors]]
+              ``matrix @ vectors``.
+          )pbdoc",
+          py::arg("vectors"))
+      .def(
+          "apply_in_place",
+          [](irreps::VectorSymmetrizer const &self,
+             Eigen::Ref<Eigen::MatrixXd> vectors) {
+            py::gil_scoped_release release;
+            self.apply_in_place(vectors);
+          },
+          R"pbdoc(
+          Apply the operator to each column, in place
+
+          Parameters
+          ----------
+          vectors: np.ndarray[np.float64[dim, n_vectors]]
+              Vectors to symmetrize or project, one per column. Must be a
+              writable, Fortran-contiguous (column-major) array, which is
+              not converted or copied.
           )pbdoc",
-          py::arg("calc_wedges") = false, py::arg("glossary") = std::nullopt);
+          py::arg("vectors").noconvert());
+
+  m.def("make_group_average_symmetrizer",
+        &irreps::make_group_average_symmetrizer, R"pbdoc(
+      Make the group average of a matrix representation
+
+      The operator, ``R = (1/|G|) * sum_g matrix_rep[g]``, projects vectors
+      onto the subspace invariant to the group. Applying it to a vector gives
+      the average of its symmetrically equivalent images.
+
+      Parameters
+      ----------
+      matrix_rep: list[np.ndarray[np.float64[dim, dim]]]
+          Full space matrix representation
+      head_group: set[int]
+          Indices of the elements of `matrix_rep` to average.
+
+      Returns
+      -------
+      symmetrizer: VectorSymmetrizer
+          The group average symmetrizer.
+      )pbdoc",
+        py::arg("matrix_rep"), py::arg("head_group"));
+
+  m.def("make_irrep_projector", &irreps::make_irrep_projector, R"pbdoc(
+      Make the projector onto the span of one or more irreducible subspaces
+
+      Parameters
+      ----------
+      irreps: list[IrrepInfo]
+          The irreducible subspaces, from :class:`IrrepDecomposition` or
+          :class:`VectorSpaceSymReport`. Complex irreps are not supported;
+          use ``allow_complex=False`` to combine them into real
+          pseudo-irreps.
+      abs_tol: float = :data:`~libcasm.casmglobal.TOL`
+          The tolerance used to check that the projector is real.
+
+      Returns
+      -------
+      projector: VectorSymmetrizer
+          The orthogonal projector onto the span of `irreps`.
+      )pbdoc",
+        py::arg("irreps"), py::arg("abs_tol") = CASM::TOL);
 
 #ifdef VERSION_INFO
   m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
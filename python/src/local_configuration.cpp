@@ -13,6 +13,8 @@
 #include "casm/casm_io/json/InputParser_impl.hh"
 #include "casm/casm_io/json/jsonParser.hh"
 #include "casm/configuration/Configuration.hh"
+#include "casm/configuration/LocalConfigurationList.hh"
+#include "casm/configuration/SupercellSet.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/clusterography/IntegralCluster.hh"
 // #include "casm/configuration/clusterography/orbits.hh"
@@ -22,6 +24,7 @@
 // #include "casm/configuration/enumeration/OccEventInfo.hh"
 #include "casm/configuration/enumeration/background_configuration.hh"
 // #include "casm/configuration/enumeration/perturbations.hh"
+#include "casm/configuration/io/binary/LocalConfigurationList_binary_io.hh"
 #include "casm/configuration/occ_events/OccEvent.hh"
 // #include "casm/configuration/occ_events/OccSystem.hh"
 // #include "casm/configuration/occ_events/orbits.hh"
@@ -104,6 +107,170 @@ PYBIND11_MODULE(_local_configuration, m) {
       )pbdoc",
       py::arg("configuration"), py::arg("event"), py::arg("event_group"));
 
+  m.def(
+      "_make_canonical_local_configurations_about_events",
+      [](std::vector<config::Configuration> const &configurations,
+         std::vector<Index> const &event_index,
+         std::vector<occ_events::OccEvent> const &events,
+         std::vector<std::vector<config::SupercellSymOp>> const &event_groups,
+         bool apply_event_occupation, Index n_threads) {
+        if (events.size() != event_groups.size()) {
+          throw std::runtime_error(
+              "Error in _make_canonical_local_configurations_about_events: "
+              "events.size() != event_groups.size()");
+        }
+        std::vector<std::vector<Index>> event_sites(events.size());
+        std::vector<std::vector<int>> occ_init(events.size());
+        std::vector<std::vector<int>> occ_final(events.size());
+        for (Index e = 0; e < events.size(); ++e) {
+          if (!apply_event_occupation || event_groups[e].empty()) {
+            continue;
+          }
+          auto supercell = event_groups[e][0].supercell();
+          auto cluster_occupation =
+              occ_events::make_cluster_occupation(events[e]);
+          event_sites[e] =
+              to_index_vector(cluster_occupation.first,
+                              supercell->unitcellcoord_index_converter);
+          occ_init[e] = cluster_occupation.second[0];
+          occ_final[e] = cluster_occupation.second[1];
+        }
+        py::gil_scoped_release release;
+        return make_canonical_forms(configurations, event_index, event_sites,
+                                    occ_init, occ_final, event_groups,
+                                    n_threads);
+      },
+      R"pbdoc(
+      Return the canonical forms of many configurations, each in the context
+      of one of a set of OccEvent, in parallel
+
+      Parameters
+      ----------
+      configurations : list[libcasm.configuration.Configuration]
+          The configurations.
+      event_index : list[int]
+          For each configuration, the index into `events` and `event_group`
+          of the event in the context of which it is made canonical.
+      events : list[libcasm.occ_events.OccEvent]
+          The events.
+      event_groups : list[list[libcasm.configuration.SupercellSymOp]]
+          For each event, the subset of the supercell symmetry group that
+          leaves the event invariant. Must be for the same supercell as the
+          configurations in the context of the event.
+      apply_event_occupation : bool = True
+          If True, the result is the same as
+          `_make_canonical_local_configuration_about_event`. If False, the
+          configuration occupation is kept and configurations are made
+          canonical with respect to the event group only.
+      n_threads : int = 1
+          Number of threads to use. If `n_threads <= 0`, use the number of
+          hardware threads. The result does not depend on `n_threads`.
+
+      Returns
+      -------
+      canonical_configurations : list[libcasm.configuration.Configuration]
+          The canonical configurations, in the order of `configurations`.
+      )pbdoc",
+      py::arg("configurations"), py::arg("event_index"), py::arg("events"),
+      py::arg("event_groups"), py::arg("apply_event_occupation") = true,
+      py::arg("n_threads") = 1);
+
+  m.def(
+      "_local_configuration_hash",
+      [](config::Configuration const &configuration,
+         std::pair<Index, Index> const &pos) {
+        return config::LocalConfigurationHash()(
+            config::LocalConfiguration(configuration, pos));
+      },
+      R"pbdoc(
+      Return a hash of a configuration and event position that is consistent
+      with LocalConfiguration equality
+
+      Parameters
+      ----------
+      configuration : libcasm.configuration.Configuration
+          The configuration.
+      pos : tuple[int, int]
+          The event position, as `(unitcell_index, equivalent_index)`.
+
+      Returns
+      -------
+      hash : int
+          The hash value. Equal local configurations have equal hash values.
+      )pbdoc",
+      py::arg("configuration"), py::arg("pos"));
+
+  m.def(
+      "_local_configurations_to_bytes",
+      [](std::vector<config::Configuration> const &configurations,
+         std::vector<std::pair<Index, Index>> const &pos) {
+        if (configurations.size() != pos.size()) {
+          throw std::runtime_error(
+              "Error in _local_configurations_to_bytes: "
+              "configurations.size() != pos.size()");
+        }
+        config::LocalConfigurationList local_configurations;
+        local_configurations.reserve(configurations.size());
+        for (Index i = 0; i < configurations.size(); ++i) {
+          local_configurations.push_back(
+              config::LocalConfiguration(configurations[i], pos[i]));
+        }
+        return py::bytes(config::to_bytes(local_configurations));
+      },
+      R"pbdoc(
+      Write configurations and event positions in the binary local
+      configuration list format
+
+      Parameters
+      ----------
+      configurations : list[libcasm.configuration.Configuration]
+          The configurations.
+      pos : list[tuple[int, int]]
+          The event positions, as `(unitcell_index, equivalent_index)`.
+
+      Returns
+      -------
+      data : bytes
+          The binary data.
+      )pbdoc",
+      py::arg("configurations"), py::arg("pos"));
+
+  m.def(
+      "_local_configurations_from_bytes",
+      [](py::bytes const &data,
+         std::shared_ptr<config::SupercellSet> supercells) {
+        config::LocalConfigurationList local_configurations =
+            config::local_configuration_list_from_bytes(std::string{data},
+                                                        *supercells);
+        std::vector<config::Configuration> configurations;
+        std::vector<std::pair<Index, Index>> pos;
+        for (auto const &value : local_configurations) {
+          configurations.push_back(value.configuration);
+          pos.push_back(value.pos);
+        }
+        return std::make_pair(configurations, pos);
+      },
+      R"pbdoc(
+      Read configurations and event positions from the binary local
+      configuration list format
+
+      Parameters
+      ----------
+      data : bytes
+          The binary data, as from `_local_configurations_to_bytes`.
+      supercells : libcasm.configuration.SupercellSet
+          A :class:`~libcasm.configuration.SupercellSet`, which holds shared
+          supercells in order to avoid duplicates.
+
+      Returns
+      -------
+      configurations : list[libcasm.configuration.Configuration]
+          The configurations.
+      pos : list[tuple[int, int]]
+          The event positions, as `(unitcell_index, equivalent_index)`.
+      )pbdoc",
+      py::arg("data"), py::arg("supercells"));
+
 #ifdef VERSION_INFO
   m.attr("__version__") = MACRO_STRINGIFY(VERSION_INFO);
 #else
@@ -21,6 +21,8 @@
 #include "casm/configuration/occ_events/OccEventCounter.hh"
 #include "casm/configuration/occ_events/OccEventRep.hh"
 #include "casm/configuration/occ_events/OccSystem.hh"
+#include "casm/configuration/occ_events/OccSystemCache.hh"
+#include "casm/configuration/occ_events/io/binary/OccEvent_binary_io.hh"
 #include "casm/configuration/occ_events/io/json/OccEventCounter_json_io.hh"
 #include "casm/configuration/occ_events/io/json/OccEvent_json_io.hh"
 #include "casm/configuration/occ_events/io/json/OccSystem_json_io.hh"
@@ -46,11 +48,6 @@ std::shared_ptr<occ_events::OccSystem> make_system(
     std::shared_ptr<xtal::BasicStructure const> const &prim,
     std::optional<std::vector<std::string>> chemical_name_list = std::nullopt,
     std::optional<std::vector<std::string>> vacancy_name_list = std::nullopt) {
-  if (!chemical_name_list.has_value()) {
-    chemical_name_list =
-        occ_events::make_chemical_name_list(*prim, make_factor_group(*prim));
-  }
-
   std::set<std::string> vacancy_name_set = {"Va", "VA", "va"};
   if (vacancy_name_list.has_value()) {
     vacancy_name_set.clear();
@@ -59,8 +56,11 @@ std::shared_ptr<occ_events::OccSystem> make_system(
     }
   }
 
-  return std::make_shared<occ_events::OccSystem>(prim, *chemical_name_list,
-                                                 vacancy_name_set);
+  // OccSystem are shared by all equivalent prims; the bindings do not
+  // modify OccSystem, so the const qualifier is only removed for the holder
+  return std::const_pointer_cast<occ_events::OccSystem>(
+      occ_events::occ_system_cache().make(prim, chemical_name_list,
+                                          vacancy_name_set));
 }
 
 occ_events::OccEventRep make_occ_event_rep(
@@ -118,6 +118,66 @@ std::tuple<Index, Index> get_occevent_coordinate(
       "could be found");
 }
 
+/// \brief Pickled OccEvent: a flat list of integers, with the number of
+///     trajectories, then for each trajectory the number of positions
+///     followed by (is_in_reservoir, is_atom, b, i, j, k, occupant_index,
+///     atom_position_index) for each position
+std::vector<Index> occ_event_getstate(occ_events::OccEvent const &event) {
+  std::vector<Index> state;
+  state.push_back(event.elements().size());
+  for (auto const &traj : event.elements()) {
+    state.push_back(traj.position.size());
+    for (auto const &pos : traj.position) {
+      state.push_back(pos.is_in_reservoir);
+      state.push_back(pos.is_atom);
+      for (Index i = 0; i < 4; ++i) {
+        state.push_back(pos.integral_site_coordinate[i]);
+      }
+      state.push_back(pos.occupant_index);
+      state.push_back(pos.atom_position_index);
+    }
+  }
+  return state;
+}
+
+/// \brief Unpickle an OccEvent
+occ_events::OccEvent occ_event_setstate(std::vector<Index> const &state) {
+  auto invalid = []() {
+    return std::runtime_error("Error unpickling OccEvent: invalid state");
+  };
+  Index n = 0;
+  auto next = [&]() {
+    if (n >= Index(state.size())) {
+      throw invalid();
+    }
+    return state[n++];
+  };
+  std::vector<occ_events::OccTrajectory> trajectories;
+  Index n_traj = next();
+  for (Index t = 0; t < n_traj; ++t) {
+    std::vector<occ_events::OccPosition> positions;
+    Index n_pos = next();
+    for (Index p = 0; p < n_pos; ++p) {
+      bool is_in_reservoir = next();
+      bool is_atom = next();
+      Index b = next();
+      Index i = next();
+      Index j = next();
+      Index k = next();
+      Index occupant_index = next();
+      Index atom_position_index = next();
+      positions.emplace_back(is_in_reservoir, is_atom,
+                             xtal::UnitCellCoord(b, i, j, k), occupant_index,
+                             atom_position_index);
+    }
+    trajectories.emplace_back(std::move(positions));
+  }
+  if (n != Index(state.size())) {
+    throw invalid();
+  }
+  return occ_events::OccEvent(std::move(trajectories));
+}
+
 }  // namespace CASMpy
 
 PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>);
@@ -160,6 +220,10 @@ PYBIND11_MODULE(_occ_events, m) {
       vacancy_name_list: Optional[List[str]]=None
           Chemical names that should be recognized as vacancies.
 
+      OccSystem are shared: constructing an OccSystem with an equivalent
+      prim and the same names returns the OccSystem constructed first,
+      whose :func:`xtal_prim` is the prim it was constructed with.
+
       )pbdoc")
       .def(
           "xtal_prim", [](occ_events::OccSystem const &m) { return m.prim; },
@@ -788,6 +852,13 @@ PYBIND11_MODULE(_occ_events, m) {
            })
       .def("__deepcopy__", [](occ_events::OccEvent const &self,
                               py::dict) { return occ_events::OccEvent(self); })
+      .def(py::pickle(
+          [](occ_events::OccEvent const &self) {
+            return occ_event_getstate(self);
+          },
+          [](std::vector<Index> const &state) {
+            return occ_event_setstate(state);
+          }))
       .def_static(
           "from_dict",
           [](const nlohmann::json &data,
@@ -937,8 +1008,8 @@ PYBIND11_MODULE(_occ_events, m) {
       [](std::shared_ptr<occ_events::OccSystem const> const &system,
          clust::ClusterSpecs const &cluster_specs,
          const nlohmann::json &occevent_counter_params,
-         std::vector<occ_events::OccEvent> const &custom_occevents)
-          -> std::vector<occ_events::OccEvent> {
+         std::vector<occ_events::OccEvent> const &custom_occevents,
+         Index n_threads) -> std::vector<occ_events::OccEvent> {
         // print errors and warnings to sys.stdout
         py::scoped_ostream_redirect redirect;
         // get canonical clusters
@@ -975,11 +1046,127 @@ PYBIND11_MODULE(_occ_events, m) {
         }
 
         return make_prim_periodic_occevent_prototypes(
-            system, clusters, occevent_symgroup_rep, params, custom_occevents);
+            system, clusters, occevent_symgroup_rep, params, custom_occevents,
+            n_threads);
       },
       "Documented in libcasm.occ_events._methods.py", py::arg("system"),
       py::arg("cluster_specs"), py::arg("occevent_counter_params"),
-      py::arg("custom_occevents"));
+      py::arg("custom_occevents"), py::arg("n_threads") = 1);
+
+  m.def(
+      "occevents_to_bytes",
+      [](std::vector<occ_events::OccEvent> const &occevents,
+         occ_events::OccSystem const &system) {
+        return py::bytes(occ_events::to_bytes(occevents, system));
+      },
+      R"pbdoc(
+      Write a list of OccEvent in a compact binary format
+
+      Positions are written as packed 64-bit integers where possible,
+      following a digest of `system`, so that
+      :func:`~libcasm.occ_events.occevents_from_bytes` can reload events
+      without chemical or atom name lookups.
+
+      Parameters
+      ----------
+      occevents: list[OccEvent]
+          The events to write.
+
+      system: OccSystem
+          The OccSystem the events index into.
+
+      Returns
+      -------
+      data: bytes
+          The events, in binary format.
+      )pbdoc",
+      py::arg("occevents"), py::arg("system"));
+
+  m.def(
+      "occevents_from_bytes",
+      [](py::bytes const &data, occ_events::OccSystem const &system) {
+        return occ_events::occevents_from_bytes(std::string{data}, system);
+      },
+      R"pbdoc(
+      Read a list of OccEvent from binary format
+
+      Parameters
+      ----------
+      data: bytes
+          Data written by :func:`~libcasm.occ_events.occevents_to_bytes` or
+          :func:`~libcasm.occ_events.occevent_orbits_to_bytes`. Reading
+          orbits returns the events of all orbits, in order.
+
+      system: OccSystem
+          The OccSystem. Raises if it is not equivalent to the OccSystem
+          the data was written with.
+
+      Returns
+      -------
+      occevents: list[OccEvent]
+          The events.
+      )pbdoc",
+      py::arg("data"), py::arg("system"));
+
+  m.def(
+      "occevent_orbits_to_bytes",
+      [](std::vector<std::vector<occ_events::OccEvent>> const &orbits,
+         occ_events::OccSystem const &system) {
+        std::vector<std::set<occ_events::OccEvent>> _orbits;
+        for (auto const &orbit : orbits) {
+          _orbits.emplace_back(orbit.begin(), orbit.end());
+        }
+        return py::bytes(occ_events::to_bytes(_orbits, system));
+      },
+      R"pbdoc(
+      Write orbits of OccEvent in a compact binary format
+
+      Parameters
+      ----------
+      orbits: list[list[OccEvent]]
+          The orbits to write. Events in each orbit are written in sorted
+          order, as by :func:`~libcasm.occ_events.make_prim_periodic_orbit`.
+
+      system: OccSystem
+          The OccSystem the events index into.
+
+      Returns
+      -------
+      data: bytes
+          The orbits, in binary format.
+      )pbdoc",
+      py::arg("orbits"), py::arg("system"));
+
+  m.def(
+      "occevent_orbits_from_bytes",
+      [](py::bytes const &data, occ_events::OccSystem const &system) {
+        std::vector<std::vector<occ_events::OccEvent>> orbits;
+        for (auto const &orbit :
+             occ_events::occevent_orbits_from_bytes(std::string{data},
+                                                    system)) {
+          orbits.emplace_back(orbit.begin(), orbit.end());
+        }
+        return orbits;
+      },
+      R"pbdoc(
+      Read orbits of OccEvent from binary format
+
+      Parameters
+      ----------
+      data: bytes
+          Data written by
+          :func:`~libcasm.occ_events.occevent_orbits_to_bytes`.
+
+      system: OccSystem
+          The OccSystem. Raises if it is not equivalent to the OccSystem
+          the data was written with.
+
+      Returns
+      -------
+      orbits: list[list[OccEvent]]
+          The orbits.
+      )pbdoc",
+      py::arg("data"), py::arg("system"));
 
   m.def("get_occevent_coordinate", &get_occevent_coordinate,
         R"pbdoc(
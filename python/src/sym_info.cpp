@@ -119,14 +119,17 @@ PYBIND11_MODULE(_sym_info, m) {
       .def_static(
           "from_elements",
           [](std::vector<xtal::SymOp> elements, xtal::Lattice const &lattice,
-             bool sort) -> std::shared_ptr<sym_info::SymGroup const> {
+             bool sort,
+             Index n_threads) -> std::shared_ptr<sym_info::SymGroup const> {
             if (sort) {
-              return sym_info::make_symgroup(elements, lattice);
+              return sym_info::make_symgroup(elements, lattice, n_threads);
             } else {
-              return sym_info::make_symgroup_without_sorting(elements, lattice);
+              return sym_info::make_symgroup_without_sorting(elements, lattice,
+                                                             n_threads);
             }
           },
-          py::arg("elements"), py::arg("lattice"), py::arg("sort") = true)
+          py::arg("elements"), py::arg("lattice"), py::arg("sort") = true,
+          py::arg("n_threads") = 1, py::call_guard<py::gil_scoped_release>())
       .def("make_subgroup", &make_symgroup_subgroup, R"pbdoc(
           Make a subgroup
 
@@ -411,13 +414,17 @@ PYBIND11_MODULE(_sym_info, m) {
         ----------
         xtal_prim: libcasm.xtal.Prim
             The :class:`libcasm.xtal.Prim`.
+        n_threads: int = 1
+            The number of threads used to find the multiplication table. If
+            `n_threads` <= 0, the number of hardware threads is used.
 
         Returns
         -------
         factor_group : SymGroup
             The group which leaves `xtal_prim` invariant
         )pbdoc",
-        py::arg("xtal_prim"));
+        py::arg("xtal_prim"), py::arg("n_threads") = 1,
+        py::call_guard<py::gil_scoped_release>());
 
   m.def("make_point_group", &sym_info::make_point_group, R"pbdoc(
         Construct the prim point group as a SymGroup
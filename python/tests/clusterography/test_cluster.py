@@ -218,3 +218,17 @@ def test_IntegralClusterOrbitGenerator():
         print(orbit_gen)
     out = f.getvalue()
     assert "sites" in out
+
+
+def test_cluster_pickle():
+    import pickle
+
+    cluster = clust.Cluster.from_list(
+        [
+            [0, 0, 0, 0],
+            [1, 1, 2, 3],
+        ]
+    )
+    unpickled = pickle.loads(pickle.dumps(cluster))
+    assert unpickled == cluster
+    assert unpickled.to_list() == [[0, 0, 0, 0], [1, 1, 2, 3]]
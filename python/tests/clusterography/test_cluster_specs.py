@@ -424,3 +424,34 @@ def test_make_custom_cluster_specs(FCC_with_interstitials_prim):
     orbits = cluster_specs.make_orbits()
     # print([orbit[0] for orbit in orbits])
     assert len(orbits) == 126
+
+
+def test_PrimPeriodicOrbitGenerator():
+    xtal_prim = xtal_prims.FCC(r=1.0, occ_dof=["A", "B"])
+    prim_factor_group = sym_info.make_factor_group(xtal_prim)
+
+    def expected(max_length):
+        return clust.ClusterSpecs(
+            xtal_prim=xtal_prim,
+            generating_group=prim_factor_group,
+            max_length=max_length,
+        ).make_orbits()
+
+    generator = clust.PrimPeriodicOrbitGenerator(
+        clust.ClusterSpecs(
+            xtal_prim=xtal_prim,
+            generating_group=prim_factor_group,
+            max_length=[0.0, 0.0, 2.01],
+        )
+    )
+    assert generator.n_branches() == 3
+    assert generator.orbits() == expected([0.0, 0.0, 2.01])
+    assert len(generator.branch_orbits(2)) == 1
+
+    # extend the pair cutoff to include 2NN pairs, then add 1NN triplets
+    pairs = generator.extend_cutoff(2.9)
+    assert len(pairs) == 2
+    triplets = generator.add_branch(2.01)
+    assert len(triplets) == 1
+    assert generator.max_length() == [0.0, 0.0, 2.9, 2.01]
+    assert generator.orbits() == expected([0.0, 0.0, 2.9, 2.01])
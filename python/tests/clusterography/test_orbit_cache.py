@@ -0,0 +1,55 @@
+import libcasm.clusterography as clust
+import libcasm.xtal as xtal
+import libcasm.xtal.prims as xtal_prims
+
+
+def test_make_orbits_with_cache(tmp_path):
+    xtal_prim = xtal_prims.FCC(r=1.0, occ_dof=["A", "B", "Va"])
+    cluster_specs = clust.make_periodic_cluster_specs(
+        xtal_prim=xtal_prim,
+        max_length=[0.0, 0.0, 2.01, 2.01],
+    )
+    expected = cluster_specs.make_orbits()
+
+    key = clust.make_cluster_specs_hash(cluster_specs)
+    assert isinstance(key, str)
+    assert clust.make_cluster_specs_hash(cluster_specs) == key
+    path = tmp_path / (key + ".json")
+
+    # miss: orbits are generated and saved
+    orbits = clust.make_orbits_with_cache(cluster_specs, tmp_path)
+    assert path.exists()
+    assert orbits == expected
+
+    # hit: orbits are regenerated from the saved prototypes
+    orbits = clust.make_orbits_with_cache(cluster_specs, tmp_path)
+    assert orbits == expected
+
+    # different ClusterSpecs, different hash
+    other_cluster_specs = clust.make_periodic_cluster_specs(
+        xtal_prim=xtal_prim,
+        max_length=[0.0, 0.0, 2.01],
+    )
+    assert clust.make_cluster_specs_hash(other_cluster_specs) != key
+    other_orbits = clust.make_orbits_with_cache(other_cluster_specs, tmp_path)
+    assert other_orbits == other_cluster_specs.make_orbits()
+    assert len(list(tmp_path.glob("*.json"))) == 2
+
+
+def test_make_local_orbits_with_cache(tmp_path):
+    xtal_prim = xtal_prims.FCC(r=1.0, occ_dof=["A", "B", "Va"])
+    phenomenal_cluster = clust.Cluster(
+        [
+            xtal.IntegralSiteCoordinate.from_list([0, 0, 0, 0]),
+            xtal.IntegralSiteCoordinate.from_list([0, 1, 0, 0]),
+        ]
+    )
+    cluster_specs = clust.make_local_cluster_specs(
+        xtal_prim=xtal_prim,
+        phenomenal_cluster=phenomenal_cluster,
+        max_length=[0.0, 0.0, 2.01],
+        cutoff_radius=[0.0, 2.01, 2.01],
+    )
+    expected = cluster_specs.make_orbits()
+    assert clust.make_orbits_with_cache(cluster_specs, tmp_path) == expected
+    assert clust.make_orbits_with_cache(cluster_specs, tmp_path) == expected
@@ -83,3 +83,235 @@ def test_configuration_list_io(simple_cubic_binary_prim):
     assert isinstance(configuration_list_3, list)
     assert len(configuration_list_3) == 2
     assert len(supercellset) == 2
+
+
+def test_configuration_jsonl_io(simple_cubic_binary_prim, tmp_path):
+    prim = config.Prim(simple_cubic_binary_prim)
+
+    T = np.array(
+        [
+            [2, 0, 0],
+            [0, 1, 0],
+            [0, 0, 1],
+        ]
+    )
+    supercell = config.Supercell(prim, T)
+    configuration_list = []
+    for i in range(4):
+        configuration = config.Configuration(supercell)
+        configuration.set_occ(0, i % 2)
+        configuration.set_occ(1, i // 2)
+        configuration_list.append(configuration)
+
+    path = tmp_path / "configurations.jsonl"
+    n_records = config_io.write_configuration_jsonl(
+        (x for x in configuration_list), path
+    )
+    assert n_records == 4
+    with open(path, "r") as f:
+        assert len(f.readlines()) == 4
+
+    supercellset = config.SupercellSet(prim)
+    n = 0
+    for i, configuration in enumerate(
+        config_io.read_configuration_jsonl(path, supercells=supercellset)
+    ):
+        assert isinstance(configuration, config.Configuration)
+        assert configuration == configuration_list[i]
+        n += 1
+    assert n == 4
+    assert len(supercellset) == 1
+
+
+def test_compressed_configuration_jsonl_io(simple_cubic_binary_prim, tmp_path):
+    prim = config.Prim(simple_cubic_binary_prim)
+    supercell = config.Supercell(prim, np.eye(3, dtype=int) * 2)
+    configuration_list = []
+    for i in range(8):
+        configuration = config.Configuration(supercell)
+        configuration.set_occ(i, 1)
+        configuration_list.append(configuration)
+
+    # compression is chosen by extension when writing
+    path = tmp_path / "configurations.jsonl.gz"
+    config_io.write_configuration_jsonl(configuration_list, path)
+    assert config_io.detect_compression(path) == "gzip"
+    with open(path, "rb") as f:
+        assert f.read(2) == b"\x1f\x8b"
+
+    # ... and by magic bytes when reading, regardless of the file name
+    renamed = path.rename(tmp_path / "configurations.jsonl")
+    result = list(config_io.read_configuration_jsonl(renamed, prim=prim))
+    assert result == configuration_list
+
+
+def test_compressed_json_io(tmp_path):
+    data = {"values": list(range(1000))}
+    config_io.write_json(data, tmp_path / "data.json.gz")
+    config_io.write_json(data, tmp_path / "data.json")
+    assert config_io.read_json(tmp_path / "data.json.gz") == data
+    assert config_io.read_json(tmp_path / "data.json") == data
+    assert (tmp_path / "data.json.gz").stat().st_size < (
+        tmp_path / "data.json"
+    ).stat().st_size
+
+    # appending adds a gzip member, which is read as a continuation
+    with config_io.open_file(tmp_path / "lines.txt.gz", "w") as f:
+        f.write("a\n")
+    with config_io.open_file(tmp_path / "lines.txt.gz", "a") as f:
+        f.write("b\n")
+    with config_io.open_file(tmp_path / "lines.txt.gz") as f:
+        assert f.read() == "a\nb\n"
+
+
+def test_configuration_binary_io(simple_cubic_binary_prim, tmp_path):
+    prim = config.Prim(simple_cubic_binary_prim)
+
+    T = np.array(
+        [
+            [2, 0, 0],
+            [0, 1, 0],
+            [0, 0, 1],
+        ]
+    )
+    supercell = config.Supercell(prim, T)
+    configuration_list = []
+    for i in range(4):
+        configuration = config.Configuration(supercell)
+        configuration.set_occ(0, i % 2)
+        configuration.set_occ(1, i // 2)
+        configuration_list.append(configuration)
+
+    supercellset = config.SupercellSet(prim)
+    data = configuration_list[1].to_bytes()
+    assert isinstance(data, bytes)
+    assert (
+        config.Configuration.from_bytes(data, supercellset) == configuration_list[1]
+    )
+
+    path = tmp_path / "configurations.bin"
+    n_records = config_io.write_configuration_binary(
+        (x for x in configuration_list), path
+    )
+    assert n_records == 4
+
+    n = 0
+    for i, configuration in enumerate(
+        config_io.read_configuration_binary(path, supercells=supercellset)
+    ):
+        assert isinstance(configuration, config.Configuration)
+        assert configuration == configuration_list[i]
+        n += 1
+    assert n == 4
+    assert len(supercellset) == 1
+
+    configuration_set = config.ConfigurationSet()
+    for configuration in configuration_list:
+        configuration_set.add(configuration)
+    configuration_set_2 = config.ConfigurationSet.from_bytes(
+        configuration_set.to_bytes(), supercellset
+    )
+    assert len(configuration_set_2) == len(configuration_set)
+    for record in configuration_set:
+        assert record.configuration_name in configuration_set_2
+
+
+def test_configuration_columnar_io(simple_cubic_binary_prim, tmp_path):
+    prim = config.Prim(simple_cubic_binary_prim)
+
+    T1 = np.array(
+        [
+            [2, 0, 0],
+            [0, 1, 0],
+            [0, 0, 1],
+        ]
+    )
+    T2 = np.array(
+        [
+            [3, 0, 0],
+            [0, 1, 0],
+            [0, 0, 1],
+        ]
+    )
+    supercell_list = [config.Supercell(prim, T1), config.Supercell(prim, T2)]
+    records = []
+    for i in range(7):
+        configuration = config.Configuration(supercell_list[i % 2])
+        configuration.set_occ(0, i % 2)
+        configuration.set_occ(1, (i // 2) % 2)
+        global_properties = {}
+        if i % 3:
+            global_properties["energy"] = np.array([-1.0 * i])
+        records.append(
+            config.ConfigurationWithProperties(
+                configuration=configuration,
+                global_properties=global_properties,
+            )
+        )
+
+    path = tmp_path / "configurations.colb"
+    n_records = config_io.write_configuration_columnar(
+        (x for x in records), path, batch_size=2
+    )
+    assert n_records == 7
+
+    supercellset = config.SupercellSet(prim)
+    found = []
+    for batch in config_io.read_columnar_batches(path, supercells=supercellset):
+        n = len(batch["record_index"])
+        assert n <= 2
+        assert batch["occupation"].shape == (n, batch["n_sites"])
+        energy = batch["global_properties"].get("energy")
+        for j, i in enumerate(batch["record_index"]):
+            found.append(i)
+            expected = records[i]
+            assert (
+                batch["supercell_list"][batch["supercell_index"][j]]
+                == expected.configuration.supercell
+            )
+            assert (batch["occupation"][j] == expected.configuration.occupation).all()
+            if energy is not None and energy["present"][j]:
+                begin, end = energy["offsets"][j], energy["offsets"][j + 1]
+                assert (
+                    energy["values"][begin:end]
+                    == expected.global_properties["energy"]
+                ).all()
+            else:
+                assert "energy" not in expected.global_properties
+    assert sorted(found) == list(range(7))
+    assert len(supercellset) == 2
+
+    read_records = list(
+        config_io.read_configuration_columnar(
+            path, supercells=supercellset, with_properties=True
+        )
+    )
+    assert len(read_records) == 7
+    for batch_value, i in zip(read_records, found):
+        assert batch_value.configuration == records[i].configuration
+
+
+def test_configuration_from_json_str(simple_cubic_binary_prim, tmp_path):
+    import json
+
+    prim = config.Prim(simple_cubic_binary_prim)
+    supercells = config.SupercellSet(prim)
+    configurations = config.ConfigurationSet()
+    for n in range(1, 4):
+        supercell = config.make_canonical_supercell(
+            config.Supercell(prim, np.diag([n, 1, 1]))
+        )
+        configuration = config.Configuration(supercell)
+        configuration.set_occ(0, 1)
+        configurations.add(configuration)
+        json_str = json.dumps(configuration.to_dict())
+        assert (
+            config.Configuration.from_json_str(json_str, supercells) == configuration
+        )
+
+    data = configurations.to_dict()
+    path = tmp_path / "config_list.json"
+    config_io.write_json(data, path)
+    configurations_in = config_io.read_configuration_set(path, prim=prim)
+    assert len(configurations_in) == len(configurations)
+    assert configurations_in.to_dict() == data
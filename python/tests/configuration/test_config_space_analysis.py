@@ -1,6 +1,8 @@
+from concurrent.futures import ThreadPoolExecutor
 from math import sqrt
 
 import numpy as np
+import pytest
 
 import libcasm.configuration as casmconfig
 
@@ -372,3 +374,146 @@ def test_config_space_analysis_1_to_dict(FCC_binary_prim):
     assert "projector" in data["occ"]
     assert "standard_dof_space" in data["occ"]
     assert "symmetry_adapted_dof_space" in data["occ"]
+
+
+def test_config_space_analysis_streaming(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    configurations = build_configurations_1(prim)
+
+    expected = casmconfig.config_space_analysis(configurations=configurations)
+
+    for n_threads in [1, 2, 4]:
+        results = casmconfig.config_space_analysis(
+            configurations=configurations,
+            store_equivalents=False,
+            n_threads=n_threads,
+        )
+        assert len(results["occ"].equivalent_configurations) == 0
+        assert len(results["occ"].equivalent_dof_values) == 0
+        assert np.allclose(results["occ"].projector, expected["occ"].projector)
+        assert np.allclose(results["occ"].eigenvalues, expected["occ"].eigenvalues)
+        assert is_same_space(
+            results["occ"].symmetry_adapted_dof_space.basis,
+            expected["occ"].symmetry_adapted_dof_space.basis,
+        )
+
+        # storing equivalents, the results do not depend on n_threads
+        results = casmconfig.config_space_analysis(
+            configurations=configurations,
+            n_threads=n_threads,
+        )
+        assert np.array_equal(results["occ"].projector, expected["occ"].projector)
+
+
+def test_config_space_analysis_prototype_supercells(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    configurations = build_configurations_1(prim)
+
+    expected = casmconfig.config_space_analysis(
+        configurations=configurations,
+        store_equivalents=False,
+    )
+    results = casmconfig.config_space_analysis(
+        configurations=configurations,
+        store_equivalents=False,
+        use_prototype_supercells=True,
+    )
+    assert np.allclose(results["occ"].projector, expected["occ"].projector)
+    assert np.allclose(results["occ"].eigenvalues, expected["occ"].eigenvalues)
+    assert is_same_space(
+        results["occ"].symmetry_adapted_dof_space.basis,
+        expected["occ"].symmetry_adapted_dof_space.basis,
+    )
+
+    with pytest.raises(Exception):
+        casmconfig.config_space_analysis(
+            configurations=configurations,
+            use_prototype_supercells=True,
+        )
+
+
+def test_config_space_analysis_max_supercell_volume(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    configurations = build_configurations_1(prim)
+
+    with pytest.raises(Exception):
+        casmconfig.config_space_analysis(
+            configurations=configurations,
+            max_supercell_volume=2,
+        )
+
+    results = casmconfig.config_space_analysis(
+        configurations=configurations,
+        max_supercell_volume=4,
+    )
+    assert len(results) == 1
+
+
+def test_config_space_analysis_python_threads(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    configurations = build_configurations_1(prim)
+
+    expected = casmconfig.config_space_analysis(configurations=configurations)
+
+    # the GIL is released during the analysis, so Python threads may overlap
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        futures = [
+            executor.submit(
+                casmconfig.config_space_analysis,
+                configurations=configurations,
+            )
+            for _ in range(4)
+        ]
+        all_results = [future.result() for future in futures]
+
+    for results in all_results:
+        assert np.array_equal(results["occ"].projector, expected["occ"].projector)
+
+
+def test_config_space_analysis_partial(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    configurations = build_configurations_1(prim)
+
+    expected = casmconfig.config_space_analysis(
+        configurations=configurations,
+        store_equivalents=False,
+    )
+
+    # partial results for disjoint subsets, as from separate processes
+    supercell = casmconfig.make_config_space_analysis_supercell(configurations)
+    keys = list(configurations.keys())
+    partials = [
+        casmconfig.config_space_analysis_partial(
+            supercell=supercell,
+            configurations={key: configurations[key] for key in subset},
+        )
+        for subset in [keys[:1], keys[1:]]
+    ]
+
+    # reduce, as plain arrays
+    total = casmconfig.config_space_analysis_partial(
+        supercell=supercell,
+        configurations={},
+    )
+    assert total.n_configurations == 0
+    assert np.allclose(total.projector["occ"], 0.0)
+    for partial in partials:
+        total.add_projector(partial.projector, partial.n_configurations)
+    assert total.n_configurations == sum(x.n_configurations for x in partials)
+
+    results = casmconfig.finish_config_space_analysis(total)
+    assert np.allclose(results["occ"].projector, expected["occ"].projector)
+    assert np.allclose(results["occ"].eigenvalues, expected["occ"].eigenvalues)
+    assert is_same_space(
+        results["occ"].symmetry_adapted_dof_space.basis,
+        expected["occ"].symmetry_adapted_dof_space.basis,
+    )
+
+    # or by merging partial results
+    merged = partials[0]
+    merged.merge(partials[1])
+    results = casmconfig.finish_config_space_analysis(merged)
+    assert np.allclose(results["occ"].projector, expected["occ"].projector)
+
+    with pytest.raises(Exception):
+        total.add_projector({"occ": np.zeros((1, 1))}, 1)
@@ -83,6 +83,56 @@ def test_configuration_occupation(simple_cubic_binary_prim):
     assert occupation_dof == ["B"] * 3 + ["A"] * 61
 
 
+def test_configuration_dof_values_views(FCC_binary_Hstrain_noshear_disp_nodz_prim):
+    prim = casmconfig.Prim(FCC_binary_Hstrain_noshear_disp_nodz_prim)
+    T = np.array(
+        [
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ],
+        dtype="int",
+    )
+    supercell = casmconfig.make_canonical_supercell(casmconfig.Supercell(prim, T))
+    configuration = casmconfig.Configuration(supercell)
+
+    # occupation
+    occupation = configuration.occupation_view()
+    assert occupation.flags.writeable
+    occupation[1] = 1
+    assert configuration.occ(1) == 1
+    configuration.set_occ(2, 1)
+    assert occupation.tolist() == [0, 1, 1, 0]
+
+    # local DoF
+    disp = configuration.local_dof_values_view("disp")
+    assert disp.shape == (2, 4)
+    disp[:, 3] = [0.01, 0.02]
+    assert np.allclose(configuration.local_dof_site_value("disp", 3), [0.01, 0.02])
+
+    # global DoF
+    Hstrain = configuration.global_dof_values_view("Hstrain")
+    Hstrain[0] = 0.1
+    assert np.allclose(configuration.global_dof_values("Hstrain"), [0.1, 0.0, 0.0])
+
+    # setting standard DoF values keeps views valid
+    standard_disp = np.zeros((3, 4))
+    standard_disp[0, :] = 0.03
+    configuration.set_local_standard_dof_values("disp", standard_disp)
+    assert np.allclose(disp, configuration.local_dof_values("disp"))
+    assert np.allclose(configuration.local_standard_dof_values("disp"), standard_disp)
+    standard_Hstrain = np.array([0.2, 0.0, 0.0, 0.0, 0.0, 0.0])
+    configuration.set_global_standard_dof_values("Hstrain", standard_Hstrain)
+    assert np.allclose(Hstrain, configuration.global_dof_values("Hstrain"))
+    disp[:, 3] = [0.01, 0.02]
+
+    # views keep the configuration alive
+    del configuration
+    occupation[0] = 1
+    assert occupation.tolist() == [1, 1, 1, 0]
+    assert np.allclose(disp[:, 3], [0.01, 0.02])
+
+
 def test_canonical_configuration_occupation(simple_cubic_binary_prim):
     prim = casmconfig.Prim(simple_cubic_binary_prim)
     T = np.array(
@@ -105,6 +155,94 @@ def test_canonical_configuration_occupation(simple_cubic_binary_prim):
     assert (canon_config.occupation == np.array([1] + [0] * 63)).all()
 
 
+def test_canonical_configurations_occupation(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    T = np.array(
+        [
+            [2, 0, 0],
+            [0, 2, 0],
+            [0, 0, 2],
+        ]
+    )
+    supercell = casmconfig.make_canonical_supercell(casmconfig.Supercell(prim, T))
+
+    configurations = []
+    for i in range(2**8):
+        configuration = casmconfig.Configuration(supercell)
+        configuration.set_occupation([(i >> l) & 1 for l in range(8)])
+        configurations.append(configuration)
+
+    expected = [casmconfig.make_canonical_configuration(x) for x in configurations]
+    for n_threads in [1, 4]:
+        canonical = casmconfig.make_canonical_configurations(
+            configurations, n_threads=n_threads
+        )
+        assert len(canonical) == len(configurations)
+        for a, b in zip(canonical, expected):
+            assert a == b
+            assert casmconfig.is_canonical_configuration(a) is True
+
+
+def test_make_canonical_configurations_mixed_supercells(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    configurations = []
+    for T in [
+        np.array([[2, 0, 0], [0, 1, 0], [0, 0, 1]]),
+        np.array([[1, 0, 0], [0, 3, 0], [0, 0, 1]]),
+        np.array([[2, 0, 0], [0, 2, 0], [0, 0, 1]]),
+    ]:
+        supercell = casmconfig.Supercell(prim, T)
+        n_sites = supercell.n_sites
+        for i in range(2**n_sites):
+            configuration = casmconfig.Configuration(supercell)
+            configuration.set_occupation([(i >> l) & 1 for l in range(n_sites)])
+            configurations.append(configuration)
+    configurations = configurations[::2] + configurations[1::2]
+
+    expected = [casmconfig.make_canonical_configuration(x) for x in configurations]
+    for n_threads in [1, 4]:
+        for max_table_bytes in [None, 0]:
+            canonical = casmconfig.make_canonical_configurations(
+                configurations, n_threads=n_threads, max_table_bytes=max_table_bytes
+            )
+            assert len(canonical) == len(configurations)
+            for a, b in zip(canonical, expected):
+                assert a == b
+
+
+def test_copy_apply_to_occupations(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    T = np.array(
+        [
+            [2, 0, 0],
+            [0, 2, 0],
+            [0, 0, 1],
+        ]
+    )
+    supercell = casmconfig.Supercell(prim, T)
+    rng = np.random.default_rng(0)
+    occupations = rng.integers(0, 2, size=(6, supercell.n_sites))
+    symgroup_rep = supercell.symgroup_rep()
+
+    for n_threads in [1, 4]:
+        transformed = casmconfig.copy_apply_to_occupations(
+            occupations, supercell, n_threads=n_threads
+        )
+        assert transformed.shape == (len(symgroup_rep), 6, supercell.n_sites)
+        for i, op in enumerate(symgroup_rep):
+            for j in range(occupations.shape[0]):
+                configuration = casmconfig.Configuration(supercell)
+                configuration.set_occupation(occupations[j, :])
+                expected = casmconfig.copy_apply(op, configuration)
+                assert (transformed[i, j, :] == expected.occupation).all()
+
+    subset = symgroup_rep[:3]
+    transformed = casmconfig.copy_apply_to_occupations(
+        occupations, supercell, supercell_symops=subset
+    )
+    assert transformed.shape == (3, 6, supercell.n_sites)
+
+
 def test_configuration_invariant_subgroup(simple_cubic_binary_prim):
     prim = casmconfig.Prim(simple_cubic_binary_prim)
     T = np.array(
@@ -311,6 +449,215 @@ def test_copy_configuration(simple_cubic_binary_prim):
     assert configuration3 is not configuration1
 
 
+def test_copy_configuration_with_cache(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    motif_supercell = casmconfig.Supercell(prim, np.eye(3, dtype="int") * 2)
+    supercell = casmconfig.Supercell(prim, np.array([[4, 0, 0], [0, 2, 0], [0, 0, 2]]))
+    cache = casmconfig.MotifTilingMapCache()
+    assert cache.size() == 0
+
+    for i in range(motif_supercell.n_sites):
+        motif = casmconfig.Configuration(motif_supercell)
+        motif.set_occ(i, 1)
+        expected = casmconfig.copy_configuration(motif, supercell)
+        super = casmconfig.copy_configuration(motif, supercell, cache=cache)
+        assert super == expected
+        assert cache.size() == 1
+
+    for fg_index in range(len(prim.factor_group.elements)):
+        expected = casmconfig.copy_transformed_configuration(
+            fg_index, [0, 0, 0], motif, supercell
+        )
+        super = casmconfig.copy_transformed_configuration(
+            fg_index, [0, 0, 0], motif, supercell, cache=cache
+        )
+        assert super == expected
+    assert cache.size() == 1 + len(prim.factor_group.elements)
+
+    cache.clear()
+    assert cache.size() == 0
+
+
+def test_find_mapping_operation(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    supercell = casmconfig.Supercell(prim, np.array([[3, 0, 0], [0, 1, 0], [0, 0, 1]]))
+    supercell_ref = casmconfig.Supercell(
+        prim, np.array([[1, 0, 0], [0, 3, 0], [0, 0, 1]])
+    )
+    configuration = casmconfig.Configuration(supercell)
+    configuration.set_occupation([0, 1, 1])
+    lattice = supercell.superlattice
+    lattice_ref = supercell_ref.superlattice
+
+    n_checked = 0
+    for i, op in enumerate(prim.factor_group.elements):
+        if not (op * lattice).is_equivalent_to(lattice_ref):
+            continue
+        configuration_ref = casmconfig.copy_transformed_configuration(
+            i, [1, 0, 0], configuration, supercell_ref
+        )
+        mapping_op = casmconfig.find_mapping_operation(
+            configuration, configuration_ref
+        )
+        assert mapping_op is not None
+        assert (mapping_op * lattice).is_equivalent_to(lattice_ref)
+        n_checked += 1
+    assert n_checked > 0
+
+    other = casmconfig.Configuration(supercell_ref)
+    other.set_occupation([0, 0, 1])
+    assert casmconfig.find_mapping_operation(configuration, other) is None
+
+
+def test_asymmetric_unit_indices(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    supercell = casmconfig.Supercell(prim, np.array([[4, 0, 0], [0, 1, 0], [0, 0, 1]]))
+    supercell_ref = casmconfig.Supercell(
+        prim, np.array([[1, 0, 0], [0, 4, 0], [0, 0, 1]])
+    )
+    configuration = casmconfig.Configuration(supercell)
+    configuration.set_occupation([0, 1, 1, 0])
+
+    initial = casmconfig.asymmetric_unit_indices(configuration)
+    assert initial == [[0, 3], [1, 2]]
+    initial_index = casmconfig.make_asymmetric_unit_index(configuration)
+    assert isinstance(initial_index, np.ndarray)
+    assert initial_index.tolist() == [0, 1, 1, 0]
+
+    # all operations: all sites equivalent
+    group = casmconfig.make_invariant_subgroup(
+        configuration=casmconfig.Configuration(supercell)
+    )
+    assert (
+        casmconfig.make_asymmetric_unit_index(configuration, group=group).tolist()
+        == [0, 0, 0, 0]
+    )
+
+    lattice = supercell.superlattice
+    lattice_ref = supercell_ref.superlattice
+    n_checked = 0
+    for i, op in enumerate(prim.factor_group.elements):
+        if not (op * lattice).is_equivalent_to(lattice_ref):
+            continue
+        configuration_ref = casmconfig.copy_transformed_configuration(
+            i, [1, 0, 0], configuration, supercell_ref
+        )
+        occ_ref = configuration_ref.occupation
+        reference = casmconfig.asymmetric_unit_indices(configuration_ref)
+        final = casmconfig.make_consistent_asymmetric_unit_indices(
+            initial=initial,
+            configuration_init=configuration,
+            reference=reference,
+            configuration_ref=configuration_ref,
+        )
+        assert final is not None
+        assert len(final) == len(reference)
+        for asym_unit, asym_unit_ref in zip(final, reference):
+            assert len(asym_unit) == len(asym_unit_ref)
+            assert configuration.occ(asym_unit[0]) == occ_ref[asym_unit_ref[0]]
+
+        final_index = casmconfig.make_consistent_asymmetric_unit_index(
+            initial=initial_index,
+            configuration_init=configuration,
+            reference=casmconfig.make_asymmetric_unit_index(configuration_ref),
+            configuration_ref=configuration_ref,
+        )
+        for i_asym, asym_unit in enumerate(final):
+            assert all(final_index[asym_unit] == i_asym)
+        n_checked += 1
+    assert n_checked > 0
+
+    other = casmconfig.Configuration(supercell_ref)
+    other.set_occupation([0, 0, 0, 1])
+    assert (
+        casmconfig.make_consistent_asymmetric_unit_indices(
+            initial, configuration, casmconfig.asymmetric_unit_indices(other), other
+        )
+        is None
+    )
+
+
+def test_super_configuration_generator(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    motif_supercell = casmconfig.Supercell(
+        prim, np.array([[2, 0, 0], [0, 1, 0], [0, 0, 1]])
+    )
+    motif = casmconfig.Configuration(motif_supercell)
+    motif.set_occupation([0, 1])
+    supercell = casmconfig.Supercell(prim, np.array([[4, 0, 0], [0, 2, 0], [0, 0, 2]]))
+
+    by_subsets = casmconfig.make_all_super_configurations_by_subsets(motif, supercell)
+    expected = casmconfig.make_all_super_configurations(motif, supercell)
+
+    for batch_size, n_threads in [(1, 1), (3, 2), (100, 4)]:
+        generator = casmconfig.SuperConfigurationGenerator(
+            motif, supercell, batch_size=batch_size, n_threads=n_threads
+        )
+        assert generator.n_subsets() == len(by_subsets)
+        assert generator.subset_index() == -1
+        found = []
+        found_by_subsets = [[] for _ in range(generator.n_subsets())]
+        for configuration in generator:
+            found.append(configuration)
+            found_by_subsets[generator.subset_index()].append(configuration)
+        assert sorted(found) == sorted(expected)
+        for i, subset in enumerate(found_by_subsets):
+            assert sorted(subset) == sorted(by_subsets[i])
+
+
+def test_distinct_configuration_finder(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    motif_supercell = casmconfig.Supercell(
+        prim, np.array([[2, 0, 0], [0, 1, 0], [0, 0, 1]])
+    )
+    motif = casmconfig.Configuration(motif_supercell)
+    motif.set_occupation([0, 1])
+    supercell = casmconfig.Supercell(prim, np.array([[4, 0, 0], [0, 2, 0], [0, 0, 2]]))
+    all = casmconfig.make_all_super_configurations(motif, supercell)
+    assert len(all) > 1
+
+    calculator = casmconfig.InvariantFingerprintCalculator(prim)
+    assert calculator.n_site_occupant_orbits() == 2
+    fingerprints = set([calculator(x) for x in all])
+    assert len(fingerprints) == 1
+
+    finder = casmconfig.DistinctConfigurationFinder(calculator)
+    assert finder.insert(all[0]) is True
+    assert finder.n_canonical_forms() == 0
+    for x in all[1:]:
+        assert finder.insert(x) is False
+    assert len(finder.configurations()) == 1
+    assert finder.n_canonical_forms() == len(all)
+
+
+def test_make_distinct_super_configurations_in_supercells(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    motif_supercell = casmconfig.Supercell(
+        prim, np.array([[2, 0, 0], [0, 1, 0], [0, 0, 1]])
+    )
+    motif = casmconfig.Configuration(motif_supercell)
+    motif.set_occupation([0, 1])
+    supercells = [
+        casmconfig.Supercell(prim, np.array(T, dtype="int64"))
+        for T in [
+            [[2, 0, 0], [0, 1, 0], [0, 0, 1]],
+            [[2, 0, 0], [0, 2, 0], [0, 0, 1]],
+            [[4, 0, 0], [0, 2, 0], [0, 0, 2]],
+            [[2, 0, 0], [0, 2, 0], [0, 0, 2]],
+        ]
+    ]
+    for n_threads in [1, 2]:
+        by_supercell = casmconfig.make_distinct_super_configurations_in_supercells(
+            motif=motif,
+            supercells=supercells,
+            n_threads=n_threads,
+        )
+        assert len(by_supercell) == len(supercells)
+        for supercell, distinct in zip(supercells, by_supercell):
+            expected = casmconfig.make_distinct_super_configurations(motif, supercell)
+            assert distinct == expected
+
+
 def test_configuration_to_from_dict(FCC_binary_Hstrain_noshear_disp_nodz_prim):
     import io
     from contextlib import redirect_stdout
@@ -430,3 +777,192 @@ def test_configuration_to_from_dict(FCC_binary_Hstrain_noshear_disp_nodz_prim):
         print(configuration_in_2)
     out = f.getvalue()
     assert "dof" in out
+
+
+def test_configuration_batch(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    T = np.array(
+        [
+            [2, 0, 0],
+            [0, 2, 0],
+            [0, 0, 1],
+        ]
+    )
+    supercell = casmconfig.Supercell(prim, T)
+    configurations = []
+    for i in range(16):
+        configuration = casmconfig.Configuration(supercell)
+        for l in range(4):
+            configuration.set_occ(l, (i >> l) & 1)
+        configurations.append(configuration)
+
+    batch = casmconfig.ConfigurationBatch(supercell, configurations)
+    assert len(batch) == 16
+    assert batch.n_sites() == 4
+    occupation = batch.occupation()
+    assert occupation.shape == (16, 4)
+    for i, configuration in enumerate(configurations):
+        assert (occupation[i] == configuration.occupation).all()
+        assert batch[i] == configuration
+
+    # the array is a view of the batch storage
+    occupation[0, :] = 1
+    assert (batch[0].occupation == 1).all()
+    batch[0] = configurations[0]
+    assert batch[0] == configurations[0]
+
+    is_canonical = batch.is_canonical(n_threads=2)
+    expected = [casmconfig.is_canonical_configuration(x) for x in configurations]
+    assert list(is_canonical) == expected
+
+    batch.make_canonical(n_threads=2)
+    for i, configuration in enumerate(configurations):
+        assert batch[i] == casmconfig.make_canonical_configuration(configuration)
+
+
+def test_configuration_batch_set_order_parameters(
+    FCC_binary_Hstrain_noshear_disp_nodz_prim,
+):
+    xtal_prim = FCC_binary_Hstrain_noshear_disp_nodz_prim
+    prim = casmconfig.Prim(xtal_prim)
+    T = np.array(
+        [
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ],
+        dtype="int",
+    )
+    supercell = casmconfig.Supercell(prim, T)
+    background = casmconfig.Configuration(supercell)
+    background.set_occ(1, 1)
+
+    for dof_space in [
+        casmclex.DoFSpace(dof_key="Hstrain", xtal_prim=xtal_prim),
+        casmclex.DoFSpace(
+            dof_key="disp",
+            xtal_prim=xtal_prim,
+            transformation_matrix_to_super=T,
+        ),
+    ]:
+        dim = dof_space.basis.shape[1]
+        order_parameters = np.array(
+            [[0.01 * (i + 1) * (j - 2) for i in range(dim)] for j in range(5)]
+        )
+        batch = casmconfig.ConfigurationBatch(supercell)
+        batch.set_order_parameters(
+            background=background,
+            dof_space=dof_space,
+            order_parameters=order_parameters,
+        )
+        assert len(batch) == 5
+        for j in range(5):
+            expected = copy.copy(background)
+            expected.set_order_parameters(
+                dof_space=dof_space,
+                order_parameters=order_parameters[j],
+            )
+            assert batch[j] == expected
+
+
+def test_configuration_pickle(simple_cubic_binary_prim):
+    import pickle
+
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    T = np.array(
+        [
+            [2, 0, 0],
+            [0, 1, 0],
+            [0, 0, 1],
+        ],
+        dtype="int",
+    )
+    supercell = casmconfig.Supercell(prim, T)
+    configuration = casmconfig.Configuration(supercell)
+    configuration.set_occ(0, 1)
+
+    unpickled_prim = pickle.loads(pickle.dumps(prim))
+    assert isinstance(unpickled_prim, casmconfig.Prim)
+    assert unpickled_prim.to_dict() == prim.to_dict()
+
+    unpickled_supercell = pickle.loads(pickle.dumps(supercell))
+    assert unpickled_supercell == supercell
+
+    unpickled = pickle.loads(pickle.dumps(configuration))
+    assert isinstance(unpickled, casmconfig.Configuration)
+    assert unpickled == configuration
+    assert list(unpickled.occupation) == list(configuration.occupation)
+
+    # supercells are shared by configurations unpickled separately
+    unpickled_2 = pickle.loads(pickle.dumps(configuration))
+    assert unpickled_2.supercell == unpickled.supercell
+
+    configurations = casmconfig.ConfigurationSet()
+    configurations.add(configuration)
+    unpickled_set = pickle.loads(pickle.dumps(configurations))
+    assert len(unpickled_set) == 1
+    assert unpickled_set.get(configuration).configuration == configuration
+
+    empty = pickle.loads(pickle.dumps(casmconfig.ConfigurationSet()))
+    assert len(empty) == 0
+
+
+def test_prim_pickle_subgroup(simple_cubic_binary_prim):
+    import pickle
+
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    elements = [
+        op
+        for op in prim.factor_group.elements
+        if np.allclose(op.matrix(), np.eye(3))
+        or np.allclose(op.matrix(), -np.eye(3))
+    ]
+    assert len(elements) == 2
+    subgroup_prim = casmconfig.Prim(
+        simple_cubic_binary_prim, factor_group_elements=elements
+    )
+
+    # prims with the same structure but different factor groups are distinct
+    unpickled_prim = pickle.loads(pickle.dumps(prim))
+    unpickled_subgroup_prim = pickle.loads(pickle.dumps(subgroup_prim))
+    assert len(unpickled_prim.factor_group.elements) == 48
+    assert len(unpickled_subgroup_prim.factor_group.elements) == 2
+
+    unpickled_subgroup_prim_2 = pickle.loads(pickle.dumps(subgroup_prim))
+    assert len(unpickled_subgroup_prim_2.factor_group.elements) == 2
+
+
+def test_configuration_delta(simple_cubic_binary_prim):
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    T = np.array(
+        [
+            [3, 0, 0],
+            [0, 3, 0],
+            [0, 0, 3],
+        ]
+    )
+    supercell = casmconfig.Supercell(prim, T)
+    background = casmconfig.Configuration(supercell)
+    configurations = []
+    for l in range(5):
+        configuration = background.copy()
+        configuration.set_occ(l, 1)
+        configurations.append(configuration)
+
+    deltas = casmconfig.make_configuration_deltas(
+        background, configurations, n_threads=2
+    )
+    assert len(deltas) == 5
+    for delta, configuration in zip(deltas, configurations):
+        assert delta.n_changes() == 1
+        assert delta.make_configuration() == configuration
+        assert delta.background() == background
+    assert deltas[0].occupation_changes() == [(0, 1)]
+    assert sorted(deltas) == sorted(deltas, reverse=True)[::-1]
+    assert casmconfig.ConfigurationDelta(background, configurations[0]) == deltas[0]
+
+    data = casmconfig.configuration_deltas_to_dict(deltas)
+    assert len(data["deltas"]) == 5
+    assert data["deltas"][0] == deltas[0].to_dict()
+    read = casmconfig.configuration_deltas_from_dict(data, prim)
+    assert [x.make_configuration() for x in read] == configurations
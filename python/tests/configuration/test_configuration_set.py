@@ -181,3 +181,128 @@ def test_ConfigurationRecord_repr(simple_cubic_binary_prim):
         assert "supercell_name" in out
         assert "configuration_id" in out
         assert "configuration_name" in out
+
+
+def test_ConfigurationSet_supercell_records(simple_cubic_binary_prim):
+    prim = config.Prim(simple_cubic_binary_prim)
+    configurations = config.ConfigurationSet()
+
+    supercells = [
+        config.Supercell(prim, np.eye(3, dtype=int)),
+        config.Supercell(prim, np.eye(3, dtype=int) * 2),
+    ]
+    for supercell in supercells:
+        for i in range(supercell.n_sites):
+            configuration = config.Configuration(supercell)
+            configuration.set_occ(i, 1)
+            configurations.add(configuration)
+    assert len(configurations) == 9
+
+    for supercell, expected in zip(supercells, [1, 8]):
+        supercell_name = config.SupercellRecord(supercell).supercell_name
+        assert configurations.count_by_supercell(supercell_name) == expected
+        records = list(configurations.supercell_records(supercell_name))
+        assert len(records) == expected
+        for record in records:
+            assert record.supercell_name == supercell_name
+            assert record.configuration.supercell == supercell
+    assert list(configurations.supercell_records("SCEL_missing")) == []
+    assert configurations.count_by_supercell("SCEL_missing") == 0
+
+    with pytest.raises(Exception):
+        config.ConfigurationRecord(
+            configuration=config.Configuration(supercells[0]),
+            supercell_name="SCEL1_1_1_1_0_0_0",
+            configuration_id="a",
+        )
+
+
+def test_ConfigurationSetView(simple_cubic_binary_prim, tmp_path):
+    prim = config.Prim(simple_cubic_binary_prim)
+    configurations = config.ConfigurationSet()
+
+    T = np.array(
+        [
+            [2, 0, 0],
+            [0, 1, 0],
+            [0, 0, 1],
+        ]
+    )
+    supercell = config.make_canonical_supercell(config.Supercell(prim, T))
+    for i in range(3):
+        configuration = config.Configuration(supercell)
+        configuration.set_occ(0, i % 2)
+        configuration.set_occ(1, i // 2)
+        configurations.add(configuration)
+
+    path = tmp_path / "configurations.bin"
+    config.ConfigurationSetView.write(configurations, str(path))
+
+    supercells = config.SupercellSet(prim)
+    view = config.ConfigurationSetView(str(path), supercells)
+    assert len(view) == 3
+    for i, record in enumerate(configurations):
+        assert view.configuration_name(i) == record.configuration_name
+        assert view[i].configuration == record.configuration
+        assert record.configuration_name in view
+        assert view.get(record.configuration_name).configuration_id == (
+            record.configuration_id
+        )
+        assert view.index(record.configuration_name) == i
+    assert view.get("SCEL1_1_1_1_0_0_0/0") is None
+    assert len([record for record in view]) == 3
+    assert view.next_config_id() == {view[0].supercell_name: 3}
+    assert len(supercells) == 1
+
+
+def test_ConfigurationSet_memory_usage(simple_cubic_binary_prim):
+    prim = config.Prim(simple_cubic_binary_prim)
+    configurations = config.ConfigurationSet()
+    empty_bytes = configurations.memory_usage()
+
+    supercell = config.Supercell(prim, np.eye(3, dtype=int) * 2)
+    for i in range(4):
+        configuration = config.Configuration(supercell)
+        configuration.set_occ(i, 1)
+        configurations.add(configuration)
+    one_bytes = configurations.memory_usage()
+    supercell_bytes = supercell.memory_usage()["total_bytes"]
+    assert one_bytes > empty_bytes + supercell_bytes
+    assert one_bytes < empty_bytes + 2 * supercell_bytes
+
+
+def test_ConfigurationSetJournal(simple_cubic_binary_prim, tmp_path):
+    prim = config.Prim(simple_cubic_binary_prim)
+    supercells = config.SupercellSet(prim)
+    supercell = config.Supercell(prim, np.eye(3, dtype=int) * 2)
+    configurations = []
+    for i in range(4):
+        configuration = config.Configuration(supercell)
+        configuration.set_occ(i, 1)
+        configurations.append(configuration)
+
+    path = str(tmp_path / "configurations.bin")
+    journal = config.ConfigurationSetJournal(path, supercells)
+    assert journal.insert(configurations[0]) is True
+    assert journal.insert(configurations[0]) is False
+    journal.compact()
+    assert journal.n_entries == 0
+    assert journal.insert(configurations[1]) is True
+    assert journal.insert(configurations[2]) is True
+    assert journal.erase(configurations[1]) is True
+    assert journal.n_entries == 3
+    journal.flush()
+    del journal
+
+    # the snapshot has only the compacted record
+    view = config.ConfigurationSetView(path, supercells)
+    assert len(view) == 1
+
+    journal = config.ConfigurationSetJournal(path, supercells, sync_policy="none")
+    assert journal.n_entries == 3
+    assert len(journal.configurations) == 2
+    assert configurations[2] in journal.configurations
+    assert configurations[1] not in journal.configurations
+
+    with pytest.raises(Exception):
+        config.ConfigurationSetJournal(path, supercells, sync_policy="bad")
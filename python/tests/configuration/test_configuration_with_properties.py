@@ -419,3 +419,65 @@ def test_configuration_with_properties_io(FCC_binary_prim):
     assert "configuration" in out
     assert "global_properties" in out
     assert "local_properties" in out
+
+
+def test_symmetrize_properties(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    T_conventional = np.array(
+        [
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ],
+        dtype=int,
+    )
+    supercell = casmconfig.Supercell(prim, T_conventional)
+    config_init = casmconfig.Configuration(supercell=supercell)
+    config_init.set_occupation(np.array([1, 1, 0, 0], dtype=int))
+
+    disp_init = np.array(
+        [
+            [0.01, 0.05, 0.09],
+            [0.02, 0.06, 0.10],
+            [0.03, 0.07, 0.11],
+            [0.04, 0.08, 0.12],
+        ]
+    ).transpose()
+    Hstrain_init = np.array([0.01, 0.02, 0.03, 0.04, 0.05, 0.06])
+    config_w_props = casmconfig.ConfigurationWithProperties(
+        configuration=config_init,
+        local_properties={"disp": disp_init},
+        global_properties={"energy": np.array([0.1]), "Hstrain": Hstrain_init},
+    )
+
+    subgroup = casmconfig.make_invariant_subgroup(config_init)
+    disp_sum = np.zeros(disp_init.shape)
+    Hstrain_sum = np.zeros(Hstrain_init.shape)
+    for op in subgroup:
+        transformed = casmconfig.copy_apply(op, config_w_props)
+        disp_sum += transformed.local_properties["disp"]
+        Hstrain_sum += transformed.global_properties["Hstrain"]
+
+    batch = casmconfig.symmetrize_properties_batch(
+        [config_w_props, config_w_props], n_threads=2
+    )
+
+    casmconfig.symmetrize_properties(config_w_props)
+    assert config_w_props.configuration == config_init
+    assert np.allclose(
+        config_w_props.local_properties["disp"], disp_sum / len(subgroup)
+    )
+    assert np.allclose(
+        config_w_props.global_properties["Hstrain"], Hstrain_sum / len(subgroup)
+    )
+    assert np.allclose(config_w_props.global_properties["energy"], [0.1])
+
+    assert len(batch) == 2
+    for x in batch:
+        assert np.allclose(
+            x.local_properties["disp"], config_w_props.local_properties["disp"]
+        )
+        assert np.allclose(
+            x.global_properties["Hstrain"],
+            config_w_props.global_properties["Hstrain"],
+        )
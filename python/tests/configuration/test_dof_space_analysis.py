@@ -541,3 +541,42 @@ def test_dof_space_analysis_6(FCC_binary_disp_fix_corner_prim):
     assert np.allclose(
         symmetry_adapted_dof_space.basis, sym_report.symmetry_adapted_subspace
     )
+
+
+def test_dof_space_analysis_cache(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    T_dof_space = np.array(
+        [  # conventional FCC cubic cell
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ],
+        dtype=int,
+    )
+    dof_space = casmclex.DoFSpace(
+        dof_key="occ",
+        xtal_prim=FCC_binary_prim,
+        transformation_matrix_to_super=T_dof_space,
+    )
+
+    expected = casmconfig.dof_space_analysis(dof_space=dof_space, prim=prim)
+
+    cache = casmirreps.IrrepDecompositionCache()
+    assert cache.size() == 0
+    for i in range(2):
+        results = casmconfig.dof_space_analysis(
+            dof_space=dof_space,
+            prim=prim,
+            irrep_decomposition_cache=cache,
+        )
+        assert cache.size() == 1
+        assert np.allclose(
+            results.symmetry_adapted_dof_space.basis,
+            expected.symmetry_adapted_dof_space.basis,
+        )
+        assert len(results.symmetry_report.irreps) == len(
+            expected.symmetry_report.irreps
+        )
+
+    cache.clear()
+    assert cache.size() == 0
@@ -200,3 +200,33 @@ def test_disp_dof_space_rep_1(FCC_binary_Hstrain_disp_prim):
         assert np.allclose(transformed_eta, transformed_disp.reshape((12,), order="F"))
 
     # assert False
+
+
+def test_dof_space_rep_cache(FCC_binary_Hstrain_disp_prim):
+    xtal_prim = FCC_binary_Hstrain_disp_prim
+    prim = config.Prim(xtal_prim)
+    T = np.array([[2, 0, 0], [0, 1, 0], [0, 0, 1]], dtype=int)
+    supercell = config.Supercell(prim, T)
+    configuration = config.Configuration(supercell=supercell)
+    group = config.make_invariant_subgroup(configuration=configuration)
+    dof_space = casmclex.DoFSpace(
+        dof_key="disp",
+        xtal_prim=xtal_prim,
+        transformation_matrix_to_super=T,
+    )
+
+    cache = config.DoFSpaceRepCache()
+    expected = config.make_dof_space_rep(group=group, dof_space=dof_space)
+    for _ in range(2):
+        matrix_rep = config.make_dof_space_rep(
+            group=group,
+            dof_space=dof_space,
+            cache=cache,
+        )
+        assert len(matrix_rep) == len(expected)
+        for M, M_expected in zip(matrix_rep, expected):
+            assert np.allclose(M, M_expected)
+        assert cache.size() == 1
+
+    cache.clear()
+    assert cache.size() == 0
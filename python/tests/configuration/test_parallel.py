@@ -0,0 +1,9 @@
+import libcasm.configuration as casmconfig
+
+
+def test_set_num_threads():
+    casmconfig.set_num_threads(2)
+    assert casmconfig.get_num_threads() == 2
+
+    casmconfig.set_num_threads(0)
+    assert casmconfig.get_num_threads() >= 1
@@ -0,0 +1,29 @@
+import numpy as np
+
+import libcasm.configuration as casmconfig
+
+
+def test_perf_report(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    casmconfig.perf_reset()
+
+    report = casmconfig.perf_report()
+    assert isinstance(report["enabled"], bool)
+    assert report["counters"]["supercell_construction"] == 0
+    assert report["timers"]["to_canonical"] == {"count": 0, "total_s": 0.0}
+
+    supercell = casmconfig.Supercell(prim, np.eye(3, dtype=int) * 2)
+    configuration = casmconfig.Configuration(supercell)
+    configuration.set_occ(0, 1)
+    casmconfig.make_canonical_configuration(configuration)
+
+    report = casmconfig.perf_report()
+    if report["enabled"]:
+        assert report["counters"]["canonicalization"] >= 1
+        assert report["counters"]["config_is_equivalent_compare"] > 0
+    else:
+        assert all(value == 0 for value in report["counters"].values())
+
+    casmconfig.perf_reset()
+    report = casmconfig.perf_report()
+    assert all(value == 0 for value in report["counters"].values())
@@ -36,6 +36,26 @@ def test_simple_cubic_binary_factor_group(simple_cubic_binary_prim):
         print(xtal.pretty_json(syminfo.to_dict()))
 
 
+def test_prim_with_factor_group_elements(simple_cubic_binary_prim):
+    xtal_prim = simple_cubic_binary_prim
+    prim = config.Prim(xtal_prim)
+    elements = prim.factor_group.elements
+
+    prim_2 = config.Prim(xtal_prim, factor_group_elements=elements)
+    assert len(prim_2.factor_group.elements) == len(elements)
+    for op, op_2 in zip(elements, prim_2.factor_group.elements):
+        assert np.allclose(op.matrix(), op_2.matrix())
+        assert np.allclose(op.translation(), op_2.translation())
+    assert prim_2.occ_symgroup_rep == prim.occ_symgroup_rep
+
+    with pytest.raises(Exception):
+        config.Prim(
+            xtal_prim,
+            sym_info_cache=config.PrimSymInfoCache(),
+            factor_group_elements=elements,
+        )
+
+
 @pytest.mark.xfail(reason="known tolerance issue")
 def test_symop_prec():
     # Relates to libcasm-xtal commit 28f1140
@@ -495,3 +515,34 @@ def test_prim_atom_position_symgroup_rep():
                         r2=cart_after,
                     )
                     assert np.allclose(d, np.zeros((3,)))
+
+
+def test_prim_sym_info_cache(simple_cubic_binary_prim, tmp_path):
+    xtal_prim = simple_cubic_binary_prim
+    cache_dir = tmp_path / "sym_info_cache"
+
+    cache = config.PrimSymInfoCache(cache_dir=str(cache_dir))
+    assert cache.cache_dir() == str(cache_dir)
+    prim = config.Prim(xtal_prim, sym_info_cache=cache)
+    assert cache.size() == 1
+    prim_2 = config.Prim(xtal_prim, sym_info_cache=cache)
+    assert cache.size() == 1
+
+    digest = config.make_prim_digest(xtal_prim)
+    assert (cache_dir / (digest + ".json")).exists()
+
+    # a new cache reads the factor group from disk
+    cache_2 = config.PrimSymInfoCache(cache_dir=str(cache_dir))
+    prim_3 = config.Prim(xtal_prim, sym_info_cache=cache_2)
+    expected = config.Prim(xtal_prim)
+    for p in [prim, prim_2, prim_3]:
+        elements = p.factor_group.elements
+        expected_elements = expected.factor_group.elements
+        assert len(elements) == len(expected_elements)
+        for op, expected_op in zip(elements, expected_elements):
+            assert np.allclose(op.matrix(), expected_op.matrix())
+        assert p.occ_symgroup_rep == expected.occ_symgroup_rep
+
+    cache.clear()
+    assert cache.size() == 0
+    assert config.PrimSymInfoCache().cache_dir() is None
@@ -377,3 +377,98 @@ def test_bcc_hcp_mapping_conversions_2():
 
     # print("### Mapped canonical configuration w/ properties ###")
     # print(xtal.pretty_json(canonical_config_w_props.to_dict()))
+
+
+def test_from_structures(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    T = np.array(
+        [
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ],
+        dtype=int,
+    )
+    supercell = casmconfig.make_canonical_supercell(casmconfig.Supercell(prim, T))
+    occupations = [[0, 0, 0, 0], [1, 0, 0, 0], [1, 1, 0, 0], [1, 1, 1, 0]]
+    structures = [
+        make_configuration(supercell, occupation).to_structure()
+        for occupation in occupations
+    ]
+
+    # an atom type that is not allowed
+    bad_structure = xtal.Structure(
+        lattice=structures[0].lattice(),
+        atom_coordinate_frac=structures[0].atom_coordinate_frac(),
+        atom_type=["C", "A", "A", "A"],
+    )
+    structures.insert(2, bad_structure)
+
+    supercell_set = casmconfig.SupercellSet(prim)
+    results, errors = casmconfig.ConfigurationWithProperties.from_structures(
+        prim=prim,
+        structures=structures,
+        supercells=supercell_set,
+        n_threads=2,
+    )
+    assert len(results) == 5
+    assert len(errors) == 5
+    assert results[2] is None
+    assert "'C'" in errors[2]
+    assert len(supercell_set) == 1
+
+    expected = [occupations[0], occupations[1], None] + occupations[2:]
+    for i, result in enumerate(results):
+        if expected[i] is None:
+            continue
+        assert errors[i] == ""
+        assert result.configuration.supercell == supercell
+        assert result.configuration.occupation.tolist() == expected[i]
+
+
+def test_make_atomic_structure_batch(FCC_binary_GLstrain_disp_prim):
+    prim = casmconfig.Prim(FCC_binary_GLstrain_disp_prim)
+    T = np.array(
+        [
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ],
+        dtype="int64",
+    )
+    supercell = casmconfig.Supercell(prim, T)
+
+    rng = np.random.default_rng(0)
+    configurations = []
+    for k in range(6):
+        config = casmconfig.Configuration(supercell)
+        config.set_occupation([(k + l) % 2 for l in range(supercell.n_sites())])
+        config.set_local_dof_values(
+            "disp", rng.uniform(-0.05, 0.05, size=(3, supercell.n_sites()))
+        )
+        config.set_global_dof_values("GLstrain", rng.uniform(-0.02, 0.02, size=6))
+        configurations.append(config)
+
+    batch = casmconfig.make_atomic_structure_batch(
+        configurations, excluded_species=["B"], n_threads=2
+    )
+    L = batch["lattice_column_vector_matrix"]
+    atom_offset = batch["atom_offset"]
+    coords = batch["atom_coordinate_cart"]
+    atom_type_index = batch["atom_type_index"]
+    names = batch["atom_type_names"]
+    assert L.shape == (3, 3 * len(configurations))
+    assert atom_offset.shape == (len(configurations) + 1,)
+    assert coords.shape == (3, atom_offset[-1])
+
+    for k, config in enumerate(configurations):
+        structure = config.to_structure(excluded_species=["B"])
+        begin, end = atom_offset[k], atom_offset[k + 1]
+        assert np.allclose(
+            L[:, 3 * k : 3 * k + 3],
+            structure.lattice().column_vector_matrix(),
+        )
+        assert np.allclose(coords[:, begin:end], structure.atom_coordinate_cart())
+        assert [names[i] for i in atom_type_index[begin:end]] == (
+            structure.atom_type()
+        )
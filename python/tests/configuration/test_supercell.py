@@ -156,6 +156,65 @@ def test_simple_cubic_binary_supercell_compare(simple_cubic_binary_prim):
     assert data[supercell2] == "supercell2"
 
 
+def test_equivalent_transformation_matrices(simple_cubic_binary_prim):
+    prim = config.Prim(simple_cubic_binary_prim)
+    T = np.array(
+        [
+            [2, 0, 0],
+            [0, 1, 0],
+            [0, 0, 1],
+        ],
+        dtype=int,
+    )
+    supercell = config.Supercell(prim, T)
+
+    equivalent_supercells = config.make_equivalent_supercells(supercell)
+    equivalent_T = config.make_equivalent_transformation_matrices(
+        prim=prim,
+        transformation_matrix_to_super=T,
+    )
+    assert len(equivalent_T) == 3
+    assert len(equivalent_T) == len(equivalent_supercells)
+    for T_equiv, scel in zip(equivalent_T, equivalent_supercells):
+        assert np.array_equal(T_equiv, scel.transformation_matrix_to_super)
+        assert config.make_superlattice_invariant_factor_group_indices(
+            prim=prim,
+            transformation_matrix_to_super=T_equiv,
+        ) == sorted(scel.factor_group.head_group_index)
+
+    canonical_T = config.make_canonical_transformation_matrix(
+        prim=prim,
+        transformation_matrix_to_super=T,
+    )
+    assert np.array_equal(
+        canonical_T,
+        config.make_canonical_supercell(supercell).transformation_matrix_to_super,
+    )
+
+    # batch variants
+    all_canonical_T = config.make_canonical_transformation_matrices(
+        prim=prim,
+        transformation_matrices_to_super=equivalent_T,
+        n_threads=2,
+    )
+    for x in all_canonical_T:
+        assert np.array_equal(x, canonical_T)
+    all_equivalent_T = config.make_equivalent_transformation_matrices_batch(
+        prim=prim,
+        transformation_matrices_to_super=[T, np.eye(3, dtype=int)],
+        n_threads=2,
+    )
+    assert len(all_equivalent_T) == 2
+    assert len(all_equivalent_T[0]) == 3
+    assert len(all_equivalent_T[1]) == 1
+    all_equivalents = config.make_equivalent_supercells_batch(
+        supercells=[supercell, config.Supercell(prim, np.eye(3, dtype=int))],
+        n_threads=2,
+    )
+    assert all_equivalents[0] == equivalent_supercells
+    assert len(all_equivalents[1]) == 1
+
+
 def test_supercell_io(simple_cubic_binary_prim):
     prim = config.Prim(simple_cubic_binary_prim)
     T1 = np.array(
@@ -188,3 +247,94 @@ def test_supercell_io(simple_cubic_binary_prim):
         print(supercell1)
     out = f.getvalue()
     assert "transformation_matrix_to_super" in out
+
+
+def test_SupercellSymInfoTables(simple_cubic_binary_prim, tmp_path):
+    prim = config.Prim(simple_cubic_binary_prim)
+    T1 = np.eye(3, dtype=int) * 2
+    T2 = np.array(
+        [
+            [2, 1, 0],
+            [0, 1, 0],
+            [0, 0, 3],
+        ]
+    )
+    supercells = [config.Supercell(prim, T1), config.Supercell(prim, T2)]
+    path = str(tmp_path / "sym_info.bin")
+    config.SupercellSymInfoTables.write(supercells, path)
+
+    tables = config.SupercellSymInfoTables(path)
+    assert len(tables) == 2
+    assert (tables.transformation_matrix_to_super(1) == T2).all()
+    for expected in supercells:
+        T = expected.transformation_matrix_to_super
+        supercell = tables.make_supercell(prim, T)
+        assert supercell == expected
+        assert supercell.n_sites == expected.n_sites
+        assert supercell.factor_group_permutations == (
+            expected.factor_group_permutations
+        )
+
+
+def test_supercell_memory_usage(simple_cubic_binary_prim):
+    prim = config.Prim(simple_cubic_binary_prim)
+    T = np.eye(3, dtype=int) * 3
+    supercell = config.Supercell(prim, T)
+    report = supercell.memory_usage()
+    assert report["n_sites"] == 27
+    assert report["n_translation_permutations"] == 27
+    assert report["translation_permutations_bytes"] >= 27 * 27 * 8
+    parts = [
+        value
+        for key, value in report.items()
+        if key.endswith("_bytes") and key != "total_bytes"
+    ]
+    assert report["total_bytes"] == sum(parts)
+
+    supercell = config.Supercell(prim, T, max_n_translation_permutations=10)
+    report = supercell.memory_usage()
+    assert report["n_translation_permutations"] == 0
+    assert report["translation_permutations_bytes"] == 0
+
+
+def test_combined_permutation_table(simple_cubic_binary_prim):
+    prim = config.Prim(simple_cubic_binary_prim)
+    T = np.eye(3, dtype=int) * 2
+    supercell = config.Supercell(prim, T)
+    no_table = config.Supercell(prim, T, combined_permutation_table_max_bytes=0)
+    assert supercell.memory_usage()["combined_permutation_table_bytes"] == 0
+
+    for op, other in zip(supercell.symgroup_rep(), no_table.symgroup_rep()):
+        perm = op.combined_permute()
+        assert perm == other.combined_permute()
+        inverse = op.inverse_combined_permute()
+        assert inverse == other.inverse_combined_permute()
+        assert [perm[i] for i in inverse] == list(range(len(perm)))
+
+    report = supercell.memory_usage()
+    assert report["combined_permutation_table_bytes"] >= 2 * 48 * 8 * 8 * 4
+    assert no_table.memory_usage()["combined_permutation_table_bytes"] == 0
+
+
+def test_make_supercell_symop_arrays(simple_cubic_binary_prim):
+    prim = config.Prim(simple_cubic_binary_prim)
+    T = np.array(
+        [
+            [2, 1, 0],
+            [0, 1, 0],
+            [0, 0, 3],
+        ]
+    )
+    supercell = config.Supercell(prim, T)
+    group = supercell.symgroup_rep()
+    assert len(group) == len(supercell.factor_group.elements) * 6
+
+    matrix, translation, time_reversal = config.make_supercell_symop_arrays(group)
+    assert matrix.shape == (len(group), 3, 3)
+    assert translation.shape == (len(group), 3)
+    assert time_reversal.shape == (len(group),)
+    for k, op in enumerate(group):
+        symop = op.to_symop()
+        assert np.allclose(matrix[k], symop.matrix())
+        assert np.allclose(translation[k], symop.translation())
+        assert time_reversal[k] == symop.time_reversal()
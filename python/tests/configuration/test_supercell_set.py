@@ -287,3 +287,57 @@ def test_SupercellRecord_repr(simple_cubic_binary_prim):
         assert "supercell_name" in out
         assert "canonical_supercell_name" in out
         assert "is_canonical" in out
+
+
+def test_SupercellSet_add_many(simple_cubic_binary_prim):
+    prim = config.Prim(simple_cubic_binary_prim)
+    supercells = config.SupercellSet(prim)
+
+    matrices = [n * np.eye(3, dtype=int) for n in [1, 2, 3, 1, 2]]
+    matrices.append(
+        np.array(
+            [
+                [2, 1, 0],
+                [0, 1, 0],
+                [0, 0, 1],
+            ]
+        )
+    )
+    records = supercells.add_by_transformation_matrices_to_super(
+        matrices, n_threads=2
+    )
+    assert len(records) == len(matrices)
+    assert len(supercells) == 4
+    for record, T in zip(records, matrices):
+        assert np.allclose(record.supercell.transformation_matrix_to_super, T)
+
+    names = [record.canonical_supercell_name for record in records]
+    canonical_supercells = config.SupercellSet(prim)
+    canonical_records = canonical_supercells.add_by_canonical_names(
+        names, n_threads=2
+    )
+    assert len(canonical_supercells) == 3
+    for record, name in zip(canonical_records, names):
+        assert record.is_canonical
+        assert record.supercell_name == name
+
+    with pytest.raises(Exception):
+        canonical_supercells.add_by_canonical_names(["SCEL2_2_1_1_0_0_1"])
+
+    data = supercells.to_dict()
+    supercells_in = config.SupercellSet.from_dict(data, prim, n_threads=2)
+    assert len(supercells_in) == 4
+
+
+def test_SupercellSet_memory_usage(simple_cubic_binary_prim):
+    prim = config.Prim(simple_cubic_binary_prim)
+    supercells = config.SupercellSet(prim)
+    for n in [1, 2, 3]:
+        supercells.add(np.eye(3, dtype=int) * n)
+
+    report = supercells.memory_usage()
+    assert len(report["supercells"]) == 3
+    assert report["total_bytes"] == report["records_bytes"] + sum(
+        x["total_bytes"] for x in report["supercells"]
+    )
+    assert report["supercells"][0]["factor_group_bytes"] > 0
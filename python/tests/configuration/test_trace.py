@@ -0,0 +1,33 @@
+import json
+
+import numpy as np
+
+import libcasm.configuration as casmconfig
+
+
+def test_trace(simple_cubic_binary_prim, tmp_path):
+    path = tmp_path / "trace.json"
+    prim = casmconfig.Prim(simple_cubic_binary_prim)
+    casmconfig.start_trace(str(path))
+    T = np.array(
+        [
+            [2, 0, 0],
+            [0, 2, 0],
+            [0, 0, 2],
+        ]
+    )
+    supercell = casmconfig.Supercell(prim, T)
+    assert supercell.n_sites == 8
+    casmconfig.stop_trace()
+
+    with open(path) as f:
+        data = json.load(f)
+    assert "traceEvents" in data
+    names = set(event["name"] for event in data["traceEvents"])
+    assert "Supercell.make_factor_group" in names
+    for event in data["traceEvents"]:
+        assert event["ph"] == "X"
+        assert event["dur"] >= 0.0
+
+    # stopping again does nothing
+    casmconfig.stop_trace()
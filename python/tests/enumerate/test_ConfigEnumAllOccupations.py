@@ -5,6 +5,7 @@ import libcasm.configuration as casmconfig
 import libcasm.enumerate as casmenum
 import libcasm.xtal as xtal
 import libcasm.xtal.prims as xtal_prims
+from libcasm.enumerate._enumerate import ConfigEnumAllOccupationsBase
 
 
 def test_ConfigEnumAllOccupations_by_supercell_FCC_1():
@@ -53,6 +54,60 @@ def test_ConfigEnumAllOccupations_by_supercell_FCC_1():
     assert len(configuration_set) == 29
 
 
+def test_ConfigEnumAllOccupations_by_supercell_n_threads_FCC_1():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B", "C"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+
+    def make_set(n_threads):
+        configuration_set = casmconfig.ConfigurationSet()
+        config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+        for configuration in config_enum.by_supercell(max=4, n_threads=n_threads):
+            configuration_set.add(configuration)
+        return configuration_set
+
+    expected = make_set(n_threads=None)
+    for n_threads in [1, 4]:
+        configuration_set = make_set(n_threads=n_threads)
+        assert len(configuration_set) == len(expected)
+        for record in configuration_set:
+            assert record.configuration in expected
+
+
+def test_ConfigEnumAllOccupations_by_supercell_check_prime_translations():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B", "C"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+
+    def make_list(check_prime_translations):
+        config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+        return [
+            configuration.copy()
+            for configuration in config_enum.by_supercell(
+                max=4, check_prime_translations=check_prime_translations
+            )
+        ]
+
+    expected = make_list(check_prime_translations=False)
+    assert make_list(check_prime_translations=True) == expected
+
+    # the checker agrees with is_primitive_configuration
+    supercell = casmconfig.Supercell(prim, np.eye(3, dtype="int") * 2)
+    checker = casmconfig.PrimitiveConfigurationChecker(supercell)
+    assert len(checker.translation_indices()) == 7
+    configuration = casmconfig.Configuration(supercell)
+    assert checker.is_primitive(configuration) is False
+    for i in range(supercell.n_sites):
+        configuration.set_occ(i, 1)
+        assert checker.is_primitive(
+            configuration
+        ) == casmconfig.is_primitive_configuration(configuration)
+
+
 def test_ConfigEnumAllOccupations_by_supercell_with_continuous_DoF_FCC_1():
     xtal_prim = xtal_prims.FCC(
         r=0.5,
@@ -313,3 +368,248 @@ def test_ConfigEnumAllOccupations_by_cluster_FCC_1():
     info.finish()
 
     assert len(configuration_set)
+
+
+def test_ConfigEnumCanonicalOccupationsBase_FCC_1():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B", "C"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+    supercell = casmconfig.Supercell(
+        prim=prim,
+        transformation_matrix_to_super=np.eye(3, dtype=int) * 2,
+    )
+    background = casmconfig.Configuration(supercell)
+    sites = set(range(supercell.n_sites))
+
+    expected = casmconfig.ConfigurationSet()
+    config_enum = ConfigEnumAllOccupationsBase(
+        background=background,
+        sites=sites,
+    )
+    while config_enum.is_valid():
+        if casmconfig.is_canonical_configuration(configuration=config_enum.value()):
+            expected.add(config_enum.value())
+        config_enum.advance()
+
+    n = 0
+    config_enum = casmenum.ConfigEnumCanonicalOccupationsBase(
+        background=background,
+        sites=sites,
+    )
+    while config_enum.is_valid():
+        assert config_enum.value() in expected
+        n += 1
+        config_enum.advance()
+    assert n == len(expected)
+
+
+def test_ConfigEnumCanonicalOccupationsBase_fixed_composition():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B", "C"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+    supercell = casmconfig.Supercell(
+        prim=prim,
+        transformation_matrix_to_super=np.eye(3, dtype=int) * 2,
+    )
+    background = casmconfig.Configuration(supercell)
+    sites = set(range(supercell.n_sites))
+    occupant_counts = [[4, 3, 1]]
+
+    expected = casmconfig.ConfigurationSet()
+    config_enum = ConfigEnumAllOccupationsBase(
+        background=background,
+        sites=sites,
+    )
+    while config_enum.is_valid():
+        occ = config_enum.value().occupation
+        counts = [int(np.count_nonzero(occ == i)) for i in range(3)]
+        if counts == occupant_counts[0] and casmconfig.is_canonical_configuration(
+            configuration=config_enum.value()
+        ):
+            expected.add(config_enum.value())
+        config_enum.advance()
+    assert len(expected) > 0
+
+    n = 0
+    config_enum = casmenum.ConfigEnumCanonicalOccupationsBase(
+        background=background,
+        sites=sites,
+        occupant_counts=occupant_counts,
+    )
+    while config_enum.is_valid():
+        assert config_enum.value() in expected
+        n += 1
+        config_enum.advance()
+    assert n == len(expected)
+
+    with pytest.raises(Exception):
+        casmenum.ConfigEnumCanonicalOccupationsBase(
+            background=background,
+            sites=sites,
+            occupant_counts=[[4, 4, 1]],
+        )
+
+
+def test_ConfigEnumAllOccupationsBase_fill_occupation_batch():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B", "C"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+    supercell = casmconfig.Supercell(
+        prim=prim,
+        transformation_matrix_to_super=np.eye(3, dtype=int) * 2,
+    )
+    background = casmconfig.Configuration(supercell)
+    sites = set(range(supercell.n_sites))
+
+    expected = []
+    expected_canonical = []
+    config_enum = ConfigEnumAllOccupationsBase(
+        background=background,
+        sites=sites,
+    )
+    while config_enum.is_valid():
+        expected.append(config_enum.value().occupation.copy())
+        if casmconfig.is_canonical_configuration(configuration=config_enum.value()):
+            expected_canonical.append(config_enum.value().occupation.copy())
+        config_enum.advance()
+
+    for dtype in [np.int8, np.int32]:
+        for canonical_only, _expected in [
+            (False, expected),
+            (True, expected_canonical),
+        ]:
+            config_enum = ConfigEnumAllOccupationsBase(
+                background=background,
+                sites=sites,
+            )
+            batch = np.zeros((100, supercell.n_sites), dtype=dtype)
+            rows = []
+            while True:
+                n = config_enum.fill_occupation_batch(
+                    batch=batch,
+                    canonical_only=canonical_only,
+                )
+                rows.extend(batch[:n].tolist())
+                if n < batch.shape[0]:
+                    break
+            assert not config_enum.is_valid()
+            assert rows == [x.tolist() for x in _expected]
+
+            # a finished enumerator writes nothing
+            n = config_enum.fill_occupation_batch(
+                batch=batch,
+                canonical_only=canonical_only,
+            )
+            assert n == 0
+
+    # arrays are not converted, so a mismatched dtype raises
+    config_enum = ConfigEnumAllOccupationsBase(background=background, sites=sites)
+    with pytest.raises(TypeError):
+        config_enum.fill_occupation_batch(
+            batch=np.zeros((100, supercell.n_sites), dtype=np.int64)
+        )
+
+    # canonical enumeration gives the same occupations, possibly reordered
+    config_enum = casmenum.ConfigEnumCanonicalOccupationsBase(
+        background=background,
+        sites=sites,
+    )
+    batch = np.zeros((len(expected_canonical) + 1, supercell.n_sites), dtype=np.int8)
+    n = config_enum.fill_occupation_batch(batch=batch)
+    assert n == len(expected_canonical)
+    assert sorted(batch[:n].tolist()) == sorted(
+        [x.tolist() for x in expected_canonical]
+    )
+
+
+def test_ConfigEnumAllOccupationsBase_gray_code():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B", "C"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+    T = np.eye(3, dtype=int)
+    T[0, 0] = 2
+    T[1, 1] = 2
+    supercell = casmconfig.Supercell(
+        prim=prim,
+        transformation_matrix_to_super=T,
+    )
+    background = casmconfig.Configuration(supercell)
+    sites = set(range(supercell.n_sites))
+
+    config_enum = ConfigEnumAllOccupationsBase(background=background, sites=sites)
+    assert config_enum.gray_code is False
+    expected = set()
+    while config_enum.is_valid():
+        expected.add(tuple(config_enum.value().occupation))
+        config_enum.advance()
+    assert len(expected) == 81
+
+    config_enum = ConfigEnumAllOccupationsBase(
+        background=background,
+        sites=sites,
+        gray_code=True,
+    )
+    assert config_enum.gray_code is True
+    assert config_enum.delta() == []
+    found = set()
+    previous = config_enum.value().occupation.copy()
+    while config_enum.is_valid():
+        found.add(tuple(config_enum.value().occupation))
+        config_enum.advance()
+        if not config_enum.is_valid():
+            break
+        delta = config_enum.delta()
+        assert len(delta) == 1
+        site_index, old_occupation, new_occupation = delta[0]
+        assert previous[site_index] == old_occupation
+        assert abs(new_occupation - old_occupation) == 1
+        previous[site_index] = new_occupation
+        assert (previous == config_enum.value().occupation).all()
+    assert found == expected
+
+
+def test_ConfigEnumAllOccupations_progress():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+
+    reports = []
+    progress = casmenum.EnumProgress(
+        callback=lambda status: reports.append(status),
+        report_interval=0.0,
+    )
+    config_enum = casmenum.ConfigEnumAllOccupations(prim=prim, progress=progress)
+    configurations = [config.copy() for config in config_enum.by_supercell(max=4)]
+    assert len(configurations) == 29
+
+    status = progress.status()
+    assert isinstance(status, casmenum.EnumProgressStatus)
+    assert status.n_accepted == 29
+    assert status.n_canonical == 29
+    assert status.n_generated >= status.n_canonical
+    assert status.n_generated == status.n_total
+    assert status.fraction_complete == pytest.approx(1.0)
+    assert status.rate > 0.0
+    assert len(reports) > 0
+    assert reports[-1].n_generated <= status.n_generated
+
+    # parallel enumeration counts natively, per batch
+    progress = casmenum.EnumProgress()
+    config_enum = casmenum.ConfigEnumAllOccupations(prim=prim, progress=progress)
+    configurations = [
+        config.copy() for config in config_enum.by_supercell(max=4, n_threads=2)
+    ]
+    assert len(configurations) == 29
+    status = progress.status()
+    assert status.n_accepted == 29
+    assert status.n_generated == status.n_total
@@ -372,3 +372,96 @@ def test_ConfigEnumLocalOccupations_L12_v2(L12_1NN_A_Va_local_enum):
 
     for x in first:
         assert x in second
+
+
+def test_make_suborbit_generating_ops(fcc_1NN_A_Va_event_L12):
+    prim, event, event_info, config = fcc_1NN_A_Va_event_L12
+
+    background_group = casmconfig.make_invariant_subgroup(configuration=config)
+    event_supercell_info = event_info.get_event_supercell_info(config.supercell)
+    event_group_rep = event_supercell_info.event_group_rep((0, 0))
+
+    ops = casmenum.make_suborbit_generating_ops(
+        supercell=config.supercell,
+        event_group=event_group_rep,
+        background_group=background_group,
+    )
+
+    # check against the direct double-coset minimum check
+    expected = []
+    rep = casmconfig.SupercellSymOp.begin(config.supercell)
+    end = casmconfig.SupercellSymOp.end(config.supercell)
+    while rep != end:
+        if not any(
+            background_op * rep * event_op < rep
+            for event_op in event_group_rep
+            for background_op in background_group
+        ):
+            expected.append(rep.copy())
+        rep.next()
+    assert len(ops) == len(expected)
+    assert all(a == b for a, b in zip(ops, expected))
+
+
+def test_ConfigEnumLocalOccupationsEngine(fcc_1NN_A_Va_event_L12):
+    prim, event, event_info, config = fcc_1NN_A_Va_event_L12
+
+    supercell = casmconfig.Supercell(
+        prim=prim,
+        transformation_matrix_to_super=np.eye(3, dtype="int") * 4,
+    )
+    background = casmconfig.copy_configuration(
+        motif=config,
+        supercell=supercell,
+    )
+    event_supercell_info = event_info.get_event_supercell_info(supercell)
+    pos = (0, 0)
+    supercell_event = event_supercell_info.event(pos)
+    event_group_rep = event_supercell_info.event_group_rep(pos)
+
+    cluster_specs = casmenum.make_first_n_orbits_cluster_specs(
+        prim=prim,
+        phenomenal=event,
+        cutoff_radius=[0, 2.01],
+        make_all_possible_orbits=True,
+    )
+    # local orbits about equivalent event 0, in unit cell 0
+    local_orbits = event_info.event_prim_info.make_local_orbits_from_cluster_specs(
+        cluster_specs=cluster_specs,
+    )[0]
+
+    engine = casmenum.ConfigEnumLocalOccupationsEngine(
+        background=background,
+        event=supercell_event,
+        event_group=event_group_rep,
+    )
+    results = engine.by_cluster(local_orbits=local_orbits)
+
+    # check against the per-orbit functions
+    expected = []
+    for i_local_orbit, local_orbit in enumerate(local_orbits):
+        sites = casmenum.make_distinct_local_cluster_sites(
+            configuration=background,
+            event=supercell_event,
+            event_group=event_group_rep,
+            local_orbits=[local_orbit],
+        )
+        for cluster_sites, _, canonical_config in (
+            casmenum.make_distinct_local_perturbations(
+                configuration=background,
+                event=supercell_event,
+                event_group=event_group_rep,
+                distinct_local_cluster_sites=sites,
+                allow_subcluster_perturbations=False,
+            )
+        ):
+            expected.append((i_local_orbit, cluster_sites, canonical_config))
+
+    assert len(results) == len(expected)
+    for result, x in zip(results, expected):
+        i_local_orbit, sites, occ_init, occ_final, _config, canonical = result
+        assert i_local_orbit == x[0]
+        assert sites == x[1]
+        assert canonical == x[2]
+        assert occ_init == [background.occ(s) for s in sites]
+        assert occ_final == [_config.occ(s) for s in sites]
@@ -830,3 +830,95 @@ def test_ConfigEnumMeshGrid_by_irreducible_wedge_FCC_disp_2():
     assert total == 34992  # 3**6 * len(symmetry_report.irreducible_wedge)
     assert len(configs_as_enumerated) == 19575
     assert len(canonical_configs) == 11413
+
+
+def test_meshgrid_points_skip_equivalents_FCC():
+    """Test meshgrid_points and irreducible_wedge_points with skip_equivalents
+
+    Compares against checking each point against the canonical form of all
+    previous points
+    """
+    from libcasm.configuration._misc import (
+        equivalent_order_parameters_index,
+        make_canonical_order_parameters,
+    )
+
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B"],
+        global_dof=[xtal.DoFSetBasis("Hstrain")],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+    dof_space = casmclex.DoFSpace(
+        dof_key="Hstrain",
+        xtal_prim=xtal_prim,
+    )
+    supercell = casmconfig.Supercell(prim, np.eye(3, dtype="int64"))
+    background = casmconfig.Configuration(supercell)
+    fg = casmconfig.make_invariant_subgroup(background)
+    dof_space_rep = casmconfig.make_dof_space_rep(group=fg, dof_space=dof_space)
+
+    def _reference(points):
+        canonical_eta_list = []
+        for eta in points:
+            if (
+                equivalent_order_parameters_index(
+                    canonical_eta_list=canonical_eta_list,
+                    eta=eta,
+                    dof_space_rep=dof_space_rep,
+                )
+                is None
+            ):
+                canonical_eta_list.append(
+                    make_canonical_order_parameters(
+                        eta=eta, dof_space_rep=dof_space_rep
+                    )
+                )
+        return canonical_eta_list
+
+    xi = [np.linspace(-0.1, 0.1, num=3)] * 6
+    all_points = list(
+        casmenum.meshgrid_points(background=background, dof_space=dof_space, xi=xi)
+    )
+    assert len(all_points) == 3**6
+    assert np.allclose(all_points[1], [0.0, -0.1, -0.1, -0.1, -0.1, -0.1])
+
+    distinct_points = list(
+        casmenum.meshgrid_points(
+            background=background,
+            dof_space=dof_space,
+            xi=xi,
+            skip_equivalents=True,
+            batch_size=7,
+        )
+    )
+    assert len(distinct_points) == len(_reference(all_points))
+
+    dof_space_analysis_results = casmconfig.dof_space_analysis(
+        dof_space=dof_space,
+        prim=prim,
+        calc_wedges=True,
+    )
+    irreducible_wedge = dof_space_analysis_results.symmetry_report.irreducible_wedge
+    wedge_points = [
+        eta
+        for _, eta in casmenum.irreducible_wedge_points(
+            background=background,
+            dof_space=dof_space,
+            irreducible_wedge=irreducible_wedge,
+            stop=0.1,
+            num=3,
+        )
+    ]
+    distinct_wedge_points = [
+        eta
+        for _, eta in casmenum.irreducible_wedge_points(
+            background=background,
+            dof_space=dof_space,
+            irreducible_wedge=irreducible_wedge,
+            stop=0.1,
+            num=3,
+            skip_equivalents=True,
+        )
+    ]
+    assert len(distinct_wedge_points) == len(_reference(wedge_points))
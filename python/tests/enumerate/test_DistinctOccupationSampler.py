@@ -0,0 +1,43 @@
+import numpy as np
+
+import libcasm.configuration as casmconfig
+import libcasm.enumerate as casmenum
+import libcasm.xtal.prims as xtal_prims
+
+
+def test_DistinctOccupationSampler_FCC_conventional():
+    xtal_prim = xtal_prims.FCC(r=0.5, occ_dof=["A", "B"])
+    prim = casmconfig.Prim(xtal_prim)
+    T = np.array([[-1, 1, 1], [1, -1, 1], [1, 1, -1]], dtype=int)
+    supercell = casmconfig.Supercell(prim, T)
+
+    # 5 orbits, of sizes 1, 4, 6, 4, 1, are equally likely
+    sampler = casmenum.DistinctOccupationSampler(supercell)
+    samples = sampler.sample(2000, seed=1, n_threads=2)
+    assert len(samples) == 2000
+    frequency = {}
+    for configuration in samples:
+        assert casmconfig.is_canonical_configuration(configuration)
+        key = tuple(configuration.occupation)
+        frequency[key] = frequency.get(key, 0) + 1
+    assert len(frequency) == 5
+    for count in frequency.values():
+        assert 300 < count < 500
+
+    # reproducible, for any number of threads
+    occupations = [tuple(x.occupation) for x in sampler.sample(10, seed=3)]
+    assert occupations == [
+        tuple(x.occupation) for x in sampler.sample(10, seed=3, n_threads=4)
+    ]
+
+
+def test_DistinctOccupationSampler_fixed_counts():
+    xtal_prim = xtal_prims.FCC(r=0.5, occ_dof=["A", "B"])
+    prim = casmconfig.Prim(xtal_prim)
+    supercell = casmconfig.Supercell(prim, np.eye(3, dtype=int) * 4)
+
+    sampler = casmenum.DistinctOccupationSampler(
+        supercell, occupant_counts=[[40, 24]]
+    )
+    for configuration in sampler.sample(5, seed=0):
+        assert np.count_nonzero(configuration.occupation) == 24
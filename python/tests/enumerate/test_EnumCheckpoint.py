@@ -0,0 +1,96 @@
+import numpy as np
+
+import libcasm.configuration as casmconfig
+import libcasm.enumerate as casmenum
+import libcasm.xtal.prims as xtal_prims
+
+
+def _make_prim():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B"],
+    )
+    return casmconfig.Prim(xtal_prim)
+
+
+def test_EnumCheckpoint_resume(tmp_path):
+    prim = _make_prim()
+    config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+    expected = [config.copy() for config in config_enum.by_supercell(max=4)]
+    assert len(expected) == 29
+
+    path = tmp_path / "checkpoint.json"
+
+    # interrupted run: the last checkpoint is saved after 10 configurations
+    supercell_set = casmconfig.SupercellSet(prim=prim)
+    checkpoint = casmenum.EnumCheckpoint(
+        path=path,
+        every_n=5,
+        supercell_set=supercell_set,
+    )
+    configuration_set = checkpoint.configuration_set
+    config_enum = casmenum.ConfigEnumAllOccupations(
+        prim=prim,
+        supercell_set=supercell_set,
+    )
+    for i, config in enumerate(config_enum.by_supercell(max=4, checkpoint=checkpoint)):
+        configuration_set.add(config)
+        if i == 11:
+            break
+    assert path.exists()
+
+    # resumed run, in a new "process"
+    prim = _make_prim()
+    supercell_set = casmconfig.SupercellSet(prim=prim)
+    checkpoint = casmenum.EnumCheckpoint(
+        path=path,
+        every_n=5,
+        supercell_set=supercell_set,
+    )
+    assert checkpoint.is_resuming
+    assert checkpoint.n_yielded == 10
+    configuration_set = checkpoint.configuration_set
+    assert len(configuration_set) == 10
+    config_enum = casmenum.ConfigEnumAllOccupations(
+        prim=prim,
+        supercell_set=supercell_set,
+    )
+    resumed = []
+    for config in config_enum.by_supercell(max=4, checkpoint=checkpoint):
+        resumed.append(config.copy())
+        configuration_set.add(config)
+    assert len(resumed) == 19
+    assert len(configuration_set) == 29
+    assert [x.to_dict() for x in resumed] == [x.to_dict() for x in expected[10:]]
+    assert checkpoint.is_complete
+
+    # a completed checkpoint yields nothing
+    checkpoint = casmenum.EnumCheckpoint(path=path)
+    assert checkpoint.is_complete
+    config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+    assert len(list(config_enum.by_supercell(max=4, checkpoint=checkpoint))) == 0
+
+
+def test_ConfigEnumAllOccupationsBase_counter_value():
+    prim = _make_prim()
+    T = np.array([[2, 0, 0], [0, 1, 0], [0, 0, 1]], dtype="int64")
+    supercell = casmconfig.Supercell(prim, T)
+    background = casmconfig.Configuration(supercell)
+    sites = set(range(supercell.n_sites))
+
+    config_enum = casmenum.ConfigEnumAllOccupationsBase(
+        background=background, sites=sites
+    )
+    values = []
+    while config_enum.is_valid():
+        values.append(list(config_enum.counter_value()))
+        config_enum.advance()
+    assert values == [[0, 0], [1, 0], [0, 1], [1, 1]]
+
+    config_enum = casmenum.ConfigEnumAllOccupationsBase(
+        background=background, sites=sites
+    )
+    config_enum.set_counter_value([1, 0])
+    assert list(config_enum.value().occupation) == [1, 0]
+    config_enum.advance()
+    assert list(config_enum.value().occupation) == [0, 1]
@@ -0,0 +1,103 @@
+import pytest
+
+import libcasm.configuration as casmconfig
+import libcasm.enumerate as casmenum
+import libcasm.xtal.prims as xtal_prims
+
+
+def _make_merged(prim, n_shards, prefix_length, n_threads=None):
+    configuration_sets = []
+    for shard_id in range(n_shards):
+        shard = casmenum.EnumShard(
+            shard_id=shard_id,
+            n_shards=n_shards,
+            prefix_length=prefix_length,
+        )
+        # round-trip through dict, as if run on a separate node
+        shard = casmenum.EnumShard.from_dict(shard.to_dict())
+        configuration_set = casmconfig.ConfigurationSet()
+        config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+        for configuration in config_enum.by_supercell(
+            max=4,
+            shard=shard,
+            n_threads=n_threads,
+        ):
+            configuration_set.add(configuration)
+        configuration_sets.append(configuration_set)
+    # merge in reverse order to check the result does not depend on order
+    return configuration_sets, casmenum.merge_configuration_sets(
+        reversed(configuration_sets)
+    )
+
+
+def _names(configuration_set):
+    return {
+        record.configuration_name: record.configuration
+        for record in configuration_set
+    }
+
+
+def test_EnumShard_FCC_binary():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+
+    config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+    unsharded = casmconfig.ConfigurationSet()
+    for configuration in config_enum.by_supercell(max=4):
+        unsharded.add(configuration)
+    assert len(unsharded) == 29
+    expected = _names(casmenum.merge_configuration_sets([unsharded]))
+
+    for prefix_length in [0, 2]:
+        configuration_sets, merged = _make_merged(
+            prim, n_shards=3, prefix_length=prefix_length
+        )
+        assert sum(len(x) for x in configuration_sets) == 29
+        assert _names(merged) == expected
+
+    # parallel enumeration is sharded by supercell
+    configuration_sets, merged = _make_merged(
+        prim, n_shards=3, prefix_length=2, n_threads=2
+    )
+    assert _names(merged) == expected
+
+
+def test_merge_configuration_sets_with_base():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+    config_enum = casmenum.ConfigEnumAllOccupations(prim=prim)
+
+    base = casmconfig.ConfigurationSet()
+    for configuration in config_enum.by_supercell(max=2):
+        base.add(configuration)
+    n_base = len(base)
+
+    configuration_sets, merged = _make_merged(prim, n_shards=2, prefix_length=0)
+    merged = casmenum.merge_configuration_sets(configuration_sets, base=base)
+    assert len(merged) == 29
+    base_names = _names(base)
+    merged_names = _names(merged)
+    for name, configuration in base_names.items():
+        assert merged_names[name] == configuration
+    assert len(merged_names) == 29
+    assert n_base < 29
+
+
+def test_EnumShard_invalid():
+    with pytest.raises(ValueError):
+        casmenum.EnumShard(shard_id=0, n_shards=0)
+    with pytest.raises(ValueError):
+        casmenum.EnumShard(shard_id=2, n_shards=2)
+    with pytest.raises(ValueError):
+        casmenum.EnumShard(shard_id=0, n_shards=2, prefix_length=-1)
+
+    shard = casmenum.EnumShard(shard_id=0, n_shards=4)
+    owners = [shard.owner("SCEL1_1_1_1_0_0_0", [i]) for i in range(16)]
+    assert owners == [shard.owner("SCEL1_1_1_1_0_0_0", [i]) for i in range(16)]
+    assert all(0 <= x < 4 for x in owners)
@@ -0,0 +1,126 @@
+import numpy as np
+
+import libcasm.configuration as casmconfig
+import libcasm.local_configuration as casmlocal
+
+
+def _make_local_configurations(prim, event_info, n, seed=0):
+    rng = np.random.default_rng(seed)
+    supercell = casmconfig.Supercell(
+        prim=prim,
+        transformation_matrix_to_super=np.eye(3, dtype="int") * 2,
+    )
+    n_equivalents = len(event_info.event_prim_info.events)
+    values = []
+    for _ in range(n):
+        config = casmconfig.Configuration(supercell)
+        # mostly A, so that equal local configurations occur often
+        for i in range(2):
+            config.set_occ(i, int(rng.integers(0, 2)))
+        pos = (
+            int(rng.integers(0, supercell.n_unitcells)),
+            int(rng.integers(0, n_equivalents)),
+        )
+        values.append(
+            casmlocal.LocalConfiguration(
+                configuration=config,
+                pos=pos,
+                event_info=event_info,
+            )
+        )
+    return values
+
+
+def test_LocalConfigurationList_index(fcc_1NN_A_Va_event_L12):
+    prim, event, event_info, config = fcc_1NN_A_Va_event_L12
+    values = _make_local_configurations(prim, event_info, 40)
+
+    local_config_list = casmlocal.LocalConfigurationList(event_info=event_info)
+    for value in values:
+        local_config_list.append(value)
+    expected = list(values)
+
+    def check():
+        assert len(local_config_list) == len(expected)
+        for value in values:
+            assert (value in local_config_list) == (value in expected)
+            if value in expected:
+                assert local_config_list.index(value) == expected.index(value)
+
+    check()
+    local_config_list[3] = values[0]
+    expected[3] = values[0]
+    local_config_list[-1] = values[1]
+    expected[-1] = values[1]
+    check()
+    del local_config_list[0]
+    del expected[0]
+    check()
+    local_config_list.sort()
+    expected.sort()
+    check()
+
+    unique_list = casmlocal.LocalConfigurationList(event_info=event_info)
+    unique_list.extend(values, unique=True)
+    unique_expected = []
+    for value in values:
+        if value not in unique_expected:
+            unique_expected.append(value)
+    assert len(unique_list) == len(unique_expected)
+
+
+def test_make_canonical_local_configurations(fcc_1NN_A_Va_event_L12):
+    prim, event, event_info, config = fcc_1NN_A_Va_event_L12
+    values = _make_local_configurations(prim, event_info, 20)
+
+    for in_canonical_pos in [True, False]:
+        for apply_event_occupation in [True, False]:
+            expected = [
+                casmlocal.make_canonical_local_configuration(
+                    x,
+                    in_canonical_pos=in_canonical_pos,
+                    apply_event_occupation=apply_event_occupation,
+                )
+                for x in values
+            ]
+            for n_threads in [1, 2]:
+                canonical = casmlocal.make_canonical_local_configurations(
+                    values,
+                    in_canonical_pos=in_canonical_pos,
+                    apply_event_occupation=apply_event_occupation,
+                    n_threads=n_threads,
+                )
+                assert canonical == expected
+
+    local_config_list = casmlocal.LocalConfigurationList(event_info=event_info)
+    local_config_list.extend(values, make_canonical=True, unique=True, n_threads=2)
+    distinct = []
+    for value in values:
+        x = casmlocal.make_canonical_local_configuration(value)
+        if x not in distinct:
+            distinct.append(x)
+    assert len(local_config_list) == len(distinct)
+    for x in distinct:
+        assert x in local_config_list
+
+
+def test_LocalConfigurationList_bytes(fcc_1NN_A_Va_event_L12):
+    prim, event, event_info, config = fcc_1NN_A_Va_event_L12
+    values = _make_local_configurations(prim, event_info, 20)
+    local_config_list = casmlocal.LocalConfigurationList(
+        event_info=event_info,
+        local_configurations=values,
+    )
+
+    supercells = casmconfig.SupercellSet(prim=prim)
+    data = local_config_list.to_bytes()
+    assert isinstance(data, bytes)
+    read_list = casmlocal.LocalConfigurationList.from_bytes(
+        data=data,
+        event_info=event_info,
+        supercells=supercells,
+    )
+    assert len(read_list) == len(local_config_list)
+    for a, b in zip(read_list, local_config_list):
+        assert a.pos == b.pos
+        assert a == b
@@ -0,0 +1,100 @@
+import numpy as np
+import pytest
+
+import libcasm.configuration as casmconfig
+import libcasm.enumerate as casmenum
+import libcasm.xtal.prims as xtal_prims
+
+
+def make_supercell():
+    xtal_prim = xtal_prims.FCC(
+        r=0.5,
+        occ_dof=["A", "B", "C"],
+    )
+    prim = casmconfig.Prim(xtal_prim)
+    return casmconfig.Supercell(
+        prim=prim,
+        transformation_matrix_to_super=np.eye(3, dtype="int64") * 2,
+    )
+
+
+def test_OccupationFilter_is_allowed():
+    supercell = make_supercell()
+    background = casmconfig.Configuration(supercell)
+    occ_filter = (
+        casmenum.OccupationFilter(supercell)
+        .require_occupant_count(
+            sublattice_index=0, occupant_index=1, min_count=1, max_count=2
+        )
+        .require_n_changed_sites(
+            background_occupation=background.occupation,
+            min_count=2,
+            max_count=3,
+        )
+        .require_allowed_occupants(sites={0}, allowed_occupants={0, 1})
+    )
+    assert occ_filter.supercell == supercell
+
+    config_enum = casmenum.ConfigEnumAllOccupationsBase(
+        background=background,
+        sites=set(range(supercell.n_sites)),
+    )
+    n_allowed = 0
+    while config_enum.is_valid():
+        occ = config_enum.value().occupation
+        n_B = np.count_nonzero(occ == 1)
+        n_changed = np.count_nonzero(occ != 0)
+        expected = 1 <= n_B <= 2 and 2 <= n_changed <= 3 and occ[0] != 2
+        assert occ_filter.is_allowed(occ) == expected
+        n_allowed += expected
+        config_enum.advance()
+    assert n_allowed > 0
+
+    with pytest.raises(Exception):
+        occ_filter.require_occupant_count(
+            sublattice_index=1, occupant_index=0, min_count=0, max_count=1
+        )
+
+
+def test_OccupationFilter_batches():
+    supercell = make_supercell()
+    background = casmconfig.Configuration(supercell)
+    sites = set(range(supercell.n_sites))
+    occ_filter = casmenum.OccupationFilter(supercell).require_occupant_count(
+        sublattice_index=0, occupant_index=2, min_count=0, max_count=1
+    )
+
+    expected = []
+    config_enum = casmenum.ConfigEnumAllOccupationsBase(
+        background=background, sites=sites
+    )
+    while config_enum.is_valid():
+        occ = config_enum.value().occupation
+        if np.count_nonzero(occ == 2) <= 1:
+            expected.append(occ.tolist())
+        config_enum.advance()
+
+    for dtype in [np.int8, np.int32]:
+        # filter while filling
+        config_enum = casmenum.ConfigEnumAllOccupationsBase(
+            background=background, sites=sites
+        )
+        batch = np.zeros((len(expected) + 1, supercell.n_sites), dtype=dtype)
+        n = config_enum.fill_occupation_batch(
+            batch=batch, occupation_filter=occ_filter
+        )
+        assert batch[:n].tolist() == expected
+
+        # filter after filling
+        config_enum = casmenum.ConfigEnumAllOccupationsBase(
+            background=background, sites=sites
+        )
+        rows = []
+        batch = np.zeros((100, supercell.n_sites), dtype=dtype)
+        while True:
+            n = config_enum.fill_occupation_batch(batch=batch)
+            n_allowed = occ_filter.compact(batch=batch, n_rows=n)
+            rows.extend(batch[:n_allowed].tolist())
+            if n < batch.shape[0]:
+                break
+        assert rows == expected
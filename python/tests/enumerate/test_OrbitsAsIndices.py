@@ -0,0 +1,52 @@
+import numpy as np
+
+import libcasm.clusterography as clust
+import libcasm.configuration as config
+import libcasm.enumerate as enum
+import libcasm.xtal.prims as xtal_prims
+
+
+def test_OrbitsAsIndices():
+    xtal_prim = xtal_prims.FCC(r=1.0, occ_dof=["A", "B"])
+    prim = config.Prim(xtal_prim)
+    cluster_specs = clust.make_periodic_cluster_specs(
+        xtal_prim=xtal_prim,
+        max_length=[0.0, 0.0, 2.01, 2.01],
+    )
+    orbits = cluster_specs.make_orbits()
+
+    T = np.array(
+        [
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ]
+    )
+    supercell = config.Supercell(prim, T * 2)
+    orbits_as_indices = enum.OrbitsAsIndices(supercell, orbits)
+    assert orbits_as_indices.n_orbits() == len(orbits)
+
+    orbit_offset = orbits_as_indices.orbit_offset
+    cluster_offset = orbits_as_indices.cluster_offset
+    sites = orbits_as_indices.sites
+    assert isinstance(sites, np.ndarray)
+    assert orbit_offset.shape == (len(orbits) + 1,)
+    assert cluster_offset.shape == (orbits_as_indices.n_clusters() + 1,)
+    assert cluster_offset[-1] == sites.shape[0]
+
+    # same clusters as nested lists
+    nested = orbits_as_indices.to_list()
+    assert len(nested) == len(orbits)
+    for i in range(len(nested)):
+        assert len(nested[i]) == orbit_offset[i + 1] - orbit_offset[i]
+        for j, cluster_sites in enumerate(nested[i]):
+            k = orbit_offset[i] + j
+            assert cluster_sites == list(
+                sites[cluster_offset[k] : cluster_offset[k + 1]]
+            )
+
+    # same distinct cluster sites as from orbits of Cluster
+    configuration = config.Configuration(supercell)
+    assert enum.make_distinct_cluster_sites(
+        configuration, orbits_as_indices
+    ) == enum.make_distinct_cluster_sites(configuration, orbits)
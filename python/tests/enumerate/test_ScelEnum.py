@@ -104,3 +104,28 @@ def test_ScelEnum_lowsym_1(lowsym_occ_prim):
         assert isinstance(supercell, casmconfig.Supercell)
 
     assert len(supercell_set) == 56
+
+
+def test_ScelEnum_make_all_by_volume(lowsym_occ_prim):
+    prim = casmconfig.Prim(lowsym_occ_prim)
+    scel_enum = casmenum.ScelEnum(prim=prim)
+    expected = [
+        supercell.transformation_matrix_to_super
+        for supercell in scel_enum.by_volume(max=4)
+    ]
+
+    supercell_set = casmconfig.SupercellSet(prim=prim)
+    scel_enum = casmenum.ScelEnum(prim=prim, supercell_set=supercell_set)
+    supercells = scel_enum.make_all_by_volume(max=4, n_threads=4)
+    assert len(supercells) == 56
+    assert len(supercell_set) == 56
+    for i, supercell in enumerate(supercells):
+        assert isinstance(supercell, casmconfig.Supercell)
+        assert np.array_equal(supercell.transformation_matrix_to_super, expected[i])
+
+    T_list = casmenum.enumerate_canonical_transformation_matrices(
+        prim=prim, max_volume=4, min_volume=2
+    )
+    assert len(T_list) == 55
+    for i, T in enumerate(T_list):
+        assert np.array_equal(T, expected[i + 1])
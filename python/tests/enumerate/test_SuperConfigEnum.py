@@ -0,0 +1,36 @@
+import numpy as np
+
+import libcasm.configuration as casmconfig
+import libcasm.enumerate as casmenum
+import libcasm.xtal.prims as xtal_prims
+
+
+def test_SuperConfigEnum_by_supercell_list_n_threads():
+    xtal_prim = xtal_prims.FCC(r=0.5, occ_dof=["A", "B"])
+    prim = casmconfig.Prim(xtal_prim)
+    motif_supercell = casmconfig.Supercell(
+        prim, np.array([[1, 0, 0], [0, 1, 0], [0, 0, 2]], dtype="int64")
+    )
+    motif = casmconfig.Configuration(motif_supercell)
+    motif.set_occupation([0, 1])
+    supercells = casmenum.enumerate_canonical_supercells(prim=prim, max_volume=8)
+
+    results = []
+    for n_threads in [1, 2]:
+        supercell_set = casmconfig.SupercellSet(prim=prim)
+        super_config_enum = casmenum.SuperConfigEnum(
+            prim=prim,
+            supercell_set=supercell_set,
+        )
+        found = list(
+            super_config_enum.by_supercell_list(
+                motif=motif,
+                supercells=supercells,
+                n_threads=n_threads,
+            )
+        )
+        for configuration in found:
+            assert configuration.supercell in supercell_set
+        results.append(found)
+    assert len(results[0]) > 1
+    assert results[0] == results[1]
@@ -0,0 +1,81 @@
+import numpy as np
+
+import libcasm.clusterography as clust
+import libcasm.configuration as config
+import libcasm.enumerate as enum
+import libcasm.xtal.prims as xtal_prims
+
+
+def test_make_flower_impact_table():
+    xtal_prim = xtal_prims.FCC(r=1.0, occ_dof=["A", "B"])
+    prim = config.Prim(xtal_prim)
+    cluster_specs = clust.make_periodic_cluster_specs(
+        xtal_prim=xtal_prim,
+        max_length=[0.0, 0.0, 2.01, 2.01],
+    )
+    orbits = cluster_specs.make_orbits()
+
+    T = np.array(
+        [
+            [4, 0, 0],
+            [0, 4, 0],
+            [0, 0, 4],
+        ],
+        dtype="int64",
+    )
+    supercell = config.Supercell(prim, T)
+    table = enum.make_flower_impact_table(supercell, orbits)
+    assert isinstance(table, enum.SupercellImpactTable)
+    n_sites = supercell.n_sites()
+    assert table.n_rows() == n_sites
+
+    row_offset = table.row_offset
+    sites = table.sites
+    assert isinstance(sites, np.ndarray)
+    assert row_offset.shape == (n_sites + 1,)
+    assert row_offset[-1] == sites.shape[0]
+
+    for l in range(n_sites):
+        row = table.row(l)
+        # 1 point + 12 1NN + 6 2NN = 19
+        assert row.shape == (19,)
+        assert l in row
+        assert list(row) == sorted(set(row))
+        assert list(row) == list(sites[row_offset[l] : row_offset[l + 1]])
+        # impact is symmetric
+        for j in row:
+            assert l in table.row(j)
+
+
+def test_make_local_impact_table():
+    xtal_prim = xtal_prims.FCC(r=1.0, occ_dof=["A", "B"])
+    prim = config.Prim(xtal_prim)
+    phenomenal = clust.Cluster.from_list(
+        [
+            [0, 0, 0, 0],
+            [0, 1, 0, 0],
+        ]
+    )
+    cluster_specs = clust.make_local_cluster_specs(
+        xtal_prim=xtal_prim,
+        phenomenal_cluster=phenomenal,
+        max_length=[0.0, 0.0, 2.01],
+        cutoff_radius=[0.0, 2.01, 2.01],
+    )
+    local_orbits = cluster_specs.make_orbits()
+
+    T = np.array(
+        [
+            [4, 0, 0],
+            [0, 4, 0],
+            [0, 0, 4],
+        ],
+        dtype="int64",
+    )
+    supercell = config.Supercell(prim, T)
+    table = enum.make_local_impact_table(supercell, local_orbits)
+    assert table.n_rows() == supercell.n_unitcells()
+
+    sizes = np.diff(table.row_offset)
+    assert np.all(sizes == sizes[0])
+    assert sizes[0] > 0
@@ -0,0 +1,36 @@
+import numpy as np
+
+import libcasm.configuration as casmconfig
+import libcasm.enumerate as casmenum
+import libcasm.xtal.prims as xtal_prims
+
+
+def test_count_distinct_occupations_FCC_conventional():
+    xtal_prim = xtal_prims.FCC(r=0.5, occ_dof=["A", "B"])
+    prim = casmconfig.Prim(xtal_prim)
+    T = np.array([[-1, 1, 1], [1, -1, 1], [1, 1, -1]], dtype=int)
+    supercell = casmconfig.Supercell(prim, T)
+
+    counts = casmenum.count_distinct_occupations(supercell, by_composition=True)
+    assert counts["total"] == 5
+    assert counts["n_sites"] == [4]
+    assert counts["n_occupants"] == [2]
+    assert counts["by_composition"] == {
+        (4, 0): 1,
+        (3, 1): 1,
+        (2, 2): 1,
+        (1, 3): 1,
+        (0, 4): 1,
+    }
+
+
+def test_count_distinct_occupations_large():
+    xtal_prim = xtal_prims.FCC(r=0.5, occ_dof=["A", "B"])
+    prim = casmconfig.Prim(xtal_prim)
+    supercell = casmconfig.Supercell(prim, np.eye(3, dtype=int) * 6)
+
+    counts = casmenum.count_distinct_occupations(supercell, n_threads=2)
+    assert "by_composition" not in counts
+    assert counts["group_order"] == 48 * 216
+    assert counts["total"] > 2**200
+    assert counts["total"] < 2**216
@@ -117,3 +117,11 @@ def test_make_all_distinct_local_perturbations(fcc_1NN_A_Va_event):
         print()
 
     assert len(configurations) == 9
+
+    # results do not depend on the number of threads
+    parallel_configurations = enum.make_all_distinct_local_perturbations(
+        supercell, phenomenal_occ_event, motif, local_clusters, n_threads=4
+    )
+    assert [c.occupation.tolist() for c in parallel_configurations] == [
+        c.occupation.tolist() for c in configurations
+    ]
@@ -0,0 +1,58 @@
+import numpy as np
+
+import libcasm.clusterography as clust
+import libcasm.configuration as config
+import libcasm.enumerate as enum
+import libcasm.xtal.prims as xtal_prims
+
+
+def test_make_local_orbits_index_table():
+    xtal_prim = xtal_prims.FCC(r=1.0, occ_dof=["A", "B"])
+    prim = config.Prim(xtal_prim)
+    prototype = clust.Cluster.from_list([[0, 0, 0, 0], [0, 1, 0, 0]])
+    local_orbits = [
+        [
+            clust.Cluster.from_list([[0, 0, 1, 0]]),
+            clust.Cluster.from_list([[0, 0, 0, 1]]),
+        ],
+        [
+            clust.Cluster.from_list([[0, 0, 1, 0], [0, 0, 0, 1]]),
+        ],
+    ]
+    trans = np.array([1, 0, 0], dtype="int")
+    phenomenal_clusters = [prototype, prototype + trans]
+
+    supercell = config.Supercell(prim, np.eye(3, dtype="int64") * 3)
+    sites, orbit_offset, cluster_offset = enum.make_local_orbits_index_table(
+        prototype=prototype,
+        local_orbits=local_orbits,
+        phenomenal_clusters=phenomenal_clusters,
+        equivalent_generating_op_indices=[0, 0],
+        supercell=supercell,
+        n_threads=2,
+    )
+    assert sites.dtype == np.int32
+    assert sites.shape == (2, 27, 4)
+    assert list(orbit_offset) == [0, 2, 3]
+    assert list(cluster_offset) == [0, 1, 2, 4]
+
+    f_unitcell = supercell.unitcell_index_converter
+    f_site = supercell.site_index_converter
+    clusters = [cluster for orbit in local_orbits for cluster in orbit]
+    for e in range(2):
+        for k in range(3):
+            for j in range(3):
+                for i in range(3):
+                    unitcell = np.array([i, j, k], dtype="int")
+                    l = f_unitcell.linear_unitcell_index(unitcell)
+                    expected = []
+                    for cluster in clusters:
+                        for site in cluster + (unitcell + e * trans):
+                            expected.append(f_site.linear_site_index(site))
+                    assert list(sites[e, l]) == expected
+
+    # the result does not depend on the number of threads
+    sites_1, _, _ = enum.make_local_orbits_index_table(
+        prototype, local_orbits, phenomenal_clusters, [0, 0], supercell
+    )
+    assert np.array_equal(sites, sites_1)
@@ -0,0 +1,44 @@
+import numpy as np
+
+import libcasm.configuration as config
+import libcasm.enumerate as enum
+import libcasm.occ_events as occ_events
+import libcasm.xtal as xtal
+
+
+def test_make_occevent_site_index_table(fcc_1NN_A_Va_event):
+    xtal_prim, occ_event = fcc_1NN_A_Va_event
+    prim = config.Prim(xtal_prim)
+    fg = xtal.make_factor_group(xtal_prim)
+    occevent_symgroup_rep = occ_events.make_occevent_symgroup_rep(fg, xtal_prim)
+    orbit = occ_events.make_prim_periodic_orbit(occ_event, occevent_symgroup_rep)
+    assert len(orbit) == 6
+
+    supercell = config.Supercell(prim, np.eye(3, dtype="int64") * 3)
+    sites, occ_init, occ_final = enum.make_occevent_site_index_table(
+        phenomenal_occevent=orbit,
+        supercell=supercell,
+        n_threads=2,
+    )
+    assert sites.dtype == np.int32
+    assert sites.shape == (6, 27, 2)
+    assert occ_init.shape == (6, 2)
+    assert occ_final.shape == (6, 2)
+
+    f_unitcell = supercell.unitcell_index_converter
+    f_site = supercell.site_index_converter
+    for e, equiv in enumerate(orbit):
+        assert list(occ_init[e]) == equiv.initial_occupation()
+        assert list(occ_final[e]) == equiv.final_occupation()
+        for k in range(3):
+            for j in range(3):
+                for i in range(3):
+                    trans = np.array([i, j, k], dtype="int")
+                    l = f_unitcell.linear_unitcell_index(trans)
+                    cluster = (equiv + trans).cluster()
+                    expected = [f_site.linear_site_index(site) for site in cluster]
+                    assert list(sites[e, l]) == expected
+
+    # the result does not depend on the number of threads
+    sites_1, _, _ = enum.make_occevent_site_index_table(orbit, supercell)
+    assert np.array_equal(sites, sites_1)
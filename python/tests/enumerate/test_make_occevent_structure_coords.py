@@ -0,0 +1,41 @@
+import numpy as np
+
+import libcasm.configuration as config
+import libcasm.enumerate as enum
+import libcasm.occ_events as occ_events
+
+
+def test_make_occevent_structure_coords(fcc_1NN_A_Va_event):
+    xtal_prim, phenomenal_occ_event = fcc_1NN_A_Va_event
+    prim = config.Prim(xtal_prim)
+    system = occ_events.OccSystem(xtal_prim)
+
+    # conventional 4-site FCC, 2x2x2, with one B
+    T = np.array(
+        [
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ],
+        dtype="int64",
+    )
+    supercell = config.Supercell(prim, T * 2)
+    configuration = config.Configuration(supercell)
+    configuration.set_occ(10, 1)
+
+    factors = [0.0, 0.25, 0.5, 0.75, 1.0]
+    events = [phenomenal_occ_event, phenomenal_occ_event.copy_reverse()]
+    results = enum.make_occevent_structure_coords(
+        configuration, events, factors, system
+    )
+    assert len(results) == len(events)
+
+    for occ_event, (L, atom_type, coords) in zip(events, results):
+        structures = enum.make_occevent_simple_structures(
+            configuration, occ_event, factors, system, False
+        )
+        assert coords.shape == (len(factors), 3, len(atom_type))
+        for k, structure in enumerate(structures):
+            assert np.allclose(L, structure.lattice().column_vector_matrix())
+            assert atom_type == structure.atom_type()
+            assert np.allclose(coords[k], structure.atom_coordinate_cart())
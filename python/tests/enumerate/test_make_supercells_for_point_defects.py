@@ -4,6 +4,7 @@ import libcasm.configuration as casmconfig
 import libcasm.enumerate as casmenum
 import libcasm.local_configuration as casmlocal
 import libcasm.occ_events as occ_events
+import libcasm.xtal.prims as xtal_prims
 
 
 def expected_neb_supercells():
@@ -213,3 +214,82 @@ def test_make_supercells_for_point_defects_1(fcc_1NN_A_Va_event):
         print(f"supercell: {value}")
         print()
     assert neb_supercells == expected_neb_supercells()
+
+
+def test_point_defect_superlattice_scores():
+    xtal_prim = xtal_prims.FCC(r=0.5, occ_dof=["A", "B"])
+    prim = casmconfig.Prim(xtal_prim)
+    T = casmenum.enumerate_canonical_transformation_matrices(prim=prim, max_volume=8)
+    scores = casmenum.make_point_defect_superlattice_scores(
+        prim=prim,
+        transformation_matrices=T,
+        n_threads=2,
+    )
+    assert len(scores) == len(T)
+    for score in scores:
+        supercell = casmconfig.Supercell(prim, score.transformation_matrix_to_super)
+        assert score.n_unitcells == supercell.n_unitcells
+        assert score.factor_group_size == len(supercell.factor_group.elements)
+        assert math.isclose(
+            score.voronoi_inner_radius,
+            supercell.superlattice.voronoi_inner_radius(),
+        )
+
+    pareto = casmenum.make_point_defect_pareto_indices(
+        n_unitcells=[x.n_unitcells for x in scores],
+        voronoi_inner_radius=[x.voronoi_inner_radius for x in scores],
+        is_candidate=[True] * len(scores),
+    )
+    found = casmenum.find_pareto_point_defect_superlattices(
+        prim=prim,
+        transformation_matrices=T,
+    )
+    assert len(pareto) > 1
+    assert [scores[i].n_unitcells for i in pareto] == [x.n_unitcells for x in found]
+    for i, x in zip(pareto, found):
+        assert (
+            scores[i].transformation_matrix_to_super
+            == x.transformation_matrix_to_super
+        ).all()
+
+
+def test_superlattice_required_operations_and_sites():
+    import numpy as np
+
+    import libcasm.xtal as xtal
+
+    prim = casmconfig.Prim(xtal_prims.FCC(r=1.0, occ_dof=["A", "B"]))
+    T = np.array([[2, 0, 0], [0, 1, 0], [0, 0, 1]], dtype="int")
+    supercell = casmconfig.Supercell(prim, T)
+
+    site1 = xtal.IntegralSiteCoordinate(sublattice=0, unitcell=[0, 0, 0])
+    site2 = xtal.IntegralSiteCoordinate(sublattice=0, unitcell=[1, 0, 0])
+    site3 = xtal.IntegralSiteCoordinate(sublattice=0, unitcell=[2, 0, 0])
+    assert casmenum.superlattice_has_required_sites(prim, T, [[site1, site2]])
+    assert not casmenum.superlattice_has_required_sites(prim, T, [[site1, site3]])
+    assert casmenum.has_required_sites([[site1, site2]], supercell)
+
+    ops = casmconfig.make_superlattice_invariant_factor_group_indices(
+        prim=prim,
+        transformation_matrix_to_super=T,
+    )
+    assert casmenum.superlattice_has_required_operations(prim, T, ops)
+    n_prim_ops = len(prim.factor_group.elements)
+    assert len(ops) < n_prim_ops
+    assert not casmenum.superlattice_has_required_operations(
+        prim, T, list(range(n_prim_ops))
+    )
+
+    matching = casmenum.make_equivalent_supercells_with_required_operations(
+        supercell=supercell,
+        required_operations=ops,
+        n_threads=2,
+    )
+    assert len(matching) >= 1
+    for x in matching:
+        assert set(ops).issubset(
+            casmconfig.make_superlattice_invariant_factor_group_indices(
+                prim=prim,
+                transformation_matrix_to_super=x.transformation_matrix_to_super,
+            )
+        )
@@ -86,3 +86,93 @@ def test_dof_space_analysis_2_generic(FCC_binary_prim):
     assert isinstance(data, dict)
 
     # print(xtal.pretty_json(data))
+
+
+def test_irrep_decomposition_n_threads(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    T = np.array(
+        [  # conventional FCC cubic cell
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ],
+        dtype=int,
+    )
+    supercell = casmconfig.Supercell(prim, T)
+    configuration = casmconfig.Configuration(
+        supercell=supercell,
+    )
+    supercell_factor_group = casmconfig.make_invariant_subgroup(
+        configuration=configuration,
+    )
+
+    dof_space = casmclex.DoFSpace(
+        dof_key="occ",
+        xtal_prim=FCC_binary_prim,
+        transformation_matrix_to_super=T,
+    )
+    matrix_rep = casmconfig.make_dof_space_rep(
+        group=supercell_factor_group,
+        dof_space=dof_space,
+    )
+
+    expected = casmirreps.IrrepDecomposition(matrix_rep=matrix_rep)
+    assert expected.symmetry_adapted_subspace.shape == (8, 8)
+    for n_threads in [2, 4, 0]:
+        irrep_decomposition = casmirreps.IrrepDecomposition(
+            matrix_rep=matrix_rep,
+            n_threads=n_threads,
+        )
+        assert len(irrep_decomposition.irreps) == len(expected.irreps)
+        assert np.allclose(
+            irrep_decomposition.symmetry_adapted_subspace,
+            expected.symmetry_adapted_subspace,
+        )
+
+    report = expected.make_symmetry_report(calc_wedges=True)
+    assert report.axis_glossary == ["x" + str(i + 1) for i in range(8)]
+    for n_threads in [2, 0]:
+        threaded_report = expected.make_symmetry_report(
+            calc_wedges=True,
+            n_threads=n_threads,
+        )
+        assert threaded_report.to_dict() == report.to_dict()
+
+
+def _cubic_point_group_rep():
+    # signed permutation matrices, the vector representation of O_h
+    import itertools
+
+    rep = []
+    for perm in itertools.permutations(range(3)):
+        for signs in itertools.product([1.0, -1.0], repeat=3):
+            M = np.zeros((3, 3))
+            for i, j in enumerate(perm):
+                M[i, j] = signs[i]
+            rep.append(M)
+    return rep
+
+
+def test_irrep_decomposition_irreducible():
+    # irreducible: found by the character pre-pass
+    rep = _cubic_point_group_rep()
+    irrep_decomposition = casmirreps.IrrepDecomposition(matrix_rep=rep)
+    assert len(irrep_decomposition.irreps) == 1
+    assert irrep_decomposition.symmetry_adapted_subspace.shape == (3, 3)
+
+    # reducible: the last irrep is the kernel of those already found
+    block_rep = []
+    for M in rep:
+        B = np.zeros((4, 4))
+        B[0, 0] = np.linalg.det(M)
+        B[1:, 1:] = M
+        block_rep.append(B)
+    for allow_complex in [True, False]:
+        irrep_decomposition = casmirreps.IrrepDecomposition(
+            matrix_rep=block_rep,
+            allow_complex=allow_complex,
+        )
+        assert len(irrep_decomposition.irreps) == 2
+        S = irrep_decomposition.symmetry_adapted_subspace
+        assert S.shape == (4, 4)
+        assert np.allclose(S.conj().T @ S, np.eye(4))
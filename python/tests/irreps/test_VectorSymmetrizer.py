@@ -0,0 +1,78 @@
+import numpy as np
+
+import libcasm.clexulator as casmclex
+import libcasm.configuration as casmconfig
+import libcasm.irreps as casmirreps
+
+
+def _conventional_FCC_occ_matrix_rep(FCC_binary_prim):
+    prim = casmconfig.Prim(FCC_binary_prim)
+    T = np.array(
+        [  # conventional FCC cubic cell
+            [-1, 1, 1],
+            [1, -1, 1],
+            [1, 1, -1],
+        ],
+        dtype=int,
+    )
+    supercell = casmconfig.Supercell(prim, T)
+    configuration = casmconfig.Configuration(supercell=supercell)
+    supercell_factor_group = casmconfig.make_invariant_subgroup(
+        configuration=configuration,
+    )
+    dof_space = casmclex.DoFSpace(
+        dof_key="occ",
+        xtal_prim=FCC_binary_prim,
+        transformation_matrix_to_super=T,
+    )
+    return casmconfig.make_dof_space_rep(
+        group=supercell_factor_group,
+        dof_space=dof_space,
+    )
+
+
+def test_group_average_symmetrizer(FCC_binary_prim):
+    matrix_rep = _conventional_FCC_occ_matrix_rep(FCC_binary_prim)
+    symmetrizer = casmirreps.make_group_average_symmetrizer(
+        matrix_rep=matrix_rep,
+        head_group=set(range(len(matrix_rep))),
+    )
+    assert isinstance(symmetrizer, casmirreps.VectorSymmetrizer)
+    assert symmetrizer.dim() == 8
+    R = symmetrizer.matrix
+    assert np.allclose(R @ R, R)
+
+    rng = np.random.default_rng(0)
+    vectors = rng.random((8, 20))
+    expected = sum(M @ vectors for M in matrix_rep) / len(matrix_rep)
+    assert np.allclose(symmetrizer(vectors), expected)
+
+    in_place = np.asfortranarray(vectors.copy())
+    symmetrizer.apply_in_place(in_place)
+    assert np.allclose(in_place, expected)
+
+
+def test_irrep_projector(FCC_binary_prim):
+    matrix_rep = _conventional_FCC_occ_matrix_rep(FCC_binary_prim)
+    irrep_decomposition = casmirreps.IrrepDecomposition(matrix_rep=matrix_rep)
+    irreps = irrep_decomposition.irreps
+    assert len(irreps) > 1
+
+    rng = np.random.default_rng(0)
+    vectors = rng.random((8, 20))
+
+    total = np.zeros((8, 8))
+    projected = np.zeros((8, 20))
+    for irrep in irreps:
+        projector = casmirreps.make_irrep_projector(irreps=[irrep])
+        P = projector.matrix
+        assert np.allclose(P @ P, P)
+        assert np.allclose(P, P.T)
+        assert np.isclose(np.trace(P), irrep.irrep_dim)
+        total += P
+        projected += projector(vectors)
+    assert np.allclose(total, np.eye(8))
+    assert np.allclose(projected, vectors)
+
+    full = casmirreps.make_irrep_projector(irreps=irreps)
+    assert np.allclose(full.matrix, np.eye(8))
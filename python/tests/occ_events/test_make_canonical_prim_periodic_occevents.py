@@ -1,6 +1,8 @@
 import math
 import sys
 
+import numpy as np
+
 import libcasm.clusterography as clust
 import libcasm.occ_events as occ_events
 import libcasm.sym_info as sym_info
@@ -74,3 +76,44 @@ def test_make_canonical_prim_periodic_occevents():
         print()
 
     assert len(canonical_occevents) == 24
+
+
+def test_make_canonical_prim_periodic_occevents_trajectory_constraints():
+    r = 1.0  # ideal atom radius
+    a = math.sqrt(((4 * r) ** 2) / 2.0)  # conventional FCC lattice parameter
+    tol = 1e-5
+    xtal_prim = xtal_prims.FCC(r=r, occ_dof=["A", "B", "Va"])
+    system = occ_events.OccSystem(xtal_prim)
+    cluster_specs = clust.ClusterSpecs(
+        xtal_prim=xtal_prim,
+        generating_group=sym_info.make_factor_group(xtal_prim),
+        max_length=[0.0, 0.0, a + tol, a + tol],
+    )
+
+    base_params = {"max_cluster_size": 3}
+    all_occevents = occ_events.make_canonical_prim_periodic_occevents(
+        system, cluster_specs, base_params, []
+    )
+    assert len(all_occevents) == 24
+
+    # only nearest neighbor hops into vacancies
+    nn_distance = 2.0 * r
+    params = {
+        "max_cluster_size": 3,
+        "max_trajectory_length": nn_distance + tol,
+        "allowed_species_pairs": [["A", "Va"], ["B", "Va"]],
+    }
+    occevents = occ_events.make_canonical_prim_periodic_occevents(
+        system, cluster_specs, params, []
+    )
+    assert 0 < len(occevents) < len(all_occevents)
+    for occevent in occevents:
+        has_vacancy = False
+        for before, after in occevent.trajectories():
+            if system.is_vacancy(before):
+                has_vacancy = True
+                continue
+            x_before = system.get_cartesian_coordinate(before)
+            x_after = system.get_cartesian_coordinate(after)
+            assert np.linalg.norm(x_after - x_before) < nn_distance + tol
+        assert has_vacancy
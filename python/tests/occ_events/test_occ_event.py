@@ -1,3 +1,5 @@
+import pytest
+
 import libcasm.occ_events as occ_events
 import libcasm.xtal as xtal
 import libcasm.xtal.prims as xtal_prims
@@ -260,3 +262,40 @@ def test_OccEvent_repr(fcc_1NN_A_Va_event):
                 print(pos)
             out = f.getvalue()
             assert "coordinate" in out
+
+
+def test_OccEvent_pickle(fcc_1NN_A_Va_event):
+    import pickle
+
+    prim, occ_event = fcc_1NN_A_Va_event
+    unpickled = pickle.loads(pickle.dumps(occ_event))
+    assert unpickled == occ_event
+    assert unpickled.initial_occupation() == occ_event.initial_occupation()
+    assert unpickled.final_occupation() == occ_event.final_occupation()
+
+    empty = pickle.loads(pickle.dumps(occ_events.OccEvent()))
+    assert empty.size() == 0
+
+
+def test_occevent_orbits_to_from_bytes(fcc_1NN_A_Va_event):
+    xtal_prim, occ_event = fcc_1NN_A_Va_event
+    system = occ_events.OccSystem(xtal_prim)
+    fg = xtal.make_factor_group(xtal_prim)
+    occevent_symgroup_rep = occ_events.make_occevent_symgroup_rep(fg, xtal_prim)
+    orbit = occ_events.make_prim_periodic_orbit(occ_event, occevent_symgroup_rep)
+
+    data = occ_events.occevents_to_bytes([occ_event], system)
+    assert isinstance(data, bytes)
+    events_in = occ_events.occevents_from_bytes(data, system)
+    assert len(events_in) == 1
+    assert events_in[0] == occ_event
+
+    data = occ_events.occevent_orbits_to_bytes([orbit, orbit[:1]], system)
+    orbits_in = occ_events.occevent_orbits_from_bytes(data, system)
+    assert len(orbits_in) == 2
+    assert orbits_in[0] == orbit
+    assert orbits_in[1] == orbit[:1]
+
+    other_prim = xtal_prims.FCC(r=1.0, occ_dof=["A", "B"])
+    with pytest.raises(Exception):
+        occ_events.occevents_from_bytes(data, occ_events.OccSystem(other_prim))
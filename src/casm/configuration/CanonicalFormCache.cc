@@ -0,0 +1,173 @@
+#include "casm/configuration/CanonicalFormCache.hh"
+
+#include <set>
+#include <stdexcept>
+
+#include "casm/configuration/ConfigurationHashSet.hh"
+#include "casm/configuration/Supercell.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param _supercell The supercell. Results are found using all of its
+///     symmetry operations.
+/// \param _max_size Maximum number of entries. If reached, all entries are
+///     erased before a new entry is added.
+CanonicalFormCache::CanonicalFormCache(
+    std::shared_ptr<Supercell const> const &_supercell, Index _max_size)
+    : m_supercell(throw_if_equal_to_nullptr(
+          _supercell, "Error in CanonicalFormCache: supercell is empty")),
+      m_ops(SupercellSymOp::begin(m_supercell),
+            SupercellSymOp::end(m_supercell)),
+      m_max_size(_max_size),
+      m_n_passes(0) {
+  if (m_max_size < 1) {
+    throw std::runtime_error(
+        "Error in CanonicalFormCache: max_size must be >= 1");
+  }
+}
+
+/// \brief The supercell
+std::shared_ptr<Supercell const> const &CanonicalFormCache::supercell() const {
+  return m_supercell;
+}
+
+/// \brief The supercell symmetry operations
+///
+/// Indices in CanonicalFormInfo are indices into this vector.
+std::vector<SupercellSymOp> const &CanonicalFormCache::ops() const {
+  return m_ops;
+}
+
+/// \brief Return the canonical form results for a configuration, finding
+///     and storing them if necessary
+///
+/// \param configuration A configuration in `supercell()`
+///
+/// Thread safe. If two threads query the same new configuration at once,
+/// both may make the pass, and one result is stored.
+CanonicalFormInfo CanonicalFormCache::get(Configuration const &configuration) {
+  if (configuration.supercell != m_supercell &&
+      *configuration.supercell != *m_supercell) {
+    throw std::runtime_error(
+        "Error in CanonicalFormCache::get: supercell mismatch");
+  }
+  std::size_t hash = ConfigurationHash()(configuration);
+  auto _find = [&]() -> Entry const * {
+    auto range = m_index.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      Entry const &entry = m_entries[it->second];
+      if (entry.configuration == configuration) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (Entry const *entry = _find()) {
+      return entry->info;
+    }
+  }
+
+  CanonicalFormInfo info =
+      make_canonical_form_info(configuration, m_ops.begin(), m_ops.end());
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_n_passes;
+  if (_find() == nullptr) {
+    if (Index(m_entries.size()) >= m_max_size) {
+      m_index.clear();
+      m_entries.clear();
+    }
+    m_index.emplace(hash, m_entries.size());
+    m_entries.push_back(Entry{configuration, info});
+  }
+  return info;
+}
+
+/// \brief Return true if a configuration is in canonical form
+///
+/// Same as `is_canonical(configuration, ops().begin(), ops().end())`.
+bool CanonicalFormCache::is_canonical(Configuration const &configuration) {
+  return get(configuration).is_canonical;
+}
+
+/// \brief Return the operation that makes a configuration canonical
+///
+/// Same as `to_canonical(configuration, ops().begin(), ops().end())`.
+SupercellSymOp CanonicalFormCache::to_canonical(
+    Configuration const &configuration) {
+  return m_ops[get(configuration).to_canonical_index];
+}
+
+/// \brief Return the operations that leave a configuration invariant
+///
+/// Same as `make_invariant_subgroup(configuration, ops().begin(),
+/// ops().end())`.
+std::vector<SupercellSymOp> CanonicalFormCache::make_invariant_subgroup(
+    Configuration const &configuration) {
+  std::vector<SupercellSymOp> subgroup;
+  for (Index i : get(configuration).invariant_subgroup_indices) {
+    subgroup.push_back(m_ops[i]);
+  }
+  return subgroup;
+}
+
+/// \brief Return the canonical form of a configuration
+///
+/// Same as `make_canonical_form(configuration, ops().begin(), ops().end())`.
+Configuration CanonicalFormCache::make_canonical_form(
+    Configuration const &configuration) {
+  return copy_apply(to_canonical(configuration), configuration);
+}
+
+/// \brief Return the distinct symmetrically equivalent configurations
+///
+/// Same as `make_equivalents(configuration, ops().begin(), ops().end())`.
+/// Because the operations form a group, there are `ops().size() / n`
+/// distinct equivalents, where `n` is the size of the invariant subgroup, so
+/// operations are applied only until all have been found.
+std::vector<Configuration> CanonicalFormCache::make_equivalents(
+    Configuration const &configuration) {
+  Index n_invariant = get(configuration).invariant_subgroup_indices.size();
+  Index n_equivalents = Index(m_ops.size()) / n_invariant;
+  std::set<Configuration> equivalents;
+  SupercellSymOpApplier applier;
+  for (auto const &op : m_ops) {
+    if (Index(equivalents.size()) == n_equivalents) {
+      break;
+    }
+    equivalents.emplace(applier.copy_apply(op, configuration));
+  }
+  return std::vector<Configuration>(equivalents.begin(), equivalents.end());
+}
+
+/// \brief Maximum number of entries
+Index CanonicalFormCache::max_size() const { return m_max_size; }
+
+/// \brief Number of entries
+Index CanonicalFormCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Number of passes over the operations made, which is the number
+///     of cache misses
+Index CanonicalFormCache::n_passes() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_n_passes;
+}
+
+/// \brief Erase all entries
+void CanonicalFormCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_index.clear();
+  m_entries.clear();
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,661 @@
+#include "casm/configuration/CanonicalFormEngine.hh"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+#include "casm/configuration/ConfigCompare.hh"
+#include "casm/configuration/ConfigIsEquivalent.hh"
+#include "casm/configuration/PrimSymInfo.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymInfo.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/configuration/perf.hh"
+#include "casm/configuration/trace.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+std::vector<SupercellSymOp> make_all_ops(
+    std::shared_ptr<Supercell const> const &supercell) {
+  return std::vector<SupercellSymOp>(SupercellSymOp::begin(supercell),
+                                     SupercellSymOp::end(supercell));
+}
+
+/// \brief Make a ConfigIsEquivalent which transforms local DoF values at
+///     most once per supercell factor group operation
+ConfigIsEquivalent make_caching_equal_to(Configuration const &configuration) {
+  double tol = configuration.supercell->prim->basicstructure->lattice().tol();
+  return ConfigIsEquivalent(configuration, tol, {"all"}, true);
+}
+
+/// \brief Index of the first element of `ops` that makes configuration
+///     canonical, using ConfigCompare
+Index to_canonical_index_by_compare(Configuration const &configuration,
+                                    std::vector<SupercellSymOp> const &ops) {
+  ConfigCompare compare_f(make_caching_equal_to(configuration));
+  return std::distance(ops.begin(),
+                       std::max_element(ops.begin(), ops.end(), compare_f));
+}
+
+/// \brief Number of occupation vectors of `n_sites` that fit in a typical L1
+///     data cache
+Index default_tile_size(Index n_sites) {
+  Index const cache_bytes = 32 * 1024;
+  Index const bytes_per_config = std::max(Index(1), n_sites) * sizeof(int);
+  return std::max(Index(1), cache_bytes / bytes_per_config);
+}
+
+}  // namespace
+
+CanonicalFormResult::CanonicalFormResult(
+    Index _to_canonical_index, SupercellSymOp const &_to_canonical,
+    std::vector<Index> const &_invariant_subgroup_indices,
+    Configuration const &_canonical_configuration)
+    : to_canonical_index(_to_canonical_index),
+      to_canonical(_to_canonical),
+      invariant_subgroup_indices(_invariant_subgroup_indices),
+      canonical_configuration(_canonical_configuration) {}
+
+/// \brief Constructor, using all operations that leave the supercell
+///     lattice invariant
+///
+/// \param _supercell The supercell. Operations are generated in the order
+///     `[SupercellSymOp::begin(_supercell), SupercellSymOp::end(_supercell))`.
+CanonicalFormEngine::CanonicalFormEngine(
+    std::shared_ptr<Supercell const> const &_supercell)
+    : CanonicalFormEngine(_supercell, make_all_ops(_supercell)) {}
+
+/// \brief Constructor, using a particular group of operations
+///
+/// \param _supercell The supercell
+/// \param _ops The operations used to find canonical forms. All must be
+///     operations in `_supercell`. Results are consistent with
+///     `[_ops.begin(), _ops.end())` being passed to the `canonical_form.hh`
+///     functions.
+CanonicalFormEngine::CanonicalFormEngine(
+    std::shared_ptr<Supercell const> const &_supercell,
+    std::vector<SupercellSymOp> const &_ops)
+    : m_supercell(throw_if_equal_to_nullptr(
+          _supercell, "Error in CanonicalFormEngine: supercell is empty")),
+      m_ops(_ops),
+      m_n_sublat(m_supercell->prim->basicstructure->basis().size()),
+      m_n_vol(m_supercell->superlattice.size()),
+      m_n_sites(m_supercell->unitcellcoord_index_converter.total_sites()),
+      m_has_aniso_occs(m_supercell->prim->sym_info.has_aniso_occs),
+      m_max_n_occ(0) {
+  if (m_ops.size() == 0) {
+    throw std::runtime_error(
+        "Error in CanonicalFormEngine: no operations provided");
+  }
+
+  m_permutations.reserve(m_ops.size() * m_n_sites);
+  m_fg_index.reserve(m_ops.size());
+  for (SupercellSymOp const &op : m_ops) {
+    if (op.supercell() != m_supercell &&
+        *op.supercell() != *m_supercell) {
+      throw std::runtime_error(
+          "Error in CanonicalFormEngine: operation supercell does not match");
+    }
+    sym_info::Permutation perm = op.combined_permute();
+    m_permutations.insert(m_permutations.end(), perm.begin(), perm.end());
+    m_fg_index.push_back(op.supercell_factor_group_index());
+  }
+
+  if (m_has_aniso_occs) {
+    PrimSymInfo const &prim_sym_info = m_supercell->prim->sym_info;
+    SymGroup const &supercell_fg = *m_supercell->sym_info.factor_group;
+    for (auto const &occ_symop_rep : prim_sym_info.occ_symgroup_rep) {
+      for (auto const &occ_perm : occ_symop_rep) {
+        m_max_n_occ = std::max(m_max_n_occ, Index(occ_perm.size()));
+      }
+    }
+    Index n_fg = supercell_fg.element.size();
+    m_occ_permutations.resize(n_fg * m_n_sublat * m_max_n_occ, 0);
+    for (Index f = 0; f < n_fg; ++f) {
+      Index prim_fg_index = supercell_fg.head_group_index[f];
+      for (Index b = 0; b < m_n_sublat; ++b) {
+        sym_info::Permutation const &occ_perm =
+            prim_sym_info.occ_symgroup_rep[prim_fg_index][b];
+        for (Index occ = 0; occ < occ_perm.size(); ++occ) {
+          m_occ_permutations[(f * m_n_sublat + b) * m_max_n_occ + occ] =
+              occ_perm[occ];
+        }
+      }
+    }
+
+    // supercell factor group operations that do not change any occupant
+    // index, such as the operations without time reversal for discrete
+    // collinear magnetic occupants, use the isotropic path
+    std::vector<char> fg_occ_is_identity(n_fg, 1);
+    for (Index f = 0; f < n_fg; ++f) {
+      Index prim_fg_index = supercell_fg.head_group_index[f];
+      for (Index b = 0; b < m_n_sublat; ++b) {
+        sym_info::Permutation const &occ_perm =
+            prim_sym_info.occ_symgroup_rep[prim_fg_index][b];
+        for (Index occ = 0; occ < occ_perm.size(); ++occ) {
+          if (occ_perm[occ] != occ) {
+            fg_occ_is_identity[f] = 0;
+          }
+        }
+      }
+    }
+    m_op_occ_is_identity.resize(m_ops.size());
+    for (Index i = 0; i < m_ops.size(); ++i) {
+      m_op_occ_is_identity[i] = fg_occ_is_identity[m_fg_index[i]];
+    }
+
+    m_occ_remap.resize(m_permutations.size());
+    for (Index i = 0; i < m_ops.size(); ++i) {
+      int const *fg_occ_permutations =
+          m_occ_permutations.data() + m_fg_index[i] * m_n_sublat * m_max_n_occ;
+      for (Index l = 0; l < m_n_sites; ++l) {
+        Index const k = i * m_n_sites + l;
+        m_occ_remap[k] =
+            fg_occ_permutations + (m_permutations[k] / m_n_vol) * m_max_n_occ;
+      }
+    }
+  }
+}
+
+/// \brief The supercell
+std::shared_ptr<Supercell const> const &CanonicalFormEngine::supercell() const {
+  return m_supercell;
+}
+
+/// \brief The operations used to find canonical forms
+std::vector<SupercellSymOp> const &CanonicalFormEngine::ops() const {
+  return m_ops;
+}
+
+/// \brief Number of sites in the supercell
+Index CanonicalFormEngine::n_sites() const { return m_n_sites; }
+
+/// \brief Pointer to the combined permutation of `ops()[op_index]`
+///
+/// The permutation has `n_sites()` elements and satisfies, ignoring any
+/// occupant index transformation:
+///     after[l] = before[permutation(op_index)[l]]
+Index const *CanonicalFormEngine::permutation(Index op_index) const {
+  return m_permutations.data() + op_index * m_n_sites;
+}
+
+/// \brief Pointer to the occupant remap tables of `ops()[op_index]`, or
+///     nullptr if `ops()[op_index]` does not transform occupant indices
+///
+/// If not nullptr, points to `n_sites()` tables, such that for occupant
+/// index values:
+///     after[l] = occupant_remap(op_index)[l][before[permutation(op_index)[l]]]
+///
+/// This is nullptr for every operation if the prim does not have
+/// anisotropic occupants, and for each operation whose occupant index
+/// permutations are all the identity otherwise. For example, with discrete
+/// collinear magnetic occupants, only the operations with time reversal
+/// have remap tables.
+int const *const *CanonicalFormEngine::occupant_remap(Index op_index) const {
+  if (!m_has_aniso_occs || m_op_occ_is_identity[op_index]) {
+    return nullptr;
+  }
+  return m_occ_remap.data() + op_index * m_n_sites;
+}
+
+/// \brief Set `after` to the occupation transformed by `ops()[op_index]`
+///
+/// Equivalent to the occupation of
+/// `copy_apply(ops()[op_index], configuration)`. The `before` and `after`
+/// vectors must not be the same object.
+void CanonicalFormEngine::apply_occupation(Index op_index,
+                                           Eigen::VectorXi const &before,
+                                           Eigen::VectorXi &after) const {
+  CASM_CONFIGURATION_PERF_COUNT(supercell_sym_op_apply);
+  after.resize(m_n_sites);
+  Index const *perm = permutation(op_index);
+  int const *const *remap = occupant_remap(op_index);
+  if (remap == nullptr) {
+    for (Index l = 0; l < m_n_sites; ++l) {
+      after[l] = before[perm[l]];
+    }
+    return;
+  }
+  for (Index l = 0; l < m_n_sites; ++l) {
+    after[l] = remap[l][before[perm[l]]];
+  }
+}
+
+/// \brief Lexicographically compare `occupation` to
+///     `ops()[op_index] * occupation`
+///
+/// \returns -1 if `occupation` is less than the transformed occupation, 0 if
+///     equal, and 1 if greater
+int CanonicalFormEngine::compare_occupation(Eigen::VectorXi const &occupation,
+                                            Index op_index) const {
+  for (Index l = 0; l < m_n_sites; ++l) {
+    int const A = occupation[l];
+    int const B = _occ_value(occupation, op_index, l);
+    if (A != B) {
+      return (A < B) ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+/// \brief Lexicographically compare `ops()[op_index_A] * occupation` to
+///     `ops()[op_index_B] * occupation`
+///
+/// \returns -1 if the A-transformed occupation is less than the B-transformed
+///     occupation, 0 if equal, and 1 if greater
+int CanonicalFormEngine::compare_occupation(Eigen::VectorXi const &occupation,
+                                            Index op_index_A,
+                                            Index op_index_B) const {
+  if (op_index_A == op_index_B) {
+    return 0;
+  }
+  for (Index l = 0; l < m_n_sites; ++l) {
+    int const A = _occ_value(occupation, op_index_A, l);
+    int const B = _occ_value(occupation, op_index_B, l);
+    if (A != B) {
+      return (A < B) ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+/// \brief Return true if configuration is in canonical form
+///
+/// Equivalent to `is_canonical(configuration, ops().begin(), ops().end())`.
+bool CanonicalFormEngine::is_canonical(
+    Configuration const &configuration) const {
+  _throw_if_other_supercell(configuration);
+  if (!_is_occupation_only(configuration)) {
+    return config::is_canonical(configuration, m_ops.begin(), m_ops.end());
+  }
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  for (Index i = 0; i < m_ops.size(); ++i) {
+    if (compare_occupation(occupation, i) < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Return the index into `ops()` of the first operation that makes
+///     the configuration canonical
+///
+/// Equivalent to the index of
+/// `to_canonical(configuration, ops().begin(), ops().end())`.
+Index CanonicalFormEngine::to_canonical_index(
+    Configuration const &configuration) const {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(canonical_form_engine);
+  CASM_CONFIGURATION_PERF_COUNT(canonicalization);
+  _throw_if_other_supercell(configuration);
+  if (!_is_occupation_only(configuration)) {
+    return to_canonical_index_by_compare(configuration, m_ops);
+  }
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  Index best = 0;
+  for (Index i = 1; i < m_ops.size(); ++i) {
+    if (compare_occupation(occupation, best, i) < 0) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+/// \brief Return the first operation that makes the configuration canonical
+SupercellSymOp const &CanonicalFormEngine::to_canonical(
+    Configuration const &configuration) const {
+  return m_ops[to_canonical_index(configuration)];
+}
+
+/// \brief Return the configuration that compares greater to all
+///     equivalents generated by `ops()`
+Configuration CanonicalFormEngine::make_canonical_form(
+    Configuration const &configuration) const {
+  Index i = to_canonical_index(configuration);
+  if (!_is_occupation_only(configuration)) {
+    return copy_apply(m_ops[i], configuration);
+  }
+  Configuration canonical_configuration(configuration);
+  apply_occupation(i, configuration.dof_values.occupation,
+                   canonical_configuration.dof_values.occupation);
+  return canonical_configuration;
+}
+
+/// \brief Return the indices into `ops()` of the operations that leave the
+///     configuration invariant
+std::vector<Index> CanonicalFormEngine::make_invariant_subgroup_indices(
+    Configuration const &configuration) const {
+  _throw_if_other_supercell(configuration);
+  std::vector<Index> indices;
+  if (!_is_occupation_only(configuration)) {
+    ConfigIsEquivalent equal_to_f = make_caching_equal_to(configuration);
+    for (Index i = 0; i < m_ops.size(); ++i) {
+      if (equal_to_f(m_ops[i])) {
+        indices.push_back(i);
+      }
+    }
+    return indices;
+  }
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  for (Index i = 0; i < m_ops.size(); ++i) {
+    if (compare_occupation(occupation, i) == 0) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+/// \brief Find the canonical operation index, the invariant subgroup, and
+///     the canonical configuration in one pass over the operations
+CanonicalFormResult CanonicalFormEngine::canonicalize(
+    Configuration const &configuration) const {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(canonical_form_engine);
+  CASM_CONFIGURATION_PERF_COUNT(canonicalization);
+  _throw_if_other_supercell(configuration);
+  Index best = 0;
+  std::vector<Index> invariant_subgroup_indices;
+
+  if (!_is_occupation_only(configuration)) {
+    ConfigIsEquivalent equal_to_f = make_caching_equal_to(configuration);
+    for (Index i = 0; i < m_ops.size(); ++i) {
+      if (equal_to_f(m_ops[i])) {
+        invariant_subgroup_indices.push_back(i);
+      }
+      if (i != best && !equal_to_f(m_ops[best], m_ops[i]) &&
+          equal_to_f.is_less()) {
+        best = i;
+      }
+    }
+    return CanonicalFormResult(best, m_ops[best], invariant_subgroup_indices,
+                               copy_apply(m_ops[best], configuration));
+  }
+
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  for (Index i = 0; i < m_ops.size(); ++i) {
+    if (compare_occupation(occupation, i) == 0) {
+      invariant_subgroup_indices.push_back(i);
+    }
+    if (compare_occupation(occupation, best, i) < 0) {
+      best = i;
+    }
+  }
+  Configuration canonical_configuration(configuration);
+  apply_occupation(best, occupation,
+                   canonical_configuration.dof_values.occupation);
+  return CanonicalFormResult(best, m_ops[best], invariant_subgroup_indices,
+                             canonical_configuration);
+}
+
+/// \brief Return `to_canonical_index` for each of many configurations
+///
+/// \param configurations The configurations, which must all be in
+///     `supercell()`
+/// \param n_threads Number of threads to use. Configurations are split into
+///     contiguous chunks, one per thread. If `n_threads <= 0`, use the number
+///     of threads set by `set_num_threads`.
+/// \param tile_size Within each chunk, occupation-only configurations are
+///     processed in tiles of `tile_size` configurations, with the operations
+///     in the outer loop, so that each permutation table row is reused for
+///     every configuration in the tile while it is in cache. If
+///     `tile_size <= 0`, a tile size is chosen so that the tile's occupation
+///     vectors fit in a typical L1 data cache.
+///
+/// \returns to_canonical_indices The index into `ops()` of the first
+///     operation that makes each configuration canonical.
+std::vector<Index> CanonicalFormEngine::to_canonical_indices(
+    std::vector<Configuration> const &configurations, Index n_threads,
+    Index tile_size) const {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(canonical_form_engine);
+  CASM_CONFIGURATION_PERF_COUNT_N(canonicalization, configurations.size());
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("CanonicalFormEngine.to_canonical_indices",
+                                     "n_configurations",
+                                     configurations.size());
+  for (auto const &configuration : configurations) {
+    _throw_if_other_supercell(configuration);
+  }
+  if (tile_size <= 0) {
+    tile_size = default_tile_size(m_n_sites);
+  }
+
+  std::vector<Index> result(configurations.size(), 0);
+  Index n_ops = m_ops.size();
+  parallel_for_chunks(
+      configurations.size(), n_threads, [&](Index begin, Index end) {
+        CASM_CONFIGURATION_TRACE_SCOPE_ARG(
+            "CanonicalFormEngine.to_canonical_indices.chunk", "size",
+            end - begin);
+        // SupercellSymOp caches translation permutations, so each thread
+        // uses its own copy of the operations for non-occupation comparisons
+        std::vector<SupercellSymOp> thread_ops;
+        std::vector<Index> tile;
+        for (Index tile_begin = begin; tile_begin < end;
+             tile_begin += tile_size) {
+          Index tile_end = std::min(end, tile_begin + tile_size);
+          tile.clear();
+          for (Index c = tile_begin; c < tile_end; ++c) {
+            if (_is_occupation_only(configurations[c])) {
+              tile.push_back(c);
+            } else {
+              if (thread_ops.empty()) {
+                thread_ops = m_ops;
+              }
+              result[c] =
+                  to_canonical_index_by_compare(configurations[c], thread_ops);
+            }
+          }
+          for (Index i = 1; i < n_ops; ++i) {
+            for (Index c : tile) {
+              if (compare_occupation(configurations[c].dof_values.occupation,
+                                     result[c], i) < 0) {
+                result[c] = i;
+              }
+            }
+          }
+        }
+      });
+  return result;
+}
+
+/// \brief Return `make_canonical_form` for each of many configurations
+///
+/// \param configurations The configurations, which must all be in
+///     `supercell()`
+/// \param n_threads Number of threads to use (see `to_canonical_indices`)
+/// \param tile_size Number of configurations per tile (see
+///     `to_canonical_indices`)
+///
+/// \returns canonical_configurations The canonical form of each
+///     configuration, in the same order as `configurations`.
+std::vector<Configuration> CanonicalFormEngine::make_canonical_forms(
+    std::vector<Configuration> const &configurations, Index n_threads,
+    Index tile_size) const {
+  std::vector<Index> indices =
+      to_canonical_indices(configurations, n_threads, tile_size);
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("CanonicalFormEngine.make_canonical_forms",
+                                     "n_configurations",
+                                     configurations.size());
+  std::vector<Configuration> result(configurations);
+  parallel_for_chunks(
+      configurations.size(), n_threads, [&](Index begin, Index end) {
+        CASM_CONFIGURATION_TRACE_SCOPE_ARG(
+            "CanonicalFormEngine.make_canonical_forms.chunk", "size",
+            end - begin);
+        std::vector<SupercellSymOp> thread_ops;
+        for (Index c = begin; c < end; ++c) {
+          if (_is_occupation_only(configurations[c])) {
+            apply_occupation(indices[c], configurations[c].dof_values.occupation,
+                             result[c].dof_values.occupation);
+          } else {
+            if (thread_ops.empty()) {
+              thread_ops = m_ops;
+            }
+            apply(thread_ops[indices[c]], result[c]);
+          }
+        }
+      });
+  return result;
+}
+
+void CanonicalFormEngine::_throw_if_other_supercell(
+    Configuration const &configuration) const {
+  if (configuration.supercell != m_supercell &&
+      *configuration.supercell != *m_supercell) {
+    throw std::runtime_error(
+        "Error in CanonicalFormEngine: configuration supercell does not "
+        "match");
+  }
+}
+
+/// \brief Return true if the fast occupation-only comparisons give the same
+///     result as ConfigCompare
+bool CanonicalFormEngine::_is_occupation_only(
+    Configuration const &configuration) const {
+  return configuration.dof_values.global_dof_values.empty() &&
+         configuration.dof_values.local_dof_values.empty();
+}
+
+namespace {
+
+/// \brief Bytes of the CanonicalFormEngine tables for all operations of a
+///     supercell
+Index _engine_table_bytes(Supercell const &supercell) {
+  Index n_ops = supercell.sym_info.factor_group->element.size() *
+                supercell.superlattice.size();
+  Index n_sites = supercell.unitcellcoord_index_converter.total_sites();
+  Index bytes_per_site = sizeof(Index);
+  if (supercell.prim->sym_info.has_aniso_occs) {
+    bytes_per_site += sizeof(int const *);
+  }
+  return n_ops * n_sites * bytes_per_site;
+}
+
+/// \brief Orders supercells by value, comparing pointers first
+struct _SupercellPtrLess {
+  bool operator()(std::shared_ptr<Supercell const> const &A,
+                  std::shared_ptr<Supercell const> const &B) const {
+    return A != B && *A < *B;
+  }
+};
+
+/// \brief Canonicalize the configurations of one supercell
+///
+/// Uses a CanonicalFormEngine if its tables fit in `max_table_bytes`, else
+/// SupercellSymOp, which only holds the translation permutations kept by
+/// the supercell's TranslationPermutationCache.
+void _make_canonical_forms_in_group(
+    std::vector<Configuration> const &configurations,
+    std::vector<Index> const &group, std::vector<Configuration> &result,
+    Index n_threads, std::optional<Index> max_table_bytes) {
+  auto const &supercell = configurations[group.front()].supercell;
+  if (max_table_bytes.has_value() &&
+      _engine_table_bytes(*supercell) > *max_table_bytes) {
+    auto begin = SupercellSymOp::begin(supercell);
+    auto end = SupercellSymOp::end(supercell);
+    parallel_for_items(group.size(), n_threads, [&](Index k) {
+      Index i = group[k];
+      result[i] = make_canonical_form(configurations[i], begin, end);
+    });
+    return;
+  }
+  std::vector<Configuration> group_configurations;
+  group_configurations.reserve(group.size());
+  for (Index i : group) {
+    group_configurations.push_back(configurations[i]);
+  }
+  CanonicalFormEngine engine(supercell);
+  std::vector<Configuration> canonical =
+      engine.make_canonical_forms(group_configurations, n_threads);
+  for (Index k = 0; k < Index(group.size()); ++k) {
+    result[group[k]] = std::move(canonical[k]);
+  }
+}
+
+}  // namespace
+
+/// \brief Return the canonical forms of many configurations in any number
+///     of supercells, grouped by supercell
+///
+/// \param configurations The configurations, which may be in any supercells
+///     with the same prim
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+/// \param max_table_bytes If present, the maximum bytes of the permutation
+///     tables used at once. A group whose CanonicalFormEngine tables would
+///     exceed the budget available to it is canonicalized with
+///     SupercellSymOp instead, which uses the supercell's bounded
+///     TranslationPermutationCache.
+///
+/// \returns The canonical form of each configuration, with respect to all
+///     operations of its supercell, in the same order as `configurations`.
+///     Equal to `make_canonical_form(configuration, begin, end)` with
+///     `SupercellSymOp::begin` and `SupercellSymOp::end` of each
+///     configuration's supercell. The result does not depend on
+///     `n_threads`.
+///
+/// Method:
+/// - Configurations are grouped by supercell, comparing Supercell pointers
+///   first and then transformation matrices, so configurations in equal but
+///   distinct Supercell objects share one group. Permutation tables are
+///   constructed once per group.
+/// - Groups are processed largest first. Groups with at least
+///   `n_configurations / n_threads` configurations are processed one at a
+///   time, using all threads, with the full `max_table_bytes` budget. The
+///   remaining groups are processed concurrently, one thread per group,
+///   with each taking groups in turn, and the budget is divided evenly
+///   between the threads.
+std::vector<Configuration> make_canonical_forms_by_supercell(
+    std::vector<Configuration> const &configurations, Index n_threads,
+    std::optional<Index> max_table_bytes) {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("make_canonical_forms_by_supercell",
+                                     "n_configurations",
+                                     configurations.size());
+  std::map<std::shared_ptr<Supercell const>, Index, _SupercellPtrLess>
+      group_index;
+  std::vector<std::vector<Index>> groups;
+  for (Index i = 0; i < Index(configurations.size()); ++i) {
+    auto const &supercell = throw_if_equal_to_nullptr(
+        configurations[i].supercell,
+        "Error in make_canonical_forms_by_supercell: supercell is empty");
+    auto it = group_index.emplace(supercell, groups.size()).first;
+    if (it->second == Index(groups.size())) {
+      groups.emplace_back();
+    }
+    groups[it->second].push_back(i);
+  }
+
+  std::vector<Index> order(groups.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](Index a, Index b) {
+    return groups[a].size() > groups[b].size();
+  });
+
+  std::vector<Configuration> result(configurations);
+  n_threads = resolve_n_threads(n_threads, configurations.size());
+  Index large_size =
+      std::max(Index(2), Index(configurations.size()) / n_threads);
+  Index n_large = 0;
+  while (n_large < Index(order.size()) &&
+         Index(groups[order[n_large]].size()) >= large_size) {
+    _make_canonical_forms_in_group(configurations, groups[order[n_large]],
+                                   result, n_threads, max_table_bytes);
+    ++n_large;
+  }
+
+  Index n_small = order.size() - n_large;
+  std::optional<Index> thread_table_bytes = max_table_bytes;
+  if (max_table_bytes.has_value()) {
+    thread_table_bytes =
+        *max_table_bytes / resolve_n_threads(n_threads, n_small);
+  }
+  parallel_for_items(n_small, n_threads, [&](Index k) {
+    _make_canonical_forms_in_group(configurations, groups[order[n_large + k]],
+                                   result, 1, thread_table_bytes);
+  });
+  return result;
+}
+
+}  // namespace config
+}  // namespace CASM
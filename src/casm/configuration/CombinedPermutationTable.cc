@@ -0,0 +1,116 @@
+#include "casm/configuration/CombinedPermutationTable.hh"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "casm/configuration/DiagonalIndexConverter.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymInfo.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param supercell The supercell. The table does not hold the supercell,
+///     so it must not outlive it.
+///
+/// Allocates the complete table, but builds no rows.
+CombinedPermutationTable::CombinedPermutationTable(Supercell const &supercell)
+    : m_supercell(&supercell),
+      m_n_translations(supercell.unitcell_index_converter.total_sites()),
+      m_n_sites(supercell.unitcellcoord_index_converter.total_sites()),
+      m_n_ops(supercell.sym_info.factor_group_permutations.size() *
+              m_n_translations),
+      m_flags(new std::once_flag[m_n_ops]),
+      m_permute(m_n_ops * m_n_sites),
+      m_inverse_permute(m_n_ops * m_n_sites),
+      m_n_built(0) {
+  if (m_n_sites > std::numeric_limits<std::int32_t>::max()) {
+    throw std::runtime_error(
+        "Error in CombinedPermutationTable: too many sites");
+  }
+}
+
+/// \brief Return the size in bytes of a table for a supercell
+Index CombinedPermutationTable::required_bytes(Supercell const &supercell) {
+  Index n_ops = supercell.sym_info.factor_group_permutations.size() *
+                supercell.unitcell_index_converter.total_sites();
+  Index n_sites = supercell.unitcellcoord_index_converter.total_sites();
+  return 2 * n_ops * n_sites * Index(sizeof(std::int32_t));
+}
+
+/// \brief Combined permutation of an operation, as `n_sites()` values
+///
+/// Value `l` is the index of the site whose values are permuted onto site
+/// `l`, as `SupercellSymOp::combined_permute()`. The row is built on first
+/// use.
+std::int32_t const *CombinedPermutationTable::permute(
+    Index supercell_factor_group_index, Index translation_index) const {
+  return m_permute.data() +
+         _row(supercell_factor_group_index, translation_index) * m_n_sites;
+}
+
+/// \brief Inverse combined permutation of an operation, as `n_sites()`
+///     values
+///
+/// Value `l` is the index of the site that the values on site `l` are
+/// permuted onto, which is the rep that transforms site indices. The row is
+/// built on first use.
+std::int32_t const *CombinedPermutationTable::inverse_permute(
+    Index supercell_factor_group_index, Index translation_index) const {
+  return m_inverse_permute.data() +
+         _row(supercell_factor_group_index, translation_index) * m_n_sites;
+}
+
+/// \brief Memory used by the table, in bytes
+Index CombinedPermutationTable::size_bytes() const {
+  return (m_permute.capacity() + m_inverse_permute.capacity()) *
+             sizeof(std::int32_t) +
+         m_n_ops * sizeof(std::once_flag);
+}
+
+/// \brief Return the operation index, building its row on first use
+Index CombinedPermutationTable::_row(Index supercell_factor_group_index,
+                                     Index translation_index) const {
+  Index n_fg = m_n_ops / std::max(Index(1), m_n_translations);
+  if (supercell_factor_group_index < 0 ||
+      supercell_factor_group_index >= n_fg || translation_index < 0 ||
+      translation_index >= m_n_translations) {
+    throw std::runtime_error(
+        "Error in CombinedPermutationTable: operation index out of range");
+  }
+  Index row = supercell_factor_group_index * m_n_translations +
+              translation_index;
+  std::call_once(m_flags[row], [&]() {
+    SupercellSymInfo const &sym_info = m_supercell->sym_info;
+    auto const &fg_perm =
+        sym_info.factor_group_permutations[supercell_factor_group_index];
+    sym_info::Permutation made_trans_perm;
+    sym_info::Permutation const *trans_perm = nullptr;
+    if (sym_info.translation_permutations.has_value()) {
+      trans_perm = &(*sym_info.translation_permutations)[translation_index];
+    } else {
+      // not added to the translation permutation cache, which is shared
+      // with operations that are not in the table
+      made_trans_perm = make_translation_permutation(
+          translation_index, m_supercell->unitcell_index_converter,
+          m_supercell->unitcellcoord_index_converter,
+          m_supercell->diagonal_index_converter.get());
+      trans_perm = &made_trans_perm;
+    }
+    std::int32_t *perm = m_permute.data() + row * m_n_sites;
+    std::int32_t *inverse_perm = m_inverse_permute.data() + row * m_n_sites;
+    for (Index l = 0; l < m_n_sites; ++l) {
+      perm[l] = fg_perm[(*trans_perm)[l]];
+      inverse_perm[perm[l]] = l;
+    }
+    m_n_built.fetch_add(1);
+  });
+  return row;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -1,8 +1,10 @@
 #include "casm/configuration/Configuration.hh"
 
+#include <algorithm>
+#include <cstring>
+
 #include "casm/clexulator/ConfigDoFValuesTools.hh"
 #include "casm/clexulator/DoFSpace.hh"
-#include "casm/configuration/ConfigCompare.hh"
 #include "casm/configuration/ConfigIsEquivalent.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/copy_configuration.hh"
@@ -21,49 +23,152 @@ Configuration::Configuration(std::shared_ptr<Supercell const> const &_supercell,
                              clexulator::ConfigDoFValues const &_dof_values)
     : supercell(_supercell), dof_values(_dof_values) {}
 
+namespace {  // anonymous
+
+/// Lexicographic comparison of continuous values in storage order, with
+/// values that differ by no more than tol treated as equal, returning -1, 0,
+/// or 1
+template <typename MatrixType>
+int _compare_continuous(MatrixType const &A, MatrixType const &B, double tol) {
+  double const *a = A.data();
+  double const *b = B.data();
+  for (Index i = 0; i < A.size(); ++i) {
+    if (a[i] < b[i] - tol) {
+      return -1;
+    }
+    if (a[i] > b[i] + tol) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/// Lexicographic comparison of occupation values, returning -1, 0, or 1
+int _compare_occupation(Eigen::VectorXi const &A, Eigen::VectorXi const &B) {
+  if (A.size() == 0 ||
+      std::memcmp(A.data(), B.data(), A.size() * sizeof(int)) == 0) {
+    return 0;
+  }
+  auto res = std::mismatch(A.data(), A.data() + A.size(), B.data());
+  return *res.first < *res.second ? -1 : 1;
+}
+
+/// Compare configurations in the same order as ConfigIsEquivalent and
+/// ConfigCompare, without constructing them, returning -1, 0, or 1
+int _compare(Configuration const &lhs, Configuration const &rhs) {
+  if (&lhs == &rhs) {
+    return 0;
+  }
+  if (lhs.supercell->prim != rhs.supercell->prim) {
+    throw std::runtime_error(
+        "Error comparing Configuration: "
+        "Only Configuration with shared prim may be compared this way.");
+  }
+  if (lhs.supercell != rhs.supercell && *lhs.supercell != *rhs.supercell) {
+    return *lhs.supercell < *rhs.supercell ? -1 : 1;
+  }
+
+  clexulator::ConfigDoFValues const &A = lhs.dof_values;
+  clexulator::ConfigDoFValues const &B = rhs.dof_values;
+  double tol = lhs.supercell->prim->basicstructure->lattice().tol();
+  for (auto const &pair : A.global_dof_values) {
+    int c = _compare_continuous(pair.second, B.global_dof_values.at(pair.first),
+                                tol);
+    if (c != 0) {
+      return c;
+    }
+  }
+  int c = _compare_occupation(A.occupation, B.occupation);
+  if (c != 0) {
+    return c;
+  }
+  for (auto const &pair : A.local_dof_values) {
+    c = _compare_continuous(pair.second, B.local_dof_values.at(pair.first),
+                            tol);
+    if (c != 0) {
+      return c;
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+
 /// \brief Less than comparison of Configuration
 ///
 /// - Must have the same Prim
 /// - Supercell are compared first, then global DoF, then occupation DoF,
 ///   then local continuous DoF
+/// - Gives the same result as `ConfigCompare`, but compares DoF values
+///   directly: supercells are first compared by pointer, occupation
+///   values are checked for equality with one memory comparison, and
+///   continuous values are only compared as needed
 bool Configuration::operator<(Configuration const &rhs) const {
-  ConfigCompare compare(*this);
-  return compare(rhs);
+  return _compare(*this, rhs) < 0;
 }
 
 /// \brief Equality comparison of Configuration
 ///
 /// - Must have the same Prim
 /// - Checks that all DoF are the same, within tolerance
+/// - Gives the same result as `ConfigIsEquivalent`, using the same direct
+///   comparison as `operator<`
 bool Configuration::eq_impl(Configuration const &rhs) const {
-  if (*supercell != *rhs.supercell) {
-    return false;
-  }
-  double xtal_tol = supercell->prim->basicstructure->lattice().tol();
-  ConfigIsEquivalent equal_to(*this, xtal_tol);
-  return equal_to(rhs);
+  return _compare(*this, rhs) == 0;
 }
 
 /// \brief Convert DoF values into the standard basis
 clexulator::ConfigDoFValues make_standard_dof_values(
     Configuration const &config) {
-  auto &supercell = config.supercell;
-  auto &prim = *supercell->prim;
-  return clexulator::to_standard_values(
-      config.dof_values, prim.basicstructure->basis().size(),
-      supercell->unitcell_index_converter.total_sites(), prim.global_dof_info,
-      prim.local_dof_info);
+  clexulator::ConfigDoFValues standard_dof_values;
+  make_standard_dof_values(config, standard_dof_values);
+  return standard_dof_values;
+}
+
+/// \brief Convert DoF values into the standard basis, writing into existing
+///     storage
+///
+/// \param config The configuration
+/// \param standard_dof_values Set to the DoF values of `config`, in the
+///     standard basis. Matrices that already have the correct shape are
+///     overwritten without reallocating, so storage may be reused for many
+///     configurations.
+void make_standard_dof_values(
+    Configuration const &config,
+    clexulator::ConfigDoFValues &standard_dof_values) {
+  auto const &supercell = *config.supercell;
+  to_standard_values(supercell.prim->dof_basis_info, config.dof_values,
+                     supercell.unitcell_index_converter.total_sites(),
+                     standard_dof_values);
 }
 
 /// \brief Set DoF values from other, which is in the standard basis
+///
+/// The existing `config.dof_values` matrices are overwritten without
+/// reallocating.
 void set_standard_dof_values(Configuration &config,
                              clexulator::ConfigDoFValues const &other) {
-  auto &supercell = config.supercell;
-  auto &prim = *supercell->prim;
-  config.dof_values = clexulator::from_standard_values(
-      other, prim.basicstructure->basis().size(),
-      supercell->unitcell_index_converter.total_sites(), prim.global_dof_info,
-      prim.local_dof_info);
+  if (&other == &config.dof_values) {
+    clexulator::ConfigDoFValues tmp(other);
+    set_standard_dof_values(config, tmp);
+    return;
+  }
+  auto const &supercell = *config.supercell;
+  from_standard_values(supercell.prim->dof_basis_info, other,
+                       supercell.unitcell_index_converter.total_sites(),
+                       config.dof_values);
+}
+
+/// \brief Estimate the memory used by a configuration, in bytes, including
+///     its supercell if not already counted
+///
+/// \param configuration The configuration
+/// \param context Records shared objects already counted
+Index memory_usage(Configuration const &configuration,
+                   MemoryUsageContext &context) {
+  return sizeof(Configuration) +
+         memory_usage_impl::heap_bytes(configuration.dof_values) +
+         make_memory_usage(*configuration.supercell, context).total_bytes();
 }
 
 /// \brief Set DoF values associated with a DoFSpace coordinate
@@ -151,6 +256,22 @@ Configuration &apply(SupercellSymOp const &op, Configuration &configuration) {
   return configuration;
 }
 
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+/// Configuration, using reusable storage
+Configuration &apply(SupercellSymOp const &op, Configuration &configuration,
+                     SupercellSymOpWorkspace &workspace) {
+  apply(op, configuration.dof_values, workspace);
+  return configuration;
+}
+
+/// \brief Apply a symmetry operation specified by a SupercellSymOpRef to
+/// Configuration, using reusable storage
+Configuration &apply(SupercellSymOpRef const &op, Configuration &configuration,
+                     SupercellSymOpWorkspace &workspace) {
+  apply(op, configuration.dof_values, workspace);
+  return configuration;
+}
+
 /// \brief Apply a symmetry operation specified by a SupercellSymOp to
 /// Configuration
 Configuration copy_apply(SupercellSymOp const &op,
@@ -171,38 +292,76 @@ ConfigurationWithProperties::ConfigurationWithProperties(
 ConfigurationWithProperties &apply(
     SupercellSymOp const &op,
     ConfigurationWithProperties &config_with_properties) {
-  apply(op, config_with_properties.configuration);
-
-  Configuration &configuration = config_with_properties.configuration;
-  Index n_sites =
-      configuration.supercell->unitcellcoord_index_converter.total_sites();
-  Index prim_fg_index = op.prim_factor_group_index();
-  xtal::SymOp symop = op.to_symop();
+  SupercellSymOpWorkspace workspace;
+  return apply(op, config_with_properties, workspace);
+}
 
-  // transform global properties
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+///     a configuration with properties, using reusable storage
+///
+/// Gives the same result as `apply(op, config_with_properties)`, with
+/// temporary values and the combined site permutation stored in
+/// `workspace`.
+ConfigurationWithProperties &apply(
+    SupercellSymOp const &op,
+    ConfigurationWithProperties &config_with_properties,
+    SupercellSymOpWorkspace &workspace) {
+  apply(op, config_with_properties.configuration, workspace);
   for (auto &property : config_with_properties.global_properties) {
-    AnisoValTraits traits(property.first);
-    Eigen::MatrixXd M = traits.symop_to_matrix(
-        get_matrix(symop), get_translation(symop), get_time_reversal(symop));
-    property.second = M * property.second;
+    apply_global_property(op, property.first, property.second, workspace);
   }
-
-  // transform then permute local properties
-  sym_info::Permutation combined_permute{op.combined_permute()};
   for (auto &property : config_with_properties.local_properties) {
-    AnisoValTraits traits(property.first);
-    Eigen::MatrixXd M = traits.symop_to_matrix(
-        get_matrix(symop), get_translation(symop), get_time_reversal(symop));
-    Eigen::MatrixXd tmp = M * property.second;
-    // permute values amongst sites
-    for (Index l = 0; l < n_sites; ++l) {
-      property.second.col(l) = tmp.col(combined_permute[l]);
-    }
+    apply_local_property(op, property.first, property.second, workspace);
   }
-
   return config_with_properties;
 }
 
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+///     the value of one global property
+///
+/// \param op The symmetry operation
+/// \param key The property name, which determines how it transforms (see
+///     `AnisoValTraits`)
+/// \param value The property value, transformed in place
+/// \param workspace Reusable storage for temporary values
+void apply_global_property(SupercellSymOp const &op, std::string const &key,
+                           Eigen::VectorXd &value,
+                           SupercellSymOpWorkspace &workspace) {
+  xtal::SymOp symop = op.to_symop();
+  AnisoValTraits traits(key);
+  Eigen::MatrixXd M = traits.symop_to_matrix(
+      get_matrix(symop), get_translation(symop), get_time_reversal(symop));
+  workspace.global_values.noalias() = M * value;
+  value = workspace.global_values;
+}
+
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+///     the value of one local property
+///
+/// \param op The symmetry operation
+/// \param key The property name, which determines how it transforms (see
+///     `AnisoValTraits`)
+/// \param value The property value, shape (dim, n_sites) in the supercell
+///     of `op`, transformed and permuted amongst sites in place
+/// \param workspace Reusable storage for temporary values and the combined
+///     site permutation
+void apply_local_property(SupercellSymOp const &op, std::string const &key,
+                          Eigen::MatrixXd &value,
+                          SupercellSymOpWorkspace &workspace) {
+  xtal::SymOp symop = op.to_symop();
+  AnisoValTraits traits(key);
+  Eigen::MatrixXd M = traits.symop_to_matrix(
+      get_matrix(symop), get_translation(symop), get_time_reversal(symop));
+  sym_info::Permutation const &combined_permute =
+      workspace.update_combined_permute(op);
+  Eigen::MatrixXd &tmp = workspace.local_values;
+  tmp.noalias() = M * value;
+  // permute values amongst sites
+  for (Index l = 0; l < value.cols(); ++l) {
+    value.col(l) = tmp.col(combined_permute[l]);
+  }
+}
+
 /// \brief Apply a symmetry operation specified by a SupercellSymOp to
 ///     a configuration with properties
 ConfigurationWithProperties copy_apply(
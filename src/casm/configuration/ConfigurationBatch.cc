@@ -0,0 +1,463 @@
+#include "casm/configuration/ConfigurationBatch.hh"
+
+#include "casm/clexulator/DoFSpace.hh"
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/parallel.hh"
+
+namespace CASM {
+namespace config {
+
+// --- ConfigurationBatchView ---
+
+ConfigurationBatchView::ConfigurationBatchView(ConfigurationBatch const &batch,
+                                               Index index)
+    : m_batch(&batch), m_index(index) {}
+
+/// \brief The shared supercell
+std::shared_ptr<Supercell const> const &ConfigurationBatchView::supercell()
+    const {
+  return m_batch->supercell();
+}
+
+/// \brief Occupation values, size n_sites
+Eigen::Map<Eigen::VectorXi const> ConfigurationBatchView::occupation() const {
+  Index n_sites = m_batch->n_sites();
+  return Eigen::Map<Eigen::VectorXi const>(
+      m_batch->occupation().data() + m_index * n_sites, n_sites);
+}
+
+/// \brief Global DoF values, in the prim basis, size dim
+Eigen::Map<Eigen::VectorXd const> ConfigurationBatchView::global_dof_values(
+    std::string const &key) const {
+  auto values = m_batch->global_dof_values(key);
+  return Eigen::Map<Eigen::VectorXd const>(
+      values.data() + m_index * values.cols(), values.cols());
+}
+
+/// \brief Local DoF values, in the prim basis, shape (dim, n_sites)
+Eigen::Map<Eigen::MatrixXd const> ConfigurationBatchView::local_dof_values(
+    std::string const &key) const {
+  auto values = m_batch->local_dof_values(key);
+  return Eigen::Map<Eigen::MatrixXd const>(
+      values.data() + m_index * values.cols(),
+      m_batch->local_dof_dim().at(key), m_batch->n_sites());
+}
+
+/// \brief Copy into a Configuration
+Configuration ConfigurationBatchView::configuration() const {
+  return m_batch->configuration(m_index);
+}
+
+/// \brief Copy into an existing Configuration, reusing its storage
+void ConfigurationBatchView::copy_to(Configuration &configuration) const {
+  m_batch->copy_to(m_index, configuration);
+}
+
+// --- ConfigurationBatch ---
+
+/// \brief Constructor, an empty batch
+///
+/// \param supercell The supercell of all configurations in the batch. The
+///     DoF keys and dimensions are those of the supercell's prim.
+ConfigurationBatch::ConfigurationBatch(
+    std::shared_ptr<Supercell const> const &supercell)
+    : m_supercell(supercell),
+      m_n_sites(supercell->unitcellcoord_index_converter.total_sites()),
+      m_size(0) {
+  Configuration default_configuration(m_supercell);
+  auto const &dof_values = default_configuration.dof_values;
+  for (auto const &pair : dof_values.global_dof_values) {
+    m_global_dof_dim.emplace(pair.first, pair.second.size());
+    m_global_dof_values.emplace(pair.first, std::vector<double>());
+  }
+  for (auto const &pair : dof_values.local_dof_values) {
+    m_local_dof_dim.emplace(pair.first, pair.second.rows());
+    m_local_dof_values.emplace(pair.first, std::vector<double>());
+  }
+}
+
+/// \brief Constructor, copying configurations
+///
+/// \param supercell The supercell of all configurations in the batch
+/// \param configurations Configurations to copy into the batch. All must be
+///     in `supercell`.
+ConfigurationBatch::ConfigurationBatch(
+    std::shared_ptr<Supercell const> const &supercell,
+    std::vector<Configuration> const &configurations)
+    : ConfigurationBatch(supercell) {
+  reserve(configurations.size());
+  for (auto const &configuration : configurations) {
+    push_back(configuration);
+  }
+}
+
+/// \brief Reserve storage for `n` configurations
+void ConfigurationBatch::reserve(Index n) {
+  m_occupation.reserve(n * m_n_sites);
+  for (auto &pair : m_global_dof_values) {
+    pair.second.reserve(n * m_global_dof_dim.at(pair.first));
+  }
+  for (auto &pair : m_local_dof_values) {
+    pair.second.reserve(n * m_local_dof_dim.at(pair.first) * m_n_sites);
+  }
+}
+
+/// \brief Remove all configurations
+void ConfigurationBatch::clear() {
+  m_occupation.clear();
+  for (auto &pair : m_global_dof_values) {
+    pair.second.clear();
+  }
+  for (auto &pair : m_local_dof_values) {
+    pair.second.clear();
+  }
+  m_size = 0;
+}
+
+/// \brief Add a configuration, which must be in the batch's supercell
+void ConfigurationBatch::push_back(Configuration const &configuration) {
+  _check(configuration);
+  auto const &dof_values = configuration.dof_values;
+  auto const &occupation = dof_values.occupation;
+  m_occupation.insert(m_occupation.end(), occupation.data(),
+                      occupation.data() + occupation.size());
+  for (auto &pair : m_global_dof_values) {
+    auto const &value = dof_values.global_dof_values.at(pair.first);
+    pair.second.insert(pair.second.end(), value.data(),
+                       value.data() + value.size());
+  }
+  for (auto &pair : m_local_dof_values) {
+    auto const &value = dof_values.local_dof_values.at(pair.first);
+    pair.second.insert(pair.second.end(), value.data(),
+                       value.data() + value.size());
+  }
+  ++m_size;
+}
+
+/// \brief Set the configuration at index `i`
+void ConfigurationBatch::set(Index i, Configuration const &configuration) {
+  _check(configuration);
+  auto const &dof_values = configuration.dof_values;
+  occupation().row(i) = dof_values.occupation.transpose();
+  for (auto const &pair : m_global_dof_dim) {
+    global_dof_values(pair.first).row(i) =
+        dof_values.global_dof_values.at(pair.first).transpose();
+  }
+  for (auto const &pair : m_local_dof_dim) {
+    auto const &value = dof_values.local_dof_values.at(pair.first);
+    local_dof_values(pair.first).row(i) =
+        Eigen::Map<Eigen::VectorXd const>(value.data(), value.size())
+            .transpose();
+  }
+}
+
+/// \brief Read-only view of the configuration at index `i`
+ConfigurationBatchView ConfigurationBatch::view(Index i) const {
+  return ConfigurationBatchView(*this, i);
+}
+
+/// \brief Copy the configuration at index `i`
+Configuration ConfigurationBatch::configuration(Index i) const {
+  Configuration result(m_supercell);
+  copy_to(i, result);
+  return result;
+}
+
+/// \brief Copy the configuration at index `i` into an existing
+///     Configuration, reusing its storage
+///
+/// If `configuration` already has DoF values of the right shape, as when it
+/// was last used with this batch, no memory is allocated.
+void ConfigurationBatch::copy_to(Index i, Configuration &configuration) const {
+  ConfigurationBatchView v = view(i);
+  configuration.supercell = m_supercell;
+  auto &dof_values = configuration.dof_values;
+  dof_values.occupation = v.occupation();
+  if (dof_values.global_dof_values.size() != m_global_dof_dim.size()) {
+    dof_values.global_dof_values.clear();
+  }
+  for (auto const &pair : m_global_dof_dim) {
+    dof_values.global_dof_values[pair.first] = v.global_dof_values(pair.first);
+  }
+  if (dof_values.local_dof_values.size() != m_local_dof_dim.size()) {
+    dof_values.local_dof_values.clear();
+  }
+  for (auto const &pair : m_local_dof_dim) {
+    dof_values.local_dof_values[pair.first] = v.local_dof_values(pair.first);
+  }
+}
+
+/// \brief Copy all configurations
+std::vector<Configuration> ConfigurationBatch::configurations() const {
+  std::vector<Configuration> result;
+  result.reserve(m_size);
+  for (Index i = 0; i < m_size; ++i) {
+    result.push_back(configuration(i));
+  }
+  return result;
+}
+
+/// \brief Occupation of all configurations, shape (size, n_sites)
+Eigen::Map<ConfigurationBatch::OccupationMatrix>
+ConfigurationBatch::occupation() {
+  return Eigen::Map<OccupationMatrix>(m_occupation.data(), m_size, m_n_sites);
+}
+
+/// \brief Occupation of all configurations, shape (size, n_sites)
+Eigen::Map<ConfigurationBatch::OccupationMatrix const>
+ConfigurationBatch::occupation() const {
+  return Eigen::Map<OccupationMatrix const>(m_occupation.data(), m_size,
+                                            m_n_sites);
+}
+
+/// \brief Values of a global DoF, shape (size, dim)
+Eigen::Map<ConfigurationBatch::ValuesMatrix>
+ConfigurationBatch::global_dof_values(std::string const &key) {
+  auto &values = _values(m_global_dof_values, key, "global");
+  return Eigen::Map<ValuesMatrix>(values.data(), m_size,
+                                  m_global_dof_dim.at(key));
+}
+
+/// \brief Values of a global DoF, shape (size, dim)
+Eigen::Map<ConfigurationBatch::ValuesMatrix const>
+ConfigurationBatch::global_dof_values(std::string const &key) const {
+  auto const &values = _values(m_global_dof_values, key, "global");
+  return Eigen::Map<ValuesMatrix const>(values.data(), m_size,
+                                        m_global_dof_dim.at(key));
+}
+
+/// \brief Values of a local DoF, shape (size, dim * n_sites)
+Eigen::Map<ConfigurationBatch::ValuesMatrix>
+ConfigurationBatch::local_dof_values(std::string const &key) {
+  auto &values = _values(m_local_dof_values, key, "local");
+  return Eigen::Map<ValuesMatrix>(values.data(), m_size,
+                                  m_local_dof_dim.at(key) * m_n_sites);
+}
+
+/// \brief Values of a local DoF, shape (size, dim * n_sites)
+Eigen::Map<ConfigurationBatch::ValuesMatrix const>
+ConfigurationBatch::local_dof_values(std::string const &key) const {
+  auto const &values = _values(m_local_dof_values, key, "local");
+  return Eigen::Map<ValuesMatrix const>(values.data(), m_size,
+                                        m_local_dof_dim.at(key) * m_n_sites);
+}
+
+void ConfigurationBatch::_check(Configuration const &configuration) const {
+  if (configuration.supercell != m_supercell &&
+      *configuration.supercell != *m_supercell) {
+    throw std::runtime_error(
+        "Error in ConfigurationBatch: configuration supercell does not "
+        "match");
+  }
+}
+
+std::vector<double> &ConfigurationBatch::_values(
+    std::map<std::string, std::vector<double>> &map, std::string const &key,
+    char const *what) {
+  auto it = map.find(key);
+  if (it == map.end()) {
+    throw std::runtime_error(std::string("Error in ConfigurationBatch: no ") +
+                             what + " DoF " + key);
+  }
+  return it->second;
+}
+
+std::vector<double> const &ConfigurationBatch::_values(
+    std::map<std::string, std::vector<double>> const &map,
+    std::string const &key, char const *what) const {
+  auto it = map.find(key);
+  if (it == map.end()) {
+    throw std::runtime_error(std::string("Error in ConfigurationBatch: no ") +
+                             what + " DoF " + key);
+  }
+  return it->second;
+}
+
+// --- Batch operations ---
+
+/// \brief Fill a batch with copies of a background configuration, with DoF
+///     values set from many DoFSpace coordinates
+///
+/// \param batch The batch, which is cleared and filled with one
+///     configuration per column of `dof_space_coordinates`. Storage is
+///     reused.
+/// \param background Provides the values of all DoF not set from the
+///     DoFSpace. Must be in the batch's supercell.
+/// \param dof_space The DoFSpace, as for `set_dof_space_values` for a
+///     single configuration. Occupation is not supported.
+/// \param dof_space_coordinates The DoFSpace coordinates, as a matrix of
+///     shape (dof_space.basis.cols(), n_configurations), with one column
+///     per configuration.
+///
+/// Gives the same result as applying `set_dof_space_values` to a copy of
+/// `background` for each column of `dof_space_coordinates`. Because that
+/// is linear in the coordinate, the prim basis values it sets are found
+/// once for each DoFSpace basis vector, and then the values for all
+/// configurations are found with one matrix product.
+void set_dof_space_values(ConfigurationBatch &batch,
+                          Configuration const &background,
+                          clexulator::DoFSpace const &dof_space,
+                          Eigen::MatrixXd const &dof_space_coordinates) {
+  std::string const &key = dof_space.dof_key;
+  if (key == "occ") {
+    throw std::runtime_error(
+        "Error in set_dof_space_values: not supported for occupation");
+  }
+  Index dim = dof_space.basis.cols();
+  if (dof_space_coordinates.rows() != dim) {
+    throw std::runtime_error(
+        "Error in set_dof_space_values: dof_space_coordinates and dof_space "
+        "dimension mismatch");
+  }
+
+  // indices into the flattened values of `key` that are set from the
+  // DoFSpace: all values for global DoF, all components of the DoFSpace
+  // sites for local DoF
+  Configuration probe(background);
+  auto &dof_values = probe.dof_values;
+  auto values_data = [&]() -> double const * {
+    return dof_space.is_global ? dof_values.global_dof_values.at(key).data()
+                               : dof_values.local_dof_values.at(key).data();
+  };
+  std::vector<Index> set_index;
+  if (dof_space.is_global) {
+    Index n_values = dof_values.global_dof_values.at(key).size();
+    for (Index i = 0; i < n_values; ++i) {
+      set_index.push_back(i);
+    }
+  } else {
+    Index dof_dim = dof_values.local_dof_values.at(key).rows();
+    for (Index l : *dof_space.sites) {
+      for (Index c = 0; c < dof_dim; ++c) {
+        set_index.push_back(l * dof_dim + c);
+      }
+    }
+  }
+
+  // prim basis values set by each DoFSpace basis vector
+  Eigen::MatrixXd M(set_index.size(), dim);
+  Eigen::VectorXd e = Eigen::VectorXd::Zero(dim);
+  for (Index j = 0; j < dim; ++j) {
+    e(j) = 1.0;
+    set_dof_space_values(probe, dof_space, e);
+    e(j) = 0.0;
+    double const *data = values_data();
+    for (Index r = 0; r < M.rows(); ++r) {
+      M(r, j) = data[set_index[r]];
+    }
+  }
+
+  Index n_configurations = dof_space_coordinates.cols();
+  batch.clear();
+  batch.reserve(n_configurations);
+  for (Index i = 0; i < n_configurations; ++i) {
+    batch.push_back(background);
+  }
+  Eigen::MatrixXd values = M * dof_space_coordinates;
+  Eigen::Map<ConfigurationBatch::ValuesMatrix> batch_values =
+      dof_space.is_global ? batch.global_dof_values(key)
+                          : batch.local_dof_values(key);
+  for (Index r = 0; r < M.rows(); ++r) {
+    batch_values.col(set_index[r]) = values.row(r).transpose();
+  }
+}
+
+/// \brief Apply a symmetry operation to every configuration in a batch
+///
+/// \param op The operation, which must be in the batch's supercell
+/// \param batch The batch, which is transformed in place
+///
+/// One temporary Configuration and one SupercellSymOpWorkspace are reused
+/// for all configurations, so the combined site permutation is made once.
+ConfigurationBatch &apply(SupercellSymOp const &op,
+                          ConfigurationBatch &batch) {
+  Configuration tmp(batch.supercell());
+  SupercellSymOpWorkspace workspace;
+  for (Index i = 0; i < batch.size(); ++i) {
+    batch.copy_to(i, tmp);
+    apply(op, tmp, workspace);
+    batch.set(i, tmp);
+  }
+  return batch;
+}
+
+/// \brief Return `engine.to_canonical_index` for each configuration in a
+///     batch
+///
+/// \param engine The canonical form engine, for the batch's supercell
+/// \param batch The configurations
+/// \param n_threads Number of threads to use. If <= 0, use the hardware
+///     concurrency.
+std::vector<Index> to_canonical_indices(CanonicalFormEngine const &engine,
+                                        ConfigurationBatch const &batch,
+                                        Index n_threads) {
+  std::vector<Index> result(batch.size());
+  parallel_for_chunks(batch.size(), n_threads, [&](Index begin, Index end) {
+    Configuration tmp(batch.supercell());
+    for (Index i = begin; i < end; ++i) {
+      batch.copy_to(i, tmp);
+      result[i] = engine.to_canonical_index(tmp);
+    }
+  });
+  return result;
+}
+
+/// \brief Return `engine.is_canonical` for each configuration in a batch
+///
+/// \param engine The canonical form engine, for the batch's supercell
+/// \param batch The configurations
+/// \param n_threads Number of threads to use. If <= 0, use the hardware
+///     concurrency.
+std::vector<bool> is_canonical(CanonicalFormEngine const &engine,
+                               ConfigurationBatch const &batch,
+                               Index n_threads) {
+  std::vector<char> flags(batch.size());
+  parallel_for_chunks(batch.size(), n_threads, [&](Index begin, Index end) {
+    Configuration tmp(batch.supercell());
+    for (Index i = begin; i < end; ++i) {
+      batch.copy_to(i, tmp);
+      flags[i] = engine.is_canonical(tmp);
+    }
+  });
+  return std::vector<bool>(flags.begin(), flags.end());
+}
+
+/// \brief Replace each configuration in a batch with its canonical form
+///
+/// \param engine The canonical form engine, for the batch's supercell
+/// \param batch The configurations, which are replaced in place
+/// \param n_threads Number of threads to use. If <= 0, use the hardware
+///     concurrency.
+///
+/// Gives the same result as `engine.make_canonical_forms` applied to
+/// `batch.configurations()`.
+void to_canonical_forms(CanonicalFormEngine const &engine,
+                        ConfigurationBatch &batch, Index n_threads) {
+  std::vector<Index> indices = to_canonical_indices(engine, batch, n_threads);
+  bool occupation_only =
+      batch.global_dof_dim().empty() && batch.local_dof_dim().empty();
+  parallel_for_chunks(batch.size(), n_threads, [&](Index begin, Index end) {
+    Configuration tmp(batch.supercell());
+    if (occupation_only) {
+      Eigen::VectorXi before;
+      for (Index i = begin; i < end; ++i) {
+        before = batch.view(i).occupation();
+        engine.apply_occupation(indices[i], before, tmp.dof_values.occupation);
+        batch.occupation().row(i) = tmp.dof_values.occupation.transpose();
+      }
+      return;
+    }
+    std::vector<SupercellSymOp> thread_ops = engine.ops();
+    SupercellSymOpWorkspace workspace;
+    for (Index i = begin; i < end; ++i) {
+      batch.copy_to(i, tmp);
+      apply(thread_ops[indices[i]], tmp, workspace);
+      batch.set(i, tmp);
+    }
+  });
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,334 @@
+#include "casm/configuration/ConfigurationDelta.hh"
+
+#include <stdexcept>
+
+#include "casm/clexulator/ConfigDoFValues.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/memory_usage.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/crystallography/BasicStructure.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+double _tol(Configuration const &background) {
+  return background.supercell->prim->basicstructure->lattice().tol();
+}
+
+/// Lexicographic comparison of continuous values, with values that differ
+/// by no more than tol treated as equal, returning -1, 0, or 1
+int _compare_continuous(Eigen::VectorXd const &A, Eigen::VectorXd const &B,
+                        double tol) {
+  if (A.size() != B.size()) {
+    return A.size() < B.size() ? -1 : 1;
+  }
+  for (Index i = 0; i < A.size(); ++i) {
+    if (A(i) < B(i) - tol) {
+      return -1;
+    }
+    if (A(i) > B(i) + tol) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/// Return true if any values differ by more than tol
+template <typename Derived1, typename Derived2>
+bool _is_different(Eigen::MatrixBase<Derived1> const &A,
+                   Eigen::MatrixBase<Derived2> const &B, double tol) {
+  return A.size() && ((A - B).array().abs() > tol).any();
+}
+
+int _compare_occupation(SparseOccupation const &A,
+                        SparseOccupation const &B) {
+  if (A == B) {
+    return 0;
+  }
+  return A < B ? -1 : 1;
+}
+
+int _compare_local(SparseLocalDoFValues const &A,
+                   SparseLocalDoFValues const &B, double tol) {
+  for (Index i = 0; i < Index(A.size()) && i < Index(B.size()); ++i) {
+    if (A[i].first != B[i].first) {
+      return A[i].first < B[i].first ? -1 : 1;
+    }
+    int c = _compare_continuous(A[i].second, B[i].second, tol);
+    if (c != 0) {
+      return c;
+    }
+  }
+  if (A.size() != B.size()) {
+    return A.size() < B.size() ? -1 : 1;
+  }
+  return 0;
+}
+
+int _compare_values(Eigen::VectorXd const &A, Eigen::VectorXd const &B,
+                    double tol) {
+  return _compare_continuous(A, B, tol);
+}
+
+int _compare_values(SparseLocalDoFValues const &A,
+                    SparseLocalDoFValues const &B, double tol) {
+  return _compare_local(A, B, tol);
+}
+
+/// Compare maps of DoF changes by key, then value, returning -1, 0, or 1
+template <typename MapType>
+int _compare_map(MapType const &A, MapType const &B, double tol) {
+  auto a = A.begin();
+  auto b = B.begin();
+  for (; a != A.end() && b != B.end(); ++a, ++b) {
+    if (a->first != b->first) {
+      return a->first < b->first ? -1 : 1;
+    }
+    int c = _compare_values(a->second, b->second, tol);
+    if (c != 0) {
+      return c;
+    }
+  }
+  if (a != A.end()) {
+    return 1;
+  }
+  if (b != B.end()) {
+    return -1;
+  }
+  return 0;
+}
+
+/// Compare deltas, returning -1, 0, or 1
+int _compare(ConfigurationDelta const &lhs, ConfigurationDelta const &rhs) {
+  if (&lhs == &rhs) {
+    return 0;
+  }
+  if (lhs.background != rhs.background &&
+      *lhs.background != *rhs.background) {
+    return *lhs.background < *rhs.background ? -1 : 1;
+  }
+  int c = _compare_occupation(lhs.occupation, rhs.occupation);
+  if (c != 0) {
+    return c;
+  }
+  double tol = _tol(*lhs.background);
+  c = _compare_map(lhs.global_dof_values, rhs.global_dof_values, tol);
+  if (c != 0) {
+    return c;
+  }
+  return _compare_map(lhs.local_dof_values, rhs.local_dof_values, tol);
+}
+
+}  // namespace
+
+/// \brief Constructor, with no changes
+///
+/// \param _background The shared background configuration
+ConfigurationDelta::ConfigurationDelta(
+    std::shared_ptr<Configuration const> const &_background)
+    : background(throw_if_equal_to_nullptr(
+          _background, "Error in ConfigurationDelta: background is empty")) {}
+
+/// \brief Number of stored changes
+///
+/// Counts each differing occupation value, each differing site for each
+/// local DoF type, and each differing global DoF type.
+Index ConfigurationDelta::size() const {
+  Index result = occupation.size() + global_dof_values.size();
+  for (auto const &pair : local_dof_values) {
+    result += pair.second.size();
+  }
+  return result;
+}
+
+/// \brief Less than comparison of ConfigurationDelta
+///
+/// - Backgrounds are compared first, by pointer and then value, then
+///   occupation changes, then global DoF changes, then local DoF changes
+/// - Continuous values that differ by no more than the prim lattice
+///   tolerance are treated as equal
+bool ConfigurationDelta::operator<(ConfigurationDelta const &rhs) const {
+  return _compare(*this, rhs) < 0;
+}
+
+/// \brief Equality comparison of ConfigurationDelta
+///
+/// For minimal deltas with equal backgrounds, equivalent to comparing the
+/// expanded configurations.
+bool ConfigurationDelta::eq_impl(ConfigurationDelta const &rhs) const {
+  return _compare(*this, rhs) == 0;
+}
+
+/// \brief Make the minimal delta of a configuration relative to a
+///     background
+///
+/// \param background The shared background configuration
+/// \param configuration A configuration in the same supercell as
+///     `background`
+///
+/// \returns A delta storing only the values of `configuration` that differ
+///     from `background`. Continuous values are stored, by site for local
+///     DoF, if any component differs by more than the prim lattice
+///     tolerance.
+ConfigurationDelta make_configuration_delta(
+    std::shared_ptr<Configuration const> const &background,
+    Configuration const &configuration) {
+  ConfigurationDelta delta(background);
+  if (configuration.supercell != background->supercell &&
+      *configuration.supercell != *background->supercell) {
+    throw std::runtime_error(
+        "Error in make_configuration_delta: configuration is not in the "
+        "background supercell");
+  }
+  clexulator::ConfigDoFValues const &A = background->dof_values;
+  clexulator::ConfigDoFValues const &B = configuration.dof_values;
+  double tol = _tol(*background);
+
+  for (Index l = 0; l < B.occupation.size(); ++l) {
+    if (B.occupation(l) != A.occupation(l)) {
+      delta.occupation.emplace_back(l, B.occupation(l));
+    }
+  }
+  for (auto const &pair : B.global_dof_values) {
+    if (_is_different(pair.second, A.global_dof_values.at(pair.first), tol)) {
+      delta.global_dof_values.emplace(pair.first, pair.second);
+    }
+  }
+  for (auto const &pair : B.local_dof_values) {
+    Eigen::MatrixXd const &values = pair.second;
+    Eigen::MatrixXd const &background_values =
+        A.local_dof_values.at(pair.first);
+    SparseLocalDoFValues changes;
+    for (Index l = 0; l < values.cols(); ++l) {
+      if (_is_different(values.col(l), background_values.col(l), tol)) {
+        changes.emplace_back(l, values.col(l));
+      }
+    }
+    if (changes.size()) {
+      delta.local_dof_values.emplace(pair.first, std::move(changes));
+    }
+  }
+  return delta;
+}
+
+/// \brief Make the minimal deltas of configurations relative to one shared
+///     background, in parallel
+///
+/// \param background The shared background configuration
+/// \param configurations Configurations in the same supercell as
+///     `background`
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns `make_configuration_delta(background, configurations[i])`, for
+///     each `i`. The result does not depend on `n_threads`.
+std::vector<ConfigurationDelta> make_configuration_deltas(
+    std::shared_ptr<Configuration const> const &background,
+    std::vector<Configuration> const &configurations, Index n_threads) {
+  throw_if_equal_to_nullptr(
+      background, "Error in make_configuration_deltas: background is empty");
+  std::vector<ConfigurationDelta> result(configurations.size(),
+                                         ConfigurationDelta(background));
+  parallel_for_items(configurations.size(), n_threads, [&](Index i) {
+    result[i] = make_configuration_delta(background, configurations[i]);
+  });
+  return result;
+}
+
+/// \brief Construct the configuration represented by a delta
+Configuration make_configuration(ConfigurationDelta const &delta) {
+  Configuration configuration = *delta.background;
+  make_configuration(delta, configuration);
+  return configuration;
+}
+
+/// \brief Set a configuration to the one represented by a delta, reusing
+///     its storage
+///
+/// \param delta The delta
+/// \param configuration Set to the background with the changes of `delta`
+///     applied. If it already has DoF values of the same shape, for
+///     instance from expanding another delta with the same background, the
+///     values are overwritten without reallocating.
+void make_configuration(ConfigurationDelta const &delta,
+                        Configuration &configuration) {
+  Configuration const &background = *delta.background;
+  if (&configuration != &background) {
+    configuration.supercell = background.supercell;
+    configuration.dof_values = background.dof_values;
+  }
+  clexulator::ConfigDoFValues &values = configuration.dof_values;
+  Index n_sites = values.occupation.size();
+  auto _check_site = [&](Index l) {
+    if (l < 0 || l >= n_sites) {
+      throw std::runtime_error(
+          "Error in make_configuration: ConfigurationDelta site index out "
+          "of range");
+    }
+  };
+
+  for (auto const &value : delta.occupation) {
+    _check_site(value.first);
+    values.occupation(value.first) = value.second;
+  }
+  for (auto const &pair : delta.global_dof_values) {
+    auto it = values.global_dof_values.find(pair.first);
+    if (it == values.global_dof_values.end() ||
+        it->second.size() != pair.second.size()) {
+      throw std::runtime_error(
+          "Error in make_configuration: ConfigurationDelta global DoF " +
+          pair.first + " is inconsistent with the background");
+    }
+    it->second = pair.second;
+  }
+  for (auto const &pair : delta.local_dof_values) {
+    auto it = values.local_dof_values.find(pair.first);
+    if (it == values.local_dof_values.end()) {
+      throw std::runtime_error(
+          "Error in make_configuration: ConfigurationDelta local DoF " +
+          pair.first + " is inconsistent with the background");
+    }
+    for (auto const &value : pair.second) {
+      _check_site(value.first);
+      if (value.second.size() != it->second.rows()) {
+        throw std::runtime_error(
+            "Error in make_configuration: ConfigurationDelta local DoF " +
+            pair.first + " has the wrong dimension");
+      }
+      it->second.col(value.first) = value.second;
+    }
+  }
+}
+
+/// \brief Estimate the memory used by a delta, in bytes, including its
+///     background if not already counted
+///
+/// \param delta The delta
+/// \param context Records shared objects already counted
+Index memory_usage(ConfigurationDelta const &delta,
+                   MemoryUsageContext &context) {
+  using namespace memory_usage_impl;
+  Index result = sizeof(ConfigurationDelta) + heap_bytes(delta.occupation);
+  for (auto const &pair : delta.global_dof_values) {
+    result += set_node_bytes + sizeof(pair) + heap_bytes(pair.first) +
+              heap_bytes(pair.second);
+  }
+  for (auto const &pair : delta.local_dof_values) {
+    result += set_node_bytes + sizeof(pair) + heap_bytes(pair.first) +
+              heap_bytes(pair.second);
+    for (auto const &value : pair.second) {
+      result += heap_bytes(value.second);
+    }
+  }
+  if (context.insert(delta.background.get())) {
+    result += memory_usage(*delta.background, context);
+  }
+  return result;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,298 @@
+#include "casm/configuration/ConfigurationFingerprint.hh"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/clusterography/ClusterSpecs.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/configuration/hash.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief Point, pair, and triplet orbits on sites with occupation DoF,
+///     with max length equal to the shortest prim lattice vector
+std::vector<std::set<clust::IntegralCluster>> _make_default_orbits(
+    std::shared_ptr<Prim const> const &prim) {
+  throw_if_equal_to_nullptr(
+      prim, "Error in InvariantFingerprintCalculator: prim is empty");
+  auto const &basicstructure = prim->basicstructure;
+  double shortest =
+      basicstructure->lattice().lat_column_mat().colwise().norm().minCoeff();
+  double max_length = 1.01 * shortest;
+  return clust::make_prim_periodic_orbits(
+      basicstructure, prim->sym_info.unitcellcoord_symgroup_rep,
+      clust::dof_sites_filter({"occ"}), {0.0, 0.0, max_length, max_length},
+      {});
+}
+
+/// \brief Find site-occupant orbits, using union-find over (sublattice,
+///     occupant) pairs
+std::vector<std::vector<Index>> _make_site_occupant_orbit_index(
+    Prim const &prim, Index &n_site_occupant_orbits) {
+  PrimSymInfo const &sym_info = prim.sym_info;
+  Index n_sublat = prim.basicstructure->basis().size();
+  std::vector<Index> n_occ(n_sublat);
+  std::vector<Index> begin(n_sublat + 1, 0);
+  for (Index b = 0; b < n_sublat; ++b) {
+    n_occ[b] = prim.basicstructure->basis()[b].occupant_dof().size();
+    begin[b + 1] = begin[b] + n_occ[b];
+  }
+
+  std::vector<Index> parent(begin[n_sublat]);
+  for (Index i = 0; i < parent.size(); ++i) {
+    parent[i] = i;
+  }
+  auto _find = [&](Index i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+
+  for (Index f = 0; f < sym_info.unitcellcoord_symgroup_rep.size(); ++f) {
+    auto const &sublattice_index =
+        sym_info.unitcellcoord_symgroup_rep[f].sublattice_index;
+    for (Index b = 0; b < n_sublat; ++b) {
+      Index b_after = sublattice_index[b];
+      for (Index occ = 0; occ < n_occ[b]; ++occ) {
+        Index occ_after = sym_info.occ_symgroup_rep[f][b][occ];
+        Index i = _find(begin[b] + occ);
+        Index j = _find(begin[b_after] + occ_after);
+        if (i != j) {
+          parent[std::max(i, j)] = std::min(i, j);
+        }
+      }
+    }
+  }
+
+  // number orbits in order of first appearance
+  std::map<Index, Index> orbit_index;
+  std::vector<std::vector<Index>> result(n_sublat);
+  for (Index b = 0; b < n_sublat; ++b) {
+    for (Index occ = 0; occ < n_occ[b]; ++occ) {
+      Index root = _find(begin[b] + occ);
+      auto it = orbit_index.emplace(root, orbit_index.size()).first;
+      result[b].push_back(it->second);
+    }
+  }
+  n_site_occupant_orbits = orbit_index.size();
+  return result;
+}
+
+}  // namespace
+
+/// \brief Constructor, using the default cluster orbits
+///
+/// \param _prim The prim
+InvariantFingerprintCalculator::InvariantFingerprintCalculator(
+    std::shared_ptr<Prim const> const &_prim)
+    : InvariantFingerprintCalculator(_prim, _make_default_orbits(_prim)) {}
+
+/// \brief Constructor, using particular cluster orbits
+///
+/// \param _prim The prim
+/// \param _orbits Prim periodic cluster orbits, which must be complete
+///     orbits with respect to the prim factor group for the fingerprint to
+///     be invariant. Larger orbits make fewer collisions, at greater cost.
+InvariantFingerprintCalculator::InvariantFingerprintCalculator(
+    std::shared_ptr<Prim const> const &_prim,
+    std::vector<std::set<clust::IntegralCluster>> const &_orbits)
+    : m_prim(throw_if_equal_to_nullptr(
+          _prim, "Error in InvariantFingerprintCalculator: prim is empty")),
+      m_orbits(_orbits),
+      m_n_site_occupant_orbits(0),
+      m_site_occupant_orbit_index(
+          _make_site_occupant_orbit_index(*m_prim, m_n_site_occupant_orbits)) {}
+
+/// \brief The prim
+std::shared_ptr<Prim const> const &InvariantFingerprintCalculator::prim()
+    const {
+  return m_prim;
+}
+
+/// \brief The prim periodic cluster orbits which contribute cluster counts
+std::vector<std::set<clust::IntegralCluster>> const &
+InvariantFingerprintCalculator::orbits() const {
+  return m_orbits;
+}
+
+/// \brief Number of site-occupant orbits
+Index InvariantFingerprintCalculator::n_site_occupant_orbits() const {
+  return m_n_site_occupant_orbits;
+}
+
+/// \brief Index of the site-occupant orbit of an occupant on a sublattice
+Index InvariantFingerprintCalculator::site_occupant_orbit_index(
+    Index sublattice_index, Index occupant_index) const {
+  return m_site_occupant_orbit_index[sublattice_index][occupant_index];
+}
+
+/// \brief Return the fingerprint of a configuration
+///
+/// The configuration must have the same prim as the calculator.
+std::uint64_t InvariantFingerprintCalculator::operator()(
+    Configuration const &configuration) const {
+  Supercell const &supercell = *configuration.supercell;
+  if (supercell.prim != m_prim) {
+    throw std::runtime_error(
+        "Error in InvariantFingerprintCalculator: prim mismatch");
+  }
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  auto const &unitcell_converter = supercell.unitcell_index_converter;
+  auto const &site_converter = supercell.unitcellcoord_index_converter;
+  Index n_unitcells = unitcell_converter.total_sites();
+
+  std::uint64_t seed = 0;
+  hash_combine(seed, n_unitcells);
+
+  // composition, by site-occupant orbit
+  std::vector<Index> composition(m_n_site_occupant_orbits, 0);
+  for (Index l = 0; l < occupation.size(); ++l) {
+    Index b = l / n_unitcells;
+    ++composition[m_site_occupant_orbit_index[b][occupation[l]]];
+  }
+  for (Index count : composition) {
+    hash_combine(seed, count);
+  }
+
+  // cluster counts, by orbit and sorted site-occupant orbit indices
+  std::map<std::vector<Index>, Index> counts;
+  std::vector<Index> key;
+  for (Index i = 0; i < m_orbits.size(); ++i) {
+    counts.clear();
+    for (clust::IntegralCluster const &cluster : m_orbits[i]) {
+      if (cluster.size() == 0) {
+        continue;
+      }
+      for (Index u = 0; u < n_unitcells; ++u) {
+        xtal::UnitCell unitcell = unitcell_converter(u);
+        key.clear();
+        for (xtal::UnitCellCoord const &site : cluster) {
+          Index l = site_converter(site + unitcell);
+          key.push_back(
+              m_site_occupant_orbit_index[site.sublattice()][occupation[l]]);
+        }
+        std::sort(key.begin(), key.end());
+        ++counts[key];
+      }
+    }
+    hash_combine(seed, i);
+    for (auto const &pair : counts) {
+      for (Index value : pair.first) {
+        hash_combine(seed, value);
+      }
+      hash_combine(seed, pair.second);
+    }
+  }
+  return seed;
+}
+
+/// \brief Constructor
+///
+/// \param _calculator Calculates configuration fingerprints
+/// \param _in_canonical_supercell If true, configurations in different
+///     supercells may be equivalent. If false, configurations are only
+///     equivalent if they have the same supercell.
+DistinctConfigurationFinder::DistinctConfigurationFinder(
+    std::shared_ptr<InvariantFingerprintCalculator const> const &_calculator,
+    bool _in_canonical_supercell)
+    : m_calculator(throw_if_equal_to_nullptr(
+          _calculator,
+          "Error in DistinctConfigurationFinder: calculator is empty")),
+      m_in_canonical_supercell(_in_canonical_supercell),
+      m_n_canonical_forms(0) {}
+
+/// \brief The fingerprint calculator
+InvariantFingerprintCalculator const &DistinctConfigurationFinder::calculator()
+    const {
+  return *m_calculator;
+}
+
+/// \brief Insert a configuration, if it is not equivalent to a
+///     configuration already found
+///
+/// \returns True if the configuration is distinct and was inserted, false
+///     otherwise
+bool DistinctConfigurationFinder::insert(Configuration const &configuration) {
+  return insert(configuration, (*m_calculator)(configuration));
+}
+
+/// \brief Insert a configuration with a precomputed fingerprint, if it is
+///     not equivalent to a configuration already found
+///
+/// Allows fingerprints to be calculated in parallel, using `calculator()`,
+/// before configurations are inserted in order.
+///
+/// \param configuration The configuration
+/// \param fingerprint Must equal `calculator()(configuration)`
+///
+/// \returns True if the configuration is distinct and was inserted, false
+///     otherwise
+bool DistinctConfigurationFinder::insert(Configuration const &configuration,
+                                         std::uint64_t fingerprint) {
+  auto range = m_index_by_fingerprint.equal_range(fingerprint);
+  std::optional<Configuration> canonical_form;
+  if (range.first != range.second) {
+    std::vector<Index> candidates;
+    for (auto it = range.first; it != range.second; ++it) {
+      candidates.push_back(it->second);
+    }
+    canonical_form = _make_canonical_form(configuration);
+    for (Index index : candidates) {
+      if (_canonical_form(index) == *canonical_form) {
+        return false;
+      }
+    }
+  }
+  m_index_by_fingerprint.emplace(fingerprint, m_configurations.size());
+  m_configurations.push_back(configuration);
+  m_canonical_forms.push_back(std::move(canonical_form));
+  return true;
+}
+
+/// \brief The distinct configurations, in the order inserted
+std::vector<Configuration> const &DistinctConfigurationFinder::configurations()
+    const {
+  return m_configurations;
+}
+
+/// \brief Number of canonical forms made
+Index DistinctConfigurationFinder::n_canonical_forms() const {
+  return m_n_canonical_forms;
+}
+
+/// \brief Canonical form of `m_configurations[index]`, made if necessary
+Configuration const &DistinctConfigurationFinder::_canonical_form(
+    Index index) {
+  std::optional<Configuration> &canonical_form = m_canonical_forms[index];
+  if (!canonical_form.has_value()) {
+    canonical_form = _make_canonical_form(m_configurations[index]);
+  }
+  return *canonical_form;
+}
+
+Configuration DistinctConfigurationFinder::_make_canonical_form(
+    Configuration const &configuration) {
+  ++m_n_canonical_forms;
+  if (m_in_canonical_supercell) {
+    return make_in_canonical_supercell(configuration);
+  }
+  auto const &supercell = configuration.supercell;
+  return make_canonical_form(configuration, SupercellSymOp::begin(supercell),
+                             SupercellSymOp::end(supercell));
+}
+
+}  // namespace config
+}  // namespace CASM
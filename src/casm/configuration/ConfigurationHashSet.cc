@@ -0,0 +1,163 @@
+#include "casm/configuration/ConfigurationHashSet.hh"
+
+#include "casm/configuration/ConfigIsEquivalent.hh"
+#include "casm/configuration/hash.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Return the hash of a configuration
+std::size_t ConfigurationHash::operator()(
+    Configuration const &configuration) const {
+  std::size_t seed = 0;
+  auto const &T =
+      configuration.supercell->superlattice.transformation_matrix_to_super();
+  for (Index i = 0; i < T.size(); ++i) {
+    hash_combine(seed, std::hash<long>()(T(i)));
+  }
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  for (Index l = 0; l < occupation.size(); ++l) {
+    hash_combine(seed, std::hash<int>()(occupation[l]));
+  }
+  return seed;
+}
+
+/// \brief Return the hash of a configuration, with quantized continuous DoF
+///     values
+std::size_t QuantizedConfigurationHash::operator()(
+    Configuration const &configuration) const {
+  std::size_t seed = ConfigurationHash()(configuration);
+  clexulator::ConfigDoFValues const &dof_values = configuration.dof_values;
+  for (auto const &dof : dof_values.global_dof_values) {
+    Eigen::VectorXd const &values = dof.second;
+    for (Index i = 0; i < values.size(); ++i) {
+      hash_combine(seed, std::hash<std::int64_t>()(
+                             quantize_dof_value(values(i), tol)));
+    }
+  }
+  for (auto const &dof : dof_values.local_dof_values) {
+    Eigen::MatrixXd const &values = dof.second;
+    for (Index i = 0; i < values.size(); ++i) {
+      hash_combine(seed, std::hash<std::int64_t>()(
+                             quantize_dof_value(values(i), tol)));
+    }
+  }
+  return seed;
+}
+
+/// \brief Constructor
+///
+/// \param _quantization_tol If provided, continuous DoF values are hashed
+///     and compared as keys quantized onto a grid with this spacing.
+///     Otherwise, continuous DoF values do not contribute to the hash and
+///     are compared within the lattice tolerance by `operator==`.
+ConfigurationHashSet::ConfigurationHashSet(
+    std::optional<double> _quantization_tol)
+    : m_quantization_tol(_quantization_tol) {
+  if (m_quantization_tol.has_value() && !(*m_quantization_tol > 0.0)) {
+    throw std::runtime_error(
+        "Error in ConfigurationHashSet: quantization_tol must be positive");
+  }
+}
+
+/// \brief Insert a configuration, if not already present
+///
+/// \returns An iterator to the configuration in the set, and true if it was
+///     inserted
+std::pair<ConfigurationHashSet::const_iterator, bool>
+ConfigurationHashSet::insert(Configuration const &configuration) {
+  std::size_t hash = _hash(configuration);
+  Index index = _find(configuration, hash);
+  if (index != -1) {
+    return std::make_pair(m_values.cbegin() + index, false);
+  }
+  m_index.emplace(hash, m_values.size());
+  m_values.push_back(configuration);
+  return std::make_pair(m_values.cend() - 1, true);
+}
+
+/// \brief Insert all configurations of another set, in order, if not
+///     already present
+void ConfigurationHashSet::merge(ConfigurationHashSet const &other) {
+  for (Configuration const &configuration : other) {
+    insert(configuration);
+  }
+}
+
+/// \brief Find a configuration, or return `end()` if not present
+ConfigurationHashSet::const_iterator ConfigurationHashSet::find(
+    Configuration const &configuration) const {
+  Index index = _find(configuration, _hash(configuration));
+  return index == -1 ? m_values.cend() : m_values.cbegin() + index;
+}
+
+/// \brief Return 1 if a configuration is present, else 0
+Index ConfigurationHashSet::count(Configuration const &configuration) const {
+  return find(configuration) == end() ? 0 : 1;
+}
+
+/// \brief Number of configurations
+Index ConfigurationHashSet::size() const { return m_values.size(); }
+
+/// \brief True if there are no configurations
+bool ConfigurationHashSet::empty() const { return m_values.empty(); }
+
+/// \brief Remove all configurations
+void ConfigurationHashSet::clear() {
+  m_values.clear();
+  m_index.clear();
+}
+
+/// \brief Reserve space for `n` configurations
+void ConfigurationHashSet::reserve(Index n) {
+  m_values.reserve(n);
+  m_index.reserve(n);
+}
+
+/// \brief Configurations, in insertion order
+std::vector<Configuration> const &ConfigurationHashSet::values() const {
+  return m_values;
+}
+
+ConfigurationHashSet::const_iterator ConfigurationHashSet::begin() const {
+  return m_values.cbegin();
+}
+
+ConfigurationHashSet::const_iterator ConfigurationHashSet::end() const {
+  return m_values.cend();
+}
+
+/// \brief Copy configurations into an ordered set
+std::set<Configuration> ConfigurationHashSet::to_set() const {
+  return std::set<Configuration>(m_values.begin(), m_values.end());
+}
+
+std::size_t ConfigurationHashSet::_hash(
+    Configuration const &configuration) const {
+  if (m_quantization_tol.has_value()) {
+    return QuantizedConfigurationHash(*m_quantization_tol)(configuration);
+  }
+  return ConfigurationHash()(configuration);
+}
+
+bool ConfigurationHashSet::_equal(Configuration const &A,
+                                  Configuration const &B) const {
+  if (m_quantization_tol.has_value()) {
+    return ConfigIsEquivalent(A, *m_quantization_tol, {"all"}, false, true)(B);
+  }
+  return A == B;
+}
+
+Index ConfigurationHashSet::_find(Configuration const &configuration,
+                                  std::size_t hash) const {
+  auto range = m_index.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (_equal(m_values[it->second], configuration)) {
+      return it->second;
+    }
+  }
+  return -1;
+}
+
+}  // namespace config
+}  // namespace CASM
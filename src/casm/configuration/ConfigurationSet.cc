@@ -1,28 +1,140 @@
 #include "casm/configuration/ConfigurationSet.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/configuration/hash.hh"
 #include "casm/configuration/supercell_name.hh"
+#include "casm/crystallography/BasicStructure.hh"
 
 namespace CASM {
 namespace config {
 
+namespace {
+
+/// \brief Hash of values rounded to a multiple of `tol`
+template <typename Derived>
+void _hash_quantized(std::size_t &seed, Eigen::MatrixBase<Derived> const &M,
+                     double tol) {
+  for (Index i = 0; i < M.size(); ++i) {
+    hash_combine(seed, std::hash<long long>()(std::llround(M(i) / tol)));
+  }
+}
+
+/// \brief True if fingerprints are exact, so a fingerprint miss proves a
+///     configuration is not in the set
+bool _has_exact_fingerprint(Configuration const &configuration) {
+  return configuration.dof_values.global_dof_values.empty() &&
+         configuration.dof_values.local_dof_values.empty();
+}
+
+/// \brief Hash of a supercell's transformation matrix
+std::size_t _supercell_hash(Supercell const &supercell) {
+  std::size_t seed = 0;
+  auto const &T = supercell.superlattice.transformation_matrix_to_super();
+  for (Index i = 0; i < T.size(); ++i) {
+    hash_combine(seed, std::hash<long>()(T(i)));
+  }
+  return seed;
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param _configuration The configuration
+/// \param _supercell_name The name of the configuration's supercell
+/// \param _configuration_id The configuration id, which must be a
+///     non-negative integer, in canonical form (i.e. "2", but not "02")
 ConfigurationRecord::ConfigurationRecord(Configuration const &_configuration,
-                                         std::string _supercell_name,
-                                         std::string _configuration_id)
+                                         std::string const &_supercell_name,
+                                         std::string const &_configuration_id)
+    : configuration(_configuration),
+      m_supercell_name(std::make_shared<std::string const>(_supercell_name)) {
+  std::optional<Index> id = parse_configuration_id(_configuration_id);
+  if (!id.has_value()) {
+    throw std::runtime_error(
+        "Error constructing ConfigurationRecord: configuration_id '" +
+        _configuration_id + "' is not a non-negative integer");
+  }
+  m_configuration_id = *id;
+}
+
+/// \brief Constructor, with a shared supercell name and integer id
+///
+/// \param _configuration The configuration
+/// \param _supercell_name Shared handle to the name of the configuration's
+///     supercell. Must not be null.
+/// \param _configuration_id The configuration id. Must be >= 0.
+ConfigurationRecord::ConfigurationRecord(
+    Configuration const &_configuration,
+    std::shared_ptr<std::string const> _supercell_name,
+    Index _configuration_id)
     : configuration(_configuration),
-      supercell_name(_supercell_name),
-      configuration_id(_configuration_id),
-      configuration_name(supercell_name + "/" + configuration_id) {}
+      m_supercell_name(std::move(_supercell_name)),
+      m_configuration_id(_configuration_id) {
+  if (!m_supercell_name) {
+    throw std::runtime_error(
+        "Error constructing ConfigurationRecord: null supercell_name");
+  }
+  if (m_configuration_id < 0) {
+    throw std::runtime_error(
+        "Error constructing ConfigurationRecord: configuration_id < 0");
+  }
+}
+
+/// \brief Parse a configuration id, returning std::nullopt if it is not a
+///     non-negative integer in canonical form (i.e. "2", but not "02")
+std::optional<Index> parse_configuration_id(
+    std::string const &configuration_id) {
+  if (configuration_id.empty() || configuration_id.size() > 18 ||
+      (configuration_id.size() > 1 && configuration_id[0] == '0')) {
+    return std::nullopt;
+  }
+  Index value = 0;
+  for (char c : configuration_id) {
+    if (c < '0' || c > '9') {
+      return std::nullopt;
+    }
+    value = 10 * value + (c - '0');
+  }
+  return value;
+}
 
 ConfigurationSet::ConfigurationSet(std::map<std::string, Index> _next_config_id)
     : m_next_config_id(_next_config_id) {}
 
+ConfigurationSet::ConfigurationSet(ConfigurationSet const &other)
+    : m_data(other.m_data),
+      m_has_primitive_canonical_index(other.m_has_primitive_canonical_index),
+      m_next_config_id(other.m_next_config_id) {
+  rebuild_index();
+}
+
+ConfigurationSet &ConfigurationSet::operator=(ConfigurationSet const &other) {
+  if (this != &other) {
+    m_data = other.m_data;
+    m_has_primitive_canonical_index = other.m_has_primitive_canonical_index;
+    m_next_config_id = other.m_next_config_id;
+    rebuild_index();
+  }
+  return *this;
+}
+
 bool ConfigurationSet::empty() const { return m_data.empty(); }
 
 ConfigurationSet::size_type ConfigurationSet::size() const {
   return m_data.size();
 }
 
-void ConfigurationSet::clear() { return m_data.clear(); }
+void ConfigurationSet::clear() {
+  m_data.clear();
+  m_index_by_fingerprint.clear();
+  m_index_by_supercell.clear();
+  m_index_by_primitive_canonical_key.clear();
+}
 
 ConfigurationSet::const_iterator ConfigurationSet::begin() const {
   return m_data.begin();
@@ -36,25 +148,47 @@ ConfigurationSet::const_iterator ConfigurationSet::end() const {
 ///     configuration_id automatically
 std::pair<ConfigurationSet::iterator, bool> ConfigurationSet::insert(
     Configuration const &configuration) {
-  auto const &superlattice = configuration.supercell->superlattice;
-  std::string supercell_name = make_supercell_name(superlattice.prim_lattice(),
-                                                   superlattice.superlattice());
-  return this->insert(supercell_name, configuration);
+  auto existing = find(configuration);
+  if (existing != end()) {
+    return std::make_pair(existing, false);
+  }
+  std::string supercell_name = make_supercell_name(
+      configuration.supercell->superlattice.transformation_matrix_to_super());
+  return _insert_new(supercell_name, configuration);
 }
 
 /// \brief Insert Configuration with known supercell_name, setting
 ///     configuration_id automatically
 std::pair<ConfigurationSet::iterator, bool> ConfigurationSet::insert(
     std::string const &supercell_name, Configuration const &configuration) {
+  auto existing = find(configuration);
+  if (existing != end()) {
+    return std::make_pair(existing, false);
+  }
+  return _insert_new(supercell_name, configuration);
+}
+
+/// \brief Insert a Configuration that is known not to be in the set
+///
+/// \param supercell_name Name of the configuration's supercell
+/// \param configuration Configuration to insert, which the caller has
+///     already checked is not in the set
+std::pair<ConfigurationSet::iterator, bool> ConfigurationSet::_insert_new(
+    std::string const &supercell_name, Configuration const &configuration) {
   auto it = m_next_config_id.find(supercell_name);
   if (it == m_next_config_id.end()) {
     it = m_next_config_id.emplace(supercell_name, 0).first;
   }
   Index &configuration_id = it->second;
 
-  auto res = m_data.insert(ConfigurationRecord(
-      configuration, supercell_name, std::to_string(configuration_id)));
+  SupercellIndex &index = m_index_by_supercell[supercell_name];
+  if (!index.name) {
+    index.name = std::make_shared<std::string const>(supercell_name);
+  }
+  auto res = m_data.insert(
+      ConfigurationRecord(configuration, index.name, configuration_id));
   if (res.second) {
+    _add_to_index(res.first);
     ++configuration_id;
   }
   return res;
@@ -63,25 +197,58 @@ std::pair<ConfigurationSet::iterator, bool> ConfigurationSet::insert(
 /// \brief Insert ConfigurationRecord, allowing custom configuration_id
 std::pair<ConfigurationSet::iterator, bool> ConfigurationSet::insert(
     ConfigurationRecord const &record) {
-  return m_data.insert(record);
+  auto existing = find(record.configuration);
+  if (existing != end()) {
+    return std::make_pair(existing, false);
+  }
+  auto res = m_data.insert(_intern(record));
+  if (res.second) {
+    _add_to_index(res.first);
+  }
+  return res;
 }
 
 ConfigurationSet::const_iterator ConfigurationSet::find(
     Configuration const &configuration) const {
-  ConfigurationRecord record(configuration, "", "");
+  auto range = m_index_by_fingerprint.equal_range(
+      make_configuration_fingerprint(configuration));
+  for (auto it = range.first; it != range.second; ++it) {
+    Configuration const &candidate = it->second->configuration;
+    if (!(candidate < configuration) && !(configuration < candidate)) {
+      return it->second;
+    }
+  }
+  if (_has_exact_fingerprint(configuration)) {
+    return end();
+  }
+  static auto const empty_name = std::make_shared<std::string const>();
+  ConfigurationRecord record(configuration, empty_name, 0);
   return m_data.find(record);
 }
 
 ConfigurationSet::const_iterator ConfigurationSet::find_by_name(
     std::string configuration_name) const {
-  auto it = this->begin();
-  auto end = this->end();
-  for (; it != end; ++it) {
-    if (it->configuration_name == configuration_name) {
-      return it;
+  auto pos = configuration_name.rfind('/');
+  if (pos == std::string::npos) {
+    return end();
+  }
+  std::optional<Index> id =
+      parse_configuration_id(configuration_name.substr(pos + 1));
+  auto index_it =
+      m_index_by_supercell.find(configuration_name.substr(0, pos));
+  if (!id.has_value() || index_it == m_index_by_supercell.end()) {
+    return end();
+  }
+
+  // if names are not unique, return the first in set order
+  auto range = index_it->second.by_id.equal_range(*id);
+  const_iterator result = end();
+  for (auto it = range.first; it != range.second; ++it) {
+    if (result == end() || *it->second < *result) {
+      result = it->second;
     }
   }
-  return end;
+  return result;
 }
 
 ConfigurationSet::size_type ConfigurationSet::count(
@@ -100,7 +267,35 @@ ConfigurationSet::size_type ConfigurationSet::count_by_name(
   return 0;
 }
 
+/// \brief Records with the given supercell name, as a contiguous range of
+///     the ordered storage
+///
+/// \param supercell_name The supercell name
+///
+/// \returns The range `[first, last)` of records with the given supercell
+///     name, in configuration order, or `[end(), end())` if there are none.
+std::pair<ConfigurationSet::const_iterator, ConfigurationSet::const_iterator>
+ConfigurationSet::supercell_range(std::string const &supercell_name) const {
+  auto index_it = m_index_by_supercell.find(supercell_name);
+  if (index_it == m_index_by_supercell.end() || index_it->second.size == 0) {
+    return std::make_pair(end(), end());
+  }
+  SupercellIndex const &index = index_it->second;
+  return std::make_pair(index.first, std::next(index.last));
+}
+
+/// \brief Number of records with the given supercell name
+ConfigurationSet::size_type ConfigurationSet::count_by_supercell(
+    std::string const &supercell_name) const {
+  auto index_it = m_index_by_supercell.find(supercell_name);
+  if (index_it == m_index_by_supercell.end()) {
+    return 0;
+  }
+  return index_it->second.size;
+}
+
 ConfigurationSet::const_iterator ConfigurationSet::erase(const_iterator it) {
+  _remove_from_index(it);
   return m_data.erase(it);
 }
 
@@ -110,7 +305,7 @@ ConfigurationSet::size_type ConfigurationSet::erase(
   if (it == end()) {
     return 0;
   }
-  m_data.erase(it);
+  erase(it);
   return 1;
 }
 
@@ -120,10 +315,75 @@ ConfigurationSet::size_type ConfigurationSet::erase_by_name(
   if (it == end()) {
     return 0;
   }
-  m_data.erase(it);
+  erase(it);
   return 1;
 }
 
+/// \brief Enable or disable the primitive canonical index
+///
+/// If enabled, the `primitive_canonical_key` of each record that does not
+/// have one is found, and the records are indexed by it. Records inserted
+/// later get a key when inserted, unless already set. If disabled, the
+/// index is erased, but records keep their keys.
+void ConfigurationSet::set_primitive_canonical_index(bool enabled) {
+  if (enabled == m_has_primitive_canonical_index) {
+    return;
+  }
+  m_has_primitive_canonical_index = enabled;
+  m_index_by_primitive_canonical_key.clear();
+  if (!enabled) {
+    return;
+  }
+  m_index_by_primitive_canonical_key.reserve(m_data.size());
+  for (auto it = m_data.begin(); it != m_data.end(); ++it) {
+    _add_to_primitive_canonical_index(it);
+  }
+}
+
+/// \brief True if the primitive canonical index is enabled
+bool ConfigurationSet::has_primitive_canonical_index() const {
+  return m_has_primitive_canonical_index;
+}
+
+/// \brief Find a record equivalent to a configuration, in any supercell
+///
+/// \param configuration A configuration, in any supercell of the prim
+///
+/// \returns A record whose primitive canonical form is equal to the
+///     primitive canonical form of `configuration`, or `end()` if there is
+///     none. Candidates are found by `make_primitive_canonical_key`, and
+///     confirmed by comparing primitive canonical forms. If there is more
+///     than one, the first in set order is returned.
+///
+/// Notes:
+/// - Throws if the primitive canonical index is not enabled.
+/// - As for `make_configuration_fingerprint`, configurations with
+///   continuous DoF that are equivalent within tolerance usually, but not
+///   always, have equal keys, so a record may not be found in rare cases.
+ConfigurationSet::const_iterator ConfigurationSet::find_primitive_canonical(
+    Configuration const &configuration) const {
+  if (!m_has_primitive_canonical_index) {
+    throw std::runtime_error(
+        "Error in ConfigurationSet::find_primitive_canonical: the primitive "
+        "canonical index is not enabled");
+  }
+  Configuration primitive_canonical =
+      make_primitive_canonical_form(configuration);
+  auto range = m_index_by_primitive_canonical_key.equal_range(
+      make_configuration_fingerprint(primitive_canonical));
+  const_iterator result = end();
+  for (auto it = range.first; it != range.second; ++it) {
+    if (result != end() && *result < *it->second) {
+      continue;
+    }
+    if (make_primitive_canonical_form(it->second->configuration) ==
+        primitive_canonical) {
+      result = it->second;
+    }
+  }
+  return result;
+}
+
 /// \brief Set IDs, by supercell_name, used to automatically ID new
 /// configurations
 void ConfigurationSet::set_next_config_id(
@@ -142,13 +402,309 @@ std::set<ConfigurationRecord> const &ConfigurationSet::data() const {
   return m_data;
 }
 
+/// \brief Rebuild the hashed indices from the ordered storage
+///
+/// Only required after inserting or erasing using the non-const `data()`.
+/// Throws if the records of a supercell are not contiguous, in which case
+/// the offending record is erased.
+void ConfigurationSet::rebuild_index() {
+  m_index_by_fingerprint.clear();
+  m_index_by_supercell.clear();
+  m_index_by_primitive_canonical_key.clear();
+  m_index_by_fingerprint.reserve(m_data.size());
+  for (auto it = m_data.begin(); it != m_data.end(); ++it) {
+    _add_to_index(it);
+  }
+}
+
+ConfigurationSet::SupercellIndex &ConfigurationSet::_supercell_index(
+    std::shared_ptr<std::string const> const &supercell_name) {
+  SupercellIndex &index = m_index_by_supercell[*supercell_name];
+  if (!index.name) {
+    index.name = supercell_name;
+  }
+  return index;
+}
+
+ConfigurationRecord ConfigurationSet::_intern(
+    ConfigurationRecord const &record) {
+  SupercellIndex &index = _supercell_index(record.supercell_name_ptr());
+  ConfigurationRecord result(record.configuration, index.name,
+                             record.configuration_id_value());
+  result.set_primitive_canonical_key(record.primitive_canonical_key());
+  return result;
+}
+
+void ConfigurationSet::_add_to_index(const_iterator it) {
+  SupercellIndex &index = _supercell_index(it->supercell_name_ptr());
+
+  // the records of each supercell must be contiguous: the neighbors of a new
+  // record must not both belong to one other supercell, and, if there are
+  // other records of its supercell, one neighbor must be one of them
+  auto _same_name = [&](const_iterator other) {
+    return other->supercell_name() == it->supercell_name();
+  };
+  std::optional<const_iterator> prev;
+  std::optional<const_iterator> next;
+  if (it != m_data.begin()) {
+    prev = std::prev(it);
+  }
+  if (std::next(it) != m_data.end()) {
+    next = std::next(it);
+  }
+  bool splits_other = prev && next && !_same_name(*prev) &&
+                      (*prev)->supercell_name() == (*next)->supercell_name();
+  bool is_adjacent =
+      (prev && _same_name(*prev)) || (next && _same_name(*next));
+  if (splits_other || (index.size > 0 && !is_adjacent)) {
+    std::string name = it->supercell_name();
+    m_data.erase(it);
+    throw std::runtime_error(
+        "Error in ConfigurationSet: records with supercell name '" + name +
+        "' are not contiguous; records with the same supercell name must "
+        "have the same supercell, and vice versa");
+  }
+
+  if (index.size == 0) {
+    index.first = it;
+    index.last = it;
+  } else if (*it < *index.first) {
+    index.first = it;
+  } else if (*index.last < *it) {
+    index.last = it;
+  }
+  ++index.size;
+  index.by_id.emplace(it->configuration_id_value(), it);
+  m_index_by_fingerprint.emplace(
+      make_configuration_fingerprint(it->configuration), it);
+  if (m_has_primitive_canonical_index) {
+    _add_to_primitive_canonical_index(it);
+  }
+}
+
+void ConfigurationSet::_add_to_primitive_canonical_index(const_iterator it) {
+  if (!it->m_primitive_canonical_key.has_value()) {
+    it->m_primitive_canonical_key =
+        make_primitive_canonical_key(it->configuration);
+  }
+  m_index_by_primitive_canonical_key.emplace(*it->m_primitive_canonical_key,
+                                             it);
+}
+
+void ConfigurationSet::_remove_from_index(const_iterator it) {
+  auto erase_from = [&](auto &index, auto const &key) {
+    auto range = index.equal_range(key);
+    for (auto index_it = range.first; index_it != range.second; ++index_it) {
+      if (index_it->second == it) {
+        index.erase(index_it);
+        return;
+      }
+    }
+  };
+  erase_from(m_index_by_fingerprint,
+             make_configuration_fingerprint(it->configuration));
+  if (m_has_primitive_canonical_index) {
+    erase_from(m_index_by_primitive_canonical_key,
+               *it->primitive_canonical_key());
+  }
+
+  SupercellIndex &index = m_index_by_supercell.at(it->supercell_name());
+  erase_from(index.by_id, it->configuration_id_value());
+  --index.size;
+  if (index.size > 0) {
+    if (it == index.first) {
+      index.first = std::next(it);
+    } else if (it == index.last) {
+      index.last = std::prev(it);
+    }
+  }
+}
+
+/// \brief Constructor
+///
+/// \param _configurations Configurations already in the set. Staged
+///     configurations found in `_configurations` are skipped. It is only
+///     read, and must not be modified until `merge_into` is called.
+/// \param _n_shards Number of independently locked shards. If
+///     `_n_shards < 1`, 1 is used.
+ConcurrentConfigurationSet::ConcurrentConfigurationSet(
+    ConfigurationSet const &_configurations, Index _n_shards)
+    : m_configurations(_configurations),
+      m_shards(std::max(Index(1), _n_shards)) {}
+
+/// \brief Stage a configuration, if it is not already in the set or staged
+///
+/// Thread safe.
+///
+/// \returns True if the configuration was staged; false if it was already
+///     in the set or already staged.
+bool ConcurrentConfigurationSet::insert(Configuration const &configuration) {
+  if (m_configurations.find(configuration) != m_configurations.end()) {
+    return false;
+  }
+  std::size_t key = _has_exact_fingerprint(configuration)
+                        ? make_configuration_fingerprint(configuration)
+                        : _supercell_hash(*configuration.supercell);
+  Shard &shard = m_shards[key % m_shards.size()];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.data.insert(configuration).second;
+}
+
+/// \brief Number of staged configurations
+///
+/// Thread safe.
+Index ConcurrentConfigurationSet::size() const {
+  Index n = 0;
+  for (Shard const &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    n += shard.data.size();
+  }
+  return n;
+}
+
+/// \brief Insert all staged configurations, in order, and clear the
+///     staged configurations
+///
+/// Notes:
+/// - Not thread safe. Must not be called concurrently with `insert`.
+/// - Staged configurations are inserted with `ConfigurationSet::insert`, in
+///   configuration order, so configuration ids are assigned
+///   deterministically.
+///
+/// \param configurations The set to insert into, usually the set given to
+///     the constructor.
+///
+/// \returns Iterators to the inserted records, in the order inserted.
+///     Configurations that were already in `configurations` are skipped.
+std::vector<ConfigurationSet::const_iterator>
+ConcurrentConfigurationSet::merge_into(ConfigurationSet &configurations) {
+  std::set<Configuration> staged;
+  for (Shard &shard : m_shards) {
+    staged.merge(shard.data);
+    shard.data.clear();
+  }
+  std::vector<ConfigurationSet::const_iterator> result;
+  for (Configuration const &configuration : staged) {
+    auto res = configurations.insert(configuration);
+    if (res.second) {
+      result.push_back(res.first);
+    }
+  }
+  return result;
+}
+
+/// \brief Estimate the memory used by a ConfigurationSet, in bytes,
+///     including its supercells if not already counted
+///
+/// \param configurations The ConfigurationSet
+/// \param context Records shared objects already counted. Each supercell
+///     is counted once, the first time it is found.
+///
+/// Includes the records, the fingerprint, name, and primitive canonical
+/// indices, and `next_config_id`.
+Index memory_usage(ConfigurationSet const &configurations,
+                   MemoryUsageContext &context) {
+  using namespace memory_usage_impl;
+  Index bytes = sizeof(ConfigurationSet);
+  std::set<std::string const *> supercell_names;
+  for (auto const &record : configurations) {
+    bytes += set_node_bytes + sizeof(ConfigurationRecord) -
+             sizeof(Configuration) +
+             memory_usage(record.configuration, context);
+
+    // fingerprint index entry, and supercell index id entry
+    bytes += 2 * hash_node_bytes + sizeof(std::size_t) + sizeof(Index) +
+             2 * sizeof(ConfigurationSet::const_iterator);
+
+    // primitive canonical index entry
+    if (configurations.has_primitive_canonical_index()) {
+      bytes += hash_node_bytes + sizeof(std::uint64_t) +
+               sizeof(ConfigurationSet::const_iterator);
+    }
+
+    // supercell index, with an interned name and its control block
+    if (supercell_names.insert(&record.supercell_name()).second) {
+      bytes += hash_node_bytes + 2 * sizeof(std::string) +
+               2 * heap_bytes(record.supercell_name()) + 2 * sizeof(long) +
+               4 * sizeof(void *) + 2 * sizeof(Index) +
+               2 * sizeof(ConfigurationSet::const_iterator);
+    }
+  }
+  for (auto const &pair : configurations.next_config_id()) {
+    bytes += set_node_bytes + sizeof(pair) + heap_bytes(pair.first);
+  }
+  return bytes;
+}
+
+/// \brief Estimate the memory used by a ConfigurationSet, in bytes,
+///     including its supercells
+///
+/// Equivalent to `memory_usage(configurations, context)`, with a new
+/// MemoryUsageContext.
+Index memory_usage(ConfigurationSet const &configurations) {
+  MemoryUsageContext context;
+  return memory_usage(configurations, context);
+}
+
+/// \brief Make a hash of a configuration's supercell and DoF values
+///
+/// Combines the supercell transformation matrix, the occupation, and
+/// continuous DoF values rounded to a multiple of the prim lattice
+/// tolerance. Equal configurations without continuous DoF always have equal
+/// fingerprints. Configurations with continuous DoF that are equal within
+/// tolerance usually, but not always, have equal fingerprints.
+std::size_t make_configuration_fingerprint(Configuration const &configuration) {
+  std::size_t seed = 0;
+  auto const &T =
+      configuration.supercell->superlattice.transformation_matrix_to_super();
+  for (Index i = 0; i < T.size(); ++i) {
+    hash_combine(seed, std::hash<long>()(T(i)));
+  }
+
+  auto const &dof_values = configuration.dof_values;
+  Eigen::VectorXi const &occupation = dof_values.occupation;
+  for (Index l = 0; l < occupation.size(); ++l) {
+    hash_combine(seed, std::hash<int>()(occupation[l]));
+  }
+
+  double tol = configuration.supercell->prim->basicstructure->lattice().tol();
+  for (auto const &pair : dof_values.global_dof_values) {
+    _hash_quantized(seed, pair.second, tol);
+  }
+  for (auto const &pair : dof_values.local_dof_values) {
+    _hash_quantized(seed, pair.second, tol);
+  }
+  return seed;
+}
+
+/// \brief Return the canonical form, in the canonical supercell, of the
+///     primitive configuration
+///
+/// Equivalent configurations have equal primitive canonical forms, even if
+/// they are in different supercells.
+Configuration make_primitive_canonical_form(
+    Configuration const &configuration) {
+  return make_in_canonical_supercell(make_primitive(configuration));
+}
+
+/// \brief Make a hash of the primitive canonical form of a configuration
+///
+/// The hash is `make_configuration_fingerprint` of
+/// `make_primitive_canonical_form(configuration)`. Equivalent
+/// configurations without continuous DoF always have equal keys, in any
+/// supercell.
+std::uint64_t make_primitive_canonical_key(Configuration const &configuration) {
+  return make_configuration_fingerprint(
+      make_primitive_canonical_form(configuration));
+}
+
 /// \brief Make a map for finding ConfigurationRecord by configuration_name
 std::map<std::string, ConfigurationRecord const *>
 make_index_by_configuration_name(
     std::set<ConfigurationRecord> const &configurations) {
   std::map<std::string, ConfigurationRecord const *> result;
   for (auto const &c : configurations) {
-    result.emplace(c.configuration_name, &c);
+    result.emplace(c.configuration_name(), &c);
   }
   return result;
 }
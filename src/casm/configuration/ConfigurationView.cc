@@ -0,0 +1,134 @@
+#include "casm/configuration/ConfigurationView.hh"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "casm/clexulator/ConfigDoFValues.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/DoFSet.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Reference the values of a ConfigDoFValues
+///
+/// \param dof_values DoF values, which must outlive the view and must not be
+///     resized while the view is in use
+ConfigDoFValuesView::ConfigDoFValuesView(
+    clexulator::ConfigDoFValues const &dof_values)
+    : occupation(dof_values.occupation.data(), dof_values.occupation.size()) {
+  for (auto const &pair : dof_values.local_dof_values) {
+    local_dof_values.emplace(
+        pair.first, Eigen::Map<Eigen::MatrixXd const>(
+                        pair.second.data(), pair.second.rows(),
+                        pair.second.cols()));
+  }
+  for (auto const &pair : dof_values.global_dof_values) {
+    global_dof_values.emplace(
+        pair.first, Eigen::Map<Eigen::VectorXd const>(pair.second.data(),
+                                                      pair.second.size()));
+  }
+}
+
+/// \brief Reference occupation values, with no continuous DoF values
+///
+/// \param _occupation Pointer to `n_sites` occupation values
+/// \param n_sites Number of sites
+ConfigDoFValuesView::ConfigDoFValuesView(int const *_occupation,
+                                         Index n_sites)
+    : occupation(_occupation, n_sites) {}
+
+/// \brief Reference the supercell and DoF values of a Configuration
+///
+/// \param configuration The configuration, which must outlive the view and
+///     must not be resized while the view is in use
+ConfigurationView::ConfigurationView(Configuration const &configuration)
+    : supercell(configuration.supercell),
+      dof_values(configuration.dof_values) {}
+
+/// \brief Reference DoF values in external buffers
+///
+/// \param _supercell The supercell
+/// \param occupation Pointer to the `n_sites` occupation values, where
+///     `n_sites` is the number of sites in `_supercell`
+/// \param local_dof_values Pointers to the column-major, `(max DoF
+///     dimension, n_sites)` values of each local continuous DoF of the prim,
+///     in the prim basis
+/// \param global_dof_values Pointers to the values of each global continuous
+///     DoF of the prim, in the prim basis
+///
+/// Throws if the DoF types do not match the DoF types of the prim.
+ConfigurationView::ConfigurationView(
+    std::shared_ptr<Supercell const> const &_supercell, int const *occupation,
+    std::map<DoFKey, double const *> const &local_dof_values,
+    std::map<DoFKey, double const *> const &global_dof_values)
+    : supercell(_supercell),
+      dof_values(occupation,
+                 _supercell->prim->basicstructure->basis().size() *
+                     _supercell->superlattice.size()) {
+  Prim const &prim = *supercell->prim;
+  Index n_sites = dof_values.occupation.size();
+  if (local_dof_values.size() != prim.local_dof_info.size() ||
+      global_dof_values.size() != prim.global_dof_info.size()) {
+    throw std::runtime_error(
+        "Error constructing ConfigurationView: DoF types do not match the "
+        "prim");
+  }
+  for (auto const &pair : prim.local_dof_info) {
+    auto it = local_dof_values.find(pair.first);
+    if (it == local_dof_values.end()) {
+      throw std::runtime_error(
+          "Error constructing ConfigurationView: missing local DoF values "
+          "for '" +
+          pair.first + "'");
+    }
+    Index dim = 0;
+    for (auto const &site_dof_set : pair.second) {
+      dim = std::max(dim, Index(site_dof_set.dim()));
+    }
+    dof_values.local_dof_values.emplace(
+        pair.first, Eigen::Map<Eigen::MatrixXd const>(it->second, dim,
+                                                      n_sites));
+  }
+  for (auto const &pair : prim.global_dof_info) {
+    auto it = global_dof_values.find(pair.first);
+    if (it == global_dof_values.end()) {
+      throw std::runtime_error(
+          "Error constructing ConfigurationView: missing global DoF values "
+          "for '" +
+          pair.first + "'");
+    }
+    dof_values.global_dof_values.emplace(
+        pair.first,
+        Eigen::Map<Eigen::VectorXd const>(it->second, pair.second.dim()));
+  }
+}
+
+/// \brief Copy the DoF values referenced by a view into a Configuration
+Configuration make_configuration(ConfigurationView const &view) {
+  clexulator::ConfigDoFValues dof_values;
+  dof_values.occupation = view.dof_values.occupation;
+  for (auto const &pair : view.dof_values.local_dof_values) {
+    dof_values.local_dof_values.emplace(pair.first, pair.second);
+  }
+  for (auto const &pair : view.dof_values.global_dof_values) {
+    dof_values.global_dof_values.emplace(pair.first, pair.second);
+  }
+  return Configuration(view.supercell, dof_values);
+}
+
+/// \brief Apply a symmetry operation to the configuration referenced by a
+///     view, giving a new Configuration
+Configuration copy_apply(SupercellSymOp const &op,
+                         ConfigurationView const &view) {
+  Configuration configuration = make_configuration(view);
+  apply(op, configuration);
+  return configuration;
+}
+
+}  // namespace config
+}  // namespace CASM
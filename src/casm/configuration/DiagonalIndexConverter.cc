@@ -0,0 +1,217 @@
+#include "casm/configuration/DiagonalIndexConverter.hh"
+
+#include <stdexcept>
+
+#include "casm/crystallography/LinearIndexConverter.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// \brief Return x mod n, in [0, n)
+Index _mod(Index x, Index n) {
+  x %= n;
+  return x < 0 ? x + n : x;
+}
+
+/// \brief Return log2(n) if n is a power of two, else -1
+Index _log2(Index n) {
+  Index result = 0;
+  while ((Index(1) << result) < n) {
+    ++result;
+  }
+  return (Index(1) << result) == n ? result : -1;
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param transformation_matrix_to_super The transformation matrix, which
+///     must be diagonal
+/// \param unitcell_index_converter The supercell's UnitCell and linear unit
+///     cell index conversions
+/// \param unitcellcoord_index_converter The supercell's UnitCellCoord and
+///     linear site index conversions
+DiagonalIndexConverter::DiagonalIndexConverter(
+    Eigen::Matrix3l const &transformation_matrix_to_super,
+    xtal::UnitCellIndexConverter const &unitcell_index_converter,
+    xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter)
+    : m_shape(transformation_matrix_to_super.diagonal().cwiseAbs()),
+      m_is_power_of_two(true),
+      m_shift(Eigen::Vector3l::Zero()),
+      m_n_unitcells(unitcell_index_converter.total_sites()),
+      m_n_sublat(0) {
+  if (!is_diagonal(transformation_matrix_to_super)) {
+    throw std::runtime_error(
+        "Error in DiagonalIndexConverter: transformation matrix is not "
+        "diagonal");
+  }
+  if (m_n_unitcells != m_shape.prod()) {
+    throw std::runtime_error(
+        "Error in DiagonalIndexConverter: unitcell_index_converter does not "
+        "match the transformation matrix");
+  }
+  m_n_sublat = unitcellcoord_index_converter.total_sites() / m_n_unitcells;
+
+  Eigen::Vector3l log2_shape;
+  for (Index i = 0; i < 3; ++i) {
+    log2_shape(i) = _log2(m_shape(i));
+    m_is_power_of_two = m_is_power_of_two && log2_shape(i) >= 0;
+  }
+  if (m_is_power_of_two) {
+    m_shift << log2_shape(1) + log2_shape(2), log2_shape(2), 0;
+  }
+
+  m_grid_to_unitcell.resize(m_n_unitcells);
+  m_unitcell_to_grid.resize(m_n_unitcells);
+  for (Index i = 0; i < m_shape(0); ++i) {
+    for (Index j = 0; j < m_shape(1); ++j) {
+      for (Index k = 0; k < m_shape(2); ++k) {
+        Index g = _grid_index(i, j, k);
+        Index u = unitcell_index_converter(UnitCell(i, j, k));
+        m_grid_to_unitcell[g] = u;
+        m_unitcell_to_grid[u] = g;
+      }
+    }
+  }
+
+  // linear site indices are expected to be sublattice-major
+  for (Index b = 0; b < m_n_sublat; ++b) {
+    for (Index u : {Index(0), m_n_unitcells - 1}) {
+      UnitCellCoord bijk(b, unitcell_index_converter(u));
+      if (unitcellcoord_index_converter(bijk) != b * m_n_unitcells + u) {
+        throw std::runtime_error(
+            "Error in DiagonalIndexConverter: unexpected linear site index "
+            "order");
+      }
+    }
+  }
+}
+
+/// \brief Return true if a transformation matrix is diagonal
+///
+/// \param transformation_matrix_to_super A non-singular transformation
+///     matrix
+bool DiagonalIndexConverter::is_diagonal(
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  Eigen::Matrix3l const &T = transformation_matrix_to_super;
+  for (Index i = 0; i < 3; ++i) {
+    for (Index j = 0; j < 3; ++j) {
+      if ((i == j) == (T(i, j) == 0)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/// \brief Linear unit cell index of a unit cell, brought within the
+///     supercell
+///
+/// Equivalent to `unitcell_index_converter(unitcell)`.
+Index DiagonalIndexConverter::linear_unitcell_index(
+    UnitCell const &unitcell) const {
+  return m_grid_to_unitcell[_grid_index(unitcell(0), unitcell(1),
+                                        unitcell(2))];
+}
+
+/// \brief Linear site index of a site, brought within the supercell
+///
+/// Equivalent to `unitcellcoord_index_converter(bijk)`.
+Index DiagonalIndexConverter::linear_site_index(
+    UnitCellCoord const &bijk) const {
+  return bijk.sublattice() * m_n_unitcells +
+         linear_unitcell_index(bijk.unitcell());
+}
+
+/// \brief Linear site index of site `l` translated by a supercell
+///     translation
+///
+/// Equivalent to `unitcellcoord_index_converter(
+/// unitcellcoord_index_converter(l) +
+/// unitcell_index_converter(translation_index))`.
+///
+/// \param l Site index in range [0, n_sites)
+/// \param translation_index Index in range [0, n_unitcells)
+Index DiagonalIndexConverter::translate_site_index(
+    Index l, Index translation_index) const {
+  Index b = l / m_n_unitcells;
+  Index u = l - b * m_n_unitcells;
+  Index g = _add(m_unitcell_to_grid[u], m_unitcell_to_grid[translation_index],
+                 false);
+  return b * m_n_unitcells + m_grid_to_unitcell[g];
+}
+
+/// \brief Construct a single supercell translation permutation
+///
+/// Equivalent to `make_translation_permutation(translation_index,
+/// unitcell_index_converter, unitcellcoord_index_converter)`.
+///
+/// \param translation_index Index in range [0, n_unitcells)
+sym_info::Permutation DiagonalIndexConverter::make_translation_permutation(
+    Index translation_index) const {
+  sym_info::Permutation permutation(n_sites());
+  Index t = m_unitcell_to_grid[translation_index];
+  for (Index u = 0; u < m_n_unitcells; ++u) {
+    Index new_u = m_grid_to_unitcell[_add(m_unitcell_to_grid[u], t, false)];
+    for (Index b = 0; b < m_n_sublat; ++b) {
+      permutation[b * m_n_unitcells + new_u] = b * m_n_unitcells + u;
+    }
+  }
+  return permutation;
+}
+
+/// \brief Return `make_translation_permutation(translation_index)[i]`,
+///     without constructing the permutation
+///
+/// \param translation_index Index in range [0, n_unitcells)
+/// \param i Site index in range [0, n_sites)
+Index DiagonalIndexConverter::translation_permute_index(Index translation_index,
+                                                        Index i) const {
+  Index b = i / m_n_unitcells;
+  Index u = i - b * m_n_unitcells;
+  Index g = _add(m_unitcell_to_grid[u], m_unitcell_to_grid[translation_index],
+                 true);
+  return b * m_n_unitcells + m_grid_to_unitcell[g];
+}
+
+/// \brief Memory used by the index tables, in bytes
+Index DiagonalIndexConverter::size_bytes() const {
+  return (m_grid_to_unitcell.capacity() + m_unitcell_to_grid.capacity()) *
+         sizeof(Index);
+}
+
+/// \brief Grid index of the grid coordinate `(i, j, k)`, reduced
+Index DiagonalIndexConverter::_grid_index(Index i, Index j, Index k) const {
+  if (m_is_power_of_two) {
+    // two's complement masks reduce negative values correctly
+    return ((i & (m_shape(0) - 1)) << m_shift(0)) |
+           ((j & (m_shape(1) - 1)) << m_shift(1)) | (k & (m_shape(2) - 1));
+  }
+  return (_mod(i, m_shape(0)) * m_shape(1) + _mod(j, m_shape(1))) *
+             m_shape(2) +
+         _mod(k, m_shape(2));
+}
+
+/// \brief Grid index of the sum, or difference, of grid indices
+Index DiagonalIndexConverter::_add(Index g, Index h, bool subtract) const {
+  Index s = subtract ? -1 : 1;
+  if (m_is_power_of_two) {
+    return _grid_index(
+        (g >> m_shift(0)) + s * (h >> m_shift(0)),
+        ((g >> m_shift(1)) & (m_shape(1) - 1)) +
+            s * ((h >> m_shift(1)) & (m_shape(1) - 1)),
+        (g & (m_shape(2) - 1)) + s * (h & (m_shape(2) - 1)));
+  }
+  Index n12 = m_shape(1) * m_shape(2);
+  return _grid_index(g / n12 + s * (h / n12),
+                     (g / m_shape(2)) % m_shape(1) +
+                         s * ((h / m_shape(2)) % m_shape(1)),
+                     g % m_shape(2) + s * (h % m_shape(2)));
+}
+
+}  // namespace config
+}  // namespace CASM
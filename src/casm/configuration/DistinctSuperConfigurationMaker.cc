@@ -0,0 +1,224 @@
+#include "casm/configuration/DistinctSuperConfigurationMaker.hh"
+
+#include <cstdint>
+#include <optional>
+
+#include "casm/configuration/ConfigurationFingerprint.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/Lattice.hh"
+#include "casm/crystallography/SymTools.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param motif The motif configuration
+DistinctSuperConfigurationMaker::DistinctSuperConfigurationMaker(
+    Configuration const &motif)
+    : m_prim_motif(make_primitive(motif)) {}
+
+/// \brief The primitive motif configuration
+Configuration const &DistinctSuperConfigurationMaker::prim_motif() const {
+  return m_prim_motif;
+}
+
+/// \brief Return prim factor group indices that create tilings of the
+///     motif into a supercell that are not equivalent under supercell
+///     factor group operations
+///
+/// Same as `unique_generating_prim_factor_group_indices(prim_motif, motif,
+/// supercell)`.
+std::set<Index>
+DistinctSuperConfigurationMaker::unique_generating_prim_factor_group_indices(
+    std::shared_ptr<Supercell const> const &supercell) const {
+  Prim const &prim = *m_prim_motif.supercell->prim;
+  SymGroup const &prim_fg = *prim.sym_info.factor_group;
+  xtal::Lattice prim_motif_lattice =
+      m_prim_motif.supercell->superlattice.superlattice();
+  xtal::Lattice supercell_lattice = supercell->superlattice.superlattice();
+  double xtal_tol = prim.basicstructure->lattice().tol();
+
+  std::set<Index> unique_generating_prim_fg_op;
+  for (Index i : _double_coset_representatives(
+           supercell->sym_info.factor_group->head_group_index)) {
+    // If prim_fg_op * prim_motif doesn't fill supercell, skip
+    auto test_lattice = sym::copy_apply(prim_fg.element[i], prim_motif_lattice);
+    if (!is_superlattice(supercell_lattice, test_lattice, xtal_tol).first) {
+      continue;
+    }
+    unique_generating_prim_fg_op.insert(i);
+  }
+  return unique_generating_prim_fg_op;
+}
+
+/// \brief Make the distinct super configurations of the motif in a
+///     supercell
+///
+/// Same as `make_distinct_super_configurations(motif, supercell)`.
+std::vector<Configuration> DistinctSuperConfigurationMaker::operator()(
+    std::shared_ptr<Supercell const> const &supercell) const {
+  std::vector<Configuration> distinct;
+  UnitCell trans(0, 0, 0);
+  UnitCell origin(0, 0, 0);
+  for (Index prim_fg_op :
+       unique_generating_prim_factor_group_indices(supercell)) {
+    distinct.push_back(
+        copy_configuration(prim_fg_op, trans, m_prim_motif, supercell, origin));
+  }
+  return distinct;
+}
+
+/// \brief Number of distinct supercell factor groups seen so far
+Index DistinctSuperConfigurationMaker::n_cached_factor_groups() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_double_coset_representatives.size();
+}
+
+/// \brief Return the prim factor group indices that are minimal in their
+///     double coset, computing them on first use for a supercell factor
+///     group
+///
+/// Keep prim_fg_op if it is the minimum of all the combined ops:
+///
+///     supercell_fg_op * prim_fg_op * prim_motif_supercell_fg_op.
+///
+/// Found without holding the lock, so if two threads see a new supercell
+/// factor group at the same time both compute the same result.
+std::vector<Index> const &
+DistinctSuperConfigurationMaker::_double_coset_representatives(
+    std::vector<Index> const &supercell_head_group_index) const {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_double_coset_representatives.find(supercell_head_group_index);
+    if (it != m_double_coset_representatives.end()) {
+      return it->second;
+    }
+  }
+
+  SymGroup const &prim_fg =
+      *m_prim_motif.supercell->prim->sym_info.factor_group;
+  std::vector<Index> const &prim_motif_head_group_index =
+      m_prim_motif.supercell->sym_info.factor_group->head_group_index;
+  auto is_minimal = [&](Index prim_fg_op) {
+    for (Index supercell_fg_op : supercell_head_group_index) {
+      for (Index prim_motif_scel_fg_op : prim_motif_head_group_index) {
+        Index combined_op = prim_fg.mult(
+            supercell_fg_op, prim_fg.mult(prim_fg_op, prim_motif_scel_fg_op));
+        if (combined_op < prim_fg_op) {
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+  std::vector<Index> representatives;
+  for (Index i = 0; i < prim_fg.element.size(); ++i) {
+    if (is_minimal(i)) {
+      representatives.push_back(i);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  // std::map references stay valid as other elements are inserted
+  return m_double_coset_representatives
+      .emplace(supercell_head_group_index, std::move(representatives))
+      .first->second;
+}
+
+/// \brief Make the distinct super configurations of a motif in each of many
+///     supercells, in parallel
+///
+/// \param motif The motif configuration
+/// \param supercells The supercells to fill
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns The configurations `result[i]` are the same as
+///     `make_distinct_super_configurations(motif, supercells[i])`. The
+///     result does not depend on `n_threads`.
+std::vector<std::vector<Configuration>> make_distinct_super_configurations(
+    Configuration const &motif,
+    std::vector<std::shared_ptr<Supercell const>> const &supercells,
+    Index n_threads) {
+  DistinctSuperConfigurationMaker f(motif);
+  std::vector<std::vector<Configuration>> result(supercells.size());
+  parallel_for_items(supercells.size(), n_threads,
+                     [&](Index i) { result[i] = f(supercells[i]); });
+  return result;
+}
+
+/// \brief Make distinct super configurations of a motif, without changing
+///     the motif orientation, in all supercells equivalent to those given
+///
+/// Method:
+/// - For each supercell given, equivalent supercells with respect to the
+///   prim point group are constructed, in parallel. If `supercell_set` is
+///   not null, they are added to it and the shared supercell in the set is
+///   used.
+/// - For each equivalent supercell that the motif tiles exactly, a super
+///   configuration is made with `copy_configuration` and its fingerprint is
+///   calculated, in parallel.
+/// - Super configurations are inserted into `finder` in order, and those
+///   that are distinct are returned.
+///
+/// \param motif The motif configuration
+/// \param supercells The initial supercells
+/// \param finder Finds distinct configurations. Configurations already in
+///     `finder` are excluded, so it may be used across calls.
+/// \param supercell_set If not null, equivalent supercells are added
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns The distinct super configurations, in the same order as by
+///     `SuperConfigEnum.by_supercell_list` with the same `finder`. The
+///     result does not depend on `n_threads`.
+std::vector<Configuration> make_fixed_orientation_super_configurations(
+    Configuration const &motif,
+    std::vector<std::shared_ptr<Supercell const>> const &supercells,
+    DistinctConfigurationFinder &finder, SupercellSet *supercell_set,
+    Index n_threads) {
+  std::vector<std::vector<std::shared_ptr<Supercell const>>> equivalents =
+      make_equivalents(supercells, n_threads);
+
+  std::vector<std::shared_ptr<Supercell const>> all;
+  for (auto &_equivalents : equivalents) {
+    for (auto &equiv : _equivalents) {
+      if (supercell_set != nullptr) {
+        all.push_back(supercell_set->insert(equiv).first->supercell);
+      } else {
+        all.push_back(std::move(equiv));
+      }
+    }
+  }
+
+  xtal::Lattice motif_lattice = motif.supercell->superlattice.superlattice();
+  double xtal_tol = motif_lattice.tol();
+  std::vector<std::optional<Configuration>> super(all.size());
+  std::vector<std::uint64_t> fingerprint(all.size());
+  parallel_for_items(all.size(), n_threads, [&](Index i) {
+    xtal::Lattice const &lattice = all[i]->superlattice.superlattice();
+    if (!is_superlattice(lattice, motif_lattice, xtal_tol).first) {
+      return;
+    }
+    super[i] = copy_configuration(motif, all[i]);
+    fingerprint[i] = finder.calculator()(*super[i]);
+  });
+
+  std::vector<Configuration> result;
+  for (Index i = 0; i < all.size(); ++i) {
+    if (super[i].has_value() && finder.insert(*super[i], fingerprint[i])) {
+      result.push_back(std::move(*super[i]));
+    }
+  }
+  return result;
+}
+
+}  // namespace config
+}  // namespace CASM
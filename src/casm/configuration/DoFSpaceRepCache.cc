@@ -0,0 +1,145 @@
+#include "casm/configuration/DoFSpaceRepCache.hh"
+
+#include <cmath>
+
+#include "casm/clexulator/DoFSpace.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/hash.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief Hash of values rounded to a multiple of `tol`
+void _hash_quantized(std::size_t &seed, Eigen::MatrixXd const &M, double tol) {
+  hash_combine(seed, M.rows());
+  hash_combine(seed, M.cols());
+  for (Index i = 0; i < M.size(); ++i) {
+    hash_combine(seed, std::hash<long long>()(std::llround(M(i) / tol)));
+  }
+}
+
+bool _is_equal(Eigen::MatrixXd const &A, Eigen::MatrixXd const &B,
+               double tol) {
+  return A.rows() == B.rows() && A.cols() == B.cols() &&
+         CASM::almost_equal(A, B, tol);
+}
+
+bool _is_same_supercell(std::shared_ptr<Supercell const> const &A,
+                        std::shared_ptr<Supercell const> const &B) {
+  return A == B || (!(*A < *B) && !(*B < *A));
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param _tol Tolerance used to compare DoFSpace basis
+DoFSpaceRepCache::DoFSpaceRepCache(double _tol) : m_tol(_tol) {}
+
+/// \brief Return a stored DoFSpace matrix representation with the same
+///     inputs, or construct, store, and return a new one
+///
+/// Parameters and the result are as for `make_dof_space_rep`.
+///
+/// The lock is not held while a new representation is constructed, so
+/// concurrent calls with the same inputs may each construct it. Only the
+/// first result stored is kept and returned.
+std::shared_ptr<std::vector<Eigen::MatrixXd> const> DoFSpaceRepCache::make(
+    std::vector<SupercellSymOp> const &group,
+    clexulator::DoFSpace const &dof_space) {
+  if (group.size() == 0) {
+    throw std::runtime_error(
+        "Error in DoFSpaceRepCache::make: group has size==0.");
+  }
+  std::shared_ptr<Supercell const> const &supercell =
+      group.begin()->supercell();
+  std::vector<std::pair<Index, Index>> group_index;
+  group_index.reserve(group.size());
+  for (SupercellSymOp const &op : group) {
+    group_index.emplace_back(op.supercell_factor_group_index(),
+                             op.translation_index());
+  }
+
+  std::size_t key = _hash(group_index, dof_space);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = _find(key, supercell, group_index, dof_space);
+    if (found) {
+      return found;
+    }
+  }
+
+  auto result = std::make_shared<std::vector<Eigen::MatrixXd> const>(
+      make_dof_space_rep(group, dof_space));
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto found = _find(key, supercell, group_index, dof_space);
+  if (found) {
+    return found;
+  }
+  m_entries.emplace(key, Entry{supercell, std::move(group_index),
+                               dof_space.dof_key, dof_space.sites,
+                               dof_space.basis, result});
+  return result;
+}
+
+/// \brief Tolerance used to compare inputs
+double DoFSpaceRepCache::tol() const { return m_tol; }
+
+/// \brief Number of stored results
+Index DoFSpaceRepCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Erase stored results
+void DoFSpaceRepCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+std::size_t DoFSpaceRepCache::_hash(
+    std::vector<std::pair<Index, Index>> const &group_index,
+    clexulator::DoFSpace const &dof_space) const {
+  std::size_t seed = group_index.size();
+  for (auto const &pair : group_index) {
+    hash_combine(seed, std::hash<Index>()(pair.first));
+    hash_combine(seed, std::hash<Index>()(pair.second));
+  }
+  hash_combine(seed, std::hash<std::string>()(dof_space.dof_key));
+  if (dof_space.sites.has_value()) {
+    hash_combine(seed, dof_space.sites->size());
+    for (Index i : *dof_space.sites) {
+      hash_combine(seed, std::hash<Index>()(i));
+    }
+  }
+  _hash_quantized(seed, dof_space.basis, m_tol);
+  return seed;
+}
+
+/// \brief Return the stored result with the given inputs, or nullptr
+///
+/// Requires the lock to be held.
+std::shared_ptr<std::vector<Eigen::MatrixXd> const> DoFSpaceRepCache::_find(
+    std::size_t key, std::shared_ptr<Supercell const> const &supercell,
+    std::vector<std::pair<Index, Index>> const &group_index,
+    clexulator::DoFSpace const &dof_space) const {
+  auto range = m_entries.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    Entry const &entry = it->second;
+    if (entry.dof_key == dof_space.dof_key &&
+        entry.sites == dof_space.sites && entry.group == group_index &&
+        _is_equal(entry.basis, dof_space.basis, m_tol) &&
+        _is_same_supercell(entry.supercell, supercell)) {
+      return entry.result;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace config
+}  // namespace CASM
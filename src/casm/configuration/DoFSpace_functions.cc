@@ -1,20 +1,92 @@
 #include "casm/configuration/DoFSpace_functions.hh"
 
+#include "casm/configuration/parallel.hh"
+
 namespace CASM {
 namespace config {
 
+namespace {
+
+/// \brief Set basis rows for default occupants to zero, and then remove
+///     columns that are entirely zero
+///
+/// \param dof_space Initial DoF space
+/// \param is_default_row If `is_default_row[i]`, basis row `i` is set to
+///     zero
+/// \param n_threads Number of threads. Columns are processed in contiguous
+///     chunks, in parallel. The result does not depend on `n_threads`.
+///
+/// The basis is not copied as a whole: each column is checked, with default
+/// rows set to zero, and then only the non-zero columns are copied to the
+/// result. For the block structure of an occupation DoF space, where each
+/// column has non-zero values on one or a few sites, most of the work is
+/// the column check.
+clexulator::DoFSpace _exclude_default_occ_rows(
+    clexulator::DoFSpace const &dof_space,
+    std::vector<bool> const &is_default_row, Index n_threads) {
+  Eigen::MatrixXd const &basis = dof_space.basis;
+  std::vector<Index> default_rows;
+  for (Index i = 0; i < basis.rows(); ++i) {
+    if (is_default_row[i]) {
+      default_rows.push_back(i);
+    }
+  }
+
+  // Find non-zero columns
+  std::vector<char> is_non_zero_col(basis.cols(), 0);
+  parallel_for_chunks(
+      basis.cols(), n_threads, [&](Index col_begin, Index col_end) {
+        Eigen::VectorXd col;
+        for (Index j = col_begin; j < col_end; ++j) {
+          col = basis.col(j);
+          for (Index i : default_rows) {
+            col(i) = 0.0;
+          }
+          is_non_zero_col[j] = !almost_zero(col);
+        }
+      });
+
+  std::vector<Index> non_zero_cols;
+  for (Index j = 0; j < basis.cols(); ++j) {
+    if (is_non_zero_col[j]) {
+      non_zero_cols.push_back(j);
+    }
+  }
+
+  // Copy non-zero columns
+  Eigen::MatrixXd tbasis(basis.rows(), non_zero_cols.size());
+  parallel_for_chunks(
+      non_zero_cols.size(), n_threads, [&](Index col_begin, Index col_end) {
+        for (Index k = col_begin; k < col_end; ++k) {
+          tbasis.col(k) = basis.col(non_zero_cols[k]);
+          for (Index i : default_rows) {
+            tbasis(i, k) = 0.0;
+          }
+        }
+      });
+
+  // Construct with only non-zero columns
+  return clexulator::make_dof_space(dof_space.dof_key, dof_space.prim,
+                                    dof_space.transformation_matrix_to_super,
+                                    dof_space.sites, tbasis);
+}
+
+}  // namespace
+
 /// Removes specified occupation modes from the DoFSpace basis, by sublattice
 ///
 /// \param dof_space Initial DoF space
 /// \param sublattice_index_to_default_occ Table of prim sublattice index to
 /// occupation
 ///     index to treat as the default occupant and remove
+/// \param n_threads Number of threads used to check and copy basis columns. If
+///     `n_threads <= 0`, use the number of threads set by `set_num_threads`.
 /// \return DoFSpace with basis updated by setting rows corresponding to the
 /// default
 ///     occupant to zero, and then columns that are entirely zero are removed.
 clexulator::DoFSpace exclude_default_occ_modes_by_sublattice(
     clexulator::DoFSpace const &dof_space,
-    std::map<int, int> sublattice_index_to_default_occ) {
+    std::map<int, int> sublattice_index_to_default_occ, Index n_threads) {
   if (dof_space.dof_key != "occ") {
     throw std::runtime_error(
         "Error in exclude_default_occ_modes_by_sublattice: Not occupation DoF");
@@ -56,42 +128,22 @@ clexulator::DoFSpace exclude_default_occ_modes_by_sublattice(
     }
   }
 
-  // Copy current basis
-  Eigen::MatrixXd basis = dof_space.basis;
-
-  // Set rows to zero which correspond to default occ
+  // Find rows which correspond to default occ; the sublattice of each site
+  // is found once
   std::vector<Index> const &site_index = *dof_space.axis_info.site_index;
   std::vector<Index> const &occ_index = *dof_space.axis_info.dof_component;
-  for (Index i = 0; i < basis.rows(); ++i) {
-    Index l = site_index[i];
-    int b = l_to_bijk(l).sublattice();
-    auto it = sublattice_index_to_default_occ.find(b);
-    if (it == sublattice_index_to_default_occ.end()) {
-      continue;
-    }
-    int default_occ = it->second;
-    if (occ_index[i] == default_occ) {
-      for (Index j = 0; j < basis.cols(); ++j) {
-        basis(i, j) = 0.0;
-      }
+  std::vector<int> default_occ(l_to_bijk.total_sites(), -1);
+  for (Index l = 0; l < l_to_bijk.total_sites(); ++l) {
+    auto it = sublattice_index_to_default_occ.find(l_to_bijk(l).sublattice());
+    if (it != sublattice_index_to_default_occ.end()) {
+      default_occ[l] = it->second;
     }
   }
-
-  // Copy non-zero columns
-  Eigen::MatrixXd tbasis(basis.rows(), basis.cols());
-  Index non_zero_cols = 0;
-  for (Index j = 0; j < basis.cols(); ++j) {
-    if (!almost_zero(basis.col(j))) {
-      tbasis.col(non_zero_cols) = basis.col(j);
-      ++non_zero_cols;
-    }
+  std::vector<bool> is_default_row(dof_space.basis.rows(), false);
+  for (Index i = 0; i < dof_space.basis.rows(); ++i) {
+    is_default_row[i] = (occ_index[i] == default_occ[site_index[i]]);
   }
-
-  // Construct with only non-zero columns
-  return clexulator::make_dof_space(dof_space.dof_key, dof_space.prim,
-                                    dof_space.transformation_matrix_to_super,
-                                    dof_space.sites,
-                                    tbasis.leftCols(non_zero_cols));
+  return _exclude_default_occ_rows(dof_space, is_default_row, n_threads);
 }
 
 /// Removes specified occupation modes from the DoFSpace basis, by supercell
@@ -100,12 +152,14 @@ clexulator::DoFSpace exclude_default_occ_modes_by_sublattice(
 /// \param dof_space Initial DoF space
 /// \param site_index_to_default_occ Table of supercell site index to occupation
 ///     index to treat as the default occupant and remove
+/// \param n_threads Number of threads used to check and copy basis columns. If
+///     `n_threads <= 0`, use the number of threads set by `set_num_threads`.
 /// \return DoFSpace with basis updated by setting rows corresponding to the
 /// default
 ///     occupant to zero, and then columns that are entirely zero are removed.
 clexulator::DoFSpace exclude_default_occ_modes_by_site(
     clexulator::DoFSpace const &dof_space,
-    std::map<Index, int> site_index_to_default_occ) {
+    std::map<Index, int> site_index_to_default_occ, Index n_threads) {
   if (dof_space.dof_key != "occ") {
     throw std::runtime_error(
         "Error in exclude_default_occ_modes_by_site: Not occupation DoF");
@@ -149,41 +203,17 @@ clexulator::DoFSpace exclude_default_occ_modes_by_site(
     }
   }
 
-  // Copy current basis
-  Eigen::MatrixXd basis = dof_space.basis;
-
-  // Set rows to zero which correspond to default occ
+  // Find rows which correspond to default occ
   std::vector<Index> const &site_index = *dof_space.axis_info.site_index;
   std::vector<Index> const &occ_index = *dof_space.axis_info.dof_component;
-  for (Index i = 0; i < basis.rows(); ++i) {
-    Index l = site_index[i];
-    auto it = site_index_to_default_occ.find(l);
-    if (it == site_index_to_default_occ.end()) {
-      continue;
-    }
-    int default_occ = it->second;
-    if (occ_index[i] == default_occ) {
-      for (Index j = 0; j < basis.cols(); ++j) {
-        basis(i, j) = 0.0;
-      }
+  std::vector<bool> is_default_row(dof_space.basis.rows(), false);
+  for (Index i = 0; i < dof_space.basis.rows(); ++i) {
+    auto it = site_index_to_default_occ.find(site_index[i]);
+    if (it != site_index_to_default_occ.end()) {
+      is_default_row[i] = (occ_index[i] == it->second);
     }
   }
-
-  // Copy non-zero columns
-  Eigen::MatrixXd tbasis(basis.rows(), basis.cols());
-  Index non_zero_cols = 0;
-  for (Index j = 0; j < basis.cols(); ++j) {
-    if (!almost_zero(basis.col(j))) {
-      tbasis.col(non_zero_cols) = basis.col(j);
-      ++non_zero_cols;
-    }
-  }
-
-  // Construct with only non-zero columns
-  return clexulator::make_dof_space(dof_space.dof_key, dof_space.prim,
-                                    dof_space.transformation_matrix_to_super,
-                                    dof_space.sites,
-                                    tbasis.leftCols(non_zero_cols));
+  return _exclude_default_occ_rows(dof_space, is_default_row, n_threads);
 }
 
 /// Removes specified occupation modes from the DoFSpace basis
@@ -205,18 +235,34 @@ clexulator::DoFSpace exclude_default_occ_modes_by_site(
 ///     occupation index (value), specified by sublattice index (key).
 /// \param site_index_to_default_occ Optional values of default
 ///     occupation index (value), specified by supercell site index (key).
-
+/// \param n_threads Number of threads used to check and copy basis columns. If
+///     `n_threads <= 0`, use the number of threads set by `set_num_threads`.
+///
+/// If neither `site_index_to_default_occ` nor
+/// `sublattice_index_to_default_occ` is provided, the result is the same as
+/// `clexulator::exclude_default_occ_modes`, but found using the same
+/// column-wise method as with the tables.
 clexulator::DoFSpace exclude_default_occ_modes(
     clexulator::DoFSpace const &dof_space_in, bool include_default_occ_modes,
     std::optional<std::map<int, int>> sublattice_index_to_default_occ,
-    std::optional<std::map<Index, int>> site_index_to_default_occ) {
+    std::optional<std::map<Index, int>> site_index_to_default_occ,
+    Index n_threads) {
   if (dof_space_in.dof_key == "occ" && !include_default_occ_modes) {
     if (site_index_to_default_occ.has_value()) {
-      return exclude_default_occ_modes_by_site(dof_space_in,
-                                               *site_index_to_default_occ);
+      return exclude_default_occ_modes_by_site(
+          dof_space_in, *site_index_to_default_occ, n_threads);
     } else if (sublattice_index_to_default_occ.has_value()) {
       return exclude_default_occ_modes_by_sublattice(
-          dof_space_in, *sublattice_index_to_default_occ);
+          dof_space_in, *sublattice_index_to_default_occ, n_threads);
+    } else if (dof_space_in.axis_info.dof_component.has_value()) {
+      std::vector<Index> const &occ_index =
+          *dof_space_in.axis_info.dof_component;
+      std::vector<bool> is_default_row(dof_space_in.basis.rows(), false);
+      for (Index i = 0; i < dof_space_in.basis.rows(); ++i) {
+        is_default_row[i] = (occ_index[i] == 0);
+      }
+      return _exclude_default_occ_rows(dof_space_in, is_default_row,
+                                       n_threads);
     } else {
       return clexulator::exclude_default_occ_modes(dof_space_in);
     }
@@ -8,6 +8,7 @@
 #include "casm/configuration/SupercellSet.hh"
 #include "casm/configuration/definitions.hh"
 #include "casm/configuration/misc.hh"
+#include "casm/configuration/parallel.hh"
 #include "casm/crystallography/SimpleStructure.hh"
 #include "casm/crystallography/StrainConverter.hh"
 #include "casm/misc/Comparisons.hh"
@@ -16,7 +17,16 @@ namespace CASM {
 namespace config {
 
 FromStructure::FromStructure(std::shared_ptr<Prim const> const &_prim)
-    : m_prim(_prim), m_xtal_prim(m_prim->basicstructure) {}
+    : m_prim(_prim), m_xtal_prim(m_prim->basicstructure) {
+  for (xtal::Site const &site : m_xtal_prim->basis()) {
+    m_occupant_indices_by_name.emplace_back();
+    Index s = 0;
+    for (auto const &mol : site.occupant_dof()) {
+      m_occupant_indices_by_name.back()[mol.name()].push_back(s);
+      ++s;
+    }
+  }
+}
 
 std::runtime_error FromStructure::error(std::string what) const {
   std::string prefix = "Error in FromStructure: ";
@@ -102,7 +112,7 @@ std::shared_ptr<Supercell const> FromStructure::make_supercell(
   Eigen::Matrix3d const &L_mapped = mapped_structure.lat_column_mat;
   Eigen::Matrix3d L_ideal = U.inverse() * L_mapped;
   double xtal_tol = m_xtal_prim->lattice().tol();
-  return std::make_shared<Supercell>(m_prim, xtal::Lattice(L_ideal, xtal_tol));
+  return make_shared_supercell(m_prim, xtal::Lattice(L_ideal, xtal_tol));
 }
 
 Eigen::MatrixXd const &FromStructure::get_local_property_or_throw(
@@ -132,14 +142,8 @@ Eigen::MatrixXd const &FromStructure::get_global_property_or_throw(
 void FromStructure::validate_atom_coords_or_throw(
     xtal::SimpleStructure const &mapped_structure,
     std::shared_ptr<Supercell const> const &supercell) const {
-  auto const &converter = supercell->unitcellcoord_index_converter;
-  auto const &xtal_prim = supercell->prim->basicstructure;
-  Index n_sites = converter.total_sites();
-  Eigen::MatrixXd R(3, n_sites);
-  for (Index l = 0; l < n_sites; ++l) {
-    xtal::UnitCellCoord bijk = converter(l);
-    R.col(l) = bijk.coordinate(*xtal_prim).const_cart();
-  }
+  Eigen::Matrix3Xd const &R = supercell->site_coordinate_cart();
+  Index n_sites = R.cols();
 
   Eigen::MatrixXd disp;
   auto it = mapped_structure.atom_info.properties.find("disp");
@@ -157,13 +161,14 @@ void FromStructure::validate_atom_coords_or_throw(
     throw this->error(msg.str());
   }
 
-  if (!almost_equal(R + disp, coords)) {
+  Eigen::MatrixXd displaced_coords = R + disp;
+  if (!almost_equal(displaced_coords, coords)) {
     jsonParser json;
     json["supercell_lattice_row_vectors"] =
         supercell->superlattice.superlattice().lat_column_mat().transpose();
     json["supercell_site_coordinates_cart"] = R.transpose();
     json["disp"] = disp.transpose();
-    json["displaced_coordinates"] = (R + disp).transpose();
+    json["displaced_coordinates"] = displaced_coords.transpose();
     json["coords"] = coords.transpose();
 
     fs::path name = error_filename();
@@ -335,6 +340,54 @@ FromStructure::default_make_global_properties(
   return global_properties;
 }
 
+/// \brief Construct configurations with properties from mapped structures,
+///     in parallel
+///
+/// Notes:
+/// - Each supercell is made and inserted into `supercells` concurrently,
+///   using ConcurrentSupercellSet, then `make_f(mapped_structure, supercell)`
+///   constructs the configuration with properties.
+/// - Errors are not thrown. If constructing the configuration from
+///   `mapped_structures[i]` throws, `result[i]` is empty and
+///   `error_messages[i]` is the exception message. Otherwise,
+///   `error_messages[i]` is empty.
+///
+/// \param mapped_structures The mapped structures
+/// \param supercells Supercells are inserted here, and must not be used by
+///     other threads during this call
+/// \param make_f Constructs the configuration with properties from a mapped
+///     structure and its supercell
+/// \param error_messages Set to the error message for each mapped structure
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+std::vector<std::optional<ConfigurationWithProperties>>
+FromStructure::make_batch(
+    std::vector<xtal::SimpleStructure> const &mapped_structures,
+    SupercellSet &supercells,
+    std::function<ConfigurationWithProperties(
+        xtal::SimpleStructure const &,
+        std::shared_ptr<Supercell const> const &)>
+        make_f,
+    std::vector<std::string> &error_messages, Index n_threads) const {
+  Index n = mapped_structures.size();
+  std::vector<std::optional<ConfigurationWithProperties>> result(n);
+  error_messages.assign(n, std::string());
+  ConcurrentSupercellSet concurrent_supercells(supercells);
+  parallel_for_chunks(n, n_threads, [&](Index begin, Index end) {
+    for (Index i = begin; i < end; ++i) {
+      try {
+        std::shared_ptr<Supercell const> supercell =
+            concurrent_supercells.insert(make_supercell(mapped_structures[i]))
+                .supercell;
+        result[i] = make_f(mapped_structures[i], supercell);
+      } catch (std::exception const &e) {
+        error_messages[i] = e.what();
+      }
+    }
+  });
+  return result;
+}
+
 /// \brief Constructor
 ///
 /// \param _prim The prim
@@ -353,20 +406,43 @@ FromIsotropicAtomicStructure::FromIsotropicAtomicStructure(
 /// \brief Construct a configuration with properties from a mapped structure
 ConfigurationWithProperties FromIsotropicAtomicStructure::operator()(
     xtal::SimpleStructure const &mapped_structure) {
-  // this must be first so other methods can use m_current_supercell
-  m_current_supercell =
+  std::shared_ptr<Supercell const> supercell =
       m_supercells->insert(this->make_supercell(mapped_structure))
           .first->supercell;
+  return this->make(mapped_structure, supercell);
+}
 
-  clexulator::ConfigDoFValues dof_values;
-  dof_values.occupation = this->make_occupation(mapped_structure);
-  dof_values.local_dof_values = this->make_local_dof_values(mapped_structure);
-  dof_values.global_dof_values = this->make_global_dof_values(mapped_structure);
-
-  return ConfigurationWithProperties(
-      Configuration(m_current_supercell, dof_values),
-      this->make_local_properties(mapped_structure),
-      this->make_global_properties(mapped_structure));
+/// \brief Construct configurations with properties from mapped
+///     structures, in parallel
+///
+/// Notes:
+/// - Equivalent to calling `operator()` for each mapped structure, but
+///   using up to `n_threads` threads. Supercells are shared through
+///   `supercells()`, which must not be used by other threads during this
+///   call.
+/// - Errors are not thrown. If constructing the configuration from
+///   `mapped_structures[i]` fails, `result[i]` is empty and
+///   `error_messages[i]` is the error message. Otherwise,
+///   `error_messages[i]` is empty.
+///
+/// \param mapped_structures The mapped structures
+/// \param error_messages Set to the error message for each mapped structure
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns The configuration with properties for each mapped structure,
+///     or empty if it could not be constructed.
+std::vector<std::optional<ConfigurationWithProperties>>
+FromIsotropicAtomicStructure::operator()(
+    std::vector<xtal::SimpleStructure> const &mapped_structures,
+    std::vector<std::string> &error_messages, Index n_threads) {
+  return make_batch(
+      mapped_structures, *m_supercells,
+      [&](xtal::SimpleStructure const &mapped_structure,
+          std::shared_ptr<Supercell const> const &supercell) {
+        return this->make(mapped_structure, supercell);
+      },
+      error_messages, n_threads);
 }
 
 /// \brief Return shared pointer to all supercells
@@ -379,9 +455,27 @@ std::runtime_error FromIsotropicAtomicStructure::error(std::string what) const {
   return std::runtime_error(prefix + what);
 }
 
+/// \brief Construct a configuration with properties from a mapped
+///     structure, in a supercell which has already been made from it
+ConfigurationWithProperties FromIsotropicAtomicStructure::make(
+    xtal::SimpleStructure const &mapped_structure,
+    std::shared_ptr<Supercell const> const &supercell) const {
+  clexulator::ConfigDoFValues dof_values;
+  dof_values.occupation = this->make_occupation(mapped_structure, supercell);
+  dof_values.local_dof_values =
+      this->make_local_dof_values(mapped_structure, supercell);
+  dof_values.global_dof_values = this->make_global_dof_values(mapped_structure);
+
+  return ConfigurationWithProperties(
+      Configuration(supercell, dof_values),
+      this->make_local_properties(mapped_structure, supercell),
+      this->make_global_properties(mapped_structure));
+}
+
 Eigen::VectorXi FromIsotropicAtomicStructure::make_occupation(
-    xtal::SimpleStructure const &mapped_structure) const {
-  auto const &converter = m_current_supercell->unitcellcoord_index_converter;
+    xtal::SimpleStructure const &mapped_structure,
+    std::shared_ptr<Supercell const> const &supercell) const {
+  auto const &converter = supercell->unitcellcoord_index_converter;
   Index n_sites = converter.total_sites();
   validate_atom_names_or_throw(mapped_structure.atom_info.names, n_sites);
 
@@ -405,32 +499,37 @@ Eigen::VectorXi FromIsotropicAtomicStructure::make_occupation(
   for (std::string const &name : mapped_structure.atom_info.names) {
     xtal::UnitCellCoord bijk = converter(l);
     xtal::Site const &site = m_xtal_prim->basis()[bijk.sublattice()];
-    Index s = 0;
-    for (auto const &mol : site.occupant_dof()) {
-      if (mol.name() != name) {
-        ++s;
-        continue;
-      }
+    Index s = site.occupant_dof().size();
 
-      // check properties
-      auto const &properties = mol.atom(0).properties();
+    // only occupants with matching name are candidates
+    auto const &occupant_indices =
+        m_occupant_indices_by_name[bijk.sublattice()];
+    auto candidates_it = occupant_indices.find(name);
+    if (candidates_it != occupant_indices.end()) {
+      for (Index candidate : candidates_it->second) {
+        auto const &mol = site.occupant_dof()[candidate];
 
-      // selectivedyanmics must match exactly if input
-      if (has_selectivedynamics) {
-        Eigen::VectorXd ideal_atom_value = default_selectivedynamics_atom_value;
-        auto property_it = properties.find(selectivedynamics_key);
-        if (property_it != properties.end()) {
-          ideal_atom_value = property_it->second.value();
-        }
+        // check properties
+        auto const &properties = mol.atom(0).properties();
 
-        if (!almost_equal(ideal_atom_value, selectivedynamics.col(l))) {
-          ++s;
-          continue;
+        // selectivedyanmics must match exactly if input
+        if (has_selectivedynamics) {
+          Eigen::VectorXd ideal_atom_value =
+              default_selectivedynamics_atom_value;
+          auto property_it = properties.find(selectivedynamics_key);
+          if (property_it != properties.end()) {
+            ideal_atom_value = property_it->second.value();
+          }
+
+          if (!almost_equal(ideal_atom_value, selectivedynamics.col(l))) {
+            continue;
+          }
         }
-      }
 
-      // name (and selectivedynamics if present ) matches -> break loop
-      break;
+        // name (and selectivedynamics if present ) matches -> break loop
+        s = candidate;
+        break;
+      }
     }
 
     if (s == site.occupant_dof().size()) {
@@ -447,14 +546,16 @@ Eigen::VectorXi FromIsotropicAtomicStructure::make_occupation(
 
 std::map<std::string, Eigen::MatrixXd>
 FromIsotropicAtomicStructure::make_local_dof_values(
-    xtal::SimpleStructure const &mapped_structure) const {
-  return default_make_local_dof_values(mapped_structure, m_current_supercell);
+    xtal::SimpleStructure const &mapped_structure,
+    std::shared_ptr<Supercell const> const &supercell) const {
+  return default_make_local_dof_values(mapped_structure, supercell);
 }
 
 std::map<std::string, Eigen::MatrixXd>
 FromIsotropicAtomicStructure::make_local_properties(
-    xtal::SimpleStructure const &mapped_structure) const {
-  return default_make_local_properties(mapped_structure, m_current_supercell);
+    xtal::SimpleStructure const &mapped_structure,
+    std::shared_ptr<Supercell const> const &supercell) const {
+  return default_make_local_properties(mapped_structure, supercell);
 }
 
 std::map<std::string, Eigen::VectorXd>
@@ -501,16 +602,62 @@ FromDiscreteMagneticAtomicStructure::FromDiscreteMagneticAtomicStructure(
   if (m_supercells == nullptr) {
     m_supercells = std::make_shared<SupercellSet>(m_prim);
   }
+
+  for (xtal::Site const &site : m_xtal_prim->basis()) {
+    m_occupant_indices_by_atom_name.emplace_back();
+    Index s = 0;
+    for (auto const &mol : site.occupant_dof()) {
+      m_occupant_indices_by_atom_name.back()[mol.atom(0).name()].push_back(s);
+      ++s;
+    }
+  }
 }
 
 /// \brief Construct a configuration with properties from a mapped structure
 ConfigurationWithProperties FromDiscreteMagneticAtomicStructure::operator()(
     xtal::SimpleStructure const &mapped_structure) {
-  // this must be first so other methods can use m_current_supercell
-  m_current_supercell =
+  std::shared_ptr<Supercell const> supercell =
       m_supercells->insert(this->make_supercell(mapped_structure))
           .first->supercell;
+  return this->make(mapped_structure, supercell);
+}
+
+/// \brief Construct configurations with properties from mapped
+///     structures, in parallel
+///
+/// Equivalent to calling `operator()` for each mapped structure, but using
+/// up to `n_threads` threads, and returning errors instead of throwing. See
+/// `FromIsotropicAtomicStructure::operator()` for details.
+std::vector<std::optional<ConfigurationWithProperties>>
+FromDiscreteMagneticAtomicStructure::operator()(
+    std::vector<xtal::SimpleStructure> const &mapped_structures,
+    std::vector<std::string> &error_messages, Index n_threads) {
+  return make_batch(
+      mapped_structures, *m_supercells,
+      [&](xtal::SimpleStructure const &mapped_structure,
+          std::shared_ptr<Supercell const> const &supercell) {
+        return this->make(mapped_structure, supercell);
+      },
+      error_messages, n_threads);
+}
 
+/// \brief Return shared pointer to all supercells
+std::shared_ptr<SupercellSet> FromDiscreteMagneticAtomicStructure::supercells()
+    const {
+  return m_supercells;
+}
+
+std::runtime_error FromDiscreteMagneticAtomicStructure::error(
+    std::string what) const {
+  std::string prefix = "Error in FromIsotropicAtomicStructure: ";
+  return std::runtime_error(prefix + what);
+}
+
+/// \brief Construct a configuration with properties from a mapped
+///     structure, in a supercell which has already been made from it
+ConfigurationWithProperties FromDiscreteMagneticAtomicStructure::make(
+    xtal::SimpleStructure const &mapped_structure,
+    std::shared_ptr<Supercell const> const &supercell) const {
   // Copy <flavor>magspin from atom_info.properties
   std::string magspin_key =
       m_prim->magspin_info.discrete_atomic_magspin_key.value();
@@ -529,32 +676,23 @@ ConfigurationWithProperties FromDiscreteMagneticAtomicStructure::operator()(
   excluded.insert(magspin_key);
 
   clexulator::ConfigDoFValues dof_values;
-  dof_values.occupation = this->make_occupation(mapped_structure, magspin);
-  dof_values.local_dof_values = this->make_local_dof_values(mapped_structure);
+  dof_values.occupation =
+      this->make_occupation(mapped_structure, supercell, magspin);
+  dof_values.local_dof_values =
+      this->make_local_dof_values(mapped_structure, supercell);
   dof_values.global_dof_values = this->make_global_dof_values(mapped_structure);
 
   return ConfigurationWithProperties(
-      Configuration(m_current_supercell, dof_values),
-      this->make_local_properties(mapped_structure, excluded),
+      Configuration(supercell, dof_values),
+      this->make_local_properties(mapped_structure, supercell, excluded),
       this->make_global_properties(mapped_structure));
 }
 
-/// \brief Return shared pointer to all supercells
-std::shared_ptr<SupercellSet> FromDiscreteMagneticAtomicStructure::supercells()
-    const {
-  return m_supercells;
-}
-
-std::runtime_error FromDiscreteMagneticAtomicStructure::error(
-    std::string what) const {
-  std::string prefix = "Error in FromIsotropicAtomicStructure: ";
-  return std::runtime_error(prefix + what);
-}
-
 Eigen::VectorXi FromDiscreteMagneticAtomicStructure::make_occupation(
     xtal::SimpleStructure const &mapped_structure,
+    std::shared_ptr<Supercell const> const &supercell,
     Eigen::MatrixXd const &magspin) const {
-  auto const &converter = m_current_supercell->unitcellcoord_index_converter;
+  auto const &converter = supercell->unitcellcoord_index_converter;
   Index n_sites = converter.total_sites();
   validate_atom_names_or_throw(mapped_structure.atom_info.names, n_sites);
 
@@ -586,20 +724,25 @@ Eigen::VectorXi FromDiscreteMagneticAtomicStructure::make_occupation(
   // - magspin.col(i) to mol.atom(0).properties().at(magspin_key)
   //   - magnitude of the difference must be less than magspin_tol
   //   - choose closest with matching name
+  std::vector<Index> const no_candidates;
   Index l = 0;
   for (std::string const &name : mapped_structure.atom_info.names) {
     xtal::UnitCellCoord bijk = converter(l);
     xtal::Site const &site = m_xtal_prim->basis()[bijk.sublattice()];
-    Index s = 0;  // current occupation index
 
     // best occupation index (default = not found)
     Index best_s = site.occupant_dof().size();
     double best_magspin_diff = std::numeric_limits<double>::infinity();
-    for (auto const &mol : site.occupant_dof()) {
-      if (mol.atom(0).name() != name) {
-        ++s;
-        continue;
-      }
+
+    // only occupants with matching name are candidates
+    auto const &occupant_indices =
+        m_occupant_indices_by_atom_name[bijk.sublattice()];
+    auto candidates_it = occupant_indices.find(name);
+    std::vector<Index> const &candidates =
+        candidates_it != occupant_indices.end() ? candidates_it->second
+                                                : no_candidates;
+    for (Index s : candidates) {
+      auto const &mol = site.occupant_dof()[s];
 
       // check properties
       auto const &properties = mol.atom(0).properties();
@@ -612,7 +755,6 @@ Eigen::VectorXi FromDiscreteMagneticAtomicStructure::make_occupation(
           ideal_atom_value = property_it->second.value();
         }
         if (!almost_equal(ideal_atom_value, selectivedynamics.col(l))) {
-          ++s;
           continue;
         }
       }
@@ -627,7 +769,6 @@ Eigen::VectorXi FromDiscreteMagneticAtomicStructure::make_occupation(
 
       // do not consider if magspin_diff >= magspin_tol
       if (magspin_diff >= m_magspin_tol) {
-        ++s;
         continue;
       }
 
@@ -636,7 +777,6 @@ Eigen::VectorXi FromDiscreteMagneticAtomicStructure::make_occupation(
         best_magspin_diff = magspin_diff;
         best_s = s;
       }
-      ++s;
     }
     if (best_s == site.occupant_dof().size()) {
       std::stringstream msg;
@@ -665,16 +805,17 @@ Eigen::VectorXi FromDiscreteMagneticAtomicStructure::make_occupation(
 
 std::map<std::string, Eigen::MatrixXd>
 FromDiscreteMagneticAtomicStructure::make_local_dof_values(
-    xtal::SimpleStructure const &mapped_structure) const {
-  return default_make_local_dof_values(mapped_structure, m_current_supercell);
+    xtal::SimpleStructure const &mapped_structure,
+    std::shared_ptr<Supercell const> const &supercell) const {
+  return default_make_local_dof_values(mapped_structure, supercell);
 }
 
 std::map<std::string, Eigen::MatrixXd>
 FromDiscreteMagneticAtomicStructure::make_local_properties(
     xtal::SimpleStructure const &mapped_structure,
+    std::shared_ptr<Supercell const> const &supercell,
     std::set<std::string> excluded) const {
-  return default_make_local_properties(mapped_structure, m_current_supercell,
-                                       excluded);
+  return default_make_local_properties(mapped_structure, supercell, excluded);
 }
 
 std::map<std::string, Eigen::VectorXd>
@@ -0,0 +1,362 @@
+#include "casm/configuration/InvariantSubgroupEngine.hh"
+
+#include <algorithm>
+
+#include "casm/configuration/ConfigIsEquivalent.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymInfo.hh"
+#include "casm/configuration/group/Group.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief Status of an element while finding an invariant subgroup
+enum class InvariantStatus { unknown, invariant, not_invariant };
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param _supercell The supercell. Results are with respect to the
+///     operations `[SupercellSymOp::begin(_supercell),
+///     SupercellSymOp::end(_supercell))`.
+InvariantSubgroupEngine::InvariantSubgroupEngine(
+    std::shared_ptr<Supercell const> const &_supercell)
+    : m_supercell(throw_if_equal_to_nullptr(
+          _supercell, "Error in InvariantSubgroupEngine: supercell is empty")),
+      m_n_factor_group(m_supercell->sym_info.factor_group->element.size()),
+      m_n_translations(m_supercell->superlattice.size()) {}
+
+/// \brief The supercell
+std::shared_ptr<Supercell const> const &InvariantSubgroupEngine::supercell()
+    const {
+  return m_supercell;
+}
+
+/// \brief Number of supercell factor group operations
+Index InvariantSubgroupEngine::n_factor_group() const {
+  return m_n_factor_group;
+}
+
+/// \brief Number of supercell translations
+Index InvariantSubgroupEngine::n_translations() const {
+  return m_n_translations;
+}
+
+/// \brief Return the indices of the translations that leave the
+///     configuration invariant
+///
+/// \param configuration A configuration in `supercell()`
+/// \param which_dofs The DoF types to compare, as for `ConfigIsEquivalent`
+///
+/// \returns The sorted translation indices, `t`, such that
+///     `SupercellSymOp(supercell(), 0, t)` leaves the configuration
+///     invariant. Index 0, the identity, is always included.
+std::vector<Index> InvariantSubgroupEngine::make_invariant_translation_indices(
+    Configuration const &configuration,
+    std::set<std::string> const &which_dofs) const {
+  _throw_if_other_supercell(configuration);
+  ConfigIsEquivalent equal_to_f(configuration, which_dofs);
+
+  std::vector<InvariantStatus> status(m_n_translations,
+                                      InvariantStatus::unknown);
+  std::vector<Index> subgroup({0});
+  status[0] = InvariantStatus::invariant;
+  for (Index t = 1; t < m_n_translations; ++t) {
+    if (status[t] != InvariantStatus::unknown) {
+      continue;
+    }
+    if (equal_to_f(SupercellSymOp(m_supercell, 0, t))) {
+      // add the cosets `k*t + subgroup` until returning to `subgroup`
+      Index n_old = subgroup.size();
+      Index x = t;
+      while (status[x] != InvariantStatus::invariant) {
+        for (Index i = 0; i < n_old; ++i) {
+          Index y = _translation_sum(x, subgroup[i]);
+          status[y] = InvariantStatus::invariant;
+          subgroup.push_back(y);
+        }
+        x = _translation_sum(x, t);
+      }
+    } else {
+      // no translation in `t + subgroup` is invariant
+      for (Index h : subgroup) {
+        status[_translation_sum(t, h)] = InvariantStatus::not_invariant;
+      }
+    }
+  }
+  std::sort(subgroup.begin(), subgroup.end());
+  return subgroup;
+}
+
+/// \brief Return the operations that leave the configuration invariant
+///
+/// \param configuration A configuration in `supercell()`
+/// \param which_dofs The DoF types to compare, as for `ConfigIsEquivalent`
+///
+/// \returns The operations, in the order of `[SupercellSymOp::begin(
+///     supercell()), SupercellSymOp::end(supercell()))`, which leave
+///     the configuration invariant. Operations are constructed with
+///     `supercell()`.
+std::vector<SupercellSymOp> InvariantSubgroupEngine::make_invariant_subgroup(
+    Configuration const &configuration,
+    std::set<std::string> const &which_dofs) const {
+  std::vector<Index> invariant_translations =
+      make_invariant_translation_indices(configuration, which_dofs);
+  ConfigIsEquivalent equal_to_f(configuration, which_dofs);
+
+  // one translation from each coset of the invariant translations
+  std::vector<Index> translation_reps;
+  std::vector<bool> covered(m_n_translations, false);
+  for (Index t = 0; t < m_n_translations; ++t) {
+    if (covered[t]) {
+      continue;
+    }
+    translation_reps.push_back(t);
+    for (Index h : invariant_translations) {
+      covered[_translation_sum(t, h)] = true;
+    }
+  }
+
+  // for each factor group operation, f, find t0 such that t0 * f is
+  // invariant, if any exists
+  SymGroup const &factor_group = *m_supercell->sym_info.factor_group;
+  std::vector<InvariantStatus> status(m_n_factor_group,
+                                      InvariantStatus::unknown);
+  std::vector<Index> rep_translation(m_n_factor_group, -1);
+  std::vector<Index> included({0});
+  std::vector<Index> excluded;
+  status[0] = InvariantStatus::invariant;
+  rep_translation[0] = 0;
+
+  // add products of included operations, and products of excluded and
+  // included operations, until no more are found
+  auto close = [&]() {
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (Index i = 0; i < included.size(); ++i) {
+        for (Index j = 0; j < included.size(); ++j) {
+          Index a = included[i];
+          Index b = included[j];
+          Index p = factor_group.mult(a, b);
+          if (status[p] != InvariantStatus::unknown) {
+            continue;
+          }
+          SupercellSymOp product =
+              SupercellSymOp(m_supercell, a, rep_translation[a]) *
+              SupercellSymOp(m_supercell, b, rep_translation[b]);
+          status[p] = InvariantStatus::invariant;
+          rep_translation[p] = product.translation_index();
+          included.push_back(p);
+          changed = true;
+        }
+      }
+      for (Index i = 0; i < excluded.size(); ++i) {
+        for (Index j = 0; j < included.size(); ++j) {
+          Index e = excluded[i];
+          Index g = included[j];
+          for (Index p : {factor_group.mult(e, g), factor_group.mult(g, e)}) {
+            if (status[p] == InvariantStatus::unknown) {
+              status[p] = InvariantStatus::not_invariant;
+              excluded.push_back(p);
+              changed = true;
+            }
+          }
+        }
+      }
+    }
+  };
+
+  for (Index f = 1; f < m_n_factor_group; ++f) {
+    if (status[f] != InvariantStatus::unknown) {
+      continue;
+    }
+    auto it = std::find_if(
+        translation_reps.begin(), translation_reps.end(), [&](Index t) {
+          return equal_to_f(SupercellSymOp(m_supercell, f, t));
+        });
+    if (it == translation_reps.end()) {
+      status[f] = InvariantStatus::not_invariant;
+      excluded.push_back(f);
+    } else {
+      status[f] = InvariantStatus::invariant;
+      rep_translation[f] = *it;
+      included.push_back(f);
+    }
+    close();
+  }
+
+  // the invariant operations with factor group operation f are
+  //     (invariant_translations + rep_translation[f]) * f
+  std::vector<SupercellSymOp> subgroup;
+  std::vector<Index> translations;
+  for (Index f = 0; f < m_n_factor_group; ++f) {
+    if (status[f] != InvariantStatus::invariant) {
+      continue;
+    }
+    translations.clear();
+    for (Index h : invariant_translations) {
+      translations.push_back(_translation_sum(h, rep_translation[f]));
+    }
+    std::sort(translations.begin(), translations.end());
+    for (Index t : translations) {
+      subgroup.emplace_back(m_supercell, f, t);
+    }
+  }
+  return subgroup;
+}
+
+/// \brief Return the first operation of each left coset of a subgroup
+///
+/// \param subgroup A subgroup of `[SupercellSymOp::begin(supercell()),
+///     SupercellSymOp::end(supercell()))`, such as the result of
+///     `make_invariant_subgroup`.
+///
+/// \returns The operations, `g`, in the order of
+///     `[SupercellSymOp::begin(supercell()), SupercellSymOp::end(
+///     supercell()))`, that are the first element of their left coset
+///     `g * subgroup`.
+std::vector<SupercellSymOp>
+InvariantSubgroupEngine::make_left_coset_representatives(
+    std::vector<SupercellSymOp> const &subgroup) const {
+  std::vector<bool> covered(m_n_factor_group * m_n_translations, false);
+  std::vector<SupercellSymOp> reps;
+  for (Index f = 0; f < m_n_factor_group; ++f) {
+    for (Index t = 0; t < m_n_translations; ++t) {
+      SupercellSymOp g(m_supercell, f, t);
+      Index g_index = _op_index(g);
+      if (covered[g_index]) {
+        continue;
+      }
+      covered[g_index] = true;
+      for (SupercellSymOp const &h : subgroup) {
+        if (h.supercell_factor_group_index() == 0 &&
+            h.translation_index() == 0) {
+          continue;
+        }
+        covered[_op_index(g * h)] = true;
+      }
+      reps.push_back(g);
+    }
+  }
+  return reps;
+}
+
+/// \brief Return the first operation of each double coset of two
+///     subgroups
+///
+/// The double cosets `left_subgroup * g * right_subgroup` partition the
+/// supercell symmetry group. If `right_subgroup` is the invariant subgroup
+/// of a configuration, each double coset is one orbit, under
+/// `left_subgroup`, of the distinct equivalents of the configuration, so
+/// applying the representatives gives one equivalent per orbit.
+///
+/// \param left_subgroup A subgroup of `[SupercellSymOp::begin(supercell()),
+///     SupercellSymOp::end(supercell()))`, such as the SupercellSymOp
+///     consistent with a local subgroup of the prim factor group.
+/// \param right_subgroup A subgroup of `[SupercellSymOp::begin(supercell()),
+///     SupercellSymOp::end(supercell()))`, such as the result of
+///     `make_invariant_subgroup`.
+///
+/// \returns The operations, `g`, in the order of
+///     `[SupercellSymOp::begin(supercell()), SupercellSymOp::end(
+///     supercell()))`, that are the first element of their double coset.
+std::vector<SupercellSymOp>
+InvariantSubgroupEngine::make_double_coset_representatives(
+    std::vector<SupercellSymOp> const &left_subgroup,
+    std::vector<SupercellSymOp> const &right_subgroup) const {
+  std::vector<bool> covered(m_n_factor_group * m_n_translations, false);
+  std::vector<SupercellSymOp> reps;
+  for (Index f = 0; f < m_n_factor_group; ++f) {
+    for (Index t = 0; t < m_n_translations; ++t) {
+      SupercellSymOp g(m_supercell, f, t);
+      Index g_index = _op_index(g);
+      if (covered[g_index]) {
+        continue;
+      }
+      covered[g_index] = true;
+      for (SupercellSymOp const &l : left_subgroup) {
+        SupercellSymOp lg = l * g;
+        for (SupercellSymOp const &r : right_subgroup) {
+          covered[_op_index(lg * r)] = true;
+        }
+      }
+      reps.push_back(g);
+    }
+  }
+  return reps;
+}
+
+/// \brief Return the distinct symmetrically equivalent configurations
+///
+/// Equivalent to `make_equivalents(configuration,
+/// SupercellSymOp::begin(supercell()), SupercellSymOp::end(supercell()))`,
+/// but only one operation per left coset of the invariant subgroup is
+/// applied.
+std::vector<Configuration> InvariantSubgroupEngine::make_equivalents(
+    Configuration const &configuration) const {
+  std::vector<SupercellSymOp> reps =
+      make_left_coset_representatives(make_invariant_subgroup(configuration));
+  std::set<Configuration> equivalents;
+  SupercellSymOpApplier applier;
+  for (SupercellSymOp const &op : reps) {
+    equivalents.emplace(applier.copy_apply(op, configuration));
+  }
+  return std::vector<Configuration>(equivalents.begin(), equivalents.end());
+}
+
+/// \brief Return the distinct symmetrically equivalent configurations
+///
+/// Equivalent to `make_equivalents(configuration_with_properties,
+/// SupercellSymOp::begin(supercell()), SupercellSymOp::end(supercell()))`,
+/// but only one operation per left coset of the invariant subgroup is
+/// applied. Properties are **not** considered in comparisons.
+std::vector<ConfigurationWithProperties>
+InvariantSubgroupEngine::make_equivalents(
+    ConfigurationWithProperties const &configuration_with_properties) const {
+  Configuration const &configuration =
+      configuration_with_properties.configuration;
+  std::vector<SupercellSymOp> reps =
+      make_left_coset_representatives(make_invariant_subgroup(configuration));
+
+  std::vector<std::pair<Configuration, SupercellSymOp>> equivalents;
+  SupercellSymOpApplier applier;
+  for (SupercellSymOp const &op : reps) {
+    equivalents.emplace_back(applier.copy_apply(op, configuration), op);
+  }
+  std::sort(equivalents.begin(), equivalents.end(),
+            [](std::pair<Configuration, SupercellSymOp> const &A,
+               std::pair<Configuration, SupercellSymOp> const &B) {
+              return A.first < B.first;
+            });
+
+  std::vector<ConfigurationWithProperties> equivalents_with_properties;
+  for (auto const &pair : equivalents) {
+    equivalents_with_properties.push_back(
+        applier.copy_apply(pair.second, configuration_with_properties));
+  }
+  return equivalents_with_properties;
+}
+
+void InvariantSubgroupEngine::_throw_if_other_supercell(
+    Configuration const &configuration) const {
+  if (configuration.supercell != m_supercell &&
+      *configuration.supercell != *m_supercell) {
+    throw std::runtime_error(
+        "Error in InvariantSubgroupEngine: configuration supercell does not "
+        "match");
+  }
+}
+
+/// \brief Index of the translation by `a` followed by `b`
+Index InvariantSubgroupEngine::_translation_sum(Index a, Index b) const {
+  xtal::UnitCellIndexConverter const &converter =
+      m_supercell->unitcell_index_converter;
+  return converter(UnitCell(converter(a) + converter(b)));
+}
+
+}  // namespace config
+}  // namespace CASM
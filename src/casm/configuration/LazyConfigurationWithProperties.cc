@@ -0,0 +1,134 @@
+#include "casm/configuration/LazyConfigurationWithProperties.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param op The symmetry operation to apply
+/// \param original The untransformed configuration with properties, which
+///     may be shared by many LazyConfigurationWithProperties
+LazyConfigurationWithProperties::LazyConfigurationWithProperties(
+    SupercellSymOp const &op,
+    std::shared_ptr<ConfigurationWithProperties const> const &original)
+    : LazyConfigurationWithProperties(
+          op, original, copy_apply(op, original->configuration)) {}
+
+/// \brief Constructor, with the configuration already transformed
+///
+/// \param op The symmetry operation to apply
+/// \param original The untransformed configuration with properties, which
+///     may be shared by many LazyConfigurationWithProperties
+/// \param transformed_configuration Equal to
+///     `copy_apply(op, original->configuration)`
+LazyConfigurationWithProperties::LazyConfigurationWithProperties(
+    SupercellSymOp const &op,
+    std::shared_ptr<ConfigurationWithProperties const> const &original,
+    Configuration const &transformed_configuration)
+    : m_op(op),
+      m_original(original),
+      m_configuration(transformed_configuration) {}
+
+/// \brief Names of the local properties
+std::set<std::string> LazyConfigurationWithProperties::local_property_keys()
+    const {
+  std::set<std::string> keys;
+  for (auto const &pair : m_original->local_properties) {
+    keys.insert(pair.first);
+  }
+  return keys;
+}
+
+/// \brief Names of the global properties
+std::set<std::string> LazyConfigurationWithProperties::global_property_keys()
+    const {
+  std::set<std::string> keys;
+  for (auto const &pair : m_original->global_properties) {
+    keys.insert(pair.first);
+  }
+  return keys;
+}
+
+/// \brief Return true if there is a local property with name `key`
+bool LazyConfigurationWithProperties::has_local_property(
+    std::string const &key) const {
+  return m_original->local_properties.count(key);
+}
+
+/// \brief Return true if there is a global property with name `key`
+bool LazyConfigurationWithProperties::has_global_property(
+    std::string const &key) const {
+  return m_original->global_properties.count(key);
+}
+
+/// \brief The transformed value of a local property
+///
+/// The property is transformed on the first call for `key`, and the result
+/// is cached. Throws if there is no local property with name `key`.
+Eigen::MatrixXd const &LazyConfigurationWithProperties::local_property(
+    std::string const &key) const {
+  auto it = m_local_properties.find(key);
+  if (it != m_local_properties.end()) {
+    return it->second;
+  }
+  auto original_it = m_original->local_properties.find(key);
+  if (original_it == m_original->local_properties.end()) {
+    throw std::runtime_error(
+        "Error in LazyConfigurationWithProperties::local_property: no "
+        "local property " +
+        key);
+  }
+  Eigen::MatrixXd &value =
+      m_local_properties.emplace(key, original_it->second).first->second;
+  apply_local_property(m_op, key, value, m_workspace);
+  return value;
+}
+
+/// \brief The transformed value of a global property
+///
+/// The property is transformed on the first call for `key`, and the result
+/// is cached. Throws if there is no global property with name `key`.
+Eigen::VectorXd const &LazyConfigurationWithProperties::global_property(
+    std::string const &key) const {
+  auto it = m_global_properties.find(key);
+  if (it != m_global_properties.end()) {
+    return it->second;
+  }
+  auto original_it = m_original->global_properties.find(key);
+  if (original_it == m_original->global_properties.end()) {
+    throw std::runtime_error(
+        "Error in LazyConfigurationWithProperties::global_property: no "
+        "global property " +
+        key);
+  }
+  Eigen::VectorXd &value =
+      m_global_properties.emplace(key, original_it->second).first->second;
+  apply_global_property(m_op, key, value, m_workspace);
+  return value;
+}
+
+/// \brief Transform all properties and return the result
+///
+/// Equal to `copy_apply(op(), original())`.
+ConfigurationWithProperties LazyConfigurationWithProperties::materialize()
+    const {
+  ConfigurationWithProperties result(m_configuration);
+  for (auto const &pair : m_original->local_properties) {
+    result.local_properties.emplace(pair.first, local_property(pair.first));
+  }
+  for (auto const &pair : m_original->global_properties) {
+    result.global_properties.emplace(pair.first, global_property(pair.first));
+  }
+  return result;
+}
+
+/// \brief Apply a symmetry operation to a configuration with properties,
+///     transforming properties only when they are accessed
+LazyConfigurationWithProperties copy_apply_lazy(
+    SupercellSymOp const &op,
+    std::shared_ptr<ConfigurationWithProperties const> const &original) {
+  return LazyConfigurationWithProperties(op, original);
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,157 @@
+#include "casm/configuration/LocalConfigurationList.hh"
+
+#include <algorithm>
+
+#include "casm/configuration/ConfigurationHashSet.hh"
+#include "casm/configuration/hash.hh"
+
+namespace CASM {
+namespace config {
+
+LocalConfiguration::LocalConfiguration(Configuration const &_configuration,
+                                       std::pair<Index, Index> const &_pos)
+    : configuration(_configuration), pos(_pos) {}
+
+/// \brief Less than comparison, by pos and then by configuration
+bool LocalConfiguration::operator<(LocalConfiguration const &rhs) const {
+  if (this->pos != rhs.pos) {
+    return this->pos < rhs.pos;
+  }
+  return this->configuration < rhs.configuration;
+}
+
+bool LocalConfiguration::eq_impl(LocalConfiguration const &rhs) const {
+  return this->pos == rhs.pos && this->configuration == rhs.configuration;
+}
+
+/// \brief Return the hash of a local configuration
+std::size_t LocalConfigurationHash::operator()(
+    LocalConfiguration const &local_configuration) const {
+  std::size_t seed = ConfigurationHash()(local_configuration.configuration);
+  hash_combine(seed, std::hash<Index>()(local_configuration.pos.first));
+  hash_combine(seed, std::hash<Index>()(local_configuration.pos.second));
+  return seed;
+}
+
+/// \brief Number of local configurations
+Index LocalConfigurationList::size() const { return m_values.size(); }
+
+/// \brief True if there are no local configurations
+bool LocalConfigurationList::empty() const { return m_values.empty(); }
+
+/// \brief Return the i-th local configuration
+///
+/// Throws std::out_of_range if `i` is not a valid index.
+LocalConfiguration const &LocalConfigurationList::at(Index i) const {
+  return m_values.at(i);
+}
+
+/// \brief Append a local configuration
+void LocalConfigurationList::push_back(LocalConfiguration const &value) {
+  m_index.emplace(LocalConfigurationHash()(value), m_values.size());
+  m_values.push_back(value);
+}
+
+/// \brief Append local configurations, in order
+void LocalConfigurationList::extend(
+    std::vector<LocalConfiguration> const &values) {
+  reserve(m_values.size() + values.size());
+  for (LocalConfiguration const &value : values) {
+    push_back(value);
+  }
+}
+
+/// \brief Set the i-th local configuration
+///
+/// Throws std::out_of_range if `i` is not a valid index.
+void LocalConfigurationList::set(Index i, LocalConfiguration const &value) {
+  LocalConfiguration &current = m_values.at(i);
+  auto range = m_index.equal_range(LocalConfigurationHash()(current));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == i) {
+      m_index.erase(it);
+      break;
+    }
+  }
+  current = value;
+  m_index.emplace(LocalConfigurationHash()(current), i);
+}
+
+/// \brief Erase the i-th local configuration
+///
+/// Throws std::out_of_range if `i` is not a valid index. Later positions
+/// shift, so the index is rebuilt.
+void LocalConfigurationList::erase(Index i) {
+  if (i < 0 || i >= size()) {
+    throw std::out_of_range(
+        "Error in LocalConfigurationList::erase: index out of range");
+  }
+  m_values.erase(m_values.begin() + i);
+  _rebuild_index();
+}
+
+/// \brief Remove all local configurations
+void LocalConfigurationList::clear() {
+  m_values.clear();
+  m_index.clear();
+}
+
+/// \brief Reserve space for `n` local configurations
+void LocalConfigurationList::reserve(Index n) {
+  m_values.reserve(n);
+  m_index.reserve(n);
+}
+
+/// \brief Sort local configurations, keeping the order of equal values
+void LocalConfigurationList::sort() {
+  std::stable_sort(m_values.begin(), m_values.end());
+  _rebuild_index();
+}
+
+/// \brief Return the index of the first equal local configuration, or -1
+Index LocalConfigurationList::index(LocalConfiguration const &value) const {
+  Index result = -1;
+  auto range = m_index.equal_range(LocalConfigurationHash()(value));
+  for (auto it = range.first; it != range.second; ++it) {
+    if ((result == -1 || it->second < result) &&
+        m_values[it->second] == value) {
+      result = it->second;
+    }
+  }
+  return result;
+}
+
+/// \brief Return true if an equal local configuration is present
+bool LocalConfigurationList::contains(LocalConfiguration const &value) const {
+  auto range = m_index.equal_range(LocalConfigurationHash()(value));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (m_values[it->second] == value) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// \brief Local configurations, in list order
+std::vector<LocalConfiguration> const &LocalConfigurationList::values() const {
+  return m_values;
+}
+
+LocalConfigurationList::const_iterator LocalConfigurationList::begin() const {
+  return m_values.cbegin();
+}
+
+LocalConfigurationList::const_iterator LocalConfigurationList::end() const {
+  return m_values.cend();
+}
+
+void LocalConfigurationList::_rebuild_index() {
+  m_index.clear();
+  m_index.reserve(m_values.size());
+  for (Index i = 0; i < m_values.size(); ++i) {
+    m_index.emplace(LocalConfigurationHash()(m_values[i]), i);
+  }
+}
+
+}  // namespace config
+}  // namespace CASM
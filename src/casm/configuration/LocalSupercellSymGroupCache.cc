@@ -0,0 +1,142 @@
+#include "casm/configuration/LocalSupercellSymGroupCache.hh"
+
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/group/Group.hh"
+#include "casm/crystallography/SymType.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param _local_prim_subgroup A local property subgroup of the prim factor
+///     group, as for `make_local_supercell_symgroup_rep`
+/// \param _supercell The supercell
+LocalSupercellSymGroup::LocalSupercellSymGroup(
+    std::shared_ptr<SymGroup const> const &_local_prim_subgroup,
+    std::shared_ptr<Supercell const> const &_supercell)
+    : local_prim_subgroup(throw_if_equal_to_nullptr(
+          _local_prim_subgroup,
+          "Error in LocalSupercellSymGroup: local_prim_subgroup is empty")),
+      supercell(throw_if_equal_to_nullptr(
+          _supercell, "Error in LocalSupercellSymGroup: supercell is empty")),
+      supercell_symgroup_rep(
+          make_local_supercell_symgroup_rep(local_prim_subgroup, supercell)),
+      symgroup(make_local_symgroup(supercell_symgroup_rep, supercell)) {}
+
+/// \brief Approximate memory used, in bytes
+///
+/// Counts the SupercellSymOp and the SymGroup elements, but not the
+/// supercell or local prim subgroup, which are shared.
+Index LocalSupercellSymGroup::size_bytes() const {
+  return sizeof(LocalSupercellSymGroup) +
+         supercell_symgroup_rep.size() * sizeof(SupercellSymOp) +
+         symgroup->element.size() * (sizeof(xtal::SymOp) + sizeof(Index));
+}
+
+/// \brief Constructor
+///
+/// \param _max_bytes Memory budget, in bytes. If 0, nothing is stored.
+LocalSupercellSymGroupCache::LocalSupercellSymGroupCache(Index _max_bytes)
+    : m_max_bytes(_max_bytes), m_size_bytes(0), m_n_hits(0), m_n_misses(0) {
+  if (m_max_bytes < 0) {
+    throw std::runtime_error(
+        "Error in LocalSupercellSymGroupCache: max_bytes < 0");
+  }
+}
+
+/// \brief Get LocalSupercellSymGroup, constructing it if not cached
+///
+/// The value is constructed without holding the lock, so concurrent misses
+/// for different keys do not wait on each other.
+///
+/// \param local_prim_subgroup A local property subgroup of the prim factor
+///     group, as for `make_local_supercell_symgroup_rep`
+/// \param supercell The supercell
+std::shared_ptr<LocalSupercellSymGroup const> LocalSupercellSymGroupCache::get(
+    std::shared_ptr<SymGroup const> const &local_prim_subgroup,
+    std::shared_ptr<Supercell const> const &supercell) {
+  key_type key(supercell.get(), local_prim_subgroup.get());
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      ++m_n_hits;
+      m_lru.splice(m_lru.begin(), m_lru, it->second.lru_position);
+      return it->second.value;
+    }
+    ++m_n_misses;
+  }
+
+  auto value = std::make_shared<LocalSupercellSymGroup const>(
+      local_prim_subgroup, supercell);
+  Index n_bytes = value->size_bytes();
+  if (n_bytes > m_max_bytes) {
+    return value;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(key);
+  if (it != m_entries.end()) {
+    // constructed concurrently by another thread
+    return it->second.value;
+  }
+  while (m_size_bytes + n_bytes > m_max_bytes) {
+    auto last = m_entries.find(m_lru.back());
+    m_size_bytes -= last->second.value->size_bytes();
+    m_entries.erase(last);
+    m_lru.pop_back();
+  }
+  m_lru.push_front(key);
+  m_entries.emplace(key, Entry{value, m_lru.begin()});
+  m_size_bytes += n_bytes;
+  return value;
+}
+
+/// \brief Memory budget, in bytes
+Index LocalSupercellSymGroupCache::max_bytes() const { return m_max_bytes; }
+
+/// \brief Total size of cached values, in bytes
+Index LocalSupercellSymGroupCache::size_bytes() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_size_bytes;
+}
+
+/// \brief Number of cached values
+Index LocalSupercellSymGroupCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Number of calls to `get` that found a cached value
+Index LocalSupercellSymGroupCache::n_hits() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_n_hits;
+}
+
+/// \brief Number of calls to `get` that constructed a value
+Index LocalSupercellSymGroupCache::n_misses() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_n_misses;
+}
+
+/// \brief Remove all cached values
+///
+/// Values already returned remain valid.
+void LocalSupercellSymGroupCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+  m_lru.clear();
+  m_size_bytes = 0;
+}
+
+/// \brief Process-wide LocalSupercellSymGroupCache
+///
+/// Constructed on first use, with the default memory budget.
+LocalSupercellSymGroupCache &local_supercell_symgroup_cache() {
+  static LocalSupercellSymGroupCache cache;
+  return cache;
+}
+
+}  // namespace config
+}  // namespace CASM
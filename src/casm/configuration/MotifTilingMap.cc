@@ -0,0 +1,354 @@
+#include "casm/configuration/MotifTilingMap.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/hash.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+void _hash_unitcell(std::size_t &seed, UnitCell const &unitcell) {
+  for (Index i = 0; i < 3; ++i) {
+    hash_combine(seed, std::hash<Index>()(unitcell(i)));
+  }
+}
+
+bool _is_same_supercell(std::shared_ptr<Supercell const> const &A,
+                        std::shared_ptr<Supercell const> const &B) {
+  return A == B || (!(*A < *B) && !(*B < *A));
+}
+
+void _check_prim(std::shared_ptr<Supercell const> const &motif_supercell,
+                 std::shared_ptr<Supercell const> const &supercell) {
+  if (supercell->prim != motif_supercell->prim) {
+    throw std::runtime_error("Error in MotifTilingMap: prim mismatch.");
+  }
+}
+
+}  // namespace
+
+/// \brief Constructor, for copying without transformation
+///
+/// \param _motif_supercell The supercell of motif configurations
+/// \param _supercell The supercell of new configurations
+/// \param _origin The UnitCell indicating which unit cell in the motif
+///     configuration is the origin in new configurations
+///
+/// Sites map according to:
+///     unitcellcoord + origin = motif_unitcellcoord
+MotifTilingMap::MotifTilingMap(
+    std::shared_ptr<Supercell const> const &_motif_supercell,
+    std::shared_ptr<Supercell const> const &_supercell,
+    UnitCell const &_origin)
+    : m_motif_supercell(_motif_supercell), m_supercell(_supercell) {
+  _check_prim(m_motif_supercell, m_supercell);
+
+  auto const &converter = m_supercell->unitcellcoord_index_converter;
+  auto const &motif_converter =
+      m_motif_supercell->unitcellcoord_index_converter;
+  Index n = converter.total_sites();
+  m_source_site_index.resize(n);
+  m_source_sublattice_index.resize(n);
+  for (Index i = 0; i < n; ++i) {
+    UnitCellCoord unitcellcoord = converter(i);
+    m_source_site_index[i] = motif_converter(unitcellcoord + _origin);
+    m_source_sublattice_index[i] = unitcellcoord.sublattice();
+  }
+}
+
+/// \brief Constructor, for copying with transformation
+///
+/// \param _prim_factor_group_index Index of prim factor group operation
+///     which transforms motif configurations
+/// \param _translation Lattice translation applied after the prim factor
+///     group operation
+/// \param _motif_supercell The supercell of motif configurations
+/// \param _supercell The supercell of new configurations
+/// \param _origin The UnitCell indicating which unit cell in the transformed
+///     motif configuration is the origin in new configurations
+///
+/// Sites map according to:
+///     unitcellcoord + origin = fg * motif_unitcellcoord + translation
+MotifTilingMap::MotifTilingMap(
+    Index _prim_factor_group_index, UnitCell const &_translation,
+    std::shared_ptr<Supercell const> const &_motif_supercell,
+    std::shared_ptr<Supercell const> const &_supercell,
+    UnitCell const &_origin)
+    : m_motif_supercell(_motif_supercell),
+      m_supercell(_supercell),
+      m_prim_factor_group_index(_prim_factor_group_index) {
+  _check_prim(m_motif_supercell, m_supercell);
+
+  PrimSymInfo const &prim_sym_info = m_supercell->prim->sym_info;
+  auto const &unitcellcoord_rep = prim_sym_info.unitcellcoord_symgroup_rep;
+  auto const &occ_rep =
+      prim_sym_info.occ_symgroup_rep[_prim_factor_group_index];
+  Index inverse_prim_factor_group_index =
+      prim_sym_info.factor_group->inverse_index[_prim_factor_group_index];
+
+  auto const &converter = m_supercell->unitcellcoord_index_converter;
+  auto const &motif_converter =
+      m_motif_supercell->unitcellcoord_index_converter;
+  Index n = converter.total_sites();
+  m_source_site_index.resize(n);
+  m_source_sublattice_index.resize(n);
+  m_occ_rep.resize(n);
+  for (Index i = 0; i < n; ++i) {
+    // motif_unitcellcoord = fg_inverse * (unitcellcoord + origin - trans)
+    UnitCellCoord motif_unitcellcoord =
+        copy_apply(unitcellcoord_rep[inverse_prim_factor_group_index],
+                   (converter(i) + _origin - _translation));
+    Index b = motif_unitcellcoord.sublattice();
+    m_source_site_index[i] = motif_converter(motif_unitcellcoord);
+    m_source_sublattice_index[i] = b;
+    m_occ_rep[i] = &occ_rep[b];
+  }
+
+  for (auto const &pair : prim_sym_info.local_dof_symgroup_rep) {
+    auto const &local_rep = pair.second[_prim_factor_group_index];
+    std::vector<Eigen::MatrixXd const *> &rep = m_local_rep[pair.first];
+    rep.resize(n);
+    for (Index i = 0; i < n; ++i) {
+      rep[i] = &local_rep[m_source_sublattice_index[i]];
+    }
+  }
+}
+
+/// \brief Copy motif configuration DoF values into `supercell`
+///
+/// \param motif A configuration in `motif_supercell`
+///
+/// \returns The same configuration as the `copy_configuration` overload
+///     with the same arguments as used to construct this map
+Configuration MotifTilingMap::apply(Configuration const &motif) const {
+  _check_motif(motif);
+  Configuration new_config{m_supercell};
+  for (auto const &pair : motif.dof_values.global_dof_values) {
+    transform_global(pair.first, pair.second,
+                     new_config.dof_values.global_dof_values.at(pair.first));
+  }
+  gather_occupation(motif.dof_values.occupation,
+                    new_config.dof_values.occupation);
+  for (auto const &pair : motif.dof_values.local_dof_values) {
+    gather_local(pair.first, pair.second,
+                 new_config.dof_values.local_dof_values.at(pair.first));
+  }
+  return new_config;
+}
+
+/// \brief Copy motif configuration DoF values and properties into
+///     `supercell`
+///
+/// \param motif_with_properties A configuration in `motif_supercell`, and
+///     its properties
+///
+/// \returns The same configuration and properties as the
+///     `copy_configuration_with_properties` overload with the same arguments
+///     as used to construct this map
+ConfigurationWithProperties MotifTilingMap::apply(
+    ConfigurationWithProperties const &motif_with_properties) const {
+  std::map<std::string, Eigen::MatrixXd> new_local_properties;
+  for (auto const &pair : motif_with_properties.local_properties) {
+    gather_local(pair.first, pair.second, new_local_properties[pair.first]);
+  }
+
+  // global properties are copied without transformation, as by
+  // copy_configuration_with_properties
+  return ConfigurationWithProperties(apply(motif_with_properties.configuration),
+                                     new_local_properties,
+                                     motif_with_properties.global_properties);
+}
+
+/// \brief Gather occupation values
+///
+/// \param source Occupation values of a configuration in `motif_supercell`
+/// \param destination Set to the occupation values in `supercell`. If
+///     transformed, occupant indices are permuted to account for
+///     anisotropic occupants.
+void MotifTilingMap::gather_occupation(Eigen::VectorXi const &source,
+                                       Eigen::VectorXi &destination) const {
+  Index n = n_sites();
+  destination.resize(n);
+  if (m_occ_rep.empty()) {
+    for (Index i = 0; i < n; ++i) {
+      destination(i) = source(m_source_site_index[i]);
+    }
+  } else {
+    for (Index i = 0; i < n; ++i) {
+      destination(i) = (*m_occ_rep[i])[source(m_source_site_index[i])];
+    }
+  }
+}
+
+/// \brief Gather local DoF or property values
+///
+/// \param key The local DoF type, used to find representation matrices if
+///     transformed. Local properties use the matrices of the DoF type with
+///     the same name.
+/// \param source Values of a configuration in `motif_supercell`, one column
+///     per site
+/// \param destination Set to the values in `supercell`
+void MotifTilingMap::gather_local(DoFKey const &key,
+                                  Eigen::MatrixXd const &source,
+                                  Eigen::MatrixXd &destination) const {
+  Index n = n_sites();
+  destination.resize(source.rows(), n);
+  if (!m_prim_factor_group_index.has_value()) {
+    for (Index i = 0; i < n; ++i) {
+      destination.col(i) = source.col(m_source_site_index[i]);
+    }
+    return;
+  }
+  auto it = m_local_rep.find(key);
+  if (it == m_local_rep.end()) {
+    throw std::runtime_error(
+        "Error in MotifTilingMap::gather_local: no local DoF of type '" + key +
+        "'");
+  }
+  std::vector<Eigen::MatrixXd const *> const &rep = it->second;
+  for (Index i = 0; i < n; ++i) {
+    destination.col(i).noalias() =
+        (*rep[i]) * source.col(m_source_site_index[i]);
+  }
+}
+
+/// \brief Transform global DoF or property values
+///
+/// \param key The global DoF type, used to find the representation matrix
+///     if transformed
+/// \param source Values of a configuration in `motif_supercell`
+/// \param destination Set to the values in `supercell`
+void MotifTilingMap::transform_global(DoFKey const &key,
+                                      Eigen::VectorXd const &source,
+                                      Eigen::VectorXd &destination) const {
+  if (!m_prim_factor_group_index.has_value()) {
+    destination = source;
+    return;
+  }
+  auto const &global_rep =
+      m_supercell->prim->sym_info.global_dof_symgroup_rep.at(key);
+  destination = global_rep[*m_prim_factor_group_index] * source;
+}
+
+void MotifTilingMap::_check_motif(Configuration const &motif) const {
+  if (!_is_same_supercell(motif.supercell, m_motif_supercell)) {
+    throw std::runtime_error(
+        "Error in MotifTilingMap::apply: motif is not in motif_supercell.");
+  }
+}
+
+/// \brief Return a stored map, for copying without transformation, or
+///     construct, store, and return a new one
+///
+/// Parameters are as for the MotifTilingMap constructor. The lock is not
+/// held while a new map is constructed, so concurrent calls with the same
+/// inputs may each construct it. Only the first map stored is kept and
+/// returned.
+std::shared_ptr<MotifTilingMap const> MotifTilingMapCache::make(
+    std::shared_ptr<Supercell const> const &motif_supercell,
+    std::shared_ptr<Supercell const> const &supercell,
+    UnitCell const &origin) {
+  return _make(-1, UnitCell(0, 0, 0), motif_supercell, supercell, origin);
+}
+
+/// \brief Return a stored map, for copying with transformation, or
+///     construct, store, and return a new one
+///
+/// Parameters are as for the MotifTilingMap constructor. The lock is not
+/// held while a new map is constructed, so concurrent calls with the same
+/// inputs may each construct it. Only the first map stored is kept and
+/// returned.
+std::shared_ptr<MotifTilingMap const> MotifTilingMapCache::make(
+    Index prim_factor_group_index, UnitCell const &translation,
+    std::shared_ptr<Supercell const> const &motif_supercell,
+    std::shared_ptr<Supercell const> const &supercell,
+    UnitCell const &origin) {
+  if (prim_factor_group_index < 0) {
+    throw std::runtime_error(
+        "Error in MotifTilingMapCache::make: prim_factor_group_index < 0");
+  }
+  return _make(prim_factor_group_index, translation, motif_supercell,
+               supercell, origin);
+}
+
+/// \brief Number of stored maps
+Index MotifTilingMapCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Erase stored maps
+void MotifTilingMapCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+/// \brief Find or construct a map, with prim_factor_group_index == -1 for
+///     copying without transformation
+std::shared_ptr<MotifTilingMap const> MotifTilingMapCache::_make(
+    Index prim_factor_group_index, UnitCell const &translation,
+    std::shared_ptr<Supercell const> const &motif_supercell,
+    std::shared_ptr<Supercell const> const &supercell,
+    UnitCell const &origin) {
+  std::size_t key = std::hash<Index>()(prim_factor_group_index);
+  _hash_unitcell(key, translation);
+  _hash_unitcell(key, origin);
+  hash_combine(key,
+               motif_supercell->unitcellcoord_index_converter.total_sites());
+  hash_combine(key, supercell->unitcellcoord_index_converter.total_sites());
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = _find(key, prim_factor_group_index, translation,
+                       motif_supercell, supercell, origin);
+    if (found) {
+      return found;
+    }
+  }
+
+  std::shared_ptr<MotifTilingMap const> result;
+  if (prim_factor_group_index < 0) {
+    result = std::make_shared<MotifTilingMap const>(motif_supercell,
+                                                    supercell, origin);
+  } else {
+    result = std::make_shared<MotifTilingMap const>(
+        prim_factor_group_index, translation, motif_supercell, supercell,
+        origin);
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto found = _find(key, prim_factor_group_index, translation,
+                     motif_supercell, supercell, origin);
+  if (found) {
+    return found;
+  }
+  m_entries.emplace(
+      key, Entry{prim_factor_group_index, translation, origin, result});
+  return result;
+}
+
+/// \brief Return the stored map with the given inputs, or nullptr
+///
+/// Requires the lock to be held.
+std::shared_ptr<MotifTilingMap const> MotifTilingMapCache::_find(
+    std::size_t key, Index prim_factor_group_index,
+    UnitCell const &translation,
+    std::shared_ptr<Supercell const> const &motif_supercell,
+    std::shared_ptr<Supercell const> const &supercell,
+    UnitCell const &origin) const {
+  auto range = m_entries.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    Entry const &entry = it->second;
+    if (entry.prim_factor_group_index == prim_factor_group_index &&
+        entry.translation == translation && entry.origin == origin &&
+        _is_same_supercell(entry.result->motif_supercell(), motif_supercell) &&
+        _is_same_supercell(entry.result->supercell(), supercell)) {
+      return entry.result;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,160 @@
+#include "casm/configuration/OccupationCanonicalizer.hh"
+
+#include <stdexcept>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/ConfigurationBatch.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/configuration/trace.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// \brief Return true if no operation of the engine remaps occupant indices
+bool _has_isotropic_occupants(CanonicalFormEngine const &engine) {
+  for (Index i = 0; i < Index(engine.ops().size()); ++i) {
+    if (engine.occupant_remap(i) != nullptr) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param _engine The canonical form engine, which provides the operations
+///     and their combined permutations. Must remain valid for the lifetime
+///     of the canonicalizer.
+/// \param use_device If true, and the library was built with a GPU backend,
+///     a device is available, and the prim has isotropic occupants, upload
+///     the permutation table and canonicalize on the device. Otherwise, the
+///     CPU path is used.
+OccupationCanonicalizer::OccupationCanonicalizer(
+    CanonicalFormEngine const &_engine, bool use_device)
+    : m_engine(_engine) {
+  if (!use_device || !device_is_available() ||
+      !_has_isotropic_occupants(m_engine)) {
+    return;
+  }
+#ifdef CASM_CONFIGURATION_CUDA
+  CASM_CONFIGURATION_TRACE_SCOPE("OccupationCanonicalizer.upload");
+  Index n_ops = m_engine.ops().size();
+  Index n_sites = m_engine.n_sites();
+  std::vector<std::int32_t> perm(n_ops * n_sites);
+  for (Index i = 0; i < n_ops; ++i) {
+    Index const *row = m_engine.permutation(i);
+    for (Index l = 0; l < n_sites; ++l) {
+      perm[i * n_sites + l] = row[l];
+    }
+  }
+  m_device_tables =
+      OccupationCanonicalizerImpl::make_device_tables(perm, n_ops, n_sites);
+#endif
+}
+
+/// \brief Return true if the library was built with a GPU backend and a
+///     device is available
+bool OccupationCanonicalizer::device_is_available() {
+#ifdef CASM_CONFIGURATION_CUDA
+  return OccupationCanonicalizerImpl::device_count() > 0;
+#else
+  return false;
+#endif
+}
+
+/// \brief Find canonical operation indices and flags for a row-major
+///     (n_configurations, n_sites) array of occupation values
+///
+/// \param occupation Occupation values, row-major with shape
+///     (n_configurations, engine().n_sites()).
+/// \param n_configurations Number of configurations.
+/// \param result Results, resized to n_configurations. Storage is reused
+///     from call to call.
+/// \param n_threads Number of threads used by the CPU path. If <= 0, use
+///     the hardware concurrency. Not used by the device path.
+void OccupationCanonicalizer::canonicalize(
+    int const *occupation, Index n_configurations,
+    OccupationCanonicalizationResult &result, Index n_threads) const {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("OccupationCanonicalizer.canonicalize",
+                                     "n_configurations", n_configurations);
+  result.to_canonical_index.resize(n_configurations);
+  result.is_canonical.resize(n_configurations);
+  if (!uses_device()) {
+    _canonicalize_on_host(occupation, n_configurations, result, n_threads);
+    return;
+  }
+#ifdef CASM_CONFIGURATION_CUDA
+  // site-major, so neighboring device threads read neighboring addresses
+  Index n_sites = m_engine.n_sites();
+  std::vector<std::int8_t> occupation_by_site(n_sites * n_configurations);
+  for (Index c = 0; c < n_configurations; ++c) {
+    int const *row = occupation + c * n_sites;
+    for (Index l = 0; l < n_sites; ++l) {
+      if (row[l] < 0 || row[l] > 127) {
+        throw std::runtime_error(
+            "Error in OccupationCanonicalizer::canonicalize: occupant index "
+            "out of range");
+      }
+      occupation_by_site[l * n_configurations + c] = row[l];
+    }
+  }
+  OccupationCanonicalizerImpl::device_canonicalize(
+      m_device_tables.get(), occupation_by_site, n_configurations,
+      result.to_canonical_index.data(), result.is_canonical.data());
+#endif
+}
+
+/// \brief Find canonical operation indices and flags for the
+///     configurations in a batch, which must be occupation-only
+///
+/// \param batch Configurations, in `engine().supercell()`, with no
+///     continuous DoF.
+/// \param n_threads Number of threads used by the CPU path.
+OccupationCanonicalizationResult OccupationCanonicalizer::canonicalize(
+    ConfigurationBatch const &batch, Index n_threads) const {
+  if (!batch.global_dof_dim().empty() || !batch.local_dof_dim().empty()) {
+    throw std::runtime_error(
+        "Error in OccupationCanonicalizer::canonicalize: batch has "
+        "continuous DoF");
+  }
+  if (batch.n_sites() != m_engine.n_sites()) {
+    throw std::runtime_error(
+        "Error in OccupationCanonicalizer::canonicalize: number of sites "
+        "mismatch");
+  }
+  OccupationCanonicalizationResult result;
+  canonicalize(batch.occupation().data(), batch.size(), result, n_threads);
+  return result;
+}
+
+/// \brief The reference implementation, using the same comparisons as
+///     `CanonicalFormEngine::to_canonical_indices`
+void OccupationCanonicalizer::_canonicalize_on_host(
+    int const *occupation, Index n_configurations,
+    OccupationCanonicalizationResult &result, Index n_threads) const {
+  Index n_ops = m_engine.ops().size();
+  Index n_sites = m_engine.n_sites();
+  parallel_for_chunks(n_configurations, n_threads, [&](Index begin,
+                                                       Index end) {
+    Eigen::VectorXi occ(n_sites);
+    for (Index c = begin; c < end; ++c) {
+      occ = Eigen::Map<Eigen::VectorXi const>(occupation + c * n_sites,
+                                              n_sites);
+      Index best = 0;
+      for (Index i = 1; i < n_ops; ++i) {
+        if (m_engine.compare_occupation(occ, best, i) < 0) {
+          best = i;
+        }
+      }
+      result.to_canonical_index[c] = best;
+      result.is_canonical[c] = (m_engine.compare_occupation(occ, best) >= 0);
+    }
+  });
+}
+
+}  // namespace config
+}  // namespace CASM
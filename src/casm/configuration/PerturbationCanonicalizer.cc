@@ -0,0 +1,340 @@
+#include "casm/configuration/PerturbationCanonicalizer.hh"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/enumeration/background_configuration.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param _engine Determines the operations with respect to which canonical
+///     forms are found
+/// \param _background The background configuration, which must be in the
+///     engine's supercell. Configurations passed to other methods are
+///     expected to differ from it on a few sites.
+PerturbationCanonicalizer::PerturbationCanonicalizer(
+    std::shared_ptr<CanonicalFormEngine const> const &_engine,
+    Configuration const &_background)
+    : m_engine(throw_if_equal_to_nullptr(
+          _engine, "Error in PerturbationCanonicalizer: engine is empty")),
+      m_background(_background),
+      m_n_sites(m_engine->n_sites()) {
+  _throw_if_other_supercell(m_background);
+  Index n_ops = m_engine->ops().size();
+  m_inverse_permutations.resize(n_ops * m_n_sites);
+  m_coset_index.resize(n_ops);
+
+  std::map<std::vector<int>, Index> coset_by_background;
+  Eigen::VectorXi transformed(m_n_sites);
+  for (Index i = 0; i < n_ops; ++i) {
+    Index const *permutation = m_engine->permutation(i);
+    Index *inverse = m_inverse_permutations.data() + i * m_n_sites;
+    for (Index l = 0; l < m_n_sites; ++l) {
+      inverse[permutation[l]] = l;
+    }
+
+    m_engine->apply_occupation(i, m_background.dof_values.occupation,
+                               transformed);
+    std::vector<int> key(transformed.data(), transformed.data() + m_n_sites);
+    auto result = coset_by_background.emplace(key, m_coset_ops.size());
+    if (result.second) {
+      m_coset_ops.emplace_back();
+      m_coset_backgrounds.insert(m_coset_backgrounds.end(), key.begin(),
+                                 key.end());
+    }
+    m_coset_index[i] = result.first->second;
+    m_coset_ops[m_coset_index[i]].push_back(i);
+  }
+}
+
+/// \brief The engine whose operations are used
+CanonicalFormEngine const &PerturbationCanonicalizer::engine() const {
+  return *m_engine;
+}
+
+/// \brief The background configuration
+Configuration const &PerturbationCanonicalizer::background() const {
+  return m_background;
+}
+
+/// \brief Number of distinct transformed backgrounds, equal to the number
+///     of engine operations divided by the size of the background
+///     invariant subgroup
+Index PerturbationCanonicalizer::n_cosets() const {
+  return m_coset_ops.size();
+}
+
+/// \brief Return the index into `engine().ops()` of the first operation
+///     that makes the configuration canonical
+///
+/// \param configuration A configuration, in the background supercell
+/// \param perturbed_sites Sites on which `configuration` may differ from the
+///     background. Sites not included are assumed, without checking, to have
+///     the background occupation.
+Index PerturbationCanonicalizer::to_canonical_index(
+    Configuration const &configuration,
+    std::set<Index> const &perturbed_sites) const {
+  _throw_if_other_supercell(configuration);
+  if (!_is_occupation_only(configuration)) {
+    return m_engine->to_canonical_index(configuration);
+  }
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  return _to_canonical_index(occupation,
+                             _changed_sites(occupation, &perturbed_sites));
+}
+
+/// \brief Return the index into `engine().ops()` of the first operation
+///     that makes the configuration canonical
+///
+/// The sites where `configuration` differs from the background are found
+/// by comparing all sites once.
+Index PerturbationCanonicalizer::to_canonical_index(
+    Configuration const &configuration) const {
+  _throw_if_other_supercell(configuration);
+  if (!_is_occupation_only(configuration)) {
+    return m_engine->to_canonical_index(configuration);
+  }
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  return _to_canonical_index(occupation, _changed_sites(occupation, nullptr));
+}
+
+/// \brief Return the canonical form of a perturbed configuration
+///
+/// \param configuration A configuration, in the background supercell
+/// \param perturbed_sites Sites on which `configuration` may differ from the
+///     background. Sites not included are assumed, without checking, to have
+///     the background occupation.
+///
+/// \returns The same configuration as
+///     `engine().make_canonical_form(configuration)`.
+Configuration PerturbationCanonicalizer::make_canonical_form(
+    Configuration const &configuration,
+    std::set<Index> const &perturbed_sites) const {
+  Index i = to_canonical_index(configuration, perturbed_sites);
+  if (!_is_occupation_only(configuration)) {
+    return m_engine->make_canonical_form(configuration);
+  }
+  Configuration canonical_configuration(configuration);
+  m_engine->apply_occupation(i, configuration.dof_values.occupation,
+                             canonical_configuration.dof_values.occupation);
+  return canonical_configuration;
+}
+
+/// \brief Return the canonical form of a perturbed configuration
+///
+/// The sites where `configuration` differs from the background are found
+/// by comparing all sites once.
+Configuration PerturbationCanonicalizer::make_canonical_form(
+    Configuration const &configuration) const {
+  Index i = to_canonical_index(configuration);
+  if (!_is_occupation_only(configuration)) {
+    return m_engine->make_canonical_form(configuration);
+  }
+  Configuration canonical_configuration(configuration);
+  m_engine->apply_occupation(i, configuration.dof_values.occupation,
+                             canonical_configuration.dof_values.occupation);
+  return canonical_configuration;
+}
+
+/// \brief Sites where the occupation differs from the background
+///
+/// If `perturbed_sites` is not null, only those sites are checked.
+std::vector<Index> PerturbationCanonicalizer::_changed_sites(
+    Eigen::VectorXi const &occupation,
+    std::set<Index> const *perturbed_sites) const {
+  Eigen::VectorXi const &background = m_background.dof_values.occupation;
+  std::vector<Index> changed_sites;
+  if (perturbed_sites == nullptr) {
+    for (Index s = 0; s < m_n_sites; ++s) {
+      if (occupation[s] != background[s]) {
+        changed_sites.push_back(s);
+      }
+    }
+    return changed_sites;
+  }
+  for (Index s : *perturbed_sites) {
+    if (s < 0 || s >= m_n_sites) {
+      throw std::runtime_error(
+          "Error in PerturbationCanonicalizer: invalid perturbed site index");
+    }
+    if (occupation[s] != background[s]) {
+      changed_sites.push_back(s);
+    }
+  }
+  return changed_sites;
+}
+
+/// \brief Index of the best operation, given the changed sites
+Index PerturbationCanonicalizer::_to_canonical_index(
+    Eigen::VectorXi const &occupation,
+    std::vector<Index> const &changed_sites) const {
+  Candidate best;
+  Candidate current;
+  Candidate coset_best;
+  bool has_best = false;
+  for (Index c = 0; c < m_coset_ops.size(); ++c) {
+    // best in coset: backgrounds are identical, compare images only
+    bool has_coset_best = false;
+    for (Index op_index : m_coset_ops[c]) {
+      current.op_index = op_index;
+      current.coset_index = c;
+      _make_image(occupation, changed_sites, op_index, current.image);
+      if (!has_coset_best || _compare(coset_best, current) < 0) {
+        std::swap(coset_best, current);
+        has_coset_best = true;
+      }
+    }
+
+    // best overall: on ties keep the first operation
+    if (!has_best) {
+      std::swap(best, coset_best);
+      has_best = true;
+      continue;
+    }
+    int result = _compare(best, coset_best);
+    if (result < 0 || (result == 0 && coset_best.op_index < best.op_index)) {
+      std::swap(best, coset_best);
+    }
+  }
+  return best.op_index;
+}
+
+/// \brief Set `image` to the image sites and values of the changed sites
+void PerturbationCanonicalizer::_make_image(
+    Eigen::VectorXi const &occupation,
+    std::vector<Index> const &changed_sites, Index op_index,
+    std::vector<ImageSite> &image) const {
+  Index const *inverse = m_inverse_permutations.data() + op_index * m_n_sites;
+  image.clear();
+  for (Index s : changed_sites) {
+    Index l = inverse[s];
+    image.push_back({l, m_engine->occupation_value(occupation, op_index, l)});
+  }
+  std::sort(image.begin(), image.end(),
+            [](ImageSite const &lhs, ImageSite const &rhs) {
+              return lhs.site < rhs.site;
+            });
+}
+
+/// \brief Lexicographically compare two transformed configurations
+///
+/// \returns -1, 0, or 1 if the occupation transformed to `A` is less than,
+///     equal to, or greater than the occupation transformed to `B`.
+int PerturbationCanonicalizer::_compare(Candidate const &A,
+                                        Candidate const &B) const {
+  bool const same_background = (A.coset_index == B.coset_index);
+  int const *A_background =
+      m_coset_backgrounds.data() + A.coset_index * m_n_sites;
+  int const *B_background =
+      m_coset_backgrounds.data() + B.coset_index * m_n_sites;
+  auto A_it = A.image.begin();
+  auto B_it = B.image.begin();
+  Index l = 0;
+  while (true) {
+    Index next = m_n_sites;
+    if (A_it != A.image.end()) {
+      next = std::min(next, A_it->site);
+    }
+    if (B_it != B.image.end()) {
+      next = std::min(next, B_it->site);
+    }
+    if (!same_background) {
+      for (; l < next; ++l) {
+        if (A_background[l] != B_background[l]) {
+          return A_background[l] < B_background[l] ? -1 : 1;
+        }
+      }
+    }
+    if (next == m_n_sites) {
+      return 0;
+    }
+    int a = A_background[next];
+    if (A_it != A.image.end() && A_it->site == next) {
+      a = A_it->value;
+      ++A_it;
+    }
+    int b = B_background[next];
+    if (B_it != B.image.end() && B_it->site == next) {
+      b = B_it->value;
+      ++B_it;
+    }
+    if (a != b) {
+      return a < b ? -1 : 1;
+    }
+    l = next + 1;
+  }
+}
+
+/// \brief Return true if the fast occupation-only comparisons give the same
+///     result as ConfigCompare
+bool PerturbationCanonicalizer::_is_occupation_only(
+    Configuration const &configuration) const {
+  return configuration.dof_values.global_dof_values.empty() &&
+         configuration.dof_values.local_dof_values.empty();
+}
+
+void PerturbationCanonicalizer::_throw_if_other_supercell(
+    Configuration const &configuration) const {
+  if (configuration.supercell != m_engine->supercell() &&
+      *configuration.supercell != *m_engine->supercell()) {
+    throw std::runtime_error(
+        "Error in PerturbationCanonicalizer: configuration supercell does not "
+        "match");
+  }
+}
+
+/// \brief Constructor
+///
+/// \param _event_group_engine A CanonicalFormEngine constructed with the
+///     SupercellSymOp consistent with both the supercell of the background
+///     and a local subgroup of the prim factor group that leaves the event
+///     invariant
+/// \param _background The background configuration
+/// \param _event_sites Linear sites indices of the cluster of sites that
+///     change during the event
+/// \param _occ_init Initial occupation on event sites
+/// \param _occ_final Final occupation on event sites
+LocalPerturbationCanonicalizer::LocalPerturbationCanonicalizer(
+    std::shared_ptr<CanonicalFormEngine const> const &_event_group_engine,
+    Configuration const &_background, std::vector<Index> const &_event_sites,
+    std::vector<int> const &_occ_init, std::vector<int> const &_occ_final)
+    : m_event_sites(_event_sites),
+      m_occ_init(_occ_init),
+      m_occ_final(_occ_final),
+      m_init(_event_group_engine,
+             copy_apply_occ(_background, m_event_sites, m_occ_init)),
+      m_final(_event_group_engine,
+              copy_apply_occ(_background, m_event_sites, m_occ_final)) {}
+
+/// \brief Return the canonical form of a perturbed configuration, in the
+///     context of the event
+///
+/// \param configuration A configuration, in the background supercell
+/// \param perturbed_sites Sites on which `configuration` may differ from the
+///     background. Sites not included, other than the event sites, are
+///     assumed, without checking, to have the background occupation.
+///
+/// \returns The canonical configuration, allowing either the initial or
+///     final occupation on the event sites.
+Configuration LocalPerturbationCanonicalizer::make_canonical_form(
+    Configuration const &configuration,
+    std::set<Index> const &perturbed_sites) const {
+  Configuration canonical_config_init = m_init.make_canonical_form(
+      copy_apply_occ(configuration, m_event_sites, m_occ_init),
+      perturbed_sites);
+  Configuration canonical_config_final = m_final.make_canonical_form(
+      copy_apply_occ(configuration, m_event_sites, m_occ_final),
+      perturbed_sites);
+  if (canonical_config_final > canonical_config_init) {
+    return canonical_config_final;
+  }
+  return canonical_config_init;
+}
+
+}  // namespace config
+}  // namespace CASM
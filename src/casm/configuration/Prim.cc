@@ -54,6 +54,7 @@ Prim::Prim(std::shared_ptr<BasicStructure const> const &_basicstructure)
           "Error in Prim constructor: _basicstructure == nullptr")),
       global_dof_info(clexulator::make_global_dof_info(*basicstructure)),
       local_dof_info(clexulator::make_local_dof_info(*basicstructure)),
+      dof_basis_info(global_dof_info, local_dof_info),
       is_atomic(_is_atomic(*basicstructure)),
       sym_info(*basicstructure),
       magspin_info(*basicstructure) {
@@ -68,11 +69,32 @@ Prim::Prim(std::vector<xtal::SymOp> const &factor_group_elements,
           "Error in Prim constructor: _basicstructure == nullptr")),
       global_dof_info(clexulator::make_global_dof_info(*basicstructure)),
       local_dof_info(clexulator::make_local_dof_info(*basicstructure)),
+      dof_basis_info(global_dof_info, local_dof_info),
       is_atomic(_is_atomic(*basicstructure)),
       sym_info(factor_group_elements, *basicstructure),
       magspin_info(*basicstructure) {
   _validate_unique_names(*basicstructure);
 }
 
+/// \brief Construct using existing symmetry representations
+///
+/// \param _sym_info Symmetry representations, which must have been
+///     constructed for `*_basicstructure` (for example, by PrimSymInfoCache).
+///     They are copied, not checked.
+/// \param _basicstructure The prim structure
+Prim::Prim(PrimSymInfo const &_sym_info,
+           std::shared_ptr<BasicStructure const> const &_basicstructure)
+    : basicstructure(throw_if_equal_to_nullptr(
+          _basicstructure,
+          "Error in Prim constructor: _basicstructure == nullptr")),
+      global_dof_info(clexulator::make_global_dof_info(*basicstructure)),
+      local_dof_info(clexulator::make_local_dof_info(*basicstructure)),
+      dof_basis_info(global_dof_info, local_dof_info),
+      is_atomic(_is_atomic(*basicstructure)),
+      sym_info(_sym_info),
+      magspin_info(*basicstructure) {
+  _validate_unique_names(*basicstructure);
+}
+
 }  // namespace config
 }  // namespace CASM
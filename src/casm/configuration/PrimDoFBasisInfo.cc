@@ -0,0 +1,130 @@
+#include "casm/configuration/PrimDoFBasisInfo.hh"
+
+#include <algorithm>
+
+#include "casm/clexulator/ConfigDoFValues.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+PrimDoFBasisInfo::Basis _make_basis(xtal::DoFSet const &dof_set) {
+  return PrimDoFBasisInfo::Basis{dof_set.basis(), dof_set.inv_basis()};
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param global_dof_info The prim global DoF basis sets, as
+///     Prim::global_dof_info
+/// \param local_dof_info The prim local DoF basis sets, by sublattice, as
+///     Prim::local_dof_info
+PrimDoFBasisInfo::PrimDoFBasisInfo(
+    std::map<DoFKey, xtal::DoFSet> const &global_dof_info,
+    std::map<DoFKey, std::vector<xtal::SiteDoFSet>> const &local_dof_info) {
+  for (auto const &pair : global_dof_info) {
+    global.emplace(pair.first, _make_basis(pair.second));
+  }
+  for (auto const &pair : local_dof_info) {
+    LocalBasis local_basis{0, 0, {}};
+    for (auto const &dof_set : pair.second) {
+      local_basis.sublattice.push_back(_make_basis(dof_set));
+      Basis const &b = local_basis.sublattice.back();
+      local_basis.standard_dim =
+          std::max(local_basis.standard_dim, Index(b.basis.rows()));
+      local_basis.prim_dim =
+          std::max(local_basis.prim_dim, Index(b.basis.cols()));
+    }
+    local.emplace(pair.first, std::move(local_basis));
+  }
+}
+
+/// \brief Convert DoF values from the prim basis to the standard basis,
+///     writing into existing storage
+///
+/// \param dof_basis_info Conversion matrices, as Prim::dof_basis_info
+/// \param prim_dof_values DoF values, in the prim basis
+/// \param n_unitcells Number of unit cells in the supercell
+/// \param standard_dof_values Set to the DoF values in the standard basis.
+///     Matrices with the correct shape are overwritten without
+///     reallocating.
+///
+/// Gives the same result as `clexulator::to_standard_values`.
+void to_standard_values(PrimDoFBasisInfo const &dof_basis_info,
+                        ConfigDoFValues const &prim_dof_values,
+                        Index n_unitcells,
+                        ConfigDoFValues &standard_dof_values) {
+  standard_dof_values.occupation = prim_dof_values.occupation;
+  for (auto const &pair : dof_basis_info.global) {
+    Eigen::VectorXd const &x = prim_dof_values.global_dof_values.at(pair.first);
+    Eigen::VectorXd &y = standard_dof_values.global_dof_values[pair.first];
+    y.resize(pair.second.basis.rows());
+    y.noalias() = pair.second.basis * x;
+  }
+  for (auto const &pair : dof_basis_info.local) {
+    auto const &local_basis = pair.second;
+    Eigen::MatrixXd const &x = prim_dof_values.local_dof_values.at(pair.first);
+    Eigen::MatrixXd &y = standard_dof_values.local_dof_values[pair.first];
+    Index n_sublat = local_basis.sublattice.size();
+    y.resize(local_basis.standard_dim, n_sublat * n_unitcells);
+    for (Index b = 0; b < n_sublat; ++b) {
+      Eigen::MatrixXd const &B = local_basis.sublattice[b].basis;
+      auto y_b = y.block(0, b * n_unitcells, y.rows(), n_unitcells);
+      if (B.cols() == 0) {
+        y_b.setZero();
+        continue;
+      }
+      y_b.topRows(B.rows()).noalias() =
+          B * x.block(0, b * n_unitcells, B.cols(), n_unitcells);
+      y_b.bottomRows(y.rows() - B.rows()).setZero();
+    }
+  }
+}
+
+/// \brief Convert DoF values from the standard basis to the prim basis,
+///     writing into existing storage
+///
+/// \param dof_basis_info Conversion matrices, as Prim::dof_basis_info
+/// \param standard_dof_values DoF values, in the standard basis
+/// \param n_unitcells Number of unit cells in the supercell
+/// \param prim_dof_values Set to the DoF values in the prim basis.
+///     Matrices with the correct shape are overwritten without
+///     reallocating.
+///
+/// Gives the same result as `clexulator::from_standard_values`.
+void from_standard_values(PrimDoFBasisInfo const &dof_basis_info,
+                          ConfigDoFValues const &standard_dof_values,
+                          Index n_unitcells, ConfigDoFValues &prim_dof_values) {
+  prim_dof_values.occupation = standard_dof_values.occupation;
+  for (auto const &pair : dof_basis_info.global) {
+    Eigen::VectorXd const &x =
+        standard_dof_values.global_dof_values.at(pair.first);
+    Eigen::VectorXd &y = prim_dof_values.global_dof_values[pair.first];
+    y.resize(pair.second.inv_basis.rows());
+    y.noalias() = pair.second.inv_basis * x;
+  }
+  for (auto const &pair : dof_basis_info.local) {
+    auto const &local_basis = pair.second;
+    Eigen::MatrixXd const &x =
+        standard_dof_values.local_dof_values.at(pair.first);
+    Eigen::MatrixXd &y = prim_dof_values.local_dof_values[pair.first];
+    Index n_sublat = local_basis.sublattice.size();
+    y.resize(local_basis.prim_dim, n_sublat * n_unitcells);
+    for (Index b = 0; b < n_sublat; ++b) {
+      Eigen::MatrixXd const &B_inv = local_basis.sublattice[b].inv_basis;
+      auto y_b = y.block(0, b * n_unitcells, y.rows(), n_unitcells);
+      if (B_inv.rows() == 0) {
+        y_b.setZero();
+        continue;
+      }
+      y_b.topRows(B_inv.rows()).noalias() =
+          B_inv * x.block(0, b * n_unitcells, B_inv.cols(), n_unitcells);
+      y_b.bottomRows(y.rows() - B_inv.rows()).setZero();
+    }
+  }
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -60,6 +60,11 @@ PrimSymInfo::PrimSymInfo(std::shared_ptr<SymGroup const> const &_factor_group,
 
   this->global_dof_symgroup_rep =
       make_global_dof_symgroup_rep(this->factor_group->element, prim);
+
+  this->packed_local_dof_symgroup_rep =
+      make_packed_dof_symgroup_rep(this->local_dof_symgroup_rep);
+  this->packed_global_dof_symgroup_rep =
+      make_packed_dof_symgroup_rep(this->global_dof_symgroup_rep);
 }
 
 }  // namespace config
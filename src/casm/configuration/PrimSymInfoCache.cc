@@ -0,0 +1,184 @@
+#include "casm/configuration/PrimSymInfoCache.hh"
+
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/PrimSymInfo.hh"
+#include "casm/configuration/io/json/PrimSymInfo_json_io.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/io/BasicStructureIO.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief Prim JSON, with the lattice tolerance, used as the cache key
+jsonParser _make_prim_json(BasicStructure const &prim) {
+  jsonParser json;
+  bool include_va = true;
+  write_prim(prim, json, FRAC, include_va);
+  json["xtal_tol"] = prim.lattice().tol();
+  return json;
+}
+
+std::string _to_string(jsonParser const &json) {
+  std::stringstream ss;
+  ss << json;
+  return ss.str();
+}
+
+/// \brief 64-bit FNV-1a hash, as hexadecimal
+///
+/// Used instead of std::hash so that digests, and file names in the cache
+/// directory, are the same for all builds.
+std::string _fnv1a_hex(std::string const &value) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : value) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return ss.str();
+}
+
+}  // namespace
+
+/// \brief Return a digest of a prim, used as a symmetry cache key
+///
+/// The digest is a hash of the prim JSON, as by `write_prim` with
+/// fractional coordinates and vacancies included, and the lattice
+/// tolerance. It is the same for all builds, so it may be used to name
+/// cached files.
+std::string make_prim_digest(BasicStructure const &prim) {
+  return _fnv1a_hex(_to_string(_make_prim_json(prim)));
+}
+
+/// \brief Constructor
+///
+/// \param _cache_dir If has_value, the directory used to read and write
+///     factor groups. It is created if it does not exist.
+PrimSymInfoCache::PrimSymInfoCache(std::optional<fs::path> _cache_dir)
+    : m_cache_dir(_cache_dir) {
+  if (m_cache_dir.has_value()) {
+    fs::create_directories(*m_cache_dir);
+  }
+}
+
+/// \brief Return stored PrimSymInfo for the prim, or construct, store,
+///     and return new PrimSymInfo
+///
+/// If not stored in memory, the factor group is read from the cache
+/// directory if possible, and otherwise found by `PrimSymInfo(prim)` and
+/// written to the cache directory.
+///
+/// The lock is not held while new PrimSymInfo is constructed, so concurrent
+/// calls with the same prim may each construct it. Only the first result
+/// stored is kept and returned.
+std::shared_ptr<PrimSymInfo const> PrimSymInfoCache::make(
+    BasicStructure const &prim) {
+  jsonParser prim_json = _make_prim_json(prim);
+  std::string key = _to_string(prim_json);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      return it->second;
+    }
+  }
+
+  std::string digest = _fnv1a_hex(key);
+  std::shared_ptr<PrimSymInfo const> result = _read(digest, key, prim);
+  if (!result) {
+    result = std::make_shared<PrimSymInfo const>(prim);
+    _write(digest, prim_json, *result, prim);
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.emplace(key, result).first->second;
+}
+
+/// \brief Construct a Prim, using stored PrimSymInfo if available
+std::shared_ptr<Prim const> PrimSymInfoCache::make_prim(
+    std::shared_ptr<BasicStructure const> const &basicstructure) {
+  throw_if_equal_to_nullptr(
+      basicstructure,
+      "Error in PrimSymInfoCache::make_prim: basicstructure == nullptr");
+  return std::make_shared<Prim const>(*make(*basicstructure), basicstructure);
+}
+
+/// \brief Directory used to store factor groups on disk, if any
+std::optional<fs::path> const &PrimSymInfoCache::cache_dir() const {
+  return m_cache_dir;
+}
+
+/// \brief Number of results stored in memory
+Index PrimSymInfoCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Erase results stored in memory
+///
+/// Files in the cache directory are not erased.
+void PrimSymInfoCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+/// \brief Read PrimSymInfo from the cache directory, or return nullptr
+///
+/// A file that can not be read, or that was written for a different prim
+/// with the same digest, is treated as missing.
+std::shared_ptr<PrimSymInfo const> PrimSymInfoCache::_read(
+    std::string const &digest, std::string const &key,
+    BasicStructure const &prim) const {
+  if (!m_cache_dir.has_value()) {
+    return nullptr;
+  }
+  fs::path path = *m_cache_dir / (digest + ".json");
+  if (!fs::exists(path)) {
+    return nullptr;
+  }
+  try {
+    jsonParser json(path);
+    if (!json.contains("prim") || _to_string(json["prim"]) != key) {
+      return nullptr;
+    }
+    return std::make_shared<PrimSymInfo const>(
+        jsonConstructor<PrimSymInfo>::from_json(json["sym_info"], prim));
+  } catch (std::exception const &) {
+    return nullptr;
+  }
+}
+
+/// \brief Write the factor group to the cache directory, if any
+///
+/// The file is written under a temporary name and then renamed, so readers
+/// never see a partially written file.
+void PrimSymInfoCache::_write(std::string const &digest,
+                              jsonParser const &prim_json,
+                              PrimSymInfo const &sym_info,
+                              BasicStructure const &prim) const {
+  if (!m_cache_dir.has_value()) {
+    return;
+  }
+  jsonParser json;
+  json["prim"] = prim_json;
+  to_json(sym_info, json["sym_info"], prim);
+
+  std::stringstream tmp_name;
+  tmp_name << digest << ".json.tmp."
+           << std::hash<std::thread::id>()(std::this_thread::get_id());
+  fs::path tmp_path = *m_cache_dir / tmp_name.str();
+  json.write(tmp_path);
+  fs::rename(tmp_path, *m_cache_dir / (digest + ".json"));
+}
+
+}  // namespace config
+}  // namespace CASM
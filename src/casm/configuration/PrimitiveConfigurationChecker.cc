@@ -0,0 +1,149 @@
+#include "casm/configuration/PrimitiveConfigurationChecker.hh"
+
+#include <algorithm>
+
+#include "casm/configuration/ConfigIsEquivalent.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief Return the distinct prime factors of n, in increasing order
+std::vector<Index> _prime_factors(Index n) {
+  std::vector<Index> result;
+  for (Index p = 2; p * p <= n; ++p) {
+    if (n % p == 0) {
+      result.push_back(p);
+      while (n % p == 0) {
+        n /= p;
+      }
+    }
+  }
+  if (n > 1) {
+    result.push_back(n);
+  }
+  return result;
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param _supercell The supercell of the configurations to be checked
+PrimitiveConfigurationChecker::PrimitiveConfigurationChecker(
+    std::shared_ptr<Supercell const> const &_supercell)
+    : m_supercell(throw_if_equal_to_nullptr(
+          _supercell,
+          "Error in PrimitiveConfigurationChecker: supercell is empty")) {
+  TranslationGrid const &grid = m_supercell->sym_info.translation_grid;
+  Eigen::Matrix3l from_grid = grid.to_grid.cast<double>()
+                                  .inverse()
+                                  .array()
+                                  .round()
+                                  .matrix()
+                                  .cast<long>();
+  auto const &converter = m_supercell->unitcell_index_converter;
+
+  for (Index p : _prime_factors(grid.shape(2))) {
+    std::vector<Index> dims;
+    for (Index i = 0; i < 3; ++i) {
+      if (grid.shape(i) % p == 0) {
+        dims.push_back(i);
+      }
+    }
+
+    // x in [0, p)^k, with first non-zero element equal to 1, gives one
+    // generator of each subgroup of order p
+    Index n_x = 1;
+    for (Index j = 0; j < dims.size(); ++j) {
+      n_x *= p;
+    }
+    std::vector<Index> x(dims.size());
+    for (Index c = 1; c < n_x; ++c) {
+      Index tmp = c;
+      for (Index j = 0; j < dims.size(); ++j) {
+        x[j] = tmp % p;
+        tmp /= p;
+      }
+      auto first = std::find_if(x.begin(), x.end(),
+                                [](Index value) { return value != 0; });
+      if (*first != 1) {
+        continue;
+      }
+      Eigen::Vector3l g = Eigen::Vector3l::Zero();
+      for (Index j = 0; j < dims.size(); ++j) {
+        g(dims[j]) = x[j] * (grid.shape(dims[j]) / p);
+      }
+      m_translation_indices.push_back(converter(UnitCell(from_grid * g)));
+    }
+  }
+
+  Index n_sites = m_supercell->unitcellcoord_index_converter.total_sites();
+  for (Index t : m_translation_indices) {
+    SupercellSymOp op(m_supercell, 0, t);
+    std::vector<Index> permutation(n_sites);
+    for (Index l = 0; l < n_sites; ++l) {
+      permutation[l] = op.permute_index(l);
+    }
+    m_permutations.push_back(std::move(permutation));
+  }
+}
+
+/// \brief The supercell
+std::shared_ptr<Supercell const> const &
+PrimitiveConfigurationChecker::supercell() const {
+  return m_supercell;
+}
+
+/// \brief Indices of the translations that are checked, one generating
+///     each subgroup of prime order
+std::vector<Index> const &PrimitiveConfigurationChecker::translation_indices()
+    const {
+  return m_translation_indices;
+}
+
+/// \brief Return true if no translations within the supercell result in
+///     the same configuration
+///
+/// Gives the same result as `is_primitive(configuration)`.
+///
+/// \param configuration A configuration in `supercell()`
+bool PrimitiveConfigurationChecker::is_primitive(
+    Configuration const &configuration) const {
+  if (*configuration.supercell != *m_supercell) {
+    throw std::runtime_error(
+        "Error in PrimitiveConfigurationChecker::is_primitive: supercell "
+        "does not match");
+  }
+  auto const &dof_values = configuration.dof_values;
+  if (dof_values.global_dof_values.empty() &&
+      dof_values.local_dof_values.empty()) {
+    Eigen::VectorXi const &occupation = dof_values.occupation;
+    for (std::vector<Index> const &permutation : m_permutations) {
+      Index l = 0;
+      Index n_sites = permutation.size();
+      while (l < n_sites && occupation[l] == occupation[permutation[l]]) {
+        ++l;
+      }
+      if (l == n_sites) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  ConfigIsEquivalent equal_to_f(configuration);
+  for (Index t : m_translation_indices) {
+    if (equal_to_f(SupercellSymOp(m_supercell, 0, t))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace config
+}  // namespace CASM
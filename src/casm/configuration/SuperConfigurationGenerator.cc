@@ -0,0 +1,130 @@
+#include "casm/configuration/SuperConfigurationGenerator.hh"
+
+#include <algorithm>
+#include <optional>
+
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/configuration/parallel.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param motif The motif configuration
+/// \param supercell The supercell to fill
+/// \param _batch_size Number of configurations made together. If
+///     `_batch_size < 1`, 1 is used.
+/// \param _n_threads Number of threads used to make each batch of
+///     configurations. If `_n_threads <= 0`, use the number of threads set by
+///     `set_num_threads`.
+SuperConfigurationGenerator::SuperConfigurationGenerator(
+    Configuration const &motif,
+    std::shared_ptr<Supercell const> const &supercell, Index _batch_size,
+    Index _n_threads)
+    : m_supercell(throw_if_equal_to_nullptr(
+          supercell,
+          "Error in SuperConfigurationGenerator: supercell is empty")),
+      m_engine(m_supercell),
+      m_batch_size(std::max(Index(1), _batch_size)),
+      m_n_threads(_n_threads),
+      m_prim_motif(make_primitive(motif)),
+      m_next_subset_index(0),
+      m_next_rep_index(0),
+      m_subset_index(-1) {
+  std::set<Index> ops = unique_generating_prim_factor_group_indices(
+      m_prim_motif, motif, m_supercell);
+  m_generating_prim_fg_ops = std::vector<Index>(ops.begin(), ops.end());
+}
+
+/// \brief The supercell being filled
+std::shared_ptr<Supercell const> const &SuperConfigurationGenerator::supercell()
+    const {
+  return m_supercell;
+}
+
+/// \brief Number of distinct configurations, which is the number of subsets
+Index SuperConfigurationGenerator::n_subsets() const {
+  return m_generating_prim_fg_ops.size();
+}
+
+/// \brief Set `configuration` to the next configuration, or return false
+///     if all configurations have been generated
+///
+/// \param configuration Set to the next configuration, if there is one,
+///     otherwise unchanged.
+///
+/// \returns True if `configuration` was set, false if all configurations
+///     have been generated.
+bool SuperConfigurationGenerator::next(Configuration &configuration) {
+  if (m_buffer.empty()) {
+    _fill_buffer();
+    if (m_buffer.empty()) {
+      return false;
+    }
+  }
+  configuration = std::move(m_buffer.front().first);
+  m_subset_index = m_buffer.front().second;
+  m_buffer.pop_front();
+  return true;
+}
+
+/// \brief Index of the subset of the configuration most recently returned
+///     by `next`
+///
+/// Subset `i` contains the configurations equivalent, by SupercellSymOp, to
+/// `make_distinct_super_configurations(motif, supercell)[i]`. Returns -1 if
+/// `next` has not returned a configuration.
+Index SuperConfigurationGenerator::subset_index() const {
+  return m_subset_index;
+}
+
+/// \brief Make the next batch of configurations
+void SuperConfigurationGenerator::_fill_buffer() {
+  std::vector<Task> tasks;
+  while (Index(tasks.size()) < m_batch_size) {
+    if (m_next_rep_index == Index(m_coset_reps.size())) {
+      if (!_begin_next_subset()) {
+        break;
+      }
+    }
+    tasks.push_back(Task{m_prototype, m_coset_reps[m_next_rep_index],
+                         m_next_subset_index - 1});
+    ++m_next_rep_index;
+  }
+
+  std::vector<std::optional<Configuration>> result(tasks.size());
+  parallel_for_chunks(
+      tasks.size(), m_n_threads, [&](Index chunk_begin, Index chunk_end) {
+        SupercellSymOpApplier applier;
+        for (Index i = chunk_begin; i < chunk_end; ++i) {
+          result[i] = applier.copy_apply(tasks[i].op, *tasks[i].prototype);
+        }
+      });
+  for (Index i = 0; i < tasks.size(); ++i) {
+    m_buffer.emplace_back(std::move(*result[i]), tasks[i].subset_index);
+  }
+}
+
+/// \brief Begin the next subset, returning false if there are none left
+bool SuperConfigurationGenerator::_begin_next_subset() {
+  while (m_next_subset_index < n_subsets()) {
+    UnitCell trans(0, 0, 0);
+    UnitCell origin(0, 0, 0);
+    m_prototype = std::make_shared<Configuration const>(copy_configuration(
+        m_generating_prim_fg_ops[m_next_subset_index], trans, m_prim_motif,
+        m_supercell, origin));
+    ++m_next_subset_index;
+    m_coset_reps = m_engine.make_left_coset_representatives(
+        m_engine.make_invariant_subgroup(*m_prototype));
+    m_next_rep_index = 0;
+    if (m_coset_reps.size()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -1,36 +1,198 @@
 #include "casm/configuration/Supercell.hh"
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+#include "casm/configuration/DiagonalIndexConverter.hh"
 #include "casm/configuration/SupercellSymInfo.hh"
+#include "casm/configuration/perf.hh"
+#include "casm/configuration/supercell_name.hh"
+#include "casm/configuration/trace.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/CanonicalForm.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
 
 namespace CASM {
 namespace config {
 
+namespace {  // anonymous
+
+/// \brief Process-wide table of weak references to shared Supercell, by
+///     prim and transformation matrix
+///
+/// Used by `make_shared_supercell`. Entries whose supercell has been
+/// destroyed are removed in sweeps, which run when the number of entries
+/// doubles, so the table size stays proportional to the number of live
+/// supercells.
+class SupercellInternTable {
+ public:
+  SupercellInternTable() : m_sweep_size(64) {}
+
+  /// \brief Return the live supercell for (prim, T), if any; else add and
+  ///     return `supercell`, if not null
+  std::shared_ptr<Supercell const> get(
+      std::shared_ptr<Prim const> const &prim,
+      Eigen::Matrix3l const &transformation_matrix_to_super,
+      std::shared_ptr<Supercell const> supercell) {
+    key_type key = _make_key(prim, transformation_matrix_to_super);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      // a live supercell keeps its prim alive, so the prim address in the key
+      // cannot have been reused
+      std::shared_ptr<Supercell const> existing = it->second.lock();
+      if (existing != nullptr) {
+        return existing;
+      }
+    }
+    if (supercell == nullptr) {
+      return nullptr;
+    }
+    m_entries[key] = supercell;
+    if (Index(m_entries.size()) > 2 * m_sweep_size) {
+      _sweep();
+    }
+    return supercell;
+  }
+
+ private:
+  typedef std::pair<Prim const *, std::array<long, 9>> key_type;
+
+  static key_type _make_key(
+      std::shared_ptr<Prim const> const &prim,
+      Eigen::Matrix3l const &transformation_matrix_to_super) {
+    key_type key;
+    key.first = prim.get();
+    for (Index i = 0; i < 3; ++i) {
+      for (Index j = 0; j < 3; ++j) {
+        key.second[3 * i + j] = transformation_matrix_to_super(i, j);
+      }
+    }
+    return key;
+  }
+
+  void _sweep() {
+    auto it = m_entries.begin();
+    while (it != m_entries.end()) {
+      if (it->second.expired()) {
+        it = m_entries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    m_sweep_size = std::max(Index(64), Index(m_entries.size()));
+  }
+
+  std::mutex m_mutex;
+
+  std::map<key_type, std::weak_ptr<Supercell const>> m_entries;
+
+  /// Number of entries after the last sweep
+  Index m_sweep_size;
+};
+
+SupercellInternTable &_supercell_intern_table() {
+  static SupercellInternTable table;
+  return table;
+}
+
+/// \brief Return a DiagonalIndexConverter if the transformation matrix is
+///     diagonal, else null
+std::shared_ptr<DiagonalIndexConverter const> _make_diagonal_index_converter(
+    Superlattice const &superlattice,
+    xtal::UnitCellIndexConverter const &unitcell_index_converter,
+    xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter) {
+  Eigen::Matrix3l const &T = superlattice.transformation_matrix_to_super();
+  if (!DiagonalIndexConverter::is_diagonal(T)) {
+    return nullptr;
+  }
+  return std::make_shared<DiagonalIndexConverter const>(
+      T, unitcell_index_converter, unitcellcoord_index_converter);
+}
+
+}  // namespace
+
 Supercell::Supercell(std::shared_ptr<Prim const> const &_prim,
                      Lattice const &_superlattice,
-                     Index max_n_translation_permutations)
+                     Index max_n_translation_permutations,
+                     Index translation_permutation_cache_max_bytes,
+                     Index combined_permutation_table_max_bytes)
     : Supercell(_prim,
                 Superlattice(_prim->basicstructure->lattice(), _superlattice),
-                max_n_translation_permutations) {}
+                max_n_translation_permutations,
+                translation_permutation_cache_max_bytes,
+                combined_permutation_table_max_bytes) {}
 
 Supercell::Supercell(std::shared_ptr<Prim const> const &_prim,
                      Superlattice const &_superlattice,
-                     Index max_n_translation_permutations)
+                     Index max_n_translation_permutations,
+                     Index translation_permutation_cache_max_bytes,
+                     Index combined_permutation_table_max_bytes)
     : prim(_prim),
       superlattice(_superlattice),
       unitcell_index_converter(superlattice.transformation_matrix_to_super()),
       unitcellcoord_index_converter(
           superlattice.transformation_matrix_to_super(),
           prim->basicstructure->basis().size()),
+      diagonal_index_converter(_make_diagonal_index_converter(
+          superlattice, unitcell_index_converter,
+          unitcellcoord_index_converter)),
       sym_info(prim, superlattice, unitcell_index_converter,
-               unitcellcoord_index_converter, max_n_translation_permutations) {}
+               unitcellcoord_index_converter, max_n_translation_permutations,
+               translation_permutation_cache_max_bytes,
+               diagonal_index_converter.get()),
+      combined_permutation_table_max_bytes(
+          combined_permutation_table_max_bytes) {
+  CASM_CONFIGURATION_PERF_COUNT(supercell_construction);
+}
 
 Supercell::Supercell(std::shared_ptr<Prim const> const &_prim,
                      Eigen::Matrix3l const &_superlattice_matrix,
-                     Index max_n_translation_permutations)
+                     Index max_n_translation_permutations,
+                     Index translation_permutation_cache_max_bytes,
+                     Index combined_permutation_table_max_bytes)
     : Supercell(
           _prim,
           Superlattice(_prim->basicstructure->lattice(), _superlattice_matrix),
-          max_n_translation_permutations) {}
+          max_n_translation_permutations,
+          translation_permutation_cache_max_bytes,
+          combined_permutation_table_max_bytes) {}
+
+/// \brief Constructor, using precomputed symmetry info
+///
+/// \param _prim The prim
+/// \param _superlattice The supercell lattice
+/// \param _sym_info Symmetry info for `_superlattice`, such as constructed
+///     by `SupercellSymInfoTables::make_sym_info`. It must have been
+///     constructed for the same prim and superlattice, which is not
+///     checked beyond its size.
+/// \param combined_permutation_table_max_bytes Memory budget, in bytes, of
+///     the combined permutation table
+Supercell::Supercell(std::shared_ptr<Prim const> const &_prim,
+                     Superlattice const &_superlattice,
+                     SupercellSymInfo &&_sym_info,
+                     Index combined_permutation_table_max_bytes)
+    : prim(_prim),
+      superlattice(_superlattice),
+      unitcell_index_converter(superlattice.transformation_matrix_to_super()),
+      unitcellcoord_index_converter(
+          superlattice.transformation_matrix_to_super(),
+          prim->basicstructure->basis().size()),
+      diagonal_index_converter(_make_diagonal_index_converter(
+          superlattice, unitcell_index_converter,
+          unitcellcoord_index_converter)),
+      sym_info(std::move(_sym_info)),
+      combined_permutation_table_max_bytes(
+          combined_permutation_table_max_bytes) {
+  if (sym_info.translation_grid.size() != superlattice.size()) {
+    throw std::runtime_error(
+        "Error in Supercell: sym_info does not match superlattice");
+  }
+  CASM_CONFIGURATION_PERF_COUNT(supercell_construction);
+}
 
 /// \brief Less than comparison of Supercell
 bool Supercell::operator<(Supercell const &B) const {
@@ -45,6 +207,29 @@ bool Supercell::operator<(Supercell const &B) const {
   return superlattice.superlattice() < B.superlattice.superlattice();
 }
 
+/// \brief Linear unit cell index of a unit cell, brought within the
+///     supercell
+///
+/// Equivalent to `unitcell_index_converter(unitcell)`, using
+/// `diagonal_index_converter` if it is not null.
+Index Supercell::linear_unitcell_index(UnitCell const &unitcell) const {
+  if (diagonal_index_converter != nullptr) {
+    return diagonal_index_converter->linear_unitcell_index(unitcell);
+  }
+  return unitcell_index_converter(unitcell);
+}
+
+/// \brief Linear site index of a site, brought within the supercell
+///
+/// Equivalent to `unitcellcoord_index_converter(bijk)`, using
+/// `diagonal_index_converter` if it is not null.
+Index Supercell::linear_site_index(UnitCellCoord const &bijk) const {
+  if (diagonal_index_converter != nullptr) {
+    return diagonal_index_converter->linear_site_index(bijk);
+  }
+  return unitcellcoord_index_converter(bijk);
+}
+
 /// \brief Equality comparison of Supercell
 bool Supercell::eq_impl(Supercell const &B) const {
   if (this == &B) {
@@ -59,5 +244,253 @@ bool Supercell::eq_impl(Supercell const &B) const {
          B.superlattice.transformation_matrix_to_super();
 }
 
+/// \brief Return true if the superlattice is a right-handed lattice in
+///     canonical form
+///
+/// Computed on first use of any canonical supercell data, then stored.
+bool Supercell::is_canonical() const { return _canonical_data().is_canonical; }
+
+/// \brief Return the canonical equivalent supercell
+///
+/// Notes:
+/// - The result has a right-handed lattice that compares greater to all
+///   equivalents with respect to prim point group symmetry, as for
+///   `make_canonical_form(Supercell const &)`.
+/// - The result is obtained using `make_shared_supercell`. If this supercell
+///   is canonical, the result compares equal to this supercell.
+std::shared_ptr<Supercell const> Supercell::canonical_supercell() const {
+  CanonicalData const &data = _canonical_data();
+  if (data.is_canonical) {
+    return make_shared_supercell(prim, superlattice);
+  }
+  return data.canonical_supercell;
+}
+
+/// \brief Return the index of a prim factor group operation that
+///     transforms this supercell to the canonical equivalent supercell
+///
+/// Equivalent to `prim_factor_group_index_to_supercell(this,
+/// canonical_supercell())`, but computed only once.
+Index Supercell::prim_factor_group_index_to_canonical() const {
+  return _canonical_data().prim_factor_group_index_to_canonical;
+}
+
+/// \brief Return the name of the canonical equivalent supercell
+std::string const &Supercell::canonical_supercell_name() const {
+  return _canonical_data().canonical_supercell_name;
+}
+
+/// \brief Return canonical equivalent supercell data, computing it on
+///     first use
+Supercell::CanonicalData const &Supercell::_canonical_data() const {
+  std::call_once(m_canonical_data_flag, [&]() {
+    CanonicalData data;
+    Lattice const &current_superlattice = superlattice.superlattice();
+    auto const &point_group = prim->sym_info.point_group->element;
+
+    data.is_canonical =
+        current_superlattice.is_right_handed() &&
+        xtal::canonical::check(current_superlattice, point_group);
+
+    Lattice canonical_superlattice = current_superlattice;
+    if (!data.is_canonical) {
+      canonical_superlattice.make_right_handed();
+      canonical_superlattice = xtal::canonical::equivalent(
+          canonical_superlattice, point_group, canonical_superlattice.tol());
+      data.canonical_supercell = make_shared_supercell(
+          prim,
+          Superlattice(superlattice.prim_lattice(), canonical_superlattice));
+      canonical_superlattice =
+          data.canonical_supercell->superlattice.superlattice();
+    }
+
+    auto const &prim_fg = prim->sym_info.factor_group->element;
+    auto res = xtal::is_equivalent_superlattice(
+        canonical_superlattice, current_superlattice, prim_fg.begin(),
+        prim_fg.end(), canonical_superlattice.tol());
+    if (res.first == prim_fg.end()) {
+      throw std::runtime_error(
+          "Error in Supercell: canonical supercell is not equivalent");
+    }
+    data.prim_factor_group_index_to_canonical =
+        std::distance(prim_fg.begin(), res.first);
+
+    data.canonical_supercell_name = make_supercell_name(
+        superlattice.prim_lattice(), canonical_superlattice);
+
+    m_canonical_data = std::move(data);
+  });
+  return m_canonical_data;
+}
+
+/// \brief Ideal site coordinates, in Cartesian coordinates, as columns
+///     by linear site index
+///
+/// Computed on first use and then stored. Thread safe.
+Eigen::Matrix3Xd const &Supercell::site_coordinate_cart() const {
+  return _site_data().coordinate_cart;
+}
+
+/// \brief Sublattice index, by linear site index
+///
+/// Computed on first use and then stored. Thread safe.
+std::vector<Index> const &Supercell::site_sublattice_index() const {
+  return _site_data().sublattice_index;
+}
+
+/// \brief Linear unit cell index, by linear site index
+///
+/// Computed on first use and then stored. Thread safe.
+std::vector<Index> const &Supercell::site_unitcell_index() const {
+  return _site_data().unitcell_index;
+}
+
+/// \brief Memory used by the per-site tables, in bytes, or 0 if they have
+///     not been computed yet
+Index Supercell::site_data_bytes() const {
+  if (!m_has_site_data.load(std::memory_order_acquire)) {
+    return 0;
+  }
+  Index n_sites = m_site_data.sublattice_index.size();
+  return n_sites * (3 * sizeof(double) + 2 * sizeof(Index));
+}
+
+/// \brief Return the table of combined permutations of all supercell
+///     operations, constructing it on first use, or null if it does not
+///     fit in the memory budget
+///
+/// The table is constructed if `CombinedPermutationTable::required_bytes`
+/// is at most `combined_permutation_table_max_bytes`. Thread safe.
+CombinedPermutationTable const *Supercell::combined_permutation_table() const {
+  std::call_once(m_combined_permutation_table_flag, [&]() {
+    if (CombinedPermutationTable::required_bytes(*this) <=
+        combined_permutation_table_max_bytes) {
+      m_combined_permutation_table =
+          std::make_unique<CombinedPermutationTable const>(*this);
+      m_has_combined_permutation_table.store(true, std::memory_order_release);
+    }
+  });
+  return m_combined_permutation_table.get();
+}
+
+/// \brief Memory used by the combined permutation table, in bytes, or 0
+///     if it has not been constructed
+Index Supercell::combined_permutation_table_bytes() const {
+  if (!m_has_combined_permutation_table.load(std::memory_order_acquire)) {
+    return 0;
+  }
+  return m_combined_permutation_table->size_bytes();
+}
+
+/// \brief Return per-site tables, computing them on first use
+Supercell::SiteData const &Supercell::_site_data() const {
+  std::call_once(m_site_data_flag, [&]() {
+    auto const &xtal_prim = *prim->basicstructure;
+    Index n_sites = unitcellcoord_index_converter.total_sites();
+    SiteData data;
+    data.coordinate_cart.resize(3, n_sites);
+    data.sublattice_index.resize(n_sites);
+    data.unitcell_index.resize(n_sites);
+    for (Index l = 0; l < n_sites; ++l) {
+      xtal::UnitCellCoord bijk = unitcellcoord_index_converter(l);
+      data.coordinate_cart.col(l) = bijk.coordinate(xtal_prim).const_cart();
+      data.sublattice_index[l] = bijk.sublattice();
+      data.unitcell_index[l] = unitcell_index_converter(bijk.unitcell());
+    }
+    m_site_data = std::move(data);
+    m_has_site_data.store(true, std::memory_order_release);
+  });
+  return m_site_data;
+}
+
+/// \brief Estimate the memory used by a Supercell
+///
+/// \param supercell The supercell
+/// \param context Records shared objects already counted. If `supercell`
+///     is already recorded, all components are 0.
+///
+/// The prim, and the canonical equivalent supercell if it is a different
+/// Supercell, are not included.
+SupercellMemoryUsage make_memory_usage(Supercell const &supercell,
+                                       MemoryUsageContext &context) {
+  SupercellMemoryUsage usage;
+  usage.n_sites = supercell.unitcellcoord_index_converter.total_sites();
+  if (!context.insert(&supercell)) {
+    return usage;
+  }
+  usage.sym_info = make_memory_usage(supercell.sym_info, context);
+  usage.site_data_bytes = supercell.site_data_bytes();
+  usage.combined_permutation_table_bytes =
+      supercell.combined_permutation_table_bytes();
+  usage.other_bytes = sizeof(Supercell) - sizeof(SupercellSymInfo);
+  if (supercell.diagonal_index_converter != nullptr) {
+    usage.other_bytes += sizeof(DiagonalIndexConverter) +
+                         supercell.diagonal_index_converter->size_bytes();
+  }
+  return usage;
+}
+
+/// \brief Estimate the memory used by a Supercell, in bytes
+///
+/// Equivalent to `make_memory_usage(supercell, context).total_bytes()`, with
+/// a new MemoryUsageContext.
+Index memory_usage(Supercell const &supercell) {
+  MemoryUsageContext context;
+  return make_memory_usage(supercell, context).total_bytes();
+}
+
+/// \brief Return a shared Supercell, reusing an existing one if possible
+///
+/// Notes:
+/// - Supercell construction computes its symmetry representations
+///   (SupercellSymInfo), which can be expensive. This function keeps a
+///   process-wide table of weak references to the supercells it returns,
+///   keyed by prim and transformation matrix, and returns the existing
+///   supercell if it is still in use elsewhere. Supercells that are no
+///   longer used are destroyed as usual.
+/// - Supercells are constructed with default parameters. Supercells
+///   constructed directly are not added to the table.
+/// - Thread safe. The supercell is constructed without holding the table
+///   lock; if another thread concurrently constructs the same supercell, the
+///   first one added to the table is returned.
+///
+/// \param prim The prim
+/// \param transformation_matrix_to_super The transformation matrix, T,
+///     relating the superlattice vectors, S, to the prim lattice vectors, L,
+///     according to `S = L * T`.
+std::shared_ptr<Supercell const> make_shared_supercell(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  SupercellInternTable &table = _supercell_intern_table();
+  auto existing = table.get(prim, transformation_matrix_to_super, nullptr);
+  if (existing != nullptr) {
+    return existing;
+  }
+  CASM_CONFIGURATION_TRACE_SCOPE("make_shared_supercell");
+  return table.get(prim, transformation_matrix_to_super,
+                   std::make_shared<Supercell const>(
+                       prim, transformation_matrix_to_super));
+}
+
+/// \brief Return a shared Supercell, reusing an existing one if possible
+///
+/// Equivalent to `make_shared_supercell(prim,
+/// superlattice.transformation_matrix_to_super())`.
+std::shared_ptr<Supercell const> make_shared_supercell(
+    std::shared_ptr<Prim const> const &prim, Superlattice const &superlattice) {
+  return make_shared_supercell(prim,
+                               superlattice.transformation_matrix_to_super());
+}
+
+/// \brief Return a shared Supercell, reusing an existing one if possible
+///
+/// Equivalent to `make_shared_supercell(prim, Superlattice(prim_lattice,
+/// superlattice))`.
+std::shared_ptr<Supercell const> make_shared_supercell(
+    std::shared_ptr<Prim const> const &prim, Lattice const &superlattice) {
+  return make_shared_supercell(
+      prim, Superlattice(prim->basicstructure->lattice(), superlattice));
+}
+
 }  // namespace config
 }  // namespace CASM
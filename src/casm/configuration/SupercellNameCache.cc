@@ -0,0 +1,174 @@
+#include "casm/configuration/SupercellNameCache.hh"
+
+#include <iterator>
+#include <stdexcept>
+
+#include "casm/configuration/Prim.hh"
+#include "casm/crystallography/CanonicalForm.hh"
+#include "casm/crystallography/Lattice.hh"
+#include "casm/crystallography/Superlattice.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// \brief Construct an entry, canonicalizing the superlattice
+///
+/// This follows the canonicalization done by `Supercell`, so that entries
+/// agree with `Supercell::canonical_supercell_name()` and
+/// `Supercell::prim_factor_group_index_to_canonical()`.
+SupercellNameCache::Entry _make_entry(Prim const &prim,
+                                      HermiteNormalFormKey const &key) {
+  SupercellNameCache::Entry entry;
+  entry.key = key;
+  entry.supercell_name = make_supercell_name(key);
+
+  Lattice const &prim_lattice = prim.basicstructure->lattice();
+  auto const &point_group = prim.sym_info.point_group->element;
+  auto const &prim_fg = prim.sym_info.factor_group->element;
+
+  Lattice superlattice =
+      xtal::make_superlattice(prim_lattice, make_hermite_normal_form(key));
+  Lattice canonical_superlattice = superlattice;
+  canonical_superlattice.make_right_handed();
+  canonical_superlattice = xtal::canonical::equivalent(
+      canonical_superlattice, point_group, canonical_superlattice.tol());
+
+  auto res = xtal::is_equivalent_superlattice(
+      canonical_superlattice, superlattice, prim_fg.begin(), prim_fg.end(),
+      canonical_superlattice.tol());
+  if (res.first == prim_fg.end()) {
+    throw std::runtime_error(
+        "Error in SupercellNameCache: canonical supercell is not equivalent");
+  }
+  entry.prim_factor_group_index_to_canonical =
+      std::distance(prim_fg.begin(), res.first);
+
+  entry.canonical_transformation_matrix_to_super =
+      xtal::make_transformation_matrix_to_super(
+          prim_lattice, canonical_superlattice, prim_lattice.tol());
+  entry.canonical_key = make_hermite_normal_form_key(
+      entry.canonical_transformation_matrix_to_super);
+  entry.canonical_supercell_name = make_supercell_name(entry.canonical_key);
+  return entry;
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param _prim The prim. Entries are only valid for supercells of this
+///     prim.
+SupercellNameCache::SupercellNameCache(std::shared_ptr<Prim const> const &_prim)
+    : m_prim(throw_if_equal_to_nullptr(
+          _prim, "Error in SupercellNameCache: prim is empty")) {}
+
+/// \brief The prim
+std::shared_ptr<Prim const> const &SupercellNameCache::prim() const {
+  return m_prim;
+}
+
+/// \brief Return the entry for a transformation matrix, constructing and
+///     storing it if necessary
+///
+/// \param transformation_matrix_to_super Any transformation matrix, T. The
+///     entry is found by the key of the Hermite normal form of T.
+///
+/// Thread safe.
+SupercellNameCache::Entry const &SupercellNameCache::get(
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  return _get(make_hermite_normal_form_key(transformation_matrix_to_super));
+}
+
+/// \brief Return the entry for a Hermite normal form key, constructing and
+///     storing it if necessary
+///
+/// \param key The key of a Hermite normal form, as from
+///     `make_hermite_normal_form_key`. If it is not in Hermite normal form,
+///     the entry is found by the key of its Hermite normal form.
+///
+/// Thread safe.
+SupercellNameCache::Entry const &SupercellNameCache::get(
+    HermiteNormalFormKey const &key) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      return it->second;
+    }
+  }
+  return _get(make_hermite_normal_form_key(make_hermite_normal_form(key)));
+}
+
+/// \brief Return the entry for a supercell name, constructing and storing
+///     it if necessary
+///
+/// \param supercell_name A supercell name, as from `make_supercell_name`.
+///     Names are stored as given, so the name of the entry may differ if
+///     `supercell_name` is not formatted exactly as by
+///     `make_supercell_name`.
+///
+/// Thread safe. Throws if `supercell_name` can not be parsed.
+SupercellNameCache::Entry const &SupercellNameCache::get(
+    std::string const &supercell_name) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_by_name.find(supercell_name);
+    if (it != m_by_name.end()) {
+      return *it->second;
+    }
+  }
+  Entry const &entry = get(make_hermite_normal_form_key(supercell_name));
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_by_name.emplace(supercell_name, &entry);
+  return entry;
+}
+
+/// \brief Return true if a supercell with this transformation matrix is
+///     in canonical form
+///
+/// Equivalent to `Supercell(prim, T).is_canonical()`, without constructing
+/// the supercell. Thread safe.
+bool SupercellNameCache::is_canonical(
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  return get(transformation_matrix_to_super)
+             .canonical_transformation_matrix_to_super ==
+         transformation_matrix_to_super;
+}
+
+/// \brief Number of entries
+Index SupercellNameCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Erase all entries
+///
+/// Invalidates references to entries.
+void SupercellNameCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_by_name.clear();
+  m_entries.clear();
+}
+
+/// \brief Find or construct the entry for a key in Hermite normal form
+///
+/// The canonicalization is done without holding the lock. If another thread
+/// stores the same entry first, its entry is returned.
+SupercellNameCache::Entry const &SupercellNameCache::_get(
+    HermiteNormalFormKey const &key) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      return it->second;
+    }
+  }
+  Entry entry = _make_entry(*m_prim, key);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.emplace(key, std::move(entry)).first->second;
+}
+
+}  // namespace config
+}  // namespace CASM
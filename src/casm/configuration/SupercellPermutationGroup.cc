@@ -0,0 +1,241 @@
+#include "casm/configuration/SupercellPermutationGroup.hh"
+
+#include <random>
+
+#include "casm/configuration/PrimSymInfo.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymInfo.hh"
+#include "casm/configuration/canonical_form.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param _supercell The supercell. The stabilizer chain of its site
+///     permutation group is built on construction.
+SupercellPermutationGroup::SupercellPermutationGroup(
+    std::shared_ptr<Supercell const> const &_supercell)
+    : m_supercell(throw_if_equal_to_nullptr(
+          _supercell,
+          "Error in SupercellPermutationGroup: supercell is empty")),
+      m_n_sites(m_supercell->unitcellcoord_index_converter.total_sites()),
+      m_translation_of_site(m_n_sites, -1),
+      m_chain(m_n_sites) {
+  Index n_fg = m_supercell->sym_info.factor_group_permutations.size();
+  Index n_vol = m_supercell->unitcell_index_converter.total_sites();
+  if (m_n_sites == 0) {
+    return;
+  }
+  for (Index t = 0; t < n_vol; ++t) {
+    m_translation_of_site[translation_permute_index(
+        t, 0, m_supercell->unitcell_index_converter,
+        m_supercell->unitcellcoord_index_converter,
+        m_supercell->diagonal_index_converter.get())] = t;
+  }
+
+  // operations that do not permute sites
+  Permutation identity(m_n_sites);
+  for (Index l = 0; l < m_n_sites; ++l) {
+    identity[l] = l;
+  }
+  Index n_kernel = 0;
+  for (Index f = 0; f < n_fg; ++f) {
+    if (_find_translation_index(f, identity) != -1) {
+      ++n_kernel;
+    }
+  }
+  Index target_order = n_fg * n_vol / n_kernel;
+
+  for (Index f = 0; f < n_fg; ++f) {
+    m_chain.insert(make_permutation(f, 0));
+  }
+  for (Index i = 0; i < 3; ++i) {
+    xtal::UnitCell unit_translation(0, 0, 0);
+    unit_translation(i) = 1;
+    m_chain.insert(make_permutation(
+        0, m_supercell->unitcell_index_converter(unit_translation)));
+  }
+
+  // fixed seed, so the chain does not vary between runs
+  std::mt19937_64 engine(0);
+  std::uniform_int_distribution<Index> fg_dist(0, n_fg - 1);
+  std::uniform_int_distribution<Index> trans_dist(0, n_vol - 1);
+  Index const max_n_random = 10000;
+  for (Index n = 0; m_chain.order() < target_order && n < max_n_random; ++n) {
+    Index f = fg_dist(engine);
+    Index t = trans_dist(engine);
+    m_chain.insert(make_permutation(f, t));
+  }
+  if (m_chain.order() != target_order) {
+    throw std::runtime_error(
+        "Error in SupercellPermutationGroup: failed to complete the "
+        "stabilizer chain");
+  }
+}
+
+/// \brief Return the combined site permutation of the operation
+///     `(factor group index, translation index)`
+///
+/// Equal to `SupercellSymOp(supercell(), f, t).combined_permute()`, which
+/// satisfies `after[l] = before[permutation[l]]`.
+SupercellPermutationGroup::Permutation
+SupercellPermutationGroup::make_permutation(
+    Index supercell_factor_group_index, Index translation_index) const {
+  SupercellSymInfo const &sym_info = m_supercell->sym_info;
+  auto const &fg_perm =
+      sym_info.factor_group_permutations[supercell_factor_group_index];
+  Permutation result(m_n_sites);
+  for (Index l = 0; l < m_n_sites; ++l) {
+    result[l] = fg_perm[translation_permute_index(
+        translation_index, l, m_supercell->unitcell_index_converter,
+        m_supercell->unitcellcoord_index_converter,
+        m_supercell->diagonal_index_converter.get())];
+  }
+  return result;
+}
+
+/// \brief Return an operation with combined site permutation `permutation`
+///
+/// Operations are checked in factor group order, and the first match is
+/// returned. Throws if no operation has the given permutation.
+SupercellSymOp SupercellPermutationGroup::find_op(
+    Permutation const &permutation) const {
+  Index n_fg = m_supercell->sym_info.factor_group_permutations.size();
+  for (Index f = 0; f < n_fg; ++f) {
+    Index t = _find_translation_index(f, permutation);
+    if (t != -1) {
+      return SupercellSymOp(m_supercell, f, t);
+    }
+  }
+  throw std::runtime_error(
+      "Error in SupercellPermutationGroup::find_op: no operation has the "
+      "given permutation");
+}
+
+/// \brief Return the lexicographically greatest equivalent occupation
+///
+/// \param occupation An occupation vector in the supercell
+/// \param to_canonical_permutation If not nullptr, set to a permutation in
+///     the group such that
+///     `result[l] == occupation[(*to_canonical_permutation)[l]]`
+///
+/// \returns The lexicographically greatest of `op * occupation`, over all
+///     supercell operations, ignoring occupant index transformations
+Eigen::VectorXi SupercellPermutationGroup::make_canonical_occupation(
+    Eigen::VectorXi const &occupation,
+    Permutation *to_canonical_permutation) const {
+  if (occupation.size() != m_n_sites) {
+    throw std::runtime_error(
+        "Error in SupercellPermutationGroup::make_canonical_occupation: "
+        "occupation size does not match the supercell");
+  }
+
+  std::vector<int> values(occupation.data(),
+                          occupation.data() + occupation.size());
+  std::vector<int> image = group::make_lexicographic_max_image(
+      m_chain, values, to_canonical_permutation);
+  Eigen::VectorXi canonical_occupation(m_n_sites);
+  for (Index l = 0; l < m_n_sites; ++l) {
+    canonical_occupation[l] = image[l];
+  }
+  return canonical_occupation;
+}
+
+/// \brief Return true if configuration is in canonical form
+bool SupercellPermutationGroup::is_canonical(
+    Configuration const &configuration) const {
+  _throw_if_other_supercell(configuration);
+  if (!_use_permutations(configuration)) {
+    return config::is_canonical(configuration,
+                                SupercellSymOp::begin(m_supercell),
+                                SupercellSymOp::end(m_supercell));
+  }
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  return make_canonical_occupation(occupation) == occupation;
+}
+
+/// \brief Return an operation that makes the configuration canonical
+///
+/// For occupation-only configurations, this is the first operation, in
+/// factor group order, with the site permutation found by
+/// `make_canonical_occupation`. Otherwise, it is the same as
+/// `to_canonical` over all supercell operations.
+SupercellSymOp SupercellPermutationGroup::to_canonical(
+    Configuration const &configuration) const {
+  _throw_if_other_supercell(configuration);
+  if (!_use_permutations(configuration)) {
+    return config::to_canonical(configuration,
+                                SupercellSymOp::begin(m_supercell),
+                                SupercellSymOp::end(m_supercell));
+  }
+  Permutation permutation;
+  make_canonical_occupation(configuration.dof_values.occupation,
+                            &permutation);
+  return find_op(permutation);
+}
+
+/// \brief Return the configuration that compares greater to all
+///     equivalents
+///
+/// The same as `make_canonical_form` over all supercell operations.
+Configuration SupercellPermutationGroup::make_canonical_form(
+    Configuration const &configuration) const {
+  _throw_if_other_supercell(configuration);
+  if (!_use_permutations(configuration)) {
+    return config::make_canonical_form(configuration,
+                                       SupercellSymOp::begin(m_supercell),
+                                       SupercellSymOp::end(m_supercell));
+  }
+  Configuration result(configuration);
+  result.dof_values.occupation =
+      make_canonical_occupation(configuration.dof_values.occupation);
+  return result;
+}
+
+void SupercellPermutationGroup::_throw_if_other_supercell(
+    Configuration const &configuration) const {
+  if (configuration.supercell != m_supercell &&
+      *configuration.supercell != *m_supercell) {
+    throw std::runtime_error(
+        "Error in SupercellPermutationGroup: configuration supercell does not "
+        "match");
+  }
+}
+
+/// \brief Return true if site permutations alone find the canonical form
+bool SupercellPermutationGroup::_use_permutations(
+    Configuration const &configuration) const {
+  return !m_supercell->prim->sym_info.has_aniso_occs &&
+         configuration.dof_values.global_dof_values.empty() &&
+         configuration.dof_values.local_dof_values.empty();
+}
+
+/// \brief Return the translation index `t` such that
+///     `make_permutation(f, t) == permutation`, or -1
+///
+/// Translations act freely on sites, so site 0 determines `t`.
+Index SupercellPermutationGroup::_find_translation_index(
+    Index f, Permutation const &permutation) const {
+  auto const &fg_perm = m_supercell->sym_info.factor_group_permutations[f];
+  Index s = 0;
+  while (s < m_n_sites && fg_perm[s] != permutation[0]) {
+    ++s;
+  }
+  if (s == m_n_sites || m_translation_of_site[s] == -1) {
+    return -1;
+  }
+  Index t = m_translation_of_site[s];
+  for (Index l = 0; l < m_n_sites; ++l) {
+    if (fg_perm[translation_permute_index(
+            t, l, m_supercell->unitcell_index_converter,
+            m_supercell->unitcellcoord_index_converter,
+            m_supercell->diagonal_index_converter.get())] != permutation[l]) {
+      return -1;
+    }
+  }
+  return t;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -1,16 +1,30 @@
 #include "casm/configuration/SupercellSet.hh"
 
+#include <algorithm>
 #include <map>
 #include <set>
 
 #include "casm/configuration/Supercell.hh"
 #include "casm/configuration/canonical_form.hh"
 #include "casm/configuration/definitions.hh"
+#include "casm/configuration/parallel.hh"
 #include "casm/configuration/supercell_name.hh"
 
 namespace CASM {
 namespace config {
 
+namespace {
+
+/// \brief Lexicographic less-than, for use as a map key
+struct _MatrixLess {
+  bool operator()(Eigen::Matrix3l const &A, Eigen::Matrix3l const &B) const {
+    return std::lexicographical_compare(A.data(), A.data() + 9, B.data(),
+                                        B.data() + 9);
+  }
+};
+
+}  // namespace
+
 SupercellRecord::SupercellRecord(
     std::shared_ptr<Supercell const> const &_supercell)
     : supercell(throw_if_equal_to_nullptr(
@@ -19,15 +33,31 @@ SupercellRecord::SupercellRecord(
       supercell_name(
           make_supercell_name(supercell->superlattice.prim_lattice(),
                               supercell->superlattice.superlattice())),
-      is_canonical(config::is_canonical(*supercell)) {
-  if (this->is_canonical) {
-    this->canonical_supercell_name = this->supercell_name;
-  } else {
-    auto canonical_supercell = make_canonical_form(*this->supercell);
-    this->canonical_supercell_name =
-        make_supercell_name(canonical_supercell->superlattice.prim_lattice(),
-                            canonical_supercell->superlattice.superlattice());
+      canonical_supercell_name(supercell->canonical_supercell_name()),
+      is_canonical(supercell->is_canonical()) {}
+
+/// \brief Constructor, using stored supercell names
+///
+/// \param _supercell The supercell
+/// \param name_cache Stores supercell names and canonical equivalent
+///     supercells for the prim, so that records for supercells with the
+///     same transformation matrix do not repeat the lattice
+///     canonicalization. Must be for the same prim as `_supercell`.
+SupercellRecord::SupercellRecord(
+    std::shared_ptr<Supercell const> const &_supercell,
+    SupercellNameCache &name_cache)
+    : supercell(throw_if_equal_to_nullptr(
+          _supercell,
+          "Error in SupercellRecord constructor: value == nullptr")) {
+  if (supercell->prim != name_cache.prim()) {
+    throw std::runtime_error(
+        "Error in SupercellRecord constructor: name_cache prim mismatch");
   }
+  auto const &T = supercell->superlattice.transformation_matrix_to_super();
+  SupercellNameCache::Entry const &entry = name_cache.get(T);
+  supercell_name = entry.supercell_name;
+  canonical_supercell_name = entry.canonical_supercell_name;
+  is_canonical = (T == entry.canonical_transformation_matrix_to_super);
 }
 
 bool SupercellRecord::operator<(SupercellRecord const &rhs) const {
@@ -39,6 +69,7 @@ SupercellSet::SupercellSet(std::shared_ptr<Prim const> const &_prim)
   if (m_prim == nullptr) {
     throw std::runtime_error("Error constructing SupercellSet: prim is empty");
   }
+  m_name_cache = std::make_shared<SupercellNameCache>(m_prim);
 }
 
 std::shared_ptr<Prim const> SupercellSet::prim() const { return m_prim; }
@@ -57,6 +88,9 @@ SupercellSet::const_iterator SupercellSet::end() const { return m_data.end(); }
 
 std::pair<SupercellSet::iterator, bool> SupercellSet::insert(
     std::shared_ptr<Supercell const> supercell) {
+  if (supercell != nullptr && supercell->prim == m_prim) {
+    return m_data.emplace(supercell, *m_name_cache);
+  }
   return m_data.emplace(supercell);
 }
 
@@ -69,9 +103,9 @@ std::pair<SupercellSet::iterator, bool> SupercellSet::insert(
     Eigen::Matrix3l const &transformation_matrix_to_super) {
   auto it = find(transformation_matrix_to_super);
   if (it == end()) {
-    auto supercell = std::make_shared<Supercell const>(
-        m_prim, transformation_matrix_to_super);
-    return m_data.emplace(supercell);
+    auto supercell =
+        make_shared_supercell(m_prim, transformation_matrix_to_super);
+    return m_data.emplace(supercell, *m_name_cache);
   } else {
     return std::make_pair(it, false);
   }
@@ -93,17 +127,15 @@ std::pair<SupercellSet::iterator, bool> SupercellSet::insert_canonical(
     std::string supercell_name) {
   auto it = find_canonical_by_name(supercell_name);
   if (it == end()) {
-    auto supercell = std::make_shared<Supercell const>(
-        m_prim, make_superlattice_from_supercell_name(
-                    m_prim->basicstructure->lattice(), supercell_name));
-    auto canonical_supercell = make_canonical_form(*supercell);
-    auto result = m_data.emplace(canonical_supercell);
-    if (result.first->canonical_supercell_name != supercell_name) {
+    SupercellNameCache::Entry const &entry = m_name_cache->get(supercell_name);
+    if (entry.canonical_supercell_name != supercell_name) {
       throw std::runtime_error(
           "Error in SupercellSet::insert_canonical: supercell_name is not the "
           "canonical supercell name");
     }
-    return result;
+    auto canonical_supercell = make_shared_supercell(
+        m_prim, entry.canonical_transformation_matrix_to_super);
+    return m_data.emplace(canonical_supercell, *m_name_cache);
   } else {
     return std::make_pair(it, false);
   }
@@ -212,6 +244,207 @@ std::set<SupercellRecord> &SupercellSet::data() { return m_data; }
 
 std::set<SupercellRecord> const &SupercellSet::data() const { return m_data; }
 
+/// \brief Supercell names and canonical supercells, shared by copies
+///
+/// Used to construct records without repeating the lattice
+/// canonicalization for supercells with the same transformation matrix.
+std::shared_ptr<SupercellNameCache> const &SupercellSet::name_cache() const {
+  return m_name_cache;
+}
+
+/// \brief Constructor
+///
+/// \param _supercells The SupercellSet to insert into. It must outlive
+///     this object, and must not be used directly while `insert` methods
+///     may be called.
+ConcurrentSupercellSet::ConcurrentSupercellSet(SupercellSet &_supercells)
+    : m_supercells(_supercells) {}
+
+/// \brief Insert a supercell, returning the record in the set
+///
+/// Thread safe.
+SupercellRecord const &ConcurrentSupercellSet::insert(
+    std::shared_ptr<Supercell const> supercell) {
+  SupercellRecord record =
+      (supercell != nullptr && supercell->prim == m_supercells.prim())
+          ? SupercellRecord(supercell, *m_supercells.name_cache())
+          : SupercellRecord(supercell);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return *m_supercells.insert(record).first;
+}
+
+/// \brief Insert a supercell, returning the record in the set
+///
+/// Thread safe. The supercell is obtained with `make_shared_supercell`.
+SupercellRecord const &ConcurrentSupercellSet::insert(
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  return insert(make_shared_supercell(m_supercells.prim(),
+                                      transformation_matrix_to_super));
+}
+
+/// \brief Insert a canonical supercell by name, returning the record in
+///     the set
+///
+/// Thread safe. Throws if `supercell_name` is not the name of the canonical
+/// equivalent supercell, as for `SupercellSet::insert_canonical`.
+SupercellRecord const &ConcurrentSupercellSet::insert_canonical(
+    std::string supercell_name) {
+  SupercellNameCache &name_cache = *m_supercells.name_cache();
+  SupercellNameCache::Entry const &entry = name_cache.get(supercell_name);
+  if (entry.canonical_supercell_name != supercell_name) {
+    throw std::runtime_error(
+        "Error in ConcurrentSupercellSet::insert_canonical: supercell_name is "
+        "not the canonical supercell name");
+  }
+  SupercellRecord record(
+      make_shared_supercell(m_supercells.prim(),
+                            entry.canonical_transformation_matrix_to_super),
+      name_cache);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return *m_supercells.insert(record).first;
+}
+
+/// \brief Number of supercells in the set
+///
+/// Thread safe.
+SupercellSet::size_type ConcurrentSupercellSet::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_supercells.size();
+}
+
+/// \brief Estimate the memory used by a SupercellSet and its supercells
+///
+/// \param supercells The SupercellSet
+/// \param context Records shared objects already counted. Supercells, and
+///     their shared members, already recorded are counted as 0 bytes.
+///
+/// Use the same `context` with `memory_usage(ConfigurationSet const &,
+/// MemoryUsageContext &)` to count supercells shared by a SupercellSet and
+/// a ConfigurationSet once.
+SupercellSetMemoryUsage make_memory_usage(SupercellSet const &supercells,
+                                          MemoryUsageContext &context) {
+  using namespace memory_usage_impl;
+  SupercellSetMemoryUsage usage;
+  usage.records_bytes = sizeof(SupercellSet);
+  for (auto const &record : supercells) {
+    usage.records_bytes += set_node_bytes + sizeof(SupercellRecord) +
+                           heap_bytes(record.supercell_name) +
+                           heap_bytes(record.canonical_supercell_name);
+    usage.supercells.emplace_back(
+        record.supercell_name, make_memory_usage(*record.supercell, context));
+  }
+  return usage;
+}
+
+/// \brief Estimate the memory used by a SupercellSet and its supercells, in
+///     bytes
+///
+/// Equivalent to `make_memory_usage(supercells, context).total_bytes()`,
+/// with a new MemoryUsageContext.
+Index memory_usage(SupercellSet const &supercells) {
+  MemoryUsageContext context;
+  return make_memory_usage(supercells, context).total_bytes();
+}
+
+/// \brief Insert many supercells, constructing the missing ones in parallel
+///
+/// \param supercells The SupercellSet to insert into
+/// \param transformation_matrices_to_super Transformation matrices of the
+///     supercells to insert. May contain duplicates.
+/// \param n_threads Number of threads used to construct supercells that are
+///     not already in `supercells`. If <= 0, use the hardware concurrency.
+///
+/// \returns The record in `supercells` for each element of
+///     `transformation_matrices_to_super`
+///
+/// Notes:
+/// - Equivalent to calling `supercells.insert(T)` for each T, but each
+///   distinct missing supercell is constructed once, and the constructions
+///   run in parallel. Supercell construction, which builds the supercell
+///   symmetry info, dominates the cost of reading many configurations.
+std::vector<SupercellRecord const *> insert_supercells(
+    SupercellSet &supercells,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices_to_super,
+    Index n_threads) {
+  std::map<Eigen::Matrix3l, SupercellRecord const *, _MatrixLess> index;
+  for (auto const &record : supercells) {
+    index.emplace(
+        record.supercell->superlattice.transformation_matrix_to_super(),
+        &record);
+  }
+
+  std::vector<Eigen::Matrix3l> missing;
+  for (auto const &T : transformation_matrices_to_super) {
+    if (index.emplace(T, nullptr).second) {
+      missing.push_back(T);
+    }
+  }
+
+  ConcurrentSupercellSet concurrent_supercells(supercells);
+  std::vector<SupercellRecord const *> missing_records(missing.size());
+  parallel_for_items(missing.size(), n_threads, [&](Index i) {
+    missing_records[i] = &concurrent_supercells.insert(missing[i]);
+  });
+  for (Index i = 0; i < Index(missing.size()); ++i) {
+    index[missing[i]] = missing_records[i];
+  }
+
+  std::vector<SupercellRecord const *> result;
+  result.reserve(transformation_matrices_to_super.size());
+  for (auto const &T : transformation_matrices_to_super) {
+    result.push_back(index.at(T));
+  }
+  return result;
+}
+
+/// \brief Insert many canonical supercells by name, constructing the missing
+///     ones in parallel
+///
+/// \param supercells The SupercellSet to insert into
+/// \param supercell_names Names of canonical supercells to insert. May
+///     contain duplicates.
+/// \param n_threads Number of threads used to construct supercells that are
+///     not already in `supercells`. If <= 0, use the hardware concurrency.
+///
+/// \returns The record in `supercells` for each element of
+///     `supercell_names`
+///
+/// Notes:
+/// - Equivalent to calling `supercells.insert_canonical(name)` for each
+///   name, but each distinct missing supercell is constructed once, and the
+///   constructions run in parallel.
+/// - Throws if any name is not the name of the canonical equivalent
+///   supercell.
+std::vector<SupercellRecord const *> insert_canonical_supercells(
+    SupercellSet &supercells, std::vector<std::string> const &supercell_names,
+    Index n_threads) {
+  std::map<std::string, SupercellRecord const *> index =
+      make_index_by_canonical_supercell_name(supercells.data());
+
+  std::vector<std::string> missing;
+  for (auto const &name : supercell_names) {
+    if (index.emplace(name, nullptr).second) {
+      missing.push_back(name);
+    }
+  }
+
+  ConcurrentSupercellSet concurrent_supercells(supercells);
+  std::vector<SupercellRecord const *> missing_records(missing.size());
+  parallel_for_items(missing.size(), n_threads, [&](Index i) {
+    missing_records[i] = &concurrent_supercells.insert_canonical(missing[i]);
+  });
+  for (Index i = 0; i < Index(missing.size()); ++i) {
+    index[missing[i]] = missing_records[i];
+  }
+
+  std::vector<SupercellRecord const *> result;
+  result.reserve(supercell_names.size());
+  for (auto const &name : supercell_names) {
+    result.push_back(index.at(name));
+  }
+  return result;
+}
+
 std::map<std::string, SupercellRecord const *>
 make_index_by_canonical_supercell_name(
     std::set<SupercellRecord> const &supercells) {
@@ -232,7 +465,7 @@ SupercellRecord const *find_or_add_canonical_supercell_by_name(
   SupercellRecord const *s = nullptr;
   auto it = index_by_supercell_name.find(supercell_name);
   if (it == index_by_supercell_name.end()) {
-    auto supercell = std::make_shared<Supercell const>(
+    auto supercell = make_shared_supercell(
         prim, make_superlattice_from_supercell_name(
                   prim->basicstructure->lattice(), supercell_name));
     auto canonical_supercell = make_canonical_form(*supercell);
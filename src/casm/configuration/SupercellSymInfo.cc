@@ -1,13 +1,248 @@
 #include "casm/configuration/SupercellSymInfo.hh"
 
+#include "casm/configuration/DiagonalIndexConverter.hh"
 #include "casm/configuration/Prim.hh"
+#include "casm/configuration/perf.hh"
+#include "casm/configuration/trace.hh"
 #include "casm/crystallography/LinearIndexConverter.hh"
 #include "casm/crystallography/Superlattice.hh"
+#include "casm/crystallography/SymType.hh"
 #include "casm/crystallography/UnitCellCoordRep.hh"
 
 namespace CASM {
 namespace config {
 
+/// \brief Constructor
+///
+/// \param _max_bytes Memory budget, in bytes. If 0, nothing is stored.
+/// \param _source If not null, used to construct permutations instead of
+///     `make_translation_permutation`. Must be safe to call concurrently.
+TranslationPermutationCache::TranslationPermutationCache(Index _max_bytes,
+                                                         source_type _source)
+    : m_max_bytes(_max_bytes),
+      m_source(std::move(_source)),
+      m_size_bytes(0),
+      m_n_hits(0),
+      m_n_misses(0) {
+  if (m_max_bytes < 0) {
+    throw std::runtime_error(
+        "Error in TranslationPermutationCache: max_bytes < 0");
+  }
+}
+
+/// \brief Get a translation permutation, constructing it if not cached
+///
+/// The permutation is constructed without holding the lock, so concurrent
+/// misses for different translations do not wait on each other.
+///
+/// \param translation_index Index in range [0, n_unitcells)
+/// \param ijk_index_converter UnitCell and linear unit cell index conversions
+///     in this supercell.
+/// \param bijk_index_converter UnitCellCoord and linear site index conversions
+///     in this supercell.
+/// \param diagonal_index_converter If not null, used to construct the
+///     permutation instead of the general converters.
+std::shared_ptr<sym_info::Permutation const> TranslationPermutationCache::get(
+    Index translation_index,
+    xtal::UnitCellIndexConverter const &ijk_index_converter,
+    xtal::UnitCellCoordIndexConverter const &bijk_index_converter,
+    DiagonalIndexConverter const *diagonal_index_converter) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(translation_index);
+    if (it != m_entries.end()) {
+      ++m_n_hits;
+      m_lru.splice(m_lru.begin(), m_lru, it->second.lru_position);
+      return it->second.permutation;
+    }
+    ++m_n_misses;
+  }
+  CASM_CONFIGURATION_PERF_COUNT(translation_permutation_rebuild);
+
+  auto permutation = std::make_shared<sym_info::Permutation const>(
+      m_source ? m_source(translation_index)
+               : make_translation_permutation(
+                     translation_index, ijk_index_converter,
+                     bijk_index_converter, diagonal_index_converter));
+  Index n_bytes = permutation->size() * sizeof(Index);
+  if (n_bytes > m_max_bytes) {
+    return permutation;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(translation_index);
+  if (it != m_entries.end()) {
+    // constructed concurrently by another thread
+    return it->second.permutation;
+  }
+  while (m_size_bytes + n_bytes > m_max_bytes) {
+    auto last = m_entries.find(m_lru.back());
+    m_size_bytes -= last->second.permutation->size() * sizeof(Index);
+    m_entries.erase(last);
+    m_lru.pop_back();
+  }
+  m_lru.push_front(translation_index);
+  m_entries.emplace(translation_index, Entry{permutation, m_lru.begin()});
+  m_size_bytes += n_bytes;
+  return permutation;
+}
+
+/// \brief Memory budget, in bytes
+Index TranslationPermutationCache::max_bytes() const { return m_max_bytes; }
+
+/// \brief Total size of cached permutations, in bytes
+Index TranslationPermutationCache::size_bytes() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_size_bytes;
+}
+
+/// \brief Number of cached permutations
+Index TranslationPermutationCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Number of calls to `get` that found a cached permutation
+Index TranslationPermutationCache::n_hits() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_n_hits;
+}
+
+/// \brief Number of calls to `get` that constructed a permutation
+Index TranslationPermutationCache::n_misses() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_n_misses;
+}
+
+/// \brief Remove all cached permutations
+void TranslationPermutationCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+  m_lru.clear();
+  m_size_bytes = 0;
+}
+
+namespace {
+
+void _swap_rows(Eigen::Matrix3l &A, Index i, Index j) {
+  if (i != j) {
+    A.row(i).swap(A.row(j));
+  }
+}
+
+void _swap_cols(Eigen::Matrix3l &A, Index i, Index j) {
+  if (i != j) {
+    A.col(i).swap(A.col(j));
+  }
+}
+
+}  // namespace
+
+/// \brief Smith normal form of an integer matrix, `U * M * V == S`
+///
+/// \param M A non-singular integer matrix
+/// \param U Set to a unimodular matrix
+/// \param S Set to a diagonal matrix, with positive diagonal elements
+///     `S(0,0) | S(1,1) | S(2,2)`
+/// \param V Set to a unimodular matrix
+void smith_normal_form(Eigen::Matrix3l const &M, Eigen::Matrix3l &U,
+                       Eigen::Matrix3l &S, Eigen::Matrix3l &V) {
+  if (M.determinant() == 0) {
+    throw std::runtime_error("Error in smith_normal_form: singular matrix");
+  }
+  S = M;
+  U = Eigen::Matrix3l::Identity();
+  V = Eigen::Matrix3l::Identity();
+  for (Index k = 0; k < 3; ++k) {
+    while (true) {
+      // move the smallest non-zero element of S[k:, k:] to S(k, k)
+      Index pi = -1;
+      Index pj = -1;
+      for (Index i = k; i < 3; ++i) {
+        for (Index j = k; j < 3; ++j) {
+          if (S(i, j) != 0 &&
+              (pi == -1 || std::abs(S(i, j)) < std::abs(S(pi, pj)))) {
+            pi = i;
+            pj = j;
+          }
+        }
+      }
+      _swap_rows(S, k, pi);
+      _swap_rows(U, k, pi);
+      _swap_cols(S, k, pj);
+      _swap_cols(V, k, pj);
+
+      // reduce row and column k by the pivot
+      bool done = true;
+      for (Index i = k + 1; i < 3; ++i) {
+        long q = S(i, k) / S(k, k);
+        S.row(i) -= q * S.row(k);
+        U.row(i) -= q * U.row(k);
+        done = done && S(i, k) == 0;
+      }
+      for (Index j = k + 1; j < 3; ++j) {
+        long q = S(k, j) / S(k, k);
+        S.col(j) -= q * S.col(k);
+        V.col(j) -= q * V.col(k);
+        done = done && S(k, j) == 0;
+      }
+      if (!done) {
+        continue;
+      }
+
+      // the pivot must divide the remaining elements
+      for (Index i = k + 1; i < 3 && done; ++i) {
+        for (Index j = k + 1; j < 3 && done; ++j) {
+          if (S(i, j) % S(k, k) != 0) {
+            S.row(k) += S.row(i);
+            U.row(k) += U.row(i);
+            done = false;
+          }
+        }
+      }
+      if (done) {
+        break;
+      }
+    }
+    if (S(k, k) < 0) {
+      S.row(k) *= -1;
+      U.row(k) *= -1;
+    }
+  }
+}
+
+/// \brief Constructor
+///
+/// \param transformation_matrix The transformation matrix, `T`, from prim
+///     to supercell lattice vectors, `L_super = L_prim * T`
+TranslationGrid::TranslationGrid(Eigen::Matrix3l const &transformation_matrix) {
+  Eigen::Matrix3l S;
+  Eigen::Matrix3l V;
+  smith_normal_form(transformation_matrix, to_grid, S, V);
+  shape = S.diagonal();
+}
+
+/// \brief Grid coordinate of a unit cell, each in [0, shape(i))
+///
+/// Unit cells that are equivalent by a supercell lattice translation have
+/// the same grid coordinate.
+Eigen::Vector3l TranslationGrid::coordinate(UnitCell const &unitcell) const {
+  Eigen::Vector3l g = to_grid * unitcell;
+  for (Index i = 0; i < 3; ++i) {
+    g(i) %= shape(i);
+    if (g(i) < 0) {
+      g(i) += shape(i);
+    }
+  }
+  return g;
+}
+
+/// \brief Row-major linear index of a unit cell's grid coordinate
+Index TranslationGrid::linear_index(UnitCell const &unitcell) const {
+  Eigen::Vector3l g = coordinate(unitcell);
+  return (g(0) * shape(1) + g(1)) * shape(2) + g(2);
+}
+
 /// \brief Constructor
 ///
 /// \brief prim Prim associated with this supercell
@@ -19,26 +254,168 @@ namespace config {
 /// \brief max_n_translation_permutations If superlattice.size() is greater than
 ///     max_n_translation_permutations, do not populate
 ///     SupercellSymInfo::translation_permutations (default=100).
+/// \brief translation_permutation_cache_max_bytes Memory budget, in bytes,
+///     of SupercellSymInfo::translation_permutation_cache, which is used if
+///     SupercellSymInfo::translation_permutations is not populated.
+/// \brief diagonal_index_converter If not null, used to construct
+///     translation permutations instead of the general converters.
 SupercellSymInfo::SupercellSymInfo(
     std::shared_ptr<Prim const> const &prim, Superlattice const &superlattice,
     xtal::UnitCellIndexConverter const &unitcell_index_converter,
     xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter,
-    Index max_n_translation_permutations)
+    Index max_n_translation_permutations,
+    Index translation_permutation_cache_max_bytes,
+    DiagonalIndexConverter const *diagonal_index_converter)
     : factor_group(std::make_shared<SymGroup const>(
           make_factor_group(prim, superlattice))),
       factor_group_permutations(make_factor_group_permutations(
           factor_group->head_group_index,
           prim->sym_info.unitcellcoord_symgroup_rep,
-          unitcellcoord_index_converter)) {
+          unitcellcoord_index_converter)),
+      factor_group_point_matrices(make_factor_group_point_matrices(
+          factor_group->head_group_index,
+          prim->sym_info.unitcellcoord_symgroup_rep)),
+      factor_group_translation_cocycle(make_factor_group_translation_cocycle(
+          *factor_group, superlattice.prim_lattice())),
+      translation_grid(superlattice.transformation_matrix_to_super()),
+      translation_cart(make_translation_cart(superlattice.prim_lattice(),
+                                             unitcell_index_converter)) {
   if (superlattice.size() <= max_n_translation_permutations) {
     translation_permutations = make_translation_permutations(
-        unitcell_index_converter, unitcellcoord_index_converter);
+        unitcell_index_converter, unitcellcoord_index_converter,
+        diagonal_index_converter);
+  } else {
+    translation_permutation_cache =
+        std::make_shared<TranslationPermutationCache>(
+            translation_permutation_cache_max_bytes);
+  }
+}
+
+/// \brief Constructor, using precomputed permutations
+///
+/// \param prim The prim
+/// \param superlattice The supercell lattice
+/// \param head_group_index Indices of the prim factor group operations in
+///     the supercell factor group, as `factor_group->head_group_index`
+/// \param _factor_group_permutations The supercell factor group
+///     permutations, as from `make_factor_group_permutations`
+/// \param _translation_permutations The supercell translation
+///     permutations, as from `make_translation_permutations`, or empty to
+///     use a TranslationPermutationCache
+/// \param translation_permutation_cache_max_bytes Memory budget of the
+///     TranslationPermutationCache, if `_translation_permutations` is empty
+/// \param translation_permutation_source If not null, and
+///     `_translation_permutations` is empty, used by the
+///     TranslationPermutationCache to construct translation permutations
+///
+/// Used to construct supercells from stored tables (see
+/// `SupercellSymInfoTables`) without constructing the permutations. The
+/// point matrices and translation cocycle, which only depend on the factor
+/// group, and the Cartesian translations are constructed. The sizes of the
+/// permutations are checked, but not their values.
+SupercellSymInfo::SupercellSymInfo(
+    std::shared_ptr<Prim const> const &prim, Superlattice const &superlattice,
+    std::set<Index> const &head_group_index,
+    std::vector<sym_info::Permutation> &&_factor_group_permutations,
+    std::optional<std::vector<sym_info::Permutation>>
+        &&_translation_permutations,
+    Index translation_permutation_cache_max_bytes,
+    TranslationPermutationCache::source_type translation_permutation_source)
+    : factor_group(std::make_shared<SymGroup const>(
+          prim->sym_info.factor_group, head_group_index)),
+      translation_permutations(std::move(_translation_permutations)),
+      factor_group_permutations(std::move(_factor_group_permutations)),
+      factor_group_point_matrices(make_factor_group_point_matrices(
+          factor_group->head_group_index,
+          prim->sym_info.unitcellcoord_symgroup_rep)),
+      factor_group_translation_cocycle(make_factor_group_translation_cocycle(
+          *factor_group, superlattice.prim_lattice())),
+      translation_grid(superlattice.transformation_matrix_to_super()),
+      translation_cart(make_translation_cart(
+          superlattice.prim_lattice(),
+          xtal::UnitCellIndexConverter(
+              superlattice.transformation_matrix_to_super()))) {
+  Index n_sites = superlattice.size() * prim->basicstructure->basis().size();
+  auto check = [&](std::vector<sym_info::Permutation> const &perms,
+                   Index expected_size, std::string const &what) {
+    if (Index(perms.size()) != expected_size) {
+      throw std::runtime_error("Error in SupercellSymInfo: wrong number of " +
+                               what);
+    }
+    for (auto const &perm : perms) {
+      if (Index(perm.size()) != n_sites) {
+        throw std::runtime_error("Error in SupercellSymInfo: wrong size of " +
+                                 what);
+      }
+    }
+  };
+  check(factor_group_permutations, factor_group->element.size(),
+        "factor group permutations");
+  if (translation_permutations.has_value()) {
+    check(*translation_permutations, superlattice.size(),
+          "translation permutations");
+  } else {
+    translation_permutation_cache =
+        std::make_shared<TranslationPermutationCache>(
+            translation_permutation_cache_max_bytes,
+            std::move(translation_permutation_source));
+  }
+}
+
+/// \brief Estimate the memory used by a SupercellSymInfo
+///
+/// \param sym_info The SupercellSymInfo
+/// \param context Records shared objects already counted. The factor group
+///     and the translation permutation cache are only counted if they are
+///     not already recorded.
+///
+/// The translation permutation cache is counted by the permutations it
+/// currently holds, which may be up to its `max_bytes()`.
+SupercellSymInfoMemoryUsage make_memory_usage(SupercellSymInfo const &sym_info,
+                                              MemoryUsageContext &context) {
+  using namespace memory_usage_impl;
+  SupercellSymInfoMemoryUsage usage;
+
+  if (context.insert(sym_info.factor_group.get())) {
+    usage.factor_group_bytes +=
+        sizeof(SymGroup) + heap_bytes(*sym_info.factor_group);
+  }
+  usage.factor_group_bytes += heap_bytes(sym_info.factor_group_point_matrices);
+  usage.factor_group_bytes +=
+      heap_bytes(sym_info.factor_group_translation_cocycle);
+
+  usage.factor_group_permutations_bytes =
+      heap_bytes(sym_info.factor_group_permutations);
+  for (auto const &perm : sym_info.factor_group_permutations) {
+    usage.factor_group_permutations_bytes += heap_bytes(perm);
   }
+
+  if (sym_info.translation_permutations.has_value()) {
+    auto const &perms = *sym_info.translation_permutations;
+    usage.n_translation_permutations = perms.size();
+    usage.translation_permutations_bytes = heap_bytes(perms);
+    for (auto const &perm : perms) {
+      usage.translation_permutations_bytes += heap_bytes(perm);
+    }
+  }
+
+  auto const &cache = sym_info.translation_permutation_cache;
+  if (context.insert(cache.get())) {
+    usage.translation_permutation_cache_bytes =
+        sizeof(TranslationPermutationCache) + cache->size_bytes() +
+        cache->size() * (hash_node_bytes + set_node_bytes +
+                         sizeof(sym_info::Permutation));
+  }
+
+  usage.other_bytes =
+      sizeof(SupercellSymInfo) + heap_bytes(sym_info.translation_cart);
+  return usage;
 }
 
 /// \brief Construct supercell factor group
 SymGroup make_factor_group(std::shared_ptr<Prim const> const &prim,
                            Superlattice const &superlattice) {
+  CASM_CONFIGURATION_TRACE_SCOPE("Supercell.make_factor_group");
   std::vector<Index> invariant_subgroup_indices =
       xtal::invariant_subgroup_indices(superlattice.superlattice(),
                                        prim->sym_info.factor_group->element);
@@ -58,10 +435,17 @@ SymGroup make_factor_group(std::shared_ptr<Prim const> const &prim,
 ///     in this supercell. Generates translations within the supercell.
 /// \param bijk_index_converter UnitCellCoord and linear site index conversions
 ///     in this supercell.
+/// \param diagonal_index_converter If not null, the fast index conversions
+///     for this supercell, used instead of the general converters.
 sym_info::Permutation make_translation_permutation(
     Index translation_index,
     xtal::UnitCellIndexConverter const &ijk_index_converter,
-    xtal::UnitCellCoordIndexConverter const &bijk_index_converter) {
+    xtal::UnitCellCoordIndexConverter const &bijk_index_converter,
+    DiagonalIndexConverter const *diagonal_index_converter) {
+  if (diagonal_index_converter != nullptr) {
+    return diagonal_index_converter->make_translation_permutation(
+        translation_index);
+  }
   std::vector<Index> single_translation_permutation(
       bijk_index_converter.total_sites(), -1);
   UnitCell translation_uc = ijk_index_converter(translation_index);
@@ -81,6 +465,36 @@ sym_info::Permutation make_translation_permutation(
   return single_translation_permutation;
 }
 
+/// \brief Return `make_translation_permutation(translation_index, ...)[i]`,
+///     without constructing the permutation
+///
+/// A translation moves the site with index `j` to the site with index
+/// `bijk_index_converter(bijk_index_converter(j) + translation_uc)`, so the
+/// site whose values are permuted onto site `i` is found by translating site
+/// `i` by `-translation_uc`.
+///
+/// \param translation_index Index in range [0, n_unitcells)
+/// \param i Site index in range [0, n_sites)
+/// \param ijk_index_converter UnitCell and linear unit cell index conversions
+///     in this supercell.
+/// \param bijk_index_converter UnitCellCoord and linear site index conversions
+///     in this supercell.
+/// \param diagonal_index_converter If not null, the fast index conversions
+///     for this supercell, used instead of the general converters.
+Index translation_permute_index(
+    Index translation_index, Index i,
+    xtal::UnitCellIndexConverter const &ijk_index_converter,
+    xtal::UnitCellCoordIndexConverter const &bijk_index_converter,
+    DiagonalIndexConverter const *diagonal_index_converter) {
+  if (diagonal_index_converter != nullptr) {
+    return diagonal_index_converter->translation_permute_index(
+        translation_index, i);
+  }
+  UnitCell translation_uc = ijk_index_converter(translation_index);
+  return bijk_index_converter(bijk_index_converter(i) +
+                              UnitCell(-translation_uc));
+}
+
 /// \brief Construct supercell translation permutations
 ///
 /// These permutations describe how the translations within the supercell
@@ -90,19 +504,48 @@ sym_info::Permutation make_translation_permutation(
 ///     in this supercell. Generates translations within the supercell.
 /// \param bijk_index_converter UnitCellCoord and linear site index conversions
 ///     in this supercell.
+/// \param diagonal_index_converter If not null, the fast index conversions
+///     for this supercell, used instead of the general converters.
 std::vector<sym_info::Permutation> make_translation_permutations(
     xtal::UnitCellIndexConverter const &ijk_index_converter,
-    xtal::UnitCellCoordIndexConverter const &bijk_index_converter) {
+    xtal::UnitCellCoordIndexConverter const &bijk_index_converter,
+    DiagonalIndexConverter const *diagonal_index_converter) {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("Supercell.make_translation_permutations",
+                                     "n_unitcells",
+                                     ijk_index_converter.total_sites());
   std::vector<sym_info::Permutation> translation_permutations;
   // Loops over lattice points
   for (Index translation_ix = 0;
        translation_ix < ijk_index_converter.total_sites(); ++translation_ix) {
-    translation_permutations.push_back(make_translation_permutation(
-        translation_ix, ijk_index_converter, bijk_index_converter));
+    translation_permutations.push_back(
+        make_translation_permutation(translation_ix, ijk_index_converter,
+                                     bijk_index_converter,
+                                     diagonal_index_converter));
   }
   return translation_permutations;
 }
 
+/// \brief Construct Cartesian coordinates of supercell translations
+///
+/// \param prim_lattice The prim lattice
+/// \param ijk_index_converter UnitCell and linear unit cell index
+///     conversions in this supercell
+///
+/// \returns A matrix with one column per supercell translation, where
+///     column `translation_index` is the Cartesian coordinate of
+///     `ijk_index_converter(translation_index)`.
+Eigen::Matrix3Xd make_translation_cart(
+    Lattice const &prim_lattice,
+    xtal::UnitCellIndexConverter const &ijk_index_converter) {
+  Index n_unitcells = ijk_index_converter.total_sites();
+  Eigen::Matrix3Xd translation_cart(3, n_unitcells);
+  Eigen::Matrix3d const &L = prim_lattice.lat_column_mat();
+  for (Index i = 0; i < n_unitcells; ++i) {
+    translation_cart.col(i) = L * ijk_index_converter(i).cast<double>();
+  }
+  return translation_cart;
+}
+
 /// \brief Construct supercell factor group permutations
 ///
 /// These permutations describe how the prim factor group operations that are
@@ -119,6 +562,9 @@ std::vector<sym_info::Permutation> make_factor_group_permutations(
     std::vector<Index> const &head_group_index,
     sym_info::UnitCellCoordSymGroupRep const &unitcellcoord_symgroup_rep,
     xtal::UnitCellCoordIndexConverter const &bijk_index_converter) {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("Supercell.make_factor_group_permutations",
+                                     "n_sites",
+                                     bijk_index_converter.total_sites());
   std::vector<sym_info::Permutation> factor_group_permutations;
   long total_sites = bijk_index_converter.total_sites();
 
@@ -136,5 +582,52 @@ std::vector<sym_info::Permutation> make_factor_group_permutations(
   return factor_group_permutations;
 }
 
+/// \brief Construct supercell factor group integer transformation matrices
+///
+/// \param head_group_index Prim factor group indices of the supercell factor
+///     group operations
+/// \param unitcellcoord_symgroup_rep Prim factor group representation
+///     describing transformation of UnitCellCoord
+///
+/// \returns point_matrices, where `point_matrices[i]` is the integer
+///     transformation matrix, in fractional coordinates of the prim lattice,
+///     of the `i`-th supercell factor group operation
+std::vector<Eigen::Matrix3l> make_factor_group_point_matrices(
+    std::vector<Index> const &head_group_index,
+    sym_info::UnitCellCoordSymGroupRep const &unitcellcoord_symgroup_rep) {
+  std::vector<Eigen::Matrix3l> point_matrices;
+  point_matrices.reserve(head_group_index.size());
+  for (Index prim_fg_index : head_group_index) {
+    point_matrices.push_back(
+        unitcellcoord_symgroup_rep[prim_fg_index].point_matrix);
+  }
+  return point_matrices;
+}
+
+/// \brief Construct the supercell factor group translation cocycle
+///
+/// \param factor_group The supercell factor group
+/// \param prim_lattice The prim lattice
+///
+/// \returns cocycle, where `cocycle[a * n_fg + b]` is the lattice
+///     translation, as UnitCell, such that
+///     `element[a] * element[b] = translation(cocycle) * element[ab]`.
+std::vector<UnitCell> make_factor_group_translation_cocycle(
+    SymGroup const &factor_group, Lattice const &prim_lattice) {
+  Index n_fg = factor_group.element.size();
+  std::vector<UnitCell> cocycle;
+  cocycle.reserve(n_fg * n_fg);
+  for (Index a = 0; a < n_fg; ++a) {
+    for (Index b = 0; b < n_fg; ++b) {
+      SymOp const &ab =
+          factor_group.element[factor_group.multiplication_table[a][b]];
+      SymOp product = factor_group.element[a] * factor_group.element[b];
+      cocycle.push_back(UnitCell::from_cartesian(
+          product.translation - ab.translation, prim_lattice));
+    }
+  }
+  return cocycle;
+}
+
 }  // namespace config
 }  // namespace CASM
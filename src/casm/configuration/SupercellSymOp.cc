@@ -1,25 +1,216 @@
 #include "casm/configuration/SupercellSymOp.hh"
 
+#include <algorithm>
+#include <memory>
+
 #include "casm/clexulator/ConfigDoFValues.hh"
 #include "casm/clexulator/ConfigDoFValuesTools_impl.hh"
 #include "casm/clexulator/DoFSpace.hh"
+#include "casm/configuration/CombinedPermutationTable.hh"
 #include "casm/configuration/PrimSymInfo.hh"
 #include "casm/configuration/Supercell.hh"
 #include "casm/configuration/SupercellSymInfo.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/configuration/perf.hh"
 #include "casm/configuration/sym_info/definitions.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
 #include "casm/crystallography/SymType.hh"
 #include "casm/crystallography/SymTypeComparator.hh"
 
 namespace CASM {
 namespace config {
 
+// --- SupercellSymOpRef ---
+
+/// Default invalid SupercellSymOpRef
+SupercellSymOpRef::SupercellSymOpRef()
+    : m_supercell(nullptr),
+      m_supercell_factor_group_index(-1),
+      m_translation_index(-1) {}
+
+/// Construct SupercellSymOpRef
+///
+/// \param _supercell Supercell, which must outlive the SupercellSymOpRef
+/// \param _supercell_factor_group_index Supercell factor group index
+/// \param _translation_index Translation index, corresponding to
+///     the translation of the origin to the unitcell with the
+///     same linear index.
+SupercellSymOpRef::SupercellSymOpRef(Supercell const &_supercell,
+                                     Index _supercell_factor_group_index,
+                                     Index _translation_index)
+    : m_supercell(&_supercell),
+      m_supercell_factor_group_index(_supercell_factor_group_index),
+      m_translation_index(_translation_index) {}
+
+/// Construct SupercellSymOpRef referring to the same operation as `op`
+///
+/// The supercell of `op` must outlive the SupercellSymOpRef.
+SupercellSymOpRef::SupercellSymOpRef(SupercellSymOp const &op)
+    : m_supercell(op.supercell().get()),
+      m_supercell_factor_group_index(op.supercell_factor_group_index()),
+      m_translation_index(op.translation_index()) {}
+
+/// \brief Prim factor group index
+Index SupercellSymOpRef::prim_factor_group_index() const {
+  this->throw_invalid_if_end();
+  return m_supercell->sym_info.factor_group
+      ->head_group_index[m_supercell_factor_group_index];
+}
+
+/// \brief Lattice translation in fractional coordinates of the prim lattice
+/// vectors
+xtal::UnitCell SupercellSymOpRef::translation_frac() const {
+  return m_supercell->unitcell_index_converter(m_translation_index);
+}
+
+/// \brief Returns the index of the site containing the site DoF values that
+///     will be permuted onto site i
+///
+/// Permutation of configuration site dof values occurs according to:
+///     after[i] = before[permute_index(i)]
+///
+/// If the supercell does not store all translation permutations, the
+/// translated index is computed directly from the index converters.
+Index SupercellSymOpRef::permute_index(Index i) const {
+  this->throw_invalid_if_end();
+  SupercellSymInfo const &sym_info = m_supercell->sym_info;
+  auto const &fg_perm =
+      sym_info.factor_group_permutations[m_supercell_factor_group_index];
+  if (sym_info.translation_permutations.has_value()) {
+    auto const &trans_perm =
+        (*sym_info.translation_permutations)[m_translation_index];
+    return fg_perm[trans_perm[i]];
+  }
+  return fg_perm[translation_permute_index(
+      m_translation_index, i, m_supercell->unitcell_index_converter,
+      m_supercell->unitcellcoord_index_converter,
+      m_supercell->diagonal_index_converter.get())];
+}
+
+/// \brief Return the SymOp for the operation
+///
+/// Defined by:
+///
+///   translation_op * factor_group_op
+///
+/// In other words, the symmetry operation equivalent to application of the
+/// factor group operation, FOLLOWED BY application of the translation
+/// operation;
+SymOp SupercellSymOpRef::to_symop() const {
+  this->throw_invalid_if_end();
+  SupercellSymInfo const &sym_info = m_supercell->sym_info;
+  SymOp const &fg_op =
+      sym_info.factor_group->element[m_supercell_factor_group_index];
+  return SymOp{fg_op.matrix,
+               sym_info.translation_cart.col(m_translation_index) +
+                   fg_op.translation,
+               fg_op.is_time_reversal_active};
+}
+
+/// \brief Returns the inverse supercell operation
+///
+/// With `*this` representing `translation(t) * element[f]`, the inverse is
+/// `translation(t_inv) * element[f_inv]`, where:
+///
+///     t_inv = -R[f_inv] * t - cocycle(f_inv, f),
+///
+/// `R` are the `sym_info.factor_group_point_matrices` and `cocycle` is from
+/// `sym_info.factor_group_translation_cocycle`, so this requires only
+/// integer arithmetic.
+SupercellSymOpRef SupercellSymOpRef::inverse() const {
+  this->throw_invalid_if_end();
+
+  // Finding the inverse factor_group operation is straightforward
+  SupercellSymInfo const &sym_info = m_supercell->sym_info;
+  SymGroup const &supercell_factor_group = *sym_info.factor_group;
+  Index fg_index = m_supercell_factor_group_index;
+  Index inverse_fg_index = supercell_factor_group.inverse_index[fg_index];
+
+  // The new translation is found using the translation cocycle
+  Index n_fg = supercell_factor_group.element.size();
+  auto const &converter = m_supercell->unitcell_index_converter;
+  Eigen::Vector3l translation_frac =
+      -sym_info.factor_group_point_matrices[inverse_fg_index] *
+          converter(m_translation_index) -
+      sym_info.factor_group_translation_cocycle[inverse_fg_index * n_fg +
+                                                fg_index];
+
+  // convert to linear index
+  return SupercellSymOpRef(*m_supercell, inverse_fg_index,
+                           converter(UnitCell(translation_frac)));
+}
+
+/// \brief Returns the supercell operation equivalent to applying first RHS
+/// and then *this
+///
+/// With `*this` representing `translation(t_a) * element[a]` and `RHS`
+/// representing `translation(t_b) * element[b]`, the product is
+/// `translation(t_ab) * element[ab]`, where:
+///
+///     t_ab = t_a + R[a] * t_b + cocycle(a, b),
+///
+/// `R` are the `sym_info.factor_group_point_matrices` and `cocycle` is from
+/// `sym_info.factor_group_translation_cocycle`, so this requires only
+/// integer arithmetic.
+SupercellSymOpRef SupercellSymOpRef::operator*(
+    SupercellSymOpRef const &RHS) const {
+  this->throw_invalid_if_end();
+  RHS.throw_invalid_if_end();
+
+  // Finding the factor_group product is straightforward
+  SupercellSymInfo const &sym_info = m_supercell->sym_info;
+  SymGroup const &supercell_factor_group = *sym_info.factor_group;
+  Index a = m_supercell_factor_group_index;
+  Index b = RHS.m_supercell_factor_group_index;
+  Index product_fg_index = supercell_factor_group.multiplication_table[a][b];
+
+  // The new translation is found using the translation cocycle
+  Index n_fg = supercell_factor_group.element.size();
+  auto const &converter = m_supercell->unitcell_index_converter;
+  Eigen::Vector3l translation_frac =
+      converter(m_translation_index) +
+      sym_info.factor_group_point_matrices[a] *
+          converter(RHS.m_translation_index) +
+      sym_info.factor_group_translation_cocycle[a * n_fg + b];
+
+  // convert to linear index
+  return SupercellSymOpRef(*m_supercell, product_fg_index,
+                           converter(UnitCell(translation_frac)));
+}
+
+/// \brief Less than comparison (used to implement operator<() and other
+/// standard comparisons via Comparisons)
+bool SupercellSymOpRef::operator<(SupercellSymOpRef const &RHS) const {
+  if (m_supercell_factor_group_index == RHS.m_supercell_factor_group_index) {
+    return m_translation_index < RHS.m_translation_index;
+  }
+  return m_supercell_factor_group_index < RHS.m_supercell_factor_group_index;
+}
+
+void SupercellSymOpRef::throw_invalid_if_end() const {
+  if (m_supercell == nullptr || m_supercell_factor_group_index < 0 ||
+      m_supercell_factor_group_index >=
+          Index(m_supercell->sym_info.factor_group_permutations.size())) {
+    throw std::runtime_error(
+        "Attempting to use an invalid SupercellSymOpRef. (Is it a default "
+        "or end SupercellSymOp?)");
+  }
+}
+
+/// \brief Equality comparison (used to implement operator==)
+bool SupercellSymOpRef::eq_impl(SupercellSymOpRef const &RHS) const {
+  return m_supercell == RHS.m_supercell &&
+         m_supercell_factor_group_index ==
+             RHS.m_supercell_factor_group_index &&
+         m_translation_index == RHS.m_translation_index;
+}
+
 // --- Inline definitions ---
 
 /// Default invalid SupercellSymOp, not equal to end iterator
 SupercellSymOp::SupercellSymOp()
     : m_supercell_factor_group_index(),
-      m_translation_index(),
-      m_tmp_translation_index(-1) {}
+      m_translation_index() {}
 
 /// Construct SupercellSymOp
 ///
@@ -36,8 +227,7 @@ SupercellSymOp::SupercellSymOp(
       m_supercell_factor_group_end_index(
           m_supercell->sym_info.factor_group_permutations.size()),
       m_translation_index(_translation_index),
-      m_N_translation(m_supercell->superlattice.size()),
-      m_tmp_translation_index(-1) {}
+      m_N_translation(m_supercell->superlattice.size()) {}
 
 /// Construct SupercellSymOp
 ///
@@ -65,6 +255,49 @@ SupercellSymOp::SupercellSymOp(
           UnitCell::from_cartesian(_translation_cart,
                                    _supercell->superlattice.prim_lattice())) {}
 
+/// Construct SupercellSymOp, owning the supercell of a SupercellSymOpRef
+///
+/// \param _supercell Supercell, which must be the supercell of `_ref`
+/// \param _ref The operation
+SupercellSymOp::SupercellSymOp(
+    std::shared_ptr<Supercell const> const &_supercell,
+    SupercellSymOpRef const &_ref)
+    : SupercellSymOp(_supercell, _ref.supercell_factor_group_index(),
+                     _ref.translation_index()) {
+  if (_supercell.get() != _ref.supercell_ptr()) {
+    throw std::runtime_error(
+        "Error in SupercellSymOp constructor: supercell is not the supercell "
+        "of the SupercellSymOpRef");
+  }
+}
+
+/// Copy constructor, which does not copy the stored translation permutation
+///
+/// Copying the stored translation permutation pointer could race with another
+/// thread's call to `other.translation_permute()`. The copy will get it from
+/// the shared translation permutation cache if needed.
+SupercellSymOp::SupercellSymOp(SupercellSymOp const &other)
+    : m_supercell(other.m_supercell),
+      m_supercell_factor_group_index(other.m_supercell_factor_group_index),
+      m_supercell_factor_group_end_index(
+          other.m_supercell_factor_group_end_index),
+      m_translation_index(other.m_translation_index),
+      m_N_translation(other.m_N_translation) {}
+
+/// Copy assignment, which does not copy the stored translation permutation
+SupercellSymOp &SupercellSymOp::operator=(SupercellSymOp const &other) {
+  if (this != &other) {
+    m_supercell = other.m_supercell;
+    m_supercell_factor_group_index = other.m_supercell_factor_group_index;
+    m_supercell_factor_group_end_index =
+        other.m_supercell_factor_group_end_index;
+    m_translation_index = other.m_translation_index;
+    m_N_translation = other.m_N_translation;
+    m_tmp_translation_permute.reset();
+  }
+  return *this;
+}
+
 /// \brief Make supercell symop begin iterator
 SupercellSymOp SupercellSymOp::begin(
     std::shared_ptr<Supercell const> const &_supercell) {
@@ -127,15 +360,33 @@ xtal::UnitCell SupercellSymOp::translation_frac() const {
 ///
 /// Permutation of configuration site dof values occurs according to:
 ///     after[i] = before[permute_index(i)]
+///
+/// If the supercell stores neither all translation permutations nor any
+/// cached translation permutations (translation permutation cache budget is
+/// 0), the translated index is computed directly from the index converters.
 Index SupercellSymOp::permute_index(Index i) const {
   this->throw_invalid_if_end();
   SupercellSymInfo const &sym_info = m_supercell->sym_info;
   auto const &fg_perm =
       sym_info.factor_group_permutations[m_supercell_factor_group_index];
+  if (!sym_info.translation_permutations.has_value() &&
+      sym_info.translation_permutation_cache->max_bytes() == 0) {
+    return fg_perm[translation_permute_index(
+        m_translation_index, i, m_supercell->unitcell_index_converter,
+        m_supercell->unitcellcoord_index_converter,
+        m_supercell->diagonal_index_converter.get())];
+  }
   auto const &trans_perm = this->translation_permute();
   return fg_perm[trans_perm[i]];
 }
 
+/// \brief Returns a non-owning handle to the current operation
+///
+/// The supercell must outlive the result.
+SupercellSymOpRef SupercellSymOp::ref() const {
+  return SupercellSymOpRef(*this);
+}
+
 /// Returns a reference to this -- allows SupercellSymOp to be treated as an
 /// iterator to SupercellSymOp object
 SupercellSymOp const &SupercellSymOp::operator*() const { return *this; }
@@ -180,51 +431,67 @@ SupercellSymOp SupercellSymOp::operator--(int) {
 
 /// \brief Return the SymOp for the current operation
 ///
-/// Defined by:
-///
-///   translation_op * factor_group_op
-///
-/// In other words, the symmetry operation equivalent to application of the
-/// factor group operation, FOLLOWED BY application of the translation
-/// operation;
+/// See `SupercellSymOpRef::to_symop`.
 SymOp SupercellSymOp::to_symop() const {
   this->throw_invalid_if_end();
-  UnitCell translation_frac =
-      this->m_supercell->unitcell_index_converter(this->m_translation_index);
-
-  Eigen::Matrix3d const &prim_lat_column_mat =
-      this->m_supercell->superlattice.prim_lattice().lat_column_mat();
-
-  Eigen::Vector3d translation_cart =
-      prim_lat_column_mat * translation_frac.cast<double>();
-
-  SymOp const &fg_op = this->m_supercell->sym_info.factor_group
-                           ->element[m_supercell_factor_group_index];
-
-  return SymOp{fg_op.matrix, translation_cart + fg_op.translation,
-               fg_op.is_time_reversal_active};
+  return this->ref().to_symop();
 }
 
-/// Returns the translation permutation. Reference not valid after increment.
+/// Returns the translation permutation. Reference not valid after
+/// increment or assignment.
+///
+/// For large supercells, the permutation is obtained from
+/// `supercell()->sym_info.translation_permutation_cache`, which is shared by
+/// all SupercellSymOp of the supercell, and then stored by this
+/// SupercellSymOp until the translation changes. This may be called
+/// concurrently on the same SupercellSymOp: the stored permutation is only
+/// replaced if it is for a different translation, which no concurrent caller
+/// can still be using.
 sym_info::Permutation const &SupercellSymOp::translation_permute() const {
   this->throw_invalid_if_end();
   if (m_supercell->sym_info.translation_permutations.has_value()) {
     return (
         *m_supercell->sym_info.translation_permutations)[m_translation_index];
   }
-  if (m_tmp_translation_index != m_translation_index) {
-    m_tmp_translation_index = m_translation_index;
-    m_tmp_translation_permute = make_translation_permutation(
-        m_tmp_translation_index, this->m_supercell->unitcell_index_converter,
-        this->m_supercell->unitcellcoord_index_converter);
+  std::shared_ptr<TranslationPermutation const> current =
+      std::atomic_load(&m_tmp_translation_permute);
+  if (current != nullptr && current->translation_index == m_translation_index) {
+    return *current->permute;
   }
-  return m_tmp_translation_permute;
+  CASM_CONFIGURATION_PERF_COUNT(translation_permutation_lookup);
+  auto value = std::make_shared<TranslationPermutation const>(
+      TranslationPermutation{
+          m_translation_index,
+          m_supercell->sym_info.translation_permutation_cache->get(
+              m_translation_index, m_supercell->unitcell_index_converter,
+              m_supercell->unitcellcoord_index_converter,
+              m_supercell->diagonal_index_converter.get())});
+  if (!std::atomic_compare_exchange_strong(&m_tmp_translation_permute,
+                                           &current, value)) {
+    // `current` is now the value stored concurrently by another caller
+    if (current != nullptr &&
+        current->translation_index == m_translation_index) {
+      return *current->permute;
+    }
+    std::atomic_store(&m_tmp_translation_permute, value);
+  }
+  return *value->permute;
 }
 
 /// Returns the combination of factor group operation permutation and
 /// translation permutation
+///
+/// If the supercell's combined permutation table fits in its memory budget,
+/// the result is copied from the table, which is built on first use.
 sym_info::Permutation SupercellSymOp::combined_permute() const {
   this->throw_invalid_if_end();
+  CombinedPermutationTable const *table =
+      m_supercell->combined_permutation_table();
+  if (table != nullptr) {
+    std::int32_t const *perm =
+        table->permute(m_supercell_factor_group_index, m_translation_index);
+    return sym_info::Permutation(perm, perm + table->n_sites());
+  }
   SupercellSymInfo const &sym_info = m_supercell->sym_info;
   auto const &fg_permute =
       sym_info.factor_group_permutations[m_supercell_factor_group_index];
@@ -233,44 +500,43 @@ sym_info::Permutation SupercellSymOp::combined_permute() const {
                                           trans_permute);  // second
 }
 
+/// \brief Returns the inverse of `combined_permute()`, which transforms
+///     site indices
+///
+/// Equivalent to `sym_info::inverse(combined_permute())`. If the
+/// supercell's combined permutation table fits in its memory budget, the
+/// result is copied from the table, which is built on first use.
+sym_info::Permutation SupercellSymOp::inverse_combined_permute() const {
+  this->throw_invalid_if_end();
+  CombinedPermutationTable const *table =
+      m_supercell->combined_permutation_table();
+  if (table != nullptr) {
+    std::int32_t const *perm = table->inverse_permute(
+        m_supercell_factor_group_index, m_translation_index);
+    return sym_info::Permutation(perm, perm + table->n_sites());
+  }
+  return sym_info::inverse(combined_permute());
+}
+
 /// \brief Returns the inverse supercell operation
+///
+/// See `SupercellSymOpRef::inverse`.
 SupercellSymOp SupercellSymOp::inverse() const {
   this->throw_invalid_if_end();
   // Copy *this, then update m_supercell_factor_group_index and
   // m_translation_index
   SupercellSymOp inverse_op(*this);
-
-  // Finding the inverse factor_group operation is straightforward
-  SymGroup const &supercell_factor_group =
-      *this->m_supercell->sym_info.factor_group;
-  Index inverse_fg_index =
-      supercell_factor_group
-          .inverse_index[this->m_supercell_factor_group_index];
-  inverse_op.m_supercell_factor_group_index = inverse_fg_index;
-
-  // New translation can be found comparing the translation for the inverse of
-  // the "total sym_op" of *this to the inverse of the untranslated sym_op
-
-  // Find the translation (cartesian coordinates)
-  SymOp const &inverse_sym_op = CASM::config::inverse(this->to_symop());
-  SymOp const &inverse_fg_op = supercell_factor_group.element[inverse_fg_index];
-  Eigen::Vector3d translation_cart =
-      (inverse_sym_op.translation - inverse_fg_op.translation);
-
-  // convert to fractional coordinates
-  Superlattice const &superlattice = this->m_supercell->superlattice;
-  UnitCell translation_uc =
-      UnitCell::from_cartesian(translation_cart, superlattice.prim_lattice());
-
-  // convert to linear index
-  inverse_op.m_translation_index =
-      m_supercell->unitcell_index_converter(translation_uc);
-
+  SupercellSymOpRef inverse_ref = this->ref().inverse();
+  inverse_op.m_supercell_factor_group_index =
+      inverse_ref.supercell_factor_group_index();
+  inverse_op.m_translation_index = inverse_ref.translation_index();
   return inverse_op;
 }
 
 /// \brief Returns the supercell operation equivalent to applying first RHS
 /// and then *this
+///
+/// See `SupercellSymOpRef::operator*`.
 SupercellSymOp SupercellSymOp::operator*(SupercellSymOp const &RHS) const {
   this->throw_invalid_if_end();
   RHS.throw_invalid_if_end();
@@ -278,34 +544,10 @@ SupercellSymOp SupercellSymOp::operator*(SupercellSymOp const &RHS) const {
   // Copy *this, then update m_supercell_factor_group_index and
   // m_translation_index
   SupercellSymOp product_op(*this);
-
-  // Finding the factor_group product is straightforward
-  SymGroup const &supercell_factor_group =
-      *this->m_supercell->sym_info.factor_group;
+  SupercellSymOpRef product_ref = this->ref() * RHS.ref();
   product_op.m_supercell_factor_group_index =
-      supercell_factor_group
-          .multiplication_table[this->m_supercell_factor_group_index]
-                               [RHS.m_supercell_factor_group_index];
-
-  // New translation can be found comparing the translation for the product of
-  // the "total sym_op" to the just the product factor group op translation
-
-  // Find the translation (cartesian coordinates)
-  SymOp total_product_op = this->to_symop() * RHS.to_symop();
-  SymOp const &product_fg_op =
-      supercell_factor_group.element[product_op.m_supercell_factor_group_index];
-  Eigen::Vector3d translation_cart =
-      total_product_op.translation - product_fg_op.translation;
-
-  // convert to fractional coordinates
-  Superlattice const &superlattice = this->m_supercell->superlattice;
-  UnitCell translation_uc =
-      UnitCell::from_cartesian(translation_cart, superlattice.prim_lattice());
-
-  // convert to linear index
-  product_op.m_translation_index =
-      m_supercell->unitcell_index_converter(translation_uc);
-
+      product_ref.supercell_factor_group_index();
+  product_op.m_translation_index = product_ref.translation_index();
   return product_op;
 }
 
@@ -345,9 +587,142 @@ SymOp inverse(SymOp const &op) {
 /// \brief Apply a symmetry operation specified by a SupercellSymOp to
 /// ConfigDoFValues
 ConfigDoFValues &apply(SupercellSymOp const &op, ConfigDoFValues &dof_values) {
+  SupercellSymOpWorkspace workspace;
+  return apply(op, dof_values, workspace);
+}
+
+/// \brief Return the combined site permutation of `op`, making it only if
+///     it is not the one already stored
+///
+/// The result satisfies `combined_permute[l] == op.permute_index(l)`. It is
+/// copied from the supercell's combined permutation table, if that fits in
+/// the memory budget. Otherwise, if the supercell neither stores nor caches
+/// translation permutations, translated site indices are computed directly,
+/// so no translation permutation is constructed.
+sym_info::Permutation const &SupercellSymOpWorkspace::update_combined_permute(
+    SupercellSymOp const &op) {
+  op.throw_invalid_if_end();
+  if (supercell == op.supercell().get() &&
+      supercell_factor_group_index == op.supercell_factor_group_index() &&
+      translation_index == op.translation_index()) {
+    return combined_permute;
+  }
+  SupercellSymInfo const &sym_info = op.supercell()->sym_info;
+  Index n_sites = op.supercell()->unitcellcoord_index_converter.total_sites();
+  combined_permute.resize(n_sites);
+  CombinedPermutationTable const *table =
+      op.supercell()->combined_permutation_table();
+  if (table != nullptr) {
+    std::int32_t const *perm = table->permute(
+        op.supercell_factor_group_index(), op.translation_index());
+    std::copy(perm, perm + n_sites, combined_permute.begin());
+  } else if (!sym_info.translation_permutations.has_value() &&
+             sym_info.translation_permutation_cache->max_bytes() == 0) {
+    for (Index l = 0; l < n_sites; ++l) {
+      combined_permute[l] = op.permute_index(l);
+    }
+  } else {
+    auto const &fg_perm =
+        sym_info.factor_group_permutations[op.supercell_factor_group_index()];
+    auto const &trans_perm = op.translation_permute();
+    for (Index l = 0; l < n_sites; ++l) {
+      combined_permute[l] = fg_perm[trans_perm[l]];
+    }
+  }
+  supercell = op.supercell().get();
+  if (shared_supercell != op.supercell()) {
+    shared_supercell = op.supercell();
+  }
+  supercell_factor_group_index = op.supercell_factor_group_index();
+  translation_index = op.translation_index();
+  return combined_permute;
+}
+
+/// \brief Return the combined site permutation of `op`, making it only if
+///     it is not the one already stored
+///
+/// The result satisfies `combined_permute[l] == op.permute_index(l)`, and is
+/// copied from the supercell's combined permutation table, if that fits in
+/// the memory budget. The supercell of `op` is not held by the workspace, so
+/// the workspace should not be used with a SupercellSymOpRef after its
+/// supercell is destroyed.
+sym_info::Permutation const &SupercellSymOpWorkspace::update_combined_permute(
+    SupercellSymOpRef const &op) {
+  op.throw_invalid_if_end();
+  if (supercell == op.supercell_ptr() &&
+      supercell_factor_group_index == op.supercell_factor_group_index() &&
+      translation_index == op.translation_index()) {
+    return combined_permute;
+  }
+  Supercell const &_supercell = op.supercell();
+  SupercellSymInfo const &sym_info = _supercell.sym_info;
+  Index n_sites = _supercell.unitcellcoord_index_converter.total_sites();
+  combined_permute.resize(n_sites);
+  auto const &fg_perm =
+      sym_info.factor_group_permutations[op.supercell_factor_group_index()];
+  CombinedPermutationTable const *table =
+      _supercell.combined_permutation_table();
+  if (table != nullptr) {
+    std::int32_t const *perm = table->permute(
+        op.supercell_factor_group_index(), op.translation_index());
+    std::copy(perm, perm + n_sites, combined_permute.begin());
+  } else if (sym_info.translation_permutations.has_value()) {
+    auto const &trans_perm =
+        (*sym_info.translation_permutations)[op.translation_index()];
+    for (Index l = 0; l < n_sites; ++l) {
+      combined_permute[l] = fg_perm[trans_perm[l]];
+    }
+  } else if (sym_info.translation_permutation_cache->max_bytes() != 0) {
+    CASM_CONFIGURATION_PERF_COUNT(translation_permutation_lookup);
+    std::shared_ptr<sym_info::Permutation const> trans_perm =
+        sym_info.translation_permutation_cache->get(
+            op.translation_index(), _supercell.unitcell_index_converter,
+            _supercell.unitcellcoord_index_converter,
+            _supercell.diagonal_index_converter.get());
+    for (Index l = 0; l < n_sites; ++l) {
+      combined_permute[l] = fg_perm[(*trans_perm)[l]];
+    }
+  } else {
+    for (Index l = 0; l < n_sites; ++l) {
+      combined_permute[l] = op.permute_index(l);
+    }
+  }
+  if (supercell != op.supercell_ptr()) {
+    shared_supercell.reset();
+  }
+  supercell = op.supercell_ptr();
+  supercell_factor_group_index = op.supercell_factor_group_index();
+  translation_index = op.translation_index();
+  return combined_permute;
+}
+
+/// \brief Apply a symmetry operation specified by a SupercellSymOp to
+/// ConfigDoFValues, using reusable storage
+///
+/// Gives the same result as `apply(op, dof_values)`. Temporary values are
+/// stored in `workspace`, so after the first call with values of the same
+/// size no heap allocation is required, and the combined site permutation
+/// is only remade when `op` changes.
+ConfigDoFValues &apply(SupercellSymOp const &op, ConfigDoFValues &dof_values,
+                       SupercellSymOpWorkspace &workspace) {
+  // uses the translation permutation held by `op`, if any, and holds the
+  // supercell in `workspace`
+  workspace.update_combined_permute(op);
+  return apply(op.ref(), dof_values, workspace);
+}
+
+/// \brief Apply a symmetry operation specified by a SupercellSymOpRef to
+/// ConfigDoFValues, using reusable storage
+///
+/// Gives the same result as `apply(SupercellSymOp(supercell, op),
+/// dof_values, workspace)`.
+ConfigDoFValues &apply(SupercellSymOpRef const &op,
+                       ConfigDoFValues &dof_values,
+                       SupercellSymOpWorkspace &workspace) {
   op.throw_invalid_if_end();
-  Supercell const &supercell = *op.supercell();
-  Prim const &prim = *op.supercell()->prim;
+  CASM_CONFIGURATION_PERF_COUNT(supercell_sym_op_apply);
+  Supercell const &supercell = op.supercell();
+  Prim const &prim = *supercell.prim;
   PrimSymInfo const &prim_sym_info = prim.sym_info;
   Index n_vol = supercell.superlattice.size();
   Index n_sublat = prim.basicstructure->basis().size();
@@ -356,22 +731,25 @@ ConfigDoFValues &apply(SupercellSymOp const &op, ConfigDoFValues &dof_values) {
   Index prim_fg_index = op.prim_factor_group_index();
 
   for (auto &dof : dof_values.global_dof_values) {
-    Eigen::MatrixXd const &M =
-        prim_sym_info.global_dof_symgroup_rep.at(dof.first)[prim_fg_index];
-    dof.second = M * dof.second;
+    workspace.global_values.resize(dof.second.size());
+    prim_sym_info.packed_global_dof_symgroup_rep.at(dof.first).apply(
+        prim_fg_index, 0, dof.second, workspace.global_values);
+    dof.second = workspace.global_values;
   }
 
-  sym_info::Permutation combined_permute{op.combined_permute()};
+  sym_info::Permutation const &combined_permute =
+      workspace.update_combined_permute(op);
 
   if (dof_values.occupation.size()) {
     // permute occupant indices (if anisotropic)
-    Eigen::VectorXi tmp{dof_values.occupation};
+    Eigen::VectorXi &tmp = workspace.occupation;
+    tmp = dof_values.occupation;
     if (prim_sym_info.has_aniso_occs) {
       Index l = 0;
       for (Index b = 0; b < n_sublat; ++b) {
+        sym_info::Permutation const &occ_perm =
+            prim_sym_info.occ_symgroup_rep[prim_fg_index][b];
         for (Index n = 0; n < n_vol; ++n, ++l) {
-          sym_info::Permutation const &occ_perm =
-              prim_sym_info.occ_symgroup_rep[prim_fg_index][b];
           tmp[l] = occ_perm[tmp[l]];
         }
       }
@@ -385,19 +763,18 @@ ConfigDoFValues &apply(SupercellSymOp const &op, ConfigDoFValues &dof_values) {
 
   using clexulator::sublattice_block;
   for (auto &dof : dof_values.local_dof_values) {
-    // vector of matrix, one per sublattice
-    sym_info::LocalDoFSymOpRep const &local_dof_symop_rep =
-        prim_sym_info.local_dof_symgroup_rep.at(dof.first)[prim_fg_index];
+    // matrices, one per sublattice, stored contiguously
+    sym_info::PackedDoFSymGroupRep const &local_dof_rep =
+        prim_sym_info.packed_local_dof_symgroup_rep.at(dof.first);
 
     // transform values on initial sites
     Eigen::MatrixXd const &init_value = dof.second;
-    Eigen::MatrixXd tmp{init_value};
+    Eigen::MatrixXd &tmp = workspace.local_values;
+    tmp = init_value;
     for (Index b = 0; b < n_sublat; ++b) {
-      Eigen::MatrixXd const &M = local_dof_symop_rep[b];
-      Index dim = M.cols();
-      if (dim == 0) continue;
-      sublattice_block(tmp, b, n_vol).topRows(dim) =
-          M * sublattice_block(init_value, b, n_vol).topRows(dim);
+      local_dof_rep.apply(prim_fg_index, b,
+                          sublattice_block(init_value, b, n_vol),
+                          sublattice_block(tmp, b, n_vol));
     }
 
     // permute values amongst sites
@@ -417,22 +794,100 @@ ConfigDoFValues copy_apply(SupercellSymOp const &op,
   return dof_values;
 }
 
+/// \brief Apply symmetry operations to many occupation vectors
+///
+/// Equivalent to applying each operation to the occupation of each
+/// configuration, as by `copy_apply(op, dof_values)`, but each combined site
+/// permutation is made once and applied to all configurations, and work is
+/// split across operations.
+///
+/// \param ops Symmetry operations, all in the same supercell
+/// \param occupations Occupation values, one configuration per column,
+///     with `n_sites` rows
+/// \param result Set to the transformed occupation values, with `n_sites`
+///     rows and `ops.size() * occupations.cols()` columns. Column
+///     `i_op * occupations.cols() + i_config` is the result of applying
+///     `ops[i_op]` to column `i_config` of `occupations`. Must not alias
+///     `occupations`.
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+void copy_apply_occupations(std::vector<SupercellSymOp> const &ops,
+                            Eigen::Ref<Eigen::MatrixXi const> occupations,
+                            Eigen::Ref<Eigen::MatrixXi> result,
+                            Index n_threads) {
+  Index n_configs = occupations.cols();
+  if (result.rows() != occupations.rows() ||
+      result.cols() != Index(ops.size()) * n_configs) {
+    throw std::runtime_error(
+        "Error in copy_apply_occupations: result size mismatch");
+  }
+  if (ops.empty() || n_configs == 0) {
+    return;
+  }
+  for (auto const &op : ops) {
+    op.throw_invalid_if_end();
+    if (op.supercell() != ops.front().supercell() &&
+        *op.supercell() != *ops.front().supercell()) {
+      throw std::runtime_error(
+          "Error in copy_apply_occupations: operations are not all in the "
+          "same supercell");
+    }
+  }
+  Supercell const &supercell = *ops.front().supercell();
+  PrimSymInfo const &prim_sym_info = supercell.prim->sym_info;
+  Index n_vol = supercell.superlattice.size();
+  Index n_sites = supercell.unitcellcoord_index_converter.total_sites();
+  if (occupations.rows() != n_sites) {
+    throw std::runtime_error(
+        "Error in copy_apply_occupations: occupation size does not match "
+        "the supercell");
+  }
+  if (prim_sym_info.has_aniso_occs) {
+    // occupant permutations are indexed by occupant, so check the range
+    auto const &occ_rep = prim_sym_info.occ_symgroup_rep[0];
+    for (Index c = 0; c < n_configs; ++c) {
+      for (Index l = 0; l < n_sites; ++l) {
+        int occ = occupations(l, c);
+        if (occ < 0 || occ >= Index(occ_rep[l / n_vol].size())) {
+          throw std::runtime_error(
+              "Error in copy_apply_occupations: occupant index out of range");
+        }
+      }
+    }
+  }
+
+  Index n_workers = resolve_n_threads(n_threads, ops.size());
+  std::vector<SupercellSymOpWorkspace> workspaces(n_workers);
+  parallel_for_items(ops.size(), n_workers, [&](Index t, Index i_op) {
+    SupercellSymOp const &op = ops[i_op];
+    sym_info::Permutation const &combined_permute =
+        workspaces[t].update_combined_permute(op);
+    auto result_block = result.middleCols(i_op * n_configs, n_configs);
+    if (prim_sym_info.has_aniso_occs) {
+      auto const &occ_rep =
+          prim_sym_info.occ_symgroup_rep[op.prim_factor_group_index()];
+      for (Index c = 0; c < n_configs; ++c) {
+        for (Index l = 0; l < n_sites; ++l) {
+          Index from = combined_permute[l];
+          result_block(l, c) = occ_rep[from / n_vol][occupations(from, c)];
+        }
+      }
+    } else {
+      for (Index c = 0; c < n_configs; ++c) {
+        for (Index l = 0; l < n_sites; ++l) {
+          result_block(l, c) = occupations(combined_permute[l], c);
+        }
+      }
+    }
+  });
+}
+
 /// \brief Apply a symmetry operation specified by a SupercellSymOp to
 ///     xtal::UnitCellCoord
 xtal::UnitCellCoord &apply(SupercellSymOp const &op,
                            xtal::UnitCellCoord &unitcellcoord) {
   op.throw_invalid_if_end();
-  UnitCell translation_frac =
-      op.supercell()->unitcell_index_converter(op.translation_index());
-
-  UnitCellCoordRep const &fg_op =
-      op.supercell()
-          ->prim->sym_info
-          .unitcellcoord_symgroup_rep[op.prim_factor_group_index()];
-
-  apply(fg_op, unitcellcoord);
-  unitcellcoord += translation_frac;
-  return unitcellcoord;
+  return apply(op.ref(), unitcellcoord);
 }
 
 /// \brief Apply a symmetry operation specified by a SupercellSymOp to
@@ -443,6 +898,20 @@ xtal::UnitCellCoord copy_apply(SupercellSymOp const &op,
   return unitcellcoord;
 }
 
+/// \brief Apply a symmetry operation specified by a SupercellSymOpRef to
+///     xtal::UnitCellCoord
+xtal::UnitCellCoord &apply(SupercellSymOpRef const &op,
+                           xtal::UnitCellCoord &unitcellcoord) {
+  UnitCellCoordRep const &fg_op =
+      op.supercell()
+          .prim->sym_info
+          .unitcellcoord_symgroup_rep[op.prim_factor_group_index()];
+
+  apply(fg_op, unitcellcoord);
+  unitcellcoord += op.translation_frac();
+  return unitcellcoord;
+}
+
 /// \brief Make SupercellSymOp group rep for local property symmetry in a
 /// supercell
 ///
@@ -574,22 +1043,13 @@ std::vector<Eigen::MatrixXd> make_matrix_rep(
   }
 }
 
-/// \brief Make the matrix representation of `group` that describes the
-///     transformation of a particular global DoF
-///
-/// \param group The group that is to be represented (this may be larger than a
-///     crystallographic factor group)
-/// \param key The type of global DoF to be transformed.
-/// \param symgroup The resulting group, which is a point group, as a SymGroup.
-///
-/// \returns matrix_rep The matrix representation of `group` which transforms
-///     the specified global DoF. Repeated elements are removed (the result
-///     is a point group representation) so the size of `matrix_rep` may be
-///     less the size of `group`.
-///
-std::vector<Eigen::MatrixXd> make_global_dof_matrix_rep(
+namespace {  // anonymous
+
+/// \brief Implements `make_global_dof_matrix_rep`; if `element` is not null,
+///     the point group operations represented are appended to it
+std::vector<Eigen::MatrixXd> _make_global_dof_matrix_rep(
     std::vector<SupercellSymOp> const &group, DoFKey key,
-    std::shared_ptr<SymGroup const> &symgroup) {
+    std::vector<xtal::SymOp> *element) {
   if (group.size() == 0) {
     throw std::runtime_error(
         "Error in make_global_dof_matrix_rep: group has size==0.");
@@ -625,52 +1085,29 @@ std::vector<Eigen::MatrixXd> make_global_dof_matrix_rep(
       prim.sym_info.global_dof_symgroup_rep.at(key);
 
   std::vector<Eigen::MatrixXd> result;
-  std::vector<xtal::SymOp> element;
   for (Index prim_factor_group_index : prim_factor_group_indices) {
     Eigen::MatrixXd M = global_dof_symgroup_rep.at(prim_factor_group_index);
-    element.push_back(
-        make_point_op(factor_group_element[prim_factor_group_index]));
+    if (element) {
+      element->push_back(
+          make_point_op(factor_group_element[prim_factor_group_index]));
+    }
     result.push_back(M);
   }
-
-  std::multiplies<SymOp> multiply_f;
-  xtal::SymOpPeriodicCompare_f equal_to_f(prim_lattice, xtal_tol);
-  symgroup = std::make_shared<SymGroup const>(
-      group::make_group(element, multiply_f, equal_to_f));
-
-  // std::cout << "make_global_dof_matrix_rep: " << group.size() << ","
-  //           << prim_factor_group_indices.size() << "," << result.size()
-  //           << std::endl;
   return result;
 }
 
-/// \brief Make the matrix representation of `group` that describes the
-///     transformation of occupation DoF or a particular local DoF of
-///     amongst a subset of supercell sites
-///
-/// \param group The group that is to be represented (this may be larger than a
-///     crystallographic factor group)
-/// \param key The type of local DoF to be transformed. May be a local
-///     continuous DoF or "occ".
-/// \param site_indices Set of site indices that define the subset of sites
-///     where DoF will be transformed
-/// \param symgroup The resulting group as a SymGroup.
-///
-/// \returns matrix_rep The matrix representation of `group` which transforms
-///     the specified occupation or local DoF.
-///
-std::vector<Eigen::MatrixXd> make_local_dof_matrix_rep(
+
+/// \brief Implements `make_local_dof_block_matrix_rep`; if `element` is not
+///     null, the operations represented are appended to it
+irreps::BlockPermutationMatrixRep _make_local_dof_block_matrix_rep(
     std::vector<SupercellSymOp> const &group, DoFKey key,
-    std::set<Index> const &site_indices,
-    std::shared_ptr<SymGroup const> &symgroup) {
+    std::set<Index> const &site_indices, std::vector<xtal::SymOp> *element) {
   if (group.size() == 0) {
     throw std::runtime_error(
-        "Error in make_local_dof_matrix_rep: group has size==0.");
+        "Error in make_local_dof_block_matrix_rep: group has size==0.");
   }
   Supercell const &supercell = *group.begin()->supercell();
   Prim const &prim = *supercell.prim;
-  xtal::Lattice const &prim_lattice = prim.basicstructure->lattice();
-  double xtal_tol = prim_lattice.tol();
 
   // Usage:
   // \code
@@ -684,7 +1121,7 @@ std::vector<Eigen::MatrixXd> make_local_dof_matrix_rep(
   // - Local DoF values transform using these symrep matrices *before*
   //   permuting among sites.
 
-  sym_info::LocalDoFSymGroupRep local_dof_symgroup_rep =
+  sym_info::LocalDoFSymGroupRep const &local_dof_symgroup_rep =
       prim.sym_info.local_dof_symgroup_rep.at(key);
   if (local_dof_symgroup_rep.size() == 0) {
     throw std::runtime_error(
@@ -692,64 +1129,151 @@ std::vector<Eigen::MatrixXd> make_local_dof_matrix_rep(
         "size==0.");
   }
 
-  std::vector<Eigen::MatrixXd> result;
+  irreps::BlockPermutationMatrixRep result;
 
-  // make map of site_index -> beginning row in basis for that site
-  // (number of rows per site == dof dimension on that site)
-  std::map<Index, Index> site_index_to_basis_index;
-  Index total_dim = 0;
+  // make map of site_index -> block index, and the beginning row in basis
+  // for each block (number of rows per site == dof dimension on that site)
+  std::map<Index, Index> site_index_to_block_index;
+  std::vector<Index> block_offset({0});
   for (Index site_index : site_indices) {
     Index b = supercell.unitcellcoord_index_converter(site_index).sublattice();
     Index site_dof_dim = local_dof_symgroup_rep.at(0).at(b).cols();
-    site_index_to_basis_index[site_index] = total_dim;
-    total_dim += site_dof_dim;
+    site_index_to_block_index[site_index] = block_offset.size() - 1;
+    block_offset.push_back(block_offset.back() + site_dof_dim);
   }
 
-  // make matrix rep, by filling in blocks with site dof symreps
-  Eigen::MatrixXd trep(total_dim, total_dim);
-  std::vector<xtal::SymOp> element;
+  // make matrix rep, with one block per site, using site dof symreps
+  std::vector<Index> block_permutation;
+  std::vector<Eigen::MatrixXd> blocks;
   for (SupercellSymOp const &supercell_symop : group) {
-    trep.setZero();
+    block_permutation.clear();
+    blocks.clear();
+    Index prim_factor_group_index = supercell_symop.prim_factor_group_index();
     for (Index site_index : site_indices) {
-      // "to_site" (after applying symmetry) determines row of block
-      // can't fail, because it was built from [begin, end)
-      Index to_site_index = site_index;
-      Index row = site_index_to_basis_index.find(to_site_index)->second;
+      // "to_site" (after applying symmetry) determines block row, which is
+      // the position of site_index in site_indices
 
-      // "from_site" (before applying symmetry) determines col of block
+      // "from_site" (before applying symmetry) determines block col
       // could fail, if mismatch between [begin, end) and group
       Index from_site_index = supercell_symop.permute_index(site_index);
-      auto col_it = site_index_to_basis_index.find(from_site_index);
-      if (col_it == site_index_to_basis_index.end()) {
+      auto col_it = site_index_to_block_index.find(from_site_index);
+      if (col_it == site_index_to_block_index.end()) {
         throw std::runtime_error(
             "Error in make_collective_dof_matrix_rep: Input group includes "
             "permutations "
             "between selected and unselected sites.");
       }
-      Index col = col_it->second;
+      block_permutation.push_back(col_it->second);
 
       // "from_site" sublattice and factor group op index
       // are used to lookup the site dof rep matrix
       Index from_site_b =
           supercell.unitcellcoord_index_converter(from_site_index).sublattice();
-      Index prim_factor_group_index = supercell_symop.prim_factor_group_index();
-      Eigen::MatrixXd U =
-          local_dof_symgroup_rep.at(prim_factor_group_index).at(from_site_b);
+      blocks.push_back(
+          local_dof_symgroup_rep.at(prim_factor_group_index).at(from_site_b));
+    }
+    result.emplace_back(block_offset, block_permutation, blocks);
 
-      // insert matrix as block in collective dof symrep
-      trep.block(row, col, U.rows(), U.cols()) = U;
+    if (element) {
+      element->push_back(supercell_symop.to_symop());
     }
-    result.push_back(trep);
+  }
+  return result;
+}
+
+}  // namespace
+
+/// \brief Make the matrix representation of `group` that describes the
+///     transformation of a particular global DoF
+///
+/// \param group The group that is to be represented (this may be larger than a
+///     crystallographic factor group)
+/// \param key The type of global DoF to be transformed.
+/// \param symgroup The resulting group, which is a point group, as a SymGroup.
+///
+/// \returns matrix_rep The matrix representation of `group` which transforms
+///     the specified global DoF. Repeated elements are removed (the result
+///     is a point group representation) so the size of `matrix_rep` may be
+///     less the size of `group`.
+///
+std::vector<Eigen::MatrixXd> make_global_dof_matrix_rep(
+    std::vector<SupercellSymOp> const &group, DoFKey key,
+    std::shared_ptr<SymGroup const> &symgroup) {
+  std::vector<xtal::SymOp> element;
+  std::vector<Eigen::MatrixXd> result =
+      _make_global_dof_matrix_rep(group, key, &element);
+
+  xtal::Lattice const &prim_lattice =
+      group.begin()->supercell()->prim->basicstructure->lattice();
+  std::multiplies<SymOp> multiply_f;
+  xtal::SymOpPeriodicCompare_f equal_to_f(prim_lattice, prim_lattice.tol());
+  sym_info::SymOpPeriodicHash_f hash_f(prim_lattice);
+  symgroup = std::make_shared<SymGroup const>(
+      group::make_group(element, multiply_f, equal_to_f, hash_f));
+  return result;
+}
 
-    element.push_back(supercell_symop.to_symop());
+/// \brief Make the matrix representation of `group` that describes the
+///     transformation of occupation DoF or a particular local DoF of
+///     amongst a subset of supercell sites
+///
+/// \param group The group that is to be represented (this may be larger than a
+///     crystallographic factor group)
+/// \param key The type of local DoF to be transformed. May be a local
+///     continuous DoF or "occ".
+/// \param site_indices Set of site indices that define the subset of sites
+///     where DoF will be transformed
+/// \param symgroup The resulting group as a SymGroup.
+///
+/// \returns matrix_rep The matrix representation of `group` which transforms
+///     the specified occupation or local DoF.
+///
+std::vector<Eigen::MatrixXd> make_local_dof_matrix_rep(
+    std::vector<SupercellSymOp> const &group, DoFKey key,
+    std::set<Index> const &site_indices,
+    std::shared_ptr<SymGroup const> &symgroup) {
+  if (group.size() == 0) {
+    throw std::runtime_error(
+        "Error in make_local_dof_matrix_rep: group has size==0.");
   }
+  return irreps::to_dense(
+      make_local_dof_block_matrix_rep(group, key, site_indices, symgroup));
+}
 
+/// \brief Make the block permutation matrix representation of `group` that
+///     describes the transformation of occupation DoF or a particular local
+///     DoF of amongst a subset of supercell sites
+///
+/// \param group The group that is to be represented (this may be larger than a
+///     crystallographic factor group)
+/// \param key The type of local DoF to be transformed. May be a local
+///     continuous DoF or "occ".
+/// \param site_indices Set of site indices that define the subset of sites
+///     where DoF will be transformed
+/// \param symgroup The resulting group as a SymGroup.
+///
+/// \returns matrix_rep The matrix representation of `group` which transforms
+///     the specified occupation or local DoF. Block `i` corresponds to the
+///     `i`-th site in `site_indices`, and its dimension is the site DoF
+///     dimension. `irreps::to_dense(matrix_rep)` is equal to the result of
+///     `make_local_dof_matrix_rep`.
+///
+irreps::BlockPermutationMatrixRep make_local_dof_block_matrix_rep(
+    std::vector<SupercellSymOp> const &group, DoFKey key,
+    std::set<Index> const &site_indices,
+    std::shared_ptr<SymGroup const> &symgroup) {
+  std::vector<xtal::SymOp> element;
+  irreps::BlockPermutationMatrixRep result =
+      _make_local_dof_block_matrix_rep(group, key, site_indices, &element);
+
+  Supercell const &supercell = *group.begin()->supercell();
+  double xtal_tol = supercell.prim->basicstructure->lattice().tol();
   std::multiplies<SymOp> multiply_f;
   xtal::SymOpPeriodicCompare_f equal_to_f(supercell.superlattice.superlattice(),
                                           xtal_tol);
+  sym_info::SymOpPeriodicHash_f hash_f(supercell.superlattice.superlattice());
   symgroup = std::make_shared<SymGroup const>(
-      group::make_group(element, multiply_f, equal_to_f));
-
+      group::make_group(element, multiply_f, equal_to_f, hash_f));
   return result;
 }
 
@@ -766,22 +1290,26 @@ std::vector<Eigen::MatrixXd> make_local_dof_matrix_rep(
 std::vector<Eigen::MatrixXd> make_dof_space_rep(
     std::vector<config::SupercellSymOp> const &group,
     clexulator::DoFSpace const &dof_space) {
-  std::shared_ptr<config::SymGroup const> symgroup;
-  std::vector<Eigen::MatrixXd> fullspace_rep;
+  // the SymGroup made by the public matrix rep functions is not needed here
   std::vector<Eigen::MatrixXd> dof_space_rep;
   if (dof_space.is_global) {
-    fullspace_rep =
-        config::make_global_dof_matrix_rep(group, dof_space.dof_key, symgroup);
+    std::vector<Eigen::MatrixXd> fullspace_rep =
+        _make_global_dof_matrix_rep(group, dof_space.dof_key, nullptr);
+    for (auto const &M : fullspace_rep) {
+      dof_space_rep.push_back(dof_space.basis_inv * M * dof_space.basis);
+    }
   } else {
     if (!dof_space.sites.has_value()) {
       throw std::runtime_error(
           "Error in make_dof_space_rep with local DoF: no DoFSpace sites");
     }
-    fullspace_rep = config::make_local_dof_matrix_rep(
-        group, dof_space.dof_key, *dof_space.sites, symgroup);
-  }
-  for (auto const &M : fullspace_rep) {
-    dof_space_rep.push_back(dof_space.basis_inv * M * dof_space.basis);
+    // local DoF: apply block permutation matrices, without dense expansion
+    irreps::BlockPermutationMatrixRep fullspace_rep =
+        _make_local_dof_block_matrix_rep(group, dof_space.dof_key,
+                                         *dof_space.sites, nullptr);
+    for (auto const &M : fullspace_rep) {
+      dof_space_rep.push_back(dof_space.basis_inv * (M * dof_space.basis));
+    }
   }
   return dof_space_rep;
 }
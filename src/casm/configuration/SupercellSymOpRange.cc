@@ -0,0 +1,214 @@
+#include "casm/configuration/SupercellSymOpRange.hh"
+
+#include <numeric>
+#include <set>
+
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymInfo.hh"
+
+namespace CASM {
+namespace config {
+
+// --- SupercellSymOpRangeIterator ---
+
+/// \brief Default invalid iterator
+SupercellSymOpRangeIterator::SupercellSymOpRangeIterator()
+    : m_range(nullptr), m_factor_group_position(0), m_translation_position(0) {}
+
+/// \brief Constructor
+///
+/// \param range The range, which must outlive the iterator
+/// \param factor_group_position Position in `range.factor_group_indices()`
+/// \param translation_position Position in `range.translation_indices()`
+SupercellSymOpRangeIterator::SupercellSymOpRangeIterator(
+    SupercellSymOpRange const &range, Index factor_group_position,
+    Index translation_position)
+    : m_range(&range),
+      m_factor_group_position(factor_group_position),
+      m_translation_position(translation_position),
+      m_op(SupercellSymOp::end(range.supercell())) {
+  _update();
+}
+
+/// \brief prefix ++it, translations are iterated in the inner loop
+SupercellSymOpRangeIterator &SupercellSymOpRangeIterator::operator++() {
+  ++m_translation_position;
+  if (m_translation_position == Index(m_range->translation_indices().size())) {
+    m_translation_position = 0;
+    ++m_factor_group_position;
+  }
+  _update();
+  return *this;
+}
+
+/// \brief postfix it++
+SupercellSymOpRangeIterator SupercellSymOpRangeIterator::operator++(int) {
+  SupercellSymOpRangeIterator cp(*this);
+  ++(*this);
+  return cp;
+}
+
+/// \brief Linear position in the range
+Index SupercellSymOpRangeIterator::position() const {
+  return m_factor_group_position * m_range->translation_indices().size() +
+         m_translation_position;
+}
+
+bool SupercellSymOpRangeIterator::operator==(
+    SupercellSymOpRangeIterator const &RHS) const {
+  return m_range == RHS.m_range &&
+         m_factor_group_position == RHS.m_factor_group_position &&
+         m_translation_position == RHS.m_translation_position;
+}
+
+/// \brief Set the indices of `m_op` to the current position, without
+///     copying the supercell shared_ptr
+void SupercellSymOpRangeIterator::_update() {
+  auto const &fg_indices = m_range->factor_group_indices();
+  auto const &trans_indices = m_range->translation_indices();
+  if (m_factor_group_position < Index(fg_indices.size()) &&
+      m_translation_position < Index(trans_indices.size())) {
+    m_op.m_supercell_factor_group_index = fg_indices[m_factor_group_position];
+    m_op.m_translation_index = trans_indices[m_translation_position];
+  } else {
+    m_op.m_supercell_factor_group_index =
+        m_op.m_supercell_factor_group_end_index;
+    m_op.m_translation_index = 0;
+  }
+}
+
+// --- SupercellSymOpRange ---
+
+/// \brief Constructor
+///
+/// \param _supercell The supercell
+/// \param _factor_group_indices Supercell factor group indices, iterated in
+///     the outer loop
+/// \param _translation_indices Translation indices, iterated in the inner
+///     loop
+SupercellSymOpRange::SupercellSymOpRange(
+    std::shared_ptr<Supercell const> const &_supercell,
+    std::vector<Index> _factor_group_indices,
+    std::vector<Index> _translation_indices)
+    : m_supercell(_supercell),
+      m_factor_group_indices(std::move(_factor_group_indices)),
+      m_translation_indices(std::move(_translation_indices)) {
+  Index n_fg = m_supercell->sym_info.factor_group_permutations.size();
+  for (Index f : m_factor_group_indices) {
+    if (f < 0 || f >= n_fg) {
+      throw std::runtime_error(
+          "Error in SupercellSymOpRange: invalid factor group index");
+    }
+  }
+  Index n_trans = m_supercell->superlattice.size();
+  for (Index t : m_translation_indices) {
+    if (t < 0 || t >= n_trans) {
+      throw std::runtime_error(
+          "Error in SupercellSymOpRange: invalid translation index");
+    }
+  }
+}
+
+/// \brief All operations consistent with the supercell
+///
+/// Gives the same operations, in the same order, as iterating from
+/// `SupercellSymOp::begin(supercell)` to `SupercellSymOp::end(supercell)`.
+SupercellSymOpRange SupercellSymOpRange::all(
+    std::shared_ptr<Supercell const> const &_supercell) {
+  std::vector<Index> fg_indices(
+      _supercell->sym_info.factor_group_permutations.size());
+  std::iota(fg_indices.begin(), fg_indices.end(), 0);
+  std::vector<Index> trans_indices(_supercell->superlattice.size());
+  std::iota(trans_indices.begin(), trans_indices.end(), 0);
+  return SupercellSymOpRange(_supercell, fg_indices, trans_indices);
+}
+
+/// \brief All translations of the supercell
+///
+/// Gives the same operations, in the same order, as iterating from
+/// `SupercellSymOp::translation_begin(supercell)` to
+/// `SupercellSymOp::translation_end(supercell)`.
+SupercellSymOpRange SupercellSymOpRange::translations(
+    std::shared_ptr<Supercell const> const &_supercell) {
+  std::vector<Index> trans_indices(_supercell->superlattice.size());
+  std::iota(trans_indices.begin(), trans_indices.end(), 0);
+  return SupercellSymOpRange(_supercell, {0}, trans_indices);
+}
+
+/// \brief The operation at linear index `i`
+SupercellSymOp SupercellSymOpRange::operator[](Index i) const {
+  Index n_trans = m_translation_indices.size();
+  return SupercellSymOp(m_supercell, m_factor_group_indices[i / n_trans],
+                        m_translation_indices[i % n_trans]);
+}
+
+/// \brief A non-owning handle to the operation at linear index `i`
+SupercellSymOpRef SupercellSymOpRange::ref(Index i) const {
+  Index n_trans = m_translation_indices.size();
+  return SupercellSymOpRef(*m_supercell, m_factor_group_indices[i / n_trans],
+                           m_translation_indices[i % n_trans]);
+}
+
+SupercellSymOpRange::const_iterator SupercellSymOpRange::begin() const {
+  if (m_translation_indices.empty()) {
+    return end();
+  }
+  return const_iterator(*this, 0, 0);
+}
+
+SupercellSymOpRange::const_iterator SupercellSymOpRange::end() const {
+  return const_iterator(*this, m_factor_group_indices.size(), 0);
+}
+
+/// \brief Copy the operations into a vector
+std::vector<SupercellSymOp> SupercellSymOpRange::to_vector() const {
+  return std::vector<SupercellSymOp>(begin(), end());
+}
+
+/// \brief Return `group` as a SupercellSymOpRange, if it has the product
+///     structure (factor group operations) x (translations)
+///
+/// \param group A group of SupercellSymOp, all in the same supercell, such
+///     as the result of `make_invariant_subgroup`
+///
+/// \returns A SupercellSymOpRange with the same operations as `group`, with
+///     factor group and translation indices in the order they first occur
+///     in `group`, if every combination of a factor group index and a
+///     translation index that occur in `group` is in `group`; otherwise
+///     std::nullopt. The order of iteration may differ from the order in
+///     `group`.
+std::optional<SupercellSymOpRange> make_supercell_symop_range(
+    std::vector<SupercellSymOp> const &group) {
+  if (group.empty()) {
+    return std::nullopt;
+  }
+  std::shared_ptr<Supercell const> const &supercell = group[0].supercell();
+  std::vector<Index> fg_indices;
+  std::vector<Index> trans_indices;
+  std::set<Index> fg_found;
+  std::set<Index> trans_found;
+  std::set<std::pair<Index, Index>> ops;
+  for (SupercellSymOp const &op : group) {
+    if (op.supercell() != supercell) {
+      throw std::runtime_error(
+          "Error in make_supercell_symop_range: operations are not all in "
+          "the same supercell");
+    }
+    Index f = op.supercell_factor_group_index();
+    Index t = op.translation_index();
+    if (fg_found.insert(f).second) {
+      fg_indices.push_back(f);
+    }
+    if (trans_found.insert(t).second) {
+      trans_indices.push_back(t);
+    }
+    ops.emplace(f, t);
+  }
+  if (ops.size() != fg_indices.size() * trans_indices.size()) {
+    return std::nullopt;
+  }
+  return SupercellSymOpRange(supercell, fg_indices, trans_indices);
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,221 @@
+#include "casm/configuration/asymmetric_unit.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/InvariantSubgroupEngine.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/Coordinate.hh"
+#include "casm/crystallography/SymType.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+#include "casm/global/enum.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief Return the root of the set containing `i`, halving paths
+Index _find_root(std::vector<Index> &parent, Index i) {
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+}  // namespace
+
+/// \brief Return the asymmetric unit index of each site, for the orbits of
+///     sites under a group of supercell operations
+///
+/// Sites are joined with a union-find over the combined site permutation of
+/// each operation, so this takes `group.size() * n_sites` steps. Asymmetric
+/// units are numbered in order of their smallest linear site index.
+///
+/// \param group Supercell operations, which should form a group
+/// \param n_sites Number of sites in the supercell
+///
+/// \returns asymmetric_unit_index, where `asymmetric_unit_index[l]` is the
+///     index of the asymmetric unit containing the site with linear site
+///     index `l`.
+std::vector<Index> make_asymmetric_unit_index(
+    std::vector<SupercellSymOp> const &group, Index n_sites) {
+  std::vector<Index> parent(n_sites);
+  for (Index l = 0; l < n_sites; ++l) {
+    parent[l] = l;
+  }
+
+  SupercellSymOpWorkspace workspace;
+  for (auto const &op : group) {
+    auto const &perm = workspace.update_combined_permute(op);
+    if (perm.size() != n_sites) {
+      throw std::runtime_error(
+          "Error in make_asymmetric_unit_index: operation and n_sites are "
+          "not consistent");
+    }
+    for (Index l = 0; l < n_sites; ++l) {
+      // keep the smallest site index as root
+      Index a = _find_root(parent, l);
+      Index b = _find_root(parent, perm[l]);
+      if (a < b) {
+        parent[b] = a;
+      } else if (b < a) {
+        parent[a] = b;
+      }
+    }
+  }
+
+  std::vector<Index> asymmetric_unit_index(n_sites);
+  Index n_asymmetric_units = 0;
+  for (Index l = 0; l < n_sites; ++l) {
+    Index root = _find_root(parent, l);
+    if (root == l) {
+      asymmetric_unit_index[l] = n_asymmetric_units++;
+    } else {
+      asymmetric_unit_index[l] = asymmetric_unit_index[root];
+    }
+  }
+  return asymmetric_unit_index;
+}
+
+/// \brief Return the asymmetric unit index of each site, for the orbits of
+///     sites under the configuration invariant subgroup
+///
+/// \param configuration The configuration
+///
+/// \returns asymmetric_unit_index, as for
+///     `make_asymmetric_unit_index(group, n_sites)` with the invariant
+///     subgroup of `configuration`.
+std::vector<Index> make_asymmetric_unit_index(
+    Configuration const &configuration) {
+  auto const &supercell = configuration.supercell;
+  return make_asymmetric_unit_index(
+      InvariantSubgroupEngine(supercell).make_invariant_subgroup(
+          configuration),
+      supercell->unitcellcoord_index_converter.total_sites());
+}
+
+/// \brief Return the linear site indices of each asymmetric unit
+///
+/// \param asymmetric_unit_index The asymmetric unit index of each site, as
+///     from `make_asymmetric_unit_index`
+///
+/// \returns asymmetric_unit_indices, where `asymmetric_unit_indices[i]` are
+///     the linear site indices, sorted, of the sites in the `i`-th
+///     asymmetric unit.
+std::vector<std::vector<Index>> make_asymmetric_unit_indices(
+    std::vector<Index> const &asymmetric_unit_index) {
+  std::vector<std::vector<Index>> asymmetric_unit_indices;
+  for (Index l = 0; l < asymmetric_unit_index.size(); ++l) {
+    Index i = asymmetric_unit_index[l];
+    if (i < 0) {
+      throw std::runtime_error(
+          "Error in make_asymmetric_unit_indices: negative index");
+    }
+    if (i >= asymmetric_unit_indices.size()) {
+      asymmetric_unit_indices.resize(i + 1);
+    }
+    asymmetric_unit_indices[i].push_back(l);
+  }
+  return asymmetric_unit_indices;
+}
+
+/// \brief Return the linear site indices of each asymmetric unit of a
+///     configuration
+///
+/// \param configuration The configuration
+///
+/// \returns asymmetric_unit_indices, as for
+///     `make_asymmetric_unit_indices(make_asymmetric_unit_index(
+///     configuration))`.
+std::vector<std::vector<Index>> make_asymmetric_unit_indices(
+    Configuration const &configuration) {
+  return make_asymmetric_unit_indices(
+      make_asymmetric_unit_index(configuration));
+}
+
+/// \brief Reorder asymmetric units to be consistent with those of an
+///     equivalent reference configuration
+///
+/// The operation from `find_mapping_operation` maps the first site of each
+/// asymmetric unit of `configuration_init` to a site of
+/// `configuration_ref`, and the asymmetric unit is placed in the position
+/// of the reference asymmetric unit that contains that site.
+///
+/// \param initial The asymmetric unit indices for `configuration_init`
+/// \param configuration_init The configuration for which the `initial`
+///     asymmetric unit indices are given
+/// \param reference The asymmetric unit indices for `configuration_ref`
+/// \param configuration_ref The reference configuration for which the
+///     `reference` asymmetric unit indices are given
+///
+/// \returns final, the asymmetric units of `initial` ordered so that
+///     `final[i]` is equivalent to `reference[i]`, or std::nullopt if the
+///     configurations are not equivalent.
+std::optional<std::vector<std::vector<Index>>>
+make_consistent_asymmetric_unit_indices(
+    std::vector<std::vector<Index>> const &initial,
+    Configuration const &configuration_init,
+    std::vector<std::vector<Index>> const &reference,
+    Configuration const &configuration_ref) {
+  std::optional<SymOp> mapping_op =
+      find_mapping_operation(configuration_init, configuration_ref);
+  if (!mapping_op.has_value()) {
+    return std::nullopt;
+  }
+
+  Supercell const &supercell_init = *configuration_init.supercell;
+  Supercell const &supercell_ref = *configuration_ref.supercell;
+  xtal::BasicStructure const &prim = *supercell_init.prim->basicstructure;
+  double tol = prim.lattice().tol();
+  Index n_sites_ref = supercell_ref.unitcellcoord_index_converter.total_sites();
+
+  std::vector<Index> reference_index(n_sites_ref, -1);
+  for (Index i = 0; i < reference.size(); ++i) {
+    for (Index l : reference[i]) {
+      if (l < 0 || l >= n_sites_ref) {
+        throw std::runtime_error(
+            "Error in make_consistent_asymmetric_unit_indices: reference "
+            "site index out of range");
+      }
+      reference_index[l] = i;
+    }
+  }
+
+  if (initial.size() != reference.size()) {
+    throw std::runtime_error(
+        "Error in make_consistent_asymmetric_unit_indices: Failed making "
+        "consistent asymmetric unit indices.");
+  }
+  std::vector<std::vector<Index>> final(reference.size());
+  std::vector<bool> is_assigned(reference.size(), false);
+  Eigen::Matrix3Xd const &coordinate_cart =
+      supercell_init.site_coordinate_cart();
+  for (auto const &asym_unit : initial) {
+    if (asym_unit.empty()) {
+      throw std::runtime_error(
+          "Error in make_consistent_asymmetric_unit_indices: empty "
+          "asymmetric unit");
+    }
+    Eigen::Vector3d transformed_cart =
+        mapping_op->matrix * coordinate_cart.col(asym_unit[0]) +
+        mapping_op->translation;
+    xtal::UnitCellCoord transformed_site = xtal::UnitCellCoord::from_coordinate(
+        prim, xtal::Coordinate(transformed_cart, prim.lattice(), CART), tol);
+    Index i_final = reference_index[supercell_ref.unitcellcoord_index_converter(
+        transformed_site)];
+    if (i_final == -1 || is_assigned[i_final]) {
+      throw std::runtime_error(
+          "Error in make_consistent_asymmetric_unit_indices: Failed making "
+          "consistent asymmetric unit indices.");
+    }
+    final[i_final] = asym_unit;
+    is_assigned[i_final] = true;
+  }
+  return final;
+}
+
+}  // namespace config
+}  // namespace CASM
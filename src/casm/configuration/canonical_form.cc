@@ -1,6 +1,12 @@
 #include "casm/configuration/canonical_form.hh"
 
+#include "casm/configuration/SupercellSymOpRange.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/configuration/find_translations.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/configuration/supercell_name.hh"
 #include "casm/crystallography/CanonicalForm.hh"
+#include "casm/crystallography/Lattice.hh"
 #include "casm/crystallography/Niggli.hh"
 
 namespace CASM {
@@ -8,12 +14,10 @@ namespace config {
 
 /// \brief Return true if supercell lattice is right-handed lattice in
 ///     canonical form
+///
+/// Computed once per supercell; see `Supercell::is_canonical`.
 bool is_canonical(Supercell const &supercell) {
-  if (!supercell.superlattice.superlattice().is_right_handed()) {
-    return false;
-  }
-  return xtal::canonical::check(supercell.superlattice.superlattice(),
-                                supercell.prim->sym_info.point_group->element);
+  return supercell.is_canonical();
 }
 
 /// \brief Return a shared supercell with right-handed lattice that compares
@@ -24,57 +28,412 @@ bool is_canonical(Supercell const &supercell) {
 ///     canonical_supercell->superlattice.superlattice() >=
 ///         sym::copy_apply(op,
 ///         supercell.superlattice.superlattice()).make_right_handed()
+///
+/// Computed once per supercell; see `Supercell::canonical_supercell`.
 std::shared_ptr<Supercell const> make_canonical_form(
     Supercell const &supercell) {
-  Lattice superlattice = supercell.superlattice.superlattice();
+  return supercell.canonical_supercell();
+}
+
+namespace {  // anonymous
+
+/// \brief Integer matrices, R, of the prim point group operations in the
+///     basis of the prim lattice vectors
+///
+/// For prim lattice vectors L, as columns, `op.matrix * L == L * R`, so
+/// `sym::copy_apply(op, superlattice)` has lattice vectors `L * R * T`,
+/// where T is the transformation matrix of `superlattice`.
+std::vector<Eigen::Matrix3l> _make_integral_point_group(Prim const &prim) {
+  Lattice const &prim_lattice = prim.basicstructure->lattice();
+  Eigen::Matrix3d const &L = prim_lattice.lat_column_mat();
+  Eigen::Matrix3d L_inv = prim_lattice.inv_lat_column_mat();
+  std::vector<Eigen::Matrix3l> result;
+  for (SymOp const &op : prim.sym_info.point_group->element) {
+    Eigen::Matrix3d R = L_inv * op.matrix * L;
+    result.push_back(R.array().round().matrix().cast<long>());
+  }
+  return result;
+}
+
+/// \brief Put an equivalent superlattice into the canonical form with
+///     respect to its own invariant subgroup, as used by `make_equivalents`
+Lattice _make_equivalent_representation(Lattice superlattice,
+                                        std::vector<SymOp> const &point_group) {
   superlattice.make_right_handed();
-  Lattice canonical_superlattice = xtal::canonical::equivalent(
-      superlattice, supercell.prim->sym_info.point_group->element,
-      superlattice.tol());
-  return std::make_shared<Supercell const>(
-      supercell.prim, xtal::Superlattice(supercell.superlattice.prim_lattice(),
-                                         canonical_superlattice));
+  std::vector<SymOp> invariant_subgroup;
+  for (Index i : xtal::invariant_subgroup_indices(superlattice, point_group)) {
+    invariant_subgroup.push_back(point_group[i]);
+  }
+  return xtal::canonical::equivalent(superlattice, invariant_subgroup);
 }
 
+}  // namespace
+
 /// \brief Return the supercell with distinct symmetrically equivalent lattices
 ///
 /// The results, `equiv`, are the distinct supercell with lattices generated by
 /// `equiv = copy_apply(op, supercell.superlattice.lattice())` for `op` in
 /// ``supercell.prim->sym_info.point_group->element`.
+///
+/// The equivalent lattices are found by
+/// `make_equivalent_transformation_matrices`, and a Supercell is only
+/// constructed for each distinct result.
 std::vector<std::shared_ptr<Supercell const>> make_equivalents(
     Supercell const &supercell) {
-  std::set<Lattice> superlats;
-  std::shared_ptr<Prim const> prim = supercell.prim;
-  Lattice const &init_superlat = supercell.superlattice.superlattice();
-  std::vector<SymOp> const &point_group = prim->sym_info.point_group->element;
-
-  // function puts equivalent superlattice into canonical form
-  auto representation_prepare = [&](Lattice superlat) {
-    superlat.make_right_handed();
-    std::vector<Index> invariant_subgroup_indices =
-        xtal::invariant_subgroup_indices(superlat, point_group);
-    std::vector<SymOp> invariant_subgroup;
-    for (Index i : invariant_subgroup_indices) {
-      invariant_subgroup.push_back(point_group[i]);
-    }
-    return xtal::canonical::equivalent(superlat, invariant_subgroup);
-  };
+  std::vector<std::shared_ptr<Supercell const>> result;
+  for (Eigen::Matrix3l const &T : make_equivalent_transformation_matrices(
+           supercell.prim,
+           supercell.superlattice.transformation_matrix_to_super())) {
+    result.push_back(make_shared_supercell(supercell.prim, T));
+  }
+  return result;
+}
+
+/// \brief Return the supercells with distinct symmetrically equivalent
+///     lattices, for many supercells in parallel
+///
+/// \param supercells The supercells
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns `make_equivalents(*supercells[i])`, for each `i`. The result
+///     does not depend on `n_threads`.
+std::vector<std::vector<std::shared_ptr<Supercell const>>> make_equivalents(
+    std::vector<std::shared_ptr<Supercell const>> const &supercells,
+    Index n_threads) {
+  std::vector<std::vector<std::shared_ptr<Supercell const>>> result(
+      supercells.size());
+  parallel_for_items(supercells.size(), n_threads, [&](Index i) {
+    result[i] = make_equivalents(*throw_if_equal_to_nullptr(
+        supercells[i], "Error in make_equivalents: supercell is empty"));
+  });
+  return result;
+}
 
-  // generate different orientations of equivalent superlattices
-  for (auto const &op : point_group) {
-    superlats.emplace(
-        representation_prepare(sym::copy_apply(op, init_superlat)));
+/// \brief Return the transformation matrix of the canonical equivalent
+///     superlattice, without constructing a Supercell
+///
+/// \param prim The prim
+/// \param transformation_matrix_to_super The transformation matrix, T, of
+///     the superlattice, `S = L * T`
+///
+/// \returns The transformation matrix of the canonical equivalent
+///     superlattice, equal to `make_canonical_form(Supercell(prim, T))
+///     ->superlattice.transformation_matrix_to_super()`.
+Eigen::Matrix3l make_canonical_transformation_matrix(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  throw_if_equal_to_nullptr(
+      prim, "Error in make_canonical_transformation_matrix: prim is empty");
+  Lattice const &prim_lattice = prim->basicstructure->lattice();
+  auto const &point_group = prim->sym_info.point_group->element;
+  Lattice superlattice =
+      xtal::make_superlattice(prim_lattice, transformation_matrix_to_super);
+  if (superlattice.is_right_handed() &&
+      xtal::canonical::check(superlattice, point_group)) {
+    return transformation_matrix_to_super;
   }
+  superlattice.make_right_handed();
+  superlattice = xtal::canonical::equivalent(superlattice, point_group,
+                                             superlattice.tol());
+  return xtal::make_transformation_matrix_to_super(prim_lattice, superlattice,
+                                                   prim_lattice.tol());
+}
 
-  // make as shared Supercell
-  std::vector<std::shared_ptr<Supercell const>> result;
-  for (Lattice const &superlat : superlats) {
-    result.push_back(std::make_shared<Supercell const>(prim, superlat));
+/// \brief Return the transformation matrices of the canonical equivalent
+///     superlattices, for many superlattices in parallel
+///
+/// \param prim The prim
+/// \param transformation_matrices_to_super The transformation matrices of
+///     the superlattices
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns `make_canonical_transformation_matrix(prim, T)`, for each T.
+///     The result does not depend on `n_threads`.
+std::vector<Eigen::Matrix3l> make_canonical_transformation_matrices(
+    std::shared_ptr<Prim const> const &prim,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices_to_super,
+    Index n_threads) {
+  std::vector<Eigen::Matrix3l> result(transformation_matrices_to_super.size());
+  parallel_for_items(result.size(), n_threads, [&](Index i) {
+    result[i] = make_canonical_transformation_matrix(
+        prim, transformation_matrices_to_super[i]);
+  });
+  return result;
+}
+
+/// \brief Return the transformation matrices of the distinct symmetrically
+///     equivalent superlattices, without constructing Supercells
+///
+/// \param prim The prim
+/// \param transformation_matrix_to_super The transformation matrix, T, of
+///     the superlattice, `S = L * T`
+///
+/// \returns The transformation matrices of the supercells returned by
+///     `make_equivalents(Supercell(prim, T))`, in the same order.
+///
+/// The prim point group operations are applied to T as integer matrices,
+/// and results that generate the same superlattice are identified by their
+/// Hermite normal form, so the lattice operations used to choose the
+/// representation of each equivalent superlattice are only done once per
+/// distinct superlattice.
+std::vector<Eigen::Matrix3l> make_equivalent_transformation_matrices(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  throw_if_equal_to_nullptr(
+      prim, "Error in make_equivalent_transformation_matrices: prim is empty");
+  Lattice const &prim_lattice = prim->basicstructure->lattice();
+  auto const &point_group = prim->sym_info.point_group->element;
+
+  std::set<HermiteNormalFormKey> distinct;
+  std::set<Lattice> superlattices;
+  for (Eigen::Matrix3l const &R : _make_integral_point_group(*prim)) {
+    Eigen::Matrix3l T = R * transformation_matrix_to_super;
+    if (!distinct.insert(make_hermite_normal_form_key(T)).second) {
+      continue;
+    }
+    superlattices.emplace(_make_equivalent_representation(
+        xtal::make_superlattice(prim_lattice, T), point_group));
   }
 
+  std::vector<Eigen::Matrix3l> result;
+  for (Lattice const &superlattice : superlattices) {
+    result.push_back(xtal::make_transformation_matrix_to_super(
+        prim_lattice, superlattice, prim_lattice.tol()));
+  }
+  return result;
+}
+
+/// \brief Return the transformation matrices of the distinct symmetrically
+///     equivalent superlattices, for many superlattices in parallel
+///
+/// \param prim The prim
+/// \param transformation_matrices_to_super The transformation matrices of
+///     the superlattices
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns `make_equivalent_transformation_matrices(prim, T)`, for each T.
+///     The result does not depend on `n_threads`.
+std::vector<std::vector<Eigen::Matrix3l>>
+make_equivalent_transformation_matrices(
+    std::shared_ptr<Prim const> const &prim,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices_to_super,
+    Index n_threads) {
+  std::vector<std::vector<Eigen::Matrix3l>> result(
+      transformation_matrices_to_super.size());
+  parallel_for_items(result.size(), n_threads, [&](Index i) {
+    result[i] = make_equivalent_transformation_matrices(
+        prim, transformation_matrices_to_super[i]);
+  });
+  return result;
+}
+
+/// \brief Return the indices of the prim factor group operations that leave
+///     a superlattice invariant, without constructing a Supercell
+///
+/// \param prim The prim
+/// \param transformation_matrix_to_super The transformation matrix, T, of
+///     the superlattice, `S = L * T`
+///
+/// \returns The indices, equal to
+///     `Supercell(prim, T).sym_info.factor_group->head_group_index`, in
+///     increasing order.
+std::vector<Index> make_superlattice_invariant_factor_group_indices(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  throw_if_equal_to_nullptr(
+      prim,
+      "Error in make_superlattice_invariant_factor_group_indices: prim is "
+      "empty");
+  std::vector<Index> result = xtal::invariant_subgroup_indices(
+      xtal::make_superlattice(prim->basicstructure->lattice(),
+                              transformation_matrix_to_super),
+      prim->sym_info.factor_group->element);
+  std::sort(result.begin(), result.end());
   return result;
 }
 
+namespace {
+
+/// \brief Check that `range` is in the supercell of `configuration`, and
+///     return the translations of `range` as a range
+SupercellSymOpRange _translations(Configuration const &configuration,
+                                  SupercellSymOpRange const &range,
+                                  std::string const &method) {
+  if (range.supercell() != configuration.supercell) {
+    throw std::runtime_error("Error in " + method +
+                             ": range and configuration are not in the "
+                             "same supercell");
+  }
+  return SupercellSymOpRange(range.supercell(), {0},
+                             range.translation_indices());
+}
+
+/// \brief If only global DoF are compared, translations act trivially, so
+///     only the first translation of `range` needs to be compared
+SupercellSymOpRange _compared_translations(
+    SupercellSymOpRange const &translations, bool global_dof_only) {
+  if (!global_dof_only || translations.empty()) {
+    return translations;
+  }
+  return SupercellSymOpRange(translations.supercell(), {0},
+                             {translations.translation_indices().front()});
+}
+
+}  // namespace
+
+/// \brief Return true if configuration is in canonical form, applying each
+///     factor group operation of `range` once
+///
+/// Gives the same result as `is_canonical(configuration, range.begin(),
+/// range.end())`. For each factor group operation, `f`, in `range`, the
+/// transformed configuration `f * configuration` is made once, and then
+/// compared after each translation, which only permutes sites. If only
+/// global DoF are compared, only the first translation is compared.
+///
+/// \param configuration The configuration
+/// \param range The operations, in the supercell of `configuration`
+bool is_canonical(Configuration const &configuration,
+                  SupercellSymOpRange const &range) {
+  SupercellSymOpRange translations = _compared_translations(
+      _translations(configuration, range, "is_canonical"),
+      is_global_dof_only_comparison(configuration));
+  return visit_config_compare(configuration, [&](auto const &compare_f) {
+    SupercellSymOpApplier applier;
+    Configuration transformed(configuration);
+    for (Index f : range.factor_group_indices()) {
+      transformed = configuration;
+      applier.apply(SupercellSymOp(range.supercell(), f, 0), transformed);
+      for (SupercellSymOp const &translation : translations) {
+        // configuration < translation * (f * configuration)
+        if (compare_f(translation, transformed)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  });
+}
+
+/// \brief Return rep that makes a configuration canonical, applying each
+///     factor group operation of `range` once
+///
+/// Gives the same result as `to_canonical(configuration, range.begin(),
+/// range.end())`: the first operation in `range` that gives the canonical
+/// form. For each factor group operation, `f`, in `range`, the transformed
+/// configuration `f * configuration` is made once, and then compared after
+/// each translation, which only permutes sites. If only global DoF are
+/// compared, only the first translation is compared.
+///
+/// \param configuration The configuration
+/// \param range The operations, in the supercell of `configuration`. Must
+///     not be empty.
+SupercellSymOp to_canonical(Configuration const &configuration,
+                            SupercellSymOpRange const &range) {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(to_canonical);
+  CASM_CONFIGURATION_PERF_COUNT(canonicalization);
+  if (range.empty()) {
+    throw std::runtime_error("Error in to_canonical: range is empty");
+  }
+  SupercellSymOpRange translations = _compared_translations(
+      _translations(configuration, range, "to_canonical"),
+      is_global_dof_only_comparison(configuration));
+  return visit_config_compare(configuration, [&](auto const &compare_f) {
+    SupercellSymOpApplier applier;
+    Configuration transformed(configuration);
+    SupercellSymOp best = range[0];
+    for (Index f : range.factor_group_indices()) {
+      transformed = configuration;
+      applier.apply(SupercellSymOp(range.supercell(), f, 0), transformed);
+      for (SupercellSymOp const &translation : translations) {
+        // best * configuration < translation * (f * configuration)
+        if (compare_f(best, translation, transformed)) {
+          best = SupercellSymOp(range.supercell(), f,
+                                translation.translation_index());
+        }
+      }
+    }
+    return best;
+  });
+}
+
+/// \brief Return the canonical form of a configuration, applying each
+///     factor group operation of `range` once
+///
+/// Equal to `copy_apply(to_canonical(configuration, range), configuration)`.
+Configuration make_canonical_form(Configuration const &configuration,
+                                  SupercellSymOpRange const &range) {
+  return copy_apply(to_canonical(configuration, range), configuration);
+}
+
+/// \brief Return rep that leave configuration invariant, applying each
+///     factor group operation of `range` once
+///
+/// Gives the same result as `make_invariant_subgroup(configuration,
+/// range.begin(), range.end(), which_dofs)`. For each factor group
+/// operation, `f`, in `range`, the transformed configuration
+/// `f * configuration` is made once, and then compared after each
+/// translation, which only permutes sites. If occupation is compared, only
+/// the translations found by `find_occupation_translation_indices` to map
+/// the occupation of `f * configuration` onto that of `configuration` are
+/// compared. If only global DoF are compared, only the first translation is
+/// compared, and all translations are included if it is equivalent.
+///
+/// \param configuration The configuration
+/// \param range The operations, in the supercell of `configuration`
+/// \param which_dofs The DoF types to compare, as for `ConfigIsEquivalent`
+std::vector<SupercellSymOp> make_invariant_subgroup(
+    Configuration const &configuration, SupercellSymOpRange const &range,
+    std::set<std::string> which_dofs) {
+  SupercellSymOpRange translations =
+      _translations(configuration, range, "make_invariant_subgroup");
+  bool compare_occupation = which_dofs.count("all") || which_dofs.count("occ");
+  bool global_dof_only =
+      is_global_dof_only_comparison(configuration, which_dofs);
+  Index n_unitcells =
+      configuration.supercell->unitcell_index_converter.total_sites();
+  return visit_config_is_equivalent(
+      configuration,
+      [&](auto const &equal_to_f) {
+        std::vector<SupercellSymOp> subgroup;
+        SupercellSymOpApplier applier;
+        Configuration transformed(configuration);
+        std::vector<bool> is_candidate(n_unitcells, true);
+        for (Index f : range.factor_group_indices()) {
+          transformed = configuration;
+          applier.apply(SupercellSymOp(range.supercell(), f, 0), transformed);
+          if (global_dof_only) {
+            if (translations.empty() ||
+                !equal_to_f(*translations.begin(), transformed)) {
+              continue;
+            }
+            for (Index t : translations.translation_indices()) {
+              subgroup.emplace_back(range.supercell(), f, t);
+            }
+            continue;
+          }
+          if (compare_occupation) {
+            std::fill(is_candidate.begin(), is_candidate.end(), false);
+            for (Index t : find_occupation_translation_indices(
+                     transformed, configuration)) {
+              is_candidate[t] = true;
+            }
+          }
+          for (SupercellSymOp const &translation : translations) {
+            if (is_candidate[translation.translation_index()] &&
+                equal_to_f(translation, transformed)) {
+              subgroup.emplace_back(range.supercell(), f,
+                                    translation.translation_index());
+            }
+          }
+        }
+        return subgroup;
+      },
+      which_dofs);
+}
+
 /// \brief Return true if the operation does not mix given sites and other sites
 bool site_indices_are_invariant(SupercellSymOp const &op,
                                 std::set<Index> const &site_indices) {
@@ -88,5 +447,65 @@ bool site_indices_are_invariant(SupercellSymOp const &op,
   });
 }
 
+/// \brief Find a symmetry operation that maps a configuration to an
+///     equivalent reference configuration, which may be in a different
+///     supercell
+///
+/// Method:
+/// - Find the first prim factor group operation, `fg_op`, that maps the
+///   superlattice of `configuration` to a superlattice equivalent to that of
+///   `configuration_ref`. Any other such operation differs from it by an
+///   element of the supercell factor group, so no other operation needs to be
+///   checked.
+/// - Copy `fg_op * configuration` into the supercell of `configuration_ref`,
+///   giving `config_init`.
+/// - Find `to_init = to_canonical(config_init)` and
+///   `to_ref = to_canonical(configuration_ref)`. The configurations are
+///   equivalent if and only if their canonical forms are equal, and then
+///   `to_ref.inverse() * to_init` maps `config_init` to `configuration_ref`.
+///
+/// This makes two canonical form searches, rather than comparing every
+/// combination of prim factor group operation and SupercellSymOp.
+///
+/// \param configuration The configuration to map.
+/// \param configuration_ref The reference configuration to map to. Must
+///     have the same prim as `configuration`.
+///
+/// \returns The symmetry operation, `mapping_op`, that maps `configuration`
+///     to `configuration_ref`, as `rep.to_symop() * fg_op` for the
+///     SupercellSymOp `rep`, or std::nullopt if the configurations are not
+///     equivalent.
+std::optional<SymOp> find_mapping_operation(
+    Configuration const &configuration,
+    Configuration const &configuration_ref) {
+  auto const &supercell_ref = configuration_ref.supercell;
+  Lattice const &lattice = configuration.supercell->superlattice.superlattice();
+  Lattice const &lattice_ref = supercell_ref->superlattice.superlattice();
+  if (configuration.supercell->superlattice.size() !=
+      supercell_ref->superlattice.size()) {
+    return std::nullopt;
+  }
+
+  auto const &prim_fg = supercell_ref->prim->sym_info.factor_group->element;
+  auto res = xtal::is_equivalent_superlattice(
+      lattice_ref, lattice, prim_fg.begin(), prim_fg.end(), lattice_ref.tol());
+  if (res.first == prim_fg.end()) {
+    return std::nullopt;
+  }
+  Index prim_fg_index = std::distance(prim_fg.begin(), res.first);
+
+  Configuration config_init = copy_configuration(
+      prim_fg_index, UnitCell(0, 0, 0), configuration, supercell_ref);
+  SupercellSymOpRange range = SupercellSymOpRange::all(supercell_ref);
+  SupercellSymOp to_init = to_canonical(config_init, range);
+  SupercellSymOp to_ref = to_canonical(configuration_ref, range);
+  if (!(copy_apply(to_init, config_init) ==
+        copy_apply(to_ref, configuration_ref))) {
+    return std::nullopt;
+  }
+  SupercellSymOp rep = to_ref.inverse() * to_init;
+  return rep.to_symop() * prim_fg[prim_fg_index];
+}
+
 }  // namespace config
 }  // namespace CASM
@@ -1,5 +1,8 @@
 #include "casm/configuration/clusterography/ClusterInvariants.hh"
 
+#include <algorithm>
+#include <cmath>
+
 #include "casm/configuration/clusterography/IntegralCluster.hh"
 #include "casm/crystallography/BasicStructure.hh"
 #include "casm/crystallography/Coordinate.hh"
@@ -8,6 +11,128 @@
 namespace CASM {
 namespace clust {
 
+namespace {
+
+/// \brief Cartesian coordinates of sites, as separate x, y, z arrays
+struct SiteCart {
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+
+  void reserve(Index n) {
+    x.reserve(n);
+    y.reserve(n);
+    z.reserve(n);
+  }
+
+  Index size() const { return x.size(); }
+
+  /// \brief Append the Cartesian coordinate of a site
+  ///
+  /// Uses the prim lattice and basis directly, without constructing an
+  /// xtal::Coordinate.
+  void push_back(xtal::UnitCellCoord const &site,
+                 xtal::BasicStructure const &basicstructure) {
+    Eigen::Vector3d r =
+        basicstructure.lattice().lat_column_mat() *
+            site.unitcell().cast<double>() +
+        basicstructure.basis()[site.sublattice()].const_cart();
+    x.push_back(r(0));
+    y.push_back(r(1));
+    z.push_back(r(2));
+  }
+};
+
+SiteCart make_site_cart(IntegralCluster const &cluster,
+                        xtal::BasicStructure const &basicstructure) {
+  SiteCart cart;
+  cart.reserve(cluster.size());
+  for (auto const &site : cluster) {
+    cart.push_back(site, basicstructure);
+  }
+  return cart;
+}
+
+/// \brief Append the distances from (x0, y0, z0) to each of the first `n`
+///     sites in `cart`
+///
+/// The loop is over contiguous arrays with no branches, so that it can be
+/// vectorized.
+void append_distances(SiteCart const &cart, Index n, double x0, double y0,
+                      double z0, std::vector<double> &result) {
+  Index n_init = result.size();
+  result.resize(n_init + n);
+  double const *x = cart.x.data();
+  double const *y = cart.y.data();
+  double const *z = cart.z.data();
+  double *d = result.data() + n_init;
+  for (Index i = 0; i < n; ++i) {
+    double dx = x[i] - x0;
+    double dy = y[i] - y0;
+    double dz = z[i] - z0;
+    d[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+}
+
+/// \brief Append the distances between each pair of sites in `cart`
+void append_pair_distances(SiteCart const &cart,
+                           std::vector<double> &result) {
+  result.reserve(result.size() + cart.size() * (cart.size() - 1) / 2);
+  for (Index j = 1; j < cart.size(); ++j) {
+    append_distances(cart, j, cart.x[j], cart.y[j], cart.z[j], result);
+  }
+}
+
+/// \brief Append the distances between each site in `cart` and each site
+///     in `other`
+void append_cross_distances(SiteCart const &cart, SiteCart const &other,
+                            std::vector<double> &result) {
+  result.reserve(result.size() + cart.size() * other.size());
+  for (Index j = 0; j < other.size(); ++j) {
+    append_distances(cart, cart.size(), other.x[j], other.y[j], other.z[j],
+                     result);
+  }
+}
+
+/// \brief Merge sorted `values`, after sorting them, into sorted `result`
+void merge_sorted(std::vector<double> &result, std::vector<double> &values) {
+  std::sort(values.begin(), values.end());
+  Index n_init = result.size();
+  result.insert(result.end(), values.begin(), values.end());
+  std::inplace_merge(result.begin(), result.begin() + n_init, result.end());
+}
+
+/// \brief Compare sorted distances, from longest to shortest, returning
+///     -1, 0, or 1
+int compare_distances(std::vector<double> const &A,
+                      std::vector<double> const &B, double tol) {
+  for (Index i = Index(A.size()) - 1; i >= 0; i--) {
+    double a = A[i];
+    double b = B[i];
+    if (CASM::almost_equal(a, b, tol)) {
+      continue;
+    }
+    return a < b ? -1 : 1;
+  }
+  return 0;
+}
+
+/// \brief Compare ClusterInvariants, returning -1, 0, or 1
+int compare_invariants(ClusterInvariants const &A, ClusterInvariants const &B,
+                       double tol) {
+  if (A.size() != B.size()) {
+    return A.size() < B.size() ? -1 : 1;
+  }
+  int c = compare_distances(A.distances(), B.distances(), tol);
+  if (c != 0) {
+    return c;
+  }
+  return compare_distances(A.phenomenal_distances(), B.phenomenal_distances(),
+                           tol);
+}
+
+}  // namespace
+
 /// \brief Construct and calculate cluster invariants
 ClusterInvariants::ClusterInvariants(
     IntegralCluster const &cluster,
@@ -16,14 +141,8 @@ ClusterInvariants::ClusterInvariants(
   m_size = cluster.size();
 
   // calculate distances between points
-  for (int i = 0; i < m_size; i++) {
-    for (int j = i + 1; j < m_size; j++) {
-      m_distances.push_back((cluster[i].coordinate(basicstructure) -
-                             cluster[j].coordinate(basicstructure))
-                                .const_cart()
-                                .norm());
-    }
-  }
+  SiteCart cart = make_site_cart(cluster, basicstructure);
+  append_pair_distances(cart, m_distances);
   std::sort(m_distances.begin(), m_distances.end());
 }
 
@@ -36,28 +155,71 @@ ClusterInvariants::ClusterInvariants(
   m_size = cluster.size();
 
   // calculate distances between points
-  for (int i = 0; i < m_size; i++) {
-    for (int j = i + 1; j < m_size; j++) {
-      m_distances.push_back((cluster[i].coordinate(basicstructure) -
-                             cluster[j].coordinate(basicstructure))
-                                .const_cart()
-                                .norm());
-    }
-  }
+  SiteCart cart = make_site_cart(cluster, basicstructure);
+  append_pair_distances(cart, m_distances);
   std::sort(m_distances.begin(), m_distances.end());
 
   // calculate distances between points and phenom sites
-  for (int i = 0; i < cluster.size(); i++) {
-    for (int j = 0; j < phenomenal.size(); j++) {
-      m_phenom_distances.push_back((cluster[i].coordinate(basicstructure) -
-                                    phenomenal[j].coordinate(basicstructure))
-                                       .const_cart()
-                                       .norm());
-    }
-  }
+  SiteCart phenomenal_cart = make_site_cart(phenomenal, basicstructure);
+  append_cross_distances(cart, phenomenal_cart, m_phenom_distances);
   std::sort(m_phenom_distances.begin(), m_phenom_distances.end());
 }
 
+/// \brief Construct cluster invariants of a cluster extended by one site,
+///     from the invariants of the cluster
+///
+/// \param parent The invariants of `parent_cluster`, as constructed by
+///     `ClusterInvariants(parent_cluster, basicstructure)`
+/// \param parent_cluster The cluster being extended
+/// \param site The site added to the end of `parent_cluster`
+/// \param basicstructure The structure
+///
+/// The result is equal to `ClusterInvariants(cluster, basicstructure)`,
+/// where `cluster` is `parent_cluster` with `site` appended. Only the
+/// `parent_cluster.size()` distances to `site` are calculated; they are
+/// merged into the already sorted distances of `parent`.
+ClusterInvariants::ClusterInvariants(
+    ClusterInvariants const &parent, IntegralCluster const &parent_cluster,
+    xtal::UnitCellCoord const &site,
+    xtal::BasicStructure const &basicstructure)
+    : m_size(parent.size() + 1),
+      m_distances(parent.distances()),
+      m_phenom_distances(parent.phenomenal_distances()) {
+  SiteCart cart = make_site_cart(parent_cluster, basicstructure);
+  SiteCart site_cart;
+  site_cart.push_back(site, basicstructure);
+  std::vector<double> new_distances;
+  append_cross_distances(cart, site_cart, new_distances);
+  merge_sorted(m_distances, new_distances);
+}
+
+/// \brief Construct cluster invariants of a cluster extended by one site,
+///     from the invariants of the cluster, including phenomenal cluster
+///     sites
+///
+/// \param parent The invariants of `parent_cluster`, as constructed by
+///     `ClusterInvariants(parent_cluster, phenomenal, basicstructure)`
+/// \param parent_cluster The cluster being extended
+/// \param site The site added to the end of `parent_cluster`
+/// \param phenomenal The phenomenal cluster
+/// \param basicstructure The structure
+///
+/// The result is equal to
+/// `ClusterInvariants(cluster, phenomenal, basicstructure)`, where `cluster`
+/// is `parent_cluster` with `site` appended.
+ClusterInvariants::ClusterInvariants(
+    ClusterInvariants const &parent, IntegralCluster const &parent_cluster,
+    xtal::UnitCellCoord const &site, IntegralCluster const &phenomenal,
+    xtal::BasicStructure const &basicstructure)
+    : ClusterInvariants(parent, parent_cluster, site, basicstructure) {
+  SiteCart phenomenal_cart = make_site_cart(phenomenal, basicstructure);
+  SiteCart site_cart;
+  site_cart.push_back(site, basicstructure);
+  std::vector<double> new_distances;
+  append_cross_distances(phenomenal_cart, site_cart, new_distances);
+  merge_sorted(m_phenom_distances, new_distances);
+}
+
 /// \brief Number of elements in the cluster
 int ClusterInvariants::size() const { return m_size; }
 
@@ -100,51 +262,14 @@ bool almost_equal(ClusterInvariants const &A, ClusterInvariants const &B,
 /// shortest
 bool compare(ClusterInvariants const &A, ClusterInvariants const &B,
              double tol) {
-  // first sort by number of sites in cluster
-  if (A.size() < B.size()) {
-    return true;
-  }
-  if (A.size() > B.size()) {
-    return false;
-  }
-
-  // all cluster distances
-  for (int i = A.distances().size() - 1; i >= 0; i--) {
-    if (CASM::almost_equal(A.distances()[i], B.distances()[i], tol)) {
-      continue;
-    }
-    if (A.distances()[i] < B.distances()[i]) {
-      return true;
-    }
-    if (A.distances()[i] > B.distances()[i]) {
-      return false;
-    }
-  }
-
-  // all cluster-phenom distances
-  for (int i = A.phenomenal_distances().size() - 1; i >= 0; i--) {
-    if (CASM::almost_equal(A.phenomenal_distances()[i],
-                           B.phenomenal_distances()[i], tol)) {
-      continue;
-    }
-    if (A.phenomenal_distances()[i] < B.phenomenal_distances()[i]) {
-      return true;
-    }
-    if (A.phenomenal_distances()[i] > B.phenomenal_distances()[i]) {
-      return false;
-    }
-  }
-
-  return false;
+  return compare_invariants(A, B, tol) < 0;
 }
 
 bool CompareCluster_f::operator()(pair_type const &A,
                                   pair_type const &B) const {
-  if (compare(A.first, B.first, xtal_tol)) {
-    return true;
-  }
-  if (compare(B.first, A.first, xtal_tol)) {
-    return false;
+  int c = compare_invariants(A.first, B.first, xtal_tol);
+  if (c != 0) {
+    return c < 0;
   }
   return A.second < B.second;
 }
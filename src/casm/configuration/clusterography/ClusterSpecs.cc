@@ -1,141 +1,17 @@
 #include "casm/configuration/clusterography/ClusterSpecs.hh"
 
+#include <algorithm>
+
 #include "casm/configuration/clusterography/ClusterInvariants.hh"
 #include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/PrimNeighborIndex.hh"
 #include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
-#include "casm/container/Counter.hh"
 #include "casm/crystallography/BasicStructure.hh"
+#include "casm/misc/algorithm.hh"
 
 namespace CASM {
 namespace clust {
 
-namespace {
-
-/// \brief Output the neighborhood of UnitCellCoord within max_radius of any
-/// site in unit cell
-///
-/// \param unit The unit cell xtal::BasicStructure
-/// \param max_radius The neighborhood distance cutoff
-/// \param site_filter A filter function that returns true for CoordType that
-///        should be considered for the neighborhood
-/// \param result Output iterator for container of UnitCellCoord
-/// \param xtal_tol Crystallography tolerance used to contstruct UnitCellCoord
-/// from CoordType
-///
-/// \returns Output iterator after generating the neighborhood
-///
-/// \ingroup IntegralCluster
-///
-template <typename OutputIterator>
-OutputIterator neighborhood(xtal::BasicStructure const &unit, double max_radius,
-                            SiteFilterFunction site_filter,
-                            OutputIterator result, double xtal_tol) {
-  auto dim = unit.lattice().enclose_sphere(max_radius);
-  EigenCounter<Eigen::Vector3i> grid_count(-dim, dim,
-                                           Eigen::Vector3i::Constant(1));
-  xtal::Coordinate lat_point(unit.lattice());
-  const auto &basis = unit.basis();
-
-  do {
-    lat_point.frac() = grid_count().cast<double>();
-
-    for (auto it = basis.begin(); it != basis.end(); ++it) {
-      if (!site_filter(*it)) {
-        continue;
-      }
-
-      xtal::Coordinate test(*it + lat_point);
-      auto within_radius = [&](const xtal::Coordinate &coord) {
-        return test.dist(coord) < max_radius;
-      };
-      if (std::any_of(basis.begin(), basis.end(), within_radius)) {
-        *result++ = xtal::UnitCellCoord::from_coordinate(unit, test, xtal_tol);
-      }
-    }
-  } while (++grid_count);
-  return result;
-}
-
-/// \brief Output the neighborhood of sites within cutoff_radius of any sites in
-/// the phenomenal
-///
-/// \param prim xtal::BasicStructure
-/// \param phenomenal IntegralCluster
-/// \param cutoff_radius The neighborhood distance cutoff
-/// \param site_filter A filter function that returns true for UnitCellCoord
-/// that
-///        should be considered for the neighborhood
-/// \param result Output iterator for container of UnitCellCoord
-/// \param xtal_tol Crystallography tolerance used to contstruct UnitCellCoord
-///
-/// \returns Output iterator after generating the neighborhood
-///
-/// \ingroup IntegralCluster
-///
-template <typename OutputIterator>
-OutputIterator neighborhood(xtal::BasicStructure const &prim,
-                            IntegralCluster const &phenomenal,
-                            double cutoff_radius,
-                            SiteFilterFunction site_filter,
-                            bool include_phenomenal_sites,
-                            OutputIterator result, double xtal_tol) {
-  int max_low_shift = 0;
-  int max_high_shift = 0;
-  for (auto it = phenomenal.begin(); it != phenomenal.end(); it++) {
-    Eigen::Vector3l vec = it->unitcell();
-    if (vec.maxCoeff() > max_high_shift) {
-      max_high_shift = vec.maxCoeff();
-    }
-    if (vec.minCoeff() < max_low_shift) {
-      max_low_shift = vec.minCoeff();
-    }
-  }
-
-  // make grid counter
-  auto dim = prim.lattice().enclose_sphere(cutoff_radius);
-  Eigen::Vector3i ones(1, 1, 1);
-  EigenCounter<Eigen::Vector3i> grid_count(
-      -dim + (max_low_shift * ones).cast<int>(),
-      dim + (max_high_shift * ones).cast<int>(), Eigen::Vector3i::Constant(1));
-
-  /// lattice scaling
-  xtal::Coordinate lat_point(prim.lattice());
-
-  const auto &basis = prim.basis();
-
-  do {
-    lat_point.frac() = grid_count().cast<double>();
-
-    for (auto it = basis.begin(); it != basis.end(); ++it) {
-      if (!site_filter(*it)) {
-        continue;
-      }
-
-      xtal::Coordinate test{*it + lat_point};
-
-      if (!include_phenomenal_sites) {
-        auto is_almost_equal = [&](const xtal::UnitCellCoord &uccoord) {
-          return test.dist(uccoord.coordinate(prim)) < xtal_tol;
-        };
-        if (std::any_of(phenomenal.begin(), phenomenal.end(),
-                        is_almost_equal)) {
-          continue;
-        }
-      }
-
-      auto within_radius = [&](const xtal::UnitCellCoord &uccoord) {
-        return test.dist(uccoord.coordinate(prim)) < cutoff_radius;
-      };
-      if (std::any_of(phenomenal.begin(), phenomenal.end(), within_radius)) {
-        *result++ = xtal::UnitCellCoord::from_coordinate(prim, test, xtal_tol);
-      }
-    }
-  } while (++grid_count);
-  return result;
-}
-
-}  // namespace
-
 /// \brief Default constructor
 ///
 /// Notes:
@@ -215,9 +91,10 @@ class OriginNeighborhood {
  public:
   std::vector<xtal::UnitCellCoord> operator()(xtal::BasicStructure const &prim,
                                               SiteFilterFunction site_filter) {
+    SiteFilterMask site_filter_mask = make_site_filter_mask(prim, site_filter);
     std::vector<xtal::UnitCellCoord> result;
     for (int i = 0; i < prim.basis().size(); ++i) {
-      if (site_filter(prim.basis()[i])) {
+      if (site_filter_mask[i]) {
         result.emplace_back(i, 0, 0, 0);
       }
     }
@@ -231,11 +108,12 @@ class MaxLengthNeighborhood {
 
   std::vector<xtal::UnitCellCoord> operator()(xtal::BasicStructure const &prim,
                                               SiteFilterFunction site_filter) {
-    std::vector<xtal::UnitCellCoord> result;
-    double xtal_tol = prim.lattice().tol();
-    neighborhood(prim, max_length, site_filter, std::back_inserter(result),
-                 xtal_tol);
-    return result;
+    std::vector<xtal::UnitCellCoord> origin_sites;
+    for (Index b = 0; b < prim.basis().size(); ++b) {
+      origin_sites.emplace_back(b, 0, 0, 0);
+    }
+    PrimNeighborIndex neighbor_index(prim, max_length, site_filter);
+    return neighbor_index.sites_within_any(origin_sites, max_length);
   }
 
  private:
@@ -255,12 +133,10 @@ class CutoffRadiusNeighborhood {
 
   std::vector<xtal::UnitCellCoord> operator()(xtal::BasicStructure const &prim,
                                               SiteFilterFunction site_filter) {
-    std::vector<xtal::UnitCellCoord> result;
-    double xtal_tol = prim.lattice().tol();
-    neighborhood(prim, phenomenal, cutoff_radius, site_filter,
-                 include_phenomenal_sites, std::back_inserter(result),
-                 xtal_tol);
-    return result;
+    PrimNeighborIndex neighbor_index(prim, cutoff_radius, site_filter);
+    return make_cutoff_radius_neighborhood(neighbor_index, phenomenal,
+                                           cutoff_radius,
+                                           include_phenomenal_sites);
   }
 
  private:
@@ -271,6 +147,33 @@ class CutoffRadiusNeighborhood {
 
 }  // namespace ClusterSpecs_impl
 
+/// \brief Sites within cutoff_radius distance to any site in the phenomenal
+///     cluster, using an existing PrimNeighborIndex
+///
+/// \param neighbor_index A PrimNeighborIndex, with
+///     `max_radius() >= cutoff_radius`
+/// \param phenomenal The phenomenal cluster
+/// \param cutoff_radius The neighborhood distance cutoff
+/// \param include_phenomenal_sites If false, exclude the sites of the
+///     phenomenal cluster
+///
+/// \returns The sites, as given by `cutoff_radius_neighborhood`, sorted
+std::vector<xtal::UnitCellCoord> make_cutoff_radius_neighborhood(
+    PrimNeighborIndex const &neighbor_index, IntegralCluster const &phenomenal,
+    double cutoff_radius, bool include_phenomenal_sites) {
+  std::vector<xtal::UnitCellCoord> result =
+      neighbor_index.sites_within_any(phenomenal, cutoff_radius);
+  if (!include_phenomenal_sites) {
+    auto is_phenomenal_site = [&](xtal::UnitCellCoord const &site) {
+      return CASM::contains(phenomenal.elements(), site);
+    };
+    result.erase(
+        std::remove_if(result.begin(), result.end(), is_phenomenal_site),
+        result.end());
+  }
+  return result;
+}
+
 /// \brief Generate clusters using all Site
 bool all_sites_filter(xtal::Site const &site) { return true; }
 
@@ -288,6 +191,21 @@ SiteFilterFunction dof_sites_filter(std::vector<DoFKey> const &dofs) {
   return ClusterSpecs_impl::DoFSitesFilter{dofs};
 }
 
+/// \brief Evaluate a site filter once for each prim sublattice
+///
+/// \param prim The prim
+/// \param site_filter A site filter function
+///
+/// \returns The mask, with `mask[b] == site_filter(prim.basis()[b])`
+SiteFilterMask make_site_filter_mask(xtal::BasicStructure const &prim,
+                                     SiteFilterFunction const &site_filter) {
+  SiteFilterMask mask;
+  for (auto const &site : prim.basis()) {
+    mask.push_back(site_filter(site));
+  }
+  return mask;
+}
+
 /// Accept all clusters
 ClusterFilterFunction all_clusters_filter() {
   return ClusterSpecs_impl::AllClusters{};
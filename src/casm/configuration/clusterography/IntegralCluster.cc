@@ -17,15 +17,15 @@ IntegralCluster::IntegralCluster(
     : m_element(elements) {}
 
 IntegralCluster::IntegralCluster(std::vector<xtal::UnitCellCoord> &&elements)
-    : m_element(std::move(elements)) {}
+    : m_element(elements.begin(), elements.end()) {}
 
 /// \brief Access vector of elements
-std::vector<xtal::UnitCellCoord> &IntegralCluster::elements() {
+IntegralCluster::ElementContainer &IntegralCluster::elements() {
   return m_element;
 }
 
 /// \brief const Access vector of elements
-const std::vector<xtal::UnitCellCoord> &IntegralCluster::elements() const {
+const IntegralCluster::ElementContainer &IntegralCluster::elements() const {
   return m_element;
 }
 
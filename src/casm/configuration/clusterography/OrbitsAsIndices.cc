@@ -0,0 +1,216 @@
+#include "casm/configuration/clusterography/OrbitsAsIndices.hh"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+
+namespace CASM {
+namespace clust {
+
+namespace {
+
+/// \brief Compare clusters, stored in `sites`, lexicographically
+struct FlatClusterLess {
+  std::vector<Index> const &sites;
+
+  bool operator()(std::pair<Index, Index> const &A,
+                  std::pair<Index, Index> const &B) const {
+    return std::lexicographical_compare(
+        sites.begin() + A.first, sites.begin() + A.second,
+        sites.begin() + B.first, sites.begin() + B.second);
+  }
+};
+
+/// \brief Add one orbit, given the site index ranges of its clusters in
+///     `cluster_sites`, to `result`
+///
+/// Clusters are sorted and duplicates are removed, as for
+/// `std::set<std::set<Index>>`.
+void push_back_orbit(OrbitsAsIndices &result,
+                     std::vector<Index> const &cluster_sites,
+                     std::vector<std::pair<Index, Index>> &ranges) {
+  FlatClusterLess less{cluster_sites};
+  std::sort(ranges.begin(), ranges.end(), less);
+  auto equal = [&](std::pair<Index, Index> const &A,
+                   std::pair<Index, Index> const &B) {
+    return !less(A, B) && !less(B, A);
+  };
+  ranges.erase(std::unique(ranges.begin(), ranges.end(), equal),
+               ranges.end());
+  for (auto const &range : ranges) {
+    result.sites.insert(result.sites.end(),
+                        cluster_sites.begin() + range.first,
+                        cluster_sites.begin() + range.second);
+    result.cluster_offset.push_back(result.sites.size());
+  }
+  result.orbit_offset.push_back(result.cluster_offset.size() - 1);
+}
+
+}  // namespace
+
+/// \brief Convert orbits of IntegralCluster to flat orbits of linear site
+///     indices in a supercell
+///
+/// \param orbits Cluster orbits
+/// \param converter A UnitCellCoordIndexConverter for the supercell in
+///     which linear site indices will be generated
+///
+/// \returns The same orbits, clusters, and sites, in the same order, as
+///     `make_orbits_as_indices(orbits, converter)`, stored as an
+///     OrbitsAsIndices.
+OrbitsAsIndices make_flat_orbits_as_indices(
+    std::vector<std::set<IntegralCluster>> const &orbits,
+    xtal::UnitCellCoordIndexConverter const &converter) {
+  OrbitsAsIndices result;
+  std::vector<Index> cluster_sites;
+  std::vector<std::pair<Index, Index>> ranges;
+  for (auto const &orbit : orbits) {
+    cluster_sites.clear();
+    ranges.clear();
+    for (auto const &cluster : orbit) {
+      Index begin = cluster_sites.size();
+      for (auto const &site : cluster) {
+        cluster_sites.push_back(converter(site));
+      }
+      std::sort(cluster_sites.begin() + begin, cluster_sites.end());
+      cluster_sites.erase(
+          std::unique(cluster_sites.begin() + begin, cluster_sites.end()),
+          cluster_sites.end());
+      ranges.emplace_back(begin, cluster_sites.size());
+    }
+    push_back_orbit(result, cluster_sites, ranges);
+  }
+  return result;
+}
+
+/// \brief Convert orbits of linear site indices to the flat representation
+OrbitsAsIndices make_flat_orbits_as_indices(
+    std::vector<std::set<std::set<Index>>> const &orbits_as_indices) {
+  OrbitsAsIndices result;
+  for (auto const &orbit : orbits_as_indices) {
+    for (auto const &cluster : orbit) {
+      result.sites.insert(result.sites.end(), cluster.begin(), cluster.end());
+      result.cluster_offset.push_back(result.sites.size());
+    }
+    result.orbit_offset.push_back(result.cluster_offset.size() - 1);
+  }
+  return result;
+}
+
+/// \brief Convert local-cluster orbits to flat tables of linear site
+///     indices for every translation of every equivalent phenomenal cluster
+///     in a supercell
+///
+/// \param local_orbits Local-cluster orbits around the prototype phenomenal
+///     cluster, as generated by `make_local_orbits`
+/// \param unitcellcoord_symgroup_rep Prim factor group, as
+///     xtal::UnitCellCoordRep
+/// \param equivalent_generating_op_indices,
+///     phenomenal_generating_translations The prim factor group index and
+///     lattice translation that generate each equivalent phenomenal
+///     cluster from the prototype, as for `make_phenomenal_occevent`
+/// \param site_converter, unitcell_converter Index converters of the
+///     supercell in which linear site indices are generated
+/// \param n_threads Number of threads. If <= 0, use the hardware
+///     concurrency.
+///
+/// \returns The clusters of `make_equivalent_local_orbits(local_orbits,
+///     op_e, translation_e)` around each equivalent, with each translation
+///     in the supercell, as linear site indices stored as described for
+///     LocalOrbitsAsIndices. Each cluster is transformed once per
+///     equivalent, and rows are filled in parallel.
+LocalOrbitsAsIndices make_flat_local_orbits_as_indices(
+    std::vector<std::set<IntegralCluster>> const &local_orbits,
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    std::vector<Index> const &equivalent_generating_op_indices,
+    std::vector<xtal::UnitCell> const &phenomenal_generating_translations,
+    xtal::UnitCellCoordIndexConverter const &site_converter,
+    xtal::UnitCellIndexConverter const &unitcell_converter, Index n_threads) {
+  if (equivalent_generating_op_indices.size() !=
+      phenomenal_generating_translations.size()) {
+    throw std::runtime_error(
+        "Error in make_flat_local_orbits_as_indices: size mismatch between "
+        "equivalent_generating_op_indices and "
+        "phenomenal_generating_translations");
+  }
+  if (site_converter.total_sites() > std::numeric_limits<std::int32_t>::max()) {
+    throw std::runtime_error(
+        "Error in make_flat_local_orbits_as_indices: too many supercell "
+        "sites for int32 site indices");
+  }
+
+  LocalOrbitsAsIndices table;
+  table.n_equivalents = equivalent_generating_op_indices.size();
+  table.n_translations = unitcell_converter.total_sites();
+  for (auto const &orbit : local_orbits) {
+    for (auto const &cluster : orbit) {
+      table.cluster_offset.push_back(table.cluster_offset.back() +
+                                     cluster.size());
+    }
+    table.orbit_offset.push_back(table.cluster_offset.size() - 1);
+  }
+
+  // sites around each equivalent, in the origin unit cell
+  Index n_cluster_sites = table.n_cluster_sites();
+  std::vector<std::vector<xtal::UnitCellCoord>> equivalent_sites(
+      table.n_equivalents);
+  config::parallel_for_chunks(
+      table.n_equivalents, n_threads, [&](Index begin, Index end) {
+        for (Index e = begin; e < end; ++e) {
+          Index fg_index = equivalent_generating_op_indices[e];
+          auto const &op = unitcellcoord_symgroup_rep.at(fg_index);
+          auto const &translation = phenomenal_generating_translations[e];
+          auto &sites = equivalent_sites[e];
+          sites.reserve(n_cluster_sites);
+          for (auto const &orbit : local_orbits) {
+            for (auto const &cluster : orbit) {
+              IntegralCluster equiv =
+                  local_integral_cluster_copy_apply(op, cluster);
+              equiv += translation;
+              sites.insert(sites.end(), equiv.begin(), equiv.end());
+            }
+          }
+        }
+      });
+
+  Index n_translations = table.n_translations;
+  table.sites.resize(table.n_equivalents * n_translations * n_cluster_sites);
+  config::parallel_for_chunks(
+      table.n_equivalents * n_translations, n_threads,
+      [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          auto const &sites = equivalent_sites[i / n_translations];
+          xtal::UnitCell translation = unitcell_converter(i % n_translations);
+          std::int32_t *row = table.sites.data() + i * n_cluster_sites;
+          for (Index s = 0; s < n_cluster_sites; ++s) {
+            row[s] = site_converter(sites[s] + translation);
+          }
+        }
+      });
+  return table;
+}
+
+/// \brief Convert flat orbits of linear site indices to nested sets
+std::vector<std::set<std::set<Index>>> make_nested_orbits_as_indices(
+    OrbitsAsIndices const &orbits_as_indices) {
+  std::vector<std::set<std::set<Index>>> result;
+  for (Index i = 0; i < orbits_as_indices.n_orbits(); ++i) {
+    std::set<std::set<Index>> orbit;
+    for (Index j = orbits_as_indices.orbit_offset[i];
+         j < orbits_as_indices.orbit_offset[i + 1]; ++j) {
+      orbit.emplace(orbits_as_indices.cluster_begin(j),
+                    orbits_as_indices.cluster_end(j));
+    }
+    result.push_back(std::move(orbit));
+  }
+  return result;
+}
+
+}  // namespace clust
+}  // namespace CASM
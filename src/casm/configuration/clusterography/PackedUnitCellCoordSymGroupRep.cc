@@ -0,0 +1,331 @@
+#include "casm/configuration/clusterography/PackedUnitCellCoordSymGroupRep.hh"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+
+namespace CASM {
+namespace clust {
+
+namespace {
+
+/// \brief One site, ordered as xtal::UnitCellCoord
+struct _Site {
+  std::int32_t i;
+  std::int32_t j;
+  std::int32_t k;
+  std::int32_t b;
+};
+
+inline bool _less(_Site const &A, _Site const &B) {
+  if (A.i != B.i) {
+    return A.i < B.i;
+  }
+  if (A.j != B.j) {
+    return A.j < B.j;
+  }
+  if (A.k != B.k) {
+    return A.k < B.k;
+  }
+  return A.b < B.b;
+}
+
+inline void _compare_exchange(_Site *sites, int x, int y) {
+  if (_less(sites[y], sites[x])) {
+    std::swap(sites[x], sites[y]);
+  }
+}
+
+/// \brief Sorting networks, as pairs of positions to compare and exchange,
+///     for 2 to 6 elements
+constexpr int _network_2[][2] = {{0, 1}};
+constexpr int _network_3[][2] = {{0, 1}, {0, 2}, {1, 2}};
+constexpr int _network_4[][2] = {{0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2}};
+constexpr int _network_5[][2] = {{0, 1}, {3, 4}, {2, 4}, {2, 3}, {0, 3},
+                                 {0, 2}, {1, 4}, {1, 3}, {1, 2}};
+constexpr int _network_6[][2] = {{1, 2}, {4, 5}, {0, 2}, {3, 5},
+                                 {0, 1}, {3, 4}, {2, 5}, {0, 3},
+                                 {1, 4}, {2, 4}, {1, 3}, {2, 3}};
+
+template <std::size_t N>
+inline void _apply_network(_Site *sites, int const (&network)[N][2]) {
+  for (std::size_t c = 0; c < N; ++c) {
+    _compare_exchange(sites, network[c][0], network[c][1]);
+  }
+}
+
+/// \brief Sort sites, using a sorting network for up to 6 sites
+void _sort_sites(_Site *sites, Index n) {
+  switch (n) {
+    case 0:
+    case 1:
+      return;
+    case 2:
+      _apply_network(sites, _network_2);
+      return;
+    case 3:
+      _apply_network(sites, _network_3);
+      return;
+    case 4:
+      _apply_network(sites, _network_4);
+      return;
+    case 5:
+      _apply_network(sites, _network_5);
+      return;
+    case 6:
+      _apply_network(sites, _network_6);
+      return;
+    default:
+      std::sort(sites, sites + n, _less);
+  }
+}
+
+std::int32_t _to_int32(long value) {
+  // leave room for products and sums of transformed coordinates
+  long const max_value = std::numeric_limits<std::int32_t>::max() / 16;
+  if (value > max_value || value < -max_value) {
+    throw std::runtime_error(
+        "Error in PackedUnitCellCoordSymGroupRep: coordinate out of range");
+  }
+  return static_cast<std::int32_t>(value);
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param unitcellcoord_symgroup_rep Symmetry group representation (as
+///     xtal::UnitCellCoordRep). All operations must have the same number of
+///     sublattices.
+PackedUnitCellCoordSymGroupRep::PackedUnitCellCoordSymGroupRep(
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep)
+    : m_n_ops(unitcellcoord_symgroup_rep.size()), m_n_sublat(0) {
+  if (m_n_ops == 0) {
+    throw std::runtime_error(
+        "Error in PackedUnitCellCoordSymGroupRep: no operations");
+  }
+  m_n_sublat = unitcellcoord_symgroup_rep[0].sublattice_index.size();
+  m_point_matrix.reserve(m_n_ops * 9);
+  m_sublattice_index.reserve(m_n_ops * m_n_sublat);
+  m_unitcell_indices.reserve(m_n_ops * m_n_sublat * 3);
+  for (auto const &rep : unitcellcoord_symgroup_rep) {
+    if (Index(rep.sublattice_index.size()) != m_n_sublat ||
+        Index(rep.unitcell_indices.size()) != m_n_sublat) {
+      throw std::runtime_error(
+          "Error in PackedUnitCellCoordSymGroupRep: inconsistent number of "
+          "sublattices");
+    }
+    for (Index r = 0; r < 3; ++r) {
+      for (Index c = 0; c < 3; ++c) {
+        m_point_matrix.push_back(_to_int32(rep.point_matrix(r, c)));
+      }
+    }
+    for (Index b = 0; b < m_n_sublat; ++b) {
+      m_sublattice_index.push_back(_to_int32(rep.sublattice_index[b]));
+      for (Index x = 0; x < 3; ++x) {
+        m_unitcell_indices.push_back(_to_int32(rep.unitcell_indices[b](x)));
+      }
+    }
+  }
+}
+
+/// \brief Write the images of a cluster under all operations, sorted and
+///     translated so the first site is in the origin unit cell
+///
+/// Image `m` is equal to
+/// `prim_periodic_integral_cluster_copy_apply(rep[m], cluster)`.
+void PackedUnitCellCoordSymGroupRep::make_prim_periodic_images(
+    IntegralCluster const &cluster, PackedClusterImages &images) const {
+  _make_images(cluster, true, images);
+}
+
+/// \brief Write the images of a cluster under all operations, sorted
+///
+/// Image `m` is equal to `local_integral_cluster_copy_apply(rep[m], cluster)`.
+void PackedUnitCellCoordSymGroupRep::make_local_images(
+    IntegralCluster const &cluster, PackedClusterImages &images) const {
+  _make_images(cluster, false, images);
+}
+
+/// \brief Return the greatest prim periodic image of a cluster
+///
+/// Equal to `make_canonical_element` with
+/// `prim_periodic_integral_cluster_apply` and `std::less<IntegralCluster>`.
+/// Thread-safe; image storage is reused per thread.
+IntegralCluster
+PackedUnitCellCoordSymGroupRep::make_prim_periodic_canonical_element(
+    IntegralCluster const &cluster) const {
+  thread_local PackedClusterImages images;
+  _make_images(cluster, true, images);
+  return make_cluster(images, _find_greatest(images));
+}
+
+/// \brief Return the greatest local image of a cluster
+///
+/// Equal to `make_canonical_element` with `local_integral_cluster_apply` and
+/// `std::less<IntegralCluster>`. Thread-safe; image storage is reused per
+/// thread.
+IntegralCluster PackedUnitCellCoordSymGroupRep::make_local_canonical_element(
+    IntegralCluster const &cluster) const {
+  thread_local PackedClusterImages images;
+  _make_images(cluster, false, images);
+  return make_cluster(images, _find_greatest(images));
+}
+
+/// \brief Make the equivalence map of a prim periodic orbit
+///
+/// \param orbit An orbit generated by these operations, as by
+///     `make_prim_periodic_orbit`
+///
+/// \returns The same as `group::make_equivalence_map` with
+///     `prim_periodic_integral_cluster_copy_apply`: `equivalence_map[i]` are
+///     the indices of the operations that map the first element of `orbit`
+///     onto the i-th element.
+std::vector<std::vector<Index>>
+PackedUnitCellCoordSymGroupRep::make_prim_periodic_equivalence_map(
+    std::set<IntegralCluster> const &orbit) const {
+  if (orbit.empty()) {
+    return {};
+  }
+  PackedClusterImages images;
+  _make_images(*orbit.begin(), true, images);
+  return _make_equivalence_map(orbit, images);
+}
+
+/// \brief Make the equivalence map of a local orbit
+///
+/// \param orbit An orbit generated by these operations, as by
+///     `make_local_orbit`
+///
+/// \returns The same as `group::make_equivalence_map` with
+///     `local_integral_cluster_copy_apply`.
+std::vector<std::vector<Index>>
+PackedUnitCellCoordSymGroupRep::make_local_equivalence_map(
+    std::set<IntegralCluster> const &orbit) const {
+  if (orbit.empty()) {
+    return {};
+  }
+  PackedClusterImages images;
+  _make_images(*orbit.begin(), false, images);
+  return _make_equivalence_map(orbit, images);
+}
+
+void PackedUnitCellCoordSymGroupRep::_make_images(
+    IntegralCluster const &cluster, bool translate_to_origin,
+    PackedClusterImages &images) const {
+  Index const n = cluster.size();
+  images.n_images = m_n_ops;
+  images.n_sites = n;
+  images.b.resize(m_n_ops * n);
+  images.i.resize(m_n_ops * n);
+  images.j.resize(m_n_ops * n);
+  images.k.resize(m_n_ops * n);
+
+  thread_local std::vector<_Site> source;
+  thread_local std::vector<_Site> image;
+  source.resize(n);
+  image.resize(n);
+  for (Index s = 0; s < n; ++s) {
+    xtal::UnitCellCoord const &site = cluster[s];
+    if (site.sublattice() < 0 || site.sublattice() >= m_n_sublat) {
+      throw std::runtime_error(
+          "Error in PackedUnitCellCoordSymGroupRep: invalid sublattice");
+    }
+    source[s].i = _to_int32(site.unitcell()(0));
+    source[s].j = _to_int32(site.unitcell()(1));
+    source[s].k = _to_int32(site.unitcell()(2));
+    source[s].b = static_cast<std::int32_t>(site.sublattice());
+  }
+
+  for (Index m = 0; m < m_n_ops; ++m) {
+    std::int32_t const *M = m_point_matrix.data() + m * 9;
+    std::int32_t const *S = m_sublattice_index.data() + m * m_n_sublat;
+    std::int32_t const *T = m_unitcell_indices.data() + m * m_n_sublat * 3;
+    for (Index s = 0; s < n; ++s) {
+      _Site const &x = source[s];
+      std::int32_t const *t = T + x.b * 3;
+      image[s].i = M[0] * x.i + M[1] * x.j + M[2] * x.k + t[0];
+      image[s].j = M[3] * x.i + M[4] * x.j + M[5] * x.k + t[1];
+      image[s].k = M[6] * x.i + M[7] * x.j + M[8] * x.k + t[2];
+      image[s].b = S[x.b];
+    }
+    _sort_sites(image.data(), n);
+    _Site origin = {0, 0, 0, 0};
+    if (translate_to_origin && n) {
+      origin = image[0];
+    }
+    Index const offset = m * n;
+    for (Index s = 0; s < n; ++s) {
+      images.i[offset + s] = image[s].i - origin.i;
+      images.j[offset + s] = image[s].j - origin.j;
+      images.k[offset + s] = image[s].k - origin.k;
+      images.b[offset + s] = image[s].b;
+    }
+  }
+}
+
+/// \brief Return the index of the first greatest image
+Index PackedUnitCellCoordSymGroupRep::_find_greatest(
+    PackedClusterImages const &images) const {
+  Index const n = images.n_sites;
+  Index best = 0;
+  for (Index m = 1; m < images.n_images; ++m) {
+    // lexicographic comparison of image `best` and image `m`
+    Index x = best * n;
+    Index y = m * n;
+    for (Index s = 0; s < n; ++s, ++x, ++y) {
+      _Site A = {images.i[x], images.j[x], images.k[x], images.b[x]};
+      _Site B = {images.i[y], images.j[y], images.k[y], images.b[y]};
+      if (_less(A, B)) {
+        best = m;
+        break;
+      }
+      if (_less(B, A)) {
+        break;
+      }
+    }
+  }
+  return best;
+}
+
+std::vector<std::vector<Index>>
+PackedUnitCellCoordSymGroupRep::_make_equivalence_map(
+    std::set<IntegralCluster> const &orbit,
+    PackedClusterImages const &images) const {
+  std::vector<std::vector<Index>> equivalence_map(orbit.size());
+  for (Index m = 0; m < images.n_images; ++m) {
+    auto it = orbit.find(make_cluster(images, m));
+    if (it == orbit.end()) {
+      throw std::runtime_error(
+          "Error in PackedUnitCellCoordSymGroupRep::make_equivalence_map: "
+          "failed");
+    }
+    equivalence_map[std::distance(orbit.begin(), it)].push_back(m);
+  }
+  return equivalence_map;
+}
+
+/// \brief Return the image of a cluster by index
+///
+/// \param images Cluster images
+/// \param image_index Index of the image, in `[0, images.n_images)`
+IntegralCluster make_cluster(PackedClusterImages const &images,
+                             Index image_index) {
+  IntegralCluster cluster;
+  Index const offset = image_index * images.n_sites;
+  for (Index s = 0; s < images.n_sites; ++s) {
+    Index x = offset + s;
+    cluster.elements().push_back(
+        xtal::UnitCellCoord(images.b[x], images.i[x], images.j[x],
+                            images.k[x]));
+  }
+  return cluster;
+}
+
+}  // namespace clust
+}  // namespace CASM
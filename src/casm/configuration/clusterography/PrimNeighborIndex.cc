@@ -0,0 +1,250 @@
+#include "casm/configuration/clusterography/PrimNeighborIndex.hh"
+
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+#include "casm/configuration/clusterography/ClusterSpecs.hh"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/container/Counter.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/Coordinate.hh"
+
+namespace CASM {
+namespace clust {
+
+/// \brief Constructor
+///
+/// \param prim The prim
+/// \param _max_radius The maximum radius which may be queried
+/// \param site_filter A filter function that returns true for xtal::Site
+///     that should be included as neighbors. Neighbor lists are made for
+///     all sublattices, whether or not they are accepted by `site_filter`.
+PrimNeighborIndex::PrimNeighborIndex(xtal::BasicStructure const &prim,
+                                     double _max_radius,
+                                     SiteFilterFunction site_filter)
+    : PrimNeighborIndex(prim, _max_radius,
+                        make_site_filter_mask(prim, site_filter)) {}
+
+/// \brief Constructor, using a site filter evaluated for each sublattice
+///
+/// \param prim The prim
+/// \param _max_radius The maximum radius which may be queried
+/// \param site_filter_mask Sites on sublattice `b` are included as neighbors
+///     if `site_filter_mask[b]` is true. Neighbor lists are made for all
+///     sublattices, whether or not they are included.
+PrimNeighborIndex::PrimNeighborIndex(xtal::BasicStructure const &prim,
+                                     double _max_radius,
+                                     SiteFilterMask const &site_filter_mask)
+    : m_max_radius(_max_radius) {
+  auto const &basis = prim.basis();
+  Index n_sublat = basis.size();
+  if (site_filter_mask.size() != n_sublat) {
+    throw std::runtime_error(
+        "Error in PrimNeighborIndex: site_filter_mask size does not match "
+        "the number of sublattices");
+  }
+
+  std::vector<xtal::Coordinate> centers;
+  for (Index b = 0; b < n_sublat; ++b) {
+    centers.push_back(xtal::UnitCellCoord(b, 0, 0, 0).coordinate(prim));
+  }
+
+  // a neighbor at basis[b2] + R of basis[b] satisfies
+  //     |R| < max_radius + |basis[b] - basis[b2]|
+  double max_basis_dist = 0.0;
+  for (Index b = 0; b < n_sublat; ++b) {
+    for (Index b2 = 0; b2 < n_sublat; ++b2) {
+      max_basis_dist = std::max(max_basis_dist, centers[b].dist(centers[b2]));
+    }
+  }
+  auto dim = prim.lattice().enclose_sphere(m_max_radius + max_basis_dist);
+  EigenCounter<Eigen::Vector3i> grid_count(-dim, dim,
+                                           Eigen::Vector3i::Constant(1));
+
+  m_neighbors.resize(n_sublat);
+  do {
+    Eigen::Vector3i const &unitcell = grid_count();
+    for (Index b2 = 0; b2 < n_sublat; ++b2) {
+      if (!site_filter_mask[b2]) {
+        continue;
+      }
+      xtal::UnitCellCoord site(b2, unitcell(0), unitcell(1), unitcell(2));
+      xtal::Coordinate coord = site.coordinate(prim);
+      for (Index b = 0; b < n_sublat; ++b) {
+        double d = centers[b].dist(coord);
+        if (d < m_max_radius) {
+          m_neighbors[b].emplace_back(site, d);
+        }
+      }
+    }
+  } while (++grid_count);
+
+  m_neighbors_by_site = m_neighbors;
+  for (Index b = 0; b < n_sublat; ++b) {
+    std::sort(m_neighbors[b].begin(), m_neighbors[b].end(),
+              [](Neighbor const &A, Neighbor const &B) {
+                if (A.distance != B.distance) {
+                  return A.distance < B.distance;
+                }
+                return A.site < B.site;
+              });
+    std::sort(m_neighbors_by_site[b].begin(), m_neighbors_by_site[b].end(),
+              [](Neighbor const &A, Neighbor const &B) {
+                return A.site < B.site;
+              });
+  }
+}
+
+/// \brief The maximum radius which may be queried
+double PrimNeighborIndex::max_radius() const { return m_max_radius; }
+
+/// \brief Number of sublattices
+Index PrimNeighborIndex::n_sublattices() const { return m_neighbors.size(); }
+
+/// \brief Neighbors of `xtal::UnitCellCoord(b, 0, 0, 0)`, sorted by
+///     distance
+///
+/// Includes `xtal::UnitCellCoord(b, 0, 0, 0)` itself, at distance 0.0, if
+/// it is accepted by the site filter.
+std::vector<PrimNeighborIndex::Neighbor> const &PrimNeighborIndex::neighbors(
+    Index b) const {
+  return m_neighbors.at(b);
+}
+
+/// \brief Return the distance between two sites, if `site_b` is a
+///     neighbor of `site_a`
+///
+/// \returns The distance between `site_a` and `site_b`, if `site_b` is
+///     accepted by the site filter and is within `max_radius()` of
+///     `site_a`, otherwise `std::nullopt`.
+std::optional<double> PrimNeighborIndex::distance(
+    xtal::UnitCellCoord const &site_a,
+    xtal::UnitCellCoord const &site_b) const {
+  xtal::UnitCell translation = site_b.unitcell() - site_a.unitcell();
+  xtal::UnitCellCoord offset(site_b.sublattice(), translation);
+  auto const &by_site = m_neighbors_by_site.at(site_a.sublattice());
+  auto it = std::lower_bound(
+      by_site.begin(), by_site.end(), offset,
+      [](Neighbor const &A, xtal::UnitCellCoord const &B) {
+        return A.site < B;
+      });
+  if (it == by_site.end() || it->site != offset) {
+    return std::nullopt;
+  }
+  return it->distance;
+}
+
+/// \brief Return the sites within `radius` of `site`
+///
+/// \param site The site
+/// \param radius The neighborhood distance cutoff. Must not be greater than
+///     `max_radius()`.
+///
+/// \returns Sites accepted by the site filter with distance from `site`
+///     less than `radius`, sorted.
+std::vector<xtal::UnitCellCoord> PrimNeighborIndex::sites_within(
+    xtal::UnitCellCoord const &site, double radius) const {
+  _throw_if_invalid_radius(radius);
+  Index b = site.sublattice();
+  std::vector<xtal::UnitCellCoord> result;
+  auto end = _end_within(b, radius);
+  for (auto it = m_neighbors.at(b).begin(); it != end; ++it) {
+    result.push_back(it->site + site.unitcell());
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/// \brief Return the sites within `radius` of any site in `sites`
+///
+/// \param sites The sites
+/// \param radius The neighborhood distance cutoff. Must not be greater than
+///     `max_radius()`.
+///
+/// \returns Sites accepted by the site filter with distance less than
+///     `radius` from any site in `sites`, sorted and without duplicates.
+std::vector<xtal::UnitCellCoord> PrimNeighborIndex::sites_within_any(
+    std::vector<xtal::UnitCellCoord> const &sites, double radius) const {
+  _throw_if_invalid_radius(radius);
+  std::set<xtal::UnitCellCoord> result;
+  for (auto const &site : sites) {
+    Index b = site.sublattice();
+    auto end = _end_within(b, radius);
+    for (auto it = m_neighbors.at(b).begin(); it != end; ++it) {
+      result.insert(it->site + site.unitcell());
+    }
+  }
+  return std::vector<xtal::UnitCellCoord>(result.begin(), result.end());
+}
+
+/// \brief Return the sites within `radius` of any site in `cluster`
+///
+/// \param cluster The cluster
+/// \param radius The neighborhood distance cutoff. Must not be greater than
+///     `max_radius()`.
+///
+/// \returns Sites accepted by the site filter with distance less than
+///     `radius` from any site in `cluster`, sorted and without duplicates.
+std::vector<xtal::UnitCellCoord> PrimNeighborIndex::sites_within_any(
+    IntegralCluster const &cluster, double radius) const {
+  return sites_within_any(
+      std::vector<xtal::UnitCellCoord>(cluster.begin(), cluster.end()), radius);
+}
+
+/// \brief Return the sites within `radius` of every site in `cluster`
+///
+/// \param cluster The cluster
+/// \param radius The neighborhood distance cutoff. Must not be greater than
+///     `max_radius()`.
+///
+/// \returns Sites accepted by the site filter with distance less than
+///     `radius` from every site in `cluster`, sorted. Sites in `cluster`
+///     are included if they satisfy the same condition. If `cluster` is
+///     empty, the result is empty.
+std::vector<xtal::UnitCellCoord> PrimNeighborIndex::sites_within_all(
+    IntegralCluster const &cluster, double radius) const {
+  _throw_if_invalid_radius(radius);
+  std::vector<xtal::UnitCellCoord> result;
+  if (!cluster.size()) {
+    return result;
+  }
+  xtal::UnitCellCoord const &first = cluster[0];
+  Index b = first.sublattice();
+  auto end = _end_within(b, radius);
+  for (auto it = m_neighbors.at(b).begin(); it != end; ++it) {
+    xtal::UnitCellCoord site = it->site + first.unitcell();
+    bool is_within_all = true;
+    for (Index i = 1; i < cluster.size(); ++i) {
+      std::optional<double> d = distance(cluster[i], site);
+      if (!d.has_value() || !(*d < radius)) {
+        is_within_all = false;
+        break;
+      }
+    }
+    if (is_within_all) {
+      result.push_back(site);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+void PrimNeighborIndex::_throw_if_invalid_radius(double radius) const {
+  if (radius > m_max_radius) {
+    throw std::runtime_error(
+        "Error in PrimNeighborIndex: radius is greater than max_radius");
+  }
+}
+
+/// \brief Return the end of the prefix of `neighbors(b)` within `radius`
+std::vector<PrimNeighborIndex::Neighbor>::const_iterator
+PrimNeighborIndex::_end_within(Index b, double radius) const {
+  auto const &neighbors = m_neighbors.at(b);
+  return std::partition_point(
+      neighbors.begin(), neighbors.end(),
+      [&](Neighbor const &neighbor) { return neighbor.distance < radius; });
+}
+
+}  // namespace clust
+}  // namespace CASM
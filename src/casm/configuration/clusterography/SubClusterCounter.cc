@@ -0,0 +1,98 @@
+#include "casm/configuration/clusterography/SubClusterCounter.hh"
+
+#include <algorithm>
+
+namespace CASM {
+namespace clust {
+
+/// \brief Constructor
+///
+/// \param orbits Cluster orbits, as from `make_prim_periodic_orbits` if
+///     `periodic` is true, else as from `make_local_orbits`
+/// \param periodic If true, clusters are equivalent under prim periodic
+///     translations
+SubClusterOrbitIndex::SubClusterOrbitIndex(
+    std::vector<std::set<IntegralCluster>> const &orbits, bool periodic)
+    : m_periodic(periodic) {
+  for (Index i = 0; i < orbits.size(); ++i) {
+    for (IntegralCluster cluster : orbits[i]) {
+      cluster.sort();
+      if (m_periodic && cluster.size()) {
+        cluster -= cluster[0].unitcell();
+      }
+      m_orbit_index.emplace(std::move(cluster), i);
+    }
+  }
+}
+
+/// \brief Return the index of the orbit containing `cluster`, or -1
+Index SubClusterOrbitIndex::orbit_index(IntegralCluster cluster) const {
+  cluster.sort();
+  return _orbit_index_of_sorted(cluster);
+}
+
+/// \brief Return the orbit index of each subcluster of `cluster`, indexed
+///     by SubClusterMask
+///
+/// \param cluster A cluster, with at most 64 sites
+///
+/// \returns orbit_indices, with size `2^cluster.size()`, where
+///     `orbit_indices[mask]` is the index of the orbit containing
+///     `make_subcluster(cluster, mask)`, or -1 if it is not in any orbit.
+///
+/// Notes:
+/// - Subclusters are made in one pass using one reused cluster, without
+///   constructing a SubClusterCounter.
+/// - The sites of `cluster` are sorted first, so that subclusters do not
+///   need sorting. The masks refer to the sites of `cluster` in their
+///   original order.
+std::vector<Index> SubClusterOrbitIndex::subcluster_orbit_indices(
+    IntegralCluster const &cluster) const {
+  SubClusterMaskCounter counter(cluster);
+
+  // sorted[j] = cluster.element(order[j])
+  std::vector<Index> order(cluster.size());
+  for (Index i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](Index a, Index b) {
+    return cluster.element(a) < cluster.element(b);
+  });
+  IntegralCluster sorted;
+  for (Index i : order) {
+    sorted.elements().push_back(cluster.element(i));
+  }
+
+  std::vector<Index> orbit_indices;
+  IntegralCluster subcluster;
+  for (; counter.valid(); counter.next()) {
+    SubClusterMask sorted_mask = 0;
+    for (Index j = 0; j < order.size(); ++j) {
+      if ((counter.mask() >> order[j]) & 1) {
+        sorted_mask |= SubClusterMask(1) << j;
+      }
+    }
+    make_subcluster(subcluster, sorted, sorted_mask);
+    orbit_indices.push_back(_orbit_index_of_sorted(subcluster));
+  }
+  return orbit_indices;
+}
+
+/// \brief Return the orbit index of a sorted cluster, or -1
+///
+/// For periodic orbits, `cluster` is translated in place so its first site
+/// is in the origin unit cell.
+Index SubClusterOrbitIndex::_orbit_index_of_sorted(
+    IntegralCluster &cluster) const {
+  if (m_periodic && cluster.size()) {
+    cluster -= cluster[0].unitcell();
+  }
+  auto it = m_orbit_index.find(cluster);
+  if (it == m_orbit_index.end()) {
+    return -1;
+  }
+  return it->second;
+}
+
+}  // namespace clust
+}  // namespace CASM
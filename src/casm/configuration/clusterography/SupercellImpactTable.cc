@@ -0,0 +1,113 @@
+#include "casm/configuration/clusterography/SupercellImpactTable.hh"
+
+#include <algorithm>
+
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/impact_neighborhood.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+
+namespace CASM {
+namespace clust {
+
+namespace {
+
+/// \brief Add one row, the linear site indices of `neighborhood` translated
+///     by `trans`, to `table`
+void _push_back_row(
+    SupercellImpactTable &table,
+    std::vector<xtal::UnitCellCoord> const &neighborhood,
+    xtal::UnitCell const &trans,
+    xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter) {
+  Index begin = table.sites.size();
+  for (auto const &site : neighborhood) {
+    table.sites.push_back(unitcellcoord_index_converter(site + trans));
+  }
+  // periodic images may coincide in small supercells
+  std::sort(table.sites.begin() + begin, table.sites.end());
+  table.sites.erase(
+      std::unique(table.sites.begin() + begin, table.sites.end()),
+      table.sites.end());
+  table.row_offset.push_back(table.sites.size());
+}
+
+}  // namespace
+
+/// \brief Make a table of the flower neighborhood of each site in a
+///     supercell
+///
+/// \param orbits The prim periodic orbits, usually those associated with
+///     non-zero eci
+/// \param unitcellcoord_index_converter A UnitCellCoordIndexConverter for the
+///     supercell in which linear site indices will be generated
+///
+/// \returns A table with one row per site in the supercell, where row `l` is
+///     the linear site indices of the flower neighborhood (see
+///     `add_to_flower_neighborhood`) of the point cluster at linear site
+///     index `l`. These are the sites which share a cluster with `l`, so a
+///     change at `l` can only change the contributions of clusters on them.
+///
+/// Method:
+/// - The flower neighborhood of `xtal::UnitCellCoord(b, 0, 0, 0)` is built
+///   once per sublattice `b`, and translated to each site.
+SupercellImpactTable make_flower_impact_table(
+    std::vector<std::set<IntegralCluster>> const &orbits,
+    xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter) {
+  std::vector<std::vector<xtal::UnitCellCoord>> neighborhood_by_sublattice;
+
+  SupercellImpactTable table;
+  Index n_sites = unitcellcoord_index_converter.total_sites();
+  table.row_offset.reserve(n_sites + 1);
+  for (Index l = 0; l < n_sites; ++l) {
+    xtal::UnitCellCoord const &site = unitcellcoord_index_converter(l);
+    Index b = site.sublattice();
+    while (Index(neighborhood_by_sublattice.size()) <= b) {
+      Index _b = neighborhood_by_sublattice.size();
+      IntegralCluster phenomenal({xtal::UnitCellCoord(_b, 0, 0, 0)});
+      std::set<xtal::UnitCellCoord> neighborhood;
+      add_to_flower_neighborhood(phenomenal, neighborhood, orbits);
+      neighborhood_by_sublattice.emplace_back(neighborhood.begin(),
+                                              neighborhood.end());
+    }
+    _push_back_row(table, neighborhood_by_sublattice[b], site.unitcell(),
+                   unitcellcoord_index_converter);
+  }
+  return table;
+}
+
+/// \brief Make a table of the local neighborhood of a phenomenal cluster,
+///     translated to each unit cell in a supercell
+///
+/// \param local_orbits The local-cluster orbits of the phenomenal cluster,
+///     usually those associated with non-zero eci
+/// \param unitcellcoord_index_converter A UnitCellCoordIndexConverter for the
+///     supercell in which linear site indices will be generated
+/// \param unitcell_index_converter A UnitCellIndexConverter for the same
+///     supercell
+///
+/// \returns A table with one row per unit cell in the supercell, where row
+///     `i` is the linear site indices of the local neighborhood (see
+///     `add_to_local_neighborhood`) translated by
+///     `unitcell_index_converter(i)`.
+SupercellImpactTable make_local_impact_table(
+    std::vector<std::set<IntegralCluster>> const &local_orbits,
+    xtal::UnitCellCoordIndexConverter const &unitcellcoord_index_converter,
+    xtal::UnitCellIndexConverter const &unitcell_index_converter) {
+  std::set<xtal::UnitCellCoord> _neighborhood;
+  add_to_local_neighborhood(_neighborhood, local_orbits);
+  std::vector<xtal::UnitCellCoord> neighborhood(_neighborhood.begin(),
+                                                _neighborhood.end());
+
+  SupercellImpactTable table;
+  Index n_unitcells = unitcell_index_converter.total_sites();
+  table.row_offset.reserve(n_unitcells + 1);
+  table.sites.reserve(n_unitcells * neighborhood.size());
+  for (Index i = 0; i < n_unitcells; ++i) {
+    _push_back_row(table, neighborhood, unitcell_index_converter(i),
+                   unitcellcoord_index_converter);
+  }
+  return table;
+}
+
+}  // namespace clust
+}  // namespace CASM
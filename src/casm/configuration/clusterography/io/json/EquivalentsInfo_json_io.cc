@@ -56,6 +56,68 @@ jsonParser &to_json(clust::EquivalentsInfo const &equivalents_info,
   return json;
 }
 
+/// \brief Write "equivalents info" to a stream, one equivalent at a time
+///
+/// Writes the same format as `to_json` for EquivalentsInfo. If
+/// `equivalent_orbits` is not null, each equivalent also includes "orbits",
+/// the local cluster orbits about its phenomenal cluster, written as by
+/// `write_cluster_orbits_json`. Only one equivalent is held as a jsonParser
+/// at a time.
+///
+/// \param out The output stream
+/// \param equivalents_info The equivalents info
+/// \param prim The prim
+/// \param equivalent_orbits If not null, `(*equivalent_orbits)[i]` are the
+///     local cluster orbits about
+///     `equivalents_info.phenomenal_clusters[i]`
+/// \param options Sets whether "elements" of each local cluster orbit are
+///     written. Equivalence maps are not written, because they depend on
+///     the symmetry of each phenomenal cluster.
+/// \param stream_options Options for compact output and number rounding
+void write_equivalents_info_json(
+    std::ostream &out, clust::EquivalentsInfo const &equivalents_info,
+    xtal::BasicStructure const &prim,
+    std::vector<std::vector<std::set<clust::IntegralCluster>>> const
+        *equivalent_orbits,
+    clust::ClusterOrbitOutputOptions const &options,
+    JsonStreamOptions const &stream_options) {
+  auto const &phenomenal_clusters = equivalents_info.phenomenal_clusters;
+  if (equivalent_orbits != nullptr &&
+      equivalent_orbits->size() != phenomenal_clusters.size()) {
+    throw std::runtime_error(
+        "Error in write_equivalents_info_json: equivalent_orbits size does "
+        "not match the number of phenomenal clusters");
+  }
+
+  clust::ClusterOrbitOutputOptions orbit_options = options;
+  orbit_options.include_equivalence_map = false;
+
+  jsonParser ops_json;
+  ops_json = equivalents_info.equivalent_generating_op_indices;
+  out << "{\"equivalent_generating_ops\":";
+  write_json(out, std::move(ops_json), stream_options);
+  out << ",\"equivalents\":";
+  JsonArrayWriter writer(out, stream_options);
+  for (Index i = 0; i < phenomenal_clusters.size(); ++i) {
+    jsonParser equivalent;
+    to_json(phenomenal_clusters[i], equivalent["phenomenal"], prim);
+    if (equivalent_orbits != nullptr) {
+      equivalent["orbits"].put_array();
+      Index linear_orbit_index = 0;
+      for (auto const &orbit : (*equivalent_orbits)[i]) {
+        jsonParser orbit_json;
+        orbit_json["linear_orbit_index"] = linear_orbit_index++;
+        to_json(orbit, orbit_json, prim, phenomenal_clusters[i], nullptr,
+                orbit_options);
+        equivalent["orbits"].push_back(orbit_json);
+      }
+    }
+    writer.write(std::move(equivalent));
+  }
+  writer.finish();
+  out << "}";
+}
+
 /// \brief Parse minimal clexulator::EquivalentsInfo from JSON
 void parse(InputParser<clust::EquivalentsInfo> &parser,
            xtal::BasicStructure const &prim) {
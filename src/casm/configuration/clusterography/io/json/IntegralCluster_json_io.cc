@@ -6,6 +6,8 @@
 #include "casm/casm_io/json/InputParser_impl.hh"
 #include "casm/casm_io/json/jsonParser.hh"
 #include "casm/configuration/clusterography/ClusterInvariants.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/io/json/JsonArrayWriter.hh"
 #include "casm/crystallography/BasicStructure.hh"
 #include "casm/crystallography/io/UnitCellCoordIO.hh"
 #include "casm/global/enum/json_io.hh"
@@ -129,7 +131,10 @@ void parse(InputParser<clust::IntegralCluster> &parser,
   auto &clust = *parser.value;
 
   if (coord_type == INTEGRAL) {
-    parser.require(clust.elements(), name);
+    std::vector<xtal::UnitCellCoord> elements;
+    parser.require(elements, name);
+    clust.elements() = clust::IntegralCluster::ElementContainer(
+        elements.begin(), elements.end());
   } else {
     std::vector<Eigen::VectorXd> coord_vec;
     parser.require(coord_vec, name);
@@ -154,4 +159,97 @@ void parse(InputParser<clust::IntegralCluster> &parser,
   }
   return;
 }
+
+/// \brief Write a cluster orbit to JSON object
+///
+/// Format:
+/// \code
+/// {
+///   "mult" : int,
+///   "prototype" : IntegralCluster,
+///   "elements" : [IntegralCluster, ...],
+///   "equivalence_map" : [[int, ...], ...]
+/// }
+/// \endcode
+///
+/// \param orbit The orbit. The first element is written as the prototype.
+/// \param json The JSON object to write to
+/// \param prim The prim
+/// \param phenomenal If has_value, `orbit` is an orbit of local clusters
+///     about `phenomenal`
+/// \param unitcellcoord_symgroup_rep The symmetry representation used to
+///     generate `orbit`. Only required if `options.include_equivalence_map`.
+/// \param options Sets which of "elements" and "equivalence_map" are
+///     included
+jsonParser &to_json(
+    std::set<clust::IntegralCluster> const &orbit, jsonParser &json,
+    xtal::BasicStructure const &prim,
+    std::optional<clust::IntegralCluster> phenomenal,
+    std::vector<xtal::UnitCellCoordRep> const *unitcellcoord_symgroup_rep,
+    clust::ClusterOrbitOutputOptions const &options) {
+  json["mult"] = orbit.size();
+  if (!orbit.size()) {
+    return json;
+  }
+  to_json(*orbit.begin(), json["prototype"], prim, phenomenal);
+
+  if (options.include_elements) {
+    json["elements"].put_array();
+    for (auto const &cluster : orbit) {
+      jsonParser tjson;
+      to_json(cluster, tjson, prim, phenomenal);
+      json["elements"].push_back(tjson);
+    }
+  }
+
+  if (options.include_equivalence_map) {
+    if (unitcellcoord_symgroup_rep == nullptr) {
+      throw std::runtime_error(
+          "Error writing cluster orbit: include_equivalence_map requires "
+          "unitcellcoord_symgroup_rep");
+    }
+    if (phenomenal.has_value()) {
+      json["equivalence_map"] = clust::make_local_equivalence_map_indices(
+          orbit, *unitcellcoord_symgroup_rep);
+    } else {
+      json["equivalence_map"] =
+          clust::make_prim_periodic_equivalence_map_indices(
+              orbit, *unitcellcoord_symgroup_rep);
+    }
+  }
+  return json;
+}
+
+/// \brief Write cluster orbits to a stream as a JSON array, one orbit at a
+///     time
+///
+/// Each orbit is written as by `to_json` for a cluster orbit, with the
+/// addition of "linear_orbit_index". Only one orbit is held as a jsonParser
+/// at a time, so memory use does not grow with the number of orbits.
+///
+/// \param out The output stream
+/// \param orbits The orbits
+/// \param prim, phenomenal, unitcellcoord_symgroup_rep, options As for
+///     `to_json` for a cluster orbit. Set `options.include_elements` to
+///     false to write only prototypes.
+/// \param stream_options Options for compact output and number rounding
+void write_cluster_orbits_json(
+    std::ostream &out,
+    std::vector<std::set<clust::IntegralCluster>> const &orbits,
+    xtal::BasicStructure const &prim,
+    std::optional<clust::IntegralCluster> phenomenal,
+    std::vector<xtal::UnitCellCoordRep> const *unitcellcoord_symgroup_rep,
+    clust::ClusterOrbitOutputOptions const &options,
+    JsonStreamOptions const &stream_options) {
+  JsonArrayWriter writer(out, stream_options);
+  for (Index i = 0; i < orbits.size(); ++i) {
+    jsonParser json;
+    json["linear_orbit_index"] = i;
+    to_json(orbits[i], json, prim, phenomenal, unitcellcoord_symgroup_rep,
+            options);
+    writer.write(std::move(json));
+  }
+  writer.finish();
+}
+
 }  // namespace CASM
@@ -1,11 +1,104 @@
 #include "casm/configuration/clusterography/occ_counter.hh"
 
+#include <algorithm>
+#include <stdexcept>
+
 #include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/sym_info/occ_sym_info.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
 #include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
 
 namespace CASM {
 namespace clust {
 
+namespace {
+
+/// \brief Cluster sites and occupants, as transformed by one group element
+struct _ClusterSiteRep {
+  /// source[i]: the site whose occupant is moved onto site i
+  std::vector<Index> source;
+
+  /// occupant[i][occ]: the occupant index on site i, if the occupant index
+  /// on site source[i] is occ
+  std::vector<std::vector<Index>> occupant;
+};
+
+/// \brief Orderly generation of cluster occupations
+///
+/// Sites are assigned in order. A partial occupation is pruned if some group
+/// element maps it to an occupation with a lexicographically greater prefix
+/// that is already fully determined, since then no completion is the
+/// greatest of its orbit.
+class _DistinctOccupationsSearch {
+ public:
+  _DistinctOccupationsSearch(std::vector<int> const &_n_occupants,
+                             std::vector<_ClusterSiteRep> const &_group_rep)
+      : m_n_occupants(_n_occupants),
+        m_group_rep(_group_rep),
+        m_occupation(_n_occupants.size(), 0) {}
+
+  std::vector<DistinctClusterOccupation> run() {
+    m_result.clear();
+    _search(0);
+    return std::move(m_result);
+  }
+
+ private:
+  /// \brief Return false if the first `n_assigned` sites cannot begin a
+  ///     greatest occupation; at a leaf, also count the stabilizer
+  bool _check(Index n_assigned, Index &n_stabilizer) const {
+    Index n_sites = m_occupation.size();
+    n_stabilizer = 0;
+    for (auto const &rep : m_group_rep) {
+      bool is_equal = true;
+      for (Index i = 0; i < n_sites; ++i) {
+        Index s = rep.source[i];
+        if (i >= n_assigned || s >= n_assigned) {
+          is_equal = false;
+          break;
+        }
+        int image = rep.occupant[i][m_occupation[s]];
+        if (image > m_occupation[i]) {
+          return false;
+        }
+        if (image < m_occupation[i]) {
+          is_equal = false;
+          break;
+        }
+      }
+      if (is_equal) {
+        ++n_stabilizer;
+      }
+    }
+    return true;
+  }
+
+  void _search(Index k) {
+    Index n_stabilizer;
+    if (!_check(k, n_stabilizer)) {
+      return;
+    }
+    if (k == m_occupation.size()) {
+      m_result.push_back(DistinctClusterOccupation{
+          m_occupation, Index(m_group_rep.size()) / n_stabilizer});
+      return;
+    }
+    for (int occ = 0; occ < m_n_occupants[k]; ++occ) {
+      m_occupation[k] = occ;
+      _search(k + 1);
+    }
+    m_occupation[k] = 0;
+  }
+
+  std::vector<int> const &m_n_occupants;
+  std::vector<_ClusterSiteRep> const &m_group_rep;
+  std::vector<int> m_occupation;
+  std::vector<DistinctClusterOccupation> m_result;
+};
+
+}  // namespace
+
 /// \brief Counter over cluster occupations
 Counter<std::vector<int>> make_occ_counter(IntegralCluster const &cluster,
                                            xtal::BasicStructure const &prim) {
@@ -19,5 +112,98 @@ Counter<std::vector<int>> make_occ_counter(IntegralCluster const &cluster,
                                    std::vector<int>(cluster.size(), 1));
 }
 
+/// \brief Make the cluster occupations that are distinct under a group which
+///     leaves the cluster invariant
+///
+/// \param cluster The cluster
+/// \param prim The prim
+/// \param cluster_group_elements The elements of a group which leaves
+///     `cluster` invariant, including translations, such as
+///     `make_cluster_group(...)->element` or a local cluster group.
+///
+/// \returns The distinct occupations, as from
+///     `make_distinct_cluster_occupations(cluster, prim,
+///     unitcellcoord_symgroup_rep, occ_symgroup_rep)`, with the
+///     representations made from `cluster_group_elements`.
+std::vector<DistinctClusterOccupation> make_distinct_cluster_occupations(
+    IntegralCluster const &cluster, xtal::BasicStructure const &prim,
+    std::vector<xtal::SymOp> const &cluster_group_elements) {
+  sym_info::OccSymInfo occ_sym_info(cluster_group_elements, prim);
+  return make_distinct_cluster_occupations(
+      cluster, prim,
+      sym_info::make_unitcellcoord_symgroup_rep(cluster_group_elements, prim),
+      occ_sym_info.occ_symgroup_rep);
+}
+
+/// \brief Make the cluster occupations that are distinct under a group which
+///     leaves the cluster invariant
+///
+/// \param cluster The cluster
+/// \param prim The prim
+/// \param unitcellcoord_symgroup_rep The group, as it transforms sites. Each
+///     element must map the sites of `cluster` onto themselves.
+/// \param occ_symgroup_rep The group, as it transforms occupant indices,
+///     with usage `occ_symgroup_rep[group_index][sublattice_index][occ]`.
+///
+/// \returns The distinct occupations, each the lexicographically greatest
+///     occupation of its orbit under the group, sorted lexicographically,
+///     with multiplicity equal to the size of its orbit. The multiplicities
+///     sum to the number of occupations counted by
+///     `make_occ_counter(cluster, prim)`.
+///
+/// Method:
+/// - Each group element is converted once to a permutation of the cluster
+///   sites and a table of occupant index transformations.
+/// - Occupations are generated by orderly generation (see
+///   `_DistinctOccupationsSearch`), so that only the distinct occupations
+///   are yielded and no canonical form is made for the others. This is
+///   intended for the small groups and clusters of cluster-based
+///   enumeration.
+std::vector<DistinctClusterOccupation> make_distinct_cluster_occupations(
+    IntegralCluster const &cluster, xtal::BasicStructure const &prim,
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    std::vector<std::vector<std::vector<Index>>> const &occ_symgroup_rep) {
+  if (occ_symgroup_rep.size() != unitcellcoord_symgroup_rep.size()) {
+    throw std::runtime_error(
+        "Error in make_distinct_cluster_occupations: group representation "
+        "size mismatch");
+  }
+  if (unitcellcoord_symgroup_rep.empty()) {
+    throw std::runtime_error(
+        "Error in make_distinct_cluster_occupations: empty group");
+  }
+  Index n_sites = cluster.size();
+  std::vector<int> n_occupants;
+  for (auto const &site : cluster) {
+    n_occupants.push_back(
+        prim.basis()[site.sublattice()].occupant_dof().size());
+  }
+
+  std::vector<_ClusterSiteRep> group_rep;
+  for (Index g = 0; g < unitcellcoord_symgroup_rep.size(); ++g) {
+    _ClusterSiteRep rep;
+    rep.source.resize(n_sites, -1);
+    rep.occupant.resize(n_sites);
+    for (Index i = 0; i < n_sites; ++i) {
+      xtal::UnitCellCoord site_after =
+          copy_apply(unitcellcoord_symgroup_rep[g], cluster[i]);
+      auto it = std::find(cluster.begin(), cluster.end(), site_after);
+      if (it == cluster.end()) {
+        throw std::runtime_error(
+            "Error in make_distinct_cluster_occupations: group does not "
+            "leave the cluster invariant");
+      }
+      Index j = std::distance(cluster.begin(), it);
+      auto const &occ_rep = occ_symgroup_rep[g][cluster[i].sublattice()];
+      rep.source[j] = i;
+      rep.occupant[j] = occ_rep;
+    }
+    group_rep.push_back(std::move(rep));
+  }
+
+  _DistinctOccupationsSearch search(n_occupants, group_rep);
+  return search.run();
+}
+
 }  // namespace clust
 }  // namespace CASM
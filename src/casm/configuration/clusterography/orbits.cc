@@ -1,13 +1,22 @@
 #include "casm/configuration/clusterography/orbits.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <memory_resource>
+
 #include "casm/configuration/clusterography/ClusterInvariants.hh"
 #include "casm/configuration/clusterography/ClusterSpecs.hh"
 #include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/PackedUnitCellCoordSymGroupRep.hh"
+#include "casm/configuration/clusterography/PrimNeighborIndex.hh"
 #include "casm/configuration/clusterography/SubClusterCounter.hh"
 #include "casm/configuration/group/Group.hh"
 #include "casm/configuration/group/orbits.hh"
 #include "casm/configuration/group/subgroups.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/configuration/perf.hh"
 #include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "casm/configuration/trace.hh"
 #include "casm/crystallography/BasicStructure.hh"
 #include "casm/crystallography/LinearIndexConverter.hh"
 #include "casm/crystallography/SymType.hh"
@@ -18,6 +27,139 @@
 namespace CASM {
 namespace clust {
 
+namespace {
+
+/// \brief A set of clusters, ordered by their invariants, whose nodes are
+///     allocated from an arena that is released at once when the set is
+///     destroyed
+///
+/// The arena is not thread-safe, so each set must be filled by one thread at
+/// a time. Its upstream resource is only used to allocate arena blocks.
+struct _ClusterBranch {
+  typedef std::pair<ClusterInvariants, IntegralCluster> pair_type;
+  typedef std::pmr::set<pair_type, CompareCluster_f> set_type;
+
+  _ClusterBranch(CompareCluster_f const &compare_f,
+                 std::pmr::memory_resource *upstream)
+      : arena(upstream), clusters(compare_f, &arena) {}
+
+  std::pmr::monotonic_buffer_resource arena;
+
+  set_type clusters;
+};
+
+/// \brief Make an empty _ClusterBranch
+std::unique_ptr<_ClusterBranch> _make_branch(
+    CompareCluster_f const &compare_f, std::pmr::memory_resource *resource) {
+  return std::make_unique<_ClusterBranch>(
+      compare_f,
+      resource != nullptr ? resource : std::pmr::get_default_resource());
+}
+
+/// \brief Extend clusters of the previous branch by one site
+///
+/// Each cluster in `prev_clusters` is extended by each candidate site, and
+/// the invariants of the extended cluster are made from the stored invariants
+/// of the cluster being extended. The extended cluster is kept, in canonical
+/// form, if it is unique and its max site-to-site distance is less than
+/// `max_length` and not less than `min_length`. For `branch == 1` candidate
+/// sites are the origin unit cell sites allowed by `site_filter_mask`, and the
+/// lengths are ignored. For `branch >= 2` candidate sites are found with
+/// `neighbor_index`.
+///
+/// Contiguous chunks of `prev_clusters` are extended into separate sets, in
+/// parallel. Chunk sets are merged in order, so that of any equivalent
+/// clusters the first found is kept, exactly as when extending serially.
+/// Each chunk set has its own arena, so threads do not share one.
+std::unique_ptr<_ClusterBranch> _extend_branch(
+    xtal::BasicStructure const &prim, CompareCluster_f const &compare_f,
+    PackedUnitCellCoordSymGroupRep const &packed_rep,
+    PrimNeighborIndex const *neighbor_index,
+    SiteFilterMask const &site_filter_mask,
+    std::vector<_ClusterBranch::pair_type const *> const &prev_clusters,
+    int branch, double max_length, double min_length, Index n_threads,
+    std::pmr::memory_resource *resource) {
+  double xtal_tol = prim.lattice().tol();
+
+  // generate candidate sites to be added to clusters of the previous branch
+  // (for branch >= 2 they are found for each cluster)
+  std::vector<xtal::UnitCellCoord> candidate_sites;
+  if (branch == 1) {
+    for (Index b = 0; b < site_filter_mask.size(); ++b) {
+      if (site_filter_mask[b]) {
+        candidate_sites.emplace_back(b, 0, 0, 0);
+      }
+    }
+  }
+
+  // a filter function selects which clusters are allowed
+  ClusterFilterFunction cluster_filter;
+  if (branch == 1) {
+    cluster_filter = all_clusters_filter();
+  } else {
+    cluster_filter = max_length_cluster_filter(max_length);
+  }
+
+  Index n_prev = prev_clusters.size();
+  Index n_chunks = config::resolve_n_threads(n_threads, n_prev);
+  std::vector<std::unique_ptr<_ClusterBranch>> chunk_branches(n_chunks);
+  auto _extend_chunk = [&](Index chunk_index) {
+    chunk_branches[chunk_index] = _make_branch(compare_f, resource);
+    _ClusterBranch::set_type &chunk_branch =
+        chunk_branches[chunk_index]->clusters;
+    Index begin = chunk_index * n_prev / n_chunks;
+    Index end = (chunk_index + 1) * n_prev / n_chunks;
+    std::vector<xtal::UnitCellCoord> cluster_candidate_sites;
+    for (Index i = begin; i < end; ++i) {
+      ClusterInvariants const &prev_invariants = prev_clusters[i]->first;
+      IntegralCluster const &prev_cluster = prev_clusters[i]->second;
+      if (branch != 1) {
+        cluster_candidate_sites = neighbor_index->sites_within_all(
+            prev_cluster, max_length + xtal_tol);
+      }
+      for (auto const &integral_site :
+           (branch == 1 ? candidate_sites : cluster_candidate_sites)) {
+        if (CASM::contains(prev_cluster.elements(), integral_site)) {
+          continue;
+        }
+        ClusterInvariants invariants(prev_invariants, prev_cluster,
+                                     integral_site, prim);
+        IntegralCluster test_cluster = prev_cluster;
+        test_cluster.elements().push_back(integral_site);
+        if (!cluster_filter(invariants, test_cluster)) {
+          continue;
+        }
+        if (branch != 1 && invariants.distances().back() < min_length) {
+          continue;
+        }
+        CASM_CONFIGURATION_PERF_COUNT(orbit_candidate_tested);
+        test_cluster = packed_rep.make_prim_periodic_canonical_element(
+            test_cluster);
+        chunk_branch.emplace(std::move(invariants), std::move(test_cluster));
+      }
+    }
+  };
+  config::parallel_for_chunks(
+      n_chunks, n_chunks, [&](Index chunk_begin, Index chunk_end) {
+        for (Index c = chunk_begin; c < chunk_end; ++c) {
+          _extend_chunk(c);
+        }
+      });
+  std::unique_ptr<_ClusterBranch> curr_branch =
+      _make_branch(compare_f, resource);
+  for (auto const &chunk_branch : chunk_branches) {
+    curr_branch->clusters.insert(chunk_branch->clusters.begin(),
+                                 chunk_branch->clusters.end());
+  }
+  chunk_branches.clear();
+
+  CASM_CONFIGURATION_PERF_COUNT_N(orbit_candidate_kept,
+                                  curr_branch->clusters.size());
+  return curr_branch;
+}
+
+}  // namespace
+
 /// \brief Copy cluster and apply symmetry operation transformation
 ///
 /// \param op, Symmetry operation representation to be applied
@@ -36,6 +178,28 @@ IntegralCluster prim_periodic_integral_cluster_copy_apply(
   return clust;
 }
 
+/// \brief Apply symmetry operation transformation to a cluster, writing the
+///     result into an existing cluster
+///
+/// \param op, Symmetry operation representation to be applied
+/// \param clust, Cluster to transform
+/// \param result, Set to the transformed cluster, sorted and translated to
+///     the origin unit cell. Its existing storage is reused.
+///
+/// \return A reference to `result`
+IntegralCluster &prim_periodic_integral_cluster_apply(
+    xtal::UnitCellCoordRep const &op, IntegralCluster const &clust,
+    IntegralCluster &result) {
+  result = clust;
+  if (!result.size()) {
+    return result;
+  }
+  apply(op, result);
+  result.sort();
+  result -= result[0].unitcell();
+  return result;
+}
+
 /// \brief Find translation that leave cluster sites invariant after
 ///     transformation, up to a permutation
 ///
@@ -67,10 +231,11 @@ xtal::UnitCell prim_periodic_integral_cluster_frac_translation(
 std::set<IntegralCluster> make_prim_periodic_orbit(
     IntegralCluster const &orbit_element,
     std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep) {
+  IntegralCluster scratch;
   return group::make_orbit(orbit_element, unitcellcoord_symgroup_rep.begin(),
                            unitcellcoord_symgroup_rep.end(),
                            std::less<IntegralCluster>(),
-                           prim_periodic_integral_cluster_copy_apply);
+                           prim_periodic_integral_cluster_apply, scratch);
 }
 
 /// \brief Make equivalence map of factor group indices for an orbit of
@@ -94,9 +259,8 @@ std::vector<std::vector<Index>> make_prim_periodic_equivalence_map_indices(
     return eq_map_indices;
   }
   eq_map_indices =
-      group::make_equivalence_map(orbit, unitcellcoord_symgroup_rep.begin(),
-                                  unitcellcoord_symgroup_rep.end(),
-                                  prim_periodic_integral_cluster_copy_apply);
+      PackedUnitCellCoordSymGroupRep(unitcellcoord_symgroup_rep)
+          .make_prim_periodic_equivalence_map(orbit);
   return eq_map_indices;
 }
 
@@ -127,9 +291,10 @@ std::vector<std::vector<xtal::SymOp>> make_prim_periodic_equivalence_map(
   // elements transform the first element in the orbit into the
   // i-th element in the orbit.
   std::vector<std::vector<Index>> eq_map_indices =
-      group::make_equivalence_map(orbit, unitcellcoord_symgroup_rep.begin(),
-                                  unitcellcoord_symgroup_rep.end(),
-                                  prim_periodic_integral_cluster_copy_apply);
+      group::make_equivalence_map_by_cosets(
+          orbit, unitcellcoord_symgroup_rep.begin(),
+          unitcellcoord_symgroup_rep.end(), symgroup->multiplication_table,
+          prim_periodic_integral_cluster_copy_apply);
 
   // Find and add proper translations to factor group ops to make equivalence
   // map SymOp
@@ -250,37 +415,47 @@ std::vector<xtal::UnitCell> make_phenomenal_generating_translations(
 /// \param lat_column_mat The 3x3 matrix whose columns are the lattice vectors.
 /// \param unitcellcoord_symgroup_rep Symmetry group representation (as
 ///     xtal::UnitCellCoordRep) of `symgroup`.
+/// \param conjugate_prototype_group If true, make the cluster groups of
+///     orbit elements other than the prototype by conjugating the prototype
+///     cluster group. If false (default), make each cluster group by finding
+///     the translation that keeps the orbit element invariant for each
+///     operation. The result is the same either way.
 ///
 /// \returns Cluster invariant groups, where cluster_groups[i] is
 ///     the SymGroup whose operations leave the sites of the i-th cluster in the
 ///     orbit invariant (up to a permutation). The head group of the cluster
 ///     groups is set to be the head group of `symgroup`, which may be
 ///     `symgroup` itself.
+///
+/// Method, if `conjugate_prototype_group` is true:
+/// - The cluster group of the prototype (first element) is found by
+///   finding the translation that keeps it invariant for each operation.
+/// - The cluster group of the i-th orbit element is found by conjugating
+///   the prototype cluster group, `g_i * h * g_i^-1`, where `g_i` is
+///   the first equivalence map operation of the i-th element. The
+///   translation of each conjugated operation, which is a lattice
+///   translation combined with an element of `symgroup`, is rounded to
+///   the nearest lattice translation, so the result is the same as
+///   applying each operation to the i-th element.
 std::vector<std::shared_ptr<SymGroup const>> make_cluster_groups(
     std::set<IntegralCluster> const &orbit,
     std::shared_ptr<SymGroup const> const &symgroup,
     Eigen::Matrix3d const &lat_column_mat,
-    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep) {
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    bool conjugate_prototype_group) {
+  std::vector<std::shared_ptr<SymGroup const>> cluster_groups;
+  if (!orbit.size()) {
+    return cluster_groups;
+  }
+
   // The indices eq_map[i] are the indices of the group
   // elements transform the first element in the orbit into the
   // i-th element in the orbit.
   std::vector<std::vector<Index>> eq_map =
-      group::make_equivalence_map(orbit, unitcellcoord_symgroup_rep.begin(),
-                                  unitcellcoord_symgroup_rep.end(),
-                                  prim_periodic_integral_cluster_copy_apply);
-
-  // The indices subgroup_indices[i] are the indices of the group
-  // elements which leave orbit element i invariant (up to a translation).
-  std::vector<group::SubgroupIndices> subgroup_indices =
-      group::make_invariant_subgroups(eq_map, *symgroup);
-
-  // The group cluster_groups[i] contains the SymOp corresponding to
-  // subgroup_indices[i] and including the translation which keeps
-  // the i-th cluster invariant
-  std::vector<std::shared_ptr<SymGroup const>> cluster_groups;
-  auto orbit_it = orbit.begin();
-  auto subgroup_indices_it = subgroup_indices.begin();
-  auto subgroup_indices_end = subgroup_indices.end();
+      group::make_equivalence_map_by_cosets(
+          orbit, unitcellcoord_symgroup_rep.begin(),
+          unitcellcoord_symgroup_rep.end(), symgroup->multiplication_table,
+          prim_periodic_integral_cluster_copy_apply);
 
   std::shared_ptr<SymGroup const> head_group;
   if (!symgroup->head_group) {
@@ -288,23 +463,143 @@ std::vector<std::shared_ptr<SymGroup const>> make_cluster_groups(
   } else {
     head_group = symgroup->head_group;
   }
-  while (subgroup_indices_it != subgroup_indices_end) {
+
+  if (!conjugate_prototype_group) {
+    // The indices subgroup_indices[i] are the indices of the group
+    // elements which leave orbit element i invariant (up to a translation).
+    std::vector<group::SubgroupIndices> subgroup_indices =
+        group::make_invariant_subgroups(eq_map, *symgroup);
+
+    // The group cluster_groups[i] contains the SymOp corresponding to
+    // subgroup_indices[i] and including the translation which keeps
+    // the i-th cluster invariant
+    auto orbit_it = orbit.begin();
+    for (auto const &indices : subgroup_indices) {
+      std::vector<xtal::SymOp> cluster_group_elements;
+      std::set<Index> head_group_indices;
+      for (Index j : indices) {
+        cluster_group_elements.push_back(make_cluster_group_element(
+            *orbit_it, lat_column_mat, symgroup->element[j],
+            unitcellcoord_symgroup_rep[j]));
+        head_group_indices.insert(symgroup->head_group_index[j]);
+      }
+      cluster_groups.emplace_back(std::make_shared<SymGroup>(
+          head_group, cluster_group_elements, head_group_indices));
+      ++orbit_it;
+    }
+    return cluster_groups;
+  }
+
+  // The first row of eq_map is the (sorted) indices of the prototype
+  // cluster group. Include the translation which keeps the prototype
+  // invariant.
+  IntegralCluster const &prototype = *orbit.begin();
+  std::vector<Index> const &prototype_indices = eq_map[0];
+  std::vector<xtal::SymOp> prototype_elements;
+  std::set<Index> head_group_indices;
+  for (Index j : prototype_indices) {
+    prototype_elements.push_back(make_cluster_group_element(
+        prototype, lat_column_mat, symgroup->element[j],
+        unitcellcoord_symgroup_rep[j]));
+    head_group_indices.insert(symgroup->head_group_index[j]);
+  }
+  cluster_groups.emplace_back(std::make_shared<SymGroup>(
+      head_group, prototype_elements, head_group_indices));
+
+  // The group cluster_groups[i] contains the conjugated prototype cluster
+  // group elements, which keep the i-th cluster invariant, sorted by index
+  // in `symgroup`
+  Eigen::Matrix3d frac_mat = lat_column_mat.inverse();
+  std::vector<std::pair<Index, xtal::SymOp>> conjugated;
+  auto orbit_it = std::next(orbit.begin());
+  for (Index i = 1; i < eq_map.size(); ++i, ++orbit_it) {
+    if (!eq_map[i].size()) {
+      throw std::runtime_error(
+          "Error in make_cluster_groups: failed due to empty row in "
+          "equivalence_map");
+    }
+    Index e_i0 = eq_map[i][0];
+    xtal::SymOp g = make_equivalence_map_op(
+        prototype, *orbit_it, lat_column_mat, symgroup->element[e_i0],
+        unitcellcoord_symgroup_rep[e_i0]);
+    Eigen::Matrix3d g_inv_matrix = g.matrix.transpose();
+
+    conjugated.clear();
+    for (Index n = 0; n < prototype_indices.size(); ++n) {
+      Index k = symgroup->mult(
+          e_i0, symgroup->mult(prototype_indices[n], symgroup->inv(e_i0)));
+      xtal::SymOp const &h = prototype_elements[n];
+      xtal::SymOp const &group_op = symgroup->element[k];
+
+      // translation of g * h * g^-1
+      Eigen::Vector3d tau = g.translation + g.matrix * h.translation -
+                            g.matrix * h.matrix * g_inv_matrix * g.translation;
+      Eigen::Vector3d frac_trans = frac_mat * (tau - group_op.translation);
+      Eigen::Vector3d lattice_trans =
+          lat_column_mat *
+          xtal::UnitCell(std::lround(frac_trans(0)),
+                         std::lround(frac_trans(1)),
+                         std::lround(frac_trans(2)))
+              .cast<double>();
+      conjugated.emplace_back(
+          k, xtal::SymOp(Eigen::Matrix3d::Identity(), lattice_trans, false) *
+                 group_op);
+    }
+    std::sort(conjugated.begin(), conjugated.end(),
+              [](std::pair<Index, xtal::SymOp> const &A,
+                 std::pair<Index, xtal::SymOp> const &B) {
+                return A.first < B.first;
+              });
+
     std::vector<xtal::SymOp> cluster_group_elements;
-    std::set<Index> head_group_indices;
-    for (Index j : *subgroup_indices_it) {
-      cluster_group_elements.push_back(make_cluster_group_element(
-          *orbit_it, lat_column_mat, symgroup->element[j],
-          unitcellcoord_symgroup_rep[j]));
-      head_group_indices.insert(symgroup->head_group_index[j]);
+    head_group_indices.clear();
+    for (auto const &pair : conjugated) {
+      cluster_group_elements.push_back(pair.second);
+      head_group_indices.insert(symgroup->head_group_index[pair.first]);
     }
     cluster_groups.emplace_back(std::make_shared<SymGroup>(
         head_group, cluster_group_elements, head_group_indices));
-    ++subgroup_indices_it;
-    ++orbit_it;
   }
   return cluster_groups;
 }
 
+/// \brief Make groups that leave cluster orbit elements invariant, for
+///     multiple orbits
+///
+/// \param orbits Cluster orbits, generated by `symgroup`
+/// \param symgroup The group used to generate the orbits.
+/// \param lat_column_mat The 3x3 matrix whose columns are the lattice vectors.
+/// \param unitcellcoord_symgroup_rep Symmetry group representation (as
+///     xtal::UnitCellCoordRep) of `symgroup`.
+/// \param n_threads Number of threads used to process orbits. If
+///     `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`.
+/// \param conjugate_prototype_group If true, make the cluster groups of orbit
+///     elements other than the prototype by conjugating the prototype cluster
+///     group. See the single orbit `make_cluster_groups` overload.
+///
+/// \returns Cluster invariant groups, where `cluster_groups[i][j]` is the
+///     result of `make_cluster_groups` for `orbits[i]`, element `j`. The
+///     result does not depend on `n_threads`.
+std::vector<std::vector<std::shared_ptr<SymGroup const>>> make_cluster_groups(
+    std::vector<std::set<IntegralCluster>> const &orbits,
+    std::shared_ptr<SymGroup const> const &symgroup,
+    Eigen::Matrix3d const &lat_column_mat,
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    Index n_threads, bool conjugate_prototype_group) {
+  std::vector<std::vector<std::shared_ptr<SymGroup const>>> cluster_groups(
+      orbits.size());
+  config::parallel_for_chunks(
+      orbits.size(), n_threads, [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          cluster_groups[i] = make_cluster_groups(
+              orbits[i], symgroup, lat_column_mat, unitcellcoord_symgroup_rep,
+              conjugate_prototype_group);
+        }
+      });
+  return cluster_groups;
+}
+
 /// \brief Make the group which leaves a cluster invariant
 ///
 /// \param cluster A cluster
@@ -371,6 +666,18 @@ std::shared_ptr<SymGroup const> make_cluster_group(
 /// \param custom_generators A vector of custom clusters to be
 ///     included regardless of site_filter and max_length. Includes
 ///     an option to specify that subclusters should also be included.
+/// \param n_threads Number of threads used to extend clusters of each branch
+///     and to generate orbits. If `n_threads <= 0`, use the number of threads
+///     set by `config::set_num_threads`. The result does not depend on the
+///     number of threads.
+/// \param resource If not null, the upstream memory resource for the
+///     arenas that hold the clusters of each branch while orbits are
+///     generated. Each arena, and all the set nodes allocated from it, is
+///     released at once when its branch is no longer needed, rather than
+///     node by node. If null, `std::pmr::get_default_resource()` is used.
+///     If `n_threads != 1`, it is used by several threads at once and must
+///     be thread-safe, as are `std::pmr::new_delete_resource()` and
+///     `std::pmr::synchronized_pool_resource`.
 ///
 /// To generate `unitcellcoord_symgroup_rep`:
 /// \code
@@ -384,73 +691,70 @@ std::vector<std::set<IntegralCluster>> make_prim_periodic_orbits(
     std::shared_ptr<xtal::BasicStructure const> const &prim,
     std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
     SiteFilterFunction site_filter, std::vector<double> const &max_length,
-    std::vector<IntegralClusterOrbitGenerator> const &custom_generators) {
+    std::vector<IntegralClusterOrbitGenerator> const &custom_generators,
+    Index n_threads, std::pmr::memory_resource *resource) {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(make_prim_periodic_orbits);
+  CASM_CONFIGURATION_TRACE_SCOPE("make_prim_periodic_orbits");
   // collect unique orbit elements, orbit branch by orbit branch
-  typedef std::pair<ClusterInvariants, IntegralCluster> pair_type;
+  // - the clusters of each branch are held in an arena-backed set, which is
+  //   released at once when the next branch is complete
   CompareCluster_f compare_f(prim->lattice().tol());
-  std::set<pair_type, CompareCluster_f> final(compare_f);
-  std::set<pair_type, CompareCluster_f> prev_branch(compare_f);
+  std::unique_ptr<_ClusterBranch> final_branch =
+      _make_branch(compare_f, resource);
+  std::unique_ptr<_ClusterBranch> prev_branch =
+      _make_branch(compare_f, resource);
+  _ClusterBranch::set_type &final = final_branch->clusters;
 
   // include null cluster (it has been the convention in CASM)
   IntegralCluster null_cluster;
   final.emplace(ClusterInvariants(null_cluster, *prim), null_cluster);
-  prev_branch.emplace(ClusterInvariants(null_cluster, *prim), null_cluster);
+  prev_branch->clusters.emplace(ClusterInvariants(null_cluster, *prim),
+                                null_cluster);
 
-  // function to make a cluster canonical
+  // function to make a cluster canonical; all operations are applied at
+  // once using packed operation tables
+  PackedUnitCellCoordSymGroupRep packed_rep(unitcellcoord_symgroup_rep);
   auto _make_canonical = [&](IntegralCluster const &cluster) {
-    return group::make_canonical_element(
-        cluster, unitcellcoord_symgroup_rep.begin(),
-        unitcellcoord_symgroup_rep.end(), std::less<IntegralCluster>(),
-        prim_periodic_integral_cluster_copy_apply);
+    return packed_rep.make_prim_periodic_canonical_element(cluster);
   };
 
-  for (int branch = 1; branch < max_length.size(); ++branch) {
-    // generate candidate sites to be added to clusters of the previous branch
-    std::vector<xtal::UnitCellCoord> candidate_sites;
-    CandidateSitesFunction f;
-    if (branch == 1) {
-      f = origin_neighborhood();
-    } else {
-      f = max_length_neighborhood(max_length[branch]);
-    }
-    candidate_sites = f(*prim, site_filter);
-
-    // a filter function selects which clusters are allowed
-    ClusterFilterFunction cluster_filter;
-    if (branch == 1) {
-      cluster_filter = all_clusters_filter();
-    } else {
-      cluster_filter = max_length_cluster_filter(max_length[branch]);
-    }
+  // for branch >= 2, only sites within max_length of every site of a cluster
+  // can be added to it; one neighbor index is used for all branches
+  double xtal_tol = prim->lattice().tol();
+  double max_neighbor_radius = 0.0;
+  for (int branch = 2; branch < max_length.size(); ++branch) {
+    max_neighbor_radius =
+        std::max(max_neighbor_radius, max_length[branch] + xtal_tol);
+  }
+  // the site filter is evaluated once per sublattice
+  SiteFilterMask site_filter_mask = make_site_filter_mask(*prim, site_filter);
+  PrimNeighborIndex neighbor_index(*prim, max_neighbor_radius,
+                                   site_filter_mask);
 
+  for (int branch = 1; branch < max_length.size(); ++branch) {
+    CASM_CONFIGURATION_TRACE_SCOPE_ARG("make_prim_periodic_orbits.branch",
+                                       "branch", branch);
     // loop over clusters from the previous branch and add one site
     // keep the cluster if it passes the cluster filter and is unique
-    std::set<pair_type, CompareCluster_f> curr_branch(compare_f);
-    for (auto const &pair : prev_branch) {
-      for (auto const &integral_site : candidate_sites) {
-        IntegralCluster test_cluster = pair.second;
-        if (CASM::contains(test_cluster.elements(), integral_site)) {
-          continue;
-        }
-        test_cluster.elements().push_back(integral_site);
-        ClusterInvariants invariants(test_cluster, *prim);
-        if (!cluster_filter(invariants, test_cluster)) {
-          continue;
-        }
-        test_cluster = _make_canonical(test_cluster);
-        curr_branch.emplace(std::move(invariants), std::move(test_cluster));
-      }
+    std::vector<_ClusterBranch::pair_type const *> prev_clusters;
+    for (auto const &pair : prev_branch->clusters) {
+      prev_clusters.push_back(&pair);
     }
+    std::unique_ptr<_ClusterBranch> curr_branch = _extend_branch(
+        *prim, compare_f, packed_rep, &neighbor_index, site_filter_mask,
+        prev_clusters, branch, max_length[branch], 0.0, n_threads, resource);
 
     // save the previous branch
-    final.insert(prev_branch.begin(), prev_branch.end());
+    final.insert(prev_branch->clusters.begin(), prev_branch->clusters.end());
 
-    // the current branch becomes the previous branch
+    // the current branch becomes the previous branch, and the previous
+    // branch arena is released
     prev_branch = std::move(curr_branch);
   }
 
   // save the last branch
-  final.insert(prev_branch.begin(), prev_branch.end());
+  final.insert(prev_branch->clusters.begin(), prev_branch->clusters.end());
+  prev_branch.reset();
 
   // add custom generators -- filters do not apply
   for (auto const &custom_generator : custom_generators) {
@@ -472,15 +776,199 @@ std::vector<std::set<IntegralCluster>> make_prim_periodic_orbits(
   }
 
   // generate orbits from the unique clusters
-  std::vector<std::set<IntegralCluster>> orbits;
+  std::vector<IntegralCluster const *> prototypes;
   for (auto const &pair : final) {
-    orbits.emplace_back(
-        make_prim_periodic_orbit(pair.second, unitcellcoord_symgroup_rep));
+    prototypes.push_back(&pair.second);
   }
+  std::vector<std::set<IntegralCluster>> orbits(prototypes.size());
+  config::parallel_for_chunks(
+      prototypes.size(), n_threads, [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          orbits[i] = make_prim_periodic_orbit(*prototypes[i],
+                                               unitcellcoord_symgroup_rep);
+        }
+      });
 
   return orbits;
 }
 
+/// \brief Constructor
+///
+/// \param _prim The prim
+/// \param _unitcellcoord_symgroup_rep Symmetry representation for
+///     transforming xtal::UnitCellCoord, as for `make_prim_periodic_orbits`
+/// \param _site_filter Function that returns true if a xtal::Site
+///     should be included in the generated clusters
+/// \param _n_threads Number of threads used to extend clusters and to generate
+///     orbits. If `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`. The result does not depend on the number of
+///     threads.
+///
+/// The null cluster branch is generated at construction.
+PrimPeriodicOrbitGenerator::PrimPeriodicOrbitGenerator(
+    std::shared_ptr<xtal::BasicStructure const> const &_prim,
+    std::vector<xtal::UnitCellCoordRep> const &_unitcellcoord_symgroup_rep,
+    SiteFilterFunction _site_filter, Index _n_threads)
+    : m_prim(_prim),
+      m_unitcellcoord_symgroup_rep(_unitcellcoord_symgroup_rep),
+      m_site_filter_mask(make_site_filter_mask(*_prim, _site_filter)),
+      m_n_threads(_n_threads),
+      m_packed_rep(std::make_unique<PackedUnitCellCoordSymGroupRep>(
+          m_unitcellcoord_symgroup_rep)),
+      m_max_length({0.0}) {
+  // include null cluster (it has been the convention in CASM)
+  IntegralCluster null_cluster;
+  m_prototypes.emplace_back();
+  m_prototypes.back().emplace_back(ClusterInvariants(null_cluster, *_prim),
+                                   null_cluster);
+  m_orbits.push_back({std::set<IntegralCluster>({null_cluster})});
+}
+
+PrimPeriodicOrbitGenerator::~PrimPeriodicOrbitGenerator() {}
+
+/// \brief Number of branches generated, including the null cluster branch
+Index PrimPeriodicOrbitGenerator::n_branches() const {
+  return m_orbits.size();
+}
+
+/// \brief Orbits of clusters of size == branch
+std::vector<std::set<IntegralCluster>> const &
+PrimPeriodicOrbitGenerator::branch_orbits(Index branch) const {
+  if (branch < 0 || branch >= m_orbits.size()) {
+    throw std::runtime_error(
+        "Error in PrimPeriodicOrbitGenerator::branch_orbits: branch has not "
+        "been generated");
+  }
+  return m_orbits[branch];
+}
+
+/// \brief Orbits of all branches generated, in order
+///
+/// This is the same as the result of `make_prim_periodic_orbits` with
+/// `max_length()` and no custom generators.
+std::vector<std::set<IntegralCluster>> PrimPeriodicOrbitGenerator::orbits()
+    const {
+  std::vector<std::set<IntegralCluster>> all;
+  for (auto const &branch_orbits : m_orbits) {
+    all.insert(all.end(), branch_orbits.begin(), branch_orbits.end());
+  }
+  return all;
+}
+
+/// \brief Generate the next branch
+///
+/// \param max_length The maximum site-to-site distance for clusters of the
+///     next branch. Ignored when the next branch is the point cluster
+///     branch.
+///
+/// \returns The orbits of the new branch
+std::vector<std::set<IntegralCluster>> const &
+PrimPeriodicOrbitGenerator::add_branch(double max_length) {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("PrimPeriodicOrbitGenerator.add_branch",
+                                     "branch", int(m_orbits.size()));
+  Index branch = m_orbits.size();
+  m_max_length.push_back(branch == 1 ? 0.0 : max_length);
+  m_prototypes.emplace_back();
+  m_orbits.emplace_back();
+  _extend(0.0);
+  return m_orbits.back();
+}
+
+/// \brief Increase the max_length of the last branch
+///
+/// \param max_length The new maximum site-to-site distance for clusters of
+///     the last branch. Must not be less than the current value. Clusters
+///     already generated are kept, and only clusters with max site-to-site
+///     distance in `[previous max_length, max_length)` are generated.
+///
+/// \returns The orbits of the last branch
+std::vector<std::set<IntegralCluster>> const &
+PrimPeriodicOrbitGenerator::extend_cutoff(double max_length) {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("PrimPeriodicOrbitGenerator.extend_cutoff",
+                                     "branch", int(m_orbits.size() - 1));
+  if (m_orbits.size() < 3) {
+    throw std::runtime_error(
+        "Error in PrimPeriodicOrbitGenerator::extend_cutoff: the last branch "
+        "must be the pair cluster branch or higher");
+  }
+  double previous_max_length = m_max_length.back();
+  if (max_length < previous_max_length) {
+    throw std::runtime_error(
+        "Error in PrimPeriodicOrbitGenerator::extend_cutoff: max_length is "
+        "less than the current value");
+  }
+  m_max_length.back() = max_length;
+  _extend(previous_max_length);
+  return m_orbits.back();
+}
+
+/// \brief Extend the next-to-last branch into the last branch, adding
+///     clusters with max site-to-site distance not less than `min_length`
+///     to the clusters already in the last branch
+void PrimPeriodicOrbitGenerator::_extend(double min_length) {
+  Index branch = m_orbits.size() - 1;
+  double max_length = m_max_length[branch];
+  xtal::BasicStructure const &prim = *m_prim;
+  CompareCluster_f compare_f(prim.lattice().tol());
+
+  // the neighbor index is rebuilt only if the radius needed grows
+  double radius = max_length + prim.lattice().tol();
+  if (branch >= 2 &&
+      (!m_neighbor_index || m_neighbor_index->max_radius() < radius)) {
+    m_neighbor_index =
+        std::make_unique<PrimNeighborIndex>(prim, radius, m_site_filter_mask);
+  }
+
+  std::vector<_ClusterBranch::pair_type const *> prev_clusters;
+  for (auto const &pair : m_prototypes[branch - 1]) {
+    prev_clusters.push_back(&pair);
+  }
+  std::unique_ptr<_ClusterBranch> added = _extend_branch(
+      prim, compare_f, *m_packed_rep, m_neighbor_index.get(),
+      m_site_filter_mask, prev_clusters, branch, max_length, min_length,
+      m_n_threads, nullptr);
+
+  // generate orbits of the added clusters
+  std::vector<IntegralCluster const *> added_prototypes;
+  for (auto const &pair : added->clusters) {
+    added_prototypes.push_back(&pair.second);
+  }
+  std::vector<std::set<IntegralCluster>> added_orbits(added_prototypes.size());
+  config::parallel_for_chunks(
+      added_prototypes.size(), m_n_threads, [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          added_orbits[i] = make_prim_periodic_orbit(
+              *added_prototypes[i], m_unitcellcoord_symgroup_rep);
+        }
+      });
+
+  // merge with the existing orbits of the branch, in the same order as
+  // `make_prim_periodic_orbits`
+  std::vector<std::pair<ClusterInvariants, IntegralCluster>> &prototypes =
+      m_prototypes[branch];
+  std::vector<std::set<IntegralCluster>> &orbits = m_orbits[branch];
+  typedef std::pair<ClusterInvariants, IntegralCluster> pair_type;
+  std::vector<std::pair<pair_type, std::set<IntegralCluster>>> merged;
+  for (Index i = 0; i < prototypes.size(); ++i) {
+    merged.emplace_back(std::move(prototypes[i]), std::move(orbits[i]));
+  }
+  Index i = 0;
+  for (auto const &pair : added->clusters) {
+    merged.emplace_back(pair, std::move(added_orbits[i]));
+    ++i;
+  }
+  std::stable_sort(merged.begin(), merged.end(),
+                   [&](auto const &A, auto const &B) {
+                     return compare_f(A.first, B.first);
+                   });
+  prototypes.clear();
+  orbits.clear();
+  for (auto &value : merged) {
+    prototypes.push_back(std::move(value.first));
+    orbits.push_back(std::move(value.second));
+  }
+}
+
 /// \brief Convert orbits of IntegralCluster to orbits of linear site
 ///     indices in a supercell
 ///
@@ -540,6 +1028,27 @@ IntegralCluster local_integral_cluster_copy_apply(
   return clust;
 }
 
+/// \brief Apply symmetry operation transformation to a local cluster,
+///     writing the result into an existing cluster
+///
+/// \param op, Symmetry operation representation to be applied
+/// \param clust, Cluster to transform
+/// \param result, Set to the transformed cluster, sorted. Its existing
+///     storage is reused.
+///
+/// \return A reference to `result`
+IntegralCluster &local_integral_cluster_apply(xtal::UnitCellCoordRep const &op,
+                                              IntegralCluster const &clust,
+                                              IntegralCluster &result) {
+  result = clust;
+  if (!result.size()) {
+    return result;
+  }
+  apply(op, result);
+  result.sort();
+  return result;
+}
+
 /// \brief Make an orbit of local clusters
 ///
 /// \param orbit_element One cluster in the orbit
@@ -549,10 +1058,11 @@ IntegralCluster local_integral_cluster_copy_apply(
 std::set<IntegralCluster> make_local_orbit(
     IntegralCluster const &orbit_element,
     std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep) {
+  IntegralCluster scratch;
   return group::make_orbit(orbit_element, unitcellcoord_symgroup_rep.begin(),
                            unitcellcoord_symgroup_rep.end(),
                            std::less<IntegralCluster>(),
-                           local_integral_cluster_copy_apply);
+                           local_integral_cluster_apply, scratch);
 }
 
 /// \brief Make equivalence map of phenomenal group indices for an orbit of
@@ -573,9 +1083,8 @@ std::vector<std::vector<Index>> make_local_equivalence_map_indices(
   if (orbit.size() == 0) {
     return eq_map_indices;
   }
-  eq_map_indices = group::make_equivalence_map(
-      orbit, unitcellcoord_symgroup_rep.begin(),
-      unitcellcoord_symgroup_rep.end(), local_integral_cluster_copy_apply);
+  eq_map_indices = PackedUnitCellCoordSymGroupRep(unitcellcoord_symgroup_rep)
+                       .make_local_equivalence_map(orbit);
   return eq_map_indices;
 }
 
@@ -603,9 +1112,12 @@ std::vector<std::vector<xtal::SymOp>> make_local_equivalence_map(
   // The indices eq_map[i] are the indices into the phenomenal group of the
   // elements transform the first element in the orbit into the
   // i-th element in the orbit.
-  std::vector<std::vector<Index>> eq_map_indices = group::make_equivalence_map(
-      orbit, unitcellcoord_symgroup_rep.begin(),
-      unitcellcoord_symgroup_rep.end(), local_integral_cluster_copy_apply);
+  std::vector<std::vector<Index>> eq_map_indices =
+      group::make_equivalence_map_by_cosets(
+          orbit, unitcellcoord_symgroup_rep.begin(),
+          unitcellcoord_symgroup_rep.end(),
+          phenomenal_group->multiplication_table,
+          local_integral_cluster_copy_apply);
 
   for (auto const &coset_indices : eq_map_indices) {
     std::vector<xtal::SymOp> coset_ops;
@@ -642,9 +1154,12 @@ std::vector<std::shared_ptr<SymGroup const>> make_local_cluster_groups(
   // The indices eq_map[i] are the indices of the group
   // elements transform the first element in the orbit into the
   // i-th element in the orbit.
-  std::vector<std::vector<Index>> eq_map = group::make_equivalence_map(
-      orbit, unitcellcoord_symgroup_rep.begin(),
-      unitcellcoord_symgroup_rep.end(), local_integral_cluster_copy_apply);
+  std::vector<std::vector<Index>> eq_map =
+      group::make_equivalence_map_by_cosets(
+          orbit, unitcellcoord_symgroup_rep.begin(),
+          unitcellcoord_symgroup_rep.end(),
+          phenomenal_group->multiplication_table,
+          local_integral_cluster_copy_apply);
 
   // The indices subgroup_indices[i] are the indices of the group
   // elements which leave orbit element i invariant.
@@ -673,6 +1188,44 @@ std::vector<std::shared_ptr<SymGroup const>> make_local_cluster_groups(
   return cluster_groups;
 }
 
+/// \brief Make groups that leave cluster orbit elements invariant, for
+///     multiple orbits of local clusters
+///
+/// \param orbits Local cluster orbits, generated by `phenomenal_group`
+/// \param phenomenal_group The phenomenal cluster group used to generate the
+///     orbits.
+/// \param unitcellcoord_symgroup_rep Symmetry group representation (as
+///     xtal::UnitCellCoordRep)
+/// \param n_threads Number of threads used to process orbits. If
+///     `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`.
+///
+/// \returns Cluster invariant groups, where `cluster_groups[i][j]` is the
+///     result of `make_local_cluster_groups` for `orbits[i]`, element `j`.
+///     The result does not depend on `n_threads`.
+std::vector<std::vector<std::shared_ptr<SymGroup const>>>
+make_local_cluster_groups(
+    std::vector<std::set<IntegralCluster>> const &orbits,
+    std::shared_ptr<SymGroup const> const &phenomenal_group,
+    std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
+    Index n_threads) {
+  if (!phenomenal_group->head_group) {
+    throw std::runtime_error(
+        "Error in make_local_cluster_groups: "
+        "phenomenal group has no head group");
+  }
+  std::vector<std::vector<std::shared_ptr<SymGroup const>>> cluster_groups(
+      orbits.size());
+  config::parallel_for_chunks(
+      orbits.size(), n_threads, [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          cluster_groups[i] = make_local_cluster_groups(
+              orbits[i], phenomenal_group, unitcellcoord_symgroup_rep);
+        }
+      });
+  return cluster_groups;
+}
+
 /// \brief Make the group that leaves a local cluster invariant
 ///
 /// \param cluster A local cluster
@@ -790,39 +1343,65 @@ std::shared_ptr<SymGroup const> make_local_cluster_group(
 ///         cluster_group->element, *prim);
 /// \endcode
 ///
+/// \param resource If not null, the upstream memory resource for the
+///     arenas that hold the clusters of each branch while orbits are
+///     generated, as for `make_prim_periodic_orbits`. If null,
+///     `std::pmr::get_default_resource()` is used.
+///
 std::vector<std::set<IntegralCluster>> make_local_orbits(
     std::shared_ptr<xtal::BasicStructure const> const &prim,
     std::vector<xtal::UnitCellCoordRep> const &unitcellcoord_symgroup_rep,
     SiteFilterFunction site_filter, std::vector<double> const &max_length,
     std::vector<IntegralClusterOrbitGenerator> const &custom_generators,
     IntegralCluster const &phenomenal, std::vector<double> const &cutoff_radius,
-    bool include_phenomenal_sites) {
+    bool include_phenomenal_sites, std::pmr::memory_resource *resource) {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(make_local_orbits);
+  CASM_CONFIGURATION_TRACE_SCOPE("make_local_orbits");
   // collect unique orbit elements, orbit branch by orbit branch
-  typedef std::pair<ClusterInvariants, IntegralCluster> pair_type;
+  // - the clusters of each branch are held in an arena-backed set, which is
+  //   released at once when the next branch is complete
   CompareCluster_f compare_f(prim->lattice().tol());
-  std::set<pair_type, CompareCluster_f> final(compare_f);
-  std::set<pair_type, CompareCluster_f> prev_branch(compare_f);
+  std::unique_ptr<_ClusterBranch> final_branch =
+      _make_branch(compare_f, resource);
+  std::unique_ptr<_ClusterBranch> prev_branch =
+      _make_branch(compare_f, resource);
+  _ClusterBranch::set_type &final = final_branch->clusters;
 
   // include null cluster (it has been the convention in CASM)
   IntegralCluster null_cluster;
   final.emplace(ClusterInvariants(null_cluster, phenomenal, *prim),
                 null_cluster);
-  prev_branch.emplace(ClusterInvariants(null_cluster, phenomenal, *prim),
-                      null_cluster);
+  prev_branch->clusters.emplace(
+      ClusterInvariants(null_cluster, phenomenal, *prim), null_cluster);
 
-  // function to make a cluster canonical
+  // function to make a cluster canonical; all operations are applied at
+  // once using packed operation tables
+  PackedUnitCellCoordSymGroupRep packed_rep(unitcellcoord_symgroup_rep);
   auto _make_canonical = [&](IntegralCluster const &cluster) {
-    return group::make_canonical_element(
-        cluster, unitcellcoord_symgroup_rep.begin(),
-        unitcellcoord_symgroup_rep.end(), std::less<IntegralCluster>(),
-        local_integral_cluster_copy_apply);
+    return packed_rep.make_local_canonical_element(cluster);
   };
 
+  // candidate sites are within cutoff_radius of the phenomenal cluster and,
+  // for branch >= 2, within max_length of every site of the cluster they are
+  // added to; one neighbor index is used for all branches
+  double xtal_tol = prim->lattice().tol();
+  double max_neighbor_radius = 0.0;
+  for (int branch = 1; branch < max_length.size(); ++branch) {
+    max_neighbor_radius = std::max(max_neighbor_radius, cutoff_radius[branch]);
+    if (branch >= 2) {
+      max_neighbor_radius =
+          std::max(max_neighbor_radius, max_length[branch] + xtal_tol);
+    }
+  }
+  PrimNeighborIndex neighbor_index(*prim, max_neighbor_radius,
+                                   make_site_filter_mask(*prim, site_filter));
+
   for (int branch = 1; branch < max_length.size(); ++branch) {
     // generate candidate sites to be added to clusters of the previous branch
-    CandidateSitesFunction f = cutoff_radius_neighborhood(
-        phenomenal, cutoff_radius[branch], include_phenomenal_sites);
-    std::vector<xtal::UnitCellCoord> candidate_sites = f(*prim, site_filter);
+    std::vector<xtal::UnitCellCoord> candidate_sites =
+        make_cutoff_radius_neighborhood(neighbor_index, phenomenal,
+                                        cutoff_radius[branch],
+                                        include_phenomenal_sites);
 
     // a filter function selects which clusters are allowed
     ClusterFilterFunction cluster_filter;
@@ -834,32 +1413,54 @@ std::vector<std::set<IntegralCluster>> make_local_orbits(
 
     // loop over clusters from the previous branch and add one site
     // keep the cluster if it passes the cluster filter and is unique
-    std::set<pair_type, CompareCluster_f> curr_branch(compare_f);
-    for (auto const &pair : prev_branch) {
-      for (auto const &integral_site : candidate_sites) {
-        IntegralCluster test_cluster = pair.second;
-        if (CASM::contains(test_cluster.elements(), integral_site)) {
+    std::unique_ptr<_ClusterBranch> curr_branch =
+        _make_branch(compare_f, resource);
+    std::vector<xtal::UnitCellCoord> cluster_candidate_sites;
+    for (auto const &pair : prev_branch->clusters) {
+      ClusterInvariants const &prev_invariants = pair.first;
+      if (branch != 1) {
+        cluster_candidate_sites.clear();
+        for (auto const &site : neighbor_index.sites_within_all(
+                 pair.second, max_length[branch] + xtal_tol)) {
+          if (std::binary_search(candidate_sites.begin(),
+                                 candidate_sites.end(), site)) {
+            cluster_candidate_sites.push_back(site);
+          }
+        }
+      }
+      for (auto const &integral_site :
+           (branch == 1 ? candidate_sites : cluster_candidate_sites)) {
+        if (CASM::contains(pair.second.elements(), integral_site)) {
           continue;
         }
+        ClusterInvariants invariants(prev_invariants, pair.second,
+                                     integral_site, phenomenal, *prim);
+        IntegralCluster test_cluster = pair.second;
         test_cluster.elements().push_back(integral_site);
-        ClusterInvariants invariants(test_cluster, phenomenal, *prim);
         if (!cluster_filter(invariants, test_cluster)) {
           continue;
         }
+        CASM_CONFIGURATION_PERF_COUNT(orbit_candidate_tested);
         test_cluster = _make_canonical(test_cluster);
-        curr_branch.emplace(std::move(invariants), std::move(test_cluster));
+        curr_branch->clusters.emplace(std::move(invariants),
+                                      std::move(test_cluster));
       }
     }
 
+    CASM_CONFIGURATION_PERF_COUNT_N(orbit_candidate_kept,
+                                    curr_branch->clusters.size());
+
     // save the previous branch
-    final.insert(prev_branch.begin(), prev_branch.end());
+    final.insert(prev_branch->clusters.begin(), prev_branch->clusters.end());
 
-    // the current branch becomes the previous branch
+    // the current branch becomes the previous branch, and the previous
+    // branch arena is released
     prev_branch = std::move(curr_branch);
   }
 
   // save the last branch
-  final.insert(prev_branch.begin(), prev_branch.end());
+  final.insert(prev_branch->clusters.begin(), prev_branch->clusters.end());
+  prev_branch.reset();
 
   // add custom generators -- filters do not apply
   for (auto const &custom_generator : custom_generators) {
@@ -890,5 +1491,54 @@ std::vector<std::set<IntegralCluster>> make_local_orbits(
   return orbits;
 }
 
+/// \brief Transform local-cluster orbits to the orbits around an equivalent
+///     phenomenal cluster
+///
+/// \param local_orbits Local-cluster orbits around a phenomenal cluster, as
+///     generated by `make_local_orbits`
+/// \param op A prim factor group operation, as xtal::UnitCellCoordRep
+/// \param translation A lattice translation applied after `op`
+///
+/// \returns The orbits of `translation * op * cluster`, for clusters in
+///     `local_orbits`. If the phenomenal cluster maps to an equivalent
+///     phenomenal cluster, these are the local-cluster orbits around the
+///     equivalent phenomenal cluster under its own invariant group, in the
+///     same order as `local_orbits`, so that orbit `i` of each corresponds.
+///     Generating them this way avoids repeating the neighborhood and orbit
+///     generation done by `make_local_orbits`.
+std::vector<std::set<IntegralCluster>> make_equivalent_local_orbits(
+    std::vector<std::set<IntegralCluster>> const &local_orbits,
+    xtal::UnitCellCoordRep const &op, xtal::UnitCell const &translation) {
+  std::vector<std::set<IntegralCluster>> result;
+  result.reserve(local_orbits.size());
+  for (auto const &orbit : local_orbits) {
+    std::set<IntegralCluster> equivalent_orbit;
+    for (auto const &cluster : orbit) {
+      IntegralCluster equiv = local_integral_cluster_copy_apply(op, cluster);
+      equiv += translation;
+      equivalent_orbit.insert(std::move(equiv));
+    }
+    result.push_back(std::move(equivalent_orbit));
+  }
+  return result;
+}
+
+/// \brief Estimate the memory used by orbits of clusters, in bytes
+///
+/// Includes the orbit vector, the `std::set` nodes, with allocator overhead
+/// approximated, and the sites of each cluster.
+Index memory_usage(std::vector<std::set<IntegralCluster>> const &orbits) {
+  Index set_node_bytes = 4 * sizeof(void *);
+  Index bytes = sizeof(orbits) +
+                orbits.capacity() * sizeof(std::set<IntegralCluster>);
+  for (auto const &orbit : orbits) {
+    for (auto const &cluster : orbit) {
+      bytes += set_node_bytes + sizeof(IntegralCluster) +
+               cluster.elements().capacity() * sizeof(xtal::UnitCellCoord);
+    }
+  }
+  return bytes;
+}
+
 }  // namespace clust
 }  // namespace CASM
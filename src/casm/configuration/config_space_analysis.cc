@@ -1,14 +1,347 @@
 #include "casm/configuration/config_space_analysis.hh"
 
+#include <cmath>
+#include <map>
+#include <sstream>
+
 #include "casm/configuration/DoFSpace_functions.hh"
+#include "casm/configuration/InvariantSubgroupEngine.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/canonical_form.hh"
 #include "casm/configuration/copy_configuration.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/configuration/perf.hh"
+#include "casm/configuration/trace.hh"
 #include "casm/crystallography/CanonicalForm.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
 
 namespace CASM {
 namespace config {
 
+namespace {
+
+/// \brief Number of equivalent configurations whose normal coordinates are
+///     constructed together before being accumulated into the projector
+///
+/// Memory used for normal coordinates is limited to (batch size x dim). The
+/// batch size does not depend on the number of threads.
+Index const equivalents_batch_size = 256;
+
+/// \brief Return normal coordinates, with values almost zero set to zero
+Eigen::VectorXd _make_normal_coordinate(
+    clexulator::ConfigDoFValues const &dof_values,
+    Eigen::Matrix3l const &transformation_matrix_to_super,
+    clexulator::DoFSpace const &dof_space, double tol) {
+  Eigen::VectorXd x = get_normal_coordinate(
+      dof_values, transformation_matrix_to_super, dof_space);
+  for (int i = 0; i < x.size(); ++i) {
+    if (almost_zero(x(i), tol)) {
+      x(i) = 0.0;
+    }
+  }
+  return x;
+}
+
+/// \brief Accumulate `P += x * x.transpose()` for the normal coordinates
+///     of `n_items` equivalent configurations
+///
+/// \param P The projector
+/// \param n_items Number of equivalent configurations
+/// \param make_x_f Function, `Eigen::VectorXd make_x_f(Index item,
+///     SupercellSymOpApplier &applier)`, returning the normal coordinates of
+///     an equivalent configuration. Must be safe to call concurrently.
+/// \param n_threads Number of threads
+/// \param equiv_x If not null, normal coordinates are appended
+///
+/// Method:
+/// - Items are processed in batches of `equivalents_batch_size`.
+/// - For each batch, normal coordinates are made in parallel. Then
+///   the rows of `P` are divided among threads, and each thread adds
+///   the contributions of all items in the batch, in order, to its rows.
+/// - Each element of `P` accumulates contributions in the order of
+///   `item`, so the result does not depend on `n_threads`.
+template <typename MakeNormalCoordinateF>
+void _accumulate_projector(Eigen::MatrixXd &P, Index n_items,
+                           MakeNormalCoordinateF make_x_f, Index n_threads,
+                           std::vector<Eigen::VectorXd> *equiv_x) {
+  std::vector<Eigen::VectorXd> batch_x;
+  for (Index batch_begin = 0; batch_begin < n_items;
+       batch_begin += equivalents_batch_size) {
+    Index batch_end = std::min(batch_begin + equivalents_batch_size, n_items);
+    batch_x.resize(batch_end - batch_begin);
+    parallel_for_chunks(
+        batch_x.size(), n_threads, [&](Index chunk_begin, Index chunk_end) {
+          SupercellSymOpApplier applier;
+          for (Index i = chunk_begin; i < chunk_end; ++i) {
+            batch_x[i] = make_x_f(batch_begin + i, applier);
+          }
+        });
+    parallel_for_chunks(
+        P.rows(), n_threads, [&](Index row_begin, Index row_end) {
+          for (Index i = row_begin; i < row_end; ++i) {
+            for (Eigen::VectorXd const &x : batch_x) {
+              if (x(i) != 0.0) {
+                P.row(i) += x(i) * x.transpose();
+              }
+            }
+          }
+        });
+    if (equiv_x) {
+      equiv_x->insert(equiv_x->end(), batch_x.begin(), batch_x.end());
+    }
+  }
+}
+
+
+/// \brief Primitive, canonical configurations, with the identifier of the
+///     first input configuration that generates each
+std::map<Configuration, std::string> _make_prim_configs(
+    std::map<std::string, Configuration> const &configurations) {
+  // prim config -> ID (might be duplicates from input configurations)
+  std::map<Configuration, std::string> prim_configs;
+  for (auto const &pair : configurations) {
+    prim_configs.emplace(
+        make_in_canonical_supercell(make_primitive(pair.second)), pair.first);
+  }
+  return prim_configs;
+}
+
+/// \brief Make the fully commensurate superlattice used by
+///     `config_space_analysis`, with the checks of
+///     `make_config_space_analysis_supercell`
+xtal::Lattice _make_config_space_analysis_superlattice(
+    std::map<std::string, Configuration> const &configurations,
+    std::optional<Index> max_supercell_volume) {
+  std::shared_ptr<Prim const> prim =
+      configurations.begin()->second.supercell->prim;
+  std::map<Configuration, std::string> prim_configs =
+      _make_prim_configs(configurations);
+
+  std::set<xtal::Lattice> lattices;
+  for (auto const &pair : prim_configs) {
+    lattices.insert(pair.first.supercell->superlattice.superlattice());
+  }
+  auto const &fg = prim->sym_info.factor_group->element;
+  xtal::Lattice super_lat = xtal::make_fully_commensurate_superduperlattice(
+      lattices.begin(), lattices.end(), fg.begin(), fg.end());
+  auto const &pg = prim->sym_info.point_group->element;
+  super_lat = xtal::canonical::equivalent(super_lat, pg);
+  if (max_supercell_volume.has_value()) {
+    Index volume = std::lround(std::abs(
+        super_lat.volume() / prim->basicstructure->lattice().volume()));
+    if (volume > *max_supercell_volume) {
+      std::stringstream msg;
+      msg << "Error in config_space_analysis: fully commensurate supercell "
+          << "volume (" << volume << ") is greater than max_supercell_volume ("
+          << *max_supercell_volume << ")";
+      throw std::runtime_error(msg.str());
+    }
+  }
+  return super_lat;
+}
+
+/// \brief Construct the standard DoF space in the fully commensurate
+///     supercell
+clexulator::DoFSpace _make_standard_dof_space(
+    DoFKey const &dof_key, Supercell const &supercell,
+    std::optional<bool> exclude_homogeneous_modes,
+    bool include_default_occ_modes,
+    std::optional<std::map<int, int>> const &sublattice_index_to_default_occ,
+    std::optional<std::map<Index, int>> const &site_index_to_default_occ,
+    Index n_threads) {
+  clexulator::DoFSpace dof_space_pre2 = clexulator::make_dof_space(
+      dof_key, supercell.prim->basicstructure,
+      supercell.superlattice.transformation_matrix_to_super());
+
+  clexulator::DoFSpace dof_space_pre1 = exclude_homogeneous_mode_space(
+      dof_space_pre2, exclude_homogeneous_modes);
+
+  return exclude_default_occ_modes(
+      dof_space_pre1, include_default_occ_modes,
+      sublattice_index_to_default_occ, site_index_to_default_occ, n_threads);
+}
+
+/// \brief Accumulate the projector contributions of the distinct
+///     equivalents of `prototype`, without storing them
+void _accumulate_prototype(Eigen::MatrixXd &P, Configuration const &prototype,
+                           InvariantSubgroupEngine const &engine,
+                           clexulator::DoFSpace const &standard_dof_space,
+                           double tol, Index n_threads) {
+  Eigen::Matrix3l const &T =
+      prototype.supercell->superlattice.transformation_matrix_to_super();
+
+  // one operation per left coset of the invariant subgroup gives
+  // each distinct equivalent configuration once
+  std::vector<SupercellSymOp> reps = engine.make_left_coset_representatives(
+      engine.make_invariant_subgroup(prototype));
+  _accumulate_projector(
+      P, reps.size(),
+      [&](Index i, SupercellSymOpApplier &applier) {
+        return _make_normal_coordinate(
+            applier.copy_apply(reps[i], prototype.dof_values), T,
+            standard_dof_space, tol);
+      },
+      n_threads, nullptr);
+}
+
+/// \brief Matrix, W, that maps DoF vector values in the smaller supercell
+///     to normal coordinates in `standard_dof_space`, after tiling
+///
+/// For a configuration, y, in the smaller supercell, with DoF vector value
+/// `v_sub(y)` in the axes of `sub_dof_space`, which must include all axes,
+/// the configuration that tiles the larger supercell has normal
+/// coordinates `x = W * v_sub(y)` in `standard_dof_space`.
+Eigen::MatrixXd _make_tiling_matrix(
+    clexulator::DoFSpace const &standard_dof_space,
+    clexulator::DoFSpace const &sub_dof_space,
+    xtal::UnitCellCoordIndexConverter const &sub_converter, Index n_basis) {
+  Eigen::MatrixXd const &basis_inv = standard_dof_space.basis_inv;
+  Eigen::MatrixXd W =
+      Eigen::MatrixXd::Zero(basis_inv.rows(), sub_dof_space.basis.rows());
+  auto const &site_index = standard_dof_space.axis_info.site_index;
+  if (!site_index.has_value()) {
+    // global DoF: tiling does not change the values
+    if (W.cols() != basis_inv.cols()) {
+      throw std::runtime_error(
+          "Error in config_space_analysis: global DoF axes mismatch");
+    }
+    return basis_inv;
+  }
+
+  // (site index, DoF component) -> axis, in the smaller supercell
+  auto const &sub_site_index = *sub_dof_space.axis_info.site_index;
+  auto const &sub_component = *sub_dof_space.axis_info.dof_component;
+  std::map<std::pair<Index, Index>, Index> sub_axis;
+  for (Index a = 0; a < Index(sub_site_index.size()); ++a) {
+    sub_axis.emplace(std::make_pair(sub_site_index[a], sub_component[a]), a);
+  }
+
+  xtal::UnitCellCoordIndexConverter converter(
+      standard_dof_space.transformation_matrix_to_super, n_basis);
+  auto const &component = *standard_dof_space.axis_info.dof_component;
+  for (Index a = 0; a < Index(site_index->size()); ++a) {
+    Index l_sub = sub_converter(converter((*site_index)[a]));
+    auto it = sub_axis.find(std::make_pair(l_sub, component[a]));
+    if (it == sub_axis.end()) {
+      throw std::runtime_error(
+          "Error in config_space_analysis: tiling axis not found");
+    }
+    W.col(it->second) += basis_inv.col(a);
+  }
+  return W;
+}
+
+/// \brief Accumulate the projector contributions of the distinct
+///     equivalents of `prim_config`, using the smallest supercell that is
+///     commensurate with all of them
+///
+/// The distinct equivalents in the fully commensurate supercell are
+/// exactly the tilings of the distinct equivalents in the smallest
+/// supercell commensurate with `prim_config` and its point group images,
+/// because that supercell is invariant under the point group. So their
+/// contribution, `sum_y x(y) * x(y)^T`, is `W * Q * W^T`, where Q is the
+/// same sum over DoF vector values in the smaller supercell, and W maps
+/// them into the standard DoF space by `_make_tiling_matrix`. The fully
+/// commensurate supercell, its symmetry operations, and the equivalent
+/// configurations in it are never constructed.
+void _accumulate_prototype_by_tiling(
+    Eigen::MatrixXd &P, Configuration const &prim_config,
+    clexulator::DoFSpace const &standard_dof_space, double tol,
+    Index n_threads) {
+  std::shared_ptr<Prim const> const &prim = prim_config.supercell->prim;
+  auto const &fg = prim->sym_info.factor_group->element;
+  std::vector<xtal::Lattice> lattices(
+      {prim_config.supercell->superlattice.superlattice()});
+  xtal::Lattice sub_lattice = xtal::make_fully_commensurate_superduperlattice(
+      lattices.begin(), lattices.end(), fg.begin(), fg.end());
+  auto sub_supercell = std::make_shared<Supercell const>(prim, sub_lattice);
+  Eigen::Matrix3l const &T_sub =
+      sub_supercell->superlattice.transformation_matrix_to_super();
+
+  // check that the standard DoF space supercell tiles the smaller supercell
+  Eigen::Matrix3d R = T_sub.cast<double>().inverse() *
+                      standard_dof_space.transformation_matrix_to_super
+                          .cast<double>();
+  if ((R - R.array().round().matrix()).cwiseAbs().maxCoeff() > tol) {
+    throw std::runtime_error(
+        "Error in config_space_analysis: fully commensurate supercell is not a "
+        "superlattice of the prototype supercell");
+  }
+
+  clexulator::DoFSpace sub_dof_space = clexulator::make_dof_space(
+      standard_dof_space.dof_key, prim->basicstructure, T_sub);
+  Eigen::MatrixXd Q = Eigen::MatrixXd::Zero(sub_dof_space.basis.cols(),
+                                            sub_dof_space.basis.cols());
+  Configuration prototype = copy_configuration(prim_config, sub_supercell);
+  InvariantSubgroupEngine engine(sub_supercell);
+  _accumulate_prototype(Q, prototype, engine, sub_dof_space, tol, n_threads);
+
+  Eigen::MatrixXd W = _make_tiling_matrix(
+      standard_dof_space, sub_dof_space,
+      sub_supercell->unitcellcoord_index_converter,
+      prim->basicstructure->basis().size());
+  Eigen::MatrixXd WB = W * sub_dof_space.basis;
+  P += WB * Q * WB.transpose();
+}
+
+/// \brief Find the symmetry adapted config space from the projector
+ConfigSpaceAnalysisResults _make_results(
+    clexulator::DoFSpace const &standard_dof_space,
+    std::map<std::string, std::vector<Eigen::VectorXd>> equivalent_dof_values,
+    std::map<std::string, std::vector<Configuration>>
+        equivalent_configurations,
+    Eigen::MatrixXd P, double tol) {
+  // clean up P?
+  for (int i = 0; i < P.rows(); ++i) {
+    for (int j = 0; j < P.cols(); ++j) {
+      if (almost_zero(P(i, j), tol)) {
+        P(i, j) = 0.0;
+      }
+    }
+  }
+
+  // --- Eigendecomposition of P ---
+  CASM_CONFIGURATION_TRACE_SCOPE("config_space_analysis.eigendecomposition");
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(P);
+  Eigen::VectorXd D = solver.eigenvalues();
+  Eigen::MatrixXd V = solver.eigenvectors();
+
+  // --- Identify non-zero eigenvalues and corresponding eigenvectors ---
+  Eigen::VectorXd D_nonzero(D.size());
+  Eigen::MatrixXd V_nonzero(P.rows(), P.cols());
+
+  int i_nonzero = 0;
+  for (int i = 0; i < D.size(); ++i) {
+    if (!almost_zero(D(i), tol)) {
+      D_nonzero(i_nonzero) = D(i);
+      V_nonzero.col(i_nonzero) = V.col(i);
+      ++i_nonzero;
+    }
+  }
+
+  if (i_nonzero == 0) {
+    throw std::runtime_error(
+        "Error in config_space_analysis: symmetry adapted config space is "
+        "null");
+  }
+
+  // --- Store results ---
+  Eigen::VectorXd eigenvalues = D_nonzero.head(i_nonzero);
+
+  clexulator::DoFSpace symmetry_adapted_dof_space = clexulator::make_dof_space(
+      standard_dof_space.dof_key, standard_dof_space.prim,
+      standard_dof_space.transformation_matrix_to_super,
+      standard_dof_space.sites,
+      standard_dof_space.basis * V_nonzero.leftCols(i_nonzero));
+
+  return ConfigSpaceAnalysisResults(
+      standard_dof_space, std::move(equivalent_dof_values),
+      std::move(equivalent_configurations), P, eigenvalues,
+      symmetry_adapted_dof_space);
+}
+
+}  // namespace
+
 ConfigSpaceAnalysisResults::ConfigSpaceAnalysisResults(
     clexulator::DoFSpace const &_standard_dof_space,
     std::map<std::string, std::vector<Eigen::VectorXd>> _equivalent_dof_values,
@@ -60,6 +393,29 @@ ConfigSpaceAnalysisResults::ConfigSpaceAnalysisResults(
 /// \param site_index_to_default_occ Optional values of default
 ///     occupation index (value), specified by supercell site index (key).
 /// \param tol Tolerance used for identifying zero-valued eigenvalues.
+/// \param store_equivalents If true (default), store the equivalent
+///     configurations and their DoF values in the results. If false, the
+///     projector is accumulated while equivalent configurations are
+///     generated, one per left coset of each configuration's invariant
+///     subgroup, and they are not stored. The projector is the same, up to
+///     floating point rounding, but memory usage does not increase with the
+///     number of equivalent configurations.
+/// \param n_threads Number of threads used to construct normal coordinates and
+///     accumulate the projector. If `n_threads <= 0`, use the number of threads
+///     set by `set_num_threads`. The result does not depend on `n_threads`.
+/// \param max_supercell_volume If provided, throw before constructing the
+///     fully commensurate supercell if its volume, as a multiple of the prim
+///     volume, is greater than this value.
+/// \param use_prototype_supercells If true, each configuration's
+///     equivalents are generated in the smallest supercell commensurate
+///     with it and its point group images, and their projector
+///     contributions are mapped into the standard DoF space of the fully
+///     commensurate supercell, which is only used for its transformation
+///     matrix. This avoids generating equivalent configurations, and the
+///     symmetry operations, in the fully commensurate supercell, which may
+///     be much larger when input configurations have incompatible shapes.
+///     The projector is the same, up to floating point rounding. Requires
+///     `store_equivalents == false`.
 ///
 /// \returns Results, including project, eigenvalues, and symmetry
 ///     adapted basis, for each requested DoF type.
@@ -69,51 +425,66 @@ std::map<DoFKey, ConfigSpaceAnalysisResults> config_space_analysis(
     std::optional<bool> exclude_homogeneous_modes,
     bool include_default_occ_modes,
     std::optional<std::map<int, int>> sublattice_index_to_default_occ,
-    std::optional<std::map<Index, int>> site_index_to_default_occ, double tol) {
+    std::optional<std::map<Index, int>> site_index_to_default_occ, double tol,
+    bool store_equivalents, Index n_threads,
+    std::optional<Index> max_supercell_volume, bool use_prototype_supercells) {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(config_space_analysis);
+  CASM_CONFIGURATION_TRACE_SCOPE("config_space_analysis");
   std::map<DoFKey, ConfigSpaceAnalysisResults> results;
 
   if (configurations.size() == 0) {
     return results;
   }
-  std::shared_ptr<Prim const> prim =
-      configurations.begin()->second.supercell->prim;
-  if (!dofs.has_value()) {
-    dofs = all_dof_types(*prim->basicstructure);
+  if (use_prototype_supercells) {
+    if (store_equivalents) {
+      throw std::runtime_error(
+          "Error in config_space_analysis: use_prototype_supercells requires "
+          "store_equivalents == false");
+    }
+    // only the prim and transformation matrix of the fully commensurate
+    // supercell are used, so skip the translation permutations
+    std::shared_ptr<Supercell const> shared_supercell =
+        std::make_shared<Supercell const>(
+            configurations.begin()->second.supercell->prim,
+            _make_config_space_analysis_superlattice(configurations,
+                                                     max_supercell_volume),
+            0, 0);
+    return finish_config_space_analysis(
+        config_space_analysis_partial(
+            shared_supercell, configurations, dofs, exclude_homogeneous_modes,
+            include_default_occ_modes, sublattice_index_to_default_occ,
+            site_index_to_default_occ, tol, n_threads, true),
+        tol);
   }
-
-  // --- Generate primitive configurations ---
-  // prim config -> ID (might be duplicates from input configurations)
-  std::map<Configuration, std::string> prim_configs;
-  for (auto const &pair : configurations) {
-    prim_configs.emplace(
-        make_in_canonical_supercell(make_primitive(pair.second)), pair.first);
+  std::shared_ptr<Supercell const> shared_supercell =
+      make_config_space_analysis_supercell(configurations,
+                                           max_supercell_volume);
+  if (!store_equivalents) {
+    return finish_config_space_analysis(
+        config_space_analysis_partial(
+            shared_supercell, configurations, dofs, exclude_homogeneous_modes,
+            include_default_occ_modes, sublattice_index_to_default_occ,
+            site_index_to_default_occ, tol, n_threads),
+        tol);
   }
 
-  // --- Generate fully commensurate supercell ---
-  std::set<xtal::Lattice> lattices;
-  for (auto const &pair : prim_configs) {
-    lattices.insert(pair.first.supercell->superlattice.superlattice());
+  std::shared_ptr<Prim const> prim = shared_supercell->prim;
+  if (!dofs.has_value()) {
+    dofs = all_dof_types(*prim->basicstructure);
   }
-  auto const &fg = prim->sym_info.factor_group->element;
-  xtal::Lattice super_lat = xtal::make_fully_commensurate_superduperlattice(
-      lattices.begin(), lattices.end(), fg.begin(), fg.end());
-  auto const &pg = prim->sym_info.point_group->element;
-  super_lat = xtal::canonical::equivalent(super_lat, pg);
-  auto shared_supercell = std::make_shared<Supercell const>(prim, super_lat);
+  std::map<Configuration, std::string> prim_configs =
+      _make_prim_configs(configurations);
+  InvariantSubgroupEngine engine(shared_supercell);
 
   // --- Generate symmetry adapted config spaces ---
   for (auto const &dof_key : *dofs) {
-    // --- Construct the standard DoF space ---
-    clexulator::DoFSpace dof_space_pre2 = clexulator::make_dof_space(
-        dof_key, prim->basicstructure,
-        shared_supercell->superlattice.transformation_matrix_to_super());
+    CASM_CONFIGURATION_TRACE_SCOPE("config_space_analysis.dof");
 
-    clexulator::DoFSpace dof_space_pre1 = exclude_homogeneous_mode_space(
-        dof_space_pre2, exclude_homogeneous_modes);
-
-    clexulator::DoFSpace standard_dof_space = exclude_default_occ_modes(
-        dof_space_pre1, include_default_occ_modes,
-        sublattice_index_to_default_occ, site_index_to_default_occ);
+    // --- Construct the standard DoF space ---
+    clexulator::DoFSpace standard_dof_space = _make_standard_dof_space(
+        dof_key, *shared_supercell, exclude_homogeneous_modes,
+        include_default_occ_modes, sublattice_index_to_default_occ,
+        site_index_to_default_occ, n_threads);
 
     // --- Begin projector construction ---
     std::map<std::string, std::vector<Eigen::VectorXd>> equivalent_dof_values;
@@ -121,100 +492,206 @@ std::map<DoFKey, ConfigSpaceAnalysisResults> config_space_analysis(
     Eigen::MatrixXd P = Eigen::MatrixXd::Zero(standard_dof_space.basis.cols(),
                                               standard_dof_space.basis.cols());
 
-    // std::cout << "P:\n" << P << std::endl;
+    Eigen::Matrix3l const &T =
+        shared_supercell->superlattice.transformation_matrix_to_super();
     for (auto const &prim_config : prim_configs) {
+      CASM_CONFIGURATION_TRACE_SCOPE("config_space_analysis.projector");
       Configuration prototype =
           copy_configuration(prim_config.first, shared_supercell);
-      std::vector<Configuration> equivalents =
-          make_equivalents(prototype, SupercellSymOp::begin(shared_supercell),
-                           SupercellSymOp::end(shared_supercell));
 
+      std::vector<Configuration> equivalents =
+          engine.make_equivalents(prototype);
       std::vector<Eigen::VectorXd> equiv_x;
-      for (auto const &config : equivalents) {
-        Eigen::VectorXd x = get_normal_coordinate(
-            config.dof_values,
-            shared_supercell->superlattice.transformation_matrix_to_super(),
-            standard_dof_space);
-
-        // clean up x?
-        for (int i = 0; i < x.size(); ++i) {
-          if (almost_zero(x(i), tol)) {
-            x(i) = 0.0;
-          }
-        }
-
-        P += x * x.transpose();
-        equiv_x.push_back(x);
-        // std::cout << "P:\n" << P << std::endl;
-      }
-      equivalent_dof_values[prim_config.second] = equiv_x;
-      equivalent_configurations[prim_config.second] = equivalents;
-    }
-    // std::cout << "P:\n" << P << std::endl;
-
-    // clean up P?
-    for (int i = 0; i < P.rows(); ++i) {
-      for (int j = 0; j < P.cols(); ++j) {
-        if (almost_zero(P(i, j), tol)) {
-          P(i, j) = 0.0;
-        }
-      }
+      _accumulate_projector(
+          P, equivalents.size(),
+          [&](Index i, SupercellSymOpApplier &applier) {
+            return _make_normal_coordinate(equivalents[i].dof_values, T,
+                                           standard_dof_space, tol);
+          },
+          n_threads, &equiv_x);
+      equivalent_dof_values[prim_config.second] = std::move(equiv_x);
+      equivalent_configurations[prim_config.second] = std::move(equivalents);
     }
 
-    // --- Eigendecomposition of P ---
-    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(P);
-    Eigen::VectorXd D = solver.eigenvalues();
-    Eigen::MatrixXd V = solver.eigenvectors();
-
-    // std::cout << "eigenvalues:\n" << D << std::endl;
-    // std::cout << "eigenvectors:\n" << V << std::endl;
-    // std::cout << "check:\n" << V * D.asDiagonal() * V.transpose() <<
-    // std::endl;
-
-    // --- Identify non-zero eigenvalues and corresponding eigenvectors ---
-    Eigen::VectorXd D_nonzero(D.size());
-    Eigen::MatrixXd V_nonzero(P.rows(), P.cols());
-
-    int i_nonzero = 0;
-    for (int i = 0; i < D.size(); ++i) {
-      if (!almost_zero(D(i), tol)) {
-        D_nonzero(i_nonzero) = D(i);
-        V_nonzero.col(i_nonzero) = V.col(i);
-        ++i_nonzero;
-      }
-    }
+    results.emplace(
+        dof_key, _make_results(standard_dof_space,
+                               std::move(equivalent_dof_values),
+                               std::move(equivalent_configurations), P, tol));
+  }
+
+  return results;
+}
 
-    // std::cout << "non-zero eigenvalues:\n"
-    //           << D_nonzero.head(i_nonzero) << std::endl;
-    // std::cout << "non-zero eigenvectors:\n"
-    //           << V_nonzero.leftCols(i_nonzero) << std::endl;
-    // std::cout << "B * non-zero eigenvectors:\n"
-    //           << standard_dof_space.basis() * V_nonzero.leftCols(i_nonzero)
-    //           << std::endl;
+/// \brief Constructor
+///
+/// \param _supercell The fully commensurate supercell
+ConfigSpaceAnalysisPartial::ConfigSpaceAnalysisPartial(
+    std::shared_ptr<Supercell const> const &_supercell)
+    : supercell(throw_if_equal_to_nullptr(
+          _supercell,
+          "Error in ConfigSpaceAnalysisPartial: supercell is empty")),
+      n_configurations(0) {}
+
+/// \brief Add the projectors of another partial result
+///
+/// \param other Another partial result, for the same fully commensurate
+///     supercell and DoF types, and a disjoint subset of configurations.
+void ConfigSpaceAnalysisPartial::merge(
+    ConfigSpaceAnalysisPartial const &other) {
+  if (other.supercell != supercell && *other.supercell != *supercell) {
+    throw std::runtime_error(
+        "Error in ConfigSpaceAnalysisPartial::merge: supercell mismatch");
+  }
+  add_projector(other.projector, other.n_configurations);
+}
 
-    if (i_nonzero == 0) {
+/// \brief Add partial projectors, as from another partial result
+///
+/// This allows partial projectors to be summed after being communicated as
+/// plain matrices, for example by an MPI reduction.
+///
+/// \param other_projector Partial projection matrices, by DoF type, which
+///     must have the same DoF types and shapes as `projector`.
+/// \param other_n_configurations Number of distinct primitive
+///     configurations accumulated into `other_projector`.
+void ConfigSpaceAnalysisPartial::add_projector(
+    std::map<DoFKey, Eigen::MatrixXd> const &other_projector,
+    Index other_n_configurations) {
+  if (other_projector.size() != projector.size()) {
+    throw std::runtime_error(
+        "Error in ConfigSpaceAnalysisPartial: DoF types mismatch");
+  }
+  for (auto const &pair : other_projector) {
+    auto it = projector.find(pair.first);
+    if (it == projector.end()) {
       throw std::runtime_error(
-          "Error in config_space_analysis: symmetry adapted config space is "
-          "null");
+          "Error in ConfigSpaceAnalysisPartial: DoF types mismatch");
     }
+    if (it->second.rows() != pair.second.rows() ||
+        it->second.cols() != pair.second.cols()) {
+      throw std::runtime_error(
+          "Error in ConfigSpaceAnalysisPartial: projector shape mismatch for " +
+          pair.first);
+    }
+  }
+  for (auto const &pair : other_projector) {
+    projector.at(pair.first) += pair.second;
+  }
+  n_configurations += other_n_configurations;
+}
 
-    // --- Store results ---
-    Eigen::VectorXd eigenvalues = D_nonzero.head(i_nonzero);
-
-    clexulator::DoFSpace symmetry_adapted_dof_space =
-        clexulator::make_dof_space(
-            standard_dof_space.dof_key, standard_dof_space.prim,
-            standard_dof_space.transformation_matrix_to_super,
-            standard_dof_space.sites,
-            standard_dof_space.basis * V_nonzero.leftCols(i_nonzero));
+/// \brief Make the fully commensurate supercell used by
+///     `config_space_analysis`
+///
+/// The supercell is commensurate with every equivalent of the primitive
+/// forms of all `configurations`. Partial analyses of subsets of the
+/// configurations must all use the supercell made from the complete set.
+///
+/// \param configurations Map of identifier string -> Configuration. Must
+///     not be empty.
+/// \param max_supercell_volume If provided, throw before constructing the
+///     fully commensurate supercell if its volume, as a multiple of the prim
+///     volume, is greater than this value.
+std::shared_ptr<Supercell const> make_config_space_analysis_supercell(
+    std::map<std::string, Configuration> const &configurations,
+    std::optional<Index> max_supercell_volume) {
+  if (configurations.size() == 0) {
+    throw std::runtime_error(
+        "Error in make_config_space_analysis_supercell: no configurations");
+  }
+  return std::make_shared<Supercell const>(
+      configurations.begin()->second.supercell->prim,
+      _make_config_space_analysis_superlattice(configurations,
+                                               max_supercell_volume));
+}
+/// \brief Accumulate the projectors of `config_space_analysis` for a subset
+///     of the input configurations
+///
+/// Equivalent configurations are generated and accumulated as for
+/// `config_space_analysis` with `store_equivalents == false`, and are not
+/// stored.
+///
+/// \param supercell The fully commensurate supercell, as made by
+///     `make_config_space_analysis_supercell` from all configurations.
+/// \param configurations Map of identifier string -> Configuration, for
+///     this subset. May be empty, which gives zero projectors.
+///
+/// The remaining parameters are as for `config_space_analysis`, and must
+/// be the same for all partial results that are merged, except
+/// `n_threads` and `use_prototype_supercells`, which do not change the
+/// result beyond floating point rounding. If `use_prototype_supercells` is
+/// true, only the prim and transformation matrix of `supercell` are used,
+/// so it may be constructed without translation permutations.
+///
+/// \returns Partial projectors, for each requested DoF type.
+ConfigSpaceAnalysisPartial config_space_analysis_partial(
+    std::shared_ptr<Supercell const> const &supercell,
+    std::map<std::string, Configuration> const &configurations,
+    std::optional<std::vector<DoFKey>> dofs,
+    std::optional<bool> exclude_homogeneous_modes,
+    bool include_default_occ_modes,
+    std::optional<std::map<int, int>> sublattice_index_to_default_occ,
+    std::optional<std::map<Index, int>> site_index_to_default_occ, double tol,
+    Index n_threads, bool use_prototype_supercells) {
+  CASM_CONFIGURATION_TRACE_SCOPE("config_space_analysis_partial");
+  ConfigSpaceAnalysisPartial partial(supercell);
+  if (!dofs.has_value()) {
+    dofs = all_dof_types(*supercell->prim->basicstructure);
+  }
+  std::map<Configuration, std::string> prim_configs =
+      _make_prim_configs(configurations);
+  partial.n_configurations = prim_configs.size();
+  std::vector<Configuration> prototypes;
+  std::optional<InvariantSubgroupEngine> engine;
+  if (!use_prototype_supercells) {
+    for (auto const &prim_config : prim_configs) {
+      prototypes.push_back(copy_configuration(prim_config.first, supercell));
+    }
+    engine.emplace(supercell);
+  }
 
-    results.emplace(std::piecewise_construct, std::forward_as_tuple(dof_key),
-                    std::forward_as_tuple(
-                        standard_dof_space, std::move(equivalent_dof_values),
-                        std::move(equivalent_configurations), P, eigenvalues,
-                        symmetry_adapted_dof_space));
+  for (auto const &dof_key : *dofs) {
+    clexulator::DoFSpace standard_dof_space = _make_standard_dof_space(
+        dof_key, *supercell, exclude_homogeneous_modes,
+        include_default_occ_modes, sublattice_index_to_default_occ,
+        site_index_to_default_occ, n_threads);
+    Eigen::MatrixXd P = Eigen::MatrixXd::Zero(standard_dof_space.basis.cols(),
+                                              standard_dof_space.basis.cols());
+    if (use_prototype_supercells) {
+      for (auto const &prim_config : prim_configs) {
+        CASM_CONFIGURATION_TRACE_SCOPE("config_space_analysis.projector");
+        _accumulate_prototype_by_tiling(P, prim_config.first,
+                                        standard_dof_space, tol, n_threads);
+      }
+    } else {
+      for (Configuration const &prototype : prototypes) {
+        CASM_CONFIGURATION_TRACE_SCOPE("config_space_analysis.projector");
+        _accumulate_prototype(P, prototype, *engine, standard_dof_space, tol,
+                              n_threads);
+      }
+    }
+    partial.standard_dof_space.emplace(dof_key, standard_dof_space);
+    partial.projector.emplace(dof_key, std::move(P));
   }
+  return partial;
+}
 
+/// \brief Find the symmetry adapted config spaces from merged partial
+///     projectors
+///
+/// \param partial Partial projectors, merged for all configurations.
+/// \param tol Tolerance used for identifying zero-valued eigenvalues.
+///
+/// \returns Results, as for `config_space_analysis` with
+///     `store_equivalents == false`, for each DoF type in `partial`.
+std::map<DoFKey, ConfigSpaceAnalysisResults> finish_config_space_analysis(
+    ConfigSpaceAnalysisPartial const &partial, double tol) {
+  std::map<DoFKey, ConfigSpaceAnalysisResults> results;
+  for (auto const &pair : partial.projector) {
+    results.emplace(pair.first,
+                    _make_results(partial.standard_dof_space.at(pair.first),
+                                  {}, {}, pair.second, tol));
+  }
   return results;
 }
 
@@ -1,23 +1,134 @@
 #include "casm/configuration/copy_configuration.hh"
 
+#include <functional>
+
 #include "casm/configuration/ConfigIsEquivalent.hh"
 #include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationView.hh"
+#include "casm/configuration/InvariantSubgroupEngine.hh"
+#include "casm/configuration/MotifTilingMap.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/find_translations.hh"
+#include "casm/configuration/hash.hh"
 
 namespace CASM {
 namespace config {
 
 namespace {
 
-SupercellSymOp find_translation(Configuration const &configuration) {
-  auto begin = SupercellSymOp::translation_begin(configuration.supercell);
-  auto end = SupercellSymOp::translation_end(configuration.supercell);
-  if (++begin == end) {
-    return end;
+/// \brief Return a hash of the occupation of each unit cell
+///
+/// Translations that leave a configuration invariant must map each unit
+/// cell onto a unit cell with the same signature. Only occupation, which is
+/// compared exactly, is included, so the signatures never exclude an
+/// invariant translation.
+std::vector<std::size_t> _make_unitcell_signatures(
+    Configuration const &configuration) {
+  Supercell const &supercell = *configuration.supercell;
+  Index n_unitcells = supercell.unitcell_index_converter.total_sites();
+  Index n_sublat = supercell.prim->basicstructure->basis().size();
+  Eigen::VectorXi const &occupation = configuration.dof_values.occupation;
+  std::vector<std::size_t> signatures(n_unitcells, 0);
+  if (occupation.size() == 0) {
+    return signatures;
+  }
+  for (Index i = 0; i < n_unitcells; ++i) {
+    UnitCell unitcell = supercell.unitcell_index_converter(i);
+    for (Index b = 0; b < n_sublat; ++b) {
+      Index l = supercell.unitcellcoord_index_converter(
+          xtal::UnitCellCoord(b, unitcell));
+      hash_combine(signatures[i], std::hash<int>()(occupation(l)));
+    }
+  }
+  return signatures;
+}
+
+/// \brief Return true if translation maps every unit cell onto a unit cell
+///     with the same signature
+bool _is_signature_invariant(Supercell const &supercell,
+                             std::vector<std::size_t> const &signatures,
+                             UnitCell const &translation) {
+  xtal::UnitCellIndexConverter const &converter =
+      supercell.unitcell_index_converter;
+  for (Index i = 0; i < signatures.size(); ++i) {
+    Index j = converter(UnitCell(converter(i) + translation));
+    if (signatures[j] != signatures[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Return the indices of non-zero translations that leave a
+///     configuration invariant
+///
+/// \param configuration The configuration
+/// \param find_first If true, return after the first invariant translation
+///     is found
+///
+/// \returns Translation indices, in increasing order, excluding 0. The
+///     translations are the same as found by comparing
+///     `[SupercellSymOp::translation_begin(supercell),
+///     SupercellSymOp::translation_end(supercell))` using
+///     ConfigIsEquivalent.
+///
+/// Method:
+/// - Unit cell occupation signatures are made in O(n_sites). Only
+///   translations that map unit cell 0 onto a unit cell with the same
+///   signature are candidates, and if there are none no further work is
+///   done.
+/// - If `find_first`, candidates are checked in order, first against all
+///   unit cell signatures and then using ConfigIsEquivalent, returning at
+///   the first invariant translation.
+/// - Otherwise, candidates are found in O(n_sites * log(n_unitcells)) using
+///   `find_translation_indices`.
+std::vector<Index> _find_invariant_translation_indices(
+    Configuration const &configuration, bool find_first) {
+  Supercell const &supercell = *configuration.supercell;
+  xtal::UnitCellIndexConverter const &converter =
+      supercell.unitcell_index_converter;
+  Index n_unitcells = converter.total_sites();
+  std::vector<Index> result;
+  if (n_unitcells == 1) {
+    return result;
+  }
+
+  // unit cell 0 must map onto a unit cell with the same signature
+  std::vector<std::size_t> signatures =
+      _make_unitcell_signatures(configuration);
+  std::vector<Index> candidates;
+  for (Index t = 1; t < n_unitcells; ++t) {
+    if (signatures[t] == signatures[0]) {
+      candidates.push_back(t);
+    }
+  }
+  if (candidates.empty()) {
+    return result;
+  }
+
+  if (find_first) {
+    ConfigIsEquivalent equal_to_f(configuration);
+    for (Index t : candidates) {
+      if (!_is_signature_invariant(supercell, signatures, converter(t))) {
+        continue;
+      }
+      if (!equal_to_f(SupercellSymOp(configuration.supercell, 0, t))) {
+        continue;
+      }
+      result.push_back(t);
+      break;
+    }
+    return result;
+  }
+
+  for (Index t : find_translation_indices(configuration, configuration)) {
+    if (t == 0) {
+      continue;
+    }
+    result.push_back(t);
   }
-  ConfigIsEquivalent f(configuration);
-  return std::find_if(begin, end, f);
+  return result;
 }
 
 }  // namespace
@@ -32,6 +143,9 @@ SupercellSymOp find_translation(Configuration const &configuration) {
 /// Notes:
 /// - This method assumes the motif forms an infinite crystal and copies site
 ///   DoF values that lie inside `supercell` directory into a new configuration.
+/// - This constructs a MotifTilingMap for each call. To copy many motif
+///   configurations with the same supercell into the same supercell,
+///   construct the MotifTilingMap once, or use MotifTilingMapCache.
 ///
 Configuration copy_configuration(
     Configuration const &motif,
@@ -40,51 +154,23 @@ Configuration copy_configuration(
     throw std::runtime_error(
         "Error in CASM::config::copy_configuration: prim mismatch.");
   }
+  return MotifTilingMap(motif.supercell, supercell, origin).apply(motif);
+}
 
-  Index supercell_total_sites =
-      supercell->unitcellcoord_index_converter.total_sites();
-
-  // construct new_config
-  Configuration new_config{supercell};
-
-  // copy global DoF values
-  new_config.dof_values.global_dof_values = motif.dof_values.global_dof_values;
-
-  // copy occupation values
-  for (Index i = 0; i < supercell_total_sites; i++) {
-    // unitcellcoord of site i in new_config
-    UnitCellCoord unitcellcoord =
-        new_config.supercell->unitcellcoord_index_converter(i);
-
-    // equivalent site in configuration
-    Index motif_site_index =
-        motif.supercell->unitcellcoord_index_converter(unitcellcoord + origin);
-
-    // copy occupation value
-    new_config.dof_values.occupation(i) =
-        motif.dof_values.occupation(motif_site_index);
-  }
-
-  // copy local DoF values
-  for (auto const &pair : motif.dof_values.local_dof_values) {
-    std::string name = pair.first;
-    Eigen::MatrixXd const &M_motif = pair.second;
-    Eigen::MatrixXd &M_super = new_config.dof_values.local_dof_values.at(name);
-    for (Index i = 0; i < supercell_total_sites; i++) {
-      // unitcellcoord of site i in new_config
-      UnitCellCoord unitcellcoord =
-          new_config.supercell->unitcellcoord_index_converter(i);
-
-      // equivalent site in motif
-      Index motif_site_index = motif.supercell->unitcellcoord_index_converter(
-          unitcellcoord + origin);
-
-      // copy dof from superconfig to this:
-      M_super.col(i) = M_motif.col(motif_site_index);
-    }
-  }
-
-  return new_config;
+/// \brief Copy configuration DoF values, referenced by a view, into a
+///     supercell
+///
+/// Equivalent to `copy_configuration` for a Configuration. The referenced
+/// DoF values are copied once, into the motif.
+///
+/// \param motif A view of the initial configuration
+/// \param supercell The Supercell of the new configuration
+/// \param origin The UnitCell indicating which unit cell in the
+///        initial configuration is the origin in new configuration
+Configuration copy_configuration(
+    ConfigurationView const &motif,
+    std::shared_ptr<Supercell const> const &supercell, UnitCell const &origin) {
+  return copy_configuration(make_configuration(motif), supercell, origin);
 }
 
 /// \brief Copy transformed configuration DoF values into a supercell
@@ -104,6 +190,10 @@ Configuration copy_configuration(
 /// map according to:
 ///     new_config_unitcellcoord + origin = fg * motif_unitcellcoord + trans
 ///
+/// This constructs a MotifTilingMap for each call. To copy many motif
+/// configurations with the same supercell into the same supercell, construct
+/// the MotifTilingMap once, or use MotifTilingMapCache.
+///
 Configuration copy_configuration(
     Index prim_factor_group_index, UnitCell translation,
     Configuration const &motif,
@@ -113,88 +203,9 @@ Configuration copy_configuration(
         "Error in CASM::config::copy_configuration (and transform): prim "
         "mismatch.");
   }
-
-  auto const &prim = supercell->prim;
-  PrimSymInfo const &prim_sym_info = prim->sym_info;
-  auto const &unitcellcoord_rep = prim_sym_info.unitcellcoord_symgroup_rep;
-  Index inverse_prim_factor_group_index =
-      prim->sym_info.factor_group->inverse_index[prim_factor_group_index];
-
-  Index supercell_total_sites =
-      supercell->unitcellcoord_index_converter.total_sites();
-
-  // construct new_config
-  Configuration new_config{supercell};
-
-  // copy transformed global DoF values
-  for (auto const &pair : motif.dof_values.global_dof_values) {
-    std::string name = pair.first;
-    Eigen::VectorXd const &V_motif = pair.second;
-    Eigen::VectorXd &V_new = new_config.dof_values.global_dof_values.at(name);
-    auto const &global_rep = prim_sym_info.global_dof_symgroup_rep.at(name);
-
-    Eigen::MatrixXd const &matrix_rep = global_rep[prim_factor_group_index];
-    V_new = matrix_rep * V_motif;
-  }
-
-  // unitcellcoord + origin = fg * motif_unitcellcoord + trans
-  // motif_unitcellcoord = fg_inverse * (unitcellcoord  + origin - trans)
-
-  // copy transformed occupation values
-  for (Index i = 0; i < supercell_total_sites; i++) {
-    // unitcellcoord of site i in new_config
-    UnitCellCoord unitcellcoord =
-        new_config.supercell->unitcellcoord_index_converter(i);
-
-    // motif_unitcellcoord, the site which transforms to site i in new_config
-    UnitCellCoord motif_unitcellcoord =
-        copy_apply(unitcellcoord_rep[inverse_prim_factor_group_index],
-                   (unitcellcoord + origin - translation));
-
-    // equivalent site in configuration
-    Index motif_site_index =
-        motif.supercell->unitcellcoord_index_converter(motif_unitcellcoord);
-
-    // occupation value transformation (accounts for aniostropic occupants)
-    Index b = motif_unitcellcoord.sublattice();
-    sym_info::Permutation const &perm_rep =
-        prim_sym_info.occ_symgroup_rep[prim_factor_group_index][b];
-
-    // copy transformed occupation value
-    new_config.dof_values.occupation(i) =
-        perm_rep[motif.dof_values.occupation(motif_site_index)];
-  }
-
-  // copy local DoF values
-  for (auto const &pair : motif.dof_values.local_dof_values) {
-    std::string name = pair.first;
-    Eigen::MatrixXd const &M_motif = pair.second;
-    Eigen::MatrixXd &M_new = new_config.dof_values.local_dof_values.at(name);
-    auto const &local_rep = prim_sym_info.local_dof_symgroup_rep.at(name);
-    for (Index i = 0; i < supercell_total_sites; i++) {
-      // unitcellcoord of site i in new_config
-      UnitCellCoord unitcellcoord =
-          new_config.supercell->unitcellcoord_index_converter(i);
-
-      // motif_unitcellcoord, the site which transforms to site i in new_config
-      UnitCellCoord motif_unitcellcoord =
-          copy_apply(unitcellcoord_rep[inverse_prim_factor_group_index],
-                     (unitcellcoord + origin - translation));
-
-      // equivalent site in configuration
-      Index motif_site_index =
-          motif.supercell->unitcellcoord_index_converter(motif_unitcellcoord);
-
-      // local DoF value transformation
-      Index b = motif_unitcellcoord.sublattice();
-      Eigen::MatrixXd const &matrix_rep = local_rep[prim_factor_group_index][b];
-
-      // copy dof from superconfig to this:
-      M_new.col(i) = matrix_rep * M_motif.col(motif_site_index);
-    }
-  }
-
-  return new_config;
+  return MotifTilingMap(prim_factor_group_index, translation, motif.supercell,
+                        supercell, origin)
+      .apply(motif);
 }
 
 /// \brief Copy configuration DoF values and properties into a supercell
@@ -212,48 +223,12 @@ ConfigurationWithProperties copy_configuration_with_properties(
     ConfigurationWithProperties const &motif_with_properties,
     std::shared_ptr<Supercell const> const &supercell, UnitCell const &origin) {
   Configuration const &motif = motif_with_properties.configuration;
-  auto const &local_properties = motif_with_properties.local_properties;
-  auto const &global_properties = motif_with_properties.global_properties;
-
   if (supercell->prim != motif.supercell->prim) {
     throw std::runtime_error(
         "Error in CASM::config::copy_configuration: prim mismatch.");
   }
-
-  Index supercell_total_sites =
-      supercell->unitcellcoord_index_converter.total_sites();
-
-  // copy configuration
-  Configuration new_config = copy_configuration(motif, supercell, origin);
-
-  // copy global properties
-  std::map<std::string, Eigen::VectorXd> new_global_properties =
-      global_properties;
-
-  // copy local property values
-  std::map<std::string, Eigen::MatrixXd> new_local_properties;
-  for (auto const &pair : local_properties) {
-    std::string name = pair.first;
-    Eigen::MatrixXd const &M_motif = pair.second;
-    Eigen::MatrixXd M_new(M_motif.rows(), supercell_total_sites);
-    M_new.setZero();
-    for (Index i = 0; i < supercell_total_sites; i++) {
-      // unitcellcoord of site i in new_config
-      UnitCellCoord unitcellcoord =
-          new_config.supercell->unitcellcoord_index_converter(i);
-
-      // equivalent site in motif
-      Index motif_site_index = motif.supercell->unitcellcoord_index_converter(
-          unitcellcoord + origin);
-
-      // copy dof from superconfig to this:
-      M_new.col(i) = M_motif.col(motif_site_index);
-    }
-    new_local_properties.emplace(name, M_new);
-  }
-
-  return ConfigurationWithProperties(new_config, new_local_properties,
-                                     new_global_properties);
+  return MotifTilingMap(motif.supercell, supercell, origin)
+      .apply(motif_with_properties);
 }
 
 /// \brief Copy transformed configuration DoF values and properties into a
@@ -280,74 +255,13 @@ ConfigurationWithProperties copy_configuration_with_properties(
     ConfigurationWithProperties const &motif_with_properties,
     std::shared_ptr<Supercell const> const &supercell, UnitCell const &origin) {
   Configuration const &motif = motif_with_properties.configuration;
-  auto const &local_properties = motif_with_properties.local_properties;
-  auto const &global_properties = motif_with_properties.global_properties;
-
   if (supercell->prim != motif.supercell->prim) {
     throw std::runtime_error(
         "Error in CASM::config::copy_configuration: prim mismatch.");
   }
-
-  auto const &prim = supercell->prim;
-  PrimSymInfo const &prim_sym_info = prim->sym_info;
-  auto const &unitcellcoord_rep = prim_sym_info.unitcellcoord_symgroup_rep;
-  Index inverse_prim_factor_group_index =
-      prim->sym_info.factor_group->inverse_index[prim_factor_group_index];
-
-  Index supercell_total_sites =
-      supercell->unitcellcoord_index_converter.total_sites();
-
-  // copy & transform configuration
-  Configuration new_config = copy_configuration(
-      prim_factor_group_index, translation, motif, supercell, origin);
-
-  // copy global properties
-  std::map<std::string, Eigen::VectorXd> new_global_properties =
-      global_properties;
-
-  // copy transformed global properties
-  for (auto const &pair : global_properties) {
-    std::string name = pair.first;
-    Eigen::VectorXd const &V_motif = pair.second;
-    auto const &global_rep = prim_sym_info.global_dof_symgroup_rep.at(name);
-    Eigen::MatrixXd const &matrix_rep = global_rep[prim_factor_group_index];
-    new_global_properties.emplace(name, matrix_rep * V_motif);
-  }
-
-  // copy transformed local property values
-  std::map<std::string, Eigen::MatrixXd> new_local_properties;
-  for (auto const &pair : local_properties) {
-    std::string name = pair.first;
-    Eigen::MatrixXd const &M_motif = pair.second;
-    Eigen::MatrixXd M_new(M_motif.rows(), supercell_total_sites);
-    M_new.setZero();
-    auto const &local_rep = prim_sym_info.local_dof_symgroup_rep.at(name);
-    for (Index i = 0; i < supercell_total_sites; i++) {
-      // unitcellcoord of site i in new_config
-      UnitCellCoord unitcellcoord =
-          new_config.supercell->unitcellcoord_index_converter(i);
-
-      // motif_unitcellcoord, the site which transforms to site i in new_config
-      UnitCellCoord motif_unitcellcoord =
-          copy_apply(unitcellcoord_rep[inverse_prim_factor_group_index],
-                     (unitcellcoord + origin - translation));
-
-      // equivalent site in configuration
-      Index motif_site_index =
-          motif.supercell->unitcellcoord_index_converter(motif_unitcellcoord);
-
-      // local DoF value transformation
-      Index b = motif_unitcellcoord.sublattice();
-      Eigen::MatrixXd const &matrix_rep = local_rep[prim_factor_group_index][b];
-
-      // copy dof from superconfig to this:
-      M_new.col(i) = matrix_rep * M_motif.col(motif_site_index);
-    }
-    new_local_properties.emplace(name, M_new);
-  }
-
-  return ConfigurationWithProperties(new_config, new_local_properties,
-                                     new_global_properties);
+  return MotifTilingMap(prim_factor_group_index, translation, motif.supercell,
+                        supercell, origin)
+      .apply(motif_with_properties);
 }
 
 /// \brief Copy configuration occupation and local DoF values into another
@@ -385,8 +299,7 @@ void copy_local_dof_values(Configuration const &source,
 
     // site in destination
     Index destination_site_index =
-        destination.supercell->unitcellcoord_index_converter(unitcellcoord +
-                                                             position);
+        destination.supercell->linear_site_index(unitcellcoord + position);
 
     // copy occupation value
     destination.dof_values.occupation(destination_site_index) =
@@ -409,8 +322,7 @@ void copy_local_dof_values(Configuration const &source,
 
       // equivalent site in destination
       Index destination_site_index =
-          destination.supercell->unitcellcoord_index_converter(unitcellcoord +
-                                                               position);
+          destination.supercell->linear_site_index(unitcellcoord + position);
 
       // copy dof from superconfig to this:
       M_destination.col(destination_site_index) = M_source.col(i);
@@ -555,13 +467,12 @@ make_all_super_configurations_by_subsets(
     Configuration const &motif,
     std::shared_ptr<Supercell const> const &supercell) {
   std::vector<std::vector<Configuration>> by_subsets;
-  SupercellSymOp begin = SupercellSymOp::begin(supercell);
-  SupercellSymOp end = SupercellSymOp::end(supercell);
+  InvariantSubgroupEngine engine(supercell);
 
   std::vector<Configuration> distinct =
       make_distinct_super_configurations(motif, supercell);
   for (auto const &config : distinct) {
-    by_subsets.push_back(make_equivalents(config, begin, end));
+    by_subsets.push_back(engine.make_equivalents(config));
   }
   return by_subsets;
 }
@@ -634,13 +545,12 @@ make_all_super_configurations_by_subsets(
     ConfigurationWithProperties const &motif_with_properties,
     std::shared_ptr<Supercell const> const &supercell) {
   std::vector<std::vector<ConfigurationWithProperties>> by_subsets;
-  SupercellSymOp begin = SupercellSymOp::begin(supercell);
-  SupercellSymOp end = SupercellSymOp::end(supercell);
+  InvariantSubgroupEngine engine(supercell);
 
   std::vector<ConfigurationWithProperties> distinct =
       make_distinct_super_configurations(motif_with_properties, supercell);
   for (auto const &config_with_properties : distinct) {
-    by_subsets.push_back(make_equivalents(config_with_properties, begin, end));
+    by_subsets.push_back(engine.make_equivalents(config_with_properties));
   }
   return by_subsets;
 }
@@ -704,6 +614,7 @@ std::set<Configuration> make_all_super_configurations_check(
   UnitCell origin(0, 0, 0);
   SupercellSymOp begin = SupercellSymOp::begin(supercell);
   SupercellSymOp end = SupercellSymOp::end(supercell);
+  SupercellSymOpApplier applier;
 
   // Loop over prim factor group ops
   for (Index prim_fg_op = 0; prim_fg_op < prim_fg.element.size();
@@ -720,7 +631,7 @@ std::set<Configuration> make_all_super_configurations_check(
         copy_configuration(prim_fg_op, trans, prim_motif, supercell, origin);
     if (!all.count(tmp)) {
       for (auto it = begin; it != end; ++it) {
-        all.emplace(copy_apply(*it, tmp));
+        all.emplace(applier.copy_apply(*it, tmp));
       }
     }
   }
@@ -730,8 +641,7 @@ std::set<Configuration> make_all_super_configurations_check(
 /// \brief Return true if no translations within the supercell result in the
 ///     same configuration
 bool is_primitive(Configuration const &configuration) {
-  auto end = SupercellSymOp::translation_end(configuration.supercell);
-  return find_translation(configuration) == end;
+  return _find_invariant_translation_indices(configuration, true).empty();
 }
 
 /// \brief Return the primitive configuration
@@ -740,33 +650,61 @@ bool is_primitive(Configuration const &configuration) {
 /// - Does not apply any symmetry operations
 /// - Use `make_in_canonical_supercell` aftwards to obtain the primitive
 ///   canonical configuration in the canonical supercell.
+///
+/// Method:
+/// - The translations that leave the configuration invariant are found
+///   once, in the initial supercell.
+/// - The supercell lattice is reduced by repeatedly replacing one lattice
+///   vector with the first invariant translation of the current lattice.
+///   The invariant translations of each intermediate lattice are the
+///   invariant translations of the initial supercell, brought within it,
+///   so only the lattice, and not a Supercell, is constructed at each step.
+/// - The configuration is copied into the primitive supercell once.
 Configuration make_primitive(Configuration const &configuration) {
-  Configuration tconfig{configuration};
-  auto prim = tconfig.supercell->prim;
-  double xtal_tol = prim->basicstructure->lattice().tol();
+  std::vector<Index> invariant_translation_indices =
+      _find_invariant_translation_indices(configuration, false);
+  if (invariant_translation_indices.empty()) {
+    return configuration;
+  }
 
-  // check if config is primitive, and if not, obtain a translation that maps
-  // the config on itself
-  while (true) {
-    SupercellSymOp result = find_translation(tconfig);
+  auto prim = configuration.supercell->prim;
+  xtal::Lattice const &prim_lattice = prim->basicstructure->lattice();
+  double xtal_tol = prim_lattice.tol();
+  xtal::UnitCellIndexConverter const &converter =
+      configuration.supercell->unitcell_index_converter;
+  std::vector<UnitCell> invariant_translations;
+  for (Index t : invariant_translation_indices) {
+    invariant_translations.push_back(converter(t));
+  }
 
-    if (result == SupercellSymOp::translation_end(tconfig.supercell)) {
+  Lattice new_lat = configuration.supercell->superlattice.superlattice();
+  while (true) {
+    xtal::Superlattice superlattice(prim_lattice, new_lat);
+    xtal::UnitCellIndexConverter new_converter(
+        superlattice.transformation_matrix_to_super());
+    Index n_unitcells = new_converter.total_sites();
+    Index first = n_unitcells;
+    for (UnitCell const &translation : invariant_translations) {
+      Index t = new_converter(translation);
+      if (t != 0 && t < first) {
+        first = t;
+      }
+    }
+    if (first == n_unitcells) {
       break;
     }
 
     // replace one of the lattice vectors with the translation
-    Lattice new_lat =
-        xtal::replace_vector(tconfig.supercell->superlattice.superlattice(),
-                             result.to_symop().translation, xtal_tol)
-            .make_right_handed()
-            .reduced_cell();
-
-    // create a sub configuration in the new supercell
-    tconfig =
-        copy_configuration(tconfig, std::make_shared<Supercell>(prim, new_lat));
+    Eigen::Vector3d translation_cart =
+        prim_lattice.lat_column_mat() * new_converter(first).cast<double>();
+    new_lat = xtal::replace_vector(new_lat, translation_cart, xtal_tol)
+                  .make_right_handed()
+                  .reduced_cell();
   }
 
-  return tconfig;
+  // create a sub configuration in the primitive supercell
+  return copy_configuration(configuration,
+                            make_shared_supercell(prim, new_lat));
 }
 
 /// \brief Transform a configuration with properties so it has the primitive
@@ -816,9 +754,9 @@ Configuration make_in_canonical_supercell(Configuration const &configuration) {
   }
 
   std::shared_ptr<Supercell const> canonical_supercell =
-      make_canonical_form(*configuration.supercell);
-  Index prim_factor_group_index = prim_factor_group_index_to_supercell(
-      configuration.supercell, canonical_supercell);
+      configuration.supercell->canonical_supercell();
+  Index prim_factor_group_index =
+      configuration.supercell->prim_factor_group_index_to_canonical();
   Configuration config_in_canonical_supercell = copy_configuration(
       prim_factor_group_index, {0, 0, 0}, configuration, canonical_supercell);
 
@@ -851,9 +789,9 @@ ConfigurationWithProperties make_in_canonical_supercell(
   }
 
   std::shared_ptr<Supercell const> canonical_supercell =
-      make_canonical_form(*configuration.supercell);
-  Index prim_factor_group_index = prim_factor_group_index_to_supercell(
-      configuration.supercell, canonical_supercell);
+      configuration.supercell->canonical_supercell();
+  Index prim_factor_group_index =
+      configuration.supercell->prim_factor_group_index_to_canonical();
   ConfigurationWithProperties config_in_canonical_supercell =
       copy_configuration_with_properties(prim_factor_group_index, {0, 0, 0},
                                          configuration_with_properties,
@@ -0,0 +1,162 @@
+// CUDA backend for OccupationCanonicalizer
+//
+// Only compiled if the library is built with the CMake option
+// `CASM_CONFIGURATION_CUDA`.
+
+#include <cuda_runtime.h>
+
+#include <sstream>
+#include <stdexcept>
+
+#include "casm/configuration/OccupationCanonicalizer.hh"
+
+namespace CASM {
+namespace config {
+namespace OccupationCanonicalizerImpl {
+
+namespace {  // anonymous
+
+void _check(cudaError_t status, char const *what) {
+  if (status != cudaSuccess) {
+    std::stringstream msg;
+    msg << "Error in OccupationCanonicalizer (" << what
+        << "): " << cudaGetErrorString(status);
+    throw std::runtime_error(msg.str());
+  }
+}
+
+/// \brief Device copy of the permutation table
+struct DeviceTables {
+  std::int32_t *perm = nullptr;
+  Index n_ops = 0;
+  Index n_sites = 0;
+};
+
+/// \brief One thread per configuration
+///
+/// Occupation values are site-major, `occ[l * n_configs + c]`, so threads
+/// of a warp read neighboring addresses. Each thread finds the first
+/// operation giving the lexicographically greatest transformed occupation,
+/// with early exit, as in CanonicalFormEngine::to_canonical_indices, and
+/// then checks whether the untransformed occupation is at least as great.
+__global__ void _canonicalize_kernel(std::int32_t const *perm, Index n_ops,
+                                     Index n_sites, std::int8_t const *occ,
+                                     Index n_configs, Index *to_canonical_index,
+                                     char *is_canonical) {
+  Index c = Index(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (c >= n_configs) {
+    return;
+  }
+  Index best = 0;
+  for (Index i = 1; i < n_ops; ++i) {
+    std::int32_t const *p_best = perm + best * n_sites;
+    std::int32_t const *p_i = perm + i * n_sites;
+    for (Index l = 0; l < n_sites; ++l) {
+      int A = occ[Index(p_best[l]) * n_configs + c];
+      int B = occ[Index(p_i[l]) * n_configs + c];
+      if (A != B) {
+        if (A < B) {
+          best = i;
+        }
+        break;
+      }
+    }
+  }
+  char canonical = 1;
+  std::int32_t const *p_best = perm + best * n_sites;
+  for (Index l = 0; l < n_sites; ++l) {
+    int A = occ[l * n_configs + c];
+    int B = occ[Index(p_best[l]) * n_configs + c];
+    if (A != B) {
+      canonical = (A > B);
+      break;
+    }
+  }
+  to_canonical_index[c] = best;
+  is_canonical[c] = canonical;
+}
+
+}  // namespace
+
+/// \brief Return the number of available devices
+Index device_count() {
+  int count = 0;
+  if (cudaGetDeviceCount(&count) != cudaSuccess) {
+    // no driver or no device: use the CPU path
+    cudaGetLastError();
+    return 0;
+  }
+  return count;
+}
+
+/// \brief Upload a row-major (n_ops, n_sites) permutation table
+std::shared_ptr<void> make_device_tables(std::vector<std::int32_t> const &perm,
+                                         Index n_ops, Index n_sites) {
+  auto tables = new DeviceTables();
+  tables->n_ops = n_ops;
+  tables->n_sites = n_sites;
+  std::shared_ptr<void> result(tables, [](void *ptr) {
+    auto tables = static_cast<DeviceTables *>(ptr);
+    cudaFree(tables->perm);
+    delete tables;
+  });
+  std::size_t bytes = perm.size() * sizeof(std::int32_t);
+  _check(cudaMalloc(&tables->perm, bytes), "cudaMalloc");
+  _check(cudaMemcpy(tables->perm, perm.data(), bytes, cudaMemcpyHostToDevice),
+         "cudaMemcpy");
+  return result;
+}
+
+/// \brief Canonicalize a site-major (n_sites, n_configurations) array of
+///     occupation values, writing results into host arrays
+void device_canonicalize(void *device_tables,
+                         std::vector<std::int8_t> const &occupation_by_site,
+                         Index n_configurations, Index *to_canonical_index,
+                         char *is_canonical) {
+  if (n_configurations == 0) {
+    return;
+  }
+  auto const &tables = *static_cast<DeviceTables *>(device_tables);
+
+  std::int8_t *d_occ = nullptr;
+  Index *d_index = nullptr;
+  char *d_flag = nullptr;
+  auto free_all = [&]() {
+    cudaFree(d_occ);
+    cudaFree(d_index);
+    cudaFree(d_flag);
+  };
+  try {
+    std::size_t occ_bytes = occupation_by_site.size();
+    _check(cudaMalloc(&d_occ, occ_bytes), "cudaMalloc");
+    _check(cudaMalloc(&d_index, n_configurations * sizeof(Index)),
+           "cudaMalloc");
+    _check(cudaMalloc(&d_flag, n_configurations), "cudaMalloc");
+    _check(cudaMemcpy(d_occ, occupation_by_site.data(), occ_bytes,
+                      cudaMemcpyHostToDevice),
+           "cudaMemcpy");
+
+    int block_size = 128;
+    Index n_blocks = (n_configurations + block_size - 1) / block_size;
+    _canonicalize_kernel<<<n_blocks, block_size>>>(
+        tables.perm, tables.n_ops, tables.n_sites, d_occ, n_configurations,
+        d_index, d_flag);
+    _check(cudaGetLastError(), "kernel launch");
+
+    _check(cudaMemcpy(to_canonical_index, d_index,
+                      n_configurations * sizeof(Index),
+                      cudaMemcpyDeviceToHost),
+           "cudaMemcpy");
+    _check(cudaMemcpy(is_canonical, d_flag, n_configurations,
+                      cudaMemcpyDeviceToHost),
+           "cudaMemcpy");
+  } catch (...) {
+    free_all();
+    throw;
+  }
+  free_all();
+}
+
+}  // namespace OccupationCanonicalizerImpl
+}  // namespace config
+}  // namespace CASM
@@ -1,15 +1,305 @@
 #include "casm/configuration/dof_space_analysis.hh"
 
+#include <cmath>
+#include <map>
+#include <mutex>
+
 #include "casm/casm_io/Log.hh"
 #include "casm/configuration/DoFSpace_functions.hh"
 #include "casm/configuration/Supercell.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/canonical_form.hh"
 #include "casm/configuration/group/subgroups.hh"
+#include "casm/configuration/irreps/IrrepDecompositionCache.hh"
+#include "casm/configuration/irreps/IrrepDecompositionImpl.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
 
 namespace CASM {
 namespace config {
 
+namespace {
+
+struct _OnceOrbitSet {
+  std::once_flag flag;
+  irreps::GroupIndicesOrbitSet value;
+};
+
+/// \brief Return a function that calls `f` on first use only, so that
+///     subgroups are found once for all k-point blocks
+std::function<irreps::GroupIndicesOrbitSet()> _make_once(
+    std::function<irreps::GroupIndicesOrbitSet()> f) {
+  auto data = std::make_shared<_OnceOrbitSet>();
+  return [=]() {
+    std::call_once(data->flag, [&]() { data->value = f(); });
+    return data->value;
+  };
+}
+
+/// \brief Make real orthonormal bases for the subspaces spanned by Bloch
+///     waves with k-points in each star
+///
+/// The k-points commensurate with the supercell are `k = T^{-T} m`, in the
+/// fractional coordinates of the prim reciprocal lattice, where `T` is the
+/// transformation matrix to the supercell, and one `m` for each lattice
+/// point of the supercell with transformation matrix `T^T`. A supercell
+/// symmetry operation with prim fractional point matrix `M` maps Bloch
+/// waves with k-point `k` to Bloch waves with k-point `M^{-T} k`, so the
+/// space spanned by Bloch waves with k-points in a star is invariant. Stars
+/// are closed under `k -> -k` so that they have real bases. The point
+/// operations of all of `group` are used, so the subspaces are also
+/// invariant for any subgroup.
+///
+/// \param supercell The supercell
+/// \param group The supercell symmetry operations
+/// \param sites The DoF space sites, in the order of the matrix
+///     representation blocks
+/// \param block_offset The beginning row of each site's block
+///
+/// \returns One basis per star, with rows in the order of the matrix
+///     representation, or null if `sites` does not include every
+///     translation of each sublattice it includes.
+std::optional<std::vector<Eigen::MatrixXd>> _make_kpoint_star_bases(
+    Supercell const &supercell, std::vector<SupercellSymOp> const &group,
+    std::set<Index> const &sites, std::vector<Index> const &block_offset) {
+  Index n_unitcells = supercell.unitcell_index_converter.total_sites();
+  std::map<Index, Index> sublattice_count;
+  for (Index site_index : sites) {
+    ++sublattice_count[supercell.unitcellcoord_index_converter(site_index)
+                           .sublattice()];
+  }
+  for (auto const &pair : sublattice_count) {
+    if (pair.second != n_unitcells) {
+      return std::nullopt;
+    }
+  }
+
+  // k-points
+  Eigen::Matrix3l T = supercell.superlattice.transformation_matrix_to_super();
+  xtal::UnitCellIndexConverter kpoint_index_converter(T.transpose());
+  Eigen::Matrix3d T_inv_transpose = T.cast<double>().inverse().transpose();
+  std::vector<Eigen::Vector3d> kpoints;
+  for (Index i = 0; i < n_unitcells; ++i) {
+    kpoints.push_back(T_inv_transpose *
+                      kpoint_index_converter(i).cast<double>());
+  }
+  auto kpoint_index = [&](Eigen::Vector3d const &k) {
+    Eigen::Vector3d m = T.transpose().cast<double>() * k;
+    return kpoint_index_converter(
+        UnitCell(std::lround(m(0)), std::lround(m(1)), std::lround(m(2))));
+  };
+
+  // k-point transformations, by prim factor group operation
+  xtal::Lattice const &prim_lattice =
+      supercell.prim->basicstructure->lattice();
+  Eigen::Matrix3d L = prim_lattice.lat_column_mat();
+  Eigen::Matrix3d L_inv = prim_lattice.inv_lat_column_mat();
+  std::set<Index> prim_fg_indices;
+  for (SupercellSymOp const &op : group) {
+    prim_fg_indices.insert(op.prim_factor_group_index());
+  }
+  std::vector<Eigen::Matrix3d> kpoint_transforms;
+  for (Index prim_fg_index : prim_fg_indices) {
+    Eigen::Matrix3d const &R =
+        supercell.prim->sym_info.factor_group->element[prim_fg_index].matrix;
+    kpoint_transforms.push_back((L_inv * R * L).inverse().transpose());
+  }
+
+  // stars, including -k
+  std::vector<Index> negative(n_unitcells);
+  for (Index i = 0; i < n_unitcells; ++i) {
+    negative[i] = kpoint_index(-kpoints[i]);
+  }
+  std::vector<Index> star_index(n_unitcells, -1);
+  std::vector<std::vector<Index>> stars;
+  for (Index i = 0; i < n_unitcells; ++i) {
+    if (star_index[i] != -1) {
+      continue;
+    }
+    std::vector<Index> star({i});
+    star_index[i] = stars.size();
+    for (Index j = 0; j < star.size(); ++j) {
+      std::vector<Index> images({negative[star[j]]});
+      for (Eigen::Matrix3d const &K : kpoint_transforms) {
+        images.push_back(kpoint_index(K * kpoints[star[j]]));
+      }
+      for (Index image : images) {
+        if (star_index[image] == -1) {
+          star_index[image] = stars.size();
+          star.push_back(image);
+        }
+      }
+    }
+    std::sort(star.begin(), star.end());
+    stars.push_back(std::move(star));
+  }
+
+  // rows by (sublattice, component), with the unit cell of each row
+  std::map<std::pair<Index, Index>, std::vector<std::pair<Index, UnitCell>>>
+      row_classes;
+  Index p = 0;
+  for (Index site_index : sites) {
+    xtal::UnitCellCoord bijk =
+        supercell.unitcellcoord_index_converter(site_index);
+    for (Index c = 0; c < block_offset[p + 1] - block_offset[p]; ++c) {
+      row_classes[std::make_pair(bijk.sublattice(), c)].emplace_back(
+          block_offset[p] + c, bijk.unitcell());
+    }
+    ++p;
+  }
+
+  // for each star, cos and sin waves for each pair of k and -k
+  Index dim = block_offset.back();
+  std::vector<Eigen::MatrixXd> bases;
+  for (std::vector<Index> const &star : stars) {
+    std::vector<Eigen::VectorXd> columns;
+    for (Index i : star) {
+      if (negative[i] < i) {
+        continue;
+      }
+      bool is_real = (negative[i] == i);
+      for (auto const &pair : row_classes) {
+        Eigen::VectorXd cos_wave = Eigen::VectorXd::Zero(dim);
+        Eigen::VectorXd sin_wave = Eigen::VectorXd::Zero(dim);
+        for (auto const &row : pair.second) {
+          double phase = 2.0 * M_PI * kpoints[i].dot(row.second.cast<double>());
+          cos_wave(row.first) = std::cos(phase);
+          sin_wave(row.first) = std::sin(phase);
+        }
+        columns.push_back(cos_wave.normalized());
+        if (!is_real) {
+          columns.push_back(sin_wave.normalized());
+        }
+      }
+    }
+    Eigen::MatrixXd basis(dim, columns.size());
+    for (Index j = 0; j < columns.size(); ++j) {
+      basis.col(j) = columns[j];
+    }
+    bases.push_back(std::move(basis));
+  }
+  return bases;
+}
+
+/// \brief Reorder irreps so those with identical characters are adjacent
+///     and indexed in order, as expected by VectorSpaceSymReport
+void _group_identical_irreps(std::vector<irreps::IrrepInfo> &irreps) {
+  std::vector<irreps::IrrepInfo> result;
+  std::vector<bool> is_placed(irreps.size(), false);
+  for (Index i = 0; i < irreps.size(); ++i) {
+    if (is_placed[i]) {
+      continue;
+    }
+    Index index = 0;
+    for (Index j = i; j < irreps.size(); ++j) {
+      if (!is_placed[j] &&
+          irreps[j].characters.size() == irreps[i].characters.size() &&
+          (irreps[j].characters - irreps[i].characters).cwiseAbs().maxCoeff() <
+              TOL) {
+        result.push_back(irreps[j]);
+        result.back().index = index++;
+        is_placed[j] = true;
+      }
+    }
+  }
+  irreps = std::move(result);
+}
+
+/// \brief Decompose the subspace of each k-point star separately, in
+///     parallel, and combine the results
+///
+/// \returns The combined decomposition, or null if the DoF space basis is
+///     not the direct sum of its projections onto the k-point star
+///     subspaces (for example, if default occupation modes are excluded
+///     using different default occupations on translationally equivalent
+///     sites).
+std::shared_ptr<irreps::IrrepDecomposition const>
+_make_kpoint_block_irrep_decomposition(
+    irreps::BlockPermutationMatrixRep const &rep,
+    std::vector<Eigen::MatrixXd> const &star_bases,
+    irreps::GroupIndices const &group_indices,
+    Eigen::MatrixXd const &init_subspace,
+    std::function<irreps::GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
+    std::function<irreps::GroupIndicesOrbitSet()> make_all_subgroups_f,
+    bool allow_complex, bool store_fullspace_rep, std::optional<Log> log,
+    std::shared_ptr<irreps::IrrepDecompositionCache> irrep_decomposition_cache,
+    Index n_threads) {
+  // project the DoF space basis onto each k-point star subspace
+  std::vector<Eigen::MatrixXd> block_init;
+  std::vector<Eigen::MatrixXd const *> block_basis;
+  Index total_dim = 0;
+  for (Eigen::MatrixXd const &B : star_bases) {
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> colqr(B.transpose() *
+                                                      init_subspace);
+    colqr.setThreshold(TOL);
+    if (colqr.rank() == 0) {
+      continue;
+    }
+    Eigen::MatrixXd Q = colqr.householderQ();
+    block_init.push_back(Q.leftCols(colqr.rank()));
+    block_basis.push_back(&B);
+    total_dim += colqr.rank();
+  }
+  if (total_dim != init_subspace.cols()) {
+    return nullptr;
+  }
+
+  make_cyclic_subgroups_f = _make_once(make_cyclic_subgroups_f);
+  make_all_subgroups_f = _make_once(make_all_subgroups_f);
+
+  Index n_blocks = block_init.size();
+  std::vector<std::shared_ptr<irreps::IrrepDecomposition const>> block_result(
+      n_blocks);
+  parallel_for_items(n_blocks, n_threads, [&](Index s) {
+    Eigen::MatrixXd const &B = *block_basis[s];
+    irreps::MatrixRep block_rep;
+    block_rep.reserve(rep.size());
+    for (irreps::BlockPermutationMatrix const &M : rep) {
+      block_rep.push_back(B.transpose() * (M * B));
+    }
+    if (irrep_decomposition_cache) {
+      block_result[s] = irrep_decomposition_cache->make(
+          block_rep, group_indices, block_init[s], make_cyclic_subgroups_f,
+          make_all_subgroups_f, allow_complex);
+    } else {
+      block_result[s] = std::make_shared<irreps::IrrepDecomposition const>(
+          block_rep, group_indices, block_init[s], make_cyclic_subgroups_f,
+          make_all_subgroups_f, allow_complex);
+    }
+  });
+
+  Eigen::MatrixXd subspace(init_subspace.rows(), total_dim);
+  std::vector<irreps::IrrepInfo> combined_irreps;
+  Index col = 0;
+  for (Index s = 0; s < n_blocks; ++s) {
+    Eigen::MatrixXd const &B = *block_basis[s];
+    Eigen::MatrixXd const &block_subspace = block_result[s]->subspace;
+    subspace.block(0, col, subspace.rows(), block_subspace.cols()) =
+        B * block_subspace;
+    col += block_subspace.cols();
+    for (irreps::IrrepInfo const &irrep :
+         irreps::IrrepDecompositionImpl::make_fullspace_irreps(
+             block_result[s]->irreps, B)) {
+      combined_irreps.push_back(irrep);
+    }
+  }
+  _group_identical_irreps(combined_irreps);
+
+  if (log.has_value()) {
+    log->indent() << "IrrepDecomposition: " << n_blocks
+                  << " k-point star blocks" << std::endl;
+  }
+
+  if (store_fullspace_rep) {
+    return std::make_shared<irreps::IrrepDecomposition const>(
+        rep, group_indices, subspace, combined_irreps, log);
+  }
+  return std::make_shared<irreps::IrrepDecomposition const>(
+      irreps::MatrixRep(), group_indices, subspace, combined_irreps, log);
+}
+
+}  // namespace
+
 DoFSpaceAnalysisResults::DoFSpaceAnalysisResults(
     clexulator::DoFSpace _symmetry_adapted_dof_space,
     irreps::VectorSpaceSymReport _symmetry_report)
@@ -40,6 +330,24 @@ DoFSpaceAnalysisResults::DoFSpaceAnalysisResults(
 /// \param log Optional logger. If has value and `log->verbosity() >=
 /// Log::verbose`,
 ///     prints step-by-step results to log.
+/// \param irrep_decomposition_cache Optional cache of irrep decompositions.
+///     If not null, an irrep decomposition with the same matrix
+///     representation and DoF space basis found by a previous analysis
+///     using the same cache is reused.
+/// \param n_threads Number of threads to use. If `use_kpoint_blocks`, the
+///     k-point star blocks are decomposed in parallel, otherwise this is passed
+///     to IrrepDecomposition. If `n_threads <= 0`, use the number of threads
+///     set by `set_num_threads`.
+/// \param use_kpoint_blocks If true, and the DoF is local with DoFSpace
+///     sites that include every translation of each sublattice included,
+///     the subspaces spanned by Bloch waves with k-points in each star are
+///     decomposed separately, and in parallel. Each decomposition uses
+///     matrices with the dimension of the star subspace, rather than of
+///     the full DoF space. The symmetry adapted basis spans the same
+///     irreducible subspaces, but may be ordered differently. Unless
+///     `calc_wedges`, `symmetry_report.symgroup_rep` is empty to bound
+///     memory use. If the DoF space basis is not the direct sum of its
+///     projections onto the star subspaces, the full space is decomposed.
 DoFSpaceAnalysisResults dof_space_analysis(
     clexulator::DoFSpace const &dof_space_in, std::shared_ptr<Prim const> prim,
     std::optional<Configuration> configuration,
@@ -47,7 +355,9 @@ DoFSpaceAnalysisResults dof_space_analysis(
     bool include_default_occ_modes,
     std::optional<std::map<int, int>> sublattice_index_to_default_occ,
     std::optional<std::map<Index, int>> site_index_to_default_occ,
-    bool calc_wedges, std::optional<Log> log) {
+    bool calc_wedges, std::optional<Log> log,
+    std::shared_ptr<irreps::IrrepDecompositionCache> irrep_decomposition_cache,
+    Index n_threads, bool use_kpoint_blocks) {
   if (dof_space_in.basis.cols() == 0) {
     std::stringstream msg;
     msg << "Error in dof_space_analysis: "
@@ -78,7 +388,7 @@ DoFSpaceAnalysisResults dof_space_analysis(
 
   clexulator::DoFSpace dof_space = exclude_default_occ_modes(
       dof_space_pre1, include_default_occ_modes,
-      sublattice_index_to_default_occ, site_index_to_default_occ);
+      sublattice_index_to_default_occ, site_index_to_default_occ, n_threads);
   if (dof_space.basis.cols() == 0) {
     std::stringstream msg;
     msg << "Error in dof_space_analysis: "
@@ -108,14 +418,28 @@ DoFSpaceAnalysisResults dof_space_analysis(
   }
 
   // get matrix rep and associated SymGroup
-  // (for global DoF, this makes the point group, removing duplicates)
+  // (for global DoF, this makes the point group, removing duplicates;
+  // for local DoF, this makes a block permutation matrix rep, which is
+  // applied without dense expansion)
   std::shared_ptr<SymGroup const> symgroup;
-  std::vector<Eigen::MatrixXd> matrix_rep =
-      make_matrix_rep(group, dof_space.dof_key, dof_space.sites, symgroup);
+  std::vector<Eigen::MatrixXd> matrix_rep;
+  std::optional<irreps::BlockPermutationMatrixRep> block_matrix_rep;
+  if (dof_space.is_global) {
+    matrix_rep = make_global_dof_matrix_rep(group, dof_space.dof_key, symgroup);
+  } else {
+    if (!dof_space.sites.has_value()) {
+      throw std::runtime_error(
+          "Error in dof_space_analysis: local DoFSpace has no sites");
+    }
+    block_matrix_rep = make_local_dof_block_matrix_rep(
+        group, dof_space.dof_key, *dof_space.sites, symgroup);
+  }
+  Index group_size = block_matrix_rep.has_value() ? block_matrix_rep->size()
+                                                  : matrix_rep.size();
 
   // use the entire group for irrep decomposition
   std::set<Index> group_indices;
-  for (Index i = 0; i < matrix_rep.size(); ++i) {
+  for (Index i = 0; i < group_size; ++i) {
     group_indices.insert(i);
   }
 
@@ -128,16 +452,42 @@ DoFSpaceAnalysisResults dof_space_analysis(
 
   bool allow_complex = true;
 
-  irreps::IrrepDecomposition irrep_decomposition(
-      matrix_rep, group_indices, dof_space.basis, make_cyclic_subgroups_f,
-      make_all_subgroups_f, allow_complex, log);
+  std::shared_ptr<irreps::IrrepDecomposition const> irrep_decomposition;
+  if (use_kpoint_blocks && block_matrix_rep.has_value()) {
+    std::optional<std::vector<Eigen::MatrixXd>> star_bases =
+        _make_kpoint_star_bases(*supercell, group, *dof_space.sites,
+                                block_matrix_rep->at(0).block_offset);
+    if (star_bases.has_value()) {
+      irrep_decomposition = _make_kpoint_block_irrep_decomposition(
+          *block_matrix_rep, *star_bases, group_indices, dof_space.basis,
+          make_cyclic_subgroups_f, make_all_subgroups_f, allow_complex,
+          calc_wedges, log, irrep_decomposition_cache, n_threads);
+    }
+  }
 
-  // Generate report, based on constructed inputs
-  irreps::VectorSpaceSymReport symmetry_report = vector_space_sym_report(
-      irrep_decomposition, calc_wedges, dof_space.axis_info.glossary);
+  if (irrep_decomposition) {
+    // found using k-point blocks
+  } else if (irrep_decomposition_cache) {
+    // results are keyed by the dense matrix rep
+    if (block_matrix_rep.has_value()) {
+      matrix_rep = irreps::to_dense(*block_matrix_rep);
+    }
+    irrep_decomposition = irrep_decomposition_cache->make(
+        matrix_rep, group_indices, dof_space.basis, make_cyclic_subgroups_f,
+        make_all_subgroups_f, allow_complex, log, n_threads);
+  } else if (block_matrix_rep.has_value()) {
+    irrep_decomposition = std::make_shared<irreps::IrrepDecomposition const>(
+        *block_matrix_rep, group_indices, dof_space.basis,
+        make_cyclic_subgroups_f, make_all_subgroups_f, allow_complex, log,
+        n_threads);
+  } else {
+    irrep_decomposition = std::make_shared<irreps::IrrepDecomposition const>(
+        matrix_rep, group_indices, dof_space.basis, make_cyclic_subgroups_f,
+        make_all_subgroups_f, allow_complex, log, n_threads);
+  }
 
-  // check for error occuring for "disp"
-  if (symmetry_report.symmetry_adapted_subspace.cols() <
+  // check for error occuring for "disp", before constructing the report
+  if (irrep_decomposition->symmetry_adapted_subspace.cols() <
       dof_space.basis.cols()) {
     std::stringstream msg;
     msg << "Error in dof_space_analysis: "
@@ -145,6 +495,11 @@ DoFSpaceAnalysisResults dof_space_analysis(
     throw dof_space_analysis_error(msg.str());
   }
 
+  // Generate report, based on constructed inputs
+  irreps::VectorSpaceSymReport symmetry_report =
+      vector_space_sym_report(*irrep_decomposition, calc_wedges,
+                              dof_space.axis_info.glossary, n_threads);
+
   clexulator::DoFSpace symmetry_adapted_dof_space = clexulator::make_dof_space(
       dof_space.dof_key, dof_space.prim,
       supercell->superlattice.transformation_matrix_to_super(), dof_space.sites,
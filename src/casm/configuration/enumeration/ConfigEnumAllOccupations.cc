@@ -1,5 +1,14 @@
 #include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
 
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/PrimitiveConfigurationChecker.hh"
+#include "casm/configuration/parallel.hh"
+
 namespace CASM {
 namespace config {
 
@@ -22,6 +31,16 @@ std::vector<int> _make_max_site_occupation(Supercell const &supercell,
   return max_site_occupation;
 }
 
+/// \brief Number of occupations, as a double because it may exceed the
+///     range of Index
+double _count_occupations(std::vector<int> const &max_site_occupation) {
+  double n = 1.0;
+  for (int max_occupation : max_site_occupation) {
+    n *= max_occupation + 1;
+  }
+  return n;
+}
+
 void _set_occupation(Configuration &configuration, std::set<Index> const &sites,
                      std::vector<int> const &value) {
   Index i = 0;
@@ -30,32 +49,412 @@ void _set_occupation(Configuration &configuration, std::set<Index> const &sites,
   }
 }
 
+/// \brief Copy background, with occupation fixed on the leading sites
+Configuration _make_fixed_background(Configuration const &background,
+                                     std::set<Index> const &sites,
+                                     std::vector<int> const &fixed_occupation) {
+  if (fixed_occupation.size() && fixed_occupation.size() >= sites.size()) {
+    throw std::runtime_error(
+        "Error in ConfigEnumAllOccupations: fixed_occupation.size() must be "
+        "less than sites.size()");
+  }
+  std::vector<int> max_site_occupation =
+      _make_max_site_occupation(*background.supercell, sites);
+  Configuration fixed_background(background);
+  Index i = 0;
+  for (Index site_index : sites) {
+    if (i == fixed_occupation.size()) {
+      break;
+    }
+    if (fixed_occupation[i] < 0 ||
+        fixed_occupation[i] > max_site_occupation[i]) {
+      throw std::runtime_error(
+          "Error in ConfigEnumAllOccupations: invalid fixed_occupation");
+    }
+    fixed_background.dof_values.occupation(site_index) = fixed_occupation[i];
+    ++i;
+  }
+  return fixed_background;
+}
+
+/// \brief Sites remaining after the first `n_fixed` sites
+std::set<Index> _make_unfixed_sites(std::set<Index> const &sites,
+                                    Index n_fixed) {
+  auto begin = sites.begin();
+  std::advance(begin, std::min(n_fixed, Index(sites.size())));
+  return std::set<Index>(begin, sites.end());
+}
+
 }  // namespace
 
 ConfigEnumAllOccupations::ConfigEnumAllOccupations(
     Configuration const &background, std::set<Index> const &sites)
     : m_current(background),
       m_sites(sites),
-      m_counter(std::vector<int>(m_sites.size(), 0),
-                _make_max_site_occupation(*m_current.supercell, m_sites),
-                std::vector<int>(m_sites.size(), 1)) {
+      m_site_indices(m_sites.begin(), m_sites.end()),
+      m_max_site_occupation(
+          _make_max_site_occupation(*m_current.supercell, m_sites)),
+      m_counter(m_sites.size(), 0),
+      m_gray_code(false),
+      m_direction(m_sites.size(), 1),
+      m_is_valid(true) {
   _set_occupation(m_current, m_sites, m_counter);
 }
 
+/// \brief Constructor, enumerating one partition of the occupations
+///
+/// \param background Specifies the background configuration.
+/// \param sites A set of site indices where occupant values are enumerated.
+/// \param fixed_occupation Occupant indices for the first
+///     `fixed_occupation.size()` sites in `sites` (in sorted order), which are
+///     held fixed. Occupations are enumerated on the remaining sites. Must be
+///     empty or have size less than `sites.size()`.
+/// \param gray_code If true, enumerate in reflected mixed-radix Gray code
+///     order, so that each call to `advance` changes the occupation of
+///     exactly one site. The same configurations are enumerated, in a
+///     different order.
+///
+/// Enumerators constructed with all distinct values of `fixed_occupation`,
+/// as generated by `make_occupation_partitions`, enumerate disjoint sets of
+/// configurations whose union is the enumeration performed by
+/// `ConfigEnumAllOccupations(background, sites)`.
+ConfigEnumAllOccupations::ConfigEnumAllOccupations(
+    Configuration const &background, std::set<Index> const &sites,
+    std::vector<int> const &fixed_occupation, bool gray_code)
+    : ConfigEnumAllOccupations(
+          _make_fixed_background(background, sites, fixed_occupation),
+          _make_unfixed_sites(sites, fixed_occupation.size())) {
+  m_gray_code = gray_code;
+}
+
 /// \brief Get the current Configuration
 Configuration const &ConfigEnumAllOccupations::value() const {
   return m_current;
 }
 
+/// \brief Occupation changes made by the last call to `advance`
+///
+/// Empty after construction and `set_counter_value`. In Gray code order,
+/// each call to `advance` that gives a valid value makes exactly one
+/// change. In lexicographic order, the first sites may be reset to 0 before
+/// one site is incremented, and the incremented site is last.
+std::vector<OccupationDelta> const &ConfigEnumAllOccupations::delta() const {
+  return m_delta;
+}
+
+/// \brief True if enumerating in Gray code order
+bool ConfigEnumAllOccupations::gray_code() const { return m_gray_code; }
+
 /// \brief Generate the next Configuration
+///
+/// Only the occupation of sites that change is written, as recorded in
+/// `delta()`.
 void ConfigEnumAllOccupations::advance() {
-  if (++m_counter) {
-    _set_occupation(m_current, m_sites, m_counter);
+  _advance();
+  if (m_progress && m_is_valid) {
+    m_progress->add_generated();
+  }
+}
+
+void ConfigEnumAllOccupations::_advance() {
+  m_delta.clear();
+  if (!m_is_valid) {
+    return;
+  }
+  if (m_gray_code) {
+    // move the fastest site that can move in its direction, and reverse
+    // the direction of the faster sites, which are at an end of their range
+    for (Index i = 0; i < m_counter.size(); ++i) {
+      int next = m_counter[i] + m_direction[i];
+      if (next >= 0 && next <= m_max_site_occupation[i]) {
+        _set_counter(i, next);
+        return;
+      }
+      m_direction[i] = -m_direction[i];
+    }
+    m_is_valid = false;
+    return;
+  }
+  Index i = 0;
+  while (i < m_counter.size() && m_counter[i] == m_max_site_occupation[i]) {
+    ++i;
+  }
+  if (i == m_counter.size()) {
+    m_is_valid = false;
+    return;
+  }
+  for (Index j = 0; j < i; ++j) {
+    if (m_counter[j] != 0) {
+      _set_counter(j, 0);
+    }
+  }
+  _set_counter(i, m_counter[i] + 1);
+}
+
+/// \brief Set `m_counter[i]` and the corresponding occupation, and record
+///     the change
+void ConfigEnumAllOccupations::_set_counter(Index i, int value) {
+  Index site_index = m_site_indices[i];
+  m_delta.push_back({site_index, m_counter[i], value});
+  m_counter[i] = value;
+  m_current.dof_values.occupation(site_index) = value;
+}
+
+/// \brief Set m_direction from m_counter
+///
+/// In reflected Gray code order, each step changes the sum of the counter
+/// elements by one, so the direction of element `i` is +1 if the sum of the
+/// slower elements, `j > i`, is even, and -1 if it is odd.
+void ConfigEnumAllOccupations::_set_direction() {
+  int sum = 0;
+  for (Index i = Index(m_counter.size()) - 1; i >= 0; --i) {
+    m_direction[i] = (sum % 2 == 0) ? 1 : -1;
+    sum += m_counter[i];
   }
 }
 
 /// \brief Return true if `value` is valid, false if no more values
-bool ConfigEnumAllOccupations::is_valid() const { return m_counter.valid(); }
+bool ConfigEnumAllOccupations::is_valid() const { return m_is_valid; }
+
+/// \brief Occupant indices on the enumerated sites, in sorted order
+///
+/// The counter value, with the background and sites, completely specifies
+/// the state of the enumeration, so it can be saved to checkpoint an
+/// enumeration.
+std::vector<int> const &ConfigEnumAllOccupations::counter_value() const {
+  return m_counter;
+}
+
+/// \brief Set the occupant indices on the enumerated sites, in sorted
+///     order, to resume enumeration
+///
+/// \param value Occupant indices on the enumerated sites, as from
+///     `counter_value`. Enumeration continues from `value`, which becomes
+///     the current value, in the same order as if `value` had been reached
+///     by calling `advance`. In Gray code order, the direction of each site
+///     is determined by `value`, so no other state is needed.
+void ConfigEnumAllOccupations::set_counter_value(
+    std::vector<int> const &value) {
+  if (value.size() != m_counter.size()) {
+    throw std::runtime_error(
+        "Error in ConfigEnumAllOccupations::set_counter_value: size mismatch");
+  }
+  for (Index i = 0; i < value.size(); ++i) {
+    if (value[i] < 0 || value[i] > m_max_site_occupation[i]) {
+      throw std::runtime_error(
+          "Error in ConfigEnumAllOccupations::set_counter_value: invalid "
+          "value");
+    }
+  }
+  m_counter = value;
+  m_is_valid = true;
+  m_delta.clear();
+  _set_direction();
+  _set_occupation(m_current, m_sites, m_counter);
+}
+
+/// \brief Number of values of the counter, i.e. the number of
+///     configurations enumerated from the first value
+///
+/// This is the product of the number of allowed occupants on each
+/// enumerated site, as a double because it may exceed the range of Index.
+double ConfigEnumAllOccupations::n_total() const {
+  return _count_occupations(m_max_site_occupation);
+}
+
+/// \brief Count the values generated in `progress`
+///
+/// \param progress If not null, `n_total()` is added to its estimated total,
+///     and the current value, if valid, and each value generated by
+///     `advance` are added to its generated count. Counts are not changed
+///     by `set_counter_value`.
+void ConfigEnumAllOccupations::set_progress(
+    std::shared_ptr<EnumProgress> const &progress) {
+  m_progress = progress;
+  if (m_progress) {
+    m_progress->add_total(n_total());
+    if (m_is_valid) {
+      m_progress->add_generated();
+    }
+  }
+}
+
+/// \brief Split the occupations enumerated on `sites` into disjoint
+///     partitions
+///
+/// \param background Specifies the background configuration.
+/// \param sites A set of site indices where occupant values are enumerated.
+/// \param min_n_partitions The minimum number of partitions requested.
+///
+/// \returns partitions All combinations of occupant indices on the fewest
+///     leading sites of `sites` that give at least `min_n_partitions`
+///     partitions. At least one site is always left unfixed, so fewer
+///     partitions may be returned. Each element is a valid
+///     `fixed_occupation` argument for the `ConfigEnumAllOccupations`
+///     constructor.
+std::vector<std::vector<int>> make_occupation_partitions(
+    Configuration const &background, std::set<Index> const &sites,
+    Index min_n_partitions) {
+  std::vector<int> max_site_occupation =
+      _make_max_site_occupation(*background.supercell, sites);
+
+  Index n_fixed = 0;
+  Index n_partitions = 1;
+  while (n_partitions < min_n_partitions &&
+         n_fixed + 1 < Index(sites.size())) {
+    n_partitions *= max_site_occupation[n_fixed] + 1;
+    ++n_fixed;
+  }
+
+  std::vector<std::vector<int>> partitions;
+  partitions.reserve(n_partitions);
+  std::vector<int> fixed_occupation(n_fixed, 0);
+  while (true) {
+    partitions.push_back(fixed_occupation);
+    Index i = 0;
+    while (i < n_fixed && fixed_occupation[i] == max_site_occupation[i]) {
+      fixed_occupation[i] = 0;
+      ++i;
+    }
+    if (i == n_fixed) {
+      break;
+    }
+    ++fixed_occupation[i];
+  }
+  return partitions;
+}
+
+/// \brief Enumerate occupations on `sites` in parallel and return the
+///     distinct canonical configurations that pass a filter
+///
+/// \param background Specifies the background configuration.
+/// \param sites A set of site indices where occupant values are enumerated.
+/// \param filter Canonical configurations for which `filter` returns false
+///     are excluded. Must be safe to call concurrently from multiple threads.
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+/// \param progress If not null, the number of occupations is added to its
+///     estimated total, and each thread adds to its counts after each batch:
+///     all configurations as generated, those already in canonical form as
+///     canonical, and those that also pass `filter` as accepted, so that
+///     `n_accepted` counts the distinct results.
+/// \param skip_non_primitive If true, non-primitive configurations are
+///     skipped as they are enumerated, before canonicalization, using a
+///     PrimitiveConfigurationChecker. Being primitive does not change under
+///     symmetry operations, so this gives the same results as excluding
+///     non-primitive configurations with `filter`, but they are not
+///     canonicalized first. Skipped configurations are counted by
+///     `progress` as generated only.
+///
+/// \returns distinct_configurations The distinct canonical forms, with
+///     respect to all operations that leave the supercell lattice invariant,
+///     of the configurations enumerated by
+///     `ConfigEnumAllOccupations(background, sites)`, that pass `filter`.
+///
+/// Method:
+/// - The enumeration is split by `make_occupation_partitions` into several
+///   partitions per thread, and each thread enumerates a contiguous range of
+///   partitions.
+/// - Each thread canonicalizes its configurations in batches and applies
+///   `filter`, keeping its own set of distinct results, which are merged
+///   after the thread finishes.
+std::set<Configuration> make_distinct_occupations(
+    Configuration const &background, std::set<Index> const &sites,
+    ConfigurationFilter const &filter, Index n_threads, EnumProgress *progress,
+    bool skip_non_primitive) {
+  CanonicalFormEngine engine(background.supercell);
+  return make_distinct_occupations(engine, background, sites, filter,
+                                   n_threads, progress, skip_non_primitive);
+}
+
+/// \brief Enumerate occupations on `sites` in parallel and return the
+///     distinct canonical configurations that pass a filter
+///
+/// Same as the overload without `engine`, except that canonical forms are
+/// found with respect to `engine.ops()`, which allows reusing one engine for
+/// many calls.
+std::set<Configuration> make_distinct_occupations(
+    CanonicalFormEngine const &engine, Configuration const &background,
+    std::set<Index> const &sites, ConfigurationFilter const &filter,
+    Index n_threads, EnumProgress *progress, bool skip_non_primitive) {
+  Index const partitions_per_thread = 8;
+  Index const batch_size = 10000;
+
+  n_threads = resolve_n_threads(n_threads, std::numeric_limits<Index>::max());
+  Index min_n_partitions =
+      (n_threads == 1) ? 1 : n_threads * partitions_per_thread;
+  std::vector<std::vector<int>> partitions =
+      make_occupation_partitions(background, sites, min_n_partitions);
+  if (progress) {
+    progress->add_total(_count_occupations(
+        _make_max_site_occupation(*background.supercell, sites)));
+  }
+
+  std::optional<PrimitiveConfigurationChecker> primitive_checker;
+  if (skip_non_primitive) {
+    primitive_checker.emplace(background.supercell);
+  }
+
+  std::set<Configuration> distinct_configurations;
+  std::mutex distinct_configurations_mutex;
+  parallel_for_chunks(
+      partitions.size(), n_threads, [&](Index begin, Index end) {
+        std::set<Configuration> thread_configurations;
+        std::vector<Configuration> batch;
+        batch.reserve(batch_size);
+        Index n_skipped = 0;
+        auto insert_batch = [&]() {
+          std::vector<Configuration> canonical_forms =
+              engine.make_canonical_forms(batch);
+          Index n_canonical = 0;
+          Index n_accepted = 0;
+          for (Index j = 0; j < canonical_forms.size(); ++j) {
+            Configuration &canonical = canonical_forms[j];
+            bool is_new = !thread_configurations.count(canonical);
+            bool is_accepted = !is_new || filter(canonical);
+            // each occupation is generated once, so counting those that are
+            // already canonical counts each distinct canonical form once
+            if (progress && canonical == batch[j]) {
+              ++n_canonical;
+              n_accepted += is_accepted;
+            }
+            if (is_new && is_accepted) {
+              thread_configurations.emplace(std::move(canonical));
+            }
+          }
+          if (progress) {
+            progress->add_canonical(n_canonical);
+            progress->add_accepted(n_accepted);
+            progress->add_generated(batch.size() + n_skipped);
+          }
+          batch.clear();
+          n_skipped = 0;
+        };
+
+        for (Index i = begin; i < end; ++i) {
+          ConfigEnumAllOccupations enumerator(background, sites,
+                                              partitions[i]);
+          while (enumerator.is_valid()) {
+            if (primitive_checker &&
+                !primitive_checker->is_primitive(enumerator.value())) {
+              ++n_skipped;
+              enumerator.advance();
+              continue;
+            }
+            batch.push_back(enumerator.value());
+            if (batch.size() == batch_size) {
+              insert_batch();
+            }
+            enumerator.advance();
+          }
+        }
+        insert_batch();
+
+        std::lock_guard<std::mutex> lock(distinct_configurations_mutex);
+        distinct_configurations.merge(thread_configurations);
+      });
+  return distinct_configurations;
+}
 
 }  // namespace config
 }  // namespace CASM
@@ -0,0 +1,277 @@
+#include "casm/configuration/enumeration/ConfigEnumCanonicalOccupations.hh"
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/crystallography/BasicStructure.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// \brief Indices of the operations that leave the background global DoF
+///     values exactly unchanged
+///
+/// For these operations ConfigCompare compares occupation first, so an
+/// occupation that is greater after transformation proves that the
+/// configuration is not canonical.
+std::vector<Index> _make_pruning_op_indices(CanonicalFormEngine const &engine,
+                                            Configuration const &background) {
+  auto const &global_dof_values = background.dof_values.global_dof_values;
+  std::vector<Index> pruning_op_indices;
+  for (Index i = 0; i < engine.ops().size(); ++i) {
+    if (global_dof_values.empty()) {
+      pruning_op_indices.push_back(i);
+      continue;
+    }
+    Configuration transformed = copy_apply(engine.ops()[i], background);
+    if (transformed.dof_values.global_dof_values == global_dof_values) {
+      pruning_op_indices.push_back(i);
+    }
+  }
+  return pruning_op_indices;
+}
+
+}  // namespace
+
+/// \brief Constructor, using all operations that leave the supercell
+///     lattice invariant
+///
+/// \param background Specifies the background configuration.
+/// \param sites A set of site indices where occupant values are enumerated.
+///     All other sites in the background configuration maintain the
+///     original value.
+/// \param occupant_counts If given, fixes the composition:
+///     `(*occupant_counts)[b][i]` is the number of sites in `sites` on
+///     sublattice `b` with occupant index `i`. The counts for each sublattice
+///     must sum to the number of sites in `sites` on that sublattice.
+///     Sublattices with no sites in `sites` may have empty counts.
+ConfigEnumCanonicalOccupations::ConfigEnumCanonicalOccupations(
+    Configuration const &background, std::set<Index> const &sites,
+    std::optional<std::vector<std::vector<Index>>> const &occupant_counts)
+    : ConfigEnumCanonicalOccupations(
+          std::make_shared<CanonicalFormEngine const>(background.supercell),
+          background, sites, occupant_counts) {}
+
+/// \brief Constructor, using the operations of an existing engine
+///
+/// \param engine Determines which operations a canonical configuration must
+///     compare greater than or equal to. Must be constructed for the
+///     background configuration's supercell.
+/// \param background Specifies the background configuration.
+/// \param sites A set of site indices where occupant values are enumerated.
+///     All other sites in the background configuration maintain the
+///     original value.
+/// \param occupant_counts If given, fixes the composition:
+///     `(*occupant_counts)[b][i]` is the number of sites in `sites` on
+///     sublattice `b` with occupant index `i`. The counts for each sublattice
+///     must sum to the number of sites in `sites` on that sublattice.
+///     Sublattices with no sites in `sites` may have empty counts.
+ConfigEnumCanonicalOccupations::ConfigEnumCanonicalOccupations(
+    std::shared_ptr<CanonicalFormEngine const> const &engine,
+    Configuration const &background, std::set<Index> const &sites,
+    std::optional<std::vector<std::vector<Index>>> const &occupant_counts)
+    : m_engine(throw_if_equal_to_nullptr(
+          engine, "Error in ConfigEnumCanonicalOccupations: engine is empty")),
+      m_current(background),
+      m_sites(sites.begin(), sites.end()),
+      m_fixed_counts(occupant_counts.has_value()),
+      m_site_position(m_engine->n_sites(), -1),
+      m_depth(0),
+      m_valid(false) {
+  if (background.supercell != m_engine->supercell() &&
+      *background.supercell != *m_engine->supercell()) {
+    throw std::runtime_error(
+        "Error in ConfigEnumCanonicalOccupations: background supercell does "
+        "not match engine supercell");
+  }
+
+  auto const &converter = m_current.supercell->unitcellcoord_index_converter;
+  auto const &basis = m_current.supercell->prim->basicstructure->basis();
+  for (Index i = 0; i < m_sites.size(); ++i) {
+    Index site_index = m_sites[i];
+    if (site_index < 0 || site_index >= m_engine->n_sites()) {
+      throw std::runtime_error(
+          "Error in ConfigEnumCanonicalOccupations: invalid site index");
+    }
+    Index b = converter(site_index).sublattice();
+    m_site_position[site_index] = i;
+    m_sublattice.push_back(b);
+    m_max_occupation.push_back(basis[b].occupant_dof().size() - 1);
+  }
+
+  if (m_fixed_counts) {
+    m_remaining_counts = *occupant_counts;
+    if (m_remaining_counts.size() != basis.size()) {
+      throw std::runtime_error(
+          "Error in ConfigEnumCanonicalOccupations: occupant_counts size does "
+          "not match the number of sublattices");
+    }
+    std::vector<Index> n_sites(basis.size(), 0);
+    for (Index b : m_sublattice) {
+      ++n_sites[b];
+    }
+    for (Index b = 0; b < basis.size(); ++b) {
+      auto const &counts = m_remaining_counts[b];
+      if (counts.empty() && n_sites[b] == 0) {
+        continue;
+      }
+      if (counts.size() != basis[b].occupant_dof().size()) {
+        throw std::runtime_error(
+            "Error in ConfigEnumCanonicalOccupations: occupant_counts[b] size "
+            "does not match the number of occupants on sublattice b");
+      }
+      Index sum = 0;
+      for (Index count : counts) {
+        if (count < 0) {
+          throw std::runtime_error(
+              "Error in ConfigEnumCanonicalOccupations: negative occupant "
+              "count");
+        }
+        sum += count;
+      }
+      if (sum != n_sites[b]) {
+        throw std::runtime_error(
+            "Error in ConfigEnumCanonicalOccupations: occupant_counts[b] does "
+            "not sum to the number of sites enumerated on sublattice b");
+      }
+    }
+  }
+  m_pruning_op_indices = _make_pruning_op_indices(*m_engine, m_current);
+
+  _search();
+}
+
+/// \brief Get the current Configuration
+Configuration const &ConfigEnumCanonicalOccupations::value() const {
+  return m_current;
+}
+
+/// \brief Generate the next Configuration
+void ConfigEnumCanonicalOccupations::advance() {
+  if (!m_valid) {
+    return;
+  }
+  if (!_next_sibling()) {
+    m_valid = false;
+    return;
+  }
+  _search();
+}
+
+/// \brief Return true if `value` is valid, false if no more values
+bool ConfigEnumCanonicalOccupations::is_valid() const { return m_valid; }
+
+/// \brief Return true if no completion of the current partial assignment
+///     can be canonical
+///
+/// The determined sites are those not in `m_sites`, and the first `m_depth`
+/// sites of `m_sites`. For each pruning operation, the current and
+/// transformed occupations are compared site by site, in the same
+/// lexicographic order used by `CanonicalFormEngine`, until a site whose
+/// value, or whose transformed value, is not yet determined. If a
+/// transformed value is found to be greater first, the partial assignment is
+/// pruned.
+bool ConfigEnumCanonicalOccupations::_is_pruned() const {
+  Eigen::VectorXi const &occupation = m_current.dof_values.occupation;
+  Index const end =
+      (m_depth < Index(m_sites.size())) ? m_sites[m_depth] : m_engine->n_sites();
+  for (Index op_index : m_pruning_op_indices) {
+    Index const *permutation = m_engine->permutation(op_index);
+    for (Index l = 0; l < end; ++l) {
+      if (m_site_position[permutation[l]] >= m_depth) {
+        break;
+      }
+      int const A = occupation[l];
+      int const B = m_engine->occupation_value(occupation, op_index, l);
+      if (A != B) {
+        if (A < B) {
+          return true;
+        }
+        break;
+      }
+    }
+  }
+  return false;
+}
+
+/// \brief Assign the first allowed occupant to `m_sites[k]`
+///
+/// If occupant counts are fixed, this is the lowest occupant index with a
+/// remaining count, which is taken. One always exists, because the remaining
+/// counts on a sublattice sum to the number of its unassigned sites.
+void ConfigEnumCanonicalOccupations::_first_value(Index k) {
+  int &value = m_current.dof_values.occupation(m_sites[k]);
+  value = 0;
+  if (m_fixed_counts) {
+    std::vector<Index> &remaining = m_remaining_counts[m_sublattice[k]];
+    while (remaining[value] == 0) {
+      ++value;
+    }
+    --remaining[value];
+  }
+}
+
+/// \brief Assign the next allowed occupant to `m_sites[k]`; return false,
+///     releasing the current occupant, if there is none
+bool ConfigEnumCanonicalOccupations::_next_value(Index k) {
+  int &value = m_current.dof_values.occupation(m_sites[k]);
+  if (!m_fixed_counts) {
+    if (value < m_max_occupation[k]) {
+      ++value;
+      return true;
+    }
+    value = 0;
+    return false;
+  }
+  std::vector<Index> &remaining = m_remaining_counts[m_sublattice[k]];
+  ++remaining[value];
+  for (int next = value + 1; next <= m_max_occupation[k]; ++next) {
+    if (remaining[next] > 0) {
+      --remaining[next];
+      value = next;
+      return true;
+    }
+  }
+  value = 0;
+  return false;
+}
+
+/// \brief Move to the next partial assignment at the current depth or
+///     above; return false if the search is complete
+bool ConfigEnumCanonicalOccupations::_next_sibling() {
+  while (m_depth > 0) {
+    if (_next_value(m_depth - 1)) {
+      return true;
+    }
+    --m_depth;
+  }
+  return false;
+}
+
+/// \brief Search from the current partial assignment for the next
+///     canonical configuration
+///
+/// On return, either `m_valid` is true and `m_current` is the next canonical
+/// configuration, or `m_valid` is false and the search is complete.
+void ConfigEnumCanonicalOccupations::_search() {
+  while (true) {
+    if (m_depth == Index(m_sites.size())) {
+      if (m_engine->is_canonical(m_current)) {
+        m_valid = true;
+        return;
+      }
+    } else if (!_is_pruned()) {
+      _first_value(m_depth);
+      ++m_depth;
+      continue;
+    }
+    if (!_next_sibling()) {
+      m_valid = false;
+      return;
+    }
+  }
+}
+
+}  // namespace config
+}  // namespace CASM
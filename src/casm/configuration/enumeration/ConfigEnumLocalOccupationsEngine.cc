@@ -0,0 +1,298 @@
+#include "casm/configuration/enumeration/ConfigEnumLocalOccupationsEngine.hh"
+
+#include <iterator>
+#include <stdexcept>
+
+#include "casm/configuration/clusterography/OrbitsAsIndices.hh"
+#include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
+#include "casm/configuration/enumeration/background_configuration.hh"
+#include "casm/configuration/enumeration/perturbations.hh"
+#include "casm/configuration/perf.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief Return the greater of the background with the initial or final
+///     event occupation applied
+Configuration _make_reference(Configuration const &background,
+                              std::vector<Index> const &event_sites,
+                              std::vector<int> const &occ_init,
+                              std::vector<int> const &occ_final) {
+  Configuration reference = copy_apply_occ(background, event_sites, occ_init);
+  Configuration config_final =
+      copy_apply_occ(background, event_sites, occ_final);
+  if (config_final > reference) {
+    return config_final;
+  }
+  return reference;
+}
+
+/// \brief Check that all event group operations are consistent with the
+///     background supercell
+std::vector<SupercellSymOp> const &_check_event_group(
+    Configuration const &background,
+    std::vector<SupercellSymOp> const &event_group) {
+  if (event_group.empty()) {
+    throw std::runtime_error(
+        "Error in ConfigEnumLocalOccupationsEngine: empty event_group");
+  }
+  for (SupercellSymOp const &op : event_group) {
+    if (op.supercell() != background.supercell) {
+      throw std::runtime_error(
+          "Error in ConfigEnumLocalOccupationsEngine: event_group and "
+          "background supercell mismatch");
+    }
+  }
+  return event_group;
+}
+
+/// \brief Get the occupation on sites
+std::vector<int> _get_occ(Configuration const &configuration,
+                          std::vector<Index> const &sites) {
+  std::vector<int> occ;
+  occ.reserve(sites.size());
+  for (Index l : sites) {
+    occ.push_back(configuration.dof_values.occupation(l));
+  }
+  return occ;
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param _background The background configuration
+/// \param _event_sites Linear sites indices of the cluster of sites that
+///     change during the event
+/// \param _occ_init Initial occupation on event_sites
+/// \param _occ_final Final occupation on event_sites
+/// \param _event_group The SupercellSymOp consistent with the supercell of
+///     the background configuration that leave the event invariant. Must
+///     not be empty.
+ConfigEnumLocalOccupationsEngine::ConfigEnumLocalOccupationsEngine(
+    Configuration const &_background, std::vector<Index> const &_event_sites,
+    std::vector<int> const &_occ_init, std::vector<int> const &_occ_final,
+    std::vector<SupercellSymOp> const &_event_group)
+    : m_background(_background),
+      m_event_sites(_event_sites),
+      m_occ_init(_occ_init),
+      m_occ_final(_occ_final),
+      m_reference(_make_reference(_background, _event_sites, _occ_init,
+                                  _occ_final)),
+      m_canonical_form_engine(_background.supercell,
+                              _check_event_group(_background, _event_group)),
+      m_indices_group_rep(make_local_cluster_sites_group_rep(
+          _background, _event_sites, _occ_init, _occ_final, _event_group)) {}
+
+/// \brief The background configuration
+Configuration const &ConfigEnumLocalOccupationsEngine::background() const {
+  return m_background;
+}
+
+/// \brief The reference configuration, which is perturbed
+///
+/// The reference configuration is the greater of the background with the
+/// initial or the final event occupation applied.
+Configuration const &ConfigEnumLocalOccupationsEngine::reference() const {
+  return m_reference;
+}
+
+/// \brief Count the perturbations generated and kept in `progress`
+///
+/// \param progress If not null, `make_distinct_local_perturbations` adds
+///     the number of occupations on each local-cluster to its estimated
+///     total, each perturbed configuration to its generated count, and each
+///     distinct canonical perturbation kept to its canonical and accepted
+///     counts.
+void ConfigEnumLocalOccupationsEngine::set_progress(
+    std::shared_ptr<EnumProgress> const &progress) {
+  m_progress = progress;
+}
+
+/// \brief Make the canonical form of a configuration in the context of the
+///     event
+///
+/// Equivalent to `make_canonical_form(configuration, event_sites, occ_init,
+/// occ_final, event_group)`.
+Configuration ConfigEnumLocalOccupationsEngine::make_canonical_form(
+    Configuration const &configuration) const {
+  return config::make_canonical_form(configuration, m_event_sites, m_occ_init,
+                                     m_occ_final, m_canonical_form_engine);
+}
+
+/// \brief Make the distinct clusters of sites from an orbit of
+///     local-clusters
+///
+/// \param local_orbit An orbit of local-clusters in the infinite crystal,
+///     positioned around the event
+///
+/// \returns The distinct local-clusters, as linear site indices in the
+///     background supercell, that are not equivalent under the operations
+///     that leave the background and event invariant.
+std::set<std::set<Index>>
+ConfigEnumLocalOccupationsEngine::make_distinct_local_cluster_sites(
+    std::set<clust::IntegralCluster> const &local_orbit) const {
+  std::vector<std::set<clust::IntegralCluster>> local_orbits({local_orbit});
+  return config::make_distinct_local_cluster_sites(
+      m_indices_group_rep,
+      clust::make_flat_orbits_as_indices(
+          local_orbits, m_background.supercell->unitcellcoord_index_converter));
+}
+
+/// \brief Make distinct perturbations on distinct local-cluster sites
+///
+/// \param distinct_local_cluster_sites Local-clusters, as linear site
+///     indices, on which all occupations are enumerated. If a local-cluster
+///     has no sites, the unperturbed reference configuration is the result.
+/// \param i_local_orbit Value to set for
+///     `LocalOccupationPerturbation::i_local_orbit`
+///
+/// \returns The perturbations with distinct canonical configurations, in
+///     the order generated.
+std::vector<LocalOccupationPerturbation>
+ConfigEnumLocalOccupationsEngine::make_distinct_local_perturbations(
+    std::set<std::set<Index>> const &distinct_local_cluster_sites,
+    Index i_local_orbit) const {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(make_distinct_perturbations);
+  std::set<Configuration> distinct;
+  std::vector<LocalOccupationPerturbation> results;
+
+  auto _add = [&](std::vector<Index> const &sites,
+                  Configuration const &configuration) {
+    auto result = distinct.emplace(make_canonical_form(configuration));
+    if (!result.second) {
+      return;
+    }
+    if (m_progress) {
+      m_progress->add_canonical();
+      m_progress->add_accepted();
+    }
+    results.push_back(LocalOccupationPerturbation{
+        i_local_orbit, sites, _get_occ(m_background, sites),
+        _get_occ(configuration, sites), configuration, *result.first});
+  };
+
+  for (auto const &local_cluster_sites : distinct_local_cluster_sites) {
+    std::vector<Index> sites(local_cluster_sites.begin(),
+                             local_cluster_sites.end());
+    if (sites.empty()) {
+      if (m_progress) {
+        m_progress->add_total(1.0);
+        m_progress->add_generated();
+      }
+      _add(sites, m_reference);
+      continue;
+    }
+    ConfigEnumAllOccupations enumerator(m_reference, local_cluster_sites);
+    enumerator.set_progress(m_progress);
+    while (enumerator.is_valid()) {
+      _add(sites, enumerator.value());
+      enumerator.advance();
+    }
+  }
+  return results;
+}
+
+/// \brief Make distinct perturbations on each local-cluster orbit
+///
+/// \param local_orbits Orbits of local-clusters in the infinite crystal,
+///     positioned around the event
+/// \param orbits If provided, only the orbits with these indices are
+///     perturbed
+///
+/// \returns For each selected orbit, in order, the results of
+///     `make_distinct_local_perturbations` on the distinct local-clusters of
+///     that orbit.
+std::vector<LocalOccupationPerturbation>
+ConfigEnumLocalOccupationsEngine::by_cluster(
+    std::vector<std::set<clust::IntegralCluster>> const &local_orbits,
+    std::optional<std::set<Index>> const &orbits) const {
+  std::vector<LocalOccupationPerturbation> results;
+  for (Index i = 0; i < local_orbits.size(); ++i) {
+    if (orbits.has_value() && !orbits->count(i)) {
+      continue;
+    }
+    std::vector<LocalOccupationPerturbation> orbit_results =
+        make_distinct_local_perturbations(
+            make_distinct_local_cluster_sites(local_orbits[i]), i);
+    std::move(orbit_results.begin(), orbit_results.end(),
+              std::back_inserter(results));
+  }
+  return results;
+}
+
+/// \brief Make distinct perturbations on a neighborhood of sites
+///
+/// \param local_orbits Orbits of local-clusters in the infinite crystal,
+///     positioned around the event
+/// \param neighborhood_from_orbits The indices of the orbits whose sites are
+///     combined into a single neighborhood of sites, on which all
+///     occupations are enumerated
+///
+/// \returns The results of `make_distinct_local_perturbations` on the
+///     neighborhood, with `i_local_orbit` set to -1.
+std::vector<LocalOccupationPerturbation>
+ConfigEnumLocalOccupationsEngine::by_neighborhood(
+    std::vector<std::set<clust::IntegralCluster>> const &local_orbits,
+    std::set<Index> const &neighborhood_from_orbits) const {
+  auto const &converter = m_background.supercell->unitcellcoord_index_converter;
+  std::set<Index> neighborhood_sites;
+  for (Index i = 0; i < local_orbits.size(); ++i) {
+    if (!neighborhood_from_orbits.count(i)) {
+      continue;
+    }
+    for (clust::IntegralCluster const &cluster : local_orbits[i]) {
+      for (xtal::UnitCellCoord const &site : cluster) {
+        neighborhood_sites.insert(converter(site));
+      }
+    }
+  }
+  return make_distinct_local_perturbations({neighborhood_sites}, -1);
+}
+
+/// \brief Return the operations that place an event in each distinct
+///     position with respect to a background configuration
+///
+/// \param supercell The supercell of the background configuration
+/// \param event_group The SupercellSymOp that leave the event invariant
+/// \param background_group The SupercellSymOp that leave the background
+///     configuration invariant
+///
+/// \returns The operations, `rep`, from the supercell symmetry group such
+///     that `rep` is the minimum element of the double coset
+///     `background_group * rep * event_group`, in the order of iteration
+///     from `SupercellSymOp::begin(supercell)`. Applying each to the event
+///     generates one event from each distinct suborbit.
+std::vector<SupercellSymOp> make_suborbit_generating_ops(
+    std::shared_ptr<Supercell const> const &supercell,
+    std::vector<SupercellSymOp> const &event_group,
+    std::vector<SupercellSymOp> const &background_group) {
+  std::vector<SupercellSymOp> ops;
+  auto end = SupercellSymOp::end(supercell);
+  for (auto it = SupercellSymOp::begin(supercell); it != end; ++it) {
+    SupercellSymOp const &rep = *it;
+    bool is_generator = true;
+    for (SupercellSymOp const &event_op : event_group) {
+      SupercellSymOp rep_event_op = rep * event_op;
+      for (SupercellSymOp const &background_op : background_group) {
+        if (background_op * rep_event_op < rep) {
+          is_generator = false;
+          break;
+        }
+      }
+      if (!is_generator) {
+        break;
+      }
+    }
+    if (is_generator) {
+      ops.push_back(rep);
+    }
+  }
+  return ops;
+}
+
+}  // namespace config
+}  // namespace CASM
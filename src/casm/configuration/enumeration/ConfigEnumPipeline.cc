@@ -0,0 +1,319 @@
+#include "casm/configuration/enumeration/ConfigEnumPipeline.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/io/binary/Configuration_binary_io.hh"
+#include "casm/configuration/parallel.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+typedef std::chrono::steady_clock Clock;
+
+double _seconds(Clock::time_point begin, Clock::time_point end) {
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+/// \brief Configurations passed between stages, numbered by the enumerate
+///     stage
+struct PipelineBatch {
+  Index index;
+  std::vector<Configuration> configurations;
+};
+
+/// \brief One CanonicalFormEngine per supercell, shared by all workers
+class CanonicalFormEngineCache {
+ public:
+  CanonicalFormEngine const &get(
+      std::shared_ptr<Supercell const> const &supercell) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_engines.find(supercell.get());
+    if (it == m_engines.end()) {
+      it = m_engines
+               .emplace(supercell.get(),
+                        std::make_pair(
+                            supercell,
+                            std::make_unique<CanonicalFormEngine>(supercell)))
+               .first;
+    }
+    return *it->second.second;
+  }
+
+ private:
+  std::mutex m_mutex;
+
+  /// Keep supercells alive, so that addresses are not reused
+  std::map<Supercell const *,
+           std::pair<std::shared_ptr<Supercell const>,
+                     std::unique_ptr<CanonicalFormEngine>>>
+      m_engines;
+};
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param _params Batch size, queue capacity, and numbers of workers
+/// \param _filter Canonical configurations for which `_filter` returns false
+///     are excluded. Must be safe to call concurrently from multiple threads,
+///     and must outlive the pipeline.
+/// \param _configurations If not null, distinct configurations are inserted
+///     here, with configuration ids assigned in enumeration order.
+///     Configurations already in the set are not inserted or written again.
+/// \param _writer If not null, each configuration newly inserted is written
+///     here, as a ConfigurationSet record if `_configurations` is not null,
+///     else as a Configuration record.
+ConfigEnumPipeline::ConfigEnumPipeline(ConfigEnumPipelineParams const &_params,
+                                       ConfigurationFilter const &_filter,
+                                       ConfigurationSet *_configurations,
+                                       ConfigurationBinaryWriter *_writer)
+    : m_params(_params),
+      m_filter(_filter),
+      m_configurations(_configurations),
+      m_writer(_writer) {}
+
+/// \brief Run the pipeline with a source that fills batches
+///
+/// \param fill_batch Called repeatedly on the calling thread with an empty
+///     vector, which it fills with up to `batch_size` configurations. Returns
+///     false when there are no more configurations.
+///
+/// \returns Metrics for each stage, in pipeline order.
+std::vector<PipelineStageMetrics> ConfigEnumPipeline::run(
+    std::function<bool(std::vector<Configuration> &)> fill_batch) {
+  Index const max_threads = std::numeric_limits<Index>::max();
+  Index n_canonical_form_workers =
+      resolve_n_threads(m_params.n_canonical_form_workers, max_threads);
+  Index n_filter_workers =
+      resolve_n_threads(m_params.n_filter_workers, max_threads);
+  Index batch_size = std::max(Index(1), m_params.batch_size);
+
+  BoundedQueue<PipelineBatch> to_canonicalize(m_params.queue_capacity);
+  BoundedQueue<PipelineBatch> to_filter(m_params.queue_capacity);
+  BoundedQueue<PipelineBatch> to_write(m_params.queue_capacity);
+
+  std::vector<PipelineStageMetrics> metrics(4);
+  metrics[0].name = "enumerate";
+  metrics[0].n_workers = 1;
+  metrics[1].name = "canonicalize";
+  metrics[1].n_workers = n_canonical_form_workers;
+  metrics[2].name = "filter";
+  metrics[2].n_workers = n_filter_workers;
+  metrics[3].name = "write";
+  metrics[3].n_workers = 1;
+  std::mutex metrics_mutex;
+
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto fail = [&]() {
+    {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+    to_canonicalize.close();
+    to_filter.close();
+    to_write.close();
+  };
+
+  Clock::time_point start = Clock::now();
+
+  // Pop batches from `in`, process them, and push them to `out`. The last
+  // worker of a stage to finish closes `out`.
+  auto run_worker = [&](BoundedQueue<PipelineBatch> &in,
+                        BoundedQueue<PipelineBatch> &out, Index &n_running,
+                        PipelineStageMetrics &stage_metrics, auto process) {
+    PipelineStageMetrics local;
+    try {
+      while (true) {
+        Clock::time_point t0 = Clock::now();
+        std::optional<PipelineBatch> batch = in.pop();
+        Clock::time_point t1 = Clock::now();
+        local.wait_seconds += _seconds(t0, t1);
+        if (!batch.has_value()) {
+          break;
+        }
+        local.n_in += batch->configurations.size();
+        process(batch->configurations);
+        local.n_out += batch->configurations.size();
+        Clock::time_point t2 = Clock::now();
+        local.busy_seconds += _seconds(t1, t2);
+        bool pushed = out.push(std::move(*batch));
+        local.wait_seconds += _seconds(t2, Clock::now());
+        if (!pushed) {
+          break;
+        }
+      }
+    } catch (...) {
+      fail();
+    }
+    std::lock_guard<std::mutex> lock(metrics_mutex);
+    stage_metrics.n_in += local.n_in;
+    stage_metrics.n_out += local.n_out;
+    stage_metrics.busy_seconds += local.busy_seconds;
+    stage_metrics.wait_seconds += local.wait_seconds;
+    if (--n_running == 0) {
+      out.close();
+      stage_metrics.wall_seconds = _seconds(start, Clock::now());
+    }
+  };
+
+  CanonicalFormEngineCache engines;
+  auto canonicalize = [&](std::vector<Configuration> &configurations) {
+    if (configurations.empty()) {
+      return;
+    }
+    std::shared_ptr<Supercell const> supercell = configurations[0].supercell;
+    bool same_supercell =
+        std::all_of(configurations.begin(), configurations.end(),
+                    [&](Configuration const &configuration) {
+                      return configuration.supercell == supercell;
+                    });
+    if (same_supercell) {
+      configurations =
+          engines.get(supercell).make_canonical_forms(configurations);
+      return;
+    }
+    for (Configuration &configuration : configurations) {
+      configuration = engines.get(configuration.supercell)
+                          .make_canonical_form(configuration);
+    }
+  };
+
+  auto filter = [&](std::vector<Configuration> &configurations) {
+    configurations.erase(
+        std::remove_if(configurations.begin(), configurations.end(),
+                       [&](Configuration const &configuration) {
+                         return !m_filter(configuration);
+                       }),
+        configurations.end());
+  };
+
+  std::vector<std::thread> threads;
+  Index n_canonical_form_running = n_canonical_form_workers;
+  for (Index i = 0; i < n_canonical_form_workers; ++i) {
+    threads.emplace_back([&]() {
+      run_worker(to_canonicalize, to_filter, n_canonical_form_running,
+                 metrics[1], canonicalize);
+    });
+  }
+  Index n_filter_running = n_filter_workers;
+  for (Index i = 0; i < n_filter_workers; ++i) {
+    threads.emplace_back([&]() {
+      run_worker(to_filter, to_write, n_filter_running, metrics[2], filter);
+    });
+  }
+
+  // write stage: handle batches in enumeration order
+  threads.emplace_back([&]() {
+    PipelineStageMetrics local;
+    try {
+      std::map<Index, std::vector<Configuration>> pending;
+      Index next_index = 0;
+      while (true) {
+        Clock::time_point t0 = Clock::now();
+        std::optional<PipelineBatch> batch = to_write.pop();
+        Clock::time_point t1 = Clock::now();
+        local.wait_seconds += _seconds(t0, t1);
+        if (!batch.has_value()) {
+          break;
+        }
+        local.n_in += batch->configurations.size();
+        pending.emplace(batch->index, std::move(batch->configurations));
+        while (!pending.empty() && pending.begin()->first == next_index) {
+          for (Configuration const &configuration : pending.begin()->second) {
+            if (m_configurations != nullptr) {
+              auto result = m_configurations->insert(configuration);
+              if (result.second) {
+                ++local.n_out;
+                if (m_writer != nullptr) {
+                  m_writer->write(*result.first);
+                }
+              }
+            } else if (m_distinct_configurations.insert(configuration)
+                           .second) {
+              ++local.n_out;
+              if (m_writer != nullptr) {
+                m_writer->write(configuration);
+              }
+            }
+          }
+          pending.erase(pending.begin());
+          ++next_index;
+        }
+        local.busy_seconds += _seconds(t1, Clock::now());
+      }
+    } catch (...) {
+      fail();
+    }
+    std::lock_guard<std::mutex> lock(metrics_mutex);
+    local.name = metrics[3].name;
+    local.n_workers = metrics[3].n_workers;
+    local.wall_seconds = _seconds(start, Clock::now());
+    metrics[3] = local;
+  });
+
+  // enumerate stage, on the calling thread
+  try {
+    Index index = 0;
+    bool has_more = true;
+    while (has_more) {
+      PipelineBatch batch{index, {}};
+      batch.configurations.reserve(batch_size);
+      Clock::time_point t0 = Clock::now();
+      has_more = fill_batch(batch.configurations);
+      Clock::time_point t1 = Clock::now();
+      metrics[0].busy_seconds += _seconds(t0, t1);
+      if (batch.configurations.empty()) {
+        continue;
+      }
+      Index n = batch.configurations.size();
+      bool pushed = to_canonicalize.push(std::move(batch));
+      metrics[0].wait_seconds += _seconds(t1, Clock::now());
+      if (!pushed) {
+        break;
+      }
+      metrics[0].n_in += n;
+      metrics[0].n_out += n;
+      ++index;
+    }
+  } catch (...) {
+    fail();
+  }
+  to_canonicalize.close();
+  {
+    std::lock_guard<std::mutex> lock(metrics_mutex);
+    metrics[0].wall_seconds = _seconds(start, Clock::now());
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return metrics;
+}
+
+/// \brief Distinct canonical configurations that passed the filter, if
+///     no ConfigurationSet was given
+std::set<Configuration> const &ConfigEnumPipeline::distinct_configurations()
+    const {
+  return m_distinct_configurations;
+}
+
+}  // namespace config
+}  // namespace CASM
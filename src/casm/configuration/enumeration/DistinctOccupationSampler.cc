@@ -0,0 +1,280 @@
+#include "casm/configuration/enumeration/DistinctOccupationSampler.hh"
+
+#include <stdexcept>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/crystallography/BasicStructure.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// \brief Uniformly random integer in `[0, n)`, for `n > 0`
+///
+/// Uses rejection of the low range of `random_engine()` so that the result
+/// is exactly uniform, and does not depend on the standard library's
+/// distribution implementations.
+Index _uniform_index(std::mt19937_64 &random_engine, Index n) {
+  std::uint64_t const n_u = n;
+  std::uint64_t const threshold = (std::uint64_t(0) - n_u) % n_u;
+  while (true) {
+    std::uint64_t const r = random_engine();
+    if (r >= threshold) {
+      return Index(r % n_u);
+    }
+  }
+}
+
+/// \brief Return true if `engine.ops()[op_index]` maps every occupation
+///     with the fixed occupant counts to another with the same counts
+///
+/// This holds if, for each destination site, occupant `k` on the source
+/// site's sublattice has the same fixed count as the occupant it becomes on
+/// the destination site's sublattice. Otherwise the operation maps every
+/// occupation with the fixed counts to one without.
+bool _preserves_counts(CanonicalFormEngine const &engine, Index op_index,
+                       std::vector<Index> const &sublattice,
+                       std::vector<int> const &n_occupants,
+                       std::vector<std::vector<Index>> const &occupant_counts) {
+  Index const *permutation = engine.permutation(op_index);
+  int const *const *occupant_remap = engine.occupant_remap(op_index);
+  for (Index l = 0; l < engine.n_sites(); ++l) {
+    Index const b_dst = sublattice[l];
+    Index const b_src = sublattice[permutation[l]];
+    for (int k = 0; k < n_occupants[b_src]; ++k) {
+      int const k_dst = occupant_remap ? occupant_remap[l][k] : k;
+      if (occupant_counts[b_dst][k_dst] != occupant_counts[b_src][k]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+/// \brief Constructor, using all operations that leave the supercell
+///     lattice invariant
+///
+/// \param supercell The supercell. Samples have the default value of any
+///     continuous DoF.
+/// \param occupant_counts If given, fixes the composition:
+///     `(*occupant_counts)[b][i]` is the number of sites on sublattice `b`
+///     with occupant index `i`. The counts for each sublattice must sum to
+///     the number of sites on that sublattice.
+DistinctOccupationSampler::DistinctOccupationSampler(
+    std::shared_ptr<Supercell const> const &supercell,
+    std::optional<std::vector<std::vector<Index>>> const &occupant_counts)
+    : DistinctOccupationSampler(
+          std::make_shared<CanonicalFormEngine const>(throw_if_equal_to_nullptr(
+              supercell,
+              "Error in DistinctOccupationSampler: supercell is empty")),
+          occupant_counts) {}
+
+/// \brief Constructor, using the operations of an existing engine
+///
+/// \param engine Determines which occupations are equivalent.
+///     `engine->ops()` must form a group, as do the default operations.
+/// \param occupant_counts If given, fixes the composition:
+///     `(*occupant_counts)[b][i]` is the number of sites on sublattice `b`
+///     with occupant index `i`. The counts for each sublattice must sum to
+///     the number of sites on that sublattice.
+DistinctOccupationSampler::DistinctOccupationSampler(
+    std::shared_ptr<CanonicalFormEngine const> const &engine,
+    std::optional<std::vector<std::vector<Index>>> const &occupant_counts)
+    : m_engine(throw_if_equal_to_nullptr(
+          engine, "Error in DistinctOccupationSampler: engine is empty")),
+      m_n_sites(m_engine->n_sites()),
+      m_fixed_counts(occupant_counts.has_value()) {
+  auto const &supercell = m_engine->supercell();
+  auto const &converter = supercell->unitcellcoord_index_converter;
+  auto const &basis = supercell->prim->basicstructure->basis();
+  for (auto const &site : basis) {
+    m_n_occupants.push_back(site.occupant_dof().size());
+  }
+  std::vector<Index> n_sites(basis.size(), 0);
+  for (Index l = 0; l < m_n_sites; ++l) {
+    Index b = converter(l).sublattice();
+    m_sublattice.push_back(b);
+    ++n_sites[b];
+  }
+
+  if (!m_fixed_counts) {
+    return;
+  }
+
+  m_occupant_counts = *occupant_counts;
+  if (m_occupant_counts.size() != basis.size()) {
+    throw std::runtime_error(
+        "Error in DistinctOccupationSampler: occupant_counts size does not "
+        "match the number of sublattices");
+  }
+  for (Index b = 0; b < basis.size(); ++b) {
+    auto const &counts = m_occupant_counts[b];
+    if (Index(counts.size()) != m_n_occupants[b]) {
+      throw std::runtime_error(
+          "Error in DistinctOccupationSampler: occupant_counts[b] size does "
+          "not match the number of occupants on sublattice b");
+    }
+    Index sum = 0;
+    for (Index count : counts) {
+      if (count < 0) {
+        throw std::runtime_error(
+            "Error in DistinctOccupationSampler: negative occupant count");
+      }
+      sum += count;
+    }
+    if (sum != n_sites[b]) {
+      throw std::runtime_error(
+          "Error in DistinctOccupationSampler: occupant_counts[b] does not "
+          "sum to the number of sites on sublattice b");
+    }
+  }
+
+  // keep only the operations that preserve the fixed composition
+  std::vector<SupercellSymOp> ops;
+  for (Index i = 0; i < m_engine->ops().size(); ++i) {
+    if (_preserves_counts(*m_engine, i, m_sublattice, m_n_occupants,
+                          m_occupant_counts)) {
+      ops.push_back(m_engine->ops()[i]);
+    }
+  }
+  if (ops.size() != m_engine->ops().size()) {
+    m_engine = std::make_shared<CanonicalFormEngine const>(supercell, ops);
+  }
+}
+
+/// \brief The supercell
+std::shared_ptr<Supercell const> const &DistinctOccupationSampler::supercell()
+    const {
+  return m_engine->supercell();
+}
+
+/// \brief Finds canonical forms, using only the operations that preserve
+///     the fixed composition, if any
+std::shared_ptr<CanonicalFormEngine const> const &
+DistinctOccupationSampler::engine() const {
+  return m_engine;
+}
+
+/// \brief Draw one distinct occupation
+///
+/// \param random_engine The random number generator
+/// \param n_proposals If not nullptr, set to the number of proposed
+///     occupations, including the accepted one
+///
+/// \returns The canonical form, with respect to `engine()->ops()`, of an
+///     occupation drawn uniformly over orbits.
+Configuration DistinctOccupationSampler::sample(
+    std::mt19937_64 &random_engine, Index *n_proposals) const {
+  Eigen::VectorXi occupation = Eigen::VectorXi::Zero(m_n_sites);
+  std::vector<char> is_drawn(m_n_sites, 0);
+  std::vector<Index> drawn;
+  drawn.reserve(m_n_sites);
+  std::vector<std::vector<Index>> remaining_counts = m_occupant_counts;
+  std::vector<Index> n_remaining;
+  for (auto const &counts : m_occupant_counts) {
+    Index sum = 0;
+    for (Index count : counts) {
+      sum += count;
+    }
+    n_remaining.push_back(sum);
+  }
+
+  // draw the occupant on site l, if not yet drawn
+  auto draw = [&](Index l) {
+    if (is_drawn[l]) {
+      return;
+    }
+    Index const b = m_sublattice[l];
+    if (!m_fixed_counts) {
+      occupation[l] = _uniform_index(random_engine, m_n_occupants[b]);
+    } else {
+      Index r = _uniform_index(random_engine, n_remaining[b]);
+      int k = 0;
+      while (r >= remaining_counts[b][k]) {
+        r -= remaining_counts[b][k];
+        ++k;
+      }
+      occupation[l] = k;
+      --remaining_counts[b][k];
+      --n_remaining[b];
+    }
+    is_drawn[l] = 1;
+    drawn.push_back(l);
+  };
+
+  Index const n_ops = m_engine->ops().size();
+  Index count = 0;
+  while (true) {
+    ++count;
+    Index const op_index = _uniform_index(random_engine, n_ops);
+    Index const *permutation = m_engine->permutation(op_index);
+    bool is_invariant = true;
+    for (Index l = 0; l < m_n_sites; ++l) {
+      draw(l);
+      draw(permutation[l]);
+      if (m_engine->occupation_value(occupation, op_index, l) !=
+          occupation[l]) {
+        is_invariant = false;
+        break;
+      }
+    }
+    if (is_invariant) {
+      break;
+    }
+
+    // reject, and return drawn occupants
+    for (Index l : drawn) {
+      if (m_fixed_counts) {
+        Index const b = m_sublattice[l];
+        ++remaining_counts[b][occupation[l]];
+        ++n_remaining[b];
+      }
+      is_drawn[l] = 0;
+    }
+    drawn.clear();
+  }
+  if (n_proposals) {
+    *n_proposals = count;
+  }
+
+  Configuration configuration(m_engine->supercell());
+  configuration.dof_values.occupation = occupation;
+  return m_engine->make_canonical_form(configuration);
+}
+
+/// \brief Draw many distinct occupations, in parallel
+///
+/// \param n_samples Number of samples
+/// \param seed Random seed. Sample `i` is drawn with a `std::mt19937_64`
+///     seeded by `std::seed_seq{seed_lo, seed_hi, i}`, so samples do not
+///     depend on `n_threads`, and drawing more samples with the same seed
+///     extends the same sequence.
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, all
+///     available hardware threads are used.
+///
+/// \returns Samples, which are independent and so may repeat.
+std::vector<Configuration> DistinctOccupationSampler::sample(
+    Index n_samples, std::uint64_t seed, Index n_threads) const {
+  if (n_samples < 0) {
+    throw std::runtime_error(
+        "Error in DistinctOccupationSampler::sample: n_samples < 0");
+  }
+  std::vector<Configuration> samples(n_samples,
+                                     Configuration(m_engine->supercell()));
+  parallel_for_items(n_samples, n_threads, [&](Index i) {
+    std::seed_seq seq{std::uint32_t(seed), std::uint32_t(seed >> 32),
+                      std::uint32_t(i)};
+    std::mt19937_64 random_engine(seq);
+    samples[i] = sample(random_engine);
+  });
+  return samples;
+}
+
+}  // namespace config
+}  // namespace CASM
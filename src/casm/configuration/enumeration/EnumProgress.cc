@@ -0,0 +1,101 @@
+#include "casm/configuration/enumeration/EnumProgress.hh"
+
+#include <stdexcept>
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param _callback If not empty, called with a status snapshot at most once
+///     per `_report_interval` seconds while counts are added, and by
+///     `report()`.
+/// \param _report_interval Minimum number of seconds between calls of
+///     `_callback` by `report_if_due`. Must be >= 0.
+EnumProgress::EnumProgress(CallbackType _callback, double _report_interval)
+    : m_callback(std::move(_callback)),
+      m_n_generated(0),
+      m_n_canonical(0),
+      m_n_accepted(0),
+      m_n_total(0.0) {
+  if (_report_interval < 0.0) {
+    throw std::runtime_error(
+        "Error in EnumProgress: report_interval must be >= 0");
+  }
+  m_report_interval = std::chrono::duration_cast<clock::duration>(
+      std::chrono::duration<double>(_report_interval));
+  clock::rep now = _now_ticks();
+  m_begin.store(now, std::memory_order_relaxed);
+  m_next_report.store(now + m_report_interval.count(),
+                      std::memory_order_relaxed);
+}
+
+/// \brief Add to the estimated total number of configurations
+///
+/// \param n Number of configurations an enumerator will generate, such as
+///     the number of values of its occupation counter.
+void EnumProgress::add_total(double n) {
+  double value = m_n_total.load(std::memory_order_relaxed);
+  while (!m_n_total.compare_exchange_weak(value, value + n,
+                                          std::memory_order_relaxed)) {
+  }
+}
+
+/// \brief Return a snapshot of the current progress
+EnumProgressStatus EnumProgress::status() const {
+  EnumProgressStatus status;
+  status.n_generated = m_n_generated.load(std::memory_order_relaxed);
+  status.n_canonical = m_n_canonical.load(std::memory_order_relaxed);
+  status.n_accepted = m_n_accepted.load(std::memory_order_relaxed);
+  status.n_total = m_n_total.load(std::memory_order_relaxed);
+  clock::duration elapsed(_now_ticks() -
+                          m_begin.load(std::memory_order_relaxed));
+  status.elapsed_seconds = std::chrono::duration<double>(elapsed).count();
+  if (status.elapsed_seconds > 0.0) {
+    status.rate = status.n_generated / status.elapsed_seconds;
+  }
+  if (status.n_total > 0.0) {
+    status.fraction_complete = status.n_generated / status.n_total;
+    if (status.rate > 0.0) {
+      double remaining = status.n_total - status.n_generated;
+      status.estimated_remaining_seconds =
+          (remaining > 0.0 ? remaining : 0.0) / status.rate;
+    }
+  }
+  return status;
+}
+
+/// \brief Set all counts to zero and restart the clock
+///
+/// Should not be called while an enumeration is adding counts.
+void EnumProgress::reset() {
+  m_n_generated.store(0, std::memory_order_relaxed);
+  m_n_canonical.store(0, std::memory_order_relaxed);
+  m_n_accepted.store(0, std::memory_order_relaxed);
+  m_n_total.store(0.0, std::memory_order_relaxed);
+  clock::rep now = _now_ticks();
+  m_begin.store(now, std::memory_order_relaxed);
+  m_next_report.store(now + m_report_interval.count(),
+                      std::memory_order_relaxed);
+}
+
+void EnumProgress::_report(bool force) {
+  if (!m_callback) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(m_report_mutex, std::defer_lock);
+  if (force) {
+    lock.lock();
+  } else if (!lock.try_lock()) {
+    return;
+  } else if (_now_ticks() < m_next_report.load(std::memory_order_relaxed)) {
+    // another thread reported while this one was checking
+    return;
+  }
+  m_callback(status());
+  m_next_report.store(_now_ticks() + m_report_interval.count(),
+                      std::memory_order_relaxed);
+}
+
+}  // namespace config
+}  // namespace CASM
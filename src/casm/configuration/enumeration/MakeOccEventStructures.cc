@@ -158,5 +158,64 @@ xtal::SimpleStructure MakeOccEventStructures::operator()(
   return structure;
 }
 
+/// \brief Deformed lattice vectors, as columns
+///
+/// This is the lattice of the structures constructed by `operator()`.
+Eigen::Matrix3d MakeOccEventStructures::lat_column_mat() const {
+  return m_F * m_ideal_lat_column_mat;
+}
+
+/// \brief Atom names, in the order of coordinates columns
+std::vector<std::string> const &MakeOccEventStructures::atom_names() const {
+  return m_atom_names;
+}
+
+/// \brief Construct Cartesian coordinates of the interpolated structures,
+///     as one array
+///
+/// \param interpolation_factors Interpolation factors, as for `operator()`,
+///     one per image
+///
+/// \return coords A `3 x (n_atoms * n_images)` matrix, where columns
+///     `[k * n_atoms, (k+1) * n_atoms)` are the Cartesian coordinates of the
+///     atoms in image `k`, as in `operator()(interpolation_factors[k])`,
+///     and `n_atoms == atom_names().size()`.
+///
+/// Method:
+/// - The deformed initial coordinates of all atoms are computed once and
+///   copied as a block into each image.
+/// - Only the columns of atoms involved in the event are then written per
+///   image.
+Eigen::MatrixXd MakeOccEventStructures::make_coords_batch(
+    std::vector<double> const &interpolation_factors) const {
+  Index n_atoms = m_atom_names.size();
+  Index n_images = interpolation_factors.size();
+
+  Eigen::MatrixXd background(3, n_atoms);
+  std::vector<Index> event_atoms;
+  for (Index i = 0; i < n_atoms; ++i) {
+    background.col(i) = m_F * m_coords_init[i];
+    if (!m_event_disp[i].isZero(0.0)) {
+      event_atoms.push_back(i);
+    }
+  }
+  std::vector<Eigen::Vector3d> event_disp;
+  for (Index i : event_atoms) {
+    event_disp.push_back(m_F * m_event_disp[i]);
+  }
+
+  Eigen::MatrixXd coords(3, n_atoms * n_images);
+  for (Index k = 0; k < n_images; ++k) {
+    Index offset = k * n_atoms;
+    coords.middleCols(offset, n_atoms) = background;
+    double f = interpolation_factors[k];
+    for (Index j = 0; j < event_atoms.size(); ++j) {
+      Index i = event_atoms[j];
+      coords.col(offset + i) = background.col(i) + f * event_disp[j];
+    }
+  }
+  return coords;
+}
+
 }  // namespace config
 }  // namespace CASM
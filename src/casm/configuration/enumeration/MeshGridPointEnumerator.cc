@@ -0,0 +1,271 @@
+#include "casm/configuration/enumeration/MeshGridPointEnumerator.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "casm/configuration/irreps/IrrepWedge.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Constructor
+///
+/// \param rep Matrices, `M`, that transform points according to
+///     `x_after = M * x_before`, as from `make_dof_space_rep`. Must not be
+///     empty, and all must be square with the same size.
+/// \param abs_tol Absolute tolerance for comparing coordinates
+CanonicalPointSet::CanonicalPointSet(std::vector<Eigen::MatrixXd> const &rep,
+                                     double abs_tol)
+    : m_dim(rep.empty() ? 0 : rep[0].rows()),
+      m_compare{abs_tol},
+      m_canonical(m_compare) {
+  if (rep.empty()) {
+    throw std::runtime_error("Error in CanonicalPointSet: rep is empty");
+  }
+  m_stacked_rep.resize(rep.size() * m_dim, m_dim);
+  for (Index i = 0; i < rep.size(); ++i) {
+    if (rep[i].rows() != m_dim || rep[i].cols() != m_dim) {
+      throw std::runtime_error(
+          "Error in CanonicalPointSet: rep matrices have inconsistent size");
+    }
+    m_stacked_rep.block(i * m_dim, 0, m_dim, m_dim) = rep[i];
+  }
+}
+
+/// \brief Point dimension
+Index CanonicalPointSet::dim() const { return m_dim; }
+
+/// \brief Return the canonical form of a point
+///
+/// Same as `make_canonical_order_parameters`: the first of `x`, `M[0] * x`,
+/// `M[1] * x`, ... that is not less than any of the others.
+Eigen::VectorXd CanonicalPointSet::make_canonical(
+    Eigen::VectorXd const &x) const {
+  if (x.size() != m_dim) {
+    throw std::runtime_error(
+        "Error in CanonicalPointSet::make_canonical: point size != dim");
+  }
+  Eigen::VectorXd images = m_stacked_rep * x;
+  Eigen::VectorXd canonical = x;
+  Index n_op = m_stacked_rep.rows() / std::max(m_dim, Index(1));
+  for (Index i = 0; i < n_op; ++i) {
+    auto image = images.segment(i * m_dim, m_dim);
+    if (m_compare(canonical, image)) {
+      canonical = image;
+    }
+  }
+  return canonical;
+}
+
+/// \brief Insert the canonical form of a point, and return true if no
+///     equivalent point was already present
+bool CanonicalPointSet::insert(Eigen::VectorXd const &x) {
+  return m_canonical.insert(make_canonical(x)).second;
+}
+
+/// \brief Number of distinct points inserted
+Index CanonicalPointSet::size() const { return m_canonical.size(); }
+
+/// \brief Lexicographic less than, with coordinates that differ by no more
+///     than tol treated as equal
+bool CanonicalPointSet::Compare::operator()(Eigen::VectorXd const &A,
+                                            Eigen::VectorXd const &B) const {
+  for (Index i = 0; i < A.size(); ++i) {
+    if (std::abs(A(i) - B(i)) > tol) {
+      return A(i) < B(i);
+    }
+  }
+  return false;
+}
+
+/// \brief Constructor, for a meshgrid
+///
+/// \param xi Coordinates of the grid along each axis, as by `numpy.meshgrid`.
+///     Must not be empty.
+/// \param dof_space_rep If has_value, skip points equivalent to a previous
+///     point under the representation
+/// \param abs_tol Absolute tolerance for checking equivalence
+MeshGridPointEnumerator::MeshGridPointEnumerator(
+    std::vector<Eigen::VectorXd> const &xi,
+    std::optional<std::vector<Eigen::MatrixXd>> const &dof_space_rep,
+    double abs_tol)
+    : m_dim(xi.size()), m_tol(abs_tol) {
+  m_grids.push_back(Grid{xi, std::nullopt});
+  _init(dof_space_rep);
+}
+
+/// \brief Constructor, for an irreducible wedge
+///
+/// \param irreducible_wedge The irreducible wedge. One grid is enumerated
+///     per SubWedge, with coordinates along the SubWedge axes.
+/// \param basis_inv Points are `basis_inv * subwedge.trans_mat * x`, for
+///     grid points `x`, as by `dof_space.basis_inv`.
+/// \param stop The end value along each SubWedge axis
+/// \param num The number of values along each SubWedge axis, from 0.0 to
+///     `stop`. For axes with symmetric multiplicity 1, `2 * num - 1` values
+///     from `-stop` to `stop` are used.
+/// \param trim_corners If true, skip grid points outside the sphere of
+///     radius `stop`
+/// \param dof_space_rep If has_value, skip points equivalent to a previous
+///     point under the representation
+/// \param abs_tol Absolute tolerance for checking trimming and equivalence
+MeshGridPointEnumerator::MeshGridPointEnumerator(
+    std::vector<irreps::SubWedge> const &irreducible_wedge,
+    Eigen::MatrixXd const &basis_inv, double stop, Index num,
+    bool trim_corners,
+    std::optional<std::vector<Eigen::MatrixXd>> const &dof_space_rep,
+    double abs_tol)
+    : m_dim(basis_inv.rows()), m_tol(abs_tol) {
+  if (trim_corners) {
+    m_trim_stop = stop;
+  }
+  for (irreps::SubWedge const &subwedge : irreducible_wedge) {
+    if (subwedge.trans_mat.rows() != basis_inv.cols()) {
+      throw std::runtime_error(
+          "Error in MeshGridPointEnumerator: SubWedge size does not match "
+          "basis_inv");
+    }
+    Grid grid;
+    for (irreps::IrrepWedge const &irrep_wedge : subwedge.irrep_wedges) {
+      for (Index m : irrep_wedge.mult) {
+        if (m == 1) {
+          grid.xi.push_back(make_linspace(-stop, stop, 2 * num - 1));
+        } else {
+          grid.xi.push_back(make_linspace(0.0, stop, num));
+        }
+      }
+    }
+    if (grid.xi.size() != subwedge.trans_mat.cols()) {
+      throw std::runtime_error(
+          "Error in MeshGridPointEnumerator: SubWedge axes do not match "
+          "trans_mat");
+    }
+    grid.trans_mat = basis_inv * subwedge.trans_mat;
+    m_grids.push_back(std::move(grid));
+  }
+  _init(dof_space_rep);
+}
+
+/// \brief Dimension of the points
+Index MeshGridPointEnumerator::dim() const { return m_dim; }
+
+/// \brief The current point
+Eigen::VectorXd const &MeshGridPointEnumerator::value() const {
+  return m_value;
+}
+
+/// \brief Index of the grid of the current point, i.e. the SubWedge index
+Index MeshGridPointEnumerator::grid_index() const { return m_grid_index; }
+
+/// \brief Generate the next point
+void MeshGridPointEnumerator::advance() {
+  if (!m_is_valid) {
+    return;
+  }
+  if (!_increment()) {
+    m_is_valid = false;
+    return;
+  }
+  _skip();
+}
+
+/// \brief Return true if `value` is valid, false if no more valid values
+bool MeshGridPointEnumerator::is_valid() const { return m_is_valid; }
+
+void MeshGridPointEnumerator::_init(
+    std::optional<std::vector<Eigen::MatrixXd>> const &dof_space_rep) {
+  for (Grid const &grid : m_grids) {
+    if (grid.xi.empty()) {
+      throw std::runtime_error(
+          "Error in MeshGridPointEnumerator: grid dimension is 0");
+    }
+  }
+  if (dof_space_rep.has_value()) {
+    m_canonical.emplace(*dof_space_rep, m_tol);
+    if (m_canonical->dim() != m_dim) {
+      throw std::runtime_error(
+          "Error in MeshGridPointEnumerator: dof_space_rep size does not "
+          "match point dimension");
+    }
+  }
+  m_grid_index = 0;
+  m_is_valid = !m_grids.empty();
+  if (!m_is_valid) {
+    return;
+  }
+  m_counter.assign(m_grids[0].xi.size(), 0);
+  _skip();
+}
+
+bool MeshGridPointEnumerator::_set_value() {
+  Grid const &grid = m_grids[m_grid_index];
+  m_x.resize(grid.xi.size());
+  for (Index i = 0; i < m_x.size(); ++i) {
+    if (m_counter[i] >= grid.xi[i].size()) {
+      // an axis with no values
+      return false;
+    }
+    m_x(i) = grid.xi[i](m_counter[i]);
+  }
+  if (m_trim_stop.has_value() &&
+      m_x.squaredNorm() / (*m_trim_stop * *m_trim_stop) > 1.0 + m_tol) {
+    return false;
+  }
+  if (grid.trans_mat.has_value()) {
+    m_value = *grid.trans_mat * m_x;
+  } else {
+    m_value = m_x;
+  }
+  if (m_canonical.has_value() && !m_canonical->insert(m_value)) {
+    return false;
+  }
+  return true;
+}
+
+bool MeshGridPointEnumerator::_increment() {
+  Grid const &grid = m_grids[m_grid_index];
+  for (Index i = 0; i < m_counter.size(); ++i) {
+    if (m_counter[i] + 1 < grid.xi[i].size()) {
+      ++m_counter[i];
+      return true;
+    }
+    m_counter[i] = 0;
+  }
+  ++m_grid_index;
+  if (m_grid_index == m_grids.size()) {
+    return false;
+  }
+  m_counter.assign(m_grids[m_grid_index].xi.size(), 0);
+  return true;
+}
+
+void MeshGridPointEnumerator::_skip() {
+  while (!_set_value()) {
+    if (!_increment()) {
+      m_is_valid = false;
+      return;
+    }
+  }
+}
+
+/// \brief Return `num` evenly spaced values from `start` to `stop`,
+///     inclusive, as by `numpy.linspace`
+Eigen::VectorXd make_linspace(double start, double stop, Index num) {
+  if (num <= 0) {
+    return Eigen::VectorXd();
+  }
+  Eigen::VectorXd result(num);
+  if (num == 1) {
+    result(0) = start;
+    return result;
+  }
+  double step = (stop - start) / (num - 1);
+  for (Index i = 0; i < num; ++i) {
+    result(i) = start + i * step;
+  }
+  result(num - 1) = stop;
+  return result;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -1,7 +1,11 @@
 
 #include "casm/configuration/enumeration/OccEventInfo.hh"
 
+#include <limits>
+
 #include "casm/configuration/Configuration.hh"
+#include "casm/configuration/LocalSupercellSymGroupCache.hh"
+#include "casm/configuration/PerturbationCanonicalizer.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/clusterography/ClusterSpecs.hh"
 #include "casm/configuration/clusterography/orbits.hh"
@@ -10,6 +14,7 @@
 #include "casm/configuration/enumeration/perturbations.hh"
 #include "casm/configuration/group/orbits.hh"
 #include "casm/configuration/occ_events/orbits.hh"
+#include "casm/configuration/parallel.hh"
 #include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
 
 // debug:
@@ -20,6 +25,60 @@
 namespace CASM {
 namespace config {
 
+namespace {  // anonymous
+
+/// \brief The index of a background configuration and the sites on which
+///     to enumerate all occupations in it
+typedef std::pair<Index, std::set<Index> const *> LocalPerturbationWork;
+
+/// \brief Enumerate all occupations for each work item, put them in
+///     canonical form with respect to the event, and merge them
+///
+/// One LocalPerturbationCanonicalizer is made per background, so each
+/// perturbation is canonicalized by comparing only the images of the
+/// perturbed sites within each coset of the background invariant subgroup.
+/// Work items are taken in turn by up to `n_threads` threads, which each
+/// collect results in their own set, and the sets are merged at the end, so
+/// the result does not depend on the number of threads.
+std::set<Configuration> _make_distinct_local_perturbations(
+    OccEventSupercellInfo const &info,
+    std::vector<Configuration> const &backgrounds,
+    std::vector<LocalPerturbationWork> const &work, Index n_threads) {
+  std::vector<std::unique_ptr<LocalPerturbationCanonicalizer>> canonicalizers(
+      backgrounds.size());
+  parallel_for_chunks(
+      backgrounds.size(), n_threads, [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          canonicalizers[i] = std::make_unique<LocalPerturbationCanonicalizer>(
+              info.canonical_form_engine, backgrounds[i], info.sites,
+              info.occ_init, info.occ_final);
+        }
+      });
+
+  std::vector<std::set<Configuration>> thread_results(
+      resolve_n_threads(n_threads, work.size()));
+  parallel_for_items(work.size(), n_threads, [&](Index t, Index i) {
+    Index background_index = work[i].first;
+    std::set<Index> const &perturbed_sites = *work[i].second;
+    LocalPerturbationCanonicalizer const &canonicalizer =
+        *canonicalizers[background_index];
+    ConfigEnumAllOccupations enumerator(backgrounds[background_index],
+                                        perturbed_sites);
+    while (enumerator.is_valid()) {
+      thread_results[t].emplace(canonicalizer.make_canonical_form(
+          enumerator.value(), perturbed_sites));
+      enumerator.advance();
+    }
+  });
+  std::set<Configuration> all;
+  for (auto &result : thread_results) {
+    all.merge(result);
+  }
+  return all;
+}
+
+}  // namespace
+
 OccEventPrimInfo::OccEventPrimInfo(std::shared_ptr<Prim const> const &_prim,
                                    occ_events::OccEvent const &_event)
     : prim(_prim),
@@ -40,10 +99,12 @@ OccEventPrimInfo::make_local_orbits(
     std::set<clust::IntegralCluster> const &local_clusters) const {
   std::set<clust::IntegralCluster> canonical_elements;
   auto const &rep = invariant_group_unitcellcoord_rep;
+  clust::IntegralCluster best;
+  clust::IntegralCluster scratch;
   for (auto const &cluster : local_clusters) {
     canonical_elements.insert(group::make_canonical_element(
         cluster, rep.begin(), rep.end(), std::less<clust::IntegralCluster>(),
-        clust::local_integral_cluster_copy_apply));
+        clust::local_integral_cluster_apply, best, scratch));
   }
   std::vector<std::set<clust::IntegralCluster>> local_orbits;
   for (auto const &cluster : canonical_elements) {
@@ -57,8 +118,12 @@ OccEventSupercellInfo::OccEventSupercellInfo(
     std::shared_ptr<Supercell const> const &_supercell)
     : event_prim_info(_event_prim_info),
       supercell(_supercell),
-      supercellsymop_symgroup_rep(make_local_supercell_symgroup_rep(
-          event_prim_info->invariant_group, supercell)) {
+      supercellsymop_symgroup_rep(
+          local_supercell_symgroup_cache()
+              .get(event_prim_info->invariant_group, supercell)
+              ->supercell_symgroup_rep),
+      canonical_form_engine(std::make_shared<CanonicalFormEngine const>(
+          supercell, supercellsymop_symgroup_rep)) {
   auto cluster_occupation = make_cluster_occupation(event_prim_info->event);
   sites = to_index_vector(cluster_occupation.first,
                           supercell->unitcellcoord_index_converter);
@@ -69,8 +134,8 @@ OccEventSupercellInfo::OccEventSupercellInfo(
 /// \brief Make canonical local environment configuration
 Configuration OccEventSupercellInfo::make_canonical_form(
     Configuration const &configuration) const {
-  return CASM::config::make_canonical_form(
-      configuration, sites, occ_init, occ_final, supercellsymop_symgroup_rep);
+  return CASM::config::make_canonical_form(configuration, sites, occ_init,
+                                           occ_final, *canonical_form_engine);
 }
 
 /// \brief Make all configurations, equivalent as infinite crystals under prim
@@ -80,8 +145,7 @@ std::set<Configuration>
 OccEventSupercellInfo::make_distinct_background_configurations(
     Configuration const &motif) const {
   return CASM::config::make_distinct_background_configurations(
-      motif, supercell, sites, occ_init, occ_final,
-      supercellsymop_symgroup_rep);
+      motif, sites, occ_init, occ_final, *canonical_form_engine);
 }
 
 /// \brief Make configurations that are distinct perturbations of local clusters
@@ -100,7 +164,7 @@ OccEventSupercellInfo::make_distinct_local_perturbations(
         "Error in OccEventSupercellInfo::make_distinct_local_perturbations: "
         "background supercell does not match this supercell");
   }
-  auto local_orbits_as_indices = make_orbits_as_indices(
+  auto local_orbits_as_indices = clust::make_flat_orbits_as_indices(
       local_orbits, supercell->unitcellcoord_index_converter);
   auto distinct_local_cluster_sites = make_distinct_local_cluster_sites(
       background, sites, occ_init, occ_final, supercellsymop_symgroup_rep,
@@ -139,21 +203,42 @@ OccEventSupercellInfo::make_distinct_local_perturbations(
 ///     of the background configuration. These orbits are broken based on the
 ///     background configuration symmetry to find all the distinct local
 ///     environment perturbations.
+/// \param n_threads Number of threads used to find the distinct local clusters
+///     in each background, and then to enumerate occupations on each distinct
+///     local cluster in each background. If `n_threads <= 0`, use the number of
+///     threads set by `set_num_threads`. The result does not depend on the
+///     number of threads.
 std::set<Configuration>
 OccEventSupercellInfo::make_all_distinct_local_perturbations(
     Configuration const &motif,
-    std::vector<std::set<clust::IntegralCluster>> const &local_orbits) const {
+    std::vector<std::set<clust::IntegralCluster>> const &local_orbits,
+    Index n_threads) const {
   auto distinct_backgrounds =
       this->make_distinct_background_configurations(motif);
-  std::set<Configuration> all;
-  for (auto const &background : distinct_backgrounds) {
-    auto tmp =
-        this->make_distinct_local_perturbations(background, local_orbits);
-    for (auto const &c : tmp) {
-      all.insert(c);
+  std::vector<Configuration> backgrounds(distinct_backgrounds.begin(),
+                                         distinct_backgrounds.end());
+  auto local_orbits_as_indices = clust::make_flat_orbits_as_indices(
+      local_orbits, supercell->unitcellcoord_index_converter);
+
+  std::vector<std::set<std::set<Index>>> distinct_local_cluster_sites(
+      backgrounds.size());
+  parallel_for_chunks(
+      backgrounds.size(), n_threads, [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          distinct_local_cluster_sites[i] = make_distinct_local_cluster_sites(
+              backgrounds[i], sites, occ_init, occ_final,
+              supercellsymop_symgroup_rep, local_orbits_as_indices);
+        }
+      });
+
+  std::vector<LocalPerturbationWork> work;
+  for (Index i = 0; i < backgrounds.size(); ++i) {
+    for (auto const &local_cluster_sites : distinct_local_cluster_sites[i]) {
+      work.emplace_back(i, &local_cluster_sites);
     }
   }
-  return all;
+  return _make_distinct_local_perturbations(*this, backgrounds, work,
+                                            n_threads);
 }
 
 /// \brief Generate local-cluster orbits and make configurations that are
@@ -165,20 +250,30 @@ OccEventSupercellInfo::make_all_distinct_local_perturbations(
 ///     without consideration of the background configuration. These orbits
 ///     are broken based on the background configuration symmetry to find
 ///     all the distinct local environment perturbations.
+/// \param n_threads Number of threads (see the overload taking
+///     `local_orbits`)
 std::set<Configuration>
 OccEventSupercellInfo::make_all_distinct_local_perturbations(
     Configuration const &motif,
-    std::set<clust::IntegralCluster> const &local_clusters) const {
+    std::set<clust::IntegralCluster> const &local_clusters,
+    Index n_threads) const {
   return this->make_all_distinct_local_perturbations(
-      motif, event_prim_info->make_local_orbits(local_clusters));
+      motif, event_prim_info->make_local_orbits(local_clusters), n_threads);
 }
 
 /// \brief Generate local-cluster orbits and make configurations that are
 ///     distinct perturbations of sites within a cutoff radius of sites
 ///     in the event
+///
+/// \param motif Used to generate distinct background configuration
+/// \param cutoff_radius Sites within this distance of event sites are
+///     perturbed
+/// \param n_threads Number of threads used to enumerate occupations in each
+///     background. If `n_threads <= 0`, use the number of threads set by
+///     `set_num_threads`. The result does not depend on the number of threads.
 std::set<Configuration>
 OccEventSupercellInfo::make_all_distinct_local_perturbations(
-    Configuration const &motif, double cutoff_radius) const {
+    Configuration const &motif, double cutoff_radius, Index n_threads) const {
   // get sites using cutoff_radius_neighborhood
   clust::CandidateSitesFunction f = clust::cutoff_radius_neighborhood(
       make_cluster(event_prim_info->event), cutoff_radius);
@@ -195,17 +290,244 @@ OccEventSupercellInfo::make_all_distinct_local_perturbations(
       this->make_distinct_background_configurations(motif);
 
   // for each background, enumerate local occupations
-  std::set<Configuration> distinct_local_perturbations;
-  for (auto const &background : distinct_backgrounds) {
-    ConfigEnumAllOccupations enumerator(background, site_indices);
-    while (enumerator.is_valid()) {
-      distinct_local_perturbations.emplace(
-          config::make_canonical_form(enumerator.value(), this->sites, occ_init,
-                                      occ_final, supercellsymop_symgroup_rep));
-      enumerator.advance();
+  std::vector<Configuration> backgrounds(distinct_backgrounds.begin(),
+                                         distinct_backgrounds.end());
+  std::vector<LocalPerturbationWork> work;
+  for (Index i = 0; i < backgrounds.size(); ++i) {
+    work.emplace_back(i, &site_indices);
+  }
+  return _make_distinct_local_perturbations(*this, backgrounds, work,
+                                            n_threads);
+}
+
+/// \brief Make linear supercell site indices and occupation for every
+///     translation of every equivalent event in an orbit
+///
+/// This is the bulk form of constructing OccEventSupercellInfo `sites`,
+/// `occ_init`, and `occ_final`, for each of `phenomenal_occevent` and each
+/// of their translations within `supercell`, such as for setting up a
+/// kinetic Monte Carlo event list.
+///
+/// \param phenomenal_occevent The equivalent events of an orbit. Each must
+///     have the same number of sites.
+/// \param supercell The supercell in which events are translated
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, all
+///     available hardware threads are used. The result does not depend on
+///     `n_threads`.
+///
+/// \returns The site index and occupation tables, see
+///     OccEventSiteIndexTable
+OccEventSiteIndexTable make_occevent_site_index_table(
+    std::vector<occ_events::OccEvent> const &phenomenal_occevent,
+    Supercell const &supercell, Index n_threads) {
+  auto const &unitcell_converter = supercell.unitcell_index_converter;
+  auto const &site_converter = supercell.unitcellcoord_index_converter;
+  if (site_converter.total_sites() > std::numeric_limits<std::int32_t>::max()) {
+    throw std::runtime_error(
+        "Error in make_occevent_site_index_table: too many supercell sites "
+        "for int32 site indices");
+  }
+
+  OccEventSiteIndexTable table;
+  table.n_equivalents = phenomenal_occevent.size();
+  table.n_translations = unitcell_converter.total_sites();
+
+  std::vector<std::vector<xtal::UnitCellCoord>> clusters;
+  for (auto const &event : phenomenal_occevent) {
+    auto cluster_occupation = make_cluster_occupation(event);
+    if (clusters.empty()) {
+      table.n_sites = cluster_occupation.first.size();
+    } else if (cluster_occupation.first.size() != table.n_sites) {
+      throw std::runtime_error(
+          "Error in make_occevent_site_index_table: equivalent events have "
+          "different numbers of sites");
+    }
+    clusters.push_back(cluster_occupation.first.elements());
+    for (Index s = 0; s < table.n_sites; ++s) {
+      table.occ_init.push_back(cluster_occupation.second[0][s]);
+      table.occ_final.push_back(cluster_occupation.second[1][s]);
     }
   }
-  return distinct_local_perturbations;
+
+  Index n_sites = table.n_sites;
+  Index n_translations = table.n_translations;
+  table.sites.resize(table.n_equivalents * n_translations * n_sites);
+  parallel_for_chunks(
+      table.n_equivalents * n_translations, n_threads,
+      [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          auto const &cluster = clusters[i / n_translations];
+          xtal::UnitCell translation = unitcell_converter(i % n_translations);
+          std::int32_t *row = table.sites.data() + i * n_sites;
+          for (Index s = 0; s < n_sites; ++s) {
+            row[s] = site_converter(cluster[s] + translation);
+          }
+        }
+      });
+  return table;
+}
+
+/// \brief Constructor
+///
+/// \param _max_entries Maximum number of OccEventSupercellInfo stored
+OccEventSupercellInfoCache::OccEventSupercellInfoCache(Index _max_entries)
+    : m_max_entries(_max_entries), m_n_hits(0), m_n_misses(0) {
+  if (m_max_entries < 0) {
+    throw std::runtime_error(
+        "Error in OccEventSupercellInfoCache: max_entries < 0");
+  }
+}
+
+/// \brief Get OccEventPrimInfo, constructing it if not cached
+///
+/// \param prim The prim
+/// \param event The event
+std::shared_ptr<OccEventPrimInfo const> OccEventSupercellInfoCache::prim_info(
+    std::shared_ptr<Prim const> const &prim,
+    occ_events::OccEvent const &event) {
+  throw_if_equal_to_nullptr(
+      prim, "Error in OccEventSupercellInfoCache::prim_info: prim is empty");
+  prim_key_type key(prim.get(), event);
+  std::promise<std::shared_ptr<OccEventPrimInfo const>> promise;
+  std::shared_future<std::shared_ptr<OccEventPrimInfo const>> future;
+  bool is_owner = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_prim_entries.find(key);
+    if (it != m_prim_entries.end()) {
+      future = it->second;
+    } else {
+      future = promise.get_future().share();
+      m_prim_entries.emplace(key, future);
+      is_owner = true;
+    }
+  }
+  if (!is_owner) {
+    // constructed, or being constructed, by another call
+    return future.get();
+  }
+
+  try {
+    promise.set_value(std::make_shared<OccEventPrimInfo const>(prim, event));
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_prim_entries.erase(key);
+  }
+  return future.get();
+}
+
+/// \brief Get OccEventSupercellInfo, constructing it if not cached
+///
+/// \param supercell The supercell
+/// \param event The event, with coordinates relative to the supercell
+///     origin
+///
+/// \returns OccEventSupercellInfo for the event in the supercell. The
+///     OccEventPrimInfo is from `prim_info(supercell->prim, event)`.
+std::shared_ptr<OccEventSupercellInfo const>
+OccEventSupercellInfoCache::supercell_info(
+    std::shared_ptr<Supercell const> const &supercell,
+    occ_events::OccEvent const &event) {
+  throw_if_equal_to_nullptr(
+      supercell,
+      "Error in OccEventSupercellInfoCache::supercell_info: supercell is "
+      "empty");
+  auto const &T = supercell->superlattice.transformation_matrix_to_super();
+  supercell_key_type key(supercell->prim.get(),
+                         std::vector<long>(T.data(), T.data() + T.size()),
+                         event);
+  auto make_value = [&]() {
+    return std::make_shared<OccEventSupercellInfo const>(
+        prim_info(supercell->prim, event), supercell);
+  };
+
+  std::promise<std::shared_ptr<OccEventSupercellInfo const>> promise;
+  std::shared_future<std::shared_ptr<OccEventSupercellInfo const>> future;
+  bool is_owner = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      ++m_n_hits;
+      m_lru.splice(m_lru.begin(), m_lru, it->second.lru_position);
+      future = it->second.value;
+    } else {
+      ++m_n_misses;
+      if (m_max_entries == 0) {
+        // nothing is stored
+        is_owner = true;
+      } else {
+        future = promise.get_future().share();
+        m_lru.push_front(key);
+        m_entries.emplace(key, Entry{future, m_lru.begin()});
+        while (m_entries.size() > m_max_entries) {
+          m_entries.erase(m_lru.back());
+          m_lru.pop_back();
+        }
+        is_owner = true;
+      }
+    }
+  }
+  if (!is_owner) {
+    // constructed, or being constructed, by another call
+    return future.get();
+  }
+  if (!future.valid()) {
+    return make_value();
+  }
+
+  try {
+    promise.set_value(make_value());
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      m_lru.erase(it->second.lru_position);
+      m_entries.erase(it);
+    }
+  }
+  return future.get();
+}
+
+/// \brief Maximum number of OccEventSupercellInfo stored
+Index OccEventSupercellInfoCache::max_entries() const { return m_max_entries; }
+
+/// \brief Number of OccEventSupercellInfo stored
+Index OccEventSupercellInfoCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Number of calls to `supercell_info` that found a stored value
+Index OccEventSupercellInfoCache::n_hits() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_n_hits;
+}
+
+/// \brief Number of calls to `supercell_info` that constructed a value
+Index OccEventSupercellInfoCache::n_misses() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_n_misses;
+}
+
+/// \brief Remove all stored values
+///
+/// Values already returned remain valid.
+void OccEventSupercellInfoCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_prim_entries.clear();
+  m_entries.clear();
+  m_lru.clear();
+}
+
+/// \brief Process-wide OccEventSupercellInfoCache
+///
+/// Constructed on first use, with the default maximum number of entries.
+OccEventSupercellInfoCache &occ_event_supercell_info_cache() {
+  static OccEventSupercellInfoCache cache;
+  return cache;
 }
 
 }  // namespace config
@@ -0,0 +1,139 @@
+#include "casm/configuration/enumeration/OccupationFilter.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/crystallography/BasicStructure.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+Index _max_n_occupants(Prim const &prim) {
+  Index n_occ_max = 0;
+  for (auto const &site : prim.basicstructure->basis()) {
+    n_occ_max = std::max(n_occ_max, Index(site.occupant_dof().size()));
+  }
+  return n_occ_max;
+}
+
+}  // namespace
+
+/// \brief Constructor, with no predicates
+///
+/// \param _supercell The supercell of the configurations that are checked
+OccupationFilter::OccupationFilter(
+    std::shared_ptr<Supercell const> const &_supercell)
+    : m_supercell(throw_if_equal_to_nullptr(
+          _supercell, "Error in OccupationFilter: supercell is empty")),
+      m_n_sites(m_supercell->unitcellcoord_index_converter.total_sites()),
+      m_n_occ_max(_max_n_occupants(*m_supercell->prim)),
+      m_check_changed(false),
+      m_min_changed(0),
+      m_max_changed(0),
+      m_check_allowed(false),
+      m_allowed_mask(m_n_sites, ~0ULL) {
+  Index n_unitcells = m_supercell->unitcell_index_converter.total_sites();
+  Index n_sublat = m_supercell->prim->basicstructure->basis().size();
+  m_slot_begin.resize(m_n_sites);
+  for (Index l = 0; l < m_n_sites; ++l) {
+    m_slot_begin[l] = (l / n_unitcells) * m_n_occ_max;
+  }
+  m_bound_index.resize(n_sublat * m_n_occ_max, -1);
+}
+
+/// \brief The supercell
+std::shared_ptr<Supercell const> const &OccupationFilter::supercell() const {
+  return m_supercell;
+}
+
+/// \brief Require that the number of sites on a sublattice with an
+///     occupant is in `[min_count, max_count]`
+///
+/// To bound the composition on a sublattice, use counts equal to the
+/// fraction of sites times the number of unit cells in the supercell. If
+/// called more than once for the same sublattice and occupant, the ranges
+/// are intersected.
+OccupationFilter &OccupationFilter::require_occupant_count(
+    Index sublattice_index, Index occupant_index, Index min_count,
+    Index max_count) {
+  auto const &basis = m_supercell->prim->basicstructure->basis();
+  if (sublattice_index < 0 || sublattice_index >= basis.size()) {
+    throw std::runtime_error(
+        "Error in OccupationFilter::require_occupant_count: invalid "
+        "sublattice_index");
+  }
+  if (occupant_index < 0 ||
+      occupant_index >= basis[sublattice_index].occupant_dof().size()) {
+    throw std::runtime_error(
+        "Error in OccupationFilter::require_occupant_count: invalid "
+        "occupant_index");
+  }
+  Index &i_bound =
+      m_bound_index[sublattice_index * m_n_occ_max + occupant_index];
+  if (i_bound < 0) {
+    i_bound = m_count_bounds.size();
+    m_count_bounds.push_back({min_count, max_count});
+  } else {
+    auto &bounds = m_count_bounds[i_bound];
+    bounds[0] = std::max(bounds[0], min_count);
+    bounds[1] = std::min(bounds[1], max_count);
+  }
+  return *this;
+}
+
+/// \brief Require that the number of sites with occupation different from
+///     `background_occupation` is in `[min_count, max_count]`
+///
+/// Replaces any previous requirement on the number of changed sites.
+OccupationFilter &OccupationFilter::require_n_changed_sites(
+    Eigen::VectorXi const &background_occupation, Index min_count,
+    Index max_count) {
+  if (background_occupation.size() != m_n_sites) {
+    throw std::runtime_error(
+        "Error in OccupationFilter::require_n_changed_sites: "
+        "background_occupation size does not match supercell");
+  }
+  m_check_changed = true;
+  m_background_occupation = background_occupation;
+  m_min_changed = min_count;
+  m_max_changed = max_count;
+  return *this;
+}
+
+/// \brief Require that each site in `sites` has one of `allowed_occupants`
+///
+/// If called more than once for the same site, the allowed occupants are
+/// intersected. Occupant indices must be less than 64.
+OccupationFilter &OccupationFilter::require_allowed_occupants(
+    std::set<Index> const &sites, std::set<int> const &allowed_occupants) {
+  unsigned long long mask = 0;
+  for (int occ : allowed_occupants) {
+    if (occ < 0 || occ >= 64) {
+      throw std::runtime_error(
+          "Error in OccupationFilter::require_allowed_occupants: invalid "
+          "occupant index");
+    }
+    mask |= 1ULL << occ;
+  }
+  for (Index l : sites) {
+    if (l < 0 || l >= m_n_sites) {
+      throw std::runtime_error(
+          "Error in OccupationFilter::require_allowed_occupants: invalid "
+          "site index");
+    }
+    m_allowed_mask[l] &= mask;
+  }
+  m_check_allowed = true;
+  return *this;
+}
+
+/// \brief Return true if the configuration occupation satisfies all
+///     predicates
+bool OccupationFilter::operator()(Configuration const &configuration) const {
+  return is_allowed(configuration.dof_values.occupation);
+}
+
+}  // namespace config
+}  // namespace CASM
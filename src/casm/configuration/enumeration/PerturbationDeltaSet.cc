@@ -0,0 +1,347 @@
+#include "casm/configuration/enumeration/PerturbationDeltaSet.hh"
+
+#include <stdlib.h>
+
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <string>
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/io/binary/binary_io.hh"
+#include "casm/crystallography/BasicStructure.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief Estimated bytes used by one delta stored in a std::set
+Index _delta_memory(SparseOccupation const &delta) {
+  return sizeof(SparseOccupation) + 4 * sizeof(void *) +
+         delta.capacity() * sizeof(SparseOccupation::value_type);
+}
+
+void _write_delta(std::ostream &out, SparseOccupation const &delta) {
+  binary_io::write_u32(out, delta.size());
+  for (auto const &value : delta) {
+    binary_io::write_u32(out, value.first);
+    binary_io::write_u32(out, value.second);
+  }
+}
+
+void _read_delta(std::istream &in, SparseOccupation &delta) {
+  delta.resize(binary_io::read_u32(in));
+  for (auto &value : delta) {
+    value.first = binary_io::read_u32(in);
+    value.second = binary_io::read_u32(in);
+  }
+}
+
+/// \brief Return true if continuous DoF values are equal, within `tol`
+template <typename MapType>
+bool _is_equal_continuous(MapType const &A, MapType const &B, double tol) {
+  if (A.size() != B.size()) {
+    return false;
+  }
+  for (auto const &pair : A) {
+    auto it = B.find(pair.first);
+    if (it == B.end() || it->second.rows() != pair.second.rows() ||
+        it->second.cols() != pair.second.cols()) {
+      return false;
+    }
+    if (pair.second.size() &&
+        ((pair.second - it->second).array().abs() >= tol).any()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Reads the deltas of one sorted run file, in order
+class _RunReader {
+ public:
+  explicit _RunReader(fs::path const &path)
+      : m_in(path.string(), std::ios::binary) {
+    if (!m_in) {
+      throw std::runtime_error(
+          "Error in PerturbationDeltaSet: failed to open run file " +
+          path.string());
+    }
+    m_remaining = binary_io::read_i64(m_in);
+  }
+
+  /// \brief Read the next delta, or return false if no deltas remain
+  bool next(SparseOccupation &delta) {
+    if (m_remaining == 0) {
+      return false;
+    }
+    _read_delta(m_in, delta);
+    --m_remaining;
+    return true;
+  }
+
+ private:
+  std::ifstream m_in;
+  Index m_remaining;
+};
+
+}  // namespace
+
+/// \brief Return the occupation of `configuration` relative to `background`
+///
+/// \param background The background configuration
+/// \param configuration A configuration in the same supercell as
+///     `background`
+///
+/// \returns The (linear site index, occupant index) of every site where the
+///     occupation of `configuration` differs from `background`, sorted by
+///     site index. Only the occupation is compared.
+SparseOccupation make_occupation_delta(Configuration const &background,
+                                       Configuration const &configuration) {
+  Eigen::VectorXi const &occ_background = background.dof_values.occupation;
+  Eigen::VectorXi const &occ = configuration.dof_values.occupation;
+  if (occ.size() != occ_background.size()) {
+    throw std::runtime_error(
+        "Error in make_occupation_delta: occupation size mismatch");
+  }
+  SparseOccupation delta;
+  for (Index l = 0; l < occ.size(); ++l) {
+    if (occ(l) != occ_background(l)) {
+      delta.emplace_back(l, occ(l));
+    }
+  }
+  return delta;
+}
+
+/// \brief Return a copy of `background` with `delta` applied
+///
+/// \param background The background configuration
+/// \param delta (linear site index, occupant index) pairs to set
+Configuration apply_occupation_delta(Configuration const &background,
+                                     SparseOccupation const &delta) {
+  Configuration configuration = background;
+  Eigen::VectorXi &occ = configuration.dof_values.occupation;
+  for (auto const &value : delta) {
+    if (value.first < 0 || value.first >= occ.size()) {
+      throw std::runtime_error(
+          "Error in apply_occupation_delta: site index out of range");
+    }
+    occ(value.first) = value.second;
+  }
+  return configuration;
+}
+
+/// \brief Constructor
+///
+/// \param _background The background configuration. Inserted
+///     configurations must be in the same supercell and have the same
+///     continuous DoF values.
+/// \param _memory_budget If present, the deltas held in memory are written
+///     to a sorted run file whenever their estimated size exceeds this
+///     number of bytes. If not present, all deltas are kept in memory.
+/// \param _spill_dir Directory in which a uniquely named directory for run
+///     files is created. If not present, `fs::temp_directory_path()` is
+///     used.
+PerturbationDeltaSet::PerturbationDeltaSet(
+    Configuration const &_background, std::optional<Index> _memory_budget,
+    std::optional<fs::path> _spill_dir)
+    : m_background(_background),
+      m_memory_budget(_memory_budget),
+      m_spill_dir(_spill_dir.has_value() ? *_spill_dir
+                                         : fs::temp_directory_path()),
+      m_memory_used(0) {
+  if (m_memory_budget.has_value() && *m_memory_budget < 0) {
+    throw std::runtime_error(
+        "Error in PerturbationDeltaSet: memory_budget must be >= 0");
+  }
+}
+
+PerturbationDeltaSet::~PerturbationDeltaSet() {
+  std::error_code ec;
+  if (!m_run_dir.empty()) {
+    fs::remove_all(m_run_dir, ec);
+  }
+}
+
+/// \brief Insert a configuration, stored relative to the background
+///
+/// Throws if `configuration` is not in the background supercell or if its
+/// continuous DoF values differ from the background.
+void PerturbationDeltaSet::insert(Configuration const &configuration) {
+  if (configuration.supercell != m_background.supercell &&
+      *configuration.supercell != *m_background.supercell) {
+    throw std::runtime_error(
+        "Error in PerturbationDeltaSet::insert: supercell mismatch");
+  }
+  double tol = m_background.supercell->prim->basicstructure->lattice().tol();
+  auto const &A = configuration.dof_values;
+  auto const &B = m_background.dof_values;
+  if (!_is_equal_continuous(A.global_dof_values, B.global_dof_values, tol) ||
+      !_is_equal_continuous(A.local_dof_values, B.local_dof_values, tol)) {
+    throw std::runtime_error(
+        "Error in PerturbationDeltaSet::insert: continuous DoF values differ "
+        "from the background");
+  }
+  insert(make_occupation_delta(m_background, configuration));
+}
+
+/// \brief Insert an occupation delta
+///
+/// \param delta (linear site index, occupant index) pairs, sorted by site
+///     index, as from `make_occupation_delta`
+void PerturbationDeltaSet::insert(SparseOccupation delta) {
+  Index memory = _delta_memory(delta);
+  if (m_deltas.insert(std::move(delta)).second) {
+    m_memory_used += memory;
+  }
+  if (m_memory_budget.has_value() && m_memory_used > *m_memory_budget) {
+    _spill();
+  }
+}
+
+/// \brief Call `f` with each distinct occupation delta, in order
+///
+/// The sorted runs and the deltas held in memory are merged, and each
+/// distinct delta is passed to `f` once.
+void PerturbationDeltaSet::for_each_delta(
+    std::function<void(SparseOccupation const &)> f) const {
+  if (m_runs.empty()) {
+    for (auto const &delta : m_deltas) {
+      f(delta);
+    }
+    return;
+  }
+
+  std::vector<std::unique_ptr<_RunReader>> readers;
+  for (auto const &path : m_runs) {
+    readers.emplace_back(std::make_unique<_RunReader>(path));
+  }
+
+  // (delta, source), source == readers.size() for the in-memory deltas
+  typedef std::pair<SparseOccupation, Index> HeapValue;
+  std::priority_queue<HeapValue, std::vector<HeapValue>,
+                      std::greater<HeapValue>>
+      heap;
+  auto memory_it = m_deltas.begin();
+  auto push_next = [&](Index source) {
+    SparseOccupation delta;
+    if (source == Index(readers.size())) {
+      if (memory_it == m_deltas.end()) {
+        return;
+      }
+      delta = *memory_it++;
+    } else if (!readers[source]->next(delta)) {
+      return;
+    }
+    heap.emplace(std::move(delta), source);
+  };
+  for (Index source = 0; source <= Index(readers.size()); ++source) {
+    push_next(source);
+  }
+
+  std::optional<SparseOccupation> last;
+  while (!heap.empty()) {
+    HeapValue top = heap.top();
+    heap.pop();
+    push_next(top.second);
+    if (last.has_value() && *last == top.first) {
+      continue;
+    }
+    f(top.first);
+    last = std::move(top.first);
+  }
+}
+
+/// \brief Call `f` with each distinct configuration, in SparseOccupation
+///     order
+///
+/// Each configuration is constructed from the background and its delta just
+/// before `f` is called.
+void PerturbationDeltaSet::for_each(
+    std::function<void(Configuration const &)> f) const {
+  for_each_delta([&](SparseOccupation const &delta) {
+    f(apply_occupation_delta(m_background, delta));
+  });
+}
+
+/// \brief Number of distinct configurations
+///
+/// If runs have been written, this reads them all.
+Index PerturbationDeltaSet::size() const {
+  if (m_runs.empty()) {
+    return m_deltas.size();
+  }
+  Index count = 0;
+  for_each_delta([&](SparseOccupation const &) { ++count; });
+  return count;
+}
+
+/// \brief Copy the distinct configurations into an ordered set
+std::set<Configuration> PerturbationDeltaSet::to_set() const {
+  std::set<Configuration> result;
+  for_each([&](Configuration const &configuration) {
+    result.emplace_hint(result.end(), configuration);
+  });
+  return result;
+}
+
+/// \brief Remove all configurations and run files
+void PerturbationDeltaSet::clear() {
+  for (auto const &path : m_runs) {
+    std::error_code ec;
+    fs::remove(path, ec);
+  }
+  m_runs.clear();
+  m_deltas.clear();
+  m_memory_used = 0;
+}
+
+/// \brief Write the deltas held in memory to a new sorted run file
+///
+/// Run file format: int64 number of deltas, then for each delta a uint32
+/// number of sites and uint32 (site index, occupant index) pairs.
+///
+/// On the first spill, a directory with a unique name is created in the
+/// spill directory with `mkdtemp`, so no other set, in this or another
+/// process, writes run files to the same paths.
+void PerturbationDeltaSet::_spill() {
+  if (m_deltas.empty()) {
+    return;
+  }
+  if (m_run_dir.empty()) {
+    std::string pattern =
+        (m_spill_dir / "casm_perturbation_delta_set.XXXXXX").string();
+    if (::mkdtemp(pattern.data()) == nullptr) {
+      throw std::runtime_error(
+          "Error in PerturbationDeltaSet: failed to create run directory in " +
+          m_spill_dir.string());
+    }
+    m_run_dir = pattern;
+  }
+  fs::path path = m_run_dir / ("run." + std::to_string(m_runs.size()) + ".bin");
+  {
+    std::ofstream out(path.string(), std::ios::binary | std::ios::trunc);
+    if (!out) {
+      throw std::runtime_error(
+          "Error in PerturbationDeltaSet: failed to open run file " +
+          path.string());
+    }
+    binary_io::write_i64(out, m_deltas.size());
+    for (auto const &delta : m_deltas) {
+      _write_delta(out, delta);
+    }
+    if (!out) {
+      throw std::runtime_error(
+          "Error in PerturbationDeltaSet: failed to write run file " +
+          path.string());
+    }
+  }
+  m_runs.push_back(path);
+  m_deltas.clear();
+  m_memory_used = 0;
+}
+
+}  // namespace config
+}  // namespace CASM
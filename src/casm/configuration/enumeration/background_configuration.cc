@@ -1,9 +1,17 @@
 #include "casm/configuration/enumeration/background_configuration.hh"
 
+#include <memory>
+#include <optional>
+#include <set>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
 #include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationHashSet.hh"
+#include "casm/configuration/InvariantSubgroupEngine.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/canonical_form.hh"
 #include "casm/configuration/copy_configuration.hh"
+#include "casm/configuration/parallel.hh"
 
 // debug:
 #include "casm/casm_io/container/json_io.hh"
@@ -68,10 +76,223 @@ Configuration make_canonical_form(
   return canonical_config_init;
 }
 
+/// \brief Make the canonical form for a configuration in the context
+///    of an occupation event, using precomputed event group permutations
+///
+/// \param configuration A configuration
+/// \param event_sites Linear sites indices of the cluster of sites that
+///     change during the event
+/// \param occ_init Initial occupation on sites
+/// \param occ_final Final occupation on sites
+/// \param event_group_engine A CanonicalFormEngine constructed with the
+///     SupercellSymOp consistent with both the supercell of configuration
+///     and a local subgroup of the prim factor group (for example a cluster
+///     group).
+///
+/// \return The canonical configuration, allowing either the initial or
+///     final occupation on the event sites. The result is identical to
+///     `make_canonical_form` using the engine's operations directly, but
+///     the site permutations are not recomputed for each call.
+Configuration make_canonical_form(
+    Configuration const &configuration, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    CanonicalFormEngine const &event_group_engine) {
+  Configuration canonical_config_init = event_group_engine.make_canonical_form(
+      copy_apply_occ(configuration, event_sites, occ_init));
+  Configuration canonical_config_final =
+      event_group_engine.make_canonical_form(
+          copy_apply_occ(configuration, event_sites, occ_final));
+  if (canonical_config_final > canonical_config_init) {
+    return canonical_config_final;
+  }
+  return canonical_config_init;
+}
+
+/// \brief Make the canonical forms of many configurations, each in the
+///     context of one of a set of occupation events, in parallel
+///
+/// One CanonicalFormEngine is constructed for each event, in parallel, and
+/// then used for all configurations in the context of that event.
+///
+/// \param configurations The configurations
+/// \param event_index For each configuration, the index of the event, so
+///     that `configurations[i]` is made canonical using
+///     `event_sites[event_index[i]]`, `occ_init[event_index[i]]`,
+///     `occ_final[event_index[i]]`, and `event_groups[event_index[i]]`.
+/// \param event_sites For each event, linear site indices of the cluster of
+///     sites that change during the event. If empty, the event occupation is
+///     not applied and configurations are only made canonical with respect
+///     to the event group.
+/// \param occ_init For each event, the initial occupation on the event sites
+/// \param occ_final For each event, the final occupation on the event sites
+/// \param event_groups For each event, the SupercellSymOp consistent with
+///     both the supercell of the configurations in the context of that event
+///     and the event invariant group
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns The canonical configurations, `result[i]` the same as
+///     `make_canonical_form(configurations[i], event_sites[e], occ_init[e],
+///     occ_final[e], event_groups[e])`, with `e = event_index[i]`, or
+///     `make_canonical_form(configurations[i], begin, end)` using the event
+///     group if `event_sites[e]` is empty. The result does not depend on
+///     `n_threads`.
+std::vector<Configuration> make_canonical_forms(
+    std::vector<Configuration> const &configurations,
+    std::vector<Index> const &event_index,
+    std::vector<std::vector<Index>> const &event_sites,
+    std::vector<std::vector<int>> const &occ_init,
+    std::vector<std::vector<int>> const &occ_final,
+    std::vector<std::vector<SupercellSymOp>> const &event_groups,
+    Index n_threads) {
+  Index n_events = event_groups.size();
+  if (configurations.size() != event_index.size() ||
+      event_sites.size() != n_events || occ_init.size() != n_events ||
+      occ_final.size() != n_events) {
+    throw std::runtime_error("Error in make_canonical_forms: size mismatch");
+  }
+  for (Index e : event_index) {
+    if (e < 0 || e >= n_events) {
+      throw std::runtime_error(
+          "Error in make_canonical_forms: event_index out of range");
+    }
+  }
+  for (Index e = 0; e < n_events; ++e) {
+    if (event_groups[e].empty()) {
+      throw std::runtime_error(
+          "Error in make_canonical_forms: empty event group");
+    }
+  }
+  for (Index i = 0; i < configurations.size(); ++i) {
+    if (*configurations[i].supercell !=
+        *event_groups[event_index[i]][0].supercell()) {
+      throw std::runtime_error(
+          "Error in make_canonical_forms: configuration and event group "
+          "supercells do not match");
+    }
+  }
+
+  std::vector<std::unique_ptr<CanonicalFormEngine>> engines(n_events);
+  parallel_for_items(n_events, n_threads, [&](Index e) {
+    engines[e] = std::make_unique<CanonicalFormEngine>(
+        event_groups[e][0].supercell(), event_groups[e]);
+  });
+
+  std::vector<std::optional<Configuration>> canonical(configurations.size());
+  parallel_for_items(configurations.size(), n_threads, [&](Index i) {
+    Index e = event_index[i];
+    if (event_sites[e].empty()) {
+      canonical[i] = engines[e]->make_canonical_form(configurations[i]);
+    } else {
+      canonical[i] = make_canonical_form(configurations[i], event_sites[e],
+                                         occ_init[e], occ_final[e],
+                                         *engines[e]);
+    }
+  });
+
+  std::vector<Configuration> result;
+  result.reserve(configurations.size());
+  for (auto &value : canonical) {
+    result.push_back(std::move(*value));
+  }
+  return result;
+}
+
+namespace {  // anonymous
+
+/// \brief Return the operations of `event_group` that leave the event sites
+///     invariant and map the initial and final event occupations onto each
+///     other or themselves
+///
+/// For these operations, `h`, the canonical form of `h * configuration` in
+/// the context of the event is the same as that of `configuration`.
+std::vector<SupercellSymOp> _make_event_occupation_stabilizer(
+    std::shared_ptr<Supercell const> const &supercell,
+    std::vector<Index> const &event_sites, std::vector<int> const &occ_init,
+    std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group) {
+  std::set<Index> site_set(event_sites.begin(), event_sites.end());
+  Configuration configuration(supercell);
+  Configuration config_init =
+      copy_apply_occ(configuration, event_sites, occ_init);
+  Configuration config_final =
+      copy_apply_occ(configuration, event_sites, occ_final);
+  auto is_event_occ = [&](Configuration const &transformed) {
+    std::vector<int> occ;
+    for (Index s : event_sites) {
+      occ.push_back(transformed.dof_values.occupation[s]);
+    }
+    return occ == occ_init || occ == occ_final;
+  };
+
+  SupercellSymOpApplier applier;
+  std::vector<SupercellSymOp> stabilizer;
+  for (SupercellSymOp const &op : event_group) {
+    if (site_indices_are_invariant(op, site_set) &&
+        is_event_occ(applier.copy_apply(op, config_init)) &&
+        is_event_occ(applier.copy_apply(op, config_final))) {
+      stabilizer.push_back(op);
+    }
+  }
+  return stabilizer;
+}
+
+/// \brief Implements make_distinct_background_configurations
+///
+/// For each distinct super configuration, `prototype`, only one operation,
+/// `g`, per double coset `H * g * S` is applied, where `H` is the event
+/// occupation stabilizer and `S` is the invariant subgroup of `prototype`.
+/// Configurations in the same double coset have the same canonical form,
+/// so the others are not constructed. Canonical forms are collected in one
+/// ConfigurationHashSet per thread, so memory use is proportional to the
+/// number of distinct results, not the number of super configurations.
+///
+/// \param make_canonical_f Returns the canonical form of a configuration in
+///     the context of the event. Must be safe to call concurrently.
+template <typename MakeCanonicalF>
+std::set<Configuration> _make_distinct_background_configurations(
+    Configuration const &motif,
+    std::shared_ptr<Supercell const> const &supercell,
+    std::vector<Index> const &event_sites, std::vector<int> const &occ_init,
+    std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group, Index n_threads,
+    MakeCanonicalF make_canonical_f) {
+  InvariantSubgroupEngine engine(supercell);
+  std::vector<SupercellSymOp> stabilizer = _make_event_occupation_stabilizer(
+      supercell, event_sites, occ_init, occ_final, event_group);
+
+  ConfigurationHashSet distinct;
+  for (Configuration const &prototype :
+       make_distinct_super_configurations(motif, supercell)) {
+    std::vector<SupercellSymOp> reps = engine.make_double_coset_representatives(
+        stabilizer, engine.make_invariant_subgroup(prototype));
+
+    Index n = resolve_n_threads(n_threads, reps.size());
+    std::vector<ConfigurationHashSet> local_distinct(n);
+    std::vector<SupercellSymOpApplier> appliers(n);
+    parallel_for_items(reps.size(), n, [&](Index t, Index i) {
+      local_distinct[t].insert(
+          make_canonical_f(appliers[t].copy_apply(reps[i], prototype)));
+    });
+    for (auto const &local : local_distinct) {
+      distinct.merge(local);
+    }
+  }
+  return distinct.to_set();
+}
+
+}  // namespace
+
 /// \brief Make all configurations, equivalent as infinite crystals under prim
 ///     factor group operations, that fit into the same supercell, but are
 ///     inequivalent under the action of a local group.
 ///
+/// The result is the set of canonical forms, as by `make_canonical_form`,
+/// of `make_all_super_configurations(motif, supercell)`, but super
+/// configurations that differ by an operation of the event group that
+/// preserves the event sites and occupation are not constructed, and
+/// super configurations are not all stored at once.
+///
 /// \param motif The motif for the background configurations
 /// \param supercell The supercell in which to generate distinct background
 ///     configurations
@@ -82,6 +303,9 @@ Configuration make_canonical_form(
 /// \param event_group The SupercellSymOp consistent with both
 ///     the supercell of configuration and a local subgroup of the prim factor
 ///     group (for example a cluster group).
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`. The result does not depend
+///     on `n_threads`.
 ///
 /// \param The configuration symmetrically equivalent to the background
 ///     configuration which form symmetrically distinct backgrounds for the
@@ -91,16 +315,49 @@ std::set<Configuration> make_distinct_background_configurations(
     std::shared_ptr<Supercell const> const &supercell,
     std::vector<Index> const &event_sites, std::vector<int> const &occ_init,
     std::vector<int> const &occ_final,
-    std::vector<SupercellSymOp> const &event_group) {
-  std::vector<Configuration> all =
-      make_all_super_configurations(motif, supercell);
+    std::vector<SupercellSymOp> const &event_group, Index n_threads) {
+  return _make_distinct_background_configurations(
+      motif, supercell, event_sites, occ_init, occ_final, event_group,
+      n_threads, [&](Configuration const &configuration) {
+        return make_canonical_form(configuration, event_sites, occ_init,
+                                   occ_final, event_group);
+      });
+}
 
-  std::set<Configuration> distinct;
-  for (Configuration const &configuration : all) {
-    distinct.emplace(make_canonical_form(configuration, event_sites, occ_init,
-                                         occ_final, event_group));
-  }
-  return distinct;
+/// \brief Make all configurations, equivalent as infinite crystals under prim
+///     factor group operations, that fit into the same supercell, but are
+///     inequivalent under the action of a local group, using precomputed
+///     event group permutations
+///
+/// Gives the same result as the overload taking the event group directly.
+///
+/// \param motif The motif for the background configurations
+/// \param event_sites Linear sites indices of the cluster of sites that
+///     change during the event
+/// \param occ_init Initial occupation on event_sites
+/// \param occ_final Final occupation on event_sites
+/// \param event_group_engine A CanonicalFormEngine constructed with the
+///     SupercellSymOp consistent with both the supercell in which to
+///     generate distinct background configurations and a local subgroup of
+///     the prim factor group (for example a cluster group).
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`. The result does not depend
+///     on `n_threads`.
+///
+/// \param The configuration symmetrically equivalent to the background
+///     configuration which form symmetrically distinct backgrounds for the
+///     event.
+std::set<Configuration> make_distinct_background_configurations(
+    Configuration const &motif, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    CanonicalFormEngine const &event_group_engine, Index n_threads) {
+  return _make_distinct_background_configurations(
+      motif, event_group_engine.supercell(), event_sites, occ_init, occ_final,
+      event_group_engine.ops(), n_threads,
+      [&](Configuration const &configuration) {
+        return make_canonical_form(configuration, event_sites, occ_init,
+                                   occ_final, event_group_engine);
+      });
 }
 
 }  // namespace config
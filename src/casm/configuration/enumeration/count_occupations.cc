@@ -0,0 +1,401 @@
+#include "casm/configuration/enumeration/count_occupations.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+
+#include "casm/configuration/PrimSymInfo.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymInfo.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// \brief Unsigned integer of arbitrary size, as little-endian base 2^32
+///     limbs, with the few operations needed for counting
+class _BigUInt {
+ public:
+  explicit _BigUInt(std::uint64_t value = 0) {
+    while (value != 0) {
+      m_limbs.push_back(static_cast<std::uint32_t>(value));
+      value >>= 32;
+    }
+  }
+
+  bool is_zero() const { return m_limbs.empty(); }
+
+  _BigUInt &operator+=(_BigUInt const &rhs) {
+    if (m_limbs.size() < rhs.m_limbs.size()) {
+      m_limbs.resize(rhs.m_limbs.size(), 0);
+    }
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < m_limbs.size(); ++i) {
+      std::uint64_t sum = carry + m_limbs[i];
+      if (i < rhs.m_limbs.size()) {
+        sum += rhs.m_limbs[i];
+      }
+      m_limbs[i] = static_cast<std::uint32_t>(sum);
+      carry = sum >> 32;
+      if (carry == 0 && i >= rhs.m_limbs.size()) {
+        break;
+      }
+    }
+    if (carry != 0) {
+      m_limbs.push_back(static_cast<std::uint32_t>(carry));
+    }
+    return *this;
+  }
+
+  _BigUInt &operator*=(std::uint32_t rhs) {
+    if (rhs == 0) {
+      m_limbs.clear();
+      return *this;
+    }
+    std::uint64_t carry = 0;
+    for (std::uint32_t &limb : m_limbs) {
+      std::uint64_t product = std::uint64_t(limb) * rhs + carry;
+      limb = static_cast<std::uint32_t>(product);
+      carry = product >> 32;
+    }
+    if (carry != 0) {
+      m_limbs.push_back(static_cast<std::uint32_t>(carry));
+    }
+    return *this;
+  }
+
+  _BigUInt operator*(_BigUInt const &rhs) const {
+    _BigUInt result;
+    if (is_zero() || rhs.is_zero()) {
+      return result;
+    }
+    result.m_limbs.assign(m_limbs.size() + rhs.m_limbs.size(), 0);
+    for (std::size_t i = 0; i < m_limbs.size(); ++i) {
+      std::uint64_t carry = 0;
+      for (std::size_t j = 0; j < rhs.m_limbs.size(); ++j) {
+        std::uint64_t value = std::uint64_t(m_limbs[i]) * rhs.m_limbs[j] +
+                              result.m_limbs[i + j] + carry;
+        result.m_limbs[i + j] = static_cast<std::uint32_t>(value);
+        carry = value >> 32;
+      }
+      result.m_limbs[i + rhs.m_limbs.size()] =
+          static_cast<std::uint32_t>(carry);
+    }
+    result._trim();
+    return result;
+  }
+
+  /// \brief Divide in place, returning the remainder
+  std::uint32_t divide(std::uint32_t divisor) {
+    std::uint64_t remainder = 0;
+    for (std::size_t i = m_limbs.size(); i-- > 0;) {
+      std::uint64_t value = (remainder << 32) | m_limbs[i];
+      m_limbs[i] = static_cast<std::uint32_t>(value / divisor);
+      remainder = value % divisor;
+    }
+    _trim();
+    return static_cast<std::uint32_t>(remainder);
+  }
+
+  std::string to_string() const {
+    if (is_zero()) {
+      return "0";
+    }
+    _BigUInt value(*this);
+    std::vector<std::uint32_t> groups;
+    while (!value.is_zero()) {
+      groups.push_back(value.divide(1000000000u));
+    }
+    std::string result = std::to_string(groups.back());
+    for (std::size_t i = groups.size() - 1; i-- > 0;) {
+      std::string group = std::to_string(groups[i]);
+      result += std::string(9 - group.size(), '0') + group;
+    }
+    return result;
+  }
+
+ private:
+  void _trim() {
+    while (!m_limbs.empty() && m_limbs.back() == 0) {
+      m_limbs.pop_back();
+    }
+  }
+
+  std::vector<std::uint32_t> m_limbs;
+};
+
+/// \brief Cycle type of a site permutation: (orbit, cycle length, number of
+///     cycles), flattened, in increasing (orbit, cycle length) order
+typedef std::vector<Index> CycleType;
+
+/// \brief Polynomial in the occupant counts of one orbit: exponents -> coef
+typedef std::map<std::vector<Index>, _BigUInt> OrbitPolynomial;
+
+/// \brief Group sublattices into orbits, using the factor group site
+///     permutations, which map sublattices onto sublattices
+std::vector<Index> _make_orbit_of_sublattice(Supercell const &supercell) {
+  auto const &converter = supercell.unitcellcoord_index_converter;
+  Index n_sublat = supercell.prim->basicstructure->basis().size();
+  std::vector<Index> parent(n_sublat);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&](Index b) {
+    while (parent[b] != b) {
+      b = parent[b] = parent[parent[b]];
+    }
+    return b;
+  };
+  for (auto const &perm : supercell.sym_info.factor_group_permutations) {
+    for (Index b = 0; b < n_sublat; ++b) {
+      Index a = find(b);
+      Index l = converter(xtal::UnitCellCoord(b, 0, 0, 0));
+      Index c = find(converter(perm[l]).sublattice());
+      parent[std::max(a, c)] = std::min(a, c);
+    }
+  }
+
+  std::vector<Index> orbit_of_sublattice(n_sublat);
+  std::map<Index, Index> orbit_index;
+  for (Index b = 0; b < n_sublat; ++b) {
+    auto it = orbit_index.emplace(find(b), orbit_index.size()).first;
+    orbit_of_sublattice[b] = it->second;
+  }
+  return orbit_of_sublattice;
+}
+
+/// \brief Multiply by (x_0^L + x_1^L + ... + x_{m-1}^L), `n_cycles` times
+void _multiply_cycles(OrbitPolynomial &polynomial, Index n_occupants,
+                      Index length, Index n_cycles) {
+  for (Index c = 0; c < n_cycles; ++c) {
+    OrbitPolynomial result;
+    for (auto const &term : polynomial) {
+      std::vector<Index> exponents = term.first;
+      for (Index k = 0; k < n_occupants; ++k) {
+        exponents[k] += length;
+        result[exponents] += term.second;
+        exponents[k] -= length;
+      }
+    }
+    polynomial = std::move(result);
+  }
+}
+
+}  // namespace
+
+/// \brief Count the symmetrically distinct occupations of a supercell,
+///     without enumerating them
+///
+/// Method:
+/// - By Burnside's lemma, the number of distinct occupations is the average,
+///   over the supercell operations `g` (factor group operation followed by
+///   translation), of the number of occupations left unchanged by `g`.
+///   An occupation is unchanged if it is constant on each cycle of the site
+///   permutation of `g`, so that number depends only on the cycle type of
+///   `g`: the product over cycles of the number of occupants allowed on the
+///   cycle's sublattice.
+/// - Cycle types are collected from the site permutations of all
+///   `n_fg * n_translations` operations, so the cost is
+///   O(n_fg * n_translations * n_sites) and the operations do not need to
+///   be applied to any occupation.
+/// - Counts by composition use Pólya's generating function: for each cycle
+///   type, the product over cycles of length `L` of
+///   (x_0^L + x_1^L + ...), with separate variables for each sublattice
+///   orbit, gives the number of unchanged occupations of each composition.
+/// - Counts include occupations whose primitive cell is smaller than the
+///   supercell, as for filtering `ConfigEnumAllOccupations` by
+///   `is_canonical`.
+///
+/// \param supercell The supercell. Its prim must not have occupants that
+///     transform into other occupants under symmetry (see
+///     `PrimSymInfo::has_aniso_occs`), because then operations also permute
+///     occupant indices.
+/// \param by_composition If true, also count by composition
+/// \param n_threads Number of threads used to collect cycle types
+///
+/// \returns The counts. Counts by composition can be numerous for large
+///     supercells with many occupants.
+DistinctOccupationCount count_distinct_occupations(
+    std::shared_ptr<Supercell const> const &supercell, bool by_composition,
+    Index n_threads) {
+  if (supercell == nullptr) {
+    throw std::runtime_error(
+        "Error in count_distinct_occupations: supercell is empty");
+  }
+  if (supercell->prim->sym_info.has_aniso_occs) {
+    throw std::runtime_error(
+        "Error in count_distinct_occupations: not supported for prim with "
+        "occupants that transform into other occupants under symmetry");
+  }
+  SupercellSymInfo const &sym_info = supercell->sym_info;
+  auto const &converter = supercell->unitcellcoord_index_converter;
+  auto const &basis = supercell->prim->basicstructure->basis();
+  Index n_sites = converter.total_sites();
+  Index n_vol = supercell->unitcell_index_converter.total_sites();
+  Index n_fg = sym_info.factor_group_permutations.size();
+
+  DistinctOccupationCount result;
+  result.group_order = n_fg * n_vol;
+  if (result.group_order > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::runtime_error(
+        "Error in count_distinct_occupations: too many supercell operations");
+  }
+
+  // sublattice orbits
+  std::vector<Index> orbit_of_sublattice =
+      _make_orbit_of_sublattice(*supercell);
+  Index n_orbits = 0;
+  for (Index o : orbit_of_sublattice) {
+    n_orbits = std::max(n_orbits, o + 1);
+  }
+  result.sublattice_orbits.resize(n_orbits);
+  result.n_occupants.assign(n_orbits, 0);
+  result.n_sites.assign(n_orbits, 0);
+  for (Index b = 0; b < Index(basis.size()); ++b) {
+    Index o = orbit_of_sublattice[b];
+    Index n_occupants = basis[b].occupant_dof().size();
+    if (!result.sublattice_orbits[o].empty() &&
+        result.n_occupants[o] != n_occupants) {
+      throw std::runtime_error(
+          "Error in count_distinct_occupations: equivalent sublattices have "
+          "different numbers of occupants");
+    }
+    result.sublattice_orbits[o].push_back(b);
+    result.n_occupants[o] = n_occupants;
+    result.n_sites[o] += n_vol;
+  }
+  std::vector<Index> orbit_of_site(n_sites);
+  for (Index l = 0; l < n_sites; ++l) {
+    orbit_of_site[l] = orbit_of_sublattice[converter(l).sublattice()];
+  }
+
+  // collect cycle types, by translation
+  std::map<CycleType, Index> cycle_types;
+  std::mutex mutex;
+  parallel_for_chunks(n_vol, n_threads, [&](Index t_begin, Index t_end) {
+    std::map<CycleType, Index> local_cycle_types;
+    std::vector<Index> perm(n_sites);
+    std::vector<char> visited(n_sites);
+    std::vector<std::pair<Index, Index>> cycles;
+    sym_info::Permutation made_translation_perm;
+    for (Index t = t_begin; t < t_end; ++t) {
+      sym_info::Permutation const *translation_perm = nullptr;
+      if (sym_info.translation_permutations.has_value()) {
+        translation_perm = &sym_info.translation_permutations->at(t);
+      } else {
+        made_translation_perm = make_translation_permutation(
+            t, supercell->unitcell_index_converter, converter,
+            supercell->diagonal_index_converter.get());
+        translation_perm = &made_translation_perm;
+      }
+      for (auto const &fg_perm : sym_info.factor_group_permutations) {
+        for (Index l = 0; l < n_sites; ++l) {
+          perm[l] = fg_perm[(*translation_perm)[l]];
+        }
+        std::fill(visited.begin(), visited.end(), 0);
+        cycles.clear();
+        for (Index l = 0; l < n_sites; ++l) {
+          if (visited[l]) {
+            continue;
+          }
+          Index length = 0;
+          Index j = l;
+          do {
+            visited[j] = 1;
+            j = perm[j];
+            ++length;
+          } while (j != l);
+          cycles.emplace_back(orbit_of_site[l], length);
+        }
+        std::sort(cycles.begin(), cycles.end());
+        CycleType cycle_type;
+        for (auto const &cycle : cycles) {
+          Index n = cycle_type.size();
+          if (n != 0 && cycle_type[n - 3] == cycle.first &&
+              cycle_type[n - 2] == cycle.second) {
+            ++cycle_type[n - 1];
+          } else {
+            cycle_type.insert(cycle_type.end(), {cycle.first, cycle.second, 1});
+          }
+        }
+        ++local_cycle_types[cycle_type];
+      }
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto const &pair : local_cycle_types) {
+      cycle_types[pair.first] += pair.second;
+    }
+  });
+  result.n_cycle_types = cycle_types.size();
+
+  // Burnside's lemma
+  _BigUInt total;
+  for (auto const &pair : cycle_types) {
+    CycleType const &cycle_type = pair.first;
+    _BigUInt n_fixed(pair.second);
+    for (Index i = 0; i < Index(cycle_type.size()); i += 3) {
+      for (Index c = 0; c < cycle_type[i + 2]; ++c) {
+        n_fixed *= std::uint32_t(result.n_occupants[cycle_type[i]]);
+      }
+    }
+    total += n_fixed;
+  }
+  if (total.divide(std::uint32_t(result.group_order)) != 0) {
+    throw std::runtime_error(
+        "Error in count_distinct_occupations: inexact division");
+  }
+  result.total = total.to_string();
+  if (!by_composition) {
+    return result;
+  }
+
+  // Pólya's generating function, by sublattice orbit
+  std::map<std::vector<Index>, _BigUInt> composition_sums;
+  for (auto const &pair : cycle_types) {
+    CycleType const &cycle_type = pair.first;
+    std::vector<OrbitPolynomial> polynomials(n_orbits);
+    for (Index o = 0; o < n_orbits; ++o) {
+      polynomials[o][std::vector<Index>(result.n_occupants[o], 0)] =
+          _BigUInt(1);
+    }
+    for (Index i = 0; i < Index(cycle_type.size()); i += 3) {
+      Index o = cycle_type[i];
+      _multiply_cycles(polynomials[o], result.n_occupants[o], cycle_type[i + 1],
+                       cycle_type[i + 2]);
+    }
+
+    // combine orbits: terms of the product of the orbit polynomials
+    std::map<std::vector<Index>, _BigUInt> combined;
+    combined[std::vector<Index>()] = _BigUInt(pair.second);
+    for (Index o = 0; o < n_orbits; ++o) {
+      std::map<std::vector<Index>, _BigUInt> next;
+      for (auto const &lhs : combined) {
+        for (auto const &rhs : polynomials[o]) {
+          std::vector<Index> key = lhs.first;
+          key.insert(key.end(), rhs.first.begin(), rhs.first.end());
+          next.emplace(std::move(key), lhs.second * rhs.second);
+        }
+      }
+      combined = std::move(next);
+    }
+    for (auto const &term : combined) {
+      composition_sums[term.first] += term.second;
+    }
+  }
+  for (auto &pair : composition_sums) {
+    if (pair.second.divide(std::uint32_t(result.group_order)) != 0) {
+      throw std::runtime_error(
+          "Error in count_distinct_occupations: inexact division");
+    }
+    result.by_composition.emplace(pair.first, pair.second.to_string());
+  }
+  return result;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,131 @@
+#include "casm/configuration/enumeration/enumerate_supercells.hh"
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/crystallography/CanonicalForm.hh"
+#include "casm/crystallography/SuperlatticeEnumerator.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Enumerate symmetrically distinct supercells, as transformation
+///     matrices to canonical superlattices
+///
+/// Notes:
+/// - Gives the same superlattices, in the same order, as iterating over
+///   `xtal::SuperlatticeEnumerator` and putting each superlattice in
+///   canonical form with `xtal::canonical::equivalent`, which is done by
+///   `libcasm.enumerate.ScelEnum.by_volume`. The result does not depend on
+///   `n_threads`.
+/// - The superlattice enumerator only yields hermite normal form
+///   superlattices that are not equivalent, by the prim point group, to a
+///   superlattice it yields earlier. Each volume is enumerated independently,
+///   so volumes are distributed over threads. Then superlattices are put in
+///   canonical form in parallel. No Supercell is constructed.
+/// - If `fixed_shape`, all volumes are enumerated together.
+///
+/// \param prim The prim
+/// \param max_volume The maximum volume superlattice to enumerate, relative
+///     to the unit cell.
+/// \param min_volume The minimum volume superlattice to enumerate, relative
+///     to the unit cell.
+/// \param dirs Which lattice vectors to enumerate over, some combination of
+///     'a', 'b', and 'c'.
+/// \param unit_cell Transformation matrix, `U`, of the unit cell used to
+///     generate superlattices of the form `S = (L * U) * T`.
+/// \param diagonal_only If true, restrict `T` to diagonal matrices.
+/// \param fixed_shape If true, restrict `T` to diagonal matrices with
+///     diagonal coefficients `[m, 1, 1]` (1d), `[m, m, 1]` (2d), or
+///     `[m, m, m]` (3d), where the dimension is `dirs.size()`.
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns The transformation matrices, `T`, relating the canonical
+///     superlattice vectors, `S`, to the prim lattice vectors, `L`,
+///     according to `S = L * T`.
+std::vector<Eigen::Matrix3l> enumerate_canonical_transformation_matrices(
+    std::shared_ptr<Prim const> const &prim, Index max_volume,
+    Index min_volume, std::string dirs, Eigen::Matrix3i const &unit_cell,
+    bool diagonal_only, bool fixed_shape, Index n_threads) {
+  throw_if_equal_to_nullptr(
+      prim,
+      "Error in enumerate_canonical_transformation_matrices: prim is empty");
+  Lattice const &prim_lattice = prim->basicstructure->lattice();
+  std::vector<xtal::SymOp> const &point_group =
+      prim->sym_info.point_group->element;
+
+  // volume ranges, [begin, end), enumerated independently
+  std::vector<std::pair<Index, Index>> volume_ranges;
+  if (fixed_shape) {
+    volume_ranges.emplace_back(min_volume, max_volume + 1);
+  } else {
+    for (Index volume = min_volume; volume <= max_volume; ++volume) {
+      volume_ranges.emplace_back(volume, volume + 1);
+    }
+  }
+
+  // larger volumes take longer, so ranges are assigned to threads in a
+  // strided pattern
+  Index n_ranges = volume_ranges.size();
+  std::vector<std::vector<Lattice>> superlattices_by_range(n_ranges);
+  Index n_workers = resolve_n_threads(n_threads, n_ranges);
+  parallel_for_chunks(n_workers, n_workers, [&](Index begin, Index end) {
+    for (Index worker = begin; worker < end; ++worker) {
+      for (Index i = worker; i < n_ranges; i += n_workers) {
+        xtal::ScelEnumProps enum_props{
+            volume_ranges[i].first, volume_ranges[i].second, dirs,
+            unit_cell,              diagonal_only,           fixed_shape};
+        xtal::SuperlatticeEnumerator enumerator{prim_lattice, point_group,
+                                                enum_props};
+        for (auto const &superlat : enumerator) {
+          superlattices_by_range[i].push_back(superlat);
+        }
+      }
+    }
+  });
+
+  std::vector<Lattice> superlattices;
+  for (auto &range_superlattices : superlattices_by_range) {
+    for (auto &superlat : range_superlattices) {
+      superlattices.push_back(std::move(superlat));
+    }
+  }
+
+  std::vector<Eigen::Matrix3l> result(superlattices.size());
+  parallel_for_chunks(
+      superlattices.size(), n_threads, [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          Lattice canonical_superlattice = xtal::canonical::equivalent(
+              superlattices[i], point_group, prim_lattice.tol());
+          result[i] = xtal::Superlattice(prim_lattice, canonical_superlattice)
+                          .transformation_matrix_to_super();
+        }
+      });
+  return result;
+}
+
+/// \brief Enumerate symmetrically distinct supercells, in canonical form
+///
+/// Equivalent to constructing shared supercells, with
+/// `make_shared_supercell`, from the results of
+/// `enumerate_canonical_transformation_matrices`. Supercells are
+/// constructed in parallel.
+std::vector<std::shared_ptr<Supercell const>> enumerate_canonical_supercells(
+    std::shared_ptr<Prim const> const &prim, Index max_volume,
+    Index min_volume, std::string dirs, Eigen::Matrix3i const &unit_cell,
+    bool diagonal_only, bool fixed_shape, Index n_threads) {
+  std::vector<Eigen::Matrix3l> T = enumerate_canonical_transformation_matrices(
+      prim, max_volume, min_volume, dirs, unit_cell, diagonal_only,
+      fixed_shape, n_threads);
+  std::vector<std::shared_ptr<Supercell const>> result(T.size());
+  parallel_for_chunks(T.size(), n_threads, [&](Index begin, Index end) {
+    for (Index i = begin; i < end; ++i) {
+      result[i] = make_shared_supercell(prim, T[i]);
+    }
+  });
+  return result;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -1,12 +1,21 @@
 #include "casm/configuration/enumeration/perturbations.hh"
 
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <tuple>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
 #include "casm/configuration/ConfigIsEquivalent.hh"
 #include "casm/configuration/Configuration.hh"
+#include "casm/configuration/PerturbationCanonicalizer.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/copy_configuration.hh"
 #include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
 #include "casm/configuration/enumeration/background_configuration.hh"
-#include "casm/configuration/group/orbits.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/configuration/perf.hh"
 #include "casm/configuration/sym_info/definitions.hh"
 
 // debug:
@@ -16,6 +25,170 @@
 namespace CASM {
 namespace config {
 
+namespace {
+
+/// \brief Sorted linear site indices of a cluster, stored inline if there
+///     are at most N sites
+///
+/// Clusters larger than N are stored in a heap buffer that is reused, so
+/// that no allocation happens for typical clusters. Clusters compare
+/// lexicographically, in the same order as the equivalent `std::set<Index>`.
+template <std::size_t N>
+class SmallSortedSites {
+ public:
+  SmallSortedSites() : m_size(0) {}
+
+  /// \brief Set to `perm` applied to `[begin, end)`, sorted in place
+  void assign_permuted(sym_info::Permutation const &perm, Index const *begin,
+                       Index const *end) {
+    m_size = end - begin;
+    if (m_size > Index(N)) {
+      m_heap.resize(m_size);
+    }
+    Index *sites = _data();
+    for (Index i = 0; i < m_size; ++i) {
+      Index value = perm[begin[i]];
+      Index j = i;
+      for (; j > 0 && sites[j - 1] > value; --j) {
+        sites[j] = sites[j - 1];
+      }
+      sites[j] = value;
+    }
+  }
+
+  Index const *begin() const { return _data(); }
+
+  Index const *end() const { return _data() + m_size; }
+
+  Index size() const { return m_size; }
+
+  bool operator<(SmallSortedSites const &other) const {
+    return std::lexicographical_compare(begin(), end(), other.begin(),
+                                        other.end());
+  }
+
+ private:
+  Index *_data() { return m_size > Index(N) ? m_heap.data() : m_inline.data(); }
+
+  Index const *_data() const {
+    return m_size > Index(N) ? m_heap.data() : m_inline.data();
+  }
+
+  Index m_size;
+  std::array<Index, N> m_inline;
+  std::vector<Index> m_heap;
+};
+
+typedef SmallSortedSites<8> ClusterSites;
+
+/// \brief Applies inverse permutations to clusters of linear site indices,
+///     reusing buffers
+class ClusterSitesCanonicalizer {
+ public:
+  ClusterSitesCanonicalizer() : m_best(0) {}
+
+  /// \brief Return the greatest of the clusters obtained by applying each
+  ///     of `[group_begin, group_end)` to `[begin, end)`
+  ClusterSites const &make_canonical(
+      std::vector<sym_info::Permutation>::const_iterator group_begin,
+      std::vector<sym_info::Permutation>::const_iterator group_end,
+      Index const *begin, Index const *end) {
+    m_best = 0;
+    m_buffers[0].assign_permuted(*group_begin++, begin, end);
+    for (; group_begin != group_end; ++group_begin) {
+      ClusterSites &test = m_buffers[1 - m_best];
+      test.assign_permuted(*group_begin, begin, end);
+      if (m_buffers[m_best] < test) {
+        m_best = 1 - m_best;
+      }
+    }
+    return m_buffers[m_best];
+  }
+
+ private:
+  /// The best so far is `m_buffers[m_best]`, the other is scratch
+  ClusterSites m_buffers[2];
+  int m_best;
+};
+
+/// \brief A hash set of clusters of linear site indices, stored in one flat
+///     buffer
+///
+/// Uses open addressing with linear probing. Inserting a cluster that is
+/// already present does not allocate.
+class FlatClusterSitesSet {
+ public:
+  FlatClusterSitesSet() : m_offsets(1, 0), m_table(16, -1) {}
+
+  /// \brief Insert the cluster `[begin, end)`; return true if it was new
+  bool insert(Index const *begin, Index const *end) {
+    std::size_t const mask = m_table.size() - 1;
+    std::size_t slot = _hash(begin, end) & mask;
+    while (m_table[slot] >= 0) {
+      if (_equal(m_table[slot], begin, end)) {
+        return false;
+      }
+      slot = (slot + 1) & mask;
+    }
+    m_table[slot] = m_offsets.size() - 1;
+    m_sites.insert(m_sites.end(), begin, end);
+    m_offsets.push_back(m_sites.size());
+    if (2 * (m_offsets.size() - 1) > m_table.size()) {
+      _rehash(2 * m_table.size());
+    }
+    return true;
+  }
+
+  /// \brief Copy the clusters into a sorted set
+  std::set<std::set<Index>> to_set() const {
+    std::set<std::set<Index>> result;
+    for (Index i = 0; i + 1 < Index(m_offsets.size()); ++i) {
+      result.emplace(m_sites.begin() + m_offsets[i],
+                     m_sites.begin() + m_offsets[i + 1]);
+    }
+    return result;
+  }
+
+ private:
+  static std::size_t _hash(Index const *begin, Index const *end) {
+    std::size_t h = 1469598103934665603ULL;
+    for (; begin != end; ++begin) {
+      h ^= static_cast<std::size_t>(*begin);
+      h *= 1099511628211ULL;
+    }
+    return h ^ (h >> 29);
+  }
+
+  bool _equal(Index i, Index const *begin, Index const *end) const {
+    Index n = m_offsets[i + 1] - m_offsets[i];
+    return n == end - begin &&
+           std::equal(begin, end, m_sites.begin() + m_offsets[i]);
+  }
+
+  void _rehash(std::size_t table_size) {
+    m_table.assign(table_size, -1);
+    std::size_t const mask = table_size - 1;
+    for (Index i = 0; i + 1 < Index(m_offsets.size()); ++i) {
+      Index const *begin = m_sites.data() + m_offsets[i];
+      Index const *end = m_sites.data() + m_offsets[i + 1];
+      std::size_t slot = _hash(begin, end) & mask;
+      while (m_table[slot] >= 0) {
+        slot = (slot + 1) & mask;
+      }
+      m_table[slot] = i;
+    }
+  }
+
+  /// Sites of all clusters, cluster `i` in `[m_offsets[i], m_offsets[i+1])`
+  std::vector<Index> m_sites;
+  std::vector<Index> m_offsets;
+
+  /// Cluster index by slot, or -1 if empty; size is a power of 2
+  std::vector<Index> m_table;
+};
+
+}  // namespace
+
 /// \brief Make the distinct clusters of sites, taking into account the
 ///     background configuration symmetry
 ///
@@ -25,38 +198,44 @@ namespace config {
 std::set<std::set<Index>> make_distinct_cluster_sites(
     Configuration const &background,
     std::vector<std::set<std::set<Index>>> const &orbits_as_indices) {
-  /// Inverse permutations can be used to transform
-  /// linear site indices.
-  auto copy_apply_f = [](sym_info::Permutation const &perm,
-                         std::set<Index> const &site_indices) {
-    std::set<Index> new_site_indices;
-    for (Index l : site_indices) {
-      new_site_indices.insert(perm[l]);
-    }
-    return new_site_indices;
-  };
+  return make_distinct_cluster_sites(
+      background, clust::make_flat_orbits_as_indices(orbits_as_indices));
+}
 
+/// \brief Make the distinct clusters of sites, taking into account the
+///     background configuration symmetry
+///
+/// \param background, The background
+/// \param orbits_as_indices, The orbits in the infinite crystal,
+///     converted to linear supercell site indices.
+std::set<std::set<Index>> make_distinct_cluster_sites(
+    Configuration const &background,
+    clust::OrbitsAsIndices const &orbits_as_indices) {
   /// Find the background factor group, and store the inverse permutations
-  /// because they are the rep that transforms site indices.
-  std::vector<SupercellSymOp> background_fg_op;
+  /// because they are the rep that transforms site indices. Operations are
+  /// kept as SupercellSymOpRef, so products and comparisons below do not copy
+  /// the supercell shared_ptr.
+  std::vector<SupercellSymOpRef> background_fg_op;
   std::vector<sym_info::Permutation> indices_group_rep;
-  ConfigIsEquivalent is_background_invariant(background);
   auto begin = SupercellSymOp::begin(background.supercell);
   auto end = SupercellSymOp::end(background.supercell);
-  for (auto it = begin; it != end; ++it) {
-    if (is_background_invariant(*it)) {
-      background_fg_op.push_back(it);
-      indices_group_rep.push_back(sym_info::inverse(it->combined_permute()));
-    }
-  }
+  visit_config_is_equivalent(
+      background, [&](auto const &is_background_invariant) {
+        for (auto it = begin; it != end; ++it) {
+          if (is_background_invariant(*it)) {
+            background_fg_op.push_back(it.ref());
+            indices_group_rep.push_back(it->inverse_combined_permute());
+          }
+        }
+      });
 
   /// Find supercell factor group operations that might create distinct
   /// sub-orbits by finding canonical operations with respect to the background
   /// configuration factor group.
   /// (An element of each coset of the background factor group).
-  auto is_possible_suborbit_generating_op = [&](SupercellSymOp const &it) {
-    for (auto background_fg_it : background_fg_op) {
-      if (background_fg_it * it > it) {
+  auto is_possible_suborbit_generating_op = [&](SupercellSymOpRef const &op) {
+    for (SupercellSymOpRef const &background_fg_op_ref : background_fg_op) {
+      if (background_fg_op_ref * op > op) {
         return false;
       }
     }
@@ -64,9 +243,9 @@ std::set<std::set<Index>> make_distinct_cluster_sites(
   };
   std::vector<sym_info::Permutation> possible_suborbit_generating_indices_rep;
   for (auto it = begin; it != end; ++it) {
-    if (is_possible_suborbit_generating_op(it)) {
+    if (is_possible_suborbit_generating_op(it.ref())) {
       possible_suborbit_generating_indices_rep.push_back(
-          sym_info::inverse(it->combined_permute()));
+          it->inverse_combined_permute());
     }
   }
 
@@ -80,39 +259,217 @@ std::set<std::set<Index>> make_distinct_cluster_sites(
   /// The resulting clusters are the distinct clusters, taking into account
   /// background configuration and supercell periodic boundary conditions
 
-  std::set<std::set<Index>> distinct_cluster_sites;
-  for (auto const &orbit : orbits_as_indices) {
-    for (auto const &cluster : orbit) {
-      for (auto const &rep : possible_suborbit_generating_indices_rep) {
-        auto suborbit_element = copy_apply_f(rep, cluster);
-        distinct_cluster_sites.emplace(group::make_canonical_element(
-            suborbit_element, indices_group_rep.begin(),
-            indices_group_rep.end(), std::less<std::set<Index>>(),
-            copy_apply_f));
-      }
+  FlatClusterSitesSet distinct;
+  ClusterSitesCanonicalizer canonicalizer;
+  ClusterSites suborbit_element;
+  for (Index j = 0; j < orbits_as_indices.n_clusters(); ++j) {
+    for (auto const &rep : possible_suborbit_generating_indices_rep) {
+      suborbit_element.assign_permuted(rep, orbits_as_indices.cluster_begin(j),
+                                       orbits_as_indices.cluster_end(j));
+      ClusterSites const &canonical = canonicalizer.make_canonical(
+          indices_group_rep.begin(), indices_group_rep.end(),
+          suborbit_element.begin(), suborbit_element.end());
+      distinct.insert(canonical.begin(), canonical.end());
     }
   }
-  return distinct_cluster_sites;
+  return distinct.to_set();
 }
 
 /// \brief Make configurations that are distinct occupation perturbations
+///
+/// \param background, The background
+/// \param distinct_cluster_sites, Linear site indices of the clusters on
+///     which occupations are enumerated
+/// \param n_threads Number of threads. Clusters are taken in turn by each
+///     thread. If `n_threads <= 0`, use the number of threads set by
+///     `set_num_threads`. The result does not depend on the number of threads.
+///
+/// Each perturbation is canonicalized with a PerturbationCanonicalizer, which
+/// compares only the images of the cluster sites within each coset of the
+/// background invariant subgroup.
 std::set<Configuration> make_distinct_perturbations(
     Configuration const &background,
-    std::set<std::set<Index>> const &distinct_cluster_sites) {
+    std::set<std::set<Index>> const &distinct_cluster_sites, Index n_threads) {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(make_distinct_perturbations);
+  PerturbationCanonicalizer canonicalizer(
+      std::make_shared<CanonicalFormEngine const>(background.supercell),
+      background);
+  std::vector<std::set<Index> const *> work;
+  for (auto const &cluster_sites : distinct_cluster_sites) {
+    work.push_back(&cluster_sites);
+  }
+  std::vector<std::set<Configuration>> thread_results(
+      resolve_n_threads(n_threads, work.size()));
+  parallel_for_items(work.size(), n_threads, [&](Index t, Index i) {
+    ConfigEnumAllOccupations enumerator(background, *work[i]);
+    while (enumerator.is_valid()) {
+      thread_results[t].emplace(
+          canonicalizer.make_canonical_form(enumerator.value(), *work[i]));
+      enumerator.advance();
+    }
+  });
   std::set<Configuration> distinct_perturbations;
-  auto begin = SupercellSymOp::begin(background.supercell);
-  auto end = SupercellSymOp::end(background.supercell);
+  for (auto &result : thread_results) {
+    distinct_perturbations.merge(result);
+  }
+  return distinct_perturbations;
+}
+
+/// \brief Make configurations that are distinct occupation perturbations,
+///     collected in a ConfigurationHashSet
+///
+/// Gives the same configurations as `make_distinct_perturbations`, but
+/// collects them with hashed lookup rather than ordered insertion.
+///
+/// \returns The distinct perturbations, in order of the cluster sites in
+///     `distinct_cluster_sites` and then in enumeration order. The result
+///     does not depend on `n_threads`.
+ConfigurationHashSet make_distinct_perturbations_hash_set(
+    Configuration const &background,
+    std::set<std::set<Index>> const &distinct_cluster_sites, Index n_threads) {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(make_distinct_perturbations);
+  PerturbationCanonicalizer canonicalizer(
+      std::make_shared<CanonicalFormEngine const>(background.supercell),
+      background);
+  std::vector<std::set<Index> const *> work;
   for (auto const &cluster_sites : distinct_cluster_sites) {
-    ConfigEnumAllOccupations enumerator(background, cluster_sites);
+    work.push_back(&cluster_sites);
+  }
+  std::vector<ConfigurationHashSet> item_results(work.size());
+  parallel_for_items(work.size(), n_threads, [&](Index i) {
+    ConfigEnumAllOccupations enumerator(background, *work[i]);
     while (enumerator.is_valid()) {
-      distinct_perturbations.emplace(
-          make_canonical_form(enumerator.value(), begin, end));
+      item_results[i].insert(
+          canonicalizer.make_canonical_form(enumerator.value(), *work[i]));
       enumerator.advance();
     }
+  });
+  ConfigurationHashSet distinct_perturbations;
+  for (auto const &result : item_results) {
+    distinct_perturbations.merge(result);
   }
   return distinct_perturbations;
 }
 
+/// \brief Insert configurations that are distinct occupation perturbations
+///     into a PerturbationDeltaSet
+///
+/// Gives the same configurations as `make_distinct_perturbations`, but each
+/// is stored only as its occupation change relative to the background, and
+/// may be written to disk if `distinct_perturbations` has a memory budget.
+///
+/// \param background, The background. Must be the background of
+///     `distinct_perturbations`.
+/// \param distinct_cluster_sites, Linear site indices of the clusters on
+///     which occupations are enumerated
+/// \param distinct_perturbations The set the canonical perturbations are
+///     inserted into
+void insert_distinct_perturbations(
+    Configuration const &background,
+    std::set<std::set<Index>> const &distinct_cluster_sites,
+    PerturbationDeltaSet &distinct_perturbations) {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(make_distinct_perturbations);
+  PerturbationCanonicalizer canonicalizer(
+      std::make_shared<CanonicalFormEngine const>(background.supercell),
+      background);
+  for (auto const &cluster_sites : distinct_cluster_sites) {
+    ConfigEnumAllOccupations enumerator(background, cluster_sites);
+    while (enumerator.is_valid()) {
+      distinct_perturbations.insert(
+          canonicalizer.make_canonical_form(enumerator.value(), cluster_sites));
+      enumerator.advance();
+    }
+  }
+}
+
+/// \brief Make configurations that are distinct occupation perturbations of
+///     every distinct background that a motif generates in a supercell
+///
+/// Gives the same result as calling `make_distinct_cluster_sites` and
+/// `make_distinct_perturbations` for the first configuration of each subset
+/// from `make_all_super_configurations_by_subsets(motif, supercell)`, and
+/// merging the results.
+///
+/// Method:
+/// - Backgrounds, their PerturbationCanonicalizer, and their distinct
+///   cluster sites are made in parallel, one background per item.
+/// - The work is then split into one item per (background, cluster sites)
+///   pair, so a background with many small clusters and one large cluster
+///   does not hold up other threads. Items are sorted by decreasing number
+///   of occupations to enumerate, and threads take items in turn from a
+///   shared counter (`parallel_for_items`) so the largest items start first
+///   and the remaining items fill in around them.
+/// - Each thread collects results in its own set, and the sets are merged at
+///   the end, so the result does not depend on the number of threads.
+///
+/// \param supercell The supercell
+/// \param motif Used to generate the distinct background configurations
+/// \param orbits Prim periodic cluster orbits, generated without
+///     consideration of the background configuration symmetry
+/// \param n_threads Number of threads. If `n_threads <= 0`, use the number of
+///     threads set by `set_num_threads`.
+std::set<Configuration> make_all_distinct_periodic_perturbations(
+    std::shared_ptr<Supercell const> const &supercell,
+    Configuration const &motif,
+    std::vector<std::set<clust::IntegralCluster>> const &orbits,
+    Index n_threads) {
+  CASM_CONFIGURATION_PERF_SCOPED_TIMER(make_distinct_perturbations);
+  auto orbits_as_indices = clust::make_flat_orbits_as_indices(
+      orbits, supercell->unitcellcoord_index_converter);
+  std::vector<Configuration> backgrounds;
+  for (auto const &subset :
+       make_all_super_configurations_by_subsets(motif, supercell)) {
+    backgrounds.push_back(subset[0]);
+  }
+
+  auto engine = std::make_shared<CanonicalFormEngine const>(supercell);
+  std::vector<std::unique_ptr<PerturbationCanonicalizer>> canonicalizers(
+      backgrounds.size());
+  std::vector<std::set<std::set<Index>>> distinct_cluster_sites(
+      backgrounds.size());
+  parallel_for_items(backgrounds.size(), n_threads, [&](Index i) {
+    canonicalizers[i] =
+        std::make_unique<PerturbationCanonicalizer>(engine, backgrounds[i]);
+    distinct_cluster_sites[i] =
+        make_distinct_cluster_sites(backgrounds[i], orbits_as_indices);
+  });
+
+  // (number of occupations, background index, cluster sites)
+  std::vector<std::tuple<double, Index, std::set<Index> const *>> work;
+  auto const &basis = supercell->prim->basicstructure->basis();
+  auto const &converter = supercell->unitcellcoord_index_converter;
+  for (Index i = 0; i < backgrounds.size(); ++i) {
+    for (auto const &cluster_sites : distinct_cluster_sites[i]) {
+      double n_occupations = 1.0;
+      for (Index l : cluster_sites) {
+        n_occupations *= basis[converter(l).sublattice()].occupant_dof().size();
+      }
+      work.emplace_back(n_occupations, i, &cluster_sites);
+    }
+  }
+  std::stable_sort(work.begin(), work.end(), [](auto const &a, auto const &b) {
+    return std::get<0>(a) > std::get<0>(b);
+  });
+
+  std::vector<std::set<Configuration>> thread_results(
+      resolve_n_threads(n_threads, work.size()));
+  parallel_for_items(work.size(), n_threads, [&](Index t, Index k) {
+    Index i = std::get<1>(work[k]);
+    std::set<Index> const &cluster_sites = *std::get<2>(work[k]);
+    ConfigEnumAllOccupations enumerator(backgrounds[i], cluster_sites);
+    while (enumerator.is_valid()) {
+      thread_results[t].emplace(canonicalizers[i]->make_canonical_form(
+          enumerator.value(), cluster_sites));
+      enumerator.advance();
+    }
+  });
+  std::set<Configuration> all;
+  for (auto &result : thread_results) {
+    all.merge(result);
+  }
+  return all;
+}
+
 /// \brief Make the distinct clusters of sites, taking into account the
 ///     event group, supercell, and background configuration symmetry
 ///
@@ -131,6 +488,57 @@ std::set<std::set<Index>> make_distinct_local_cluster_sites(
     std::vector<int> const &occ_init, std::vector<int> const &occ_final,
     std::vector<SupercellSymOp> const &event_group,
     std::vector<std::set<std::set<Index>>> const &local_orbits_as_indices) {
+  return make_distinct_local_cluster_sites(
+      background, event_sites, occ_init, occ_final, event_group,
+      clust::make_flat_orbits_as_indices(local_orbits_as_indices));
+}
+
+/// \brief Make the distinct clusters of sites, taking into account the
+///     event group, supercell, and background configuration symmetry
+///
+/// \param background, The background
+/// \param event_sites Linear sites indices of the cluster of sites that
+///     change during the event
+/// \param occ_init Initial occupation on sites
+/// \param occ_final Final occupation on sites
+/// \param event_group The SupercellSymOp consistent with
+///     the supercell of the background configuration that leave the
+///     event invariant
+/// \param local_orbits_as_indices, The local orbits in the infinite crystal,
+///     converted to linear supercell site indices
+std::set<std::set<Index>> make_distinct_local_cluster_sites(
+    Configuration const &background, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group,
+    clust::OrbitsAsIndices const &local_orbits_as_indices) {
+  return make_distinct_local_cluster_sites(
+      make_local_cluster_sites_group_rep(background, event_sites, occ_init,
+                                         occ_final, event_group),
+      local_orbits_as_indices);
+}
+
+/// \brief Make the site index permutations that transform clusters of sites
+///     while leaving the background configuration and event invariant
+///
+/// \param background, The background
+/// \param event_sites Linear sites indices of the cluster of sites that
+///     change during the event
+/// \param occ_init Initial occupation on sites
+/// \param occ_final Final occupation on sites
+/// \param event_group The SupercellSymOp consistent with
+///     the supercell of the background configuration that leave the
+///     event invariant
+///
+/// \returns indices_group_rep The inverse combined permutations of the
+///     operations in `event_group` that leave the background configuration
+///     with the event applied invariant, either with the initial and final
+///     occupation unchanged or interchanged. Applying
+///     `indices_group_rep[i][l]` to each linear site index `l` of a cluster
+///     transforms it.
+std::vector<sym_info::Permutation> make_local_cluster_sites_group_rep(
+    Configuration const &background, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group) {
   /// Inverse permutations can be used to transform
   /// linear site indices.
   /// Keep only event group operations that also keep
@@ -147,33 +555,37 @@ std::set<std::set<Index>> make_distinct_local_cluster_sites(
     Configuration B = copy_apply(op, config_final);
     if ((A == config_init && B == config_final) ||
         (B == config_init && A == config_final)) {
-      indices_group_rep.push_back(sym_info::inverse(op.combined_permute()));
+      indices_group_rep.push_back(op.inverse_combined_permute());
     }
   }
-  auto copy_apply_f = [](sym_info::Permutation const &perm,
-                         std::set<Index> const &site_indices) {
-    std::set<Index> new_site_indices;
-    for (Index l : site_indices) {
-      new_site_indices.insert(perm[l]);
-    }
-    return new_site_indices;
-  };
+  return indices_group_rep;
+}
 
+/// \brief Make the distinct clusters of sites, given the site index
+///     permutations that leave the background configuration and event
+///     invariant
+///
+/// \param indices_group_rep Site index permutations, as from
+///     `make_local_cluster_sites_group_rep`. Must not be empty.
+/// \param local_orbits_as_indices, The local orbits in the infinite crystal,
+///     converted to linear supercell site indices
+std::set<std::set<Index>> make_distinct_local_cluster_sites(
+    std::vector<sym_info::Permutation> const &indices_group_rep,
+    clust::OrbitsAsIndices const &local_orbits_as_indices) {
   /// Generate new orbit generators.
   /// A generator is the canonical element from an orbit.
   /// These will take into account background configuration and
   /// supercell periodic boundary conditions
-  std::set<std::set<Index>> distinct_local_cluster_sites;
-  for (auto const &orbit : local_orbits_as_indices) {
-    std::set<std::set<Index>> tmp = group::make_orbit_generators(
-        orbit, indices_group_rep.begin(), indices_group_rep.end(),
-        std::less<std::set<Index>>(), copy_apply_f);
-    for (auto const &local_cluster_sites : tmp) {
-      distinct_local_cluster_sites.insert(local_cluster_sites);
-    }
+  FlatClusterSitesSet distinct;
+  ClusterSitesCanonicalizer canonicalizer;
+  for (Index j = 0; j < local_orbits_as_indices.n_clusters(); ++j) {
+    ClusterSites const &canonical = canonicalizer.make_canonical(
+        indices_group_rep.begin(), indices_group_rep.end(),
+        local_orbits_as_indices.cluster_begin(j),
+        local_orbits_as_indices.cluster_end(j));
+    distinct.insert(canonical.begin(), canonical.end());
   }
-
-  return distinct_local_cluster_sites;
+  return distinct.to_set();
 }
 
 /// \brief Make configurations that are distinct local occupation perturbations
@@ -193,17 +605,82 @@ std::set<Configuration> make_distinct_local_perturbations(
     std::vector<int> const &occ_init, std::vector<int> const &occ_final,
     std::vector<SupercellSymOp> const &event_group,
     std::set<std::set<Index>> const &distinct_local_cluster_sites) {
+  LocalPerturbationCanonicalizer canonicalizer(
+      std::make_shared<CanonicalFormEngine const>(background.supercell,
+                                                  event_group),
+      background, event_sites, occ_init, occ_final);
   std::set<Configuration> distinct_local_perturbations;
   for (auto const &local_cluster_sites : distinct_local_cluster_sites) {
     ConfigEnumAllOccupations enumerator(background, local_cluster_sites);
     while (enumerator.is_valid()) {
-      distinct_local_perturbations.emplace(make_canonical_form(
-          enumerator.value(), event_sites, occ_init, occ_final, event_group));
+      distinct_local_perturbations.emplace(canonicalizer.make_canonical_form(
+          enumerator.value(), local_cluster_sites));
       enumerator.advance();
     }
   }
   return distinct_local_perturbations;
 }
 
+/// \brief Make configurations that are distinct local occupation
+///     perturbations, collected in a ConfigurationHashSet
+///
+/// Gives the same configurations as `make_distinct_local_perturbations`, in
+/// order of the local cluster sites in `distinct_local_cluster_sites` and
+/// then in enumeration order, but collects them with hashed lookup rather
+/// than ordered insertion.
+ConfigurationHashSet make_distinct_local_perturbations_hash_set(
+    Configuration const &background, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group,
+    std::set<std::set<Index>> const &distinct_local_cluster_sites) {
+  LocalPerturbationCanonicalizer canonicalizer(
+      std::make_shared<CanonicalFormEngine const>(background.supercell,
+                                                  event_group),
+      background, event_sites, occ_init, occ_final);
+  ConfigurationHashSet distinct_local_perturbations;
+  for (auto const &local_cluster_sites : distinct_local_cluster_sites) {
+    ConfigEnumAllOccupations enumerator(background, local_cluster_sites);
+    while (enumerator.is_valid()) {
+      distinct_local_perturbations.insert(canonicalizer.make_canonical_form(
+          enumerator.value(), local_cluster_sites));
+      enumerator.advance();
+    }
+  }
+  return distinct_local_perturbations;
+}
+
+/// \brief Insert configurations that are distinct local occupation
+///     perturbations into a PerturbationDeltaSet
+///
+/// Gives the same configurations as `make_distinct_local_perturbations`, but
+/// each is stored only as its occupation change relative to the background,
+/// and may be written to disk if `distinct_local_perturbations` has a memory
+/// budget.
+///
+/// \param distinct_local_perturbations The set the canonical local
+///     perturbations are inserted into. Its background must be
+///     `background`.
+///
+/// Other parameters are as for `make_distinct_local_perturbations`.
+void insert_distinct_local_perturbations(
+    Configuration const &background, std::vector<Index> const &event_sites,
+    std::vector<int> const &occ_init, std::vector<int> const &occ_final,
+    std::vector<SupercellSymOp> const &event_group,
+    std::set<std::set<Index>> const &distinct_local_cluster_sites,
+    PerturbationDeltaSet &distinct_local_perturbations) {
+  LocalPerturbationCanonicalizer canonicalizer(
+      std::make_shared<CanonicalFormEngine const>(background.supercell,
+                                                  event_group),
+      background, event_sites, occ_init, occ_final);
+  for (auto const &local_cluster_sites : distinct_local_cluster_sites) {
+    ConfigEnumAllOccupations enumerator(background, local_cluster_sites);
+    while (enumerator.is_valid()) {
+      distinct_local_perturbations.insert(canonicalizer.make_canonical_form(
+          enumerator.value(), local_cluster_sites));
+      enumerator.advance();
+    }
+  }
+}
+
 }  // namespace config
 }  // namespace CASM
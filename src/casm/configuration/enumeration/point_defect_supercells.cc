@@ -0,0 +1,464 @@
+#include "casm/configuration/enumeration/point_defect_supercells.hh"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <set>
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/Lattice.hh"
+#include "casm/crystallography/SymTools.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+Lattice _make_superlattice(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  Lattice const &prim_lattice = prim->basicstructure->lattice();
+  return Lattice(prim_lattice.lat_column_mat() *
+                     transformation_matrix_to_super.cast<double>(),
+                 prim_lattice.tol());
+}
+
+double _voronoi_inner_radius_bound(Lattice const &superlattice) {
+  Eigen::Matrix3d R = superlattice.reduced_cell().lat_column_mat();
+  return 0.5 * R.colwise().norm().minCoeff();
+}
+
+Index _n_unitcells(Eigen::Matrix3l const &transformation_matrix_to_super) {
+  return std::abs(transformation_matrix_to_super.determinant());
+}
+
+/// \brief Integer adjugate, `adj(T) = det(T) * T^-1`
+Eigen::Matrix3l _adjugate(Eigen::Matrix3l const &T) {
+  Eigen::Matrix3l adj;
+  for (Index i = 0; i < 3; ++i) {
+    for (Index j = 0; j < 3; ++j) {
+      Index r0 = (j + 1) % 3, r1 = (j + 2) % 3;
+      Index c0 = (i + 1) % 3, c1 = (i + 2) % 3;
+      adj(i, j) = T(r0, c0) * T(r1, c1) - T(r0, c1) * T(r1, c0);
+    }
+  }
+  return adj;
+}
+
+/// \brief Integer matrix, R, of a prim factor group operation in the basis
+///     of the prim lattice vectors, `op.matrix * L == L * R`
+Eigen::Matrix3l _make_integral_matrix(Lattice const &prim_lattice,
+                                      SymOp const &op) {
+  Eigen::Matrix3d R = prim_lattice.inv_lat_column_mat() * op.matrix *
+                      prim_lattice.lat_column_mat();
+  return R.array().round().matrix().cast<long>();
+}
+
+/// \brief Return true if all elements of `M` are divisible by `n`
+bool _is_divisible(Eigen::Matrix3l const &M, long n) {
+  for (Index i = 0; i < 9; ++i) {
+    if (M(i) % n != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Return true if the superlattice is left invariant by each of the
+///     required operations, given integer matrices of the prim factor group
+///
+/// The superlattice `S = L * T` is invariant under `R` if and only if
+/// `T^-1 * R * T` is an integer matrix, which is checked exactly as
+/// `adj(T) * R * T == 0 (mod det(T))`.
+bool _has_required_operations(
+    std::vector<Eigen::Matrix3l> const &integral_factor_group,
+    Eigen::Matrix3l const &T, std::vector<Index> const &required_operations) {
+  Eigen::Matrix3l adj = _adjugate(T);
+  long det = std::abs(T.determinant());
+  for (Index i : required_operations) {
+    if (!_is_divisible(adj * integral_factor_group[i] * T, det)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<Eigen::Matrix3l> _make_integral_factor_group(
+    Prim const &prim, std::vector<Index> const &required_operations,
+    std::string const &method) {
+  auto const &factor_group = prim.sym_info.factor_group->element;
+  for (Index i : required_operations) {
+    if (i < 0 || i >= Index(factor_group.size())) {
+      throw std::runtime_error("Error in " + method +
+                               ": required operation index out of range");
+    }
+  }
+  Lattice const &prim_lattice = prim.basicstructure->lattice();
+  std::vector<Eigen::Matrix3l> result;
+  for (SymOp const &op : factor_group) {
+    result.push_back(_make_integral_matrix(prim_lattice, op));
+  }
+  return result;
+}
+
+}  // namespace
+
+/// \brief Return an upper bound on the superlattice Voronoi inner radius
+///
+/// The Voronoi inner radius is half the length of the shortest lattice
+/// vector, so half the length of the shortest vector of any basis, here the
+/// reduced cell, is an upper bound. This is much cheaper than the Voronoi
+/// inner radius itself.
+double point_defect_voronoi_inner_radius_bound(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  return _voronoi_inner_radius_bound(
+      _make_superlattice(prim, transformation_matrix_to_super));
+}
+
+/// \brief Score a superlattice for point defect calculations
+///
+/// The supercell factor group size is the number of prim factor group
+/// operations that leave the superlattice invariant, so it is found without
+/// constructing a Supercell.
+PointDefectSuperlatticeScore make_point_defect_superlattice_score(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  Lattice superlattice =
+      _make_superlattice(prim, transformation_matrix_to_super);
+  PointDefectSuperlatticeScore score;
+  score.transformation_matrix_to_super = transformation_matrix_to_super;
+  score.n_unitcells = _n_unitcells(transformation_matrix_to_super);
+  score.factor_group_size =
+      xtal::invariant_subgroup_indices(superlattice,
+                                       prim->sym_info.factor_group->element)
+          .size();
+  score.voronoi_inner_radius = superlattice.inner_voronoi_radius();
+  return score;
+}
+
+/// \brief Score superlattices for point defect calculations, in parallel
+///
+/// \param prim The prim
+/// \param transformation_matrices Transformation matrices, `T`, of the
+///     superlattices to score, such that `S = L * T`
+/// \param min_factor_group_size Superlattices with a smaller supercell factor
+///     group are excluded
+/// \param min_voronoi_inner_radius Superlattices with a smaller Voronoi inner
+///     radius are excluded. The cheap upper bound is checked first, so most
+///     of these are excluded without finding their factor group.
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns Scores of the superlattices that are not excluded, in the
+///     order of `transformation_matrices`. The result does not depend on
+///     `n_threads`.
+std::vector<PointDefectSuperlatticeScore>
+make_point_defect_superlattice_scores(
+    std::shared_ptr<Prim const> const &prim,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices,
+    Index min_factor_group_size, double min_voronoi_inner_radius,
+    Index n_threads) {
+  throw_if_equal_to_nullptr(
+      prim, "Error in make_point_defect_superlattice_scores: prim is empty");
+  Index n = transformation_matrices.size();
+  std::vector<PointDefectSuperlatticeScore> scores(n);
+  std::vector<char> is_included(n, 0);
+  parallel_for_items(n, n_threads, [&](Index i) {
+    Eigen::Matrix3l const &T = transformation_matrices[i];
+    if (min_voronoi_inner_radius > 0.0 &&
+        point_defect_voronoi_inner_radius_bound(prim, T) <
+            min_voronoi_inner_radius) {
+      return;
+    }
+    PointDefectSuperlatticeScore score =
+        make_point_defect_superlattice_score(prim, T);
+    if (score.factor_group_size < min_factor_group_size ||
+        score.voronoi_inner_radius < min_voronoi_inner_radius) {
+      return;
+    }
+    scores[i] = score;
+    is_included[i] = 1;
+  });
+
+  std::vector<PointDefectSuperlatticeScore> result;
+  for (Index i = 0; i < n; ++i) {
+    if (is_included[i]) {
+      result.push_back(scores[i]);
+    }
+  }
+  return result;
+}
+
+/// \brief Return the indices of Pareto-optimal points, maximizing Voronoi
+///     inner radius and minimizing number of unit cells
+///
+/// Point `i` is Pareto-optimal if `is_candidate[i]`, and for every other
+/// point `j`, of any candidacy:
+/// - if `n_unitcells[j] < n_unitcells[i]`, then
+///   `voronoi_inner_radius[i] >= voronoi_inner_radius[j] + tol`, and
+/// - if `n_unitcells[j] == n_unitcells[i]`, then
+///   `voronoi_inner_radius[j] <= voronoi_inner_radius[i] + tol`.
+///
+/// Points are sorted by number of unit cells, so this is O(n log(n)).
+///
+/// \returns Indices of the Pareto-optimal points, in increasing order
+std::vector<Index> make_point_defect_pareto_indices(
+    std::vector<Index> const &n_unitcells,
+    std::vector<double> const &voronoi_inner_radius,
+    std::vector<bool> const &is_candidate, double tol) {
+  Index n = n_unitcells.size();
+  if (Index(voronoi_inner_radius.size()) != n ||
+      Index(is_candidate.size()) != n) {
+    throw std::runtime_error(
+        "Error in make_point_defect_pareto_indices: size mismatch");
+  }
+  std::vector<Index> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](Index a, Index b) {
+    return n_unitcells[a] < n_unitcells[b];
+  });
+
+  std::vector<Index> result;
+  double prefix_max = -std::numeric_limits<double>::infinity();
+  auto group_begin = order.begin();
+  while (group_begin != order.end()) {
+    auto group_end = group_begin;
+    double group_max = -std::numeric_limits<double>::infinity();
+    while (group_end != order.end() &&
+           n_unitcells[*group_end] == n_unitcells[*group_begin]) {
+      group_max = std::max(group_max, voronoi_inner_radius[*group_end]);
+      ++group_end;
+    }
+    for (auto it = group_begin; it != group_end; ++it) {
+      double r = voronoi_inner_radius[*it];
+      if (is_candidate[*it] && r >= prefix_max + tol && group_max <= r + tol) {
+        result.push_back(*it);
+      }
+    }
+    prefix_max = std::max(prefix_max, group_max);
+    group_begin = group_end;
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/// \brief Find the Pareto-optimal superlattices for point defect
+///     calculations
+///
+/// Gives the same result as scoring all superlattices with
+/// `make_point_defect_superlattice_scores` and then finding the
+/// Pareto-optimal scores with `make_point_defect_pareto_indices`, but
+/// superlattices are considered in order of increasing volume and a
+/// superlattice is rejected using only the cheap upper bound on its Voronoi
+/// inner radius if the bound is not larger than the Voronoi inner radius of
+/// a smaller superlattice already scored.
+///
+/// \param prim The prim
+/// \param transformation_matrices Transformation matrices, `T`, of the
+///     superlattices to consider, such that `S = L * T`
+/// \param min_factor_group_size Superlattices with a smaller supercell factor
+///     group are excluded
+/// \param min_voronoi_inner_radius Superlattices with a smaller Voronoi inner
+///     radius are excluded
+/// \param tol Tolerance for comparing Voronoi inner radius
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns Scores of the Pareto-optimal superlattices, sorted by number of
+///     unit cells, and otherwise in the order of `transformation_matrices`.
+///     The result does not depend on `n_threads`.
+std::vector<PointDefectSuperlatticeScore>
+find_pareto_point_defect_superlattices(
+    std::shared_ptr<Prim const> const &prim,
+    std::vector<Eigen::Matrix3l> const &transformation_matrices,
+    Index min_factor_group_size, double min_voronoi_inner_radius, double tol,
+    Index n_threads) {
+  throw_if_equal_to_nullptr(
+      prim, "Error in find_pareto_point_defect_superlattices: prim is empty");
+  Index n = transformation_matrices.size();
+  std::vector<Index> n_unitcells(n);
+  std::vector<double> bound(n);
+  parallel_for_items(n, n_threads, [&](Index i) {
+    n_unitcells[i] = _n_unitcells(transformation_matrices[i]);
+    bound[i] = point_defect_voronoi_inner_radius_bound(
+        prim, transformation_matrices[i]);
+  });
+  std::vector<Index> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](Index a, Index b) {
+    return n_unitcells[a] < n_unitcells[b];
+  });
+
+  std::vector<PointDefectSuperlatticeScore> result;
+  std::vector<PointDefectSuperlatticeScore> scores(n);
+  std::vector<char> is_included(n, 0);
+  double prefix_max = -std::numeric_limits<double>::infinity();
+  Index group_begin = 0;
+  while (group_begin < n) {
+    Index group_end = group_begin;
+    while (group_end < n &&
+           n_unitcells[order[group_end]] == n_unitcells[order[group_begin]]) {
+      ++group_end;
+    }
+
+    // A superlattice with radius <= prefix_max is neither optimal nor
+    // changes prefix_max, so it is rejected using the bound if possible
+    parallel_for_items(group_end - group_begin, n_threads, [&](Index k) {
+      Index i = order[group_begin + k];
+      if (bound[i] < min_voronoi_inner_radius || bound[i] <= prefix_max) {
+        return;
+      }
+      PointDefectSuperlatticeScore score =
+          make_point_defect_superlattice_score(prim,
+                                               transformation_matrices[i]);
+      if (score.factor_group_size < min_factor_group_size ||
+          score.voronoi_inner_radius < min_voronoi_inner_radius) {
+        return;
+      }
+      scores[i] = score;
+      is_included[i] = 1;
+    });
+
+    double group_max = -std::numeric_limits<double>::infinity();
+    for (Index k = group_begin; k < group_end; ++k) {
+      if (is_included[order[k]]) {
+        group_max = std::max(group_max, scores[order[k]].voronoi_inner_radius);
+      }
+    }
+    for (Index k = group_begin; k < group_end; ++k) {
+      Index i = order[k];
+      if (!is_included[i]) {
+        continue;
+      }
+      double r = scores[i].voronoi_inner_radius;
+      if (r >= prefix_max + tol && group_max <= r + tol) {
+        result.push_back(scores[i]);
+      }
+    }
+    prefix_max = std::max(prefix_max, group_max);
+    group_begin = group_end;
+  }
+  return result;
+}
+
+/// \brief Return true if a superlattice is left invariant by each of the
+///     required prim factor group operations
+///
+/// \param prim The prim
+/// \param transformation_matrix_to_super The transformation matrix, T, of
+///     the superlattice, `S = L * T`
+/// \param required_operations Indices of prim factor group operations
+///
+/// Equivalent to checking that `required_operations` is a subset of
+/// `make_superlattice_invariant_factor_group_indices(prim, T)`, but each
+/// operation is checked with integer arithmetic only.
+bool has_required_operations(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super,
+    std::vector<Index> const &required_operations) {
+  std::string method = "has_required_operations";
+  throw_if_equal_to_nullptr(prim, "Error in " + method + ": prim is empty");
+  return _has_required_operations(
+      _make_integral_factor_group(*prim, required_operations, method),
+      transformation_matrix_to_super, required_operations);
+}
+
+/// \brief Return true if a superlattice has each set of required sites
+///     without periodic image overlap
+///
+/// \param prim The prim
+/// \param transformation_matrix_to_super The transformation matrix, T, of
+///     the superlattice, `S = L * T`
+/// \param required_sites Sets of required sites
+///
+/// Two sites are periodic images in the supercell if they have the same
+/// sublattice and their unit cells differ by a superlattice vector, `T * n`
+/// for integer `n`. Each unit cell, `u`, is reduced to
+/// `adj(T) * u (mod det(T))`, which is equal for periodic images, so
+/// overlap is found with integer arithmetic only and without constructing a
+/// Supercell. Gives the same result as checking that the linear site
+/// indices in `Supercell(prim, T)` of each set are distinct.
+bool has_required_sites(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super,
+    std::vector<std::vector<xtal::UnitCellCoord>> const &required_sites) {
+  throw_if_equal_to_nullptr(prim, "Error in has_required_sites: prim is empty");
+  Eigen::Matrix3l const &T = transformation_matrix_to_super;
+  Eigen::Matrix3l adj = _adjugate(T);
+  long det = std::abs(T.determinant());
+  if (det == 0) {
+    throw std::runtime_error(
+        "Error in has_required_sites: transformation matrix is singular");
+  }
+  for (auto const &sites : required_sites) {
+    std::set<std::array<long, 4>> images;
+    for (xtal::UnitCellCoord const &site : sites) {
+      Eigen::Vector3l r = adj * site.unitcell();
+      std::array<long, 4> key;
+      key[0] = site.sublattice();
+      for (Index i = 0; i < 3; ++i) {
+        key[i + 1] = ((r(i) % det) + det) % det;
+      }
+      if (!images.insert(key).second) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/// \brief Make the equivalent supercells whose factor group includes the
+///     required operations
+///
+/// \param supercell The initial supercell
+/// \param required_operations Indices of prim factor group operations that
+///     are required in the supercell factor group
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns The supercells of `make_equivalents(supercell)`, in the same
+///     order, whose factor group includes all `required_operations`.
+///
+/// Equivalent superlattices are found by
+/// `make_equivalent_transformation_matrices`, the required operations are
+/// checked with integer arithmetic, as in `has_required_operations`, and a
+/// Supercell is only constructed for the superlattices that pass. The
+/// result does not depend on `n_threads`.
+std::vector<std::shared_ptr<Supercell const>>
+make_equivalent_supercells_with_required_operations(
+    Supercell const &supercell, std::vector<Index> const &required_operations,
+    Index n_threads) {
+  std::string method = "make_equivalent_supercells_with_required_operations";
+  auto const &prim = supercell.prim;
+  std::vector<Eigen::Matrix3l> integral_factor_group =
+      _make_integral_factor_group(*prim, required_operations, method);
+  std::vector<Eigen::Matrix3l> candidates =
+      make_equivalent_transformation_matrices(
+          prim, supercell.superlattice.transformation_matrix_to_super());
+
+  Index n = candidates.size();
+  std::vector<std::shared_ptr<Supercell const>> matching(n);
+  parallel_for_items(n, n_threads, [&](Index i) {
+    if (_has_required_operations(integral_factor_group, candidates[i],
+                                 required_operations)) {
+      matching[i] = make_shared_supercell(prim, candidates[i]);
+    }
+  });
+
+  std::vector<std::shared_ptr<Supercell const>> result;
+  for (auto const &ptr : matching) {
+    if (ptr != nullptr) {
+      result.push_back(ptr);
+    }
+  }
+  return result;
+}
+
+}  // namespace config
+}  // namespace CASM
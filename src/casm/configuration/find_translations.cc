@@ -0,0 +1,265 @@
+#include "casm/configuration/find_translations.hh"
+
+#include <cmath>
+#include <complex>
+#include <set>
+
+#include "casm/configuration/ConfigIsEquivalent.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+typedef std::complex<double> complex_type;
+
+/// \brief In-place radix-2 FFT, unnormalized, `a.size()` a power of 2
+void _fft_pow2(std::vector<complex_type> &a, bool inverse) {
+  Index n = a.size();
+  for (Index i = 1, j = 0; i < n; ++i) {
+    Index bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      std::swap(a[i], a[j]);
+    }
+  }
+  double sign = inverse ? 1.0 : -1.0;
+  for (Index len = 2; len <= n; len <<= 1) {
+    double angle = sign * 2.0 * M_PI / len;
+    for (Index i = 0; i < n; i += len) {
+      for (Index k = 0; k < len / 2; ++k) {
+        complex_type w = std::polar(1.0, angle * k);
+        complex_type u = a[i + k];
+        complex_type v = a[i + k + len / 2] * w;
+        a[i + k] = u + v;
+        a[i + k + len / 2] = u - v;
+      }
+    }
+  }
+}
+
+/// \brief In-place FFT of any length, unnormalized
+///
+/// Lengths that are not a power of 2 use Bluestein's algorithm, which
+/// writes the transform as a convolution of power of 2 length.
+void _fft(std::vector<complex_type> &a, bool inverse) {
+  Index n = a.size();
+  if (n <= 1) {
+    return;
+  }
+  if ((n & (n - 1)) == 0) {
+    _fft_pow2(a, inverse);
+    return;
+  }
+  Index m = 1;
+  while (m < 2 * n - 1) {
+    m <<= 1;
+  }
+  double sign = inverse ? 1.0 : -1.0;
+  std::vector<complex_type> chirp(n);
+  for (Index k = 0; k < n; ++k) {
+    // k^2 mod 2n, to keep the angle small
+    Index k2 = (k * k) % (2 * n);
+    chirp[k] = std::polar(1.0, sign * M_PI * k2 / n);
+  }
+  std::vector<complex_type> x(m, 0.0);
+  std::vector<complex_type> y(m, 0.0);
+  for (Index k = 0; k < n; ++k) {
+    x[k] = a[k] * chirp[k];
+  }
+  y[0] = std::conj(chirp[0]);
+  for (Index k = 1; k < n; ++k) {
+    y[k] = y[m - k] = std::conj(chirp[k]);
+  }
+  _fft_pow2(x, false);
+  _fft_pow2(y, false);
+  for (Index k = 0; k < m; ++k) {
+    x[k] *= y[k];
+  }
+  _fft_pow2(x, true);
+  for (Index k = 0; k < n; ++k) {
+    a[k] = x[k] * chirp[k] / double(m);
+  }
+}
+
+/// \brief In-place 3-dimensional FFT of row-major data, unnormalized
+void _fft3(std::vector<complex_type> &data, Eigen::Vector3l const &shape,
+           bool inverse) {
+  Eigen::Vector3l stride(shape(1) * shape(2), shape(2), 1);
+  Index size = data.size();
+  std::vector<complex_type> line;
+  for (Index axis = 0; axis < 3; ++axis) {
+    Index n = shape(axis);
+    if (n == 1) {
+      continue;
+    }
+    line.resize(n);
+    for (Index start = 0; start < size; ++start) {
+      // visit each line once, from its first element
+      if ((start / stride(axis)) % n != 0) {
+        continue;
+      }
+      for (Index k = 0; k < n; ++k) {
+        line[k] = data[start + k * stride(axis)];
+      }
+      _fft(line, inverse);
+      for (Index k = 0; k < n; ++k) {
+        data[start + k * stride(axis)] = line[k];
+      }
+    }
+  }
+}
+
+}  // namespace
+
+/// \brief Return the number of sites with equal occupation after each
+///     supercell translation
+///
+/// \param from, to Configurations in the same supercell
+///
+/// \returns Overlap, where `overlap[t]` is the number of sites, `l`, for
+///     which, after applying `SupercellSymOp(supercell, 0, t)` to `from`,
+///     the occupation on site `l` is equal to `to.dof_values.occupation(l)`.
+///
+/// Method:
+/// - Sites are indexed by sublattice and the supercell's TranslationGrid
+///   coordinate of their unit cell, in which translations add, so the
+///   overlap is a sum over sublattices and occupants of cross-correlations
+///   of occupant indicator arrays.
+/// - The cross-correlations are found with a 3-dimensional FFT, in
+///   O(n_sites * n_occupants * log(n_unitcells)), instead of comparing
+///   every translation in O(n_sites * n_unitcells).
+std::vector<Index> make_translation_occupation_overlap(
+    Configuration const &from, Configuration const &to) {
+  if (from.supercell != to.supercell && *from.supercell != *to.supercell) {
+    throw std::runtime_error(
+        "Error in make_translation_occupation_overlap: supercell mismatch");
+  }
+  Supercell const &supercell = *from.supercell;
+  TranslationGrid const &grid = supercell.sym_info.translation_grid;
+  xtal::UnitCellIndexConverter const &ijk_converter =
+      supercell.unitcell_index_converter;
+  xtal::UnitCellCoordIndexConverter const &bijk_converter =
+      supercell.unitcellcoord_index_converter;
+  Index n_unitcells = grid.size();
+  Index n_sites = bijk_converter.total_sites();
+  Eigen::VectorXi const &occ_from = from.dof_values.occupation;
+  Eigen::VectorXi const &occ_to = to.dof_values.occupation;
+
+  std::vector<Index> overlap(n_unitcells, 0);
+  if (occ_from.size() == 0) {
+    std::fill(overlap.begin(), overlap.end(), n_sites);
+    return overlap;
+  }
+
+  // site indices by sublattice, and grid linear index of each site's unit
+  // cell
+  std::vector<std::vector<Index>> sublattice_sites(n_sites / n_unitcells);
+  std::vector<Index> site_grid_index(n_sites);
+  for (Index l = 0; l < n_sites; ++l) {
+    xtal::UnitCellCoord bijk = bijk_converter(l);
+    sublattice_sites[bijk.sublattice()].push_back(l);
+    site_grid_index[l] = grid.linear_index(bijk.unitcell());
+  }
+
+  // sum of F_to * conj(F_from) over sublattices and occupants
+  std::vector<complex_type> sum(n_unitcells, 0.0);
+  std::vector<complex_type> f_from(n_unitcells);
+  std::vector<complex_type> f_to(n_unitcells);
+  for (std::vector<Index> const &sites : sublattice_sites) {
+    std::set<int> occupants;
+    for (Index l : sites) {
+      occupants.insert(occ_from(l));
+    }
+    for (int s : occupants) {
+      std::fill(f_from.begin(), f_from.end(), 0.0);
+      std::fill(f_to.begin(), f_to.end(), 0.0);
+      for (Index l : sites) {
+        if (occ_from(l) == s) {
+          f_from[site_grid_index[l]] = 1.0;
+        }
+        if (occ_to(l) == s) {
+          f_to[site_grid_index[l]] = 1.0;
+        }
+      }
+      _fft3(f_from, grid.shape, false);
+      _fft3(f_to, grid.shape, false);
+      for (Index k = 0; k < n_unitcells; ++k) {
+        sum[k] += f_to[k] * std::conj(f_from[k]);
+      }
+    }
+  }
+  _fft3(sum, grid.shape, true);
+
+  for (Index t = 0; t < n_unitcells; ++t) {
+    Index k = grid.linear_index(ijk_converter(t));
+    overlap[t] = std::lround(sum[k].real() / n_unitcells);
+  }
+  return overlap;
+}
+
+/// \brief Return the indices of the supercell translations that map the
+///     occupation of one configuration onto another
+///
+/// \param from, to Configurations in the same supercell
+///
+/// \returns Translation indices, `t`, in increasing order, for which
+///     applying `SupercellSymOp(supercell, 0, t)` to `from` gives the
+///     occupation of `to`. Found using
+///     `make_translation_occupation_overlap`.
+std::vector<Index> find_occupation_translation_indices(
+    Configuration const &from, Configuration const &to) {
+  std::vector<Index> overlap = make_translation_occupation_overlap(from, to);
+  Index n_sites = from.supercell->unitcellcoord_index_converter.total_sites();
+  std::vector<Index> result;
+  for (Index t = 0; t < overlap.size(); ++t) {
+    if (overlap[t] == n_sites) {
+      result.push_back(t);
+    }
+  }
+  return result;
+}
+
+/// \brief Return the indices of the supercell translations that map one
+///     configuration onto another
+///
+/// \param from, to Configurations in the same supercell
+///
+/// \returns Translation indices, `t`, in increasing order, for which
+///     applying `SupercellSymOp(supercell, 0, t)` to `from` gives a
+///     configuration equivalent to `to`, as determined by
+///     ConfigIsEquivalent. Candidates are found with
+///     `find_occupation_translation_indices`, and only those are compared
+///     using ConfigIsEquivalent. If there are no local continuous DoF, only
+///     the first candidate is compared, because translations do not change
+///     global DoF values.
+std::vector<Index> find_translation_indices(Configuration const &from,
+                                            Configuration const &to) {
+  std::vector<Index> candidates = find_occupation_translation_indices(from, to);
+  bool has_local_dof = !from.dof_values.local_dof_values.empty();
+  ConfigIsEquivalent equal_to_f(to);
+  std::vector<Index> result;
+  for (Index t : candidates) {
+    if (!has_local_dof && !result.empty()) {
+      result.push_back(t);
+      continue;
+    }
+    if (!equal_to_f(SupercellSymOp(from.supercell, 0, t), from)) {
+      if (!has_local_dof) {
+        return result;
+      }
+      continue;
+    }
+    result.push_back(t);
+  }
+  return result;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,300 @@
+#include "casm/configuration/group/StabilizerChain.hh"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <stdexcept>
+
+namespace CASM {
+namespace group {
+
+namespace {
+
+/// \brief Return the first point `x >= begin` with `p[x] != x`, or -1
+Index _first_moved(StabilizerChain::Permutation const &p, Index begin) {
+  for (Index x = begin; x < Index(p.size()); ++x) {
+    if (p[x] != x) {
+      return x;
+    }
+  }
+  return -1;
+}
+
+/// \brief A partial image: `image[x] == values[permutation[x]]`
+struct _Candidate {
+  std::vector<int> image;
+  StabilizerChain::Permutation permutation;
+};
+
+}  // namespace
+
+/// \brief Constructor, the trivial group
+///
+/// \param _n_points Number of points permuted
+StabilizerChain::StabilizerChain(Index _n_points) : m_n_points(_n_points) {
+  if (m_n_points < 0) {
+    throw std::runtime_error(
+        "Error in StabilizerChain: n_points must be non-negative");
+  }
+}
+
+/// \brief Add an element, extending the chain if the element is not
+///     already in the group it generates
+///
+/// \param element A permutation of `[0, n_points())`
+///
+/// \returns True if the chain was extended, false if `element` was already
+///     in the group
+///
+/// If `element` is not in the group, its residue after sifting is added as a
+/// strong generator, adding a level if needed, and the orbits of the
+/// levels it belongs to are recomputed.
+bool StabilizerChain::insert(Permutation const &element) {
+  if (Index(element.size()) != m_n_points) {
+    throw std::runtime_error(
+        "Error in StabilizerChain::insert: element size does not match "
+        "n_points");
+  }
+  Permutation residue = element;
+  Index m = _sift(residue);
+  if (m == -1) {
+    return false;
+  }
+
+  Permutation inverse(m_n_points);
+  for (Index x = 0; x < m_n_points; ++x) {
+    inverse[residue[x]] = x;
+  }
+  m_generators.push_back(std::move(residue));
+  m_inverse_generators.push_back(std::move(inverse));
+  m_first_moved.push_back(m);
+
+  auto it = m_levels.begin();
+  while (it != m_levels.end() && it->base_point < m) {
+    ++it;
+  }
+  if (it == m_levels.end() || it->base_point != m) {
+    Level level;
+    level.base_point = m;
+    m_levels.insert(it, level);
+  }
+
+  // the new generator fixes every point less than m, so it belongs to all
+  // levels with base point <= m
+  for (Level &level : m_levels) {
+    if (level.base_point > m) {
+      break;
+    }
+    _make_orbit(level);
+  }
+  return true;
+}
+
+/// \brief Return true if `element` is in the group generated so far
+///
+/// The result is exact once the chain is complete.
+bool StabilizerChain::contains(Permutation const &element) const {
+  if (Index(element.size()) != m_n_points) {
+    return false;
+  }
+  Permutation residue = element;
+  return _sift(residue) == -1;
+}
+
+/// \brief Group order, the product of the level orbit sizes
+///
+/// Equal to the order of the generated group once the chain is complete,
+/// and otherwise a lower bound on it.
+Index StabilizerChain::order() const {
+  Index result = 1;
+  for (Level const &level : m_levels) {
+    result *= level.orbit.size();
+  }
+  return result;
+}
+
+/// \brief Return the transversal element of level `i` that maps
+///     `base_point(i)` to `point`
+///
+/// The result is the product of the strong generators on the path from
+/// `base_point(i)` to `point` in the level's Schreier vector. Throws if
+/// `point` is not in `orbit(i)`.
+StabilizerChain::Permutation StabilizerChain::transversal(Index i,
+                                                          Index point) const {
+  Level const &level = m_levels[i];
+  if (point != level.base_point && level.parent[point] == -1) {
+    throw std::runtime_error(
+        "Error in StabilizerChain::transversal: point is not in the orbit");
+  }
+  std::vector<Index> path;
+  for (Index x = point; x != level.base_point; x = level.parent[x]) {
+    path.push_back(level.edge[x]);
+  }
+  Permutation result(m_n_points);
+  for (Index x = 0; x < m_n_points; ++x) {
+    result[x] = x;
+  }
+  for (auto it = path.rbegin(); it != path.rend(); ++it) {
+    Permutation const &g = m_generators[*it];
+    for (Index x = 0; x < m_n_points; ++x) {
+      result[x] = g[result[x]];
+    }
+  }
+  return result;
+}
+
+/// \brief Sift `element` through the chain
+///
+/// \param element On input, the permutation to sift. On output, the
+///     residue.
+///
+/// \returns The first point moved by the residue, or -1 if the residue is
+///     the identity (`element` is in the group)
+///
+/// The residue fixes every point less than the returned point. Sifting
+/// stops when the returned point is not a base point, or when the residue
+/// maps it outside the level orbit.
+Index StabilizerChain::_sift(Permutation &element) const {
+  auto it = m_levels.begin();
+  Index m = _first_moved(element, 0);
+  while (m != -1) {
+    while (it != m_levels.end() && it->base_point < m) {
+      ++it;
+    }
+    if (it == m_levels.end() || it->base_point != m) {
+      return m;
+    }
+    Index x = element[m];
+    if (x != m && it->parent[x] == -1) {
+      return m;
+    }
+    // element <- g^-1 * element, along the path from x to the base point
+    while (x != m) {
+      Permutation const &g_inv = m_inverse_generators[it->edge[x]];
+      for (Index y = m; y < m_n_points; ++y) {
+        element[y] = g_inv[element[y]];
+      }
+      x = it->parent[x];
+    }
+    m = _first_moved(element, m + 1);
+  }
+  return -1;
+}
+
+/// \brief Recompute the orbit of a level from the strong generators
+///
+/// Uses the generators that fix every point less than the base point.
+void StabilizerChain::_make_orbit(Level &level) {
+  Index const base = level.base_point;
+  level.parent.assign(m_n_points, -1);
+  level.edge.assign(m_n_points, -1);
+  level.orbit.clear();
+  level.orbit.push_back(base);
+  for (Index k = 0; k < Index(level.orbit.size()); ++k) {
+    Index y = level.orbit[k];
+    for (Index g = 0; g < Index(m_generators.size()); ++g) {
+      if (m_first_moved[g] < base) {
+        continue;
+      }
+      Index z = m_generators[g][y];
+      if (z != base && level.parent[z] == -1) {
+        level.parent[z] = y;
+        level.edge[z] = g;
+        level.orbit.push_back(z);
+      }
+    }
+  }
+}
+
+/// \brief Return the lexicographically greatest image of `values` under the
+///     group, where the image under `p` is `image[x] = values[p[x]]`
+///
+/// \param chain A complete stabilizer chain for the group
+/// \param values Values on the points, size `chain.n_points()`
+/// \param permutation If not nullptr, set to a group element `p` that gives
+///     the result
+///
+/// \returns The lexicographically greatest image
+///
+/// Method:
+/// - All candidates agree on the points less than the base point of the
+///   current level. Level `i` changes only points `>= base_point(i)`, and
+///   points in `[base_point(i), base_point(i + 1))` are fixed at later
+///   levels, so at each level only the candidates greatest on that range
+///   are kept.
+/// - Candidates with equal images have identical subtrees, so they are
+///   merged. The work depends on the number of distinct partial images,
+///   not on the group order.
+std::vector<int> make_lexicographic_max_image(
+    StabilizerChain const &chain, std::vector<int> const &values,
+    StabilizerChain::Permutation *permutation) {
+  Index n = chain.n_points();
+  if (Index(values.size()) != n) {
+    throw std::runtime_error(
+        "Error in make_lexicographic_max_image: values size does not match "
+        "n_points");
+  }
+
+  std::vector<_Candidate> candidates(1);
+  candidates[0].image = values;
+  candidates[0].permutation.resize(n);
+  for (Index x = 0; x < n; ++x) {
+    candidates[0].permutation[x] = x;
+  }
+
+  for (Index i = 0; i < chain.n_levels(); ++i) {
+    Index begin = chain.base_point(i);
+    Index end = (i + 1 < chain.n_levels()) ? chain.base_point(i + 1) : n;
+    std::vector<Index> const &orbit = chain.orbit(i);
+
+    int best_value = std::numeric_limits<int>::min();
+    for (_Candidate const &candidate : candidates) {
+      for (Index x : orbit) {
+        best_value = std::max(best_value, candidate.image[x]);
+      }
+    }
+
+    std::vector<_Candidate> next;
+    std::set<std::vector<int>> found;
+    _Candidate trial;
+    trial.image.resize(n);
+    trial.permutation.resize(n);
+    for (_Candidate const &candidate : candidates) {
+      for (Index x : orbit) {
+        if (candidate.image[x] != best_value) {
+          continue;
+        }
+        StabilizerChain::Permutation u = chain.transversal(i, x);
+        for (Index y = 0; y < n; ++y) {
+          trial.image[y] = candidate.image[u[y]];
+          trial.permutation[y] = candidate.permutation[u[y]];
+        }
+        if (!next.empty()) {
+          std::vector<int> const &best = next.front().image;
+          auto mismatch =
+              std::mismatch(trial.image.begin() + begin,
+                            trial.image.begin() + end, best.begin() + begin);
+          if (mismatch.first != trial.image.begin() + end) {
+            if (*mismatch.first < *mismatch.second) {
+              continue;
+            }
+            next.clear();
+            found.clear();
+          }
+        }
+        if (found.insert(trial.image).second) {
+          next.push_back(trial);
+        }
+      }
+    }
+    candidates = std::move(next);
+  }
+
+  if (permutation != nullptr) {
+    *permutation = std::move(candidates.front().permutation);
+  }
+  return std::move(candidates.front().image);
+}
+
+}  // namespace group
+}  // namespace CASM
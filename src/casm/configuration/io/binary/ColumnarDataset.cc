@@ -0,0 +1,501 @@
+#include "casm/configuration/io/binary/ColumnarDataset.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <sstream>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/binary/binary_io.hh"
+#include "casm/configuration/supercell_name.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// \brief Records with the same signature can share a batch
+std::string _signature(Configuration const &configuration) {
+  auto const &dof_values = configuration.dof_values;
+  std::stringstream ss;
+  ss << dof_values.occupation.size() << ";";
+  for (auto const &pair : dof_values.global_dof_values) {
+    ss << "G" << pair.first.size() << ":" << pair.first << ":"
+       << pair.second.size() << ";";
+  }
+  for (auto const &pair : dof_values.local_dof_values) {
+    ss << "L" << pair.first.size() << ":" << pair.first << ":"
+       << pair.second.rows() << ";";
+  }
+  return ss.str();
+}
+
+/// \brief Write one kind of property, for all records, as ragged columns
+template <typename GetMapF>
+void _write_properties(std::ostream &out,
+                       std::vector<ConfigurationWithProperties> const &records,
+                       GetMapF get_map) {
+  std::set<std::string> keys;
+  for (auto const &record : records) {
+    for (auto const &pair : get_map(record)) {
+      keys.insert(pair.first);
+    }
+  }
+  binary_io::write_u32(out, keys.size());
+  for (auto const &key : keys) {
+    binary_io::write_string(out, key);
+    std::vector<Index> rows, cols;
+    for (auto const &record : records) {
+      auto const &map = get_map(record);
+      auto it = map.find(key);
+      binary_io::write_u8(out, it != map.end());
+      rows.push_back(it != map.end() ? it->second.rows() : 0);
+      cols.push_back(it != map.end() ? it->second.cols() : 0);
+    }
+    for (Index r : rows) {
+      binary_io::write_u32(out, r);
+    }
+    for (Index c : cols) {
+      binary_io::write_u32(out, c);
+    }
+    Index offset = 0;
+    binary_io::write_i64(out, offset);
+    for (Index i = 0; i < records.size(); ++i) {
+      offset += rows[i] * cols[i];
+      binary_io::write_i64(out, offset);
+    }
+    for (auto const &record : records) {
+      auto const &map = get_map(record);
+      auto it = map.find(key);
+      if (it != map.end()) {
+        binary_io::write_doubles(out, it->second.data(), it->second.size());
+      }
+    }
+  }
+}
+
+std::map<std::string, ColumnarProperty> _read_properties(std::istream &in,
+                                                         Index n_records) {
+  std::map<std::string, ColumnarProperty> properties;
+  Index count = binary_io::read_u32(in);
+  for (Index k = 0; k < count; ++k) {
+    std::string key = binary_io::read_string(in);
+    ColumnarProperty &property = properties[key];
+    property.present.resize(n_records);
+    binary_io::read_exact(in, reinterpret_cast<char *>(property.present.data()),
+                          n_records);
+    for (Index i = 0; i < n_records; ++i) {
+      property.rows.push_back(binary_io::read_u32(in));
+    }
+    for (Index i = 0; i < n_records; ++i) {
+      property.cols.push_back(binary_io::read_u32(in));
+    }
+    for (Index i = 0; i < n_records + 1; ++i) {
+      property.offsets.push_back(binary_io::read_i64(in));
+    }
+    for (Index i = 0; i < n_records; ++i) {
+      if (property.offsets[i + 1] - property.offsets[i] !=
+          property.rows[i] * property.cols[i]) {
+        throw std::runtime_error(
+            "Error reading columnar dataset: invalid property offsets for " +
+            key);
+      }
+    }
+    property.values.resize(property.offsets.back());
+    binary_io::read_doubles(in, property.values.data(),
+                            property.values.size());
+  }
+  return properties;
+}
+
+}  // namespace
+
+/// \brief Value for record `i`, as a matrix
+Eigen::MatrixXd ColumnarProperty::matrix(Index i) const {
+  return Eigen::Map<Eigen::MatrixXd const>(values.data() + offsets[i],
+                                           rows[i], cols[i]);
+}
+
+/// \brief Reconstruct record `i`
+ConfigurationWithProperties ColumnarBatch::configuration_with_properties(
+    Index i) const {
+  clexulator::ConfigDoFValues dof_values;
+  dof_values.occupation = occupation.col(i);
+  for (auto const &pair : global_dof_values) {
+    dof_values.global_dof_values.emplace(pair.first, pair.second.col(i));
+  }
+  for (auto const &pair : local_dof_values) {
+    Index dim = local_dof_dim.at(pair.first);
+    dof_values.local_dof_values.emplace(
+        pair.first, Eigen::Map<Eigen::MatrixXd const>(
+                        pair.second.col(i).data(), dim, n_sites));
+  }
+  Configuration configuration(supercell_list->at(supercell_index[i]),
+                              dof_values);
+
+  std::map<std::string, Eigen::MatrixXd> _local_properties;
+  for (auto const &pair : local_properties) {
+    if (pair.second.present[i]) {
+      _local_properties.emplace(pair.first, pair.second.matrix(i));
+    }
+  }
+  std::map<std::string, Eigen::VectorXd> _global_properties;
+  for (auto const &pair : global_properties) {
+    if (pair.second.present[i]) {
+      _global_properties.emplace(pair.first, pair.second.matrix(i).col(0));
+    }
+  }
+  return ConfigurationWithProperties(configuration, _local_properties,
+                                     _global_properties);
+}
+
+/// \brief Reconstruct all records of a batch
+std::vector<ConfigurationWithProperties> make_configurations_with_properties(
+    ColumnarBatch const &batch) {
+  std::vector<ConfigurationWithProperties> records;
+  records.reserve(batch.size());
+  for (Index i = 0; i < batch.size(); ++i) {
+    records.push_back(batch.configuration_with_properties(i));
+  }
+  return records;
+}
+
+// --- ColumnarDatasetWriter ---
+
+/// \brief Constructor, writes the header
+///
+/// \param out The output stream. Must remain valid until `finish` is
+///     called, and should be opened in binary mode.
+/// \param batch_size Maximum number of records per batch. Must be >= 1.
+ColumnarDatasetWriter::ColumnarDatasetWriter(std::ostream &out,
+                                             Index batch_size)
+    : m_out(&out), m_batch_size(batch_size), m_size(0), m_finished(false) {
+  if (m_batch_size < 1) {
+    throw std::runtime_error(
+        "Error in ColumnarDatasetWriter: batch_size must be >= 1");
+  }
+  m_out->write(COLUMNAR_DATASET_MAGIC, sizeof(COLUMNAR_DATASET_MAGIC));
+  binary_io::write_u32(*m_out, COLUMNAR_DATASET_VERSION);
+}
+
+/// \brief Destructor, calls `finish` if it has not been called
+ColumnarDatasetWriter::~ColumnarDatasetWriter() {
+  if (!m_finished) {
+    finish();
+  }
+}
+
+/// \brief Write a Configuration, with no properties
+void ColumnarDatasetWriter::write(Configuration const &configuration) {
+  write(ConfigurationWithProperties(configuration));
+}
+
+/// \brief Write a ConfigurationWithProperties
+void ColumnarDatasetWriter::write(
+    ConfigurationWithProperties const &configuration_with_properties) {
+  if (m_finished) {
+    throw std::runtime_error(
+        "Error in ColumnarDatasetWriter::write: dataset is already finished");
+  }
+  Buffer &buffer =
+      m_buffers[_signature(configuration_with_properties.configuration)];
+  buffer.record_index.push_back(m_size);
+  buffer.records.push_back(configuration_with_properties);
+  ++m_size;
+  if (buffer.records.size() >= m_batch_size) {
+    _flush(buffer);
+  }
+}
+
+/// \brief Write all buffered records
+void ColumnarDatasetWriter::finish() {
+  if (m_finished) {
+    return;
+  }
+  for (auto &pair : m_buffers) {
+    _flush(pair.second);
+  }
+  m_buffers.clear();
+  m_out->flush();
+  m_finished = true;
+}
+
+/// \brief Number of records written
+Index ColumnarDatasetWriter::size() const { return m_size; }
+
+/// \brief Write the supercell record, if not yet written, and return its
+///     index in the stream
+Index ColumnarDatasetWriter::_supercell_index(
+    std::shared_ptr<Supercell const> const &supercell) {
+  auto it = m_supercell_index.find(supercell.get());
+  if (it != m_supercell_index.end()) {
+    return it->second;
+  }
+  Index index = m_supercells.size();
+  auto const &superlattice = supercell->superlattice;
+  binary_io::write_u8(*m_out, 'S');
+  binary_io::write_u32(*m_out, index);
+  binary_io::write_string(*m_out,
+                          make_supercell_name(superlattice.prim_lattice(),
+                                              superlattice.superlattice()));
+  auto const &T = superlattice.transformation_matrix_to_super();
+  for (Index i = 0; i < 3; ++i) {
+    for (Index j = 0; j < 3; ++j) {
+      binary_io::write_i64(*m_out, T(i, j));
+    }
+  }
+  m_supercells.push_back(supercell);
+  m_supercell_index.emplace(supercell.get(), index);
+  return index;
+}
+
+/// \brief Write the records in a buffer as a batch and clear it
+void ColumnarDatasetWriter::_flush(Buffer &buffer) {
+  auto const &records = buffer.records;
+  if (records.empty()) {
+    return;
+  }
+  Index n_records = records.size();
+
+  // supercell records must precede the batch that uses them
+  std::vector<Index> supercell_index;
+  for (auto const &record : records) {
+    supercell_index.push_back(
+        _supercell_index(record.configuration.supercell));
+  }
+
+  auto const &first = records.front().configuration.dof_values;
+  Index n_sites = first.occupation.size();
+
+  std::ostringstream out(std::ios::binary);
+  binary_io::write_u32(out, n_records);
+  binary_io::write_u32(out, n_sites);
+  for (Index index : buffer.record_index) {
+    binary_io::write_i64(out, index);
+  }
+  for (Index index : supercell_index) {
+    binary_io::write_u32(out, index);
+  }
+
+  // occupation
+  bool fits_int8 = true;
+  for (auto const &record : records) {
+    auto const &occupation = record.configuration.dof_values.occupation;
+    if (occupation.size() && (occupation.minCoeff() < INT8_MIN ||
+                              occupation.maxCoeff() > INT8_MAX)) {
+      fits_int8 = false;
+    }
+  }
+  binary_io::write_u8(out, fits_int8 ? 1 : 2);
+  for (auto const &record : records) {
+    auto const &occupation = record.configuration.dof_values.occupation;
+    if (fits_int8) {
+      std::string bytes(occupation.size(), '\0');
+      for (Index l = 0; l < occupation.size(); ++l) {
+        bytes[l] = static_cast<char>(static_cast<std::int8_t>(occupation[l]));
+      }
+      out.write(bytes.data(), bytes.size());
+    } else {
+      for (Index l = 0; l < occupation.size(); ++l) {
+        if (occupation[l] < INT16_MIN || occupation[l] > INT16_MAX) {
+          throw std::runtime_error(
+              "Error writing columnar dataset: occupation out of range");
+        }
+        auto value = static_cast<std::uint16_t>(occupation[l]);
+        binary_io::write_u8(out, value & 0xff);
+        binary_io::write_u8(out, value >> 8);
+      }
+    }
+  }
+
+  // global DoF
+  binary_io::write_u32(out, first.global_dof_values.size());
+  for (auto const &pair : first.global_dof_values) {
+    binary_io::write_string(out, pair.first);
+    binary_io::write_u32(out, pair.second.size());
+    for (auto const &record : records) {
+      auto const &value =
+          record.configuration.dof_values.global_dof_values.at(pair.first);
+      binary_io::write_doubles(out, value.data(), value.size());
+    }
+  }
+
+  // local DoF
+  binary_io::write_u32(out, first.local_dof_values.size());
+  for (auto const &pair : first.local_dof_values) {
+    binary_io::write_string(out, pair.first);
+    binary_io::write_u32(out, pair.second.rows());
+    for (auto const &record : records) {
+      auto const &value =
+          record.configuration.dof_values.local_dof_values.at(pair.first);
+      binary_io::write_doubles(out, value.data(), value.size());
+    }
+  }
+
+  // properties
+  _write_properties(out, records,
+                    [](ConfigurationWithProperties const &record)
+                        -> std::map<std::string, Eigen::MatrixXd> const & {
+                      return record.local_properties;
+                    });
+  _write_properties(out, records,
+                    [](ConfigurationWithProperties const &record)
+                        -> std::map<std::string, Eigen::VectorXd> const & {
+                      return record.global_properties;
+                    });
+
+  std::string bytes = out.str();
+  binary_io::write_u8(*m_out, 'B');
+  binary_io::write_i64(*m_out, bytes.size());
+  m_out->write(bytes.data(), bytes.size());
+
+  buffer.record_index.clear();
+  buffer.records.clear();
+}
+
+// --- ColumnarDatasetReader ---
+
+/// \brief Constructor, reads the header
+///
+/// \param in The input stream. Must remain valid while reading, and should
+///     be opened in binary mode.
+/// \param supercells Supercells are found or added to this set as records
+///     are read. Must remain valid while reading.
+ColumnarDatasetReader::ColumnarDatasetReader(std::istream &in,
+                                             SupercellSet &supercells)
+    : m_in(&in),
+      m_supercells(&supercells),
+      m_supercell_list(
+          std::make_shared<std::vector<std::shared_ptr<Supercell const>>>()) {
+  char magic[sizeof(COLUMNAR_DATASET_MAGIC)];
+  binary_io::read_exact(*m_in, magic, sizeof(magic));
+  if (std::memcmp(magic, COLUMNAR_DATASET_MAGIC, sizeof(magic)) != 0) {
+    throw std::runtime_error(
+        "Error reading columnar dataset: not a columnar dataset stream");
+  }
+  Index version = binary_io::read_u32(*m_in);
+  if (version < 1 || version > COLUMNAR_DATASET_VERSION) {
+    throw std::runtime_error(
+        "Error reading columnar dataset: unsupported version " +
+        std::to_string(version));
+  }
+}
+
+/// \brief Read the next batch, or return std::nullopt at end of stream
+std::optional<ColumnarBatch> ColumnarDatasetReader::read_batch() {
+  std::istream &in = *m_in;
+  while (true) {
+    int tag = in.get();
+    if (tag == std::char_traits<char>::eof()) {
+      return std::nullopt;
+    }
+    if (tag == 'S') {
+      Index supercell_index = binary_io::read_u32(in);
+      std::string name = binary_io::read_string(in);
+      Eigen::Matrix3l T;
+      for (Index i = 0; i < 3; ++i) {
+        for (Index j = 0; j < 3; ++j) {
+          T(i, j) = binary_io::read_i64(in);
+        }
+      }
+      if (supercell_index != m_supercell_list->size()) {
+        throw std::runtime_error(
+            "Error reading columnar dataset: unexpected supercell index");
+      }
+      auto record =
+          m_supercells->insert(make_shared_supercell(m_supercells->prim(), T));
+      if (record.first->supercell_name != name) {
+        throw std::runtime_error(
+            "Error reading columnar dataset: supercell name mismatch for " +
+            name);
+      }
+      m_supercell_list->push_back(record.first->supercell);
+      continue;
+    }
+    if (tag != 'B') {
+      throw std::runtime_error(
+          "Error reading columnar dataset: invalid record tag");
+    }
+
+    binary_io::read_i64(in);
+    ColumnarBatch batch;
+    batch.supercell_list = m_supercell_list;
+    Index n_records = binary_io::read_u32(in);
+    Index n_sites = binary_io::read_u32(in);
+    batch.n_sites = n_sites;
+    for (Index i = 0; i < n_records; ++i) {
+      batch.record_index.push_back(binary_io::read_i64(in));
+    }
+    for (Index i = 0; i < n_records; ++i) {
+      Index supercell_index = binary_io::read_u32(in);
+      if (supercell_index >= m_supercell_list->size()) {
+        throw std::runtime_error(
+            "Error reading columnar dataset: unknown supercell index");
+      }
+      auto const &supercell = m_supercell_list->at(supercell_index);
+      if (supercell->unitcellcoord_index_converter.total_sites() != n_sites) {
+        throw std::runtime_error(
+            "Error reading columnar dataset: batch size does not match "
+            "supercell");
+      }
+      batch.supercell_index.push_back(supercell_index);
+    }
+
+    // occupation
+    batch.occupation.resize(n_sites, n_records);
+    int width = in.get();
+    if (width == 1) {
+      std::string bytes(n_sites * n_records, '\0');
+      binary_io::read_exact(in, &bytes[0], bytes.size());
+      for (Index i = 0; i < bytes.size(); ++i) {
+        batch.occupation.data()[i] = static_cast<std::int8_t>(bytes[i]);
+      }
+    } else if (width == 2) {
+      std::string bytes(2 * n_sites * n_records, '\0');
+      binary_io::read_exact(in, &bytes[0], bytes.size());
+      for (Index i = 0; i < n_sites * n_records; ++i) {
+        auto lo = static_cast<unsigned char>(bytes[2 * i]);
+        auto hi = static_cast<unsigned char>(bytes[2 * i + 1]);
+        batch.occupation.data()[i] = static_cast<std::int16_t>(
+            static_cast<std::uint16_t>(lo | (hi << 8)));
+      }
+    } else {
+      throw std::runtime_error(
+          "Error reading columnar dataset: invalid occupation width");
+    }
+
+    // global DoF
+    Index count = binary_io::read_u32(in);
+    for (Index k = 0; k < count; ++k) {
+      std::string key = binary_io::read_string(in);
+      Eigen::MatrixXd value(binary_io::read_u32(in), n_records);
+      binary_io::read_doubles(in, value.data(), value.size());
+      batch.global_dof_values.emplace(key, std::move(value));
+    }
+
+    // local DoF
+    count = binary_io::read_u32(in);
+    for (Index k = 0; k < count; ++k) {
+      std::string key = binary_io::read_string(in);
+      Index dim = binary_io::read_u32(in);
+      Eigen::MatrixXd value(dim * n_sites, n_records);
+      binary_io::read_doubles(in, value.data(), value.size());
+      batch.local_dof_values.emplace(key, std::move(value));
+      batch.local_dof_dim.emplace(key, dim);
+    }
+
+    batch.local_properties = _read_properties(in, n_records);
+    batch.global_properties = _read_properties(in, n_records);
+    return batch;
+  }
+}
+
+/// \brief Supercells read so far, in stream order
+std::vector<std::shared_ptr<Supercell const>> const &
+ColumnarDatasetReader::supercell_list() const {
+  return *m_supercell_list;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,468 @@
+#include "casm/configuration/io/binary/ConfigurationSetJournal.hh"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/binary/ConfigurationSetView.hh"
+#include "casm/configuration/io/binary/Configuration_binary_io.hh"
+#include "casm/configuration/io/binary/binary_io.hh"
+#include "casm/configuration/trace.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// Size of the journal header: magic, uint32 version, int64 snapshot size,
+/// int64 number of snapshot records
+Index const JOURNAL_HEADER_SIZE = sizeof(CONFIGURATION_JOURNAL_MAGIC) + 20;
+
+/// Size of an entry, excluding payload: tag, uint32 length, uint32 checksum
+Index const ENTRY_OVERHEAD = 9;
+
+/// Buffered entries are written once the buffer is at least this large
+std::size_t const MAX_BUFFER_SIZE = 1 << 20;
+
+void _throw_error(std::string const &what) {
+  throw std::runtime_error("Error in ConfigurationSetJournal: " + what);
+}
+
+std::uint32_t _fnv1a(char const *data, std::size_t n) {
+  std::uint32_t hash = 2166136261u;
+  for (std::size_t i = 0; i < n; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+Index _load_u32(char const *p) {
+  std::uint32_t value = 0;
+  for (Index i = 0; i < 4; ++i) {
+    value |= static_cast<std::uint32_t>(static_cast<unsigned char>(p[i]))
+             << (8 * i);
+  }
+  return value;
+}
+
+/// Return the file size, or -1 if it does not exist
+Index _file_size(std::string const &path) {
+  struct stat st;
+  if (::stat(path.c_str(), &st) != 0) {
+    return -1;
+  }
+  return st.st_size;
+}
+
+void _write_all(int fd, char const *data, std::size_t n) {
+  while (n > 0) {
+    ssize_t written = ::write(fd, data, n);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      _throw_error(std::string("write failed: ") + std::strerror(errno));
+    }
+    data += written;
+    n -= written;
+  }
+}
+
+void _fsync(int fd, std::string const &path) {
+  if (::fsync(fd) != 0) {
+    _throw_error("fsync failed for " + path);
+  }
+}
+
+void _fsync_path(std::string const &path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    _throw_error("could not open " + path);
+  }
+  int result = ::fsync(fd);
+  ::close(fd);
+  if (result != 0) {
+    _throw_error("fsync failed for " + path);
+  }
+}
+
+/// fsync the directory containing `path`, so that a rename is durable
+void _fsync_directory(std::string const &path) {
+  auto pos = path.rfind('/');
+  std::string dir = ".";
+  if (pos == 0) {
+    dir = "/";
+  } else if (pos != std::string::npos) {
+    dir = path.substr(0, pos);
+  }
+  _fsync_path(dir);
+}
+
+void _rename(std::string const &from, std::string const &to) {
+  if (::rename(from.c_str(), to.c_str()) != 0) {
+    _throw_error("could not rename " + from + " to " + to);
+  }
+}
+
+std::string _header(Index snapshot_size, Index n_snapshot_records) {
+  std::ostringstream out;
+  out.write(CONFIGURATION_JOURNAL_MAGIC, sizeof(CONFIGURATION_JOURNAL_MAGIC));
+  binary_io::write_u32(out, CONFIGURATION_JOURNAL_VERSION);
+  binary_io::write_i64(out, snapshot_size);
+  binary_io::write_i64(out, n_snapshot_records);
+  return out.str();
+}
+
+std::string _record_payload(ConfigurationRecord const &record) {
+  std::ostringstream out;
+  binary_io::write_string(out, record.supercell_name());
+  Eigen::Matrix3l const &T = record.configuration.supercell->superlattice
+                                 .transformation_matrix_to_super();
+  for (Index i = 0; i < 3; ++i) {
+    for (Index j = 0; j < 3; ++j) {
+      binary_io::write_i64(out, T(i, j));
+    }
+  }
+  binary_io::write_string(out, record.configuration_id());
+  binary_io::write_dof_values(out, record.configuration.dof_values);
+  return out.str();
+}
+
+std::string _erase_payload(std::string const &configuration_name) {
+  std::ostringstream out;
+  binary_io::write_string(out, configuration_name);
+  return out.str();
+}
+
+/// Increase the next configuration id of the record's supercell past the
+/// record's id
+void _bump_next_config_id(ConfigurationRecord const &record,
+                          std::map<std::string, Index> &next_config_id) {
+  Index &next_id = next_config_id[record.supercell_name()];
+  next_id = std::max(next_id, record.configuration_id_value() + 1);
+}
+
+}  // namespace
+
+/// \brief Constructor, reads the snapshot and replays the journal
+///
+/// \param _path Path to the snapshot. The journal is at
+///     `_path + ".journal"`. Neither needs to exist.
+/// \param _supercells Supercells used by records are found or added to this
+///     set
+/// \param _sync_policy When to call `fsync`
+/// \param _compact_threshold If > 0, `compact` is called automatically when
+///     the journal has this many entries
+ConfigurationSetJournal::ConfigurationSetJournal(
+    std::string const &_path, std::shared_ptr<SupercellSet> const &_supercells,
+    JournalSyncPolicy _sync_policy, Index _compact_threshold)
+    : m_path(_path),
+      m_journal_path(_path + ".journal"),
+      m_supercells(_supercells),
+      m_sync_policy(_sync_policy),
+      m_compact_threshold(_compact_threshold),
+      m_fd(-1),
+      m_n_entries(0) {
+  if (m_supercells == nullptr) {
+    _throw_error("supercells is null");
+  }
+  if (m_compact_threshold < 0) {
+    _throw_error("compact_threshold must be >= 0");
+  }
+  _load();
+}
+
+/// \brief Destructor, flushes the journal
+ConfigurationSetJournal::~ConfigurationSetJournal() {
+  if (m_fd < 0) {
+    return;
+  }
+  try {
+    flush();
+  } catch (std::exception const &) {
+    // entries not written are lost, as for a crash
+  }
+  ::close(m_fd);
+}
+
+/// \brief Insert Configuration, setting supercell_name and
+///     configuration_id automatically, and journal it
+std::pair<ConfigurationSetJournal::const_iterator, bool>
+ConfigurationSetJournal::insert(Configuration const &configuration) {
+  auto res = m_configurations.insert(configuration);
+  if (res.second) {
+    _append('R', _record_payload(*res.first));
+  }
+  return res;
+}
+
+/// \brief Insert ConfigurationRecord, allowing custom configuration_id,
+///     and journal it
+///
+/// The next configuration id of the record's supercell is increased past
+/// the record's id, as when the journal is replayed.
+std::pair<ConfigurationSetJournal::const_iterator, bool>
+ConfigurationSetJournal::insert(ConfigurationRecord const &record) {
+  auto res = m_configurations.insert(record);
+  if (res.second) {
+    std::map<std::string, Index> next_config_id =
+        m_configurations.next_config_id();
+    _bump_next_config_id(*res.first, next_config_id);
+    m_configurations.set_next_config_id(next_config_id);
+    _append('R', _record_payload(*res.first));
+  }
+  return res;
+}
+
+/// \brief Erase by configuration, and journal it
+ConfigurationSetJournal::size_type ConfigurationSetJournal::erase(
+    Configuration const &configuration) {
+  auto it = m_configurations.find(configuration);
+  if (it == m_configurations.end()) {
+    return 0;
+  }
+  return erase_by_name(it->configuration_name());
+}
+
+/// \brief Erase by configuration name, and journal it
+ConfigurationSetJournal::size_type ConfigurationSetJournal::erase_by_name(
+    std::string const &configuration_name) {
+  if (m_configurations.erase_by_name(configuration_name) == 0) {
+    return 0;
+  }
+  _append('E', _erase_payload(configuration_name));
+  return 1;
+}
+
+/// \brief Write buffered entries, and `fsync` unless the policy is `none`
+void ConfigurationSetJournal::flush() {
+  _write_buffer();
+  if (m_sync_policy != JournalSyncPolicy::none) {
+    _fsync(m_fd, m_journal_path);
+  }
+}
+
+/// \brief Write a new snapshot and reset the journal
+///
+/// The snapshot is written to `snapshot_path() + ".tmp"` and renamed over
+/// the old snapshot, then the journal is reset the same way. If interrupted
+/// before the snapshot is renamed, the old snapshot and journal are kept;
+/// after, the old journal no longer matches the snapshot and is ignored.
+void ConfigurationSetJournal::compact() {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("ConfigurationSetJournal::compact",
+                                     "n_entries", m_n_entries);
+  _write_buffer();
+  bool sync = (m_sync_policy != JournalSyncPolicy::none);
+  std::string tmp_path = m_path + ".tmp";
+  {
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+      _throw_error("could not open " + tmp_path);
+    }
+    write_indexed_binary(out, m_configurations);
+    out.close();
+    if (!out) {
+      _throw_error("could not write " + tmp_path);
+    }
+  }
+  if (sync) {
+    _fsync_path(tmp_path);
+  }
+  Index snapshot_size = _file_size(tmp_path);
+  _rename(tmp_path, m_path);
+  if (sync) {
+    _fsync_directory(m_path);
+  }
+  _reset_journal(snapshot_size, m_configurations.size());
+}
+
+void ConfigurationSetJournal::_load() {
+  CASM_CONFIGURATION_TRACE_SCOPE("ConfigurationSetJournal::_load");
+  Index snapshot_size = _file_size(m_path);
+  if (snapshot_size < 0) {
+    snapshot_size = 0;
+  } else {
+    std::ifstream in(m_path, std::ios::binary);
+    if (!in) {
+      _throw_error("could not open " + m_path);
+    }
+    read_binary(in, *m_supercells, m_configurations);
+  }
+  Index n_snapshot_records = m_configurations.size();
+
+  Index valid_size = 0;
+  std::ifstream in(m_journal_path, std::ios::binary);
+  if (in) {
+    std::string journal((std::istreambuf_iterator<char>(in)),
+                        std::istreambuf_iterator<char>());
+    valid_size = _replay(journal, snapshot_size, n_snapshot_records);
+  }
+  if (valid_size == 0) {
+    _reset_journal(snapshot_size, n_snapshot_records);
+  } else {
+    _open_journal(valid_size);
+  }
+}
+
+/// Replay journal entries, returning the size of the valid part of the
+/// journal, or 0 if it does not match the snapshot
+Index ConfigurationSetJournal::_replay(std::string const &journal,
+                                       Index snapshot_size,
+                                       Index n_snapshot_records) {
+  Index size = journal.size();
+  if (size < JOURNAL_HEADER_SIZE ||
+      std::memcmp(journal.data(), CONFIGURATION_JOURNAL_MAGIC,
+                  sizeof(CONFIGURATION_JOURNAL_MAGIC)) != 0) {
+    _throw_error("not a configuration journal: " + m_journal_path);
+  }
+  binary_io::MemoryStreamBuffer header_buf(
+      journal.data() + sizeof(CONFIGURATION_JOURNAL_MAGIC),
+      journal.data() + JOURNAL_HEADER_SIZE);
+  std::istream header(&header_buf);
+  if (binary_io::read_u32(header) != CONFIGURATION_JOURNAL_VERSION) {
+    _throw_error("unsupported journal version: " + m_journal_path);
+  }
+  if (binary_io::read_i64(header) != snapshot_size ||
+      binary_io::read_i64(header) != n_snapshot_records) {
+    return 0;
+  }
+
+  std::map<std::string, Index> next_config_id =
+      m_configurations.next_config_id();
+  std::map<std::string, std::shared_ptr<Supercell const>> supercells;
+  Index offset = JOURNAL_HEADER_SIZE;
+  while (size - offset >= ENTRY_OVERHEAD) {
+    char tag = journal[offset];
+    Index length = _load_u32(journal.data() + offset + 1);
+    if (size - offset - ENTRY_OVERHEAD < length) {
+      break;
+    }
+    char const *payload = journal.data() + offset + 5;
+    if (_load_u32(payload + length) != _fnv1a(payload, length)) {
+      break;
+    }
+
+    binary_io::MemoryStreamBuffer entry_buf(payload, payload + length);
+    std::istream entry(&entry_buf);
+    if (tag == 'R') {
+      std::string supercell_name = binary_io::read_string(entry);
+      Eigen::Matrix3l T;
+      for (Index i = 0; i < 3; ++i) {
+        for (Index j = 0; j < 3; ++j) {
+          T(i, j) = binary_io::read_i64(entry);
+        }
+      }
+      std::string configuration_id = binary_io::read_string(entry);
+      std::shared_ptr<Supercell const> &supercell = supercells[supercell_name];
+      if (supercell == nullptr) {
+        supercell = m_supercells
+                        ->insert(make_shared_supercell(m_supercells->prim(), T))
+                        .first->supercell;
+      }
+      Configuration configuration(
+          supercell, binary_io::read_dof_values(entry, *supercell));
+      auto res = m_configurations.insert(
+          ConfigurationRecord(configuration, supercell_name, configuration_id));
+      if (res.second) {
+        _bump_next_config_id(*res.first, next_config_id);
+      }
+    } else if (tag == 'E') {
+      m_configurations.erase_by_name(binary_io::read_string(entry));
+    } else {
+      _throw_error("unknown entry tag in " + m_journal_path);
+    }
+    offset += ENTRY_OVERHEAD + length;
+    ++m_n_entries;
+  }
+  m_configurations.set_next_config_id(next_config_id);
+  return offset;
+}
+
+void ConfigurationSetJournal::_append(char tag, std::string const &payload) {
+  std::ostringstream entry;
+  binary_io::write_u8(entry, tag);
+  binary_io::write_u32(entry, payload.size());
+  entry.write(payload.data(), payload.size());
+  binary_io::write_u32(entry, _fnv1a(payload.data(), payload.size()));
+  m_buffer += entry.str();
+  ++m_n_entries;
+
+  if (m_sync_policy == JournalSyncPolicy::every_entry) {
+    flush();
+  } else if (m_buffer.size() >= MAX_BUFFER_SIZE) {
+    _write_buffer();
+  }
+  if (m_compact_threshold > 0 && m_n_entries >= m_compact_threshold) {
+    compact();
+  }
+}
+
+void ConfigurationSetJournal::_write_buffer() {
+  if (m_buffer.empty()) {
+    return;
+  }
+  _write_all(m_fd, m_buffer.data(), m_buffer.size());
+  m_buffer.clear();
+}
+
+/// Replace the journal with one that has only a header, matching the
+/// snapshot
+void ConfigurationSetJournal::_reset_journal(Index snapshot_size,
+                                             Index n_snapshot_records) {
+  bool sync = (m_sync_policy != JournalSyncPolicy::none);
+  std::string tmp_path = m_journal_path + ".tmp";
+  int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    _throw_error("could not open " + tmp_path);
+  }
+  try {
+    std::string header = _header(snapshot_size, n_snapshot_records);
+    _write_all(fd, header.data(), header.size());
+    if (sync) {
+      _fsync(fd, tmp_path);
+    }
+  } catch (...) {
+    ::close(fd);
+    throw;
+  }
+  ::close(fd);
+  _rename(tmp_path, m_journal_path);
+  if (sync) {
+    _fsync_directory(m_journal_path);
+  }
+  m_n_entries = 0;
+  _open_journal(JOURNAL_HEADER_SIZE);
+}
+
+/// Open the journal for appending, discarding anything after `valid_size`
+void ConfigurationSetJournal::_open_journal(Index valid_size) {
+  if (m_fd >= 0) {
+    ::close(m_fd);
+    m_fd = -1;
+  }
+  int fd = ::open(m_journal_path.c_str(), O_WRONLY | O_APPEND);
+  if (fd < 0) {
+    _throw_error("could not open " + m_journal_path);
+  }
+  if (::ftruncate(fd, valid_size) != 0) {
+    ::close(fd);
+    _throw_error("could not truncate " + m_journal_path);
+  }
+  m_fd = fd;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,403 @@
+#include "casm/configuration/io/binary/ConfigurationSetView.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/binary/Configuration_binary_io.hh"
+#include "casm/configuration/io/binary/binary_io.hh"
+#include "casm/configuration/trace.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// Size of the 'F' footer record: tag, int64 offset of the 'I' record
+Index const FOOTER_SIZE = 9;
+
+/// Size of the header: magic, uint32 version
+Index const HEADER_SIZE = sizeof(CONFIGURATION_BINARY_MAGIC) + 4;
+
+std::uint64_t _load_le(char const *p, Index n_bytes) {
+  std::uint64_t value = 0;
+  for (Index i = 0; i < n_bytes; ++i) {
+    value |= static_cast<std::uint64_t>(static_cast<unsigned char>(p[i]))
+             << (8 * i);
+  }
+  return value;
+}
+
+Index _load_u32(char const *p) { return _load_le(p, 4); }
+
+Index _load_i64(char const *p) { return static_cast<Index>(_load_le(p, 8)); }
+
+/// \brief An std::istream reading from mapped memory
+struct MemoryStream {
+  MemoryStream(char const *begin, char const *end)
+      : buffer(begin, end), in(&buffer) {}
+
+  binary_io::MemoryStreamBuffer buffer;
+  std::istream in;
+};
+
+[[noreturn]] void _throw_invalid(std::string const &what) {
+  throw std::runtime_error("Error in ConfigurationSetView: " + what);
+}
+
+}  // namespace
+
+/// \brief Write a ConfigurationSet in the indexed binary configuration format
+///
+/// Writes the records of `configurations`, in set order, as
+/// `ConfigurationBinaryWriter::write(ConfigurationSet const &)` does, then
+/// an 'I' index record and an 'F' footer record.
+///
+/// The 'I' record contents, with offsets in bytes from the start of the
+/// stream, are:
+/// - uint32 number of supercells, then int64 offsets of the 'S' records
+/// - uint32 number of records, then int64 offsets of the 'R' records
+/// - uint32 record indices, sorted by configuration name
+/// - int64 offset of the 'N' record
+///
+/// \param out The output stream, which must support `tellp`. Should be
+///     opened in binary mode.
+/// \param configurations The configurations to write
+void write_indexed_binary(std::ostream &out,
+                          ConfigurationSet const &configurations) {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("write_indexed_binary", "n_configurations",
+                                     configurations.size());
+  std::streamoff begin = out.tellp();
+  if (begin < 0) {
+    throw std::runtime_error(
+        "Error in write_indexed_binary: output stream does not support tellp");
+  }
+  auto tell = [&]() -> Index { return out.tellp() - begin; };
+
+  ConfigurationBinaryWriter writer(out);
+  std::vector<Index> supercell_offsets;
+  std::vector<Index> record_offsets;
+  std::vector<std::string> names;
+  for (auto const &record : configurations) {
+    Index offset = tell();
+    Index n_supercells = writer.n_supercells();
+    writer.supercell_index(record.configuration.supercell);
+    if (writer.n_supercells() != n_supercells) {
+      supercell_offsets.push_back(offset);
+    }
+    record_offsets.push_back(tell());
+    writer.write(record);
+    names.push_back(record.configuration_name());
+  }
+  Index next_config_id_offset = tell();
+  writer.write_next_config_id(configurations.next_config_id());
+
+  std::vector<Index> name_order(names.size());
+  for (Index i = 0; i < name_order.size(); ++i) {
+    name_order[i] = i;
+  }
+  std::sort(name_order.begin(), name_order.end(),
+            [&](Index a, Index b) { return names[a] < names[b]; });
+
+  std::ostringstream index;
+  binary_io::write_u32(index, supercell_offsets.size());
+  for (Index offset : supercell_offsets) {
+    binary_io::write_i64(index, offset);
+  }
+  binary_io::write_u32(index, record_offsets.size());
+  for (Index offset : record_offsets) {
+    binary_io::write_i64(index, offset);
+  }
+  for (Index i : name_order) {
+    binary_io::write_u32(index, i);
+  }
+  binary_io::write_i64(index, next_config_id_offset);
+
+  Index index_offset = tell();
+  std::string index_bytes = index.str();
+  binary_io::write_u8(out, 'I');
+  binary_io::write_i64(out, index_bytes.size());
+  out.write(index_bytes.data(), index_bytes.size());
+  binary_io::write_u8(out, 'F');
+  binary_io::write_i64(out, index_offset);
+}
+
+/// \brief Constructor, maps the file and reads the index
+///
+/// \param path Path to a file written by `write_indexed_binary`
+/// \param _supercells Supercells are found or added to this set as they are
+///     used
+ConfigurationSetView::ConfigurationSetView(
+    std::string const &path, std::shared_ptr<SupercellSet> const &_supercells)
+    : m_supercells(_supercells), m_data(nullptr), m_size(0) {
+  if (m_supercells == nullptr) {
+    _throw_invalid("supercells is null");
+  }
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    _throw_invalid("could not open " + path);
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    _throw_invalid("could not stat " + path);
+  }
+  m_size = st.st_size;
+  if (m_size < HEADER_SIZE + FOOTER_SIZE) {
+    ::close(fd);
+    _throw_invalid("file too small: " + path);
+  }
+  void *data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    _throw_invalid("could not map " + path);
+  }
+  m_data = static_cast<char const *>(data);
+
+  try {
+    if (std::memcmp(m_data, CONFIGURATION_BINARY_MAGIC,
+                    sizeof(CONFIGURATION_BINARY_MAGIC)) != 0) {
+      _throw_invalid("not a binary configuration file: " + path);
+    }
+    Index version = _load_u32(m_data + sizeof(CONFIGURATION_BINARY_MAGIC));
+    if (version < 1 || version > CONFIGURATION_BINARY_VERSION) {
+      _throw_invalid("unsupported version " + std::to_string(version));
+    }
+
+    char const *footer = m_data + m_size - FOOTER_SIZE;
+    if (footer[0] != 'F') {
+      _throw_invalid("no index, not written by write_indexed_binary: " + path);
+    }
+    Index index_offset = _load_i64(footer + 1);
+    if (index_offset < HEADER_SIZE ||
+        index_offset > m_size - FOOTER_SIZE - FOOTER_SIZE ||
+        m_data[index_offset] != 'I') {
+      _throw_invalid("invalid index offset");
+    }
+    char const *p = m_data + index_offset + 1;
+    Index index_length = _load_i64(p);
+    p += 8;
+    char const *index_end = p + index_length;
+    if (index_end != footer) {
+      _throw_invalid("invalid index length");
+    }
+
+    auto require = [&](Index n_bytes) {
+      if (n_bytes < 0 || n_bytes > index_end - p) {
+        _throw_invalid("index is truncated");
+      }
+    };
+    require(4);
+    m_n_supercells = _load_u32(p);
+    p += 4;
+    require(8 * m_n_supercells);
+    m_supercell_offsets = p;
+    p += 8 * m_n_supercells;
+    require(4);
+    m_n_records = _load_u32(p);
+    p += 4;
+    require(8 * m_n_records);
+    m_record_offsets = p;
+    p += 8 * m_n_records;
+    require(4 * m_n_records);
+    m_name_order = p;
+    p += 4 * m_n_records;
+    require(8);
+    m_next_config_id_offset = _load_i64(p);
+  } catch (...) {
+    ::munmap(const_cast<char *>(m_data), m_size);
+    throw;
+  }
+
+  m_supercell_list.resize(m_n_supercells);
+}
+
+ConfigurationSetView::~ConfigurationSetView() {
+  ::munmap(const_cast<char *>(m_data), m_size);
+}
+
+/// \brief Number of configuration records
+Index ConfigurationSetView::size() const { return m_n_records; }
+
+/// \brief Number of supercells
+Index ConfigurationSetView::n_supercells() const { return m_n_supercells; }
+
+/// \brief Supercells used by records are found or added to this set
+std::shared_ptr<SupercellSet> const &ConfigurationSetView::supercells() const {
+  return m_supercells;
+}
+
+/// \brief Get a supercell by its index in the file, constructing it on
+///     first use
+///
+/// The supercell is inserted into `supercells()`, and the stored supercell
+/// name is checked against the name of the constructed supercell.
+std::shared_ptr<Supercell const> const &ConfigurationSetView::supercell(
+    Index supercell_index) const {
+  if (supercell_index < 0 || supercell_index >= m_n_supercells) {
+    _throw_invalid("supercell index out of range");
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto &supercell = m_supercell_list[supercell_index];
+  if (supercell != nullptr) {
+    return supercell;
+  }
+
+  MemoryStream stream(
+      _at(_load_i64(m_supercell_offsets + 8 * supercell_index)),
+      m_data + m_size);
+  std::istream &in = stream.in;
+  if (in.get() != 'S' || binary_io::read_u32(in) != supercell_index) {
+    _throw_invalid("invalid supercell record");
+  }
+  std::string name = binary_io::read_string(in);
+  Eigen::Matrix3l T;
+  for (Index i = 0; i < 3; ++i) {
+    for (Index j = 0; j < 3; ++j) {
+      T(i, j) = binary_io::read_i64(in);
+    }
+  }
+  auto record =
+      m_supercells->insert(make_shared_supercell(m_supercells->prim(), T));
+  if (record.first->supercell_name != name) {
+    _throw_invalid("supercell name mismatch for " + name);
+  }
+  supercell = record.first->supercell;
+  return supercell;
+}
+
+/// \brief Get a supercell name by its index in the file
+///
+/// Reads the name only, without constructing the supercell.
+std::string ConfigurationSetView::supercell_name(Index supercell_index) const {
+  if (supercell_index < 0 || supercell_index >= m_n_supercells) {
+    _throw_invalid("supercell index out of range");
+  }
+  MemoryStream stream(
+      _at(_load_i64(m_supercell_offsets + 8 * supercell_index)),
+      m_data + m_size);
+  std::istream &in = stream.in;
+  if (in.get() != 'S' || binary_io::read_u32(in) != supercell_index) {
+    _throw_invalid("invalid supercell record");
+  }
+  return binary_io::read_string(in);
+}
+
+/// \brief Configuration id of the i-th record
+std::string ConfigurationSetView::configuration_id(Index i) const {
+  MemoryStream stream(_at(_record_offset(i)), m_data + m_size);
+  std::istream &in = stream.in;
+  if (in.get() != 'R') {
+    _throw_invalid("invalid configuration record");
+  }
+  return binary_io::read_string(in);
+}
+
+/// \brief Configuration name ("<supercell_name>/<configuration_id>") of
+///     the i-th record
+std::string ConfigurationSetView::configuration_name(Index i) const {
+  Index offset = _record_offset(i);
+  return supercell_name(_record_supercell_index(offset)) + "/" +
+         configuration_id(i);
+}
+
+/// \brief Decode the configuration of the i-th record
+Configuration ConfigurationSetView::configuration(Index i) const {
+  MemoryStream stream(_at(_record_offset(i)), m_data + m_size);
+  std::istream &in = stream.in;
+  if (in.get() != 'R') {
+    _throw_invalid("invalid configuration record");
+  }
+  binary_io::read_string(in);
+  std::shared_ptr<Supercell const> const &_supercell =
+      supercell(binary_io::read_u32(in));
+  return Configuration(_supercell,
+                       binary_io::read_dof_values(in, *_supercell));
+}
+
+/// \brief Decode the i-th record
+ConfigurationRecord ConfigurationSetView::record(Index i) const {
+  Index offset = _record_offset(i);
+  return ConfigurationRecord(configuration(i),
+                             supercell_name(_record_supercell_index(offset)),
+                             configuration_id(i));
+}
+
+/// \brief Find a record index by configuration name, returning `size()`
+///     if not found
+///
+/// Uses binary search over the record indices sorted by configuration name,
+/// decoding only the names of the records visited.
+Index ConfigurationSetView::find_by_name(
+    std::string const &configuration_name) const {
+  Index lo = 0;
+  Index hi = m_n_records;
+  while (lo < hi) {
+    Index mid = lo + (hi - lo) / 2;
+    Index i = _load_u32(m_name_order + 4 * mid);
+    std::string name = this->configuration_name(i);
+    if (name == configuration_name) {
+      return i;
+    }
+    if (name < configuration_name) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return m_n_records;
+}
+
+/// \brief Next configuration ids, by supercell name
+std::map<std::string, Index> ConfigurationSetView::next_config_id() const {
+  MemoryStream stream(_at(m_next_config_id_offset), m_data + m_size);
+  std::istream &in = stream.in;
+  if (in.get() != 'N') {
+    _throw_invalid("invalid next configuration ids record");
+  }
+  std::map<std::string, Index> next_config_id;
+  Index count = binary_io::read_u32(in);
+  for (Index k = 0; k < count; ++k) {
+    std::string name = binary_io::read_string(in);
+    next_config_id[name] = binary_io::read_i64(in);
+  }
+  return next_config_id;
+}
+
+/// \brief Check that `offset` is within the file and return a pointer
+char const *ConfigurationSetView::_at(Index offset) const {
+  if (offset < HEADER_SIZE || offset >= m_size) {
+    _throw_invalid("record offset out of range");
+  }
+  return m_data + offset;
+}
+
+/// \brief Offset of the i-th record, checking `i`
+Index ConfigurationSetView::_record_offset(Index i) const {
+  if (i < 0 || i >= m_n_records) {
+    _throw_invalid("record index out of range");
+  }
+  return _load_i64(m_record_offsets + 8 * i);
+}
+
+/// \brief Supercell index of the record at `offset`, skipping the
+///     configuration id
+Index ConfigurationSetView::_record_supercell_index(Index record_offset) const {
+  MemoryStream stream(_at(record_offset), m_data + m_size);
+  std::istream &in = stream.in;
+  if (in.get() != 'R') {
+    _throw_invalid("invalid configuration record");
+  }
+  binary_io::read_string(in);
+  return binary_io::read_u32(in);
+}
+
+}  // namespace config
+}  // namespace CASM
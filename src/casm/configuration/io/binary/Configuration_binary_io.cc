@@ -0,0 +1,385 @@
+#include "casm/configuration/io/binary/Configuration_binary_io.hh"
+
+#include <cstring>
+#include <sstream>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/binary/binary_io.hh"
+#include "casm/configuration/supercell_name.hh"
+#include "casm/configuration/trace.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+void _set_value(std::unique_ptr<Configuration> &value,
+                Configuration const &configuration,
+                std::map<std::string, Eigen::MatrixXd> const &local_properties,
+                std::map<std::string, Eigen::VectorXd> const
+                    &global_properties) {
+  value = std::make_unique<Configuration>(configuration);
+}
+
+void _set_value(std::unique_ptr<ConfigurationWithProperties> &value,
+                Configuration const &configuration,
+                std::map<std::string, Eigen::MatrixXd> const &local_properties,
+                std::map<std::string, Eigen::VectorXd> const
+                    &global_properties) {
+  value = std::make_unique<ConfigurationWithProperties>(
+      configuration, local_properties, global_properties);
+}
+
+}  // namespace
+
+// --- ConfigurationBinaryWriter ---
+
+/// \brief Constructor, writes the header
+///
+/// \param out The output stream. Must remain valid while writing, and should
+///     be opened in binary mode.
+ConfigurationBinaryWriter::ConfigurationBinaryWriter(std::ostream &out)
+    : m_out(&out) {
+  m_out->write(CONFIGURATION_BINARY_MAGIC,
+               sizeof(CONFIGURATION_BINARY_MAGIC));
+  binary_io::write_u32(*m_out, CONFIGURATION_BINARY_VERSION);
+}
+
+/// \brief Write a Configuration record
+void ConfigurationBinaryWriter::write(Configuration const &configuration) {
+  Index index = supercell_index(configuration.supercell);
+  binary_io::write_u8(*m_out, 'C');
+  binary_io::write_u32(*m_out, index);
+  binary_io::write_dof_values(*m_out, configuration.dof_values);
+}
+
+/// \brief Write a ConfigurationWithProperties record
+void ConfigurationBinaryWriter::write(
+    ConfigurationWithProperties const &configuration_with_properties) {
+  Configuration const &configuration =
+      configuration_with_properties.configuration;
+  Index index = supercell_index(configuration.supercell);
+  binary_io::write_u8(*m_out, 'P');
+  binary_io::write_u32(*m_out, index);
+  binary_io::write_dof_values(*m_out, configuration.dof_values);
+  binary_io::write_matrix_map(*m_out,
+                              configuration_with_properties.local_properties);
+  binary_io::write_vector_map(*m_out,
+                              configuration_with_properties.global_properties);
+}
+
+/// \brief Write a ConfigurationSet record
+void ConfigurationBinaryWriter::write(ConfigurationRecord const &record) {
+  Index index = supercell_index(record.configuration.supercell);
+  binary_io::write_u8(*m_out, 'R');
+  binary_io::write_string(*m_out, record.configuration_id());
+  binary_io::write_u32(*m_out, index);
+  binary_io::write_dof_values(*m_out, record.configuration.dof_values);
+  if (record.primitive_canonical_key().has_value()) {
+    binary_io::write_u8(*m_out, 'K');
+    binary_io::write_i64(*m_out, *record.primitive_canonical_key());
+  }
+}
+
+/// \brief Write the records and next configuration ids of a
+///     ConfigurationSet
+void ConfigurationBinaryWriter::write(ConfigurationSet const &configurations) {
+  for (auto const &record : configurations) {
+    write(record);
+  }
+  write_next_config_id(configurations.next_config_id());
+}
+
+/// \brief Write a next configuration ids record
+void ConfigurationBinaryWriter::write_next_config_id(
+    std::map<std::string, Index> const &next_config_id) {
+  binary_io::write_u8(*m_out, 'N');
+  binary_io::write_u32(*m_out, next_config_id.size());
+  for (auto const &pair : next_config_id) {
+    binary_io::write_string(*m_out, pair.first);
+    binary_io::write_i64(*m_out, pair.second);
+  }
+}
+
+/// \brief Write the supercell record, if not yet written, and return its
+///     index in the stream
+Index ConfigurationBinaryWriter::supercell_index(
+    std::shared_ptr<Supercell const> const &supercell) {
+  auto it = m_supercell_index.find(supercell.get());
+  if (it != m_supercell_index.end()) {
+    return it->second;
+  }
+  Index index = m_supercells.size();
+  auto const &superlattice = supercell->superlattice;
+  binary_io::write_u8(*m_out, 'S');
+  binary_io::write_u32(*m_out, index);
+  binary_io::write_string(*m_out,
+                          make_supercell_name(superlattice.prim_lattice(),
+                                              superlattice.superlattice()));
+  auto const &T = superlattice.transformation_matrix_to_super();
+  for (Index i = 0; i < 3; ++i) {
+    for (Index j = 0; j < 3; ++j) {
+      binary_io::write_i64(*m_out, T(i, j));
+    }
+  }
+  m_supercells.push_back(supercell);
+  m_supercell_index.emplace(supercell.get(), index);
+  return index;
+}
+
+/// \brief Number of supercell records written
+Index ConfigurationBinaryWriter::n_supercells() const {
+  return m_supercells.size();
+}
+
+// --- ConfigurationBinaryReader ---
+
+/// \brief Constructor, reads the header and the first record
+///
+/// \param in The input stream. Must remain valid while reading, and should
+///     be opened in binary mode.
+/// \param supercells Supercells are found or added to this set as records
+///     are read. Must remain valid while reading.
+template <typename ConfigurationType>
+ConfigurationBinaryReader<ConfigurationType>::ConfigurationBinaryReader(
+    std::istream &in, SupercellSet &supercells)
+    : m_in(&in), m_supercells(&supercells), m_supercell_index(-1) {
+  char magic[sizeof(CONFIGURATION_BINARY_MAGIC)];
+  binary_io::read_exact(*m_in, magic, sizeof(magic));
+  if (std::memcmp(magic, CONFIGURATION_BINARY_MAGIC, sizeof(magic)) != 0) {
+    throw std::runtime_error(
+        "Error reading binary configuration: not a binary configuration "
+        "stream");
+  }
+  Index version = binary_io::read_u32(*m_in);
+  if (version < 1 || version > CONFIGURATION_BINARY_VERSION) {
+    throw std::runtime_error(
+        "Error reading binary configuration: unsupported version " +
+        std::to_string(version));
+  }
+  advance();
+}
+
+/// \brief Get the current record
+template <typename ConfigurationType>
+ConfigurationType const &ConfigurationBinaryReader<ConfigurationType>::value()
+    const {
+  return *m_current;
+}
+
+/// \brief Configuration id of the current record, if it is a 'R' record,
+///     else empty
+template <typename ConfigurationType>
+std::string const &
+ConfigurationBinaryReader<ConfigurationType>::configuration_id() const {
+  return m_configuration_id;
+}
+
+/// \brief Primitive canonical key of the current record, if it is a 'R'
+///     record followed by a 'K' record, else empty
+template <typename ConfigurationType>
+std::optional<std::uint64_t> const &
+ConfigurationBinaryReader<ConfigurationType>::primitive_canonical_key() const {
+  return m_primitive_canonical_key;
+}
+
+/// \brief Supercell name of the current record
+template <typename ConfigurationType>
+std::string const &
+ConfigurationBinaryReader<ConfigurationType>::supercell_name() const {
+  return m_supercell_name_list.at(m_supercell_index);
+}
+
+/// \brief Read the next record
+template <typename ConfigurationType>
+void ConfigurationBinaryReader<ConfigurationType>::advance() {
+  std::istream &in = *m_in;
+  while (true) {
+    int tag = in.get();
+    if (tag == std::char_traits<char>::eof()) {
+      m_current.reset();
+      return;
+    }
+    if (tag == 'S') {
+      Index supercell_index = binary_io::read_u32(in);
+      std::string name = binary_io::read_string(in);
+      Eigen::Matrix3l T;
+      for (Index i = 0; i < 3; ++i) {
+        for (Index j = 0; j < 3; ++j) {
+          T(i, j) = binary_io::read_i64(in);
+        }
+      }
+      if (supercell_index != m_supercell_list.size()) {
+        throw std::runtime_error(
+            "Error reading binary configuration: unexpected supercell index");
+      }
+      auto record =
+          m_supercells->insert(make_shared_supercell(m_supercells->prim(), T));
+      if (record.first->supercell_name != name) {
+        throw std::runtime_error(
+            "Error reading binary configuration: supercell name mismatch for " +
+            name);
+      }
+      m_supercell_list.push_back(record.first->supercell);
+      m_supercell_name_list.push_back(name);
+      continue;
+    }
+    if (tag == 'N') {
+      Index count = binary_io::read_u32(in);
+      for (Index i = 0; i < count; ++i) {
+        std::string name = binary_io::read_string(in);
+        m_next_config_id[name] = binary_io::read_i64(in);
+      }
+      continue;
+    }
+    if (tag == 'I') {
+      Index length = binary_io::read_i64(in);
+      in.ignore(length);
+      if (in.gcount() != length) {
+        throw std::runtime_error(
+            "Error reading binary configuration: unexpected end of stream");
+      }
+      continue;
+    }
+    if (tag == 'F' || tag == 'K') {
+      binary_io::read_i64(in);
+      continue;
+    }
+    if (tag != 'C' && tag != 'P' && tag != 'R') {
+      throw std::runtime_error(
+          "Error reading binary configuration: invalid record tag");
+    }
+
+    m_configuration_id.clear();
+    m_primitive_canonical_key.reset();
+    if (tag == 'R') {
+      m_configuration_id = binary_io::read_string(in);
+    }
+    Index supercell_index = binary_io::read_u32(in);
+    if (supercell_index >= m_supercell_list.size()) {
+      throw std::runtime_error(
+          "Error reading binary configuration: unknown supercell index");
+    }
+    m_supercell_index = supercell_index;
+    auto const &supercell = m_supercell_list[supercell_index];
+    Configuration configuration(supercell,
+                                binary_io::read_dof_values(in, *supercell));
+    std::map<std::string, Eigen::MatrixXd> local_properties;
+    std::map<std::string, Eigen::VectorXd> global_properties;
+    if (tag == 'P') {
+      local_properties = binary_io::read_matrix_map(in);
+      global_properties = binary_io::read_vector_map(in);
+    }
+    if (tag == 'R' && in.peek() == 'K') {
+      in.get();
+      m_primitive_canonical_key = binary_io::read_i64(in);
+    }
+    _set_value(m_current, configuration, local_properties, global_properties);
+    return;
+  }
+}
+
+/// \brief Return true if `value` is valid, false if no more records
+template <typename ConfigurationType>
+bool ConfigurationBinaryReader<ConfigurationType>::is_valid() const {
+  return m_current != nullptr;
+}
+
+/// \brief Next configuration ids read from 'N' records
+template <typename ConfigurationType>
+std::map<std::string, Index> const &
+ConfigurationBinaryReader<ConfigurationType>::next_config_id() const {
+  return m_next_config_id;
+}
+
+template class ConfigurationBinaryReader<Configuration>;
+template class ConfigurationBinaryReader<ConfigurationWithProperties>;
+
+// --- Functions ---
+
+/// \brief Write a ConfigurationSet in the binary configuration format
+void write_binary(std::ostream &out, ConfigurationSet const &configurations) {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("write_binary", "n_configurations",
+                                     configurations.size());
+  ConfigurationBinaryWriter writer(out);
+  writer.write(configurations);
+}
+
+/// \brief Read a ConfigurationSet from the binary configuration format
+///
+/// \param in The input stream
+/// \param supercells Supercells are found or added to this set
+/// \param configurations Records are inserted into this set. 'R' records keep
+///     their configuration id, and primitive canonical key, if present; 'C'
+///     records are given the next id automatically.
+///     Next configuration ids are then set from the stream, if present.
+void read_binary(std::istream &in, SupercellSet &supercells,
+                 ConfigurationSet &configurations) {
+  CASM_CONFIGURATION_TRACE_SCOPE("read_binary");
+  ConfigurationBinaryReader<Configuration> reader(in, supercells);
+  while (reader.is_valid()) {
+    if (reader.configuration_id().empty()) {
+      configurations.insert(reader.value());
+    } else {
+      ConfigurationRecord record(reader.value(), reader.supercell_name(),
+                                 reader.configuration_id());
+      record.set_primitive_canonical_key(reader.primitive_canonical_key());
+      configurations.insert(record);
+    }
+    reader.advance();
+  }
+  if (!reader.next_config_id().empty()) {
+    configurations.set_next_config_id(reader.next_config_id());
+  }
+}
+
+/// \brief Convert a Configuration to the binary configuration format
+std::string to_bytes(Configuration const &configuration) {
+  std::ostringstream out;
+  ConfigurationBinaryWriter writer(out);
+  writer.write(configuration);
+  return out.str();
+}
+
+/// \brief Convert a ConfigurationWithProperties to the binary configuration
+///     format
+std::string to_bytes(
+    ConfigurationWithProperties const &configuration_with_properties) {
+  std::ostringstream out;
+  ConfigurationBinaryWriter writer(out);
+  writer.write(configuration_with_properties);
+  return out.str();
+}
+
+/// \brief Convert a ConfigurationSet to the binary configuration format
+std::string to_bytes(ConfigurationSet const &configurations) {
+  std::ostringstream out;
+  write_binary(out, configurations);
+  return out.str();
+}
+
+/// \brief Read a single Configuration or ConfigurationWithProperties from
+///     the binary configuration format
+///
+/// Reads the first record. Throws if there is none.
+template <typename ConfigurationType>
+ConfigurationType from_bytes(std::string const &bytes,
+                             SupercellSet &supercells) {
+  std::istringstream in(bytes);
+  ConfigurationBinaryReader<ConfigurationType> reader(in, supercells);
+  if (!reader.is_valid()) {
+    throw std::runtime_error(
+        "Error reading binary configuration: no configuration record");
+  }
+  return reader.value();
+}
+
+template Configuration from_bytes<Configuration>(std::string const &bytes,
+                                                 SupercellSet &supercells);
+template ConfigurationWithProperties from_bytes<ConfigurationWithProperties>(
+    std::string const &bytes, SupercellSet &supercells);
+
+}  // namespace config
+}  // namespace CASM
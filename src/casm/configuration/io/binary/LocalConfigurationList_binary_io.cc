@@ -0,0 +1,100 @@
+#include "casm/configuration/io/binary/LocalConfigurationList_binary_io.hh"
+
+#include <cstring>
+#include <sstream>
+
+#include "casm/configuration/LocalConfigurationList.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/binary/Configuration_binary_io.hh"
+#include "casm/configuration/io/binary/binary_io.hh"
+
+namespace CASM {
+namespace config {
+
+/// \brief Write a LocalConfigurationList in binary format
+///
+/// \param out The output stream
+/// \param local_configurations The local configurations to write
+void write_binary(std::ostream &out,
+                  LocalConfigurationList const &local_configurations) {
+  out.write(LOCAL_CONFIGURATION_LIST_BINARY_MAGIC,
+            sizeof(LOCAL_CONFIGURATION_LIST_BINARY_MAGIC));
+  binary_io::write_u32(out, LOCAL_CONFIGURATION_LIST_BINARY_VERSION);
+  binary_io::write_i64(out, local_configurations.size());
+  for (LocalConfiguration const &value : local_configurations) {
+    binary_io::write_i64(out, value.pos.first);
+    binary_io::write_i64(out, value.pos.second);
+  }
+  ConfigurationBinaryWriter writer(out);
+  for (LocalConfiguration const &value : local_configurations) {
+    writer.write(value.configuration);
+  }
+}
+
+/// \brief Read a LocalConfigurationList from binary format
+///
+/// \param in The input stream
+/// \param supercells Supercells are found or added to this set
+/// \param local_configurations Local configurations are appended to this
+///     list, in order
+void read_binary(std::istream &in, SupercellSet &supercells,
+                 LocalConfigurationList &local_configurations) {
+  char magic[sizeof(LOCAL_CONFIGURATION_LIST_BINARY_MAGIC)];
+  binary_io::read_exact(in, magic, sizeof(magic));
+  if (std::memcmp(magic, LOCAL_CONFIGURATION_LIST_BINARY_MAGIC,
+                  sizeof(magic)) != 0) {
+    throw std::runtime_error(
+        "Error reading binary local configurations: not a binary local "
+        "configuration list stream");
+  }
+  Index version = binary_io::read_u32(in);
+  if (version < 1 || version > LOCAL_CONFIGURATION_LIST_BINARY_VERSION) {
+    throw std::runtime_error(
+        "Error reading binary local configurations: unsupported version " +
+        std::to_string(version));
+  }
+  Index n = binary_io::read_i64(in);
+  if (n < 0) {
+    throw std::runtime_error(
+        "Error reading binary local configurations: invalid size");
+  }
+  std::vector<std::pair<Index, Index>> pos;
+  for (Index i = 0; i < n; ++i) {
+    Index unitcell_index = binary_io::read_i64(in);
+    Index equivalent_index = binary_io::read_i64(in);
+    pos.emplace_back(unitcell_index, equivalent_index);
+  }
+
+  ConfigurationBinaryReader<Configuration> reader(in, supercells);
+  local_configurations.reserve(local_configurations.size() + n);
+  for (Index i = 0; i < n; ++i) {
+    if (!reader.is_valid()) {
+      throw std::runtime_error(
+          "Error reading binary local configurations: missing configuration "
+          "record");
+    }
+    local_configurations.push_back(LocalConfiguration(reader.value(), pos[i]));
+    if (i + 1 < n) {
+      reader.advance();
+    }
+  }
+}
+
+/// \brief Convert a LocalConfigurationList to binary format
+std::string to_bytes(LocalConfigurationList const &local_configurations) {
+  std::ostringstream out;
+  write_binary(out, local_configurations);
+  return out.str();
+}
+
+/// \brief Read a LocalConfigurationList from binary format
+LocalConfigurationList local_configuration_list_from_bytes(
+    std::string const &bytes, SupercellSet &supercells) {
+  std::istringstream in(bytes);
+  LocalConfigurationList local_configurations;
+  read_binary(in, supercells, local_configurations);
+  return local_configurations;
+}
+
+}  // namespace config
+}  // namespace CASM
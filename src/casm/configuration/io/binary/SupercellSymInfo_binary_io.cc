@@ -0,0 +1,396 @@
+#include "casm/configuration/io/binary/SupercellSymInfo_binary_io.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "casm/configuration/PrimSymInfoCache.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/io/binary/binary_io.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// Size of the fixed part of the header: magic, uint32 version, uint32 0,
+/// uint64 prim digest, int64 prim basis size, int64 prim factor group size,
+/// int64 number of supercells
+Index const HEADER_SIZE = sizeof(SUPERCELL_SYM_INFO_BINARY_MAGIC) + 8 + 32;
+
+/// Number of int64 values before the permutations in a supercell record
+Index const RECORD_HEADER_COUNT = 12;
+
+std::uint64_t _load_le(char const *p, Index n_bytes) {
+  std::uint64_t value = 0;
+  for (Index i = 0; i < n_bytes; ++i) {
+    value |= static_cast<std::uint64_t>(static_cast<unsigned char>(p[i]))
+             << (8 * i);
+  }
+  return value;
+}
+
+Index _load_u32(char const *p) { return _load_le(p, 4); }
+
+Index _load_i64(char const *p) { return static_cast<Index>(_load_le(p, 8)); }
+
+/// \brief 64-bit FNV-1a hash
+struct _Fnv1a {
+  std::uint64_t value = 14695981039346656037ULL;
+
+  void add(std::uint64_t x) {
+    for (int i = 0; i < 8; ++i) {
+      value ^= (x >> (8 * i)) & 0xff;
+      value *= 1099511628211ULL;
+    }
+  }
+
+  void add(std::string const &s) {
+    add(s.size());
+    for (unsigned char c : s) {
+      value ^= c;
+      value *= 1099511628211ULL;
+    }
+  }
+};
+
+/// \brief Read `n` int64 values, directly if the host is little-endian
+void _load_i64s(char const *p, Index *values, Index n) {
+  std::uint16_t x = 1;
+  unsigned char c;
+  std::memcpy(&c, &x, 1);
+  if (c == 1 && sizeof(Index) == 8) {
+    std::memcpy(values, p, n * 8);
+    return;
+  }
+  for (Index i = 0; i < n; ++i) {
+    values[i] = _load_i64(p + 8 * i);
+  }
+}
+
+void _write_permutations(std::ostream &out,
+                         std::vector<sym_info::Permutation> const &perms) {
+  for (auto const &perm : perms) {
+    for (Index value : perm) {
+      binary_io::write_i64(out, value);
+    }
+  }
+}
+
+[[noreturn]] void _throw_invalid(std::string const &what) {
+  throw std::runtime_error("Error in SupercellSymInfoTables: " + what);
+}
+
+/// \brief Read a permutation of `n_sites` values, checking each is a valid
+///     site index
+sym_info::Permutation _load_permutation(char const *p, Index n_sites) {
+  sym_info::Permutation perm(n_sites);
+  _load_i64s(p, perm.data(), n_sites);
+  for (Index value : perm) {
+    if (value < 0 || value >= n_sites) {
+      _throw_invalid("invalid permutation");
+    }
+  }
+  return perm;
+}
+
+}  // namespace
+
+/// \brief Digest of the prim structure and factor group, identifying the
+///     prim of binary supercell symmetry tables
+///
+/// The digest combines `make_prim_digest` of the prim structure with the
+/// prim factor group representation on sites, so prim with the same
+/// structure but a different factor group, such as a subgroup, have
+/// different digests. It is the same for all builds.
+std::uint64_t make_supercell_sym_info_prim_digest(Prim const &prim) {
+  _Fnv1a hash;
+  hash.add(make_prim_digest(*prim.basicstructure));
+  hash.add(prim.sym_info.unitcellcoord_symgroup_rep.size());
+  for (auto const &rep : prim.sym_info.unitcellcoord_symgroup_rep) {
+    for (Index r = 0; r < 3; ++r) {
+      for (Index c = 0; c < 3; ++c) {
+        hash.add(rep.point_matrix(r, c));
+      }
+    }
+    for (Index b = 0; b < Index(rep.sublattice_index.size()); ++b) {
+      hash.add(rep.sublattice_index[b]);
+      for (Index x = 0; x < 3; ++x) {
+        hash.add(rep.unitcell_indices[b](x));
+      }
+    }
+  }
+  return hash.value;
+}
+
+/// \brief Write the symmetry tables of supercells in the binary supercell
+///     symmetry tables format
+///
+/// \param out The output stream, which should be opened in binary mode
+/// \param supercells The supercells, which must all have the same prim.
+///     Translation permutations are written only for supercells that store
+///     them (see `SupercellSymInfo::translation_permutations`).
+void write_supercell_sym_info_tables(
+    std::ostream &out,
+    std::vector<std::shared_ptr<Supercell const>> const &supercells) {
+  std::uint64_t prim_digest = 0;
+  Index prim_basis_size = 0;
+  Index prim_factor_group_size = 0;
+  if (supercells.size()) {
+    auto const &prim = supercells[0]->prim;
+    prim_digest = make_supercell_sym_info_prim_digest(*prim);
+    prim_basis_size = prim->basicstructure->basis().size();
+    prim_factor_group_size = prim->sym_info.factor_group->element.size();
+  }
+
+  // header
+  out.write(SUPERCELL_SYM_INFO_BINARY_MAGIC,
+            sizeof(SUPERCELL_SYM_INFO_BINARY_MAGIC));
+  binary_io::write_u32(out, SUPERCELL_SYM_INFO_BINARY_VERSION);
+  binary_io::write_u32(out, 0);
+  binary_io::write_i64(out, static_cast<Index>(prim_digest));
+  binary_io::write_i64(out, prim_basis_size);
+  binary_io::write_i64(out, prim_factor_group_size);
+  binary_io::write_i64(out, supercells.size());
+  Index offset = HEADER_SIZE + 8 * supercells.size();
+  for (auto const &supercell : supercells) {
+    if (supercell->prim != supercells[0]->prim) {
+      throw std::runtime_error(
+          "Error in write_supercell_sym_info_tables: prim mismatch");
+    }
+    SupercellSymInfo const &sym_info = supercell->sym_info;
+    Index n_fg = sym_info.factor_group_permutations.size();
+    Index n_t = sym_info.translation_permutations.has_value()
+                    ? sym_info.translation_permutations->size()
+                    : 0;
+    Index n_sites = supercell->unitcellcoord_index_converter.total_sites();
+    binary_io::write_i64(out, offset);
+    offset += 8 * (RECORD_HEADER_COUNT + n_fg + (n_fg + n_t) * n_sites);
+  }
+
+  // supercell records
+  for (auto const &supercell : supercells) {
+    SupercellSymInfo const &sym_info = supercell->sym_info;
+    Eigen::Matrix3l const &T =
+        supercell->superlattice.transformation_matrix_to_super();
+    for (Index i = 0; i < 3; ++i) {
+      for (Index j = 0; j < 3; ++j) {
+        binary_io::write_i64(out, T(i, j));
+      }
+    }
+    Index n_t = sym_info.translation_permutations.has_value()
+                    ? sym_info.translation_permutations->size()
+                    : 0;
+    binary_io::write_i64(out, sym_info.factor_group_permutations.size());
+    binary_io::write_i64(out, n_t);
+    binary_io::write_i64(
+        out, supercell->unitcellcoord_index_converter.total_sites());
+    for (Index value : sym_info.factor_group->head_group_index) {
+      binary_io::write_i64(out, value);
+    }
+    _write_permutations(out, sym_info.factor_group_permutations);
+    if (n_t) {
+      _write_permutations(out, *sym_info.translation_permutations);
+    }
+  }
+}
+
+/// \brief Constructor, maps the file and reads the header
+///
+/// \param path Path to a file written by `write_supercell_sym_info_tables`
+SupercellSymInfoTables::SupercellSymInfoTables(std::string const &path)
+    : m_size(0) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    _throw_invalid("could not open " + path);
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    _throw_invalid("could not stat " + path);
+  }
+  m_size = st.st_size;
+  if (m_size < HEADER_SIZE) {
+    ::close(fd);
+    _throw_invalid("file too small: " + path);
+  }
+  void *data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    _throw_invalid("could not map " + path);
+  }
+  Index size = m_size;
+  m_data = std::shared_ptr<char const>(
+      static_cast<char const *>(data),
+      [size](char const *p) { ::munmap(const_cast<char *>(p), size); });
+
+  if (std::memcmp(m_data.get(), SUPERCELL_SYM_INFO_BINARY_MAGIC,
+                  sizeof(SUPERCELL_SYM_INFO_BINARY_MAGIC)) != 0) {
+    _throw_invalid("not a supercell symmetry tables file: " + path);
+  }
+  char const *p = m_data.get() + sizeof(SUPERCELL_SYM_INFO_BINARY_MAGIC);
+  Index version = _load_u32(p);
+  if (version != SUPERCELL_SYM_INFO_BINARY_VERSION) {
+    _throw_invalid("unsupported version " + std::to_string(version));
+  }
+  p += 8;
+  m_prim_digest = _load_le(p, 8);
+  m_prim_basis_size = _load_i64(p + 8);
+  m_prim_factor_group_size = _load_i64(p + 16);
+  m_n_supercells = _load_i64(p + 24);
+  _at(HEADER_SIZE, m_n_supercells);
+}
+
+/// \brief Transformation matrix to supercell of the i-th supercell
+Eigen::Matrix3l SupercellSymInfoTables::transformation_matrix_to_super(
+    Index i) const {
+  char const *p = _at(_record_offset(i), 9);
+  Eigen::Matrix3l T;
+  for (Index r = 0; r < 3; ++r) {
+    for (Index c = 0; c < 3; ++c) {
+      T(r, c) = _load_i64(p + 8 * (3 * r + c));
+    }
+  }
+  return T;
+}
+
+/// \brief Return the index of the supercell with the given transformation
+///     matrix, or `size()` if not found
+Index SupercellSymInfoTables::find(
+    Eigen::Matrix3l const &transformation_matrix_to_super) const {
+  for (Index i = 0; i < m_n_supercells; ++i) {
+    if (this->transformation_matrix_to_super(i) ==
+        transformation_matrix_to_super) {
+      return i;
+    }
+  }
+  return m_n_supercells;
+}
+
+/// \brief Construct the SupercellSymInfo of the i-th supercell
+///
+/// \param prim The prim, which must be the prim of the supercells the
+///     tables were written from, as checked by
+///     `make_supercell_sym_info_prim_digest`.
+/// \param i Supercell index, in [0, size())
+/// \param translation_permutation_cache_max_bytes Memory budget of the
+///     TranslationPermutationCache. Stored translation permutations are read
+///     from the mapped file on demand, so this bounds how many are held by
+///     this process. If 0, translation permutations are not read and
+///     permuted indices are computed directly.
+///
+/// Factor group permutations are copied. Translation permutations are not,
+/// and the returned SupercellSymInfo shares the mapping. All permutation
+/// values are checked to be in `[0, n_sites)` when read.
+SupercellSymInfo SupercellSymInfoTables::make_sym_info(
+    std::shared_ptr<Prim const> const &prim, Index i,
+    Index translation_permutation_cache_max_bytes) const {
+  if (Index(prim->basicstructure->basis().size()) != m_prim_basis_size ||
+      Index(prim->sym_info.factor_group->element.size()) !=
+          m_prim_factor_group_size ||
+      make_supercell_sym_info_prim_digest(*prim) != m_prim_digest) {
+    _throw_invalid("prim mismatch");
+  }
+  Index offset = _record_offset(i);
+  char const *p = _at(offset, RECORD_HEADER_COUNT);
+  Index n_fg = _load_i64(p + 8 * 9);
+  Index n_t = _load_i64(p + 8 * 10);
+  Index n_sites = _load_i64(p + 8 * 11);
+  if (n_fg < 1 || n_fg > m_prim_factor_group_size || n_t < 0 ||
+      n_sites < 1 || n_sites > m_size / 8) {
+    _throw_invalid("invalid supercell record");
+  }
+  offset += 8 * RECORD_HEADER_COUNT;
+
+  std::set<Index> head_group_index;
+  p = _at(offset, n_fg);
+  for (Index j = 0; j < n_fg; ++j) {
+    Index value = _load_i64(p + 8 * j);
+    if (value < 0 || value >= m_prim_factor_group_size) {
+      _throw_invalid("invalid factor group index");
+    }
+    head_group_index.insert(value);
+  }
+  offset += 8 * n_fg;
+
+  std::vector<sym_info::Permutation> factor_group_permutations;
+  p = _at(offset, n_fg * n_sites);
+  for (Index j = 0; j < n_fg; ++j) {
+    factor_group_permutations.push_back(
+        _load_permutation(p + 8 * j * n_sites, n_sites));
+  }
+  offset += 8 * n_fg * n_sites;
+
+  Superlattice superlattice(prim->basicstructure->lattice(),
+                            transformation_matrix_to_super(i));
+  if (n_t && n_t != superlattice.size()) {
+    _throw_invalid("invalid supercell record");
+  }
+
+  // stored translation permutations are read from the mapping on demand
+  TranslationPermutationCache::source_type translation_permutation_source;
+  if (n_t) {
+    char const *q = _at(offset, n_t * n_sites);
+    std::shared_ptr<char const> data = m_data;
+    translation_permutation_source = [data, q, n_t,
+                                      n_sites](Index translation_index) {
+      if (translation_index < 0 || translation_index >= n_t) {
+        _throw_invalid("translation index out of range");
+      }
+      return _load_permutation(q + 8 * translation_index * n_sites, n_sites);
+    };
+  }
+
+  return SupercellSymInfo(prim, superlattice, head_group_index,
+                          std::move(factor_group_permutations), std::nullopt,
+                          translation_permutation_cache_max_bytes,
+                          std::move(translation_permutation_source));
+}
+
+/// \brief Construct a Supercell using the stored tables
+///
+/// \param prim The prim, which must be the prim of the supercells the
+///     tables were written from.
+/// \param transformation_matrix_to_super The supercell transformation
+///     matrix, which must be one of the stored supercells
+/// \param translation_permutation_cache_max_bytes Memory budget of the
+///     TranslationPermutationCache, if translation permutations are not
+///     stored for this supercell
+std::shared_ptr<Supercell const> SupercellSymInfoTables::make_supercell(
+    std::shared_ptr<Prim const> const &prim,
+    Eigen::Matrix3l const &transformation_matrix_to_super,
+    Index translation_permutation_cache_max_bytes) const {
+  Index i = find(transformation_matrix_to_super);
+  if (i == m_n_supercells) {
+    _throw_invalid("supercell not found");
+  }
+  return std::make_shared<Supercell const>(
+      prim,
+      Superlattice(prim->basicstructure->lattice(),
+                   transformation_matrix_to_super),
+      make_sym_info(prim, i, translation_permutation_cache_max_bytes));
+}
+
+/// \brief Offset of the i-th supercell record, checking `i`
+Index SupercellSymInfoTables::_record_offset(Index i) const {
+  if (i < 0 || i >= m_n_supercells) {
+    _throw_invalid("supercell index out of range");
+  }
+  return _load_i64(m_data.get() + HEADER_SIZE + 8 * i);
+}
+
+/// \brief Pointer to `n` int64 values at `offset`, checking bounds
+char const *SupercellSymInfoTables::_at(Index offset, Index n) const {
+  if (offset < 0 || n < 0 || offset > m_size || n > (m_size - offset) / 8) {
+    _throw_invalid("file is truncated");
+  }
+  return m_data.get() + offset;
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,232 @@
+#include "casm/configuration/io/binary/binary_io.hh"
+
+#include <cstdint>
+#include <cstring>
+
+#include "casm/configuration/Supercell.hh"
+
+namespace CASM {
+namespace config {
+namespace binary_io {
+
+namespace {  // anonymous
+
+bool _is_little_endian() {
+  std::uint16_t x = 1;
+  unsigned char c;
+  std::memcpy(&c, &x, 1);
+  return c == 1;
+}
+
+bool const IS_LITTLE_ENDIAN = _is_little_endian();
+
+template <typename UIntType>
+void _write_uint(std::ostream &out, UIntType value) {
+  char bytes[sizeof(UIntType)];
+  for (std::size_t i = 0; i < sizeof(UIntType); ++i) {
+    bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
+  out.write(bytes, sizeof(UIntType));
+}
+
+template <typename UIntType>
+UIntType _read_uint(std::istream &in) {
+  unsigned char bytes[sizeof(UIntType)];
+  read_exact(in, reinterpret_cast<char *>(bytes), sizeof(UIntType));
+  UIntType value = 0;
+  for (std::size_t i = 0; i < sizeof(UIntType); ++i) {
+    value |= static_cast<UIntType>(bytes[i]) << (8 * i);
+  }
+  return value;
+}
+
+}  // namespace
+
+void write_u8(std::ostream &out, unsigned char value) {
+  out.put(static_cast<char>(value));
+}
+
+void write_u32(std::ostream &out, Index value) {
+  if (value < 0 || value > Index(UINT32_MAX)) {
+    throw std::runtime_error(
+        "Error writing binary configuration: value out of range for uint32");
+  }
+  _write_uint(out, static_cast<std::uint32_t>(value));
+}
+
+void write_i64(std::ostream &out, Index value) {
+  _write_uint(out, static_cast<std::uint64_t>(value));
+}
+
+void write_string(std::ostream &out, std::string const &value) {
+  write_u32(out, value.size());
+  out.write(value.data(), value.size());
+}
+
+void write_doubles(std::ostream &out, double const *values, Index n) {
+  if (IS_LITTLE_ENDIAN) {
+    out.write(reinterpret_cast<char const *>(values), n * sizeof(double));
+    return;
+  }
+  for (Index i = 0; i < n; ++i) {
+    std::uint64_t bits;
+    std::memcpy(&bits, values + i, sizeof(double));
+    _write_uint(out, bits);
+  }
+}
+
+void write_vector_map(std::ostream &out,
+                      std::map<std::string, Eigen::VectorXd> const &values) {
+  write_u32(out, values.size());
+  for (auto const &pair : values) {
+    write_string(out, pair.first);
+    write_u32(out, pair.second.size());
+    write_doubles(out, pair.second.data(), pair.second.size());
+  }
+}
+
+void write_matrix_map(std::ostream &out,
+                      std::map<std::string, Eigen::MatrixXd> const &values) {
+  write_u32(out, values.size());
+  for (auto const &pair : values) {
+    write_string(out, pair.first);
+    write_u32(out, pair.second.rows());
+    write_u32(out, pair.second.cols());
+    write_doubles(out, pair.second.data(), pair.second.size());
+  }
+}
+
+void write_occupation(std::ostream &out, Eigen::VectorXi const &occupation) {
+  write_u32(out, occupation.size());
+  bool fits_int8 = true;
+  for (Index l = 0; l < occupation.size(); ++l) {
+    if (occupation[l] < INT16_MIN || occupation[l] > INT16_MAX) {
+      throw std::runtime_error(
+          "Error writing binary configuration: occupant index out of range");
+    }
+    if (occupation[l] < INT8_MIN || occupation[l] > INT8_MAX) {
+      fits_int8 = false;
+    }
+  }
+  if (fits_int8) {
+    write_u8(out, 1);
+    std::string bytes(occupation.size(), '\0');
+    for (Index l = 0; l < occupation.size(); ++l) {
+      bytes[l] = static_cast<char>(static_cast<std::int8_t>(occupation[l]));
+    }
+    out.write(bytes.data(), bytes.size());
+  } else {
+    write_u8(out, 2);
+    for (Index l = 0; l < occupation.size(); ++l) {
+      _write_uint(out, static_cast<std::uint16_t>(
+                            static_cast<std::int16_t>(occupation[l])));
+    }
+  }
+}
+
+void write_dof_values(std::ostream &out,
+                      clexulator::ConfigDoFValues const &dof_values) {
+  write_occupation(out, dof_values.occupation);
+  write_vector_map(out, dof_values.global_dof_values);
+  write_matrix_map(out, dof_values.local_dof_values);
+}
+
+void read_exact(std::istream &in, char *data, Index n) {
+  if (!in.read(data, n)) {
+    throw std::runtime_error(
+        "Error reading binary configuration: unexpected end of stream");
+  }
+}
+
+Index read_u32(std::istream &in) { return _read_uint<std::uint32_t>(in); }
+
+Index read_i64(std::istream &in) {
+  return static_cast<Index>(_read_uint<std::uint64_t>(in));
+}
+
+std::string read_string(std::istream &in) {
+  std::string value(read_u32(in), '\0');
+  read_exact(in, &value[0], value.size());
+  return value;
+}
+
+void read_doubles(std::istream &in, double *values, Index n) {
+  if (IS_LITTLE_ENDIAN) {
+    read_exact(in, reinterpret_cast<char *>(values), n * sizeof(double));
+    return;
+  }
+  for (Index i = 0; i < n; ++i) {
+    std::uint64_t bits = _read_uint<std::uint64_t>(in);
+    std::memcpy(values + i, &bits, sizeof(double));
+  }
+}
+
+std::map<std::string, Eigen::VectorXd> read_vector_map(std::istream &in) {
+  std::map<std::string, Eigen::VectorXd> values;
+  Index count = read_u32(in);
+  for (Index i = 0; i < count; ++i) {
+    std::string key = read_string(in);
+    Eigen::VectorXd value(read_u32(in));
+    read_doubles(in, value.data(), value.size());
+    values.emplace(key, value);
+  }
+  return values;
+}
+
+std::map<std::string, Eigen::MatrixXd> read_matrix_map(std::istream &in) {
+  std::map<std::string, Eigen::MatrixXd> values;
+  Index count = read_u32(in);
+  for (Index i = 0; i < count; ++i) {
+    std::string key = read_string(in);
+    Index rows = read_u32(in);
+    Index cols = read_u32(in);
+    Eigen::MatrixXd value(rows, cols);
+    read_doubles(in, value.data(), value.size());
+    values.emplace(key, value);
+  }
+  return values;
+}
+
+Eigen::VectorXi read_occupation(std::istream &in) {
+  Eigen::VectorXi occupation(read_u32(in));
+  int width = in.get();
+  if (width == 1) {
+    std::string bytes(occupation.size(), '\0');
+    read_exact(in, &bytes[0], bytes.size());
+    for (Index l = 0; l < occupation.size(); ++l) {
+      occupation[l] = static_cast<std::int8_t>(bytes[l]);
+    }
+  } else if (width == 2) {
+    for (Index l = 0; l < occupation.size(); ++l) {
+      occupation[l] = static_cast<std::int16_t>(_read_uint<std::uint16_t>(in));
+    }
+  } else {
+    throw std::runtime_error(
+        "Error reading binary configuration: invalid occupation width");
+  }
+  return occupation;
+}
+
+clexulator::ConfigDoFValues read_dof_values(std::istream &in,
+                                            Supercell const &supercell) {
+  clexulator::ConfigDoFValues dof_values;
+  dof_values.occupation = read_occupation(in);
+  dof_values.global_dof_values = read_vector_map(in);
+  dof_values.local_dof_values = read_matrix_map(in);
+
+  Index n_sites = supercell.unitcellcoord_index_converter.total_sites();
+  bool valid = (dof_values.occupation.size() == n_sites);
+  for (auto const &pair : dof_values.local_dof_values) {
+    valid = valid && (pair.second.cols() == n_sites);
+  }
+  if (!valid) {
+    throw std::runtime_error(
+        "Error reading binary configuration: DoF values size does not match "
+        "supercell");
+  }
+  return dof_values;
+}
+
+}  // namespace binary_io
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,206 @@
+#include "casm/configuration/io/json/ConfigurationDelta_json_io.hh"
+
+#include "casm/casm_io/container/json_io.hh"
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationDelta.hh"
+#include "casm/configuration/io/json/Configuration_json_io.hh"
+
+namespace CASM {
+
+/// Read ConfigurationDelta from JSON, relative to a background
+///
+/// \param json The JSON input, in the format written by
+///     `to_json(config::ConfigurationDelta const &, jsonParser &)`
+/// \param background The shared background configuration
+///
+/// The delta is checked against the background when expanded by
+/// `make_configuration`.
+config::ConfigurationDelta jsonConstructor<config::ConfigurationDelta>::
+    from_json(jsonParser const &json,
+              std::shared_ptr<config::Configuration const> const &background) {
+  config::ConfigurationDelta delta(background);
+  if (!json.is_obj()) {
+    throw std::runtime_error(
+        "Error reading ConfigurationDelta from JSON: not an object");
+  }
+  if (json.contains("occupation")) {
+    std::vector<Index> sites;
+    std::vector<int> values;
+    CASM::from_json(sites, json["occupation"]["sites"]);
+    CASM::from_json(values, json["occupation"]["values"]);
+    if (sites.size() != values.size()) {
+      throw std::runtime_error(
+          "Error reading ConfigurationDelta from JSON: occupation sites and "
+          "values size mismatch");
+    }
+    for (Index i = 0; i < Index(sites.size()); ++i) {
+      delta.occupation.emplace_back(sites[i], values[i]);
+    }
+  }
+  if (json.contains("global_dof")) {
+    for (auto it = json["global_dof"].begin(); it != json["global_dof"].end();
+         ++it) {
+      Eigen::VectorXd values;
+      CASM::from_json(values, *it);
+      delta.global_dof_values.emplace(it.name(), values);
+    }
+  }
+  if (json.contains("local_dof")) {
+    for (auto it = json["local_dof"].begin(); it != json["local_dof"].end();
+         ++it) {
+      std::vector<Index> sites;
+      Eigen::MatrixXd values;
+      CASM::from_json(sites, (*it)["sites"]);
+      CASM::from_json(values, (*it)["values"]);
+      if (Index(sites.size()) != values.rows()) {
+        throw std::runtime_error(
+            "Error reading ConfigurationDelta from JSON: local DoF " +
+            it.name() + " sites and values size mismatch");
+      }
+      config::SparseLocalDoFValues changes;
+      for (Index i = 0; i < Index(sites.size()); ++i) {
+        changes.emplace_back(sites[i], values.row(i).transpose());
+      }
+      delta.local_dof_values.emplace(it.name(), std::move(changes));
+    }
+  }
+  return delta;
+}
+
+/// Insert ConfigurationDelta to JSON, without its background
+///
+/// Format:
+/// \code
+/// {
+///   "occupation": { // if any occupation values differ
+///     "sites": [<linear site index>, ...],
+///     "values": [<occupant index>, ...]
+///   },
+///   "global_dof": { // if any global DoF values differ
+///     <dof name>: [<value>, ...], ...
+///   },
+///   "local_dof": { // if any local DoF values differ
+///     <dof name>: {
+///       "sites": [<linear site index>, ...],
+///       "values": [[<value>, ...], ...] // one row per site
+///     }, ...
+///   }
+/// }
+/// \endcode
+///
+/// DoF values are written in the prim basis.
+jsonParser &to_json(config::ConfigurationDelta const &delta, jsonParser &json) {
+  json.put_obj();
+  if (delta.occupation.size()) {
+    std::vector<Index> sites;
+    std::vector<int> values;
+    for (auto const &value : delta.occupation) {
+      sites.push_back(value.first);
+      values.push_back(value.second);
+    }
+    json["occupation"]["sites"] = sites;
+    json["occupation"]["values"] = values;
+  }
+  if (delta.global_dof_values.size()) {
+    json["global_dof"].put_obj();
+    for (auto const &pair : delta.global_dof_values) {
+      to_json_array(pair.second, json["global_dof"][pair.first]);
+    }
+  }
+  if (delta.local_dof_values.size()) {
+    json["local_dof"].put_obj();
+    for (auto const &pair : delta.local_dof_values) {
+      std::vector<Index> sites;
+      Eigen::MatrixXd values(pair.second.size(),
+                             pair.second.size()
+                                 ? pair.second.front().second.size()
+                                 : 0);
+      for (Index i = 0; i < Index(pair.second.size()); ++i) {
+        sites.push_back(pair.second[i].first);
+        values.row(i) = pair.second[i].second.transpose();
+      }
+      json["local_dof"][pair.first]["sites"] = sites;
+      json["local_dof"][pair.first]["values"] = values;
+    }
+  }
+  return json;
+}
+
+/// Insert ConfigurationDelta sharing one background to JSON
+///
+/// Format:
+/// \code
+/// {
+///   "basis": "prim",
+///   "background": <Configuration, with DoF values in the prim basis>,
+///   "deltas": [<ConfigurationDelta>, ...]
+/// }
+/// \endcode
+///
+/// The background is written once. All deltas must share a background that
+/// compares equal to the first.
+jsonParser &to_json(std::vector<config::ConfigurationDelta> const &deltas,
+                    jsonParser &json) {
+  json.put_obj();
+  json["basis"] = "prim";
+  json["deltas"].put_array();
+  if (deltas.empty()) {
+    return json;
+  }
+  auto const &background = deltas.front().background;
+  json["background"].put_obj();
+  to_json(*background, json["background"], true);
+  for (auto const &delta : deltas) {
+    if (delta.background != background &&
+        *delta.background != *background) {
+      throw std::runtime_error(
+          "Error writing ConfigurationDelta to JSON: deltas do not share a "
+          "background");
+    }
+    jsonParser tjson;
+    to_json(delta, tjson);
+    json["deltas"].push_back(tjson);
+  }
+  return json;
+}
+
+/// Read ConfigurationDelta sharing one background from JSON
+///
+/// \param deltas Set to the deltas, which share one background
+/// \param json The JSON input, in the format written by
+///     `to_json(std::vector<config::ConfigurationDelta> const &, jsonParser
+///     &)`
+/// \param prim The prim
+void from_json(std::vector<config::ConfigurationDelta> &deltas,
+               jsonParser const &json,
+               std::shared_ptr<config::Prim const> const &prim) {
+  deltas.clear();
+  if (!json.is_obj() || !json.contains("deltas")) {
+    throw std::runtime_error(
+        "Error reading ConfigurationDelta from JSON: invalid format");
+  }
+  if (json.contains("basis") && json["basis"].get<std::string>() != "prim") {
+    throw std::runtime_error(
+        "Error reading ConfigurationDelta from JSON: \"basis\" must be "
+        "\"prim\"");
+  }
+  if (json["deltas"].size() == 0) {
+    return;
+  }
+  if (!json.contains("background")) {
+    throw std::runtime_error(
+        "Error reading ConfigurationDelta from JSON: \"background\" not "
+        "found");
+  }
+  auto background = std::make_shared<config::Configuration const>(
+      jsonConstructor<config::Configuration>::from_json(json["background"],
+                                                        prim));
+  for (auto it = json["deltas"].begin(); it != json["deltas"].end(); ++it) {
+    deltas.push_back(
+        jsonConstructor<config::ConfigurationDelta>::from_json(*it,
+                                                               background));
+  }
+}
+
+}  // namespace CASM
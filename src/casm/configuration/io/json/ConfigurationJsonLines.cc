@@ -0,0 +1,113 @@
+#include "casm/configuration/io/json/ConfigurationJsonLines.hh"
+
+#include <string>
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/json/ConfigurationJsonSax.hh"
+#include "casm/configuration/io/json/Configuration_json_io.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief Write JSON on one line, with full double precision
+void _write_compact(std::ostream &out, jsonParser const &json) {
+  out << static_cast<nlohmann::json const &>(json).dump() << '\n';
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param in The input stream. Must remain valid while reading. The first
+///     record is read by the constructor.
+/// \param supercells Supercells are found or added to this set as records
+///     are read. Must remain valid while reading.
+template <typename ConfigurationType>
+ConfigurationJsonLinesReader<ConfigurationType>::ConfigurationJsonLinesReader(
+    std::istream &in, SupercellSet &supercells)
+    : m_in(&in), m_supercells(&supercells), m_line_number(0) {
+  advance();
+}
+
+/// \brief Get the current record
+template <typename ConfigurationType>
+ConfigurationType const &
+ConfigurationJsonLinesReader<ConfigurationType>::value() const {
+  return *m_current;
+}
+
+/// \brief Read the next record
+///
+/// Throws `std::runtime_error`, including the line number, if a line cannot
+/// be parsed.
+template <typename ConfigurationType>
+void ConfigurationJsonLinesReader<ConfigurationType>::advance() {
+  std::string line;
+  while (std::getline(*m_in, line)) {
+    ++m_line_number;
+    if (line.find_first_not_of(" \t\r") == std::string::npos) {
+      continue;
+    }
+    try {
+      m_current =
+          make_from_json_string<ConfigurationType>(line, *m_supercells);
+    } catch (std::exception &e) {
+      throw std::runtime_error(
+          "Error in ConfigurationJsonLinesReader: line " +
+          std::to_string(m_line_number) + ": " + e.what());
+    }
+    return;
+  }
+  m_current.reset();
+}
+
+/// \brief Return true if `value` is valid, false if no more records
+template <typename ConfigurationType>
+bool ConfigurationJsonLinesReader<ConfigurationType>::is_valid() const {
+  return m_current != nullptr;
+}
+
+/// \brief Line number (starting from 1) of the current record
+template <typename ConfigurationType>
+Index ConfigurationJsonLinesReader<ConfigurationType>::line_number() const {
+  return m_line_number;
+}
+
+template class ConfigurationJsonLinesReader<Configuration>;
+template class ConfigurationJsonLinesReader<ConfigurationWithProperties>;
+
+/// \brief Write a Configuration as one line of a JSON lines stream
+///
+/// \param out The output stream
+/// \param configuration The configuration
+/// \param write_prim_basis If true, write DoF values using the prim basis.
+///     Default (false) is to write DoF values in the standard basis.
+void write_json_line(std::ostream &out, Configuration const &configuration,
+                     bool write_prim_basis) {
+  jsonParser json;
+  to_json(configuration, json, write_prim_basis);
+  _write_compact(out, json);
+}
+
+/// \brief Write a ConfigurationWithProperties as one line of a JSON lines
+///     stream
+///
+/// \param out The output stream
+/// \param configuration_with_properties The configuration with properties
+/// \param write_prim_basis If true, write DoF values using the prim basis.
+///     Default (false) is to write DoF values in the standard basis.
+void write_json_line(
+    std::ostream &out,
+    ConfigurationWithProperties const &configuration_with_properties,
+    bool write_prim_basis) {
+  jsonParser json;
+  to_json(configuration_with_properties, json, write_prim_basis);
+  _write_compact(out, json);
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,742 @@
+#include "casm/configuration/io/json/ConfigurationJsonSax.hh"
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/clexulator/ConfigDoFValuesTools_impl.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/json/Configuration_json_io.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+typedef nlohmann::json _json;
+
+/// \brief A 1d array, or a 2d array stored by row, of numbers
+struct _ValueArray {
+  std::vector<double> values;
+
+  /// \brief Number of rows, for 2d arrays
+  Index n_rows = 0;
+
+  /// \brief Number of columns, for 2d arrays, or -1 if no row was read
+  Index n_cols = -1;
+};
+
+/// \brief A Configuration or ConfigurationWithProperties record, as read
+///     from the token stream
+struct _Record {
+  /// \brief Index into `_RecordSaxHandler::supercell_names`, if read from a
+  ///     ConfigurationSet
+  Index supercell_index = -1;
+
+  std::string configuration_id;
+
+  Eigen::Matrix3l T = Eigen::Matrix3l::Zero();
+
+  Index T_n_rows = 0;
+
+  std::optional<std::string> basis;
+
+  bool has_configuration = false;
+
+  bool has_dof = false;
+
+  std::vector<int> occupation;
+
+  std::map<std::string, _ValueArray> local_dofs;
+
+  std::map<std::string, _ValueArray> global_dofs;
+
+  std::map<std::string, _ValueArray> local_properties;
+
+  std::map<std::string, _ValueArray> global_properties;
+};
+
+enum class _Mode { configuration, configuration_with_properties, set };
+
+/// \brief The location of a JSON container in the standard layout
+enum class _Context {
+  set,
+  supercells,
+  supercell,
+  config_id,
+  with_properties,
+  record,
+  dof,
+  local_dofs,
+  global_dofs,
+  local_properties,
+  global_properties,
+  named_local,
+  named_global,
+  T,
+  T_row,
+  occ,
+  local_values,
+  local_row,
+  global_values
+};
+
+struct _Frame {
+  _Context context;
+
+  /// \brief Current key, for objects
+  std::string key;
+
+  /// \brief Number of elements read, for arrays
+  Index size = 0;
+
+  /// \brief Row index, for T_row
+  Index row = 0;
+
+  /// \brief Values being read, for named DoF and properties
+  _ValueArray *target = nullptr;
+};
+
+/// \brief A scalar JSON value
+struct _Scalar {
+  bool is_number = false;
+  bool is_integer = false;
+  double number = 0.0;
+  std::int64_t integer = 0;
+  std::string const *string = nullptr;
+};
+
+/// \brief Reads the standard Configuration, ConfigurationWithProperties, or
+///     ConfigurationSet layout from an nlohmann::json SAX token stream
+///
+/// Each callback returns false, which stops parsing, if a token is not in
+/// the standard layout. Containers under unrecognized keys are skipped.
+class _RecordSaxHandler {
+ public:
+  explicit _RecordSaxHandler(_Mode _mode) : mode(_mode), m_skip_depth(0) {}
+
+  _Mode mode;
+
+  /// \brief Records, in file order
+  std::vector<_Record> records;
+
+  /// \brief Supercell names, in file order, for a ConfigurationSet
+  std::vector<std::string> supercell_names;
+
+  std::optional<std::string> version;
+
+  /// \brief "basis", for a ConfigurationSet
+  std::optional<std::string> basis;
+
+  bool has_supercells = false;
+
+  std::optional<std::map<std::string, Index>> next_config_id;
+
+  bool null() { return _value(_Scalar()); }
+
+  bool boolean(bool) { return _value(_Scalar()); }
+
+  bool number_integer(_json::number_integer_t x) {
+    _Scalar s;
+    s.is_number = true;
+    s.is_integer = true;
+    s.number = double(x);
+    s.integer = x;
+    return _value(s);
+  }
+
+  bool number_unsigned(_json::number_unsigned_t x) {
+    _Scalar s;
+    s.is_number = true;
+    s.is_integer = (x <= _json::number_unsigned_t(
+                              std::numeric_limits<std::int64_t>::max()));
+    s.number = double(x);
+    s.integer = s.is_integer ? std::int64_t(x) : 0;
+    return _value(s);
+  }
+
+  bool number_float(_json::number_float_t x, _json::string_t const &) {
+    _Scalar s;
+    s.is_number = true;
+    s.number = x;
+    return _value(s);
+  }
+
+  bool string(_json::string_t &x) {
+    _Scalar s;
+    s.string = &x;
+    return _value(s);
+  }
+
+  bool binary(_json::binary_t &) { return _value(_Scalar()); }
+
+  bool key(_json::string_t &x) {
+    if (!m_skip_depth) {
+      m_stack.back().key = x;
+    }
+    return true;
+  }
+
+  bool start_object(std::size_t) {
+    if (m_skip_depth) {
+      ++m_skip_depth;
+      return true;
+    }
+    if (m_stack.empty()) {
+      if (mode == _Mode::set) {
+        return _push(_Context::set);
+      }
+      records.emplace_back();
+      if (mode == _Mode::configuration_with_properties) {
+        return _push(_Context::with_properties);
+      }
+      records.back().has_configuration = true;
+      return _push(_Context::record);
+    }
+    _Frame &parent = m_stack.back();
+    std::string const &k = parent.key;
+    switch (parent.context) {
+      case _Context::set:
+        if (k == "supercells") {
+          has_supercells = true;
+          return _push(_Context::supercells);
+        } else if (k == "config_id") {
+          next_config_id.emplace();
+          return _push(_Context::config_id);
+        } else if (k == "version" || k == "basis") {
+          return false;
+        }
+        return _skip();
+      case _Context::supercells:
+        supercell_names.push_back(k);
+        return _push(_Context::supercell);
+      case _Context::supercell:
+        records.emplace_back();
+        records.back().supercell_index = supercell_names.size() - 1;
+        records.back().configuration_id = k;
+        records.back().has_configuration = true;
+        return _push(_Context::record);
+      case _Context::with_properties:
+        if (k == "configuration") {
+          records.back().has_configuration = true;
+          return _push(_Context::record);
+        } else if (k == "local_properties") {
+          return _push(_Context::local_properties);
+        } else if (k == "global_properties") {
+          return _push(_Context::global_properties);
+        }
+        return _skip();
+      case _Context::record:
+        if (k == "dof") {
+          records.back().has_dof = true;
+          return _push(_Context::dof);
+        } else if (k == "transformation_matrix_to_supercell" ||
+                   k == "basis") {
+          return false;
+        }
+        return _skip();
+      case _Context::dof:
+        if (k == "local_dofs") {
+          return _push(_Context::local_dofs);
+        } else if (k == "global_dofs") {
+          return _push(_Context::global_dofs);
+        } else if (k == "occ") {
+          return false;
+        }
+        return _skip();
+      case _Context::local_dofs:
+        return _push(_Context::named_local, &records.back().local_dofs[k]);
+      case _Context::global_dofs:
+        return _push(_Context::named_global, &records.back().global_dofs[k]);
+      case _Context::local_properties:
+        return _push(_Context::named_local,
+                     &records.back().local_properties[k]);
+      case _Context::global_properties:
+        return _push(_Context::named_global,
+                     &records.back().global_properties[k]);
+      case _Context::named_local:
+      case _Context::named_global:
+        if (k == "values") {
+          return false;
+        }
+        return _skip();
+      default:
+        return false;
+    }
+  }
+
+  bool end_object() {
+    if (m_skip_depth) {
+      --m_skip_depth;
+      return true;
+    }
+    m_stack.pop_back();
+    return true;
+  }
+
+  bool start_array(std::size_t) {
+    if (m_skip_depth) {
+      ++m_skip_depth;
+      return true;
+    }
+    if (m_stack.empty()) {
+      return false;
+    }
+    _Frame &parent = m_stack.back();
+    std::string const &k = parent.key;
+    switch (parent.context) {
+      case _Context::set:
+        if (k == "supercells" || k == "config_id" || k == "version" ||
+            k == "basis") {
+          return false;
+        }
+        return _skip();
+      case _Context::with_properties:
+        if (k == "configuration" || k == "local_properties" ||
+            k == "global_properties") {
+          return false;
+        }
+        return _skip();
+      case _Context::record:
+        if (k == "transformation_matrix_to_supercell") {
+          return _push(_Context::T);
+        } else if (k == "dof" || k == "basis") {
+          return false;
+        }
+        return _skip();
+      case _Context::dof:
+        if (k == "occ") {
+          return _push(_Context::occ);
+        } else if (k == "local_dofs" || k == "global_dofs") {
+          return false;
+        }
+        return _skip();
+      case _Context::named_local:
+        if (k == "values") {
+          return _push(_Context::local_values, parent.target);
+        }
+        return _skip();
+      case _Context::named_global:
+        if (k == "values") {
+          return _push(_Context::global_values, parent.target);
+        }
+        return _skip();
+      case _Context::T: {
+        Index row = parent.size++;
+        if (row >= 3) {
+          return false;
+        }
+        if (!_push(_Context::T_row)) {
+          return false;
+        }
+        m_stack.back().row = row;
+        return true;
+      }
+      case _Context::local_values:
+        parent.target->n_rows++;
+        return _push(_Context::local_row, parent.target);
+      default:
+        return false;
+    }
+  }
+
+  bool end_array() {
+    if (m_skip_depth) {
+      --m_skip_depth;
+      return true;
+    }
+    _Frame const &frame = m_stack.back();
+    switch (frame.context) {
+      case _Context::T_row:
+        if (frame.size != 3) {
+          return false;
+        }
+        break;
+      case _Context::T:
+        if (frame.size != 3) {
+          return false;
+        }
+        records.back().T_n_rows = 3;
+        break;
+      case _Context::local_row:
+        if (frame.target->n_cols == -1) {
+          frame.target->n_cols = frame.size;
+        } else if (frame.target->n_cols != frame.size) {
+          return false;
+        }
+        break;
+      default:
+        break;
+    }
+    m_stack.pop_back();
+    return true;
+  }
+
+  bool parse_error(std::size_t, std::string const &,
+                   nlohmann::detail::exception const &) {
+    return false;
+  }
+
+ private:
+  std::vector<_Frame> m_stack;
+
+  /// \brief Depth within a skipped container, or 0
+  Index m_skip_depth;
+
+  bool _push(_Context context, _ValueArray *target = nullptr) {
+    _Frame frame;
+    frame.context = context;
+    frame.target = target;
+    m_stack.push_back(std::move(frame));
+    return true;
+  }
+
+  bool _skip() {
+    m_skip_depth = 1;
+    return true;
+  }
+
+  bool _value(_Scalar const &s) {
+    if (m_skip_depth) {
+      return true;
+    }
+    if (m_stack.empty()) {
+      return false;
+    }
+    _Frame &parent = m_stack.back();
+    std::string const &k = parent.key;
+    switch (parent.context) {
+      case _Context::set:
+        if (k == "version" || k == "basis") {
+          if (!s.string) {
+            return false;
+          }
+          (k == "version" ? version : basis) = *s.string;
+          return true;
+        } else if (k == "supercells" || k == "config_id") {
+          return false;
+        }
+        return true;
+      case _Context::config_id:
+        if (!s.is_integer) {
+          return false;
+        }
+        (*next_config_id)[k] = s.integer;
+        return true;
+      case _Context::with_properties:
+        return !(k == "configuration" || k == "local_properties" ||
+                 k == "global_properties");
+      case _Context::record:
+        if (k == "basis") {
+          if (!s.string) {
+            return false;
+          }
+          records.back().basis = *s.string;
+          return true;
+        }
+        return !(k == "transformation_matrix_to_supercell" || k == "dof");
+      case _Context::dof:
+        return !(k == "occ" || k == "local_dofs" || k == "global_dofs");
+      case _Context::named_local:
+      case _Context::named_global:
+        return k != "values";
+      case _Context::T_row: {
+        Index col = parent.size++;
+        if (!s.is_integer || col >= 3) {
+          return false;
+        }
+        records.back().T(parent.row, col) = s.integer;
+        return true;
+      }
+      case _Context::occ:
+        if (!s.is_integer || s.integer < std::numeric_limits<int>::min() ||
+            s.integer > std::numeric_limits<int>::max()) {
+          return false;
+        }
+        records.back().occupation.push_back(int(s.integer));
+        return true;
+      case _Context::local_row:
+        if (!s.is_number) {
+          return false;
+        }
+        parent.size++;
+        parent.target->values.push_back(s.number);
+        return true;
+      case _Context::global_values:
+        if (!s.is_number) {
+          return false;
+        }
+        parent.target->values.push_back(s.number);
+        return true;
+      default:
+        return false;
+    }
+  }
+};
+
+/// \brief Parse a JSON string, returning false if it is not valid JSON in
+///     the standard layout
+bool _parse(std::string const &json_str, _RecordSaxHandler &handler) {
+  return _json::sax_parse(json_str, &handler);
+}
+
+/// \brief Matrix with the inner arrays of a 2d array as columns
+Eigen::MatrixXd _transpose_matrix(_ValueArray const &array) {
+  Index n_cols = std::max(Index(0), array.n_cols);
+  return Eigen::Map<Eigen::MatrixXd const>(array.values.data(), n_cols,
+                                           array.n_rows);
+}
+
+/// \brief Vector with the values of a 1d array
+Eigen::VectorXd _vector(_ValueArray const &array) {
+  return Eigen::Map<Eigen::VectorXd const>(array.values.data(),
+                                           array.values.size());
+}
+
+/// \brief Return true if a record "basis" is "prim", or set `is_valid` false
+///     if it is not "prim" or "standard"
+bool _read_prim_basis(std::optional<std::string> const &basis,
+                      bool &is_valid) {
+  if (basis.has_value() && *basis != "prim" && *basis != "standard") {
+    is_valid = false;
+  }
+  return basis.has_value() && *basis == "prim";
+}
+
+/// \brief Make prim basis DoF values from a record
+///
+/// \returns False, without making DoF values, if the record DoF types or
+///     dimensions are not consistent with the prim and supercell. The
+///     document reader gives the error messages in that case.
+bool _make_dof_values(clexulator::ConfigDoFValues &dof_values,
+                      _Record const &record, Supercell const &supercell,
+                      bool read_prim_basis) {
+  if (!record.has_dof) {
+    return false;
+  }
+  Prim const &prim = *supercell.prim;
+  Index volume = supercell.unitcell_index_converter.total_sites();
+  Index n_sites = volume * prim.basicstructure->basis().size();
+  if (Index(record.occupation.size()) != n_sites) {
+    return false;
+  }
+  if (record.local_dofs.size() != prim.local_dof_info.size() ||
+      record.global_dofs.size() != prim.global_dof_info.size()) {
+    return false;
+  }
+
+  clexulator::ConfigDoFValues values;
+  values.occupation = Eigen::Map<Eigen::VectorXi const>(
+      record.occupation.data(), record.occupation.size());
+  for (auto const &pair : record.local_dofs) {
+    auto info_it = prim.local_dof_info.find(pair.first);
+    if (info_it == prim.local_dof_info.end()) {
+      return false;
+    }
+    Index expected_dim = read_prim_basis
+                             ? clexulator::max_dim(info_it->second)
+                             : info_it->second.front().basis().rows();
+    if (pair.second.n_rows != n_sites || pair.second.n_cols != expected_dim) {
+      return false;
+    }
+    values.local_dof_values.emplace(pair.first,
+                                    _transpose_matrix(pair.second));
+  }
+  for (auto const &pair : record.global_dofs) {
+    auto info_it = prim.global_dof_info.find(pair.first);
+    if (info_it == prim.global_dof_info.end()) {
+      return false;
+    }
+    Index expected_dim = read_prim_basis ? info_it->second.basis().cols()
+                                         : info_it->second.basis().rows();
+    if (Index(pair.second.values.size()) != expected_dim) {
+      return false;
+    }
+    values.global_dof_values.emplace(pair.first, _vector(pair.second));
+  }
+
+  if (read_prim_basis) {
+    dof_values = std::move(values);
+  } else {
+    from_standard_values(prim.dof_basis_info, values, volume, dof_values);
+  }
+  return true;
+}
+
+/// \brief Make a Configuration from a record, or return nullptr if
+///     not possible without the document reader
+std::unique_ptr<Configuration> _make_configuration(_Record const &record,
+                                                   SupercellSet &supercells) {
+  if (!record.has_configuration || record.T_n_rows != 3) {
+    return nullptr;
+  }
+  bool is_valid = true;
+  bool read_prim_basis = _read_prim_basis(record.basis, is_valid);
+  if (!is_valid) {
+    return nullptr;
+  }
+  auto supercell = supercells.insert(record.T).first->supercell;
+  clexulator::ConfigDoFValues dof_values;
+  if (!_make_dof_values(dof_values, record, *supercell, read_prim_basis)) {
+    return nullptr;
+  }
+  return std::make_unique<Configuration>(supercell, dof_values);
+}
+
+/// \brief Make a Configuration or ConfigurationWithProperties from a JSON
+///     string, or return nullptr if not possible without the document reader
+template <typename ConfigurationType>
+std::unique_ptr<ConfigurationType> _fast_make_from_json_string(
+    std::string const &json_str, SupercellSet &supercells);
+
+template <>
+std::unique_ptr<Configuration> _fast_make_from_json_string<Configuration>(
+    std::string const &json_str, SupercellSet &supercells) {
+  _RecordSaxHandler handler(_Mode::configuration);
+  if (!_parse(json_str, handler) || handler.records.size() != 1) {
+    return nullptr;
+  }
+  return _make_configuration(handler.records.front(), supercells);
+}
+
+template <>
+std::unique_ptr<ConfigurationWithProperties>
+_fast_make_from_json_string<ConfigurationWithProperties>(
+    std::string const &json_str, SupercellSet &supercells) {
+  _RecordSaxHandler handler(_Mode::configuration_with_properties);
+  if (!_parse(json_str, handler) || handler.records.size() != 1) {
+    return nullptr;
+  }
+  _Record const &record = handler.records.front();
+  std::unique_ptr<Configuration> configuration =
+      _make_configuration(record, supercells);
+  if (configuration == nullptr) {
+    return nullptr;
+  }
+  auto result =
+      std::make_unique<ConfigurationWithProperties>(*configuration);
+  for (auto const &pair : record.local_properties) {
+    result->local_properties.emplace(pair.first,
+                                     _transpose_matrix(pair.second));
+  }
+  for (auto const &pair : record.global_properties) {
+    result->global_properties.emplace(pair.first, _vector(pair.second));
+  }
+  return result;
+}
+
+/// \brief Read a ConfigurationSet from a JSON string, returning false if
+///     not possible without the document reader
+bool _fast_read_configuration_set_json(std::string const &json_str,
+                                       SupercellSet &supercells,
+                                       ConfigurationSet &configurations,
+                                       Index n_threads) {
+  _RecordSaxHandler handler(_Mode::set);
+  if (!_parse(json_str, handler) || !handler.has_supercells ||
+      handler.version != std::string("1.0") ||
+      !handler.next_config_id.has_value()) {
+    return false;
+  }
+  bool is_valid = true;
+  bool read_prim_basis = _read_prim_basis(handler.basis, is_valid);
+  if (!is_valid) {
+    return false;
+  }
+
+  std::vector<SupercellRecord const *> supercell_records;
+  try {
+    supercell_records = insert_canonical_supercells(
+        supercells, handler.supercell_names, n_threads);
+  } catch (std::exception &) {
+    return false;
+  }
+
+  configurations.clear();
+  for (_Record &record : handler.records) {
+    SupercellRecord const *s = supercell_records[record.supercell_index];
+    clexulator::ConfigDoFValues dof_values;
+    if (!_make_dof_values(dof_values, record, *s->supercell,
+                          read_prim_basis)) {
+      return false;
+    }
+    configurations.insert(ConfigurationRecord(
+        Configuration(s->supercell, dof_values),
+        handler.supercell_names[record.supercell_index],
+        record.configuration_id));
+    // release token buffers as records are converted
+    record = _Record();
+  }
+  configurations.set_next_config_id(*handler.next_config_id);
+  return true;
+}
+
+}  // namespace
+
+/// \brief Read a Configuration or ConfigurationWithProperties from a JSON
+///     string, without constructing a JSON document
+///
+/// \param json_str A JSON object, in the format read by
+///     `jsonMake<ConfigurationType>::make_from_json`
+/// \param supercells Supercells are found or added to this set
+///
+/// \returns The configuration. Throws, as the document reader, if the
+///     record is invalid.
+template <typename ConfigurationType>
+std::unique_ptr<ConfigurationType> make_from_json_string(
+    std::string const &json_str, SupercellSet &supercells) {
+  std::unique_ptr<ConfigurationType> result =
+      _fast_make_from_json_string<ConfigurationType>(json_str, supercells);
+  if (result != nullptr) {
+    return result;
+  }
+  jsonParser json = jsonParser::parse(json_str);
+  return jsonMake<ConfigurationType>::make_from_json(json, supercells);
+}
+
+template std::unique_ptr<Configuration> make_from_json_string<Configuration>(
+    std::string const &json_str, SupercellSet &supercells);
+template std::unique_ptr<ConfigurationWithProperties>
+make_from_json_string<ConfigurationWithProperties>(std::string const &json_str,
+                                                   SupercellSet &supercells);
+
+/// \brief Read a ConfigurationSet from a JSON string, without constructing a
+///     JSON document
+///
+/// Reads the format read by `from_json(SupercellSet &, ConfigurationSet &,
+/// jsonParser const &, ...)`. Configurations are read from the token stream
+/// directly into DoF value buffers. If the input is not in the standard
+/// layout, or is inconsistent with the prim, it is read with the document
+/// reader instead, which gives the same result or the same error.
+///
+/// \param json_str The JSON input
+/// \param supercells The SupercellSet holding the configurations'
+///     supercells. Supercells that are not already present are added.
+/// \param configurations The ConfigurationSet to read into. It is cleared
+///     first.
+/// \param n_threads Number of threads used to construct the supercells
+///     that are not already in `supercells`. If <= 0, use the hardware
+///     concurrency.
+void read_configuration_set_json(std::string const &json_str,
+                                 SupercellSet &supercells,
+                                 ConfigurationSet &configurations,
+                                 Index n_threads) {
+  if (_fast_read_configuration_set_json(json_str, supercells, configurations,
+                                        n_threads)) {
+    return;
+  }
+  jsonParser json = jsonParser::parse(json_str);
+  CASM::from_json(supercells, configurations, json, supercells.prim(),
+                  n_threads);
+}
+
+}  // namespace config
+}  // namespace CASM
@@ -253,18 +253,31 @@ clexulator::ConfigDoFValues read_dof_values(
                       prim.basicstructure->basis().size(), prim.global_dof_info,
                       prim.local_dof_info, !read_prim_basis);
   if (!read_prim_basis) {
-    dof_values = clexulator::from_standard_values(
-        dof_values, prim.basicstructure->basis().size(),
-        supercell->unitcell_index_converter.total_sites(), prim.global_dof_info,
-        prim.local_dof_info);
+    clexulator::ConfigDoFValues prim_dof_values;
+    from_standard_values(prim.dof_basis_info, dof_values,
+                         supercell->unitcell_index_converter.total_sites(),
+                         prim_dof_values);
+    return prim_dof_values;
   }
   return dof_values;
 }
 }  // namespace
 
+/// \brief Read ConfigurationSet from JSON
+///
+/// \param supercells The SupercellSet holding the configurations'
+///     supercells. Supercells that are not already present are added.
+/// \param configurations The ConfigurationSet to read into. It is cleared
+///     first.
+/// \param json The JSON input, in the format written by `to_json`
+/// \param prim The prim
+/// \param n_threads Number of threads used to construct the supercells
+///     that are not already in `supercells`. If <= 0, use the hardware
+///     concurrency.
 void from_json(config::SupercellSet &supercells,
                config::ConfigurationSet &configurations, jsonParser const &json,
-               std::shared_ptr<config::Prim const> const &prim) {
+               std::shared_ptr<config::Prim const> const &prim,
+               Index n_threads) {
   configurations.clear();
 
   auto &log = CASM::log();
@@ -291,9 +304,28 @@ void from_json(config::SupercellSet &supercells,
     report_and_throw_if_invalid(validator, log, error_if_invalid);
   }
 
-  std::map<std::string, config::SupercellRecord const *>
-      index_by_supercell_name =
-          make_index_by_canonical_supercell_name(supercells.data());
+  // find or add all supercells by name, constructing missing supercells
+  // in parallel
+  std::vector<std::string> supercell_names;
+  for (auto it = json["supercells"].begin(); it != json["supercells"].end();
+       ++it) {
+    supercell_names.push_back(it.name());
+  }
+  std::vector<config::SupercellRecord const *> supercell_records;
+  try {
+    supercell_records =
+        insert_canonical_supercells(supercells, supercell_names, n_threads);
+  } catch (std::exception &e) {
+    std::stringstream msg;
+    msg << "Error: could not find or construct supercells by name: "
+        << e.what();
+    validator.error.insert(msg.str());
+  }
+
+  if (!validator.valid()) {
+    log.indent() << "Error reading configurations:" << std::endl;
+    report_and_throw_if_invalid(validator, log, error_if_invalid);
+  }
 
   // read config list contents
   auto scel_it = json["supercells"].begin();
@@ -301,26 +333,10 @@ void from_json(config::SupercellSet &supercells,
 
   clexulator::ConfigDoFValues dof_values;
 
-  for (; scel_it != scel_end; ++scel_it) {
+  for (Index i = 0; scel_it != scel_end; ++scel_it, ++i) {
     auto config_it = scel_it->begin();
     auto config_end = scel_it->end();
-
-    // try to find or add supercell by name
-    config::SupercellRecord const *s = nullptr;
-    try {
-      s = find_or_add_canonical_supercell_by_name(
-          scel_it.name(), supercells.data(), index_by_supercell_name, prim);
-    } catch (std::exception &e) {
-      std::stringstream msg;
-      msg << "Error: could not find or construct supercell '" << scel_it.name()
-          << "' by name: " << e.what();
-      validator.error.insert(msg.str());
-    }
-
-    if (!validator.valid()) {
-      log.indent() << "Error reading configurations:" << std::endl;
-      report_and_throw_if_invalid(validator, log, error_if_invalid);
-    }
+    config::SupercellRecord const *s = supercell_records[i];
 
     // try to construct configurations for supercell
     for (; config_it != config_end; ++config_it) {
@@ -372,7 +388,7 @@ jsonParser &to_json(config::ConfigurationSet const &configurations,
   }
   for (const auto &c : configurations) {
     jsonParser &configjson =
-        json["supercells"][c.supercell_name][c.configuration_id];
+        json["supercells"][c.supercell_name()][c.configuration_id()];
     if (write_prim_basis) {
       to_json(c.configuration.dof_values, configjson["dof"]);
     } else {
@@ -444,7 +460,7 @@ jsonParser &to_json(config::Configuration const &configuration,
   }
   auto const &superlattice = configuration.supercell->superlattice;
   std::string supercell_name = config::make_supercell_name(
-      superlattice.prim_lattice(), superlattice.superlattice());
+      superlattice.transformation_matrix_to_super());
   json["supercell_name"] = supercell_name;
   json["transformation_matrix_to_supercell"] =
       superlattice.transformation_matrix_to_super();
@@ -462,15 +478,14 @@ jsonParser &to_json(config::Configuration const &configuration,
 /// Parse Configuration from JSON with error messages
 ///
 /// Notes:
-/// - This version creates a new Supercell for each Configuration.
-///   Comparisons will still work correctly, but if reading many
-///   Configuration, memory usage will be increased and speed will
-///   be decreased.
+/// - This version does not use a SupercellSet. Supercells are obtained with
+///   `make_shared_supercell`, so Configuration in the same supercell share
+///   a Supercell while it is in use.
 void parse(InputParser<config::Configuration> &parser,
            std::shared_ptr<config::Prim const> const &prim) {
   Eigen::Matrix3l T;
   parser.require(T, "transformation_matrix_to_supercell");
-  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto supercell = config::make_shared_supercell(prim, T);
 
   clexulator::ConfigDoFValues dof_values;
   parser.require(dof_values, "dof");
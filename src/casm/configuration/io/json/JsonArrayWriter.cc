@@ -0,0 +1,112 @@
+#include "casm/configuration/io/json/JsonArrayWriter.hh"
+
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "casm/casm_io/json/jsonParser.hh"
+
+namespace CASM {
+
+namespace {
+
+void _round_numbers(nlohmann::json &json, int precision) {
+  if (json.is_number_float()) {
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%.*g", precision, json.get<double>());
+    json = std::strtod(buf, nullptr);
+  } else if (json.is_array() || json.is_object()) {
+    for (auto &value : json) {
+      _round_numbers(value, precision);
+    }
+  }
+}
+
+}  // namespace
+
+/// \brief Round floating point numbers in a JSON document, in place, to
+///     `precision` significant digits
+///
+/// \param json The JSON document
+/// \param precision Number of significant digits. Must be in [1, 17].
+void round_json_numbers(jsonParser &json, int precision) {
+  if (precision < 1 || precision > 17) {
+    throw std::runtime_error(
+        "Error in round_json_numbers: precision must be in [1, 17]");
+  }
+  _round_numbers(static_cast<nlohmann::json &>(json), precision);
+}
+
+/// \brief Write one JSON value to a stream
+///
+/// \param out The output stream
+/// \param json The value to write
+/// \param options If `options.compact`, the value is written on one line.
+///     If `options.precision` has value, floating point numbers are rounded
+///     first.
+void write_json(std::ostream &out, jsonParser json,
+                JsonStreamOptions const &options) {
+  if (options.precision.has_value()) {
+    round_json_numbers(json, *options.precision);
+  }
+  if (options.compact) {
+    out << static_cast<nlohmann::json const &>(json).dump();
+  } else {
+    out << json;
+  }
+}
+
+/// \brief Constructor, writes the opening bracket
+///
+/// \param out The output stream. Must remain valid until `finish` is
+///     called.
+/// \param options Options for writing each element
+JsonArrayWriter::JsonArrayWriter(std::ostream &out,
+                                 JsonStreamOptions const &options)
+    : m_out(&out), m_options(options), m_size(0), m_finished(false) {
+  *m_out << "[";
+}
+
+/// \brief Destructor, calls `finish` if it has not been called
+JsonArrayWriter::~JsonArrayWriter() {
+  if (!m_finished) {
+    finish();
+  }
+}
+
+/// \brief Write the next element
+void JsonArrayWriter::write(jsonParser json) {
+  if (m_finished) {
+    throw std::runtime_error(
+        "Error in JsonArrayWriter::write: array is already finished");
+  }
+  if (m_size) {
+    *m_out << ",";
+  }
+  if (!m_options.compact) {
+    *m_out << "\n";
+  }
+  write_json(*m_out, std::move(json), m_options);
+  ++m_size;
+}
+
+/// \brief Write the closing bracket
+void JsonArrayWriter::finish() {
+  if (m_finished) {
+    return;
+  }
+  if (m_size && !m_options.compact) {
+    *m_out << "\n";
+  }
+  *m_out << "]";
+  m_out->flush();
+  m_finished = true;
+}
+
+/// \brief Number of elements written
+Index JsonArrayWriter::size() const { return m_size; }
+
+/// \brief The options used to write elements
+JsonStreamOptions const &JsonArrayWriter::options() const { return m_options; }
+
+}  // namespace CASM
@@ -0,0 +1,81 @@
+#include "casm/configuration/io/json/PrimSymInfo_json_io.hh"
+
+#include "casm/casm_io/container/json_io.hh"
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/PrimSymInfo.hh"
+#include "casm/configuration/sym_info/io/json/SymGroup_json_io.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/misc/CASM_math.hh"
+
+namespace CASM {
+
+/// \brief Write PrimSymInfo groups to JSON object
+///
+/// Format:
+/// \code
+/// {
+///   "factor_group": <SymGroup JSON>,
+///   "point_group": <SymGroup JSON>,
+///   "lattice_point_group": <SymGroup JSON>
+/// }
+/// \endcode
+///
+/// The symmetry representations are not written. They are determined by the
+/// factor group and prim, and are constructed again when reading.
+jsonParser &to_json(config::PrimSymInfo const &sym_info, jsonParser &json,
+                    xtal::BasicStructure const &prim) {
+  xtal::Lattice const &lattice = prim.lattice();
+  json = jsonParser::object();
+  to_json(sym_info.factor_group, json["factor_group"], lattice);
+  to_json(sym_info.point_group, json["point_group"], lattice);
+  to_json(sym_info.lattice_point_group, json["lattice_point_group"], lattice);
+  return json;
+}
+
+/// \brief Construct from JSON
+///
+/// The factor group is read from "factor_group", in the order written, and
+/// the other groups and the symmetry representations are constructed from it
+/// as by `PrimSymInfo(factor_group_elements, prim)`. This skips the factor
+/// group search of `PrimSymInfo(prim)`.
+config::PrimSymInfo jsonConstructor<config::PrimSymInfo>::from_json(
+    jsonParser const &json, xtal::BasicStructure const &prim) {
+  if (!json.contains("factor_group")) {
+    throw std::runtime_error(
+        "Error reading PrimSymInfo from JSON: missing factor_group");
+  }
+  return config::PrimSymInfo(symgroup_elements_from_json(json["factor_group"]),
+                             prim);
+}
+
+/// \brief Read factor group elements, in order, from SymGroup JSON
+///
+/// Unlike reading `std::shared_ptr<SymGroup const>`, elements are not sorted
+/// by class, so the order, and the meaning of factor group indices, is kept.
+std::vector<xtal::SymOp> symgroup_elements_from_json(jsonParser const &json) {
+  if (!json.contains("group_operations")) {
+    throw std::runtime_error(
+        "Error reading SymGroup elements from JSON: missing group_operations");
+  }
+  jsonParser const &json_ops = json["group_operations"];
+  Index n_elements = json_ops.size();
+  std::vector<xtal::SymOp> elements;
+  for (Index i = 0; i < n_elements; ++i) {
+    std::string op_name = "op_" + to_sequential_string(i + 1, n_elements);
+    if (!json_ops.contains(op_name)) {
+      throw std::runtime_error(
+          "Error reading SymGroup elements from JSON: missing " + op_name);
+    }
+    jsonParser const &json_cart = json_ops[op_name]["CART"];
+    Eigen::Matrix3d matrix;
+    Eigen::Vector3d translation;
+    bool is_time_reversal_active;
+    from_json(matrix, json_cart["matrix"]);
+    from_json(translation, json_cart["tau"]);
+    from_json(is_time_reversal_active, json_cart["time_reversal"]);
+    elements.emplace_back(matrix, translation, is_time_reversal_active);
+  }
+  return elements;
+}
+
+}  // namespace CASM
@@ -19,7 +19,7 @@ void from_json(std::shared_ptr<config::Supercell const> &supercell,
   Eigen::Matrix3l T;
   parser.require(T, "transformation_matrix_to_supercell");
   report_and_throw_if_invalid(parser, log, error_if_invalid);
-  supercell = std::make_shared<config::Supercell const>(prim, T);
+  supercell = config::make_shared_supercell(prim, T);
 }
 
 void from_json(std::shared_ptr<config::Supercell const> &supercell,
@@ -43,7 +43,7 @@ jsonParser &to_json(std::shared_ptr<config::Supercell const> const &supercell,
   }
   auto const &superlattice = supercell->superlattice;
   std::string supercell_name = config::make_supercell_name(
-      superlattice.prim_lattice(), superlattice.superlattice());
+      superlattice.transformation_matrix_to_super());
   json["supercell_name"] = supercell_name;
   json["transformation_matrix_to_supercell"] =
       superlattice.transformation_matrix_to_super();
@@ -51,8 +51,15 @@ jsonParser &to_json(std::shared_ptr<config::Supercell const> const &supercell,
 }
 
 /// \brief Read SupercellSet from JSON
+///
+/// \param supercells The SupercellSet to read into. It is cleared first.
+/// \param json The JSON input, in the format written by `to_json`
+/// \param prim The prim. Must be the same as `supercells.prim()`.
+/// \param n_threads Number of threads used to construct the supercells.
+///     If <= 0, use the hardware concurrency.
 void from_json(config::SupercellSet &supercells, jsonParser const &json,
-               std::shared_ptr<config::Prim const> const &prim) {
+               std::shared_ptr<config::Prim const> const &prim,
+               Index n_threads) {
   supercells.clear();
 
   std::set<std::string> matching_versions = {"1.0", "2.0"};
@@ -69,13 +76,14 @@ void from_json(config::SupercellSet &supercells, jsonParser const &json,
     throw std::runtime_error("Error reading supercells: invalid format");
   }
 
+  std::vector<Eigen::Matrix3l> matrices;
   if (json.contains("supercells")) {
     auto it = json["supercells"].begin();
     auto end = json["supercells"].end();
     for (; it != end; ++it) {
       Eigen::Matrix3l mat;
       from_json(mat, *it);
-      supercells.insert(std::make_shared<config::Supercell const>(prim, mat));
+      matrices.push_back(mat);
     }
   }
   if (json.contains("non_canonical_supercells")) {
@@ -89,9 +97,10 @@ void from_json(config::SupercellSet &supercells, jsonParser const &json,
       }
       Eigen::Matrix3l mat;
       from_json(mat, (*it)["transformation_matrix_to_supercell"]);
-      supercells.insert(std::make_shared<config::Supercell const>(prim, mat));
+      matrices.push_back(mat);
     }
   }
+  config::insert_supercells(supercells, matrices, n_threads);
 }
 
 /// \brief Write SupercellSet to JSON (version 2.0)
@@ -0,0 +1,74 @@
+#include "casm/configuration/io/json/memory_usage_json_io.hh"
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/SupercellSet.hh"
+
+namespace CASM {
+
+/// \brief Write SupercellMemoryUsage to JSON
+///
+/// Format:
+/// \code
+/// {
+///   "n_sites": <int>,
+///   "factor_group_bytes": <int>,
+///   "factor_group_permutations_bytes": <int>,
+///   "n_translation_permutations": <int>,
+///   "translation_permutations_bytes": <int>,
+///   "translation_permutation_cache_bytes": <int>,
+///   "site_data_bytes": <int>,
+///   "combined_permutation_table_bytes": <int>,
+///   "other_bytes": <int>,
+///   "total_bytes": <int>
+/// }
+/// \endcode
+jsonParser &to_json(config::SupercellMemoryUsage const &usage,
+                    jsonParser &json) {
+  json.put_obj();
+  json["n_sites"] = usage.n_sites;
+  json["factor_group_bytes"] = usage.sym_info.factor_group_bytes;
+  json["factor_group_permutations_bytes"] =
+      usage.sym_info.factor_group_permutations_bytes;
+  json["n_translation_permutations"] =
+      usage.sym_info.n_translation_permutations;
+  json["translation_permutations_bytes"] =
+      usage.sym_info.translation_permutations_bytes;
+  json["translation_permutation_cache_bytes"] =
+      usage.sym_info.translation_permutation_cache_bytes;
+  json["site_data_bytes"] = usage.site_data_bytes;
+  json["combined_permutation_table_bytes"] =
+      usage.combined_permutation_table_bytes;
+  json["other_bytes"] = usage.sym_info.other_bytes + usage.other_bytes;
+  json["total_bytes"] = usage.total_bytes();
+  return json;
+}
+
+/// \brief Write SupercellSetMemoryUsage to JSON
+///
+/// Format:
+/// \code
+/// {
+///   "supercells": [
+///     {"supercell_name": <str>, <SupercellMemoryUsage JSON values>},
+///     ...
+///   ],
+///   "records_bytes": <int>,
+///   "total_bytes": <int>
+/// }
+/// \endcode
+jsonParser &to_json(config::SupercellSetMemoryUsage const &usage,
+                    jsonParser &json) {
+  json.put_obj();
+  json["supercells"].put_array();
+  for (auto const &pair : usage.supercells) {
+    jsonParser supercell_json;
+    to_json(pair.second, supercell_json);
+    supercell_json["supercell_name"] = pair.first;
+    json["supercells"].push_back(supercell_json);
+  }
+  json["records_bytes"] = usage.records_bytes;
+  json["total_bytes"] = usage.total_bytes();
+  return json;
+}
+
+}  // namespace CASM
@@ -0,0 +1,35 @@
+#include "casm/configuration/io/json/perf_json_io.hh"
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/perf.hh"
+
+namespace CASM {
+
+/// \brief Write PerfReport to JSON
+///
+/// Format:
+/// \code
+/// {
+///   "enabled": <bool>,
+///   "counters": { <name>: <int>, ... },
+///   "timers": { <name>: {"count": <int>, "total_s": <float>}, ... }
+/// }
+/// \endcode
+jsonParser &to_json(config::perf::PerfReport const &report, jsonParser &json) {
+  json.put_obj();
+  json["enabled"] = report.enabled;
+  json["counters"].put_obj();
+  for (auto const &pair : report.counters) {
+    json["counters"][pair.first] = pair.second;
+  }
+  json["timers"].put_obj();
+  for (auto const &pair : report.timers) {
+    jsonParser &timer_json = json["timers"][pair.first];
+    timer_json.put_obj();
+    timer_json["count"] = pair.second.count;
+    timer_json["total_s"] = pair.second.total_s;
+  }
+  return json;
+}
+
+}  // namespace CASM
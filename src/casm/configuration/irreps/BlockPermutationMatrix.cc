@@ -0,0 +1,95 @@
+#include "casm/configuration/irreps/BlockPermutationMatrix.hh"
+
+#include <stdexcept>
+
+namespace CASM {
+namespace irreps {
+
+/// \brief Constructor
+///
+/// \param _block_offset Beginning row (or column) of each block, followed
+///     by the total number of rows. Must begin with 0 and be non-decreasing.
+/// \param _block_permutation Block column of the non-zero block in each
+///     block row. Must be a permutation of `[0, n_blocks)`.
+/// \param _blocks Non-zero block in each block row. `_blocks[i]` must have
+///     shape `(block_dim(i), block_dim(_block_permutation[i]))`.
+BlockPermutationMatrix::BlockPermutationMatrix(
+    std::vector<Index> _block_offset, std::vector<Index> _block_permutation,
+    std::vector<Eigen::MatrixXd> _blocks)
+    : block_offset(std::move(_block_offset)),
+      block_permutation(std::move(_block_permutation)),
+      blocks(std::move(_blocks)) {
+  Index n = blocks.size();
+  if (Index(block_offset.size()) != n + 1 ||
+      Index(block_permutation.size()) != n) {
+    throw std::runtime_error(
+        "Error in BlockPermutationMatrix: inconsistent number of blocks");
+  }
+  if (block_offset[0] != 0) {
+    throw std::runtime_error(
+        "Error in BlockPermutationMatrix: block_offset[0] != 0");
+  }
+  std::vector<bool> found(n, false);
+  for (Index i = 0; i < n; ++i) {
+    if (block_dim(i) < 0) {
+      throw std::runtime_error(
+          "Error in BlockPermutationMatrix: block_offset is decreasing");
+    }
+    Index j = block_permutation[i];
+    if (j < 0 || j >= n || found[j]) {
+      throw std::runtime_error(
+          "Error in BlockPermutationMatrix: block_permutation is not a "
+          "permutation");
+    }
+    found[j] = true;
+    if (blocks[i].rows() != block_dim(i) || blocks[i].cols() != block_dim(j)) {
+      throw std::runtime_error(
+          "Error in BlockPermutationMatrix: block has incorrect shape");
+    }
+  }
+}
+
+/// \brief Return the product of this matrix and `X`, without constructing
+///     the dense matrix
+///
+/// \param X A matrix (or vector) with `X.rows() == cols()`
+///
+/// \returns The product, with shape `(rows(), X.cols())`. The cost is
+///     `O(sum_i block_dim(i)^2 * X.cols())`.
+Eigen::MatrixXd BlockPermutationMatrix::operator*(
+    Eigen::MatrixXd const &X) const {
+  if (X.rows() != cols()) {
+    throw std::runtime_error(
+        "Error in BlockPermutationMatrix::operator*: dimension mismatch");
+  }
+  Eigen::MatrixXd result(rows(), X.cols());
+  for (Index i = 0; i < n_blocks(); ++i) {
+    Index j = block_permutation[i];
+    result.middleRows(block_offset[i], block_dim(i)) =
+        blocks[i] * X.middleRows(block_offset[j], block_dim(j));
+  }
+  return result;
+}
+
+/// \brief Construct the dense matrix
+Eigen::MatrixXd BlockPermutationMatrix::to_dense() const {
+  Eigen::MatrixXd result = Eigen::MatrixXd::Zero(rows(), cols());
+  for (Index i = 0; i < n_blocks(); ++i) {
+    Index j = block_permutation[i];
+    result.block(block_offset[i], block_offset[j], block_dim(i),
+                 block_dim(j)) = blocks[i];
+  }
+  return result;
+}
+
+/// \brief Construct the dense matrix representation
+MatrixRep to_dense(BlockPermutationMatrixRep const &rep) {
+  MatrixRep result;
+  for (BlockPermutationMatrix const &M : rep) {
+    result.push_back(M.to_dense());
+  }
+  return result;
+}
+
+}  // namespace irreps
+}  // namespace CASM
@@ -10,6 +10,7 @@
 #include "casm/casm_io/json/jsonParser.hh"
 #include "casm/configuration/irreps/io/json/IrrepDecomposition_json_io.hh"
 #include "casm/configuration/irreps/misc.hh"
+#include "casm/configuration/trace.hh"
 
 namespace CASM {
 
@@ -103,15 +104,122 @@ Eigen::MatrixXd full_trans_mat(std::vector<IrrepInfo> const &irreps) {
 ///     _cyclic_subgroups fails.
 /// \param allow_complex If true, all irreps may be complex-valued, if false,
 ///     complex irreps are combined to form real representations
+/// \param _log If has value, log progress
+/// \param n_threads Number of threads used to construct commuter matrices in
+///     `irrep_decomposition` and to find special directions in
+///     `make_irrep_special_directions`. If `n_threads <= 0`, use the number of
+///     threads set by `config::set_num_threads`. The result does not depend on
+///     `n_threads`.
 ///
 IrrepDecomposition::IrrepDecomposition(
     MatrixRep const &_fullspace_rep, GroupIndices const &_head_group,
     Eigen::MatrixXd const &init_subspace,
     std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
     std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
-    bool allow_complex, std::optional<Log> _log)
+    bool allow_complex, std::optional<Log> _log, Index n_threads)
     : fullspace_rep(_fullspace_rep), head_group(_head_group), log(_log) {
+  _decompose(fullspace_rep, init_subspace, make_cyclic_subgroups_f,
+             make_all_subgroups_f, allow_complex, n_threads);
+}
+
+/// IrrepDecomposition constructor, using a block permutation matrix rep
+///
+/// Equivalent to the constructor with `to_dense(_fullspace_rep)`, but the
+/// invariant subspace and the subspace matrix representations are
+/// constructed by applying `_fullspace_rep` without dense matrices, which
+/// is much faster when the full space is large. The block rep is stored as
+/// `fullspace_block_rep`, and `fullspace_rep` is left empty. Wedge
+/// construction applies the block rep, and reports densify it one element
+/// at a time.
+IrrepDecomposition::IrrepDecomposition(
+    BlockPermutationMatrixRep const &_fullspace_rep,
+    GroupIndices const &_head_group, Eigen::MatrixXd const &init_subspace,
+    std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
+    std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
+    bool allow_complex, std::optional<Log> _log, Index n_threads)
+    : fullspace_block_rep(_fullspace_rep), head_group(_head_group), log(_log) {
+  _decompose(_fullspace_rep, init_subspace, make_cyclic_subgroups_f,
+             make_all_subgroups_f, allow_complex, n_threads);
+}
+
+/// IrrepDecomposition constructor, using irreps that are already found
+///
+/// For combining decompositions found separately in invariant subspaces,
+/// as by `dof_space_analysis` with `use_kpoint_blocks`.
+///
+/// \param _fullspace_rep Full space matrix representation. May be empty,
+///     in which case the result may not be used to construct irreducible
+///     wedges, and `vector_space_sym_report` gives an empty `symgroup_rep`.
+/// \param _head_group Group used to find the irreps
+/// \param _subspace Invariant subspace spanned by the irreps
+/// \param _irreps Irreps, with full space dimension, with irreps that have
+///     identical characters adjacent and indexed in order
+/// \param _log If has value, log progress
+IrrepDecomposition::IrrepDecomposition(MatrixRep const &_fullspace_rep,
+                                       GroupIndices const &_head_group,
+                                       Eigen::MatrixXd const &_subspace,
+                                       std::vector<IrrepInfo> const &_irreps,
+                                       std::optional<Log> _log)
+    : fullspace_rep(_fullspace_rep),
+      head_group(_head_group),
+      subspace(_subspace),
+      irreps(_irreps),
+      symmetry_adapted_subspace(full_trans_mat(irreps).adjoint()),
+      log(_log) {}
+
+/// IrrepDecomposition constructor, using irreps that are already found
+/// and a block permutation matrix rep
+///
+/// As the constructor taking a dense `_fullspace_rep`, but the rep is
+/// stored as `fullspace_block_rep`, and `fullspace_rep` is left empty.
+IrrepDecomposition::IrrepDecomposition(
+    BlockPermutationMatrixRep const &_fullspace_rep,
+    GroupIndices const &_head_group, Eigen::MatrixXd const &_subspace,
+    std::vector<IrrepInfo> const &_irreps, std::optional<Log> _log)
+    : fullspace_block_rep(_fullspace_rep),
+      head_group(_head_group),
+      subspace(_subspace),
+      irreps(_irreps),
+      symmetry_adapted_subspace(full_trans_mat(irreps).adjoint()),
+      log(_log) {}
+
+/// \brief Return true if `fullspace_rep` or `fullspace_block_rep` is
+///     stored
+bool IrrepDecomposition::has_fullspace_rep() const {
+  return !fullspace_rep.empty() || fullspace_block_rep.has_value();
+}
+
+/// \brief Return the product of the full space matrix representation of
+///     element `element_index` and `X`
+///
+/// The block rep, if stored, is applied without constructing the dense
+/// matrix.
+Eigen::MatrixXd IrrepDecomposition::apply_fullspace_rep(
+    Index element_index, Eigen::MatrixXd const &X) const {
+  if (fullspace_block_rep.has_value()) {
+    return fullspace_block_rep->at(element_index) * X;
+  }
+  return fullspace_rep.at(element_index) * X;
+}
+
+/// \brief Return the dense full space matrix representation of element
+///     `element_index`
+Eigen::MatrixXd IrrepDecomposition::make_fullspace_matrix(
+    Index element_index) const {
+  if (fullspace_block_rep.has_value()) {
+    return fullspace_block_rep->at(element_index).to_dense();
+  }
+  return fullspace_rep.at(element_index);
+}
+
+template <typename RepType>
+void IrrepDecomposition::_decompose(
+    RepType const &rep, Eigen::MatrixXd const &init_subspace,
+    std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
+    std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
+    bool allow_complex, Index n_threads) {
   using namespace IrrepDecompositionImpl;
+  CASM_CONFIGURATION_TRACE_SCOPE("IrrepDecomposition");
 
   if (log.has_value()) {
     log->begin<Log::verbose>("IrrepDecomposition");
@@ -119,10 +227,13 @@ IrrepDecomposition::IrrepDecomposition(
     prettyp<Log::verbose>(*log, "1. Initial vector space", init_subspace);
   }
 
-  Index dim = fullspace_rep[0].rows();
+  Index dim = rep[0].rows();
 
   // 1) Expand subspace by application of group, and orthonormalization
-  subspace = make_invariant_space(fullspace_rep, head_group, init_subspace);
+  {
+    CASM_CONFIGURATION_TRACE_SCOPE("IrrepDecomposition.make_invariant_space");
+    subspace = make_invariant_space(rep, head_group, init_subspace);
+  }
   if (log.has_value()) {
     prettyp<Log::verbose>(*log, "2. Initial invariant vector space", subspace);
   }
@@ -140,10 +251,13 @@ IrrepDecomposition::IrrepDecomposition(
       log->indent() << "-- Begin step " << i << " --" << std::endl;
     }
 
+    CASM_CONFIGURATION_TRACE_SCOPE("IrrepDecomposition.step");
+
     // Irreps are found in a subspace specified via the subspace matrix rep
-    MatrixRep subspace_rep_i = make_subspace_rep(fullspace_rep, subspace_i);
+    MatrixRep subspace_rep_i = make_subspace_rep(rep, subspace_i);
     std::vector<IrrepInfo> subspace_irreps_i =
-        irrep_decomposition(subspace_rep_i, head_group, allow_complex);
+        irrep_decomposition(subspace_rep_i, head_group, allow_complex,
+                            n_threads);
     if (log.has_value()) {
       print_irreps<Log::verbose>(*log, "Irreps, as found", subspace_irreps_i);
     }
@@ -157,9 +271,14 @@ IrrepDecomposition::IrrepDecomposition(
     }
 
     // Symmetrize all the irreps that were found
-    std::vector<IrrepInfo> symmetrized_subspace_irreps_i =
-        symmetrize_irreps(subspace_rep_i, head_group, subspace_irreps_i,
-                          make_cyclic_subgroups_f, make_all_subgroups_f);
+    std::vector<IrrepInfo> symmetrized_subspace_irreps_i;
+    {
+      CASM_CONFIGURATION_TRACE_SCOPE("IrrepDecomposition.symmetrize_irreps");
+      symmetrized_subspace_irreps_i =
+          symmetrize_irreps(subspace_rep_i, head_group, subspace_irreps_i,
+                            make_cyclic_subgroups_f, make_all_subgroups_f,
+                            n_threads);
+    }
     if (log.has_value()) {
       print_irreps<Log::verbose>(*log, "Irreps, symmetrized",
                                  subspace_irreps_i);
@@ -0,0 +1,140 @@
+#include "casm/configuration/irreps/IrrepDecompositionCache.hh"
+
+#include <cmath>
+
+#include "casm/configuration/hash.hh"
+#include "casm/configuration/irreps/IrrepDecomposition.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+
+namespace CASM {
+namespace irreps {
+
+namespace {
+
+/// \brief Hash of values rounded to a multiple of `tol`
+void _hash_quantized(std::size_t &seed, Eigen::MatrixXd const &M, double tol) {
+  hash_combine(seed, M.rows());
+  hash_combine(seed, M.cols());
+  for (Index i = 0; i < M.size(); ++i) {
+    hash_combine(seed, std::hash<long long>()(std::llround(M(i) / tol)));
+  }
+}
+
+bool _is_equal(Eigen::MatrixXd const &A, Eigen::MatrixXd const &B,
+               double tol) {
+  return A.rows() == B.rows() && A.cols() == B.cols() &&
+         CASM::almost_equal(A, B, tol);
+}
+
+}  // namespace
+
+/// \brief Constructor
+///
+/// \param _tol Tolerance used to compare matrix representations and initial
+///     subspaces
+IrrepDecompositionCache::IrrepDecompositionCache(double _tol) : m_tol(_tol) {}
+
+/// \brief Return a stored IrrepDecomposition with the same inputs, or
+///     construct, store, and return a new IrrepDecomposition
+///
+/// Parameters are as for the IrrepDecomposition constructor. If a stored
+/// result is returned, `log` and `n_threads` are not used.
+///
+/// The lock is not held while a new IrrepDecomposition is constructed, so
+/// concurrent calls with the same inputs may each construct it. Only the
+/// first result stored is kept and returned.
+std::shared_ptr<IrrepDecomposition const> IrrepDecompositionCache::make(
+    MatrixRep const &fullspace_rep, GroupIndices const &head_group,
+    Eigen::MatrixXd const &init_subspace,
+    std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
+    std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
+    bool allow_complex, std::optional<Log> log, Index n_threads) {
+  std::size_t key =
+      _hash(fullspace_rep, head_group, init_subspace, allow_complex);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found =
+        _find(key, fullspace_rep, head_group, init_subspace, allow_complex);
+    if (found) {
+      return found;
+    }
+  }
+
+  auto result = std::make_shared<IrrepDecomposition const>(
+      fullspace_rep, head_group, init_subspace, make_cyclic_subgroups_f,
+      make_all_subgroups_f, allow_complex, log, n_threads);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto found =
+      _find(key, fullspace_rep, head_group, init_subspace, allow_complex);
+  if (found) {
+    return found;
+  }
+  m_entries.emplace(key, Entry{init_subspace, allow_complex, result});
+  return result;
+}
+
+/// \brief Tolerance used to compare inputs
+double IrrepDecompositionCache::tol() const { return m_tol; }
+
+/// \brief Number of stored results
+Index IrrepDecompositionCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Erase stored results
+void IrrepDecompositionCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+std::size_t IrrepDecompositionCache::_hash(
+    MatrixRep const &fullspace_rep, GroupIndices const &head_group,
+    Eigen::MatrixXd const &init_subspace, bool allow_complex) const {
+  std::size_t seed = fullspace_rep.size();
+  for (Eigen::MatrixXd const &M : fullspace_rep) {
+    _hash_quantized(seed, M, m_tol);
+  }
+  hash_combine(seed, head_group.size());
+  for (Index i : head_group) {
+    hash_combine(seed, std::hash<Index>()(i));
+  }
+  _hash_quantized(seed, init_subspace, m_tol);
+  hash_combine(seed, allow_complex);
+  return seed;
+}
+
+/// \brief Return the stored result with the given inputs, or nullptr
+///
+/// Requires the lock to be held.
+std::shared_ptr<IrrepDecomposition const> IrrepDecompositionCache::_find(
+    std::size_t key, MatrixRep const &fullspace_rep,
+    GroupIndices const &head_group, Eigen::MatrixXd const &init_subspace,
+    bool allow_complex) const {
+  auto range = m_entries.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    Entry const &entry = it->second;
+    IrrepDecomposition const &result = *entry.result;
+    if (entry.allow_complex != allow_complex ||
+        result.head_group != head_group ||
+        result.fullspace_rep.size() != fullspace_rep.size() ||
+        !_is_equal(entry.init_subspace, init_subspace, m_tol)) {
+      continue;
+    }
+    bool is_equal_rep = true;
+    for (Index i = 0; i < fullspace_rep.size(); ++i) {
+      if (!_is_equal(result.fullspace_rep[i], fullspace_rep[i], m_tol)) {
+        is_equal_rep = false;
+        break;
+      }
+    }
+    if (is_equal_rep) {
+      return entry.result;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace irreps
+}  // namespace CASM
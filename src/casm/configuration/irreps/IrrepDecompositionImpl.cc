@@ -1,8 +1,10 @@
 #include "casm/configuration/irreps/IrrepDecompositionImpl.hh"
 
+#include <cmath>
 #include <iostream>
 
 #include "casm/configuration/irreps/Symmetrizer.hh"
+#include "casm/configuration/parallel.hh"
 #include "casm/configuration/irreps/to_real.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
 #include "casm/misc/CASM_math.hh"
@@ -68,6 +70,12 @@ bool CommuterParamsCounter::increment() {
   return true;
 }
 
+/// Make a commuter matrix
+///
+/// The matrix rep is real, so the Reynolds operation is applied to the real
+/// and imaginary parts of the initial matrix separately using real
+/// arithmetic. The imaginary part is skipped if it is zero, as it is for
+/// real kernel columns and phase.
 Eigen::MatrixXcd make_commuter(CommuterParamsCounter const &params,
                                MatrixRep const &rep,
                                GroupIndices const &head_group,
@@ -82,12 +90,23 @@ Eigen::MatrixXcd make_commuter(CommuterParamsCounter const &params,
   auto const &phase = params.phase;
   Eigen::MatrixXcd M_init = phase * col_i * col_j.adjoint() +
                             std::conj(phase) * col_j * col_i.adjoint();
-  Eigen::MatrixXcd M = complex_Zero(dim, dim);
+  Eigen::MatrixXd M_init_real = M_init.real();
+  Eigen::MatrixXd M_init_imag = M_init.imag();
+  bool is_real = M_init_imag.isZero(0.0);
+  Eigen::MatrixXd M_real = real_Zero(dim, dim);
+  Eigen::MatrixXd M_imag = real_Zero(dim, dim);
 
   // Reynolds operation to symmetrize:
   for (Index element_index : head_group) {
-    M += rep[element_index] * M_init * rep[element_index].transpose();
+    Eigen::MatrixXd const &R = rep[element_index];
+    M_real.noalias() += R * M_init_real * R.transpose();
+    if (!is_real) {
+      M_imag.noalias() += R * M_init_imag * R.transpose();
+    }
   }
+  Eigen::MatrixXcd M(dim, dim);
+  M.real() = M_real;
+  M.imag() = M_imag;
   return M;
 }
 
@@ -404,6 +423,9 @@ bool PossibleIrrep::operator<(PossibleIrrep const &other) const {
 /// and construct matrix representation that acts on vectors in the K*V basis,
 /// which will be block diagonalized and sorted by eigenvalue. Each block
 /// corresponds to a possible irrep, which can be checked by characters value.
+///
+/// If K and M are real, the eigenvalue decomposition and transformation of
+/// the matrix rep are done using real arithmetic.
 std::vector<PossibleIrrep> make_possible_irreps(
     Eigen::MatrixXcd const &commuter, Eigen::MatrixXcd const &kernel,
     MatrixRep const &rep, GroupIndices const &head_group, double is_irrep_tol,
@@ -415,24 +437,49 @@ std::vector<PossibleIrrep> make_possible_irreps(
   //    dim^(3/2) * kernel.adjoint() * M * kernel
   //
   double dim = kernel.rows();
-  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXcd> esolve;
   double scale = dim * sqrt(dim);
-  esolve.compute(scale * kernel.adjoint() * commuter * kernel);
-  Eigen::MatrixXd eigenvalues = esolve.eigenvalues();
-  Eigen::MatrixXcd KV_matrix = kernel * esolve.eigenvectors();
-
-  // Columns of KV_matrix are orthonormal eigenvectors of commuter in terms of
-  // natural basis (they were calculated in terms of kernel as basis)
-
-  // When the matrix representation is transformed to operate on coordinates
-  // with KV_matrix basis, it becomes block diagonalized
+  Eigen::MatrixXd eigenvalues;
+  Eigen::MatrixXcd KV_matrix;
   std::vector<Eigen::MatrixXcd> transformed_rep;
   transformed_rep.reserve(head_group.size());
-  for (auto const &element_index : head_group) {
-    transformed_rep.push_back(KV_matrix.adjoint() * rep[element_index] *
-                              KV_matrix);
+
+  if (kernel.imag().isZero(0.0) && commuter.imag().isZero(0.0)) {
+    Eigen::MatrixXd kernel_real = kernel.real();
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> esolve;
+    esolve.compute(scale * kernel_real.transpose() * commuter.real() *
+                   kernel_real);
+    eigenvalues = esolve.eigenvalues();
+    Eigen::MatrixXd KV_matrix_real = kernel_real * esolve.eigenvectors();
+    KV_matrix = KV_matrix_real.cast<std::complex<double>>();
+
+    // When the matrix representation is transformed to operate on coordinates
+    // with KV_matrix basis, it becomes block diagonalized
+    for (auto const &element_index : head_group) {
+      Eigen::MatrixXd transformed = KV_matrix_real.transpose() *
+                                    rep[element_index] * KV_matrix_real;
+      transformed_rep.push_back(transformed.cast<std::complex<double>>());
+    }
+  } else {
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXcd> esolve;
+    esolve.compute(scale * kernel.adjoint() * commuter * kernel);
+    eigenvalues = esolve.eigenvalues();
+    KV_matrix = kernel * esolve.eigenvectors();
+
+    // When the matrix representation is transformed to operate on coordinates
+    // with KV_matrix basis, it becomes block diagonalized
+    Eigen::MatrixXd KV_matrix_real = KV_matrix.real();
+    Eigen::MatrixXd KV_matrix_imag = KV_matrix.imag();
+    Eigen::MatrixXcd R_KV(KV_matrix.rows(), KV_matrix.cols());
+    for (auto const &element_index : head_group) {
+      R_KV.real() = rep[element_index] * KV_matrix_real;
+      R_KV.imag() = rep[element_index] * KV_matrix_imag;
+      transformed_rep.push_back(KV_matrix.adjoint() * R_KV);
+    }
   }
 
+  // Columns of KV_matrix are orthonormal eigenvectors of commuter in terms of
+  // natural basis (they were calculated in terms of kernel as basis)
+
   // make possible irreps:
   // - The possible irrep corresponds to a range eigenvectors with equal
   //   eigenvalues, could be irrep or could be reducible with degenerate
@@ -517,17 +564,64 @@ IrrepInfo subspace_to_full_space(IrrepInfo const &subspace_irrep,
   return result;
 }
 
+/// Calculate characters of the head group elements
+///
+/// \returns characters, where `characters(i)` is the character of
+///     `rep[*std::next(head_group.begin(), i)]`
+Eigen::VectorXd make_head_group_characters(MatrixRep const &rep,
+                                           GroupIndices const &head_group) {
+  Eigen::VectorXd characters(head_group.size());
+  Index i = 0;
+  for (Index element_index : head_group) {
+    characters(i) = rep[element_index].trace();
+    ++i;
+  }
+  return characters;
+}
+
+/// Calculate the sum of squared irrep multiplicities from characters
+///
+/// For a representation that decomposes into irreps with multiplicities
+/// `m_i`, `sum_i m_i^2 = |characters|^2 / head_group_size`. It is 1 if and
+/// only if the representation is irreducible.
+Index make_sum_of_squared_multiplicities(Eigen::VectorXd const &characters,
+                                         Index head_group_size) {
+  return std::lround(make_squared_norm(characters) / head_group_size);
+}
+
 /// Check if a representation is irreducible
 ///
 /// A representation is irreducible if the squared norm of the characters
 /// equals the group size
 bool is_irrep(MatrixRep const &rep, GroupIndices const &head_group) {
-  double characters_squared_norm = 0;
+  double characters_squared_norm =
+      make_squared_norm(make_head_group_characters(rep, head_group));
+  return almost_equal(characters_squared_norm, double(head_group.size()), TOL);
+}
+
+/// Make the possible irrep spanning all of `kernel`
+///
+/// The kernel is the orthogonal complement of the already found irreps, so
+/// it is an invariant subspace and the possible irrep is block diagonal. It
+/// is an irrep if the characters of `rep` restricted to the kernel have
+/// squared norm equal to the head group size. This is checked before
+/// searching for commuters, which is not necessary when only one irrep
+/// remains.
+PossibleIrrep make_kernel_possible_irrep(Eigen::MatrixXcd const &kernel,
+                                         MatrixRep const &rep,
+                                         GroupIndices const &head_group,
+                                         double is_irrep_tol,
+                                         bool allow_complex) {
+  std::vector<Eigen::MatrixXcd> transformed_rep;
+  transformed_rep.reserve(head_group.size());
   for (Index element_index : head_group) {
-    double character = rep[element_index].trace();
-    characters_squared_norm += character * character;
+    transformed_rep.push_back(
+        kernel.adjoint() *
+        rep[element_index].cast<std::complex<double>>() * kernel);
   }
-  return almost_equal(characters_squared_norm, double(head_group.size()), TOL);
+  Eigen::VectorXd eigenvalues = Eigen::VectorXd::Zero(kernel.cols());
+  return PossibleIrrep(eigenvalues, kernel, transformed_rep, head_group.size(),
+                       is_irrep_tol, allow_complex, 0, kernel.cols());
 }
 
 /// IrrepDecomposition proceeds by constructing "commuters", M_k, which commute
@@ -612,6 +706,11 @@ bool is_irrep(MatrixRep const &rep, GroupIndices const &head_group) {
 /// \param allow_complex If true, irreducible space basis vectors may be
 ///     complex-valued. If false, complex irreps are combined to form real
 ///     representations
+/// \param n_threads Number of threads used to construct commuter matrices. If
+///     `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`. With more than one thread, the commuters for
+///     the next `n_threads` commuter parameters are constructed in parallel and
+///     then checked in order, so the result does not depend on `n_threads`.
 ///
 /// \result vector of IrrepInfo objects. Irreps are ordered by dimension, with
 ///     identity first (if present).  Repeated irreps (with equal character
@@ -619,7 +718,8 @@ bool is_irrep(MatrixRep const &rep, GroupIndices const &head_group) {
 ///
 std::vector<IrrepInfo> irrep_decomposition(MatrixRep const &rep,
                                            GroupIndices const &head_group,
-                                           bool allow_complex) {
+                                           bool allow_complex,
+                                           Index n_threads) {
   if (!rep.size()) {
     return std::vector<IrrepInfo>();
   }
@@ -648,6 +748,24 @@ std::vector<IrrepInfo> irrep_decomposition(MatrixRep const &rep,
 
   double is_irrep_tol = TOL;
 
+  // character pre-pass: if the sum of squared irrep multiplicities is 1, the
+  // representation is irreducible and no commuters are needed
+  Eigen::VectorXd characters = make_head_group_characters(rep, head_group);
+  if (make_sum_of_squared_multiplicities(characters, head_group.size()) == 1) {
+    PossibleIrrep possible_irrep = make_kernel_possible_irrep(
+        kernel, rep, head_group, is_irrep_tol, allow_complex);
+    if (possible_irrep.is_irrep) {
+      irreps.insert(possible_irrep);
+      return make_irrep_info(irreps);
+    }
+  }
+
+  // commuters for up to `batch_size` consecutive commuter params are made in
+  // parallel, then checked in order
+  Index batch_size = config::resolve_n_threads(n_threads, 2 * dim * dim);
+  std::vector<CommuterParamsCounter> batch_params;
+  std::vector<Eigen::MatrixXcd> batch_commuters;
+
   do {  // while adapated_subspace.cols() != dim
 
     if (!commuter_params.valid()) {
@@ -657,51 +775,84 @@ std::vector<IrrepInfo> irrep_decomposition(MatrixRep const &rep,
       break;
     }
 
-    // make next commuter, M, and check if not zero
-    Eigen::MatrixXcd commuter =
-        make_commuter(commuter_params, rep, head_group, kernel);
-
-    if (almost_equal(frobenius_product(commuter).real(), 0., TOL)) {
-      commuter_params.increment();
-      continue;
+    // make next commuters, M
+    batch_params.clear();
+    CommuterParamsCounter next_params = commuter_params;
+    while (next_params.valid() && Index(batch_params.size()) < batch_size) {
+      batch_params.push_back(next_params);
+      next_params.increment();
     }
+    batch_commuters.resize(batch_params.size());
+    config::parallel_for_chunks(
+        batch_params.size(), batch_size, [&](Index begin, Index end) {
+          for (Index b = begin; b < end; ++b) {
+            batch_commuters[b] =
+                make_commuter(batch_params[b], rep, head_group, kernel);
+          }
+        });
+
+    for (Eigen::MatrixXcd const &commuter : batch_commuters) {
+      // check if commuter is not zero
+      if (almost_equal(frobenius_product(commuter).real(), 0., TOL)) {
+        commuter_params.increment();
+        continue;
+      }
 
-    // make possible irreps:
-    //
-    // Given kernel, K, and commuter matrix, M, perform eigenvalue decomposition
-    //     K.adjoint() * M * K = V * D * V.inverse()
-    // and construct matrix representation that acts on vectors in the K*V
-    // basis, which will be block diagonalized and sorted by eigenvalue. Each
-    // block corresponds to a possible irrep, which can be checked by its
-    // characters. The columns in K*V corresponding to an irrep are the irrep
-    // subspace.
-    std::vector<PossibleIrrep> possible_irreps = make_possible_irreps(
-        commuter, kernel, rep, head_group, is_irrep_tol, allow_complex);
-
-    // save any possible irrep that:
-    // - i) is an irrep,
-    // - and ii) extends the adapted_subspace space (BP: not necessary?)
-    bool any_new_irreps = false;
-    for (auto const &possible_irrep : possible_irreps) {
-      if (possible_irrep.is_irrep &&
-          is_extended_by(adapted_subspace, possible_irrep.subspace)) {
-        irreps.insert(possible_irrep);
-        adapted_subspace = extend(adapted_subspace, possible_irrep.subspace);
-        any_new_irreps = true;
+      // make possible irreps:
+      //
+      // Given kernel, K, and commuter matrix, M, perform eigenvalue
+      // decomposition
+      //     K.adjoint() * M * K = V * D * V.inverse()
+      // and construct matrix representation that acts on vectors in the K*V
+      // basis, which will be block diagonalized and sorted by eigenvalue. Each
+      // block corresponds to a possible irrep, which can be checked by its
+      // characters. The columns in K*V corresponding to an irrep are the
+      // irrep subspace.
+      std::vector<PossibleIrrep> possible_irreps = make_possible_irreps(
+          commuter, kernel, rep, head_group, is_irrep_tol, allow_complex);
+
+      // save any possible irrep that:
+      // - i) is an irrep,
+      // - and ii) extends the adapted_subspace space (BP: not necessary?)
+      bool any_new_irreps = false;
+      for (auto const &possible_irrep : possible_irreps) {
+        if (possible_irrep.is_irrep &&
+            is_extended_by(adapted_subspace, possible_irrep.subspace)) {
+          irreps.insert(possible_irrep);
+          adapted_subspace = extend(adapted_subspace, possible_irrep.subspace);
+          any_new_irreps = true;
+        }
       }
-    }
 
-    // if any new irreps were found, recalculate kernel, reset commuter params
-    // counter, and go again
-    if (any_new_irreps && adapted_subspace.cols() != dim) {
-      kernel = make_kernel(adapted_subspace);
-      commuter_params.reset(kernel);
-      if (kernel.cols() + adapted_subspace.cols() != adapted_subspace.rows()) {
-        throw std::runtime_error(
-            "Unknown error finding irreps: dimension mismatch");
+      // if any new irreps were found, recalculate kernel, reset commuter
+      // params counter, and go again, discarding the rest of the batch
+      if (any_new_irreps && adapted_subspace.cols() != dim) {
+        kernel = make_kernel(adapted_subspace);
+        commuter_params.reset(kernel);
+        if (kernel.cols() + adapted_subspace.cols() !=
+            adapted_subspace.rows()) {
+          throw std::runtime_error(
+              "Unknown error finding irreps: dimension mismatch");
+        }
+
+        // if the rest of the space is one irrep, take it without
+        // searching for commuters (a complex kernel is only used directly if
+        // complex irreps are allowed, so real irreps are made as before)
+        if (allow_complex || kernel.imag().isZero(TOL)) {
+          PossibleIrrep kernel_irrep = make_kernel_possible_irrep(
+              kernel, rep, head_group, is_irrep_tol, allow_complex);
+          if (kernel_irrep.is_irrep &&
+              is_extended_by(adapted_subspace, kernel_irrep.subspace)) {
+            irreps.insert(kernel_irrep);
+            adapted_subspace = extend(adapted_subspace, kernel_irrep.subspace);
+          }
+        }
+        break;
       }
-    } else {
       commuter_params.increment();
+      if (adapted_subspace.cols() == dim) {
+        break;
+      }
     }
   } while (adapted_subspace.cols() != dim);
 
@@ -730,10 +881,12 @@ std::vector<IrrepInfo> make_fullspace_irreps(
   return fullspace_irreps;
 }
 
-/// Expand subspace by application of group, and orthogonalize
-Eigen::MatrixXd make_invariant_space(MatrixRep const &rep,
-                                     GroupIndices const &head_group,
-                                     Eigen::MatrixXd const &subspace) {
+namespace {
+
+template <typename RepType>
+Eigen::MatrixXd _make_invariant_space(RepType const &rep,
+                                      GroupIndices const &head_group,
+                                      Eigen::MatrixXd const &subspace) {
   if (!subspace.isIdentity()) {
     Eigen::MatrixXd symspace(subspace.rows(),
                              subspace.cols() * head_group.size());
@@ -752,6 +905,37 @@ Eigen::MatrixXd make_invariant_space(MatrixRep const &rep,
   return subspace;
 }
 
+/// \brief Return `subspace.transpose()` and the right inverse used by
+///     `make_subspace_rep`
+std::pair<Eigen::MatrixXd, Eigen::MatrixXd> _make_subspace_transforms(
+    Eigen::MatrixXd const &subspace) {
+  Eigen::MatrixXd trans_mat = subspace.transpose();
+  Eigen::MatrixXd rightmat =
+      subspace.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV)
+          .solve(Eigen::MatrixXd::Identity(trans_mat.cols(), trans_mat.cols()))
+          .transpose();
+  return std::make_pair(trans_mat, rightmat);
+}
+
+}  // namespace
+
+/// Expand subspace by application of group, and orthogonalize
+Eigen::MatrixXd make_invariant_space(MatrixRep const &rep,
+                                     GroupIndices const &head_group,
+                                     Eigen::MatrixXd const &subspace) {
+  return _make_invariant_space(rep, head_group, subspace);
+}
+
+/// Expand subspace by application of group, and orthogonalize
+///
+/// Equivalent to `make_invariant_space` with `to_dense(rep)`, but `rep`
+/// is applied without constructing dense matrices.
+Eigen::MatrixXd make_invariant_space(BlockPermutationMatrixRep const &rep,
+                                     GroupIndices const &head_group,
+                                     Eigen::MatrixXd const &subspace) {
+  return _make_invariant_space(rep, head_group, subspace);
+}
+
 /// \brief Create the subspace rep from the fullspace rep
 ///
 /// Create `subspace_rep`, a transformed copy of `fullspace_rep` that acts
@@ -769,11 +953,7 @@ Eigen::MatrixXd make_invariant_space(MatrixRep const &rep,
 ///     subspace
 MatrixRep make_subspace_rep(MatrixRep const &fullspace_rep,
                             Eigen::MatrixXd const &subspace) {
-  Eigen::MatrixXd trans_mat = subspace.transpose();
-  Eigen::MatrixXd rightmat =
-      subspace.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV)
-          .solve(Eigen::MatrixXd::Identity(trans_mat.cols(), trans_mat.cols()))
-          .transpose();
+  auto [trans_mat, rightmat] = _make_subspace_transforms(subspace);
   MatrixRep subspace_rep;
   for (Index i = 0; i < fullspace_rep.size(); ++i) {
     subspace_rep.push_back(trans_mat * fullspace_rep[i] * rightmat);
@@ -781,13 +961,31 @@ MatrixRep make_subspace_rep(MatrixRep const &fullspace_rep,
   return subspace_rep;
 }
 
+/// \brief Create the subspace rep from the fullspace rep
+///
+/// Equivalent to `make_subspace_rep` with `to_dense(fullspace_rep)`, but
+/// `fullspace_rep` is applied without constructing dense matrices.
+MatrixRep make_subspace_rep(BlockPermutationMatrixRep const &fullspace_rep,
+                            Eigen::MatrixXd const &subspace) {
+  auto [trans_mat, rightmat] = _make_subspace_transforms(subspace);
+  MatrixRep subspace_rep;
+  for (Index i = 0; i < fullspace_rep.size(); ++i) {
+    subspace_rep.push_back(trans_mat * (fullspace_rep[i] * rightmat));
+  }
+  return subspace_rep;
+}
+
 /// \brief Symmetrize IrrepInfo, by finding high symmetry directions and
 /// aligning the irrep subspace basis with those directions
+///
+/// \param n_threads Number of threads used by
+///     `make_irrep_special_directions`
 std::vector<IrrepInfo> symmetrize_irreps(
     MatrixRep const &subspace_rep, GroupIndices const &head_group,
     std::vector<IrrepInfo> const &irreps,
     std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
-    std::function<GroupIndicesOrbitSet()> make_all_subgroups_f) {
+    std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
+    Index n_threads) {
   std::vector<IrrepInfo> symmetrized_irreps;
   double vec_compare_tol = TOL;
   bool use_all_subgroups = false;
@@ -795,9 +993,10 @@ std::vector<IrrepInfo> symmetrize_irreps(
     Eigen::MatrixXcd irrep_subspace = irrep.trans_mat.adjoint();
 
     multivector<Eigen::VectorXcd>::X<2> irrep_special_directions =
-        make_irrep_special_directions(subspace_rep, head_group, irrep_subspace,
-                                      vec_compare_tol, make_cyclic_subgroups_f,
-                                      make_all_subgroups_f, use_all_subgroups);
+        make_irrep_special_directions(
+            subspace_rep, head_group, irrep_subspace, vec_compare_tol,
+            make_cyclic_subgroups_f, make_all_subgroups_f, use_all_subgroups,
+            n_threads);
 
     Eigen::MatrixXcd symmetrizer_matrix = make_irrep_symmetrizer_matrix(
         irrep_special_directions, irrep_subspace, vec_compare_tol);
@@ -1,10 +1,12 @@
 #include "casm/configuration/irreps/IrrepWedge.hh"
 
+#include <algorithm>
+#include <exception>
+#include <functional>
+
 #include "casm/configuration/irreps/IrrepDecompositionImpl.hh"
 #include "casm/configuration/irreps/VectorSymCompare_v2.hh"
-#include "casm/container/Counter.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
-#include "casm/misc/algorithm.hh"
 
 namespace CASM {
 namespace irreps {
@@ -12,9 +14,9 @@ namespace irreps {
 namespace IrrepWedgeImpl {
 
 /// \param _rep The dimension of _rep should match the dimension of the irrep
-static IrrepWedge _wedge_from_pseudo_irrep(IrrepInfo const &irrep,
-                                           MatrixRep const &_rep,
-                                           GroupIndices const &head_group) {
+static IrrepWedge _wedge_from_pseudo_irrep(
+    IrrepInfo const &irrep, IrrepDecomposition const &irrep_decomposition,
+    GroupIndices const &head_group) {
   Eigen::MatrixXd t_axes = irrep.trans_mat.transpose().real();
   Eigen::MatrixXd axes = vector_space_prepare(t_axes, TOL);
   Eigen::VectorXd v = axes.col(0);
@@ -27,7 +29,7 @@ static IrrepWedge _wedge_from_pseudo_irrep(IrrepInfo const &irrep,
   for (Index i = 1; i < axes.cols(); ++i) {
     double bestproj = -1;
     for (Index element_index : head_group) {
-      v = _rep[element_index] * axes.col(0);
+      v = irrep_decomposition.apply_fullspace_rep(element_index, axes.col(0));
       // std::cout << "v: " << v.transpose() << std::endl;
       bool skip_op = false;
       for (Index j = 0; j < i; ++j) {
@@ -50,6 +52,67 @@ static IrrepWedge _wedge_from_pseudo_irrep(IrrepInfo const &irrep,
   return IrrepWedge(irrep, axes);
 }
 
+/// Orbit of an IrrepWedge under the head group
+struct _IrrepWedgeOrbit {
+  /// Equivalent wedge axes, in order of first appearance, starting with the
+  /// original wedge axes
+  std::vector<Eigen::MatrixXd> axes;
+
+  /// Group elements that leave the original wedge axes invariant
+  std::vector<Index> stabilizer;
+};
+
+static Index _find_axes(std::vector<Eigen::MatrixXd> const &orbit,
+                        Eigen::MatrixXd const &axes) {
+  Index o = 0;
+  for (; o < orbit.size(); ++o) {
+    if (Eigen::almost_equal(orbit[o], axes)) {
+      break;
+    }
+  }
+  return o;
+}
+
+static _IrrepWedgeOrbit _make_irrep_wedge_orbit(
+    IrrepWedge const &wedge, IrrepDecomposition const &irrep_decomposition,
+    GroupIndices const &head_group) {
+  _IrrepWedgeOrbit result;
+  result.axes.push_back(wedge.axes);
+  for (Index element_index : head_group) {
+    Eigen::MatrixXd test_axes =
+        irrep_decomposition.apply_fullspace_rep(element_index, wedge.axes);
+    Index o = _find_axes(result.axes, test_axes);
+    if (o == 0) {
+      result.stabilizer.push_back(element_index);
+    } else if (o == result.axes.size()) {
+      result.axes.push_back(test_axes);
+    }
+  }
+  return result;
+}
+
+/// \returns action, where action[k][o] is the index in orbit of
+///     fullspace_rep[group[k]] * orbit[o]
+static std::vector<std::vector<Index>> _make_orbit_action(
+    std::vector<Eigen::MatrixXd> const &orbit,
+    IrrepDecomposition const &irrep_decomposition,
+    std::vector<Index> const &group) {
+  std::vector<std::vector<Index>> action(group.size());
+  for (Index k = 0; k < group.size(); ++k) {
+    action[k].reserve(orbit.size());
+    for (Eigen::MatrixXd const &axes : orbit) {
+      Index o = _find_axes(
+          orbit, irrep_decomposition.apply_fullspace_rep(group[k], axes));
+      if (o == orbit.size()) {
+        throw std::runtime_error(
+            "Error in make_symrep_subwedges: irrep wedge orbit is not closed");
+      }
+      action[k].push_back(o);
+    }
+  }
+  return action;
+}
+
 }  // namespace IrrepWedgeImpl
 
 IrrepWedge::IrrepWedge(IrrepInfo _irrep_info, Eigen::MatrixXd _axes)
@@ -109,7 +172,6 @@ SubWedge make_dummy_subwedge(Eigen::MatrixXd const &axes) {
 std::vector<IrrepWedge> make_irrep_wedges(
     IrrepDecomposition const &irrep_decomposition) {
   std::vector<IrrepInfo> const &irreps = irrep_decomposition.irreps;
-  MatrixRep const &fullspace_rep = irrep_decomposition.fullspace_rep;
   GroupIndices const &head_group = irrep_decomposition.head_group;
 
   std::vector<IrrepWedge> wedges;
@@ -134,7 +196,7 @@ std::vector<IrrepWedge> make_irrep_wedges(
     // std::endl;
     if (irrep.directions.empty()) {
       wedges.back() = IrrepWedgeImpl::_wedge_from_pseudo_irrep(
-          irrep, fullspace_rep, head_group);
+          irrep, irrep_decomposition, head_group);
       continue;
     }
 
@@ -169,104 +231,104 @@ std::vector<IrrepWedge> make_irrep_wedges(
 
 /// \brief Find full irreducible wedge of a group-represented vector space, as
 /// a vector of SubWedges, from an IrrepDecomposition
+///
+/// Method:
+/// - The orbit of each irrep wedge is found, in parallel across irreps.
+/// - SubWedges are combinations of one wedge from each irrep wedge orbit, and
+///   one SubWedge is kept from each orbit of combinations. The irrep wedge
+///   with the largest orbit is fixed to its first orbit element, so only
+///   its stabilizer subgroup, `S`, acts on the other irrep wedges.
+/// - The action of `S` on each other irrep wedge orbit is tabulated once, in
+///   parallel across irreps, as permutations of orbit indices.
+/// - Then, instead of generating every combination and comparing it against
+///   all previously found SubWedges, a stabilizer chain is followed: for
+///   each irrep, in order from last to first, one representative is chosen
+///   from each orbit of the current subgroup, and the stabilizer of that
+///   representative in the current subgroup is used for the next irrep.
+///
+/// The representatives are the minimal orbit indices, so the result is the
+/// same SubWedges, in the same order, as comparing every combination, with
+/// the first irrep wedge index varying fastest.
+///
+/// \param irrep_decomposition The IrrepDecomposition
+/// \param n_threads Number of threads to use. If `n_threads <= 0`, use the
+///     number of threads set by `config::set_num_threads`.
 std::vector<SubWedge> make_symrep_subwedges(
-    IrrepDecomposition const &irrep_decomposition) {
-  auto irrep_wedge_compare = [](const IrrepWedge &a,
-                                const IrrepWedge &b) -> bool {
-    return Eigen::almost_equal(a.axes, b.axes);
-  };
-
-  auto tot_wedge_compare = [irrep_wedge_compare](
-                               const std::vector<IrrepWedge> &a,
-                               const std::vector<IrrepWedge> &b) -> bool {
-    if (a.size() != b.size()) return false;
-    for (auto ita = a.begin(), itb = b.begin(); ita != a.end(); ++ita, ++itb)
-      if (!irrep_wedge_compare(*ita, *itb)) return false;
-    // std::cout << "Equal: \n" << SubWedge(a).trans_mat << ",\n" <<
-    // SubWedge(b).trans_mat << "\n\n";
-    return true;
-  };
-
+    IrrepDecomposition const &irrep_decomposition, Index n_threads) {
+  using namespace IrrepWedgeImpl;
   std::vector<IrrepWedge> init_wedges = make_irrep_wedges(irrep_decomposition);
-  MatrixRep const &fullspace_rep = irrep_decomposition.fullspace_rep;
   GroupIndices const &head_group = irrep_decomposition.head_group;
+  Index n_wedges = init_wedges.size();
+  if (n_wedges == 0) {
+    return {};
+  }
 
-  std::vector<SubWedge> result;
+  // orbits[w] is orbit of init_wedges[w]
+  std::vector<_IrrepWedgeOrbit> orbits(n_wedges);
+  _parallel_for(n_wedges, n_threads, [&](Index w) {
+    orbits[w] = _make_irrep_wedge_orbit(init_wedges[w], irrep_decomposition,
+                                        head_group);
+  });
 
-  // irrep_wedge_orbits[w] is orbit of wedges[w]
-  multivector<IrrepWedge>::X<2> irrep_wedge_orbits;
-  irrep_wedge_orbits.reserve(init_wedges.size());
-  // max_equiv[w] is irrep_wedge_orbits[w].size()-1
-  std::vector<Index> max_equiv;
-  max_equiv.reserve(init_wedges.size());
-  // std::cout << "irreducible wedges for group of order " << head_group.size()
-  // << std::endl;
   Index imax = 0;
-  multivector<Index>::X<2> subgroups;
-  for (IrrepWedge const &wedge : init_wedges) {
-    // std::cout << "Working wedge with axes: \n" << wedge.axes.transpose() <<
-    // std::endl;
-    irrep_wedge_orbits.push_back({wedge});
+  for (Index w = 1; w < n_wedges; ++w) {
+    if (orbits[w].axes.size() > orbits[imax].axes.size()) {
+      imax = w;
+    }
+  }
 
-    // Start getting orbit of wedges[w]
-    subgroups.push_back({});
-    for (Index element_index : head_group) {
-      IrrepWedge test_wedge{wedge};
-      test_wedge.axes = fullspace_rep[element_index] * wedge.axes;
-      Index o = 0;
-      for (; o < irrep_wedge_orbits.back().size(); ++o) {
-        if (irrep_wedge_compare(irrep_wedge_orbits.back()[o], test_wedge)) {
-          if (o == 0) {
-            subgroups.back().push_back(element_index);
-          }
-          break;
-        }
-      }
-      if (o < irrep_wedge_orbits.back().size()) continue;
-      irrep_wedge_orbits.back().push_back(test_wedge);
+  // action[w][k][o] is the orbit index of stabilizer[k] * orbits[w].axes[o]
+  std::vector<Index> const &stabilizer = orbits[imax].stabilizer;
+  std::vector<std::vector<std::vector<Index>>> action(n_wedges);
+  _parallel_for(n_wedges, n_threads, [&](Index w) {
+    if (w != imax) {
+      action[w] = _make_orbit_action(orbits[w].axes, irrep_decomposition,
+                                     stabilizer);
+    }
+  });
+
+  std::vector<Index> levels;
+  for (Index w = n_wedges - 1; w >= 0; --w) {
+    if (w != imax) {
+      levels.push_back(w);
     }
-    // std::cout << "wedge mult: " << irrep_wedge_orbits.back().size();
-    // std::cout << "; subgroups[" << subgroups.size() << "]: " <<
-    // subgroups.back() << std::endl; std::cout << "N equiv wedges found: " <<
-    // irrep_wedge_orbits.back().size() << std::endl;
-    max_equiv.push_back(irrep_wedge_orbits.back().size() - 1);
-    if (max_equiv.back() > max_equiv[imax]) imax = max_equiv.size() - 1;
   }
-  max_equiv[imax] = 0;
-
-  // Counter over combinations of equivalent wedges
-  Counter<std::vector<Index>> wcount(std::vector<Index>(init_wedges.size(), 0),
-                                     max_equiv,
-                                     std::vector<Index>(init_wedges.size(), 1));
-
-  // std::cout << "max_equiv: " << max_equiv << std::endl;
-  // std::cout << "init wcount: " << wcount() << std::endl;
-  multivector<IrrepWedge>::X<3> tot_wedge_orbits;
-  // std::cout << "Starting slow bit!\n";
-  for (; wcount; ++wcount) {
-    std::vector<IrrepWedge> twedge = init_wedges;
-    for (Index i = 0; i < init_wedges.size(); i++)
-      twedge[i].axes = irrep_wedge_orbits[i][wcount[i]].axes;
-
-    if (contains_if(
-            tot_wedge_orbits,
-            [tot_wedge_compare, &twedge](
-                const multivector<IrrepWedge>::X<2> &wedge_orbit) -> bool {
-              return contains(wedge_orbit, twedge, tot_wedge_compare);
-            }))
-      continue;
 
-    tot_wedge_orbits.push_back({twedge});
-    result.emplace_back(twedge);
-    for (Index p : subgroups[imax]) {
-      for (Index i = 0; i < twedge.size(); i++)
-        twedge[i].axes = fullspace_rep[p] * result.back().irrep_wedges[i].axes;
-      if (!contains(tot_wedge_orbits.back(), twedge, tot_wedge_compare)) {
-        tot_wedge_orbits.back().push_back(twedge);
+  std::vector<SubWedge> result;
+  std::vector<Index> choice(n_wedges, 0);
+  std::vector<Index> subgroup(stabilizer.size());
+  for (Index k = 0; k < subgroup.size(); ++k) {
+    subgroup[k] = k;
+  }
+  std::function<void(Index, std::vector<Index> const &)> _visit;
+  _visit = [&](Index level, std::vector<Index> const &_subgroup) {
+    if (level == levels.size()) {
+      std::vector<IrrepWedge> twedge = init_wedges;
+      for (Index w = 0; w < n_wedges; ++w) {
+        twedge[w].axes = orbits[w].axes[choice[w]];
       }
+      result.emplace_back(twedge);
+      return;
     }
-  }
-  // std::cout << "Num subwedges: " << result.size() << std::endl;
+    Index w = levels[level];
+    std::vector<bool> visited(orbits[w].axes.size(), false);
+    for (Index o = 0; o < visited.size(); ++o) {
+      if (visited[o]) {
+        continue;
+      }
+      std::vector<Index> next_subgroup;
+      for (Index k : _subgroup) {
+        Index image = action[w][k][o];
+        visited[image] = true;
+        if (image == o) {
+          next_subgroup.push_back(k);
+        }
+      }
+      choice[w] = o;
+      _visit(level + 1, next_subgroup);
+    }
+  };
+  _visit(0, subgroup);
   return result;
 }
 
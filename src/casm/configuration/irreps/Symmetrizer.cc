@@ -1,7 +1,13 @@
 #include "casm/configuration/irreps/Symmetrizer.hh"
 
+#include <cmath>
+#include <optional>
+#include <unordered_set>
+
+#include "casm/configuration/hash.hh"
 #include "casm/configuration/irreps/SimpleOrbit_impl.hh"
 #include "casm/configuration/irreps/VectorSymCompare_v2.hh"
+#include "casm/configuration/parallel.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
 #include "casm/misc/CASM_math.hh"
 
@@ -9,6 +15,32 @@ namespace CASM {
 
 namespace irreps {
 
+namespace {
+
+/// \brief Real and imaginary parts of a direction, rounded to `tol`
+std::vector<long> _make_direction_key(Eigen::VectorXcd const &direction,
+                                      double tol) {
+  std::vector<long> key;
+  key.reserve(2 * direction.size());
+  for (Index i = 0; i < direction.size(); ++i) {
+    key.push_back(std::llround(direction(i).real() / tol));
+    key.push_back(std::llround(direction(i).imag() / tol));
+  }
+  return key;
+}
+
+struct _DirectionKeyHash {
+  std::size_t operator()(std::vector<long> const &key) const {
+    std::size_t seed = key.size();
+    for (long value : key) {
+      hash_combine(seed, std::hash<long>()(value));
+    }
+    return seed;
+  }
+};
+
+}  // namespace
+
 /// Find high-symmetry directions in a irreducible space
 ///
 /// \param rep Matrix representation of head_group, this defines group action
@@ -34,6 +66,11 @@ namespace irreps {
 /// normalized to unit length. The total set of all directions is guaranteed to
 /// span the space.
 ///
+/// \param n_threads Number of threads used to find candidate directions
+///     from subgroups. If `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`. The result does not depend on
+///     `n_threads`.
+///
 /// \throws if `rep` is not an irreducible representation
 ///
 multivector<Eigen::VectorXcd>::X<2> make_irrep_special_directions(
@@ -41,49 +78,74 @@ multivector<Eigen::VectorXcd>::X<2> make_irrep_special_directions(
     Eigen::MatrixXcd const &irrep_subspace, double vec_compare_tol,
     std::function<GroupIndicesOrbitSet()> make_cyclic_subgroups_f,
     std::function<GroupIndicesOrbitSet()> make_all_subgroups_f,
-    bool use_all_subgroups) {
+    bool use_all_subgroups, Index n_threads) {
   GroupIndicesOrbitSet sgroups =
       (use_all_subgroups ? make_all_subgroups_f() : make_cyclic_subgroups_f());
+  std::vector<GroupIndices const *> sgroup_prototypes;
+  for (auto const &orbit : sgroups) {
+    sgroup_prototypes.push_back(&*orbit.begin());
+  }
 
-  std::vector<Eigen::VectorXcd> tdirs;
-  Eigen::MatrixXd R;
   Index dim = rep[0].rows();
 
   // Loop over small (i.e., cyclic) subgroups and hope that each special
-  // direction is invariant to at least one small subgroup
-  for (auto const &orbit : sgroups) {
-    // Reynolds for small subgroup *(orbit.begin()) in irrep_subspace i
-    R.setZero(dim, dim);
-
-    for (Index element_index : *(orbit.begin())) {
-      R += rep[element_index];
-    }
+  // direction is invariant to at least one small subgroup. Subgroups are
+  // independent, so candidates are found in parallel and then collected in
+  // subgroup order.
+  std::vector<std::optional<Eigen::VectorXcd>> candidates(
+      sgroup_prototypes.size());
+  config::parallel_for_items(
+      sgroup_prototypes.size(), n_threads, [&](Index i) {
+        // Reynolds for small subgroup in irrep_subspace
+        Eigen::MatrixXd R = Eigen::MatrixXd::Zero(dim, dim);
+        for (Index element_index : *sgroup_prototypes[i]) {
+          R += rep[element_index];
+        }
 
-    if ((R * irrep_subspace).norm() < TOL) continue;
+        if ((R * irrep_subspace).norm() < TOL) return;
 
-    // Find spanning vectors of column space of R*irrep_space, which is
-    // projection of irrep_space into its invariant component
-    auto QR = (R * irrep_subspace).colPivHouseholderQr();
-    QR.setThreshold(TOL);
-    // If only one spanning vector, it is special direction
-    if (QR.rank() > 1) continue;
-    Eigen::MatrixXcd Q = QR.matrixQ();
+        // Find spanning vectors of column space of R*irrep_space, which is
+        // projection of irrep_space into its invariant component
+        auto QR = (R * irrep_subspace).colPivHouseholderQr();
+        QR.setThreshold(TOL);
+        // If only one spanning vector, it is special direction
+        if (QR.rank() > 1) return;
+        Eigen::MatrixXcd Q = QR.matrixQ();
+        candidates[i] = Q.col(0);
+      });
 
-    // Convert from irrep_subspace back to total space and push_back
-    tdirs.push_back(Q.col(0));
-    tdirs.push_back(-Q.col(0));
+  std::vector<Eigen::VectorXcd> tdirs;
+  for (auto const &candidate : candidates) {
+    if (candidate.has_value()) {
+      tdirs.push_back(*candidate);
+      tdirs.push_back(-*candidate);
+    }
   }
 
   // t_result may contain duplicates, or elements that are equivalent by
   // symmetry. To discern more info, we need to exclude duplicates and find
   // the orbit of the directions. this should also
   // reveal the invariant subgroups.
+  //
+  // Most directions are elements of an orbit already found, so the rounded
+  // elements of every orbit element are hashed, and the orbit of a
+  // direction is only generated if it is not found. Directions that round
+  // differently still have their orbit generated and compared, so the
+  // result is the same as generating every orbit.
 
   VectorSymCompare sym_compare{rep, vec_compare_tol};
   std::set<SimpleOrbit<VectorSymCompare>> orbit_result;
+  std::unordered_set<std::vector<long>, _DirectionKeyHash> found;
   for (Eigen::VectorXcd const &direction : tdirs) {
-    orbit_result.emplace(direction, head_group.begin(), head_group.end(),
-                         sym_compare);
+    if (found.count(_make_direction_key(direction, vec_compare_tol))) {
+      continue;
+    }
+    SimpleOrbit<VectorSymCompare> orbit(direction, head_group.begin(),
+                                        head_group.end(), sym_compare);
+    for (Eigen::VectorXcd const &element : orbit) {
+      found.insert(_make_direction_key(element, vec_compare_tol));
+    }
+    orbit_result.insert(std::move(orbit));
   }
   multivector<Eigen::VectorXcd>::X<2> result;
   for (auto const &orbit : orbit_result) {
@@ -95,7 +157,7 @@ multivector<Eigen::VectorXcd>::X<2> make_irrep_special_directions(
   } else {
     return make_irrep_special_directions(
         rep, head_group, irrep_subspace, vec_compare_tol,
-        make_cyclic_subgroups_f, make_all_subgroups_f, true);
+        make_cyclic_subgroups_f, make_all_subgroups_f, true, n_threads);
   }
 }
 
@@ -65,12 +65,25 @@ VectorSpaceSymReport::VectorSpaceSymReport(
 /// \param axis_glossary If has value, copied to
 /// VectorSpaceSymReport.axis_glossary;
 ///     otherwise, axis_glossary is set to {"x1", "x2", ...}
+/// \param n_threads Number of threads used by `make_symrep_subwedges` if
+///     `calc_wedges`. If `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`. The result does not depend on `n_threads`.
+///
+/// The parts of the report are constructed once each and moved into the
+/// result. If `calc_wedges` is false, no symmetry operations are applied.
 VectorSpaceSymReport vector_space_sym_report(
     IrrepDecomposition const &irrep_decomposition, bool calc_wedges,
-    std::optional<std::vector<std::string>> axis_glossary) {
+    std::optional<std::vector<std::string>> axis_glossary, Index n_threads) {
+  // the full space rep may not be stored if the decomposition was combined
+  // from decompositions of invariant subspaces, to bound memory use; a block
+  // rep is densified one element at a time
   std::vector<Eigen::MatrixXd> symgroup_rep;
-  for (Index element_index : irrep_decomposition.head_group) {
-    symgroup_rep.push_back(irrep_decomposition.fullspace_rep[element_index]);
+  if (irrep_decomposition.has_fullspace_rep()) {
+    symgroup_rep.reserve(irrep_decomposition.head_group.size());
+    for (Index element_index : irrep_decomposition.head_group) {
+      symgroup_rep.push_back(
+          irrep_decomposition.make_fullspace_matrix(element_index));
+    }
   }
 
   if (!axis_glossary.has_value()) {
@@ -84,12 +97,14 @@ VectorSpaceSymReport vector_space_sym_report(
 
   std::vector<SubWedge> irreducible_wedge;
   if (calc_wedges) {
-    irreducible_wedge = make_symrep_subwedges(irrep_decomposition);
+    irreducible_wedge = make_symrep_subwedges(irrep_decomposition, n_threads);
   }
 
   return VectorSpaceSymReport(
-      symgroup_rep, irrep_decomposition.irreps, irreducible_wedge,
-      irrep_decomposition.symmetry_adapted_subspace, axis_glossary.value());
+      std::move(symgroup_rep), irrep_decomposition.irreps,
+      std::move(irreducible_wedge),
+      irrep_decomposition.symmetry_adapted_subspace,
+      std::move(axis_glossary.value()));
 }
 
 }  // namespace irreps
@@ -0,0 +1,110 @@
+#include "casm/configuration/irreps/VectorSymmetrizer.hh"
+
+#include <stdexcept>
+
+namespace CASM {
+namespace irreps {
+
+/// \brief Constructor
+///
+/// \param _matrix The `dim x dim` operator matrix
+VectorSymmetrizer::VectorSymmetrizer(Eigen::MatrixXd _matrix)
+    : m_matrix(std::move(_matrix)) {
+  if (m_matrix.rows() != m_matrix.cols()) {
+    throw std::runtime_error(
+        "Error in VectorSymmetrizer: matrix is not square");
+  }
+}
+
+/// \brief The `dim x dim` operator matrix
+Eigen::MatrixXd const &VectorSymmetrizer::matrix() const { return m_matrix; }
+
+/// \brief Vector dimension
+Index VectorSymmetrizer::dim() const { return m_matrix.rows(); }
+
+/// \brief Return `matrix() * vectors`
+///
+/// \param vectors A `dim x n_vectors` matrix, with one vector per column
+Eigen::MatrixXd VectorSymmetrizer::operator()(
+    Eigen::MatrixXd const &vectors) const {
+  if (vectors.rows() != dim()) {
+    throw std::runtime_error(
+        "Error in VectorSymmetrizer: vectors.rows() != dim");
+  }
+  Eigen::MatrixXd result(dim(), vectors.cols());
+  result.noalias() = m_matrix * vectors;
+  return result;
+}
+
+/// \brief Set `vectors = matrix() * vectors`
+///
+/// \param vectors A `dim x n_vectors` matrix, with one vector per column
+void VectorSymmetrizer::apply_in_place(
+    Eigen::Ref<Eigen::MatrixXd> vectors) const {
+  vectors = (*this)(vectors);
+}
+
+/// \brief Make the group average of a matrix representation
+///
+/// The result is `R = (1/|G|) * sum_g rep[g]`, for `g` in `head_group`, the
+/// orthogonal projector onto the subspace of vectors invariant to the group.
+/// Applying it to a vector gives the average of its symmetrically equivalent
+/// images.
+///
+/// \param rep Matrix representation
+/// \param head_group Indices of the elements of `rep` to average
+VectorSymmetrizer make_group_average_symmetrizer(
+    MatrixRep const &rep, GroupIndices const &head_group) {
+  if (head_group.empty()) {
+    throw std::runtime_error(
+        "Error in make_group_average_symmetrizer: head_group is empty");
+  }
+  Index dim = rep[*head_group.begin()].rows();
+  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(dim, dim);
+  for (Index element_index : head_group) {
+    R += rep[element_index];
+  }
+  R /= head_group.size();
+  return VectorSymmetrizer(std::move(R));
+}
+
+/// \brief Make the projector onto the span of one or more irreducible
+///     subspaces
+///
+/// For each irrep, with `A = irrep.trans_mat`, the projector onto the rows of
+/// `A` is `A^+ (A A^+)^-1 A`. The irreps of a decomposition are mutually
+/// orthogonal, so the projector onto their span is the sum.
+///
+/// \param irreps The irreducible subspaces, as from an IrrepDecomposition
+///     or VectorSpaceSymReport
+/// \param abs_tol Tolerance used to check that the projector is real
+///
+/// \throws If the projector has imaginary components, which happens for
+///     complex irreps. Use an IrrepDecomposition with `allow_complex=false`,
+///     which combines them into real pseudo-irreps.
+VectorSymmetrizer make_irrep_projector(std::vector<IrrepInfo> const &irreps,
+                                       double abs_tol) {
+  if (irreps.empty()) {
+    throw std::runtime_error("Error in make_irrep_projector: irreps is empty");
+  }
+  Index dim = irreps[0].vector_dim;
+  Eigen::MatrixXcd P = Eigen::MatrixXcd::Zero(dim, dim);
+  for (IrrepInfo const &irrep : irreps) {
+    if (irrep.vector_dim != dim) {
+      throw std::runtime_error(
+          "Error in make_irrep_projector: irreps have different vector_dim");
+    }
+    Eigen::MatrixXcd const &A = irrep.trans_mat;
+    Eigen::MatrixXcd gram = A * A.adjoint();
+    P += A.adjoint() * gram.ldlt().solve(A);
+  }
+  if (P.imag().cwiseAbs().maxCoeff() > abs_tol) {
+    throw std::runtime_error(
+        "Error in make_irrep_projector: projector is not real (complex "
+        "irreps)");
+  }
+  return VectorSymmetrizer(P.real());
+}
+
+}  // namespace irreps
+}  // namespace CASM
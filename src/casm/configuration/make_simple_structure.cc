@@ -1,9 +1,14 @@
 #include "casm/configuration/make_simple_structure.hh"
 
+#include <algorithm>
+#include <optional>
+#include <sstream>
 #include <vector>  // see https://github.com/prisms-center/CASMcode_clexulator/issues/19
 
 #include "casm/clexulator/ConfigDoFValuesTools_impl.hh"
 #include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationView.hh"
+#include "casm/configuration/parallel.hh"
 #include "casm/crystallography/SimpleStructure.hh"
 #include "casm/crystallography/StrainConverter.hh"
 
@@ -124,11 +129,7 @@ xtal::SimpleStructure make_simple_structure(
   }
 
   // get ideal site coordinates (all sites)
-  Eigen::MatrixXd coords(3, n_sites);
-  for (Index l = 0; l < n_sites; ++l) {
-    xtal::UnitCellCoord bijk = converter(l);
-    coords.col(l) = bijk.coordinate(*prim.basicstructure).const_cart();
-  }
+  Eigen::MatrixXd coords = supercell.site_coordinate_cart();
 
   // get deformation gradient, F
   Eigen::Matrix3d F;
@@ -274,6 +275,21 @@ xtal::SimpleStructure make_simple_structure(
   return structure;
 }
 
+/// \brief (deprecated) Convert a view of a Configuration to a SimpleStructure
+///
+/// Equivalent to `make_simple_structure` for a Configuration. The referenced
+/// DoF values are copied once.
+xtal::SimpleStructure make_simple_structure(
+    ConfigurationView const &configuration,
+    std::map<std::string, Eigen::MatrixXd> const &local_properties,
+    std::map<std::string, Eigen::VectorXd> const &global_properties,
+    std::string atom_type_naming_method,
+    std::set<std::string> excluded_species) {
+  return make_simple_structure(make_configuration(configuration),
+                               local_properties, global_properties,
+                               atom_type_naming_method, excluded_species);
+}
+
 /// \brief Constructor
 ///
 /// \param atom_type_naming_method Specifies how to set atom_info.names.
@@ -329,5 +345,155 @@ xtal::SimpleStructure ToAtomicStructure::operator()(
                                m_excluded_species);
 }
 
+/// \brief Convert many configurations of one supercell to contiguous
+///     coordinate and atom type arrays
+///
+/// \param configurations Configurations, all of the same supercell. Only
+///     occupation, "disp", and strain DoF are used; other DoF values, which
+///     `operator()` copies to structure properties, are not included.
+/// \param n_threads Number of threads used to fill the arrays. If <= 0, use the
+///     number of threads set by `set_num_threads`.
+///
+/// \returns batch The lattice vectors, coordinates, and atom types of each
+///     configuration, the same as the structures constructed by
+///     `operator()(configurations[k])`, stored as contiguous arrays.
+///
+/// Method:
+/// - The ideal site coordinates, and the atom type of each (sublattice,
+///   occupant) pair, are computed once for the supercell.
+/// - For each configuration, displacements are added to the ideal
+///   coordinates of all sites with one matrix operation, the included atoms
+///   are gathered, and the deformation gradient is applied to them with
+///   one matrix product.
+AtomicStructureBatch ToAtomicStructure::make_batch(
+    std::vector<Configuration> const &configurations, Index n_threads) const {
+  AtomicStructureBatch batch;
+  if (configurations.empty()) {
+    return batch;
+  }
+
+  // references
+  auto const &supercell = *configurations[0].supercell;
+  auto const &prim = *supercell.prim;
+  auto const &basis = prim.basicstructure->basis();
+  auto const &converter = supercell.unitcellcoord_index_converter;
+  Index n_sites = converter.total_sites();
+  Index N_sublat = basis.size();
+  Index N_unitcells = supercell.unitcell_index_converter.total_sites();
+
+  // validate no multi-atom molecules
+  if (!prim.is_atomic) {
+    throw std::runtime_error(
+        "Error in ToAtomicStructure::make_batch: not an atomic structure");
+  }
+
+  // atom type index by (sublattice, occupant), or -1 if excluded
+  std::vector<std::vector<int>> type_index(N_sublat);
+  for (Index b = 0; b < N_sublat; ++b) {
+    for (Index s = 0; s < basis[b].occupant_dof().size(); ++s) {
+      std::string name;
+      if (m_atom_type_naming_method == "orientation_name") {
+        name = prim.basicstructure->unique_names()[b][s];
+      } else if (m_atom_type_naming_method == "chemical_name") {
+        name = basis[b].occupant_dof()[s].name();
+      } else {
+        std::stringstream msg;
+        msg << "Error in ToAtomicStructure::make_batch: invalid "
+               "atom_type_naming_method='"
+            << m_atom_type_naming_method << "'";
+        throw std::runtime_error(msg.str());
+      }
+      int index = -1;
+      if (!m_excluded_species.count(name)) {
+        auto it = std::find(batch.atom_type_names.begin(),
+                            batch.atom_type_names.end(), name);
+        index = std::distance(batch.atom_type_names.begin(), it);
+        if (it == batch.atom_type_names.end()) {
+          batch.atom_type_names.push_back(name);
+        }
+      }
+      type_index[b].push_back(index);
+    }
+  }
+
+  // ideal site coordinates (all sites), and sublattice by site
+  Eigen::Matrix3Xd const &ideal_coords = supercell.site_coordinate_cart();
+  std::vector<Index> const &sublattice = supercell.site_sublattice_index();
+  Eigen::Matrix3d ideal_lat_column_mat =
+      supercell.superlattice.superlattice().lat_column_mat();
+
+  DoFKey strain_dof_key;
+  std::optional<xtal::StrainConverter> strain_converter;
+  if (has_strain_dof(*prim.basicstructure)) {
+    strain_dof_key = get_strain_dof_key(*prim.basicstructure);
+    strain_converter.emplace(strain_dof_key,
+                             prim.global_dof_info.at(strain_dof_key).basis());
+  }
+  bool has_disp = prim.local_dof_info.count("disp");
+
+  // validate, count atoms, and set atom types and site indices
+  Index n_configurations = configurations.size();
+  std::vector<int> atom_type;
+  for (Index k = 0; k < n_configurations; ++k) {
+    Configuration const &configuration = configurations[k];
+    if (configuration.supercell.get() != &supercell &&
+        *configuration.supercell != supercell) {
+      throw std::runtime_error(
+          "Error in ToAtomicStructure::make_batch: configurations are not all "
+          "in the same supercell");
+    }
+    auto const &occupation = configuration.dof_values.occupation;
+    for (Index l = 0; l < n_sites; ++l) {
+      int s = occupation(l);
+      Index b = sublattice[l];
+      if (s < 0 || s >= type_index[b].size()) {
+        std::stringstream msg;
+        msg << "Error in ToAtomicStructure::make_batch: invalid occupation="
+            << s << " at linear_site_index=" << l << " in configuration " << k
+            << ".";
+        throw std::runtime_error(msg.str());
+      }
+      if (type_index[b][s] >= 0) {
+        atom_type.push_back(type_index[b][s]);
+        batch.site_index.push_back(l);
+      }
+    }
+    batch.atom_offset.push_back(batch.site_index.size());
+  }
+  batch.atom_type = Eigen::Map<Eigen::VectorXi>(atom_type.data(),
+                                                atom_type.size());
+  batch.coords.resize(3, batch.site_index.size());
+  batch.lat_column_mat.resize(3, 3 * n_configurations);
+
+  // fill coordinates and lattice vectors
+  parallel_for_chunks(
+      n_configurations, n_threads, [&](Index chunk_begin, Index chunk_end) {
+        Eigen::MatrixXd site_coords;
+        for (Index k = chunk_begin; k < chunk_end; ++k) {
+          auto const &dof_values = configurations[k].dof_values;
+          Eigen::Matrix3d F = Eigen::Matrix3d::Identity();
+          if (strain_converter.has_value()) {
+            F = strain_converter->to_F(
+                dof_values.global_dof_values.at(strain_dof_key));
+          }
+          site_coords = ideal_coords;
+          if (has_disp) {
+            site_coords += clexulator::local_to_standard_values(
+                dof_values.local_dof_values.at("disp"), N_sublat, N_unitcells,
+                prim.local_dof_info.at("disp"));
+          }
+          Index begin = batch.atom_offset[k];
+          Index n_atoms = batch.atom_offset[k + 1] - begin;
+          for (Index i = begin; i < begin + n_atoms; ++i) {
+            batch.coords.col(i) = site_coords.col(batch.site_index[i]);
+          }
+          batch.coords.middleCols(begin, n_atoms) =
+              F * batch.coords.middleCols(begin, n_atoms);
+          batch.lat_column_mat.middleCols(3 * k, 3) = F * ideal_lat_column_mat;
+        }
+      });
+  return batch;
+}
+
 }  // namespace config
 }  // namespace CASM
@@ -0,0 +1,38 @@
+#include "casm/configuration/memory_usage.hh"
+
+#include "casm/clexulator/ConfigDoFValues.hh"
+#include "casm/configuration/group/Group.hh"
+#include "casm/crystallography/SymType.hh"
+
+namespace CASM {
+namespace config {
+namespace memory_usage_impl {
+
+/// \brief Heap bytes owned by ConfigDoFValues
+Index heap_bytes(ConfigDoFValues const &value) {
+  Index bytes = heap_bytes(value.occupation);
+  for (auto const &pair : value.local_dof_values) {
+    bytes += set_node_bytes + sizeof(pair) + heap_bytes(pair.first) +
+             heap_bytes(pair.second);
+  }
+  for (auto const &pair : value.global_dof_values) {
+    bytes += set_node_bytes + sizeof(pair) + heap_bytes(pair.first) +
+             heap_bytes(pair.second);
+  }
+  return bytes;
+}
+
+/// \brief Heap bytes owned by a SymGroup, excluding its head group
+Index heap_bytes(SymGroup const &value) {
+  Index bytes = heap_bytes(value.element) + heap_bytes(value.head_group_index) +
+                heap_bytes(value.multiplication_table) +
+                heap_bytes(value.inverse_index);
+  for (auto const &row : value.multiplication_table) {
+    bytes += heap_bytes(row);
+  }
+  return bytes;
+}
+
+}  // namespace memory_usage_impl
+}  // namespace config
+}  // namespace CASM
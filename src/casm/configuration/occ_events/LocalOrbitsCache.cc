@@ -0,0 +1,196 @@
+#include "casm/configuration/occ_events/LocalOrbitsCache.hh"
+
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/group/Group.hh"
+#include "casm/configuration/group/orbits.hh"
+#include "casm/configuration/occ_events/orbits.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/SymType.hh"
+
+namespace CASM {
+namespace occ_events {
+
+/// \brief Constructor
+///
+/// \param _prim The prim
+/// \param _prim_factor_group The prim factor group
+/// \param _site_filter, _max_length, _custom_generators, _cutoff_radius,
+///     _include_phenomenal_sites Parameters passed to
+///     `clust::make_local_orbits` to generate the local-cluster orbits
+///     around the prototype of each OccEvent orbit
+LocalOrbitsCache::LocalOrbitsCache(
+    std::shared_ptr<xtal::BasicStructure const> const &_prim,
+    std::shared_ptr<SymGroup const> const &_prim_factor_group,
+    clust::SiteFilterFunction _site_filter,
+    std::vector<double> const &_max_length,
+    std::vector<clust::IntegralClusterOrbitGenerator> const &_custom_generators,
+    std::vector<double> const &_cutoff_radius, bool _include_phenomenal_sites)
+    : m_prim(_prim),
+      m_prim_factor_group(_prim_factor_group),
+      m_site_filter(_site_filter),
+      m_max_length(_max_length),
+      m_custom_generators(_custom_generators),
+      m_cutoff_radius(_cutoff_radius),
+      m_include_phenomenal_sites(_include_phenomenal_sites),
+      m_n_hits(0),
+      m_n_misses(0) {
+  if (m_prim == nullptr || m_prim_factor_group == nullptr) {
+    throw std::runtime_error(
+        "Error in LocalOrbitsCache: prim or prim_factor_group is empty");
+  }
+  m_occevent_symgroup_rep =
+      make_occevent_symgroup_rep(m_prim_factor_group->element, *m_prim);
+}
+
+/// \brief Get the local-cluster orbits around an OccEvent
+///
+/// \param event An OccEvent, in any unit cell
+///
+/// \returns The local-cluster orbits around `event`, equal as sets to those
+///     generated by `clust::make_local_orbits` with the group that leaves
+///     `event` invariant, and in the order of the orbits around the
+///     prototype.
+std::vector<std::set<clust::IntegralCluster>> LocalOrbitsCache::local_orbits(
+    OccEvent const &event) {
+  std::shared_ptr<LocalOrbitsPrototype const> entry = prototype(event);
+  std::pair<Index, xtal::UnitCell> op =
+      find_equivalence_op(entry->prototype, event);
+  return clust::make_equivalent_local_orbits(
+      entry->local_orbits,
+      m_occevent_symgroup_rep[op.first].unitcellcoord_rep, op.second);
+}
+
+/// \brief Get the prototype entry for an OccEvent's orbit, constructing it
+///     if not cached
+///
+/// \param event An OccEvent, in any unit cell
+std::shared_ptr<LocalOrbitsPrototype const> LocalOrbitsCache::prototype(
+    OccEvent const &event) {
+  OccEvent key = make_prototype(event);
+  std::promise<std::shared_ptr<LocalOrbitsPrototype const>> promise;
+  std::shared_future<std::shared_ptr<LocalOrbitsPrototype const>> future;
+  bool is_owner = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      ++m_n_hits;
+      future = it->second;
+    } else {
+      ++m_n_misses;
+      future = promise.get_future().share();
+      m_entries.emplace(key, future);
+      is_owner = true;
+    }
+  }
+  if (!is_owner) {
+    // constructed, or being constructed, by another call
+    return future.get();
+  }
+
+  try {
+    promise.set_value(_make_entry(key));
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.erase(key);
+  }
+  return future.get();
+}
+
+/// \brief Return the prototype of an OccEvent's prim periodic orbit
+///
+/// The prototype is the greatest equivalent under the prim factor group,
+/// after translation to the origin unit cell, which is the last element of
+/// `make_prim_periodic_orbit(event, ...)`.
+OccEvent LocalOrbitsCache::make_prototype(OccEvent const &event) const {
+  OccEvent best;
+  OccEvent scratch;
+  return group::make_canonical_element(
+      event, m_occevent_symgroup_rep.begin(), m_occevent_symgroup_rep.end(),
+      std::less<OccEvent>(), prim_periodic_occevent_apply, best, scratch);
+}
+
+/// \brief Find the prim factor group index and translation that map the
+///     prototype onto an equivalent OccEvent
+///
+/// \param prototype The prototype of the orbit of `event`
+/// \param event An OccEvent, in any unit cell
+///
+/// \returns `{factor_group_index, translation}`, for the first factor group
+///     operation such that applying it and then the translation to
+///     `prototype` gives `event`, up to standardization. Throws if `event`
+///     is not equivalent to `prototype`.
+std::pair<Index, xtal::UnitCell> LocalOrbitsCache::find_equivalence_op(
+    OccEvent const &prototype, OccEvent const &event) const {
+  OccEvent target = event;
+  standardize(target);
+  if (!target.size()) {
+    return std::make_pair(Index(0), xtal::UnitCell(0, 0, 0));
+  }
+  clust::IntegralCluster target_cluster = make_cluster(target);
+  for (Index i = 0; i < Index(m_occevent_symgroup_rep.size()); ++i) {
+    OccEvent test = copy_apply(m_occevent_symgroup_rep[i], prototype);
+    clust::IntegralCluster test_cluster = make_cluster(test);
+    xtal::UnitCell translation(0, 0, 0);
+    if (target_cluster.size() && test_cluster.size()) {
+      translation = target_cluster[0].unitcell() - test_cluster[0].unitcell();
+    }
+    test += translation;
+    standardize(test);
+    if (test == target) {
+      return std::make_pair(i, translation);
+    }
+  }
+  throw std::runtime_error(
+      "Error in LocalOrbitsCache::find_equivalence_op: event is not "
+      "equivalent to the prototype");
+}
+
+/// \brief Number of prototype entries stored
+Index LocalOrbitsCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Number of calls to `prototype` that found a stored value
+Index LocalOrbitsCache::n_hits() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_n_hits;
+}
+
+/// \brief Number of calls to `prototype` that constructed a value
+Index LocalOrbitsCache::n_misses() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_n_misses;
+}
+
+/// \brief Remove all stored values
+///
+/// Values already returned remain valid.
+void LocalOrbitsCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+  m_n_hits = 0;
+  m_n_misses = 0;
+}
+
+std::shared_ptr<LocalOrbitsPrototype const> LocalOrbitsCache::_make_entry(
+    OccEvent const &prototype) const {
+  auto entry = std::make_shared<LocalOrbitsPrototype>();
+  entry->prototype = prototype;
+  entry->invariant_group = make_occevent_group(
+      prototype, m_prim_factor_group, m_prim->lattice().lat_column_mat(),
+      m_occevent_symgroup_rep);
+  auto unitcellcoord_symgroup_rep = sym_info::make_unitcellcoord_symgroup_rep(
+      entry->invariant_group->element, *m_prim);
+  entry->local_orbits = clust::make_local_orbits(
+      m_prim, unitcellcoord_symgroup_rep, m_site_filter, m_max_length,
+      m_custom_generators, make_cluster(prototype), m_cutoff_radius,
+      m_include_phenomenal_sites);
+  return entry;
+}
+
+}  // namespace occ_events
+}  // namespace CASM
@@ -1,6 +1,9 @@
 #include "casm/configuration/occ_events/OccEvent.hh"
 
+#include <functional>
+
 #include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/hash.hh"
 #include "casm/configuration/occ_events/OccEventRep.hh"
 #include "casm/configuration/occ_events/OccPosition.hh"
 #include "casm/configuration/occ_events/OccTrajectory.hh"
@@ -221,5 +224,29 @@ OccEvent copy_apply(OccEventRep const &rep, OccEvent occ_event) {
   return occ_event;
 }
 
+/// \brief Hash of an OccEvent, consistent with OccEvent equality
+std::size_t OccEventHash::operator()(OccEvent const &event) const {
+  std::size_t seed = event.size();
+  for (OccTrajectory const &traj : event) {
+    hash_combine(seed, traj.position.size());
+    for (OccPosition const &pos : traj.position) {
+      hash_combine(seed, 2 * pos.is_in_reservoir + pos.is_atom);
+      hash_combine(seed, std::hash<Index>()(pos.occupant_index));
+      if (pos.is_in_reservoir) {
+        continue;
+      }
+      xtal::UnitCellCoord const &site = pos.integral_site_coordinate;
+      hash_combine(seed, std::hash<Index>()(site.sublattice()));
+      for (Index i = 0; i < 3; ++i) {
+        hash_combine(seed, std::hash<long>()(site.unitcell()(i)));
+      }
+      if (pos.is_atom) {
+        hash_combine(seed, std::hash<Index>()(pos.atom_position_index));
+      }
+    }
+  }
+  return seed;
+}
+
 }  // namespace occ_events
 }  // namespace CASM
@@ -799,9 +799,22 @@ class TrajectoryCounter : public SingleStepBase<OccEventCounterData> {
   ///
   /// Notes:
   /// - Permutes `position_final` until no more permutations allowed
+  /// - If the last state checked failed a trajectory constraint at
+  ///   trajectory `i`, all remaining permutations with the same
+  ///   `position_final[0..i]` are skipped, by putting the rest of
+  ///   `position_final` in last (descending) permutation order first
   bool advance() override {
-    bool valid = std::next_permutation(data()->position_final.begin(),
-                                       data()->position_final.end());
+    auto &position_final = data()->position_final;
+    if (m_prune_index >= 0) {
+      std::sort(position_final.begin() + m_prune_index + 1,
+                position_final.end(),
+                [](OccPosition const &A, OccPosition const &B) {
+                  return B < A;
+                });
+      m_prune_index = -1;
+    }
+    bool valid =
+        std::next_permutation(position_final.begin(), position_final.end());
     if (valid) {
       data()->occ_event =
           make_occevent(data()->position_init, data()->position_final);
@@ -818,6 +831,10 @@ class TrajectoryCounter : public SingleStepBase<OccEventCounterData> {
 
   /// \brief Return true if in a not-finished && allowed state
   bool is_allowed() const override {
+    if (std::string const *what = this->fails_trajectory_constraints()) {
+      _fails(*what);
+      return false;
+    }
     if (this->fails_require_chemical_type_conserving_trajectories()) {
       _fails("trajectory:require_chemical_type_conserving_trajectories");
       return false;
@@ -893,6 +910,84 @@ class TrajectoryCounter : public SingleStepBase<OccEventCounterData> {
     }
   }
 
+  /// \brief Check each trajectory, in order, against the constraints
+  ///     that can be decided for a partial assignment of trajectories
+  ///     (max_trajectory_length, max_moving_atoms, allowed_species_pairs)
+  ///
+  /// \returns Pointer to the name of the failed constraint, or nullptr if
+  ///     all trajectories pass. If a trajectory fails, `m_prune_index`
+  ///     is set to its index, so that `advance` can skip every
+  ///     permutation with the same failing prefix.
+  std::string const *fails_trajectory_constraints() const {
+    static std::string const max_trajectory_length =
+        "trajectory:max_trajectory_length";
+    static std::string const max_moving_atoms = "trajectory:max_moving_atoms";
+    static std::string const allowed_species_pairs =
+        "trajectory:allowed_species_pairs";
+
+    auto const &params = data()->params;
+    if (!params.max_trajectory_length.has_value() &&
+        !params.max_moving_atoms.has_value() &&
+        !params.allowed_species_pairs.has_value()) {
+      return nullptr;
+    }
+    OccSystem const &system = *data()->system;
+    auto const &position_init = data()->position_init;
+    auto const &position_final = data()->position_final;
+    Index n_moving = 0;
+    for (Index i = 0; i < position_init.size(); ++i) {
+      OccPosition const &before = position_init[i];
+      OccPosition const &after = position_final[i];
+      if (before.is_in_reservoir == after.is_in_reservoir &&
+          (before.is_in_reservoir ||
+           before.integral_site_coordinate == after.integral_site_coordinate)) {
+        continue;
+      }
+      if (system.is_vacancy(before)) {
+        continue;
+      }
+      ++n_moving;
+      if (params.max_moving_atoms.has_value() &&
+          n_moving > *params.max_moving_atoms) {
+        m_prune_index = i;
+        return &max_moving_atoms;
+      }
+      if (params.max_trajectory_length.has_value() && !before.is_in_reservoir &&
+          !after.is_in_reservoir &&
+          (system.get_cartesian_coordinate(after) -
+           system.get_cartesian_coordinate(before))
+                  .norm() > *params.max_trajectory_length + m_tol) {
+        m_prune_index = i;
+        return &max_trajectory_length;
+      }
+      if (params.allowed_species_pairs.has_value() &&
+          !params.allowed_species_pairs->count(std::make_pair(
+              system.get_atom_name(before), _initial_chemical_name(after)))) {
+        m_prune_index = i;
+        return &allowed_species_pairs;
+      }
+    }
+    return nullptr;
+  }
+
+  /// \brief Name of the chemical on the site of `position` in the
+  ///     initial occupation, or of the chemical in the reservoir
+  std::string _initial_chemical_name(OccPosition const &position) const {
+    if (position.is_in_reservoir) {
+      return data()->system->get_chemical_name(position);
+    }
+    auto const &cluster = data()->cluster;
+    auto const &occ_init = data()->occ_init_counter();
+    for (Index j = 0; j < cluster.size(); ++j) {
+      if (cluster[j] == position.integral_site_coordinate) {
+        return data()->system->get_chemical_name(cluster[j], occ_init[j]);
+      }
+    }
+    throw std::runtime_error(
+        "Error in OccEventCounter: trajectory destination is not a cluster "
+        "site");
+  }
+
   /// \brief Check for trajectories in which the atom/molecule type
   ///     changes (should always be required except for debugging
   ///     purposes) (require_chemical_type_conserving_trajectories)
@@ -953,6 +1048,8 @@ class TrajectoryCounter : public SingleStepBase<OccEventCounterData> {
   ///     generated.
   void initialize() const override {
     data()->trajectory_finished = false;
+    m_prune_index = -1;
+    m_tol = data()->system->prim->lattice().tol();
 
     data()->system->make_occ_positions(
         data()->position_init, m_count, data()->cluster,
@@ -973,6 +1070,13 @@ class TrajectoryCounter : public SingleStepBase<OccEventCounterData> {
  private:
   /// \brief Temporary variable used for checking atom/molecule conservation
   mutable Eigen::VectorXi m_count;
+
+  /// \brief Index of the trajectory that failed a trajectory constraint in
+  ///     the last state checked, or -1
+  mutable Index m_prune_index = -1;
+
+  /// \brief Tolerance used to compare trajectory lengths
+  mutable double m_tol = TOL;
 };
 
 }  // namespace
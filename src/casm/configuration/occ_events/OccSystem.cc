@@ -1,6 +1,11 @@
 #include "casm/configuration/occ_events/OccSystem.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <optional>
+#include <sstream>
+#include <unordered_map>
 
 #include "casm/configuration/clusterography/IntegralCluster.hh"
 #include "casm/configuration/occ_events/OccPosition.hh"
@@ -109,6 +114,31 @@ OccSystem::OccSystem(std::shared_ptr<xtal::BasicStructure const> const &_prim,
     }
     ++b;
   }
+
+  // --- build flat lookup tables ---
+
+  std::size_t max_short_index = std::numeric_limits<short_index_type>::max();
+  if (chemical_name_list.size() > max_short_index ||
+      orientation_name_list.size() > max_short_index ||
+      atom_name_list.size() > max_short_index) {
+    throw std::runtime_error(
+        "Error constructing OccSystem: too many chemical, orientation, or atom "
+        "names");
+  }
+  atom_position_offset.push_back(0);
+  for (Index b = 0; b < prim->basis().size(); ++b) {
+    occupant_offset.push_back(flat_occupant_to_chemical_index.size());
+    for (Index i = 0; i < occupant_to_chemical_index[b].size(); ++i) {
+      flat_occupant_to_chemical_index.push_back(
+          occupant_to_chemical_index[b][i]);
+      flat_occupant_to_orientation_index.push_back(
+          occupant_to_orientation_index[b][i]);
+      for (int atom_name_index : atom_position_to_name_index[b][i]) {
+        flat_atom_position_to_name_index.push_back(atom_name_index);
+      }
+      atom_position_offset.push_back(flat_atom_position_to_name_index.size());
+    }
+  }
 }
 
 OccPosition OccSystem::make_molecule_position(
@@ -403,7 +433,7 @@ void OccSystem::molecule_count(Eigen::VectorXi &count,
   Index i = 0;
   for (auto const &site : cluster) {
     b = site.sublattice();
-    count(occupant_to_chemical_index[b][occ[i]]) += 1;
+    count(get_chemical_index(b, occ[i])) += 1;
     ++i;
   }
   return;
@@ -429,7 +459,7 @@ void OccSystem::orientation_count(Eigen::VectorXi &count,
   Index i = 0;
   for (auto const &site : cluster) {
     b = site.sublattice();
-    count(occupant_to_orientation_index[b][occ[i]]) += 1;
+    count(get_orientation_index(b, occ[i])) += 1;
     ++i;
   }
   return;
@@ -455,8 +485,10 @@ void OccSystem::atom_count(Eigen::VectorXi &count,
   Index i = 0;
   for (auto const &site : cluster) {
     b = site.sublattice();
-    for (auto const &atom_name_index : atom_position_to_name_index[b][occ[i]]) {
-      count(atom_name_index) += 1;
+    Index j = get_occupant_flat_index(b, occ[i]);
+    for (Index k = atom_position_offset[j]; k < atom_position_offset[j + 1];
+         ++k) {
+      count(flat_atom_position_to_name_index[k]) += 1;
     }
     ++i;
   }
@@ -484,8 +516,8 @@ bool OccSystem::is_molecule_conserving(
   Index i = 0;
   for (auto const &site : cluster) {
     b = site.sublattice();
-    count(occupant_to_chemical_index[b][occ_final[i]]) += 1;
-    count(occupant_to_chemical_index[b][occ_init[i]]) -= 1;
+    count(get_chemical_index(b, occ_final[i])) += 1;
+    count(get_chemical_index(b, occ_init[i])) -= 1;
     ++i;
   }
   return !count.any();
@@ -513,13 +545,15 @@ bool OccSystem::is_atom_conserving(Eigen::VectorXi &count,
   Index i = 0;
   for (auto const &site : cluster) {
     b = site.sublattice();
-    for (auto const &atom_name_index :
-         atom_position_to_name_index[b][occ_final[i]]) {
-      count(atom_name_index) += 1;
+    Index j = get_occupant_flat_index(b, occ_final[i]);
+    for (Index k = atom_position_offset[j]; k < atom_position_offset[j + 1];
+         ++k) {
+      count(flat_atom_position_to_name_index[k]) += 1;
     }
-    for (auto const &atom_name_index :
-         atom_position_to_name_index[b][occ_init[i]]) {
-      count(atom_name_index) -= 1;
+    j = get_occupant_flat_index(b, occ_init[i]);
+    for (Index k = atom_position_offset[j]; k < atom_position_offset[j + 1];
+         ++k) {
+      count(flat_atom_position_to_name_index[k]) -= 1;
     }
     ++i;
   }
@@ -595,8 +629,8 @@ bool OccSystem::is_any_unchanging_vacant_site(
   Index i = 0;
   for (auto const &site : cluster) {
     Index b = site.sublattice();
-    if (is_vacancy_list[occupant_to_chemical_index[b][occ_init[i]]] &&
-        is_vacancy_list[occupant_to_chemical_index[b][occ_final[i]]]) {
+    if (is_vacancy_list[get_chemical_index(b, occ_init[i])] &&
+        is_vacancy_list[get_chemical_index(b, occ_final[i])]) {
       return true;
     }
     ++i;
@@ -772,6 +806,147 @@ bool OccSystem::is_indivisible_molecule_breakup(
   return _check();
 }
 
+namespace {
+
+/// \brief Finds molecules in a list that are `xtal::Molecule::identical`
+///     to a given molecule
+///
+/// Candidates are found by a hash of the atom names and coordinates,
+/// rounded to the tolerance, and checked with `identical`. Molecules whose
+/// coordinates round differently are still found, by comparing with every
+/// molecule in the list when there is no candidate, so results are the same
+/// as a pairwise search while most lookups compare with one molecule.
+class _MoleculeLookup {
+ public:
+  _MoleculeLookup(std::vector<xtal::Molecule> const &_molecule_list,
+                  double _tol)
+      : m_molecule_list(_molecule_list), m_tol(_tol) {
+    for (Index i = 0; i < m_molecule_list.size(); ++i) {
+      m_index[_key(m_molecule_list[i])].push_back(i);
+    }
+  }
+
+  /// \brief Index of an identical molecule in the list, or -1
+  Index find(xtal::Molecule const &molecule) const {
+    auto it = m_index.find(_key(molecule));
+    if (it != m_index.end()) {
+      for (Index i : it->second) {
+        if (m_molecule_list[i].identical(molecule, m_tol)) {
+          return i;
+        }
+      }
+    }
+    for (Index i = 0; i < m_molecule_list.size(); ++i) {
+      if (m_molecule_list[i].identical(molecule, m_tol)) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  /// \brief Call after `molecule_list.push_back`
+  void push_back() {
+    Index i = m_molecule_list.size() - 1;
+    m_index[_key(m_molecule_list[i])].push_back(i);
+  }
+
+ private:
+  /// \brief Sorted atom names and rounded coordinates
+  std::string _key(xtal::Molecule const &molecule) const {
+    std::vector<std::string> atoms;
+    for (auto const &atom : molecule.atoms()) {
+      std::stringstream ss;
+      ss << atom.name();
+      for (Index i = 0; i < 3; ++i) {
+        ss << ' ' << std::llround(atom.cart()(i) / m_tol);
+      }
+      atoms.push_back(ss.str());
+    }
+    std::sort(atoms.begin(), atoms.end());
+    std::string key;
+    for (auto const &atom : atoms) {
+      key += atom;
+      key += ';';
+    }
+    return key;
+  }
+
+  std::vector<xtal::Molecule> const &m_molecule_list;
+  double m_tol;
+  std::unordered_map<std::string, std::vector<Index>> m_index;
+};
+
+/// \brief Check that a molecule has a name
+void _throw_if_empty_name(xtal::Molecule const &molecule) {
+  if (molecule.name().empty()) {
+    throw std::runtime_error("Error: molecule has empty name");
+  }
+}
+
+/// \brief As `is_contained_in_any_orientation`, using a lookup
+bool _is_contained_in_any_orientation(
+    _MoleculeLookup const &lookup,
+    std::vector<xtal::Molecule> const &molecule_list,
+    xtal::Molecule const &molecule,
+    std::vector<xtal::SymOp> const &factor_group) {
+  for (auto const &op : factor_group) {
+    xtal::Molecule tmol = sym::copy_apply(op, molecule);
+    _throw_if_empty_name(tmol);
+    Index i = lookup.find(tmol);
+    if (i != -1) {
+      if (molecule_list[i].name() != tmol.name()) {
+        throw std::runtime_error(
+            "Error: equivalent molecules have different names");
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+/// \brief All molecule orientations in a prim, and optionally the unique
+///     name of each
+std::vector<xtal::Molecule> _molecule_list_all_orientations(
+    xtal::BasicStructure const &prim,
+    std::vector<std::string> *orientation_name_list = nullptr) {
+  if (orientation_name_list &&
+      prim.unique_names().size() != prim.basis().size()) {
+    throw std::runtime_error("Error in orientation_name: basis size mismatch");
+  }
+  double tol = prim.lattice().tol();
+  std::vector<xtal::Molecule> molecule_list;
+  _MoleculeLookup lookup(molecule_list, tol);
+  Index b = 0;
+  for (auto const &site : prim.basis()) {
+    Index occupant_index = 0;
+    for (auto const &mol : site.occupant_dof()) {
+      _throw_if_empty_name(mol);
+      Index i = lookup.find(mol);
+      if (i != -1 && molecule_list[i].name() != mol.name()) {
+        throw std::runtime_error(
+            "Error: equivalent molecules have different names");
+      }
+      if (i == -1) {
+        molecule_list.emplace_back(mol);
+        lookup.push_back();
+        if (orientation_name_list) {
+          if (prim.unique_names()[b].size() != site.occupant_dof().size()) {
+            throw std::runtime_error(
+                "Error in orientation_name: occupant size mismatch");
+          }
+          orientation_name_list->push_back(
+              prim.unique_names()[b][occupant_index]);
+        }
+      }
+      ++occupant_index;
+    }
+    ++b;
+  }
+  return molecule_list;
+}
+
+}  // namespace
+
 /// \brief Check if a molecule is contained in a list, in given orientation
 bool is_contained_in_this_orientation(
     std::vector<xtal::Molecule> const &molecule_list,
@@ -821,16 +996,7 @@ bool is_valid_molecule_naming(xtal::BasicStructure const &prim,
 /// \brief Generate a list of all molecule orientations in a prim
 std::vector<xtal::Molecule> molecule_list_all_orientations(
     xtal::BasicStructure const &prim) {
-  double tol = prim.lattice().tol();
-  std::vector<xtal::Molecule> molecule_list;
-  for (auto const &site : prim.basis()) {
-    for (auto const &mol : site.occupant_dof()) {
-      if (!is_contained_in_this_orientation(molecule_list, mol, tol)) {
-        molecule_list.emplace_back(mol);
-      }
-    }
-  }
-  return molecule_list;
+  return _molecule_list_all_orientations(prim);
 }
 
 /// \brief Generate a list of symmetrically unique molecules in a prim
@@ -839,11 +1005,13 @@ std::vector<xtal::Molecule> molecule_list_single_orientation(
     std::vector<xtal::SymOp> const &factor_group) {
   double tol = prim.lattice().tol();
   std::vector<xtal::Molecule> molecule_list;
+  _MoleculeLookup lookup(molecule_list, tol);
   for (auto const &site : prim.basis()) {
     for (auto const &mol : site.occupant_dof()) {
-      if (!is_contained_in_any_orientation(molecule_list, mol, factor_group,
-                                           tol)) {
+      if (!_is_contained_in_any_orientation(lookup, molecule_list, mol,
+                                            factor_group)) {
         molecule_list.emplace_back(mol);
+        lookup.push_back();
       }
     }
   }
@@ -854,12 +1022,10 @@ std::vector<xtal::Molecule> molecule_list_single_orientation(
 ///     the `prim->unique_names()`
 std::vector<std::string> make_orientation_name_list(
     xtal::BasicStructure const &prim) {
-  std::vector<xtal::Molecule> molecule_list =
-      molecule_list_all_orientations(prim);
+  // the name of each orientation is the unique name of its first
+  // occurrence, as by `orientation_name`
   std::vector<std::string> orientation_name_list;
-  for (auto const &mol : molecule_list) {
-    orientation_name_list.push_back(orientation_name(mol, prim));
-  }
+  _molecule_list_all_orientations(prim, &orientation_name_list);
   return orientation_name_list;
 }
 
@@ -907,10 +1073,12 @@ std::vector<xtal::Molecule> molecule_list_single_orientation(
     std::vector<xtal::Molecule> const &molecule_list_all_orientations,
     std::vector<xtal::SymOp> const &factor_group, double tol) {
   std::vector<xtal::Molecule> molecule_list;
+  _MoleculeLookup lookup(molecule_list, tol);
   for (auto const &mol : molecule_list_all_orientations) {
-    if (!is_contained_in_any_orientation(molecule_list, mol, factor_group,
-                                         tol)) {
+    if (!_is_contained_in_any_orientation(lookup, molecule_list, mol,
+                                          factor_group)) {
       molecule_list.emplace_back(mol);
+      lookup.push_back();
     }
   }
   return molecule_list;
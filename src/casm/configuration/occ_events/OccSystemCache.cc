@@ -0,0 +1,116 @@
+#include "casm/configuration/occ_events/OccSystemCache.hh"
+
+#include <sstream>
+#include <stdexcept>
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/group/Group.hh"
+#include "casm/configuration/occ_events/OccSystem.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/io/BasicStructureIO.hh"
+
+namespace CASM {
+namespace occ_events {
+
+namespace {
+
+/// \brief Prim JSON, with the lattice tolerance, as a string
+std::string _make_prim_key(xtal::BasicStructure const &prim) {
+  jsonParser json;
+  bool include_va = true;
+  write_prim(prim, json, FRAC, include_va);
+  json["xtal_tol"] = prim.lattice().tol();
+  std::stringstream ss;
+  ss << json;
+  return ss.str();
+}
+
+}  // namespace
+
+/// \brief Constructor
+OccSystemCache::OccSystemCache() {}
+
+/// \brief Return the stored OccSystem, or construct, store, and return a
+///     new OccSystem
+///
+/// \param prim The prim
+/// \param chemical_name_list Names of the unique chemical components. If
+///     not has_value, `make_chemical_name_list` with the prim factor group
+///     is used.
+/// \param vacancy_name_list Chemical names that indicate vacancies
+///
+/// The lock is not held while a new OccSystem is constructed, so concurrent
+/// calls with the same arguments may each construct it. Only the first
+/// result stored is kept and returned.
+std::shared_ptr<OccSystem const> OccSystemCache::make(
+    std::shared_ptr<xtal::BasicStructure const> const &prim,
+    std::optional<std::vector<std::string>> const &chemical_name_list,
+    std::set<std::string> const &vacancy_name_list) {
+  if (prim == nullptr) {
+    throw std::runtime_error("Error in OccSystemCache::make: prim == nullptr");
+  }
+  std::string prim_key = _make_prim_key(*prim);
+
+  std::vector<std::string> _chemical_name_list;
+  if (chemical_name_list.has_value()) {
+    _chemical_name_list = *chemical_name_list;
+  } else {
+    bool is_found = false;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_chemical_name_lists.find(prim_key);
+      if (it != m_chemical_name_lists.end()) {
+        _chemical_name_list = it->second;
+        is_found = true;
+      }
+    }
+    if (!is_found) {
+      auto factor_group = sym_info::make_factor_group(*prim);
+      _chemical_name_list =
+          make_chemical_name_list(*prim, factor_group->element);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_chemical_name_lists.emplace(prim_key, _chemical_name_list);
+    }
+  }
+
+  key_type key(prim_key, _chemical_name_list, vacancy_name_list);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      return it->second;
+    }
+  }
+
+  auto result = std::make_shared<OccSystem const>(prim, _chemical_name_list,
+                                                  vacancy_name_list);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.emplace(key, result).first->second;
+}
+
+/// \brief Number of OccSystem stored
+Index OccSystemCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// \brief Erase stored results
+///
+/// OccSystem already returned remain valid.
+void OccSystemCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_chemical_name_lists.clear();
+  m_entries.clear();
+}
+
+/// \brief Process-wide OccSystemCache
+///
+/// Constructed on first use.
+OccSystemCache &occ_system_cache() {
+  static OccSystemCache cache;
+  return cache;
+}
+
+}  // namespace occ_events
+}  // namespace CASM
@@ -0,0 +1,183 @@
+#include "casm/configuration/occ_events/PackedOccEvent.hh"
+
+#include <stdexcept>
+
+#include "casm/configuration/hash.hh"
+#include "casm/configuration/occ_events/OccEvent.hh"
+#include "casm/configuration/occ_events/OccPosition.hh"
+#include "casm/configuration/occ_events/OccTrajectory.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+
+namespace CASM {
+namespace occ_events {
+
+namespace {
+
+typedef PackedOccPosition P;
+
+constexpr int _atom_position_shift = 0;
+constexpr int _occupant_shift = _atom_position_shift + P::atom_position_bits;
+constexpr int _sublattice_shift = _occupant_shift + P::occupant_bits;
+constexpr int _k_shift = _sublattice_shift + P::sublattice_bits;
+constexpr int _j_shift = _k_shift + P::unitcell_bits;
+constexpr int _i_shift = _j_shift + P::unitcell_bits;
+constexpr int _kind_shift = _i_shift + P::unitcell_bits;
+static_assert(_kind_shift + P::kind_bits == 64,
+              "PackedOccPosition fields must fill 64 bits");
+
+constexpr std::uint64_t _kind_molecule = 0;
+constexpr std::uint64_t _kind_atom = 1;
+constexpr std::uint64_t _kind_reservoir = 2;
+
+constexpr std::uint64_t _mask(int n_bits) {
+  return (std::uint64_t(1) << n_bits) - 1;
+}
+
+bool _fits(Index value, int n_bits) {
+  return value >= 0 && static_cast<std::uint64_t>(value) <= _mask(n_bits);
+}
+
+bool _fits_unitcell(long value) {
+  return value >= -P::unitcell_offset && value < P::unitcell_offset;
+}
+
+std::uint64_t _field(std::uint64_t value, int shift, int n_bits) {
+  return (value >> shift) & _mask(n_bits);
+}
+
+}  // namespace
+
+/// \brief Return true if `pos` can be packed
+bool PackedOccPosition::is_packable(OccPosition const &pos) {
+  if (!_fits(pos.occupant_index, occupant_bits)) {
+    return false;
+  }
+  if (pos.is_in_reservoir) {
+    return true;
+  }
+  xtal::UnitCellCoord const &site = pos.integral_site_coordinate;
+  if (!_fits(site.sublattice(), sublattice_bits)) {
+    return false;
+  }
+  for (Index i = 0; i < 3; ++i) {
+    if (!_fits_unitcell(site.unitcell()(i))) {
+      return false;
+    }
+  }
+  return !pos.is_atom || _fits(pos.atom_position_index, atom_position_bits);
+}
+
+/// \brief Pack an OccPosition; throws if it is not packable
+std::uint64_t PackedOccPosition::pack(OccPosition const &pos) {
+  if (!is_packable(pos)) {
+    throw std::runtime_error(
+        "Error in PackedOccPosition::pack: OccPosition is out of range");
+  }
+  std::uint64_t occ = static_cast<std::uint64_t>(pos.occupant_index);
+  if (pos.is_in_reservoir) {
+    return (_kind_reservoir << _kind_shift) | (occ << _occupant_shift);
+  }
+  xtal::UnitCellCoord const &site = pos.integral_site_coordinate;
+  auto _unitcell = [&](Index i) {
+    return static_cast<std::uint64_t>(site.unitcell()(i) + unitcell_offset);
+  };
+  std::uint64_t value = ((pos.is_atom ? _kind_atom : _kind_molecule)
+                         << _kind_shift) |
+                        (_unitcell(0) << _i_shift) |
+                        (_unitcell(1) << _j_shift) |
+                        (_unitcell(2) << _k_shift) |
+                        (static_cast<std::uint64_t>(site.sublattice())
+                         << _sublattice_shift) |
+                        (occ << _occupant_shift);
+  if (pos.is_atom) {
+    value |= static_cast<std::uint64_t>(pos.atom_position_index)
+             << _atom_position_shift;
+  }
+  return value;
+}
+
+/// \brief Unpack an OccPosition
+OccPosition PackedOccPosition::unpack(std::uint64_t value) {
+  std::uint64_t kind = _field(value, _kind_shift, kind_bits);
+  Index occ = _field(value, _occupant_shift, occupant_bits);
+  if (kind == _kind_reservoir) {
+    return OccPosition::molecule_in_reservoir(occ);
+  }
+  auto _unitcell = [&](int shift) {
+    return static_cast<long>(_field(value, shift, unitcell_bits)) -
+           unitcell_offset;
+  };
+  xtal::UnitCellCoord site(
+      _field(value, _sublattice_shift, sublattice_bits), _unitcell(_i_shift),
+      _unitcell(_j_shift), _unitcell(_k_shift));
+  if (kind == _kind_atom) {
+    return OccPosition::atom(
+        site, occ, _field(value, _atom_position_shift, atom_position_bits));
+  }
+  return OccPosition::molecule(site, occ);
+}
+
+/// \brief Pack an OccEvent; throws if it is not packable
+PackedOccEvent::PackedOccEvent(OccEvent const &event) {
+  Index n = 1;
+  for (OccTrajectory const &traj : event) {
+    n += 1 + traj.position.size();
+  }
+  key.reserve(n);
+  key.push_back(event.size());
+  for (OccTrajectory const &traj : event) {
+    key.push_back(traj.position.size());
+    for (OccPosition const &pos : traj.position) {
+      key.push_back(PackedOccPosition::pack(pos));
+    }
+  }
+}
+
+/// \brief Return true if all positions in `event` can be packed
+bool PackedOccEvent::is_packable(OccEvent const &event) {
+  for (OccTrajectory const &traj : event) {
+    for (OccPosition const &pos : traj.position) {
+      if (!PackedOccPosition::is_packable(pos)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/// \brief Unpack the OccEvent
+///
+/// Positions in the reservoir are unpacked as
+/// `OccPosition::molecule_in_reservoir`, which compares equal to
+/// `OccPosition::atom_in_reservoir` for the same occupant.
+OccEvent PackedOccEvent::unpack() const {
+  if (key.empty()) {
+    throw std::runtime_error("Error in PackedOccEvent::unpack: empty key");
+  }
+  std::vector<OccTrajectory> trajectories;
+  auto it = key.begin() + 1;
+  for (std::uint64_t t = 0; t < key[0]; ++t) {
+    if (it == key.end() || std::uint64_t(key.end() - it) <= *it) {
+      throw std::runtime_error("Error in PackedOccEvent::unpack: bad key");
+    }
+    OccTrajectory traj;
+    std::uint64_t n_position = *it++;
+    for (std::uint64_t p = 0; p < n_position; ++p) {
+      traj.position.push_back(PackedOccPosition::unpack(*it++));
+    }
+    trajectories.push_back(std::move(traj));
+  }
+  return OccEvent(std::move(trajectories));
+}
+
+/// \brief Hash of a PackedOccEvent
+std::size_t PackedOccEventHash::operator()(PackedOccEvent const &event) const {
+  std::size_t seed = event.key.size();
+  for (std::uint64_t value : event.key) {
+    hash_combine(seed, value);
+  }
+  return seed;
+}
+
+}  // namespace occ_events
+}  // namespace CASM
@@ -0,0 +1,371 @@
+#include "casm/configuration/occ_events/io/binary/OccEvent_binary_io.hh"
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include "casm/configuration/occ_events/OccEvent.hh"
+#include "casm/configuration/occ_events/OccPosition.hh"
+#include "casm/configuration/occ_events/OccSystem.hh"
+#include "casm/configuration/occ_events/OccTrajectory.hh"
+#include "casm/configuration/occ_events/PackedOccEvent.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+
+namespace CASM {
+namespace occ_events {
+
+namespace {
+
+// occ_events does not depend on config, so the little-endian helpers of
+// config::binary_io are repeated here
+
+template <typename UIntType>
+void _write_uint(std::ostream &out, UIntType value) {
+  char bytes[sizeof(UIntType)];
+  for (std::size_t i = 0; i < sizeof(UIntType); ++i) {
+    bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
+  out.write(bytes, sizeof(UIntType));
+}
+
+void _write_u8(std::ostream &out, unsigned char value) {
+  _write_uint(out, static_cast<std::uint8_t>(value));
+}
+
+void _write_u32(std::ostream &out, Index value) {
+  if (value < 0 || value > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::runtime_error(
+        "Error writing binary OccEvent: value out of range");
+  }
+  _write_uint(out, static_cast<std::uint32_t>(value));
+}
+
+void _write_i64(std::ostream &out, std::int64_t value) {
+  _write_uint(out, static_cast<std::uint64_t>(value));
+}
+
+void _read_exact(std::istream &in, char *data, Index n) {
+  in.read(data, n);
+  if (in.gcount() != n) {
+    throw std::runtime_error(
+        "Error reading binary OccEvent: unexpected end of stream");
+  }
+}
+
+template <typename UIntType>
+UIntType _read_uint(std::istream &in) {
+  unsigned char bytes[sizeof(UIntType)];
+  _read_exact(in, reinterpret_cast<char *>(bytes), sizeof(UIntType));
+  UIntType value = 0;
+  for (std::size_t i = 0; i < sizeof(UIntType); ++i) {
+    value |= static_cast<UIntType>(bytes[i]) << (8 * i);
+  }
+  return value;
+}
+
+unsigned char _read_u8(std::istream &in) {
+  return _read_uint<std::uint8_t>(in);
+}
+
+Index _read_u32(std::istream &in) { return _read_uint<std::uint32_t>(in); }
+
+Index _read_i64(std::istream &in) {
+  return static_cast<std::int64_t>(_read_uint<std::uint64_t>(in));
+}
+
+/// \brief Incremental 64-bit FNV-1a hash
+struct _Fnv1a {
+  std::uint64_t value = 14695981039346656037ULL;
+
+  void add(std::uint64_t x) {
+    for (int i = 0; i < 8; ++i) {
+      value ^= (x >> (8 * i)) & 0xff;
+      value *= 1099511628211ULL;
+    }
+  }
+
+  void add(std::string const &s) {
+    add(s.size());
+    for (unsigned char c : s) {
+      value ^= c;
+      value *= 1099511628211ULL;
+    }
+  }
+
+  template <typename T>
+  void add(std::vector<T> const &v) {
+    add(v.size());
+    for (auto const &x : v) {
+      add(x);
+    }
+  }
+
+  void add(int x) { add(static_cast<std::uint64_t>(static_cast<Index>(x))); }
+};
+
+void _write_header(std::ostream &out, OccSystem const &system) {
+  out.write(OCC_EVENT_BINARY_MAGIC, sizeof(OCC_EVENT_BINARY_MAGIC));
+  _write_u32(out, OCC_EVENT_BINARY_VERSION);
+  _write_uint(out, make_occsystem_digest(system));
+}
+
+void _read_header(std::istream &in, OccSystem const &system) {
+  char magic[sizeof(OCC_EVENT_BINARY_MAGIC)];
+  _read_exact(in, magic, sizeof(magic));
+  if (std::memcmp(magic, OCC_EVENT_BINARY_MAGIC, sizeof(magic)) != 0) {
+    throw std::runtime_error(
+        "Error reading binary OccEvent: not a binary OccEvent stream");
+  }
+  Index version = _read_u32(in);
+  if (version < 1 || version > OCC_EVENT_BINARY_VERSION) {
+    throw std::runtime_error(
+        "Error reading binary OccEvent: unsupported version " +
+        std::to_string(version));
+  }
+  std::uint64_t digest = _read_uint<std::uint64_t>(in);
+  if (digest != make_occsystem_digest(system)) {
+    throw std::runtime_error(
+        "Error reading binary OccEvent: written for a different OccSystem");
+  }
+}
+
+void _write_event(std::ostream &out, OccEvent const &event) {
+  if (PackedOccEvent::is_packable(event)) {
+    PackedOccEvent packed(event);
+    _write_u8(out, 'P');
+    _write_u32(out, packed.key.size());
+    for (std::uint64_t value : packed.key) {
+      _write_uint(out, value);
+    }
+    return;
+  }
+  _write_u8(out, 'F');
+  _write_u32(out, event.size());
+  for (OccTrajectory const &traj : event) {
+    _write_u32(out, traj.position.size());
+    for (OccPosition const &pos : traj.position) {
+      xtal::UnitCellCoord const &site = pos.integral_site_coordinate;
+      _write_u8(out, (pos.is_in_reservoir ? 1 : 0) |
+                                   (pos.is_atom ? 2 : 0));
+      _write_i64(out, site.sublattice());
+      _write_i64(out, site.unitcell()(0));
+      _write_i64(out, site.unitcell()(1));
+      _write_i64(out, site.unitcell()(2));
+      _write_i64(out, pos.occupant_index);
+      _write_i64(out, pos.atom_position_index);
+    }
+  }
+}
+
+/// \brief Throw if the indices of `pos` are not valid for `system`
+void _check_position(OccPosition const &pos, OccSystem const &system) {
+  bool is_valid = true;
+  if (pos.is_in_reservoir) {
+    is_valid = pos.occupant_index >= 0 &&
+               pos.occupant_index < system.chemical_name_list.size();
+  } else {
+    Index b = pos.integral_site_coordinate.sublattice();
+    auto const &occupants = system.occupant_to_chemical_index;
+    is_valid = b >= 0 && b < occupants.size() && pos.occupant_index >= 0 &&
+               pos.occupant_index < occupants[b].size();
+    if (is_valid && pos.is_atom) {
+      auto const &atoms =
+          system.atom_position_to_name_index[b][pos.occupant_index];
+      is_valid = pos.atom_position_index >= 0 &&
+                 pos.atom_position_index < atoms.size();
+    }
+  }
+  if (!is_valid) {
+    throw std::runtime_error(
+        "Error reading binary OccEvent: position index out of range");
+  }
+}
+
+OccEvent _read_event(std::istream &in, OccSystem const &system) {
+  unsigned char encoding = _read_u8(in);
+  if (encoding == 'P') {
+    PackedOccEvent packed;
+    Index n = _read_u32(in);
+    packed.key.resize(n);
+    for (Index i = 0; i < n; ++i) {
+      packed.key[i] = _read_uint<std::uint64_t>(in);
+    }
+    OccEvent event = packed.unpack();
+    for (OccTrajectory const &traj : event) {
+      for (OccPosition const &pos : traj.position) {
+        _check_position(pos, system);
+      }
+    }
+    return event;
+  }
+  if (encoding != 'F') {
+    throw std::runtime_error(
+        "Error reading binary OccEvent: unknown event encoding");
+  }
+  Index n_traj = _read_u32(in);
+  std::vector<OccTrajectory> trajectories;
+  trajectories.reserve(n_traj);
+  for (Index t = 0; t < n_traj; ++t) {
+    Index n_pos = _read_u32(in);
+    std::vector<OccPosition> positions;
+    positions.reserve(n_pos);
+    for (Index p = 0; p < n_pos; ++p) {
+      unsigned char flags = _read_u8(in);
+      Index b = _read_i64(in);
+      Index i = _read_i64(in);
+      Index j = _read_i64(in);
+      Index k = _read_i64(in);
+      Index occupant_index = _read_i64(in);
+      Index atom_position_index = _read_i64(in);
+      positions.emplace_back((flags & 1) != 0, (flags & 2) != 0,
+                             xtal::UnitCellCoord(b, i, j, k), occupant_index,
+                             atom_position_index);
+      _check_position(positions.back(), system);
+    }
+    trajectories.emplace_back(std::move(positions));
+  }
+  return OccEvent(std::move(trajectories));
+}
+
+/// \brief Read the number of events or groups, checking it is valid
+Index _read_size(std::istream &in) {
+  Index n = _read_i64(in);
+  if (n < 0) {
+    throw std::runtime_error("Error reading binary OccEvent: invalid size");
+  }
+  return n;
+}
+
+}  // namespace
+
+/// \brief Digest of the OccSystem indices that OccEvent refer to
+std::uint64_t make_occsystem_digest(OccSystem const &system) {
+  _Fnv1a hash;
+  hash.add(system.prim->basis().size());
+  hash.add(system.chemical_name_list);
+  hash.add(system.atom_name_list);
+  hash.add(system.orientation_name_list);
+  hash.add(system.occupant_to_chemical_index);
+  hash.add(system.occupant_to_orientation_index);
+  hash.add(system.atom_position_to_name_index);
+  return hash.value;
+}
+
+/// \brief Write OccEvent in binary format
+///
+/// \param out The output stream
+/// \param events The events to write
+/// \param system The OccSystem, whose digest is written so that readers can
+///     check that event indices have the same meaning
+void write_binary(std::ostream &out, std::vector<OccEvent> const &events,
+                  OccSystem const &system) {
+  _write_header(out, system);
+  _write_i64(out, 1);
+  _write_i64(out, events.size());
+  for (OccEvent const &event : events) {
+    _write_event(out, event);
+  }
+}
+
+/// \brief Write OccEvent orbits in binary format
+///
+/// \param out The output stream
+/// \param orbits The orbits to write. Events are written in orbit order.
+/// \param system The OccSystem
+void write_binary(std::ostream &out,
+                  std::vector<std::set<OccEvent>> const &orbits,
+                  OccSystem const &system) {
+  _write_header(out, system);
+  _write_i64(out, orbits.size());
+  for (std::set<OccEvent> const &orbit : orbits) {
+    _write_i64(out, orbit.size());
+    for (OccEvent const &event : orbit) {
+      _write_event(out, event);
+    }
+  }
+}
+
+/// \brief Read OccEvent from binary format
+///
+/// \param in The input stream
+/// \param system The OccSystem. Throws if it does not have the digest of
+///     the OccSystem the events were written with.
+/// \param events Events are appended to this list, in order. If the stream
+///     contains orbits, the events of all orbits are appended.
+///
+/// Events are constructed directly from integer indices, without chemical
+/// or atom name lookups; indices are only checked to be in range.
+void read_binary(std::istream &in, OccSystem const &system,
+                 std::vector<OccEvent> &events) {
+  _read_header(in, system);
+  Index n_groups = _read_size(in);
+  for (Index g = 0; g < n_groups; ++g) {
+    Index n = _read_size(in);
+    events.reserve(events.size() + n);
+    for (Index i = 0; i < n; ++i) {
+      events.push_back(_read_event(in, system));
+    }
+  }
+}
+
+/// \brief Read OccEvent orbits from binary format
+///
+/// \param in The input stream
+/// \param system The OccSystem. Throws if it does not have the digest of
+///     the OccSystem the orbits were written with.
+/// \param orbits Orbits are appended to this list, in order
+///
+/// Events are written in orbit order, so each is inserted at the end of
+/// its orbit.
+void read_binary(std::istream &in, OccSystem const &system,
+                 std::vector<std::set<OccEvent>> &orbits) {
+  _read_header(in, system);
+  Index n_groups = _read_size(in);
+  orbits.reserve(orbits.size() + n_groups);
+  for (Index g = 0; g < n_groups; ++g) {
+    Index n = _read_size(in);
+    std::set<OccEvent> orbit;
+    for (Index i = 0; i < n; ++i) {
+      orbit.emplace_hint(orbit.end(), _read_event(in, system));
+    }
+    orbits.push_back(std::move(orbit));
+  }
+}
+
+/// \brief Convert OccEvent to binary format
+std::string to_bytes(std::vector<OccEvent> const &events,
+                     OccSystem const &system) {
+  std::ostringstream out;
+  write_binary(out, events, system);
+  return out.str();
+}
+
+/// \brief Convert OccEvent orbits to binary format
+std::string to_bytes(std::vector<std::set<OccEvent>> const &orbits,
+                     OccSystem const &system) {
+  std::ostringstream out;
+  write_binary(out, orbits, system);
+  return out.str();
+}
+
+/// \brief Read OccEvent from binary format
+std::vector<OccEvent> occevents_from_bytes(std::string const &bytes,
+                                           OccSystem const &system) {
+  std::istringstream in(bytes);
+  std::vector<OccEvent> events;
+  read_binary(in, system, events);
+  return events;
+}
+
+/// \brief Read OccEvent orbits from binary format
+std::vector<std::set<OccEvent>> occevent_orbits_from_bytes(
+    std::string const &bytes, OccSystem const &system) {
+  std::istringstream in(bytes);
+  std::vector<std::set<OccEvent>> orbits;
+  read_binary(in, system, orbits);
+  return orbits;
+}
+
+}  // namespace occ_events
+}  // namespace CASM
@@ -1,6 +1,8 @@
 #include "casm/configuration/occ_events/io/json/OccEventCounter_json_io.hh"
 
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "casm/casm_io/container/json_io.hh"
 #include "casm/casm_io/json/InputParser_impl.hh"
@@ -128,6 +130,19 @@ jsonParser &to_json(occ_events::OccEventCounterParameters const &params,
                           "do_not_allow_breakup");
   _to_json.if_not_default(params.skip_direct_exchange, true,
                           "skip_direct_exchange");
+  _to_json(params.max_trajectory_length, "max_trajectory_length");
+  _to_json(params.max_moving_atoms, "max_moving_atoms");
+  if (params.allowed_species_pairs.has_value()) {
+    jsonParser &tjson = json["allowed_species_pairs"];
+    tjson.put_array();
+    for (auto const &pair : *params.allowed_species_pairs) {
+      jsonParser pair_json;
+      pair_json.put_array();
+      pair_json.push_back(pair.first);
+      pair_json.push_back(pair.second);
+      tjson.push_back(pair_json);
+    }
+  }
   _to_json.if_not_default(params.save_state_info, false, "save_state_info");
   return json;
 }
@@ -191,6 +206,23 @@ void parse(InputParser<occ_events::OccEventCounterParameters> &parser) {
                        false);
   parser.optional_else(params.skip_direct_exchange, "skip_direct_exchange",
                        true);
+  parser.optional(params.max_trajectory_length, "max_trajectory_length");
+  parser.optional(params.max_moving_atoms, "max_moving_atoms");
+
+  // list of [atom_name, chemical_name]
+  std::optional<std::vector<std::vector<std::string>>> allowed_species_pairs;
+  parser.optional(allowed_species_pairs, "allowed_species_pairs");
+  if (allowed_species_pairs.has_value()) {
+    params.allowed_species_pairs.emplace();
+    for (auto const &pair : *allowed_species_pairs) {
+      if (pair.size() != 2) {
+        parser.insert_error("allowed_species_pairs",
+                            "Error: expected [atom_name, chemical_name] pairs");
+        break;
+      }
+      params.allowed_species_pairs->emplace(pair[0], pair[1]);
+    }
+  }
   parser.optional_else(params.save_state_info, "save_state_info", false);
 
   if (!parser.valid()) {
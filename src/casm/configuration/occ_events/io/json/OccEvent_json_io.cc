@@ -61,7 +61,7 @@ void parse_non_reservoir_position(InputParser<occ_events::OccPosition> &parser,
     parser.error.insert("Error: Invalid occupant_index");
     return;
   }
-  Index mol_size = system.atom_position_to_name_index[b][occupant_index].size();
+  Index mol_size = system.get_n_atom_positions(b, occupant_index);
 
   std::unique_ptr<occ_events::OccPosition> p;
   try {
@@ -120,9 +120,8 @@ jsonParser &to_json(
       }
       if (!pos.is_atom) {
         Index b = pos.integral_site_coordinate.sublattice();
-        Index mol_size = system->get()
-                             .atom_position_to_name_index[b][pos.occupant_index]
-                             .size();
+        Index mol_size =
+            system->get().get_n_atom_positions(b, pos.occupant_index);
         if (mol_size > 1) {
           json["atom_name"] = system->get().get_atom_name(pos);
         }
@@ -341,6 +340,32 @@ jsonParser &to_json(
   return json;
 }
 
+/// \brief Write OccEvent orbits to a stream as a JSON array, one orbit at a
+///     time
+///
+/// Each orbit is written as by `to_json` for an OccEvent orbit, with the
+/// addition of "linear_orbit_index". Only one orbit is held as a jsonParser
+/// at a time, so memory use does not grow with the number of orbits. With
+/// `options.include_elements == false`, only prototypes are written.
+void write_occevent_orbits_json(
+    std::ostream &out,
+    std::vector<std::set<occ_events::OccEvent>> const &orbits,
+    std::optional<std::reference_wrapper<occ_events::OccSystem const>> system,
+    std::shared_ptr<occ_events::SymGroup const> const &factor_group,
+    std::vector<occ_events::OccEventRep> const &occevent_symgroup_rep,
+    occ_events::OccEventOutputOptions const &options,
+    JsonStreamOptions const &stream_options) {
+  JsonArrayWriter writer(out, stream_options);
+  for (Index i = 0; i < orbits.size(); ++i) {
+    jsonParser json;
+    json["linear_orbit_index"] = i;
+    to_json(orbits[i], json, system, factor_group, occevent_symgroup_rep,
+            options);
+    writer.write(std::move(json));
+  }
+  writer.finish();
+}
+
 void from_json(occ_events::OccEvent &event, jsonParser const &json,
                occ_events::OccSystem const &system) {
   event = jsonConstructor<occ_events::OccEvent>::from_json(json, system);
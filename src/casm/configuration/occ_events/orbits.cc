@@ -1,5 +1,10 @@
 #include "casm/configuration/occ_events/orbits.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <unordered_set>
+
 #include "casm/configuration/clusterography/IntegralCluster.hh"
 #include "casm/configuration/clusterography/orbits.hh"
 #include "casm/configuration/group/Group.hh"
@@ -9,6 +14,9 @@
 #include "casm/configuration/occ_events/OccEventCounter.hh"
 #include "casm/configuration/occ_events/OccEventInvariants.hh"
 #include "casm/configuration/occ_events/OccEventRep.hh"
+#include "casm/configuration/occ_events/PackedOccEvent.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/configuration/trace.hh"
 #include "casm/crystallography/BasicStructure.hh"
 #include "casm/crystallography/SymType.hh"
 
@@ -34,6 +42,29 @@ OccEvent prim_periodic_occevent_copy_apply(OccEventRep const &rep,
   return occ_event;
 }
 
+/// \brief Apply symmetry operation transformation to an OccEvent, writing
+///     the result into an existing OccEvent
+///
+/// \param rep, Symmetry operation representation to be applied
+/// \param occ_event, OccEvent to transform
+/// \param result, Set to the transformed OccEvent, sorted and translated to
+///     the origin unit cell. Its existing storage is reused.
+///
+/// \return A reference to `result`
+OccEvent &prim_periodic_occevent_apply(OccEventRep const &rep,
+                                       OccEvent const &occ_event,
+                                       OccEvent &result) {
+  result = occ_event;
+  if (!result.size()) {
+    return result;
+  }
+  apply(rep, result);
+  clust::IntegralCluster cluster = make_cluster(result);
+  result -= cluster[0].unitcell();
+  standardize(result);
+  return result;
+}
+
 /// \brief Make an orbit of OccEvent, with periodic symmetry of a prim
 ///
 /// \param orbit_element One OccEvent in the orbit
@@ -43,9 +74,10 @@ OccEvent prim_periodic_occevent_copy_apply(OccEventRep const &rep,
 std::set<OccEvent> make_prim_periodic_orbit(
     OccEvent const &orbit_element,
     std::vector<OccEventRep> const &occevent_symgroup_rep) {
+  OccEvent scratch;
   return group::make_orbit(orbit_element, occevent_symgroup_rep.begin(),
                            occevent_symgroup_rep.end(), std::less<OccEvent>(),
-                           prim_periodic_occevent_copy_apply);
+                           prim_periodic_occevent_apply, scratch);
 }
 
 /// \brief Generate equivalent OccEvent, translated to origin unit cell,
@@ -122,11 +154,28 @@ std::vector<OccEvent> make_phenomenal_occevent(
 ///     the orbit invariant (up to a permutation/reversal). The head group of
 ///     the invariant groups is set to be the head group of `symgroup`, which
 ///     may be `symgroup` itself.
+///
+/// Notes:
+/// - The group of the first element in the orbit, the prototype, is found
+///   from the equivalence map, including the translation which keeps the
+///   prototype invariant. The group of the i-th element is then made by
+///   conjugating the prototype group elements, `g * h * g^-1`, where `g` is
+///   an operation that maps the prototype onto the i-th element, without
+///   applying any more operations to OccEvent.
+/// - The lattice translation part of each conjugated element, which is a
+///   translation combined with an element of `symgroup`, is rounded to
+///   the nearest lattice translation, so the result is the same as
+///   applying each operation to the i-th element.
 std::vector<std::shared_ptr<SymGroup const>> make_occevent_groups(
     std::set<OccEvent> const &orbit,
     std::shared_ptr<SymGroup const> const &symgroup,
     Eigen::Matrix3d const &lat_column_mat,
     std::vector<OccEventRep> const &occevent_symgroup_rep) {
+  std::vector<std::shared_ptr<SymGroup const>> occevent_groups;
+  if (!orbit.size()) {
+    return occevent_groups;
+  }
+
   std::shared_ptr<SymGroup const> head_group;
   if (!symgroup->head_group) {
     head_group = symgroup;
@@ -137,38 +186,117 @@ std::vector<std::shared_ptr<SymGroup const>> make_occevent_groups(
   // The indices eq_map[i] are the indices of the group
   // elements transform the first element in the orbit into the
   // i-th element in the orbit.
-  std::vector<std::vector<Index>> eq_map = group::make_equivalence_map(
-      orbit, occevent_symgroup_rep.begin(), occevent_symgroup_rep.end(),
-      prim_periodic_occevent_copy_apply);
-
-  // The indices subgroup_indices[i] are the indices of the group
-  // elements which leave orbit element i invariant (up to a translation).
-  std::vector<group::SubgroupIndices> subgroup_indices =
-      group::make_invariant_subgroups(eq_map, *symgroup);
-
-  // The group occevent_groups[i] contains the SymOp corresponding to
-  // subgroup_indices[i] and including the translation which keeps
-  // the i-th OccEvent invariant
-  std::vector<std::shared_ptr<SymGroup const>> occevent_groups;
-  auto orbit_it = orbit.begin();
-  auto subgroup_indices_it = subgroup_indices.begin();
-  auto subgroup_indices_end = subgroup_indices.end();
+  std::vector<std::vector<Index>> eq_map =
+      group::make_equivalence_map_by_cosets(
+          orbit, occevent_symgroup_rep.begin(), occevent_symgroup_rep.end(),
+          symgroup->multiplication_table, prim_periodic_occevent_copy_apply);
+
+  // The first row of eq_map is the (sorted) indices of the prototype
+  // OccEvent group. Include the translation which keeps the prototype
+  // invariant.
+  clust::IntegralCluster prototype = make_cluster(*orbit.begin());
+  std::vector<Index> const &prototype_indices = eq_map[0];
+  std::vector<xtal::SymOp> prototype_elements;
+  for (Index j : prototype_indices) {
+    prototype_elements.push_back(clust::make_cluster_group_element(
+        prototype, lat_column_mat, symgroup->element[j],
+        occevent_symgroup_rep[j].unitcellcoord_rep));
+  }
+  occevent_groups.emplace_back(std::make_shared<SymGroup>(
+      head_group, prototype_elements,
+      std::set<Index>(prototype_indices.begin(), prototype_indices.end())));
+
+  // The group occevent_groups[i] contains the conjugated prototype OccEvent
+  // group elements, which keep the i-th OccEvent invariant, sorted by index
+  // in `symgroup`
+  Eigen::Matrix3d frac_mat = lat_column_mat.inverse();
+  std::vector<std::pair<Index, xtal::SymOp>> conjugated;
+  auto orbit_it = std::next(orbit.begin());
+  for (Index i = 1; i < eq_map.size(); ++i, ++orbit_it) {
+    if (!eq_map[i].size()) {
+      throw std::runtime_error(
+          "Error in make_occevent_groups: failed due to empty row in "
+          "equivalence_map");
+    }
+    Index e_i0 = eq_map[i][0];
+    xtal::SymOp g = clust::make_equivalence_map_op(
+        prototype, make_cluster(*orbit_it), lat_column_mat,
+        symgroup->element[e_i0], occevent_symgroup_rep[e_i0].unitcellcoord_rep);
+    Eigen::Matrix3d g_inv_matrix = g.matrix.transpose();
+
+    conjugated.clear();
+    for (Index n = 0; n < prototype_indices.size(); ++n) {
+      Index k = symgroup->mult(
+          e_i0, symgroup->mult(prototype_indices[n], symgroup->inv(e_i0)));
+      xtal::SymOp const &h = prototype_elements[n];
+      xtal::SymOp const &group_op = symgroup->element[k];
+
+      // translation of g * h * g^-1
+      Eigen::Vector3d tau = g.translation + g.matrix * h.translation -
+                            g.matrix * h.matrix * g_inv_matrix * g.translation;
+      Eigen::Vector3d frac_trans = frac_mat * (tau - group_op.translation);
+      Eigen::Vector3d lattice_trans =
+          lat_column_mat *
+          xtal::UnitCell(std::lround(frac_trans(0)),
+                         std::lround(frac_trans(1)),
+                         std::lround(frac_trans(2)))
+              .cast<double>();
+      conjugated.emplace_back(
+          k, xtal::SymOp(Eigen::Matrix3d::Identity(), lattice_trans, false) *
+                 group_op);
+    }
+    std::sort(conjugated.begin(), conjugated.end(),
+              [](std::pair<Index, xtal::SymOp> const &A,
+                 std::pair<Index, xtal::SymOp> const &B) {
+                return A.first < B.first;
+              });
 
-  while (subgroup_indices_it != subgroup_indices_end) {
     std::vector<xtal::SymOp> occevent_group_elements;
-    for (Index j : *subgroup_indices_it) {
-      occevent_group_elements.push_back(clust::make_cluster_group_element(
-          make_cluster(*orbit_it), lat_column_mat, symgroup->element[j],
-          occevent_symgroup_rep[j].unitcellcoord_rep));
+    std::set<Index> indices;
+    for (auto const &pair : conjugated) {
+      occevent_group_elements.push_back(pair.second);
+      indices.insert(pair.first);
     }
     occevent_groups.emplace_back(std::make_shared<SymGroup>(
-        head_group, occevent_group_elements, *subgroup_indices_it));
-    ++subgroup_indices_it;
-    ++orbit_it;
+        head_group, occevent_group_elements, indices));
   }
   return occevent_groups;
 }
 
+/// \brief Make groups that leave OccEvent orbit elements invariant, for
+///     multiple orbits
+///
+/// \param orbits OccEvent orbits, generated by `symgroup`
+/// \param symgroup The symmetry group used to generate the orbits.
+/// \param lat_column_mat The 3x3 matrix whose columns are the lattice vectors.
+/// \param occevent_symgroup_rep Symmetry group representation (as
+///     OccEventRep) of `symgroup`.
+/// \param n_threads Number of threads used to process orbits. If
+///     `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`.
+///
+/// \returns OccEvent invariant groups, where `occevent_groups[i][j]` is the
+///     result of `make_occevent_groups` for `orbits[i]`, element `j`. The
+///     result does not depend on `n_threads`.
+std::vector<std::vector<std::shared_ptr<SymGroup const>>> make_occevent_groups(
+    std::vector<std::set<OccEvent>> const &orbits,
+    std::shared_ptr<SymGroup const> const &symgroup,
+    Eigen::Matrix3d const &lat_column_mat,
+    std::vector<OccEventRep> const &occevent_symgroup_rep, Index n_threads) {
+  CASM_CONFIGURATION_TRACE_SCOPE_ARG("make_occevent_groups", "n_orbits",
+                                     orbits.size());
+  std::vector<std::vector<std::shared_ptr<SymGroup const>>> occevent_groups(
+      orbits.size());
+  config::parallel_for_chunks(
+      orbits.size(), n_threads, [&](Index begin, Index end) {
+        for (Index i = begin; i < end; ++i) {
+          occevent_groups[i] = make_occevent_groups(
+              orbits[i], symgroup, lat_column_mat, occevent_symgroup_rep);
+        }
+      });
+  return occevent_groups;
+}
+
 /// \brief Make the group which leaves an OccEvent invariant
 ///
 /// \param occ_event The OccEvent
@@ -221,55 +349,283 @@ std::shared_ptr<SymGroup const> make_occevent_group(
   return std::make_shared<SymGroup>(head_group, elements, indices);
 }
 
+namespace {
+
+/// \brief Standardize an OccEvent, and translate it so its first cluster
+///     site is in the origin unit cell
+///
+/// The result is the same for all translations of `occ_event`.
+OccEvent _make_translation_standardized(OccEvent occ_event) {
+  standardize(occ_event);
+  clust::IntegralCluster cluster = make_cluster(occ_event);
+  if (cluster.size()) {
+    occ_event -= cluster[0].unitcell();
+  }
+  return occ_event;
+}
+
+/// \brief Collects prototypes of distinct orbits of OccEvent
+///
+/// Method:
+/// - When an OccEvent that is not equivalent to any previously found
+///   OccEvent is inserted, its canonical form is added to the prototypes
+///   and every element of its orbit, translation standardized, is stored in
+///   a hash set.
+/// - Each inserted OccEvent is translation standardized and looked up in the
+///   hash set, so canonicalization over the full symmetry group only runs
+///   for OccEvent in orbits that have not been found yet.
+/// - Orbit elements are stored as PackedOccEvent, so lookups hash and
+///   compare integer keys. Elements with positions that cannot be packed
+///   are stored as OccEvent.
+/// - If constructed with `_keep_prototypes == false`, prototypes are not
+///   stored. Instead, the canonical form and orbit of the most recently
+///   found orbit are available from `last_prototype` and `last_orbit`, so
+///   that orbits can be used as they are found.
+class OccEventPrototypeCollector {
+ public:
+  typedef std::pair<OccEventInvariants, OccEvent> pair_type;
+  typedef std::set<pair_type, CompareOccEvent_f> set_type;
+
+  OccEventPrototypeCollector(
+      OccSystem const &_system,
+      std::vector<OccEventRep> const &_occevent_symgroup_rep,
+      bool _keep_prototypes = true)
+      : m_system(_system),
+        m_occevent_symgroup_rep(_occevent_symgroup_rep),
+        m_keep_prototypes(_keep_prototypes),
+        m_prototypes(CompareOccEvent_f(_system.prim->lattice().tol())) {}
+
+  /// \brief Insert an OccEvent, and return true if it is not equivalent to
+  ///     an OccEvent already inserted
+  bool insert(OccEvent const &event) {
+    if (_contains(_make_translation_standardized(event))) {
+      return false;
+    }
+    OccEvent canonical;
+    group::make_canonical_element(
+        event, m_occevent_symgroup_rep.begin(), m_occevent_symgroup_rep.end(),
+        std::less<OccEvent>(), prim_periodic_occevent_apply, canonical,
+        m_scratch);
+    if (!m_keep_prototypes) {
+      m_last_orbit.clear();
+    }
+    for (OccEventRep const &rep : m_occevent_symgroup_rep) {
+      prim_periodic_occevent_apply(rep, canonical, m_scratch);
+      _insert(_make_translation_standardized(m_scratch));
+      if (!m_keep_prototypes) {
+        m_last_orbit.insert(m_scratch);
+      }
+    }
+    if (m_keep_prototypes) {
+      m_prototypes.emplace(OccEventInvariants(event, m_system),
+                           std::move(canonical));
+    } else {
+      m_last_prototype = std::move(canonical);
+    }
+    return true;
+  }
+
+  /// \brief Canonical OccEvent, sorted by invariants and then OccEvent
+  set_type const &prototypes() const { return m_prototypes; }
+
+  /// \brief Canonical OccEvent of the most recently found orbit, if not
+  ///     keeping prototypes
+  OccEvent const &last_prototype() const { return m_last_prototype; }
+
+  /// \brief The most recently found orbit, if not keeping prototypes
+  std::set<OccEvent> const &last_orbit() const { return m_last_orbit; }
+
+ private:
+  bool _contains(OccEvent const &element) const {
+    if (PackedOccEvent::is_packable(element)) {
+      return m_orbit_elements.count(PackedOccEvent(element));
+    }
+    return m_unpacked_orbit_elements.count(element);
+  }
+
+  void _insert(OccEvent const &element) {
+    if (PackedOccEvent::is_packable(element)) {
+      m_orbit_elements.emplace(element);
+    } else {
+      m_unpacked_orbit_elements.insert(element);
+    }
+  }
+
+  OccSystem const &m_system;
+  std::vector<OccEventRep> const &m_occevent_symgroup_rep;
+  bool m_keep_prototypes;
+
+  /// \brief Translation standardized elements of the orbits found so far
+  std::unordered_set<PackedOccEvent, PackedOccEventHash> m_orbit_elements;
+
+  /// \brief Translation standardized elements of the orbits found so far
+  ///     that cannot be packed
+  std::unordered_set<OccEvent, OccEventHash> m_unpacked_orbit_elements;
+
+  /// \brief Reused to hold images during canonicalization
+  OccEvent m_scratch;
+
+  set_type m_prototypes;
+
+  OccEvent m_last_prototype;
+  std::set<OccEvent> m_last_orbit;
+};
+
+}  // namespace
+
 /// \brief Make prototypes of distinct orbits of OccEvent, with periodic
 ///     symmetry of a prim
+///
+/// \param system The OccSystem
+/// \param clusters Clusters on which OccEvent are generated
+/// \param occevent_symgroup_rep Symmetry group representation used to find
+///     canonical OccEvent
+/// \param params Parameters controlling which OccEvent are generated
+/// \param custom_events OccEvent included regardless of `params`
+/// \param n_threads Number of threads used to count OccEvent. If
+///     `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`.
+///
+/// Notes:
+/// - Each counted OccEvent, after translation and standardization, is looked
+///   up in a hash set of the elements of the orbits already found. Only
+///   OccEvent that are not found are made canonical, which is done by
+///   applying every operation in `occevent_symgroup_rep`.
+/// - If `n_threads != 1`, each thread takes the next cluster in `clusters`
+///   that has not been counted yet and counts OccEvent on it with its own
+///   OccEventCounter. The OccEvent found on each cluster are merged in the
+///   order of `clusters`, so the result does not depend on `n_threads`.
+/// - With more than one thread, the custom filters in `params`
+///   (`cluster_filter`, `occ_init_filter`, `occ_final_filter`, and
+///   `trajectory_filter`) are called concurrently and must be safe to call
+///   concurrently. If `params.print_state_info` is set, counting is serial.
 std::vector<OccEvent> make_prim_periodic_occevent_prototypes(
     std::shared_ptr<OccSystem const> const &system,
     std::vector<clust::IntegralCluster> const &clusters,
     std::vector<OccEventRep> const &occevent_symgroup_rep,
     OccEventCounterParameters const &params,
-    std::vector<OccEvent> const &custom_events) {
-  // function to make an OccEvent canonical
-  auto _make_canonical = [&](OccEvent const &event) {
-    return group::make_canonical_element(
-        event, occevent_symgroup_rep.begin(), occevent_symgroup_rep.end(),
-        std::less<OccEvent>(), prim_periodic_occevent_copy_apply);
-  };
-
-  typedef std::pair<OccEventInvariants, OccEvent> pair_type;
-  CompareOccEvent_f compare_f(system->prim->lattice().tol());
-  std::set<pair_type, CompareOccEvent_f> prototype_events(compare_f);
+    std::vector<OccEvent> const &custom_events, Index n_threads) {
+  CASM_CONFIGURATION_TRACE_SCOPE("make_prim_periodic_occevent_prototypes");
+  OccEventPrototypeCollector collector(*system, occevent_symgroup_rep);
 
-  OccEventCounter counter(system, clusters, params);
+  if (params.print_state_info) {
+    n_threads = 1;
+  }
+  n_threads = config::resolve_n_threads(n_threads, clusters.size());
 
-  while (!counter.is_finished()) {
-    prototype_events.emplace(OccEventInvariants(counter.value(), *system),
-                             _make_canonical(counter.value()));
-    counter.advance();
+  if (n_threads == 1) {
+    CASM_CONFIGURATION_TRACE_SCOPE("OccEventCounter.count");
+    OccEventCounter counter(system, clusters, params);
+    while (!counter.is_finished()) {
+      collector.insert(counter.value());
+      counter.advance();
+    }
+  } else {
+    // cluster_prototypes[i]: the canonical OccEvent found on clusters[i]
+    std::vector<OccEventPrototypeCollector::set_type> cluster_prototypes(
+        clusters.size(), collector.prototypes());
+    std::atomic<Index> next_cluster(0);
+    config::parallel_for_chunks(
+        n_threads, n_threads, [&](Index, Index) {
+          Index i;
+          while ((i = next_cluster++) < clusters.size()) {
+            CASM_CONFIGURATION_TRACE_SCOPE_ARG("OccEventCounter.count",
+                                               "cluster", i);
+            std::vector<clust::IntegralCluster> prototype(1, clusters[i]);
+            OccEventCounter counter(system, prototype, params);
+            OccEventPrototypeCollector cluster_collector(
+                *system, occevent_symgroup_rep);
+            while (!counter.is_finished()) {
+              cluster_collector.insert(counter.value());
+              counter.advance();
+            }
+            cluster_prototypes[i] = cluster_collector.prototypes();
+          }
+        });
+    for (auto const &prototypes : cluster_prototypes) {
+      for (auto const &pair : prototypes) {
+        collector.insert(pair.second);
+      }
+    }
   }
 
   for (auto const &event : custom_events) {
-    prototype_events.emplace(OccEventInvariants(event, *system),
-                             _make_canonical(event));
+    collector.insert(event);
   }
 
   std::vector<OccEvent> result;
-  for (auto const &pair : prototype_events) {
+  for (auto const &pair : collector.prototypes()) {
     result.emplace_back(pair.second);
   }
   return result;
 }
 
+/// \brief Generate orbits of OccEvent incrementally, as OccEventCounter
+///     counts them, with periodic symmetry of a prim
+///
+/// \param system The OccSystem
+/// \param clusters Clusters on which OccEvent are generated
+/// \param occevent_symgroup_rep Symmetry group representation used to find
+///     canonical OccEvent
+/// \param params Parameters controlling which OccEvent are generated
+/// \param f Function called as `f(prototype, orbit)` once for each distinct
+///     orbit, as soon as the first of its OccEvent is counted. The
+///     prototype is the canonical OccEvent of the orbit, and the orbit is
+///     equal to `make_prim_periodic_orbit(prototype, occevent_symgroup_rep)`.
+///     Both are only valid during the call.
+/// \param custom_events OccEvent included regardless of `params`, after the
+///     counted OccEvent
+///
+/// \returns The number of distinct orbits
+///
+/// Notes:
+/// - OccEventCounter is advanced one OccEvent at a time, and each counted
+///   OccEvent is deduplicated against the orbits already found before the
+///   next is counted, so memory use is proportional to the number of
+///   distinct OccEvent found rather than the number counted.
+/// - Orbits are passed to `f` in the order they are found, not the order
+///   of `make_prim_periodic_occevent_prototypes`, which sorts prototypes
+///   by OccEventInvariants once all are found. The set of prototypes is
+///   the same.
+Index for_each_prim_periodic_occevent_orbit(
+    std::shared_ptr<OccSystem const> const &system,
+    std::vector<clust::IntegralCluster> const &clusters,
+    std::vector<OccEventRep> const &occevent_symgroup_rep,
+    OccEventCounterParameters const &params, OccEventOrbitFunction const &f,
+    std::vector<OccEvent> const &custom_events) {
+  CASM_CONFIGURATION_TRACE_SCOPE("for_each_prim_periodic_occevent_orbit");
+  OccEventPrototypeCollector collector(*system, occevent_symgroup_rep, false);
+  Index n_orbits = 0;
+  auto _insert = [&](OccEvent const &event) {
+    if (collector.insert(event)) {
+      ++n_orbits;
+      f(collector.last_prototype(), collector.last_orbit());
+    }
+  };
+
+  OccEventCounter counter(system, clusters, params);
+  while (!counter.is_finished()) {
+    _insert(counter.value());
+    counter.advance();
+  }
+  for (auto const &event : custom_events) {
+    _insert(event);
+  }
+  return n_orbits;
+}
+
 /// \brief Make orbits of OccEvent, with periodic symmetry of a prim
 std::vector<std::set<OccEvent>> make_prim_periodic_occevent_orbits(
     std::shared_ptr<OccSystem const> const &system,
     std::vector<clust::IntegralCluster> const &clusters,
     std::vector<OccEventRep> const &occevent_symgroup_rep,
     OccEventCounterParameters const &params,
-    std::vector<OccEvent> const &custom_events) {
+    std::vector<OccEvent> const &custom_events, Index n_threads) {
+  CASM_CONFIGURATION_TRACE_SCOPE("make_prim_periodic_occevent_orbits");
   std::vector<OccEvent> orbit_prototypes =
-      make_prim_periodic_occevent_prototypes(
-          system, clusters, occevent_symgroup_rep, params, custom_events);
+      make_prim_periodic_occevent_prototypes(system, clusters,
+                                             occevent_symgroup_rep, params,
+                                             custom_events, n_threads);
 
   // generate orbits from the unique OccEvent
   std::vector<std::set<OccEvent>> orbits;
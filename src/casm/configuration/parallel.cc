@@ -0,0 +1,254 @@
+#include "casm/configuration/parallel.hh"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "casm/configuration/trace.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {
+
+/// \brief True while the current thread is running a parallel task
+thread_local bool _in_parallel_region = false;
+
+/// \brief Sets `_in_parallel_region` for the lifetime of the object
+class _ParallelRegionGuard {
+ public:
+  _ParallelRegionGuard() : m_previous(_in_parallel_region) {
+    _in_parallel_region = true;
+  }
+
+  ~_ParallelRegionGuard() { _in_parallel_region = m_previous; }
+
+ private:
+  bool m_previous;
+};
+
+/// \brief Default number of threads: `CASM_NUM_THREADS` if set to a
+///     positive integer, else `std::thread::hardware_concurrency()`
+Index _default_num_threads() {
+  if (char const *value = std::getenv("CASM_NUM_THREADS")) {
+    try {
+      Index n = std::stol(value);
+      if (n > 0) {
+        return n;
+      }
+    } catch (std::exception const &) {
+    }
+  }
+  return std::max(Index(1), Index(std::thread::hardware_concurrency()));
+}
+
+/// \brief A fixed set of worker threads taking tasks from a shared queue
+class _ThreadPool {
+ public:
+  /// \brief Constructor
+  ///
+  /// \param _n_workers Number of worker threads. The threads that submit
+  ///     tasks also run them, so a pool for `n` threads has `n - 1` workers.
+  explicit _ThreadPool(Index _n_workers) : m_stop(false) {
+    for (Index i = 0; i < _n_workers; ++i) {
+      m_workers.emplace_back([this]() { _work(); });
+    }
+  }
+
+  _ThreadPool(_ThreadPool const &) = delete;
+  _ThreadPool &operator=(_ThreadPool const &) = delete;
+
+  ~_ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto &worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  /// \brief Add a task to the queue
+  void submit(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_tasks.push_back(std::move(task));
+    }
+    m_cv.notify_one();
+  }
+
+  /// \brief Run one queued task on the calling thread, if any
+  ///
+  /// \returns True if a task was run
+  bool try_run_one() {
+    std::function<void()> task;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_tasks.empty()) {
+        return false;
+      }
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+    _ParallelRegionGuard guard;
+    task();
+    return true;
+  }
+
+ private:
+  void _work() {
+    _in_parallel_region = true;
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&]() { return m_stop || !m_tasks.empty(); });
+        if (m_tasks.empty()) {
+          return;
+        }
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+      }
+      task();
+    }
+  }
+
+  bool m_stop;
+  std::deque<std::function<void()>> m_tasks;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::vector<std::thread> m_workers;
+};
+
+std::mutex _pool_mutex;
+Index _num_threads = 0;
+std::shared_ptr<_ThreadPool> _pool;
+
+/// \brief Get the process-wide pool, constructing it if necessary
+std::shared_ptr<_ThreadPool> _get_pool() {
+  std::lock_guard<std::mutex> lock(_pool_mutex);
+  if (_num_threads <= 0) {
+    _num_threads = _default_num_threads();
+  }
+  if (!_pool) {
+    _pool = std::make_shared<_ThreadPool>(_num_threads - 1);
+  }
+  return _pool;
+}
+
+}  // namespace
+
+/// \brief Set the number of threads used by parallel operations
+///
+/// \param n_threads Number of threads, including the calling thread, that
+///     parallel operations share. If `n_threads <= 0`, the default is
+///     restored: `CASM_NUM_THREADS` if set, else
+///     `std::thread::hardware_concurrency()`.
+///
+/// Notes:
+/// - This is the number of threads used when a parallel operation is given
+///   `n_threads <= 0`, and the size of the process-wide thread pool that all
+///   parallel operations run on.
+/// - Parallel operations already running finish on the previous pool, whose
+///   threads exit once those operations complete.
+/// - Use `set_num_threads(1)`, or `CASM_NUM_THREADS=1`, when running one
+///   process per core, as with MPI or multiprocessing.
+void set_num_threads(Index n_threads) {
+  std::lock_guard<std::mutex> lock(_pool_mutex);
+  Index value = n_threads > 0 ? n_threads : _default_num_threads();
+  if (value != _num_threads) {
+    _num_threads = value;
+    _pool.reset();
+  }
+}
+
+/// \brief Number of threads used by parallel operations
+///
+/// \returns The value set by `set_num_threads`, or the default:
+///     `CASM_NUM_THREADS` if set, else `std::thread::hardware_concurrency()`.
+Index get_num_threads() {
+  std::lock_guard<std::mutex> lock(_pool_mutex);
+  if (_num_threads <= 0) {
+    _num_threads = _default_num_threads();
+  }
+  return _num_threads;
+}
+
+/// \brief Return true if called from a task of a parallel operation
+///
+/// Parallel operations started from a task run on the calling thread, so
+/// nested parallelism does not oversubscribe the pool.
+bool in_parallel_region() { return _in_parallel_region; }
+
+namespace parallel_impl {
+
+/// \brief Call `task(t)` for each `t` in `[0, n_tasks)`, using the
+///     process-wide thread pool and the calling thread
+///
+/// Notes:
+/// - Tasks `1` to `n_tasks - 1` are queued on the pool, and task `0` is run
+///   by the calling thread, which then runs queued tasks until all of its
+///   tasks have finished.
+/// - Tasks must not wait on other tasks.
+/// - If any task throws, the first exception caught is rethrown after all
+///   tasks have finished.
+void run_tasks(Index n_tasks, std::function<void(Index)> const &task) {
+  if (n_tasks <= 0) {
+    return;
+  }
+  std::shared_ptr<_ThreadPool> pool = _get_pool();
+
+  std::mutex mutex;
+  std::condition_variable done;
+  Index n_remaining = n_tasks;
+  std::exception_ptr first_exception;
+
+  auto run = [&](Index t) {
+    std::exception_ptr exception;
+    try {
+      CASM_CONFIGURATION_TRACE_SCOPE_ARG("parallel_task", "task", t);
+      task(t);
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (exception && !first_exception) {
+      first_exception = exception;
+    }
+    if (--n_remaining == 0) {
+      done.notify_all();
+    }
+  };
+
+  for (Index t = 1; t < n_tasks; ++t) {
+    pool->submit([&run, t]() { run(t); });
+  }
+  {
+    _ParallelRegionGuard guard;
+    run(0);
+  }
+
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (n_remaining == 0) {
+        break;
+      }
+    }
+    if (!pool->try_run_one()) {
+      std::unique_lock<std::mutex> lock(mutex);
+      done.wait(lock, [&]() { return n_remaining == 0; });
+      break;
+    }
+  }
+
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
+}
+
+}  // namespace parallel_impl
+
+}  // namespace config
+}  // namespace CASM
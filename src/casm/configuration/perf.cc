@@ -0,0 +1,131 @@
+#include "casm/configuration/perf.hh"
+
+#include <cstdint>
+#include <stdexcept>
+
+namespace CASM {
+namespace config {
+namespace perf {
+
+namespace detail {
+
+std::array<std::atomic<Index>, int(Counter::n_counters)> counters{};
+
+}  // namespace detail
+
+namespace {
+
+/// Number of timed scopes, by timer
+std::array<std::atomic<Index>, int(Timer::n_timers)> timer_counts{};
+
+/// Total time, in nanoseconds, by timer
+std::array<std::atomic<std::int64_t>, int(Timer::n_timers)> timer_totals{};
+
+}  // namespace
+
+/// \brief Return true if the library was compiled with instrumentation
+///
+/// If false, the `CASM_CONFIGURATION_PERF_*` macros used in the library
+/// expand to nothing, and all counters and timers remain zero.
+bool is_enabled() {
+#ifdef CASM_CONFIGURATION_PERF
+  return true;
+#else
+  return false;
+#endif
+}
+
+/// \brief Return the name of a counter
+std::string name(Counter counter) {
+  switch (counter) {
+    case Counter::supercell_sym_op_apply:
+      return "supercell_sym_op_apply";
+    case Counter::config_is_equivalent_compare:
+      return "config_is_equivalent_compare";
+    case Counter::config_is_equivalent_early_exit:
+      return "config_is_equivalent_early_exit";
+    case Counter::config_is_equivalent_early_exit_depth:
+      return "config_is_equivalent_early_exit_depth";
+    case Counter::translation_permutation_lookup:
+      return "translation_permutation_lookup";
+    case Counter::translation_permutation_rebuild:
+      return "translation_permutation_rebuild";
+    case Counter::supercell_construction:
+      return "supercell_construction";
+    case Counter::canonicalization:
+      return "canonicalization";
+    case Counter::orbit_candidate_tested:
+      return "orbit_candidate_tested";
+    case Counter::orbit_candidate_kept:
+      return "orbit_candidate_kept";
+    default:
+      throw std::runtime_error("Error in perf::name: invalid Counter");
+  }
+}
+
+/// \brief Return the name of a timer
+std::string name(Timer timer) {
+  switch (timer) {
+    case Timer::to_canonical:
+      return "to_canonical";
+    case Timer::canonical_form_engine:
+      return "canonical_form_engine";
+    case Timer::make_prim_periodic_orbits:
+      return "make_prim_periodic_orbits";
+    case Timer::make_local_orbits:
+      return "make_local_orbits";
+    case Timer::make_distinct_perturbations:
+      return "make_distinct_perturbations";
+    case Timer::config_space_analysis:
+      return "config_space_analysis";
+    default:
+      throw std::runtime_error("Error in perf::name: invalid Timer");
+  }
+}
+
+/// \brief Add a timed scope to a timer
+void add_time(Timer timer, std::chrono::steady_clock::duration duration) {
+  std::int64_t ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  timer_counts[int(timer)].fetch_add(1, std::memory_order_relaxed);
+  timer_totals[int(timer)].fetch_add(ns, std::memory_order_relaxed);
+}
+
+/// \brief Set all counters and timers to zero
+///
+/// Not synchronized with concurrent counting; call it between, not during,
+/// instrumented operations.
+void reset() {
+  for (auto &value : detail::counters) {
+    value.store(0, std::memory_order_relaxed);
+  }
+  for (auto &value : timer_counts) {
+    value.store(0, std::memory_order_relaxed);
+  }
+  for (auto &value : timer_totals) {
+    value.store(0, std::memory_order_relaxed);
+  }
+}
+
+/// \brief Return a snapshot of all counters and timers
+///
+/// All counters and timers are included, by name, even if zero.
+PerfReport make_report() {
+  PerfReport report;
+  report.enabled = is_enabled();
+  for (int i = 0; i < int(Counter::n_counters); ++i) {
+    report.counters[name(Counter(i))] =
+        detail::counters[i].load(std::memory_order_relaxed);
+  }
+  for (int i = 0; i < int(Timer::n_timers); ++i) {
+    TimerValue value;
+    value.count = timer_counts[i].load(std::memory_order_relaxed);
+    value.total_s = timer_totals[i].load(std::memory_order_relaxed) * 1e-9;
+    report.timers[name(Timer(i))] = value;
+  }
+  return report;
+}
+
+}  // namespace perf
+}  // namespace config
+}  // namespace CASM
@@ -8,54 +8,53 @@
 namespace CASM {
 namespace config {
 
-/// \brief Return a string representing the HNF of a matrix
+/// \brief Make the key of the Hermite normal form of a transformation
+///     matrix
 ///
-/// String format is: SCELV_A_B_C_D_E_F, where:
-/// - V: H(0, 0) * H(1, 1) * H(2, 2)
-/// - A: H(0,0),
-/// - B: H(1,1),
-/// - C: H(2,2),
-/// - D: H(1,2),
-/// - E: H(0,2),
-/// - F: H(0,1),
-/// - H: hermite_normal_form(matrix)
-std::string hermite_normal_form_name(const Eigen::Matrix3l &matrix) {
-  std::string name_str;
-
-  Eigen::Matrix3i H = hermite_normal_form(matrix.cast<int>()).first;
-  name_str = "SCEL";
-  std::stringstream tname;
-  // Consider using a for loop with HermiteCounter_impl::_canonical_unroll here
-  tname << H(0, 0) * H(1, 1) * H(2, 2) << "_" << H(0, 0) << "_" << H(1, 1)
-        << "_" << H(2, 2) << "_" << H(1, 2) << "_" << H(0, 2) << "_" << H(0, 1);
-  name_str.append(tname.str());
-
-  return name_str;
+/// \param transformation_matrix_to_super Any transformation matrix, T
+///
+/// \returns The key of H = hermite_normal_form(T): H(0,0), H(1,1), H(2,2),
+///     H(1,2), H(0,2), H(0,1). Transformation matrices that generate the
+///     same superlattice, up to a change of lattice vectors, have the same
+///     key.
+HermiteNormalFormKey make_hermite_normal_form_key(
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  Eigen::Matrix3i H =
+      hermite_normal_form(transformation_matrix_to_super.cast<int>()).first;
+  return HermiteNormalFormKey(
+      {H(0, 0), H(1, 1), H(2, 2), H(1, 2), H(0, 2), H(0, 1)});
 }
 
-/// \brief Inverse function of `hermite_normal_form_name`
-Eigen::Matrix3l make_hermite_normal_form(std::string hermite_normal_form_name) {
+/// \brief Parse the key of the Hermite normal form from a supercell name
+///
+/// \param supercell_name A supercell name, with format
+///     SCELV_A_B_C_D_E_F, as generated by `make_supercell_name`
+///
+/// \returns The key (A, B, C, D, E, F). The format is checked, but the
+///     values are not checked to be a Hermite normal form.
+HermiteNormalFormKey make_hermite_normal_form_key(
+    std::string const &supercell_name) {
   std::vector<std::string> tokens;
   try {
     char_separator sep("SCEL_");
-    tokenizer tok(hermite_normal_form_name, sep);
+    tokenizer tok(supercell_name, sep);
     std::copy_if(tok.begin(), tok.end(), std::back_inserter(tokens),
                  [](const std::string &val) { return !val.empty(); });
     if (tokens.size() != 7) {
       throw std::invalid_argument(
           "Error in make_supercell: supercell name format error");
     }
-    Eigen::Matrix3l T;
-    auto cast = [](std::string val) { return std::stol(val); };
-    T << cast(tokens[1]), cast(tokens[6]), cast(tokens[5]), 0, cast(tokens[2]),
-        cast(tokens[4]), 0, 0, cast(tokens[3]);
-    return T;
+    HermiteNormalFormKey key;
+    for (int i = 0; i < 6; ++i) {
+      key[i] = std::stol(tokens[i + 1]);
+    }
+    return key;
   } catch (std::exception &e) {
     std::string format = "SCELV_T00_T11_T22_T12_T02_T01";
     std::stringstream ss;
-    ss << "Error in make_hermite_normal_form: "
+    ss << "Error in make_hermite_normal_form_key: "
        << "expected format: " << format << ", "
-       << "name: |" << hermite_normal_form_name << "|"
+       << "name: |" << supercell_name << "|"
        << ", "
        << "tokens: " << tokens << ", "
        << "tokens.size(): " << tokens.size() << ", "
@@ -64,6 +63,39 @@ Eigen::Matrix3l make_hermite_normal_form(std::string hermite_normal_form_name) {
   }
 }
 
+/// \brief Make the Hermite normal form matrix from its key
+Eigen::Matrix3l make_hermite_normal_form(HermiteNormalFormKey const &key) {
+  Eigen::Matrix3l H;
+  H << key[0], key[5], key[4], 0, key[1], key[3], 0, 0, key[2];
+  return H;
+}
+
+/// \brief Make the supercell name from the key of the Hermite normal form
+///
+/// String format is: SCELV_A_B_C_D_E_F, where:
+/// - V: A * B * C
+/// - (A, B, C, D, E, F): the key
+std::string make_supercell_name(HermiteNormalFormKey const &key) {
+  std::stringstream ss;
+  ss << "SCEL" << key[0] * key[1] * key[2];
+  for (long value : key) {
+    ss << "_" << value;
+  }
+  return ss.str();
+}
+
+/// \brief Make the supercell name from a transformation matrix
+///
+/// Equivalent to `make_supercell_name(make_hermite_normal_form_key(T))`.
+/// This is also equivalent to `make_supercell_name(prim_lattice,
+/// superlattice)` for `superlattice = make_superlattice(prim_lattice, T)`,
+/// but does not need to find T from the lattices.
+std::string make_supercell_name(
+    Eigen::Matrix3l const &transformation_matrix_to_super) {
+  return make_supercell_name(
+      make_hermite_normal_form_key(transformation_matrix_to_super));
+}
+
 /// \brief Make the supercell name of a superlattice
 ///
 /// The supercell name is a string generated from the hermite
@@ -98,7 +130,7 @@ std::string make_supercell_name(xtal::Lattice const &prim_lattice,
                                 xtal::Lattice const &superlattice) {
   Eigen::Matrix3l T = xtal::make_transformation_matrix_to_super(
       prim_lattice, superlattice, prim_lattice.tol());
-  return hermite_normal_form_name(T);
+  return make_supercell_name(T);
 }
 
 /// \brief Construct a superlattice from the supercell name
@@ -114,7 +146,8 @@ std::string make_supercell_name(xtal::Lattice const &prim_lattice,
 ///
 xtal::Lattice make_superlattice_from_supercell_name(
     xtal::Lattice const &prim_lattice, std::string supercell_name) {
-  Eigen::Matrix3l H = make_hermite_normal_form(supercell_name);
+  Eigen::Matrix3l H =
+      make_hermite_normal_form(make_hermite_normal_form_key(supercell_name));
   return make_superlattice(prim_lattice, H);
 }
 
@@ -1,6 +1,9 @@
 #include "casm/configuration/sym_info/factor_group.hh"
 
+#include <cmath>
+
 #include "casm/configuration/group/Group.hh"
+#include "casm/configuration/hash.hh"
 #include "casm/crystallography/BasicStructure.hh"
 #include "casm/crystallography/BasicStructureTools.hh"
 #include "casm/crystallography/SymTools.hh"
@@ -16,10 +19,51 @@ bool ConjugacyClassCompare::operator()(const map_type &A,
   return float_lexicographical_compare(A.begin()->first, B.begin()->first, tol);
 }
 
+/// \brief Constructor
+///
+/// \param lattice The lattice used to find fractional translations, as for
+///     xtal::SymOpPeriodicCompare_f
+/// \param _bin_width Width of the bins values are rounded to. Should be much
+///     larger than the comparison tolerance (to make fallback searches rare)
+///     and `1.0 / _bin_width` should be an integer (so translations that
+///     differ by a lattice translation have the same hash value).
+SymOpPeriodicHash_f::SymOpPeriodicHash_f(xtal::Lattice const &lattice,
+                                         double _bin_width)
+    : inv_lat_column_mat(lattice.inv_lat_column_mat()),
+      bin_width(_bin_width) {}
+
+std::size_t SymOpPeriodicHash_f::operator()(SymOp const &op) const {
+  std::size_t seed = op.is_time_reversal_active;
+  for (Index i = 0; i < 9; ++i) {
+    hash_combine(seed, std::hash<long long>()(
+                           std::llround(op.matrix(i) / bin_width)));
+  }
+  long long n_bins = std::llround(1.0 / bin_width);
+  Eigen::Vector3d frac_translation = inv_lat_column_mat * op.translation;
+  for (Index i = 0; i < 3; ++i) {
+    long long bin = std::llround(frac_translation(i) / bin_width) % n_bins;
+    if (bin < 0) {
+      bin += n_bins;
+    }
+    hash_combine(seed, std::hash<long long>()(bin));
+  }
+  return seed;
+}
+
 /// \brief Construct a SymGroup from the group elements, sorting by class
 /// and operation
+///
+/// The multiplication table is found once, using SymOpPeriodicHash_f to
+/// find products, and is then permuted into the sorted order.
+///
+/// \param _elements Group elements
+/// \param lattice Lattice used for comparisons and sorting
+/// \param n_threads Number of threads to use to find the multiplication table.
+///     If `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`.
 std::shared_ptr<SymGroup const> make_symgroup(
-    std::vector<SymOp> const &_elements, xtal::Lattice const &lattice) {
+    std::vector<SymOp> const &_elements, xtal::Lattice const &lattice,
+    Index n_threads) {
   std::vector<SymOp> elements{_elements};
 
   // this is called `sort_factor_group`, but can sort any xtal::SymOp
@@ -28,9 +72,11 @@ std::shared_ptr<SymGroup const> make_symgroup(
   double xtal_tol = lattice.tol();
   std::multiplies<SymOp> multiply_f;
   xtal::SymOpPeriodicCompare_f equal_to_f(lattice, xtal_tol);
+  SymOpPeriodicHash_f hash_f(lattice);
 
   // make a `tmp` group, so we can use the multiplication table
-  SymGroup tmp = group::make_group(elements, multiply_f, equal_to_f);
+  SymGroup tmp =
+      group::make_group(elements, multiply_f, equal_to_f, hash_f, n_threads);
 
   // use the group with multiplication table to make conjugacy classes
   std::vector<std::vector<Index>> conjugacy_classes =
@@ -61,20 +107,50 @@ std::shared_ptr<SymGroup const> make_symgroup(
     }
   }
 
-  // now make the group with elements sorted by class
-  return std::make_shared<SymGroup>(
-      group::make_group(sorted_elements, multiply_f, equal_to_f));
+  // now make the group with elements sorted by class, permuting the `tmp`
+  // multiplication table instead of finding it again
+  group::HashedElementIndex<SymOp, xtal::SymOpPeriodicCompare_f,
+                            SymOpPeriodicHash_f>
+      tmp_index(tmp.element, equal_to_f, hash_f);
+  Index size = sorted_elements.size();
+  std::vector<Index> tmp_of_sorted(size);
+  std::vector<Index> sorted_of_tmp(size);
+  for (Index i = 0; i < size; ++i) {
+    tmp_of_sorted[i] = tmp_index.find(sorted_elements[i]);
+    if (tmp_of_sorted[i] == -1) {
+      throw std::runtime_error(
+          "Error in make_symgroup: failed to find sorted element");
+    }
+    sorted_of_tmp[tmp_of_sorted[i]] = i;
+  }
+  group::MultiplicationTable multiplication_table(size);
+  for (Index i = 0; i < size; ++i) {
+    multiplication_table[i].reserve(size);
+    for (Index j = 0; j < size; ++j) {
+      multiplication_table[i].push_back(
+          sorted_of_tmp[tmp.mult(tmp_of_sorted[i], tmp_of_sorted[j])]);
+    }
+  }
+  return std::make_shared<SymGroup>(sorted_elements, multiplication_table);
 }
 
 /// \brief Construct a SymGroup from the group elements,
 ///     without sorting by class or operation
+///
+/// \param elements Group elements
+/// \param lattice Lattice used for comparisons
+/// \param n_threads Number of threads to use to find the multiplication table.
+///     If `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`.
 std::shared_ptr<SymGroup const> make_symgroup_without_sorting(
-    std::vector<SymOp> const &elements, xtal::Lattice const &lattice) {
+    std::vector<SymOp> const &elements, xtal::Lattice const &lattice,
+    Index n_threads) {
   double xtal_tol = lattice.tol();
   std::multiplies<SymOp> multiply_f;
   xtal::SymOpPeriodicCompare_f equal_to_f(lattice, xtal_tol);
+  SymOpPeriodicHash_f hash_f(lattice);
   return std::make_shared<SymGroup>(
-      group::make_group(elements, multiply_f, equal_to_f));
+      group::make_group(elements, multiply_f, equal_to_f, hash_f, n_threads));
 }
 
 /// \brief Generate prim factor group
@@ -82,10 +158,15 @@ std::shared_ptr<SymGroup const> make_symgroup_without_sorting(
 /// Notes:
 /// - Result is sorted by class, with classes sorted by symop
 /// - Uses lattice tol for comparison
+///
+/// \param prim The prim
+/// \param n_threads Number of threads to use to find the multiplication table.
+///     If `n_threads <= 0`, use the number of threads set by
+///     `config::set_num_threads`.
 std::shared_ptr<SymGroup const> make_factor_group(
-    xtal::BasicStructure const &prim) {
+    xtal::BasicStructure const &prim, Index n_threads) {
   std::vector<SymOp> elements = xtal::make_factor_group(prim);
-  return make_symgroup(elements, prim.lattice());
+  return make_symgroup(elements, prim.lattice(), n_threads);
 }
 
 /// \brief Use prim factor group
@@ -118,8 +199,9 @@ std::shared_ptr<SymGroup const> make_point_group(
     }
   }
 
+  SymOpPeriodicHash_f hash_f(lattice);
   return std::make_shared<SymGroup>(
-      group::make_group(pg_element, multiply_f, equal_to_f));
+      group::make_group(pg_element, multiply_f, equal_to_f, hash_f));
 }
 
 /// \brief Generate lattice point group
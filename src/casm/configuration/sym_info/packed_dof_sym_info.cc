@@ -0,0 +1,99 @@
+#include "casm/configuration/sym_info/packed_dof_sym_info.hh"
+
+#include <stdexcept>
+
+namespace CASM {
+namespace sym_info {
+
+/// \brief Default constructor, with no operations
+PackedDoFSymGroupRep::PackedDoFSymGroupRep() : m_n_ops(0), m_op_stride(0) {}
+
+/// \brief Constructor, from a local DoF representation
+///
+/// \param rep Matrices indexed by [op][sublattice]. All matrices must be
+///     square, and for each sublattice all matrices must have the same size.
+PackedDoFSymGroupRep::PackedDoFSymGroupRep(LocalDoFSymGroupRep const &rep)
+    : m_n_ops(rep.size()), m_op_stride(0) {
+  if (rep.empty()) {
+    return;
+  }
+  std::vector<Eigen::MatrixXd const *> first_op;
+  for (Eigen::MatrixXd const &M : rep[0]) {
+    first_op.push_back(&M);
+  }
+  _init(first_op);
+  double *it = m_data.data();
+  for (LocalDoFSymOpRep const &op_rep : rep) {
+    if (op_rep.size() != m_dim.size()) {
+      throw std::runtime_error(
+          "Error in PackedDoFSymGroupRep: inconsistent number of sublattices");
+    }
+    for (Index b = 0; b < m_dim.size(); ++b) {
+      Eigen::MatrixXd const &M = op_rep[b];
+      if (M.rows() != m_dim[b] || M.cols() != m_dim[b]) {
+        throw std::runtime_error(
+            "Error in PackedDoFSymGroupRep: inconsistent matrix size");
+      }
+      Eigen::Map<Eigen::MatrixXd>(it, m_dim[b], m_dim[b]) = M;
+      it += M.size();
+    }
+  }
+}
+
+/// \brief Constructor, from a global DoF representation
+///
+/// \param rep Matrices indexed by [op]. All matrices must be square and
+///     have the same size.
+PackedDoFSymGroupRep::PackedDoFSymGroupRep(GlobalDoFSymGroupRep const &rep)
+    : m_n_ops(rep.size()), m_op_stride(0) {
+  if (rep.empty()) {
+    return;
+  }
+  _init({&rep[0]});
+  double *it = m_data.data();
+  for (Eigen::MatrixXd const &M : rep) {
+    if (M.rows() != m_dim[0] || M.cols() != m_dim[0]) {
+      throw std::runtime_error(
+          "Error in PackedDoFSymGroupRep: inconsistent matrix size");
+    }
+    Eigen::Map<Eigen::MatrixXd>(it, m_dim[0], m_dim[0]) = M;
+    it += M.size();
+  }
+}
+
+void PackedDoFSymGroupRep::_init(
+    std::vector<Eigen::MatrixXd const *> const &first_op) {
+  for (Eigen::MatrixXd const *M : first_op) {
+    if (M->rows() != M->cols()) {
+      throw std::runtime_error(
+          "Error in PackedDoFSymGroupRep: matrix is not square");
+    }
+    m_dim.push_back(M->cols());
+    m_offset.push_back(m_op_stride);
+    m_op_stride += M->size();
+  }
+  m_data.resize(m_n_ops * m_op_stride);
+}
+
+/// \brief Make packed local DoF symmetry representations
+std::map<DoFKey, PackedDoFSymGroupRep> make_packed_dof_symgroup_rep(
+    std::map<DoFKey, LocalDoFSymGroupRep> const &local_dof_symgroup_rep) {
+  std::map<DoFKey, PackedDoFSymGroupRep> result;
+  for (auto const &pair : local_dof_symgroup_rep) {
+    result.emplace(pair.first, PackedDoFSymGroupRep(pair.second));
+  }
+  return result;
+}
+
+/// \brief Make packed global DoF symmetry representations
+std::map<DoFKey, PackedDoFSymGroupRep> make_packed_dof_symgroup_rep(
+    std::map<DoFKey, GlobalDoFSymGroupRep> const &global_dof_symgroup_rep) {
+  std::map<DoFKey, PackedDoFSymGroupRep> result;
+  for (auto const &pair : global_dof_symgroup_rep) {
+    result.emplace(pair.first, PackedDoFSymGroupRep(pair.second));
+  }
+  return result;
+}
+
+}  // namespace sym_info
+}  // namespace CASM
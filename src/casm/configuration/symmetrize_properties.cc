@@ -0,0 +1,178 @@
+#include "casm/configuration/symmetrize_properties.hh"
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/InvariantSubgroupEngine.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/parallel.hh"
+#include "casm/crystallography/AnisoValTraits.hh"
+#include "casm/crystallography/SymType.hh"
+
+namespace CASM {
+namespace config {
+
+namespace {  // anonymous
+
+/// \brief A property value and the sum of its transformed values
+template <typename ValueType>
+struct _PropertySum {
+  _PropertySum(std::string const &key, ValueType &_value)
+      : traits(key),
+        value(_value),
+        sum(ValueType::Zero(_value.rows(), _value.cols())) {}
+
+  AnisoValTraits traits;
+  ValueType &value;
+  ValueType sum;
+};
+
+}  // namespace
+
+/// \brief Average the properties of a configuration over a group of
+///     operations, in place
+///
+/// Equivalent to replacing each property by the average over `group` of
+/// `copy_apply(op, config_with_properties)`, without copying the
+/// configuration.
+///
+/// \param config_with_properties The configuration and properties. Local
+///     and global properties are replaced by their averages over `group`.
+///     The configuration itself is not changed, so `group` should leave it
+///     invariant, as does `make_invariant_subgroup(configuration, ...)`.
+/// \param group The operations, all in the supercell of the configuration.
+///     Must not be empty.
+void symmetrize_properties(ConfigurationWithProperties &config_with_properties,
+                           std::vector<SupercellSymOp> const &group) {
+  SupercellSymOpWorkspace workspace;
+  symmetrize_properties(config_with_properties, group, workspace);
+}
+
+/// \brief Average the properties of a configuration over a group of
+///     operations, in place, using reusable storage
+///
+/// Gives the same result as `symmetrize_properties(config_with_properties,
+/// group)`. For each operation, each property is transformed by one matrix
+/// product, and local property values are accumulated in permuted order
+/// using the combined site permutation stored in `workspace`.
+void symmetrize_properties(ConfigurationWithProperties &config_with_properties,
+                           std::vector<SupercellSymOp> const &group,
+                           SupercellSymOpWorkspace &workspace) {
+  if (group.empty()) {
+    throw std::runtime_error("Error in symmetrize_properties: empty group");
+  }
+  Supercell const &supercell = *config_with_properties.configuration.supercell;
+  for (auto const &op : group) {
+    if (&op.supercell() != &supercell) {
+      throw std::runtime_error(
+          "Error in symmetrize_properties: operation and configuration "
+          "supercells do not match");
+    }
+  }
+
+  std::vector<_PropertySum<Eigen::VectorXd>> global_sums;
+  for (auto &property : config_with_properties.global_properties) {
+    global_sums.emplace_back(property.first, property.second);
+  }
+  std::vector<_PropertySum<Eigen::MatrixXd>> local_sums;
+  for (auto &property : config_with_properties.local_properties) {
+    local_sums.emplace_back(property.first, property.second);
+  }
+
+  Eigen::MatrixXd M;
+  for (auto const &op : group) {
+    xtal::SymOp symop = op.to_symop();
+    for (auto &x : global_sums) {
+      M = x.traits.symop_to_matrix(get_matrix(symop), get_translation(symop),
+                                   get_time_reversal(symop));
+      x.sum.noalias() += M * x.value;
+    }
+    if (local_sums.empty()) {
+      continue;
+    }
+    sym_info::Permutation const &combined_permute =
+        workspace.update_combined_permute(op);
+    Eigen::MatrixXd &tmp = workspace.local_values;
+    for (auto &x : local_sums) {
+      M = x.traits.symop_to_matrix(get_matrix(symop), get_translation(symop),
+                                   get_time_reversal(symop));
+      tmp.noalias() = M * x.value;
+      for (Index l = 0; l < x.sum.cols(); ++l) {
+        x.sum.col(l) += tmp.col(combined_permute[l]);
+      }
+    }
+  }
+
+  double n = group.size();
+  for (auto &x : global_sums) {
+    x.value = x.sum / n;
+  }
+  for (auto &x : local_sums) {
+    x.value = x.sum / n;
+  }
+}
+
+/// \brief Average the properties of each configuration over the given
+///     group of operations, in place
+///
+/// \param configurations The configurations and properties
+/// \param groups The operations used for each configuration, with
+///     `groups.size() == configurations.size()`
+/// \param n_threads Number of threads. If <= 0, use the hardware
+///     concurrency.
+void symmetrize_properties(
+    std::vector<ConfigurationWithProperties> &configurations,
+    std::vector<std::vector<SupercellSymOp>> const &groups, Index n_threads) {
+  if (groups.size() != configurations.size()) {
+    throw std::runtime_error(
+        "Error in symmetrize_properties: size mismatch between "
+        "configurations and groups");
+  }
+  Index n = configurations.size();
+  std::vector<SupercellSymOpWorkspace> workspaces(
+      resolve_n_threads(n_threads, n));
+  parallel_for_items(n, n_threads, [&](Index t, Index i) {
+    symmetrize_properties(configurations[i], groups[i], workspaces[t]);
+  });
+}
+
+/// \brief Average the properties of each configuration over its invariant
+///     subgroup, in place
+///
+/// \param configurations The configurations and properties
+/// \param which_dofs The DoF used to determine the invariant subgroup of
+///     each configuration, as in `make_invariant_subgroup`. Subgroups are
+///     found with one InvariantSubgroupEngine per supercell.
+/// \param n_threads Number of threads. If <= 0, use the hardware
+///     concurrency.
+void symmetrize_properties(
+    std::vector<ConfigurationWithProperties> &configurations,
+    std::set<std::string> const &which_dofs, Index n_threads) {
+  // one engine per supercell
+  std::map<Supercell const *, std::unique_ptr<InvariantSubgroupEngine>>
+      engines;
+  for (auto const &x : configurations) {
+    auto &engine = engines[x.configuration.supercell.get()];
+    if (!engine) {
+      engine =
+          std::make_unique<InvariantSubgroupEngine>(x.configuration.supercell);
+    }
+  }
+
+  Index n = configurations.size();
+  std::vector<SupercellSymOpWorkspace> workspaces(
+      resolve_n_threads(n_threads, n));
+  parallel_for_items(n, n_threads, [&](Index t, Index i) {
+    Configuration const &configuration = configurations[i].configuration;
+    std::vector<SupercellSymOp> subgroup =
+        engines.at(configuration.supercell.get())
+            ->make_invariant_subgroup(configuration, which_dofs);
+    symmetrize_properties(configurations[i], subgroup, workspaces[t]);
+  });
+}
+
+}  // namespace config
+}  // namespace CASM
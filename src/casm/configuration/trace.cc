@@ -0,0 +1,183 @@
+#include "casm/configuration/trace.hh"
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace CASM {
+namespace config {
+namespace trace {
+
+namespace detail {
+
+std::atomic<Index> generation(0);
+
+}  // namespace detail
+
+namespace {
+
+struct _Event {
+  char const *name;
+  char const *arg_name;
+  Index arg_value;
+  std::chrono::steady_clock::time_point begin;
+  std::chrono::steady_clock::time_point end;
+};
+
+/// \brief Events recorded by one thread
+///
+/// The mutex is only contended while the trace is written.
+struct _ThreadBuffer {
+  explicit _ThreadBuffer(Index _tid) : tid(_tid), generation(0) {}
+
+  Index tid;
+  std::mutex mutex;
+  Index generation;
+  std::vector<_Event> events;
+};
+
+std::mutex _trace_mutex;
+std::unique_ptr<std::ofstream> _trace_file;
+std::chrono::steady_clock::time_point _trace_begin;
+Index _next_generation = 1;
+
+/// \brief All thread buffers, so events of exited threads are kept
+std::vector<std::shared_ptr<_ThreadBuffer>> _buffers;
+
+_ThreadBuffer &_thread_buffer() {
+  thread_local std::shared_ptr<_ThreadBuffer> buffer;
+  if (!buffer) {
+    std::lock_guard<std::mutex> lock(_trace_mutex);
+    buffer = std::make_shared<_ThreadBuffer>(_buffers.size() + 1);
+    _buffers.push_back(buffer);
+  }
+  return *buffer;
+}
+
+void _write_string(std::ostream &out, char const *value) {
+  out << '"';
+  for (char const *c = value; *c; ++c) {
+    if (*c == '"' || *c == '\\') {
+      out << '\\';
+    }
+    out << *c;
+  }
+  out << '"';
+}
+
+double _microseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+/// \brief Starts a trace if `CASM_TRACE_FILE` is set, and writes it at exit
+struct _EnvironmentTrace {
+  _EnvironmentTrace() {
+    if (char const *path = std::getenv("CASM_TRACE_FILE")) {
+      if (*path) {
+        try {
+          start(path);
+        } catch (std::exception const &) {
+        }
+      }
+    }
+  }
+
+  ~_EnvironmentTrace() { stop(); }
+};
+
+_EnvironmentTrace _environment_trace;
+
+}  // namespace
+
+/// \brief Start recording trace events, to be written to a file
+///
+/// \param path Trace file path. The file is opened, and truncated, now, and
+///     written by `stop()`.
+///
+/// If a trace is already being recorded, it is stopped and written first.
+/// Throws if the file cannot be opened.
+void start(std::string const &path) {
+  stop();
+  auto file = std::make_unique<std::ofstream>(path, std::ios::trunc);
+  if (!*file) {
+    throw std::runtime_error("Error in trace::start: cannot open " + path);
+  }
+  std::lock_guard<std::mutex> lock(_trace_mutex);
+  _trace_file = std::move(file);
+  _trace_begin = std::chrono::steady_clock::now();
+  detail::generation.store(_next_generation++, std::memory_order_relaxed);
+}
+
+/// \brief Stop recording and write the trace file
+///
+/// Writes the Chrome trace event JSON format, with one complete (`"X"`)
+/// event per scoped event and one track per thread. Events still open are
+/// not recorded. Does nothing if no trace is being recorded.
+void stop() {
+  std::lock_guard<std::mutex> lock(_trace_mutex);
+  Index active_generation = detail::generation.exchange(0);
+  if (!active_generation) {
+    return;
+  }
+  std::ostream &out = *_trace_file;
+  out << std::fixed << std::setprecision(3);
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  for (auto const &buffer : _buffers) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    if (buffer->generation == active_generation) {
+      for (auto const &event : buffer->events) {
+        out << (first ? "\n" : ",\n") << "{\"name\":";
+        first = false;
+        _write_string(out, event.name);
+        out << ",\"cat\":\"casm\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+            << buffer->tid
+            << ",\"ts\":" << _microseconds(event.begin - _trace_begin)
+            << ",\"dur\":" << _microseconds(event.end - event.begin);
+        if (event.arg_name) {
+          out << ",\"args\":{";
+          _write_string(out, event.arg_name);
+          out << ":" << event.arg_value << "}";
+        }
+        out << "}";
+      }
+    }
+    buffer->events.clear();
+    buffer->events.shrink_to_fit();
+  }
+  out << "\n]}\n";
+  out.flush();
+  _trace_file.reset();
+}
+
+namespace detail {
+
+/// \brief Record a complete event on the calling thread
+///
+/// Events begun during an earlier trace, identified by `generation`, are
+/// dropped.
+void record(Index generation, char const *name, char const *arg_name,
+            Index arg_value, std::chrono::steady_clock::time_point begin,
+            std::chrono::steady_clock::time_point end) {
+  if (detail::generation.load(std::memory_order_relaxed) != generation) {
+    return;
+  }
+  _ThreadBuffer &buffer = _thread_buffer();
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+  if (buffer.generation != generation) {
+    buffer.events.clear();
+    buffer.generation = generation;
+  }
+  buffer.events.push_back({name, arg_name, arg_value, begin, end});
+}
+
+}  // namespace detail
+
+}  // namespace trace
+}  // namespace config
+}  // namespace CASM
@@ -0,0 +1,76 @@
+#ifndef CASM_config_benchmark_helpers
+#define CASM_config_benchmark_helpers
+
+#include <random>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "teststructures.hh"
+
+namespace test {
+
+using namespace CASM;
+
+/// \brief Make a shared Prim from a teststructures.hh prim factory
+inline std::shared_ptr<config::Prim const> make_benchmark_prim(
+    xtal::BasicStructure (*make_xtal_prim)()) {
+  return config::make_shared_prim(make_xtal_prim());
+}
+
+/// \brief Make the supercell with `T = diag(volume, 1, 1)`
+///
+/// This supercell is not in canonical form for volume > 1, and its number of
+/// sites is proportional to `volume`.
+inline std::shared_ptr<config::Supercell const> make_benchmark_supercell(
+    std::shared_ptr<config::Prim const> const &prim, Index volume) {
+  Eigen::Matrix3l T = Eigen::Matrix3l::Identity();
+  T(0, 0) = volume;
+  return std::make_shared<config::Supercell const>(prim, T);
+}
+
+/// \brief Make the supercell with `T = n * I`
+inline std::shared_ptr<config::Supercell const> make_cubic_benchmark_supercell(
+    std::shared_ptr<config::Prim const> const &prim, Index n) {
+  Eigen::Matrix3l T = Eigen::Matrix3l::Identity() * n;
+  return std::make_shared<config::Supercell const>(prim, T);
+}
+
+/// \brief Make a configuration with random, but reproducible, DoF values
+///
+/// Occupation values are chosen uniformly from the allowed occupants, and
+/// continuous DoF values are chosen uniformly from [-0.1, 0.1].
+inline config::Configuration make_random_configuration(
+    std::shared_ptr<config::Supercell const> const &supercell,
+    unsigned int seed = 0) {
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<double> value(-0.1, 0.1);
+
+  config::Configuration configuration(supercell);
+  auto const &basis = supercell->prim->basicstructure->basis();
+  auto const &converter = supercell->unitcellcoord_index_converter;
+  Eigen::VectorXi &occupation = configuration.dof_values.occupation;
+  for (Index l = 0; l < occupation.size(); ++l) {
+    int n_occupants = basis[converter(l).sublattice()].occupant_dof().size();
+    std::uniform_int_distribution<int> occ(0, n_occupants - 1);
+    occupation(l) = occ(engine);
+  }
+  for (auto &pair : configuration.dof_values.local_dof_values) {
+    Eigen::MatrixXd &M = pair.second;
+    for (Index i = 0; i < M.size(); ++i) {
+      M(i) = value(engine);
+    }
+  }
+  for (auto &pair : configuration.dof_values.global_dof_values) {
+    Eigen::VectorXd &v = pair.second;
+    for (Index i = 0; i < v.size(); ++i) {
+      v(i) = value(engine);
+    }
+  }
+  return configuration;
+}
+
+}  // namespace test
+
+#endif
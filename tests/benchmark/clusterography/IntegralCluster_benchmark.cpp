@@ -0,0 +1,74 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// \brief Make `n_sites` distinct sites of `test::FCC_binary_prim`
+std::vector<xtal::UnitCellCoord> _make_sites(Index n_sites) {
+  std::vector<xtal::UnitCellCoord> sites;
+  for (Index i = 0; i < n_sites; ++i) {
+    sites.emplace_back(0, i, i % 2, 0);
+  }
+  return sites;
+}
+
+/// \brief Factor group unitcellcoord reps of `test::FCC_binary_prim`
+std::vector<xtal::UnitCellCoordRep> _make_fcc_unitcellcoord_symgroup_rep() {
+  auto prim = std::make_shared<xtal::BasicStructure const>(
+      test::FCC_binary_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  return sym_info::make_unitcellcoord_symgroup_rep(factor_group->element,
+                                                   *prim);
+}
+
+}  // namespace
+
+/// \brief copy_apply of an IntegralCluster by each factor group operation
+///
+/// The benchmark argument is the number of cluster sites. Clusters of up to 6
+/// sites are stored inline, so larger clusters show the cost of allocating
+/// for each copy.
+static void BM_IntegralClusterCopyApply(benchmark::State &state) {
+  auto unitcellcoord_symgroup_rep = _make_fcc_unitcellcoord_symgroup_rep();
+  clust::IntegralCluster cluster(_make_sites(state.range(0)));
+  for (auto _ : state) {
+    for (auto const &rep : unitcellcoord_symgroup_rep) {
+      clust::IntegralCluster result = copy_apply(rep, cluster);
+      benchmark::DoNotOptimize(result.elements().data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          unitcellcoord_symgroup_rep.size());
+}
+BENCHMARK(BM_IntegralClusterCopyApply)
+    ->DenseRange(1, 8)
+    ->ArgName("n_sites");
+
+/// \brief The same copies as `BM_IntegralClusterCopyApply`, of a
+///     `std::vector<xtal::UnitCellCoord>`, for comparison
+static void BM_UnitCellCoordVectorCopyApply(benchmark::State &state) {
+  auto unitcellcoord_symgroup_rep = _make_fcc_unitcellcoord_symgroup_rep();
+  std::vector<xtal::UnitCellCoord> sites = _make_sites(state.range(0));
+  for (auto _ : state) {
+    for (auto const &rep : unitcellcoord_symgroup_rep) {
+      std::vector<xtal::UnitCellCoord> result = sites;
+      for (auto &unitcellcoord : result) {
+        apply(rep, unitcellcoord);
+      }
+      benchmark::DoNotOptimize(result.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          unitcellcoord_symgroup_rep.size());
+}
+BENCHMARK(BM_UnitCellCoordVectorCopyApply)
+    ->DenseRange(1, 8)
+    ->ArgName("n_sites");
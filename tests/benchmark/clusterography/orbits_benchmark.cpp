@@ -0,0 +1,115 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "synthetic_prims.hh"
+
+using namespace CASM;
+
+/// \brief make_prim_periodic_orbits, with pair clusters up to a maximum
+///     length, and triplet and quadruplet clusters up to the second nearest
+///     neighbor distance
+///
+/// The first benchmark argument is the maximum pair length, times 100, in the
+/// units of `test::FCC_binary_prim` (conventional lattice parameter 4.0), and
+/// the second argument is the number of threads.
+static void BM_MakePrimPeriodicOrbits(
+    benchmark::State &state, xtal::BasicStructure (*make_xtal_prim)()) {
+  auto prim = std::make_shared<xtal::BasicStructure const>(make_xtal_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  double length = state.range(0) / 100.0;
+  std::vector<double> max_length = {0, 0, length, 4.01, 4.01};
+  std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+  Index n_orbits = 0;
+  for (auto _ : state) {
+    auto orbits = clust::make_prim_periodic_orbits(
+        prim, unitcellcoord_symgroup_rep, site_filter, max_length,
+        custom_generators, state.range(1));
+    n_orbits = orbits.size();
+  }
+  state.counters["n_orbits"] = n_orbits;
+}
+BENCHMARK_CAPTURE(BM_MakePrimPeriodicOrbits, FCC, test::FCC_binary_prim)
+    ->ArgsProduct({{401, 601, 801, 1001}, {1, 4}})
+    ->ArgNames({"max_length", "n_threads"})
+    ->Unit(benchmark::kMillisecond);
+
+/// \brief make_local_orbits around a point cluster, with pair and triplet
+///     clusters up to a cutoff radius
+///
+/// The benchmark argument is the cutoff radius, and maximum cluster length,
+/// times 100, in the units of `test::FCC_binary_prim`.
+static void BM_MakeLocalOrbits(benchmark::State &state,
+                               xtal::BasicStructure (*make_xtal_prim)()) {
+  auto prim = std::make_shared<xtal::BasicStructure const>(make_xtal_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto factor_group_unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  clust::IntegralCluster phenomenal({xtal::UnitCellCoord(0, 0, 0, 0)});
+  auto cluster_group = make_cluster_group(
+      phenomenal, factor_group, prim->lattice().lat_column_mat(),
+      factor_group_unitcellcoord_symgroup_rep);
+  auto unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(cluster_group->element, *prim);
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  double length = state.range(0) / 100.0;
+  std::vector<double> max_length = {0, 0, length, length};
+  std::vector<double> cutoff_radius = {0, length, length, length};
+  std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+  Index n_orbits = 0;
+  for (auto _ : state) {
+    auto orbits = clust::make_local_orbits(
+        prim, unitcellcoord_symgroup_rep, site_filter, max_length,
+        custom_generators, phenomenal, cutoff_radius);
+    n_orbits = orbits.size();
+  }
+  state.counters["n_orbits"] = n_orbits;
+}
+BENCHMARK_CAPTURE(BM_MakeLocalOrbits, FCC, test::FCC_binary_prim)
+    ->Arg(401)
+    ->Arg(601)
+    ->Arg(801)
+    ->ArgName("cutoff_radius")
+    ->Unit(benchmark::kMillisecond);
+
+/// \brief make_prim_periodic_orbits, for synthetic prims
+///
+/// Benchmark arguments are the number of sublattices, the lattice (index in
+/// `test::SyntheticLattice` order), the maximum number of cluster sites, and
+/// the cluster cutoff, times 100, in units of the cubic synthetic lattice
+/// parameter.
+static void BM_MakePrimPeriodicOrbitsSynthetic(benchmark::State &state) {
+  auto config_prim =
+      test::make_shared_synthetic_prim(state.range(0), 2, state.range(1));
+  auto const &prim = config_prim->basicstructure;
+  auto const &unitcellcoord_symgroup_rep =
+      config_prim->sym_info.unitcellcoord_symgroup_rep;
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  std::vector<double> max_length = test::make_synthetic_max_length(
+      state.range(2), state.range(3) / 100.0);
+  std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+  Index n_orbits = 0;
+  for (auto _ : state) {
+    auto orbits = clust::make_prim_periodic_orbits(
+        prim, unitcellcoord_symgroup_rep, site_filter, max_length,
+        custom_generators);
+    n_orbits = orbits.size();
+  }
+  state.counters["n_orbits"] = n_orbits;
+  test::set_synthetic_prim_counters(state, *config_prim);
+}
+BENCHMARK(BM_MakePrimPeriodicOrbitsSynthetic)
+    ->ArgNames({"n_sublat", "lattice", "max_branch", "cutoff"})
+    // cluster cutoff
+    ->ArgsProduct({{1}, {0}, {4}, {101, 142, 174, 201, 224}})
+    // number of cluster sites
+    ->ArgsProduct({{1}, {0}, {2, 3, 4, 5}, {142}})
+    // sublattices
+    ->ArgsProduct({{1, 2, 4}, {0}, {3}, {142}})
+    // point group order
+    ->ArgsProduct({{1}, {0, 1, 2, 3, 4, 5}, {3}, {142}})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,204 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "synthetic_prims.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// \brief Set counters shared by the supercell-size parametrized benchmarks
+void _set_supercell_counters(benchmark::State &state,
+                             config::Supercell const &supercell) {
+  state.counters["volume"] = supercell.superlattice.size();
+  state.counters["n_sites"] =
+      supercell.unitcellcoord_index_converter.total_sites();
+}
+
+}  // namespace
+
+/// \brief make_canonical_form(Supercell const &)
+///
+/// The canonical supercell is memoized by Supercell, so a new Supercell is
+/// constructed, untimed, for each iteration.
+static void BM_MakeCanonicalSupercell(
+    benchmark::State &state, xtal::BasicStructure (*make_xtal_prim)()) {
+  auto prim = test::make_benchmark_prim(make_xtal_prim);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto supercell = test::make_benchmark_supercell(prim, state.range(0));
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(make_canonical_form(*supercell));
+  }
+  auto supercell = test::make_benchmark_supercell(prim, state.range(0));
+  _set_supercell_counters(state, *supercell);
+}
+BENCHMARK_CAPTURE(BM_MakeCanonicalSupercell, occ, test::FCC_binary_prim)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+/// \brief make_canonical_form(Configuration const &, begin, end)
+static void BM_MakeCanonicalConfiguration(
+    benchmark::State &state, xtal::BasicStructure (*make_xtal_prim)()) {
+  auto prim = test::make_benchmark_prim(make_xtal_prim);
+  auto supercell = test::make_cubic_benchmark_supercell(prim, state.range(0));
+  config::Configuration configuration =
+      test::make_random_configuration(supercell);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(make_canonical_form(configuration, begin, end));
+  }
+  _set_supercell_counters(state, *supercell);
+}
+BENCHMARK_CAPTURE(BM_MakeCanonicalConfiguration, occ, test::FCC_binary_prim)
+    ->DenseRange(1, 4);
+BENCHMARK_CAPTURE(BM_MakeCanonicalConfiguration, disp,
+                  test::FCC_binary_disp_prim)
+    ->DenseRange(1, 4);
+BENCHMARK_CAPTURE(BM_MakeCanonicalConfiguration, GLstrain,
+                  test::FCC_ternary_GLstrain_prim)
+    ->DenseRange(1, 4);
+
+/// \brief make_invariant_subgroup(Configuration const &, begin, end)
+static void BM_MakeInvariantSubgroup(benchmark::State &state,
+                                     xtal::BasicStructure (*make_xtal_prim)()) {
+  auto prim = test::make_benchmark_prim(make_xtal_prim);
+  auto supercell = test::make_cubic_benchmark_supercell(prim, state.range(0));
+  config::Configuration configuration =
+      test::make_random_configuration(supercell);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        make_invariant_subgroup(configuration, begin, end));
+  }
+  _set_supercell_counters(state, *supercell);
+}
+BENCHMARK_CAPTURE(BM_MakeInvariantSubgroup, occ, test::FCC_binary_prim)
+    ->DenseRange(1, 4);
+BENCHMARK_CAPTURE(BM_MakeInvariantSubgroup, disp, test::FCC_binary_disp_prim)
+    ->DenseRange(1, 4);
+
+/// \brief Iterate over all SupercellSymOp of a supercell
+static void BM_SupercellSymOpIteration(benchmark::State &state) {
+  auto prim = test::make_benchmark_prim(test::FCC_binary_prim);
+  auto supercell = test::make_cubic_benchmark_supercell(prim, state.range(0));
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  Index n_ops = 0;
+  for (auto _ : state) {
+    n_ops = 0;
+    for (auto it = begin; it != end; ++it) {
+      benchmark::DoNotOptimize(it->supercell_factor_group_index());
+      ++n_ops;
+    }
+  }
+  state.counters["n_ops"] = n_ops;
+  state.SetItemsProcessed(state.iterations() * n_ops);
+  _set_supercell_counters(state, *supercell);
+}
+BENCHMARK(BM_SupercellSymOpIteration)->DenseRange(1, 4);
+
+/// \brief Apply all SupercellSymOp of a supercell to a configuration
+static void BM_SupercellSymOpApply(benchmark::State &state,
+                                   xtal::BasicStructure (*make_xtal_prim)()) {
+  auto prim = test::make_benchmark_prim(make_xtal_prim);
+  auto supercell = test::make_cubic_benchmark_supercell(prim, state.range(0));
+  config::Configuration configuration =
+      test::make_random_configuration(supercell);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  config::SupercellSymOpApplier applier;
+  Index n_ops = 0;
+  for (auto _ : state) {
+    n_ops = 0;
+    for (auto it = begin; it != end; ++it) {
+      benchmark::DoNotOptimize(applier.copy_apply(*it, configuration));
+      ++n_ops;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * n_ops);
+  _set_supercell_counters(state, *supercell);
+}
+BENCHMARK_CAPTURE(BM_SupercellSymOpApply, occ, test::FCC_binary_prim)
+    ->DenseRange(1, 4);
+BENCHMARK_CAPTURE(BM_SupercellSymOpApply, disp, test::FCC_binary_disp_prim)
+    ->DenseRange(1, 4);
+BENCHMARK_CAPTURE(BM_SupercellSymOpApply, GLstrain,
+                  test::FCC_ternary_GLstrain_prim)
+    ->DenseRange(1, 4);
+
+/// \brief make_canonical_form(Configuration const &, begin, end), for
+///     synthetic prims
+///
+/// Benchmark arguments are the number of sublattices, the number of
+/// occupants per site, the lattice (index in `test::SyntheticLattice`
+/// order), whether occupants are anisotropic, and the supercell volume, with
+/// `T = diag(volume, 1, 1)`.
+static void BM_MakeCanonicalConfigurationSynthetic(benchmark::State &state) {
+  auto prim = test::make_shared_synthetic_prim(
+      state.range(0), state.range(1), state.range(2), state.range(3));
+  auto supercell = test::make_benchmark_supercell(prim, state.range(4));
+  config::Configuration configuration =
+      test::make_random_configuration(supercell);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(make_canonical_form(configuration, begin, end));
+  }
+  test::set_synthetic_prim_counters(state, *prim);
+  _set_supercell_counters(state, *supercell);
+}
+BENCHMARK(BM_MakeCanonicalConfigurationSynthetic)
+    ->ArgNames({"n_sublat", "n_occ", "lattice", "aniso", "volume"})
+    // supercell volume sweep
+    ->ArgsProduct({{1}, {2}, {0}, {0}, {1, 4, 16, 64}})
+    // sublattices
+    ->ArgsProduct({{1, 2, 4, 8}, {2}, {0}, {0}, {8}})
+    // occupants per site
+    ->ArgsProduct({{1}, {2, 3, 4, 6}, {0}, {0}, {8}})
+    // point group order
+    ->ArgsProduct({{1}, {2}, {0, 1, 2, 3, 4, 5}, {0}, {8}})
+    // anisotropic occupants
+    ->ArgsProduct({{1}, {2, 4}, {0}, {0, 1}, {8}});
+
+/// \brief make_canonical_form(Configuration const &, begin, end), for
+///     synthetic prims with continuous DoF
+///
+/// The benchmark argument is the supercell volume, with
+/// `T = diag(volume, 1, 1)`.
+static void BM_MakeCanonicalConfigurationSyntheticDoF(
+    benchmark::State &state, std::vector<std::string> local_dof,
+    std::vector<std::string> global_dof) {
+  test::SyntheticPrimParams params;
+  params.n_sublattices = 2;
+  params.local_dof = local_dof;
+  params.global_dof = global_dof;
+  auto prim = test::make_shared_synthetic_prim(params);
+  auto supercell = test::make_benchmark_supercell(prim, state.range(0));
+  config::Configuration configuration =
+      test::make_random_configuration(supercell);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(make_canonical_form(configuration, begin, end));
+  }
+  test::set_synthetic_prim_counters(state, *prim);
+  _set_supercell_counters(state, *supercell);
+}
+BENCHMARK_CAPTURE(BM_MakeCanonicalConfigurationSyntheticDoF, occ,
+                  std::vector<std::string>{}, std::vector<std::string>{})
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+BENCHMARK_CAPTURE(BM_MakeCanonicalConfigurationSyntheticDoF, disp,
+                  std::vector<std::string>{"disp"},
+                  std::vector<std::string>{})
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+BENCHMARK_CAPTURE(BM_MakeCanonicalConfigurationSyntheticDoF, disp_GLstrain,
+                  std::vector<std::string>{"disp"},
+                  std::vector<std::string>{"GLstrain"})
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
@@ -0,0 +1,37 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.hh"
+#include "casm/configuration/config_space_analysis.hh"
+
+using namespace CASM;
+
+/// \brief config_space_analysis of one random configuration
+///
+/// The configuration is in a supercell with `T = diag(volume, 1, 1)`, so the
+/// fully commensurate supercell, and the number of equivalent
+/// configurations, grows with volume.
+static void BM_ConfigSpaceAnalysis(benchmark::State &state,
+                                   xtal::BasicStructure (*make_xtal_prim)(),
+                                   std::string dof) {
+  auto prim = test::make_benchmark_prim(make_xtal_prim);
+  auto supercell = test::make_benchmark_supercell(prim, state.range(0));
+  std::map<std::string, config::Configuration> configurations;
+  configurations.emplace("random",
+                         test::make_random_configuration(supercell));
+  std::vector<std::string> dofs({dof});
+  bool store_equivalents = state.range(1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(config::config_space_analysis(
+        configurations, dofs, std::nullopt, false, std::nullopt, std::nullopt,
+        TOL, store_equivalents));
+  }
+  state.counters["volume"] = state.range(0);
+}
+BENCHMARK_CAPTURE(BM_ConfigSpaceAnalysis, occ, test::FCC_binary_prim, "occ")
+    ->ArgsProduct({{1, 2, 3, 4}, {0, 1}})
+    ->ArgNames({"volume", "store_equivalents"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ConfigSpaceAnalysis, disp, test::FCC_binary_disp_prim,
+                  "disp")
+    ->ArgsProduct({{1, 2, 3, 4}, {0, 1}})
+    ->ArgNames({"volume", "store_equivalents"})
+    ->Unit(benchmark::kMillisecond);
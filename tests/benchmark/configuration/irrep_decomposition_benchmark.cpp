@@ -0,0 +1,128 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/group/subgroups.hh"
+#include "casm/configuration/irreps/IrrepDecomposition.hh"
+#include "synthetic_prims.hh"
+
+using namespace CASM;
+
+/// \brief IrrepDecomposition of a local DoF matrix rep on all supercell sites
+///
+/// The matrix rep and subgroups are constructed once, so only the
+/// decomposition is timed. The vector space dimension is
+/// `n_sites * dof_dim`.
+static void BM_IrrepDecompositionLocal(benchmark::State &state,
+                                       xtal::BasicStructure (*make_xtal_prim)(),
+                                       std::string dof) {
+  auto prim = test::make_benchmark_prim(make_xtal_prim);
+  auto supercell = test::make_benchmark_supercell(prim, state.range(0));
+  std::vector<config::SupercellSymOp> group(
+      config::SupercellSymOp::begin(supercell),
+      config::SupercellSymOp::end(supercell));
+  std::set<Index> sites;
+  for (Index l = 0; l < supercell->unitcellcoord_index_converter.total_sites();
+       ++l) {
+    sites.insert(l);
+  }
+  std::shared_ptr<config::SymGroup const> symgroup;
+  std::vector<Eigen::MatrixXd> matrix_rep =
+      config::make_local_dof_matrix_rep(group, dof, sites, symgroup);
+
+  irreps::GroupIndices head_group;
+  for (Index i = 0; i < matrix_rep.size(); ++i) {
+    head_group.insert(i);
+  }
+  Index dim = matrix_rep[0].rows();
+  Eigen::MatrixXd init_subspace = Eigen::MatrixXd::Identity(dim, dim);
+  std::function<irreps::GroupIndicesOrbitSet()> make_cyclic_subgroups_f =
+      [=]() { return group::make_cyclic_subgroups(*symgroup); };
+  std::function<irreps::GroupIndicesOrbitSet()> make_all_subgroups_f = [=]() {
+    return group::make_all_subgroups(*symgroup);
+  };
+  bool allow_complex = true;
+
+  for (auto _ : state) {
+    irreps::IrrepDecomposition irrep_decomposition(
+        matrix_rep, head_group, init_subspace, make_cyclic_subgroups_f,
+        make_all_subgroups_f, allow_complex);
+    benchmark::DoNotOptimize(irrep_decomposition.irreps);
+  }
+  state.counters["volume"] = state.range(0);
+  state.counters["dim"] = dim;
+}
+BENCHMARK_CAPTURE(BM_IrrepDecompositionLocal, occ, test::FCC_ternary_prim,
+                  "occ")
+    ->DenseRange(1, 4)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IrrepDecompositionLocal, disp, test::FCC_binary_disp_prim,
+                  "disp")
+    ->DenseRange(1, 4)
+    ->Unit(benchmark::kMillisecond);
+
+/// \brief IrrepDecomposition of a local DoF matrix rep on all supercell
+///     sites, for synthetic prims
+///
+/// Benchmark arguments are the number of sublattices, the lattice (index in
+/// `test::SyntheticLattice` order), and the supercell volume, with
+/// `T = diag(volume, 1, 1)`.
+static void BM_IrrepDecompositionLocalSynthetic(benchmark::State &state,
+                                                std::string dof) {
+  test::SyntheticPrimParams params;
+  params.n_sublattices = state.range(0);
+  params.n_occupants = (dof == "occ") ? 3 : 1;
+  params.lattice = static_cast<test::SyntheticLattice>(state.range(1));
+  if (dof != "occ") {
+    params.local_dof = {dof};
+  }
+  auto prim = test::make_shared_synthetic_prim(params);
+  auto supercell = test::make_benchmark_supercell(prim, state.range(2));
+  std::vector<config::SupercellSymOp> group(
+      config::SupercellSymOp::begin(supercell),
+      config::SupercellSymOp::end(supercell));
+  std::set<Index> sites;
+  for (Index l = 0; l < supercell->unitcellcoord_index_converter.total_sites();
+       ++l) {
+    sites.insert(l);
+  }
+  std::shared_ptr<config::SymGroup const> symgroup;
+  std::vector<Eigen::MatrixXd> matrix_rep =
+      config::make_local_dof_matrix_rep(group, dof, sites, symgroup);
+
+  irreps::GroupIndices head_group;
+  for (Index i = 0; i < matrix_rep.size(); ++i) {
+    head_group.insert(i);
+  }
+  Index dim = matrix_rep[0].rows();
+  Eigen::MatrixXd init_subspace = Eigen::MatrixXd::Identity(dim, dim);
+  std::function<irreps::GroupIndicesOrbitSet()> make_cyclic_subgroups_f =
+      [=]() { return group::make_cyclic_subgroups(*symgroup); };
+  std::function<irreps::GroupIndicesOrbitSet()> make_all_subgroups_f = [=]() {
+    return group::make_all_subgroups(*symgroup);
+  };
+  bool allow_complex = true;
+
+  for (auto _ : state) {
+    irreps::IrrepDecomposition irrep_decomposition(
+        matrix_rep, head_group, init_subspace, make_cyclic_subgroups_f,
+        make_all_subgroups_f, allow_complex);
+    benchmark::DoNotOptimize(irrep_decomposition.irreps);
+  }
+  state.counters["volume"] = state.range(2);
+  state.counters["dim"] = dim;
+  test::set_synthetic_prim_counters(state, *prim);
+}
+BENCHMARK_CAPTURE(BM_IrrepDecompositionLocalSynthetic, occ, "occ")
+    ->ArgNames({"n_sublat", "lattice", "volume"})
+    // point group order
+    ->ArgsProduct({{1}, {0, 1, 2, 3, 4, 5}, {2}})
+    // sublattices
+    ->ArgsProduct({{1, 2, 4}, {0}, {1}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IrrepDecompositionLocalSynthetic, disp, "disp")
+    ->ArgNames({"n_sublat", "lattice", "volume"})
+    // point group order
+    ->ArgsProduct({{1}, {0, 1, 2, 3, 4, 5}, {2}})
+    // supercell volume sweep
+    ->ArgsProduct({{1}, {0}, {1, 2, 3, 4}})
+    ->Unit(benchmark::kMillisecond);
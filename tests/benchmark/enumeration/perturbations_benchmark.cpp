@@ -0,0 +1,48 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/enumeration/perturbations.hh"
+
+using namespace CASM;
+
+/// \brief make_distinct_perturbations of nearest neighbor pair and triplet
+///     clusters in a random background configuration
+///
+/// The first benchmark argument is `n`, for the supercell `T = n * I`, and
+/// the second argument is the number of threads.
+static void BM_MakeDistinctPerturbations(
+    benchmark::State &state, xtal::BasicStructure (*make_xtal_prim)()) {
+  auto prim = test::make_benchmark_prim(make_xtal_prim);
+  auto supercell = test::make_cubic_benchmark_supercell(prim, state.range(0));
+  config::Configuration background = test::make_random_configuration(supercell);
+
+  std::vector<clust::IntegralCluster> clusters(
+      {clust::IntegralCluster({xtal::UnitCellCoord(0, 0, 0, 0),
+                               xtal::UnitCellCoord(0, 1, 0, 0)}),
+       clust::IntegralCluster({xtal::UnitCellCoord(0, 0, 0, 0),
+                               xtal::UnitCellCoord(0, 1, 0, 0),
+                               xtal::UnitCellCoord(0, 0, 1, 0)})});
+  std::vector<std::set<clust::IntegralCluster>> orbits;
+  for (auto const &cluster : clusters) {
+    orbits.emplace_back(make_prim_periodic_orbit(
+        cluster, prim->sym_info.unitcellcoord_symgroup_rep));
+  }
+  auto orbits_as_indices = clust::make_flat_orbits_as_indices(
+      orbits, supercell->unitcellcoord_index_converter);
+  auto distinct_cluster_sites =
+      config::make_distinct_cluster_sites(background, orbits_as_indices);
+
+  Index n_perturbations = 0;
+  for (auto _ : state) {
+    auto perturbations = config::make_distinct_perturbations(
+        background, distinct_cluster_sites, state.range(1));
+    n_perturbations = perturbations.size();
+  }
+  state.counters["n_sites"] =
+      supercell->unitcellcoord_index_converter.total_sites();
+  state.counters["n_perturbations"] = n_perturbations;
+}
+BENCHMARK_CAPTURE(BM_MakeDistinctPerturbations, occ, test::FCC_binary_prim)
+    ->ArgsProduct({{2, 3, 4}, {1, 4}})
+    ->ArgNames({"n", "n_threads"})
+    ->Unit(benchmark::kMillisecond);
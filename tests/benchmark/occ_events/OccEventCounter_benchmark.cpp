@@ -0,0 +1,94 @@
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.hh"
+#include "casm/configuration/occ_events/OccEventCounter.hh"
+#include "casm/configuration/occ_events/OccSystem.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "synthetic_prims.hh"
+
+using namespace CASM;
+
+/// \brief Count all OccEvent on FCC nearest neighbor clusters
+///
+/// The benchmark argument is the number of sites in the cluster, which are
+/// chosen from the origin and its nearest neighbors in an (a, b) plane.
+static void BM_OccEventCounter(benchmark::State &state,
+                               xtal::BasicStructure (*make_xtal_prim)()) {
+  auto prim = std::make_shared<xtal::BasicStructure const>(make_xtal_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto system = std::make_shared<occ_events::OccSystem>(
+      prim, occ_events::make_chemical_name_list(*prim, factor_group->element));
+
+  std::vector<xtal::UnitCellCoord> sites = {
+      xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(0, 1, 0, 0),
+      xtal::UnitCellCoord(0, 0, 1, 0), xtal::UnitCellCoord(0, 1, -1, 0)};
+  sites.resize(state.range(0));
+  std::vector<clust::IntegralCluster> clusters({clust::IntegralCluster(sites)});
+
+  occ_events::OccEventCounterParameters params;
+  params.skip_direct_exchange = false;
+  Index n_events = 0;
+  for (auto _ : state) {
+    occ_events::OccEventCounter counter(system, clusters, params);
+    n_events = 0;
+    while (!counter.is_finished()) {
+      benchmark::DoNotOptimize(counter.value());
+      counter.advance();
+      ++n_events;
+    }
+  }
+  state.counters["n_events"] = n_events;
+}
+BENCHMARK_CAPTURE(BM_OccEventCounter, FCC_binary_vacancy,
+                  test::FCC_binary_vacancy_prim)
+    ->DenseRange(2, 4)
+    ->ArgName("cluster_size")
+    ->Unit(benchmark::kMillisecond);
+
+/// \brief Count all OccEvent on a cluster of a synthetic prim with a
+///     vacancy
+///
+/// Benchmark arguments are the number of occupants per site, including the
+/// vacancy, the lattice (index in `test::SyntheticLattice` order), and the
+/// number of sites in the cluster, which are the origin and its neighbors
+/// along the a, b, and -a lattice vectors.
+static void BM_OccEventCounterSynthetic(benchmark::State &state) {
+  test::SyntheticPrimParams prim_params;
+  prim_params.n_occupants = state.range(0);
+  prim_params.lattice = static_cast<test::SyntheticLattice>(state.range(1));
+  prim_params.vacancy = true;
+  auto config_prim = test::make_shared_synthetic_prim(prim_params);
+  auto const &prim = config_prim->basicstructure;
+  auto const &factor_group = config_prim->sym_info.factor_group;
+  auto system = std::make_shared<occ_events::OccSystem>(
+      prim, occ_events::make_chemical_name_list(*prim, factor_group->element));
+
+  std::vector<xtal::UnitCellCoord> sites = {
+      xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(0, 1, 0, 0),
+      xtal::UnitCellCoord(0, 0, 1, 0), xtal::UnitCellCoord(0, -1, 0, 0)};
+  sites.resize(state.range(2));
+  std::vector<clust::IntegralCluster> clusters({clust::IntegralCluster(sites)});
+
+  occ_events::OccEventCounterParameters params;
+  params.skip_direct_exchange = false;
+  Index n_events = 0;
+  for (auto _ : state) {
+    occ_events::OccEventCounter counter(system, clusters, params);
+    n_events = 0;
+    while (!counter.is_finished()) {
+      benchmark::DoNotOptimize(counter.value());
+      counter.advance();
+      ++n_events;
+    }
+  }
+  state.counters["n_events"] = n_events;
+  test::set_synthetic_prim_counters(state, *config_prim);
+}
+BENCHMARK(BM_OccEventCounterSynthetic)
+    ->ArgNames({"n_occ", "lattice", "cluster_size"})
+    // occupants per site
+    ->ArgsProduct({{2, 3, 4, 5}, {0}, {3}})
+    // cluster size
+    ->ArgsProduct({{3}, {0}, {2, 3, 4}})
+    // point group order
+    ->ArgsProduct({{3}, {0, 2, 5}, {3}})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,210 @@
+#ifndef CASM_config_benchmark_synthetic_prims
+#define CASM_config_benchmark_synthetic_prims
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/PrimSymInfo.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/Molecule.hh"
+#include "casm/crystallography/Site.hh"
+
+namespace test {
+
+using namespace CASM;
+
+/// \brief Lattice of a synthetic prim, in order of decreasing lattice point
+///     group order (48, 24, 16, 8, 4, 2)
+///
+/// Benchmark arguments are integers, so benchmarks pass the index of the
+/// lattice in this order.
+enum class SyntheticLattice {
+  cubic,
+  hexagonal,
+  tetragonal,
+  orthorhombic,
+  monoclinic,
+  triclinic
+};
+
+/// \brief Parameters of a synthetic prim
+///
+/// Notes:
+/// - Sublattice `b` is at fractional coordinate `(0, 0, b / n_sublattices)`.
+///   Each sublattice has its own occupant species, so sublattices are not
+///   related by translation and the prim stays primitive. For more than one
+///   sublattice the factor group is the subgroup of the lattice point group
+///   that preserves the stacking along the c axis.
+/// - If `anisotropic_occupants`, occupants come in pairs of the same atom
+///   with opposite "Cmagspin", as `test::SimpleCubic_ising_prim`, so
+///   occupant index permutations are non-trivial.
+/// - If `vacancy`, the last occupant on each sublattice is a vacancy, in
+///   addition to the `n_occupants - 1` atoms.
+/// - The actual factor group order is reported by
+///   `set_synthetic_prim_counters`, and should be used to chart results
+///   rather than the lattice.
+struct SyntheticPrimParams {
+  Index n_sublattices = 1;
+
+  Index n_occupants = 2;
+
+  SyntheticLattice lattice = SyntheticLattice::cubic;
+
+  bool anisotropic_occupants = false;
+
+  bool vacancy = false;
+
+  /// \brief Local continuous DoF names, such as "disp"
+  std::vector<std::string> local_dof;
+
+  /// \brief Global continuous DoF names, such as "GLstrain"
+  std::vector<std::string> global_dof;
+};
+
+/// \brief Lattice vectors, as columns, of a synthetic lattice
+///
+/// Lengths are close to 1.0, so cluster cutoffs are in units of the
+/// nearest-neighbor distance of the cubic lattice.
+inline Eigen::Matrix3d make_synthetic_lattice_column_mat(
+    SyntheticLattice lattice) {
+  Eigen::Matrix3d L;
+  switch (lattice) {
+    case SyntheticLattice::cubic:
+      L << 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0;
+      break;
+    case SyntheticLattice::hexagonal:
+      L << 1.0, -0.5, 0.0, 0.0, std::sqrt(3.0) / 2.0, 0.0, 0.0, 0.0, 1.6;
+      break;
+    case SyntheticLattice::tetragonal:
+      L << 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.3;
+      break;
+    case SyntheticLattice::orthorhombic:
+      L << 1.0, 0.0, 0.0, 0.0, 1.2, 0.0, 0.0, 0.0, 1.4;
+      break;
+    case SyntheticLattice::monoclinic:
+      L << 1.0, 0.0, 0.3, 0.0, 1.2, 0.0, 0.0, 0.0, 1.4;
+      break;
+    case SyntheticLattice::triclinic:
+      L << 1.0, 0.2, 0.3, 0.0, 1.1, 0.15, 0.0, 0.0, 1.3;
+      break;
+  }
+  return L;
+}
+
+/// \brief Make a synthetic prim
+inline xtal::BasicStructure make_synthetic_prim(
+    SyntheticPrimParams const &params) {
+  using namespace CASM::xtal;
+
+  if (params.n_sublattices < 1 || params.n_occupants < 1) {
+    throw std::runtime_error(
+        "Error in make_synthetic_prim: n_sublattices and n_occupants must be "
+        ">= 1");
+  }
+
+  BasicStructure struc{
+      Lattice{make_synthetic_lattice_column_mat(params.lattice)}};
+  struc.set_title("synthetic");
+
+  AnisoValTraits Cmagspin("Cmagspin");
+  Eigen::VectorXd up(1);
+  up << 1.0;
+  Eigen::VectorXd down(1);
+  down << -1.0;
+
+  std::vector<SiteDoFSet> local_dofsets;
+  for (std::string const &name : params.local_dof) {
+    local_dofsets.emplace_back(AnisoValTraits(name));
+  }
+
+  std::vector<std::vector<std::string>> unique_names;
+  for (Index b = 0; b < params.n_sublattices; ++b) {
+    std::vector<Molecule> occupants;
+    std::vector<std::string> names;
+    Index n_atoms = params.n_occupants - (params.vacancy ? 1 : 0);
+    for (Index i = 0; i < n_atoms; ++i) {
+      Index species = params.anisotropic_occupants ? i / 2 : i;
+      std::string atom_name = "S" + std::to_string(b) + "_" +
+                              std::to_string(species);
+      Molecule occupant = Molecule::make_atom(atom_name);
+      if (params.anisotropic_occupants) {
+        bool is_up = (i % 2 == 0);
+        occupant.set_properties(
+            {{Cmagspin.name(), SpeciesProperty(Cmagspin, is_up ? up : down)}});
+        atom_name += is_up ? ".up" : ".down";
+      }
+      occupants.push_back(occupant);
+      names.push_back(atom_name);
+    }
+    if (params.vacancy) {
+      occupants.push_back(Molecule::make_vacancy());
+      names.push_back("Va");
+    }
+    Eigen::Vector3d frac(0.0, 0.0,
+                         double(b) / double(params.n_sublattices));
+    struc.push_back(Site(Coordinate(frac, struc.lattice(), FRAC), occupants,
+                         local_dofsets));
+    unique_names.push_back(names);
+  }
+  struc.set_unique_names(unique_names);
+
+  std::vector<DoFSet> global_dofsets;
+  for (std::string const &name : params.global_dof) {
+    global_dofsets.emplace_back(AnisoValTraits(name));
+  }
+  struc.set_global_dofs(global_dofsets);
+
+  return struc;
+}
+
+/// \brief Make a shared synthetic Prim
+inline std::shared_ptr<config::Prim const> make_shared_synthetic_prim(
+    SyntheticPrimParams const &params) {
+  return config::make_shared_prim(make_synthetic_prim(params));
+}
+
+/// \brief Make a synthetic prim from integer benchmark arguments
+///
+/// \param n_sublattices Number of sublattices
+/// \param n_occupants Number of occupants per site
+/// \param lattice Index of the lattice, in SyntheticLattice order
+/// \param anisotropic_occupants If non-zero, use anisotropic occupants
+inline std::shared_ptr<config::Prim const> make_shared_synthetic_prim(
+    Index n_sublattices, Index n_occupants, Index lattice,
+    Index anisotropic_occupants = 0) {
+  SyntheticPrimParams params;
+  params.n_sublattices = n_sublattices;
+  params.n_occupants = n_occupants;
+  params.lattice = static_cast<SyntheticLattice>(lattice);
+  params.anisotropic_occupants = (anisotropic_occupants != 0);
+  return make_shared_synthetic_prim(params);
+}
+
+/// \brief Maximum cluster site-to-site distances, by number of sites, for
+///     clusters of up to `max_branch` sites within `cutoff`
+inline std::vector<double> make_synthetic_max_length(Index max_branch,
+                                                     double cutoff) {
+  std::vector<double> max_length(max_branch + 1, cutoff);
+  max_length[0] = 0.0;
+  if (max_branch >= 1) {
+    max_length[1] = 0.0;
+  }
+  return max_length;
+}
+
+/// \brief Set benchmark counters describing a synthetic prim
+///
+/// Sets "n_sublat", "n_fg" (the factor group order), and "aniso_occs".
+template <typename StateType>
+void set_synthetic_prim_counters(StateType &state, config::Prim const &prim) {
+  state.counters["n_sublat"] = prim.basicstructure->basis().size();
+  state.counters["n_fg"] = prim.sym_info.factor_group->element.size();
+  state.counters["aniso_occs"] = prim.sym_info.has_aniso_occs ? 1 : 0;
+}
+
+}  // namespace test
+
+#endif
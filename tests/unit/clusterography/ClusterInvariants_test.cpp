@@ -0,0 +1,120 @@
+#include "casm/configuration/clusterography/ClusterInvariants.hh"
+
+#include <algorithm>
+
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/Coordinate.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(ClusterInvariantsTest, Extend) {
+  xtal::BasicStructure prim = test::ZrO_prim();
+  std::vector<xtal::UnitCellCoord> sites = {
+      xtal::UnitCellCoord(2, 0, 0, 0), xtal::UnitCellCoord(3, 1, 0, 0),
+      xtal::UnitCellCoord(2, 0, -1, 1), xtal::UnitCellCoord(3, -1, 1, 0),
+      xtal::UnitCellCoord(2, 1, 1, -1)};
+  clust::IntegralCluster phenomenal(
+      {xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(1, 0, 0, 0)});
+
+  clust::IntegralCluster parent_cluster;
+  clust::ClusterInvariants parent(parent_cluster, prim);
+  clust::ClusterInvariants local_parent(parent_cluster, phenomenal, prim);
+  for (auto const &site : sites) {
+    clust::IntegralCluster cluster = parent_cluster;
+    cluster.elements().push_back(site);
+
+    clust::ClusterInvariants expected(cluster, prim);
+    clust::ClusterInvariants extended(parent, parent_cluster, site, prim);
+    EXPECT_EQ(extended.size(), expected.size());
+    EXPECT_EQ(extended.distances(), expected.distances());
+    EXPECT_TRUE(extended.phenomenal_distances().empty());
+
+    clust::ClusterInvariants local_expected(cluster, phenomenal, prim);
+    clust::ClusterInvariants local_extended(local_parent, parent_cluster, site,
+                                            phenomenal, prim);
+    EXPECT_EQ(local_extended.size(), local_expected.size());
+    EXPECT_EQ(local_extended.distances(), local_expected.distances());
+    EXPECT_EQ(local_extended.phenomenal_distances(),
+              local_expected.phenomenal_distances());
+
+    parent_cluster = cluster;
+    parent = extended;
+    local_parent = local_extended;
+  }
+}
+
+TEST(ClusterInvariantsTest, DistancesAndCompare) {
+  xtal::BasicStructure prim = test::ZrO_prim();
+  std::vector<clust::IntegralCluster> clusters = {
+      clust::IntegralCluster({xtal::UnitCellCoord(2, 0, 0, 0),
+                              xtal::UnitCellCoord(3, 1, 0, 0)}),
+      clust::IntegralCluster({xtal::UnitCellCoord(2, 0, 0, 0),
+                              xtal::UnitCellCoord(3, 1, 0, 0),
+                              xtal::UnitCellCoord(2, 0, -1, 1)}),
+      clust::IntegralCluster({xtal::UnitCellCoord(0, 0, 0, 0),
+                              xtal::UnitCellCoord(1, 0, 0, 1)}),
+      clust::IntegralCluster(
+          {xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(1, 0, 0, 1),
+           xtal::UnitCellCoord(2, 1, 1, -1), xtal::UnitCellCoord(3, -1, 1, 0)}),
+  };
+  clust::IntegralCluster phenomenal(
+      {xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(1, 0, 0, 0)});
+  double tol = prim.lattice().tol();
+
+  std::vector<clust::ClusterInvariants> invariants;
+  for (auto const &cluster : clusters) {
+    clust::ClusterInvariants local(cluster, phenomenal, prim);
+
+    // compare to distances calculated from xtal::Coordinate
+    std::vector<double> expected;
+    for (int i = 0; i < cluster.size(); ++i) {
+      for (int j = i + 1; j < cluster.size(); ++j) {
+        expected.push_back(
+            (cluster[i].coordinate(prim) - cluster[j].coordinate(prim))
+                .const_cart()
+                .norm());
+      }
+    }
+    std::sort(expected.begin(), expected.end());
+    ASSERT_EQ(local.distances().size(), expected.size());
+    for (Index i = 0; i < expected.size(); ++i) {
+      EXPECT_NEAR(local.distances()[i], expected[i], 1e-10);
+    }
+
+    std::vector<double> expected_phenom;
+    for (int i = 0; i < cluster.size(); ++i) {
+      for (int j = 0; j < phenomenal.size(); ++j) {
+        expected_phenom.push_back(
+            (cluster[i].coordinate(prim) - phenomenal[j].coordinate(prim))
+                .const_cart()
+                .norm());
+      }
+    }
+    std::sort(expected_phenom.begin(), expected_phenom.end());
+    ASSERT_EQ(local.phenomenal_distances().size(), expected_phenom.size());
+    for (Index i = 0; i < expected_phenom.size(); ++i) {
+      EXPECT_NEAR(local.phenomenal_distances()[i], expected_phenom[i], 1e-10);
+    }
+    invariants.push_back(local);
+  }
+
+  // CompareCluster_f is consistent with compare and almost_equal
+  clust::CompareCluster_f compare_f(tol);
+  for (Index i = 0; i < clusters.size(); ++i) {
+    for (Index j = 0; j < clusters.size(); ++j) {
+      auto const &A = invariants[i];
+      auto const &B = invariants[j];
+      bool A_less = clust::compare(A, B, tol);
+      bool B_less = clust::compare(B, A, tol);
+      EXPECT_FALSE(A_less && B_less);
+      EXPECT_EQ(!A_less && !B_less, clust::almost_equal(A, B, tol));
+      bool expected_less = A_less || (!B_less && clusters[i] < clusters[j]);
+      EXPECT_EQ(compare_f(std::make_pair(A, clusters[i]),
+                          std::make_pair(B, clusters[j])),
+                expected_less);
+    }
+  }
+}
@@ -0,0 +1,103 @@
+#include "casm/configuration/clusterography/PackedUnitCellCoordSymGroupRep.hh"
+
+#include "casm/configuration/clusterography/ClusterSpecs.hh"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/group/Group.hh"
+#include "casm/configuration/group/orbits.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Check the packed representation against the IntegralCluster functions,
+/// for all clusters in `orbits`
+void check_packed_rep(
+    std::vector<std::set<clust::IntegralCluster>> const &orbits,
+    std::vector<xtal::UnitCellCoordRep> const &rep, bool is_local) {
+  using namespace clust;
+  PackedUnitCellCoordSymGroupRep packed_rep(rep);
+  EXPECT_EQ(packed_rep.size(), rep.size());
+
+  PackedClusterImages images;
+  for (auto const &orbit : orbits) {
+    for (auto const &cluster : orbit) {
+      IntegralCluster best;
+      IntegralCluster scratch;
+      if (is_local) {
+        packed_rep.make_local_images(cluster, images);
+        group::make_canonical_element(
+            cluster, rep.begin(), rep.end(), std::less<IntegralCluster>(),
+            local_integral_cluster_apply, best, scratch);
+        EXPECT_EQ(packed_rep.make_local_canonical_element(cluster), best);
+      } else {
+        packed_rep.make_prim_periodic_images(cluster, images);
+        group::make_canonical_element(
+            cluster, rep.begin(), rep.end(), std::less<IntegralCluster>(),
+            prim_periodic_integral_cluster_apply, best, scratch);
+        EXPECT_EQ(packed_rep.make_prim_periodic_canonical_element(cluster),
+                  best);
+      }
+      ASSERT_EQ(images.n_images, rep.size());
+      ASSERT_EQ(images.n_sites, cluster.size());
+      for (Index m = 0; m < rep.size(); ++m) {
+        IntegralCluster expected =
+            is_local ? local_integral_cluster_copy_apply(rep[m], cluster)
+                     : prim_periodic_integral_cluster_copy_apply(rep[m],
+                                                                 cluster);
+        EXPECT_EQ(make_cluster(images, m), expected);
+      }
+    }
+
+    if (is_local) {
+      EXPECT_EQ(packed_rep.make_local_equivalence_map(orbit),
+                group::make_equivalence_map(orbit, rep.begin(), rep.end(),
+                                            local_integral_cluster_copy_apply));
+    } else {
+      EXPECT_EQ(packed_rep.make_prim_periodic_equivalence_map(orbit),
+                group::make_equivalence_map(
+                    orbit, rep.begin(), rep.end(),
+                    prim_periodic_integral_cluster_copy_apply));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(PackedUnitCellCoordSymGroupRepTest, ZrOPrimPeriodic) {
+  auto prim = std::make_shared<xtal::BasicStructure const>(test::ZrO_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  std::vector<double> max_length = {0, 0, 6.01, 4.01, 4.01};
+  auto orbits = clust::make_prim_periodic_orbits(
+      prim, rep, clust::dof_sites_filter(), max_length, {});
+  check_packed_rep(orbits, rep, false);
+}
+
+TEST(PackedUnitCellCoordSymGroupRepTest, FCCLocal) {
+  auto prim =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto factor_group_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  clust::IntegralCluster phenomenal(
+      {xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(0, 0, 1, 0)});
+  auto cluster_group = clust::make_cluster_group(
+      phenomenal, factor_group, prim->lattice().lat_column_mat(),
+      factor_group_rep);
+  auto rep =
+      sym_info::make_unitcellcoord_symgroup_rep(cluster_group->element, *prim);
+  std::vector<double> max_length = {0, 0, 4.01, 4.01};
+  std::vector<double> cutoff_radius = {0, 4.01, 4.01, 4.01};
+  auto orbits = clust::make_local_orbits(prim, rep, clust::dof_sites_filter(),
+                                         max_length, {}, phenomenal,
+                                         cutoff_radius);
+  check_packed_rep(orbits, rep, true);
+}
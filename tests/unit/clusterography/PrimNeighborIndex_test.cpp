@@ -0,0 +1,155 @@
+#include "casm/configuration/clusterography/PrimNeighborIndex.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+#include "casm/configuration/clusterography/ClusterSpecs.hh"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/Coordinate.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Sites accepted by site_filter within radius of every site in cluster,
+/// found by checking every site in a large box
+std::vector<xtal::UnitCellCoord> brute_force_sites_within_all(
+    xtal::BasicStructure const &prim, clust::IntegralCluster const &cluster,
+    double radius, clust::SiteFilterFunction site_filter, int dim) {
+  std::vector<xtal::UnitCellCoord> result;
+  for (int i = -dim; i <= dim; ++i) {
+    for (int j = -dim; j <= dim; ++j) {
+      for (int k = -dim; k <= dim; ++k) {
+        for (Index b = 0; b < prim.basis().size(); ++b) {
+          if (!site_filter(prim.basis()[b])) {
+            continue;
+          }
+          xtal::UnitCellCoord site(b, i, j, k);
+          bool is_within_all = true;
+          for (auto const &cluster_site : cluster) {
+            if (!(site.coordinate(prim).dist(cluster_site.coordinate(prim)) <
+                  radius)) {
+              is_within_all = false;
+            }
+          }
+          if (is_within_all) {
+            result.push_back(site);
+          }
+        }
+      }
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+}  // namespace
+
+TEST(PrimNeighborIndexTest, FCCBinary) {
+  xtal::BasicStructure prim = test::FCC_binary_prim();
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  clust::PrimNeighborIndex neighbor_index(prim, 6.0, site_filter);
+  EXPECT_EQ(neighbor_index.n_sublattices(), 1);
+
+  // FCC, a = 4.0: 1 + 12 + 6 + 24 sites within 5.0
+  xtal::UnitCellCoord origin(0, 0, 0, 0);
+  EXPECT_EQ(neighbor_index.sites_within(origin, 2.0).size(), 1);
+  EXPECT_EQ(neighbor_index.sites_within(origin, 3.0).size(), 13);
+  EXPECT_EQ(neighbor_index.sites_within(origin, 4.5).size(), 19);
+  EXPECT_EQ(neighbor_index.sites_within(origin, 5.0).size(), 43);
+
+  // neighbors are sorted by distance
+  auto const &neighbors = neighbor_index.neighbors(0);
+  for (Index i = 1; i < neighbors.size(); ++i) {
+    EXPECT_TRUE(neighbors[i - 1].distance <= neighbors[i].distance);
+  }
+
+  // translation
+  xtal::UnitCellCoord site(0, 1, -2, 3);
+  auto translated = neighbor_index.sites_within(site, 5.0);
+  auto expected = neighbor_index.sites_within(origin, 5.0);
+  for (auto &s : expected) {
+    s = s + site.unitcell();
+  }
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(translated, expected);
+
+  // distance
+  auto d = neighbor_index.distance(site, xtal::UnitCellCoord(0, 2, -2, 3));
+  ASSERT_TRUE(d.has_value());
+  EXPECT_NEAR(*d, 2.0 * std::sqrt(2.0), 1e-10);
+  EXPECT_FALSE(neighbor_index.distance(site, xtal::UnitCellCoord(0, 9, 9, 9))
+                   .has_value());
+
+  // radius greater than max_radius
+  EXPECT_THROW(neighbor_index.sites_within(origin, 6.5), std::runtime_error);
+}
+
+TEST(PrimNeighborIndexTest, ZrOSitesWithinAll) {
+  xtal::BasicStructure prim = test::ZrO_prim();
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  clust::PrimNeighborIndex neighbor_index(prim, 6.0, site_filter);
+
+  std::vector<clust::IntegralCluster> clusters = {
+      clust::IntegralCluster({xtal::UnitCellCoord(2, 0, 0, 0)}),
+      clust::IntegralCluster(
+          {xtal::UnitCellCoord(2, 0, 0, 0), xtal::UnitCellCoord(3, 0, 0, 0)}),
+      clust::IntegralCluster({xtal::UnitCellCoord(2, 0, 0, 0),
+                              xtal::UnitCellCoord(3, 1, 0, 0),
+                              xtal::UnitCellCoord(2, 0, -1, 1)})};
+  for (auto const &cluster : clusters) {
+    for (double radius : {3.0, 4.5, 6.0}) {
+      EXPECT_EQ(neighbor_index.sites_within_all(cluster, radius),
+                brute_force_sites_within_all(prim, cluster, radius,
+                                             site_filter, 6));
+    }
+  }
+}
+
+TEST(PrimNeighborIndexTest, MaxLengthNeighborhood) {
+  xtal::BasicStructure prim = test::ZrO_prim();
+  clust::SiteFilterFunction site_filter = clust::all_sites_filter;
+  std::vector<xtal::UnitCellCoord> result =
+      clust::max_length_neighborhood(5.17)(prim, site_filter);
+
+  // sites within 5.17 of any site in the origin unit cell
+  std::set<xtal::UnitCellCoord> expected;
+  for (Index b = 0; b < prim.basis().size(); ++b) {
+    clust::IntegralCluster cluster({xtal::UnitCellCoord(b, 0, 0, 0)});
+    for (auto const &site :
+         brute_force_sites_within_all(prim, cluster, 5.17, site_filter, 6)) {
+      expected.insert(site);
+    }
+  }
+  EXPECT_EQ(result,
+            std::vector<xtal::UnitCellCoord>(expected.begin(), expected.end()));
+}
+
+TEST(PrimNeighborIndexTest, SiteFilterMask) {
+  xtal::BasicStructure prim = test::ZrO_prim();
+
+  // ZrO: Zr sites have no DoF, O sites have occupation DoF
+  EXPECT_EQ(clust::make_site_filter_mask(prim, clust::dof_sites_filter()),
+            clust::SiteFilterMask({false, false, true, true}));
+  EXPECT_EQ(clust::make_site_filter_mask(prim, clust::all_sites_filter),
+            clust::SiteFilterMask({true, true, true, true}));
+
+  // constructing from a mask or a function gives the same neighbors
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  clust::PrimNeighborIndex from_function(prim, 6.0, site_filter);
+  clust::PrimNeighborIndex from_mask(
+      prim, 6.0, clust::make_site_filter_mask(prim, site_filter));
+  for (Index b = 0; b < prim.basis().size(); ++b) {
+    clust::IntegralCluster cluster({xtal::UnitCellCoord(b, 0, 0, 0)});
+    EXPECT_EQ(from_mask.sites_within_all(cluster, 6.0),
+              from_function.sites_within_all(cluster, 6.0));
+  }
+
+  // mask size must match the number of sublattices
+  EXPECT_THROW(clust::PrimNeighborIndex(prim, 6.0, clust::SiteFilterMask(2)),
+               std::runtime_error);
+}
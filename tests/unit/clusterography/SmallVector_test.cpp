@@ -0,0 +1,120 @@
+#include "casm/configuration/clusterography/SmallVector.hh"
+
+#include <memory>
+#include <string>
+
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "gtest/gtest.h"
+
+using namespace CASM;
+
+TEST(SmallVectorTest, InlineAndHeap) {
+  clust::SmallVector<int, 4> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.is_inline());
+  for (int i = 0; i < 4; ++i) {
+    v.push_back(i);
+  }
+  EXPECT_TRUE(v.is_inline());
+  v.push_back(4);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(std::vector<int>(v), std::vector<int>({0, 1, 2, 3, 4}));
+
+  // push_back of an element across a reallocation
+  clust::SmallVector<std::string, 2> s({"a", "b"});
+  s.push_back(s[0]);
+  EXPECT_EQ(std::vector<std::string>(s),
+            std::vector<std::string>({"a", "b", "a"}));
+}
+
+TEST(SmallVectorTest, CopyAndMove) {
+  for (int n : {2, 8}) {
+    clust::SmallVector<std::string, 4> v;
+    for (int i = 0; i < n; ++i) {
+      v.push_back(std::to_string(i));
+    }
+    clust::SmallVector<std::string, 4> copy(v);
+    EXPECT_EQ(copy, v);
+
+    clust::SmallVector<std::string, 4> moved(std::move(copy));
+    EXPECT_EQ(moved, v);
+    EXPECT_TRUE(copy.empty());
+
+    clust::SmallVector<std::string, 4> assigned({"x"});
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned, v);
+
+    assigned = v;
+    EXPECT_EQ(assigned, v);
+  }
+
+  // move-only elements
+  clust::SmallVector<std::unique_ptr<int>, 2> p;
+  for (int i = 0; i < 3; ++i) {
+    p.emplace_back(new int(i));
+  }
+  clust::SmallVector<std::unique_ptr<int>, 2> q(std::move(p));
+  EXPECT_EQ(q.size(), 3);
+  EXPECT_EQ(*q[2], 2);
+}
+
+TEST(SmallVectorTest, InsertEraseResize) {
+  clust::SmallVector<int, 4> v({0, 1, 2, 3, 4, 5});
+  std::vector<int> check({0, 1, 2, 3, 4, 5});
+
+  v.erase(v.begin() + 1);
+  check.erase(check.begin() + 1);
+  EXPECT_EQ(std::vector<int>(v), check);
+
+  v.erase(v.begin(), v.begin() + 2);
+  check.erase(check.begin(), check.begin() + 2);
+  EXPECT_EQ(std::vector<int>(v), check);
+
+  v.insert(v.begin() + 1, 10);
+  check.insert(check.begin() + 1, 10);
+  EXPECT_EQ(std::vector<int>(v), check);
+
+  v.resize(6);
+  check.resize(6);
+  EXPECT_EQ(std::vector<int>(v), check);
+
+  v.pop_back();
+  check.pop_back();
+  EXPECT_EQ(std::vector<int>(v), check);
+  EXPECT_EQ(v.front(), check.front());
+  EXPECT_EQ(v.back(), check.back());
+  EXPECT_THROW(v.at(v.size()), std::out_of_range);
+}
+
+TEST(SmallVectorTest, Compare) {
+  std::vector<std::vector<int>> values(
+      {{}, {0}, {0, 1}, {1}, {0, 1, 2, 3, 4, 5}, {0, 1, 2, 3, 4, 6}});
+  for (auto const &a : values) {
+    for (auto const &b : values) {
+      clust::SmallVector<int, 4> A(a);
+      clust::SmallVector<int, 4> B(b);
+      EXPECT_EQ(A == B, a == b);
+      EXPECT_EQ(A != B, a != b);
+      EXPECT_EQ(A < B, a < b);
+      EXPECT_EQ(A > B, a > b);
+      EXPECT_EQ(A <= B, a <= b);
+      EXPECT_EQ(A >= B, a >= b);
+    }
+  }
+}
+
+TEST(SmallVectorTest, IntegralClusterElements) {
+  clust::IntegralCluster cluster(
+      {xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(0, 1, 0, 0),
+       xtal::UnitCellCoord(0, 0, 1, 0)});
+  EXPECT_TRUE(cluster.elements().is_inline());
+
+  clust::IntegralCluster copy(cluster);
+  EXPECT_TRUE(copy.elements().is_inline());
+  EXPECT_EQ(copy, cluster);
+
+  copy += xtal::UnitCell(1, 0, 0);
+  EXPECT_TRUE(cluster < copy);
+  EXPECT_EQ(copy.element(0), xtal::UnitCellCoord(0, 1, 0, 0));
+}
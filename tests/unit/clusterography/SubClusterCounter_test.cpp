@@ -0,0 +1,97 @@
+#include "casm/configuration/clusterography/SubClusterCounter.hh"
+
+#include "casm/configuration/clusterography/ClusterSpecs.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+// test FCC_binary_prim
+class SubClusterCounterTest : public testing::Test {
+ protected:
+  std::shared_ptr<xtal::BasicStructure const> prim;
+  std::vector<xtal::UnitCellCoordRep> unitcellcoord_symgroup_rep;
+  std::vector<std::set<clust::IntegralCluster>> orbits;
+
+  SubClusterCounterTest() {
+    prim =
+        std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+    auto factor_group = sym_info::make_factor_group(*prim);
+    unitcellcoord_symgroup_rep =
+        sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+    clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+    std::vector<double> max_length = {0, 0, 4.01, 4.01};
+    std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+
+    orbits =
+        make_prim_periodic_orbits(prim, unitcellcoord_symgroup_rep, site_filter,
+                                  max_length, custom_generators);
+  }
+};
+
+TEST_F(SubClusterCounterTest, MaskCounterTest) {
+  clust::IntegralCluster cluster({xtal::UnitCellCoord(0, 0, 0, 0),
+                                  xtal::UnitCellCoord(0, 1, 0, 0),
+                                  xtal::UnitCellCoord(0, 0, 1, 0)});
+  clust::SubClusterCounter counter(cluster);
+  clust::SubClusterMaskCounter mask_counter(cluster);
+  clust::SubClusterMask expected_mask = 0;
+  while (counter.valid()) {
+    ASSERT_TRUE(mask_counter.valid());
+    EXPECT_EQ(mask_counter.mask(), expected_mask);
+    EXPECT_EQ(mask_counter.materialize(), counter.value());
+    EXPECT_EQ(clust::make_subcluster(cluster, mask_counter.mask()),
+              counter.value());
+    counter.next();
+    mask_counter.next();
+    ++expected_mask;
+  }
+  EXPECT_FALSE(mask_counter.valid());
+  EXPECT_EQ(expected_mask, 8);
+
+  // null cluster
+  clust::SubClusterMaskCounter null_counter{clust::IntegralCluster()};
+  ASSERT_TRUE(null_counter.valid());
+  EXPECT_EQ(null_counter.mask(), 0);
+  EXPECT_EQ(null_counter.materialize().size(), 0);
+  null_counter.next();
+  EXPECT_FALSE(null_counter.valid());
+}
+
+TEST_F(SubClusterCounterTest, OrbitIndexTest) {
+  clust::SubClusterOrbitIndex orbit_index(orbits, true);
+  for (Index i = 0; i < orbits.size(); ++i) {
+    clust::IntegralCluster const &prototype = *orbits[i].begin();
+    EXPECT_EQ(orbit_index.orbit_index(prototype), i);
+
+    // translated and unsorted clusters are found too
+    clust::IntegralCluster translated = prototype;
+    translated += xtal::UnitCell(1, -2, 3);
+    std::reverse(translated.elements().begin(), translated.elements().end());
+    EXPECT_EQ(orbit_index.orbit_index(translated), i);
+
+    std::vector<Index> orbit_indices =
+        orbit_index.subcluster_orbit_indices(translated);
+    ASSERT_EQ(orbit_indices.size(), Index(1) << prototype.size());
+    for (clust::SubClusterMaskCounter counter(translated); counter.valid();
+         counter.next()) {
+      clust::IntegralCluster const &subcluster = counter.materialize();
+      Index j = orbit_indices[counter.mask()];
+      EXPECT_EQ(j, orbit_index.orbit_index(subcluster));
+      ASSERT_GE(j, 0);
+      EXPECT_EQ(make_prim_periodic_orbit(subcluster,
+                                         unitcellcoord_symgroup_rep),
+                orbits[j]);
+    }
+  }
+
+  // a cluster that is not in any orbit
+  clust::IntegralCluster far({xtal::UnitCellCoord(0, 0, 0, 0),
+                              xtal::UnitCellCoord(0, 10, 0, 0)});
+  EXPECT_EQ(orbit_index.orbit_index(far), -1);
+}
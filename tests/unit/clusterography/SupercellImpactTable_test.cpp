@@ -0,0 +1,137 @@
+#include "casm/configuration/clusterography/SupercellImpactTable.hh"
+
+#include "casm/configuration/clusterography/ClusterSpecs.hh"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/impact_neighborhood.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+std::set<Index> to_indices(
+    std::set<xtal::UnitCellCoord> const &neighborhood,
+    xtal::UnitCellCoordIndexConverter const &converter) {
+  std::set<Index> result;
+  for (auto const &site : neighborhood) {
+    result.insert(converter(site));
+  }
+  return result;
+}
+
+}  // namespace
+
+// test FCC_binary_prim
+class SupercellImpactTableTest : public testing::Test {
+ protected:
+  std::shared_ptr<xtal::BasicStructure const> prim;
+  std::vector<xtal::UnitCellCoordRep> unitcellcoord_symgroup_rep;
+  std::vector<std::set<clust::IntegralCluster>> orbits;
+  Eigen::Matrix3l T;
+
+  SupercellImpactTableTest() {
+    prim =
+        std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+    auto factor_group = sym_info::make_factor_group(*prim);
+    unitcellcoord_symgroup_rep =
+        sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+    clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+    std::vector<double> max_length = {0, 0, 4.01, 4.01};
+    std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+
+    orbits =
+        make_prim_periodic_orbits(prim, unitcellcoord_symgroup_rep, site_filter,
+                                  max_length, custom_generators);
+    T = 4 * Eigen::Matrix3l::Identity();
+  }
+};
+
+TEST_F(SupercellImpactTableTest, FlowerTest) {
+  xtal::UnitCellCoordIndexConverter converter(T, prim->basis().size());
+  clust::SupercellImpactTable table =
+      clust::make_flower_impact_table(orbits, converter);
+  ASSERT_EQ(table.n_rows(), converter.total_sites());
+  EXPECT_EQ(table.row_offset.back(), table.sites.size());
+
+  for (Index l = 0; l < table.n_rows(); ++l) {
+    // same as converting the flower neighborhood of site l
+    clust::IntegralCluster phenomenal({converter(l)});
+    std::set<xtal::UnitCellCoord> neighborhood;
+    add_to_flower_neighborhood(phenomenal, neighborhood, orbits);
+    std::set<Index> expected = to_indices(neighborhood, converter);
+    std::vector<Index> row(table.row_begin(l), table.row_end(l));
+    EXPECT_EQ(row, std::vector<Index>(expected.begin(), expected.end()));
+
+    // 1 point + 12 1NN + 6 2NN = 19
+    EXPECT_EQ(table.row_size(l), 19);
+
+    // impact is symmetric
+    for (Index j : row) {
+      EXPECT_TRUE(std::binary_search(table.row_begin(j), table.row_end(j), l));
+    }
+  }
+}
+
+TEST_F(SupercellImpactTableTest, FlowerSmallSupercellTest) {
+  // periodic images coincide, so rows are shorter, but still contain no
+  // duplicates
+  Eigen::Matrix3l T_small = Eigen::Matrix3l::Identity();
+  xtal::UnitCellCoordIndexConverter converter(T_small, prim->basis().size());
+  clust::SupercellImpactTable table =
+      clust::make_flower_impact_table(orbits, converter);
+  ASSERT_EQ(table.n_rows(), 1);
+  ASSERT_EQ(table.row_size(0), 1);
+  EXPECT_EQ(*table.row_begin(0), 0);
+}
+
+TEST_F(SupercellImpactTableTest, LocalTest) {
+  // phenomenal cluster & cluster group
+  auto factor_group = sym_info::make_factor_group(*prim);
+  clust::IntegralCluster phenomenal(
+      {xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(0, 1, 0, 0)});
+  auto cluster_group =
+      make_cluster_group(phenomenal, factor_group,
+                         prim->lattice().lat_column_mat(),
+                         unitcellcoord_symgroup_rep);
+  auto cluster_group_rep = sym_info::make_unitcellcoord_symgroup_rep(
+      cluster_group->element, *prim);
+
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  std::vector<double> max_length = {0, 0, 4.01, 4.01};
+  std::vector<double> cutoff_radius = {0, 4.01, 4.01, 4.01};
+  bool include_phenomenal_sites = false;
+  std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+  std::vector<std::set<clust::IntegralCluster>> local_orbits =
+      make_local_orbits(prim, cluster_group_rep, site_filter, max_length,
+                        custom_generators, phenomenal, cutoff_radius,
+                        include_phenomenal_sites);
+
+  xtal::UnitCellCoordIndexConverter converter(T, prim->basis().size());
+  xtal::UnitCellIndexConverter unitcell_converter(T);
+  clust::SupercellImpactTable table =
+      clust::make_local_impact_table(local_orbits, converter,
+                                     unitcell_converter);
+  ASSERT_EQ(table.n_rows(), unitcell_converter.total_sites());
+
+  std::set<xtal::UnitCellCoord> neighborhood;
+  add_to_local_neighborhood(neighborhood, local_orbits);
+  for (Index i = 0; i < table.n_rows(); ++i) {
+    std::set<xtal::UnitCellCoord> translated;
+    for (auto const &site : neighborhood) {
+      translated.insert(site + unitcell_converter(i));
+    }
+    std::set<Index> expected = to_indices(translated, converter);
+    std::vector<Index> row(table.row_begin(i), table.row_end(i));
+    EXPECT_EQ(row, std::vector<Index>(expected.begin(), expected.end()));
+
+    // 19 + 19 - 10 overlap - 2 (does not include phenomenal sites)
+    EXPECT_EQ(table.row_size(i), 26);
+  }
+}
@@ -1,12 +1,14 @@
 #include "casm/casm_io/container/json_io.hh"
 #include "casm/casm_io/json/jsonParser.hh"
 #include "casm/configuration/clusterography/ClusterSpecs.hh"
+#include "casm/configuration/clusterography/OrbitsAsIndices.hh"
 #include "casm/configuration/clusterography/io/json/IntegralCluster_json_io.hh"
 #include "casm/configuration/clusterography/orbits.hh"
 #include "casm/configuration/group/Group.hh"
 #include "casm/configuration/sym_info/factor_group.hh"
 #include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
 #include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
 #include "casm/crystallography/UnitCellCoordRep.hh"
 #include "gtest/gtest.h"
 #include "teststructures.hh"
@@ -73,6 +75,14 @@ TEST(LocalOrbitTest, Test1) {
   for (auto const &orbit : orbits) {
     EXPECT_EQ(orbit.size(), *orbit_size_it++);
   }
+
+  // orbits do not depend on the memory resource
+  std::pmr::unsynchronized_pool_resource pool;
+  auto pool_orbits = make_local_orbits(
+      prim, unitcellcoord_symgroup_rep, site_filter, max_length,
+      custom_generators, phenomenal, cutoff_radius, include_phenomenal_sites,
+      &pool);
+  EXPECT_EQ(pool_orbits, orbits);
 }
 
 // test FCC_binary_prim - phenomenal == 1NN pair cluster
@@ -122,3 +132,74 @@ TEST(LocalOrbitTest, Test2) {
     EXPECT_EQ(orbit.size(), *orbit_size_it++);
   }
 }
+
+// test FCC_binary_prim - local orbits of equivalent 1NN pairs as indices
+TEST(LocalOrbitTest, FlatLocalOrbitsAsIndices) {
+  auto prim =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto factor_group_unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  clust::IntegralCluster phenomenal(
+      {xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(0, 0, 1, 0)});
+  auto cluster_group = make_cluster_group(
+      phenomenal, factor_group, prim->lattice().lat_column_mat(),
+      factor_group_unitcellcoord_symgroup_rep);
+  auto unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(cluster_group->element, *prim);
+  std::vector<double> max_length = {0, 0, 2.01};
+  std::vector<double> cutoff_radius = {0, 2.01, 2.01};
+  auto local_orbits = make_local_orbits(
+      prim, unitcellcoord_symgroup_rep, clust::dof_sites_filter(), max_length,
+      {}, phenomenal, cutoff_radius, false);
+
+  Eigen::Matrix3l T;
+  T << 4, 0, 0, 0, 4, 0, 0, 0, 4;
+  xtal::UnitCellCoordIndexConverter site_converter(T, prim->basis().size());
+  xtal::UnitCellIndexConverter unitcell_converter(T);
+  std::vector<Index> op_indices = {0, 5};
+  std::vector<xtal::UnitCell> translations = {xtal::UnitCell(0, 0, 0),
+                                              xtal::UnitCell(1, 0, 0)};
+  clust::LocalOrbitsAsIndices table = clust::make_flat_local_orbits_as_indices(
+      local_orbits, factor_group_unitcellcoord_symgroup_rep, op_indices,
+      translations, site_converter, unitcell_converter, 2);
+
+  EXPECT_EQ(table.n_equivalents, 2);
+  EXPECT_EQ(table.n_translations, 64);
+  EXPECT_EQ(table.n_orbits(), local_orbits.size());
+  Index n_cluster_sites = 0;
+  for (auto const &orbit : local_orbits) {
+    for (auto const &cluster : orbit) {
+      n_cluster_sites += cluster.size();
+    }
+  }
+  EXPECT_EQ(table.n_cluster_sites(), n_cluster_sites);
+  EXPECT_EQ(table.sites.size(), 2 * 64 * n_cluster_sites);
+
+  for (Index e = 0; e < 2; ++e) {
+    auto equivalent_orbits = clust::make_equivalent_local_orbits(
+        local_orbits, factor_group_unitcellcoord_symgroup_rep[op_indices[e]],
+        translations[e]);
+    for (Index l : {Index(0), Index(21)}) {
+      xtal::UnitCell translation = unitcell_converter(l);
+      std::int32_t const *row = table.row(e, l);
+      for (Index i = 0; i < table.n_orbits(); ++i) {
+        std::set<std::vector<Index>> expected;
+        for (auto const &cluster : equivalent_orbits[i]) {
+          std::vector<Index> sites;
+          for (auto const &site : cluster) {
+            sites.push_back(site_converter(site + translation));
+          }
+          expected.insert(sites);
+        }
+        std::set<std::vector<Index>> found;
+        for (Index j = table.orbit_offset[i]; j < table.orbit_offset[i + 1];
+             ++j) {
+          found.emplace(row + table.cluster_offset[j],
+                        row + table.cluster_offset[j + 1]);
+        }
+        EXPECT_EQ(found, expected);
+      }
+    }
+  }
+}
@@ -0,0 +1,107 @@
+#include "casm/configuration/clusterography/occ_counter.hh"
+
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/group/Group.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/configuration/sym_info/occ_sym_info.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Brute force: canonicalize every occupation from make_occ_counter
+std::map<std::vector<int>, Index> make_expected(
+    clust::IntegralCluster const &cluster, xtal::BasicStructure const &prim,
+    std::vector<xtal::SymOp> const &cluster_group_elements) {
+  auto unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(cluster_group_elements, prim);
+  sym_info::OccSymInfo occ_sym_info(cluster_group_elements, prim);
+
+  std::map<std::vector<int>, std::set<std::vector<int>>> orbits;
+  auto counter = clust::make_occ_counter(cluster, prim);
+  while (counter.valid()) {
+    std::vector<int> const &occ = counter();
+    std::vector<int> greatest = occ;
+    for (Index g = 0; g < cluster_group_elements.size(); ++g) {
+      std::vector<int> image(occ.size());
+      for (Index i = 0; i < cluster.size(); ++i) {
+        xtal::UnitCellCoord site_after =
+            copy_apply(unitcellcoord_symgroup_rep[g], cluster[i]);
+        Index j = std::distance(
+            cluster.begin(),
+            std::find(cluster.begin(), cluster.end(), site_after));
+        Index b = cluster[i].sublattice();
+        image[j] = occ_sym_info.occ_symgroup_rep[g][b][occ[i]];
+      }
+      greatest = std::max(greatest, image);
+    }
+    orbits[greatest].insert(occ);
+    ++counter;
+  }
+  std::map<std::vector<int>, Index> expected;
+  for (auto const &pair : orbits) {
+    expected.emplace(pair.first, pair.second.size());
+  }
+  return expected;
+}
+
+}  // namespace
+
+class DistinctClusterOccupationsTest : public testing::Test {
+ protected:
+  void check(xtal::BasicStructure const &_prim,
+             clust::IntegralCluster const &cluster, Index expected_size) {
+    auto prim = std::make_shared<xtal::BasicStructure const>(_prim);
+    auto factor_group = sym_info::make_factor_group(*prim);
+    auto unitcellcoord_symgroup_rep =
+        sym_info::make_unitcellcoord_symgroup_rep(factor_group->element,
+                                                  *prim);
+    auto cluster_group =
+        make_cluster_group(cluster, factor_group,
+                           prim->lattice().lat_column_mat(),
+                           unitcellcoord_symgroup_rep);
+
+    std::vector<clust::DistinctClusterOccupation> distinct =
+        clust::make_distinct_cluster_occupations(cluster, *prim,
+                                                 cluster_group->element);
+    std::map<std::vector<int>, Index> expected =
+        make_expected(cluster, *prim, cluster_group->element);
+
+    ASSERT_EQ(distinct.size(), expected.size());
+    EXPECT_EQ(distinct.size(), expected_size);
+    auto expected_it = expected.begin();
+    for (auto const &value : distinct) {
+      EXPECT_EQ(value.occupation, expected_it->first);
+      EXPECT_EQ(value.multiplicity, expected_it->second);
+      ++expected_it;
+    }
+  }
+};
+
+TEST_F(DistinctClusterOccupationsTest, FCCTernaryPair) {
+  // 1NN pair: AA, BB, CC, AB, AC, BC
+  clust::IntegralCluster cluster(
+      {xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(0, 1, 0, 0)});
+  check(test::FCC_ternary_prim(), cluster, 6);
+}
+
+TEST_F(DistinctClusterOccupationsTest, FCCTernaryTriplet) {
+  // 1NN equilateral triplet: multisets of size 3 from 3 occupants
+  clust::IntegralCluster cluster({xtal::UnitCellCoord(0, 0, 0, 0),
+                                  xtal::UnitCellCoord(0, 1, 0, 0),
+                                  xtal::UnitCellCoord(0, 0, 1, 0)});
+  check(test::FCC_ternary_prim(), cluster, 10);
+}
+
+TEST_F(DistinctClusterOccupationsTest, ZrOPair) {
+  // O-O pair, with Va/O on each site
+  clust::IntegralCluster cluster(
+      {xtal::UnitCellCoord(2, 0, 0, 0), xtal::UnitCellCoord(3, 0, 0, 0)});
+  check(test::ZrO_prim(), cluster, 3);
+}
@@ -0,0 +1,109 @@
+#include <sstream>
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/clusterography/ClusterSpecs.hh"
+#include "casm/configuration/clusterography/io/json/IntegralCluster_json_io.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/io/json/JsonArrayWriter.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/UnitCellCoordRep.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(JsonArrayWriterTest, Test1) {
+  for (bool compact : {true, false}) {
+    std::stringstream ss;
+    JsonStreamOptions options;
+    options.compact = compact;
+    options.precision = 3;
+    {
+      JsonArrayWriter writer(ss, options);
+      for (Index i = 0; i < 3; ++i) {
+        jsonParser json;
+        json["index"] = i;
+        json["value"] = 1.0 / 3.0;
+        writer.write(std::move(json));
+      }
+      EXPECT_EQ(writer.size(), 3);
+    }
+    jsonParser json = jsonParser::parse(ss.str());
+    ASSERT_TRUE(json.is_array());
+    ASSERT_EQ(json.size(), 3);
+    for (Index i = 0; i < 3; ++i) {
+      EXPECT_EQ(json[i]["index"].get<Index>(), i);
+      EXPECT_EQ(json[i]["value"].get<double>(), 0.333);
+    }
+  }
+
+  std::stringstream ss;
+  { JsonArrayWriter writer(ss); }
+  EXPECT_TRUE(jsonParser::parse(ss.str()).is_array());
+  EXPECT_EQ(jsonParser::parse(ss.str()).size(), 0);
+}
+
+TEST(ClusterOrbitsJsonIOTest, Test1) {
+  auto prim =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  std::vector<double> max_length = {0, 0, 4.01, 4.01};
+  std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+  auto orbits =
+      make_prim_periodic_orbits(prim, unitcellcoord_symgroup_rep, site_filter,
+                                max_length, custom_generators);
+
+  // all orbit elements, with equivalence map
+  {
+    clust::ClusterOrbitOutputOptions options;
+    options.include_equivalence_map = true;
+    JsonStreamOptions stream_options;
+    stream_options.compact = true;
+    std::stringstream ss;
+    write_cluster_orbits_json(ss, orbits, *prim, std::nullopt,
+                              &unitcellcoord_symgroup_rep, options,
+                              stream_options);
+    jsonParser json = jsonParser::parse(ss.str());
+    ASSERT_EQ(json.size(), orbits.size());
+    for (Index i = 0; i < orbits.size(); ++i) {
+      jsonParser expected;
+      to_json(orbits[i], expected, *prim, std::nullopt,
+              &unitcellcoord_symgroup_rep, options);
+      EXPECT_EQ(json[i]["linear_orbit_index"].get<Index>(), i);
+      EXPECT_EQ(json[i]["mult"].get<Index>(), orbits[i].size());
+      EXPECT_EQ(json[i]["elements"].size(), orbits[i].size());
+      EXPECT_EQ(json[i]["equivalence_map"].size(), orbits[i].size());
+      EXPECT_EQ(json[i]["elements"], expected["elements"]);
+    }
+  }
+
+  // prototypes only
+  {
+    clust::ClusterOrbitOutputOptions options;
+    options.include_elements = false;
+    std::stringstream ss;
+    write_cluster_orbits_json(ss, orbits, *prim, std::nullopt, nullptr,
+                              options);
+    jsonParser json = jsonParser::parse(ss.str());
+    ASSERT_EQ(json.size(), orbits.size());
+    for (Index i = 0; i < orbits.size(); ++i) {
+      EXPECT_TRUE(json[i].contains("prototype"));
+      EXPECT_FALSE(json[i].contains("elements"));
+    }
+  }
+
+  // equivalence map requires the symmetry representation
+  {
+    clust::ClusterOrbitOutputOptions options;
+    options.include_equivalence_map = true;
+    std::stringstream ss;
+    EXPECT_THROW(write_cluster_orbits_json(ss, orbits, *prim, std::nullopt,
+                                           nullptr, options),
+                 std::runtime_error);
+  }
+}
@@ -240,3 +240,163 @@ TEST(PrimPeriodicOrbitTest, Test4) {
     EXPECT_EQ(orbit.begin()->size(), *cluster_size_it++);
   }
 }
+
+// test that orbits do not depend on the number of threads (ZrO)
+TEST(PrimPeriodicOrbitTest, Test5) {
+  auto prim = std::make_shared<xtal::BasicStructure const>(test::ZrO_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  std::vector<double> max_length = {0, 0, 5.17, 5.17, 5.17};
+  std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+
+  auto serial_orbits =
+      make_prim_periodic_orbits(prim, unitcellcoord_symgroup_rep, site_filter,
+                                max_length, custom_generators);
+  for (Index n_threads : {2, 3, 8, 0}) {
+    auto orbits =
+        make_prim_periodic_orbits(prim, unitcellcoord_symgroup_rep, site_filter,
+                                  max_length, custom_generators, n_threads);
+    EXPECT_EQ(orbits, serial_orbits);
+  }
+}
+
+// test that orbits do not depend on the memory resource (ZrO)
+TEST(PrimPeriodicOrbitTest, MemoryResource) {
+  auto prim = std::make_shared<xtal::BasicStructure const>(test::ZrO_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  std::vector<double> max_length = {0, 0, 5.17, 5.17};
+  std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+
+  auto expected =
+      make_prim_periodic_orbits(prim, unitcellcoord_symgroup_rep, site_filter,
+                                max_length, custom_generators);
+
+  std::pmr::synchronized_pool_resource pool;
+  for (Index n_threads : {1, 4}) {
+    auto orbits = make_prim_periodic_orbits(
+        prim, unitcellcoord_symgroup_rep, site_filter, max_length,
+        custom_generators, n_threads, &pool);
+    EXPECT_EQ(orbits, expected);
+  }
+}
+
+// test that branch by branch generation matches make_prim_periodic_orbits
+TEST(PrimPeriodicOrbitTest, PrimPeriodicOrbitGenerator) {
+  auto prim = std::make_shared<xtal::BasicStructure const>(test::ZrO_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+  auto _expected = [&](std::vector<double> const &max_length) {
+    return make_prim_periodic_orbits(prim, unitcellcoord_symgroup_rep,
+                                     site_filter, max_length,
+                                     custom_generators);
+  };
+
+  for (Index n_threads : {1, 4}) {
+    clust::PrimPeriodicOrbitGenerator generator(
+        prim, unitcellcoord_symgroup_rep, site_filter, n_threads);
+    EXPECT_EQ(generator.n_branches(), 1);
+    EXPECT_EQ(generator.orbits(), _expected({0}));
+
+    generator.add_branch();
+    EXPECT_EQ(generator.n_branches(), 2);
+    EXPECT_EQ(generator.orbits(), _expected({0, 0}));
+    EXPECT_THROW(generator.extend_cutoff(4.0), std::runtime_error);
+
+    auto const &pairs = generator.add_branch(4.0);
+    Index n_pairs = pairs.size();
+    EXPECT_EQ(generator.orbits(), _expected({0, 0, 4.0}));
+
+    // extending the cutoff keeps, and adds to, the existing orbits
+    generator.extend_cutoff(5.17);
+    EXPECT_GT(generator.branch_orbits(2).size(), n_pairs);
+    EXPECT_EQ(generator.orbits(), _expected({0, 0, 5.17}));
+    EXPECT_THROW(generator.extend_cutoff(4.0), std::runtime_error);
+
+    generator.add_branch(5.17);
+    std::vector<double> max_length = {0, 0, 5.17, 5.17};
+    EXPECT_EQ(generator.max_length(), max_length);
+    EXPECT_EQ(generator.orbits(), _expected(max_length));
+    for (auto const &orbit : generator.branch_orbits(3)) {
+      EXPECT_EQ(orbit.begin()->size(), 3);
+    }
+    EXPECT_THROW(generator.branch_orbits(4), std::runtime_error);
+  }
+}
+
+TEST(PrimPeriodicOrbitTest, ClusterGroups) {
+  auto prim = std::make_shared<xtal::BasicStructure const>(test::ZrO_prim());
+  auto factor_group = sym_info::make_factor_group(*prim);
+  auto unitcellcoord_symgroup_rep =
+      sym_info::make_unitcellcoord_symgroup_rep(factor_group->element, *prim);
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  std::vector<double> max_length = {0, 0, 5.17, 5.17};
+  std::vector<clust::IntegralClusterOrbitGenerator> custom_generators = {};
+  Eigen::Matrix3d const &lat_column_mat = prim->lattice().lat_column_mat();
+
+  auto orbits =
+      make_prim_periodic_orbits(prim, unitcellcoord_symgroup_rep, site_filter,
+                                max_length, custom_generators);
+
+  // cluster groups, with and without conjugating the prototype cluster
+  // group, match cluster groups found directly
+  for (auto const &orbit : orbits) {
+    auto cluster_groups = make_cluster_groups(
+        orbit, factor_group, lat_column_mat, unitcellcoord_symgroup_rep);
+    auto conjugated_cluster_groups =
+        make_cluster_groups(orbit, factor_group, lat_column_mat,
+                            unitcellcoord_symgroup_rep, true);
+    ASSERT_EQ(cluster_groups.size(), orbit.size());
+    ASSERT_EQ(conjugated_cluster_groups.size(), orbit.size());
+    cluster_groups.insert(cluster_groups.end(),
+                          conjugated_cluster_groups.begin(),
+                          conjugated_cluster_groups.end());
+    auto orbit_it = orbit.begin();
+    Index n = 0;
+    for (auto const &cluster_group : cluster_groups) {
+      if (n++ == orbit.size()) {
+        orbit_it = orbit.begin();
+      }
+      auto expected = make_cluster_group(*orbit_it, factor_group,
+                                         lat_column_mat,
+                                         unitcellcoord_symgroup_rep);
+      EXPECT_EQ(cluster_group->head_group_index, expected->head_group_index);
+      EXPECT_EQ(cluster_group->multiplication_table,
+                expected->multiplication_table);
+      ASSERT_EQ(cluster_group->element.size(), expected->element.size());
+      for (Index i = 0; i < expected->element.size(); ++i) {
+        EXPECT_TRUE(cluster_group->element[i].matrix.isApprox(
+            expected->element[i].matrix));
+        EXPECT_TRUE((cluster_group->element[i].translation -
+                     expected->element[i].translation)
+                        .isZero(1e-10));
+      }
+      ++orbit_it;
+    }
+  }
+
+  // result does not depend on the number of threads
+  auto serial = make_cluster_groups(orbits, factor_group, lat_column_mat,
+                                    unitcellcoord_symgroup_rep);
+  ASSERT_EQ(serial.size(), orbits.size());
+  for (Index n_threads : {2, 0}) {
+    auto parallel =
+        make_cluster_groups(orbits, factor_group, lat_column_mat,
+                            unitcellcoord_symgroup_rep, n_threads, true);
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (Index i = 0; i < serial.size(); ++i) {
+      ASSERT_EQ(parallel[i].size(), serial[i].size());
+      for (Index j = 0; j < serial[i].size(); ++j) {
+        EXPECT_EQ(parallel[i][j]->head_group_index,
+                  serial[i][j]->head_group_index);
+      }
+    }
+  }
+}
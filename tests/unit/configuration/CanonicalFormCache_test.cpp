@@ -0,0 +1,117 @@
+#include "casm/configuration/CanonicalFormCache.hh"
+
+#include "casm/configuration/canonical_form.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Check `make_canonical_form_info` and a CanonicalFormCache against the
+/// separate canonical form functions
+void check_canonical_form_info(config::Configuration const &configuration,
+                               config::CanonicalFormCache &cache) {
+  auto const &ops = cache.ops();
+  config::CanonicalFormInfo info =
+      make_canonical_form_info(configuration, ops.begin(), ops.end());
+
+  EXPECT_EQ(info.is_canonical,
+            is_canonical(configuration, ops.begin(), ops.end()));
+  EXPECT_EQ(ops[info.to_canonical_index],
+            to_canonical(configuration, ops.begin(), ops.end()));
+  std::vector<config::SupercellSymOp> subgroup =
+      make_invariant_subgroup(configuration, ops.begin(), ops.end());
+  ASSERT_EQ(info.invariant_subgroup_indices.size(), subgroup.size());
+  for (Index i = 0; i < Index(subgroup.size()); ++i) {
+    EXPECT_EQ(ops[info.invariant_subgroup_indices[i]], subgroup[i]);
+  }
+
+  EXPECT_EQ(cache.is_canonical(configuration), info.is_canonical);
+  EXPECT_EQ(cache.to_canonical(configuration),
+            ops[info.to_canonical_index]);
+  EXPECT_EQ(cache.make_invariant_subgroup(configuration), subgroup);
+  EXPECT_EQ(cache.make_canonical_form(configuration),
+            make_canonical_form(configuration, ops.begin(), ops.end()));
+  EXPECT_EQ(cache.make_equivalents(configuration),
+            make_equivalents(configuration, ops.begin(), ops.end()));
+}
+
+}  // namespace
+
+TEST(CanonicalFormCacheTest, Occupation) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::CanonicalFormCache cache(supercell);
+
+  config::Configuration configuration(supercell);
+  Eigen::VectorXi &occ = configuration.dof_values.occupation;
+  Index n_sites = occ.size();
+  for (Index count = 0; count < (Index(1) << n_sites); ++count) {
+    for (Index l = 0; l < n_sites; ++l) {
+      occ(l) = (count >> l) & 1;
+    }
+    check_canonical_form_info(configuration, cache);
+  }
+  // one pass per distinct configuration
+  EXPECT_EQ(cache.n_passes(), Index(1) << n_sites);
+  EXPECT_EQ(cache.size(), Index(1) << n_sites);
+
+  // modified values do not match the stale entry
+  occ.setZero();
+  EXPECT_TRUE(cache.is_canonical(configuration));
+  occ(1) = 1;
+  EXPECT_EQ(cache.is_canonical(configuration),
+            is_canonical(configuration, cache.ops().begin(),
+                         cache.ops().end()));
+  EXPECT_EQ(cache.n_passes(), Index(1) << n_sites);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(CanonicalFormCacheTest, ContinuousDoF) {
+  auto prim =
+      config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::CanonicalFormCache cache(supercell, 2);
+
+  config::Configuration configuration(supercell);
+  clexulator::ConfigDoFValues &dof_values = configuration.dof_values;
+
+  // only strain is non-zero
+  dof_values.global_dof_values.at("GLstrain")(2) = 0.01;
+  check_canonical_form_info(configuration, cache);
+
+  dof_values.occupation(2) = 1;
+  dof_values.local_dof_values.at("disp")(2, 2) = 1.0;
+  check_canonical_form_info(configuration, cache);
+
+  dof_values.occupation(3) = 1;
+  check_canonical_form_info(configuration, cache);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.n_passes(), 3);
+}
+
+TEST(CanonicalFormCacheTest, GlobalDoFOnly) {
+  auto prim = config::make_shared_prim(test::SimpleCubic_GLstrain_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::CanonicalFormCache cache(supercell);
+
+  config::Configuration configuration(supercell);
+  ASSERT_TRUE(config::is_global_dof_only_comparison(configuration));
+  Eigen::VectorXd &strain =
+      configuration.dof_values.global_dof_values.at("GLstrain");
+  check_canonical_form_info(configuration, cache);
+  strain(2) = 0.01;
+  check_canonical_form_info(configuration, cache);
+  strain(3) = 0.02;
+  check_canonical_form_info(configuration, cache);
+  EXPECT_EQ(cache.n_passes(), 3);
+}
@@ -0,0 +1,245 @@
+#include "casm/configuration/CanonicalFormEngine.hh"
+
+#include "casm/configuration/canonical_form.hh"
+#include "casm/crystallography/SymType.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Check CanonicalFormEngine against the canonical_form.hh functions
+void check_engine(config::CanonicalFormEngine const &engine,
+                  config::Configuration const &configuration) {
+  auto const &ops = engine.ops();
+  auto begin = ops.begin();
+  auto end = ops.end();
+
+  config::SupercellSymOp expected_to_canonical =
+      to_canonical(configuration, begin, end);
+  config::Configuration expected_canonical =
+      make_canonical_form(configuration, begin, end);
+  std::vector<config::SupercellSymOp> expected_invariant_subgroup =
+      make_invariant_subgroup(configuration, begin, end);
+
+  EXPECT_EQ(engine.is_canonical(configuration),
+            is_canonical(configuration, begin, end));
+  EXPECT_EQ(engine.to_canonical(configuration), expected_to_canonical);
+  EXPECT_EQ(engine.make_canonical_form(configuration), expected_canonical);
+
+  config::CanonicalFormResult result = engine.canonicalize(configuration);
+  EXPECT_EQ(result.to_canonical, expected_to_canonical);
+  EXPECT_EQ(ops[result.to_canonical_index], expected_to_canonical);
+  EXPECT_EQ(result.canonical_configuration, expected_canonical);
+  ASSERT_EQ(result.invariant_subgroup_indices.size(),
+            expected_invariant_subgroup.size());
+  for (Index i = 0; i < expected_invariant_subgroup.size(); ++i) {
+    EXPECT_EQ(ops[result.invariant_subgroup_indices[i]],
+              expected_invariant_subgroup[i]);
+  }
+  EXPECT_EQ(engine.make_invariant_subgroup_indices(configuration),
+            result.invariant_subgroup_indices);
+}
+
+}  // namespace
+
+TEST(CanonicalFormEngineTest, FCCBinary) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::CanonicalFormEngine engine(supercell);
+
+  EXPECT_EQ(engine.n_sites(), 8);
+  EXPECT_EQ(engine.occupant_remap(0), nullptr);
+  EXPECT_EQ(engine.ops().size(), 48 * 8);
+
+  config::Configuration configuration(supercell);
+  Index n_configs = 1 << engine.n_sites();
+  for (Index count = 0; count < n_configs; ++count) {
+    test::set_occupation(configuration.dof_values.occupation, count, 2);
+    check_engine(engine, configuration);
+  }
+}
+
+TEST(CanonicalFormEngineTest, FCCTernarySubgroup) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 4, 0, 0, 0, 1, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  // use only the pure translations
+  std::vector<config::SupercellSymOp> ops(
+      config::SupercellSymOp::translation_begin(supercell),
+      config::SupercellSymOp::translation_end(supercell));
+  config::CanonicalFormEngine engine(supercell, ops);
+  EXPECT_EQ(engine.ops().size(), 4);
+
+  config::Configuration configuration(supercell);
+  for (Index count = 0; count < 81; ++count) {
+    test::set_occupation(configuration.dof_values.occupation, count, 3);
+    check_engine(engine, configuration);
+  }
+}
+
+TEST(CanonicalFormEngineTest, FCCDimerAnisoOccupation) {
+  auto prim = config::make_shared_prim(test::FCC_dimer_prim());
+  ASSERT_TRUE(prim->sym_info.has_aniso_occs);
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::CanonicalFormEngine engine(supercell);
+
+  config::Configuration configuration(supercell);
+  for (Index count = 0; count < 81; ++count) {
+    test::set_occupation(configuration.dof_values.occupation, count, 3);
+    check_engine(engine, configuration);
+  }
+
+  // the occupant remap tables give the same occupation as SupercellSymOp
+  test::set_occupation(configuration.dof_values.occupation, 46, 3);
+  // operations that do not permute occupants, such as the identity, have no
+  // remap table
+  Eigen::VectorXi after;
+  Index n_remap = 0;
+  for (Index i = 0; i < engine.ops().size(); ++i) {
+    if (engine.occupant_remap(i) != nullptr) {
+      ++n_remap;
+    }
+    engine.apply_occupation(i, configuration.dof_values.occupation, after);
+    EXPECT_EQ(after,
+              copy_apply(engine.ops()[i], configuration).dof_values.occupation);
+  }
+  EXPECT_EQ(engine.occupant_remap(0), nullptr);
+  EXPECT_GT(n_remap, 0);
+}
+
+TEST(CanonicalFormEngineTest, SimpleCubicIsingMagspin) {
+  // discrete collinear magnetic occupants, A.up and A.down
+  auto prim = config::make_shared_prim(test::SimpleCubic_ising_prim());
+  ASSERT_TRUE(prim->sym_info.has_aniso_occs);
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::CanonicalFormEngine engine(supercell);
+  EXPECT_EQ(engine.ops().size(), 96 * 8);
+
+  config::Configuration configuration(supercell);
+  Index n_configs = 1 << engine.n_sites();
+  for (Index count = 0; count < n_configs; ++count) {
+    test::set_occupation(configuration.dof_values.occupation, count, 2);
+    check_engine(engine, configuration);
+  }
+
+  // only the time reversal operations, which flip up and down, have remap
+  // tables
+  test::set_occupation(configuration.dof_values.occupation, 23, 2);
+  Eigen::VectorXi after;
+  for (Index i = 0; i < engine.ops().size(); ++i) {
+    bool is_time_reversal = engine.ops()[i].to_symop().is_time_reversal_active;
+    EXPECT_EQ(engine.occupant_remap(i) != nullptr, is_time_reversal);
+    engine.apply_occupation(i, configuration.dof_values.occupation, after);
+    EXPECT_EQ(after,
+              copy_apply(engine.ops()[i], configuration).dof_values.occupation);
+  }
+}
+
+TEST(CanonicalFormEngineTest, FCCTernaryGLStrainDisp) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::CanonicalFormEngine engine(supercell);
+
+  config::Configuration configuration(supercell);
+  clexulator::ConfigDoFValues &dof_values = configuration.dof_values;
+  dof_values.occupation(3) = 1;
+  dof_values.local_dof_values.at("disp")(2, 2) = 1.0;
+  dof_values.global_dof_values.at("GLstrain")(2) = 0.01;
+  check_engine(engine, configuration);
+
+  config::Configuration canonical_configuration =
+      engine.make_canonical_form(configuration);
+  Eigen::VectorXi expected_occ(4);
+  expected_occ << 1, 0, 0, 0;
+  EXPECT_TRUE(almost_equal(
+      expected_occ, canonical_configuration.dof_values.occupation.transpose()));
+}
+
+TEST(CanonicalFormEngineTest, MakeCanonicalForms) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+
+  std::vector<config::Configuration> configurations;
+  for (Index count = 0; count < 256; ++count) {
+    config::Configuration configuration(supercell);
+    test::set_occupation(configuration.dof_values.occupation, count, 2);
+    configurations.push_back(configuration);
+  }
+
+  config::CanonicalFormEngine engine(supercell);
+  for (Index n_threads : {1, 3}) {
+    std::vector<Index> indices =
+        engine.to_canonical_indices(configurations, n_threads, 7);
+    std::vector<config::Configuration> canonical =
+        make_canonical_forms(configurations, begin, end, n_threads);
+    ASSERT_EQ(indices.size(), configurations.size());
+    ASSERT_EQ(canonical.size(), configurations.size());
+    for (Index i = 0; i < configurations.size(); ++i) {
+      EXPECT_EQ(indices[i], engine.to_canonical_index(configurations[i]));
+      EXPECT_EQ(canonical[i],
+                make_canonical_form(configurations[i], begin, end));
+    }
+  }
+}
+
+TEST(CanonicalFormEngineTest, BySupercell) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  std::vector<Eigen::Matrix3l> T(3);
+  T[0] << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  T[1] << 2, 0, 0, 0, 1, 0, 0, 0, 1;
+  T[2] << 3, 0, 0, 0, 1, 0, 0, 0, 1;
+
+  // configurations in mixed supercells, including equal supercells that
+  // are distinct objects
+  std::vector<config::Configuration> configurations;
+  for (Index count = 0; count < 16; ++count) {
+    auto supercell =
+        std::make_shared<config::Supercell const>(prim, T[count % 3]);
+    config::Configuration configuration(supercell);
+    test::set_occupation(configuration.dof_values.occupation, count, 2);
+    configurations.push_back(configuration);
+  }
+  auto large = std::make_shared<config::Supercell const>(prim, T[0]);
+  for (Index count = 0; count < 16; ++count) {
+    config::Configuration configuration(large);
+    test::set_occupation(configuration.dof_values.occupation, count, 2);
+    configurations.push_back(configuration);
+  }
+
+  std::vector<config::Configuration> expected;
+  for (auto const &configuration : configurations) {
+    auto const &supercell = configuration.supercell;
+    expected.push_back(make_canonical_form(
+        configuration, config::SupercellSymOp::begin(supercell),
+        config::SupercellSymOp::end(supercell)));
+  }
+
+  for (Index n_threads : {1, 4}) {
+    EXPECT_EQ(config::make_canonical_forms_by_supercell(configurations,
+                                                        n_threads),
+              expected);
+    // budget too small for any table: canonicalize with SupercellSymOp
+    EXPECT_EQ(config::make_canonical_forms_by_supercell(configurations,
+                                                        n_threads, 0),
+              expected);
+  }
+  EXPECT_TRUE(config::make_canonical_forms_by_supercell({}).empty());
+}
@@ -0,0 +1,89 @@
+#include "casm/configuration/io/binary/ColumnarDataset.hh"
+
+#include <sstream>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(ColumnarDatasetTest, ReadWrite) {
+  auto prim =
+      config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T1, T2, T3;
+  T1 << 2, 0, 0, 0, 1, 0, 0, 0, 1;
+  T2 << 1, 0, 0, 0, 1, 0, 0, 0, 2;
+  T3 << 3, 0, 0, 0, 1, 0, 0, 0, 1;
+  std::vector<std::shared_ptr<config::Supercell const>> supercell_list = {
+      std::make_shared<config::Supercell const>(prim, T1),
+      std::make_shared<config::Supercell const>(prim, T2),
+      std::make_shared<config::Supercell const>(prim, T3)};
+
+  std::vector<config::ConfigurationWithProperties> records;
+  for (Index i = 0; i < 11; ++i) {
+    config::Configuration configuration(supercell_list[i % 3]);
+    configuration.dof_values.occupation(0) = i % 3;
+    configuration.dof_values.local_dof_values.at("disp")(1, 1) = 0.1 * i;
+    configuration.dof_values.global_dof_values.at("GLstrain")(0) = -0.01 * i;
+    std::map<std::string, Eigen::MatrixXd> local_properties;
+    std::map<std::string, Eigen::VectorXd> global_properties;
+    if (i % 2) {
+      global_properties["energy"] = Eigen::VectorXd::Constant(1, -1.0 * i);
+      local_properties["force"] = Eigen::MatrixXd::Constant(
+          3, configuration.dof_values.occupation.size(), 0.5 * i);
+    }
+    records.emplace_back(configuration, local_properties, global_properties);
+  }
+
+  std::stringstream ss;
+  {
+    config::ColumnarDatasetWriter writer(ss, 2);
+    for (auto const &record : records) {
+      writer.write(record);
+    }
+    writer.finish();
+    EXPECT_EQ(writer.size(), records.size());
+  }
+
+  config::SupercellSet supercells(prim);
+  config::ColumnarDatasetReader reader(ss, supercells);
+  std::vector<bool> found(records.size(), false);
+  Index n_batches = 0;
+  while (auto batch = reader.read_batch()) {
+    ++n_batches;
+    EXPECT_LE(batch->size(), 2);
+    EXPECT_EQ(batch->occupation.rows(), batch->n_sites);
+    EXPECT_EQ(batch->occupation.cols(), batch->size());
+    EXPECT_EQ(batch->local_dof_values.at("disp").rows(), 3 * batch->n_sites);
+    auto values = config::make_configurations_with_properties(*batch);
+    for (Index j = 0; j < batch->size(); ++j) {
+      Index i = batch->record_index[j];
+      ASSERT_LT(i, records.size());
+      EXPECT_FALSE(found[i]);
+      found[i] = true;
+      EXPECT_EQ(values[j].configuration, records[i].configuration);
+      EXPECT_EQ(values[j].global_properties, records[i].global_properties);
+      EXPECT_EQ(values[j].local_properties, records[i].local_properties);
+    }
+  }
+  // 2 signatures: n_sites == 2 (T1, T2: 4 + 4 records), n_sites == 3 (3)
+  EXPECT_EQ(n_batches, 6);
+  for (bool x : found) {
+    EXPECT_TRUE(x);
+  }
+  EXPECT_EQ(supercells.size(), 3);
+  EXPECT_EQ(reader.supercell_list().size(), 3);
+}
+
+TEST(ColumnarDatasetTest, Errors) {
+  std::stringstream ss;
+  EXPECT_THROW(config::ColumnarDatasetWriter(ss, 0), std::runtime_error);
+
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::SupercellSet supercells(prim);
+  std::stringstream bad("CASMCFGB....");
+  EXPECT_THROW(config::ColumnarDatasetReader(bad, supercells),
+               std::runtime_error);
+}
@@ -1,9 +1,13 @@
 #include "casm/configuration/ConfigCompare.hh"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "casm/configuration/Configuration.hh"
 #include "casm/configuration/Prim.hh"
 #include "casm/configuration/Supercell.hh"
 #include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
 #include "gtest/gtest.h"
 #include "teststructures.hh"
@@ -156,3 +160,216 @@ TEST_F(ConfigCompareFCCTest, Test4) {
     --l_expected;
   }
 }
+
+namespace {
+
+/// Check ConfigIsEquivalent and ConfigCompare against comparisons of
+///     occupation vectors transformed with copy_apply
+void check_occupation_comparisons(
+    std::shared_ptr<config::Supercell const> const &supercell) {
+  config::Configuration configuration(supercell);
+  Eigen::VectorXi &occ = configuration.dof_values.occupation;
+  for (Index l = 0; l < occ.size(); ++l) {
+    occ[l] = (l * 7 + l / 3) % 2;
+  }
+  config::ConfigIsEquivalent equal_to_f(configuration);
+  config::ConfigCompare compare_f(equal_to_f);
+
+  auto lexicographic_less = [](Eigen::VectorXi const &A,
+                               Eigen::VectorXi const &B) {
+    return std::lexicographical_compare(A.data(), A.data() + A.size(),
+                                        B.data(), B.data() + B.size());
+  };
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  config::SupercellSymOp B = begin;
+  for (Index i = 0; i < 7; ++i) {
+    ++B;
+  }
+  Eigen::VectorXi B_occ = copy_apply(B, configuration).dof_values.occupation;
+  for (auto A = begin; A != end; ++A) {
+    Eigen::VectorXi A_occ = copy_apply(*A, configuration).dof_values.occupation;
+    EXPECT_EQ(equal_to_f(*A), occ == A_occ);
+    EXPECT_EQ(compare_f(*A), lexicographic_less(occ, A_occ));
+    EXPECT_EQ(equal_to_f(*A, B), A_occ == B_occ);
+    EXPECT_EQ(compare_f(*A, B), lexicographic_less(A_occ, B_occ));
+  }
+}
+
+}  // namespace
+
+TEST(ConfigCompareOccupationTest, PackedOccupation) {
+  // more sites than one comparison block
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 5, 0, 0, 0, 3, 0, 0, 0, 6;
+  check_occupation_comparisons(
+      std::make_shared<config::Supercell const>(prim, T));
+
+  // no stored translation permutations, with and without the cache
+  check_occupation_comparisons(
+      std::make_shared<config::Supercell const>(prim, T, 0));
+  check_occupation_comparisons(
+      std::make_shared<config::Supercell const>(prim, T, 0, 0));
+}
+
+TEST(ConfigCompareLocalDoFTest, CacheByFactorGroupOp) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration configuration(supercell);
+  Eigen::MatrixXd &disp = configuration.dof_values.local_dof_values.at("disp");
+  disp(0, 1) = 0.1;
+  disp(2, 2) = 0.2;
+  disp(1, 3) = -0.1;
+
+  double tol = prim->basicstructure->lattice().tol();
+  config::ConfigIsEquivalent expected_f(configuration, tol);
+  config::ConfigIsEquivalent cached_f(configuration, tol, {"all"}, true);
+
+  // visit operations with factor group operations in reverse order, so
+  // that consecutive comparisons use different factor group operations
+  std::vector<config::SupercellSymOp> ops(
+      config::SupercellSymOp::begin(supercell),
+      config::SupercellSymOp::end(supercell));
+  std::reverse(ops.begin(), ops.end());
+  for (Index i = 0; i < ops.size(); ++i) {
+    config::SupercellSymOp const &A = ops[i];
+    config::SupercellSymOp const &B = ops[(i * 13) % ops.size()];
+    EXPECT_EQ(cached_f(A), expected_f(A));
+    if (!expected_f(A)) {
+      EXPECT_EQ(cached_f.is_less(), expected_f.is_less());
+    }
+    EXPECT_EQ(cached_f(A, B), expected_f(A, B));
+    if (!expected_f(A, B)) {
+      EXPECT_EQ(cached_f.is_less(), expected_f.is_less());
+    }
+  }
+}
+
+namespace {
+
+/// Check OccupationConfigIsEquivalent against ConfigIsEquivalent
+template <bool HasAnisoOccs>
+void check_occupation_config_is_equivalent(
+    std::shared_ptr<config::Supercell const> const &supercell,
+    std::set<std::string> const &which_dofs = {"all"}) {
+  config::Configuration configuration(supercell);
+  for (auto &dof : configuration.dof_values.local_dof_values) {
+    dof.second(0, 0) = 0.1;
+  }
+  Eigen::VectorXi &occ = configuration.dof_values.occupation;
+  for (Index l = 0; l < occ.size(); ++l) {
+    occ[l] = (l * 7 + l / 3) % 2;
+  }
+  config::Configuration other(configuration);
+  other.dof_values.occupation[0] = 1 - occ[0];
+
+  ASSERT_TRUE(config::is_occupation_only_comparison(configuration, which_dofs));
+  config::ConfigIsEquivalent expected_f(configuration, which_dofs);
+  config::OccupationConfigIsEquivalent<HasAnisoOccs> equal_to_f(configuration);
+
+  EXPECT_EQ(equal_to_f(other), expected_f(other));
+  EXPECT_EQ(equal_to_f.is_less(), expected_f.is_less());
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  config::SupercellSymOp B = begin;
+  for (Index i = 0; i < 7; ++i) {
+    ++B;
+  }
+  for (auto A = begin; A != end; ++A) {
+    EXPECT_EQ(equal_to_f(*A), expected_f(*A));
+    if (!expected_f(*A)) {
+      EXPECT_EQ(equal_to_f.is_less(), expected_f.is_less());
+    }
+    EXPECT_EQ(equal_to_f(*A, B), expected_f(*A, B));
+    if (!expected_f(*A, B)) {
+      EXPECT_EQ(equal_to_f.is_less(), expected_f.is_less());
+    }
+    EXPECT_EQ(equal_to_f(*A, other), expected_f(*A, other));
+    if (!expected_f(*A, other)) {
+      EXPECT_EQ(equal_to_f.is_less(), expected_f.is_less());
+    }
+    EXPECT_EQ(equal_to_f(*A, B, other), expected_f(*A, B, other));
+    if (!expected_f(*A, B, other)) {
+      EXPECT_EQ(equal_to_f.is_less(), expected_f.is_less());
+    }
+  }
+
+  // the visitor selects the specialized type
+  bool is_specialized = config::visit_config_is_equivalent(
+      configuration, [](auto const &f) {
+        return std::is_same_v<
+            std::decay_t<decltype(f)>,
+            config::OccupationConfigIsEquivalent<HasAnisoOccs>>;
+      },
+      which_dofs);
+  EXPECT_TRUE(is_specialized);
+}
+
+}  // namespace
+
+TEST(OccupationConfigIsEquivalentTest, IsotropicOccupation) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 3, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  check_occupation_config_is_equivalent<false>(supercell);
+
+  // the comparison type must match the prim
+  config::Configuration configuration(supercell);
+  EXPECT_THROW(config::OccupationConfigIsEquivalent<true>{configuration},
+               std::runtime_error);
+}
+
+TEST(OccupationConfigIsEquivalentTest, AnisotropicOccupation) {
+  auto prim = config::make_shared_prim(test::FCC_dimer_prim());
+  ASSERT_TRUE(prim->sym_info.has_aniso_occs);
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  check_occupation_config_is_equivalent<true>(supercell);
+}
+
+TEST(OccupationConfigIsEquivalentTest, ContinuousDoF) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration configuration(supercell);
+  EXPECT_FALSE(config::is_occupation_only_comparison(configuration));
+  EXPECT_TRUE(config::is_occupation_only_comparison(configuration, {"occ"}));
+
+  bool is_general = config::visit_config_is_equivalent(
+      configuration, [](auto const &f) {
+        return std::is_same_v<std::decay_t<decltype(f)>,
+                              config::ConfigIsEquivalent>;
+      });
+  EXPECT_TRUE(is_general);
+}
+
+TEST(OccupationConfigIsEquivalentTest, ContinuousDoFCompareOccupation) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  check_occupation_config_is_equivalent<false>(supercell, {"occ"});
+
+  // continuous DoF break the symmetry only if they are compared
+  config::Configuration configuration(supercell);
+  configuration.dof_values.local_dof_values.at("disp")(0, 0) = 0.1;
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  Index n_ops = 0;
+  for (auto it = begin; it != end; ++it) {
+    ++n_ops;
+  }
+  EXPECT_EQ(config::make_invariant_subgroup(configuration, begin, end, {"occ"})
+                .size(),
+            n_ops);
+  EXPECT_LT(config::make_invariant_subgroup(configuration, begin, end).size(),
+            n_ops);
+}
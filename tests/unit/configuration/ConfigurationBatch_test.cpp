@@ -0,0 +1,162 @@
+#include "casm/configuration/ConfigurationBatch.hh"
+
+#include "casm/clexulator/DoFSpace.hh"
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(ConfigurationBatchTest, Storage) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  std::vector<config::Configuration> configurations;
+  for (Index i = 0; i < 5; ++i) {
+    config::Configuration configuration(supercell);
+    configuration.dof_values.occupation(i % 4) = 1 + i % 2;
+    configuration.dof_values.local_dof_values.at("disp")(1, i % 4) = 0.1 * i;
+    configuration.dof_values.global_dof_values.at("GLstrain")(2) = 0.01 * i;
+    configurations.push_back(configuration);
+  }
+
+  config::ConfigurationBatch batch(supercell, configurations);
+  ASSERT_EQ(batch.size(), 5);
+  EXPECT_EQ(batch.n_sites(), 4);
+  EXPECT_EQ(batch.occupation().rows(), 5);
+  EXPECT_EQ(batch.occupation().cols(), 4);
+  EXPECT_EQ(batch.global_dof_values("GLstrain").cols(), 6);
+  EXPECT_EQ(batch.local_dof_values("disp").cols(), 12);
+  EXPECT_THROW(batch.local_dof_values("magspin"), std::runtime_error);
+
+  config::Configuration tmp(supercell);
+  for (Index i = 0; i < 5; ++i) {
+    EXPECT_EQ(batch.configuration(i), configurations[i]);
+    batch.copy_to(i, tmp);
+    EXPECT_EQ(tmp, configurations[i]);
+    config::ConfigurationBatchView view = batch.view(i);
+    EXPECT_EQ(Eigen::VectorXi(view.occupation()),
+              configurations[i].dof_values.occupation);
+    EXPECT_TRUE(almost_equal(
+        Eigen::MatrixXd(view.local_dof_values("disp")),
+        configurations[i].dof_values.local_dof_values.at("disp")));
+    EXPECT_TRUE(almost_equal(
+        Eigen::VectorXd(view.global_dof_values("GLstrain")),
+        configurations[i].dof_values.global_dof_values.at("GLstrain")));
+  }
+
+  batch.set(0, configurations[4]);
+  EXPECT_EQ(batch.configuration(0), configurations[4]);
+  EXPECT_EQ(batch.configurations().size(), 5);
+
+  // configurations must be in the batch's supercell
+  Eigen::Matrix3l T2 = Eigen::Matrix3l::Identity();
+  auto other_supercell = std::make_shared<config::Supercell const>(prim, T2);
+  EXPECT_THROW(batch.push_back(config::Configuration(other_supercell)),
+               std::runtime_error);
+
+  // apply
+  config::SupercellSymOp op(supercell, 3, 1);
+  config::apply(op, batch);
+  for (Index i = 1; i < 5; ++i) {
+    config::Configuration expected = copy_apply(op, configurations[i]);
+    config::Configuration value = batch.configuration(i);
+    EXPECT_EQ(value.dof_values.occupation, expected.dof_values.occupation);
+    EXPECT_TRUE(
+        almost_equal(value.dof_values.local_dof_values.at("disp"),
+                     expected.dof_values.local_dof_values.at("disp")));
+    EXPECT_TRUE(
+        almost_equal(value.dof_values.global_dof_values.at("GLstrain"),
+                     expected.dof_values.global_dof_values.at("GLstrain")));
+  }
+
+  batch.clear();
+  EXPECT_TRUE(batch.empty());
+}
+
+TEST(ConfigurationBatchTest, CanonicalForms) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+
+  std::vector<config::Configuration> configurations;
+  for (Index count = 0; count < 256; ++count) {
+    config::Configuration configuration(supercell);
+    test::set_occupation(configuration.dof_values.occupation, count, 2);
+    configurations.push_back(configuration);
+  }
+
+  config::CanonicalFormEngine engine(supercell);
+  for (Index n_threads : {1, 3}) {
+    config::ConfigurationBatch batch(supercell, configurations);
+    std::vector<bool> flags = config::is_canonical(engine, batch, n_threads);
+    config::to_canonical_forms(engine, batch, n_threads);
+    ASSERT_EQ(flags.size(), configurations.size());
+    ASSERT_EQ(batch.size(), configurations.size());
+    for (Index i = 0; i < configurations.size(); ++i) {
+      EXPECT_EQ(flags[i], is_canonical(configurations[i], begin, end));
+      EXPECT_EQ(batch.configuration(i),
+                make_canonical_form(configurations[i], begin, end));
+    }
+  }
+}
+
+TEST(ConfigurationBatchTest, SetDoFSpaceValues) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  background.dof_values.occupation(1) = 1;
+  background.dof_values.local_dof_values.at("disp")(0, 2) = 0.05;
+  background.dof_values.global_dof_values.at("GLstrain")(0) = 0.02;
+
+  std::vector<clexulator::DoFSpace> dof_spaces;
+  dof_spaces.emplace_back("GLstrain", prim->basicstructure);
+  dof_spaces.emplace_back("disp", prim->basicstructure, T,
+                          std::set<Index>({0, 3}));
+  for (auto const &dof_space : dof_spaces) {
+    Index dim = dof_space.basis.cols();
+    Eigen::MatrixXd coordinates(dim, 7);
+    for (Index i = 0; i < coordinates.rows(); ++i) {
+      for (Index j = 0; j < coordinates.cols(); ++j) {
+        coordinates(i, j) = 0.01 * (i + 1) * (j - 3);
+      }
+    }
+
+    config::ConfigurationBatch batch(supercell);
+    config::set_dof_space_values(batch, background, dof_space, coordinates);
+    ASSERT_EQ(batch.size(), coordinates.cols());
+    for (Index j = 0; j < coordinates.cols(); ++j) {
+      config::Configuration expected(background);
+      config::set_dof_space_values(expected, dof_space, coordinates.col(j));
+      config::Configuration configuration = batch.configuration(j);
+      EXPECT_EQ(configuration.dof_values.occupation,
+                expected.dof_values.occupation);
+      EXPECT_TRUE(
+          almost_equal(configuration.dof_values.local_dof_values.at("disp"),
+                       expected.dof_values.local_dof_values.at("disp")));
+      EXPECT_TRUE(almost_equal(
+          configuration.dof_values.global_dof_values.at("GLstrain"),
+          expected.dof_values.global_dof_values.at("GLstrain")));
+    }
+  }
+
+  clexulator::DoFSpace occ_dof_space("occ", prim->basicstructure, T);
+  config::ConfigurationBatch batch(supercell);
+  EXPECT_THROW(config::set_dof_space_values(
+                   batch, background, occ_dof_space,
+                   Eigen::MatrixXd::Zero(occ_dof_space.basis.cols(), 1)),
+               std::runtime_error);
+}
@@ -0,0 +1,120 @@
+#include "casm/configuration/ConfigurationDelta.hh"
+
+#include <set>
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/io/json/ConfigurationDelta_json_io.hh"
+#include "casm/configuration/memory_usage.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(ConfigurationDeltaTest, Occupation) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 4, 0, 0, 0, 4, 0, 0, 0, 4;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto background = std::make_shared<config::Configuration const>(supercell);
+
+  std::vector<config::Configuration> configurations;
+  for (Index l = 0; l < 4; ++l) {
+    config::Configuration configuration = *background;
+    configuration.dof_values.occupation(l) = 1;
+    configuration.dof_values.occupation(l + 10) = 1;
+    configurations.push_back(configuration);
+  }
+  configurations.push_back(*background);
+
+  for (Index n_threads : {1, 4}) {
+    std::vector<config::ConfigurationDelta> deltas =
+        config::make_configuration_deltas(background, configurations,
+                                          n_threads);
+    ASSERT_EQ(deltas.size(), configurations.size());
+    for (Index i = 0; i < deltas.size(); ++i) {
+      EXPECT_EQ(deltas[i].background, background);
+      EXPECT_EQ(make_configuration(deltas[i]), configurations[i]);
+    }
+    EXPECT_EQ(deltas[0].size(), 2);
+    EXPECT_EQ(deltas.back().size(), 0);
+  }
+
+  // usable in sets
+  std::set<config::ConfigurationDelta> unique;
+  for (auto const &configuration : configurations) {
+    unique.insert(make_configuration_delta(background, configuration));
+    unique.insert(make_configuration_delta(background, configuration));
+  }
+  EXPECT_EQ(unique.size(), configurations.size());
+
+  // expanding into existing storage
+  config::Configuration expanded = *background;
+  for (auto const &delta : unique) {
+    make_configuration(delta, expanded);
+    EXPECT_EQ(make_configuration_delta(background, expanded), delta);
+  }
+
+  // memory is proportional to the number of changes
+  config::MemoryUsageContext context;
+  memory_usage(*background, context);
+  EXPECT_LT(memory_usage(*unique.begin(), context),
+            memory_usage(*background, context));
+
+  // configurations in other supercells cannot be stored
+  auto other_supercell = std::make_shared<config::Supercell const>(
+      prim, Eigen::Matrix3l::Identity());
+  EXPECT_THROW(make_configuration_delta(
+                   background, config::Configuration(other_supercell)),
+               std::runtime_error);
+}
+
+TEST(ConfigurationDeltaTest, ContinuousDoFAndJson) {
+  auto prim =
+      config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration tmp(supercell);
+  tmp.dof_values.local_dof_values.at("disp").col(0) << 0.01, 0.0, 0.0;
+  auto background = std::make_shared<config::Configuration const>(tmp);
+
+  std::vector<config::Configuration> configurations;
+  {
+    config::Configuration configuration = *background;
+    configuration.dof_values.occupation(3) = 2;
+    configuration.dof_values.local_dof_values.at("disp").col(5) << 0.0, 0.02,
+        0.0;
+    configurations.push_back(configuration);
+  }
+  {
+    config::Configuration configuration = *background;
+    configuration.dof_values.global_dof_values.at("GLstrain")(0) = 0.01;
+    configuration.dof_values.local_dof_values.at("disp").col(0).setZero();
+    configurations.push_back(configuration);
+  }
+
+  std::vector<config::ConfigurationDelta> deltas =
+      config::make_configuration_deltas(background, configurations);
+  EXPECT_EQ(deltas[0].size(), 2);
+  EXPECT_EQ(deltas[0].local_dof_values.at("disp").size(), 1);
+  EXPECT_EQ(deltas[1].size(), 2);
+  EXPECT_EQ(deltas[1].global_dof_values.count("GLstrain"), 1);
+  for (Index i = 0; i < deltas.size(); ++i) {
+    EXPECT_EQ(make_configuration(deltas[i]), configurations[i]);
+  }
+
+  jsonParser json;
+  to_json(deltas, json);
+  EXPECT_EQ(json["deltas"].size(), 2);
+  EXPECT_FALSE(json["deltas"].begin()->contains("global_dof"));
+
+  std::vector<config::ConfigurationDelta> read;
+  from_json(read, json, prim);
+  ASSERT_EQ(read.size(), deltas.size());
+  EXPECT_EQ(read[0].background, read[1].background);
+  for (Index i = 0; i < deltas.size(); ++i) {
+    EXPECT_EQ(*read[i].background, *background);
+    EXPECT_EQ(make_configuration(read[i]), configurations[i]);
+  }
+}
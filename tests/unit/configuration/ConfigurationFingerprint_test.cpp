@@ -0,0 +1,94 @@
+#include "casm/configuration/ConfigurationFingerprint.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class ConfigurationFingerprintTest : public testing::Test {
+ protected:
+  ConfigurationFingerprintTest() {
+    prim = config::make_shared_prim(test::FCC_binary_prim());
+    calculator =
+        std::make_shared<config::InvariantFingerprintCalculator const>(prim);
+
+    Eigen::Matrix3l T_conventional;
+    T_conventional << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+    motif_supercell =
+        std::make_shared<config::Supercell const>(prim, T_conventional);
+
+    Eigen::Matrix3l T_double = Eigen::Matrix3l::Identity();
+    T_double(0, 0) = 2;
+    supercell = std::make_shared<config::Supercell const>(
+        prim, Eigen::Matrix3l(T_conventional * T_double));
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<config::InvariantFingerprintCalculator const> calculator;
+  std::shared_ptr<config::Supercell const> motif_supercell;
+  std::shared_ptr<config::Supercell const> supercell;
+};
+
+TEST_F(ConfigurationFingerprintTest, SiteOccupantOrbits) {
+  EXPECT_EQ(calculator->n_site_occupant_orbits(), 2);
+  EXPECT_EQ(calculator->orbits().size(), 4);
+
+  // anisotropic occupants related by symmetry are in one orbit
+  auto dimer_prim = config::make_shared_prim(test::FCC_dimer_prim());
+  config::InvariantFingerprintCalculator dimer_calculator(dimer_prim);
+  EXPECT_EQ(dimer_calculator.n_site_occupant_orbits(), 1);
+  EXPECT_EQ(dimer_calculator.site_occupant_orbit_index(0, 2), 0);
+}
+
+TEST_F(ConfigurationFingerprintTest, Invariance) {
+  config::Configuration motif(motif_supercell);
+  motif.dof_values.occupation << 1, 0, 0, 0;
+
+  std::vector<config::Configuration> all =
+      config::make_all_super_configurations(motif, supercell);
+  ASSERT_GT(all.size(), 1);
+  std::uint64_t expected = (*calculator)(all[0]);
+  for (auto const &configuration : all) {
+    EXPECT_EQ((*calculator)(configuration), expected);
+    EXPECT_EQ((*calculator)(config::make_in_canonical_supercell(configuration)),
+              expected);
+  }
+
+  config::Configuration other(supercell);
+  other.dof_values.occupation = all[0].dof_values.occupation;
+  other.dof_values.occupation(0) = 1 - other.dof_values.occupation(0);
+  EXPECT_NE((*calculator)(other), expected);
+}
+
+TEST_F(ConfigurationFingerprintTest, DistinctConfigurationFinder) {
+  config::Configuration motif(motif_supercell);
+  motif.dof_values.occupation << 1, 0, 0, 0;
+  std::vector<config::Configuration> all =
+      config::make_all_super_configurations(motif, supercell);
+
+  for (bool in_canonical_supercell : {true, false}) {
+    config::DistinctConfigurationFinder finder(calculator,
+                                               in_canonical_supercell);
+    EXPECT_TRUE(finder.insert(all[0]));
+    EXPECT_EQ(finder.n_canonical_forms(), 0);
+    for (Index i = 1; i < all.size(); ++i) {
+      EXPECT_FALSE(finder.insert(all[i]));
+    }
+    EXPECT_EQ(finder.configurations().size(), 1);
+    EXPECT_EQ(finder.configurations()[0], all[0]);
+    EXPECT_EQ(finder.n_canonical_forms(), all.size());
+  }
+
+  // configurations with distinct fingerprints are not canonicalized
+  config::DistinctConfigurationFinder finder(calculator);
+  config::Configuration other(motif_supercell);
+  other.dof_values.occupation << 1, 1, 0, 0;
+  EXPECT_TRUE(finder.insert(motif));
+  EXPECT_TRUE(finder.insert(other));
+  EXPECT_EQ(finder.configurations().size(), 2);
+  EXPECT_EQ(finder.n_canonical_forms(), 0);
+}
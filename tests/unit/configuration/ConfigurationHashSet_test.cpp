@@ -0,0 +1,120 @@
+#include "casm/configuration/ConfigurationHashSet.hh"
+
+#include <random>
+
+#include "casm/configuration/ConfigCompare.hh"
+#include "casm/configuration/ConfigIsEquivalent.hh"
+#include "casm/configuration/Prim.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class ConfigurationHashSetTest : public testing::Test {
+ protected:
+  ConfigurationHashSetTest()
+      : prim(config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim())) {
+    std::mt19937 engine(1234);
+    std::uniform_int_distribution<int> occ_dist(0, 2);
+    std::uniform_int_distribution<int> choice(0, 1);
+
+    Eigen::Matrix3l T1 = Eigen::Matrix3l::Identity() * 2;
+    Eigen::Matrix3l T2 = Eigen::Matrix3l::Identity();
+    T2(2, 2) = 2;
+    for (Eigen::Matrix3l const &T : {T1, T2}) {
+      auto supercell = std::make_shared<config::Supercell const>(prim, T);
+      for (Index n = 0; n < 60; ++n) {
+        config::Configuration configuration(supercell);
+        auto &dof_values = configuration.dof_values;
+        for (Index l = 0; l < dof_values.occupation.size(); ++l) {
+          // mostly 0, so that equal occupations occur often
+          dof_values.occupation(l) = (l < 2) ? occ_dist(engine) : 0;
+        }
+        dof_values.global_dof_values.at("GLstrain")(0) =
+            0.01 * choice(engine);
+        dof_values.local_dof_values.at("disp")(0, 0) = 0.1 * choice(engine);
+        configurations.push_back(configuration);
+      }
+    }
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::vector<config::Configuration> configurations;
+};
+
+TEST_F(ConfigurationHashSetTest, CompareMatchesConfigCompare) {
+  double tol = prim->basicstructure->lattice().tol();
+  for (auto const &A : configurations) {
+    config::ConfigCompare compare_f(A, {"all"});
+    config::ConfigIsEquivalent equal_to_f(A, tol);
+    for (auto const &B : configurations) {
+      EXPECT_EQ(A < B, compare_f(B));
+      EXPECT_EQ(A == B, equal_to_f(B));
+    }
+  }
+}
+
+TEST_F(ConfigurationHashSetTest, InsertMatchesStdSet) {
+  std::set<config::Configuration> expected;
+  config::ConfigurationHashSet hash_set;
+  std::vector<config::Configuration> first_inserted;
+  for (auto const &configuration : configurations) {
+    bool expected_inserted = expected.insert(configuration).second;
+    auto result = hash_set.insert(configuration);
+    EXPECT_EQ(result.second, expected_inserted);
+    EXPECT_TRUE(*result.first == configuration);
+    if (expected_inserted) {
+      first_inserted.push_back(configuration);
+    }
+  }
+  ASSERT_EQ(hash_set.size(), expected.size());
+  EXPECT_TRUE(hash_set.to_set() == expected);
+  ASSERT_EQ(hash_set.values().size(), first_inserted.size());
+  for (Index i = 0; i < first_inserted.size(); ++i) {
+    EXPECT_TRUE(hash_set.values()[i] == first_inserted[i]);
+  }
+  for (auto const &configuration : configurations) {
+    EXPECT_EQ(hash_set.count(configuration), 1);
+  }
+
+  config::ConfigurationHashSet merged;
+  merged.merge(hash_set);
+  merged.merge(hash_set);
+  EXPECT_EQ(merged.size(), hash_set.size());
+
+  hash_set.clear();
+  EXPECT_TRUE(hash_set.empty());
+  EXPECT_TRUE(hash_set.find(configurations[0]) == hash_set.end());
+}
+
+TEST_F(ConfigurationHashSetTest, QuantizedCompareMatchesConfigCompare) {
+  double tol = prim->basicstructure->lattice().tol();
+  config::QuantizedConfigurationHash hash_f(tol);
+  for (auto const &A : configurations) {
+    config::ConfigIsEquivalent equal_to_f(A, tol, {"all"}, false, true);
+    for (auto const &B : configurations) {
+      bool is_equal = equal_to_f(B);
+      EXPECT_EQ(A == B, is_equal);
+      if (is_equal) {
+        EXPECT_EQ(hash_f(A), hash_f(B));
+      } else {
+        EXPECT_EQ(A < B, equal_to_f.is_less());
+      }
+    }
+  }
+}
+
+TEST_F(ConfigurationHashSetTest, QuantizedInsertMatchesStdSet) {
+  double tol = prim->basicstructure->lattice().tol();
+  std::set<config::Configuration> expected;
+  config::ConfigurationHashSet hash_set(tol);
+  ASSERT_TRUE(hash_set.quantization_tol().has_value());
+  for (auto const &configuration : configurations) {
+    bool expected_inserted = expected.insert(configuration).second;
+    EXPECT_EQ(hash_set.insert(configuration).second, expected_inserted);
+  }
+  EXPECT_EQ(hash_set.size(), expected.size());
+  EXPECT_TRUE(hash_set.to_set() == expected);
+
+  EXPECT_THROW(config::ConfigurationHashSet(0.0), std::runtime_error);
+}
@@ -0,0 +1,54 @@
+#include "casm/configuration/io/json/ConfigurationJsonLines.hh"
+
+#include <sstream>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(ConfigurationJsonLinesTest, ReadWrite) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 1, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  std::vector<config::Configuration> configurations;
+  std::stringstream ss;
+  for (Index i = 0; i < 3; ++i) {
+    config::Configuration configuration(supercell);
+    configuration.dof_values.occupation(0) = i % 2;
+    configuration.dof_values.occupation(1) = i / 2;
+    configurations.push_back(configuration);
+    config::write_json_line(ss, configuration);
+    if (i == 1) {
+      ss << "\n";
+    }
+  }
+
+  config::SupercellSet supercells(prim);
+  config::ConfigurationJsonLinesReader<config::Configuration> reader(
+      ss, supercells);
+  Index i = 0;
+  while (reader.is_valid()) {
+    ASSERT_LT(i, configurations.size());
+    EXPECT_EQ(reader.value(), configurations[i]);
+    ++i;
+    reader.advance();
+  }
+  EXPECT_EQ(i, 3);
+  EXPECT_EQ(reader.line_number(), 4);
+  EXPECT_EQ(supercells.size(), 1);
+}
+
+TEST(ConfigurationJsonLinesTest, InvalidLine) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  std::stringstream ss("{\"not\": \"a configuration\"}\n");
+  config::SupercellSet supercells(prim);
+  EXPECT_THROW(
+      config::ConfigurationJsonLinesReader<config::Configuration>(ss,
+                                                                  supercells),
+      std::runtime_error);
+}
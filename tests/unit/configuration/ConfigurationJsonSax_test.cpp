@@ -0,0 +1,140 @@
+#include "casm/configuration/io/json/ConfigurationJsonSax.hh"
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/json/Configuration_json_io.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+std::string _dump(jsonParser const &json) {
+  return static_cast<nlohmann::json const &>(json).dump();
+}
+
+config::Configuration _make_configuration(
+    std::shared_ptr<config::Supercell const> const &supercell, Index i) {
+  config::Configuration configuration(supercell);
+  auto &occupation = configuration.dof_values.occupation;
+  for (Index l = 0; l < occupation.size(); ++l) {
+    occupation(l) = (l + i) % 3;
+  }
+  Eigen::MatrixXd &disp = configuration.dof_values.local_dof_values.at("disp");
+  for (Index j = 0; j < disp.size(); ++j) {
+    disp(j) = 0.01 * (j + i);
+  }
+  Eigen::VectorXd &strain =
+      configuration.dof_values.global_dof_values.at("GLstrain");
+  for (Index j = 0; j < strain.size(); ++j) {
+    strain(j) = 0.001 * (j + 1) * (i + 1);
+  }
+  return configuration;
+}
+
+}  // namespace
+
+TEST(ConfigurationJsonSaxTest, Configuration) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration configuration = _make_configuration(supercell, 1);
+
+  for (bool write_prim_basis : {false, true}) {
+    jsonParser json;
+    to_json(configuration, json, write_prim_basis);
+    json["unrecognized"]["value"] = 1;
+    std::string json_str = _dump(json);
+
+    config::SupercellSet supercells(prim);
+    auto fast = config::make_from_json_string<config::Configuration>(
+        json_str, supercells);
+    auto dom = jsonMake<config::Configuration>::make_from_json(
+        jsonParser::parse(json_str), supercells);
+    EXPECT_EQ(supercells.size(), 1);
+    EXPECT_EQ(fast->supercell, dom->supercell);
+    EXPECT_EQ(fast->dof_values.occupation, dom->dof_values.occupation);
+    EXPECT_TRUE(fast->dof_values.local_dof_values.at("disp").isApprox(
+        dom->dof_values.local_dof_values.at("disp")));
+    EXPECT_TRUE(fast->dof_values.global_dof_values.at("GLstrain").isApprox(
+        dom->dof_values.global_dof_values.at("GLstrain")));
+  }
+}
+
+TEST(ConfigurationJsonSaxTest, ConfigurationWithProperties) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T = Eigen::Matrix3l::Identity() * 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  Eigen::MatrixXd forces = Eigen::MatrixXd::Random(3, 8);
+  Eigen::VectorXd energy = Eigen::VectorXd::Constant(1, -1.5);
+  config::ConfigurationWithProperties x(_make_configuration(supercell, 2),
+                                        {{"force", forces}},
+                                        {{"energy", energy}});
+  jsonParser json;
+  to_json(x, json);
+
+  config::SupercellSet supercells(prim);
+  auto fast =
+      config::make_from_json_string<config::ConfigurationWithProperties>(
+          _dump(json), supercells);
+  EXPECT_EQ(fast->configuration.dof_values.occupation,
+            x.configuration.dof_values.occupation);
+  EXPECT_TRUE(fast->local_properties.at("force").isApprox(forces));
+  EXPECT_TRUE(fast->global_properties.at("energy").isApprox(energy));
+}
+
+TEST(ConfigurationJsonSaxTest, ConfigurationSet) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  config::SupercellSet supercells(prim);
+  config::ConfigurationSet configurations;
+  for (Index volume = 1; volume <= 3; ++volume) {
+    Eigen::Matrix3l T = Eigen::Matrix3l::Identity();
+    T(0, 0) = volume;
+    auto supercell = supercells.insert(T).first->supercell;
+    for (Index i = 0; i < 2; ++i) {
+      configurations.insert(_make_configuration(supercell, i));
+    }
+  }
+  jsonParser json;
+  to_json(configurations, json);
+  std::string json_str = _dump(json);
+
+  config::SupercellSet supercells_in(prim);
+  config::ConfigurationSet fast;
+  config::read_configuration_set_json(json_str, supercells_in, fast);
+  config::ConfigurationSet dom;
+  from_json(supercells_in, dom, jsonParser::parse(json_str), prim);
+  ASSERT_EQ(fast.size(), dom.size());
+  auto fast_it = fast.begin();
+  for (auto const &record : dom) {
+    EXPECT_EQ(fast_it->configuration_name(), record.configuration_name());
+    EXPECT_EQ(fast_it->configuration.dof_values.occupation,
+              record.configuration.dof_values.occupation);
+    EXPECT_TRUE(fast_it->configuration.dof_values.local_dof_values.at("disp")
+                    .isApprox(record.configuration.dof_values.local_dof_values
+                                  .at("disp")));
+    ++fast_it;
+  }
+  EXPECT_EQ(fast.next_config_id(), dom.next_config_id());
+}
+
+TEST(ConfigurationJsonSaxTest, Invalid) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::SupercellSet supercells(prim);
+
+  // inconsistent with the prim: read with the document reader, which throws
+  std::string json_str =
+      "{\"dof\": {\"occ\": [0, 1]}, \"transformation_matrix_to_supercell\": "
+      "[[1, 0, 0], [0, 1, 0], [0, 0, 1]]}";
+  EXPECT_THROW(config::make_from_json_string<config::Configuration>(
+                   json_str, supercells),
+               std::runtime_error);
+
+  // not valid JSON
+  EXPECT_ANY_THROW(config::make_from_json_string<config::Configuration>(
+      "{\"dof\": ", supercells));
+}
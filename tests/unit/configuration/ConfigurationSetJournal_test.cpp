@@ -0,0 +1,110 @@
+#include "casm/configuration/io/binary/ConfigurationSetJournal.hh"
+
+#include <fstream>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/binary/ConfigurationSetView.hh"
+#include "gtest/gtest.h"
+#include "testdir.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+std::vector<config::Configuration> make_configurations(
+    config::SupercellSet &supercells) {
+  Eigen::Matrix3l T;
+  T << 1, 0, 0, 0, 1, 0, 0, 0, 4;
+  auto supercell = supercells
+                       .insert(std::make_shared<config::Supercell const>(
+                           supercells.prim(), T))
+                       .first->supercell;
+  std::vector<config::Configuration> configurations;
+  for (Index count = 0; count < 16; ++count) {
+    config::Configuration configuration(supercell);
+    for (Index l = 0; l < 4; ++l) {
+      configuration.dof_values.occupation(l) = (count >> l) & 1;
+    }
+    configurations.push_back(configuration);
+  }
+  return configurations;
+}
+
+}  // namespace
+
+TEST(ConfigurationSetJournalTest, ReplayAndCompact) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  auto supercells = std::make_shared<config::SupercellSet>(prim);
+  std::vector<config::Configuration> all = make_configurations(*supercells);
+
+  test::TmpDir tmp_dir;
+  std::string path = (tmp_dir.path() / "configurations.bin").string();
+  std::string erased_name;
+  {
+    config::ConfigurationSetJournal journal(path, supercells);
+    for (Index i = 0; i < 8; ++i) {
+      EXPECT_TRUE(journal.insert(all[i]).second);
+    }
+    EXPECT_FALSE(journal.insert(all[0]).second);
+    journal.compact();
+    EXPECT_EQ(journal.n_entries(), 0);
+
+    for (Index i = 8; i < 12; ++i) {
+      journal.insert(all[i]);
+    }
+    erased_name = journal.configurations().find(all[2])->configuration_name();
+    EXPECT_EQ(journal.erase(all[2]), 1);
+    EXPECT_EQ(journal.erase(all[2]), 0);
+    EXPECT_EQ(journal.n_entries(), 5);
+  }
+
+  // the snapshot is readable by itself, and has only the compacted records
+  {
+    config::ConfigurationSetView view(path, supercells);
+    EXPECT_EQ(view.size(), 8);
+  }
+
+  // replay the journal over the snapshot
+  {
+    config::ConfigurationSetJournal journal(path, supercells);
+    config::ConfigurationSet const &configurations = journal.configurations();
+    EXPECT_EQ(journal.n_entries(), 5);
+    EXPECT_EQ(configurations.size(), 11);
+    EXPECT_EQ(configurations.count(all[2]), 0);
+    EXPECT_EQ(configurations.count_by_name(erased_name), 0);
+    std::string supercell_name = configurations.begin()->supercell_name();
+    EXPECT_EQ(configurations.next_config_id().at(supercell_name), 12);
+
+    // new ids continue after replayed ids
+    auto res = journal.insert(all[12]);
+    EXPECT_EQ(res.first->configuration_id(), "12");
+  }
+
+  // a partially written entry at the end is discarded
+  {
+    std::ofstream out(path + ".journal", std::ios::binary | std::ios::app);
+    out.write("R\x40\x00", 3);
+  }
+  {
+    config::ConfigurationSetJournal journal(
+        path, supercells, config::JournalSyncPolicy::every_entry, 4);
+    EXPECT_EQ(journal.n_entries(), 6);
+    EXPECT_EQ(journal.configurations().size(), 12);
+
+    // automatic compaction when the threshold is reached
+    journal.insert(all[13]);
+    EXPECT_EQ(journal.n_entries(), 0);
+    journal.insert(all[14]);
+    EXPECT_EQ(journal.n_entries(), 1);
+  }
+  {
+    config::ConfigurationSetView view(path, supercells);
+    EXPECT_EQ(view.size(), 13);
+    config::ConfigurationSetJournal journal(path, supercells);
+    EXPECT_EQ(journal.n_entries(), 1);
+    EXPECT_EQ(journal.configurations().size(), 14);
+  }
+}
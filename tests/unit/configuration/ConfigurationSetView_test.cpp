@@ -0,0 +1,100 @@
+#include "casm/configuration/io/binary/ConfigurationSetView.hh"
+
+#include <fstream>
+#include <sstream>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/binary/Configuration_binary_io.hh"
+#include "gtest/gtest.h"
+#include "testdir.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+config::ConfigurationSet make_configurations(
+    config::SupercellSet &supercells) {
+  auto prim = supercells.prim();
+  Eigen::Matrix3l T1, T2;
+  T1 << 1, 0, 0, 0, 1, 0, 0, 0, 2;
+  T2 << 1, 0, 0, 0, 1, 0, 0, 0, 3;
+  config::ConfigurationSet configurations;
+  for (auto const &T : {T1, T2}) {
+    auto supercell =
+        supercells.insert(std::make_shared<config::Supercell const>(prim, T))
+            .first->supercell;
+    Index n_sites = supercell->unitcellcoord_index_converter.total_sites();
+    for (Index i = 0; i < n_sites; ++i) {
+      config::Configuration configuration(supercell);
+      for (Index l = 0; l <= i; ++l) {
+        configuration.dof_values.occupation(l) = 1;
+      }
+      configurations.insert(configuration);
+    }
+  }
+  return configurations;
+}
+
+}  // namespace
+
+TEST(ConfigurationSetViewTest, ReadByIndexAndName) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::SupercellSet write_supercells(prim);
+  config::ConfigurationSet configurations =
+      make_configurations(write_supercells);
+  ASSERT_EQ(configurations.size(), 5);
+
+  test::TmpDir tmp_dir;
+  std::string path = (tmp_dir.path() / "configurations.bin").string();
+  {
+    std::ofstream out(path, std::ios::binary);
+    config::write_indexed_binary(out, configurations);
+  }
+
+  auto supercells = std::make_shared<config::SupercellSet>(prim);
+  config::ConfigurationSetView view(path, supercells);
+  EXPECT_EQ(view.size(), 5);
+  EXPECT_EQ(view.n_supercells(), 2);
+  EXPECT_EQ(supercells->size(), 0);
+
+  Index i = 0;
+  for (auto const &record : configurations) {
+    EXPECT_EQ(view.configuration_name(i), record.configuration_name());
+    EXPECT_EQ(view.configuration_id(i), record.configuration_id());
+    config::ConfigurationRecord view_record = view.record(i);
+    EXPECT_EQ(view_record.configuration, record.configuration);
+    EXPECT_EQ(view_record.supercell_name(), record.supercell_name());
+    EXPECT_EQ(view.find_by_name(record.configuration_name()), i);
+    ++i;
+  }
+  EXPECT_EQ(view.find_by_name("SCEL1_1_1_1_0_0_0/0"), view.size());
+  EXPECT_EQ(view.next_config_id(), configurations.next_config_id());
+  EXPECT_EQ(supercells->size(), 2);
+
+  // the indexed format is also readable as a stream
+  std::ifstream in(path, std::ios::binary);
+  config::ConfigurationSet read_configurations;
+  config::read_binary(in, *supercells, read_configurations);
+  EXPECT_EQ(read_configurations.size(), configurations.size());
+}
+
+TEST(ConfigurationSetViewTest, NotIndexed) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::SupercellSet write_supercells(prim);
+  config::ConfigurationSet configurations =
+      make_configurations(write_supercells);
+
+  test::TmpDir tmp_dir;
+  std::string path = (tmp_dir.path() / "configurations.bin").string();
+  {
+    std::ofstream out(path, std::ios::binary);
+    config::write_binary(out, configurations);
+  }
+
+  auto supercells = std::make_shared<config::SupercellSet>(prim);
+  EXPECT_THROW(config::ConfigurationSetView(path, supercells),
+               std::runtime_error);
+}
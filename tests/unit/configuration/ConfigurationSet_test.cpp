@@ -0,0 +1,366 @@
+#include "casm/configuration/ConfigurationSet.hh"
+
+#include <thread>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(ConfigurationSetTest, OccupationIndex) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  config::ConfigurationSet configurations;
+  std::vector<config::Configuration> all;
+  for (Index count = 0; count < 256; ++count) {
+    config::Configuration configuration(supercell);
+    for (Index l = 0; l < 8; ++l) {
+      configuration.dof_values.occupation(l) = (count >> l) & 1;
+    }
+    all.push_back(configuration);
+    EXPECT_TRUE(configurations.insert(configuration).second);
+  }
+  EXPECT_EQ(configurations.size(), 256);
+
+  for (auto const &configuration : all) {
+    EXPECT_FALSE(configurations.insert(configuration).second);
+    auto it = configurations.find(configuration);
+    ASSERT_TRUE(it != configurations.end());
+    EXPECT_EQ(it->configuration, configuration);
+    EXPECT_EQ(configurations.find_by_name(it->configuration_name()), it);
+    EXPECT_EQ(configurations.count_by_name(it->configuration_name()), 1);
+  }
+  EXPECT_EQ(configurations.size(), 256);
+
+  // copies have their own index
+  config::ConfigurationSet copy(configurations);
+  std::string name = configurations.find(all[3])->configuration_name();
+  EXPECT_EQ(configurations.erase_by_name(name), 1);
+  EXPECT_EQ(configurations.count_by_name(name), 0);
+  EXPECT_EQ(configurations.count(all[3]), 0);
+  EXPECT_EQ(configurations.erase(all[4]), 1);
+  EXPECT_EQ(configurations.count(all[4]), 0);
+  EXPECT_EQ(configurations.size(), 254);
+
+  EXPECT_EQ(copy.size(), 256);
+  EXPECT_EQ(copy.count_by_name(name), 1);
+  EXPECT_EQ(copy.count(all[3]), 1);
+  EXPECT_EQ(copy.count(all[4]), 1);
+
+  configurations.clear();
+  EXPECT_EQ(configurations.count(all[0]), 0);
+  EXPECT_EQ(configurations.count_by_name(name), 0);
+}
+
+TEST(ConfigurationSetTest, SupercellIndex) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T1 = Eigen::Matrix3l::Identity();
+  Eigen::Matrix3l T2 = 2 * Eigen::Matrix3l::Identity();
+  auto supercell1 = std::make_shared<config::Supercell const>(prim, T1);
+  auto supercell2 = std::make_shared<config::Supercell const>(prim, T2);
+
+  config::ConfigurationSet configurations;
+  for (Index count = 0; count < 16; ++count) {
+    config::Configuration configuration(supercell2);
+    for (Index l = 0; l < 4; ++l) {
+      configuration.dof_values.occupation(l) = (count >> l) & 1;
+    }
+    configurations.insert(configuration);
+  }
+  for (Index occ = 0; occ < 2; ++occ) {
+    config::Configuration configuration(supercell1);
+    configuration.dof_values.occupation(0) = occ;
+    configurations.insert(configuration);
+  }
+  std::string name1 = configurations.begin()->supercell_name();
+  std::string name2 = std::prev(configurations.end())->supercell_name();
+  EXPECT_EQ(configurations.count_by_supercell(name1), 2);
+  EXPECT_EQ(configurations.count_by_supercell(name2), 16);
+  EXPECT_EQ(configurations.count_by_supercell("SCEL_missing"), 0);
+
+  // records of a supercell are contiguous and share one supercell name
+  auto range = configurations.supercell_range(name2);
+  EXPECT_EQ(std::distance(range.first, range.second), 16);
+  for (auto it = range.first; it != range.second; ++it) {
+    EXPECT_EQ(it->supercell_name_ptr(), range.first->supercell_name_ptr());
+    EXPECT_EQ(configurations.find_by_name(it->configuration_name()), it);
+  }
+  EXPECT_EQ(range.second, configurations.end());
+
+  // erasing the first and last records of a supercell updates the range
+  configurations.erase(range.first);
+  configurations.erase(std::prev(configurations.end()));
+  range = configurations.supercell_range(name2);
+  EXPECT_EQ(std::distance(range.first, range.second), 14);
+  EXPECT_EQ(configurations.count_by_supercell(name2), 14);
+  configurations.erase(configurations.begin());
+  configurations.erase(configurations.begin());
+  EXPECT_EQ(configurations.count_by_supercell(name1), 0);
+  range = configurations.supercell_range(name1);
+  EXPECT_EQ(range.first, configurations.end());
+  EXPECT_EQ(range.second, configurations.end());
+
+  // configuration ids must be non-negative integers
+  EXPECT_EQ(config::parse_configuration_id("12").value(), 12);
+  EXPECT_FALSE(config::parse_configuration_id("").has_value());
+  EXPECT_FALSE(config::parse_configuration_id("01").has_value());
+  EXPECT_FALSE(config::parse_configuration_id("-1").has_value());
+  EXPECT_FALSE(config::parse_configuration_id("a").has_value());
+  EXPECT_THROW(config::ConfigurationRecord(config::Configuration(supercell1),
+                                           name1, "a"),
+               std::runtime_error);
+
+  // a supercell name that splits another supercell's records is rejected
+  config::Configuration configuration(supercell2);
+  configuration.dof_values.occupation(0) = 1;
+  configurations.erase(configuration);
+  EXPECT_THROW(configurations.insert(
+                   config::ConfigurationRecord(configuration, name1, "5")),
+               std::runtime_error);
+  EXPECT_EQ(configurations.count(configuration), 0);
+  EXPECT_EQ(configurations.size(), 13);
+}
+
+TEST(ConfigurationSetTest, ContinuousDoFIndex) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  double tol = prim->basicstructure->lattice().tol();
+
+  config::ConfigurationSet configurations;
+  config::Configuration configuration(supercell);
+  configuration.dof_values.local_dof_values.at("disp")(0, 1) = 0.5 * tol;
+  EXPECT_TRUE(configurations.insert(configuration).second);
+
+  // equal within tolerance, but rounds to a different fingerprint
+  config::Configuration close(configuration);
+  close.dof_values.local_dof_values.at("disp")(0, 1) = 0.4 * tol;
+  EXPECT_NE(config::make_configuration_fingerprint(configuration),
+            config::make_configuration_fingerprint(close));
+  EXPECT_EQ(configurations.count(close), 1);
+  EXPECT_FALSE(configurations.insert(close).second);
+
+  config::Configuration different(configuration);
+  different.dof_values.global_dof_values.at("GLstrain")(0) = 0.01;
+  EXPECT_EQ(configurations.count(different), 0);
+  EXPECT_TRUE(configurations.insert(different).second);
+  EXPECT_EQ(configurations.size(), 2);
+}
+
+TEST(ConfigurationSetTest, ConcurrentInsert) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  std::vector<config::Configuration> all;
+  for (Index count = 0; count < 256; ++count) {
+    config::Configuration configuration(supercell);
+    for (Index l = 0; l < 8; ++l) {
+      configuration.dof_values.occupation(l) = (count >> l) & 1;
+    }
+    all.push_back(configuration);
+  }
+
+  // sequential reference: first 16 already present, the rest inserted in
+  // configuration order
+  config::ConfigurationSet expected;
+  for (Index i = 0; i < 16; ++i) {
+    expected.insert(all[i]);
+  }
+  config::ConfigurationSet configurations(expected);
+  std::set<config::Configuration> sorted(all.begin() + 16, all.end());
+  for (auto const &configuration : sorted) {
+    expected.insert(configuration);
+  }
+
+  // each thread inserts all configurations, in a different order
+  config::ConcurrentConfigurationSet concurrent(configurations, 8);
+  Index n_threads = 4;
+  std::vector<Index> n_staged(n_threads, 0);
+  std::vector<std::thread> threads;
+  for (Index t = 0; t < n_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (Index i = 0; i < all.size(); ++i) {
+        Index j = (i * (2 * t + 1) + 17 * t) % all.size();
+        if (concurrent.insert(all[j])) {
+          ++n_staged[t];
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(n_staged[0] + n_staged[1] + n_staged[2] + n_staged[3], 240);
+  EXPECT_EQ(concurrent.size(), 240);
+
+  auto inserted = concurrent.merge_into(configurations);
+  EXPECT_EQ(inserted.size(), 240);
+  EXPECT_EQ(concurrent.size(), 0);
+  ASSERT_EQ(configurations.size(), expected.size());
+  for (auto const &record : expected) {
+    auto it = configurations.find(record.configuration);
+    ASSERT_TRUE(it != configurations.end());
+    EXPECT_EQ(it->configuration_name(), record.configuration_name());
+  }
+}
+
+TEST(ConfigurationSetTest, ConcurrentSupercellSetInsert) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::SupercellSet supercells(prim);
+  config::ConcurrentSupercellSet concurrent(supercells);
+
+  std::vector<std::thread> threads;
+  for (Index t = 0; t < 4; ++t) {
+    threads.emplace_back([&]() {
+      for (Index n = 1; n <= 4; ++n) {
+        Eigen::Matrix3l T = n * Eigen::Matrix3l::Identity();
+        config::SupercellRecord const &record = concurrent.insert(T);
+        EXPECT_EQ(record.supercell->superlattice.size(), n * n * n);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(concurrent.size(), 4);
+  EXPECT_EQ(supercells.size(), 4);
+}
+
+TEST(ConfigurationSetTest, InsertSupercells) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::SupercellSet supercells(prim);
+  Eigen::Matrix3l T2 = 2 * Eigen::Matrix3l::Identity();
+  supercells.insert(T2);
+
+  std::vector<Eigen::Matrix3l> matrices;
+  for (Index i = 0; i < 3; ++i) {
+    for (Index n = 1; n <= 4; ++n) {
+      matrices.push_back(n * Eigen::Matrix3l::Identity());
+    }
+  }
+  auto records = config::insert_supercells(supercells, matrices, 4);
+  ASSERT_EQ(records.size(), matrices.size());
+  EXPECT_EQ(supercells.size(), 4);
+  for (Index i = 0; i < Index(matrices.size()); ++i) {
+    auto const &superlattice = records[i]->supercell->superlattice;
+    EXPECT_EQ(superlattice.transformation_matrix_to_super(), matrices[i]);
+    EXPECT_EQ(records[i], &*supercells.find(matrices[i]));
+  }
+
+  std::vector<std::string> names;
+  for (auto const &record : supercells) {
+    names.push_back(record.canonical_supercell_name);
+  }
+  names.push_back(names.front());
+  config::SupercellSet canonical_supercells(prim);
+  auto canonical_records =
+      config::insert_canonical_supercells(canonical_supercells, names, 2);
+  ASSERT_EQ(canonical_records.size(), names.size());
+  for (Index i = 0; i < Index(names.size()); ++i) {
+    EXPECT_TRUE(canonical_records[i]->is_canonical);
+    EXPECT_EQ(canonical_records[i]->supercell_name, names[i]);
+  }
+  EXPECT_EQ(canonical_records.front(), canonical_records.back());
+
+  EXPECT_ANY_THROW(
+      config::insert_canonical_supercells(canonical_supercells, {"bad"}, 2));
+}
+
+TEST(ConfigurationSetTest, MemoryUsage) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::SupercellSet supercells(prim);
+  Eigen::Matrix3l T = 2 * Eigen::Matrix3l::Identity();
+  auto supercell = supercells.insert(T).first->supercell;
+  supercells.insert(Eigen::Matrix3l(Eigen::Matrix3l::Identity()));
+
+  config::MemoryUsageContext context;
+  config::SupercellSetMemoryUsage supercells_usage =
+      config::make_memory_usage(supercells, context);
+  ASSERT_EQ(supercells_usage.supercells.size(), 2);
+  EXPECT_GT(supercells_usage.records_bytes, 0);
+  EXPECT_EQ(supercells_usage.total_bytes(), config::memory_usage(supercells));
+
+  config::ConfigurationSet configurations;
+  EXPECT_EQ(config::memory_usage(configurations),
+            Index(sizeof(config::ConfigurationSet)));
+  for (Index count = 0; count < 16; ++count) {
+    config::Configuration configuration(supercell);
+    for (Index l = 0; l < 4; ++l) {
+      configuration.dof_values.occupation(l) = (count >> l) & 1;
+    }
+    configurations.insert(configuration);
+  }
+
+  // the shared supercell is counted once
+  Index supercell_bytes = config::memory_usage(*supercell);
+  Index total_bytes = config::memory_usage(configurations);
+  EXPECT_GT(total_bytes, supercell_bytes + 16 * 8 * Index(sizeof(int)));
+  EXPECT_LT(total_bytes, 2 * supercell_bytes + 16 * 1024);
+
+  // supercells already counted with the SupercellSet are not counted again
+  Index configurations_only_bytes =
+      config::memory_usage(configurations, context);
+  EXPECT_EQ(configurations_only_bytes, total_bytes - supercell_bytes);
+}
+
+TEST(ConfigurationSetTest, PrimitiveCanonicalIndex) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T1, T2;
+  T1 << 1, 0, 0, 0, 1, 0, 0, 0, 2;
+  T2 << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell_1 = std::make_shared<config::Supercell const>(prim, T1);
+  auto supercell_2 = std::make_shared<config::Supercell const>(prim, T2);
+
+  config::Configuration motif(supercell_1);
+  motif.dof_values.occupation << 0, 1;
+  // the same configuration, in a larger supercell
+  config::Configuration larger = config::copy_configuration(motif, supercell_2);
+  // an equivalent configuration, in the canonical primitive supercell
+  config::Configuration primitive_canonical =
+      config::make_primitive_canonical_form(motif);
+  ASSERT_EQ(config::make_primitive_canonical_key(larger),
+            config::make_primitive_canonical_key(motif));
+
+  config::ConfigurationSet configurations;
+  EXPECT_FALSE(configurations.has_primitive_canonical_index());
+  EXPECT_THROW(configurations.find_primitive_canonical(motif),
+               std::runtime_error);
+  auto it = configurations.insert(motif).first;
+  EXPECT_FALSE(it->primitive_canonical_key().has_value());
+
+  // enabling finds keys for records already in the set
+  configurations.set_primitive_canonical_index(true);
+  ASSERT_TRUE(it->primitive_canonical_key().has_value());
+  EXPECT_EQ(*it->primitive_canonical_key(),
+            config::make_primitive_canonical_key(motif));
+  EXPECT_EQ(configurations.find_primitive_canonical(larger), it);
+  EXPECT_EQ(configurations.find_primitive_canonical(primitive_canonical), it);
+  EXPECT_EQ(configurations.find_primitive_canonical(motif), it);
+
+  // not equivalent
+  config::Configuration pure(supercell_2);
+  EXPECT_EQ(configurations.find_primitive_canonical(pure),
+            configurations.end());
+
+  // keys are found on insert, and kept by copies
+  auto pure_it = configurations.insert(pure).first;
+  EXPECT_TRUE(pure_it->primitive_canonical_key().has_value());
+  config::ConfigurationSet copy(configurations);
+  EXPECT_TRUE(copy.has_primitive_canonical_index());
+  EXPECT_EQ(copy.find_primitive_canonical(config::Configuration(supercell_1)),
+            copy.find(pure));
+
+  // erased records are removed from the index
+  configurations.erase(it);
+  EXPECT_EQ(configurations.find_primitive_canonical(larger),
+            configurations.end());
+}
@@ -0,0 +1,92 @@
+#include "casm/configuration/ConfigurationView.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(ConfigurationViewTest, OccupationMatchesConfiguration) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+
+  config::Configuration configuration(supercell);
+  Index n_sites = configuration.dof_values.occupation.size();
+  std::vector<int> occupation(n_sites);
+  for (Index count = 0; count < (Index(1) << n_sites); ++count) {
+    for (Index l = 0; l < n_sites; ++l) {
+      occupation[l] = (count >> l) & 1;
+      configuration.dof_values.occupation(l) = occupation[l];
+    }
+    config::ConfigurationView view(supercell, occupation.data());
+
+    EXPECT_EQ(is_canonical(view, begin, end),
+              is_canonical(configuration, begin, end));
+    EXPECT_EQ(to_canonical(view, begin, end),
+              to_canonical(configuration, begin, end));
+    EXPECT_EQ(make_invariant_subgroup(view, begin, end),
+              make_invariant_subgroup(configuration, begin, end));
+
+    config::Configuration copy = make_configuration(view);
+    EXPECT_EQ(copy.dof_values.occupation, configuration.dof_values.occupation);
+    EXPECT_EQ(
+        copy_configuration(view, supercell).dof_values.occupation,
+        copy_configuration(configuration, supercell).dof_values.occupation);
+  }
+}
+
+TEST(ConfigurationViewTest, LocalDoFMatchesConfiguration) {
+  auto prim = config::make_shared_prim(test::FCC_binary_disp_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 1, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+
+  config::Configuration configuration(supercell);
+  Eigen::MatrixXd &disp = configuration.dof_values.local_dof_values.at("disp");
+  disp.col(0) << 0.01, 0.0, 0.0;
+  disp.col(1) << 0.0, 0.02, 0.0;
+  std::vector<int> occupation = {1, 0};
+  configuration.dof_values.occupation << 1, 0;
+  std::vector<double> disp_values(disp.data(), disp.data() + disp.size());
+
+  config::ConfigurationView view(supercell, occupation.data(),
+                                 {{"disp", disp_values.data()}});
+  EXPECT_EQ(is_canonical(view, begin, end),
+            is_canonical(configuration, begin, end));
+  EXPECT_EQ(to_canonical(view, begin, end),
+            to_canonical(configuration, begin, end));
+  EXPECT_EQ(make_invariant_subgroup(view, begin, end),
+            make_invariant_subgroup(configuration, begin, end));
+
+  for (auto it = begin; it != end; ++it) {
+    config::Configuration expected = copy_apply(*it, configuration);
+    config::Configuration result = copy_apply(*it, view);
+    EXPECT_EQ(result.dof_values.occupation, expected.dof_values.occupation);
+    EXPECT_TRUE(result.dof_values.local_dof_values.at("disp").isApprox(
+        expected.dof_values.local_dof_values.at("disp")));
+  }
+
+  // a view of a Configuration references its values
+  config::ConfigurationView config_view(configuration);
+  EXPECT_EQ(config_view.dof_values.occupation.data(),
+            configuration.dof_values.occupation.data());
+  EXPECT_EQ(config_view.dof_values.local_dof_values.at("disp").data(),
+            disp.data());
+
+  // DoF not in the prim, or missing, throw
+  EXPECT_THROW(config::ConfigurationView(supercell, occupation.data(),
+                                         {{"disp", disp_values.data()},
+                                          {"magspin", disp_values.data()}}),
+               std::runtime_error);
+  EXPECT_THROW(config::ConfigurationView(supercell, occupation.data()),
+               std::runtime_error);
+}
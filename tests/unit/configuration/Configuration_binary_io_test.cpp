@@ -0,0 +1,161 @@
+#include "casm/configuration/io/binary/Configuration_binary_io.hh"
+
+#include <sstream>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(ConfigurationBinaryIOTest, OccupationReadWrite) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T1, T2;
+  T1 << 2, 0, 0, 0, 1, 0, 0, 0, 1;
+  T2 << 1, 0, 0, 0, 1, 0, 0, 0, 3;
+  auto supercell_1 = std::make_shared<config::Supercell const>(prim, T1);
+  auto supercell_2 = std::make_shared<config::Supercell const>(prim, T2);
+
+  std::vector<config::Configuration> configurations;
+  std::stringstream ss;
+  config::ConfigurationBinaryWriter writer(ss);
+  for (Index i = 0; i < 4; ++i) {
+    config::Configuration configuration(i % 2 ? supercell_1 : supercell_2);
+    configuration.dof_values.occupation(0) = i / 2;
+    configurations.push_back(configuration);
+    writer.write(configuration);
+  }
+
+  config::SupercellSet supercells(prim);
+  config::ConfigurationBinaryReader<config::Configuration> reader(ss,
+                                                                  supercells);
+  Index i = 0;
+  while (reader.is_valid()) {
+    ASSERT_LT(i, configurations.size());
+    EXPECT_EQ(reader.value(), configurations[i]);
+    EXPECT_TRUE(reader.configuration_id().empty());
+    ++i;
+    reader.advance();
+  }
+  EXPECT_EQ(i, 4);
+  EXPECT_EQ(supercells.size(), 2);
+}
+
+TEST(ConfigurationBinaryIOTest, ContinuousDoFToBytes) {
+  auto prim =
+      config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  config::Configuration configuration(supercell);
+  configuration.dof_values.occupation(3) = 2;
+  configuration.dof_values.local_dof_values.at("disp")(2, 2) = 0.123456789;
+  configuration.dof_values.global_dof_values.at("GLstrain")(2) = -0.01;
+
+  config::SupercellSet supercells(prim);
+  config::Configuration read_configuration =
+      config::from_bytes<config::Configuration>(config::to_bytes(configuration),
+                                                supercells);
+  EXPECT_EQ(read_configuration, configuration);
+  EXPECT_EQ(read_configuration.dof_values.local_dof_values.at("disp")(2, 2),
+            0.123456789);
+
+  std::map<std::string, Eigen::VectorXd> global_properties;
+  global_properties["energy"] = Eigen::VectorXd::Constant(1, -1.5);
+  config::ConfigurationWithProperties with_properties(configuration, {},
+                                                      global_properties);
+  auto read_with_properties =
+      config::from_bytes<config::ConfigurationWithProperties>(
+          config::to_bytes(with_properties), supercells);
+  EXPECT_EQ(read_with_properties.configuration, configuration);
+  EXPECT_EQ(read_with_properties.global_properties.at("energy")(0), -1.5);
+  EXPECT_EQ(supercells.size(), 1);
+}
+
+TEST(ConfigurationBinaryIOTest, ConfigurationSetReadWrite) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::SupercellSet supercells(prim);
+  Eigen::Matrix3l T;
+  T << 1, 0, 0, 0, 1, 0, 0, 0, 2;
+  auto supercell =
+      supercells.insert(std::make_shared<config::Supercell const>(prim, T))
+          .first->supercell;
+
+  config::ConfigurationSet configurations;
+  for (Index i = 0; i < 3; ++i) {
+    config::Configuration configuration(supercell);
+    configuration.dof_values.occupation(0) = i % 2;
+    configuration.dof_values.occupation(1) = i / 2;
+    configurations.insert(configuration);
+  }
+
+  std::stringstream ss;
+  config::write_binary(ss, configurations);
+  config::ConfigurationSet read_configurations;
+  config::read_binary(ss, supercells, read_configurations);
+
+  ASSERT_EQ(read_configurations.size(), configurations.size());
+  auto it = configurations.begin();
+  auto read_it = read_configurations.begin();
+  for (; it != configurations.end(); ++it, ++read_it) {
+    EXPECT_EQ(read_it->configuration, it->configuration);
+    EXPECT_EQ(read_it->supercell_name(), it->supercell_name());
+    EXPECT_EQ(read_it->configuration_id(), it->configuration_id());
+  }
+  EXPECT_EQ(read_configurations.next_config_id(),
+            configurations.next_config_id());
+}
+
+TEST(ConfigurationBinaryIOTest, PrimitiveCanonicalKeyReadWrite) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::SupercellSet supercells(prim);
+  Eigen::Matrix3l T;
+  T << 1, 0, 0, 0, 1, 0, 0, 0, 2;
+  auto supercell =
+      supercells.insert(std::make_shared<config::Supercell const>(prim, T))
+          .first->supercell;
+
+  config::ConfigurationSet configurations;
+  configurations.set_primitive_canonical_index(true);
+  // non-equivalent: A-A, B-B, A-B
+  for (Index i = 0; i < 3; ++i) {
+    config::Configuration configuration(supercell);
+    configuration.dof_values.occupation(0) = (i == 1);
+    configuration.dof_values.occupation(1) = (i >= 1);
+    configurations.insert(configuration);
+  }
+
+  std::stringstream ss;
+  config::write_binary(ss, configurations);
+  config::ConfigurationSet read_configurations;
+  config::read_binary(ss, supercells, read_configurations);
+
+  // keys are read, and used when the index is enabled
+  ASSERT_EQ(read_configurations.size(), configurations.size());
+  auto it = configurations.begin();
+  auto read_it = read_configurations.begin();
+  for (; it != configurations.end(); ++it, ++read_it) {
+    ASSERT_TRUE(read_it->primitive_canonical_key().has_value());
+    EXPECT_EQ(read_it->primitive_canonical_key(),
+              it->primitive_canonical_key());
+  }
+  read_configurations.set_primitive_canonical_index(true);
+  for (auto const &record : configurations) {
+    EXPECT_EQ(
+        read_configurations.find_primitive_canonical(record.configuration)
+            ->configuration,
+        record.configuration);
+  }
+}
+
+TEST(ConfigurationBinaryIOTest, InvalidHeader) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  std::stringstream ss("not a binary configuration stream");
+  config::SupercellSet supercells(prim);
+  EXPECT_THROW(
+      config::ConfigurationBinaryReader<config::Configuration>(ss, supercells),
+      std::runtime_error);
+}
@@ -1,6 +1,7 @@
 #include "casm/configuration/Configuration.hh"
 
 #include "casm/casm_io/json/jsonParser.hh"
+#include "casm/clexulator/ConfigDoFValuesTools.hh"
 #include "casm/configuration/Prim.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/canonical_form.hh"
@@ -60,6 +61,51 @@ TEST(ConfigurationTest, Test1) {
   EXPECT_EQ(dof_values.occupation, expected);
 }
 
+TEST(ConfigurationTest, StandardDoFValues) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  config::Configuration configuration(supercell);
+  auto &dof_values = configuration.dof_values;
+  dof_values.occupation(1) = 2;
+  auto &disp = dof_values.local_dof_values.at("disp");
+  for (Index i = 0; i < disp.size(); ++i) {
+    disp.data()[i] = 0.01 * (i + 1);
+  }
+  auto &strain = dof_values.global_dof_values.at("GLstrain");
+  for (Index i = 0; i < strain.size(); ++i) {
+    strain(i) = 0.001 * (i + 1);
+  }
+
+  Index n_sublat = prim->basicstructure->basis().size();
+  Index n_unitcells = supercell->unitcell_index_converter.total_sites();
+  clexulator::ConfigDoFValues expected = clexulator::to_standard_values(
+      dof_values, n_sublat, n_unitcells, prim->global_dof_info,
+      prim->local_dof_info);
+
+  // storage is reused by later calls
+  clexulator::ConfigDoFValues standard;
+  config::make_standard_dof_values(configuration, standard);
+  double const *disp_data = standard.local_dof_values.at("disp").data();
+  config::make_standard_dof_values(configuration, standard);
+  EXPECT_EQ(standard.local_dof_values.at("disp").data(), disp_data);
+  EXPECT_EQ(standard.occupation, expected.occupation);
+  EXPECT_TRUE(standard.local_dof_values.at("disp").isApprox(
+      expected.local_dof_values.at("disp")));
+  EXPECT_TRUE(standard.global_dof_values.at("GLstrain")
+                  .isApprox(expected.global_dof_values.at("GLstrain")));
+
+  // round trip
+  config::Configuration other(supercell);
+  config::set_standard_dof_values(other, standard);
+  EXPECT_EQ(other.dof_values.occupation, dof_values.occupation);
+  EXPECT_TRUE(other.dof_values.local_dof_values.at("disp").isApprox(disp));
+  EXPECT_TRUE(
+      other.dof_values.global_dof_values.at("GLstrain").isApprox(strain));
+}
+
 TEST(ConfigurationJsonTest, Test1) {
   std::shared_ptr<config::Prim const> prim =
       config::make_shared_prim(test::FCC_binary_prim());
@@ -0,0 +1,65 @@
+#include "casm/configuration/DiagonalIndexConverter.hh"
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymInfo.hh"
+#include "casm/crystallography/LinearIndexConverter.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+void check_diagonal_index_converter(config::Supercell const &supercell,
+                                    bool is_power_of_two) {
+  ASSERT_NE(supercell.diagonal_index_converter, nullptr);
+  auto const &fast = *supercell.diagonal_index_converter;
+  auto const &ijk = supercell.unitcell_index_converter;
+  auto const &bijk = supercell.unitcellcoord_index_converter;
+  EXPECT_EQ(fast.is_power_of_two(), is_power_of_two);
+  EXPECT_EQ(fast.n_unitcells(), ijk.total_sites());
+  EXPECT_EQ(fast.n_sites(), bijk.total_sites());
+
+  xtal::UnitCell shift(-3, 5, 7);
+  for (Index l = 0; l < bijk.total_sites(); ++l) {
+    xtal::UnitCellCoord site = bijk(l) + shift;
+    EXPECT_EQ(fast.linear_site_index(site), bijk(site));
+    EXPECT_EQ(supercell.linear_site_index(site), bijk(site));
+    EXPECT_EQ(supercell.linear_unitcell_index(site.unitcell()),
+              ijk(site.unitcell()));
+  }
+
+  for (Index t = 0; t < ijk.total_sites(); ++t) {
+    sym_info::Permutation expected =
+        config::make_translation_permutation(t, ijk, bijk);
+    EXPECT_EQ(fast.make_translation_permutation(t), expected);
+    for (Index l = 0; l < bijk.total_sites(); ++l) {
+      EXPECT_EQ(fast.translation_permute_index(t, l), expected[l]);
+      EXPECT_EQ(fast.translate_site_index(l, t), bijk(bijk(l) + ijk(t)));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(DiagonalIndexConverterTest, Test1) {
+  auto prim = config::make_shared_prim(test::ZrO_prim());
+
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 4;
+  check_diagonal_index_converter(config::Supercell(prim, T), true);
+
+  T << 3, 0, 0, 0, 2, 0, 0, 0, 1;
+  check_diagonal_index_converter(config::Supercell(prim, T), false);
+
+  // translation permutations are not stored; the cache and direct paths
+  // use the fast converter
+  T << 4, 0, 0, 0, 4, 0, 0, 0, 8;
+  config::Supercell large(prim, T);
+  EXPECT_FALSE(large.sym_info.translation_permutations.has_value());
+  check_diagonal_index_converter(large, true);
+
+  T << 1, 1, 0, 0, 2, 0, 0, 0, 1;
+  EXPECT_EQ(config::Supercell(prim, T).diagonal_index_converter, nullptr);
+}
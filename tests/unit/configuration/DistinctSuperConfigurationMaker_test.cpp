@@ -0,0 +1,97 @@
+#include "casm/configuration/DistinctSuperConfigurationMaker.hh"
+
+#include "casm/configuration/ConfigurationFingerprint.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/configuration/enumeration/enumerate_supercells.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class DistinctSuperConfigurationMakerTest : public testing::Test {
+ protected:
+  DistinctSuperConfigurationMakerTest() {
+    prim = config::make_shared_prim(test::FCC_binary_prim());
+    Eigen::Matrix3l T;
+    T << 1, 0, 0, 0, 1, 0, 0, 0, 2;
+    motif_supercell = std::make_shared<config::Supercell const>(prim, T);
+    supercells = config::enumerate_canonical_supercells(prim, 8);
+  }
+
+  config::Configuration make_motif() const {
+    config::Configuration motif(motif_supercell);
+    motif.dof_values.occupation(0) = 1;
+    return motif;
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<config::Supercell const> motif_supercell;
+  std::vector<std::shared_ptr<config::Supercell const>> supercells;
+};
+
+TEST_F(DistinctSuperConfigurationMakerTest, MatchesSingleSupercell) {
+  config::Configuration motif = make_motif();
+  config::DistinctSuperConfigurationMaker f(motif);
+  Index n_found = 0;
+  for (auto const &supercell : supercells) {
+    std::vector<config::Configuration> expected =
+        config::make_distinct_super_configurations(motif, supercell);
+    EXPECT_EQ(f(supercell), expected);
+    n_found += expected.size();
+  }
+  EXPECT_GT(n_found, 0);
+  // supercells with the same factor group share double coset representatives
+  EXPECT_LT(f.n_cached_factor_groups(), Index(supercells.size()));
+
+  for (Index n_threads : {1, 4}) {
+    std::vector<std::vector<config::Configuration>> by_supercell =
+        config::make_distinct_super_configurations(motif, supercells,
+                                                   n_threads);
+    ASSERT_EQ(by_supercell.size(), supercells.size());
+    for (Index i = 0; i < supercells.size(); ++i) {
+      EXPECT_EQ(by_supercell[i], f(supercells[i]));
+    }
+  }
+}
+
+TEST_F(DistinctSuperConfigurationMakerTest, FixedOrientation) {
+  config::Configuration motif = make_motif();
+  auto calculator =
+      std::make_shared<config::InvariantFingerprintCalculator const>(prim);
+
+  // serial, one supercell at a time
+  config::DistinctConfigurationFinder expected_finder(calculator);
+  std::vector<config::Configuration> expected;
+  xtal::Lattice motif_lattice = motif_supercell->superlattice.superlattice();
+  for (auto const &supercell : supercells) {
+    for (auto const &equiv : config::make_equivalents(*supercell)) {
+      if (!is_superlattice(equiv->superlattice.superlattice(), motif_lattice,
+                           motif_lattice.tol())
+               .first) {
+        continue;
+      }
+      config::Configuration super = config::copy_configuration(motif, equiv);
+      if (expected_finder.insert(super)) {
+        expected.push_back(super);
+      }
+    }
+  }
+  ASSERT_GT(expected.size(), 1);
+
+  for (Index n_threads : {1, 4}) {
+    config::DistinctConfigurationFinder finder(calculator);
+    config::SupercellSet supercell_set(prim);
+    std::vector<config::Configuration> found =
+        config::make_fixed_orientation_super_configurations(
+            motif, supercells, finder, &supercell_set, n_threads);
+    EXPECT_EQ(found, expected);
+    EXPECT_GE(supercell_set.size(), supercells.size());
+    for (auto const &configuration : found) {
+      auto it = supercell_set.find(configuration.supercell);
+      ASSERT_TRUE(it != supercell_set.end());
+      EXPECT_EQ(it->supercell, configuration.supercell);
+    }
+  }
+}
@@ -0,0 +1,82 @@
+#include "casm/configuration/DoFSpaceRepCache.hh"
+
+#include "casm/clexulator/DoFSpace.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class DoFSpaceRepCacheTest : public testing::Test {
+ protected:
+  DoFSpaceRepCacheTest() {
+    prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+    T << 2, 0, 0, 0, 1, 0, 0, 0, 1;
+    supercell = std::make_shared<config::Supercell const>(prim, T);
+    group = std::vector<config::SupercellSymOp>(
+        config::SupercellSymOp::begin(supercell),
+        config::SupercellSymOp::end(supercell));
+  }
+
+  void expect_equal(std::vector<Eigen::MatrixXd> const &A,
+                    std::vector<Eigen::MatrixXd> const &B) {
+    ASSERT_EQ(A.size(), B.size());
+    for (Index i = 0; i < A.size(); ++i) {
+      EXPECT_TRUE(almost_equal(A[i], B[i]));
+    }
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  Eigen::Matrix3l T;
+  std::shared_ptr<config::Supercell const> supercell;
+  std::vector<config::SupercellSymOp> group;
+};
+
+TEST_F(DoFSpaceRepCacheTest, GlobalDoF) {
+  clexulator::DoFSpace dof_space("GLstrain", prim->basicstructure);
+  config::DoFSpaceRepCache cache;
+  auto rep = cache.make(group, dof_space);
+  expect_equal(*rep, config::make_dof_space_rep(group, dof_space));
+  EXPECT_EQ(cache.size(), 1);
+
+  auto rep2 = cache.make(group, dof_space);
+  EXPECT_EQ(rep.get(), rep2.get());
+  EXPECT_EQ(cache.size(), 1);
+
+  // a different basis is a different entry
+  Eigen::MatrixXd basis = dof_space.basis.leftCols(2);
+  clexulator::DoFSpace subspace("GLstrain", prim->basicstructure,
+                                std::nullopt, std::nullopt, basis);
+  auto rep3 = cache.make(group, subspace);
+  EXPECT_NE(rep.get(), rep3.get());
+  EXPECT_EQ(cache.size(), 2);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST_F(DoFSpaceRepCacheTest, LocalDoF) {
+  clexulator::DoFSpace dof_space("disp", prim->basicstructure, T);
+  config::DoFSpaceRepCache cache;
+  auto rep = cache.make(group, dof_space);
+  expect_equal(*rep, config::make_dof_space_rep(group, dof_space));
+
+  // a subgroup is a different entry
+  std::vector<config::SupercellSymOp> subgroup(group.begin(),
+                                               group.begin() + 1);
+  auto rep2 = cache.make(subgroup, dof_space);
+  EXPECT_EQ(rep2->size(), 1);
+  EXPECT_EQ(cache.size(), 2);
+
+  // an equal supercell, constructed separately, shares the entry
+  auto supercell2 = std::make_shared<config::Supercell const>(prim, T);
+  std::vector<config::SupercellSymOp> group2(
+      config::SupercellSymOp::begin(supercell2),
+      config::SupercellSymOp::end(supercell2));
+  auto rep3 = cache.make(group2, dof_space);
+  EXPECT_EQ(rep.get(), rep3.get());
+  EXPECT_EQ(cache.size(), 2);
+}
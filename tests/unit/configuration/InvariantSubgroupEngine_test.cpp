@@ -0,0 +1,166 @@
+#include "casm/configuration/InvariantSubgroupEngine.hh"
+
+#include "casm/configuration/canonical_form.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Check InvariantSubgroupEngine against the canonical_form.hh functions
+void check_engine(config::InvariantSubgroupEngine const &engine,
+                  config::Configuration const &configuration) {
+  auto begin = config::SupercellSymOp::begin(engine.supercell());
+  auto end = config::SupercellSymOp::end(engine.supercell());
+
+  std::vector<config::SupercellSymOp> expected_invariant_subgroup =
+      make_invariant_subgroup(configuration, begin, end);
+  std::vector<config::SupercellSymOp> invariant_subgroup =
+      engine.make_invariant_subgroup(configuration);
+  EXPECT_EQ(invariant_subgroup, expected_invariant_subgroup);
+
+  std::vector<Index> expected_translations;
+  for (auto const &op : expected_invariant_subgroup) {
+    if (op.supercell_factor_group_index() == 0) {
+      expected_translations.push_back(op.translation_index());
+    }
+  }
+  EXPECT_EQ(engine.make_invariant_translation_indices(configuration),
+            expected_translations);
+
+  std::vector<config::Configuration> equivalents =
+      engine.make_equivalents(configuration);
+  EXPECT_EQ(equivalents, make_equivalents(configuration, begin, end));
+  EXPECT_EQ(equivalents.size() * invariant_subgroup.size(),
+            engine.n_factor_group() * engine.n_translations());
+}
+
+}  // namespace
+
+TEST(InvariantSubgroupEngineTest, FCCBinary) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::InvariantSubgroupEngine engine(supercell);
+  EXPECT_EQ(engine.n_factor_group(), 48);
+  EXPECT_EQ(engine.n_translations(), 8);
+
+  config::Configuration configuration(supercell);
+  for (Index count = 0; count < 256; ++count) {
+    test::set_occupation(configuration.dof_values.occupation, count, 2);
+    check_engine(engine, configuration);
+  }
+}
+
+TEST(InvariantSubgroupEngineTest, DoubleCosetRepresentatives) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::InvariantSubgroupEngine engine(supercell);
+  std::vector<config::SupercellSymOp> group(
+      config::SupercellSymOp::begin(supercell),
+      config::SupercellSymOp::end(supercell));
+  std::vector<config::SupercellSymOp> identity({group[0]});
+  std::vector<config::SupercellSymOp> translations(
+      group.begin(), group.begin() + engine.n_translations());
+
+  config::Configuration configuration(supercell);
+  configuration.dof_values.occupation << 1, 1, 0, 0, 0, 0, 0, 1;
+  auto subgroup = engine.make_invariant_subgroup(configuration);
+
+  EXPECT_EQ(engine.make_double_coset_representatives(identity, subgroup),
+            engine.make_left_coset_representatives(subgroup));
+  EXPECT_EQ(engine.make_double_coset_representatives(group, subgroup).size(),
+            1);
+
+  // one representative per orbit of the equivalents under translations
+  std::set<config::Configuration> orbits;
+  for (auto const &equivalent : engine.make_equivalents(configuration)) {
+    orbits.insert(make_canonical_form(equivalent, translations.begin(),
+                                      translations.end()));
+  }
+  EXPECT_EQ(
+      engine.make_double_coset_representatives(translations, subgroup).size(),
+      orbits.size());
+}
+
+TEST(InvariantSubgroupEngineTest, FCCTernaryPeriodic) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 6, 0, 0, 0, 1, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::InvariantSubgroupEngine engine(supercell);
+
+  // periodic configurations, given as occupation by position along a
+  config::Configuration configuration(supercell);
+  Eigen::VectorXi &occ = configuration.dof_values.occupation;
+  auto set_by_position = [&](std::vector<int> const &by_position) {
+    for (Index l = 0; l < occ.size(); ++l) {
+      auto bijk = supercell->unitcellcoord_index_converter(l);
+      Index i = ((bijk.unitcell()[0] % 6) + 6) % 6;
+      occ[l] = by_position[i];
+    }
+  };
+
+  set_by_position({1, 0, 1, 0, 1, 0});
+  check_engine(engine, configuration);
+  EXPECT_EQ(engine.make_invariant_translation_indices(configuration).size(),
+            3);
+  set_by_position({2, 1, 0, 2, 1, 0});
+  check_engine(engine, configuration);
+  EXPECT_EQ(engine.make_invariant_translation_indices(configuration).size(),
+            2);
+  set_by_position({2, 1, 1, 0, 0, 0});
+  check_engine(engine, configuration);
+  EXPECT_EQ(engine.make_invariant_translation_indices(configuration).size(),
+            1);
+}
+
+TEST(InvariantSubgroupEngineTest, FCCDimerAnisoOccupation) {
+  auto prim = config::make_shared_prim(test::FCC_dimer_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::InvariantSubgroupEngine engine(supercell);
+
+  config::Configuration configuration(supercell);
+  for (Index count = 0; count < 81; ++count) {
+    test::set_occupation(configuration.dof_values.occupation, count, 3);
+    check_engine(engine, configuration);
+  }
+}
+
+TEST(InvariantSubgroupEngineTest, FCCTernaryGLStrainDisp) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::InvariantSubgroupEngine engine(supercell);
+
+  config::Configuration configuration(supercell);
+  clexulator::ConfigDoFValues &dof_values = configuration.dof_values;
+  check_engine(engine, configuration);
+  dof_values.occupation(3) = 1;
+  check_engine(engine, configuration);
+  dof_values.local_dof_values.at("disp")(2, 2) = 1.0;
+  check_engine(engine, configuration);
+  dof_values.global_dof_values.at("GLstrain")(2) = 0.01;
+  check_engine(engine, configuration);
+
+  config::ConfigurationWithProperties configuration_with_properties(
+      configuration);
+  std::vector<config::ConfigurationWithProperties> equivalents =
+      engine.make_equivalents(configuration_with_properties);
+  std::vector<config::ConfigurationWithProperties> expected =
+      make_equivalents(configuration_with_properties,
+                       config::SupercellSymOp::begin(supercell),
+                       config::SupercellSymOp::end(supercell));
+  ASSERT_EQ(equivalents.size(), expected.size());
+  for (Index i = 0; i < equivalents.size(); ++i) {
+    EXPECT_EQ(equivalents[i].configuration, expected[i].configuration);
+  }
+}
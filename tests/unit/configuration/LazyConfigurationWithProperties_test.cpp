@@ -0,0 +1,93 @@
+#include "casm/configuration/LazyConfigurationWithProperties.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+config::ConfigurationWithProperties _make_configuration_with_properties(
+    std::shared_ptr<config::Supercell const> const &supercell) {
+  config::Configuration configuration(supercell);
+  clexulator::ConfigDoFValues &dof_values = configuration.dof_values;
+  dof_values.occupation(0) = 1;
+  dof_values.occupation(2) = 2;
+  dof_values.local_dof_values.at("disp")(0, 0) = 1.0;
+  dof_values.local_dof_values.at("disp")(1, 3) = 0.5;
+  dof_values.global_dof_values.at("GLstrain")(0) = 0.01;
+  dof_values.global_dof_values.at("GLstrain")(4) = 0.02;
+  return config::ConfigurationWithProperties(
+      configuration, {{"disp", dof_values.local_dof_values.at("disp")}},
+      {{"GLstrain", dof_values.global_dof_values.at("GLstrain")}});
+}
+
+}  // namespace
+
+TEST(LazyConfigurationWithPropertiesTest, CopyApply) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto original = std::make_shared<config::ConfigurationWithProperties const>(
+      _make_configuration_with_properties(supercell));
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  auto lazy_copies = config::make_lazy_copies(*original, begin, end);
+  Index i = 0;
+  for (auto it = begin; it != end; ++it, ++i) {
+    config::ConfigurationWithProperties expected = copy_apply(*it, *original);
+    config::LazyConfigurationWithProperties lazy =
+        config::copy_apply_lazy(*it, original);
+    EXPECT_EQ(lazy.configuration(), expected.configuration);
+    EXPECT_TRUE(lazy.has_local_property("disp"));
+    EXPECT_FALSE(lazy.has_local_property("force"));
+    EXPECT_EQ(lazy.global_property_keys(), std::set<std::string>({"GLstrain"}));
+    EXPECT_TRUE(almost_equal(lazy.local_property("disp"),
+                             expected.local_properties.at("disp")));
+    // cached value
+    EXPECT_TRUE(almost_equal(lazy.local_property("disp"),
+                             expected.local_properties.at("disp")));
+    EXPECT_TRUE(almost_equal(lazy.global_property("GLstrain"),
+                             expected.global_properties.at("GLstrain")));
+    EXPECT_THROW(lazy.global_property("energy"), std::runtime_error);
+
+    config::ConfigurationWithProperties materialized =
+        lazy_copies[i].materialize();
+    EXPECT_EQ(materialized.configuration, expected.configuration);
+    EXPECT_TRUE(almost_equal(materialized.local_properties.at("disp"),
+                             expected.local_properties.at("disp")));
+    EXPECT_TRUE(almost_equal(materialized.global_properties.at("GLstrain"),
+                             expected.global_properties.at("GLstrain")));
+  }
+  EXPECT_EQ(lazy_copies.size(), i);
+}
+
+TEST(LazyConfigurationWithPropertiesTest, MakeEquivalents) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::ConfigurationWithProperties original =
+      _make_configuration_with_properties(supercell);
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  auto expected = config::make_equivalents(original, begin, end);
+  auto lazy = config::make_lazy_equivalents(original, begin, end);
+  ASSERT_EQ(lazy.size(), expected.size());
+  for (Index i = 0; i < lazy.size(); ++i) {
+    EXPECT_EQ(lazy[i].configuration(), expected[i].configuration);
+    EXPECT_TRUE(almost_equal(lazy[i].local_property("disp"),
+                             expected[i].local_properties.at("disp")));
+    EXPECT_TRUE(almost_equal(lazy[i].global_property("GLstrain"),
+                             expected[i].global_properties.at("GLstrain")));
+  }
+}
@@ -0,0 +1,98 @@
+#include "casm/configuration/LocalConfigurationList.hh"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/io/binary/LocalConfigurationList_binary_io.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class LocalConfigurationListTest : public testing::Test {
+ protected:
+  LocalConfigurationListTest()
+      : prim(config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim())) {
+    std::mt19937 engine(1234);
+    std::uniform_int_distribution<int> occ_dist(0, 2);
+    std::uniform_int_distribution<int> choice(0, 1);
+
+    Eigen::Matrix3l T = Eigen::Matrix3l::Identity() * 2;
+    auto supercell = std::make_shared<config::Supercell const>(prim, T);
+    for (Index n = 0; n < 80; ++n) {
+      config::Configuration configuration(supercell);
+      auto &dof_values = configuration.dof_values;
+      for (Index l = 0; l < dof_values.occupation.size(); ++l) {
+        // mostly 0, so that equal local configurations occur often
+        dof_values.occupation(l) = (l < 2) ? occ_dist(engine) : 0;
+      }
+      dof_values.local_dof_values.at("disp")(0, 0) = 0.1 * choice(engine);
+      std::pair<Index, Index> pos(choice(engine), choice(engine));
+      values.emplace_back(configuration, pos);
+    }
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::vector<config::LocalConfiguration> values;
+};
+
+TEST_F(LocalConfigurationListTest, IndexMatchesLinearSearch) {
+  config::LocalConfigurationList list;
+  list.extend(values);
+  ASSERT_EQ(list.size(), values.size());
+
+  auto check = [&]() {
+    for (auto const &value : values) {
+      auto it = std::find(list.begin(), list.end(), value);
+      Index expected = (it == list.end()) ? -1 : it - list.begin();
+      EXPECT_EQ(list.index(value), expected);
+      EXPECT_EQ(list.contains(value), expected != -1);
+    }
+  };
+  check();
+
+  list.set(3, values[0]);
+  list.set(5, values[1]);
+  check();
+
+  list.erase(0);
+  list.erase(10);
+  check();
+
+  list.sort();
+  EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+  check();
+
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  check();
+}
+
+TEST_F(LocalConfigurationListTest, BinaryRoundTrip) {
+  config::LocalConfigurationList list;
+  list.extend(values);
+
+  std::string bytes = config::to_bytes(list);
+  config::SupercellSet supercells(prim);
+  config::LocalConfigurationList read =
+      config::local_configuration_list_from_bytes(bytes, supercells);
+  ASSERT_EQ(read.size(), list.size());
+  for (Index i = 0; i < list.size(); ++i) {
+    EXPECT_EQ(read.at(i).pos, list.at(i).pos);
+    EXPECT_TRUE(read.at(i) == list.at(i));
+    EXPECT_EQ(read.index(list.at(i)), list.index(list.at(i)));
+  }
+
+  config::LocalConfigurationList empty;
+  config::LocalConfigurationList read_empty =
+      config::local_configuration_list_from_bytes(config::to_bytes(empty),
+                                                  supercells);
+  EXPECT_TRUE(read_empty.empty());
+
+  EXPECT_THROW(config::local_configuration_list_from_bytes(
+                   bytes.substr(0, bytes.size() / 2), supercells),
+               std::runtime_error);
+}
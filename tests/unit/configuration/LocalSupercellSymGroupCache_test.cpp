@@ -0,0 +1,101 @@
+#include "casm/configuration/LocalSupercellSymGroupCache.hh"
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/group/Group.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class LocalSupercellSymGroupCacheTest : public testing::Test {
+ protected:
+  LocalSupercellSymGroupCacheTest() {
+    prim = config::make_shared_prim(test::FCC_binary_prim());
+    Eigen::Matrix3l T = 3 * Eigen::Matrix3l::Identity();
+    supercell = std::make_shared<config::Supercell const>(prim, T);
+
+    auto const &sym_info = prim->sym_info;
+    clust::IntegralCluster phenomenal(
+        {xtal::UnitCellCoord(0, 0, 0, 0), xtal::UnitCellCoord(0, 1, 0, 0)});
+    cluster_group = clust::make_cluster_group(
+        phenomenal, sym_info.factor_group,
+        prim->basicstructure->lattice().lat_column_mat(),
+        sym_info.unitcellcoord_symgroup_rep);
+  }
+
+  void expect_equal(std::vector<config::SupercellSymOp> const &A,
+                    std::vector<config::SupercellSymOp> const &B) {
+    ASSERT_EQ(A.size(), B.size());
+    for (Index i = 0; i < A.size(); ++i) {
+      EXPECT_EQ(A[i].supercell_factor_group_index(),
+                B[i].supercell_factor_group_index());
+      EXPECT_EQ(A[i].translation_index(), B[i].translation_index());
+    }
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<config::Supercell const> supercell;
+  std::shared_ptr<config::SymGroup const> cluster_group;
+};
+
+TEST_F(LocalSupercellSymGroupCacheTest, Test1) {
+  config::LocalSupercellSymGroupCache cache;
+  auto value = cache.get(cluster_group, supercell);
+  expect_equal(value->supercell_symgroup_rep,
+               config::make_local_supercell_symgroup_rep(cluster_group,
+                                                         supercell));
+  EXPECT_EQ(value->symgroup->element.size(),
+            value->supercell_symgroup_rep.size());
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.n_misses(), 1);
+  EXPECT_EQ(cache.size_bytes(), value->size_bytes());
+
+  // same supercell and group: shared
+  auto value2 = cache.get(cluster_group, supercell);
+  EXPECT_EQ(value.get(), value2.get());
+  EXPECT_EQ(cache.n_hits(), 1);
+
+  // different supercell: new entry
+  Eigen::Matrix3l T = 2 * Eigen::Matrix3l::Identity();
+  auto supercell2 = std::make_shared<config::Supercell const>(prim, T);
+  auto value3 = cache.get(cluster_group, supercell2);
+  EXPECT_NE(value.get(), value3.get());
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.n_misses(), 2);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.size_bytes(), 0);
+  EXPECT_EQ(value->supercell_symgroup_rep.size(),
+            value2->supercell_symgroup_rep.size());
+}
+
+TEST_F(LocalSupercellSymGroupCacheTest, MaxBytes) {
+  auto value = config::local_supercell_symgroup_cache().get(cluster_group,
+                                                            supercell);
+
+  // room for one value only: least recently used is evicted
+  config::LocalSupercellSymGroupCache cache(value->size_bytes());
+  auto cached = cache.get(cluster_group, supercell);
+  EXPECT_EQ(cache.size(), 1);
+
+  // an equal, but distinct, supercell is a different key of the same size
+  Eigen::Matrix3l T = 3 * Eigen::Matrix3l::Identity();
+  auto supercell2 = std::make_shared<config::Supercell const>(prim, T);
+  cache.get(cluster_group, supercell2);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_LE(cache.size_bytes(), cache.max_bytes());
+
+  cache.get(cluster_group, supercell);
+  EXPECT_EQ(cache.n_hits(), 0);
+  EXPECT_EQ(cache.n_misses(), 3);
+
+  // nothing stored
+  config::LocalSupercellSymGroupCache empty_cache(0);
+  empty_cache.get(cluster_group, supercell);
+  EXPECT_EQ(empty_cache.size(), 0);
+}
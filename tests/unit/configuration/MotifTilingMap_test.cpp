@@ -0,0 +1,108 @@
+#include "casm/configuration/MotifTilingMap.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class MotifTilingMapTest : public testing::Test {
+ protected:
+  MotifTilingMapTest() {
+    prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+    Eigen::Matrix3l T;
+    T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+    supercell = std::make_shared<config::Supercell const>(prim, T);
+
+    // conventional 4-site FCC cell, with distinct values on each site
+    motif = std::make_unique<config::Configuration>(supercell);
+    auto &dof_values = motif->dof_values;
+    dof_values.occupation << 0, 1, 2, 1;
+    Eigen::MatrixXd &disp = dof_values.local_dof_values.at("disp");
+    for (Index l = 0; l < disp.cols(); ++l) {
+      disp.col(l) << 0.01 * l, 0.02, -0.03 * l;
+    }
+    Eigen::VectorXd &strain = dof_values.global_dof_values.at("GLstrain");
+    strain << 0.01, 0.02, 0.03, 0.04, 0.05, 0.06;
+  }
+
+  void expect_equal(config::Configuration const &A,
+                    config::Configuration const &B) {
+    EXPECT_EQ(A.supercell, B.supercell);
+    EXPECT_EQ(A.dof_values.occupation, B.dof_values.occupation);
+    EXPECT_TRUE(almost_equal(A.dof_values.local_dof_values.at("disp"),
+                             B.dof_values.local_dof_values.at("disp")));
+    EXPECT_TRUE(almost_equal(A.dof_values.global_dof_values.at("GLstrain"),
+                             B.dof_values.global_dof_values.at("GLstrain")));
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<config::Supercell const> supercell;
+  std::unique_ptr<config::Configuration> motif;
+};
+
+TEST_F(MotifTilingMapTest, TransformMatchesSupercellSymOp) {
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  for (auto it = begin; it != end; ++it) {
+    config::MotifTilingMap map(it.prim_factor_group_index(),
+                               it.translation_frac(), supercell, supercell);
+    EXPECT_EQ(map.n_sites(), 4);
+    expect_equal(map.apply(*motif), copy_apply(*it, *motif));
+  }
+}
+
+TEST_F(MotifTilingMapTest, TilePrimitiveMotif) {
+  Eigen::Matrix3l T = Eigen::Matrix3l::Identity();
+  auto prim_supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration prim_motif = copy_configuration(*motif, prim_supercell);
+
+  config::MotifTilingMap map(prim_supercell, supercell);
+  EXPECT_FALSE(map.prim_factor_group_index().has_value());
+  for (Index i = 0; i < map.n_sites(); ++i) {
+    EXPECT_EQ(map.source_site_index()[i], 0);
+    EXPECT_EQ(map.source_sublattice_index()[i], 0);
+  }
+
+  config::Configuration super = map.apply(prim_motif);
+  EXPECT_EQ(super.dof_values.occupation, Eigen::VectorXi::Zero(4));
+  Eigen::MatrixXd const &disp = super.dof_values.local_dof_values.at("disp");
+  for (Index l = 0; l < disp.cols(); ++l) {
+    EXPECT_TRUE(
+        almost_equal(disp.col(l), Eigen::Vector3d(0.0, 0.02, 0.0).eval()));
+  }
+
+  // the motif must be in the motif supercell
+  EXPECT_THROW(map.apply(*motif), std::runtime_error);
+}
+
+TEST_F(MotifTilingMapTest, Cache) {
+  config::MotifTilingMapCache cache;
+  auto map = cache.make(supercell, supercell, xtal::UnitCell(1, 0, 0));
+  EXPECT_EQ(cache.size(), 1);
+  expect_equal(map->apply(*motif),
+               copy_configuration(*motif, supercell, xtal::UnitCell(1, 0, 0)));
+
+  // an equal supercell, constructed separately, shares the entry
+  Eigen::Matrix3l T = supercell->superlattice.transformation_matrix_to_super();
+  auto supercell2 = std::make_shared<config::Supercell const>(prim, T);
+  auto map2 = cache.make(supercell2, supercell2, xtal::UnitCell(1, 0, 0));
+  EXPECT_EQ(map.get(), map2.get());
+  EXPECT_EQ(cache.size(), 1);
+
+  // a different origin, or a transformation, is a different entry
+  auto map3 = cache.make(supercell, supercell);
+  EXPECT_NE(map.get(), map3.get());
+  auto map4 = cache.make(1, xtal::UnitCell(0, 0, 0), supercell, supercell);
+  EXPECT_TRUE(map4->prim_factor_group_index().has_value());
+  expect_equal(map4->apply(*motif),
+               copy_configuration(1, xtal::UnitCell(0, 0, 0), *motif,
+                                  supercell));
+  EXPECT_EQ(cache.size(), 3);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
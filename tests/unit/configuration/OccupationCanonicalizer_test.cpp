@@ -0,0 +1,60 @@
+#include "casm/configuration/OccupationCanonicalizer.hh"
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/ConfigurationBatch.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(OccupationCanonicalizerTest, MatchesCanonicalFormEngine) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::CanonicalFormEngine engine(supercell);
+
+  config::ConfigurationBatch batch(supercell);
+  config::Configuration configuration(supercell);
+  for (Index count = 0; count < 81; ++count) {
+    test::set_occupation(configuration.dof_values.occupation, count, 3);
+    batch.push_back(configuration);
+  }
+  std::vector<config::Configuration> configurations = batch.configurations();
+  std::vector<Index> expected_index =
+      engine.to_canonical_indices(configurations);
+
+  // the CPU reference, and the device, if available
+  for (bool use_device : {false, true}) {
+    config::OccupationCanonicalizer canonicalizer(engine, use_device);
+    if (!use_device) {
+      EXPECT_FALSE(canonicalizer.uses_device());
+    }
+    for (Index n_threads : {1, 2}) {
+      config::OccupationCanonicalizationResult result =
+          canonicalizer.canonicalize(batch, n_threads);
+      ASSERT_EQ(result.to_canonical_index.size(), configurations.size());
+      EXPECT_EQ(result.to_canonical_index, expected_index);
+      for (Index i = 0; i < Index(configurations.size()); ++i) {
+        EXPECT_EQ(bool(result.is_canonical[i]),
+                  engine.is_canonical(configurations[i]));
+      }
+    }
+  }
+}
+
+TEST(OccupationCanonicalizerTest, ContinuousDoFThrows) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << 1, 0, 0, 0, 1, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::CanonicalFormEngine engine(supercell);
+  config::ConfigurationBatch batch(supercell);
+  batch.push_back(config::Configuration(supercell));
+
+  config::OccupationCanonicalizer canonicalizer(engine);
+  EXPECT_THROW(canonicalizer.canonicalize(batch), std::runtime_error);
+}
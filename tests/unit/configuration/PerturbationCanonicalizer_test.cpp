@@ -0,0 +1,75 @@
+#include "casm/configuration/PerturbationCanonicalizer.hh"
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// \brief Check PerturbationCanonicalizer against CanonicalFormEngine for
+///     all occupations on `sites`
+void check_canonicalizer(
+    std::shared_ptr<config::CanonicalFormEngine const> const &engine,
+    config::Configuration const &background, std::set<Index> const &sites) {
+  config::PerturbationCanonicalizer canonicalizer(engine, background);
+  EXPECT_EQ(engine->ops().size() % canonicalizer.n_cosets(), 0);
+
+  config::ConfigEnumAllOccupations enumerator(background, sites);
+  while (enumerator.is_valid()) {
+    config::Configuration const &configuration = enumerator.value();
+    Index expected_index = engine->to_canonical_index(configuration);
+    EXPECT_EQ(canonicalizer.to_canonical_index(configuration, sites),
+              expected_index);
+    EXPECT_EQ(canonicalizer.to_canonical_index(configuration), expected_index);
+    EXPECT_EQ(canonicalizer.make_canonical_form(configuration, sites),
+              engine->make_canonical_form(configuration));
+    enumerator.advance();
+  }
+}
+
+}  // namespace
+
+TEST(PerturbationCanonicalizerTest, FCCTernary) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 3, 0, 0, 0, 3, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto engine = std::make_shared<config::CanonicalFormEngine const>(supercell);
+
+  // perfect background: one coset
+  config::Configuration background(supercell);
+  config::PerturbationCanonicalizer canonicalizer(engine, background);
+  EXPECT_EQ(canonicalizer.n_cosets(), 1);
+  check_canonicalizer(engine, background, {0, 1, 5});
+
+  // low symmetry background
+  Eigen::VectorXi &occupation = background.dof_values.occupation;
+  for (Index l = 0; l < occupation.size(); ++l) {
+    occupation(l) = (l * l + l / 3) % 3;
+  }
+  check_canonicalizer(engine, background, {0, 1, 5});
+  check_canonicalizer(engine, background, {2, 9, 10, 17});
+
+  // other supercell
+  auto other_supercell = std::make_shared<config::Supercell const>(
+      prim, Eigen::Matrix3l::Identity());
+  EXPECT_THROW(config::PerturbationCanonicalizer(
+                   engine, config::Configuration(other_supercell)),
+               std::runtime_error);
+}
+
+TEST(PerturbationCanonicalizerTest, FCCDimerAnisoOccupation) {
+  auto prim = config::make_shared_prim(test::FCC_dimer_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto engine = std::make_shared<config::CanonicalFormEngine const>(supercell);
+
+  config::Configuration background(supercell);
+  background.dof_values.occupation(0) = 2;
+  background.dof_values.occupation(3) = 1;
+  check_canonicalizer(engine, background, {1, 2});
+}
@@ -0,0 +1,92 @@
+#include "casm/configuration/PrimSymInfoCache.hh"
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/PrimSymInfo.hh"
+#include "casm/configuration/io/json/PrimSymInfo_json_io.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "gtest/gtest.h"
+#include "testdir.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+void expect_same_sym_info(config::PrimSymInfo const &A,
+                          config::PrimSymInfo const &B) {
+  ASSERT_EQ(A.factor_group->element.size(), B.factor_group->element.size());
+  for (Index i = 0; i < A.factor_group->element.size(); ++i) {
+    EXPECT_TRUE(A.factor_group->element[i].matrix.isApprox(
+        B.factor_group->element[i].matrix));
+  }
+  EXPECT_EQ(A.factor_group->multiplication_table,
+            B.factor_group->multiplication_table);
+  EXPECT_EQ(A.point_group->element.size(), B.point_group->element.size());
+  EXPECT_EQ(A.occ_symgroup_rep, B.occ_symgroup_rep);
+  EXPECT_EQ(A.local_dof_symgroup_rep.size(), B.local_dof_symgroup_rep.size());
+  EXPECT_EQ(A.global_dof_symgroup_rep.size(),
+            B.global_dof_symgroup_rep.size());
+}
+
+}  // namespace
+
+TEST(PrimSymInfoCacheTest, InMemory) {
+  xtal::BasicStructure prim = test::FCC_ternary_GLstrain_prim();
+  config::PrimSymInfoCache cache;
+
+  auto sym_info = cache.make(prim);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.make(prim), sym_info);
+  EXPECT_EQ(cache.size(), 1);
+  expect_same_sym_info(*sym_info, config::PrimSymInfo(prim));
+
+  cache.make(test::SimpleCubic_ising_prim());
+  EXPECT_EQ(cache.size(), 2);
+
+  auto shared_prim =
+      cache.make_prim(std::make_shared<xtal::BasicStructure const>(prim));
+  EXPECT_EQ(cache.size(), 2);
+  expect_same_sym_info(shared_prim->sym_info, *sym_info);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(PrimSymInfoCacheTest, OnDisk) {
+  xtal::BasicStructure prim = test::FCC_ternary_GLstrain_prim();
+  test::TmpDir tmp_dir;
+  fs::path cache_dir = tmp_dir.path() / "sym_info_cache";
+  std::string digest = config::make_prim_digest(prim);
+  EXPECT_EQ(digest.size(), 16);
+  EXPECT_EQ(digest, config::make_prim_digest(prim));
+  EXPECT_NE(digest, config::make_prim_digest(test::SimpleCubic_ising_prim()));
+
+  std::shared_ptr<config::PrimSymInfo const> first;
+  {
+    config::PrimSymInfoCache cache(cache_dir);
+    first = cache.make(prim);
+  }
+  EXPECT_TRUE(fs::exists(cache_dir / (digest + ".json")));
+
+  config::PrimSymInfoCache cache(cache_dir);
+  EXPECT_EQ(cache.size(), 0);
+  auto second = cache.make(prim);
+  EXPECT_NE(first, second);
+  expect_same_sym_info(*first, *second);
+}
+
+TEST(PrimSymInfoCacheTest, JsonIO) {
+  xtal::BasicStructure prim = test::SimpleCubic_ising_prim();
+  config::PrimSymInfo sym_info(prim);
+
+  jsonParser json;
+  to_json(sym_info, json, prim);
+  EXPECT_TRUE(json.contains("factor_group"));
+  EXPECT_TRUE(json.contains("point_group"));
+  EXPECT_TRUE(json.contains("lattice_point_group"));
+
+  config::PrimSymInfo read =
+      jsonConstructor<config::PrimSymInfo>::from_json(json, prim);
+  expect_same_sym_info(sym_info, read);
+}
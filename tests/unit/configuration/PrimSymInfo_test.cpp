@@ -95,3 +95,42 @@ TEST(PrimSymInfoTest, Test5) {
   EXPECT_EQ(prim_sym_info.local_dof_symgroup_rep.size(), 1);
   EXPECT_EQ(prim_sym_info.global_dof_symgroup_rep.size(), 0);
 }
+
+TEST(PrimSymInfoTest, PackedDoFSymGroupRep) {
+  config::PrimSymInfo prim_sym_info(test::FCC_ternary_GLstrain_prim());
+  config::PrimSymInfo disp_prim_sym_info(test::SimpleCubic_disp_prim());
+
+  auto check = [](sym_info::PackedDoFSymGroupRep const &packed,
+                  std::vector<std::vector<Eigen::MatrixXd>> const &rep) {
+    ASSERT_EQ(packed.n_ops(), rep.size());
+    for (Index op = 0; op < rep.size(); ++op) {
+      ASSERT_EQ(packed.n_sublat(), rep[op].size());
+      for (Index b = 0; b < rep[op].size(); ++b) {
+        Eigen::MatrixXd const &M = rep[op][b];
+        ASSERT_EQ(packed.dim(b), M.cols());
+        EXPECT_TRUE(Eigen::MatrixXd(packed.matrix(op, b)) == M);
+
+        Eigen::MatrixXd before = Eigen::MatrixXd::Random(M.cols(), 5);
+        Eigen::MatrixXd after = Eigen::MatrixXd::Zero(M.cols(), 5);
+        packed.apply(op, b, before, after);
+        EXPECT_TRUE(after.isApprox(M * before));
+      }
+    }
+  };
+
+  // global, GLstrain: dim 6
+  std::vector<std::vector<Eigen::MatrixXd>> global_rep;
+  for (auto const &M : prim_sym_info.global_dof_symgroup_rep.at("GLstrain")) {
+    global_rep.push_back({M});
+  }
+  check(prim_sym_info.packed_global_dof_symgroup_rep.at("GLstrain"),
+        global_rep);
+
+  // local, occ: dim 3
+  check(prim_sym_info.packed_local_dof_symgroup_rep.at("occ"),
+        prim_sym_info.local_dof_symgroup_rep.at("occ"));
+
+  // local, disp: dim 3
+  check(disp_prim_sym_info.packed_local_dof_symgroup_rep.at("disp"),
+        disp_prim_sym_info.local_dof_symgroup_rep.at("disp"));
+}
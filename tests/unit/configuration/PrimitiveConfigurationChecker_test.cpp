@@ -0,0 +1,91 @@
+#include "casm/configuration/PrimitiveConfigurationChecker.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Check PrimitiveConfigurationChecker against is_primitive for all binary
+/// occupations
+void check_all_occupations(
+    std::shared_ptr<config::Supercell const> const &supercell) {
+  config::PrimitiveConfigurationChecker checker(supercell);
+  config::Configuration configuration(supercell);
+  Index n_sites = configuration.dof_values.occupation.size();
+  for (Index count = 0; count < (Index(1) << n_sites); ++count) {
+    test::set_occupation(configuration.dof_values.occupation, count, 2);
+    EXPECT_EQ(checker.is_primitive(configuration),
+              config::is_primitive(configuration));
+  }
+}
+
+}  // namespace
+
+class PrimitiveConfigurationCheckerTest : public testing::Test {
+ protected:
+  PrimitiveConfigurationCheckerTest() {
+    prim = config::make_shared_prim(test::FCC_binary_prim());
+  }
+
+  std::shared_ptr<config::Supercell const> make_supercell(Index a, Index b,
+                                                          Index c) {
+    Eigen::Matrix3l T = Eigen::Matrix3l::Zero();
+    T.diagonal() << a, b, c;
+    return std::make_shared<config::Supercell const>(prim, T);
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+};
+
+TEST_F(PrimitiveConfigurationCheckerTest, TranslationIndices) {
+  // Z_2 x Z_2 x Z_2: 7 subgroups of order 2
+  EXPECT_EQ(config::PrimitiveConfigurationChecker(make_supercell(2, 2, 2))
+                .translation_indices()
+                .size(),
+            7);
+  // Z_6: one subgroup each of order 2 and 3
+  EXPECT_EQ(config::PrimitiveConfigurationChecker(make_supercell(1, 1, 6))
+                .translation_indices()
+                .size(),
+            2);
+  // Z_3 x Z_3: 4 subgroups of order 3
+  EXPECT_EQ(config::PrimitiveConfigurationChecker(make_supercell(3, 3, 1))
+                .translation_indices()
+                .size(),
+            4);
+  EXPECT_TRUE(config::PrimitiveConfigurationChecker(make_supercell(1, 1, 1))
+                  .translation_indices()
+                  .empty());
+}
+
+TEST_F(PrimitiveConfigurationCheckerTest, Occupation) {
+  check_all_occupations(make_supercell(2, 2, 2));
+  check_all_occupations(make_supercell(1, 1, 6));
+  check_all_occupations(make_supercell(1, 2, 4));
+  check_all_occupations(make_supercell(3, 3, 1));
+
+  // non-diagonal
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  check_all_occupations(std::make_shared<config::Supercell const>(prim, T));
+}
+
+TEST_F(PrimitiveConfigurationCheckerTest, ContinuousDoF) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T = Eigen::Matrix3l::Identity();
+  T(0, 0) = 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::PrimitiveConfigurationChecker checker(supercell);
+
+  config::Configuration configuration(supercell);
+  EXPECT_FALSE(checker.is_primitive(configuration));
+  configuration.dof_values.local_dof_values.at("disp")(0, 0) = 0.01;
+  EXPECT_TRUE(checker.is_primitive(configuration));
+  EXPECT_EQ(checker.is_primitive(configuration),
+            config::is_primitive(configuration));
+}
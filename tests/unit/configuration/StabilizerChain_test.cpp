@@ -0,0 +1,151 @@
+#include "casm/configuration/group/StabilizerChain.hh"
+
+#include <random>
+#include <set>
+
+#include "gtest/gtest.h"
+
+using namespace CASM;
+
+namespace {
+
+typedef group::StabilizerChain::Permutation Permutation;
+
+/// (a * b)[x] == a[b[x]]
+Permutation multiply(Permutation const &a, Permutation const &b) {
+  Permutation result(a.size());
+  for (group::Index x = 0; x < a.size(); ++x) {
+    result[x] = a[b[x]];
+  }
+  return result;
+}
+
+/// All elements of the group generated by `generators`
+std::vector<Permutation> make_closure(
+    std::vector<Permutation> const &generators) {
+  Permutation identity(generators.front().size());
+  for (group::Index x = 0; x < identity.size(); ++x) {
+    identity[x] = x;
+  }
+  std::set<Permutation> found({identity});
+  std::vector<Permutation> elements({identity});
+  for (group::Index i = 0; i < elements.size(); ++i) {
+    for (auto const &g : generators) {
+      Permutation p = multiply(g, elements[i]);
+      if (found.insert(p).second) {
+        elements.push_back(p);
+      }
+    }
+  }
+  return elements;
+}
+
+/// Insert random elements until the chain order equals the group order
+group::StabilizerChain make_chain(std::vector<Permutation> const &elements) {
+  group::StabilizerChain chain(elements.front().size());
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<group::Index> dist(0, elements.size() - 1);
+  while (chain.order() < elements.size()) {
+    chain.insert(elements[dist(engine)]);
+  }
+  return chain;
+}
+
+/// Translations and reflections of an L1 x L2 periodic grid
+std::vector<Permutation> make_grid_generators(group::Index L1,
+                                             group::Index L2) {
+  auto index = [&](group::Index i, group::Index j) {
+    return ((i % L1 + L1) % L1) * L2 + ((j % L2 + L2) % L2);
+  };
+  group::Index n = L1 * L2;
+  Permutation tx(n), ty(n), rx(n), ry(n);
+  for (group::Index i = 0; i < L1; ++i) {
+    for (group::Index j = 0; j < L2; ++j) {
+      tx[index(i, j)] = index(i + 1, j);
+      ty[index(i, j)] = index(i, j + 1);
+      rx[index(i, j)] = index(-i, j);
+      ry[index(i, j)] = index(i, -j);
+    }
+  }
+  return {tx, ty, rx, ry};
+}
+
+}  // namespace
+
+TEST(StabilizerChainTest, SymmetricGroup) {
+  group::Index n = 6;
+  Permutation swap(n), cycle(n);
+  for (group::Index x = 0; x < n; ++x) {
+    swap[x] = x;
+    cycle[x] = (x + 1) % n;
+  }
+  std::swap(swap[0], swap[1]);
+  std::vector<Permutation> elements = make_closure({swap, cycle});
+  EXPECT_EQ(elements.size(), 720);
+
+  group::StabilizerChain chain = make_chain(elements);
+  EXPECT_EQ(chain.order(), 720);
+  for (group::Index i = 1; i < chain.n_levels(); ++i) {
+    EXPECT_LT(chain.base_point(i - 1), chain.base_point(i));
+  }
+  for (auto const &element : elements) {
+    EXPECT_TRUE(chain.contains(element));
+    EXPECT_FALSE(chain.insert(element));
+  }
+  for (group::Index i = 0; i < chain.n_levels(); ++i) {
+    for (group::Index x : chain.orbit(i)) {
+      Permutation u = chain.transversal(i, x);
+      EXPECT_EQ(u[chain.base_point(i)], x);
+      for (group::Index y = 0; y < chain.base_point(i); ++y) {
+        EXPECT_EQ(u[y], y);
+      }
+    }
+  }
+
+  // dihedral subgroup does not contain a transposition
+  Permutation reflection(n);
+  for (group::Index x = 0; x < n; ++x) {
+    reflection[x] = (n - x) % n;
+  }
+  std::vector<Permutation> dihedral = make_closure({cycle, reflection});
+  group::StabilizerChain dihedral_chain = make_chain(dihedral);
+  EXPECT_EQ(dihedral_chain.order(), 2 * n);
+  EXPECT_FALSE(dihedral_chain.contains(swap));
+}
+
+TEST(StabilizerChainTest, LexicographicMaxImage) {
+  std::mt19937 engine(1);
+  std::vector<std::pair<group::Index, group::Index>> shapes({{4, 3}, {4, 4}});
+  for (auto shape : shapes) {
+    std::vector<Permutation> elements =
+        make_closure(make_grid_generators(shape.first, shape.second));
+    group::StabilizerChain chain = make_chain(elements);
+    EXPECT_EQ(chain.order(), elements.size());
+    group::Index n = chain.n_points();
+
+    for (group::Index trial = 0; trial < 100; ++trial) {
+      std::vector<int> values(n);
+      int n_values = 1 + trial % 3;
+      for (auto &v : values) {
+        v = engine() % n_values;
+      }
+      std::vector<int> expected;
+      for (auto const &p : elements) {
+        std::vector<int> image(n);
+        for (group::Index x = 0; x < n; ++x) {
+          image[x] = values[p[x]];
+        }
+        expected = std::max(expected, image);
+      }
+
+      Permutation p;
+      std::vector<int> image =
+          group::make_lexicographic_max_image(chain, values, &p);
+      EXPECT_EQ(image, expected);
+      EXPECT_TRUE(chain.contains(p));
+      for (group::Index x = 0; x < n; ++x) {
+        EXPECT_EQ(image[x], values[p[x]]);
+      }
+    }
+  }
+}
@@ -0,0 +1,90 @@
+#include "casm/configuration/SupercellNameCache.hh"
+
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(SupercellNameCacheTest, MatchesSupercell) {
+  auto prim = config::make_shared_prim(test::ZrO_prim());
+  config::SupercellNameCache cache(prim);
+
+  std::vector<Eigen::Matrix3l> matrices;
+  Eigen::Matrix3l T;
+  T << 1, 0, 0, 0, 1, 0, 0, 0, 1;
+  matrices.push_back(T);
+  T << 2, 0, 0, 0, 1, 0, 0, 0, 1;
+  matrices.push_back(T);
+  T << 1, 0, 0, 0, 2, 0, 0, 0, 1;
+  matrices.push_back(T);
+  T << 1, 1, 0, 0, 1, 0, 0, 0, 2;
+  matrices.push_back(T);
+  T << 0, 1, 0, 1, 0, 0, 0, 0, 3;
+  matrices.push_back(T);
+
+  for (auto const &T : matrices) {
+    config::Supercell supercell(prim, T);
+    auto const &entry = cache.get(T);
+    EXPECT_EQ(entry.supercell_name,
+              config::make_supercell_name(
+                  prim->basicstructure->lattice(),
+                  supercell.superlattice.superlattice()));
+    EXPECT_EQ(entry.canonical_supercell_name,
+              supercell.canonical_supercell_name());
+    EXPECT_EQ(entry.prim_factor_group_index_to_canonical,
+              supercell.prim_factor_group_index_to_canonical());
+    EXPECT_EQ(entry.canonical_transformation_matrix_to_super,
+              supercell.canonical_supercell()
+                  ->superlattice.transformation_matrix_to_super());
+    EXPECT_EQ(cache.is_canonical(T), supercell.is_canonical());
+
+    // lookup by name and key find the stored entry
+    EXPECT_EQ(&cache.get(entry.supercell_name), &entry);
+    EXPECT_EQ(&cache.get(entry.key), &entry);
+  }
+
+  // the 2x1x1 and 1x2x1 supercells are equivalent
+  EXPECT_EQ(cache.get(matrices[1]).canonical_supercell_name,
+            cache.get(matrices[2]).canonical_supercell_name);
+  EXPECT_EQ(cache.size(), 5);
+
+  // matrices that generate the same superlattice share an entry
+  T << 1, 1, 0, 0, 1, 0, 0, 0, 1;
+  EXPECT_EQ(&cache.get(T), &cache.get(matrices[0]));
+  EXPECT_EQ(cache.size(), 5);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(SupercellNameCacheTest, SupercellSet) {
+  auto prim = config::make_shared_prim(test::ZrO_prim());
+  config::SupercellSet supercells(prim);
+
+  Eigen::Matrix3l T;
+  T << 1, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = config::make_shared_supercell(prim, T);
+  auto canonical_supercell = config::make_canonical_form(*supercell);
+  auto const &record = *supercells.insert(supercell).first;
+  EXPECT_EQ(record.canonical_supercell_name,
+            supercell->canonical_supercell_name());
+  EXPECT_EQ(record.is_canonical, supercell->is_canonical());
+  EXPECT_EQ(supercells.name_cache()->size(), 1);
+
+  auto result =
+      supercells.insert_canonical(supercell->canonical_supercell_name());
+  EXPECT_EQ(
+      result.first->supercell->superlattice.transformation_matrix_to_super(),
+      canonical_supercell->superlattice.transformation_matrix_to_super());
+  EXPECT_TRUE(result.first->is_canonical);
+  EXPECT_EQ(result.first->supercell_name,
+            supercell->canonical_supercell_name());
+
+  if (!supercell->is_canonical()) {
+    EXPECT_THROW(supercells.insert_canonical(record.supercell_name),
+                 std::runtime_error);
+  }
+}
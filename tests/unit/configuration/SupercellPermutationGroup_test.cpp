@@ -0,0 +1,103 @@
+#include "casm/configuration/SupercellPermutationGroup.hh"
+
+#include <random>
+#include <set>
+
+#include "casm/configuration/canonical_form.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Check SupercellPermutationGroup against the canonical_form.hh functions
+void check_group(config::SupercellPermutationGroup const &group,
+                 config::Configuration const &configuration) {
+  auto const &supercell = group.supercell();
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+
+  config::Configuration expected_canonical =
+      make_canonical_form(configuration, begin, end);
+  EXPECT_EQ(group.make_canonical_form(configuration), expected_canonical);
+  EXPECT_EQ(group.is_canonical(configuration),
+            is_canonical(configuration, begin, end));
+  EXPECT_EQ(copy_apply(group.to_canonical(configuration), configuration),
+            expected_canonical);
+}
+
+/// Number of distinct combined site permutations
+Index count_distinct_permutations(
+    std::shared_ptr<config::Supercell const> const &supercell) {
+  std::set<sym_info::Permutation> permutations;
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  for (auto it = begin; it != end; ++it) {
+    permutations.insert(it->combined_permute());
+  }
+  return permutations.size();
+}
+
+}  // namespace
+
+TEST(SupercellPermutationGroupTest, FCCBinary) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::SupercellPermutationGroup group(supercell);
+  EXPECT_EQ(group.order(), count_distinct_permutations(supercell));
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  for (auto it = begin; it != end; ++it) {
+    auto permutation = group.make_permutation(
+        it->supercell_factor_group_index(), it->translation_index());
+    EXPECT_EQ(permutation, it->combined_permute());
+    EXPECT_TRUE(group.stabilizer_chain().contains(permutation));
+    EXPECT_EQ(group.find_op(permutation).combined_permute(), permutation);
+  }
+
+  config::Configuration configuration(supercell);
+  for (Index count = 0; count < 256; ++count) {
+    for (Index l = 0; l < 8; ++l) {
+      configuration.dof_values.occupation(l) = (count >> l) & 1;
+    }
+    check_group(group, configuration);
+  }
+}
+
+TEST(SupercellPermutationGroupTest, ZrO) {
+  auto prim = config::make_shared_prim(test::ZrO_prim());
+  Eigen::Matrix3l T;
+  T << 2, 1, 0, -1, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::SupercellPermutationGroup group(supercell);
+  EXPECT_EQ(group.order(), count_distinct_permutations(supercell));
+
+  std::mt19937 engine(0);
+  config::Configuration configuration(supercell);
+  auto &occupation = configuration.dof_values.occupation;
+  Index n_vol = supercell->superlattice.size();
+  for (Index trial = 0; trial < 50; ++trial) {
+    // O sublattices (2, 3) are binary; Zr sublattices (0, 1) are fixed
+    for (Index l = 2 * n_vol; l < occupation.size(); ++l) {
+      occupation(l) = (trial % 5 == 0) ? 0 : engine() % 2;
+    }
+    check_group(group, configuration);
+  }
+}
+
+TEST(SupercellPermutationGroupTest, ContinuousDoF) {
+  auto prim = config::make_shared_prim(test::FCC_binary_disp_prim());
+  Eigen::Matrix3l T;
+  T << 1, 1, 0, -1, 1, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::SupercellPermutationGroup group(supercell);
+
+  config::Configuration configuration(supercell);
+  configuration.dof_values.occupation(1) = 1;
+  configuration.dof_values.local_dof_values.at("disp")(0, 0) = 0.1;
+  check_group(group, configuration);
+}
@@ -0,0 +1,155 @@
+#include "casm/configuration/io/binary/SupercellSymInfo_binary_io.hh"
+
+#include <fstream>
+#include <sstream>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "gtest/gtest.h"
+#include "testdir.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(SupercellSymInfoTablesTest, WriteAndMap) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T1, T2, T3;
+  T1 << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  T2 << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  T3 << 4, 0, 0, 0, 4, 0, 0, 0, 4;
+  std::vector<std::shared_ptr<config::Supercell const>> supercells = {
+      std::make_shared<config::Supercell const>(prim, T1),
+      std::make_shared<config::Supercell const>(prim, T2),
+      // translation permutations not stored
+      std::make_shared<config::Supercell const>(prim, T3, 10)};
+
+  test::TmpDir tmp_dir;
+  std::string path = (tmp_dir.path() / "sym_info.bin").string();
+  {
+    std::ofstream out(path, std::ios::binary);
+    config::write_supercell_sym_info_tables(out, supercells);
+  }
+
+  config::SupercellSymInfoTables tables(path);
+  EXPECT_EQ(tables.size(), 3);
+  EXPECT_EQ(tables.transformation_matrix_to_super(1), T2);
+  EXPECT_EQ(tables.find(T3), 2);
+  Eigen::Matrix3l T4 = 3 * Eigen::Matrix3l::Identity();
+  EXPECT_EQ(tables.find(T4), 3);
+  EXPECT_THROW(tables.make_supercell(prim, T4), std::runtime_error);
+
+  for (auto const &expected : supercells) {
+    Eigen::Matrix3l const &T =
+        expected->superlattice.transformation_matrix_to_super();
+    auto supercell = tables.make_supercell(prim, T);
+    EXPECT_EQ(*supercell, *expected);
+    config::SupercellSymInfo const &a = supercell->sym_info;
+    config::SupercellSymInfo const &b = expected->sym_info;
+    EXPECT_EQ(a.factor_group->head_group_index,
+              b.factor_group->head_group_index);
+    EXPECT_EQ(a.factor_group_permutations, b.factor_group_permutations);
+    EXPECT_EQ(a.factor_group_point_matrices, b.factor_group_point_matrices);
+
+    // translation permutations are read from the mapping, not copied
+    EXPECT_FALSE(a.translation_permutations.has_value());
+    ASSERT_NE(a.translation_permutation_cache, nullptr);
+    Index n_unitcells = supercell->unitcell_index_converter.total_sites();
+    for (Index t = 0; t < n_unitcells; ++t) {
+      EXPECT_EQ(*a.translation_permutation_cache->get(
+                    t, supercell->unitcell_index_converter,
+                    supercell->unitcellcoord_index_converter),
+                config::make_translation_permutation(
+                    t, expected->unitcell_index_converter,
+                    expected->unitcellcoord_index_converter));
+    }
+
+    // operations in the mapped supercell act the same
+    config::Configuration configuration(supercell);
+    configuration.dof_values.occupation(1) = 1;
+    config::Configuration expected_configuration(expected);
+    expected_configuration.dof_values.occupation(1) = 1;
+    auto it = config::SupercellSymOp::begin(supercell);
+    auto expected_it = config::SupercellSymOp::begin(expected);
+    for (; it != config::SupercellSymOp::end(supercell); ++it, ++expected_it) {
+      EXPECT_EQ(copy_apply(*it, configuration).dof_values.occupation,
+                copy_apply(*expected_it, expected_configuration)
+                    .dof_values.occupation);
+    }
+  }
+
+  auto other_prim = config::make_shared_prim(test::ZrO_prim());
+  EXPECT_THROW(tables.make_supercell(other_prim, T1), std::runtime_error);
+
+  // a supercell keeps the mapping valid after the tables are destroyed
+  std::shared_ptr<config::Supercell const> supercell;
+  {
+    config::SupercellSymInfoTables other_tables(path);
+    supercell = other_tables.make_supercell(prim, T1);
+  }
+  EXPECT_EQ(*supercell->sym_info.translation_permutation_cache->get(
+                1, supercell->unitcell_index_converter,
+                supercell->unitcellcoord_index_converter),
+            supercells[0]->sym_info.translation_permutations->at(1));
+}
+
+TEST(SupercellSymInfoTablesTest, CheckPrimAndPermutations) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  std::vector<std::shared_ptr<config::Supercell const>> supercells = {
+      std::make_shared<config::Supercell const>(prim, T)};
+
+  test::TmpDir tmp_dir;
+  std::string path = (tmp_dir.path() / "sym_info.bin").string();
+  std::string data;
+  {
+    std::stringstream ss;
+    config::write_supercell_sym_info_tables(ss, supercells);
+    data = ss.str();
+  }
+  auto write = [&](std::string const &bytes) {
+    std::ofstream out(path, std::ios::binary);
+    out.write(bytes.data(), bytes.size());
+  };
+
+  // a prim with the same structure and factor group size, but the factor
+  // group in a different order
+  std::vector<xtal::SymOp> reversed_factor_group(
+      prim->sym_info.factor_group->element.rbegin(),
+      prim->sym_info.factor_group->element.rend());
+  auto reversed_prim = std::make_shared<config::Prim const>(
+      reversed_factor_group, prim->basicstructure);
+  EXPECT_NE(config::make_supercell_sym_info_prim_digest(*prim),
+            config::make_supercell_sym_info_prim_digest(*reversed_prim));
+  write(data);
+  {
+    config::SupercellSymInfoTables tables(path);
+    EXPECT_NO_THROW(tables.make_supercell(prim, T));
+    EXPECT_THROW(tables.make_supercell(reversed_prim, T), std::runtime_error);
+  }
+
+  // a factor group permutation value out of range
+  Index n_sites = 8;
+  Index n_fg = prim->sym_info.factor_group->element.size();
+  Index record_begin = data.size() - 8 * (12 + n_fg + (n_fg + 8) * n_sites);
+  std::string invalid = data;
+  invalid[record_begin + 8 * (12 + n_fg)] = 8;
+  write(invalid);
+  {
+    config::SupercellSymInfoTables tables(path);
+    EXPECT_THROW(tables.make_supercell(prim, T), std::runtime_error);
+  }
+
+  // a translation permutation value out of range, checked when read
+  invalid = data;
+  invalid[data.size() - 8] = 8;
+  write(invalid);
+  {
+    config::SupercellSymInfoTables tables(path);
+    auto supercell = tables.make_supercell(prim, T);
+    auto &cache = *supercell->sym_info.translation_permutation_cache;
+    EXPECT_THROW(cache.get(7, supercell->unitcell_index_converter,
+                           supercell->unitcellcoord_index_converter),
+                 std::runtime_error);
+  }
+}
@@ -0,0 +1,96 @@
+#include "casm/configuration/SupercellSymOpRange.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class SupercellSymOpRangeTest : public testing::Test {
+ protected:
+  SupercellSymOpRangeTest() {
+    prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+    Eigen::Matrix3l T;
+    T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+    supercell = std::make_shared<config::Supercell const>(prim, T);
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<config::Supercell const> supercell;
+};
+
+TEST_F(SupercellSymOpRangeTest, All) {
+  auto range = config::SupercellSymOpRange::all(supercell);
+  std::vector<config::SupercellSymOp> expected(
+      config::SupercellSymOp::begin(supercell),
+      config::SupercellSymOp::end(supercell));
+  EXPECT_EQ(range.size(), expected.size());
+  EXPECT_EQ(range.to_vector(), expected);
+  for (Index i = 0; i < range.size(); ++i) {
+    EXPECT_EQ(range[i], expected[i]);
+    EXPECT_EQ(config::SupercellSymOp(supercell, range.ref(i)), expected[i]);
+  }
+
+  auto translations = config::SupercellSymOpRange::translations(supercell);
+  EXPECT_EQ(translations.to_vector(),
+            std::vector<config::SupercellSymOp>(
+                config::SupercellSymOp::translation_begin(supercell),
+                config::SupercellSymOp::translation_end(supercell)));
+
+  auto made = config::make_supercell_symop_range(expected);
+  ASSERT_TRUE(made.has_value());
+  EXPECT_EQ(made->to_vector(), expected);
+
+  // not a product of factor group operations and translations
+  std::vector<config::SupercellSymOp> group = {
+      config::SupercellSymOp(supercell, 0, 0),
+      config::SupercellSymOp(supercell, 1, 1)};
+  EXPECT_FALSE(config::make_supercell_symop_range(group).has_value());
+
+  config::SupercellSymOpRange empty(supercell, {}, {0});
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_THROW(config::SupercellSymOpRange(supercell, {-1}, {0}),
+               std::runtime_error);
+}
+
+TEST_F(SupercellSymOpRangeTest, CanonicalForm) {
+  auto range = config::SupercellSymOpRange::all(supercell);
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+
+  std::vector<config::Configuration> configurations;
+  config::Configuration configuration(supercell);
+  configurations.push_back(configuration);
+  configuration.dof_values.occupation(0) = 1;
+  configurations.push_back(configuration);
+  configuration.dof_values.occupation(1) = 2;
+  configurations.push_back(configuration);
+  configuration.dof_values.local_dof_values.at("disp")(0, 2) = 0.01;
+  configurations.push_back(configuration);
+  configuration.dof_values.global_dof_values.at("GLstrain")(1) = 0.02;
+  configurations.push_back(configuration);
+
+  for (auto const &config : configurations) {
+    EXPECT_EQ(config::is_canonical(config, range),
+              config::is_canonical(config, begin, end));
+    EXPECT_EQ(config::to_canonical(config, range),
+              config::to_canonical(config, begin, end));
+    EXPECT_EQ(config::make_canonical_form(config, range),
+              config::make_canonical_form(config, begin, end));
+    EXPECT_EQ(config::make_invariant_subgroup(config, range),
+              config::make_invariant_subgroup(config, begin, end));
+    EXPECT_EQ(config::make_invariant_subgroup(config, range, {"occ"}),
+              config::make_invariant_subgroup(config, begin, end, {"occ"}));
+  }
+
+  // a range in a different supercell
+  auto other = std::make_shared<config::Supercell const>(
+      prim, supercell->superlattice.transformation_matrix_to_super());
+  EXPECT_THROW(config::is_canonical(configuration,
+                                    config::SupercellSymOpRange::all(other)),
+               std::runtime_error);
+}
@@ -1,9 +1,13 @@
 #include "casm/configuration/SupercellSymOp.hh"
 
+#include "casm/configuration/CombinedPermutationTable.hh"
 #include "casm/configuration/Configuration.hh"
 #include "casm/configuration/Prim.hh"
 #include "casm/configuration/Supercell.hh"
 #include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/group/subgroups.hh"
+#include "casm/configuration/irreps/IrrepDecomposition.hh"
+#include "casm/configuration/sym_info/definitions.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
 #include "gtest/gtest.h"
 #include "teststructures.hh"
@@ -106,6 +110,26 @@ TEST_F(SupercellSymOpFCCTest, Test5) {
   EXPECT_EQ(occ_matrix_rep.size(), 48);
 }
 
+TEST_F(SupercellSymOpFCCTest, TestToSymOp) {
+  auto const &sym_info = supercell->sym_info;
+  EXPECT_EQ(sym_info.translation_cart.cols(), 4);
+
+  Eigen::Matrix3d const &L =
+      supercell->superlattice.prim_lattice().lat_column_mat();
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  for (auto it = begin; it != end; ++it) {
+    auto const &fg_op =
+        sym_info.factor_group->element[it->supercell_factor_group_index()];
+    Eigen::Vector3d expected_translation =
+        L * it->translation_frac().cast<double>() + fg_op.translation;
+    xtal::SymOp op = it->to_symop();
+    EXPECT_TRUE(almost_equal(op.matrix, fg_op.matrix));
+    EXPECT_TRUE(almost_equal(op.translation, expected_translation));
+    EXPECT_EQ(op.is_time_reversal_active, fg_op.is_time_reversal_active);
+  }
+}
+
 class SupercellSymOpFCCTernaryGLStrainDispTest : public testing::Test {
  protected:
   SupercellSymOpFCCTernaryGLStrainDispTest() {
@@ -311,6 +335,68 @@ TEST_F(SupercellSymOpFCCTernaryGLStrainDispTest, TestLocalMatrixRep2) {
   EXPECT_EQ(disp_matrix_rep.size(), 2 * 16);
 }
 
+// Test make local block permutation matrix rep
+TEST_F(SupercellSymOpFCCTernaryGLStrainDispTest, TestLocalBlockMatrixRep) {
+  config::Configuration configuration(supercell);
+  configuration.dof_values.occupation(0) = 1;
+  Index n_sites = supercell->unitcellcoord_index_converter.total_sites();
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  std::set<Index> site_indices;
+  for (Index l = 0; l < n_sites; ++l) {
+    site_indices.emplace(l);
+  }
+  auto invariant_subgroup = make_invariant_subgroup(configuration, begin, end);
+
+  std::vector<Eigen::MatrixXd> disp_matrix_rep = make_local_dof_matrix_rep(
+      invariant_subgroup, "disp", site_indices, symgroup);
+  irreps::BlockPermutationMatrixRep disp_block_matrix_rep =
+      make_local_dof_block_matrix_rep(invariant_subgroup, "disp",
+                                      site_indices, symgroup);
+  ASSERT_EQ(disp_block_matrix_rep.size(), disp_matrix_rep.size());
+
+  Eigen::MatrixXd X = Eigen::MatrixXd::Random(3 * n_sites, 2);
+  for (Index i = 0; i < disp_matrix_rep.size(); ++i) {
+    irreps::BlockPermutationMatrix const &M = disp_block_matrix_rep[i];
+    EXPECT_EQ(M.n_blocks(), n_sites);
+    EXPECT_EQ(M.rows(), 3 * n_sites);
+    EXPECT_TRUE(almost_equal(M.to_dense(), disp_matrix_rep[i]));
+    EXPECT_TRUE(almost_equal(M * X, disp_matrix_rep[i] * X));
+  }
+
+  // IrrepDecomposition stores the block rep without densifying it
+  std::set<Index> group_indices;
+  for (Index i = 0; i < disp_matrix_rep.size(); ++i) {
+    group_indices.insert(i);
+  }
+  auto make_cyclic_subgroups_f = [&]() {
+    return group::make_cyclic_subgroups(*symgroup);
+  };
+  auto make_all_subgroups_f = [&]() {
+    return group::make_all_subgroups(*symgroup);
+  };
+  Eigen::MatrixXd init_subspace =
+      Eigen::MatrixXd::Identity(3 * n_sites, 3 * n_sites);
+  irreps::IrrepDecomposition dense_decomposition(
+      disp_matrix_rep, group_indices, init_subspace, make_cyclic_subgroups_f,
+      make_all_subgroups_f, true);
+  irreps::IrrepDecomposition block_decomposition(
+      disp_block_matrix_rep, group_indices, init_subspace,
+      make_cyclic_subgroups_f, make_all_subgroups_f, true);
+  EXPECT_TRUE(block_decomposition.fullspace_rep.empty());
+  ASSERT_TRUE(block_decomposition.fullspace_block_rep.has_value());
+  EXPECT_TRUE(block_decomposition.has_fullspace_rep());
+  EXPECT_TRUE(almost_equal(block_decomposition.symmetry_adapted_subspace,
+                           dense_decomposition.symmetry_adapted_subspace));
+  for (Index i = 0; i < disp_matrix_rep.size(); ++i) {
+    EXPECT_TRUE(almost_equal(block_decomposition.make_fullspace_matrix(i),
+                             disp_matrix_rep[i]));
+    EXPECT_TRUE(almost_equal(block_decomposition.apply_fullspace_rep(i, X),
+                             dense_decomposition.apply_fullspace_rep(i, X)));
+  }
+}
+
 class SupercellSymOpSimpleCubicIsingTest : public testing::Test {
  protected:
   SupercellSymOpSimpleCubicIsingTest() {
@@ -344,3 +430,326 @@ TEST_F(SupercellSymOpSimpleCubicIsingTest, Test1) {
   EXPECT_TRUE(almost_equal(occ_count,
                            Eigen::VectorXi::Constant(size, 1 * 48 + 7 * 48)));
 }
+
+TEST(SupercellSymOpTranslationPermutationTest, CacheAndIndexArithmetic) {
+  std::shared_ptr<config::Prim const> prim =
+      config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  Index n_sites = 8;
+  Index permutation_bytes = n_sites * sizeof(Index);
+
+  // all translation permutations stored
+  auto supercell_full = std::make_shared<config::Supercell const>(prim, T);
+  // at most 2 translation permutations cached
+  auto supercell_cached = std::make_shared<config::Supercell const>(
+      prim, T, 0, 2 * permutation_bytes);
+  // no translation permutations stored
+  auto supercell_none =
+      std::make_shared<config::Supercell const>(prim, T, 0, 0);
+
+  ASSERT_TRUE(supercell_full->sym_info.translation_permutations.has_value());
+  EXPECT_EQ(supercell_full->sym_info.translation_permutation_cache, nullptr);
+  ASSERT_FALSE(
+      supercell_cached->sym_info.translation_permutations.has_value());
+  auto const &cache = supercell_cached->sym_info.translation_permutation_cache;
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->max_bytes(), 2 * permutation_bytes);
+
+  auto it_full = config::SupercellSymOp::begin(supercell_full);
+  auto it_cached = config::SupercellSymOp::begin(supercell_cached);
+  auto it_none = config::SupercellSymOp::begin(supercell_none);
+  auto end_full = config::SupercellSymOp::end(supercell_full);
+  for (; it_full != end_full; ++it_full, ++it_cached, ++it_none) {
+    EXPECT_EQ(it_full->translation_permute(), it_cached->translation_permute());
+    EXPECT_EQ(it_full->translation_permute(), it_none->translation_permute());
+    for (Index l = 0; l < n_sites; ++l) {
+      EXPECT_EQ(it_full->permute_index(l), it_cached->permute_index(l));
+      EXPECT_EQ(it_full->permute_index(l), it_none->permute_index(l));
+    }
+    EXPECT_LE(cache->size(), 2);
+    EXPECT_LE(cache->size_bytes(), cache->max_bytes());
+  }
+  EXPECT_GT(cache->n_misses(), 0);
+  EXPECT_EQ(supercell_none->sym_info.translation_permutation_cache->size(), 0);
+
+  // a cached permutation is shared by other operations in the supercell
+  config::SupercellSymOp op(supercell_cached, 0, 3);
+  config::SupercellSymOp other_op(supercell_cached, 1, 3);
+  op.translation_permute();
+  Index n_hits = cache->n_hits();
+  other_op.translation_permute();
+  EXPECT_EQ(cache->n_hits(), n_hits + 1);
+}
+
+// Product and inverse by translation cocycle, including non-zero cocycles
+// from factor group operations with fractional translations
+TEST(SupercellSymOpAlgebraTest, ZrOProductAndInverse) {
+  std::shared_ptr<config::Prim const> prim =
+      config::make_shared_prim(test::ZrO_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto const &info = supercell->sym_info;
+  Index n_fg = info.factor_group->element.size();
+  EXPECT_EQ(info.factor_group_point_matrices.size(), n_fg);
+  EXPECT_EQ(info.factor_group_translation_cocycle.size(), n_fg * n_fg);
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  for (auto it_a = begin; it_a != end; ++it_a) {
+    sym_info::Permutation perm_a = it_a->combined_permute();
+    EXPECT_EQ(it_a->inverse().combined_permute(), sym_info::inverse(perm_a));
+    EXPECT_EQ(it_a->inverse() * (*it_a), begin);
+    for (auto it_b = begin; it_b != end; ++it_b) {
+      sym_info::Permutation expected =
+          sym_info::combined_permute(it_b->combined_permute(),  // first
+                                     perm_a);                   // second
+      EXPECT_EQ((*it_a * *it_b).combined_permute(), expected);
+    }
+  }
+}
+
+TEST(SupercellSymOpApplierTest, ApplyWithWorkspace) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+
+  // with stored translation permutations, and with none stored or cached
+  std::vector<std::shared_ptr<config::Supercell const>> supercells;
+  supercells.push_back(std::make_shared<config::Supercell const>(prim, T));
+  supercells.push_back(
+      std::make_shared<config::Supercell const>(prim, T, 0, 0));
+
+  for (auto const &supercell : supercells) {
+    config::Configuration configuration(supercell);
+    clexulator::ConfigDoFValues &dof_values = configuration.dof_values;
+    dof_values.occupation(0) = 1;
+    dof_values.occupation(2) = 2;
+    dof_values.local_dof_values.at("disp")(0, 0) = 1.0;
+    dof_values.local_dof_values.at("disp")(1, 3) = 0.5;
+    dof_values.global_dof_values.at("GLstrain")(0) = 0.01;
+    dof_values.global_dof_values.at("GLstrain")(4) = 0.02;
+
+    config::ConfigurationWithProperties configuration_with_properties(
+        configuration, {{"disp", dof_values.local_dof_values.at("disp")}},
+        {{"GLstrain", dof_values.global_dof_values.at("GLstrain")}});
+
+    auto begin = config::SupercellSymOp::begin(supercell);
+    auto end = config::SupercellSymOp::end(supercell);
+    config::SupercellSymOpApplier applier;
+    for (auto it = begin; it != end; ++it) {
+      EXPECT_EQ(applier.copy_apply(*it, configuration),
+                copy_apply(*it, configuration));
+
+      clexulator::ConfigDoFValues expected_dof_values =
+          copy_apply(*it, dof_values);
+      clexulator::ConfigDoFValues dof_values_with_workspace =
+          applier.copy_apply(*it, dof_values);
+      EXPECT_EQ(dof_values_with_workspace.occupation,
+                expected_dof_values.occupation);
+      EXPECT_TRUE(
+          almost_equal(dof_values_with_workspace.local_dof_values.at("disp"),
+                       expected_dof_values.local_dof_values.at("disp")));
+      EXPECT_TRUE(almost_equal(
+          dof_values_with_workspace.global_dof_values.at("GLstrain"),
+          expected_dof_values.global_dof_values.at("GLstrain")));
+
+      config::ConfigurationWithProperties expected =
+          copy_apply(*it, configuration_with_properties);
+      config::ConfigurationWithProperties with_workspace =
+          applier.copy_apply(*it, configuration_with_properties);
+      EXPECT_EQ(with_workspace.configuration, expected.configuration);
+      EXPECT_TRUE(almost_equal(with_workspace.local_properties.at("disp"),
+                               expected.local_properties.at("disp")));
+      EXPECT_TRUE(almost_equal(with_workspace.global_properties.at("GLstrain"),
+                               expected.global_properties.at("GLstrain")));
+    }
+
+    // the stored combined permutation matches the last operation applied
+    config::SupercellSymOp last(supercell, 3, 2);
+    applier.copy_apply(last, configuration);
+    EXPECT_EQ(applier.workspace().combined_permute, last.combined_permute());
+  }
+}
+
+TEST(SupercellSymOpRefTest, MatchesSupercellSymOp) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+
+  // with stored, cached, and no translation permutations
+  Index permutation_bytes = 4 * sizeof(Index);
+  std::vector<std::shared_ptr<config::Supercell const>> supercells;
+  supercells.push_back(std::make_shared<config::Supercell const>(prim, T));
+  supercells.push_back(std::make_shared<config::Supercell const>(
+      prim, T, 0, 2 * permutation_bytes));
+  supercells.push_back(
+      std::make_shared<config::Supercell const>(prim, T, 0, 0));
+
+  for (auto const &supercell : supercells) {
+    config::Configuration configuration(supercell);
+    Index n_sites = configuration.dof_values.occupation.size();
+    for (Index l = 0; l < n_sites; ++l) {
+      configuration.dof_values.occupation(l) = l % 3;
+      configuration.dof_values.local_dof_values.at("disp").col(l) =
+          Eigen::Vector3d(0.01 * l, 0.02, -0.03 * l);
+    }
+    configuration.dof_values.global_dof_values.at("GLstrain")(0) = 0.01;
+
+    config::SupercellSymOpApplier applier;
+    config::SupercellSymOpApplier ref_applier;
+    auto begin = config::SupercellSymOp::begin(supercell);
+    auto end = config::SupercellSymOp::end(supercell);
+    for (auto it = begin; it != end; ++it) {
+      config::SupercellSymOpRef ref = it->ref();
+      EXPECT_EQ(ref.supercell_ptr(), supercell.get());
+      EXPECT_EQ(ref.prim_factor_group_index(), it->prim_factor_group_index());
+      for (Index l = 0; l < n_sites; ++l) {
+        EXPECT_EQ(ref.permute_index(l), it->permute_index(l));
+      }
+      EXPECT_EQ(config::SupercellSymOp(supercell, ref.inverse()),
+                it->inverse());
+      EXPECT_EQ(config::SupercellSymOp(supercell, ref * begin->ref()),
+                *it * *begin);
+      EXPECT_TRUE(almost_equal(ref.to_symop().matrix, it->to_symop().matrix));
+
+      EXPECT_EQ(ref_applier.copy_apply(ref, configuration),
+                applier.copy_apply(*it, configuration));
+      EXPECT_EQ(ref_applier.workspace().combined_permute,
+                it->combined_permute());
+
+      xtal::UnitCellCoord site(0, 0, 1, 0);
+      xtal::UnitCellCoord expected_site = copy_apply(*it, site);
+      EXPECT_EQ(apply(ref, site), expected_site);
+    }
+  }
+
+  // a SupercellSymOp must own the supercell of the SupercellSymOpRef
+  config::SupercellSymOpRef ref = config::SupercellSymOp(supercells[0], 1, 1);
+  EXPECT_THROW(config::SupercellSymOp(supercells[1], ref), std::runtime_error);
+  EXPECT_THROW(config::SupercellSymOpRef().permute_index(0),
+               std::runtime_error);
+}
+
+TEST(SupercellSymOpRefTest, CanonicalFormRange) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  config::Configuration configuration(supercell);
+  configuration.dof_values.occupation(1) = 1;
+  configuration.dof_values.occupation(2) = 1;
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  std::vector<config::SupercellSymOpRef> refs;
+  for (auto it = begin; it != end; ++it) {
+    refs.push_back(it->ref());
+  }
+
+  // canonical form templates accept ranges of SupercellSymOpRef
+  EXPECT_EQ(config::is_canonical(configuration, refs.begin(), refs.end()),
+            config::is_canonical(configuration, begin, end));
+  EXPECT_EQ(config::to_canonical(configuration, refs.begin(), refs.end()),
+            config::to_canonical(configuration, begin, end));
+  EXPECT_EQ(
+      config::make_canonical_form(configuration, refs.begin(), refs.end()),
+      config::make_canonical_form(configuration, begin, end));
+  EXPECT_EQ(
+      config::make_invariant_subgroup(configuration, refs.begin(), refs.end()),
+      config::make_invariant_subgroup(configuration, begin, end));
+
+  std::vector<config::SupercellSymOpRef> empty;
+  EXPECT_THROW(config::to_canonical(configuration, empty.begin(), empty.end()),
+               std::runtime_error);
+}
+
+TEST(SupercellSymOpApplierTest, CopyApplyOccupations) {
+  // isotropic and anisotropic occupants
+  std::vector<std::shared_ptr<config::Prim const>> prims;
+  prims.push_back(config::make_shared_prim(test::FCC_ternary_prim()));
+  prims.push_back(config::make_shared_prim(test::SimpleCubic_ising_prim()));
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+
+  for (auto const &prim : prims) {
+    auto supercell = std::make_shared<config::Supercell const>(prim, T);
+    std::vector<config::SupercellSymOp> ops;
+    auto begin = config::SupercellSymOp::begin(supercell);
+    auto end = config::SupercellSymOp::end(supercell);
+    for (auto it = begin; it != end; ++it) {
+      ops.push_back(*it);
+    }
+
+    std::vector<config::Configuration> configurations;
+    for (Index i = 0; i < 5; ++i) {
+      config::Configuration configuration(supercell);
+      configuration.dof_values.occupation(i % 4) = 1;
+      configuration.dof_values.occupation((i + 1) % 4) = i % 2;
+      configurations.push_back(configuration);
+    }
+    Index n_sites = configurations[0].dof_values.occupation.size();
+    Eigen::MatrixXi occupations(n_sites, configurations.size());
+    for (Index c = 0; c < configurations.size(); ++c) {
+      occupations.col(c) = configurations[c].dof_values.occupation;
+    }
+
+    for (Index n_threads : {1, 4}) {
+      Eigen::MatrixXi result(n_sites, ops.size() * configurations.size());
+      config::copy_apply_occupations(ops, occupations, result, n_threads);
+      for (Index i = 0; i < ops.size(); ++i) {
+        for (Index c = 0; c < configurations.size(); ++c) {
+          config::Configuration expected =
+              copy_apply(ops[i], configurations[c]);
+          EXPECT_EQ(Eigen::VectorXi(result.col(i * configurations.size() + c)),
+                    expected.dof_values.occupation);
+        }
+      }
+    }
+
+    Eigen::MatrixXi wrong_size(n_sites, 1);
+    EXPECT_THROW(config::copy_apply_occupations(ops, occupations, wrong_size),
+                 std::runtime_error);
+  }
+}
+
+TEST(SupercellSymOpTest, CombinedPermutationTable) {
+  auto prim = config::make_shared_prim(test::ZrO_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+
+  // with the table, and with a budget too small for it
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  auto no_table = std::make_shared<config::Supercell const>(
+      prim, T, 100, config::DEFAULT_TRANSLATION_PERMUTATION_CACHE_MAX_BYTES,
+      0);
+  EXPECT_EQ(no_table->combined_permutation_table(), nullptr);
+  EXPECT_EQ(supercell->combined_permutation_table_bytes(), 0);
+
+  config::CombinedPermutationTable const *table =
+      supercell->combined_permutation_table();
+  ASSERT_NE(table, nullptr);
+  EXPECT_EQ(table, supercell->combined_permutation_table());
+  EXPECT_EQ(table->n_built(), 0);
+  EXPECT_GE(supercell->combined_permutation_table_bytes(),
+            config::CombinedPermutationTable::required_bytes(*supercell));
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  Index n_ops = 0;
+  for (auto it = begin; it != end; ++it, ++n_ops) {
+    config::SupercellSymOp other(no_table, it->supercell_factor_group_index(),
+                                 it->translation_index());
+    sym_info::Permutation expected = other.combined_permute();
+    EXPECT_EQ(it->combined_permute(), expected);
+    EXPECT_EQ(it->inverse_combined_permute(), sym_info::inverse(expected));
+    EXPECT_EQ(other.inverse_combined_permute(), sym_info::inverse(expected));
+    for (Index l = 0; l < expected.size(); ++l) {
+      EXPECT_EQ(it->permute_index(l), expected[l]);
+    }
+  }
+  EXPECT_EQ(table->n_ops(), n_ops);
+  EXPECT_EQ(table->n_built(), n_ops);
+}
@@ -1,6 +1,9 @@
 #include "casm/configuration/Supercell.hh"
 
+#include <thread>
+
 #include "casm/configuration/Prim.hh"
+#include "casm/crystallography/SymTools.hh"
 #include "gtest/gtest.h"
 #include "teststructures.hh"
 
@@ -18,3 +21,146 @@ TEST(SupercellTest, Test1) {
   EXPECT_EQ(supercell->sym_info.translation_permutations->size(), 4);
   EXPECT_EQ(supercell->sym_info.factor_group_permutations.size(), 48);
 }
+
+TEST(SupercellTest, MakeSharedSupercell) {
+  std::shared_ptr<config::Prim const> prim =
+      config::make_shared_prim(test::FCC_binary_prim());
+
+  Eigen::Matrix3l T1;
+  T1 << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  Eigen::Matrix3l T2 = 2 * Eigen::Matrix3l::Identity();
+
+  auto supercell_a = config::make_shared_supercell(prim, T1);
+  auto supercell_b = config::make_shared_supercell(prim, T1);
+  EXPECT_EQ(supercell_a, supercell_b);
+
+  auto supercell_c = config::make_shared_supercell(prim, T2);
+  EXPECT_NE(supercell_a, supercell_c);
+  EXPECT_EQ(supercell_c->superlattice.size(), 8);
+
+  // a different prim gives a different supercell
+  std::shared_ptr<config::Prim const> other_prim =
+      config::make_shared_prim(test::FCC_binary_prim());
+  auto supercell_d = config::make_shared_supercell(other_prim, T1);
+  EXPECT_NE(supercell_a, supercell_d);
+
+  // after all references are released, a new supercell is constructed
+  std::weak_ptr<config::Supercell const> weak_a = supercell_a;
+  supercell_a.reset();
+  supercell_b.reset();
+  EXPECT_TRUE(weak_a.expired());
+  auto supercell_e = config::make_shared_supercell(prim, T1);
+  EXPECT_EQ(supercell_e->superlattice.transformation_matrix_to_super(), T1);
+}
+
+TEST(SupercellTest, CanonicalSupercellData) {
+  std::shared_ptr<config::Prim const> prim =
+      config::make_shared_prim(test::FCC_binary_prim());
+
+  Eigen::Matrix3l T;
+  T << 0, 1, 1, 1, 0, 2, 1, 1, 0;
+  auto supercell = config::make_shared_supercell(prim, T);
+
+  auto canonical_supercell = supercell->canonical_supercell();
+  EXPECT_EQ(supercell->is_canonical(), supercell == canonical_supercell);
+  EXPECT_TRUE(canonical_supercell->is_canonical());
+  EXPECT_EQ(canonical_supercell->canonical_supercell(), canonical_supercell);
+  EXPECT_EQ(supercell->canonical_supercell(), canonical_supercell);
+  EXPECT_EQ(supercell->canonical_supercell_name(),
+            canonical_supercell->canonical_supercell_name());
+
+  // the stored prim factor group index transforms to the canonical supercell
+  Index fg_index = supercell->prim_factor_group_index_to_canonical();
+  xtal::SymOp const &op = prim->sym_info.factor_group->element[fg_index];
+  xtal::Lattice transformed =
+      sym::copy_apply(op, supercell->superlattice.superlattice());
+  EXPECT_TRUE(xtal::is_superlattice(
+                  canonical_supercell->superlattice.superlattice(),
+                  transformed, transformed.tol())
+                  .first);
+  EXPECT_EQ(canonical_supercell->superlattice.size(),
+            supercell->superlattice.size());
+}
+
+TEST(SupercellTest, SiteData) {
+  std::shared_ptr<config::Prim const> prim =
+      config::make_shared_prim(test::ZrO_prim());
+
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 1, 0, 0, 0, 2;
+  config::Supercell supercell(prim, T);
+  EXPECT_EQ(supercell.site_data_bytes(), 0);
+
+  // concurrent first use
+  std::vector<Eigen::Matrix3Xd const *> results(4, nullptr);
+  std::vector<std::thread> threads;
+  for (Index i = 0; i < 4; ++i) {
+    threads.emplace_back(
+        [&, i]() { results[i] = &supercell.site_coordinate_cart(); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (auto ptr : results) {
+    EXPECT_EQ(ptr, results[0]);
+  }
+
+  auto const &converter = supercell.unitcellcoord_index_converter;
+  Index n_sites = converter.total_sites();
+  Eigen::Matrix3Xd const &R = supercell.site_coordinate_cart();
+  std::vector<Index> const &b = supercell.site_sublattice_index();
+  std::vector<Index> const &i = supercell.site_unitcell_index();
+  ASSERT_EQ(R.cols(), n_sites);
+  ASSERT_EQ(b.size(), n_sites);
+  ASSERT_EQ(i.size(), n_sites);
+  for (Index l = 0; l < n_sites; ++l) {
+    xtal::UnitCellCoord bijk = converter(l);
+    EXPECT_TRUE(almost_equal(
+        Eigen::Vector3d(R.col(l)),
+        Eigen::Vector3d(bijk.coordinate(*prim->basicstructure).const_cart())));
+    EXPECT_EQ(b[l], bijk.sublattice());
+    EXPECT_EQ(i[l], supercell.unitcell_index_converter(bijk.unitcell()));
+  }
+  EXPECT_EQ(supercell.site_data_bytes(),
+            n_sites * (3 * sizeof(double) + 2 * sizeof(Index)));
+}
+
+TEST(SupercellTest, MemoryUsage) {
+  std::shared_ptr<config::Prim const> prim =
+      config::make_shared_prim(test::FCC_binary_prim());
+
+  Eigen::Matrix3l T = 3 * Eigen::Matrix3l::Identity();
+  auto supercell_full = std::make_shared<config::Supercell const>(prim, T);
+  auto supercell_cached =
+      std::make_shared<config::Supercell const>(prim, T, 10);
+
+  // translation permutations dominate the stored tables: 27 x 27 Index
+  config::MemoryUsageContext context;
+  config::SupercellMemoryUsage full =
+      config::make_memory_usage(*supercell_full, context);
+  EXPECT_EQ(full.n_sites, 27);
+  EXPECT_EQ(full.sym_info.n_translation_permutations, 27);
+  EXPECT_GE(full.sym_info.translation_permutations_bytes,
+            27 * 27 * Index(sizeof(Index)));
+  EXPECT_GE(full.sym_info.factor_group_permutations_bytes,
+            48 * 27 * Index(sizeof(Index)));
+  EXPECT_EQ(full.site_data_bytes, 0);
+  EXPECT_EQ(full.total_bytes(), config::memory_usage(*supercell_full));
+
+  config::SupercellMemoryUsage cached =
+      config::make_memory_usage(*supercell_cached, context);
+  EXPECT_EQ(cached.sym_info.n_translation_permutations, 0);
+  EXPECT_EQ(cached.sym_info.translation_permutations_bytes, 0);
+  EXPECT_LT(cached.total_bytes(), full.total_bytes());
+
+  // already counted
+  config::SupercellMemoryUsage again =
+      config::make_memory_usage(*supercell_full, context);
+  EXPECT_EQ(again.n_sites, 27);
+  EXPECT_EQ(again.total_bytes(), 0);
+
+  // per-site tables are counted once computed
+  supercell_full->site_sublattice_index();
+  EXPECT_EQ(config::memory_usage(*supercell_full),
+            full.total_bytes() + supercell_full->site_data_bytes());
+}
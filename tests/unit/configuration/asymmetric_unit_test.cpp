@@ -0,0 +1,122 @@
+#include "casm/configuration/asymmetric_unit.hh"
+
+#include <set>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/InvariantSubgroupEngine.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/crystallography/Lattice.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// \brief Asymmetric units from the orbit of each site, sorted by their
+///     smallest site index
+std::vector<std::vector<Index>> make_expected_asymmetric_unit_indices(
+    config::Configuration const &configuration) {
+  auto const &supercell = configuration.supercell;
+  std::vector<config::SupercellSymOp> invariant_subgroup =
+      config::InvariantSubgroupEngine(supercell).make_invariant_subgroup(
+          configuration);
+  std::set<std::vector<Index>> orbits;
+  Index n_sites = supercell->unitcellcoord_index_converter.total_sites();
+  for (Index l = 0; l < n_sites; ++l) {
+    std::set<Index> orbit;
+    for (auto const &op : invariant_subgroup) {
+      orbit.insert(op.permute_index(l));
+    }
+    orbits.emplace(orbit.begin(), orbit.end());
+  }
+  return std::vector<std::vector<Index>>(orbits.begin(), orbits.end());
+}
+
+}  // namespace
+
+class AsymmetricUnitTest : public testing::Test {
+ protected:
+  AsymmetricUnitTest() {
+    prim = config::make_shared_prim(test::FCC_binary_prim());
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+};
+
+TEST_F(AsymmetricUnitTest, Test1) {
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration configuration(supercell);
+
+  // all sites equivalent
+  std::vector<Index> asymmetric_unit_index =
+      config::make_asymmetric_unit_index(configuration);
+  EXPECT_EQ(asymmetric_unit_index, std::vector<Index>(8, 0));
+
+  for (Index count = 0; count < 256; count += 7) {
+    for (Index l = 0; l < 8; ++l) {
+      configuration.dof_values.occupation(l) = (count >> l) & 1;
+    }
+    auto asymmetric_unit_indices =
+        config::make_asymmetric_unit_indices(configuration);
+    EXPECT_EQ(asymmetric_unit_indices,
+              make_expected_asymmetric_unit_indices(configuration));
+    EXPECT_EQ(config::make_asymmetric_unit_indices(
+                  config::make_asymmetric_unit_index(configuration)),
+              asymmetric_unit_indices);
+  }
+}
+
+TEST_F(AsymmetricUnitTest, ConsistentAsymmetricUnitIndices) {
+  Eigen::Matrix3l T1 = Eigen::Matrix3l::Identity();
+  T1(0, 0) = 4;
+  auto supercell1 = std::make_shared<config::Supercell const>(prim, T1);
+  Eigen::Matrix3l T2 = Eigen::Matrix3l::Identity();
+  T2(1, 1) = 4;
+  auto supercell2 = std::make_shared<config::Supercell const>(prim, T2);
+
+  config::Configuration configuration(supercell1);
+  configuration.dof_values.occupation << 0, 1, 1, 0;
+  auto initial = config::make_asymmetric_unit_indices(configuration);
+  EXPECT_EQ(initial.size(), 2);
+
+  auto const &prim_fg = prim->sym_info.factor_group->element;
+  xtal::Lattice const &lattice1 = supercell1->superlattice.superlattice();
+  xtal::Lattice const &lattice2 = supercell2->superlattice.superlattice();
+  Index n_checked = 0;
+  for (Index i = 0; i < prim_fg.size(); ++i) {
+    auto res = xtal::is_equivalent_superlattice(
+        lattice2, lattice1, prim_fg.begin() + i, prim_fg.begin() + i + 1,
+        lattice2.tol());
+    if (res.first == prim_fg.begin() + i + 1) {
+      continue;
+    }
+    config::Configuration configuration_ref = copy_configuration(
+        i, xtal::UnitCell(1, 0, 0), configuration, supercell2);
+    auto reference = config::make_asymmetric_unit_indices(configuration_ref);
+
+    auto final = config::make_consistent_asymmetric_unit_indices(
+        initial, configuration, reference, configuration_ref);
+    ASSERT_TRUE(final.has_value());
+    ASSERT_EQ(final->size(), reference.size());
+    for (Index j = 0; j < reference.size(); ++j) {
+      // equivalent asymmetric units have the same size and occupation
+      ASSERT_EQ((*final)[j].size(), reference[j].size());
+      EXPECT_EQ(
+          configuration.dof_values.occupation((*final)[j][0]),
+          configuration_ref.dof_values.occupation(reference[j][0]));
+    }
+    ++n_checked;
+  }
+  EXPECT_GT(n_checked, 0);
+
+  // not equivalent
+  config::Configuration other(supercell2);
+  other.dof_values.occupation << 0, 0, 0, 1;
+  EXPECT_FALSE(config::make_consistent_asymmetric_unit_indices(
+                   initial, configuration,
+                   config::make_asymmetric_unit_indices(other), other)
+                   .has_value());
+}
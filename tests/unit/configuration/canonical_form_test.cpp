@@ -1,5 +1,8 @@
 #include "casm/configuration/canonical_form.hh"
 
+#include "casm/configuration/SupercellSymOpRange.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/crystallography/Lattice.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
 #include "gtest/gtest.h"
 #include "teststructures.hh"
@@ -49,6 +52,65 @@ TEST_F(CanonicalFormFCCTest, TestSupercell2) {
   EXPECT_EQ(equivalents.size(), 3);
 }
 
+TEST_F(CanonicalFormFCCTest, TestSupercellLatticeOnly) {
+  Eigen::Matrix3d S;
+  S << 4., 0, 0, 0, 8., 0, 0, 0, 4.;
+  xtal::Superlattice superlat(prim->basicstructure->lattice(),
+                              xtal::Lattice(S));
+  auto tmp_supercell =
+      std::make_shared<config::Supercell const>(prim, superlat);
+  Eigen::Matrix3l const &T = superlat.transformation_matrix_to_super();
+
+  std::vector<Eigen::Matrix3l> equivalent_T =
+      config::make_equivalent_transformation_matrices(prim, T);
+  auto equivalents = make_equivalents(*tmp_supercell);
+  ASSERT_EQ(equivalent_T.size(), 3);
+  ASSERT_EQ(equivalents.size(), 3);
+  for (Index i = 0; i < equivalent_T.size(); ++i) {
+    EXPECT_EQ(equivalent_T[i],
+              equivalents[i]->superlattice.transformation_matrix_to_super());
+    auto const &head_group_index =
+        equivalents[i]->sym_info.factor_group->head_group_index;
+    EXPECT_EQ(config::make_superlattice_invariant_factor_group_indices(
+                  prim, equivalent_T[i]),
+              std::vector<Index>(head_group_index.begin(),
+                                 head_group_index.end()));
+  }
+
+  EXPECT_EQ(config::make_canonical_transformation_matrix(prim, T),
+            make_canonical_form(*tmp_supercell)
+                ->superlattice.transformation_matrix_to_super());
+
+  // batch variants do not depend on n_threads
+  std::vector<Eigen::Matrix3l> matrices;
+  for (auto const &equiv : equivalents) {
+    matrices.push_back(equiv->superlattice.transformation_matrix_to_super());
+  }
+  matrices.push_back(supercell->superlattice.transformation_matrix_to_super());
+  auto canonical_T =
+      config::make_canonical_transformation_matrices(prim, matrices, 4);
+  auto all_equivalent_T =
+      config::make_equivalent_transformation_matrices(prim, matrices, 4);
+  ASSERT_EQ(canonical_T.size(), matrices.size());
+  ASSERT_EQ(all_equivalent_T.size(), matrices.size());
+  for (Index i = 0; i < matrices.size(); ++i) {
+    EXPECT_EQ(canonical_T[i],
+              config::make_canonical_transformation_matrix(prim, matrices[i]));
+    EXPECT_EQ(all_equivalent_T[i],
+              config::make_equivalent_transformation_matrices(prim,
+                                                              matrices[i]));
+  }
+  EXPECT_EQ(canonical_T[0], canonical_T[1]);
+  EXPECT_EQ(canonical_T[0], canonical_T[2]);
+
+  std::vector<std::shared_ptr<config::Supercell const>> supercells(
+      {tmp_supercell, supercell});
+  auto all_equivalents = config::make_equivalents(supercells, 2);
+  ASSERT_EQ(all_equivalents.size(), 2);
+  EXPECT_EQ(all_equivalents[0].size(), 3);
+  EXPECT_EQ(all_equivalents[1].size(), make_equivalents(*supercell).size());
+}
+
 TEST_F(CanonicalFormFCCTest, Test1) {
   config::Configuration configuration(supercell);
   Eigen::VectorXi &occ = configuration.dof_values.occupation;
@@ -91,6 +153,88 @@ TEST_F(CanonicalFormFCCTest, Test2) {
   EXPECT_TRUE(almost_equal(equivalents[3].dof_values.occupation, expected));
 }
 
+TEST_F(CanonicalFormFCCTest, FindMappingOperation) {
+  Eigen::Matrix3l T1 = Eigen::Matrix3l::Identity();
+  T1(0, 0) = 3;
+  auto supercell1 = std::make_shared<config::Supercell const>(prim, T1);
+  Eigen::Matrix3l T2 = Eigen::Matrix3l::Identity();
+  T2(1, 1) = 3;
+  auto supercell2 = std::make_shared<config::Supercell const>(prim, T2);
+
+  config::Configuration configuration(supercell1);
+  configuration.dof_values.occupation << 0, 1, 1;
+
+  auto const &prim_fg = prim->sym_info.factor_group->element;
+  xtal::Lattice const &lattice1 = supercell1->superlattice.superlattice();
+  xtal::Lattice const &lattice2 = supercell2->superlattice.superlattice();
+  Eigen::Matrix3d const &L = prim->basicstructure->lattice().lat_column_mat();
+
+  // find the prim factor group operation and translation of mapping_op, and
+  // check that they copy `configuration` to `configuration_ref`
+  auto check = [&](config::Configuration const &configuration_ref) {
+    auto mapping_op = find_mapping_operation(configuration, configuration_ref);
+    ASSERT_TRUE(mapping_op.has_value());
+    Index count = 0;
+    for (Index i = 0; i < prim_fg.size(); ++i) {
+      if (!almost_equal(prim_fg[i].matrix, mapping_op->matrix)) {
+        continue;
+      }
+      Eigen::Vector3d frac =
+          L.inverse() * (mapping_op->translation - prim_fg[i].translation);
+      Eigen::Vector3l trans = frac.array().round().matrix().cast<long>();
+      ASSERT_TRUE(almost_equal(frac, trans.cast<double>()));
+      EXPECT_EQ(copy_configuration(i, xtal::UnitCell(trans), configuration,
+                                   configuration_ref.supercell),
+                configuration_ref);
+      ++count;
+    }
+    EXPECT_EQ(count, 1);
+  };
+
+  for (Index i = 0; i < prim_fg.size(); ++i) {
+    auto res = xtal::is_equivalent_superlattice(
+        lattice2, lattice1, prim_fg.begin() + i, prim_fg.begin() + i + 1,
+        lattice2.tol());
+    if (res.first == prim_fg.begin() + i + 1) {
+      continue;
+    }
+    check(copy_configuration(i, xtal::UnitCell(1, 0, 0), configuration,
+                             supercell2));
+  }
+
+  // same supercell
+  check(configuration);
+
+  // not equivalent
+  config::Configuration other(supercell2);
+  other.dof_values.occupation << 0, 0, 1;
+  EXPECT_FALSE(find_mapping_operation(configuration, other).has_value());
+
+  // different volume
+  config::Configuration larger(supercell);
+  EXPECT_FALSE(find_mapping_operation(configuration, larger).has_value());
+}
+
+TEST_F(CanonicalFormFCCTest, EquivalenceMapByCosets) {
+  config::Configuration configuration(supercell);
+  Eigen::VectorXi &occ = configuration.dof_values.occupation;
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+
+  std::vector<Eigen::VectorXi> occs(3, Eigen::VectorXi(4));
+  occs[0] << 0, 0, 1, 0;
+  occs[1] << 0, 0, 1, 1;
+  occs[2] << 1, 1, 1, 1;
+  for (auto const &value : occs) {
+    occ = value;
+    std::vector<config::Configuration> equivalents =
+        make_equivalents(configuration, begin, end);
+    auto expected = make_equivalence_map(equivalents, begin, end);
+    auto eq_map = make_equivalence_map_by_cosets(equivalents, begin, end);
+    EXPECT_EQ(eq_map, expected);
+  }
+}
+
 class CanonicalFormFCCTest2 : public testing::Test {
  protected:
   CanonicalFormFCCTest2() {
@@ -234,3 +378,61 @@ TEST_F(CanonicalFormFCCTernaryGLStrainDispTest, Test4) {
       expected_GLstrain,
       canonical_configuration.dof_values.global_dof_values.at("GLstrain")));
 }
+
+class CanonicalFormSimpleCubicGLStrainTest : public testing::Test {
+ protected:
+  CanonicalFormSimpleCubicGLStrainTest() {
+    auto prim = config::make_shared_prim(test::SimpleCubic_GLstrain_prim());
+    Eigen::Matrix3l T;
+    T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+    supercell = std::make_shared<config::Supercell const>(prim, T);
+  }
+
+  std::shared_ptr<config::Supercell const> supercell;
+};
+
+TEST_F(CanonicalFormSimpleCubicGLStrainTest, GlobalDoFOnly) {
+  config::Configuration configuration(supercell);
+  configuration.dof_values.global_dof_values.at("GLstrain")(2) = 0.01;
+  EXPECT_TRUE(config::is_global_dof_only_comparison(configuration));
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  auto range = config::SupercellSymOpRange::all(supercell);
+  Index n_translations = supercell->unitcell_index_converter.total_sites();
+
+  EXPECT_FALSE(is_canonical(configuration, begin, end));
+  EXPECT_FALSE(is_canonical(configuration, range));
+
+  config::SupercellSymOp op = to_canonical(configuration, begin, end);
+  EXPECT_EQ(op.translation_index(), 0);
+  EXPECT_EQ(to_canonical(configuration, range), op);
+
+  config::Configuration canonical_configuration =
+      make_canonical_form(configuration, begin, end);
+  Eigen::VectorXd expected_GLstrain(6);
+  expected_GLstrain << 0.01, 0., 0., 0., 0., 0.;
+  EXPECT_TRUE(almost_equal(
+      expected_GLstrain,
+      canonical_configuration.dof_values.global_dof_values.at("GLstrain")));
+  EXPECT_TRUE(is_canonical(canonical_configuration, begin, end));
+  EXPECT_TRUE(is_canonical(canonical_configuration, range));
+
+  // 16 point operations leave Ezz invariant, each with all translations
+  std::vector<config::SupercellSymOp> subgroup =
+      make_invariant_subgroup(configuration, begin, end);
+  EXPECT_EQ(subgroup.size(), 16 * n_translations);
+  EXPECT_EQ(make_invariant_subgroup(configuration, range), subgroup);
+
+  std::vector<config::Configuration> equivalents =
+      make_equivalents(configuration, begin, end);
+  EXPECT_EQ(equivalents.size(), 3);
+
+  auto equivalence_map = make_equivalence_map(equivalents, begin, end);
+  ASSERT_EQ(equivalence_map.size(), 3);
+  for (auto const &ops : equivalence_map) {
+    EXPECT_EQ(ops.size(), 16 * n_translations);
+  }
+  EXPECT_EQ(make_equivalence_map_by_cosets(equivalents, begin, end),
+            equivalence_map);
+}
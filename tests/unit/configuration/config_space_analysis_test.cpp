@@ -264,4 +264,95 @@ TEST_F(ConfigSpaceAnalysisTest, Test4) {
   expected.col(2) << 0.0, -0.5, 0.0, -0.5, 0.5, 0.0, 0.5, 0.0;
   expected.col(3) << 0.0, 0.5, 0.0, 0.5, 0.5, 0.0, 0.5, 0.0;
   EXPECT_TRUE(almost_equal(basis, expected));
-}
\ No newline at end of file
+}
+TEST_F(ConfigSpaceAnalysisTest, PartialMerge) {
+  make_prim(test::FCC_binary_prim());
+  build_configurations_1();
+
+  std::map<DoFKey, config::ConfigSpaceAnalysisResults> expected =
+      config::config_space_analysis(
+          configurations, dofs, exclude_homogeneous_modes,
+          include_default_occ_modes, sublattice_index_to_default_occ,
+          site_index_to_default_occ, tol, false);
+
+  // partial results for disjoint subsets, in the supercell of all of them
+  auto supercell = config::make_config_space_analysis_supercell(configurations);
+  std::map<std::string, config::Configuration> subset_a;
+  std::map<std::string, config::Configuration> subset_b;
+  for (auto const &pair : configurations) {
+    auto &subset = (subset_a.size() <= subset_b.size()) ? subset_a : subset_b;
+    subset.emplace(pair.first, pair.second);
+  }
+  config::ConfigSpaceAnalysisPartial partial_a =
+      config::config_space_analysis_partial(supercell, subset_a, dofs);
+  config::ConfigSpaceAnalysisPartial partial_b =
+      config::config_space_analysis_partial(supercell, subset_b, dofs);
+
+  // reduce into an empty partial, as after communicating plain matrices
+  config::ConfigSpaceAnalysisPartial reduced =
+      config::config_space_analysis_partial(supercell, {}, dofs);
+  EXPECT_EQ(reduced.n_configurations, 0);
+  reduced.merge(partial_a);
+  reduced.add_projector(partial_b.projector, partial_b.n_configurations);
+  EXPECT_EQ(reduced.n_configurations, 4);
+
+  std::map<DoFKey, config::ConfigSpaceAnalysisResults> results =
+      config::finish_config_space_analysis(reduced);
+  ASSERT_EQ(results.size(), expected.size());
+  auto const &result = results.at("occ");
+  EXPECT_TRUE(result.equivalent_configurations.empty());
+  EXPECT_TRUE(almost_equal(result.projector, expected.at("occ").projector));
+  EXPECT_TRUE(
+      almost_equal(result.eigenvalues, expected.at("occ").eigenvalues));
+
+  // same span, allowing rotation within degenerate eigenspaces
+  auto span_projector = [](Eigen::MatrixXd const &B) -> Eigen::MatrixXd {
+    return B * (B.transpose() * B).inverse() * B.transpose();
+  };
+  EXPECT_TRUE(almost_equal(
+      span_projector(result.symmetry_adapted_dof_space.basis),
+      span_projector(expected.at("occ").symmetry_adapted_dof_space.basis)));
+
+  // mismatched shapes are rejected
+  std::map<DoFKey, Eigen::MatrixXd> wrong_shape;
+  wrong_shape.emplace("occ", Eigen::MatrixXd::Zero(2, 2));
+  EXPECT_THROW(reduced.add_projector(wrong_shape, 1), std::runtime_error);
+}
+
+TEST_F(ConfigSpaceAnalysisTest, PrototypeSupercells) {
+  make_prim(test::FCC_binary_prim());
+  build_configurations_1();
+
+  std::map<DoFKey, config::ConfigSpaceAnalysisResults> expected =
+      config::config_space_analysis(
+          configurations, dofs, exclude_homogeneous_modes,
+          include_default_occ_modes, sublattice_index_to_default_occ,
+          site_index_to_default_occ, tol, false);
+
+  for (Index n_threads : {1, 2}) {
+    std::map<DoFKey, config::ConfigSpaceAnalysisResults> results =
+        config::config_space_analysis(
+            configurations, dofs, exclude_homogeneous_modes,
+            include_default_occ_modes, sublattice_index_to_default_occ,
+            site_index_to_default_occ, tol, false, n_threads, std::nullopt,
+            true);
+    ASSERT_EQ(results.size(), expected.size());
+    auto const &result = results.at("occ");
+    auto const &expected_result = expected.at("occ");
+    auto const &dof_space = result.standard_dof_space;
+    auto const &expected_dof_space = expected_result.standard_dof_space;
+    EXPECT_EQ(dof_space.transformation_matrix_to_super,
+              expected_dof_space.transformation_matrix_to_super);
+    EXPECT_TRUE(almost_equal(result.projector, expected_result.projector));
+    EXPECT_TRUE(
+        almost_equal(result.eigenvalues, expected_result.eigenvalues));
+  }
+
+  // equivalents are not generated in the fully commensurate supercell
+  EXPECT_THROW(config::config_space_analysis(
+                   configurations, dofs, exclude_homogeneous_modes,
+                   include_default_occ_modes, sublattice_index_to_default_occ,
+                   site_index_to_default_occ, tol, true, 1, std::nullopt,
+                   true),
+               std::runtime_error);
+}
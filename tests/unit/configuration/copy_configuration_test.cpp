@@ -1,6 +1,9 @@
 #include "casm/configuration/copy_configuration.hh"
 
+#include <algorithm>
+
 #include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SuperConfigurationGenerator.hh"
 #include "casm/configuration/SupercellSymOp.hh"
 #include "casm/configuration/canonical_form.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
@@ -153,6 +156,59 @@ TEST_F(CopyConfigurationFCCTest, MakePrimitiveTest1) {
   EXPECT_EQ(occ(primitive_configuration, {0, 1, 0, 0}), 0);
 }
 
+TEST_F(CopyConfigurationFCCTest, SuperConfigurationGeneratorTest1) {
+  // 2-site motif, tiled into the 4-site conventional FCC cell
+  config::Configuration motif(sub_supercell_xy);
+  occ(motif, 0) = 1;
+
+  std::vector<config::Configuration> all =
+      config::make_all_super_configurations(motif, supercell);
+  std::sort(all.begin(), all.end());
+
+  for (Index batch_size : {1, 2, 100}) {
+    for (Index n_threads : {1, 4}) {
+      config::SuperConfigurationGenerator generator(motif, supercell,
+                                                    batch_size, n_threads);
+      EXPECT_EQ(generator.n_subsets(),
+                Index(config::make_distinct_super_configurations(motif,
+                                                                 supercell)
+                          .size()));
+      std::vector<config::Configuration> found;
+      config::Configuration configuration(supercell);
+      while (generator.next(configuration)) {
+        found.push_back(configuration);
+      }
+      std::sort(found.begin(), found.end());
+      EXPECT_EQ(found, all);
+    }
+  }
+}
+
+TEST_F(CopyConfigurationFCCTest, MakePrimitiveTest2) {
+  // 2-site motif, tiled into a 108-site supercell, which requires more than
+  // one lattice reduction step
+  config::Configuration motif(sub_supercell_xy);
+  occ(motif, 0) = 1;
+  Eigen::Matrix3l T =
+      supercell->superlattice.transformation_matrix_to_super() * 3;
+  auto large_supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration configuration =
+      copy_configuration(motif, large_supercell);
+  EXPECT_EQ(total_sites(configuration), 108);
+  EXPECT_EQ(is_primitive(configuration), false);
+
+  config::Configuration primitive_configuration = make_primitive(configuration);
+  EXPECT_EQ(total_sites(primitive_configuration), 2);
+  EXPECT_EQ(is_primitive(primitive_configuration), true);
+  EXPECT_EQ(copy_configuration(primitive_configuration, large_supercell),
+            configuration);
+
+  // a single differing site makes the configuration primitive
+  occ(configuration, 5) = 1 - occ(configuration, 5);
+  EXPECT_EQ(is_primitive(configuration), true);
+  EXPECT_EQ(total_sites(make_primitive(configuration)), 108);
+}
+
 TEST_F(CopyConfigurationFCCTest, CopyTransformTest1) {
   // This creates a 4-site conventional FCC cell,
   // where z=0 has occ=1, z=1/2 has occ=0
@@ -387,3 +387,42 @@ TEST(AllSubgroupsTest, Test2) {
             }),
             1);
 }
+
+// more than 64 elements: subgroups of Z_130 are the cyclic subgroups of
+// order d, for each divisor d of 130
+TEST(AllSubgroupsTest, Test3) {
+  using namespace group;
+  using namespace cyclic_subgroups_test;
+  Index n = 130;
+  std::vector<Index> elements;
+  for (Index i = 0; i < n; ++i) {
+    elements.push_back(i);
+  }
+  Group<Index> group = make_group(
+      elements, [=](Index i, Index j) { return (i + j) % n; }, equal_to_f);
+  std::set<SubgroupOrbit> all_subgroups = make_all_subgroups(group);
+
+  EXPECT_EQ(all_subgroups.size(), 8);
+  auto any_count = make_any_count(all_subgroups);
+  for (Index d : {1, 2, 5, 10, 13, 26, 65, 130}) {
+    SubgroupIndices subgroup;
+    for (Index i = 0; i < n; i += n / d) {
+      subgroup.insert(i);
+    }
+    EXPECT_EQ(any_count(subgroup), 1);
+  }
+}
+
+// the 98 subgroups of m-3m, in 33 orbits
+TEST(AllSubgroupsTest, Test4) {
+  using namespace group;
+  config::PrimSymInfo prim_sym_info(test::FCC_binary_prim());
+  std::set<SubgroupOrbit> all_subgroups =
+      make_all_subgroups(*prim_sym_info.factor_group);
+  Index n_subgroups = 0;
+  for (auto const &orbit : all_subgroups) {
+    n_subgroups += orbit.size();
+  }
+  EXPECT_EQ(all_subgroups.size(), 33);
+  EXPECT_EQ(n_subgroups, 98);
+}
@@ -1,5 +1,8 @@
 #include "casm/configuration/dof_space_analysis.hh"
 
+#include <algorithm>
+
+#include "casm/configuration/DoFSpace_functions.hh"
 #include "casm/crystallography/io/BasicStructureIO.hh"
 #include "casm/misc/CASM_Eigen_math.hh"
 #include "gtest/gtest.h"
@@ -397,4 +400,252 @@ TEST_F(DoFSpaceAnalysisTest, Test6) {
   EXPECT_EQ(irreps.size(), 3);
   EXPECT_EQ(symmetry_adapted_subspace.rows(), 9);
   EXPECT_EQ(symmetry_adapted_subspace.cols(), 9);
-}
\ No newline at end of file
+}
+
+namespace {
+
+// number of distinct M * A, for M in rep
+Index _orbit_size(std::vector<Eigen::MatrixXd> const &rep,
+                  Eigen::MatrixXd const &A) {
+  std::vector<Eigen::MatrixXd> orbit;
+  for (Eigen::MatrixXd const &M : rep) {
+    Eigen::MatrixXd test = M * A;
+    bool found = false;
+    for (Eigen::MatrixXd const &B : orbit) {
+      if (almost_equal(B, test)) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      orbit.push_back(test);
+    }
+  }
+  return orbit.size();
+}
+
+}  // namespace
+
+TEST_F(DoFSpaceAnalysisTest, SubWedgesDisp) {
+  // conventional FCC cell, disp, calculate wedges
+  make_prim(test::FCC_binary_disp_prim());
+
+  Eigen::Matrix3l T;
+  T << -1, 1, 1,  //
+      1, -1, 1,   //
+      1, 1, -1;   //
+  transformation_matrix_to_super = T;
+  make_dof_space("disp");
+
+  calc_wedges = true;
+  config::DoFSpaceAnalysisResults results = config::dof_space_analysis(
+      *dof_space, prim, configuration, exclude_homogeneous_modes,
+      include_default_occ_modes, sublattice_index_to_default_occ,
+      site_index_to_default_occ, calc_wedges, log);
+
+  irreps::VectorSpaceSymReport const &symmetry_report = results.symmetry_report;
+  std::vector<Eigen::MatrixXd> const &rep = symmetry_report.symgroup_rep;
+  std::vector<irreps::SubWedge> const &wedge =
+      symmetry_report.irreducible_wedge;
+  ASSERT_GT(wedge.size(), 0);
+
+  // SubWedges are distinct, and their orbits together contain every
+  // combination of equivalent irrep wedges
+  Index n_combinations = 1;
+  for (irreps::IrrepWedge const &irrep_wedge : wedge[0].irrep_wedges) {
+    n_combinations *= _orbit_size(rep, irrep_wedge.axes);
+  }
+  Index n_covered = 0;
+  for (Index i = 0; i < wedge.size(); ++i) {
+    n_covered += _orbit_size(rep, wedge[i].trans_mat);
+    for (Index j = 0; j < i; ++j) {
+      for (Eigen::MatrixXd const &M : rep) {
+        EXPECT_FALSE(almost_equal(M * wedge[j].trans_mat, wedge[i].trans_mat));
+      }
+    }
+  }
+  EXPECT_EQ(n_covered, n_combinations);
+}
+
+namespace {
+
+template <typename Derived>
+bool _is_equal_complex(Eigen::MatrixBase<Derived> const &A,
+                       Eigen::MatrixBase<Derived> const &B) {
+  return A.rows() == B.rows() && A.cols() == B.cols() &&
+         (A.size() == 0 || (A - B).cwiseAbs().maxCoeff() < TOL);
+}
+
+// Projectors onto the isotypic components, i.e. the sum over all irreps with
+// the same characters, which do not depend on the decomposition method
+std::vector<std::pair<Eigen::VectorXcd, Eigen::MatrixXcd>>
+_isotypic_projectors(std::vector<irreps::IrrepInfo> const &irreps) {
+  std::vector<std::pair<Eigen::VectorXcd, Eigen::MatrixXcd>> result;
+  for (irreps::IrrepInfo const &irrep : irreps) {
+    Eigen::MatrixXcd P = irrep.trans_mat.adjoint() * irrep.trans_mat;
+    auto it = std::find_if(result.begin(), result.end(), [&](auto const &x) {
+      return _is_equal_complex(x.first, irrep.characters);
+    });
+    if (it == result.end()) {
+      result.emplace_back(irrep.characters, P);
+    } else {
+      it->second += P;
+    }
+  }
+  return result;
+}
+
+void _expect_same_isotypic_projectors(
+    std::vector<irreps::IrrepInfo> const &irreps_a,
+    std::vector<irreps::IrrepInfo> const &irreps_b) {
+  auto P_a = _isotypic_projectors(irreps_a);
+  auto P_b = _isotypic_projectors(irreps_b);
+  ASSERT_EQ(P_a.size(), P_b.size());
+  for (auto const &x : P_a) {
+    auto it = std::find_if(P_b.begin(), P_b.end(), [&](auto const &y) {
+      return _is_equal_complex(x.first, y.first);
+    });
+    ASSERT_TRUE(it != P_b.end());
+    EXPECT_TRUE(_is_equal_complex(x.second, it->second));
+  }
+}
+
+}  // namespace
+
+TEST_F(DoFSpaceAnalysisTest, KPointBlocksOcc) {
+  // conventional FCC cell, occ, decompose by k-point star blocks
+  make_prim(test::FCC_binary_prim());
+
+  Eigen::Matrix3l T;
+  T << -1, 1, 1,  //
+      1, -1, 1,   //
+      1, 1, -1;   //
+  transformation_matrix_to_super = T;
+  make_dof_space("occ");
+
+  config::DoFSpaceAnalysisResults expected = config::dof_space_analysis(
+      *dof_space, prim, configuration, exclude_homogeneous_modes,
+      include_default_occ_modes, sublattice_index_to_default_occ,
+      site_index_to_default_occ, calc_wedges, log);
+  config::DoFSpaceAnalysisResults results = config::dof_space_analysis(
+      *dof_space, prim, configuration, exclude_homogeneous_modes,
+      include_default_occ_modes, sublattice_index_to_default_occ,
+      site_index_to_default_occ, calc_wedges, log, nullptr, 2, true);
+
+  irreps::VectorSpaceSymReport const &report = results.symmetry_report;
+  EXPECT_EQ(report.irreps.size(), 2);
+  EXPECT_EQ(report.symmetry_adapted_subspace.rows(), 8);
+  EXPECT_EQ(report.symmetry_adapted_subspace.cols(), 4);
+  EXPECT_EQ(report.symgroup_rep.size(), 0);
+  _expect_same_isotypic_projectors(expected.symmetry_report.irreps,
+                                   report.irreps);
+}
+
+TEST_F(DoFSpaceAnalysisTest, KPointBlocksDisp) {
+  // conventional FCC cell, disp, decompose by k-point star blocks
+  make_prim(test::FCC_binary_disp_prim());
+
+  Eigen::Matrix3l T;
+  T << -1, 1, 1,  //
+      1, -1, 1,   //
+      1, 1, -1;   //
+  transformation_matrix_to_super = T;
+  make_dof_space("disp");
+
+  config::DoFSpaceAnalysisResults expected = config::dof_space_analysis(
+      *dof_space, prim, configuration, exclude_homogeneous_modes,
+      include_default_occ_modes, sublattice_index_to_default_occ,
+      site_index_to_default_occ, calc_wedges, log);
+  config::DoFSpaceAnalysisResults results = config::dof_space_analysis(
+      *dof_space, prim, configuration, exclude_homogeneous_modes,
+      include_default_occ_modes, sublattice_index_to_default_occ,
+      site_index_to_default_occ, calc_wedges, log, nullptr, 2, true);
+
+  Eigen::MatrixXd const &S_expected =
+      expected.symmetry_report.symmetry_adapted_subspace;
+  Eigen::MatrixXd const &S = results.symmetry_report.symmetry_adapted_subspace;
+  ASSERT_EQ(S.rows(), S_expected.rows());
+  ASSERT_EQ(S.cols(), S_expected.cols());
+  Eigen::MatrixXd P = S * S.transpose();
+  Eigen::MatrixXd P_expected = S_expected * S_expected.transpose();
+  EXPECT_TRUE(almost_equal(P, P_expected));
+  _expect_same_isotypic_projectors(expected.symmetry_report.irreps,
+                                   results.symmetry_report.irreps);
+}
+
+TEST_F(DoFSpaceAnalysisTest, SpecialDirectionsThreads) {
+  // conventional FCC cell, disp: special directions of 3- and 6-dimensional
+  // irreps do not depend on the number of threads
+  make_prim(test::FCC_binary_disp_prim());
+
+  Eigen::Matrix3l T;
+  T << -1, 1, 1,  //
+      1, -1, 1,   //
+      1, 1, -1;   //
+  transformation_matrix_to_super = T;
+  make_dof_space("disp");
+
+  std::vector<config::DoFSpaceAnalysisResults> results;
+  for (Index n_threads : {1, 4}) {
+    results.push_back(config::dof_space_analysis(
+        *dof_space, prim, configuration, exclude_homogeneous_modes,
+        include_default_occ_modes, sublattice_index_to_default_occ,
+        site_index_to_default_occ, calc_wedges, log, nullptr, n_threads));
+  }
+  auto const &irreps_a = results[0].symmetry_report.irreps;
+  auto const &irreps_b = results[1].symmetry_report.irreps;
+  ASSERT_EQ(irreps_a.size(), irreps_b.size());
+  for (Index i = 0; i < irreps_a.size(); ++i) {
+    ASSERT_EQ(irreps_a[i].directions.size(), irreps_b[i].directions.size());
+    for (Index j = 0; j < irreps_a[i].directions.size(); ++j) {
+      ASSERT_EQ(irreps_a[i].directions[j].size(),
+                irreps_b[i].directions[j].size());
+      for (Index k = 0; k < irreps_a[i].directions[j].size(); ++k) {
+        EXPECT_TRUE(almost_equal(irreps_a[i].directions[j][k],
+                                 irreps_b[i].directions[j][k]));
+      }
+    }
+  }
+  EXPECT_TRUE(
+      almost_equal(results[0].symmetry_report.symmetry_adapted_subspace,
+                   results[1].symmetry_report.symmetry_adapted_subspace));
+}
+
+TEST_F(DoFSpaceAnalysisTest, ExcludeDefaultOccModes) {
+  // conventional FCC cell, ternary occupation
+  make_prim(test::FCC_ternary_prim());
+
+  Eigen::Matrix3l T;
+  T << -1, 1, 1,  //
+      1, -1, 1,   //
+      1, 1, -1;   //
+  transformation_matrix_to_super = T;
+  make_dof_space("occ");
+
+  clexulator::DoFSpace expected =
+      clexulator::exclude_default_occ_modes(*dof_space);
+  for (Index n_threads : {1, 4}) {
+    clexulator::DoFSpace by_default = config::exclude_default_occ_modes(
+        *dof_space, false, std::nullopt, std::nullopt, n_threads);
+    EXPECT_TRUE(almost_equal(by_default.basis, expected.basis));
+
+    clexulator::DoFSpace by_sublattice =
+        config::exclude_default_occ_modes_by_sublattice(*dof_space, {{0, 0}},
+                                                        n_threads);
+    EXPECT_TRUE(almost_equal(by_sublattice.basis, expected.basis));
+
+    std::map<Index, int> site_index_to_default_occ;
+    for (Index l = 0; l < 4; ++l) {
+      site_index_to_default_occ[l] = 0;
+    }
+    clexulator::DoFSpace by_site = config::exclude_default_occ_modes_by_site(
+        *dof_space, site_index_to_default_occ, n_threads);
+    EXPECT_TRUE(almost_equal(by_site.basis, expected.basis));
+
+    // default occupant 1 on site 0 only
+    clexulator::DoFSpace one_site = config::exclude_default_occ_modes_by_site(
+        *dof_space, {{0, 1}}, n_threads);
+    EXPECT_EQ(one_site.basis.rows(), 12);
+    EXPECT_EQ(one_site.basis.cols(), 11);
+  }
+}
@@ -0,0 +1,95 @@
+#include "casm/configuration/sym_info/factor_group.hh"
+
+#include "casm/configuration/group/Group.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/BasicStructureTools.hh"
+#include "casm/crystallography/Lattice.hh"
+#include "casm/crystallography/SymType.hh"
+#include "casm/crystallography/SymTypeComparator.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// Multiplication table found by searching all elements, as by make_group
+/// without a hash function
+group::MultiplicationTable make_reference_table(
+    std::vector<xtal::SymOp> const &elements, xtal::Lattice const &lattice) {
+  std::multiplies<xtal::SymOp> multiply_f;
+  xtal::SymOpPeriodicCompare_f equal_to_f(lattice, lattice.tol());
+  return group::make_group(elements, multiply_f, equal_to_f)
+      .multiplication_table;
+}
+
+void check_factor_group(xtal::BasicStructure const &prim) {
+  xtal::Lattice const &lattice = prim.lattice();
+  std::vector<xtal::SymOp> elements = xtal::make_factor_group(prim);
+
+  std::multiplies<xtal::SymOp> multiply_f;
+  xtal::SymOpPeriodicCompare_f equal_to_f(lattice, lattice.tol());
+  sym_info::SymOpPeriodicHash_f hash_f(lattice);
+  for (Index n_threads : {1, 2, 0}) {
+    auto hashed =
+        group::make_group(elements, multiply_f, equal_to_f, hash_f, n_threads);
+    EXPECT_EQ(hashed.multiplication_table,
+              make_reference_table(elements, lattice));
+  }
+
+  auto factor_group = sym_info::make_symgroup(elements, lattice, 2);
+  EXPECT_EQ(factor_group->element.size(), elements.size());
+  EXPECT_EQ(factor_group->multiplication_table,
+            make_reference_table(factor_group->element, lattice));
+
+  auto unsorted = sym_info::make_symgroup_without_sorting(elements, lattice, 2);
+  EXPECT_EQ(unsorted->multiplication_table,
+            make_reference_table(elements, lattice));
+}
+
+}  // namespace
+
+TEST(FactorGroupTest, HashedMultiplicationTable) {
+  check_factor_group(test::FCC_binary_prim());
+  check_factor_group(test::ZrO_prim());
+  check_factor_group(test::SimpleCubic_ising_prim());
+}
+
+TEST(FactorGroupTest, HashedMultiplicationTableWithTranslations) {
+  // factor group of a 2x2x2 supercell, including the translations
+  xtal::BasicStructure prim = test::FCC_binary_prim();
+  xtal::Lattice const &lattice = prim.lattice();
+  xtal::Lattice superlattice(2.0 * lattice.lat_column_mat(), lattice.tol());
+  std::vector<xtal::SymOp> elements;
+  for (xtal::SymOp const &op : xtal::make_factor_group(prim)) {
+    for (int i = 0; i < 2; ++i) {
+      for (int j = 0; j < 2; ++j) {
+        for (int k = 0; k < 2; ++k) {
+          Eigen::Vector3d t =
+              lattice.lat_column_mat() * Eigen::Vector3d(i, j, k);
+          elements.emplace_back(op.matrix, op.translation + t,
+                                op.is_time_reversal_active);
+        }
+      }
+    }
+  }
+  std::multiplies<xtal::SymOp> multiply_f;
+  xtal::SymOpPeriodicCompare_f equal_to_f(superlattice, superlattice.tol());
+  sym_info::SymOpPeriodicHash_f hash_f(superlattice);
+  auto hashed = group::make_group(elements, multiply_f, equal_to_f, hash_f, 2);
+  EXPECT_EQ(hashed.multiplication_table,
+            make_reference_table(elements, superlattice));
+}
+
+TEST(FactorGroupTest, SymOpPeriodicHash) {
+  xtal::BasicStructure prim = test::ZrO_prim();
+  xtal::Lattice const &lattice = prim.lattice();
+  sym_info::SymOpPeriodicHash_f hash_f(lattice);
+  for (xtal::SymOp const &op : xtal::make_factor_group(prim)) {
+    // equal up to a lattice translation
+    Eigen::Vector3d t = lattice.lat_column_mat() * Eigen::Vector3d(1, -2, 3);
+    xtal::SymOp translated(op.matrix, op.translation + t,
+                           op.is_time_reversal_active);
+    EXPECT_EQ(hash_f(op), hash_f(translated));
+  }
+}
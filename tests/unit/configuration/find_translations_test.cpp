@@ -0,0 +1,105 @@
+#include "casm/configuration/find_translations.hh"
+
+#include <set>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+std::vector<Index> brute_force_translation_indices(
+    config::Configuration const &from, config::Configuration const &to) {
+  std::vector<Index> result;
+  Index n_unitcells = from.supercell->unitcell_index_converter.total_sites();
+  for (Index t = 0; t < n_unitcells; ++t) {
+    if (copy_apply(config::SupercellSymOp(from.supercell, 0, t), from) == to) {
+      result.push_back(t);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(TranslationGridTest, SmithNormalForm) {
+  std::vector<Eigen::Matrix3l> matrices(3);
+  matrices[0] << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  matrices[1] << 1, 1, 0, -1, 1, 0, 0, 0, 3;
+  matrices[2] << 2, -1, 4, 0, 3, 1, 1, 1, 2;
+  for (Eigen::Matrix3l const &M : matrices) {
+    Eigen::Matrix3l U, S, V;
+    config::smith_normal_form(M, U, S, V);
+    EXPECT_EQ(U * M * V, S);
+    EXPECT_EQ(std::abs(U.determinant()), 1);
+    EXPECT_EQ(std::abs(V.determinant()), 1);
+    EXPECT_TRUE(S.isDiagonal());
+    EXPECT_GT(S(0, 0), 0);
+    EXPECT_EQ(S(1, 1) % S(0, 0), 0);
+    EXPECT_EQ(S(2, 2) % S(1, 1), 0);
+    EXPECT_EQ(S.determinant(), std::abs(M.determinant()));
+  }
+}
+
+TEST(TranslationGridTest, Coordinates) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << 1, 1, 0, -1, 1, 0, 0, 0, 3;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::TranslationGrid const &grid = supercell->sym_info.translation_grid;
+  EXPECT_EQ(grid.shape, Eigen::Vector3l(1, 1, 6));
+  EXPECT_EQ(grid.size(), 6);
+
+  // unit cells within the supercell have distinct grid coordinates
+  std::set<Index> linear_indices;
+  for (Index t = 0; t < grid.size(); ++t) {
+    linear_indices.insert(
+        grid.linear_index(supercell->unitcell_index_converter(t)));
+  }
+  EXPECT_EQ(Index(linear_indices.size()), grid.size());
+
+  // supercell lattice translations have grid coordinate 0
+  for (Index i = 0; i < 3; ++i) {
+    EXPECT_EQ(grid.linear_index(UnitCell(Eigen::Vector3l(T.col(i)))), 0);
+  }
+}
+
+TEST(FindTranslationsTest, MatchesBruteForce) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T_motif;
+  T_motif << 1, 1, 0, -1, 1, 0, 0, 0, 1;
+  auto motif_supercell =
+      std::make_shared<config::Supercell const>(prim, T_motif);
+  config::Configuration motif(motif_supercell);
+  motif.dof_values.occupation(0) = 1;
+
+  Eigen::Matrix3l T;
+  T << 2, 2, 0, -2, 2, 0, 0, 0, 3;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration periodic = copy_configuration(motif, supercell);
+  config::Configuration single(supercell);
+  single.dof_values.occupation(3) = 2;
+  single.dof_values.occupation(10) = 1;
+
+  for (config::Configuration const &from : {periodic, single}) {
+    for (Index t : {Index(0), Index(5)}) {
+      config::Configuration to =
+          copy_apply(config::SupercellSymOp(supercell, 0, t), from);
+      std::vector<Index> expected = brute_force_translation_indices(from, to);
+      EXPECT_EQ(config::find_translation_indices(from, to), expected);
+      EXPECT_EQ(config::find_occupation_translation_indices(from, to),
+                expected);
+    }
+  }
+  EXPECT_EQ(config::find_translation_indices(periodic, periodic).size(), 12);
+  EXPECT_EQ(config::find_translation_indices(single, single).size(), 1);
+  EXPECT_TRUE(config::find_translation_indices(periodic, single).empty());
+
+  std::vector<Index> overlap =
+      config::make_translation_occupation_overlap(single, single);
+  EXPECT_EQ(overlap[0], supercell->unitcellcoord_index_converter.total_sites());
+}
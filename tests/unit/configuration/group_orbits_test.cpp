@@ -0,0 +1,128 @@
+#include "casm/configuration/group/orbits.hh"
+
+#include <functional>
+#include <vector>
+
+#include "casm/global/definitions.hh"
+#include "gtest/gtest.h"
+
+using namespace CASM;
+
+namespace {
+
+typedef std::vector<int> element_type;
+
+/// Cyclic shift of `element` by `shift`
+element_type _copy_apply(Index shift, element_type const &element) {
+  element_type result(element.size());
+  for (Index i = 0; i < element.size(); ++i) {
+    result[(i + shift) % element.size()] = element[i];
+  }
+  return result;
+}
+
+/// Cyclic shift of `element` by `shift`, written into `result`
+void _apply(Index shift, element_type const &element, element_type &result) {
+  result.resize(element.size());
+  for (Index i = 0; i < element.size(); ++i) {
+    result[(i + shift) % element.size()] = element[i];
+  }
+}
+
+/// Cyclic shift, stopping as soon as the image is known not to be greater
+/// than `best`
+bool _apply_if_greater(Index shift, element_type const &element,
+                       element_type const &best, element_type &result) {
+  Index n = element.size();
+  result.resize(n);
+  bool is_equal = true;
+  for (Index i = 0; i < n; ++i) {
+    // result[i] = element[(i - shift) mod n], generated in order of i
+    result[i] = element[(i + n - shift % n) % n];
+    if (is_equal) {
+      if (result[i] < best[i]) {
+        return false;
+      }
+      if (result[i] > best[i]) {
+        is_equal = false;
+      }
+    }
+  }
+  return !is_equal;
+}
+
+}  // namespace
+
+TEST(GroupOrbitsTest, ScratchAndEarlyExit) {
+  std::vector<Index> group({0, 1, 2, 3, 4, 5});
+  std::vector<element_type> elements(
+      {{0, 1, 0, 0, 1, 1}, {2, 0, 1, 0, 0, 0}, {1, 1, 1, 1, 1, 1}});
+
+  element_type best;
+  element_type scratch;
+  for (auto const &element : elements) {
+    element_type expected = group::make_canonical_element(
+        element, group.begin(), group.end(), std::less<element_type>(),
+        _copy_apply);
+    EXPECT_EQ(group::make_canonical_element(
+                  element, group.begin(), group.end(),
+                  std::less<element_type>(), _apply, best, scratch),
+              expected);
+    EXPECT_EQ(group::make_canonical_element_early_exit(
+                  element, group.begin(), group.end(), _apply,
+                  _apply_if_greater, best, scratch),
+              expected);
+
+    auto expected_orbit =
+        group::make_orbit(element, group.begin(), group.end(),
+                          std::less<element_type>(), _copy_apply);
+    EXPECT_EQ(group::make_orbit(element, group.begin(), group.end(),
+                                std::less<element_type>(), _apply, scratch),
+              expected_orbit);
+  }
+}
+
+TEST(GroupOrbitsTest, HashedOrbit) {
+  std::vector<Index> group({0, 1, 2, 3, 4, 5});
+  element_type element({0, 1, 0, 0, 1, 1});
+
+  auto hash_f = [](element_type const &x) {
+    std::size_t seed = 0;
+    for (int v : x) {
+      seed = seed * 31 + std::hash<int>()(v);
+    }
+    return seed;
+  };
+  element_type scratch;
+  auto orbit = group::make_hashed_orbit(element, group.begin(), group.end(),
+                                        hash_f, std::equal_to<element_type>(),
+                                        _apply, scratch);
+  auto expected_orbit =
+      group::make_orbit(element, group.begin(), group.end(),
+                        std::less<element_type>(), _copy_apply);
+  EXPECT_EQ(orbit.size(), expected_orbit.size());
+  for (auto const &x : expected_orbit) {
+    EXPECT_EQ(orbit.count(x), 1);
+  }
+}
+
+TEST(GroupOrbitsTest, EquivalenceMapByCosets) {
+  std::vector<Index> group({0, 1, 2, 3, 4, 5});
+  group::MultiplicationTable multiplication_table(6, std::vector<Index>(6));
+  for (Index i = 0; i < 6; ++i) {
+    for (Index j = 0; j < 6; ++j) {
+      multiplication_table[i][j] = (i + j) % 6;
+    }
+  }
+  std::vector<element_type> elements(
+      {{0, 1, 0, 0, 1, 0}, {0, 1, 0, 0, 1, 1}, {1, 1, 1, 1, 1, 1}});
+  for (auto const &element : elements) {
+    auto orbit = group::make_orbit(element, group.begin(), group.end(),
+                                   std::less<element_type>(), _copy_apply);
+    auto expected = group::make_equivalence_map(orbit, group.begin(),
+                                                group.end(), _copy_apply);
+    auto eq_map = group::make_equivalence_map_by_cosets(
+        orbit, group.begin(), group.end(), multiplication_table, _copy_apply);
+    EXPECT_EQ(eq_map, expected);
+  }
+}
@@ -215,3 +215,55 @@ TEST_F(MakeSimpleStructureTestStrainDisp, Test1) {
   // check disp
   EXPECT_FALSE(structure.atom_info.properties.count("disp"));
 }
+
+TEST_F(MakeSimpleStructureTestStrainDisp, BatchTest) {
+  DoFKey strain_dof_key = "GLstrain";
+  xtal::StrainConverter DoFstrain_converter(
+      strain_dof_key, prim->global_dof_info.at(strain_dof_key).basis());
+
+  std::vector<config::Configuration> configurations;
+  for (Index k = 0; k < 5; ++k) {
+    config::Configuration configuration(supercell);
+    auto &dof_values = configuration.dof_values;
+    for (Index l = 0; l < k && l < 4; ++l) {
+      dof_values.occupation(l) = 1 + (k + l) % 2;
+    }
+    Eigen::MatrixXd disp = Eigen::MatrixXd::Zero(3, 4);
+    disp.col(k % 4) << 0.01 * k, 0.0, -0.01;
+    dof_values.local_dof_values.at("disp") = disp;
+    Eigen::Matrix3d F = Eigen::Matrix3d::Identity();
+    F(2, 2) = 1.0 + 0.05 * k;
+    F(0, 1) = 0.01 * k;
+    F(1, 0) = 0.01 * k;
+    dof_values.global_dof_values.at(strain_dof_key) =
+        DoFstrain_converter.from_F(F);
+    configurations.push_back(configuration);
+  }
+
+  for (Index n_threads : {1, 3}) {
+    // exclude "B" to check that excluded sites are skipped
+    config::ToAtomicStructure f("chemical_name", {"B"});
+    config::AtomicStructureBatch batch =
+        f.make_batch(configurations, n_threads);
+    ASSERT_EQ(batch.n_configurations(), configurations.size());
+    ASSERT_EQ(batch.coords.cols(), batch.atom_offset.back());
+    ASSERT_EQ(batch.atom_type.size(), batch.atom_offset.back());
+
+    for (Index k = 0; k < configurations.size(); ++k) {
+      xtal::SimpleStructure structure = f(configurations[k]);
+      Index begin = batch.atom_offset[k];
+      Index n_atoms = batch.atom_offset[k + 1] - begin;
+      ASSERT_EQ(n_atoms, structure.atom_info.names.size());
+      EXPECT_TRUE(almost_equal(Eigen::MatrixXd(structure.lat_column_mat),
+                               Eigen::MatrixXd(batch.lat_column_mat.middleCols(
+                                   3 * k, 3))));
+      EXPECT_TRUE(almost_equal(structure.atom_info.coords,
+                               Eigen::MatrixXd(batch.coords.middleCols(
+                                   begin, n_atoms))));
+      for (Index i = 0; i < n_atoms; ++i) {
+        EXPECT_EQ(batch.atom_type_names[batch.atom_type(begin + i)],
+                  structure.atom_info.names[i]);
+      }
+    }
+  }
+}
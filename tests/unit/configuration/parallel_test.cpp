@@ -0,0 +1,94 @@
+#include "casm/configuration/parallel.hh"
+
+#include <numeric>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+using namespace CASM;
+
+TEST(ParallelTest, SetNumThreads) {
+  config::set_num_threads(3);
+  EXPECT_EQ(config::get_num_threads(), 3);
+  EXPECT_EQ(config::resolve_n_threads(0, 100), 3);
+  EXPECT_EQ(config::resolve_n_threads(0, 2), 2);
+  EXPECT_EQ(config::resolve_n_threads(8, 100), 8);
+
+  config::set_num_threads(0);
+  EXPECT_GE(config::get_num_threads(), 1);
+  EXPECT_FALSE(config::in_parallel_region());
+}
+
+TEST(ParallelTest, ResultsIndependentOfNumThreads) {
+  Index n_items = 1000;
+  for (Index num_threads : {1, 2, 4}) {
+    config::set_num_threads(num_threads);
+    for (Index n_threads : {1, 3, 8, 0}) {
+      std::vector<Index> value(n_items, 0);
+      config::parallel_for_chunks(n_items, n_threads,
+                                  [&](Index begin, Index end) {
+                                    for (Index i = begin; i < end; ++i) {
+                                      value[i] += i;
+                                    }
+                                  });
+      config::parallel_for_items(n_items, n_threads,
+                                 [&](Index i) { value[i] += i; });
+      for (Index i = 0; i < n_items; ++i) {
+        EXPECT_EQ(value[i], 2 * i);
+      }
+    }
+  }
+  config::set_num_threads(0);
+}
+
+TEST(ParallelTest, NestedRunsSerially) {
+  config::set_num_threads(4);
+  Index n_outer = 16;
+  std::vector<Index> n_inner_threads(n_outer, 0);
+  std::vector<Index> sum(n_outer, 0);
+  config::parallel_for_items(n_outer, 4, [&](Index i) {
+    EXPECT_TRUE(config::in_parallel_region());
+    n_inner_threads[i] = config::resolve_n_threads(4, 100);
+    std::vector<Index> part(4, 0);
+    config::parallel_for_chunks(100, 4, [&](Index begin, Index end) {
+      for (Index j = begin; j < end; ++j) {
+        part[0] += j;
+      }
+    });
+    sum[i] = part[0];
+  });
+  EXPECT_FALSE(config::in_parallel_region());
+  for (Index i = 0; i < n_outer; ++i) {
+    EXPECT_EQ(n_inner_threads[i], 1);
+    EXPECT_EQ(sum[i], 4950);
+  }
+  config::set_num_threads(0);
+}
+
+TEST(ParallelTest, Exceptions) {
+  for (Index num_threads : {1, 4}) {
+    config::set_num_threads(num_threads);
+    EXPECT_THROW(config::parallel_for_chunks(100, 4,
+                                             [&](Index begin, Index end) {
+                                               if (begin > 0) {
+                                                 throw std::runtime_error(
+                                                     "test");
+                                               }
+                                             }),
+                 std::runtime_error);
+    EXPECT_THROW(config::parallel_for_items(100, 4,
+                                            [&](Index i) {
+                                              if (i == 50) {
+                                                throw std::runtime_error(
+                                                    "test");
+                                              }
+                                            }),
+                 std::runtime_error);
+
+    // the pool is still usable after an exception
+    std::vector<Index> value(100, 0);
+    config::parallel_for_items(100, 4, [&](Index i) { value[i] = i; });
+    EXPECT_EQ(std::accumulate(value.begin(), value.end(), Index(0)), 4950);
+  }
+  config::set_num_threads(0);
+}
@@ -0,0 +1,79 @@
+#include "casm/configuration/perf.hh"
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/io/json/perf_json_io.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(PerfTest, ReportNames) {
+  config::perf::reset();
+  config::perf::PerfReport report = config::perf::make_report();
+  EXPECT_EQ(report.enabled, config::perf::is_enabled());
+  EXPECT_EQ(report.counters.size(), int(config::perf::Counter::n_counters));
+  EXPECT_EQ(report.timers.size(), int(config::perf::Timer::n_timers));
+  for (auto const &pair : report.counters) {
+    EXPECT_EQ(pair.second, 0);
+  }
+  for (auto const &pair : report.timers) {
+    EXPECT_EQ(pair.second.count, 0);
+    EXPECT_EQ(pair.second.total_s, 0.0);
+  }
+  EXPECT_EQ(report.counters.count("translation_permutation_rebuild"), 1);
+  EXPECT_EQ(report.timers.count("make_prim_periodic_orbits"), 1);
+}
+
+TEST(PerfTest, CountAndReset) {
+  using config::perf::Counter;
+  using config::perf::Timer;
+  config::perf::reset();
+  config::perf::count(Counter::canonicalization);
+  config::perf::count(Counter::canonicalization, 2);
+  { config::perf::ScopedTimer timer(Timer::to_canonical); }
+
+  config::perf::PerfReport report = config::perf::make_report();
+  EXPECT_EQ(report.counters.at("canonicalization"), 3);
+  EXPECT_EQ(report.timers.at("to_canonical").count, 1);
+  EXPECT_GE(report.timers.at("to_canonical").total_s, 0.0);
+
+  jsonParser json;
+  to_json(report, json);
+  EXPECT_EQ(json["counters"]["canonicalization"].get<Index>(), 3);
+  EXPECT_EQ(json["timers"]["to_canonical"]["count"].get<Index>(), 1);
+  EXPECT_TRUE(json.contains("enabled"));
+
+  config::perf::reset();
+  report = config::perf::make_report();
+  EXPECT_EQ(report.counters.at("canonicalization"), 0);
+  EXPECT_EQ(report.timers.at("to_canonical").count, 0);
+}
+
+TEST(PerfTest, Instrumentation) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  config::perf::reset();
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration configuration(supercell);
+  configuration.dof_values.occupation(0) = 1;
+  make_canonical_form(configuration, config::SupercellSymOp::begin(supercell),
+                      config::SupercellSymOp::end(supercell));
+
+  config::perf::PerfReport report = config::perf::make_report();
+  if (!config::perf::is_enabled()) {
+    EXPECT_EQ(report.counters.at("supercell_construction"), 0);
+    EXPECT_EQ(report.counters.at("canonicalization"), 0);
+    return;
+  }
+  EXPECT_EQ(report.counters.at("supercell_construction"), 1);
+  EXPECT_EQ(report.counters.at("canonicalization"), 1);
+  EXPECT_EQ(report.counters.at("supercell_sym_op_apply"), 1);
+  EXPECT_EQ(report.counters.at("config_is_equivalent_compare"), 48 * 8 - 1);
+  EXPECT_GT(report.counters.at("config_is_equivalent_early_exit"), 0);
+  EXPECT_EQ(report.timers.at("to_canonical").count, 1);
+}
@@ -70,3 +70,22 @@ TEST_F(SupercellNameTest, Test3) {
   EXPECT_TRUE(
       is_symmetrically_equivalent(recreated_superlattice, superlattice));
 }
+
+TEST_F(SupercellNameTest, HermiteNormalFormKey) {
+  // standard cubic FCC unit cell
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  config::HermiteNormalFormKey key = config::make_hermite_normal_form_key(T);
+  EXPECT_EQ(key, config::HermiteNormalFormKey({2, 2, 1, 1, 1, 0}));
+  EXPECT_EQ(config::make_supercell_name(key), "SCEL4_2_2_1_1_1_0");
+  EXPECT_EQ(config::make_supercell_name(T), "SCEL4_2_2_1_1_1_0");
+  EXPECT_EQ(config::make_hermite_normal_form_key("SCEL4_2_2_1_1_1_0"), key);
+
+  // same superlattice as T
+  Eigen::Matrix3l H = config::make_hermite_normal_form(key);
+  EXPECT_EQ(config::make_hermite_normal_form_key(H), key);
+  EXPECT_EQ(H.determinant(), 4);
+
+  EXPECT_THROW(config::make_hermite_normal_form_key("SCEL4_2_2_1_1_1"),
+               std::runtime_error);
+}
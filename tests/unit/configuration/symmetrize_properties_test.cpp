@@ -0,0 +1,86 @@
+#include "casm/configuration/symmetrize_properties.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/misc/CASM_Eigen_math.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+config::ConfigurationWithProperties _make_configuration_with_properties(
+    std::shared_ptr<config::Supercell const> const &supercell) {
+  config::Configuration configuration(supercell);
+  configuration.dof_values.occupation(0) = 1;
+  Index n_sites = configuration.dof_values.occupation.size();
+  Eigen::MatrixXd disp = Eigen::MatrixXd::Zero(3, n_sites);
+  for (Index l = 0; l < n_sites; ++l) {
+    disp.col(l) << 0.01 * l, -0.02 * l + 0.01, 0.03;
+  }
+  Eigen::VectorXd strain(6);
+  strain << 0.01, 0.02, 0.03, 0.004, 0.005, 0.006;
+  return config::ConfigurationWithProperties(configuration, {{"disp", disp}},
+                                             {{"GLstrain", strain}});
+}
+
+}  // namespace
+
+TEST(SymmetrizePropertiesTest, MatchesCopyApply) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::ConfigurationWithProperties original =
+      _make_configuration_with_properties(supercell);
+
+  auto subgroup = config::make_invariant_subgroup(
+      original.configuration, config::SupercellSymOp::begin(supercell),
+      config::SupercellSymOp::end(supercell), {"occ"});
+  ASSERT_GT(subgroup.size(), 1);
+
+  Eigen::MatrixXd disp_sum =
+      Eigen::MatrixXd::Zero(3, original.local_properties.at("disp").cols());
+  Eigen::VectorXd strain_sum = Eigen::VectorXd::Zero(6);
+  for (auto const &op : subgroup) {
+    config::ConfigurationWithProperties transformed = copy_apply(op, original);
+    disp_sum += transformed.local_properties.at("disp");
+    strain_sum += transformed.global_properties.at("GLstrain");
+  }
+
+  config::ConfigurationWithProperties symmetrized = original;
+  config::symmetrize_properties(symmetrized, subgroup);
+  EXPECT_EQ(symmetrized.configuration, original.configuration);
+  EXPECT_TRUE(almost_equal(symmetrized.local_properties.at("disp"),
+                           disp_sum / subgroup.size()));
+  EXPECT_TRUE(almost_equal(symmetrized.global_properties.at("GLstrain"),
+                           strain_sum / subgroup.size()));
+
+  // symmetrized properties are invariant
+  for (auto const &op : subgroup) {
+    config::ConfigurationWithProperties transformed =
+        copy_apply(op, symmetrized);
+    EXPECT_TRUE(almost_equal(transformed.local_properties.at("disp"),
+                             symmetrized.local_properties.at("disp")));
+    EXPECT_TRUE(almost_equal(transformed.global_properties.at("GLstrain"),
+                             symmetrized.global_properties.at("GLstrain")));
+  }
+
+  // batch
+  std::vector<config::ConfigurationWithProperties> batch(3, original);
+  config::symmetrize_properties(batch, {"occ"}, 2);
+  for (auto const &x : batch) {
+    EXPECT_TRUE(almost_equal(x.local_properties.at("disp"),
+                             symmetrized.local_properties.at("disp")));
+    EXPECT_TRUE(almost_equal(x.global_properties.at("GLstrain"),
+                             symmetrized.global_properties.at("GLstrain")));
+  }
+
+  EXPECT_THROW(config::symmetrize_properties(
+                   symmetrized, std::vector<config::SupercellSymOp>{}),
+               std::runtime_error);
+}
@@ -0,0 +1,94 @@
+#include "casm/configuration/trace.hh"
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#include "casm/casm_io/json/jsonParser.hh"
+#include "casm/configuration/parallel.hh"
+#include "gtest/gtest.h"
+#include "testdir.hh"
+
+using namespace CASM;
+
+namespace {
+
+jsonParser read_trace(std::string const &path) {
+  std::ifstream in(path);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return jsonParser::parse(ss.str());
+}
+
+}  // namespace
+
+TEST(TraceTest, InactiveByDefault) {
+  EXPECT_FALSE(config::trace::is_active());
+  // recording while inactive does nothing, and stopping is allowed
+  { CASM_CONFIGURATION_TRACE_SCOPE("inactive"); }
+  config::trace::stop();
+  EXPECT_FALSE(config::trace::is_active());
+}
+
+TEST(TraceTest, WriteEvents) {
+  test::TmpDir tmp_dir;
+  std::string path = (tmp_dir.path() / "trace.json").string();
+
+  config::trace::start(path);
+  EXPECT_TRUE(config::trace::is_active());
+  {
+    CASM_CONFIGURATION_TRACE_SCOPE("outer");
+    CASM_CONFIGURATION_TRACE_SCOPE_ARG("inner", "value", 3);
+  }
+  std::thread thread([]() { CASM_CONFIGURATION_TRACE_SCOPE("thread"); });
+  thread.join();
+  config::trace::stop();
+  EXPECT_FALSE(config::trace::is_active());
+
+  // events after stop are not recorded
+  { CASM_CONFIGURATION_TRACE_SCOPE("after"); }
+
+  jsonParser json = read_trace(path);
+  ASSERT_TRUE(json.contains("traceEvents"));
+  jsonParser const &events = json["traceEvents"];
+  ASSERT_EQ(events.size(), Index(3));
+
+  std::map<std::string, jsonParser> by_name;
+  for (auto const &event : events) {
+    EXPECT_EQ(event["ph"].get<std::string>(), "X");
+    EXPECT_GE(event["dur"].get<double>(), 0.0);
+    by_name[event["name"].get<std::string>()] = event;
+  }
+  ASSERT_EQ(by_name.count("outer"), 1);
+  ASSERT_EQ(by_name.count("inner"), 1);
+  ASSERT_EQ(by_name.count("thread"), 1);
+  EXPECT_EQ(by_name["inner"]["args"]["value"].get<Index>(), 3);
+  EXPECT_EQ(by_name["inner"]["tid"].get<Index>(),
+            by_name["outer"]["tid"].get<Index>());
+  EXPECT_NE(by_name["thread"]["tid"].get<Index>(),
+            by_name["outer"]["tid"].get<Index>());
+  EXPECT_GE(by_name["outer"]["dur"].get<double>(),
+            by_name["inner"]["dur"].get<double>());
+}
+
+TEST(TraceTest, RestartDiscardsPreviousEvents) {
+  test::TmpDir tmp_dir;
+  std::string path_a = (tmp_dir.path() / "a.json").string();
+  std::string path_b = (tmp_dir.path() / "b.json").string();
+
+  config::trace::start(path_a);
+  { CASM_CONFIGURATION_TRACE_SCOPE("a"); }
+  config::trace::start(path_b);
+  config::parallel_for_chunks(4, 4, [](Index begin, Index end) {});
+  config::trace::stop();
+
+  jsonParser json_a = read_trace(path_a);
+  ASSERT_EQ(json_a["traceEvents"].size(), Index(1));
+  EXPECT_EQ(json_a["traceEvents"][0]["name"].get<std::string>(), "a");
+
+  jsonParser json_b = read_trace(path_b);
+  for (auto const &event : json_b["traceEvents"]) {
+    EXPECT_EQ(event["name"].get<std::string>(), "parallel_task");
+  }
+}
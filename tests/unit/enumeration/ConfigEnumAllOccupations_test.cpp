@@ -0,0 +1,215 @@
+#include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
+
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/copy_configuration.hh"
+#include "casm/configuration/enumeration/ConfigurationFilter.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(ConfigEnumAllOccupationsTest, Partitions) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  std::set<Index> sites = test::make_all_sites(background);
+
+  std::set<config::Configuration> expected;
+  config::ConfigEnumAllOccupations enumerator(background, sites);
+  while (enumerator.is_valid()) {
+    expected.insert(enumerator.value());
+    enumerator.advance();
+  }
+  EXPECT_EQ(expected.size(), 6561);
+
+  std::vector<std::vector<int>> partitions =
+      config::make_occupation_partitions(background, sites, 10);
+  EXPECT_EQ(partitions.size(), 27);
+
+  Index count = 0;
+  std::set<config::Configuration> found;
+  for (auto const &fixed_occupation : partitions) {
+    config::ConfigEnumAllOccupations partition_enumerator(background, sites,
+                                                          fixed_occupation);
+    while (partition_enumerator.is_valid()) {
+      found.insert(partition_enumerator.value());
+      ++count;
+      partition_enumerator.advance();
+    }
+  }
+  EXPECT_EQ(count, expected.size());
+  EXPECT_EQ(found, expected);
+
+  // at least one site is always left unfixed
+  partitions = config::make_occupation_partitions(background, sites, 100000);
+  EXPECT_EQ(partitions.size(), 2187);
+}
+
+TEST(ConfigEnumAllOccupationsTest, MakeDistinctOccupations) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  std::set<Index> sites = test::make_all_sites(background);
+
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  std::set<config::Configuration> expected_all;
+  std::set<config::Configuration> expected_unique;
+  config::ConfigEnumAllOccupations enumerator(background, sites);
+  while (enumerator.is_valid()) {
+    config::Configuration const &value = enumerator.value();
+    expected_all.insert(make_canonical_form(value, begin, end));
+    if (is_primitive(value) && is_canonical(value, begin, end)) {
+      expected_unique.insert(value);
+    }
+    enumerator.advance();
+  }
+
+  for (Index n_threads : {1, 4}) {
+    EXPECT_EQ(config::make_distinct_occupations(
+                  background, sites, config::AllConfigurationFilter(),
+                  n_threads),
+              expected_all);
+    EXPECT_EQ(config::make_distinct_occupations(
+                  background, sites, config::UniqueConfigurationFilter(),
+                  n_threads),
+              expected_unique);
+  }
+}
+
+TEST(ConfigEnumAllOccupationsTest, Progress) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  std::set<Index> sites = test::make_all_sites(background);
+
+  auto progress = std::make_shared<config::EnumProgress>();
+  config::ConfigEnumAllOccupations enumerator(background, sites);
+  EXPECT_EQ(enumerator.n_total(), 6561.0);
+  enumerator.set_progress(progress);
+  while (enumerator.is_valid()) {
+    enumerator.advance();
+  }
+  config::EnumProgressStatus status = progress->status();
+  EXPECT_EQ(status.n_generated, 6561);
+  EXPECT_EQ(status.n_total, 6561.0);
+  ASSERT_TRUE(status.fraction_complete.has_value());
+  EXPECT_EQ(*status.fraction_complete, 1.0);
+
+  std::set<config::Configuration> expected_all =
+      config::make_distinct_occupations(background, sites,
+                                        config::AllConfigurationFilter(), 1);
+  for (Index n_threads : {1, 4}) {
+    config::EnumProgress parallel_progress;
+    std::set<config::Configuration> unique = config::make_distinct_occupations(
+        background, sites, config::UniqueConfigurationFilter(), n_threads,
+        &parallel_progress);
+    status = parallel_progress.status();
+    EXPECT_EQ(status.n_generated, 6561);
+    EXPECT_EQ(status.n_total, 6561.0);
+    EXPECT_EQ(status.n_canonical, expected_all.size());
+    EXPECT_EQ(status.n_accepted, unique.size());
+  }
+}
+
+TEST(ConfigEnumAllOccupationsTest, Resume) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 1, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  std::set<Index> sites = test::make_all_sites(background);
+
+  std::vector<config::Configuration> expected;
+  std::vector<std::vector<int>> counter_values;
+  config::ConfigEnumAllOccupations enumerator(background, sites);
+  while (enumerator.is_valid()) {
+    expected.push_back(enumerator.value());
+    counter_values.push_back(enumerator.counter_value());
+    enumerator.advance();
+  }
+  EXPECT_EQ(expected.size(), 9);
+  EXPECT_EQ(counter_values[1], std::vector<int>({1, 0}));
+
+  // resume from each checkpoint, and check the remaining values match
+  for (Index i = 0; i < counter_values.size(); ++i) {
+    config::ConfigEnumAllOccupations resumed(background, sites);
+    resumed.set_counter_value(counter_values[i]);
+    Index j = i;
+    while (resumed.is_valid()) {
+      ASSERT_LT(j, expected.size());
+      EXPECT_EQ(resumed.value(), expected[j]);
+      resumed.advance();
+      ++j;
+    }
+    EXPECT_EQ(j, expected.size());
+  }
+
+  config::ConfigEnumAllOccupations resumed(background, sites);
+  EXPECT_THROW(resumed.set_counter_value({0}), std::runtime_error);
+  EXPECT_THROW(resumed.set_counter_value({0, 3}), std::runtime_error);
+}
+
+TEST(ConfigEnumAllOccupationsTest, GrayCode) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  std::set<Index> sites = test::make_all_sites(background);
+
+  std::set<config::Configuration> expected;
+  config::ConfigEnumAllOccupations enumerator(background, sites);
+  EXPECT_FALSE(enumerator.gray_code());
+  while (enumerator.is_valid()) {
+    expected.insert(enumerator.value());
+    enumerator.advance();
+  }
+  EXPECT_EQ(expected.size(), 81);
+
+  config::ConfigEnumAllOccupations gray_enumerator(background, sites, {},
+                                                   true);
+  EXPECT_TRUE(gray_enumerator.gray_code());
+  EXPECT_TRUE(gray_enumerator.delta().empty());
+  std::set<config::Configuration> found;
+  std::vector<std::vector<int>> counter_values;
+  Index count = 0;
+  config::Configuration previous = gray_enumerator.value();
+  while (gray_enumerator.is_valid()) {
+    found.insert(gray_enumerator.value());
+    counter_values.push_back(gray_enumerator.counter_value());
+    ++count;
+    gray_enumerator.advance();
+    if (!gray_enumerator.is_valid()) {
+      break;
+    }
+    // exactly one site changes, by one occupant index
+    ASSERT_EQ(gray_enumerator.delta().size(), 1);
+    config::OccupationDelta const &delta = gray_enumerator.delta()[0];
+    EXPECT_EQ(previous.dof_values.occupation(delta.site_index),
+              delta.old_occupation);
+    EXPECT_EQ(std::abs(delta.new_occupation - delta.old_occupation), 1);
+    previous.dof_values.occupation(delta.site_index) = delta.new_occupation;
+    EXPECT_EQ(previous, gray_enumerator.value());
+  }
+  EXPECT_EQ(count, expected.size());
+  EXPECT_EQ(found, expected);
+
+  // resume from a checkpoint
+  config::ConfigEnumAllOccupations resumed(background, sites, {}, true);
+  resumed.set_counter_value(counter_values[30]);
+  for (Index i = 30; i < counter_values.size(); ++i) {
+    ASSERT_TRUE(resumed.is_valid());
+    EXPECT_EQ(resumed.counter_value(), counter_values[i]);
+    resumed.advance();
+  }
+  EXPECT_FALSE(resumed.is_valid());
+}
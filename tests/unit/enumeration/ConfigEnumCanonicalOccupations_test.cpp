@@ -0,0 +1,168 @@
+#include "casm/configuration/enumeration/ConfigEnumCanonicalOccupations.hh"
+
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// \brief Check ConfigEnumCanonicalOccupations against filtering
+///     ConfigEnumAllOccupations with is_canonical
+void check_enumerator(config::Configuration const &background,
+                      std::set<Index> const &sites) {
+  auto begin = config::SupercellSymOp::begin(background.supercell);
+  auto end = config::SupercellSymOp::end(background.supercell);
+
+  std::set<config::Configuration> expected;
+  config::ConfigEnumAllOccupations all_enumerator(background, sites);
+  while (all_enumerator.is_valid()) {
+    if (is_canonical(all_enumerator.value(), begin, end)) {
+      expected.insert(all_enumerator.value());
+    }
+    all_enumerator.advance();
+  }
+
+  Index count = 0;
+  std::set<config::Configuration> found;
+  config::ConfigEnumCanonicalOccupations enumerator(background, sites);
+  while (enumerator.is_valid()) {
+    found.insert(enumerator.value());
+    ++count;
+    enumerator.advance();
+  }
+  EXPECT_EQ(count, expected.size());
+  EXPECT_EQ(found, expected);
+}
+
+/// \brief Check ConfigEnumCanonicalOccupations with fixed occupant counts
+///     against filtering ConfigEnumAllOccupations by composition and with
+///     is_canonical
+void check_fixed_counts_enumerator(
+    config::Configuration const &background, std::set<Index> const &sites,
+    std::vector<std::vector<Index>> const &occupant_counts) {
+  auto begin = config::SupercellSymOp::begin(background.supercell);
+  auto end = config::SupercellSymOp::end(background.supercell);
+  auto const &converter =
+      background.supercell->unitcellcoord_index_converter;
+
+  std::set<config::Configuration> expected;
+  config::ConfigEnumAllOccupations all_enumerator(background, sites);
+  while (all_enumerator.is_valid()) {
+    config::Configuration const &configuration = all_enumerator.value();
+    std::vector<std::vector<Index>> counts = occupant_counts;
+    for (auto &sublattice_counts : counts) {
+      std::fill(sublattice_counts.begin(), sublattice_counts.end(), 0);
+    }
+    for (Index l : sites) {
+      ++counts[converter(l).sublattice()]
+              [configuration.dof_values.occupation(l)];
+    }
+    if (counts == occupant_counts &&
+        is_canonical(configuration, begin, end)) {
+      expected.insert(configuration);
+    }
+    all_enumerator.advance();
+  }
+  ASSERT_GT(expected.size(), 0);
+
+  Index count = 0;
+  std::set<config::Configuration> found;
+  config::ConfigEnumCanonicalOccupations enumerator(background, sites,
+                                                    occupant_counts);
+  while (enumerator.is_valid()) {
+    found.insert(enumerator.value());
+    ++count;
+    enumerator.advance();
+  }
+  EXPECT_EQ(count, expected.size());
+  EXPECT_EQ(found, expected);
+}
+
+}  // namespace
+
+TEST(ConfigEnumCanonicalOccupationsTest, FCCTernary) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  check_enumerator(background, test::make_all_sites(background));
+
+  // enumerate on a subset of sites, with a non-default background
+  background.dof_values.occupation(0) = 2;
+  check_enumerator(background, {1, 2, 4, 6, 7});
+}
+
+TEST(ConfigEnumCanonicalOccupationsTest, FCCDimerAnisoOccupation) {
+  auto prim = config::make_shared_prim(test::FCC_dimer_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  check_enumerator(background, test::make_all_sites(background));
+}
+
+TEST(ConfigEnumCanonicalOccupationsTest, FCCTernaryGLStrainDisp) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_GLstrain_disp_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  check_enumerator(background, test::make_all_sites(background));
+
+  // only operations that leave the strain invariant can prune
+  background.dof_values.global_dof_values.at("GLstrain")(2) = 0.01;
+  background.dof_values.local_dof_values.at("disp")(0, 1) = 0.1;
+  check_enumerator(background, test::make_all_sites(background));
+}
+
+TEST(ConfigEnumCanonicalOccupationsTest, FCCTernaryFixedCounts) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  std::set<Index> sites = test::make_all_sites(background);
+  check_fixed_counts_enumerator(background, sites, {{3, 3, 2}});
+  check_fixed_counts_enumerator(background, sites, {{8, 0, 0}});
+  check_fixed_counts_enumerator(background, sites, {{0, 4, 4}});
+
+  // enumerate on a subset of sites, with a non-default background
+  background.dof_values.occupation(0) = 2;
+  check_fixed_counts_enumerator(background, {1, 2, 4, 6, 7}, {{2, 2, 1}});
+
+  // counts must match the number of sites enumerated on each sublattice
+  std::vector<std::vector<Index>> wrong_sum({{3, 3, 3}});
+  EXPECT_THROW(
+      config::ConfigEnumCanonicalOccupations(background, sites, wrong_sum),
+      std::runtime_error);
+  std::vector<std::vector<Index>> wrong_size({{4, 4}});
+  EXPECT_THROW(
+      config::ConfigEnumCanonicalOccupations(background, sites, wrong_size),
+      std::runtime_error);
+}
+
+TEST(ConfigEnumCanonicalOccupationsTest, ZrOFixedCounts) {
+  auto prim = config::make_shared_prim(test::ZrO_prim());
+  Eigen::Matrix3l T;
+  T << 1, 0, 0, 0, 1, 0, 0, 0, 3;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  check_fixed_counts_enumerator(background, test::make_all_sites(background),
+                                {{3}, {3}, {2, 1}, {1, 2}});
+
+  // only O sites
+  std::set<Index> sites;
+  auto const &converter = supercell->unitcellcoord_index_converter;
+  for (Index l : test::make_all_sites(background)) {
+    if (converter(l).sublattice() >= 2) {
+      sites.insert(l);
+    }
+  }
+  check_fixed_counts_enumerator(background, sites, {{}, {}, {1, 2}, {2, 1}});
+}
@@ -0,0 +1,148 @@
+#include "casm/configuration/enumeration/ConfigEnumLocalOccupationsEngine.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/clusterography/OrbitsAsIndices.hh"
+#include "casm/configuration/enumeration/OccEventInfo.hh"
+#include "casm/configuration/enumeration/background_configuration.hh"
+#include "casm/configuration/enumeration/perturbations.hh"
+#include "casm/configuration/occ_events/OccSystem.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class ConfigEnumLocalOccupationsEngineTest : public testing::Test {
+ protected:
+  ConfigEnumLocalOccupationsEngineTest() {
+    using namespace config;
+    using namespace occ_events;
+    auto basicstructure =
+        std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+    prim = std::make_shared<Prim>(basicstructure);
+    system = std::make_shared<OccSystem>(
+        prim->basicstructure,
+        make_chemical_name_list(*prim->basicstructure,
+                                prim->sym_info.factor_group->element));
+
+    // event: sites at origin and xy-face center
+    OccEvent event(
+        {OccTrajectory({system->make_atom_position({0, 0, 0, 0}, "A", 0),
+                        system->make_atom_position({0, 0, 0, 1}, "A", 0)}),
+         OccTrajectory({system->make_atom_position({0, 0, 0, 1}, "B", 0),
+                        system->make_atom_position({0, 0, 0, 0}, "B", 0)})});
+    event_prim_info = std::make_shared<OccEventPrimInfo>(prim, event);
+
+    // L12 motif
+    Eigen::Matrix3d L_motif;
+    L_motif.col(0) << 4., 0., 0.;
+    L_motif.col(1) << 0., 4., 0.;
+    L_motif.col(2) << 0., 0., 4.;
+    auto motif_supercell =
+        std::make_shared<Supercell const>(prim, xtal::Lattice(L_motif));
+    motif = std::make_shared<Configuration>(motif_supercell);
+    motif->dof_values.occupation << 1, 0, 0, 0;
+
+    Eigen::Matrix3d L_supercell = 3.0 * L_motif;
+    supercell =
+        std::make_shared<Supercell const>(prim, xtal::Lattice(L_supercell));
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<occ_events::OccSystem> system;
+  std::shared_ptr<config::OccEventPrimInfo> event_prim_info;
+  std::shared_ptr<config::Configuration> motif;
+  std::shared_ptr<config::Supercell const> supercell;
+};
+
+TEST_F(ConfigEnumLocalOccupationsEngineTest, Test1) {
+  using namespace clust;
+  using namespace config;
+
+  std::vector<std::set<IntegralCluster>> local_orbits =
+      event_prim_info->make_local_orbits(std::set<IntegralCluster>(
+          {IntegralCluster({{0, 1, 0, 0}}),
+           IntegralCluster({{0, 1, 0, 0}, {0, 0, 1, 0}})}));
+  ASSERT_EQ(local_orbits.size(), 2);
+
+  OccEventSupercellInfo info(event_prim_info, supercell);
+  std::set<Configuration> backgrounds =
+      info.make_distinct_background_configurations(*motif);
+  ASSERT_EQ(backgrounds.size(), 2);
+
+  std::vector<Index> expected_by_background({3, 2});
+  Index i_background = 0;
+  for (Configuration const &background : backgrounds) {
+    ConfigEnumLocalOccupationsEngine engine(background, info.sites,
+                                            info.occ_init, info.occ_final,
+                                            info.supercellsymop_symgroup_rep);
+
+    // canonical form is consistent with the free function
+    EXPECT_EQ(engine.make_canonical_form(background),
+              make_canonical_form(background, info.sites, info.occ_init,
+                                  info.occ_final,
+                                  info.supercellsymop_symgroup_rep));
+
+    // distinct local-cluster sites are consistent with the free function
+    for (auto const &local_orbit : local_orbits) {
+      EXPECT_EQ(engine.make_distinct_local_cluster_sites(local_orbit),
+                make_distinct_local_cluster_sites(
+                    background, info.sites, info.occ_init, info.occ_final,
+                    info.supercellsymop_symgroup_rep,
+                    make_flat_orbits_as_indices(
+                        std::vector<std::set<IntegralCluster>>({local_orbit}),
+                        supercell->unitcellcoord_index_converter)));
+    }
+
+    // point cluster: all occupations on distinct sites
+    std::vector<LocalOccupationPerturbation> results =
+        engine.by_cluster(local_orbits, std::set<Index>({0}));
+    EXPECT_EQ(results.size(), expected_by_background[i_background]);
+    std::set<Configuration> canonical;
+    for (auto const &x : results) {
+      EXPECT_EQ(x.i_local_orbit, 0);
+      EXPECT_EQ(x.sites.size(), 1);
+      EXPECT_EQ(x.initial_occupation[0],
+                background.dof_values.occupation(x.sites[0]));
+      EXPECT_EQ(x.final_occupation[0],
+                x.configuration.dof_values.occupation(x.sites[0]));
+      EXPECT_EQ(x.canonical_configuration,
+                engine.make_canonical_form(x.configuration));
+      canonical.insert(x.canonical_configuration);
+    }
+    EXPECT_EQ(canonical.size(), results.size());
+
+    // both orbits: results are concatenated by orbit
+    std::vector<LocalOccupationPerturbation> all_results =
+        engine.by_cluster(local_orbits);
+    EXPECT_GT(all_results.size(), results.size());
+    for (Index i = 0; i < all_results.size(); ++i) {
+      EXPECT_EQ(all_results[i].i_local_orbit, i < results.size() ? 0 : 1);
+    }
+
+    // neighborhood: all occupations on the combined sites of orbit 0
+    std::vector<LocalOccupationPerturbation> neighborhood_results =
+        engine.by_neighborhood(local_orbits, std::set<Index>({0}));
+    ASSERT_GT(neighborhood_results.size(), 0);
+    EXPECT_EQ(neighborhood_results[0].i_local_orbit, -1);
+    std::set<Index> neighborhood_sites;
+    for (auto const &cluster : local_orbits[0]) {
+      neighborhood_sites.insert(
+          supercell->unitcellcoord_index_converter(cluster[0]));
+    }
+    EXPECT_EQ(neighborhood_results[0].sites,
+              std::vector<Index>(neighborhood_sites.begin(),
+                                 neighborhood_sites.end()));
+    ++i_background;
+  }
+}
+
+TEST_F(ConfigEnumLocalOccupationsEngineTest, SupercellMismatch) {
+  using namespace config;
+  OccEventSupercellInfo info(event_prim_info, supercell);
+  Configuration background(motif->supercell);
+  EXPECT_THROW(ConfigEnumLocalOccupationsEngine(
+                   background, info.sites, info.occ_init, info.occ_final,
+                   info.supercellsymop_symgroup_rep),
+               std::runtime_error);
+}
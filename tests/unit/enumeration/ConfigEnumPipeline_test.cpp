@@ -0,0 +1,120 @@
+#include "casm/configuration/enumeration/ConfigEnumPipeline.hh"
+
+#include <sstream>
+
+#include "casm/configuration/ConfigurationSet.hh"
+#include "casm/configuration/SupercellSet.hh"
+#include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
+#include "casm/configuration/io/binary/Configuration_binary_io.hh"
+#include "casm/configuration/parallel.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class ConfigEnumPipelineTest : public testing::Test {
+ protected:
+  ConfigEnumPipelineTest() {
+    prim = config::make_shared_prim(test::FCC_ternary_prim());
+    Eigen::Matrix3l T;
+    T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+    supercell = std::make_shared<config::Supercell const>(prim, T);
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<config::Supercell const> supercell;
+};
+
+TEST_F(ConfigEnumPipelineTest, MatchesMakeDistinctOccupations) {
+  config::Configuration background(supercell);
+  std::set<Index> sites = test::make_all_sites(background);
+  config::UniqueConfigurationFilter filter;
+  std::set<config::Configuration> expected =
+      config::make_distinct_occupations(background, sites, filter);
+  ASSERT_GT(expected.size(), 1);
+
+  std::vector<std::string> names;
+  for (Index n_workers : {1, 3}) {
+    config::ConfigEnumPipelineParams params;
+    params.batch_size = 7;
+    params.queue_capacity = 2;
+    params.n_canonical_form_workers = n_workers;
+    params.n_filter_workers = n_workers;
+
+    config::ConfigurationSet configurations;
+    std::stringstream ss;
+    config::ConfigurationBinaryWriter writer(ss);
+    config::ConfigEnumPipeline pipeline(params, filter, &configurations,
+                                        &writer);
+    config::ConfigEnumAllOccupations enumerator(background, sites);
+    std::vector<config::PipelineStageMetrics> metrics =
+        pipeline.run_enumerator(enumerator);
+
+    std::set<config::Configuration> found;
+    for (auto const &record : configurations) {
+      found.insert(record.configuration);
+    }
+    EXPECT_EQ(found, expected);
+
+    // configuration ids are assigned in enumeration order, independent of
+    // the number of workers
+    std::vector<std::string> _names;
+    for (auto const &record : configurations) {
+      _names.push_back(record.configuration_name());
+    }
+    if (names.empty()) {
+      names = _names;
+    }
+    EXPECT_EQ(_names, names);
+
+    ASSERT_EQ(metrics.size(), 4);
+    EXPECT_EQ(metrics[0].name, "enumerate");
+    EXPECT_EQ(metrics[0].n_out, 81);
+    EXPECT_EQ(metrics[1].n_workers, n_workers);
+    EXPECT_EQ(metrics[1].n_in, metrics[0].n_out);
+    EXPECT_EQ(metrics[2].n_in, metrics[1].n_out);
+    EXPECT_EQ(metrics[3].n_in, metrics[2].n_out);
+    EXPECT_EQ(metrics[3].n_out, expected.size());
+
+    // newly inserted records were streamed
+    config::SupercellSet supercells(prim);
+    config::ConfigurationBinaryReader<config::Configuration> reader(
+        ss, supercells);
+    Index n_read = 0;
+    while (reader.is_valid()) {
+      EXPECT_FALSE(reader.configuration_id().empty());
+      ++n_read;
+      reader.advance();
+    }
+    EXPECT_EQ(n_read, expected.size());
+  }
+}
+
+TEST_F(ConfigEnumPipelineTest, FilterException) {
+  config::Configuration background(supercell);
+  std::set<Index> sites = test::make_all_sites(background);
+  config::GenericConfigurationFilter filter;
+  filter.f = [](config::Configuration const &configuration) -> bool {
+    throw std::runtime_error("filter error");
+  };
+
+  config::ConfigEnumPipelineParams params;
+  params.batch_size = 3;
+  params.queue_capacity = 1;
+  params.n_filter_workers = 2;
+  config::ConfigEnumPipeline pipeline(params, filter);
+  config::ConfigEnumAllOccupations enumerator(background, sites);
+  EXPECT_THROW(pipeline.run_enumerator(enumerator), std::runtime_error);
+}
+
+TEST(BoundedQueueTest, CloseDrains) {
+  config::BoundedQueue<int> queue(2);
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+  queue.close();
+  EXPECT_FALSE(queue.push(3));
+  EXPECT_EQ(queue.pop().value(), 1);
+  EXPECT_EQ(queue.pop().value(), 2);
+  EXPECT_FALSE(queue.pop().has_value());
+}
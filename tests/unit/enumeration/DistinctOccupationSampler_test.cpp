@@ -0,0 +1,126 @@
+#include "casm/configuration/enumeration/DistinctOccupationSampler.hh"
+
+#include <algorithm>
+#include <map>
+
+#include "casm/configuration/CanonicalFormEngine.hh"
+#include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// \brief Check that samples are canonical, satisfy the fixed composition,
+///     and are uniform over all distinct occupations
+void check_sampler(std::shared_ptr<config::Supercell const> const &supercell,
+                   std::optional<std::vector<std::vector<Index>>> const
+                       &occupant_counts = std::nullopt) {
+  auto const &converter = supercell->unitcellcoord_index_converter;
+  Index n_sites = converter.total_sites();
+  config::DistinctOccupationSampler sampler(supercell, occupant_counts);
+  auto const &engine = *sampler.engine();
+
+  // expected: canonical forms of all occupations with the fixed composition
+  auto has_counts = [&](config::Configuration const &configuration) {
+    if (!occupant_counts.has_value()) {
+      return true;
+    }
+    std::vector<std::vector<Index>> counts = *occupant_counts;
+    for (auto &sublattice_counts : counts) {
+      std::fill(sublattice_counts.begin(), sublattice_counts.end(), 0);
+    }
+    for (Index l = 0; l < n_sites; ++l) {
+      Index b = converter(l).sublattice();
+      ++counts[b][configuration.dof_values.occupation(l)];
+    }
+    return counts == *occupant_counts;
+  };
+  std::set<Index> sites;
+  for (Index l = 0; l < n_sites; ++l) {
+    sites.insert(l);
+  }
+  std::map<config::Configuration, Index> frequency;
+  config::ConfigEnumAllOccupations all_enumerator(
+      config::Configuration(supercell), sites);
+  while (all_enumerator.is_valid()) {
+    if (has_counts(all_enumerator.value())) {
+      frequency.emplace(engine.make_canonical_form(all_enumerator.value()),
+                        0);
+    }
+    all_enumerator.advance();
+  }
+
+  Index n_samples = 400 * frequency.size();
+  std::vector<config::Configuration> samples = sampler.sample(n_samples, 42);
+  ASSERT_EQ(samples.size(), n_samples);
+  for (auto const &sample : samples) {
+    EXPECT_TRUE(engine.is_canonical(sample));
+    EXPECT_TRUE(has_counts(sample));
+    auto it = frequency.find(sample);
+    ASSERT_TRUE(it != frequency.end());
+    ++it->second;
+  }
+
+  // every orbit has the same probability, 1 / frequency.size(), so each
+  // count is within 7 standard deviations of 400
+  for (auto const &pair : frequency) {
+    EXPECT_GT(pair.second, 260);
+    EXPECT_LT(pair.second, 540);
+  }
+}
+
+}  // namespace
+
+TEST(DistinctOccupationSamplerTest, FCCBinary) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T = 2 * Eigen::Matrix3l::Identity();
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  check_sampler(supercell);
+  check_sampler(supercell, std::vector<std::vector<Index>>({{5, 3}}));
+}
+
+TEST(DistinctOccupationSamplerTest, FCCTernary) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  check_sampler(std::make_shared<config::Supercell const>(prim, T));
+}
+
+TEST(DistinctOccupationSamplerTest, ZrOFixedCounts) {
+  auto prim = config::make_shared_prim(test::ZrO_prim());
+  Eigen::Matrix3l T;
+  T << 1, 0, 0, 0, 1, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  // different counts on the two O sublattices exclude the operations that
+  // exchange them
+  std::vector<std::vector<Index>> occupant_counts({{2}, {2}, {1, 1}, {2, 0}});
+  config::DistinctOccupationSampler sampler(supercell, occupant_counts);
+  config::CanonicalFormEngine full_engine(supercell);
+  EXPECT_LT(sampler.engine()->ops().size(), full_engine.ops().size());
+  check_sampler(supercell, occupant_counts);
+}
+
+TEST(DistinctOccupationSamplerTest, Reproducible) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T = 4 * Eigen::Matrix3l::Identity();
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::DistinctOccupationSampler sampler(
+      supercell, std::vector<std::vector<Index>>({{32, 32}}));
+
+  std::vector<config::Configuration> serial = sampler.sample(8, 7);
+  EXPECT_EQ(sampler.sample(8, 7, 3), serial);
+  EXPECT_NE(sampler.sample(8, 8), serial);
+
+  // fewer samples with the same seed are a prefix
+  std::vector<config::Configuration> first = sampler.sample(4, 7);
+  EXPECT_TRUE(std::equal(first.begin(), first.end(), serial.begin()));
+
+  std::mt19937_64 random_engine(0);
+  Index n_proposals = 0;
+  config::Configuration sample = sampler.sample(random_engine, &n_proposals);
+  EXPECT_GE(n_proposals, 1);
+  EXPECT_TRUE(sampler.engine()->is_canonical(sample));
+}
@@ -0,0 +1,80 @@
+#include "casm/configuration/enumeration/EnumProgress.hh"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace CASM;
+
+TEST(EnumProgressTest, Counts) {
+  config::EnumProgress progress;
+  config::EnumProgressStatus status = progress.status();
+  EXPECT_EQ(status.n_generated, 0);
+  EXPECT_EQ(status.n_total, 0.0);
+  EXPECT_FALSE(status.fraction_complete.has_value());
+  EXPECT_FALSE(status.estimated_remaining_seconds.has_value());
+
+  progress.add_total(100.0);
+  progress.add_generated(25);
+  progress.add_canonical(5);
+  progress.add_accepted(3);
+  status = progress.status();
+  EXPECT_EQ(status.n_generated, 25);
+  EXPECT_EQ(status.n_canonical, 5);
+  EXPECT_EQ(status.n_accepted, 3);
+  EXPECT_EQ(status.n_total, 100.0);
+  ASSERT_TRUE(status.fraction_complete.has_value());
+  EXPECT_EQ(*status.fraction_complete, 0.25);
+
+  progress.reset();
+  status = progress.status();
+  EXPECT_EQ(status.n_generated, 0);
+  EXPECT_EQ(status.n_total, 0.0);
+}
+
+TEST(EnumProgressTest, ThrottledCallback) {
+  Index n_reports = 0;
+  config::EnumProgressStatus last;
+  config::EnumProgress progress(
+      [&](config::EnumProgressStatus const &status) {
+        ++n_reports;
+        last = status;
+      },
+      3600.0);
+  for (Index i = 0; i < 1000; ++i) {
+    progress.add_generated();
+  }
+  EXPECT_EQ(n_reports, 0);
+  progress.report();
+  EXPECT_EQ(n_reports, 1);
+  EXPECT_EQ(last.n_generated, 1000);
+
+  config::EnumProgress every_time(
+      [&](config::EnumProgressStatus const &status) { ++n_reports; }, 0.0);
+  every_time.add_generated();
+  every_time.add_generated();
+  EXPECT_EQ(n_reports, 3);
+
+  EXPECT_THROW(config::EnumProgress(config::EnumProgress::CallbackType(), -1.0),
+               std::runtime_error);
+}
+
+TEST(EnumProgressTest, Threads) {
+  config::EnumProgress progress(
+      [](config::EnumProgressStatus const &status) {}, 0.0);
+  std::vector<std::thread> threads;
+  for (Index t = 0; t < 4; ++t) {
+    threads.emplace_back([&]() {
+      for (Index i = 0; i < 1000; ++i) {
+        progress.add_total(1.0);
+        progress.add_generated();
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(progress.status().n_generated, 4000);
+  EXPECT_EQ(progress.status().n_total, 4000.0);
+}
@@ -0,0 +1,87 @@
+#include "casm/configuration/enumeration/Enumerator.hh"
+
+#include "casm/configuration/clusterography/SubClusterCounter.hh"
+#include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
+#include "casm/configuration/occ_events/OccEventCounter.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+// the existing protocols are all recognized
+static_assert(
+    std::is_class_v<config::EnumeratorProtocol<occ_events::OccEventCounter>>);
+static_assert(
+    std::is_class_v<config::EnumeratorProtocol<clust::SubClusterCounter>>);
+
+TEST(EnumeratorTest, ConfigEnumAllOccupations) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << 2, 0, 0, 0, 1, 0, 0, 0, 1;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::Configuration background(supercell);
+  std::set<Index> sites({0, 1});
+
+  std::vector<config::Configuration> expected;
+  config::ConfigEnumAllOccupations enumerator(background, sites);
+  while (enumerator.is_valid()) {
+    expected.push_back(enumerator.value());
+    enumerator.advance();
+  }
+  EXPECT_EQ(expected.size(), 9);
+
+  // chunked pulls into existing storage, through the type erased interface
+  config::Enumerator<config::Configuration> erased(
+      config::ConfigEnumAllOccupations(background, sites));
+  std::vector<config::Configuration> storage(4, background);
+  std::vector<config::Configuration> found;
+  Index n;
+  while ((n = erased.next_batch(storage.data(), storage.size()))) {
+    found.insert(found.end(), storage.begin(), storage.begin() + n);
+  }
+  EXPECT_FALSE(erased.is_valid());
+  EXPECT_EQ(found, expected);
+
+  // appending, directly on the concrete type
+  config::ConfigEnumAllOccupations direct(background, sites);
+  std::vector<config::Configuration> batch;
+  EXPECT_EQ(config::next_batch(direct, batch, 5), 5);
+  EXPECT_EQ(config::next_batch(direct, batch, 5), 4);
+  EXPECT_EQ(batch, expected);
+}
+
+TEST(EnumeratorTest, SubClusterCounter) {
+  clust::IntegralCluster cluster({xtal::UnitCellCoord(0, 0, 0, 0),
+                                  xtal::UnitCellCoord(0, 1, 0, 0),
+                                  xtal::UnitCellCoord(0, 0, 1, 0)});
+  config::Enumerator<clust::IntegralCluster> enumerator(
+      clust::SubClusterCounter{cluster});
+  std::vector<clust::IntegralCluster> subclusters;
+  EXPECT_EQ(enumerator.next_batch(subclusters, 100), 8);
+  EXPECT_EQ(subclusters.front().size(), 0);
+  EXPECT_EQ(subclusters.back(), cluster);
+}
+
+TEST(EnumeratorTest, RangeAndGenerator) {
+  std::vector<int> values({1, 2, 3});
+  auto range = config::make_range_enumerator(values.begin(), values.end());
+  std::vector<int> found;
+  EXPECT_EQ(config::next_batch(range, found, 2), 2);
+  EXPECT_EQ(config::next_batch(range, found, 2), 1);
+  EXPECT_EQ(found, values);
+
+  Index i = 0;
+  config::Enumerator<Index> squares(config::GeneratorEnumerator<Index>(
+      [&](Index &value) {
+        if (i == 4) {
+          return false;
+        }
+        value = i * i;
+        ++i;
+        return true;
+      },
+      0));
+  std::vector<Index> found_squares;
+  EXPECT_EQ(squares.next_batch(found_squares, 10), 4);
+  EXPECT_EQ(found_squares, std::vector<Index>({0, 1, 4, 9}));
+}
@@ -85,3 +85,38 @@ TEST_F(MakeOccEventStructuresTest, Test1) {
     EXPECT_EQ(structure.atom_info.size(), 2);
   }
 }
+
+// batch coordinates match structures constructed one at a time
+TEST_F(MakeOccEventStructuresTest, CoordsBatchTest) {
+  using namespace config;
+  using namespace occ_events;
+
+  OccEvent event(
+      {OccTrajectory({system->make_atom_position({0, 0, 0, 0}, "A", 0),
+                      system->make_atom_position({0, 0, 0, -1}, "A", 0)}),
+       OccTrajectory({system->make_atom_position({0, 0, 0, -1}, "Va", 0),
+                      system->make_atom_position({0, 0, 0, 0}, "Va", 0)})});
+
+  Eigen::Matrix3d L_motif;
+  L_motif.col(0) << 8., 0., 0.;
+  L_motif.col(1) << 0., 8., 0.;
+  L_motif.col(2) << 0., 0., 8.;
+  auto supercell =
+      std::make_shared<Supercell const>(prim, xtal::Lattice(L_motif));
+  Configuration configuration(supercell);
+  configuration.dof_values.occupation(5) = 1;
+
+  config::MakeOccEventStructures f(configuration, event, system);
+  std::vector<double> factors = {0.0, 0.25, 0.5, 0.75, 1.0};
+  Eigen::MatrixXd coords = f.make_coords_batch(factors);
+  Index n_atoms = f.atom_names().size();
+  ASSERT_EQ(coords.rows(), 3);
+  ASSERT_EQ(coords.cols(), n_atoms * factors.size());
+  for (Index k = 0; k < factors.size(); ++k) {
+    xtal::SimpleStructure structure = f(factors[k]);
+    EXPECT_EQ(structure.atom_info.names, f.atom_names());
+    EXPECT_TRUE(structure.lat_column_mat.isApprox(f.lat_column_mat()));
+    EXPECT_TRUE(structure.atom_info.coords.isApprox(
+        coords.middleCols(k * n_atoms, n_atoms), 1e-12));
+  }
+}
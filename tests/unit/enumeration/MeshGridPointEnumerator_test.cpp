@@ -0,0 +1,121 @@
+#include "casm/configuration/enumeration/MeshGridPointEnumerator.hh"
+
+#include "casm/configuration/irreps/IrrepWedge.hh"
+#include "gtest/gtest.h"
+
+using namespace CASM;
+
+namespace {
+
+std::vector<Eigen::VectorXd> _enumerate_all(
+    config::MeshGridPointEnumerator &enumerator) {
+  std::vector<Eigen::VectorXd> points;
+  while (enumerator.is_valid()) {
+    points.push_back(enumerator.value());
+    enumerator.advance();
+  }
+  return points;
+}
+
+}  // namespace
+
+TEST(MeshGridPointEnumeratorTest, Linspace) {
+  Eigen::VectorXd x = config::make_linspace(-1.0, 1.0, 5);
+  ASSERT_EQ(x.size(), 5);
+  EXPECT_EQ(x(0), -1.0);
+  EXPECT_EQ(x(2), 0.0);
+  EXPECT_EQ(x(4), 1.0);
+  EXPECT_EQ(config::make_linspace(0.0, 1.0, 1).size(), 1);
+  EXPECT_EQ(config::make_linspace(0.0, 1.0, 0).size(), 0);
+}
+
+TEST(MeshGridPointEnumeratorTest, MeshGrid) {
+  std::vector<Eigen::VectorXd> xi = {config::make_linspace(0.0, 2.0, 3),
+                                     config::make_linspace(0.0, 1.0, 2)};
+  config::MeshGridPointEnumerator enumerator(xi);
+  EXPECT_EQ(enumerator.dim(), 2);
+  auto points = _enumerate_all(enumerator);
+  ASSERT_EQ(points.size(), 6);
+  // first coordinate is incremented fastest
+  EXPECT_TRUE(points[1].isApprox(Eigen::Vector2d(1.0, 0.0)));
+  EXPECT_TRUE(points[3].isApprox(Eigen::Vector2d(0.0, 1.0)));
+  EXPECT_TRUE(points[5].isApprox(Eigen::Vector2d(2.0, 1.0)));
+}
+
+TEST(MeshGridPointEnumeratorTest, SkipEquivalents) {
+  std::vector<Eigen::VectorXd> xi(2, config::make_linspace(-1.0, 1.0, 3));
+  Eigen::MatrixXd swap(2, 2);
+  swap << 0.0, 1.0, 1.0, 0.0;
+  std::vector<Eigen::MatrixXd> rep = {Eigen::MatrixXd::Identity(2, 2), swap};
+
+  config::MeshGridPointEnumerator enumerator(xi, rep);
+  auto points = _enumerate_all(enumerator);
+  EXPECT_EQ(points.size(), 6);
+
+  config::CanonicalPointSet canonical(rep);
+  for (auto const &x : points) {
+    EXPECT_TRUE(canonical.insert(x));
+    EXPECT_FALSE(canonical.insert(swap * x));
+  }
+  EXPECT_EQ(canonical.size(), 6);
+  EXPECT_TRUE(canonical.make_canonical(Eigen::Vector2d(0.0, 1.0))
+                  .isApprox(Eigen::Vector2d(1.0, 0.0)));
+}
+
+TEST(MeshGridPointEnumeratorTest, IrreducibleWedge) {
+  Eigen::MatrixXd axes = Eigen::MatrixXd::Identity(2, 2);
+  irreps::SubWedge mult_1_subwedge = irreps::make_dummy_subwedge(axes);
+  irreps::IrrepWedge irrep_wedge = irreps::make_dummy_irrep_wedge(axes);
+  irrep_wedge.mult = {2, 2};
+  irreps::SubWedge mult_2_subwedge({irrep_wedge});
+  std::vector<irreps::SubWedge> wedge = {mult_1_subwedge, mult_2_subwedge};
+  Eigen::MatrixXd basis_inv = Eigen::MatrixXd::Identity(2, 2);
+
+  // multiplicity 1 axes use [-stop, stop]
+  config::MeshGridPointEnumerator all(wedge, basis_inv, 1.0, 3, false);
+  auto points = _enumerate_all(all);
+  EXPECT_EQ(points.size(), 25 + 9);
+
+  config::MeshGridPointEnumerator trimmed(wedge, basis_inv, 1.0, 3, true);
+  Index n_first = 0;
+  Index n_second = 0;
+  while (trimmed.is_valid()) {
+    EXPECT_LE(trimmed.value().norm(), 1.0 + 1e-5);
+    if (trimmed.grid_index() == 0) {
+      ++n_first;
+    } else {
+      EXPECT_EQ(trimmed.grid_index(), 1);
+      EXPECT_GE(trimmed.value().minCoeff(), 0.0);
+      ++n_second;
+    }
+    trimmed.advance();
+  }
+  EXPECT_EQ(n_first, 13);
+  EXPECT_EQ(n_second, 6);
+}
+
+TEST(MeshGridPointEnumeratorTest, FillBatch) {
+  std::vector<Eigen::VectorXd> xi = {config::make_linspace(0.0, 2.0, 3),
+                                     config::make_linspace(0.0, 1.0, 2)};
+  config::MeshGridPointEnumerator expected_enumerator(xi);
+  auto expected = _enumerate_all(expected_enumerator);
+
+  config::MeshGridPointEnumerator enumerator(xi);
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> batch(
+      4, 2);
+  Eigen::Matrix<Index, Eigen::Dynamic, 1> grid_index(4);
+  std::vector<Eigen::VectorXd> points;
+  Index n_written;
+  do {
+    n_written = enumerator.fill_batch(batch, grid_index);
+    for (Index i = 0; i < n_written; ++i) {
+      points.push_back(batch.row(i).transpose());
+      EXPECT_EQ(grid_index(i), 0);
+    }
+  } while (n_written == batch.rows());
+  EXPECT_FALSE(enumerator.is_valid());
+  ASSERT_EQ(points.size(), expected.size());
+  for (Index i = 0; i < points.size(); ++i) {
+    EXPECT_TRUE(points[i].isApprox(expected[i]));
+  }
+}
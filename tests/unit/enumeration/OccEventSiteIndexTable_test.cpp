@@ -0,0 +1,86 @@
+#include "casm/configuration/enumeration/OccEventInfo.hh"
+#include "casm/configuration/occ_events/OccSystem.hh"
+#include "casm/configuration/occ_events/orbits.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class OccEventSiteIndexTableTest : public testing::Test {
+ protected:
+  OccEventSiteIndexTableTest() {
+    auto basicstructure =
+        std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+    prim = std::make_shared<config::Prim const>(basicstructure);
+    system = std::make_shared<occ_events::OccSystem>(
+        prim->basicstructure,
+        occ_events::make_chemical_name_list(
+            *prim->basicstructure, prim->sym_info.factor_group->element));
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<occ_events::OccSystem> system;
+};
+
+TEST_F(OccEventSiteIndexTableTest, Test1) {
+  using namespace occ_events;
+
+  // 1NN A-B exchange, and its orbit
+  OccEvent event(
+      {OccTrajectory({system->make_atom_position({0, 0, 0, 0}, "A", 0),
+                      system->make_atom_position({0, 1, 0, 0}, "A", 0)}),
+       OccTrajectory({system->make_atom_position({0, 1, 0, 0}, "B", 0),
+                      system->make_atom_position({0, 0, 0, 0}, "B", 0)})});
+  auto prim_info =
+      std::make_shared<config::OccEventPrimInfo const>(prim, event);
+  std::set<OccEvent> orbit =
+      make_prim_periodic_orbit(event, prim_info->occevent_symgroup_rep);
+  std::vector<OccEvent> equivalents(orbit.begin(), orbit.end());
+  EXPECT_EQ(equivalents.size(), 6);
+
+  Eigen::Matrix3l T = Eigen::Matrix3l::Identity() * 3;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+
+  config::OccEventSiteIndexTable table =
+      config::make_occevent_site_index_table(equivalents, *supercell, 4);
+  EXPECT_EQ(table.n_equivalents, 6);
+  EXPECT_EQ(table.n_translations, 27);
+  EXPECT_EQ(table.n_sites, 2);
+  EXPECT_EQ(table.sites.size(), 6 * 27 * 2);
+  EXPECT_EQ(table.occ_init.size(), 6 * 2);
+  EXPECT_EQ(table.occ_final.size(), 6 * 2);
+
+  // translation 0 matches OccEventSupercellInfo
+  for (Index e = 0; e < table.n_equivalents; ++e) {
+    config::OccEventSupercellInfo info(
+        std::make_shared<config::OccEventPrimInfo const>(prim, equivalents[e]),
+        supercell);
+    for (Index s = 0; s < table.n_sites; ++s) {
+      EXPECT_EQ(table.sites[e * table.n_translations * 2 + s], info.sites[s]);
+      EXPECT_EQ(table.occ_init[e * 2 + s], info.occ_init[s]);
+      EXPECT_EQ(table.occ_final[e * 2 + s], info.occ_final[s]);
+    }
+  }
+
+  // each entry matches the translated event
+  auto const &unitcell_converter = supercell->unitcell_index_converter;
+  for (Index e = 0; e < table.n_equivalents; ++e) {
+    for (Index l = 0; l < table.n_translations; ++l) {
+      OccEvent translated = equivalents[e];
+      translated += unitcell_converter(l);
+      std::vector<Index> expected =
+          to_index_vector(make_cluster_occupation(translated).first,
+                          supercell->unitcellcoord_index_converter);
+      for (Index s = 0; s < table.n_sites; ++s) {
+        EXPECT_EQ(table.sites[(e * table.n_translations + l) * 2 + s],
+                  expected[s]);
+      }
+    }
+  }
+
+  // the result does not depend on the number of threads
+  config::OccEventSiteIndexTable serial_table =
+      config::make_occevent_site_index_table(equivalents, *supercell, 1);
+  EXPECT_EQ(table.sites, serial_table.sites);
+}
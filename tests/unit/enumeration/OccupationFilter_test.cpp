@@ -0,0 +1,135 @@
+#include "casm/configuration/enumeration/OccupationFilter.hh"
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/enumeration/ConfigEnumAllOccupations.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class OccupationFilterTest : public testing::Test {
+ protected:
+  OccupationFilterTest() {
+    prim = config::make_shared_prim(test::FCC_ternary_prim());
+    Eigen::Matrix3l T;
+    T << 2, 0, 0, 0, 2, 0, 0, 0, 1;
+    supercell = std::make_shared<config::Supercell const>(prim, T);
+  }
+
+  /// All occupations of the supercell
+  std::vector<Eigen::VectorXi> make_all_occupations() const {
+    config::Configuration background(supercell);
+    std::vector<Eigen::VectorXi> occupations;
+    config::ConfigEnumAllOccupations enumerator(
+        background, test::make_all_sites(background));
+    while (enumerator.is_valid()) {
+      occupations.push_back(enumerator.value().dof_values.occupation);
+      enumerator.advance();
+    }
+    return occupations;
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<config::Supercell const> supercell;
+};
+
+TEST_F(OccupationFilterTest, NoPredicates) {
+  config::OccupationFilter filter(supercell);
+  for (auto const &occupation : make_all_occupations()) {
+    EXPECT_TRUE(filter.is_allowed(occupation));
+  }
+  EXPECT_THROW(filter.is_allowed(Eigen::VectorXi::Zero(3)),
+               std::runtime_error);
+}
+
+TEST_F(OccupationFilterTest, Predicates) {
+  Eigen::VectorXi background = Eigen::VectorXi::Zero(4);
+  config::OccupationFilter filter(supercell);
+  filter.require_occupant_count(0, 1, 1, 2)
+      .require_n_changed_sites(background, 2, 3)
+      .require_allowed_occupants({0}, {0, 1});
+  EXPECT_THROW(filter.require_occupant_count(1, 0, 0, 1), std::runtime_error);
+  EXPECT_THROW(filter.require_occupant_count(0, 3, 0, 1), std::runtime_error);
+  EXPECT_THROW(filter.require_allowed_occupants({4}, {0}),
+               std::runtime_error);
+
+  Index n_allowed = 0;
+  for (auto const &occupation : make_all_occupations()) {
+    Index n_B = (occupation.array() == 1).count();
+    Index n_changed = (occupation.array() != 0).count();
+    bool expected = n_B >= 1 && n_B <= 2 && n_changed >= 2 &&
+                    n_changed <= 3 && occupation(0) != 2;
+    EXPECT_EQ(filter.is_allowed(occupation), expected);
+    if (expected) {
+      ++n_allowed;
+    }
+  }
+  EXPECT_GT(n_allowed, 0);
+
+  // ranges for the same occupant are intersected
+  filter.require_occupant_count(0, 1, 2, 4);
+  for (auto const &occupation : make_all_occupations()) {
+    if (filter.is_allowed(occupation)) {
+      EXPECT_EQ((occupation.array() == 1).count(), 2);
+    }
+  }
+}
+
+TEST_F(OccupationFilterTest, NegativeOccupation) {
+  // without an allowed occupants check, a negative occupant index is not
+  // counted
+  config::OccupationFilter filter(supercell);
+  filter.require_occupant_count(0, 0, 0, 3);
+  Eigen::VectorXi occupation = Eigen::VectorXi::Zero(4);
+  EXPECT_FALSE(filter.is_allowed(occupation));
+  occupation(0) = -1;
+  EXPECT_TRUE(filter.is_allowed(occupation));
+}
+
+TEST_F(OccupationFilterTest, Compact) {
+  config::OccupationFilter filter(supercell);
+  filter.require_occupant_count(0, 2, 0, 0);
+
+  std::vector<Eigen::VectorXi> occupations = make_all_occupations();
+  Eigen::Matrix<std::int8_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+      batch(occupations.size() + 1, 4);
+  batch.setConstant(2);
+  std::vector<Eigen::VectorXi> expected;
+  for (Index i = 0; i < occupations.size(); ++i) {
+    batch.row(i) = occupations[i].transpose().cast<std::int8_t>();
+    if ((occupations[i].array() != 2).all()) {
+      expected.push_back(occupations[i]);
+    }
+  }
+
+  Index n_allowed = filter.compact(batch, occupations.size());
+  ASSERT_EQ(n_allowed, 16);
+  ASSERT_EQ(n_allowed, expected.size());
+  for (Index i = 0; i < n_allowed; ++i) {
+    EXPECT_EQ(batch.row(i).cast<int>().transpose(), expected[i]);
+  }
+  EXPECT_THROW(filter.compact(batch, batch.rows() + 1), std::runtime_error);
+}
+
+TEST_F(OccupationFilterTest, ConfigurationFilter) {
+  config::Configuration background(supercell);
+  config::OccupationFilter filter(supercell);
+  filter.require_n_changed_sites(background.dof_values.occupation, 0, 1);
+
+  config::ConfigurationFilter const &base = filter;
+  EXPECT_FALSE(base.primitive_guarantee());
+  EXPECT_FALSE(base.canonical_guarantee());
+
+  Index n_allowed = 0;
+  config::ConfigEnumAllOccupations enumerator(
+      background, test::make_all_sites(background));
+  while (enumerator.is_valid()) {
+    if (base(enumerator.value())) {
+      ++n_allowed;
+    }
+    enumerator.advance();
+  }
+  // background, plus 2 other occupants on each of 4 sites
+  EXPECT_EQ(n_allowed, 9);
+}
@@ -1,5 +1,10 @@
+#include <thread>
+
 #include "casm/configuration/Configuration.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/copy_configuration.hh"
 #include "casm/configuration/enumeration/OccEventInfo.hh"
+#include "casm/configuration/enumeration/background_configuration.hh"
 #include "casm/configuration/occ_events/OccSystem.hh"
 #include "casm/crystallography/BasicStructure.hh"
 #include "gtest/gtest.h"
@@ -110,4 +115,139 @@ TEST_F(FCCBinaryBackgroundConfigurationTest, Test2) {
   //   std::cout << c.dof_values.occupation.transpose() << std::endl;
   // }
   EXPECT_EQ(backgrounds.size(), 2);
+
+  // table-driven canonical forms match those using the event group directly
+  std::set<Configuration> expected_backgrounds =
+      make_distinct_background_configurations(
+          motif, supercell, event_supercell_info.sites,
+          event_supercell_info.occ_init, event_supercell_info.occ_final,
+          event_supercell_info.supercellsymop_symgroup_rep);
+  EXPECT_EQ(backgrounds, expected_backgrounds);
+
+  // same as canonical forms of all super configurations, with threads
+  std::set<Configuration> all_canonical;
+  for (auto const &configuration :
+       make_all_super_configurations(motif, supercell)) {
+    all_canonical.insert(
+        event_supercell_info.make_canonical_form(configuration));
+  }
+  EXPECT_EQ(backgrounds, all_canonical);
+  EXPECT_EQ(make_distinct_background_configurations(
+                motif, event_supercell_info.sites,
+                event_supercell_info.occ_init, event_supercell_info.occ_final,
+                *event_supercell_info.canonical_form_engine, 4),
+            backgrounds);
+
+  // event group operations that do not preserve the event occupation are
+  // not used to skip super configurations
+  std::vector<int> occ({0, 1});
+  std::set<Configuration> occ_canonical;
+  for (auto const &configuration :
+       make_all_super_configurations(motif, supercell)) {
+    occ_canonical.insert(make_canonical_form(
+        configuration, event_supercell_info.sites, occ, occ,
+        event_supercell_info.supercellsymop_symgroup_rep));
+  }
+  EXPECT_EQ(make_distinct_background_configurations(
+                motif, supercell, event_supercell_info.sites, occ, occ,
+                event_supercell_info.supercellsymop_symgroup_rep, 2),
+            occ_canonical);
+  for (auto const &configuration :
+       make_all_super_configurations(motif, supercell)) {
+    EXPECT_EQ(event_supercell_info.make_canonical_form(configuration),
+              make_canonical_form(
+                  configuration, event_supercell_info.sites,
+                  event_supercell_info.occ_init, event_supercell_info.occ_final,
+                  event_supercell_info.supercellsymop_symgroup_rep));
+  }
+
+  // bulk canonical forms, with and without event occupation, match
+  std::vector<Configuration> all =
+      make_all_super_configurations(motif, supercell);
+  std::vector<Index> event_index(all.size(), 0);
+  for (Index i = 0; i < all.size(); ++i) {
+    event_index[i] = i % 2;
+  }
+  auto const &event_group = event_supercell_info.supercellsymop_symgroup_rep;
+  std::vector<Configuration> canonical = make_canonical_forms(
+      all, event_index, {event_supercell_info.sites, {}},
+      {event_supercell_info.occ_init, {}},
+      {event_supercell_info.occ_final, {}}, {event_group, event_group}, 2);
+  ASSERT_EQ(canonical.size(), all.size());
+  for (Index i = 0; i < all.size(); ++i) {
+    if (event_index[i] == 0) {
+      EXPECT_EQ(canonical[i], event_supercell_info.make_canonical_form(all[i]));
+    } else {
+      EXPECT_EQ(canonical[i], make_canonical_form(all[i], event_group.begin(),
+                                                  event_group.end()));
+    }
+  }
+}
+
+TEST_F(FCCBinaryBackgroundConfigurationTest, OccEventSupercellInfoCache) {
+  using namespace config;
+  using namespace occ_events;
+
+  OccEvent event_a(
+      {OccTrajectory({system->make_atom_position({0, 0, 0, 0}, "A", 0),
+                      system->make_atom_position({0, 0, 0, 1}, "A", 0)}),
+       OccTrajectory({system->make_atom_position({0, 0, 0, 1}, "B", 0),
+                      system->make_atom_position({0, 0, 0, 0}, "B", 0)})});
+  OccEvent event_b(
+      {OccTrajectory({system->make_atom_position({0, 0, 0, 0}, "A", 0),
+                      system->make_atom_position({0, 1, 0, 0}, "A", 0)}),
+       OccTrajectory({system->make_atom_position({0, 1, 0, 0}, "B", 0),
+                      system->make_atom_position({0, 0, 0, 0}, "B", 0)})});
+
+  Eigen::Matrix3l T = Eigen::Matrix3l::Identity() * 3;
+  auto supercell = std::make_shared<Supercell const>(prim, T);
+  auto equal_supercell = std::make_shared<Supercell const>(prim, T);
+
+  OccEventSupercellInfoCache cache(2);
+  auto info_a = cache.supercell_info(supercell, event_a);
+  EXPECT_EQ(cache.supercell_info(equal_supercell, event_a), info_a);
+  EXPECT_EQ(cache.n_misses(), 1);
+  EXPECT_EQ(cache.n_hits(), 1);
+  EXPECT_EQ(info_a->event_prim_info, cache.prim_info(prim, event_a));
+
+  // matches construction without the cache
+  OccEventSupercellInfo expected(
+      std::make_shared<OccEventPrimInfo const>(prim, event_a), supercell);
+  EXPECT_EQ(info_a->sites, expected.sites);
+  EXPECT_EQ(info_a->occ_init, expected.occ_init);
+  EXPECT_EQ(info_a->occ_final, expected.occ_final);
+  EXPECT_EQ(info_a->supercellsymop_symgroup_rep.size(),
+            expected.supercellsymop_symgroup_rep.size());
+
+  // least recently used first out
+  auto info_b = cache.supercell_info(supercell, event_b);
+  EXPECT_NE(info_b, info_a);
+  auto other_supercell = std::make_shared<Supercell const>(
+      prim, Eigen::Matrix3l(Eigen::Matrix3l::Identity() * 2));
+  cache.supercell_info(other_supercell, event_a);
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.supercell_info(supercell, event_b), info_b);
+  EXPECT_EQ(cache.n_misses(), 3);
+  EXPECT_NE(cache.supercell_info(supercell, event_a), info_a);
+  EXPECT_EQ(cache.n_misses(), 4);
+
+  // concurrent calls construct once
+  OccEventSupercellInfoCache concurrent_cache;
+  std::vector<std::shared_ptr<OccEventSupercellInfo const>> results(8);
+  std::vector<std::thread> threads;
+  for (Index i = 0; i < results.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      results[i] = concurrent_cache.supercell_info(supercell, event_a);
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(concurrent_cache.n_misses(), 1);
+  for (auto const &result : results) {
+    EXPECT_EQ(result, results[0]);
+  }
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
 }
@@ -0,0 +1,123 @@
+#include "casm/configuration/enumeration/count_occupations.hh"
+
+#include <map>
+#include <set>
+
+#include "casm/configuration/SupercellPermutationGroup.hh"
+#include "casm/configuration/SupercellSymInfo.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+namespace {
+
+/// \brief Check count_distinct_occupations against canonicalizing all
+///     occupations
+void check_counts(std::shared_ptr<config::Supercell const> const &supercell) {
+  auto const &converter = supercell->unitcellcoord_index_converter;
+  auto const &basis = supercell->prim->basicstructure->basis();
+  Index n_sites = converter.total_sites();
+
+  config::DistinctOccupationCount count =
+      config::count_distinct_occupations(supercell, true, 2);
+  EXPECT_EQ(count.group_order,
+            supercell->sym_info.factor_group_permutations.size() *
+                supercell->unitcell_index_converter.total_sites());
+  EXPECT_EQ(config::count_distinct_occupations(supercell).total, count.total);
+
+  // offset of each sublattice's occupant counts in the composition key
+  std::vector<Index> sublattice_offset(basis.size());
+  Index key_size = 0;
+  for (Index o = 0; o < Index(count.sublattice_orbits.size()); ++o) {
+    for (Index b : count.sublattice_orbits[o]) {
+      sublattice_offset[b] = key_size;
+    }
+    key_size += count.n_occupants[o];
+  }
+
+  config::SupercellPermutationGroup group(supercell);
+  std::set<std::vector<int>> canonical;
+  std::map<std::vector<Index>, Index> expected_by_composition;
+  Eigen::VectorXi occupation = Eigen::VectorXi::Zero(n_sites);
+  while (true) {
+    Eigen::VectorXi canonical_occupation =
+        group.make_canonical_occupation(occupation);
+    if (canonical
+            .emplace(canonical_occupation.data(),
+                     canonical_occupation.data() + n_sites)
+            .second) {
+      std::vector<Index> key(key_size, 0);
+      for (Index l = 0; l < n_sites; ++l) {
+        Index b = converter(l).sublattice();
+        ++key[sublattice_offset[b] + occupation(l)];
+      }
+      ++expected_by_composition[key];
+    }
+
+    // next occupation
+    Index l = 0;
+    while (l < n_sites) {
+      Index b = converter(l).sublattice();
+      if (occupation(l) + 1 < Index(basis[b].occupant_dof().size())) {
+        ++occupation(l);
+        break;
+      }
+      occupation(l) = 0;
+      ++l;
+    }
+    if (l == n_sites) {
+      break;
+    }
+  }
+
+  EXPECT_EQ(count.total, std::to_string(canonical.size()));
+  ASSERT_EQ(count.by_composition.size(), expected_by_composition.size());
+  for (auto const &pair : expected_by_composition) {
+    ASSERT_EQ(count.by_composition.count(pair.first), 1);
+    EXPECT_EQ(count.by_composition.at(pair.first), std::to_string(pair.second));
+  }
+}
+
+}  // namespace
+
+TEST(CountOccupationsTest, FCCBinary) {
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  check_counts(std::make_shared<config::Supercell const>(prim, T));
+  T = 2 * Eigen::Matrix3l::Identity();
+  check_counts(std::make_shared<config::Supercell const>(prim, T));
+  T << 1, 0, 0, 0, 1, 0, 0, 0, 5;
+  check_counts(std::make_shared<config::Supercell const>(prim, T));
+}
+
+TEST(CountOccupationsTest, FCCTernary) {
+  auto prim = config::make_shared_prim(test::FCC_ternary_prim());
+  Eigen::Matrix3l T;
+  T << -1, 1, 1, 1, -1, 1, 1, 1, -1;
+  check_counts(std::make_shared<config::Supercell const>(prim, T));
+}
+
+TEST(CountOccupationsTest, ZrO) {
+  auto prim = config::make_shared_prim(test::ZrO_prim());
+  Eigen::Matrix3l T;
+  T << 1, 0, 0, 0, 1, 0, 0, 0, 2;
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  check_counts(supercell);
+
+  config::DistinctOccupationCount count =
+      config::count_distinct_occupations(supercell);
+  EXPECT_EQ(count.sublattice_orbits.size(), 2);
+}
+
+TEST(CountOccupationsTest, Large) {
+  // 2^216 occupations, far beyond the range of Index
+  auto prim = config::make_shared_prim(test::FCC_binary_prim());
+  Eigen::Matrix3l T = 6 * Eigen::Matrix3l::Identity();
+  auto supercell = std::make_shared<config::Supercell const>(prim, T);
+  config::DistinctOccupationCount count =
+      config::count_distinct_occupations(supercell, false, 4);
+  EXPECT_GT(count.total.size(), 60);
+  EXPECT_EQ(count.n_sites, std::vector<Index>({216}));
+}
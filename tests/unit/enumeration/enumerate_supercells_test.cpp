@@ -0,0 +1,39 @@
+#include "casm/configuration/enumeration/enumerate_supercells.hh"
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+TEST(EnumerateSupercellsTest, FCCTest1) {
+  auto basicstructure =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+  auto prim = std::make_shared<config::Prim const>(basicstructure);
+
+  auto supercells = config::enumerate_canonical_supercells(prim, 4);
+  EXPECT_EQ(supercells.size(), 13);
+  for (Index i = 0; i < supercells.size(); ++i) {
+    EXPECT_TRUE(config::is_canonical(*supercells[i]));
+    if (i > 0) {
+      EXPECT_LE(supercells[i - 1]->superlattice.size(),
+                supercells[i]->superlattice.size());
+    }
+  }
+
+  // the result does not depend on the number of threads
+  auto T_1 = config::enumerate_canonical_transformation_matrices(prim, 6);
+  auto T_4 = config::enumerate_canonical_transformation_matrices(
+      prim, 6, 1, "abc", Eigen::Matrix3i::Identity(), false, false, 4);
+  EXPECT_EQ(T_1, T_4);
+
+  auto T_min = config::enumerate_canonical_transformation_matrices(prim, 4, 3);
+  ASSERT_EQ(T_min.size(), 10);
+  for (Index i = 0; i < T_min.size(); ++i) {
+    EXPECT_EQ(T_min[i], supercells[i + 3]->superlattice
+                            .transformation_matrix_to_super());
+  }
+}
@@ -258,6 +258,12 @@ class FCCBinaryLocalPerturbationsTest : public testing::Test {
 
     // check total number
     EXPECT_EQ(all.size(), expected_total_perturbations);
+
+    // results do not depend on the number of threads
+    std::set<Configuration> all_parallel =
+        event_supercell_info.make_all_distinct_local_perturbations(
+            motif, local_clusters, 4);
+    EXPECT_EQ(all_parallel, all);
   }
 
   std::shared_ptr<config::Prim const> prim;
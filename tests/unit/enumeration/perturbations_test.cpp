@@ -1,5 +1,8 @@
 #include "casm/configuration/enumeration/perturbations.hh"
 
+#include <algorithm>
+#include <iterator>
+
 #include "casm/configuration/Configuration.hh"
 #include "casm/configuration/clusterography/IntegralCluster.hh"
 #include "casm/configuration/clusterography/orbits.hh"
@@ -7,6 +10,7 @@
 #include "casm/crystallography/BasicStructure.hh"
 #include "casm/crystallography/UnitCellCoord.hh"
 #include "gtest/gtest.h"
+#include "testdir.hh"
 #include "teststructures.hh"
 
 // debug:
@@ -242,4 +246,216 @@ TEST_F(FCCBinaryPerturbationsTest, Test7) {
     }
     EXPECT_EQ(perturbations.size(), 5);
   }
-}
\ No newline at end of file
+}
+TEST_F(FCCBinaryPerturbationsTest, FlatOrbitsAsIndices) {
+  using namespace clust;
+
+  Eigen::Matrix3d motif_L;
+  motif_L.col(0) << 4., 0., 0.;
+  motif_L.col(1) << 0., 4., 0.;
+  motif_L.col(2) << 0., 0., 4.;
+  auto motif_supercell =
+      std::make_shared<config::Supercell const>(prim, xtal::Lattice(motif_L));
+
+  // L12 config
+  config::Configuration motif(motif_supercell);
+  motif.dof_values.occupation(0) = 1;
+
+  Eigen::Matrix3d L = motif_L * 2;
+  supercell = std::make_shared<config::Supercell const>(prim, xtal::Lattice(L));
+  config::Configuration configuration =
+      config::copy_configuration(motif, supercell);
+
+  std::vector<clust::IntegralCluster> clusters(
+      {clust::IntegralCluster({{0, 0, 0, 0}}),
+       clust::IntegralCluster({{0, 0, 0, 0}, {0, 1, 0, 0}}),
+       clust::IntegralCluster({{0, 0, 0, 0}, {0, 2, 0, 0}}),
+       clust::IntegralCluster({{0, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}})});
+  std::vector<std::set<clust::IntegralCluster>> orbits;
+  for (auto const &cluster : clusters) {
+    orbits.emplace_back(make_prim_periodic_orbit(
+        cluster, prim->sym_info.unitcellcoord_symgroup_rep));
+  }
+
+  auto const &converter = supercell->unitcellcoord_index_converter;
+  std::vector<std::set<std::set<Index>>> nested =
+      clust::make_orbits_as_indices(orbits, converter);
+  clust::OrbitsAsIndices flat =
+      clust::make_flat_orbits_as_indices(orbits, converter);
+  EXPECT_EQ(flat.n_orbits(), 4);
+  EXPECT_EQ(flat.orbit_offset.size(), 5);
+  EXPECT_EQ(flat.cluster_offset.back(), flat.sites.size());
+  EXPECT_EQ(clust::make_nested_orbits_as_indices(flat), nested);
+
+  clust::OrbitsAsIndices from_nested =
+      clust::make_flat_orbits_as_indices(nested);
+  EXPECT_EQ(from_nested.orbit_offset, flat.orbit_offset);
+  EXPECT_EQ(from_nested.cluster_offset, flat.cluster_offset);
+  EXPECT_EQ(from_nested.sites, flat.sites);
+
+  EXPECT_EQ(make_distinct_cluster_sites(configuration, flat),
+            make_distinct_cluster_sites(configuration, nested));
+}
+
+TEST_F(FCCBinaryPerturbationsTest, HashSet) {
+  using namespace clust;
+
+  Eigen::Matrix3d L;
+  // conventional 4-atom fcc supercell * 6
+  L.col(0) << 4., 0., 0.;
+  L.col(1) << 0., 8., 0.;
+  L.col(2) << 0., 0., 12.;
+  supercell = std::make_shared<config::Supercell const>(prim, xtal::Lattice(L));
+  config::Configuration configuration(supercell);
+
+  std::vector<clust::IntegralCluster> clusters(
+      {clust::IntegralCluster({{0, 0, 0, 0}, {0, 1, 0, 0}}),
+       clust::IntegralCluster({{0, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}})});
+  std::vector<std::set<clust::IntegralCluster>> orbits;
+  for (auto const &cluster : clusters) {
+    orbits.emplace_back(make_prim_periodic_orbit(
+        cluster, prim->sym_info.unitcellcoord_symgroup_rep));
+  }
+  auto distinct_cluster_sites = make_distinct_cluster_sites(
+      configuration, clust::make_orbits_as_indices(
+                         orbits, supercell->unitcellcoord_index_converter));
+
+  std::set<config::Configuration> expected =
+      config::make_distinct_perturbations(configuration,
+                                          distinct_cluster_sites);
+  config::ConfigurationHashSet serial =
+      config::make_distinct_perturbations_hash_set(configuration,
+                                                   distinct_cluster_sites);
+  config::ConfigurationHashSet parallel =
+      config::make_distinct_perturbations_hash_set(
+          configuration, distinct_cluster_sites, 4);
+  EXPECT_TRUE(serial.to_set() == expected);
+  ASSERT_EQ(parallel.size(), serial.size());
+  for (Index i = 0; i < serial.size(); ++i) {
+    EXPECT_TRUE(parallel.values()[i] == serial.values()[i]);
+  }
+}
+
+TEST_F(FCCBinaryPerturbationsTest, AllDistinctPeriodicPerturbations) {
+  Eigen::Matrix3d motif_L;
+  // conventional 4-atom fcc supercell
+  motif_L.col(0) << 4., 0., 0.;
+  motif_L.col(1) << 0., 4., 0.;
+  motif_L.col(2) << 0., 0., 4.;
+  auto motif_supercell =
+      std::make_shared<config::Supercell const>(prim, xtal::Lattice(motif_L));
+
+  // L12 config
+  config::Configuration motif(motif_supercell);
+  motif.dof_values.occupation(0) = 1;
+
+  Eigen::Matrix3d L = motif_L * 2;
+  supercell = std::make_shared<config::Supercell const>(prim, xtal::Lattice(L));
+
+  std::vector<std::set<clust::IntegralCluster>> orbits;
+  for (auto const &cluster :
+       {clust::IntegralCluster({{0, 0, 0, 0}}),
+        clust::IntegralCluster({{0, 0, 0, 0}, {0, 1, 0, 0}})}) {
+    orbits.emplace_back(make_prim_periodic_orbit(
+        cluster, prim->sym_info.unitcellcoord_symgroup_rep));
+  }
+
+  // expected: serial, per background
+  auto orbits_as_indices = clust::make_flat_orbits_as_indices(
+      orbits, supercell->unitcellcoord_index_converter);
+  std::set<config::Configuration> expected;
+  for (auto const &subset :
+       config::make_all_super_configurations_by_subsets(motif, supercell)) {
+    auto perturbations = config::make_distinct_perturbations(
+        subset[0], make_distinct_cluster_sites(subset[0], orbits_as_indices));
+    expected.insert(perturbations.begin(), perturbations.end());
+  }
+  EXPECT_FALSE(expected.empty());
+
+  for (Index n_threads : {1, 4}) {
+    EXPECT_EQ(config::make_all_distinct_periodic_perturbations(
+                  supercell, motif, orbits, n_threads),
+              expected);
+  }
+}
+
+TEST_F(FCCBinaryPerturbationsTest, PerturbationDeltaSet) {
+  using namespace clust;
+
+  Eigen::Matrix3d L;
+  // conventional 4-atom fcc supercell * 6
+  L.col(0) << 4., 0., 0.;
+  L.col(1) << 0., 8., 0.;
+  L.col(2) << 0., 0., 12.;
+  supercell = std::make_shared<config::Supercell const>(prim, xtal::Lattice(L));
+  config::Configuration configuration(supercell);
+
+  std::vector<clust::IntegralCluster> clusters(
+      {clust::IntegralCluster({{0, 0, 0, 0}, {0, 1, 0, 0}}),
+       clust::IntegralCluster({{0, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}})});
+  std::vector<std::set<clust::IntegralCluster>> orbits;
+  for (auto const &cluster : clusters) {
+    orbits.emplace_back(make_prim_periodic_orbit(
+        cluster, prim->sym_info.unitcellcoord_symgroup_rep));
+  }
+  auto distinct_cluster_sites = make_distinct_cluster_sites(
+      configuration, clust::make_orbits_as_indices(
+                         orbits, supercell->unitcellcoord_index_converter));
+
+  std::set<config::Configuration> expected =
+      config::make_distinct_perturbations(configuration,
+                                          distinct_cluster_sites);
+
+  // all in memory
+  config::PerturbationDeltaSet in_memory(configuration);
+  config::insert_distinct_perturbations(configuration, distinct_cluster_sites,
+                                        in_memory);
+  EXPECT_EQ(in_memory.n_runs(), 0);
+  EXPECT_EQ(in_memory.size(), expected.size());
+  EXPECT_EQ(in_memory.to_set(), expected);
+
+  // spill every few insertions, so duplicates are spread over many runs
+  config::PerturbationDeltaSet spilled(configuration, 200);
+  config::insert_distinct_perturbations(configuration, distinct_cluster_sites,
+                                        spilled);
+  EXPECT_GT(spilled.n_runs(), 1);
+  EXPECT_EQ(spilled.size(), expected.size());
+  EXPECT_EQ(spilled.to_set(), expected);
+
+  // deltas are visited in order, once each
+  std::vector<config::SparseOccupation> deltas;
+  spilled.for_each_delta(
+      [&](config::SparseOccupation const &delta) { deltas.push_back(delta); });
+  EXPECT_TRUE(std::is_sorted(deltas.begin(), deltas.end()));
+  EXPECT_TRUE(std::adjacent_find(deltas.begin(), deltas.end()) ==
+              deltas.end());
+
+  for (auto const &c : expected) {
+    EXPECT_TRUE(config::apply_occupation_delta(
+                    configuration,
+                    config::make_occupation_delta(configuration, c)) == c);
+  }
+
+  spilled.clear();
+  EXPECT_EQ(spilled.n_runs(), 0);
+  EXPECT_EQ(spilled.size(), 0);
+
+  // sets sharing a spill directory write runs in their own directories,
+  // which are removed on destruction
+  test::TmpDir tmp_dir;
+  {
+    config::PerturbationDeltaSet a(configuration, 200, tmp_dir.path());
+    config::PerturbationDeltaSet b(configuration, 200, tmp_dir.path());
+    config::insert_distinct_perturbations(configuration,
+                                          distinct_cluster_sites, a);
+    config::insert_distinct_perturbations(configuration,
+                                          distinct_cluster_sites, b);
+    EXPECT_GT(a.n_runs(), 1);
+    EXPECT_EQ(a.to_set(), expected);
+    EXPECT_EQ(b.to_set(), expected);
+    EXPECT_EQ(std::distance(fs::directory_iterator(tmp_dir.path()),
+                            fs::directory_iterator()),
+              2);
+  }
+  EXPECT_TRUE(fs::is_empty(tmp_dir.path()));
+}
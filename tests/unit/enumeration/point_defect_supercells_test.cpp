@@ -0,0 +1,168 @@
+#include "casm/configuration/enumeration/point_defect_supercells.hh"
+
+#include <algorithm>
+
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/enumeration/enumerate_supercells.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class PointDefectSupercellsTest : public testing::Test {
+ protected:
+  PointDefectSupercellsTest() {
+    prim = config::make_shared_prim(test::FCC_binary_prim());
+    T = config::enumerate_canonical_transformation_matrices(prim, 12);
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::vector<Eigen::Matrix3l> T;
+};
+
+TEST_F(PointDefectSupercellsTest, Scores) {
+  auto scores = config::make_point_defect_superlattice_scores(prim, T);
+  ASSERT_EQ(scores.size(), T.size());
+  for (Index i = 0; i < T.size(); ++i) {
+    config::Supercell supercell(prim, T[i]);
+    EXPECT_EQ(scores[i].transformation_matrix_to_super, T[i]);
+    EXPECT_EQ(scores[i].n_unitcells,
+              supercell.unitcell_index_converter.total_sites());
+    EXPECT_EQ(scores[i].factor_group_size,
+              supercell.sym_info.factor_group->element.size());
+    EXPECT_NEAR(scores[i].voronoi_inner_radius,
+                supercell.superlattice.superlattice().inner_voronoi_radius(),
+                1e-10);
+    EXPECT_GE(config::point_defect_voronoi_inner_radius_bound(prim, T[i]),
+              scores[i].voronoi_inner_radius - 1e-10);
+  }
+
+  // filters, and the result does not depend on the number of threads
+  auto filtered = config::make_point_defect_superlattice_scores(
+      prim, T, 8, scores[0].voronoi_inner_radius * 2.0, 1);
+  auto filtered_4 = config::make_point_defect_superlattice_scores(
+      prim, T, 8, scores[0].voronoi_inner_radius * 2.0, 4);
+  ASSERT_GT(filtered.size(), 0);
+  ASSERT_LT(filtered.size(), scores.size());
+  ASSERT_EQ(filtered.size(), filtered_4.size());
+  for (Index i = 0; i < filtered.size(); ++i) {
+    EXPECT_GE(filtered[i].factor_group_size, 8);
+    EXPECT_EQ(filtered[i].transformation_matrix_to_super,
+              filtered_4[i].transformation_matrix_to_super);
+  }
+}
+
+TEST_F(PointDefectSupercellsTest, Pareto) {
+  auto scores = config::make_point_defect_superlattice_scores(prim, T);
+  std::vector<Index> n_unitcells;
+  std::vector<double> radius;
+  std::vector<bool> is_candidate;
+  for (auto const &score : scores) {
+    n_unitcells.push_back(score.n_unitcells);
+    radius.push_back(score.voronoi_inner_radius);
+    is_candidate.push_back(true);
+  }
+  std::vector<Index> pareto =
+      config::make_point_defect_pareto_indices(n_unitcells, radius,
+                                               is_candidate);
+
+  // brute force
+  double tol = 1e-5;
+  std::vector<Index> expected;
+  for (Index i = 0; i < scores.size(); ++i) {
+    bool is_max = true;
+    for (Index j = 0; j < scores.size(); ++j) {
+      if (j == i || n_unitcells[j] > n_unitcells[i]) {
+        continue;
+      }
+      if (n_unitcells[i] == n_unitcells[j] &&
+          std::abs(radius[i] - radius[j]) <= tol) {
+        continue;
+      }
+      if (radius[i] < radius[j] + tol) {
+        is_max = false;
+        break;
+      }
+    }
+    if (is_max) {
+      expected.push_back(i);
+    }
+  }
+  ASSERT_GT(expected.size(), 1);
+  EXPECT_EQ(pareto, expected);
+
+  // bounded search gives the same result
+  for (Index n_threads : {1, 4}) {
+    auto found = config::find_pareto_point_defect_superlattices(
+        prim, T, 0, 0.0, tol, n_threads);
+    ASSERT_EQ(found.size(), expected.size());
+    for (Index k = 0; k < expected.size(); ++k) {
+      EXPECT_EQ(found[k].transformation_matrix_to_super, T[expected[k]]);
+    }
+  }
+}
+
+TEST_F(PointDefectSupercellsTest, RequiredOperationsAndSites) {
+  std::vector<xtal::UnitCellCoord> sites;
+  for (long i = -1; i <= 2; ++i) {
+    for (long j = -1; j <= 1; ++j) {
+      sites.emplace_back(0, i, j, 0);
+    }
+  }
+  for (Index t = 0; t < std::min(Index(T.size()), Index(30)); ++t) {
+    config::Supercell supercell(prim, T[t]);
+
+    // required sites: compare with linear site indices
+    auto const &converter = supercell.unitcellcoord_index_converter;
+    for (Index a = 0; a < sites.size(); ++a) {
+      for (Index b = a + 1; b < sites.size(); ++b) {
+        bool expected = converter(sites[a]) != converter(sites[b]);
+        EXPECT_EQ(config::has_required_sites(prim, T[t],
+                                             {{sites[a], sites[b]}}),
+                  expected);
+      }
+    }
+
+    // required operations: compare with the supercell factor group
+    auto const &head_group_index =
+        supercell.sym_info.factor_group->head_group_index;
+    Index n_prim_ops = prim->sym_info.factor_group->element.size();
+    for (Index i = 0; i < n_prim_ops; ++i) {
+      bool expected =
+          std::find(head_group_index.begin(), head_group_index.end(), i) !=
+          head_group_index.end();
+      EXPECT_EQ(config::has_required_operations(prim, T[t], {i}), expected);
+    }
+
+    std::vector<Index> required(head_group_index.begin(),
+                                head_group_index.end());
+    std::sort(required.begin(), required.end());
+    std::vector<Eigen::Matrix3l> equivalents =
+        config::make_equivalent_transformation_matrices(prim, T[t]);
+    std::vector<Eigen::Matrix3l> expected;
+    for (auto const &T_equiv : equivalents) {
+      auto ops = config::make_superlattice_invariant_factor_group_indices(
+          prim, T_equiv);
+      if (std::includes(ops.begin(), ops.end(), required.begin(),
+                        required.end())) {
+        expected.push_back(T_equiv);
+      }
+    }
+    ASSERT_GT(expected.size(), 0);
+    for (Index n_threads : {1, 4}) {
+      auto matching =
+          config::make_equivalent_supercells_with_required_operations(
+              supercell, required, n_threads);
+      ASSERT_EQ(matching.size(), expected.size());
+      for (Index k = 0; k < expected.size(); ++k) {
+        EXPECT_EQ(matching[k]->superlattice.transformation_matrix_to_super(),
+                  expected[k]);
+      }
+    }
+  }
+  EXPECT_THROW(config::has_required_operations(prim, T[0], {-1}),
+               std::runtime_error);
+}
@@ -155,6 +155,121 @@ TEST_F(FCCBinaryOccEventCounterTest, Test2) {
   EXPECT_EQ(prototypes.size(), 4);
 }
 
+TEST_F(FCCBinaryOccEventCounterTest, TrajectoryConstraints) {
+  using namespace CASM::occ_events;
+
+  // clang-format off
+  std::vector<clust::IntegralCluster> clusters({
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0),
+          xtal::UnitCellCoord(0, 1, 0, 0),
+          xtal::UnitCellCoord(0, 0, 1, 0)}),
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0),
+          xtal::UnitCellCoord(0, 1, 1, -1)})});
+  // clang-format on
+
+  OccEventCounterParameters base;
+  base.allow_subcluster_events = true;
+  base.skip_direct_exchange = false;
+  Index n_all = count_occevents(clusters, base);
+
+  auto n_moving = [&](OccEventCounterData const &data) {
+    Index n = 0;
+    for (Index i = 0; i < data.position_init.size(); ++i) {
+      if (!system->is_vacancy(data.position_init[i]) &&
+          data.position_init[i].integral_site_coordinate !=
+              data.position_final[i].integral_site_coordinate) {
+        ++n;
+      }
+    }
+    return n;
+  };
+
+  // the constraints skip the same events as equivalent trajectory filters
+  {
+    OccEventCounterParameters params = base;
+    params.max_moving_atoms = 2;
+    OccEventCounterParameters filter_params = base;
+    filter_params.trajectory_filter = [&](OccEventCounterData const &data) {
+      return n_moving(data) <= 2;
+    };
+    Index n = count_occevents(clusters, params);
+    EXPECT_EQ(n, count_occevents(clusters, filter_params));
+    EXPECT_LT(n, n_all);
+  }
+
+  {
+    // nearest neighbor distance is 2*sqrt(2)
+    OccEventCounterParameters params = base;
+    params.max_trajectory_length = 3.0;
+    OccEventCounterParameters filter_params = base;
+    filter_params.trajectory_filter = [&](OccEventCounterData const &data) {
+      for (Index i = 0; i < data.position_init.size(); ++i) {
+        Eigen::Vector3d d =
+            system->get_cartesian_coordinate(data.position_final[i]) -
+            system->get_cartesian_coordinate(data.position_init[i]);
+        if (d.norm() > 3.0) {
+          return false;
+        }
+      }
+      return true;
+    };
+    Index n = count_occevents(clusters, params);
+    EXPECT_EQ(n, count_occevents(clusters, filter_params));
+    EXPECT_LT(n, n_all);
+  }
+
+  {
+    // "B" may not move onto a site initially occupied by "B"
+    OccEventCounterParameters params = base;
+    params.allowed_species_pairs =
+        std::set<std::pair<std::string, std::string>>(
+            {{"A", "A"}, {"A", "B"}, {"B", "A"}});
+    OccEventCounterParameters filter_params = base;
+    filter_params.trajectory_filter = [&](OccEventCounterData const &data) {
+      for (Index i = 0; i < data.position_init.size(); ++i) {
+        auto const &before = data.position_init[i];
+        auto const &after = data.position_final[i];
+        if (before.integral_site_coordinate == after.integral_site_coordinate ||
+            system->get_atom_name(before) != "B") {
+          continue;
+        }
+        for (Index j = 0; j < data.cluster.size(); ++j) {
+          if (data.cluster[j] == after.integral_site_coordinate &&
+              system->get_chemical_name(data.cluster[j],
+                                        data.occ_init_counter()[j]) == "B") {
+            return false;
+          }
+        }
+      }
+      return true;
+    };
+    Index n = count_occevents(clusters, params);
+    EXPECT_EQ(n, count_occevents(clusters, filter_params));
+    EXPECT_LT(n, n_all);
+  }
+
+  // pruned permutations are skipped without being checked individually
+  {
+    OccEventCounterParameters params = base;
+    params.max_moving_atoms = 1;
+    params.save_state_info = true;
+    OccEventCounterParameters filter_params = base;
+    filter_params.save_state_info = true;
+    filter_params.trajectory_filter = [&](OccEventCounterData const &data) {
+      return n_moving(data) <= 1;
+    };
+    OccEventCounter counter(system, clusters, params);
+    OccEventCounter filter_counter(system, clusters, filter_params);
+    while (counter.advance()) {
+    }
+    while (filter_counter.advance()) {
+    }
+    EXPECT_LT(counter.data()->info.size(), filter_counter.data()->info.size());
+  }
+}
+
 TEST(OccEventCounterParametersJsonIO, Test1) {
   occ_events::OccEventCounterParameters params;
   _check_json_io(params);
@@ -172,4 +287,11 @@ TEST(OccEventCounterParametersJsonIO, Test1) {
   params.min_cluster_size = 2;
   params.max_cluster_size = 4;
   _check_json_io(params);
+
+  params = occ_events::OccEventCounterParameters();
+  params.max_trajectory_length = 3.0;
+  params.max_moving_atoms = 2;
+  params.allowed_species_pairs =
+      std::set<std::pair<std::string, std::string>>({{"A", "Va"}});
+  _check_json_io(params);
 }
@@ -1,5 +1,10 @@
+#include <set>
+
 #include "casm/configuration/group/Group.hh"
+#include "casm/configuration/group/orbits.hh"
+#include "casm/configuration/occ_events/OccEvent.hh"
 #include "casm/configuration/occ_events/OccEventCounter.hh"
+#include "casm/configuration/occ_events/OccEventInvariants.hh"
 #include "casm/configuration/occ_events/OccEventRep.hh"
 #include "casm/configuration/occ_events/OccSystem.hh"
 #include "casm/configuration/occ_events/definitions.hh"
@@ -197,3 +202,118 @@ TEST_F(FCCDumbbellOccEventCounterTest, Test2) {
 
   EXPECT_EQ(prototypes.size(), 5);
 }
+
+TEST_F(FCCDumbbellOccEventCounterTest, ParallelPrototypes) {
+  using namespace CASM::occ_events;
+
+  // clang-format off
+  std::vector<clust::IntegralCluster> clusters({
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0)}),
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0),
+          xtal::UnitCellCoord(0, 1, 0, 0)}),
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0),
+          xtal::UnitCellCoord(0, 1, 1, -1)})});
+  // clang-format on
+
+  OccEventCounterParameters params;
+  params.skip_direct_exchange = false;
+
+  std::vector<OccEvent> serial = make_prim_periodic_occevent_prototypes(
+      system, clusters, occevent_symgroup_rep, params);
+  EXPECT_TRUE(serial.size() > 0);
+  for (Index n_threads : {2, 3, 0}) {
+    std::vector<OccEvent> parallel = make_prim_periodic_occevent_prototypes(
+        system, clusters, occevent_symgroup_rep, params, {}, n_threads);
+    EXPECT_EQ(parallel, serial);
+  }
+}
+
+TEST_F(FCCDumbbellOccEventCounterTest, HashedPrototypes) {
+  using namespace CASM::occ_events;
+
+  // clang-format off
+  std::vector<clust::IntegralCluster> clusters({
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0),
+          xtal::UnitCellCoord(0, 1, 0, 0)}),
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0),
+          xtal::UnitCellCoord(0, 1, 1, -1)})});
+  // clang-format on
+
+  OccEventCounterParameters params;
+  params.skip_direct_exchange = false;
+
+  // expected: canonicalize every counted OccEvent
+  typedef std::pair<OccEventInvariants, OccEvent> pair_type;
+  std::set<pair_type, CompareOccEvent_f> expected_set(
+      CompareOccEvent_f(system->prim->lattice().tol()));
+  OccEventHash hash_f;
+  auto translation_standardized = [](OccEvent occ_event) {
+    standardize(occ_event);
+    occ_event -= make_cluster(occ_event)[0].unitcell();
+    return occ_event;
+  };
+  OccEventCounter counter(system, clusters, params);
+  while (!counter.is_finished()) {
+    OccEvent event = counter.value();
+    OccEvent standardized = translation_standardized(event);
+    OccEvent translated =
+        translation_standardized(event + xtal::UnitCell(1, -2, 3));
+    EXPECT_EQ(translated, standardized);
+    EXPECT_EQ(hash_f(translated), hash_f(standardized));
+
+    expected_set.emplace(
+        OccEventInvariants(event, *system),
+        group::make_canonical_element(
+            event, occevent_symgroup_rep.begin(), occevent_symgroup_rep.end(),
+            std::less<OccEvent>(), prim_periodic_occevent_copy_apply));
+    counter.advance();
+  }
+  std::vector<OccEvent> expected;
+  for (auto const &pair : expected_set) {
+    expected.push_back(pair.second);
+  }
+
+  std::vector<OccEvent> prototypes = make_prim_periodic_occevent_prototypes(
+      system, clusters, occevent_symgroup_rep, params);
+  EXPECT_EQ(prototypes, expected);
+}
+
+TEST_F(FCCDumbbellOccEventCounterTest, IncrementalOrbits) {
+  using namespace CASM::occ_events;
+
+  // clang-format off
+  std::vector<clust::IntegralCluster> clusters({
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0),
+          xtal::UnitCellCoord(0, 1, 0, 0)}),
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0),
+          xtal::UnitCellCoord(0, 1, 1, -1)})});
+  // clang-format on
+
+  OccEventCounterParameters params;
+  params.skip_direct_exchange = false;
+
+  std::vector<OccEvent> expected = make_prim_periodic_occevent_prototypes(
+      system, clusters, occevent_symgroup_rep, params);
+
+  std::set<OccEvent> found;
+  Index n_calls = 0;
+  Index n_orbits = for_each_prim_periodic_occevent_orbit(
+      system, clusters, occevent_symgroup_rep, params,
+      [&](OccEvent const &prototype, std::set<OccEvent> const &orbit) {
+        ++n_calls;
+        EXPECT_EQ(orbit,
+                  make_prim_periodic_orbit(prototype, occevent_symgroup_rep));
+        EXPECT_TRUE(found.insert(prototype).second);
+      });
+
+  EXPECT_EQ(n_orbits, expected.size());
+  EXPECT_EQ(n_calls, expected.size());
+  EXPECT_EQ(found, std::set<OccEvent>(expected.begin(), expected.end()));
+}
@@ -0,0 +1,81 @@
+#include "casm/configuration/occ_events/LocalOrbitsCache.hh"
+
+#include <algorithm>
+
+#include "casm/configuration/clusterography/ClusterSpecs.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/group/Group.hh"
+#include "casm/configuration/occ_events/OccEvent.hh"
+#include "casm/configuration/occ_events/OccEventRep.hh"
+#include "casm/configuration/occ_events/OccSystem.hh"
+#include "casm/configuration/occ_events/orbits.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/configuration/sym_info/unitcellcoord_sym_info.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class FCCBinaryLocalOrbitsCacheTest : public testing::Test {
+ protected:
+  std::shared_ptr<xtal::BasicStructure const> prim;
+  std::shared_ptr<occ_events::SymGroup const> factor_group;
+  std::vector<occ_events::OccEventRep> occevent_symgroup_rep;
+  std::unique_ptr<occ_events::OccSystem> system;
+
+  FCCBinaryLocalOrbitsCacheTest() {
+    prim =
+        std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+    factor_group = sym_info::make_factor_group(*prim);
+    occevent_symgroup_rep =
+        occ_events::make_occevent_symgroup_rep(factor_group->element, *prim);
+    system = std::make_unique<occ_events::OccSystem>(
+        prim,
+        occ_events::make_chemical_name_list(*prim, factor_group->element));
+  }
+};
+
+TEST_F(FCCBinaryLocalOrbitsCacheTest, EquivalentEvents) {
+  using namespace CASM::occ_events;
+
+  xtal::UnitCellCoord site0(0, 0, 0, 0);
+  xtal::UnitCellCoord site1(0, 1, 0, 0);
+  OccEvent occ_event(
+      {OccTrajectory({system->make_molecule_position(site0, "B"),
+                      system->make_molecule_position(site1, "B")}),
+       OccTrajectory({system->make_molecule_position(site1, "A"),
+                      system->make_molecule_position(site0, "A")})});
+
+  clust::SiteFilterFunction site_filter = clust::dof_sites_filter();
+  std::vector<double> max_length = {0, 0, 3.01};
+  std::vector<double> cutoff_radius = {0, 3.01, 3.01};
+  LocalOrbitsCache cache(prim, factor_group, site_filter, max_length, {},
+                         cutoff_radius);
+
+  for (Index i = 0; i < Index(occevent_symgroup_rep.size()); i += 7) {
+    OccEvent equiv = copy_apply(occevent_symgroup_rep[i], occ_event);
+    equiv += xtal::UnitCell(1, 0, -1);
+    standardize(equiv);
+
+    auto orbits = cache.local_orbits(equiv);
+
+    auto invariant_group =
+        make_occevent_group(equiv, factor_group,
+                            prim->lattice().lat_column_mat(),
+                            occevent_symgroup_rep);
+    auto expected = clust::make_local_orbits(
+        prim,
+        sym_info::make_unitcellcoord_symgroup_rep(invariant_group->element,
+                                                  *prim),
+        site_filter, max_length, {}, make_cluster(equiv), cutoff_radius);
+
+    ASSERT_EQ(orbits.size(), expected.size());
+    std::sort(orbits.begin(), orbits.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(orbits, expected);
+  }
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.n_misses(), 1);
+}
@@ -0,0 +1,122 @@
+#include "casm/configuration/occ_events/io/binary/OccEvent_binary_io.hh"
+
+#include "casm/configuration/occ_events/OccEvent.hh"
+#include "casm/configuration/occ_events/OccEventCounter.hh"
+#include "casm/configuration/occ_events/OccEventRep.hh"
+#include "casm/configuration/occ_events/OccPosition.hh"
+#include "casm/configuration/occ_events/OccSystem.hh"
+#include "casm/configuration/occ_events/OccTrajectory.hh"
+#include "casm/configuration/occ_events/PackedOccEvent.hh"
+#include "casm/configuration/occ_events/orbits.hh"
+#include "casm/configuration/sym_info/factor_group.hh"
+#include "casm/crystallography/BasicStructure.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+#include "gtest/gtest.h"
+#include "teststructures.hh"
+
+using namespace CASM;
+
+class OccEventBinaryIOTest : public testing::Test {
+ protected:
+  std::shared_ptr<xtal::BasicStructure const> prim;
+  std::shared_ptr<occ_events::SymGroup const> factor_group;
+  std::vector<occ_events::OccEventRep> occevent_symgroup_rep;
+  std::shared_ptr<occ_events::OccSystem> system;
+
+  OccEventBinaryIOTest() {
+    prim =
+        std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+    factor_group = sym_info::make_factor_group(*prim);
+    occevent_symgroup_rep =
+        occ_events::make_occevent_symgroup_rep(factor_group->element, *prim);
+    system = std::make_shared<occ_events::OccSystem>(
+        prim,
+        occ_events::make_chemical_name_list(*prim, factor_group->element));
+  }
+};
+
+TEST_F(OccEventBinaryIOTest, Orbits) {
+  using namespace CASM::occ_events;
+
+  // clang-format off
+  std::vector<clust::IntegralCluster> clusters({
+      clust::IntegralCluster({
+          xtal::UnitCellCoord(0, 0, 0, 0),
+          xtal::UnitCellCoord(0, 1, 0, 0),
+          xtal::UnitCellCoord(0, 0, 1, 0)})});
+  // clang-format on
+
+  OccEventCounterParameters params;
+  std::vector<std::set<OccEvent>> orbits = make_prim_periodic_occevent_orbits(
+      system, clusters, occevent_symgroup_rep, params);
+  ASSERT_EQ(orbits.size(), 4);
+
+  std::string bytes = to_bytes(orbits, *system);
+  std::vector<std::set<OccEvent>> orbits_in =
+      occevent_orbits_from_bytes(bytes, *system);
+  EXPECT_TRUE(orbits_in == orbits);
+
+  // read as a flat list of events
+  std::vector<OccEvent> events = occevents_from_bytes(bytes, *system);
+  Index n_events = 0;
+  for (auto const &orbit : orbits) {
+    n_events += orbit.size();
+  }
+  EXPECT_EQ(events.size(), n_events);
+  EXPECT_TRUE(events.front() == *orbits.front().begin());
+}
+
+TEST_F(OccEventBinaryIOTest, NotPackable) {
+  using namespace CASM::occ_events;
+
+  // unit cell indices out of the packed range are written in full
+  OccPosition A = OccPosition::molecule(xtal::UnitCellCoord(0, 0, 0, 0), 1);
+  OccPosition B =
+      OccPosition::molecule(xtal::UnitCellCoord(0, 5000, 0, -3), 1);
+  OccPosition C = OccPosition::atom(xtal::UnitCellCoord(0, 1, 0, 0), 0, 0);
+  std::vector<OccEvent> events = {
+      OccEvent({OccTrajectory({A, B}), OccTrajectory({B, A})}),
+      OccEvent({OccTrajectory({A, C}), OccTrajectory({C, A})}), OccEvent()};
+  ASSERT_FALSE(PackedOccEvent::is_packable(events[0]));
+
+  std::vector<OccEvent> events_in =
+      occevents_from_bytes(to_bytes(events, *system), *system);
+  ASSERT_EQ(events_in.size(), events.size());
+  for (Index i = 0; i < events.size(); ++i) {
+    EXPECT_TRUE(events_in[i] == events[i]);
+  }
+}
+
+TEST_F(OccEventBinaryIOTest, Invalid) {
+  using namespace CASM::occ_events;
+
+  OccPosition A = OccPosition::molecule(xtal::UnitCellCoord(0, 0, 0, 0), 1);
+  OccPosition B = OccPosition::molecule(xtal::UnitCellCoord(0, 1, 0, 0), 1);
+  std::vector<OccEvent> events = {
+      OccEvent({OccTrajectory({A, B}), OccTrajectory({B, A})})};
+  std::string bytes = to_bytes(events, *system);
+
+  // different OccSystem
+  auto ternary_prim =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_ternary_prim());
+  OccSystem ternary_system(
+      ternary_prim, make_chemical_name_list(*ternary_prim,
+                                            factor_group->element));
+  EXPECT_NE(make_occsystem_digest(ternary_system),
+            make_occsystem_digest(*system));
+  EXPECT_THROW(occevents_from_bytes(bytes, ternary_system),
+               std::runtime_error);
+
+  // out of range occupant index
+  OccPosition D = OccPosition::molecule(xtal::UnitCellCoord(0, 1, 0, 0), 5);
+  std::vector<OccEvent> invalid = {OccEvent({OccTrajectory({A, D})})};
+  EXPECT_THROW(occevents_from_bytes(to_bytes(invalid, *system), *system),
+               std::runtime_error);
+
+  // truncated or not a binary OccEvent stream
+  EXPECT_THROW(occevents_from_bytes(bytes.substr(0, bytes.size() - 1),
+                                    *system),
+               std::runtime_error);
+  EXPECT_THROW(occevents_from_bytes("not binary", *system),
+               std::runtime_error);
+}
@@ -2,6 +2,7 @@
 
 #include "casm/configuration/group/Group.hh"
 #include "casm/configuration/occ_events/OccPosition.hh"
+#include "casm/configuration/occ_events/OccSystemCache.hh"
 #include "casm/configuration/occ_events/definitions.hh"
 #include "casm/configuration/sym_info/factor_group.hh"
 #include "casm/crystallography/BasicStructure.hh"
@@ -114,6 +115,90 @@ TEST(OccSystemTest, Test3) {
             std::vector<std::string>({"A2.x", "A2.y", "A2.z"}));
 }
 
+TEST(OccSystemTest, FlatLookupTables) {
+  auto prim =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_dimer_prim());
+  std::shared_ptr<occ_events::SymGroup const> factor_group =
+      sym_info::make_factor_group(*prim);
+  std::vector<std::string> chemical_name_list =
+      occ_events::make_chemical_name_list(*prim, factor_group->element);
+  occ_events::OccSystem system(prim, chemical_name_list);
+
+  EXPECT_EQ(system.occupant_offset.size(), prim->basis().size());
+  for (Index b = 0; b < prim->basis().size(); ++b) {
+    Index n_occupants = prim->basis()[b].occupant_dof().size();
+    for (Index i = 0; i < n_occupants; ++i) {
+      EXPECT_EQ(system.get_chemical_index(b, i),
+                system.occupant_to_chemical_index[b][i]);
+      EXPECT_EQ(system.get_orientation_index(b, i),
+                system.occupant_to_orientation_index[b][i]);
+      auto const &atom_names = system.atom_position_to_name_index[b][i];
+      EXPECT_EQ(system.get_n_atom_positions(b, i), atom_names.size());
+      for (Index j = 0; j < atom_names.size(); ++j) {
+        EXPECT_EQ(system.get_atom_name_index(b, i, j), atom_names[j]);
+      }
+    }
+  }
+}
+
+TEST(OccSystemTest, MoleculeListOrientations) {
+  auto prim =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_dimer_prim());
+  std::shared_ptr<occ_events::SymGroup const> factor_group =
+      sym_info::make_factor_group(*prim);
+
+  auto all_orientations = occ_events::molecule_list_all_orientations(*prim);
+  ASSERT_EQ(all_orientations.size(), 3);
+  for (Index i = 0; i < all_orientations.size(); ++i) {
+    EXPECT_TRUE(all_orientations[i].identical(
+        prim->basis()[0].occupant_dof()[i], prim->lattice().tol()));
+  }
+  auto single_orientation = occ_events::molecule_list_single_orientation(
+      all_orientations, factor_group->element, prim->lattice().tol());
+  EXPECT_EQ(single_orientation.size(), 1);
+
+  auto invalid_prim = std::make_shared<xtal::BasicStructure const>(
+      FCC_dimer_prim_invalid_naming1());
+  EXPECT_THROW(occ_events::molecule_list_single_orientation(
+                   *invalid_prim, factor_group->element),
+               std::runtime_error);
+}
+
+TEST(OccSystemTest, OccSystemCache) {
+  occ_events::OccSystemCache cache;
+  auto prim =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_dimer_prim());
+  auto other_prim =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_dimer_prim());
+  std::shared_ptr<occ_events::SymGroup const> factor_group =
+      sym_info::make_factor_group(*prim);
+
+  // equal prims share one OccSystem
+  auto system = cache.make(prim);
+  EXPECT_EQ(system->chemical_name_list,
+            occ_events::make_chemical_name_list(*prim, factor_group->element));
+  EXPECT_EQ(cache.make(other_prim), system);
+  EXPECT_EQ(cache.make(prim, system->chemical_name_list), system);
+  EXPECT_EQ(cache.size(), 1);
+
+  // different vacancy names
+  auto no_va_system =
+      cache.make(prim, std::nullopt, std::set<std::string>());
+  EXPECT_NE(no_va_system, system);
+  EXPECT_EQ(cache.size(), 2);
+
+  // different prim
+  auto binary_prim =
+      std::make_shared<xtal::BasicStructure const>(test::FCC_binary_prim());
+  EXPECT_EQ(cache.make(binary_prim)->chemical_name_list,
+            std::vector<std::string>({"A", "B"}));
+  EXPECT_EQ(cache.size(), 3);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_NE(cache.make(prim), system);
+}
+
 TEST(MakereservoirPositionTest, Test1) {
   auto prim =
       std::make_shared<xtal::BasicStructure const>(test::FCC_dimer_prim());
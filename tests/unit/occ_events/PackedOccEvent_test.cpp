@@ -0,0 +1,94 @@
+#include "casm/configuration/occ_events/PackedOccEvent.hh"
+
+#include "casm/configuration/occ_events/OccEvent.hh"
+#include "casm/configuration/occ_events/OccPosition.hh"
+#include "casm/configuration/occ_events/OccTrajectory.hh"
+#include "casm/crystallography/UnitCellCoord.hh"
+#include "gtest/gtest.h"
+
+using namespace CASM;
+using occ_events::OccEvent;
+using occ_events::OccPosition;
+using occ_events::OccTrajectory;
+using occ_events::PackedOccEvent;
+using occ_events::PackedOccPosition;
+
+namespace {
+
+std::vector<OccPosition> _make_positions() {
+  std::vector<xtal::UnitCellCoord> sites = {
+      xtal::UnitCellCoord(0, 0, 0, 0),     xtal::UnitCellCoord(1, 0, 0, 0),
+      xtal::UnitCellCoord(0, 1, 0, 0),     xtal::UnitCellCoord(0, -1, 0, 0),
+      xtal::UnitCellCoord(0, 0, -1, 1),    xtal::UnitCellCoord(2, 0, 0, -1),
+      xtal::UnitCellCoord(0, 2047, 0, 0),  xtal::UnitCellCoord(3, 0, 0, -2048),
+      xtal::UnitCellCoord(1, -1, 1, -1)};
+  std::vector<OccPosition> positions;
+  for (auto const &site : sites) {
+    for (Index occ = 0; occ < 2; ++occ) {
+      positions.push_back(OccPosition::molecule(site, occ));
+      for (Index atom = 0; atom < 2; ++atom) {
+        positions.push_back(OccPosition::atom(site, occ, atom));
+      }
+    }
+  }
+  for (Index occ = 0; occ < 3; ++occ) {
+    positions.push_back(OccPosition::molecule_in_reservoir(occ));
+    positions.push_back(OccPosition::atom_in_reservoir(occ));
+  }
+  return positions;
+}
+
+}  // namespace
+
+TEST(PackedOccEventTest, PositionOrder) {
+  std::vector<OccPosition> positions = _make_positions();
+  for (auto const &A : positions) {
+    ASSERT_TRUE(PackedOccPosition::is_packable(A));
+    std::uint64_t a = PackedOccPosition::pack(A);
+    EXPECT_TRUE(PackedOccPosition::unpack(a) == A);
+    for (auto const &B : positions) {
+      std::uint64_t b = PackedOccPosition::pack(B);
+      EXPECT_EQ(a < b, A < B);
+      EXPECT_EQ(a == b, A == B);
+    }
+  }
+}
+
+TEST(PackedOccEventTest, NotPackable) {
+  std::vector<OccPosition> positions = {
+      OccPosition::molecule(xtal::UnitCellCoord(0, 2048, 0, 0), 0),
+      OccPosition::molecule(xtal::UnitCellCoord(1024, 0, 0, 0), 0),
+      OccPosition::molecule(xtal::UnitCellCoord(0, 0, 0, 0), 256),
+      OccPosition::atom(xtal::UnitCellCoord(0, 0, 0, 0), 0, 256)};
+  for (auto const &pos : positions) {
+    EXPECT_FALSE(PackedOccPosition::is_packable(pos));
+    EXPECT_THROW(PackedOccPosition::pack(pos), std::runtime_error);
+  }
+}
+
+TEST(PackedOccEventTest, EventOrder) {
+  std::vector<OccPosition> p = _make_positions();
+  std::vector<OccEvent> events = {
+      OccEvent(),
+      OccEvent({OccTrajectory({p[0], p[3]})}),
+      OccEvent({OccTrajectory({p[3], p[0]})}),
+      OccEvent({OccTrajectory({p[0], p[3], p[6]})}),
+      OccEvent({OccTrajectory({p[0], p[3]}), OccTrajectory({p[3], p[0]})}),
+      OccEvent({OccTrajectory({p[0]}), OccTrajectory({p[3], p[0]})}),
+      OccEvent({OccTrajectory({p[0], p[3]}), OccTrajectory({p[3]})}),
+      OccEvent({OccTrajectory({p[9], p.back()})})};
+  for (auto const &A : events) {
+    ASSERT_TRUE(PackedOccEvent::is_packable(A));
+    PackedOccEvent a(A);
+    EXPECT_TRUE(a.unpack() == A);
+    for (auto const &B : events) {
+      PackedOccEvent b(B);
+      EXPECT_EQ(a < b, A < B);
+      EXPECT_EQ(a == b, A == B);
+      if (a == b) {
+        EXPECT_EQ(occ_events::PackedOccEventHash()(a),
+                  occ_events::PackedOccEventHash()(b));
+      }
+    }
+  }
+}
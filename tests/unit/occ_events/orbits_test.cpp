@@ -128,3 +128,54 @@ TEST_F(FCCBinaryOccEventOrbitTest, Test4) {
       occevent_symgroup_rep);
   EXPECT_EQ(occevent_group->element.size(), 2);
 }
+
+TEST_F(FCCBinaryOccEventOrbitTest, OccEventGroups) {
+  using namespace CASM::occ_events;
+
+  xtal::UnitCellCoord site0(0, 0, 0, 0);
+  xtal::UnitCellCoord site1(0, 1, 0, 0);
+  xtal::UnitCellCoord site2(0, 0, 1, 0);
+
+  std::vector<std::set<OccEvent>> orbits;
+  orbits.push_back(make_prim_periodic_orbit(
+      OccEvent({OccTrajectory({system->make_molecule_position(site0, "B"),
+                               system->make_molecule_position(site1, "B")}),
+                OccTrajectory({system->make_molecule_position(site1, "A"),
+                               system->make_molecule_position(site0, "A")})}),
+      occevent_symgroup_rep));
+  orbits.push_back(make_prim_periodic_orbit(
+      OccEvent({OccTrajectory({system->make_molecule_position(site0, "B"),
+                               system->make_molecule_position(site1, "B")}),
+                OccTrajectory({system->make_molecule_position(site1, "A"),
+                               system->make_molecule_position(site2, "A")}),
+                OccTrajectory({system->make_molecule_position(site2, "A"),
+                               system->make_molecule_position(site0, "A")})}),
+      occevent_symgroup_rep));
+
+  Eigen::Matrix3d lat_column_mat = prim->lattice().lat_column_mat();
+  auto orbits_groups = make_occevent_groups(
+      orbits, factor_group, lat_column_mat, occevent_symgroup_rep, 2);
+  ASSERT_EQ(orbits_groups.size(), orbits.size());
+
+  for (Index i = 0; i < orbits.size(); ++i) {
+    // conjugated groups match groups found by applying all operations
+    ASSERT_EQ(orbits_groups[i].size(), orbits[i].size());
+    auto orbit_it = orbits[i].begin();
+    for (auto const &group : orbits_groups[i]) {
+      auto expected = make_occevent_group(*orbit_it, factor_group,
+                                          lat_column_mat,
+                                          occevent_symgroup_rep);
+      EXPECT_EQ(group->head_group_index, expected->head_group_index);
+      ASSERT_EQ(group->element.size(), expected->element.size());
+      for (Index j = 0; j < group->element.size(); ++j) {
+        EXPECT_TRUE(group->element[j].matrix.isApprox(
+            expected->element[j].matrix));
+        EXPECT_LT((group->element[j].translation -
+                   expected->element[j].translation)
+                      .norm(),
+                  1e-10);
+      }
+      ++orbit_it;
+    }
+  }
+}
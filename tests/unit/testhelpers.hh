@@ -0,0 +1,33 @@
+#ifndef CASM_unittest_testhelpers
+#define CASM_unittest_testhelpers
+
+#include <set>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/definitions.hh"
+
+namespace test {
+
+/// Set occupation to the `count`-th occupation in base `n_occ`
+inline void set_occupation(Eigen::VectorXi &occ, CASM::Index count,
+                           int n_occ) {
+  for (CASM::Index l = 0; l < occ.size(); ++l) {
+    occ[l] = count % n_occ;
+    count /= n_occ;
+  }
+}
+
+/// Return the indices of all sites in `configuration`
+inline std::set<CASM::Index> make_all_sites(
+    CASM::config::Configuration const &configuration) {
+  std::set<CASM::Index> sites;
+  for (CASM::Index l = 0; l < configuration.dof_values.occupation.size();
+       ++l) {
+    sites.insert(l);
+  }
+  return sites;
+}
+
+}  // namespace test
+
+#endif
@@ -0,0 +1,172 @@
+#include <optional>
+
+#include "casm/configuration/Configuration.hh"
+#include "casm/configuration/Prim.hh"
+#include "casm/configuration/Supercell.hh"
+#include "casm/configuration/SupercellSymOp.hh"
+#include "casm/configuration/canonical_form.hh"
+#include "casm/configuration/clusterography/IntegralCluster.hh"
+#include "casm/configuration/clusterography/orbits.hh"
+#include "casm/configuration/parallel.hh"
+#include "gtest/gtest.h"
+#include "testhelpers.hh"
+#include "teststructures.hh"
+
+// These tests share one Prim, Supercell, and set of SupercellSymOp between
+// threads, without copying, to check the thread safety contract described
+// for Supercell and SupercellSymOp. Build with CASM_TESTS_TSAN=ON to check
+// them with ThreadSanitizer.
+
+using namespace CASM;
+
+namespace {
+
+Index const n_threads = 4;
+
+}  // namespace
+
+class ThreadSafetyTest : public testing::Test {
+ protected:
+  ThreadSafetyTest() {
+    prim = config::make_shared_prim(test::FCC_binary_prim());
+    Eigen::Matrix3l T;
+    T << 2, 0, 0, 0, 2, 0, 0, 0, 2;
+    // store all translation permutations
+    supercell = std::make_shared<config::Supercell const>(prim, T);
+    // cache at most 2 translation permutations, so concurrent callers of
+    // `translation_permute()` replace them
+    supercell_cached = std::make_shared<config::Supercell const>(
+        prim, T, 0, 2 * 8 * sizeof(Index));
+
+    for (Index count = 0; count < 64; ++count) {
+      config::Configuration configuration(supercell);
+      test::set_occupation(configuration.dof_values.occupation, 3 * count + 1,
+                           2);
+      configurations.push_back(configuration);
+    }
+  }
+
+  std::shared_ptr<config::Prim const> prim;
+  std::shared_ptr<config::Supercell const> supercell;
+  std::shared_ptr<config::Supercell const> supercell_cached;
+  std::vector<config::Configuration> configurations;
+};
+
+TEST_F(ThreadSafetyTest, SharedSupercellSymOp) {
+  std::vector<config::SupercellSymOp> ops(
+      config::SupercellSymOp::begin(supercell_cached),
+      config::SupercellSymOp::end(supercell_cached));
+  // the same operations, with all translation permutations stored
+  std::vector<config::SupercellSymOp> expected_ops;
+  for (auto const &op : ops) {
+    expected_ops.emplace_back(supercell, op.supercell_factor_group_index(),
+                              op.translation_index());
+  }
+
+  // every thread uses every op, in a different order
+  std::vector<Index> n_failed(n_threads, 0);
+  config::parallel_for_items(n_threads, n_threads, [&](Index i) {
+    for (Index repeat = 0; repeat < 4; ++repeat) {
+      for (Index k = 0; k < ops.size(); ++k) {
+        Index j = (k * (2 * i + 1) + repeat) % ops.size();
+        if (ops[j].translation_permute() !=
+                expected_ops[j].translation_permute() ||
+            ops[j].combined_permute() != expected_ops[j].combined_permute()) {
+          ++n_failed[i];
+        }
+      }
+    }
+  });
+  for (Index i = 0; i < n_threads; ++i) {
+    EXPECT_EQ(n_failed[i], 0);
+  }
+}
+
+TEST_F(ThreadSafetyTest, Apply) {
+  std::vector<config::SupercellSymOp> ops(
+      config::SupercellSymOp::begin(supercell_cached),
+      config::SupercellSymOp::end(supercell_cached));
+  config::Configuration configuration(supercell_cached);
+  configuration.dof_values.occupation = configurations[5].dof_values.occupation;
+  std::vector<Eigen::VectorXi> expected;
+  for (auto const &op : ops) {
+    expected.push_back(copy_apply(op, configuration).dof_values.occupation);
+  }
+
+  std::vector<Index> n_failed(ops.size(), 0);
+  config::parallel_for_items(ops.size(), n_threads, [&](Index i) {
+    for (Index j = 0; j < ops.size(); ++j) {
+      Index k = (i + j) % ops.size();
+      if (copy_apply(ops[k], configuration).dof_values.occupation !=
+          expected[k]) {
+        ++n_failed[i];
+      }
+    }
+  });
+  for (Index i = 0; i < ops.size(); ++i) {
+    EXPECT_EQ(n_failed[i], 0);
+  }
+}
+
+TEST_F(ThreadSafetyTest, Canonicalization) {
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  std::vector<config::Configuration> expected;
+  for (auto const &configuration : configurations) {
+    expected.push_back(config::make_canonical_form(configuration, begin, end));
+  }
+
+  std::vector<std::optional<config::Configuration>> canonical(
+      configurations.size());
+  config::parallel_for_items(configurations.size(), n_threads, [&](Index i) {
+    canonical[i] = config::make_canonical_form(configurations[i], begin, end);
+  });
+  for (Index i = 0; i < configurations.size(); ++i) {
+    ASSERT_TRUE(canonical[i].has_value());
+    EXPECT_EQ(canonical[i]->dof_values.occupation,
+              expected[i].dof_values.occupation);
+  }
+}
+
+TEST_F(ThreadSafetyTest, ConfigurationOrbits) {
+  auto begin = config::SupercellSymOp::begin(supercell);
+  auto end = config::SupercellSymOp::end(supercell);
+  std::vector<Index> expected;
+  for (auto const &configuration : configurations) {
+    expected.push_back(
+        config::make_equivalents(configuration, begin, end).size());
+  }
+
+  std::vector<Index> orbit_size(configurations.size(), 0);
+  config::parallel_for_items(configurations.size(), n_threads, [&](Index i) {
+    orbit_size[i] =
+        config::make_equivalents(configurations[i], begin, end).size();
+  });
+  EXPECT_EQ(orbit_size, expected);
+}
+
+TEST_F(ThreadSafetyTest, ClusterOrbits) {
+  auto const &unitcellcoord_symgroup_rep =
+      prim->sym_info.unitcellcoord_symgroup_rep;
+  std::vector<clust::IntegralCluster> prototypes;
+  for (Index i = 1; i < 9; ++i) {
+    prototypes.emplace_back(std::vector<xtal::UnitCellCoord>(
+        {xtal::UnitCellCoord(0, 0, 0, 0),
+         xtal::UnitCellCoord(0, i % 3, i / 3, 0)}));
+  }
+  std::vector<Index> expected;
+  for (auto const &prototype : prototypes) {
+    expected.push_back(
+        clust::make_prim_periodic_orbit(prototype, unitcellcoord_symgroup_rep)
+            .size());
+  }
+
+  std::vector<Index> orbit_size(prototypes.size(), 0);
+  config::parallel_for_items(prototypes.size(), n_threads, [&](Index i) {
+    orbit_size[i] =
+        clust::make_prim_periodic_orbit(prototypes[i],
+                                        unitcellcoord_symgroup_rep)
+            .size();
+  });
+  EXPECT_EQ(orbit_size, expected);
+}